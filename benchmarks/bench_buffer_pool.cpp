@@ -0,0 +1,136 @@
+/**
+ * @file bench_buffer_pool.cpp
+ * @brief Large image buffers of `BufferPool` on regular and huge pages (`BufferPool::HugePages`).
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Two access patterns that miss the TLB on regular pages:
+ * - First touch: a fresh buffer written through once (loads, working image copies).
+ * - Column walk: each column of an RGBA float image read top to bottom (vertical passes,
+ *   tiles), one page per row on regular pages.
+ */
+
+#include "bench_common.h"
+
+#include "common/memory/buffer_pool.h"
+
+#include <cstring>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using HugePages = Core::Common::BufferPool::HugePages;
+
+/**
+ * @brief Sets the pool's pages for one benchmark, restoring them (and dropping the blocks
+ *        mapped meanwhile) afterwards.
+ */
+class ScopedHugePages {
+public:
+    explicit ScopedHugePages(HugePages mode)
+        : m_previous(Core::Common::BufferPool::instance().hugePages())
+    {
+        Core::Common::BufferPool::instance().trim();
+        Core::Common::BufferPool::instance().setHugePages(mode);
+    }
+
+    ~ScopedHugePages()
+    {
+        Core::Common::BufferPool::instance().setHugePages(m_previous);
+        Core::Common::BufferPool::instance().trim();
+    }
+
+    ScopedHugePages(const ScopedHugePages&) = delete;
+    ScopedHugePages& operator=(const ScopedHugePages&) = delete;
+
+private:
+    HugePages m_previous;
+};
+
+/**
+ * @brief Skips the benchmark if `mode` maps no huge page on this host.
+ * @return true if the benchmark can run.
+ */
+bool hugePagesAvailable(benchmark::State& state, HugePages mode, std::size_t bytes)
+{
+    if (mode == HugePages::Off) {
+        return true;
+    }
+    auto& pool { Core::Common::BufferPool::instance() };
+    const std::size_t before { pool.hugePageAllocationCount() };
+    pool.release(pool.acquire(bytes), bytes);
+    pool.trim();
+    if (pool.hugePageAllocationCount() == before) {
+        state.SkipWithError("No huge pages on this host");
+        return false;
+    }
+    return true;
+}
+
+void BM_BufferFirstTouch(benchmark::State& state, HugePages mode)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+    const std::size_t bytes { static_cast<std::size_t>(width) * height * 4 * sizeof(float) };
+
+    const ScopedHugePages pages(mode);
+    if (!hugePagesAvailable(state, mode, bytes)) {
+        return;
+    }
+    auto& pool { Core::Common::BufferPool::instance() };
+
+    for (auto _ : state) {
+        // A fresh mapping each time: the pages fault in during the write
+        void* block { pool.acquire(bytes) };
+        std::memset(block, 0, bytes);
+        benchmark::DoNotOptimize(block);
+        benchmark::ClobberMemory();
+        pool.release(block, bytes);
+        state.PauseTiming();
+        pool.trim();
+        state.ResumeTiming();
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+void BM_BufferColumnWalk(benchmark::State& state, HugePages mode)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+    const std::size_t count { static_cast<std::size_t>(width) * height * 4 };
+
+    const ScopedHugePages pages(mode);
+    if (!hugePagesAvailable(state, mode, count * sizeof(float))) {
+        return;
+    }
+
+    auto pixels { Core::Common::makePooledArray<float>(count) };
+    std::memset(pixels.get(), 0, count * sizeof(float));
+
+    const std::size_t stride { static_cast<std::size_t>(width) * 4 };
+    for (auto _ : state) {
+        float sum { 0.0f };
+        for (std::size_t x = 0; x < stride; x += 4) {
+            for (std::size_t y = 0; y < height; ++y) {
+                sum += pixels[y * stride + x];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_BufferFirstTouch, regular, HugePages::Off)->Apply(applyPipelineSizes);
+BENCHMARK_CAPTURE(BM_BufferFirstTouch, transparent, HugePages::Transparent)->Apply(applyPipelineSizes);
+BENCHMARK_CAPTURE(BM_BufferFirstTouch, reserved, HugePages::Explicit)->Apply(applyPipelineSizes);
+
+BENCHMARK_CAPTURE(BM_BufferColumnWalk, regular, HugePages::Off)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_BufferColumnWalk, transparent, HugePages::Transparent)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_BufferColumnWalk, reserved, HugePages::Explicit)->Apply(applyOperationSizes);
+
+} // namespace CaptureMoment::Benchmarks
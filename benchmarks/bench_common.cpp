@@ -0,0 +1,129 @@
+/**
+ * @file bench_common.cpp
+ * @brief Implementation of the shared benchmark fixtures.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <OpenImageIO/imagebufalgo.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+
+namespace CaptureMoment::Benchmarks {
+
+void applyPipelineSizes(benchmark::internal::Benchmark* bench)
+{
+    for (const ImageSize& size : { k_12mp, k_24mp, k_60mp, k_100mp }) {
+        bench->Args({ static_cast<int64_t>(size.m_width), static_cast<int64_t>(size.m_height) });
+    }
+    bench->ArgNames({ "width", "height" })->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+void applyOperationSizes(benchmark::internal::Benchmark* bench)
+{
+    for (const ImageSize& size : { k_12mp, k_24mp }) {
+        bench->Args({ static_cast<int64_t>(size.m_width), static_cast<int64_t>(size.m_height) });
+    }
+    bench->ArgNames({ "width", "height" })->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+std::unique_ptr<Core::Common::ImageRegion> makeGradientImage(Core::Common::ImageDim width,
+                                                             Core::Common::ImageDim height)
+{
+    Core::Common::PixelBuffer data(width * height * 4);
+
+    // Horizontal ramp over 0..2 (highlights above 1.0), vertical tint, slow ripple for texture
+    float* pixel { data.data() };
+    for (Core::Common::ImageDim y = 0; y < height; ++y) {
+        const float v { static_cast<float>(y) / static_cast<float>(height) };
+        for (Core::Common::ImageDim x = 0; x < width; ++x) {
+            const float u { static_cast<float>(x) / static_cast<float>(width) };
+            const float ripple { 0.05f * std::sin(static_cast<float>(x + y) * 0.01f) };
+            pixel[0] = 2.0f * u * u + ripple;
+            pixel[1] = 2.0f * u * (0.5f + 0.5f * v);
+            pixel[2] = 2.0f * u * (1.0f - 0.5f * v) - ripple;
+            pixel[3] = 1.0f;
+            pixel += 4;
+        }
+    }
+
+    return std::make_unique<Core::Common::ImageRegion>(std::move(data), width, height, 4);
+}
+
+const std::filesystem::path& scratchDirectory()
+{
+    static const std::filesystem::path directory = [] {
+        auto path { std::filesystem::temp_directory_path() / "capturemoment_benchmarks" };
+        std::error_code error;
+        std::filesystem::create_directories(path, error);
+        return path;
+    }();
+    return directory;
+}
+
+std::string writeTestImage(const std::string& name, int width, int height)
+{
+    static std::mutex write_mutex;
+    std::lock_guard lock(write_mutex);
+
+    const auto path { scratchDirectory() / name };
+    if (std::filesystem::exists(path)) {
+        return path.string();
+    }
+
+    OIIO::ImageSpec spec(width, height, 4, OIIO::TypeDesc::UINT16);
+    spec.tile_width = 256;
+    spec.tile_height = 256;
+    spec.alpha_channel = 3;
+
+    OIIO::ImageBuf image(spec);
+    const float top_left[] { 0.0f, 0.0f, 0.1f, 1.0f };
+    const float top_right[] { 1.0f, 0.6f, 0.2f, 1.0f };
+    const float bottom_left[] { 0.1f, 0.2f, 0.0f, 1.0f };
+    const float bottom_right[] { 0.9f, 1.0f, 0.8f, 1.0f };
+    OIIO::ImageBufAlgo::fill(image, top_left, top_right, bottom_left, bottom_right);
+
+    if (!image.write(path.string())) {
+        spdlog::error("[writeTestImage]: Cannot write '{}': {}", path.string(), image.geterror());
+        return {};
+    }
+    return path.string();
+}
+
+void setPixelCounters(benchmark::State& state, Core::Common::ImageDim width, Core::Common::ImageDim height)
+{
+    const auto pixels { static_cast<int64_t>(width * height) };
+    state.SetItemsProcessed(state.iterations() * pixels);
+    state.counters["megapixels"] = static_cast<double>(pixels) / 1.0e6;
+}
+
+void LatencySeries::merge(const LatencySeries& other)
+{
+    m_samples_ms.insert(m_samples_ms.end(), other.m_samples_ms.begin(), other.m_samples_ms.end());
+}
+
+void LatencySeries::print(std::string_view phase)
+{
+    if (m_samples_ms.empty()) {
+        std::printf("  %-12s %8s\n", std::string(phase).c_str(), "-");
+        return;
+    }
+    std::ranges::sort(m_samples_ms);
+    std::printf("  %-12s %8zu %9.2f %9.2f %9.2f %9.2f\n", std::string(phase).c_str(), m_samples_ms.size(),
+                percentile(50.0), percentile(95.0), percentile(99.0), m_samples_ms.back());
+}
+
+double LatencySeries::percentile(double p) const
+{
+    const auto rank { static_cast<std::size_t>(std::ceil(p / 100.0 * static_cast<double>(m_samples_ms.size()))) };
+    return m_samples_ms[std::clamp<std::size_t>(rank, 1, m_samples_ms.size()) - 1];
+}
+
+} // namespace CaptureMoment::Benchmarks
@@ -0,0 +1,114 @@
+/**
+ * @file bench_common.h
+ * @brief Shared fixtures of the benchmark suite (synthetic images, scratch files, sizes).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/image_region.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+/**
+ * @brief Sensor sizes of the suite, in pixels (width, height).
+ */
+struct ImageSize {
+    Core::Common::ImageDim m_width;
+    Core::Common::ImageDim m_height;
+};
+
+/** @brief 12 MP (4000 x 3000). */
+inline constexpr ImageSize k_12mp { 4000, 3000 };
+/** @brief 24 MP (6000 x 4000). */
+inline constexpr ImageSize k_24mp { 6000, 4000 };
+/** @brief 60 MP (9504 x 6336). */
+inline constexpr ImageSize k_60mp { 9504, 6336 };
+/** @brief 100 MP (11648 x 8736). */
+inline constexpr ImageSize k_100mp { 11648, 8736 };
+
+/**
+ * @brief Adds the 12/24/60/100 MP sizes as (width, height) arguments.
+ */
+void applyPipelineSizes(benchmark::internal::Benchmark* bench);
+
+/**
+ * @brief Adds the 12/24 MP sizes as (width, height) arguments (per-operation benchmarks).
+ */
+void applyOperationSizes(benchmark::internal::Benchmark* bench);
+
+/**
+ * @brief Creates a linear RGBA_F32 image with smooth gradients (all tonal ranges covered).
+ */
+[[nodiscard]] std::unique_ptr<Core::Common::ImageRegion> makeGradientImage(Core::Common::ImageDim width,
+                                                                           Core::Common::ImageDim height);
+
+/**
+ * @brief Directory for the files written by the benchmarks (created on first use).
+ */
+[[nodiscard]] const std::filesystem::path& scratchDirectory();
+
+/**
+ * @brief Writes (once) a 16-bit tiled TIFF gradient into the scratch directory.
+ *
+ * @param name File name, unique per size.
+ * @return The file path, or an empty string if it cannot be written.
+ */
+[[nodiscard]] std::string writeTestImage(const std::string& name, int width, int height);
+
+/**
+ * @brief Reports pixels per second and the image size in megapixels.
+ */
+void setPixelCounters(benchmark::State& state, Core::Common::ImageDim width, Core::Common::ImageDim height);
+
+/**
+ * @brief Latency samples of one phase, in milliseconds (scenario runners; not thread-safe).
+ */
+class LatencySeries {
+public:
+    /**
+     * @brief Records one sample.
+     */
+    void add(std::chrono::steady_clock::duration duration)
+    {
+        m_samples_ms.push_back(std::chrono::duration<double, std::milli>(duration).count());
+    }
+
+    /**
+     * @brief Appends the samples of another series (per-thread series merged after a run).
+     */
+    void merge(const LatencySeries& other);
+
+    /**
+     * @brief Number of samples.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_samples_ms.size(); }
+
+    /**
+     * @brief Prints one row: count, p50, p95, p99 and max, in milliseconds.
+     */
+    void print(std::string_view phase);
+
+private:
+    /**
+     * @brief Nearest-rank percentile of the sorted samples.
+     */
+    [[nodiscard]] double percentile(double p) const;
+
+    /**
+     * @brief Samples, in milliseconds.
+     */
+    std::vector<double> m_samples_ms;
+};
+
+} // namespace CaptureMoment::Benchmarks
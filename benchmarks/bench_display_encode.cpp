@@ -0,0 +1,48 @@
+/**
+ * @file bench_display_encode.cpp
+ * @brief Linear float to sRGB RGBA8 display conversion (`encodeLinearToSrgb8`).
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * The conversion the display items run on the CPU when the engine hands over linear data.
+ */
+
+#include "bench_common.h"
+
+#include "rendering/srgb_encoder.h"
+
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+void BM_DisplayEncodeSrgb8(benchmark::State& state)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+
+    const auto source { makeGradientImage(width, height) };
+    std::vector<std::uint8_t> display(width * height * 4);
+
+    for (auto _ : state) {
+        UI::Rendering::encodeLinearToSrgb8(source->m_data.data(), display.data(), width * height);
+        benchmark::DoNotOptimize(display.data());
+        benchmark::ClobberMemory();
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+} // anonymous namespace
+
+// Display sizes: 1080p, 1440p, 4K, 5K
+BENCHMARK(BM_DisplayEncodeSrgb8)
+    ->Args({ 1920, 1080 })
+    ->Args({ 2560, 1440 })
+    ->Args({ 3840, 2160 })
+    ->Args({ 5120, 2880 })
+    ->ArgNames({ "width", "height" })
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace CaptureMoment::Benchmarks
@@ -0,0 +1,65 @@
+/**
+ * @file bench_downsample.cpp
+ * @brief Display downsample (`IWorkingImageHardware::downsample`) on the CPU and the GPU.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include "config/app_config.h"
+#include "image_processing/factories/working_image_factory.h"
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+/**
+ * @brief Long edge of the display image (a 1440p screen).
+ */
+constexpr Core::Common::ImageDim k_display_long_edge { 2560 };
+
+void BM_Downsample(benchmark::State& state, Core::Common::MemoryType backend)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+
+    if (backend == Core::Common::MemoryType::GPU_MEMORY && !Core::Config::AppConfig::hasGpuHalideTarget()) {
+        state.SkipWithError("No GPU Halide target on this machine");
+        return;
+    }
+
+    const auto source { makeGradientImage(width, height) };
+    auto working { Core::ImageProcessing::WorkingImageFactory::create(*source, backend) };
+    if (!working) {
+        state.SkipWithError("Working image unavailable on this backend");
+        return;
+    }
+
+    const Core::Common::ImageDim target_width { k_display_long_edge };
+    const Core::Common::ImageDim target_height { height * k_display_long_edge / width };
+
+    // Kernel compilation stays out of the measurement
+    if (!working->downsample(target_width, target_height)) {
+        state.SkipWithError("downsample failed");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto display { working->downsample(target_width, target_height) };
+        if (!display) {
+            state.SkipWithError("downsample failed");
+            return;
+        }
+        benchmark::DoNotOptimize(display);
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_Downsample, cpu, Core::Common::MemoryType::CPU_RAM)->Apply(applyPipelineSizes);
+BENCHMARK_CAPTURE(BM_Downsample, gpu, Core::Common::MemoryType::GPU_MEMORY)->Apply(applyPipelineSizes);
+
+} // namespace CaptureMoment::Benchmarks
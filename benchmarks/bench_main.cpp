@@ -0,0 +1,40 @@
+/**
+ * @file bench_main.cpp
+ * @brief Entry point of the benchmark suite: core initialization and run context.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Results are emitted as JSON with the standard Google Benchmark flags:
+ *   capturemoment_benchmarks --benchmark_out=results.json --benchmark_out_format=json
+ * (the `run_benchmarks` target passes them). The JSON context records the Halide targets,
+ * so results from different machines of the fleet can be told apart.
+ */
+
+#include "core_initialization.h"
+#include "config/app_config.h"
+
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // Backends, Halide targets and working image factories, as the application does at startup
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(spdlog::level::warn);
+
+    using CaptureMoment::Core::Config::AppConfig;
+    benchmark::AddCustomContext("halide_target", AppConfig::getHalideTarget().to_string());
+    benchmark::AddCustomContext("halide_gpu_target",
+                                AppConfig::hasGpuHalideTarget()
+                                    ? AppConfig::getHalideTarget(CaptureMoment::Core::Common::MemoryType::GPU_MEMORY).to_string()
+                                    : std::string("none"));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
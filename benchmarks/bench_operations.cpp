@@ -0,0 +1,74 @@
+/**
+ * @file bench_operations.cpp
+ * @brief Standalone `IOperation::execute` of each tone operation (unfused, CPU working image).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include "image_processing/factories/working_image_factory.h"
+#include "operations/operation_factory.h"
+#include "operations/operation_registry.h"
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using Core::Operations::OperationType;
+
+const Core::Operations::OperationFactory& operationFactory()
+{
+    static const auto factory = [] {
+        Core::Operations::OperationFactory registered;
+        Core::Operations::OperationRegistry::registerAll(registered);
+        return registered;
+    }();
+    return factory;
+}
+
+void BM_OperationExecute(benchmark::State& state, OperationType type)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+
+    Core::Operations::OperationDescriptor descriptor;
+    descriptor.type = type;
+    descriptor.name = "benchmark";
+    descriptor.enabled = true;
+    descriptor.setParam(Core::Operations::ParameterKey::Value, 0.3f);
+
+    auto operation { operationFactory().create(descriptor) };
+    if (!operation) {
+        state.SkipWithError("Operation not registered");
+        return;
+    }
+
+    const auto source { makeGradientImage(width, height) };
+    auto working { Core::ImageProcessing::WorkingImageFactory::create(*source, Core::Common::MemoryType::CPU_RAM) };
+    if (!working) {
+        state.SkipWithError("No CPU working image");
+        return;
+    }
+
+    // Repeated on the same image: the values drift, the cost per pixel does not
+    for (auto _ : state) {
+        if (!(*operation)->execute(*working, descriptor)) {
+            state.SkipWithError("execute failed");
+            return;
+        }
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_OperationExecute, brightness, OperationType::Brightness)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_OperationExecute, contrast, OperationType::Contrast)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_OperationExecute, highlights, OperationType::Highlights)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_OperationExecute, shadows, OperationType::Shadows)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_OperationExecute, whites, OperationType::Whites)->Apply(applyOperationSizes);
+BENCHMARK_CAPTURE(BM_OperationExecute, blacks, OperationType::Blacks)->Apply(applyOperationSizes);
+
+} // namespace CaptureMoment::Benchmarks
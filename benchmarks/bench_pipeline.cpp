@@ -0,0 +1,97 @@
+/**
+ * @file bench_pipeline.cpp
+ * @brief Fused `OperationPipelineExecutor` over all tone operations, 12 to 100 MP, CPU and GPU.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include "config/app_config.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "operations/operation_factory.h"
+#include "operations/operation_registry.h"
+#include "pipeline/operation_pipeline_executor.h"
+#include "pipeline/pipeline_builder.h"
+
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using Core::Operations::OperationType;
+
+/**
+ * @brief One descriptor per tone operation, as a typical edit.
+ */
+std::vector<Core::Operations::OperationDescriptor> toneEdit()
+{
+    std::vector<Core::Operations::OperationDescriptor> operations;
+    const std::pair<OperationType, float> values[] {
+        { OperationType::Brightness, 0.05f }, { OperationType::Contrast, 0.2f },
+        { OperationType::Highlights, -0.4f }, { OperationType::Shadows, 0.3f },
+        { OperationType::Whites, 0.1f },      { OperationType::Blacks, -0.1f },
+    };
+
+    for (const auto& [type, value] : values) {
+        Core::Operations::OperationDescriptor descriptor;
+        descriptor.type = type;
+        descriptor.name = "benchmark";
+        descriptor.enabled = true;
+        descriptor.setParam(Core::Operations::ParameterKey::Value, value);
+        operations.push_back(std::move(descriptor));
+    }
+    return operations;
+}
+
+void BM_FusedPipeline(benchmark::State& state, Core::Common::MemoryType backend)
+{
+    const auto width { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const auto height { static_cast<Core::Common::ImageDim>(state.range(1)) };
+
+    if (backend == Core::Common::MemoryType::GPU_MEMORY && !Core::Config::AppConfig::hasGpuHalideTarget()) {
+        state.SkipWithError("No GPU Halide target on this machine");
+        return;
+    }
+
+    Core::Operations::OperationFactory factory;
+    Core::Operations::OperationRegistry::registerAll(factory);
+
+    auto base_executor { Core::Pipeline::PipelineBuilder::build(Core::Pipeline::PipelineType::HalideOperation) };
+    auto* executor { dynamic_cast<Core::Pipeline::OperationPipelineExecutor*>(base_executor.get()) };
+    if (!executor) {
+        state.SkipWithError("No Halide executor");
+        return;
+    }
+    executor->init(toneEdit(), factory);
+
+    const auto source { makeGradientImage(width, height) };
+    auto working { Core::ImageProcessing::WorkingImageFactory::create(*source, backend) };
+    if (!working) {
+        state.SkipWithError("Working image unavailable on this backend");
+        return;
+    }
+
+    // JIT compilation and first transfers stay out of the measurement
+    if (!executor->execute(*working)) {
+        state.SkipWithError("execute failed");
+        return;
+    }
+
+    for (auto _ : state) {
+        if (!executor->execute(*working)) {
+            state.SkipWithError("execute failed");
+            return;
+        }
+    }
+
+    setPixelCounters(state, width, height);
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_FusedPipeline, cpu, Core::Common::MemoryType::CPU_RAM)->Apply(applyPipelineSizes);
+BENCHMARK_CAPTURE(BM_FusedPipeline, gpu, Core::Common::MemoryType::GPU_MEMORY)->Apply(applyPipelineSizes);
+
+} // namespace CaptureMoment::Benchmarks
@@ -0,0 +1,75 @@
+/**
+ * @file bench_source_manager.cpp
+ * @brief `SourceManager::getTile` on a decoded source and on a tile-backed source.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include "config/app_config.h"
+#include "managers/source_manager.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+constexpr int k_source_width { static_cast<int>(k_24mp.m_width) };
+constexpr int k_source_height { static_cast<int>(k_24mp.m_height) };
+
+/**
+ * @brief Reads tiles of state.range(0) pixels, walking the whole image so caches see real traffic.
+ *
+ * @param tile_backed true to load through the OIIO tile cache instead of decoding up front.
+ */
+void BM_SourceGetTile(benchmark::State& state, bool tile_backed)
+{
+    const std::string path { writeTestImage("source_24mp.tif", k_source_width, k_source_height) };
+    if (path.empty()) {
+        state.SkipWithError("Cannot write the test image");
+        return;
+    }
+
+    auto& config { Core::Config::AppConfig::instance() };
+    const std::uint64_t tiled_min_pixels { config.getTiledSourceMinPixels() };
+    config.setTiledSourceMinPixels(tile_backed ? 1 : std::numeric_limits<std::uint64_t>::max());
+
+    Core::Managers::SourceManager source;
+    const auto loaded { source.loadFile(path) };
+    config.setTiledSourceMinPixels(tiled_min_pixels);
+
+    if (!loaded) {
+        state.SkipWithError("loadFile failed");
+        return;
+    }
+
+    const auto tile_size { static_cast<Core::Common::ImageDim>(state.range(0)) };
+    const Core::Common::ImageDim columns { source.width() / tile_size };
+    const Core::Common::ImageDim rows { source.height() / tile_size };
+    Core::Common::ImageDim index { 0 };
+
+    for (auto _ : state) {
+        const Core::Common::ImageDim x { (index % columns) * tile_size };
+        const Core::Common::ImageDim y { ((index / columns) % rows) * tile_size };
+        ++index;
+
+        auto tile { source.getTile(x, y, tile_size, tile_size) };
+        if (!tile) {
+            state.SkipWithError("getTile failed");
+            return;
+        }
+        benchmark::DoNotOptimize(tile);
+    }
+
+    setPixelCounters(state, tile_size, tile_size);
+}
+
+} // anonymous namespace
+
+BENCHMARK_CAPTURE(BM_SourceGetTile, decoded, false)->Arg(256)->Arg(512)->Arg(1024)->ArgName("tile")->UseRealTime();
+BENCHMARK_CAPTURE(BM_SourceGetTile, tile_backed, true)->Arg(256)->Arg(512)->Arg(1024)->ArgName("tile")->UseRealTime();
+
+} // namespace CaptureMoment::Benchmarks
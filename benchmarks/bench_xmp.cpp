@@ -0,0 +1,99 @@
+/**
+ * @file bench_xmp.cpp
+ * @brief XMP sidecar save and load of an edit (`FileSerializerManager`, Exiv2).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bench_common.h"
+
+#include "operations/operation_descriptor.h"
+#include "serializer/file_serializer_manager.h"
+#include "serializer/file_serializer_reader.h"
+#include "serializer/file_serializer_writer.h"
+#include "serializer/provider/exiv2_provider.h"
+#include "serializer/strategy/sidecar_xmp_path_strategy.h"
+
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using Core::Operations::OperationType;
+
+std::unique_ptr<Core::Serializer::FileSerializerManager> makeSerializer()
+{
+    return std::make_unique<Core::Serializer::FileSerializerManager>(
+        std::make_unique<Core::Serializer::FileSerializerWriter>(
+            std::make_unique<Core::Serializer::Exiv2Provider>(),
+            std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()),
+        std::make_unique<Core::Serializer::FileSerializerReader>(
+            std::make_unique<Core::Serializer::Exiv2Provider>(),
+            std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()));
+}
+
+std::vector<Core::Operations::OperationDescriptor> sampleEdit()
+{
+    std::vector<Core::Operations::OperationDescriptor> operations;
+    for (const OperationType type : { OperationType::Brightness, OperationType::Contrast, OperationType::Highlights,
+                                      OperationType::Shadows, OperationType::Whites, OperationType::Blacks }) {
+        Core::Operations::OperationDescriptor descriptor;
+        descriptor.type = type;
+        descriptor.name = "benchmark";
+        descriptor.enabled = true;
+        descriptor.setParam(Core::Operations::ParameterKey::Value, 0.25f);
+        operations.push_back(std::move(descriptor));
+    }
+    return operations;
+}
+
+void BM_XmpSave(benchmark::State& state)
+{
+    const std::string path { writeTestImage("xmp_source.tif", 64, 64) };
+    if (path.empty()) {
+        state.SkipWithError("Cannot write the test image");
+        return;
+    }
+
+    const auto serializer { makeSerializer() };
+    const auto operations { sampleEdit() };
+
+    for (auto _ : state) {
+        if (!serializer->saveToFile(path, operations)) {
+            state.SkipWithError("saveToFile failed");
+            return;
+        }
+    }
+}
+
+void BM_XmpLoad(benchmark::State& state)
+{
+    const std::string path { writeTestImage("xmp_source.tif", 64, 64) };
+    if (path.empty()) {
+        state.SkipWithError("Cannot write the test image");
+        return;
+    }
+
+    const auto serializer { makeSerializer() };
+    if (!serializer->saveToFile(path, sampleEdit())) {
+        state.SkipWithError("saveToFile failed");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto operations { serializer->loadFromFile(path) };
+        if (operations.empty()) {
+            state.SkipWithError("loadFromFile returned no operation");
+            return;
+        }
+        benchmark::DoNotOptimize(operations);
+    }
+}
+
+} // anonymous namespace
+
+BENCHMARK(BM_XmpSave)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_XmpLoad)->Unit(benchmark::kMicrosecond);
+
+} // namespace CaptureMoment::Benchmarks
@@ -0,0 +1,397 @@
+/**
+ * @file latency_runner.cpp
+ * @brief Headless "slider-to-photon" scenario runner: replays slider moves through `PhotoEngine`.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Loads a file, then replays a slider sequence at UI rate (60-120 Hz) through
+ * `applyOperations`, the way the image controller does: every tick submits the full list of
+ * active operations, and a display thread waits for each future and fetches the display image
+ * (the fused one, or a downsample encoded to sRGB).
+ *
+ * Reports per-request latency percentiles (p50/p95/p99) for each phase:
+ * - queueing: submission to launch of the pass (waiting for the previous pass);
+ * - pipeline: launch to settlement of the pass;
+ * - downsample / encode: display image of a completed pass (skipped when fused);
+ * - total: submission to display image ready;
+ * and the share of requests coalesced (superseded before they ran) or dropped (aborted mid-pass).
+ *
+ * Usage:
+ *   capturemoment_latency [--image PATH] [--sequence FILE.csv] [--rate HZ] [--seconds S]
+ *                         [--display WxH] [--proxy]
+ *
+ * The sequence file holds one slider move per line: `time_ms,operation,value`
+ * (e.g. `16.7,Exposure,0.25`; `#` starts a comment). Without one, a sine sweep of the
+ * exposure slider is generated at `--rate`. Without `--image`, a 24 MP test TIFF is written.
+ */
+
+#include "bench_common.h"
+
+#include "core_initialization.h"
+#include "engine/photo_engine.h"
+#include "operations/operation_descriptor.h"
+#include "rendering/srgb_encoder.h"
+
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using Clock = Core::Common::ProcessingTimings::Clock;
+using Core::Operations::OperationType;
+
+/**
+ * @brief One recorded slider move.
+ */
+struct SliderEvent {
+    /** @brief Offset from the start of the replay. */
+    Clock::duration m_at{};
+    /** @brief Slider that moved. */
+    OperationType m_type{OperationType::Exposure};
+    /** @brief Its new value. */
+    float m_value{0.0f};
+};
+
+/**
+ * @brief Command-line options of the runner.
+ */
+struct RunnerOptions {
+    std::string m_image_path;
+    std::string m_sequence_path;
+    double m_rate_hz{120.0};
+    double m_seconds{5.0};
+    Core::Common::ImageDim m_display_width{2560};
+    Core::Common::ImageDim m_display_height{1440};
+    bool m_use_proxy{false};
+};
+
+/**
+ * @brief A submitted request, handed to the display thread.
+ */
+struct InFlightRequest {
+    Clock::time_point m_submitted{};
+    std::future<Core::Common::ProcessingOutcome> m_future;
+};
+
+std::optional<RunnerOptions> parseOptions(int argc, char** argv)
+{
+    RunnerOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg { argv[i] };
+        const bool has_value { i + 1 < argc };
+
+        if (arg == "--proxy") {
+            options.m_use_proxy = true;
+        } else if (arg == "--image" && has_value) {
+            options.m_image_path = argv[++i];
+        } else if (arg == "--sequence" && has_value) {
+            options.m_sequence_path = argv[++i];
+        } else if (arg == "--rate" && has_value) {
+            options.m_rate_hz = std::stod(argv[++i]);
+        } else if (arg == "--seconds" && has_value) {
+            options.m_seconds = std::stod(argv[++i]);
+        } else if (arg == "--display" && has_value) {
+            unsigned width { 0 };
+            unsigned height { 0 };
+            if (std::sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width == 0 || height == 0) {
+                return std::nullopt;
+            }
+            options.m_display_width = width;
+            options.m_display_height = height;
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    if (options.m_rate_hz <= 0.0 || options.m_seconds <= 0.0) {
+        return std::nullopt;
+    }
+    return options;
+}
+
+/**
+ * @brief Reads a `time_ms,operation,value` sequence (operation names as in `OperationType`).
+ */
+std::vector<SliderEvent> loadSequence(const std::string& path)
+{
+    std::vector<SliderEvent> events;
+    std::ifstream file(path);
+    if (!file) {
+        spdlog::error("[LatencyRunner::loadSequence]: Cannot open '{}'", path);
+        return events;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string time_ms;
+        std::string name;
+        std::string value;
+        if (!std::getline(fields, time_ms, ',') || !std::getline(fields, name, ',') || !std::getline(fields, value)) {
+            spdlog::warn("[LatencyRunner::loadSequence]: Skipping malformed line '{}'", line);
+            continue;
+        }
+
+        const auto type { magic_enum::enum_cast<OperationType>(name, magic_enum::case_insensitive) };
+        if (!type) {
+            spdlog::warn("[LatencyRunner::loadSequence]: Unknown operation '{}'", name);
+            continue;
+        }
+
+        const std::chrono::duration<double, std::milli> at { std::stod(time_ms) };
+        events.push_back({ std::chrono::duration_cast<Clock::duration>(at), *type, std::stof(value) });
+    }
+
+    std::ranges::stable_sort(events, {}, &SliderEvent::m_at);
+    return events;
+}
+
+/**
+ * @brief Sine sweep of the exposure slider, one move per tick (a drag back and forth).
+ */
+std::vector<SliderEvent> generateSweep(double rate_hz, double seconds)
+{
+    std::vector<SliderEvent> events;
+    const auto ticks { static_cast<std::size_t>(rate_hz * seconds) };
+    events.reserve(ticks);
+
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+        const double t { static_cast<double>(tick) / rate_hz };
+        const std::chrono::duration<double> at { t };
+        const auto value { static_cast<float>(1.5 * std::sin(2.0 * std::numbers::pi * 0.5 * t)) };
+        events.push_back({ std::chrono::duration_cast<Clock::duration>(at), OperationType::Exposure, value });
+    }
+    return events;
+}
+
+/**
+ * @brief Active operations for the current slider values, in pipeline order.
+ */
+std::vector<Core::Operations::OperationDescriptor> buildOperations(const std::map<OperationType, float>& sliders)
+{
+    std::vector<Core::Operations::OperationDescriptor> operations;
+    operations.reserve(sliders.size());
+
+    for (const auto& [type, value] : sliders) {
+        Core::Operations::OperationDescriptor descriptor;
+        descriptor.type = type;
+        descriptor.name = std::string(magic_enum::enum_name(type));
+        descriptor.enabled = true;
+        descriptor.setParam(Core::Operations::ParameterKey::Value, value);
+        operations.push_back(std::move(descriptor));
+    }
+    return operations;
+}
+
+void printUsage()
+{
+    std::printf("Usage: capturemoment_latency [--image PATH] [--sequence FILE.csv] [--rate HZ] [--seconds S]\n"
+                "                             [--display WxH] [--proxy]\n");
+}
+
+int runLatencyScenario(const RunnerOptions& options)
+{
+    // 1. Scenario input
+    const std::string image_path { options.m_image_path.empty()
+                                       ? writeTestImage("latency_24mp.tif", static_cast<int>(k_24mp.m_width),
+                                                        static_cast<int>(k_24mp.m_height))
+                                       : options.m_image_path };
+    if (image_path.empty()) {
+        spdlog::error("[LatencyRunner]: No input image");
+        return 1;
+    }
+
+    const auto events { options.m_sequence_path.empty() ? generateSweep(options.m_rate_hz, options.m_seconds)
+                                                         : loadSequence(options.m_sequence_path) };
+    if (events.empty()) {
+        spdlog::error("[LatencyRunner]: Empty slider sequence");
+        return 1;
+    }
+
+    // 2. Engine, set up as the image controller does
+    Core::Engine::PhotoEngine engine;
+    if (auto loaded = engine.loadImage(image_path); !loaded) {
+        spdlog::error("[LatencyRunner]: Cannot load '{}'", image_path);
+        return 1;
+    }
+
+    const Core::Common::ImageDim display_width { std::min(options.m_display_width, engine.width()) };
+    const Core::Common::ImageDim display_height { std::min(options.m_display_height, engine.height()) };
+
+    if (options.m_use_proxy) {
+        if (auto proxy = engine.prepareProxy(display_width, display_height); !proxy) {
+            spdlog::error("[LatencyRunner]: Cannot prepare the proxy");
+            return 1;
+        }
+    }
+    engine.setDisplayOutputSize(display_width, display_height);
+
+    // 3. Engine-side phases, reported as each request settles
+    std::mutex stats_mutex;
+    LatencySeries queueing;
+    LatencySeries pipeline;
+    std::map<Core::Common::ProcessingOutcome, std::size_t> outcomes;
+    std::size_t coalesced { 0 };
+    std::size_t dropped { 0 };
+
+    engine.setProcessingTimingsCallback([&](const Core::Common::ProcessingTimings& timings) {
+        std::lock_guard lock(stats_mutex);
+        ++outcomes[timings.m_outcome];
+
+        if (!timings.ran()) {
+            ++coalesced;
+            return;
+        }
+        queueing.add(timings.queueing());
+        pipeline.add(timings.pipeline());
+        if (timings.m_outcome != Core::Common::ProcessingOutcome::Completed) {
+            ++dropped;
+        }
+    });
+
+    // 4. Display thread: settles the futures in submission order, then fetches the display image
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<InFlightRequest> in_flight;
+    bool replay_done { false };
+
+    LatencySeries downsample;
+    LatencySeries encode;
+    LatencySeries total;
+    std::size_t fused { 0 };
+
+    std::thread display_thread([&] {
+        std::vector<std::uint8_t> display;
+
+        while (true) {
+            InFlightRequest request;
+            {
+                std::unique_lock lock(queue_mutex);
+                queue_cv.wait(lock, [&] { return replay_done || !in_flight.empty(); });
+                if (in_flight.empty()) {
+                    return;
+                }
+                request = std::move(in_flight.front());
+                in_flight.pop_front();
+            }
+
+            if (request.m_future.get() != Core::Common::ProcessingOutcome::Completed) {
+                continue;
+            }
+
+            if (auto image = engine.takeDisplayImage()) {
+                ++fused;
+                total.add(Clock::now() - request.m_submitted);
+                continue;
+            }
+
+            const auto downsample_start { Clock::now() };
+            auto region = engine.getDownsampledDisplayImage(display_width, display_height);
+            if (!region) {
+                continue;
+            }
+            const auto encode_start { Clock::now() };
+
+            const Core::Common::ImageRegion& image { *region.value() };
+            display.resize(static_cast<std::size_t>(image.m_width) * image.m_height * 4);
+            UI::Rendering::encodeLinearToSrgb8(image.m_data.data(), display.data(),
+                                               static_cast<std::size_t>(image.m_width) * image.m_height);
+            const auto encode_end { Clock::now() };
+
+            downsample.add(encode_start - downsample_start);
+            encode.add(encode_end - encode_start);
+            total.add(encode_end - request.m_submitted);
+        }
+    });
+
+    // 5. Replay at the recorded times
+    std::map<OperationType, float> sliders;
+    const auto replay_start { Clock::now() };
+
+    for (const SliderEvent& event : events) {
+        std::this_thread::sleep_until(replay_start + event.m_at);
+        sliders[event.m_type] = event.m_value;
+
+        InFlightRequest request;
+        request.m_submitted = Clock::now();
+        request.m_future = options.m_use_proxy ? engine.applyOperationsToProxy(buildOperations(sliders))
+                                               : engine.applyOperations(buildOperations(sliders));
+        {
+            std::lock_guard lock(queue_mutex);
+            in_flight.push_back(std::move(request));
+        }
+        queue_cv.notify_one();
+    }
+    const auto replay_end { Clock::now() };
+
+    {
+        std::lock_guard lock(queue_mutex);
+        replay_done = true;
+    }
+    queue_cv.notify_one();
+    display_thread.join();
+    engine.setProcessingTimingsCallback({});
+
+    // 6. Report
+    const double replay_s { std::chrono::duration<double>(replay_end - replay_start).count() };
+    const std::size_t submitted { events.size() };
+    const auto share = [submitted](std::size_t count) { return 100.0 * static_cast<double>(count) / static_cast<double>(submitted); };
+
+    std::printf("Scenario: %s, %zu requests over %.2f s (%.1f Hz), display %zux%zu%s\n", image_path.c_str(), submitted,
+                replay_s, static_cast<double>(submitted) / replay_s, display_width, display_height,
+                options.m_use_proxy ? ", proxy" : "");
+    std::printf("  %-12s %8s %9s %9s %9s %9s   (ms)\n", "phase", "count", "p50", "p95", "p99", "max");
+    queueing.print("queueing");
+    pipeline.print("pipeline");
+    downsample.print("downsample");
+    encode.print("encode");
+    total.print("total");
+
+    std::printf("  completed %zu, coalesced %zu (%.1f%%), dropped mid-pass %zu (%.1f%%), failed %zu, fused display %zu\n",
+                outcomes[Core::Common::ProcessingOutcome::Completed], coalesced, share(coalesced), dropped, share(dropped),
+                outcomes[Core::Common::ProcessingOutcome::Failed], fused);
+    return 0;
+}
+
+} // anonymous namespace
+
+} // namespace CaptureMoment::Benchmarks
+
+int main(int argc, char** argv)
+{
+    const auto options { CaptureMoment::Benchmarks::parseOptions(argc, argv) };
+    if (!options) {
+        CaptureMoment::Benchmarks::printUsage();
+        return 1;
+    }
+
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(spdlog::level::warn);
+
+    return CaptureMoment::Benchmarks::runLatencyScenario(*options);
+}
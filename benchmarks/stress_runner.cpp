@@ -0,0 +1,395 @@
+/**
+ * @file stress_runner.cpp
+ * @brief Headless concurrency stress of `StateImageManager`: many submitters, readers and reloads at once.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Where `capturemoment_latency` replays one slider at UI rate, this runner hammers the manager
+ * from several threads at once, the way the production load reaches it: interactive slider
+ * moves, display refreshes, thumbnail-strip reloads.
+ * - `--submitters` threads call `applyOperations` at `--rate` Hz each, every thread moving its
+ *   own slider and submitting the full list of operations;
+ * - `--readers` threads call `getDownsampledDisplayImage` at `--display-rate` Hz each;
+ * - one loader thread alternates between two images with `loadImage` every `--load-ms`
+ *   (0: never), cancelling whatever runs.
+ *
+ * Reports the submission and pass throughput, latency percentiles (submission to settlement
+ * of each future, queueing, pipeline, display image, load), the share of requests coalesced
+ * (superseded before they ran), aborted mid-pass or cancelled, and checks the settlement
+ * contract: every future settles within `--settle-timeout` seconds after the run, and the
+ * timings callback sees every request exactly once. A violated contract, a failed load or
+ * a failed pass makes the exit status 1, so that the runner can gate a change of the
+ * scheduler, of the cancellation or of the result handoff, in particular in a
+ * `-DENABLE_TSAN=ON` build (see BUILDING_MAIN.md).
+ *
+ * Usage:
+ *   capturemoment_stress [--image PATH] [--submitters N] [--rate HZ] [--readers N]
+ *                        [--display-rate HZ] [--load-ms MS] [--seconds S] [--display WxH]
+ *                        [--settle-timeout S]
+ *
+ * Without `--image`, 12 MP test TIFFs are written (the loader alternates with a second one).
+ */
+
+#include "bench_common.h"
+
+#include "core_initialization.h"
+#include "managers/state_image_manager.h"
+#include "operations/operation_descriptor.h"
+
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <future>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace CaptureMoment::Benchmarks {
+
+namespace {
+
+using Clock = Core::Common::ProcessingTimings::Clock;
+using Core::Common::ProcessingOutcome;
+using Core::Operations::OperationType;
+
+/**
+ * @brief Sliders moved by the submitters, one per thread (round robin beyond six threads).
+ */
+constexpr std::array k_sliders {
+    OperationType::Exposure, OperationType::Contrast, OperationType::Highlights,
+    OperationType::Shadows, OperationType::Whites, OperationType::Blacks
+};
+
+/**
+ * @brief Command-line options of the runner.
+ */
+struct StressOptions {
+    std::string m_image_path;
+    std::size_t m_submitters{4};
+    double m_rate_hz{240.0};
+    std::size_t m_readers{2};
+    double m_display_rate_hz{60.0};
+    double m_load_ms{750.0};
+    double m_seconds{5.0};
+    double m_settle_timeout_s{10.0};
+    Core::Common::ImageDim m_display_width{2560};
+    Core::Common::ImageDim m_display_height{1440};
+};
+
+/**
+ * @brief A request of a submitter, kept until the end of the run.
+ */
+struct SubmittedRequest {
+    Clock::time_point m_submitted{};
+    std::future<ProcessingOutcome> m_future;
+};
+
+/**
+ * @brief What a submitter thread measured.
+ */
+struct SubmitterResult {
+    /** @brief Submission to settlement of each future, measured as the thread collects them. */
+    LatencySeries m_settle;
+    /** @brief Requests of the thread. */
+    std::vector<SubmittedRequest> m_requests;
+};
+
+std::optional<StressOptions> parseOptions(int argc, char** argv)
+{
+    StressOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg { argv[i] };
+        if (i + 1 >= argc) {
+            return std::nullopt;
+        }
+
+        if (arg == "--image") {
+            options.m_image_path = argv[++i];
+        } else if (arg == "--submitters") {
+            options.m_submitters = std::stoul(argv[++i]);
+        } else if (arg == "--rate") {
+            options.m_rate_hz = std::stod(argv[++i]);
+        } else if (arg == "--readers") {
+            options.m_readers = std::stoul(argv[++i]);
+        } else if (arg == "--display-rate") {
+            options.m_display_rate_hz = std::stod(argv[++i]);
+        } else if (arg == "--load-ms") {
+            options.m_load_ms = std::stod(argv[++i]);
+        } else if (arg == "--seconds") {
+            options.m_seconds = std::stod(argv[++i]);
+        } else if (arg == "--settle-timeout") {
+            options.m_settle_timeout_s = std::stod(argv[++i]);
+        } else if (arg == "--display") {
+            unsigned width { 0 };
+            unsigned height { 0 };
+            if (std::sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width == 0 || height == 0) {
+                return std::nullopt;
+            }
+            options.m_display_width = width;
+            options.m_display_height = height;
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    if (options.m_submitters == 0 || options.m_rate_hz <= 0.0 || options.m_display_rate_hz <= 0.0
+        || options.m_load_ms < 0.0 || options.m_seconds <= 0.0 || options.m_settle_timeout_s <= 0.0) {
+        return std::nullopt;
+    }
+    return options;
+}
+
+/**
+ * @brief Active operations of a submitter: its slider at `value`, the others at a fixed offset.
+ */
+std::vector<Core::Operations::OperationDescriptor> buildOperations(OperationType moved, float value)
+{
+    std::vector<Core::Operations::OperationDescriptor> operations;
+    operations.reserve(k_sliders.size());
+
+    for (const OperationType type : k_sliders) {
+        Core::Operations::OperationDescriptor descriptor;
+        descriptor.type = type;
+        descriptor.name = std::string(magic_enum::enum_name(type));
+        descriptor.enabled = true;
+        descriptor.setParam(Core::Operations::ParameterKey::Value, type == moved ? value : 0.1f);
+        operations.push_back(std::move(descriptor));
+    }
+    return operations;
+}
+
+/**
+ * @brief Waits for the futures of a submitter, oldest first.
+ * @details A future is collected once it is ready; the latency is measured at collection, a
+ *          few milliseconds late at most while the run goes on.
+ * @param deadline Futures still not ready by then are left unresolved.
+ */
+void collectSettled(SubmitterResult& result, std::size_t& collected, Clock::time_point deadline)
+{
+    while (collected < result.m_requests.size()) {
+        SubmittedRequest& request = result.m_requests[collected];
+        if (request.m_future.wait_until(deadline) != std::future_status::ready) {
+            return;
+        }
+        result.m_settle.add(Clock::now() - request.m_submitted);
+        ++collected;
+    }
+}
+
+void printUsage()
+{
+    std::printf("Usage: capturemoment_stress [--image PATH] [--submitters N] [--rate HZ] [--readers N]\n"
+                "                            [--display-rate HZ] [--load-ms MS] [--seconds S] [--display WxH]\n"
+                "                            [--settle-timeout S]\n");
+}
+
+int runStressScenario(const StressOptions& options)
+{
+    // 1. Scenario input: the loader alternates between two files
+    const std::string image_path { options.m_image_path.empty()
+                                       ? writeTestImage("stress_12mp.tif", static_cast<int>(k_12mp.m_width),
+                                                        static_cast<int>(k_12mp.m_height))
+                                       : options.m_image_path };
+    const std::string other_path { writeTestImage("stress_12mp_portrait.tif", static_cast<int>(k_12mp.m_height),
+                                                  static_cast<int>(k_12mp.m_width)) };
+    if (image_path.empty() || other_path.empty()) {
+        spdlog::error("[StressRunner]: No input image");
+        return 1;
+    }
+
+    Core::Managers::StateImageManager manager;
+    if (!manager.loadImage(image_path)) {
+        spdlog::error("[StressRunner]: Cannot load '{}'", image_path);
+        return 1;
+    }
+
+    // 2. Engine-side accounting, one entry per settled request
+    std::mutex stats_mutex;
+    LatencySeries queueing;
+    LatencySeries pipeline;
+    std::map<ProcessingOutcome, std::size_t> outcomes;
+    std::size_t coalesced { 0 };
+    std::size_t aborted { 0 };
+    std::size_t notified { 0 };
+
+    manager.setProcessingTimingsCallback([&](const Core::Common::ProcessingTimings& timings) {
+        std::lock_guard lock(stats_mutex);
+        ++notified;
+        ++outcomes[timings.m_outcome];
+
+        if (!timings.ran()) {
+            ++coalesced;
+            return;
+        }
+        queueing.add(timings.queueing());
+        pipeline.add(timings.pipeline());
+        if (timings.m_outcome != ProcessingOutcome::Completed) {
+            ++aborted;
+        }
+    });
+
+    const auto run_start { Clock::now() };
+    const auto run_end { run_start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.m_seconds)) };
+
+    // 3. Submitters: each moves its slider (a sine sweep, phase-shifted per thread)
+    std::vector<SubmitterResult> submitter_results(options.m_submitters);
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0; index < options.m_submitters; ++index) {
+        threads.emplace_back([&, index] {
+            SubmitterResult& result = submitter_results[index];
+            const OperationType slider { k_sliders[index % k_sliders.size()] };
+            const auto period { std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.m_rate_hz)) };
+            std::size_t collected { 0 };
+
+            for (auto tick = run_start; tick < run_end; tick += period) {
+                std::this_thread::sleep_until(tick);
+                const double t { std::chrono::duration<double>(tick - run_start).count() };
+                const auto value { static_cast<float>(std::sin(2.0 * std::numbers::pi * (0.5 * t + 0.1 * static_cast<double>(index)))) };
+
+                SubmittedRequest request;
+                request.m_submitted = Clock::now();
+                request.m_future = manager.applyOperations(buildOperations(slider, value));
+                result.m_requests.push_back(std::move(request));
+
+                collectSettled(result, collected, Clock::now());
+            }
+
+            const auto settle_deadline { Clock::now()
+                                         + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.m_settle_timeout_s)) };
+            collectSettled(result, collected, settle_deadline);
+        });
+    }
+
+    // 4. Display readers
+    std::vector<LatencySeries> reader_latencies(options.m_readers);
+    std::atomic<std::size_t> display_failures { 0 };
+
+    for (std::size_t index = 0; index < options.m_readers; ++index) {
+        threads.emplace_back([&, index] {
+            const auto period { std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.m_display_rate_hz)) };
+            for (auto tick = run_start; tick < run_end; tick += period) {
+                std::this_thread::sleep_until(tick);
+                const auto start { Clock::now() };
+                auto region = manager.getDownsampledDisplayImage(options.m_display_width, options.m_display_height);
+                if (!region) {
+                    // Expected while a reload swaps the working image
+                    display_failures.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                reader_latencies[index].add(Clock::now() - start);
+            }
+        });
+    }
+
+    // 5. Loader
+    LatencySeries loads;
+    std::size_t load_failures { 0 };
+
+    if (options.m_load_ms > 0.0) {
+        threads.emplace_back([&] {
+            const auto period { std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(options.m_load_ms)) };
+            bool other { true };
+            for (auto tick = run_start + period; tick < run_end; tick += period) {
+                std::this_thread::sleep_until(tick);
+                const auto start { Clock::now() };
+                if (!manager.loadImage(other ? other_path : image_path)) {
+                    ++load_failures;
+                } else {
+                    loads.add(Clock::now() - start);
+                }
+                other = !other;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const double run_s { std::chrono::duration<double>(Clock::now() - run_start).count() };
+    manager.setProcessingTimingsCallback({});
+
+    // 6. Settlement contract
+    LatencySeries settle;
+    LatencySeries display;
+    std::size_t submitted { 0 };
+    std::size_t unresolved { 0 };
+
+    for (SubmitterResult& result : submitter_results) {
+        settle.merge(result.m_settle);
+        submitted += result.m_requests.size();
+        unresolved += result.m_requests.size() - result.m_settle.size();
+    }
+    for (const LatencySeries& series : reader_latencies) {
+        display.merge(series);
+    }
+
+    // 7. Report
+    const auto share = [submitted](std::size_t count) {
+        return submitted == 0 ? 0.0 : 100.0 * static_cast<double>(count) / static_cast<double>(submitted);
+    };
+    const std::size_t completed { outcomes[ProcessingOutcome::Completed] };
+    const std::size_t failed { outcomes[ProcessingOutcome::Failed] };
+
+    std::printf("Stress: %s, %zu submitters at %.0f Hz, %zu readers at %.0f Hz, reload every %.0f ms, %.2f s\n",
+                image_path.c_str(), options.m_submitters, options.m_rate_hz, options.m_readers,
+                options.m_display_rate_hz, options.m_load_ms, run_s);
+    std::printf("  throughput: %.1f requests/s submitted, %.1f passes/s completed\n",
+                static_cast<double>(submitted) / run_s, static_cast<double>(completed) / run_s);
+    std::printf("  %-12s %8s %9s %9s %9s %9s   (ms)\n", "phase", "count", "p50", "p95", "p99", "max");
+    settle.print("settle");
+    queueing.print("queueing");
+    pipeline.print("pipeline");
+    display.print("display");
+    loads.print("load");
+
+    std::printf("  submitted %zu: completed %zu, coalesced %zu (%.1f%%), aborted mid-pass %zu (%.1f%%), cancelled %zu, failed %zu\n",
+                submitted, completed, coalesced, share(coalesced), aborted, share(aborted),
+                outcomes[ProcessingOutcome::Cancelled], failed);
+    std::printf("  display reads failed %zu, loads failed %zu\n", display_failures.load(), load_failures);
+
+    bool contract_held { true };
+    if (unresolved != 0) {
+        std::printf("FAILED: %zu future(s) not settled %.0f s after the run\n", unresolved, options.m_settle_timeout_s);
+        contract_held = false;
+    }
+    if (notified != submitted) {
+        std::printf("FAILED: %zu request(s) submitted, %zu settlement(s) notified\n", submitted, notified);
+        contract_held = false;
+    }
+    if (failed != 0 || load_failures != 0) {
+        std::printf("FAILED: %zu failed pass(es), %zu failed load(s)\n", failed, load_failures);
+        contract_held = false;
+    }
+    return contract_held ? 0 : 1;
+}
+
+} // anonymous namespace
+
+} // namespace CaptureMoment::Benchmarks
+
+int main(int argc, char** argv)
+{
+    const auto options { CaptureMoment::Benchmarks::parseOptions(argc, argv) };
+    if (!options) {
+        CaptureMoment::Benchmarks::printUsage();
+        return 1;
+    }
+
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(spdlog::level::warn);
+
+    return CaptureMoment::Benchmarks::runStressScenario(*options);
+}
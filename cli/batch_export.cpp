@@ -0,0 +1,369 @@
+/**
+ * @file batch_export.cpp
+ * @brief Headless batch export: applies the saved edits of many files and writes the results.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Reads the XMP sidecar of every file (`FileSerializerManager::loadFromFiles`), then exports
+ * them through `Export::BatchExporter`: decode, process and encode stages overlap across
+ * files, within a memory budget, on the CPU and the GPU at once when one is available.
+ *
+ * Usage:
+ *   capturemoment_export --output DIR [--format jpeg|tiff|exr] [--quality Q] [--long-edge PX]
+ *                        [--dither none|ordered|noise] [--memory-mb MB] [--encode-threads N] [--overwrite] [--no-edits]
+ *                        [--rendition SUFFIX:FORMAT:PX[:Q]]... [--list FILE] [FILES...]
+ *
+ * `--list` reads one path per line (empty lines and lines starting with `#` are skipped), for
+ * batches larger than a command line. The exit code is 0 only if every file was written.
+ *
+ * Each `--rendition` adds an output per file from the same processing pass, e.g.
+ * `--format tiff --rendition _web:jpeg:2048 --rendition _thumb:jpeg:400:80` writes
+ * `IMG_0001.tif`, `IMG_0001_web.jpg` and `IMG_0001_thumb.jpg`.
+ *
+ * Render farm (`Export::RenderFarmQueue`, a directory every node mounts):
+ *   capturemoment_export --farm DIR --output DIR [output options] [FILES...]
+ *       queues one job per file, then waits for the workers' results (coordinator).
+ *   capturemoment_export --farm-worker DIR [--worker-id ID] [--exit-when-idle] [--memory-mb MB] [--encode-threads N]
+ *       renders the jobs of the farm until stopped, or until none is left with `--exit-when-idle`.
+ */
+
+#include "core_initialization.h"
+#include "export/batch_exporter.h"
+#include "export/render_farm_queue.h"
+#include "export/render_farm_worker.h"
+#include "serializer/file_serializer_manager.h"
+#include "serializer/file_serializer_reader.h"
+#include "serializer/file_serializer_writer.h"
+#include "serializer/provider/exiv2_provider.h"
+#include "serializer/strategy/sidecar_xmp_path_strategy.h"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Cli {
+
+namespace {
+
+struct ExportOptions {
+    Core::Export::ExportSettings m_settings;
+    std::vector<std::string> m_files;
+    std::size_t m_memory_budget_bytes { Core::Export::BatchExporter::k_default_memory_budget_bytes };
+    std::size_t m_encode_threads { 0 };
+    bool m_load_edits { true };
+    /** @brief Farm directory: the files are queued there, for the workers (empty: export here). */
+    std::filesystem::path m_farm;
+    /** @brief Farm directory this process renders the jobs of (empty: not a worker). */
+    std::filesystem::path m_farm_worker;
+    /** @brief Id of the worker in the results (default: host name and process id). */
+    std::string m_worker_id;
+    bool m_exit_when_idle { false };
+};
+
+[[nodiscard]] std::optional<Core::Export::ExportFormat> parseFormat(std::string_view format)
+{
+    if (format == "jpeg" || format == "jpg") {
+        return Core::Export::ExportFormat::Jpeg;
+    }
+    if (format == "tiff" || format == "tif") {
+        return Core::Export::ExportFormat::Tiff;
+    }
+    if (format == "exr") {
+        return Core::Export::ExportFormat::Exr;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Parses `SUFFIX:FORMAT:PX[:Q]` (PX 0: full size).
+ */
+[[nodiscard]] std::optional<Core::Export::ExportRendition> parseRendition(std::string_view value)
+{
+    std::vector<std::string> fields;
+    for (const auto field : std::views::split(value, ':')) {
+        fields.emplace_back(field.begin(), field.end());
+    }
+    if (fields.size() < 3 || fields.size() > 4) {
+        return std::nullopt;
+    }
+    const auto format { parseFormat(fields[1]) };
+    if (!format) {
+        return std::nullopt;
+    }
+    Core::Export::ExportRendition rendition { fields[0], *format };
+    rendition.m_max_long_edge = static_cast<Core::Common::ImageDim>(std::stoul(fields[2]));
+    if (fields.size() == 4) {
+        rendition.m_jpeg_quality = std::stoi(fields[3]);
+    }
+    return rendition;
+}
+
+[[nodiscard]] bool readList(const std::string& list_path, std::vector<std::string>& files)
+{
+    std::ifstream list(list_path);
+    if (!list) {
+        return false;
+    }
+    for (std::string line; std::getline(list, line);) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (!line.empty() && line.front() != '#') {
+            files.push_back(std::move(line));
+        }
+    }
+    return true;
+}
+
+std::optional<ExportOptions> parseOptions(int argc, char** argv)
+{
+    ExportOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg { argv[i] };
+        const bool has_value { i + 1 < argc };
+
+        if (arg == "--overwrite") {
+            options.m_settings.m_overwrite = true;
+        } else if (arg == "--no-edits") {
+            options.m_load_edits = false;
+        } else if (arg == "--exit-when-idle") {
+            options.m_exit_when_idle = true;
+        } else if (arg == "--farm" && has_value) {
+            options.m_farm = argv[++i];
+        } else if (arg == "--farm-worker" && has_value) {
+            options.m_farm_worker = argv[++i];
+        } else if (arg == "--worker-id" && has_value) {
+            options.m_worker_id = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            options.m_settings.m_output_directory = argv[++i];
+        } else if (arg == "--format" && has_value) {
+            const auto format { parseFormat(argv[++i]) };
+            if (!format) {
+                return std::nullopt;
+            }
+            options.m_settings.m_format = *format;
+        } else if (arg == "--rendition" && has_value) {
+            auto rendition { parseRendition(argv[++i]) };
+            if (!rendition) {
+                return std::nullopt;
+            }
+            options.m_settings.m_renditions.push_back(std::move(*rendition));
+        } else if (arg == "--quality" && has_value) {
+            options.m_settings.m_jpeg_quality = std::stoi(argv[++i]);
+        } else if (arg == "--dither" && has_value) {
+            const std::string_view dither { argv[++i] };
+            if (dither == "none") {
+                options.m_settings.m_dither = Core::Utils::DitherMode::None;
+            } else if (dither == "ordered") {
+                options.m_settings.m_dither = Core::Utils::DitherMode::Ordered;
+            } else if (dither == "noise") {
+                options.m_settings.m_dither = Core::Utils::DitherMode::Noise;
+            } else {
+                return std::nullopt;
+            }
+        } else if (arg == "--long-edge" && has_value) {
+            options.m_settings.m_max_long_edge = static_cast<Core::Common::ImageDim>(std::stoul(argv[++i]));
+        } else if (arg == "--memory-mb" && has_value) {
+            options.m_memory_budget_bytes = static_cast<std::size_t>(std::stoull(argv[++i])) << 20;
+        } else if (arg == "--encode-threads" && has_value) {
+            options.m_encode_threads = static_cast<std::size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--list" && has_value) {
+            if (!readList(argv[++i], options.m_files)) {
+                std::fprintf(stderr, "Cannot read the list '%s'\n", argv[i]);
+                return std::nullopt;
+            }
+        } else if (arg.starts_with("--")) {
+            return std::nullopt;
+        } else {
+            options.m_files.emplace_back(arg);
+        }
+    }
+
+    // A worker takes its files and output settings from the farm
+    if (!options.m_farm_worker.empty()) {
+        return options;
+    }
+    if (options.m_settings.m_output_directory.empty() || options.m_files.empty()) {
+        return std::nullopt;
+    }
+    return options;
+}
+
+void printUsage()
+{
+    std::printf("Usage: capturemoment_export --output DIR [--format jpeg|tiff|exr] [--quality Q] [--long-edge PX]\n"
+                "                            [--dither none|ordered|noise] [--memory-mb MB] [--encode-threads N] [--overwrite] [--no-edits]\n"
+                "                            [--rendition SUFFIX:FORMAT:PX[:Q]]... [--list FILE] [--farm DIR] [FILES...]\n"
+                "       capturemoment_export --farm-worker DIR [--worker-id ID] [--exit-when-idle] [--memory-mb MB] [--encode-threads N]\n");
+}
+
+[[nodiscard]] std::vector<Core::Export::ExportJob> loadJobs(const ExportOptions& options)
+{
+    std::vector<Core::Export::ExportJob> jobs(options.m_files.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        jobs[i].m_source_path = options.m_files[i];
+    }
+    if (options.m_load_edits) {
+        const Core::Serializer::FileSerializerManager serializer(
+            std::make_unique<Core::Serializer::FileSerializerWriter>(
+                std::make_unique<Core::Serializer::Exiv2Provider>(),
+                std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()),
+            std::make_unique<Core::Serializer::FileSerializerReader>(
+                std::make_unique<Core::Serializer::Exiv2Provider>(),
+                std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()));
+
+        const std::size_t edited { serializer.loadFromFiles(options.m_files,
+            [&jobs](std::size_t index, std::vector<Core::Operations::OperationDescriptor> operations) {
+                jobs[index].m_operations = std::move(operations);
+            }) };
+        std::printf("%zu of %zu file(s) have edits\n", edited, jobs.size());
+    }
+    return jobs;
+}
+
+void printResult(std::size_t done, std::size_t total, const std::string& source, const std::filesystem::path& output,
+                 const std::expected<void, Core::ErrorHandling::CoreError>& status)
+{
+    if (status) {
+        std::printf("[%zu/%zu] %s -> %s\n", done, total, source.c_str(), output.string().c_str());
+    } else {
+        std::printf("[%zu/%zu] %s FAILED (%s)\n", done, total, source.c_str(),
+                    std::string(Core::ErrorHandling::to_string(status.error())).c_str());
+    }
+    std::fflush(stdout);
+}
+
+int runExport(const ExportOptions& options)
+{
+    const auto started { std::chrono::steady_clock::now() };
+
+    // 1. The edits of every file, read from the sidecars several at once
+    const auto jobs { loadJobs(options) };
+
+    // 2. Export, reporting each file as it completes
+    Core::Export::BatchExporter exporter(options.m_memory_budget_bytes, options.m_encode_threads);
+    std::size_t done { 0 };
+    const auto results { exporter.run(jobs, options.m_settings,
+        [&done, total = jobs.size()](std::size_t, const Core::Export::ExportResult& result) {
+            printResult(++done, total, result.m_source_path, result.m_output_path, result.m_status);
+        }) };
+
+    std::size_t failed { 0 };
+    for (const auto& result : results) {
+        failed += result.m_status ? 0 : 1;
+    }
+
+    const double seconds { std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count() };
+    std::printf("%zu written, %zu failed in %.1f s (%.2f files/s, %zu processor(s))\n", results.size() - failed, failed,
+                seconds, seconds > 0.0 ? static_cast<double>(results.size()) / seconds : 0.0, exporter.processorCount());
+    return failed == 0 ? 0 : 2;
+}
+
+int runFarmCoordinator(const ExportOptions& options)
+{
+    const auto started { std::chrono::steady_clock::now() };
+    const Core::Export::RenderFarmQueue queue(options.m_farm);
+
+    // 1. One job per file, with its edits
+    const auto jobs { loadJobs(options) };
+    const auto ids { queue.submit(jobs, options.m_settings) };
+    if (!ids) {
+        std::fprintf(stderr, "Cannot queue the jobs in '%s'\n", options.m_farm.string().c_str());
+        return 1;
+    }
+    std::printf("%zu job(s) queued in %s, waiting for the workers\n", ids->size(), options.m_farm.string().c_str());
+    std::fflush(stdout);
+
+    // 2. The workers' results, as they come
+    std::size_t done { 0 };
+    const auto results { queue.wait(*ids, [&done, total = ids->size()](std::size_t, const Core::Export::FarmResult& result) {
+        printResult(++done, total, result.m_source_path, result.m_output_path, result.m_status);
+    }) };
+
+    std::size_t failed { 0 };
+    std::set<std::string> workers;
+    for (const auto& result : results) {
+        failed += result.m_status ? 0 : 1;
+        workers.insert(result.m_worker);
+    }
+
+    const double seconds { std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count() };
+    std::printf("%zu written, %zu failed in %.1f s (%.2f files/s, %zu worker(s))\n", results.size() - failed, failed,
+                seconds, seconds > 0.0 ? static_cast<double>(results.size()) / seconds : 0.0, workers.size());
+    return failed == 0 ? 0 : 2;
+}
+
+[[nodiscard]] std::string defaultWorkerId()
+{
+#if defined(_WIN32)
+    const char* host { std::getenv("COMPUTERNAME") };
+    const auto pid { static_cast<unsigned long>(GetCurrentProcessId()) };
+#else
+    std::array<char, 256> name {};
+    const char* host { ::gethostname(name.data(), name.size() - 1) == 0 ? name.data() : nullptr };
+    const auto pid { static_cast<unsigned long>(::getpid()) };
+#endif
+    return std::format("{}-{}", host ? host : "worker", pid);
+}
+
+int runFarmWorker(const ExportOptions& options)
+{
+    Core::Export::RenderFarmWorker worker(Core::Export::RenderFarmQueue(options.m_farm_worker),
+                                          options.m_worker_id.empty() ? defaultWorkerId() : options.m_worker_id,
+                                          options.m_memory_budget_bytes, options.m_encode_threads);
+    std::printf("Worker %s serving %s\n", worker.id().c_str(), options.m_farm_worker.string().c_str());
+    std::fflush(stdout);
+
+    std::size_t done { 0 };
+    worker.run([&done](const Core::Export::FarmResult& result) {
+        ++done;
+        printResult(done, done, result.m_source_path, result.m_output_path, result.m_status);
+    }, {}, options.m_exit_when_idle);
+    return 0;
+}
+
+} // anonymous namespace
+
+} // namespace CaptureMoment::Cli
+
+int main(int argc, char** argv)
+{
+    const auto options { CaptureMoment::Cli::parseOptions(argc, argv) };
+    if (!options) {
+        CaptureMoment::Cli::printUsage();
+        return 1;
+    }
+
+    // The benchmark decides whether a GPU processor joins the CPU one
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(spdlog::level::warn);
+
+    if (!options->m_farm_worker.empty()) {
+        return CaptureMoment::Cli::runFarmWorker(*options);
+    }
+    if (!options->m_farm.empty()) {
+        return CaptureMoment::Cli::runFarmCoordinator(*options);
+    }
+    return CaptureMoment::Cli::runExport(*options);
+}
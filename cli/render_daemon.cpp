@@ -0,0 +1,127 @@
+/**
+ * @file render_daemon.cpp
+ * @brief Render daemon: a warm engine serving the renders of local clients.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Initializes the core once (backend decision, Halide, OIIO, Exiv2), then serves requests on a
+ * Unix socket through `Export::RenderServer` until SIGINT or SIGTERM. Clients connect with
+ * `Export::RenderClient`; images come and go in shared memory.
+ *
+ * Usage:
+ *   capturemoment_renderd --socket PATH [--memory-mb MB] [--encode-threads N] [--verbose]
+ */
+
+#include "core_initialization.h"
+#include "common/cancellation_token.h"
+#include "export/render_server.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#if !defined(_WIN32)
+#include <csignal>
+#include <pthread.h>
+#include <thread>
+#endif
+
+namespace CaptureMoment::Cli {
+
+namespace {
+
+struct DaemonOptions {
+    std::filesystem::path m_socket;
+    std::size_t m_memory_budget_bytes { Core::Export::BatchExporter::k_default_memory_budget_bytes };
+    std::size_t m_encode_threads { 0 };
+    bool m_verbose { false };
+};
+
+std::optional<DaemonOptions> parseOptions(int argc, char** argv)
+{
+    DaemonOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg { argv[i] };
+        const bool has_value { i + 1 < argc };
+
+        if (arg == "--verbose") {
+            options.m_verbose = true;
+        } else if (arg == "--socket" && has_value) {
+            options.m_socket = argv[++i];
+        } else if (arg == "--memory-mb" && has_value) {
+            options.m_memory_budget_bytes = static_cast<std::size_t>(std::stoull(argv[++i])) << 20;
+        } else if (arg == "--encode-threads" && has_value) {
+            options.m_encode_threads = static_cast<std::size_t>(std::stoul(argv[++i]));
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    if (options.m_socket.empty()) {
+        return std::nullopt;
+    }
+    return options;
+}
+
+void printUsage()
+{
+    std::printf("Usage: capturemoment_renderd --socket PATH [--memory-mb MB] [--encode-threads N] [--verbose]\n");
+}
+
+} // anonymous namespace
+
+} // namespace CaptureMoment::Cli
+
+int main(int argc, char** argv)
+{
+    const auto options { CaptureMoment::Cli::parseOptions(argc, argv) };
+    if (!options) {
+        CaptureMoment::Cli::printUsage();
+        return 1;
+    }
+
+#if defined(_WIN32)
+    std::fprintf(stderr, "The render daemon needs Unix sockets and is not available on Windows\n");
+    return 1;
+#else
+    // The signals go to a thread waiting for them: the server threads never see them
+    sigset_t stop_signals;
+    sigemptyset(&stop_signals);
+    sigaddset(&stop_signals, SIGINT);
+    sigaddset(&stop_signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop_signals, nullptr);
+
+    // Paid once for every request to come
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(options->m_verbose ? spdlog::level::info : spdlog::level::warn);
+
+    auto stop { std::make_shared<CaptureMoment::Core::Common::CancellationToken::Counter>(0) };
+    const CaptureMoment::Core::Common::CancellationToken token(stop, 0);
+    std::jthread signal_waiter([&stop_signals, stop] {
+        int signal { 0 };
+        sigwait(&stop_signals, &signal);
+        stop->fetch_add(1);
+    });
+
+    CaptureMoment::Core::Export::RenderServer server(options->m_socket, options->m_memory_budget_bytes,
+                                                     options->m_encode_threads);
+    std::printf("Serving renders on %s\n", options->m_socket.string().c_str());
+    std::fflush(stdout);
+
+    const auto served { server.run(token) };
+    if (!served) {
+        std::fprintf(stderr, "Cannot listen on '%s'\n", options->m_socket.string().c_str());
+        // The waiter returns once a signal comes: send it one
+        pthread_kill(signal_waiter.native_handle(), SIGTERM);
+        return 1;
+    }
+    std::printf("%zu request(s) served\n", server.requestCount());
+    return 0;
+#endif
+}
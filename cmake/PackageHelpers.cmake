@@ -18,6 +18,27 @@ function(find_required_packages)
 
     # magic_enum (mandatory)
     find_magic_enum_package()
+
+    # SQLite (mandatory for the thumbnail cache)
+    find_sqlite3_package()
+
+    # xxHash (mandatory for the card import checksums)
+    find_xxhash_package()
+
+    # nlohmann/json (mandatory for the performance profiles)
+    find_nlohmann_json_package()
+
+    # libjpeg (optional: DCT-scaled JPEG decodes for thumbnails and load previews)
+    find_jpeg_package()
+
+    # liburing (optional, Linux: asynchronous read-ahead of files on network storage)
+    find_liburing_package()
+
+    # zstd (optional: compression of the recently viewed images kept in memory)
+    find_zstd_package()
+
+    # OpenMP (optional: thread count of LibRaw's parallel decompression and demosaic)
+    find_openmp_package()
     
     # Qt6 will be searched by the sub-projects ui/desktop, ui/mobile
 
@@ -175,6 +196,151 @@ function(find_exiv2_package)
 
 endfunction()
 
+# ============================================================
+# Find SQLite
+# ============================================================
+function(find_sqlite3_package)
+    message(STATUS "Searching for SQLite3...")
+
+    # FindSQLite3.cmake ships with CMake and defines the SQLite::SQLite3 target
+    find_package(SQLite3 MODULE QUIET)
+
+    if(SQLite3_FOUND)
+        set(SQLite3_FOUND TRUE PARENT_SCOPE)
+        set(SQLite3_VERSION ${SQLite3_VERSION} PARENT_SCOPE)
+    else()
+        message(FATAL_ERROR "SQLite3 not found. Please install it via your package manager or vcpkg/conan.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find xxHash
+# ============================================================
+function(find_xxhash_package)
+    message(STATUS "Searching for xxHash...")
+
+    # Attempt CONFIG first (vcpkg, Conan), which defines xxHash::xxhash
+    find_package(xxHash CONFIG QUIET)
+
+    # Distribution packages often ship no CMake config: look for the header and library
+    if(NOT xxHash_FOUND)
+        message(STATUS "xxHash not found via CONFIG. Attempting manual search...")
+        find_path(XXHASH_INCLUDE_DIR NAMES xxhash.h)
+        find_library(XXHASH_LIBRARY NAMES xxhash)
+
+        if(XXHASH_INCLUDE_DIR AND XXHASH_LIBRARY)
+            add_library(xxHash::xxhash UNKNOWN IMPORTED)
+            set_target_properties(xxHash::xxhash PROPERTIES
+                IMPORTED_LOCATION ${XXHASH_LIBRARY}
+                INTERFACE_INCLUDE_DIRECTORIES ${XXHASH_INCLUDE_DIR})
+            set(xxHash_FOUND TRUE)
+            message(STATUS "xxHash found manually: ${XXHASH_LIBRARY}")
+        endif()
+    endif()
+
+    if(xxHash_FOUND)
+        set(xxHash_FOUND TRUE PARENT_SCOPE)
+        set(xxHash_VERSION ${xxHash_VERSION} PARENT_SCOPE)
+    else()
+        message(FATAL_ERROR "xxHash not found. Please install it via your package manager (e.g. apt install libxxhash-dev) or vcpkg/conan.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find nlohmann/json
+# ============================================================
+function(find_nlohmann_json_package)
+    message(STATUS "Searching for nlohmann_json...")
+
+    # Header-only; vcpkg, Conan and the distribution packages ship its CMake config
+    find_package(nlohmann_json CONFIG QUIET)
+
+    if(nlohmann_json_FOUND)
+        set(nlohmann_json_FOUND TRUE PARENT_SCOPE)
+        set(nlohmann_json_VERSION ${nlohmann_json_VERSION} PARENT_SCOPE)
+    else()
+        message(FATAL_ERROR "nlohmann_json not found. Please install it via your package manager (e.g. apt install nlohmann-json3-dev) or vcpkg/conan.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find libjpeg (libjpeg-turbo)
+# ============================================================
+function(find_jpeg_package)
+    message(STATUS "Searching for libjpeg...")
+
+    # FindJPEG.cmake ships with CMake and defines the JPEG::JPEG target
+    find_package(JPEG MODULE QUIET)
+
+    if(JPEG_FOUND)
+        set(JPEG_FOUND TRUE PARENT_SCOPE)
+        set(JPEG_VERSION ${JPEG_VERSION} PARENT_SCOPE)
+    else()
+        message(STATUS "libjpeg not found: JPEG thumbnails and previews are decoded at full resolution.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find liburing (Linux)
+# ============================================================
+function(find_liburing_package)
+    if(NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        return()
+    endif()
+
+    message(STATUS "Searching for liburing...")
+
+    # liburing ships a pkg-config file only
+    find_package(PkgConfig QUIET)
+    if(PkgConfig_FOUND)
+        pkg_check_modules(LIBURING QUIET IMPORTED_TARGET liburing)
+    endif()
+
+    if(LIBURING_FOUND)
+        set(LIBURING_FOUND TRUE PARENT_SCOPE)
+        set(LIBURING_VERSION ${LIBURING_VERSION} PARENT_SCOPE)
+    else()
+        message(STATUS "liburing not found: network files are read ahead from threads.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find zstd
+# ============================================================
+function(find_zstd_package)
+    message(STATUS "Searching for zstd...")
+
+    # libzstd ships a pkg-config file on every platform; its CMake config is not always installed
+    find_package(PkgConfig QUIET)
+    if(PkgConfig_FOUND)
+        pkg_check_modules(ZSTD QUIET IMPORTED_TARGET libzstd)
+    endif()
+
+    if(ZSTD_FOUND)
+        set(ZSTD_FOUND TRUE PARENT_SCOPE)
+        set(ZSTD_VERSION ${ZSTD_VERSION} PARENT_SCOPE)
+    else()
+        message(STATUS "zstd not found: recently viewed images are kept in memory as uncompressed half floats.")
+    endif()
+endfunction()
+
+# ============================================================
+# Find OpenMP
+# ============================================================
+function(find_openmp_package)
+    message(STATUS "Searching for OpenMP...")
+
+    # Only the runtime API is used: LibRaw, built with OpenMP, runs its loops on the same runtime
+    find_package(OpenMP QUIET COMPONENTS CXX)
+
+    if(OpenMP_CXX_FOUND)
+        set(OpenMP_CXX_FOUND TRUE PARENT_SCOPE)
+        set(OpenMP_CXX_VERSION ${OpenMP_CXX_VERSION} PARENT_SCOPE)
+    else()
+        message(STATUS "OpenMP not found: RAW decodes use LibRaw's default thread count.")
+    endif()
+endfunction()
+
 # ============================================================
 # Summary of all found packages
 # ============================================================
@@ -213,6 +379,48 @@ function(summarize_found_packages)
         message(STATUS "║ magic_enum : Not Found")
     endif()
 
+    if(SQLite3_FOUND)
+        message(STATUS "║ SQLite3 : ${SQLite3_VERSION}")
+    else()
+        message(STATUS "║ SQLite3 : Not Found")
+    endif()
+
+    if(xxHash_FOUND)
+        message(STATUS "║ xxHash : ${xxHash_VERSION}")
+    else()
+        message(STATUS "║ xxHash : Not Found")
+    endif()
+
+    if(nlohmann_json_FOUND)
+        message(STATUS "║ nlohmann_json : ${nlohmann_json_VERSION}")
+    else()
+        message(STATUS "║ nlohmann_json : Not Found")
+    endif()
+
+    if(JPEG_FOUND)
+        message(STATUS "║ libjpeg : ${JPEG_VERSION}")
+    else()
+        message(STATUS "║ libjpeg : Not Found (optional)")
+    endif()
+
+    if(LIBURING_FOUND)
+        message(STATUS "║ liburing : ${LIBURING_VERSION}")
+    else()
+        message(STATUS "║ liburing : Not Found (optional)")
+    endif()
+
+    if(ZSTD_FOUND)
+        message(STATUS "║ zstd : ${ZSTD_VERSION}")
+    else()
+        message(STATUS "║ zstd : Not Found (optional)")
+    endif()
+
+    if(OpenMP_CXX_FOUND)
+        message(STATUS "║ OpenMP : ${OpenMP_CXX_VERSION}")
+    else()
+        message(STATUS "║ OpenMP : Not Found (optional)")
+    endif()
+
     message(STATUS "╚════════════════════════════════════════════════════════════╝")
     message(STATUS "")
 
@@ -224,6 +432,11 @@ function(summarize_found_packages)
     message(STATUS "║ Halide : 21.0.0")
     message(STATUS "║ Exiv2 : 0.28.7")
     message(STATUS "║ magic_enum : 0.9.7")
+    message(STATUS "║ SQLite3 : 3.50.0")
+    message(STATUS "║ xxHash : 0.8.3")
+    message(STATUS "║ nlohmann_json : 3.12.0")
+    message(STATUS "║ libjpeg-turbo : 3.1.0")
+    message(STATUS "║ liburing : 2.9")
     message(STATUS "╚════════════════════════════════════════════════════════════╝")
     message(STATUS "")
 endfunction()
\ No newline at end of file
@@ -0,0 +1,103 @@
+/**
+ * @file tone_generator.cpp
+ * @brief Halide generator for the ahead-of-time fused tone kernel.
+ *
+ * @details
+ * Produces `capturemoment_tone_kernel`, a single parameterized kernel applying, in this order:
+ * Brightness, Contrast, Highlights, Shadows, Whites, Blacks.
+ *
+ * Each stage is gated by a bit of `enabled_mask` (bit 0 = Brightness ... bit 5 = Blacks),
+ * so any chain that is an ordered subsequence of the canonical order yields exactly
+ * the same result as the JIT-fused pipeline (disabled stages are skipped, including their clamps).
+ *
+ * The graph is the one used by the operations themselves (`tone_adjustments.h`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+
+#include "Halide.h"
+
+namespace CaptureMoment::Core::Generators {
+
+class ToneGenerator : public Halide::Generator<ToneGenerator> {
+public:
+    Input<Halide::Buffer<float, 3>> input { "input" };
+    Input<int> enabled_mask { "enabled_mask", 0 };
+    Input<float> brightness { "brightness", Operations::OperationRanges::getBrightnessDefaultValue() };
+    Input<float> contrast { "contrast", Operations::OperationRanges::getContrastDefaultValue() };
+    Input<float> highlights { "highlights", Operations::OperationRanges::getHighlightsDefaultValue() };
+    Input<float> shadows { "shadows", Operations::OperationRanges::getShadowsDefaultValue() };
+    Input<float> whites { "whites", Operations::OperationRanges::getWhitesDefaultValue() };
+    Input<float> blacks { "blacks", Operations::OperationRanges::getBlacksDefaultValue() };
+
+    Output<Halide::Buffer<float, 3>> output { "output" };
+
+    void generate()
+    {
+        Halide::Func current("tone_input");
+        current(x, y, c) = input(x, y, c);
+
+        current = gate(current, 0, Operations::applyBrightnessAdjustment(current, brightness, x, y, c));
+        current = gate(current, 1, Operations::applyContrastAdjustment(current, contrast, x, y, c));
+        current = gate(current, 2, Operations::applyHighlightsAdjustment(current, highlights, x, y, c));
+        current = gate(current, 3, Operations::applyShadowsAdjustment(current, shadows, x, y, c));
+        current = gate(current, 4, Operations::applyWhitesAdjustment(current, whites, x, y, c));
+        current = gate(current, 5, Operations::applyBlacksAdjustment(current, blacks, x, y, c));
+
+        output(x, y, c) = current(x, y, c);
+    }
+
+    void schedule()
+    {
+        // Interleaved RGBA on both ends, as stored by the working images
+        input.dim(0).set_stride(4);
+        input.dim(2).set_bounds(0, 4).set_stride(1);
+        output.dim(0).set_stride(4);
+        output.dim(2).set_bounds(0, 4).set_stride(1);
+
+        if (using_autoscheduler()) {
+            // Offline autoscheduling (CAPTUREMOMENT_AOT_AUTOSCHEDULER): a 24 MP frame, all stages enabled
+            input.set_estimates({{0, 6000}, {0, 4000}, {0, 4}});
+            output.set_estimates({{0, 6000}, {0, 4000}, {0, 4}});
+            enabled_mask.set_estimate(0x3f);
+            brightness.set_estimate(Operations::OperationRanges::getBrightnessDefaultValue());
+            contrast.set_estimate(Operations::OperationRanges::getContrastDefaultValue());
+            highlights.set_estimate(Operations::OperationRanges::getHighlightsDefaultValue());
+            shadows.set_estimate(Operations::OperationRanges::getShadowsDefaultValue());
+            whites.set_estimate(Operations::OperationRanges::getWhitesDefaultValue());
+            blacks.set_estimate(Operations::OperationRanges::getBlacksDefaultValue());
+            return;
+        }
+
+        output.bound(c, 0, 4).reorder(c, x, y).unroll(c);
+
+        if (get_target().has_gpu_feature()) {
+            Halide::Var xo, yo, xi, yi;
+            output.gpu_tile(x, y, xo, yo, xi, yi, 16, 16);
+        } else {
+            Halide::Var yo, yi;
+            const int vector_size = natural_vector_size<float>();
+            output.split(y, yo, yi, 8).parallel(yo).vectorize(x, vector_size);
+        }
+    }
+
+private:
+    Halide::Var x { "x" }, y { "y" }, c { "c" };
+
+    /**
+     * @brief Selects the adjusted stage when its bit is set in `enabled_mask`, the previous one otherwise.
+     */
+    Halide::Func gate(const Halide::Func& previous, int bit, const Halide::Func& adjusted)
+    {
+        Halide::Func gated(adjusted.name() + "_gated");
+        gated(x, y, c) = Halide::select((enabled_mask & (1 << bit)) != 0, adjusted(x, y, c), previous(x, y, c));
+        return gated;
+    }
+};
+
+} // namespace CaptureMoment::Core::Generators
+
+HALIDE_REGISTER_GENERATOR(CaptureMoment::Core::Generators::ToneGenerator, capturemoment_tone)
@@ -0,0 +1,223 @@
+/**
+ * @file card_importer.h
+ * @brief Declaration of CardImporter (checksummed import of memory cards into the catalog).
+ *
+ * @details
+ * Every byte is read from the card once:
+ * 1. Several files are copied at once (`ImportSettings::m_parallel_files`), each in
+ *    `k_block_bytes` blocks with the system's sequential read-ahead hint, to a part file that
+ *    is renamed when complete.
+ * 2. The bytes are hashed (XXH3, 64 bits) as they pass. The hash verifies the copy (the copy
+ *    is read back, from the page cache) and finds duplicates: a file already cataloged, or
+ *    already imported by the same run, with the same hash and size is not kept.
+ * 3. The copy, still in the page cache, goes straight to the header metadata
+ *    (`ISourceManager::readMetadata`) and, when a `ThumbnailService` is given, to the thumbnail
+ *    cache, whose perceptual hash goes to the record. Records are added to the catalog in batches
+ *    of `CatalogDatabase::k_import_batch_rows`.
+ * 4. With `ImportSettings::m_auto_tone`, the histogram the thumbnail was rendered with gives the
+ *    auto-tone values, saved as the copy's edits: no pass over the full-resolution image.
+ * 5. With `ImportSettings::m_smart_preview_directory`, the copy is also decoded to a smart
+ *    preview (`Managers::SmartPreviewStore`), so it can be edited once its drive is offline.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "catalog/catalog_database.h"
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "managers/i_source_manager.h"
+#include "serializer/i_file_serializer_writer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Thumbnails {
+class ThumbnailService;
+}
+
+namespace Catalog {
+
+/**
+ * @brief What the import did with a file.
+ */
+enum class ImportOutcome : std::uint8_t {
+    Copied,     ///< Copied, verified and cataloged (if its metadata could be read)
+    Duplicate   ///< Same content as a cataloged (or just imported) file: the copy was discarded
+};
+
+/**
+ * @brief Settings shared by every file of an import.
+ */
+struct ImportSettings {
+    /** @brief Directory the files are copied to (created if missing). */
+    std::filesystem::path m_destination;
+
+    /** @brief Files copied at once (fast card readers serve several streams better than one). */
+    std::size_t m_parallel_files{4};
+
+    /** @brief true to read each copy back and compare its hash before keeping it. */
+    bool m_verify{true};
+
+    /** @brief true to discard a file whose content is already cataloged. */
+    bool m_skip_duplicates{true};
+
+    /**
+     * @brief true to save auto-tone values with each copy (`Operations::AutoTone`), read off the
+     *        histogram of its thumbnail: needs the importer's thumbnail service and edit writer.
+     */
+    bool m_auto_tone{false};
+
+    /**
+     * @brief Directory the smart previews of the copies are written to
+     *        (`Managers::SmartPreviewStore::directoryFor` the catalog), or empty for none.
+     */
+    std::filesystem::path m_smart_preview_directory;
+};
+
+/**
+ * @brief Outcome of one file.
+ */
+struct ImportResult {
+    std::string m_source_path;
+
+    /** @brief The copy, or the file it duplicates. */
+    std::filesystem::path m_destination_path;
+
+    /** @brief XXH3 hash of the file's bytes (0 if the copy failed). */
+    std::uint64_t m_content_hash{0};
+
+    std::expected<ImportOutcome, ErrorHandling::CoreError> m_status;
+
+    /** @brief true if auto-tone values were saved with the copy. */
+    bool m_auto_toned{false};
+
+    /** @brief true if a smart preview of the copy was stored. */
+    bool m_smart_preview{false};
+};
+
+/**
+ * @class CardImporter
+ * @brief Copies files off a card in parallel, checksummed, and catalogs them.
+ */
+class CardImporter {
+public:
+    /**
+     * @brief Receives the outcome of each file as soon as it is known (one call at a time, in
+     *        completion order, on an import thread).
+     */
+    using ProgressCallback = std::function<void(std::size_t index, const ImportResult& result)>;
+
+    /**
+     * @brief Size of the blocks read and written (one buffer per file in flight).
+     */
+    static constexpr std::size_t k_block_bytes = std::size_t{4} << 20;
+
+    /**
+     * @brief Creates the importer.
+     * @param catalog The catalog the files are added to (must outlive the importer).
+     * @param source Reads the header metadata (nullptr: a dedicated `SourceManager`).
+     * @param thumbnails Renders the thumbnails of the copies into its cache (nullptr: none).
+     * @param writer Saves the auto-tone edits of the copies (nullptr: `ImportSettings::m_auto_tone` is ignored).
+     */
+    explicit CardImporter(CatalogDatabase& catalog,
+                          std::unique_ptr<Managers::ISourceManager> source = nullptr,
+                          Thumbnails::ThumbnailService* thumbnails = nullptr,
+                          std::unique_ptr<Serializer::IFileSerializerWriter> writer = nullptr);
+
+    ~CardImporter();
+
+    CardImporter(const CardImporter&) = delete;
+    CardImporter& operator=(const CardImporter&) = delete;
+
+    /**
+     * @brief Imports files and waits for all of them.
+     *
+     * A cancelled token stops starting files and interrupts the copies in progress: their
+     * result is `LoadCancelled` and their part files are removed.
+     *
+     * @param sources The files on the card.
+     * @param settings Destination and options.
+     * @param on_progress Receives each outcome (optional).
+     * @param token Cancels the import.
+     * @return One outcome per source, in the order of `sources`.
+     */
+    [[nodiscard]] std::vector<ImportResult> run(std::span<const std::string> sources, const ImportSettings& settings,
+                                                const ProgressCallback& on_progress = {},
+                                                const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Copies a file in blocks of `buffer`'s size, hashing the bytes as they pass.
+     * @param destination Created; must not exist.
+     * @return The XXH3 hash of the bytes, `FileNotFound` if the source cannot be opened,
+     *         `LoadCancelled`, or `IOError` (the destination is then incomplete).
+     */
+    [[nodiscard]] static std::expected<std::uint64_t, ErrorHandling::CoreError>
+    copyFile(const std::filesystem::path& source, const std::filesystem::path& destination,
+             std::span<std::byte> buffer, const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Hashes a file in blocks of `buffer`'s size (same hash as `copyFile`).
+     * @return The XXH3 hash, `FileNotFound`, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<std::uint64_t, ErrorHandling::CoreError>
+    hashFile(const std::filesystem::path& path, std::span<std::byte> buffer);
+
+private:
+    /**
+     * @brief State shared by the import threads of a run.
+     */
+    struct RunState;
+
+    /**
+     * @brief Copies, verifies, deduplicates and catalogs one file (import thread).
+     */
+    [[nodiscard]] ImportResult importFile(const std::string& source, const ImportSettings& settings, RunState& state,
+                                          std::span<std::byte> buffer, const Common::CancellationToken& token);
+
+    /**
+     * @brief Adds the records collected so far to the catalog.
+     */
+    void flushRecords(RunState& state);
+
+    /**
+     * @brief The catalog the files are added to.
+     */
+    CatalogDatabase& m_catalog;
+
+    /**
+     * @brief Reads the header metadata of the copies.
+     */
+    std::unique_ptr<Managers::ISourceManager> m_source;
+
+    /**
+     * @brief Renders the thumbnails of the copies (nullptr: none).
+     */
+    Thumbnails::ThumbnailService* m_thumbnails;
+
+    /**
+     * @brief Saves the auto-tone edits (nullptr: none).
+     */
+    std::unique_ptr<Serializer::IFileSerializerWriter> m_writer;
+
+    /**
+     * @brief Guards `m_writer` (the XMP toolkit is not reentrant).
+     */
+    std::mutex m_writer_mutex;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,53 @@
+/**
+ * @file catalog.h
+ * @brief Umbrella header for the Catalog module.
+ *
+ * @details
+ * This module indexes the photo library in a SQLite database:
+ * - **Records**: `ImageRecord` (file, header metadata, rating) and the grid queries.
+ * - **Database**: `CatalogDatabase` stores images, edit stacks, keywords and grid thumbnails.
+ * - **Edits**: `CatalogEditsReader` serves the parsed sidecars of unchanged XMP files.
+ * - **Import**: `CardImporter` copies memory cards, checksummed, into the catalog.
+ * - **Sync**: `CatalogSync` applies the changes `FolderWatcher` reports in the watched folders.
+ * - **Grouping**: `PerceptualIndex` finds near-duplicates and bursts by perceptual hash.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+/**
+ * @brief Image records, grid queries and cursors.
+ */
+#include "catalog/catalog_records.h"
+
+/**
+ * @brief SQLite catalog (WAL, prepared statements, batched imports).
+ */
+#include "catalog/catalog_database.h"
+
+/**
+ * @brief Sidecar edits read from the catalog while the sidecar is unchanged.
+ */
+#include "catalog/catalog_edits_reader.h"
+
+/**
+ * @brief Change notifications of folder trees.
+ */
+#include "catalog/folder_watcher.h"
+
+/**
+ * @brief Incremental sync of the catalog with the watched folders.
+ */
+#include "catalog/catalog_sync.h"
+
+/**
+ * @brief Parallel, checksummed import of memory cards.
+ */
+#include "catalog/card_importer.h"
+
+/**
+ * @brief Near-duplicate and burst grouping by perceptual hash.
+ */
+#include "catalog/perceptual_index.h"
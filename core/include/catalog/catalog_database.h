@@ -0,0 +1,356 @@
+/**
+ * @file catalog_database.h
+ * @brief Declaration of CatalogDatabase (SQLite catalog of images, edits, keywords and thumbnails).
+ *
+ * @details
+ * The catalog indexes the user's library: one row per image file (header metadata, rating), its
+ * edit stack as a binary blob (`Serializer::encodeEditStack`), its keywords and its grid
+ * thumbnail. It is sized for libraries of several hundred thousand images:
+ * - **WAL mode**: grid and filmstrip queries never wait for an import, and an import never
+ *   waits for them. Reads and writes use two connections, each serialized by its own mutex.
+ * - **Prepared statements**: every statement is prepared once per connection, on first use,
+ *   and reused (`SQLITE_PREPARE_PERSISTENT`).
+ * - **Batched writes**: an import commits `k_import_batch_rows` rows per transaction instead of
+ *   one transaction (and one WAL sync) per row.
+ * - **Grid indexes**: `(folder, capture date, id)` and `(capture date, id)` serve the grid
+ *   pages straight from the index, read by key (`GridCursor`) rather than by offset.
+ *
+ * Folders are stored once and images reference them, so a path is not repeated 300k times.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "catalog/catalog_records.h"
+#include "common/error_handling/core_error.h"
+#include "managers/image_metadata.h"
+#include "operations/operation_descriptor.h"
+#include "thumbnails/thumbnail.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @class CatalogDatabase
+ * @brief Thread-safe SQLite catalog.
+ *
+ * @details
+ * Writes go through the write connection, reads through a read-only connection: under WAL a
+ * reader sees the last committed transaction and is never blocked by the writer. Failures are
+ * reported as `CoreError::CatalogError` (logged with the SQLite message).
+ */
+class CatalogDatabase {
+public:
+    /**
+     * @brief Rows written per transaction during an import.
+     */
+    static constexpr std::size_t k_import_batch_rows { 4096 };
+
+    /**
+     * @brief Version of the schema (SQLite `user_version`).
+     */
+    static constexpr int k_schema_version { 5 };
+
+    /**
+     * @brief Opens (or creates) a catalog.
+     * @param database The catalog file. Its directory is created if needed.
+     * @return The catalog, `CoreError::UnsupportedFormat` for a catalog of a newer schema, or
+     *         `CoreError::CatalogError` if the file cannot be opened as a database.
+     */
+    [[nodiscard]] static std::expected<std::unique_ptr<CatalogDatabase>, ErrorHandling::CoreError>
+    open(const std::filesystem::path& database);
+
+    /**
+     * @brief Builds the record of a file from its header metadata (see `ISourceManager::readMetadata`).
+     * @return The record (not in the catalog yet), or `CoreError::FileNotFound`.
+     */
+    [[nodiscard]] static std::expected<ImageRecord, ErrorHandling::CoreError>
+    makeRecord(std::string_view path, const Managers::ImageMetadata& metadata);
+
+    /**
+     * @brief Modification time of a file, in the unit of `ImageRecord::m_file_mtime`.
+     * @return The time, or `std::nullopt` if the file does not exist.
+     */
+    [[nodiscard]] static std::optional<std::int64_t> fileTime(const std::filesystem::path& path);
+
+    /**
+     * @brief Finalizes the statements and closes both connections.
+     */
+    ~CatalogDatabase();
+
+    CatalogDatabase(const CatalogDatabase&) = delete;
+    CatalogDatabase& operator=(const CatalogDatabase&) = delete;
+
+    // ============================================================
+    // Images
+    // ============================================================
+
+    /**
+     * @brief Adds images, or updates those already cataloged (same path), in transactions of
+     *        `k_import_batch_rows` rows.
+     *
+     * The rating of an updated image is kept. On failure, the batches committed before stay.
+     *
+     * @param records The images (`m_id`, `m_import_time`, `m_sidecar_mtime` and `m_sidecar_size` are ignored).
+     * @return The number of records written, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::size_t, ErrorHandling::CoreError>
+    addImages(std::span<const ImageRecord> records);
+
+    /**
+     * @brief Looks an image up by path.
+     * @return The record, `std::nullopt` if the path is not cataloged, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::optional<ImageRecord>, ErrorHandling::CoreError>
+    findImage(std::string_view path) const;
+
+    /**
+     * @brief Looks up an image with the same content (see `ImageRecord::m_content_hash`).
+     * @return A record of the same hash and size, `std::nullopt` if there is none (or the hash
+     *         is 0), or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::optional<ImageRecord>, ErrorHandling::CoreError>
+    findDuplicate(std::uint64_t content_hash, std::uint64_t file_size) const;
+
+    /**
+     * @brief Reads one page of a grid (see `GridQuery`, `GridCursor::after`).
+     * @return The records in capture-date order (fewer than `m_limit` on the last page).
+     */
+    [[nodiscard]] std::expected<std::vector<ImageRecord>, ErrorHandling::CoreError>
+    queryGrid(const GridQuery& query) const;
+
+    /**
+     * @brief Every image of one folder (not of its subfolders), in no particular order.
+     */
+    [[nodiscard]] std::expected<std::vector<ImageRecord>, ErrorHandling::CoreError>
+    folderImages(std::string_view folder) const;
+
+    /**
+     * @brief The cataloged folders in a tree: `root` and every folder below it.
+     */
+    [[nodiscard]] std::expected<std::vector<std::string>, ErrorHandling::CoreError>
+    foldersUnder(const std::filesystem::path& root) const;
+
+    /**
+     * @brief Removes images (with their edits, keywords and thumbnails), in one transaction.
+     * @param paths Absolute paths; those not cataloged are ignored.
+     * @return The number of images removed, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::size_t, ErrorHandling::CoreError>
+    removeImages(std::span<const std::string> paths);
+
+    /**
+     * @brief Number of images in the catalog.
+     */
+    [[nodiscard]] std::expected<std::uint64_t, ErrorHandling::CoreError> imageCount() const;
+
+    /**
+     * @brief Sets the star rating of an image (clamped to 0 to 5).
+     * @return void, `CoreError::NotInCatalog` for an unknown id, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> setRating(ImageId image, int rating);
+
+    /**
+     * @brief Every known perceptual hash, in capture-date order (see `PerceptualIndex`).
+     *
+     * One row of three columns per image: 300k images load in well under a second.
+     */
+    [[nodiscard]] std::expected<std::vector<PerceptualHashEntry>, ErrorHandling::CoreError>
+    perceptualHashes() const;
+
+    // ============================================================
+    // Edits
+    // ============================================================
+
+    /**
+     * @brief Stores the edit stack of an image (binary edit format), replacing the previous one.
+     * @return void, `CoreError::NotInCatalog` for an unknown id, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    saveEdits(ImageId image, std::span<const Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Records the modification time and size of the sidecar whose edits were just saved.
+     * @param size The sidecar's size, or 0 if its edits were not read (then never served by
+     *             `findSidecarEdits` as the sidecar's own).
+     * @return void, `CoreError::NotInCatalog` for an unknown id, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    setSidecarMtime(ImageId image, std::int64_t mtime, std::uint64_t size = 0);
+
+    /**
+     * @brief Stores the edits parsed from a sidecar with the sidecar's modification time and
+     *        size, in one transaction.
+     * @return void, `CoreError::NotInCatalog` for an unknown id, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    saveSidecarEdits(ImageId image, std::span<const Operations::OperationDescriptor> operations,
+                     std::int64_t sidecar_mtime, std::uint64_t sidecar_size);
+
+    /**
+     * @brief Looks up an image by path with its edits and the stamp of the sidecar they were
+     *        read from, in one indexed query.
+     * @return The edits, `std::nullopt` if the path is not cataloged, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::optional<SidecarEdits>, ErrorHandling::CoreError>
+    findSidecarEdits(std::string_view path) const;
+
+    /**
+     * @brief Loads the edit stack of an image.
+     * @return The operations (empty if the image has no edits), `CoreError::DecodingError` /
+     *         `CoreError::UnsupportedFormat` for an unreadable blob, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+    loadEdits(ImageId image) const;
+
+    // ============================================================
+    // Keywords
+    // ============================================================
+
+    /**
+     * @brief Tags images with a keyword (created if new), in one transaction.
+     * @return void, or `CoreError::CatalogError` (nothing is tagged then).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    tagImages(std::span<const ImageId> images, std::string_view keyword);
+
+    /**
+     * @brief Keywords of an image, alphabetically.
+     */
+    [[nodiscard]] std::expected<std::vector<std::string>, ErrorHandling::CoreError>
+    keywordsOf(ImageId image) const;
+
+    // ============================================================
+    // Thumbnails
+    // ============================================================
+
+    /**
+     * @brief Stores the grid thumbnail of an image, rendered with the edits of `edit_hash`, and
+     *        its perceptual hash (if known) in the image record.
+     * @return void, `CoreError::NotInCatalog` for an unknown id, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    storeThumbnail(ImageId image, std::uint64_t edit_hash, const Thumbnails::Thumbnail& thumbnail);
+
+    /**
+     * @brief Loads the grid thumbnail of an image.
+     * @return The thumbnail, `std::nullopt` if there is none or it was rendered with other
+     *         edits, or `CoreError::CatalogError`.
+     */
+    [[nodiscard]] std::expected<std::optional<Thumbnails::Thumbnail>, ErrorHandling::CoreError>
+    loadThumbnail(ImageId image, std::uint64_t edit_hash) const;
+
+private:
+    /**
+     * @enum Statement
+     * @brief Statements of the pool, prepared once per connection.
+     */
+    enum class Statement : std::uint8_t {
+        InsertFolder,
+        FindFolder,
+        UpsertImage,
+        FindImage,
+        FindDuplicate,
+        GridAll,
+        GridFolder,
+        GridKeyword,
+        FolderImages,
+        FoldersUnder,
+        RemoveImage,
+        CountImages,
+        SetRating,
+        SaveEdits,
+        SetSidecarMtime,
+        SetPerceptualHash,
+        PerceptualHashes,
+        LoadEdits,
+        FindSidecarEdits,
+        InsertKeyword,
+        FindKeyword,
+        TagImage,
+        KeywordsOfImage,
+        StoreThumbnail,
+        LoadThumbnail,
+        Count
+    };
+
+    /**
+     * @struct Connection
+     * @brief A SQLite connection and its prepared statements.
+     */
+    struct Connection {
+        /**
+         * @brief Serializes the use of the connection and its statements.
+         */
+        std::mutex m_mutex;
+
+        /**
+         * @brief The connection.
+         */
+        sqlite3* m_db{nullptr};
+
+        /**
+         * @brief Statements prepared so far, by `Statement`.
+         */
+        std::array<sqlite3_stmt*, static_cast<std::size_t>(Statement::Count)> m_statements{};
+    };
+
+    CatalogDatabase() = default;
+
+    /**
+     * @brief Prepared statement of a connection, reset and unbound, prepared on first use.
+     * Caller holds the connection's mutex.
+     * @return The statement, or nullptr (logged) if it cannot be prepared.
+     */
+    [[nodiscard]] static sqlite3_stmt* statement_unsafe(Connection& connection, Statement statement);
+
+    /**
+     * @brief Folder id of a directory, inserted if new. Caller holds the write mutex.
+     * @return The id, or `std::nullopt` on a SQLite failure.
+     */
+    [[nodiscard]] std::optional<std::int64_t> folderId_unsafe(const std::string& folder);
+
+    /**
+     * @brief Finalizes the statements and closes a connection. Caller holds its mutex.
+     */
+    static void close_unsafe(Connection& connection) noexcept;
+
+    /**
+     * @brief Connection of the writes (schema, imports, ratings, edits, keywords, thumbnails).
+     */
+    mutable Connection m_write;
+
+    /**
+     * @brief Read-only connection of the queries.
+     */
+    mutable Connection m_read;
+
+    /**
+     * @brief Folder ids by path, so an import looks each folder up once. Guarded by the write mutex.
+     */
+    std::unordered_map<std::string, std::int64_t> m_folder_ids;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,86 @@
+/**
+ * @file catalog_edits_reader.h
+ * @brief Declaration of CatalogEditsReader (sidecar edits served from the catalog while unchanged).
+ *
+ * @details
+ * Opening an image parsed its XMP sidecar with Exiv2 every time, although the catalog already
+ * holds the edit stack in binary form. This reader stats the sidecar and looks the image up in
+ * the catalog (`CatalogDatabase::findSidecarEdits`, one indexed query): if the sidecar has the
+ * modification time and size the cataloged edits were parsed from, those are returned. Otherwise
+ * the sidecar is parsed by the wrapped reader and the result stored with the new stamp.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "catalog/catalog_database.h"
+#include "serializer/i_file_serializer_reader.h"
+#include "serializer/strategy/i_xmp_path_strategy.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @class CatalogEditsReader
+ * @brief IFileSerializerReader caching the parsed sidecars of cataloged images in the catalog.
+ *
+ * Images not in the catalog are read by the wrapped reader every time. Wraps the XMP reader
+ * itself: the cache is keyed on the sidecar at the strategy's path, so a reader preferring
+ * another file (`BinaryFileSerializerReader`) goes around it, not inside it.
+ */
+class CatalogEditsReader final : public Serializer::IFileSerializerReader {
+public:
+    /**
+     * @brief Constructs a CatalogEditsReader.
+     *
+     * @param catalog The catalog holding the edits; must outlive the reader.
+     * @param xmp_paths Locates the sidecars, as the wrapped reader does. Must not be null.
+     * @param reader Parses a sidecar on a miss. Must not be null.
+     */
+    CatalogEditsReader(CatalogDatabase& catalog,
+                       std::unique_ptr<Serializer::IXmpPathStrategy> xmp_paths,
+                       std::unique_ptr<Serializer::IFileSerializerReader> reader);
+
+    ~CatalogEditsReader() override = default;
+
+    CatalogEditsReader(const CatalogEditsReader&) = delete;
+    CatalogEditsReader& operator=(const CatalogEditsReader&) = delete;
+    CatalogEditsReader(CatalogEditsReader&&) = delete;
+    CatalogEditsReader& operator=(CatalogEditsReader&&) = delete;
+
+    /**
+     * @brief Loads the operations of an image: from the catalog if its sidecar is unchanged,
+     *        else parsed from the sidecar (and cataloged).
+     *
+     * @param source_image_path The path to the source image file.
+     * @return The operations, or an empty vector if none could be loaded.
+     */
+    [[nodiscard]] std::vector<Operations::OperationDescriptor> loadFromFile(std::string_view source_image_path) const override;
+
+private:
+    /**
+     * @brief The catalog holding the parsed edits.
+     */
+    CatalogDatabase& m_catalog;
+
+    /**
+     * @brief Strategy locating the sidecars.
+     */
+    std::unique_ptr<Serializer::IXmpPathStrategy> m_xmp_paths;
+
+    /**
+     * @brief Reader parsing a changed sidecar.
+     */
+    std::unique_ptr<Serializer::IFileSerializerReader> m_reader;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
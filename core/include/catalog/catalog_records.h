@@ -0,0 +1,189 @@
+/**
+ * @file catalog_records.h
+ * @brief Rows exchanged with the catalog: images, sidecar edits, perceptual hashes and grid queries.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "managers/image_metadata.h"
+#include "operations/operation_descriptor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @brief Identifier of an image in a catalog (0: not in the catalog).
+ */
+using ImageId = std::int64_t;
+
+/**
+ * @struct ImageRecord
+ * @brief One image of the catalog: its file, header metadata and rating.
+ */
+struct ImageRecord {
+    /**
+     * @brief Catalog identifier (0 until the record is added).
+     */
+    ImageId m_id{0};
+
+    /**
+     * @brief Absolute path of the file.
+     */
+    std::string m_path;
+
+    /**
+     * @brief Size of the file, in bytes, when it was imported.
+     */
+    std::uint64_t m_file_size{0};
+
+    /**
+     * @brief Modification time of the file (file clock ticks) when it was imported.
+     */
+    std::int64_t m_file_mtime{0};
+
+    /**
+     * @brief Modification time of the XMP sidecar (file clock ticks) whose edits the catalog
+     *        holds (0: none read).
+     */
+    std::int64_t m_sidecar_mtime{0};
+
+    /**
+     * @brief Size of that sidecar, in bytes (0: its edits were not read).
+     */
+    std::uint64_t m_sidecar_size{0};
+
+    /**
+     * @brief XXH3 hash of the file's bytes, computed by a card import (0: unknown). A change
+     *        of the file found by a sync resets it.
+     */
+    std::uint64_t m_content_hash{0};
+
+    /**
+     * @brief Difference hash of the picture (`Utils::differenceHash`, 0: unknown), from its
+     *        thumbnail. Kept by an update that brings none, unless the file changed.
+     */
+    std::uint64_t m_perceptual_hash{0};
+
+    /**
+     * @brief Dimensions, orientation, capture date, camera and lens.
+     */
+    Managers::ImageMetadata m_metadata;
+
+    /**
+     * @brief Star rating, 0 (unrated) to 5.
+     */
+    int m_rating{0};
+
+    /**
+     * @brief Time of the import, in seconds since the epoch.
+     */
+    std::int64_t m_import_time{0};
+};
+
+/**
+ * @struct SidecarEdits
+ * @brief An image's cataloged edits and the stamp of the sidecar they were parsed from.
+ */
+struct SidecarEdits {
+    ImageId m_id{0};
+
+    /**
+     * @brief Modification time of the sidecar (file clock ticks, 0: none read).
+     */
+    std::int64_t m_sidecar_mtime{0};
+
+    /**
+     * @brief Size of the sidecar, in bytes (0: its edits were not read).
+     */
+    std::uint64_t m_sidecar_size{0};
+
+    /**
+     * @brief The edit stack (`std::nullopt`: none stored, or unreadable).
+     */
+    std::optional<std::vector<Operations::OperationDescriptor>> m_operations;
+};
+
+/**
+ * @struct PerceptualHashEntry
+ * @brief An image's perceptual hash and capture date: what duplicate and burst grouping read.
+ */
+struct PerceptualHashEntry {
+    ImageId m_id{0};
+    std::uint64_t m_hash{0};
+
+    /**
+     * @brief EXIF capture date (`YYYY:MM:DD HH:MM:SS`, may be empty).
+     */
+    std::string m_capture_date;
+};
+
+/**
+ * @struct GridCursor
+ * @brief Position in the capture-date order of a grid: the last record of the previous page.
+ *
+ * Pages are read by key (`capture date, id` after the cursor), never by offset, so page N of a
+ * 300k-image grid costs the same as page 1.
+ */
+struct GridCursor {
+    /**
+     * @brief Capture date of the last record shown (empty sorts first).
+     */
+    std::string m_capture_date;
+
+    /**
+     * @brief Identifier of the last record shown (0: start of the grid).
+     */
+    ImageId m_id{0};
+
+    /**
+     * @brief Cursor continuing after a record.
+     */
+    [[nodiscard]] static GridCursor after(const ImageRecord& record)
+    {
+        return GridCursor { record.m_metadata.m_capture_date, record.m_id };
+    }
+};
+
+/**
+ * @struct GridQuery
+ * @brief One page of a filmstrip or grid, in capture-date order.
+ */
+struct GridQuery {
+    /**
+     * @brief Only the images of this folder (absolute path), if set.
+     */
+    std::optional<std::string> m_folder;
+
+    /**
+     * @brief Only the images tagged with this keyword, if set.
+     */
+    std::optional<std::string> m_keyword;
+
+    /**
+     * @brief Only the images rated at least this.
+     */
+    int m_min_rating{0};
+
+    /**
+     * @brief Start of the page (default: start of the grid).
+     */
+    GridCursor m_after;
+
+    /**
+     * @brief Maximum number of records of the page.
+     */
+    std::size_t m_limit{256};
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
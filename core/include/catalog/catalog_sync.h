@@ -0,0 +1,250 @@
+/**
+ * @file catalog_sync.h
+ * @brief Declaration of CatalogSync (keeps the catalog in step with the watched folders).
+ *
+ * @details
+ * Watched folders are never rescanned as a whole on a change:
+ * 1. `FolderWatcher` reports the changed paths; they are coalesced for `k_debounce` (a copy of
+ *    a card writes many files in a burst) and handled together on the sync thread.
+ * 2. Only the changed files are looked at: an image whose size or modification time differs
+ *    from its record has its header metadata re-read (`ISourceManager::readMetadataBatch`), an
+ *    image gone from disk is removed, and an XMP sidecar newer than the one the catalog read
+ *    has its edits re-read (`IFileSerializerReader`).
+ * 3. Every `reconcile_interval`, each watched tree is compared with the catalog by size and
+ *    modification time (a `stat` per file, no file is opened unless it changed). This catches
+ *    what the notifications missed: network shares often report nothing, and a queue overflow
+ *    loses events.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "catalog/catalog_database.h"
+#include "catalog/folder_watcher.h"
+#include "common/error_handling/core_error.h"
+#include "managers/i_source_manager.h"
+#include "serializer/i_file_serializer_reader.h"
+#include "serializer/strategy/i_xmp_path_strategy.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @struct SyncStats
+ * @brief What one sync pass changed in the catalog.
+ */
+struct SyncStats {
+    /**
+     * @brief Images added, or whose metadata was re-read.
+     */
+    std::size_t m_images_updated{0};
+
+    /**
+     * @brief Images removed (their file is gone).
+     */
+    std::size_t m_images_removed{0};
+
+    /**
+     * @brief Images whose edits were re-read from a changed sidecar.
+     */
+    std::size_t m_edits_refreshed{0};
+};
+
+/**
+ * @class CatalogSync
+ * @brief Applies the changes of watched folder trees to a catalog, incrementally.
+ */
+class CatalogSync {
+public:
+    /**
+     * @brief Quiet time after the last change before a burst of changes is applied.
+     */
+    static constexpr std::chrono::milliseconds k_debounce { 500 };
+
+    /**
+     * @brief Longest a change waits for its burst to end (a long copy still shows up).
+     */
+    static constexpr std::chrono::milliseconds k_max_delay { 5000 };
+
+    /**
+     * @brief Default time between two reconciliations of the watched trees.
+     */
+    static constexpr std::chrono::seconds k_default_reconcile_interval { 15 * 60 };
+
+    /**
+     * @brief Creates the sync, with no folder watched.
+     * @param catalog The catalog kept up to date (must outlive the sync).
+     * @param reader Reads the edits of a sidecar (nullptr: edits are not synced).
+     * @param xmp_paths Maps images to their sidecars (nullptr: `SidecarXmpPathStrategy`).
+     * @param source Reads the header metadata (nullptr: a dedicated `SourceManager`).
+     * @param reconcile_interval Time between two reconciliations of the watched trees.
+     */
+    explicit CatalogSync(CatalogDatabase& catalog,
+                         std::unique_ptr<Serializer::IFileSerializerReader> reader = nullptr,
+                         std::unique_ptr<Serializer::IXmpPathStrategy> xmp_paths = nullptr,
+                         std::unique_ptr<Managers::ISourceManager> source = nullptr,
+                         std::chrono::seconds reconcile_interval = k_default_reconcile_interval);
+
+    /**
+     * @brief Stops watching and waits for the pass in progress.
+     */
+    ~CatalogSync();
+
+    CatalogSync(const CatalogSync&) = delete;
+    CatalogSync& operator=(const CatalogSync&) = delete;
+
+    /**
+     * @brief Keeps a folder tree in sync, starting with a reconciliation on the sync thread.
+     *
+     * Where the platform (or the file system) sends no notifications, the tree is still
+     * reconciled every `reconcile_interval`.
+     *
+     * @return void, or `CoreError::FileNotFound` if `root` is not a directory.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path& root);
+
+    /**
+     * @brief Stops syncing a folder tree (its images stay in the catalog).
+     */
+    void unwatch(const std::filesystem::path& root);
+
+    /**
+     * @brief Compares a folder tree with the catalog and applies the differences (blocking).
+     * @return What changed, or `CoreError::CatalogError` (what was applied before stays).
+     */
+    [[nodiscard]] std::expected<SyncStats, ErrorHandling::CoreError> reconcile(const std::filesystem::path& root);
+
+    /**
+     * @brief true for the extension of an image format the source manager reads.
+     */
+    [[nodiscard]] static bool isImageFile(const std::filesystem::path& path);
+
+private:
+    /**
+     * @brief An image file to look at, with its record if it is cataloged.
+     */
+    struct Candidate {
+        std::string m_path;
+        std::optional<ImageRecord> m_record;
+    };
+
+    /**
+     * @brief Queues changed paths and wakes the sync thread (watcher thread).
+     */
+    void onChanges(std::vector<std::filesystem::path> paths);
+
+    /**
+     * @brief Sync thread: applies the bursts of changes and the periodic reconciliations.
+     */
+    void run();
+
+    /**
+     * @brief Applies a burst of changed paths. Caller holds m_sync_mutex.
+     */
+    std::expected<void, ErrorHandling::CoreError> applyChanges_unsafe(const std::vector<std::filesystem::path>& paths, SyncStats& stats);
+
+    /**
+     * @brief Compares a tree with the catalog. Caller holds m_sync_mutex.
+     */
+    std::expected<void, ErrorHandling::CoreError> reconcile_unsafe(const std::filesystem::path& root, SyncStats& stats);
+
+    /**
+     * @brief Brings the images of `candidates` up to date: removed if gone, metadata re-read if
+     *        the file changed, edits re-read if the sidecar changed. Caller holds m_sync_mutex.
+     */
+    std::expected<void, ErrorHandling::CoreError> refresh_unsafe(std::vector<Candidate> candidates, SyncStats& stats);
+
+    /**
+     * @brief The catalog kept up to date.
+     */
+    CatalogDatabase& m_catalog;
+
+    /**
+     * @brief Reader of the sidecar edits (nullptr: edits are not synced).
+     */
+    std::unique_ptr<Serializer::IFileSerializerReader> m_reader;
+
+    /**
+     * @brief Maps images to their sidecars.
+     */
+    std::unique_ptr<Serializer::IXmpPathStrategy> m_xmp_paths;
+
+    /**
+     * @brief Reads the header metadata of changed files.
+     */
+    std::unique_ptr<Managers::ISourceManager> m_source;
+
+    /**
+     * @brief Time between two reconciliations of the watched trees.
+     */
+    const std::chrono::seconds m_reconcile_interval;
+
+    /**
+     * @brief Serializes the sync passes (sync thread and `reconcile`).
+     */
+    std::mutex m_sync_mutex;
+
+    /**
+     * @brief Guards the state below, shared with the watcher thread.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Wakes the sync thread (changes, new root, stop).
+     */
+    std::condition_variable m_wake;
+
+    /**
+     * @brief Watched roots.
+     */
+    std::vector<std::filesystem::path> m_roots;
+
+    /**
+     * @brief Roots waiting for their first reconciliation.
+     */
+    std::vector<std::filesystem::path> m_unreconciled;
+
+    /**
+     * @brief Changed paths not applied yet.
+     */
+    std::unordered_set<std::string> m_pending;
+
+    /**
+     * @brief Arrival of the first and of the last pending change.
+     */
+    std::chrono::steady_clock::time_point m_first_change;
+    std::chrono::steady_clock::time_point m_last_change;
+
+    /**
+     * @brief Set to stop the sync thread.
+     */
+    bool m_stopping{false};
+
+    std::thread m_thread;
+
+    /**
+     * @brief Change notifications (declared last: destroyed first, so no callback reaches a
+     *        destroyed member).
+     */
+    std::unique_ptr<FolderWatcher> m_watcher;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,88 @@
+/**
+ * @file folder_watcher.h
+ * @brief Declaration of FolderWatcher (change notifications of folder trees).
+ *
+ * @details
+ * The operating system reports changes in a watched tree, so the catalog does not rescan it:
+ * - Linux: inotify, one watch per directory (added as directories appear).
+ * - Windows: `ReadDirectoryChangesW` on each root, subtree included.
+ * - macOS: an FSEvents stream over the roots, with file-level events.
+ *
+ * Notifications are best effort: network shares often report nothing, and a burst can overflow
+ * the kernel queue (the root is then reported, to be rescanned). `CatalogSync` reconciles
+ * periodically to catch what was missed.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @class FolderWatcher
+ * @brief Watches folder trees and reports the paths that changed.
+ */
+class FolderWatcher {
+public:
+    /**
+     * @brief Receives changed paths, on the watcher's thread (must return quickly).
+     *
+     * A path is a file (created, written, renamed or deleted) or a directory whose content
+     * must be rescanned as a whole (a directory moved in, or a queue overflow).
+     */
+    using ChangeCallback = std::function<void(std::vector<std::filesystem::path> paths)>;
+
+    /**
+     * @brief true if this platform reports changes (otherwise `watch` fails).
+     */
+    [[nodiscard]] static bool isSupported() noexcept;
+
+    /**
+     * @brief Creates a watcher with no folder watched.
+     */
+    explicit FolderWatcher(ChangeCallback callback);
+
+    /**
+     * @brief Stops watching. No callback runs once it returns.
+     */
+    ~FolderWatcher();
+
+    FolderWatcher(const FolderWatcher&) = delete;
+    FolderWatcher& operator=(const FolderWatcher&) = delete;
+
+    /**
+     * @brief Watches a folder and everything below it.
+     * @return void, `CoreError::FileNotFound` if `root` is not a directory, or
+     *         `CoreError::IOError` if the system refuses the watch (or has no notifications).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path& root);
+
+    /**
+     * @brief Stops watching a folder tree given to `watch`.
+     */
+    void unwatch(const std::filesystem::path& root);
+
+private:
+    /**
+     * @brief The platform's notification state (and thread).
+     */
+    struct Platform;
+
+    std::unique_ptr<Platform> m_platform;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,154 @@
+/**
+ * @file perceptual_index.h
+ * @brief Declaration of PerceptualIndex (near-duplicate and burst grouping by perceptual hash).
+ *
+ * @details
+ * Comparing every pair of 300k hashes is 45 billion comparisons. The index answers "which hashes
+ * are within r bits of this one" without a scan, by multi-index hashing:
+ * - Each 64-bit hash is split in `k_chunks` chunks of 16 bits, and each chunk position has a
+ *   table from chunk value to the images holding it (counting-sorted arrays, built in O(n)).
+ * - Two hashes within r bits share at least one chunk within floor(r / k_chunks) bits (pigeonhole):
+ *   a query probes, in each table, the chunk values that close to its own, and checks the full
+ *   distance of the few images found there. Up to r = 3 a query is four exact bucket lookups.
+ *
+ * Bursts need no index: in capture order, the frames of a burst are consecutive, seconds apart
+ * at most and nearly identical, so `burstGroups` is a single pass.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "catalog/catalog_records.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Catalog {
+
+/**
+ * @class PerceptualIndex
+ * @brief Immutable index of perceptual hashes (`CatalogDatabase::perceptualHashes`).
+ *
+ * @details
+ * Built once from a snapshot of the catalog and read by any number of threads. The tables add
+ * 12 bytes per image and chunk to the entries, plus 1 MB of offsets.
+ */
+class PerceptualIndex {
+public:
+    /**
+     * @brief Chunks a hash is split in (one table each).
+     */
+    static constexpr std::size_t k_chunks { 4 };
+
+    /**
+     * @brief Default distance, in bits, of near-duplicates: the same picture resized,
+     *        recompressed or rendered from its raw twin.
+     */
+    static constexpr int k_default_duplicate_radius { 3 };
+
+    /**
+     * @brief Default distance, in bits, between consecutive frames of a burst.
+     */
+    static constexpr int k_default_burst_radius { 10 };
+
+    /**
+     * @brief Default longest time between consecutive frames of a burst.
+     */
+    static constexpr std::chrono::seconds k_default_burst_gap { 2 };
+
+    /**
+     * @brief Indexes a snapshot of the catalog's hashes (entries whose hash is 0 are skipped).
+     */
+    explicit PerceptualIndex(std::vector<PerceptualHashEntry> entries);
+
+    /**
+     * @brief Number of indexed images.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Images whose hash is within `radius` bits of `hash` (the query image included if
+     *        indexed), in the order of the entries.
+     */
+    [[nodiscard]] std::vector<ImageId> near(std::uint64_t hash, int radius) const;
+
+    /**
+     * @brief Groups of near-duplicates: the images linked by chains of hashes within `radius`
+     *        bits. Images without a duplicate are left out.
+     * @return The groups, each in the order of the entries, ordered by their first image.
+     */
+    [[nodiscard]] std::vector<std::vector<ImageId>> duplicateGroups(int radius = k_default_duplicate_radius) const;
+
+    /**
+     * @brief Groups of burst frames: runs of consecutive images at most `max_gap` apart whose
+     *        hashes differ from the previous frame by at most `radius` bits.
+     * @param entries The images in capture order (as `CatalogDatabase::perceptualHashes` reads
+     *        them). Images without a capture date never join a burst.
+     * @return The bursts of two frames or more, in capture order.
+     */
+    [[nodiscard]] static std::vector<std::vector<ImageId>>
+    burstGroups(std::span<const PerceptualHashEntry> entries, int radius = k_default_burst_radius,
+                std::chrono::seconds max_gap = k_default_burst_gap);
+
+    /**
+     * @brief Seconds since the epoch of an EXIF capture date (`YYYY:MM:DD HH:MM:SS`; `-` also
+     *        accepted between the date fields).
+     * @return The time, or `std::nullopt` for an empty or malformed date.
+     */
+    [[nodiscard]] static std::optional<std::int64_t> captureSeconds(std::string_view date);
+
+private:
+    /**
+     * @brief Bits per chunk, and values per table.
+     */
+    static constexpr int k_chunk_bits { 16 };
+    static constexpr std::size_t k_chunk_values { std::size_t{1} << k_chunk_bits };
+
+    /**
+     * @brief Chunk `chunk` of a hash.
+     */
+    [[nodiscard]] static std::uint32_t chunkOf(std::uint64_t hash, std::size_t chunk) noexcept;
+
+    /**
+     * @brief Calls `visit` with the index of every entry within `radius` bits of `hash`, possibly
+     *        several times for one entry.
+     */
+    template <typename Visitor>
+    void forEachNear(std::uint64_t hash, int radius, Visitor&& visit) const;
+
+    /**
+     * @brief The indexed images (hash not 0), in the order they were given.
+     */
+    std::vector<PerceptualHashEntry> m_entries;
+
+    /**
+     * @brief Per table: where the entries of each chunk value start in `m_members`
+     *        (`k_chunk_values + 1` offsets).
+     */
+    std::array<std::vector<std::uint32_t>, k_chunks> m_offsets;
+
+    /**
+     * @brief Per table: entry indices grouped by chunk value.
+     */
+    std::array<std::vector<std::uint32_t>, k_chunks> m_members;
+
+    /**
+     * @brief Per table: the hashes of `m_members`, side by side, so a bucket is checked without
+     *        reaching into `m_entries`.
+     */
+    std::array<std::vector<std::uint64_t>, k_chunks> m_hashes;
+};
+
+} // namespace Catalog
+
+} // namespace CaptureMoment::Core
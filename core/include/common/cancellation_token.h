@@ -0,0 +1,89 @@
+/**
+ * @file cancellation_token.h
+ * @brief Generation-based cooperative cancellation token.
+ *
+ * @details
+ * Each processing request is numbered by its submitter. The token of a request compares its
+ * own generation with the latest one issued: as soon as a newer request (or an explicit
+ * cancellation) bumps the counter, every older token reports `isCancelled()`. Long-running
+ * work polls the token at safe points (e.g. between Halide parallel tasks) and stops early.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class CancellationToken
+ * @brief Cheap, copyable view of a request generation.
+ *
+ * @details
+ * A default-constructed token is never cancelled. Copies share the same counter, so a token
+ * may be handed to worker threads by value. `isCancelled()` is a single relaxed atomic load.
+ */
+class CancellationToken {
+public:
+    /**
+     * @brief Counter of the latest issued generation, owned by the submitter.
+     */
+    using Counter = std::atomic<std::uint64_t>;
+
+    /**
+     * @brief Creates a token that is never cancelled.
+     */
+    CancellationToken() = default;
+
+    /**
+     * @brief Creates a token for one generation of a counter.
+     * @param latest Counter bumped by the submitter for every new request or cancellation.
+     * @param generation Generation of the request this token belongs to.
+     */
+    CancellationToken(std::shared_ptr<const Counter> latest, std::uint64_t generation) noexcept
+        : m_latest(std::move(latest))
+        , m_generation(generation)
+    {
+    }
+
+    /**
+     * @brief true once a newer generation was issued.
+     */
+    [[nodiscard]] bool isCancelled() const noexcept
+    {
+        return m_latest && m_latest->load(std::memory_order_relaxed) != m_generation;
+    }
+
+    /**
+     * @brief true if this token can ever be cancelled (i.e. it is bound to a counter).
+     */
+    [[nodiscard]] bool isCancellable() const noexcept { return static_cast<bool>(m_latest); }
+
+    /**
+     * @brief Generation of the request this token belongs to (0 for an unbound token).
+     */
+    [[nodiscard]] std::uint64_t generation() const noexcept { return m_generation; }
+
+private:
+    /**
+     * @brief Latest generation issued by the submitter.
+     */
+    std::shared_ptr<const Counter> m_latest;
+
+    /**
+     * @brief Generation of this token.
+     */
+    std::uint64_t m_generation{0};
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
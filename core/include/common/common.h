@@ -35,11 +35,66 @@
  */
 #include "common/image_region.h"
 
+/**
+ * @brief Read-only, keep-alive view over float pixels (zero-copy export of working images).
+ */
+#include "common/image_view.h"
+
 /**
  * @brief Definition of supported pixel formats (e.g., RGBA_U8, RGBA_F32).
  */
 #include "common/pixel_format.h"
 
+/**
+ * @brief Display-ready RGBA8 (sRGB) image produced by the pipeline for the viewport.
+ */
+#include "common/display_image.h"
+
+/**
+ * @brief Generation-based cooperative cancellation token for processing requests.
+ */
+#include "common/cancellation_token.h"
+
+/**
+ * @brief Single-writer sequence lock publishing a POD value without blocking.
+ */
+#include "common/seqlock.h"
+
+/**
+ * @brief Triple-buffered single-producer/single-consumer handoff of the latest frame.
+ */
+#include "common/frame_mailbox.h"
+
+/**
+ * @brief Size-class pool of aligned blocks backing pixel buffers (`PixelBuffer`, `PooledArray`).
+ */
+#include "common/memory/buffer_pool.h"
+
+/**
+ * @brief Read-only memory mapping of a whole file (pages faulted in on demand).
+ */
+#include "common/memory/mapped_file.h"
+
+/**
+ * @brief Contents of a whole file read with parallel reads (network storage read-ahead).
+ */
+#include "common/memory/read_ahead_file.h"
+
+/**
+ * @brief Anonymous memory region shared with another process (memfd, POSIX shared memory).
+ */
+#include "common/memory/shared_memory.h"
+
+/**
+ * @brief Process-wide memory ceiling shared by the caches and pools (LRU eviction, usage report).
+ */
+#include "common/memory/memory_budget.h"
+
+/**
+ * @brief Process-wide counters and histograms, exported as a snapshot or Prometheus text.
+ */
+#include "common/metrics/core_metrics.h"
+
 // ============================================================
 // 3. Common Types
 // ============================================================
@@ -54,4 +109,14 @@
  */
 #include "common/types/image_types.h"
 
+/**
+ * @brief Rectangular region of interest used to restrict processing to visible pixels.
+ */
+#include "common/types/region_of_interest.h"
+
+/**
+ * @brief Final state of a processing request (completed, superseded, cancelled, failed).
+ */
+#include "common/types/processing_outcome.h"
+
 // Add other common headers as needed
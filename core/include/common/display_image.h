@@ -0,0 +1,141 @@
+/**
+ * @file display_image.h
+ * @brief Defines the DisplayImage structure: display-ready, 8-bit sRGB pixels.
+ *
+ * @details
+ * `ImageRegion` carries linear float data for processing. The viewport only needs
+ * a small, gamma-encoded 8-bit image, which the pipeline can produce directly
+ * (see `Pipeline::DisplayEncodeStage`). The UI uploads these bytes as is.
+ *
+ * On the GPU backend the bytes may instead stay on the device (`DisplayDeviceBuffer`):
+ * a renderer on the same GPU API then samples them without any host transfer.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "preview_histogram.h"
+#include "types/image_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @struct DisplayDeviceBuffer
+ * @brief Native GPU buffer holding the rows of a device-resident DisplayImage.
+ */
+struct DisplayDeviceBuffer {
+    /**
+     * @brief GPU API owning the native handle.
+     */
+    enum class Api : std::uint8_t {
+        None,   ///< No device buffer
+        Metal   ///< `m_native_buffer` is an `id<MTLBuffer>`
+    };
+
+    /**
+     * @brief API of the handle.
+     */
+    Api m_api{Api::None};
+
+    /**
+     * @brief Native buffer object (not retained: `m_keep_alive` owns it).
+     */
+    std::uintptr_t m_native_buffer{0};
+
+    /**
+     * @brief Byte offset of the first row in the native buffer.
+     */
+    std::size_t m_offset{0};
+
+    /**
+     * @brief Byte distance between rows (padded for texture aliasing, >= width * 4).
+     */
+    std::size_t m_bytes_per_row{0};
+
+    /**
+     * @brief Owns the device allocation; the buffer is recycled once the last copy is gone.
+     */
+    std::shared_ptr<const void> m_keep_alive;
+
+    /**
+     * @brief Checks that a native buffer is attached.
+     */
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_api != Api::None && m_native_buffer != 0 && m_keep_alive != nullptr;
+    }
+};
+
+/**
+ * @struct DisplayImage
+ * @brief RGBA8 image, sRGB-encoded, interleaved, row-major (`data[(y * width + x) * 4 + c]`).
+ */
+struct DisplayImage {
+    /**
+     * @brief Number of channels (always RGBA).
+     */
+    static constexpr ImageChan k_channels = 4;
+
+    /**
+     * @brief Width in pixels.
+     */
+    ImageDim m_width{0};
+
+    /**
+     * @brief Height in pixels.
+     */
+    ImageDim m_height{0};
+
+    /**
+     * @brief Pixel bytes, `m_width * m_height * k_channels` long.
+     */
+    std::vector<std::uint8_t> m_data;
+
+    /**
+     * @brief Device copy of the pixels; when set, `m_data` is empty.
+     */
+    DisplayDeviceBuffer m_device;
+
+    /**
+     * @brief Histogram of the pixels, when requested (see `PhotoEngine::setHistogramEnabled`).
+     */
+    std::shared_ptr<const PreviewHistogram> m_histogram;
+
+    /**
+     * @brief Number of bytes of one row.
+     */
+    [[nodiscard]] constexpr std::size_t bytesPerLine() const noexcept
+    {
+        return static_cast<std::size_t>(m_width) * k_channels;
+    }
+
+    /**
+     * @brief Checks that the pixels live on the device only (see `m_device`).
+     */
+    [[nodiscard]] bool isOnDevice() const noexcept
+    {
+        return m_width > 0 && m_height > 0 && m_data.empty() && m_device.isValid();
+    }
+
+    /**
+     * @brief Checks that the dimensions are non-zero and match the (host) data size.
+     */
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return m_width > 0 && m_height > 0
+               && m_data.size() == bytesPerLine() * static_cast<std::size_t>(m_height);
+    }
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -105,6 +105,39 @@ enum class CoreError : uint8_t {
      */
     SourceNotLoaded = 9,
 
+    /**
+     * @brief An asynchronous load was cancelled or superseded before its image was installed.
+     * @details The decoded image (if decoding completed) is kept in the decoded-image cache.
+     */
+    LoadCancelled = 10,
+
+    // ==========================================
+    // Catalog Errors
+    // ==========================================
+
+    /**
+     * @brief The catalog database could not be opened, read or written.
+     * @details Covers SQLite failures (locked, corrupt or read-only database, failed transaction).
+     */
+    CatalogError = 11,
+
+    /**
+     * @brief The catalog has no record of the requested image.
+     * @details Raised when an image id does not (or no longer) exist in the catalog.
+     */
+    NotInCatalog = 12,
+
+    // ==========================================
+    // Plugin Errors
+    // ==========================================
+
+    /**
+     * @brief An operation plugin could not be loaded.
+     * @details The library is missing or lacks the entry points, was built against another plugin
+     *          API version, or registered no operation.
+     */
+    PluginError = 13,
+
     // ==========================================
     // System Errors
     // ==========================================
@@ -175,12 +208,16 @@ enum class CoreErrorCategory : uint8_t {
     case CoreError::FileNotFound:
     case CoreError::UnsupportedFormat:
     case CoreError::SourceNotLoaded:
+    case CoreError::LoadCancelled:
         return CoreErrorCategory::Source;
 
     case CoreError::DecodingError:
+    case CoreError::CatalogError:
+    case CoreError::NotInCatalog:
         return CoreErrorCategory::Serialization;
 
     case CoreError::Success:
+    case CoreError::PluginError:
     case CoreError::Unexpected:
     default:
         return CoreErrorCategory::System;
@@ -208,7 +245,11 @@ enum class CoreErrorCategory : uint8_t {
     case CoreError::FileNotFound:  return "FileNotFound";
     case CoreError::UnsupportedFormat: return "UnsupportedFormat";
     case CoreError::SourceNotLoaded: return "SourceNotLoaded";
+    case CoreError::LoadCancelled: return "LoadCancelled";
     case CoreError::DecodingError: return "DecodingError";
+    case CoreError::CatalogError: return "CatalogError";
+    case CoreError::NotInCatalog: return "NotInCatalog";
+    case CoreError::PluginError: return "PluginError";
     default: return "Unknown";
     }
 }
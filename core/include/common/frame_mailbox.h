@@ -0,0 +1,130 @@
+/**
+ * @file frame_mailbox.h
+ * @brief Triple-buffered single-producer/single-consumer mailbox handing over the latest frame.
+ *
+ * @details
+ * Three slots: the producer owns one (back), the consumer owns one (front), and the third
+ * (middle) is shared. Publishing fills the back slot, then swaps it with the middle one in a
+ * single atomic exchange that also raises a "fresh" bit; acquiring swaps the middle slot with
+ * the front one if that bit is up. Neither side ever waits for the other, whatever it is
+ * doing with its own slot: the producer can publish while a frame is being converted, and
+ * frames published faster than they are acquired simply replace each other (latest wins).
+ *
+ * Slots are recycled, never allocated: after `publish()` the back slot holds a frame the
+ * consumer is done with, that the producer may reuse or release.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class FrameMailbox
+ * @brief Latest-value handoff of movable frames from one thread to another, without a lock.
+ *
+ * @tparam T Default-constructible frame (e.g. an image and its metadata).
+ *
+ * @warning One producer thread (`back`, `publish`) and one consumer thread (`acquire`, `front`).
+ */
+template<typename T>
+class FrameMailbox {
+public:
+    /**
+     * @brief Slot the producer fills before `publish()`. Producer thread only.
+     */
+    [[nodiscard]] T& back() noexcept { return m_slots[m_back]; }
+
+    /**
+     * @brief Hands the back slot over to the consumer; the producer gets a recycled slot.
+     */
+    void publish() noexcept
+    {
+        m_back = static_cast<std::uint8_t>(
+            m_middle.exchange(static_cast<std::uint8_t>(m_back | k_fresh), std::memory_order_acq_rel) & k_index_mask);
+    }
+
+    /**
+     * @brief Fills the back slot with a frame and publishes it.
+     */
+    void publish(T frame)
+    {
+        back() = std::move(frame);
+        publish();
+    }
+
+    /**
+     * @brief true if a frame was published since the last `acquire()`. Any thread.
+     */
+    [[nodiscard]] bool hasFresh() const noexcept
+    {
+        return (m_middle.load(std::memory_order_acquire) & k_fresh) != 0;
+    }
+
+    /**
+     * @brief Takes the latest published frame into the front slot. Consumer thread only.
+     * @return true if `front()` changed, false if nothing was published since the last call.
+     */
+    bool acquire() noexcept
+    {
+        if (!hasFresh()) {
+            return false;
+        }
+        m_front = static_cast<std::uint8_t>(m_middle.exchange(m_front, std::memory_order_acq_rel) & k_index_mask);
+        return true;
+    }
+
+    /**
+     * @brief Latest acquired frame, owned by the consumer until its next `acquire()`.
+     */
+    [[nodiscard]] T& front() noexcept { return m_slots[m_front]; }
+
+    /**
+     * @copydoc front()
+     */
+    [[nodiscard]] const T& front() const noexcept { return m_slots[m_front]; }
+
+private:
+    /**
+     * @brief Bit of `m_middle` set while the middle slot holds an unacquired frame.
+     */
+    static constexpr std::uint8_t k_fresh { 0x4 };
+
+    /**
+     * @brief Bits of `m_middle` holding the slot index.
+     */
+    static constexpr std::uint8_t k_index_mask { 0x3 };
+
+    /**
+     * @brief The three slots.
+     */
+    std::array<T, 3> m_slots {};
+
+    /**
+     * @brief Index of the shared slot, with `k_fresh`.
+     */
+    alignas(64) std::atomic<std::uint8_t> m_middle { 1 };
+
+    /**
+     * @brief Index of the producer's slot (producer thread only).
+     */
+    alignas(64) std::uint8_t m_back { 0 };
+
+    /**
+     * @brief Index of the consumer's slot (consumer thread only).
+     */
+    alignas(64) std::uint8_t m_front { 2 };
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -13,6 +13,7 @@
 
 #include "pixel_format.h"
 #include "types/image_types.h"
+#include "memory/buffer_pool.h"
 
 #include <vector>
 #include <cstddef>
@@ -46,6 +47,16 @@ namespace Common {
  */
 struct ImageRegion {
 
+    /**
+     * @brief Element type of the pixel data (see `TypedImageLike`).
+     */
+    using value_type = float;
+
+    /**
+     * @brief Element order of the pixel data (see `TypedImageLike`).
+     */
+    static constexpr PixelLayout k_layout { PixelLayout::Interleaved };
+
     // ============================================================
     // Dimensions & Meta-data
     // ============================================================
@@ -83,9 +94,10 @@ struct ImageRegion {
     /**
      * @brief Pixel data (row-major layout).
      *
-     * Stored as float32 to support HDR.
+     * Stored as float32 to support HDR. The storage is borrowed from `BufferPool`
+     * (aligned, recycled) and `resize` does not zero-fill: writers must cover every element.
      */
-    std::vector<float> m_data;
+    PixelBuffer m_data;
 
     // ============================================================
     // Constructors
@@ -118,7 +130,7 @@ struct ImageRegion {
      * @note The x and y coordinates default to (0, 0).
      * @note Format defaults to PixelFormat::RGBA_F32.
      */
-    ImageRegion(std::vector<float>&& data, ImageDim w, ImageDim h, ImageChan ch)
+    ImageRegion(PixelBuffer&& data, ImageDim w, ImageDim h, ImageChan ch)
         : m_data(std::move(data))
         , m_width(w)
         , m_height(h)
@@ -136,7 +148,7 @@ struct ImageRegion {
      * @param h Height in pixels.
      * @param ch Number of color channels per pixel.
      */
-    ImageRegion(ImageCoord x, ImageCoord y, std::vector<float>&& data, ImageDim w, ImageDim h, ImageChan ch)
+    ImageRegion(ImageCoord x, ImageCoord y, PixelBuffer&& data, ImageDim w, ImageDim h, ImageChan ch)
         : m_x(x)
         , m_y(y)
         , m_data(std::move(data))
@@ -343,6 +355,40 @@ concept MutableImageLike = ImageLike<T> && requires(T t)
     { t.getBuffer() } -> std::convertible_to<std::span<float>>;
 };
 
+/**
+ * @concept TypedImageLike
+ * @brief Generalizes ImageLike to any element type and layout.
+ *
+ * The type names its element type (`value_type`) and its layout (`k_layout`), and reads its
+ * elements through `operator()(y, x, c)` whatever the layout. `ImageRegion` is the float,
+ * interleaved case; `ImageRegionT` covers 8-bit, 16-bit, half and float, interleaved and planar.
+ */
+template<typename T>
+concept TypedImageLike = requires(const T& t)
+{
+    typename T::value_type;
+    { T::k_layout } -> std::convertible_to<PixelLayout>;
+
+    { t.m_width } -> std::convertible_to<Common::ImageDim>;
+    { t.m_height } -> std::convertible_to<Common::ImageDim>;
+    { t.m_channels } -> std::convertible_to<Common::ImageChan>;
+    { t.isValid() } -> std::same_as<bool>;
+
+    { t.getBuffer() } -> std::convertible_to<std::span<const typename T::value_type>>;
+    { t(0, 0, 0) } -> std::convertible_to<typename T::value_type>;
+};
+
+/**
+ * @concept MutableTypedImageLike
+ * @brief Extends TypedImageLike to require read/write access.
+ */
+template<typename T>
+concept MutableTypedImageLike = TypedImageLike<T> && requires(T t)
+{
+    { t.getBuffer() } -> std::convertible_to<std::span<typename T::value_type>>;
+    { t(0, 0, 0) } -> std::same_as<typename T::value_type&>;
+};
+
 } // namespace Common
 
 } // namespace CaptureMoment::Core
@@ -0,0 +1,179 @@
+/**
+ * @file image_view.h
+ * @brief Defines the ImageView structure: a read-only, lifetime-safe view over float pixels.
+ *
+ * @details
+ * `IWorkingImageHardware::exportToCPUCopy` deep-copies the whole image. Readers that only
+ * need to look at the pixels (writing back to the source, feeding an out-of-place kernel)
+ * use `IWorkingImageHardware::exportToCPUView` instead, which returns this view over the
+ * working image's own host storage.
+ *
+ * The view holds a keep-alive handle on that storage: the memory stays valid for as long
+ * as the view exists, even if the working image is destroyed or re-initialized meanwhile.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "image_region.h"
+#include "types/image_types.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @struct ImageView
+ * @brief Non-owning (but keep-alive) read-only access to float RGBA pixels.
+ *
+ * @details
+ * Element `(x, y, c)` lives at `m_data[y * m_y_stride + x * m_x_stride + c * m_c_stride]`.
+ * Working images are interleaved (`m_x_stride == m_channels`, `m_c_stride == 1`), but readers
+ * should go through the strides rather than assume it.
+ *
+ * @note The keep-alive guarantees the memory, not the contents: processing the working image
+ *       in place while a view is held is visible through the view. Views are meant to be
+ *       short-lived, taken and consumed within one step.
+ */
+struct ImageView {
+    /**
+     * @brief The pixel elements, starting at `(0, 0, 0)`.
+     */
+    std::span<const float> m_data;
+
+    /**
+     * @brief Width in pixels.
+     */
+    ImageDim m_width{0};
+
+    /**
+     * @brief Height in pixels.
+     */
+    ImageDim m_height{0};
+
+    /**
+     * @brief Number of channels per pixel.
+     */
+    ImageChan m_channels{0};
+
+    /**
+     * @brief Distance, in elements, between horizontally adjacent pixels.
+     */
+    std::size_t m_x_stride{0};
+
+    /**
+     * @brief Distance, in elements, between vertically adjacent pixels (one row).
+     */
+    std::size_t m_y_stride{0};
+
+    /**
+     * @brief Distance, in elements, between the channels of a pixel.
+     */
+    std::size_t m_c_stride{1};
+
+    /**
+     * @brief Shared ownership of the storage `m_data` points into.
+     */
+    std::shared_ptr<const void> m_keep_alive;
+
+    /**
+     * @brief Builds a view over dense interleaved storage (`data[(y * width + x) * channels + c]`).
+     */
+    [[nodiscard]] static ImageView interleaved(std::span<const float> data, ImageDim width, ImageDim height,
+                                               ImageChan channels, std::shared_ptr<const void> keep_alive) noexcept
+    {
+        ImageView view;
+        view.m_data = data;
+        view.m_width = width;
+        view.m_height = height;
+        view.m_channels = channels;
+        view.m_x_stride = static_cast<std::size_t>(channels);
+        view.m_y_stride = static_cast<std::size_t>(width) * channels;
+        view.m_c_stride = 1;
+        view.m_keep_alive = std::move(keep_alive);
+        return view;
+    }
+
+    /**
+     * @brief Checks the dimensions, the keep-alive handle, and that every element lies within `m_data`.
+     */
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        if (m_width == 0 || m_height == 0 || m_channels == 0 || !m_keep_alive) {
+            return false;
+        }
+
+        const std::size_t last = (static_cast<std::size_t>(m_height) - 1) * m_y_stride
+                                 + (static_cast<std::size_t>(m_width) - 1) * m_x_stride
+                                 + (static_cast<std::size_t>(m_channels) - 1) * m_c_stride;
+        return last < m_data.size();
+    }
+
+    /**
+     * @brief True if the elements are dense and interleaved (one `memcpy` reproduces the image).
+     */
+    [[nodiscard]] bool isContiguous() const noexcept
+    {
+        return m_c_stride == 1
+               && m_x_stride == static_cast<std::size_t>(m_channels)
+               && m_y_stride == static_cast<std::size_t>(m_width) * m_channels;
+    }
+
+    /**
+     * @brief Returns the viewed elements (satisfies `ImageLike`).
+     */
+    [[nodiscard]] std::span<const float> getBuffer() const noexcept
+    {
+        return m_data;
+    }
+
+    /**
+     * @brief Reads element `(x, y, c)`; argument order matches `ImageRegion::operator()`.
+     */
+    [[nodiscard]] float operator()(int y, int x, int c) const noexcept
+    {
+        assert(y >= 0 && static_cast<std::size_t>(y) < m_height);
+        assert(x >= 0 && static_cast<std::size_t>(x) < m_width);
+        assert(c >= 0 && static_cast<std::size_t>(c) < m_channels);
+        return m_data[static_cast<std::size_t>(y) * m_y_stride
+                      + static_cast<std::size_t>(x) * m_x_stride
+                      + static_cast<std::size_t>(c) * m_c_stride];
+    }
+
+    /**
+     * @brief Copies the viewed pixels into a new, dense ImageRegion (pooled storage).
+     * @throws std::bad_alloc if the allocation fails.
+     */
+    [[nodiscard]] ImageRegion toImageRegion() const
+    {
+        PixelBuffer data(static_cast<std::size_t>(m_width) * m_height * m_channels);
+
+        if (isContiguous()) {
+            std::copy_n(m_data.begin(), data.size(), data.begin());
+        } else {
+            std::size_t i = 0;
+            for (ImageDim y = 0; y < m_height; ++y) {
+                for (ImageDim x = 0; x < m_width; ++x) {
+                    for (ImageChan c = 0; c < m_channels; ++c) {
+                        data[i++] = (*this)(static_cast<int>(y), static_cast<int>(x), static_cast<int>(c));
+                    }
+                }
+            }
+        }
+
+        return ImageRegion(std::move(data), m_width, m_height, m_channels);
+    }
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,121 @@
+/**
+ * @file log.h
+ * @brief Logging macros for hot paths: compile-time level and per-subsystem runtime filters.
+ *
+ * @details
+ * `CM_LOG_<LEVEL>(Subsystem, "format", args...)` forwards to spdlog with two gates in front:
+ * - **Compile time**: levels below `CAPTUREMOMENT_LOG_ACTIVE_LEVEL` expand to nothing, the
+ *   arguments are not even evaluated. It defaults to `SPDLOG_LEVEL_INFO` with `NDEBUG` and
+ *   `SPDLOG_LEVEL_TRACE` otherwise; the `LOG_ACTIVE_LEVEL` CMake option overrides it.
+ * - **Run time**: each subsystem has its own threshold (one relaxed atomic load), set with
+ *   `setSubsystemLevel()` or `CAPTUREMOMENT_LOG=pipeline=warn,render=off`, on top of the
+ *   logger level. Nothing is formatted when either rejects the message.
+ *
+ * Use the macros in code that runs per frame, per tile or per edit; plain `spdlog::` calls
+ * stay fine elsewhere.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#ifndef CAPTUREMOMENT_LOG_ACTIVE_LEVEL
+    #ifdef NDEBUG
+        #define CAPTUREMOMENT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+    #else
+        #define CAPTUREMOMENT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+    #endif
+#endif
+
+namespace CaptureMoment::Core {
+
+namespace Common::Logging {
+
+/**
+ * @enum Subsystem
+ * @brief Areas with their own runtime log threshold.
+ */
+enum class Subsystem : std::uint8_t {
+    Engine,     ///< StateImageManager, workers, request scheduling
+    Source,     ///< Decoding, caches, source tiles
+    Pipeline,   ///< Pipeline building, compilation and execution
+    Operations, ///< Operation graphs (fusion)
+    Image,      ///< Working images and device transfers
+    Render,     ///< Display: renderers, texture staging
+    Count
+};
+
+/**
+ * @brief Per-subsystem thresholds (spdlog level values), all `trace` until configured.
+ */
+inline std::array<std::atomic<int>, static_cast<std::size_t>(Subsystem::Count)> g_subsystem_levels {};
+
+/**
+ * @brief Whether a message of @p level from @p subsystem passes the runtime filters.
+ */
+[[nodiscard]] inline bool shouldLog(Subsystem subsystem, spdlog::level::level_enum level) noexcept
+{
+    return static_cast<int>(level) >= g_subsystem_levels[static_cast<std::size_t>(subsystem)].load(std::memory_order_relaxed)
+        && spdlog::default_logger_raw()->should_log(level);
+}
+
+/**
+ * @brief Sets the runtime threshold of one subsystem.
+ */
+void setSubsystemLevel(Subsystem subsystem, spdlog::level::level_enum level) noexcept;
+
+/**
+ * @brief Applies a filter list such as `pipeline=warn,render=off` (names are case-insensitive).
+ * @return false if an entry was not understood (the valid ones are still applied).
+ */
+bool applySubsystemLevels(std::string_view spec);
+
+} // namespace Common::Logging
+
+} // namespace CaptureMoment::Core
+
+#define CM_LOG_AT(level, subsystem, ...)                                                                        \
+    do {                                                                                                        \
+        if (::CaptureMoment::Core::Common::Logging::shouldLog(                                                  \
+                ::CaptureMoment::Core::Common::Logging::Subsystem::subsystem, level)) {                         \
+            spdlog::log(level, __VA_ARGS__);                                                                    \
+        }                                                                                                       \
+    } while (false)
+
+#if CAPTUREMOMENT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+    #define CM_LOG_TRACE(subsystem, ...) CM_LOG_AT(spdlog::level::trace, subsystem, __VA_ARGS__)
+#else
+    #define CM_LOG_TRACE(subsystem, ...) static_cast<void>(0)
+#endif
+
+#if CAPTUREMOMENT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define CM_LOG_DEBUG(subsystem, ...) CM_LOG_AT(spdlog::level::debug, subsystem, __VA_ARGS__)
+#else
+    #define CM_LOG_DEBUG(subsystem, ...) static_cast<void>(0)
+#endif
+
+#if CAPTUREMOMENT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+    #define CM_LOG_INFO(subsystem, ...) CM_LOG_AT(spdlog::level::info, subsystem, __VA_ARGS__)
+#else
+    #define CM_LOG_INFO(subsystem, ...) static_cast<void>(0)
+#endif
+
+#if CAPTUREMOMENT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+    #define CM_LOG_WARN(subsystem, ...) CM_LOG_AT(spdlog::level::warn, subsystem, __VA_ARGS__)
+#else
+    #define CM_LOG_WARN(subsystem, ...) static_cast<void>(0)
+#endif
+
+#define CM_LOG_ERROR(subsystem, ...) CM_LOG_AT(spdlog::level::err, subsystem, __VA_ARGS__)
+#define CM_LOG_CRITICAL(subsystem, ...) CM_LOG_AT(spdlog::level::critical, subsystem, __VA_ARGS__)
@@ -0,0 +1,342 @@
+/**
+ * @file buffer_pool.h
+ * @brief Declaration of BufferPool (size-class, aligned block recycling) and its allocator adapters.
+ *
+ * @details
+ * Every edit produces full-size float buffers (working image copies, exports, display
+ * downsamples). Allocating them fresh means the OS maps new pages each time, and the first
+ * touch of a multi-hundred-MB block page-faults its way through the copy that follows.
+ *
+ * `BufferPool` keeps released blocks on per-size-class free lists so that the next request of
+ * a similar size gets back memory that is already mapped. In steady-state editing the sizes
+ * repeat, so no large allocation reaches the system allocator.
+ *
+ * - Blocks of at least `k_page_threshold` bytes are page-aligned and rounded up to a size class
+ *   (four classes per power of two, at most 25% slack).
+ * - Smaller blocks are cache-line aligned and are not cached.
+ *
+ * On a multi-node host, a block acquired by a thread pinned to a node (`NumaTopology`) is first
+ * touched there, so it is only recycled for threads pinned to the same node: a strip processed
+ * by that node's workers never reads remote memory.
+ *
+ * Optionally (`setHugePages`), blocks of at least `k_huge_page_threshold` bytes are mapped on
+ * huge pages: a multi-hundred-MB image then costs a few hundred TLB entries instead of tens of
+ * thousands, and its first touch and strided (column, tile) walks miss the TLB far less.
+ * - `HugePages::Transparent`: an anonymous mapping aligned to `k_huge_page_size` and advised
+ *   `MADV_HUGEPAGE` (Linux; elsewhere the blocks stay on regular pages).
+ * - `HugePages::Explicit`: pages of the reserved huge page pool (`MAP_HUGETLB` on Linux, large
+ *   pages on Windows, which need the "Lock pages in memory" right); transparent huge pages when
+ *   the pool is empty (Linux), regular pages otherwise.
+ *
+ * The pool is registered with `MemoryBudget`: its usage is the large blocks handed out plus the
+ * free lists, and the free lists are dropped when the budget asks for memory.
+ *
+ * Two adapters expose the pool:
+ * - `PooledAllocator<T>`: a standard allocator whose default construction leaves trivial
+ *   elements uninitialized, so `resize(n)` does not zero-fill (see `PixelBuffer`).
+ * - `PooledArray<T>` / `makeSharedPooledArray<T>`: unique or shared arrays returned to the
+ *   pool when the last owner goes away.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class BufferPool
+ * @brief Process-wide, thread-safe recycler of large aligned memory blocks.
+ */
+class BufferPool {
+public:
+    /**
+     * @brief Alignment of every block (one cache line, and a multiple of any SIMD width in use).
+     */
+    static constexpr std::size_t k_cache_line_alignment = 64;
+
+    /**
+     * @brief Alignment of pooled blocks.
+     */
+    static constexpr std::size_t k_page_alignment = 4096;
+
+    /**
+     * @brief Requests from this size on are page-aligned, size-classed and recycled.
+     */
+    static constexpr std::size_t k_page_threshold = 64 * 1024;
+
+    /**
+     * @brief Default upper bound on the bytes kept in the free lists.
+     */
+    static constexpr std::size_t k_default_max_cached_bytes = std::size_t{2} * 1024 * 1024 * 1024;
+
+    /**
+     * @brief Size of a huge page (the x86-64 and ARM64 default), and alignment of the mapped blocks.
+     */
+    static constexpr std::size_t k_huge_page_size = std::size_t{2} * 1024 * 1024;
+
+    /**
+     * @brief Requests from this size on are mapped on huge pages when enabled (rounding them up
+     *        to whole huge pages then adds at most 12.5%).
+     */
+    static constexpr std::size_t k_huge_page_threshold = std::size_t{16} * 1024 * 1024;
+
+    /**
+     * @brief Pages backing the large blocks.
+     */
+    enum class HugePages : std::uint8_t {
+        Off = 0,         ///< Regular pages, from the system allocator (default).
+        Transparent = 1, ///< Transparent huge pages (Linux `madvise(MADV_HUGEPAGE)`).
+        Explicit = 2     ///< Reserved huge pages (Linux `MAP_HUGETLB`, Windows large pages), else transparent.
+    };
+
+    /**
+     * @brief Returns the process-wide pool.
+     */
+    [[nodiscard]] static BufferPool& instance();
+
+    /**
+     * @brief Returns a block of at least `bytes` bytes, reusing a cached one when possible.
+     * @throws std::bad_alloc if the system allocation fails.
+     */
+    [[nodiscard]] void* acquire(std::size_t bytes);
+
+    /**
+     * @brief Returns a block obtained from `acquire(bytes)` with the same `bytes`.
+     * @details Cached for reuse unless that would exceed the cache limit, in which case it is freed.
+     */
+    void release(void* ptr, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Frees every cached block (e.g. after closing an image).
+     */
+    void trim() noexcept;
+
+    /**
+     * @brief Sets the upper bound on cached bytes, trimming if the cache is already above it.
+     */
+    void setMaxCachedBytes(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Sets the pages the next large blocks are mapped on.
+     * @details Blocks already handed out or cached keep their pages (and are recycled as they are).
+     */
+    void setHugePages(HugePages mode) noexcept;
+
+    /**
+     * @brief Pages the next large blocks are mapped on.
+     */
+    [[nodiscard]] HugePages hugePages() const noexcept;
+
+    /**
+     * @brief Number of blocks mapped on huge pages since startup (0 when they are unavailable).
+     */
+    [[nodiscard]] std::size_t hugePageAllocationCount() const noexcept;
+
+    /**
+     * @brief Bytes currently held in the free lists.
+     */
+    [[nodiscard]] std::size_t cachedBytes() const noexcept;
+
+    /**
+     * @brief Bytes of large blocks currently handed out (acquired and not yet released).
+     */
+    [[nodiscard]] std::size_t liveBytes() const noexcept;
+
+    /**
+     * @brief Number of large blocks requested from the system since startup.
+     * @details Constant across frames in steady state; used to verify that the pool is effective.
+     */
+    [[nodiscard]] std::size_t systemAllocationCount() const noexcept;
+
+    /**
+     * @brief Actual capacity of a block acquired for `bytes` bytes.
+     */
+    [[nodiscard]] static constexpr std::size_t sizeClass(std::size_t bytes) noexcept
+    {
+        if (bytes < k_page_threshold) {
+            return (bytes + k_cache_line_alignment - 1) & ~(k_cache_line_alignment - 1);
+        }
+
+        // Four classes per octave: [2^k, 1.25 * 2^k, 1.5 * 2^k, 1.75 * 2^k]
+        std::size_t octave = k_page_threshold;
+        while (octave <= bytes / 2) {
+            octave *= 2;
+        }
+        const std::size_t step = octave / 4;
+        const std::size_t rounded = (bytes + step - 1) / step * step;
+        return (rounded + k_page_alignment - 1) & ~(k_page_alignment - 1);
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+private:
+    /**
+     * @brief Private: use `instance()`. The instance is never destroyed, so containers with
+     *        static storage duration can still release into it during shutdown.
+     */
+    BufferPool() = default;
+
+    /**
+     * @brief Guards the free lists and counters.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Cached blocks, keyed by size class plus one plus their node (0: acquired unpinned).
+     *        Size classes are page multiples, so the node fits in the low bits.
+     */
+    std::unordered_map<std::size_t, std::vector<void*>> m_free_lists;
+
+    /**
+     * @brief Node of the large blocks handed out to pinned threads (absent: unpinned).
+     */
+    std::unordered_map<void*, std::size_t> m_block_nodes;
+
+    /**
+     * @brief Blocks mapped on huge pages (cached or handed out), with the length of their mapping.
+     */
+    std::unordered_map<void*, std::size_t> m_mapped_blocks;
+
+    /**
+     * @brief Pages of the next large blocks.
+     */
+    HugePages m_huge_pages{HugePages::Off};
+
+    /**
+     * @brief Blocks mapped on huge pages since startup.
+     */
+    std::size_t m_huge_page_allocations{0};
+
+    /**
+     * @brief Sum of the size classes of all cached blocks.
+     */
+    std::size_t m_cached_bytes{0};
+
+    /**
+     * @brief Cache limit.
+     */
+    std::size_t m_max_cached_bytes{k_default_max_cached_bytes};
+
+    /**
+     * @brief Large blocks obtained from the system allocator.
+     */
+    std::size_t m_system_allocations{0};
+
+    /**
+     * @brief Sum of the size classes of the large blocks handed out.
+     */
+    std::size_t m_live_bytes{0};
+};
+
+/**
+ * @class PooledAllocator
+ * @brief Standard allocator backed by `BufferPool`, default-initializing on construction.
+ *
+ * @details
+ * `construct(p)` with no arguments performs default-initialization instead of
+ * value-initialization, so growing a container of trivial elements does not write zeros.
+ */
+template<typename T>
+class PooledAllocator {
+public:
+    using value_type = T;
+
+    PooledAllocator() noexcept = default;
+
+    template<typename U>
+    PooledAllocator(const PooledAllocator<U>&) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(BufferPool::instance().acquire(count * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+        BufferPool::instance().release(ptr, count * sizeof(T));
+    }
+
+    template<typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    template<typename U>
+    friend bool operator==(const PooledAllocator&, const PooledAllocator<U>&) noexcept { return true; }
+};
+
+/**
+ * @brief Float pixel storage of `ImageRegion`: pooled, aligned, not zero-filled on resize.
+ */
+using PixelBuffer = std::vector<float, PooledAllocator<float>>;
+
+/**
+ * @struct PoolDeleter
+ * @brief Deleter returning an array to `BufferPool`.
+ */
+struct PoolDeleter {
+    /**
+     * @brief Size the block was acquired with.
+     */
+    std::size_t m_bytes{0};
+
+    void operator()(void* ptr) const noexcept
+    {
+        BufferPool::instance().release(ptr, m_bytes);
+    }
+};
+
+/**
+ * @brief Owning pointer to a pooled array.
+ */
+template<typename T>
+using PooledArray = std::unique_ptr<T[], PoolDeleter>;
+
+/**
+ * @brief Allocates `count` uninitialized elements from the pool (counterpart of `make_unique_for_overwrite`).
+ * @throws std::bad_alloc if the system allocation fails.
+ */
+template<typename T>
+    requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+[[nodiscard]] PooledArray<T> makePooledArray(std::size_t count)
+{
+    const std::size_t bytes = count * sizeof(T);
+    return PooledArray<T>(static_cast<T*>(BufferPool::instance().acquire(bytes)), PoolDeleter{bytes});
+}
+
+/**
+ * @brief Shared counterpart of `makePooledArray`, for storage that views may keep alive.
+ * @throws std::bad_alloc if an allocation fails.
+ */
+template<typename T>
+    requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+[[nodiscard]] std::shared_ptr<T[]> makeSharedPooledArray(std::size_t count)
+{
+    return std::shared_ptr<T[]>(makePooledArray<T>(count));
+}
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
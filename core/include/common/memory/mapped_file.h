@@ -0,0 +1,90 @@
+/**
+ * @file mapped_file.h
+ * @brief Declaration of MappedFile (read-only memory mapping of a whole file).
+ *
+ * @details
+ * A mapped file costs no heap and no read at open: pages are faulted in from the OS page cache
+ * as they are touched, and stay shared with every other process (or later session) mapping the
+ * same file. Regions never read are never loaded.
+ *
+ * The mapping is read-only: writing through `data()` is undefined behaviour (a fault).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class MappedFile
+ * @brief Move-only owner of a read-only mapping of a file.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps a whole file read-only.
+     * @param path The file to map (must not be empty).
+     * @return The mapping, `FileNotFound` if the file cannot be opened, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<MappedFile, ErrorHandling::CoreError> open(const std::filesystem::path& path);
+
+    /**
+     * @brief Creates an empty mapping.
+     */
+    MappedFile() noexcept = default;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief The mapped bytes (empty if nothing is mapped).
+     */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept
+    {
+        return {static_cast<const std::byte*>(m_data), m_size};
+    }
+
+    /**
+     * @brief true if a file is mapped.
+     */
+    [[nodiscard]] bool isMapped() const noexcept { return m_data != nullptr; }
+
+private:
+    /**
+     * @brief Unmaps the file, if any.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Start of the mapping.
+     */
+    void* m_data{nullptr};
+
+    /**
+     * @brief Size of the mapping, in bytes.
+     */
+    std::size_t m_size{0};
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
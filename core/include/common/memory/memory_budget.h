@@ -0,0 +1,239 @@
+/**
+ * @file memory_budget.h
+ * @brief Declaration of MemoryBudget (process-wide memory ceiling shared by caches and pools).
+ *
+ * @details
+ * Several copies of an image coexist: the decoded image cache, the OIIO tile cache, the
+ * pooled working copies and tiles, the display buffers of the renderer. Each is bounded on
+ * its own, so their sum is not, and several instances on one host can exhaust its memory.
+ *
+ * Every cache or buffer pool registers with `MemoryBudget` as a consumer:
+ * - a usage callback reporting the bytes it holds,
+ * - for evictable consumers, a release callback freeing at least a number of bytes (in its own
+ *   LRU order) and returning how many it freed.
+ *
+ * When a consumer grows (`Registration::notifyGrowth`) or the ceiling changes, the total is
+ * compared to the ceiling; past it, evictable consumers are asked to release the excess, least
+ * recently used consumer first. Usage-only consumers (live working images, renderer staging)
+ * are counted, so that they push the caches down instead of the total going over.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class MemoryBudget
+ * @brief Process-wide, thread-safe registry of memory consumers enforcing a byte ceiling.
+ */
+class MemoryBudget {
+public:
+    /**
+     * @brief Returns the bytes currently held by a consumer.
+     */
+    using UsageFunction = std::function<std::size_t()>;
+
+    /**
+     * @brief Frees at least the given number of bytes if possible; returns the bytes freed.
+     */
+    using ReleaseFunction = std::function<std::size_t(std::size_t)>;
+
+    /**
+     * @struct ConsumerUsage
+     * @brief One line of `report()`.
+     */
+    struct ConsumerUsage {
+        /** @brief Consumer name, as registered. */
+        std::string m_name;
+        /** @brief Bytes held. */
+        std::size_t m_bytes{0};
+        /** @brief true if the consumer can release memory on request. */
+        bool m_evictable{false};
+    };
+
+private:
+    /**
+     * @brief Registered consumer, shared between the registry and its Registration.
+     */
+    struct Consumer {
+        /** @brief Name used in reports and logs. */
+        std::string m_name;
+        /** @brief Usage callback. */
+        UsageFunction m_usage;
+        /** @brief Release callback, empty for usage-only consumers. */
+        ReleaseFunction m_release;
+        /** @brief Held while a callback runs; unregistering waits on it. */
+        std::mutex m_call_mutex;
+        /** @brief Cleared on unregistration, under `m_call_mutex`. */
+        bool m_alive{true};
+        /** @brief Budget clock value of the last use (LRU order between consumers). */
+        std::atomic<std::uint64_t> m_last_use{0};
+    };
+
+public:
+    /**
+     * @class Registration
+     * @brief Move-only handle of a consumer; unregisters it on destruction.
+     *
+     * @details
+     * Destruction waits for a callback of the consumer running on another thread, so the
+     * owner must not hold a lock taken by its own callbacks while destroying the handle.
+     */
+    class Registration {
+    public:
+        Registration() = default;
+        ~Registration();
+
+        Registration(Registration&& other) noexcept;
+        Registration& operator=(Registration&& other) noexcept;
+
+        Registration(const Registration&) = delete;
+        Registration& operator=(const Registration&) = delete;
+
+        /**
+         * @brief Marks the consumer as used now (evicted last).
+         */
+        void touch() const noexcept;
+
+        /**
+         * @brief Marks the consumer as used and enforces the ceiling after it grew.
+         * @details Must be called without holding a lock taken by the consumer's callbacks.
+         */
+        void notifyGrowth() const;
+
+        /**
+         * @brief true if the handle refers to a registered consumer.
+         */
+        [[nodiscard]] explicit operator bool() const noexcept { return static_cast<bool>(m_consumer); }
+
+    private:
+        friend class MemoryBudget;
+
+        explicit Registration(std::shared_ptr<Consumer> consumer) noexcept;
+
+        /**
+         * @brief Unregisters the consumer, if any.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief The registered consumer.
+         */
+        std::shared_ptr<Consumer> m_consumer;
+    };
+
+    /**
+     * @brief Returns the process-wide budget.
+     */
+    [[nodiscard]] static MemoryBudget& instance();
+
+    /**
+     * @brief Registers a consumer.
+     *
+     * @param name Name used in reports and logs.
+     * @param usage Returns the bytes held; called from any thread.
+     * @param release Frees memory on request; empty for usage-only consumers.
+     * @return The handle keeping the consumer registered.
+     */
+    [[nodiscard]] Registration registerConsumer(std::string name, UsageFunction usage, ReleaseFunction release = {});
+
+    /**
+     * @brief Sets the ceiling and enforces it.
+     * @param bytes Maximum bytes held by all consumers, or 0 for no ceiling.
+     */
+    void setCeilingBytes(std::size_t bytes);
+
+    /**
+     * @brief The ceiling in bytes, 0 if unlimited.
+     */
+    [[nodiscard]] std::size_t ceilingBytes() const noexcept;
+
+    /**
+     * @brief Bytes currently held by all consumers.
+     */
+    [[nodiscard]] std::size_t usageBytes() const;
+
+    /**
+     * @brief Bytes held per consumer, in registration order.
+     */
+    [[nodiscard]] std::vector<ConsumerUsage> report() const;
+
+    /**
+     * @brief Releases memory from evictable consumers until the total is under the ceiling.
+     *
+     * @details
+     * Least recently used consumers are asked first. Does nothing without a ceiling, or when
+     * another enforcement is already running (including one further up the same call stack).
+     *
+     * @return The bytes freed.
+     */
+    std::size_t enforce();
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+private:
+    /**
+     * @brief Private: use `instance()`. Never destroyed, so that consumers with static storage
+     *        duration can still unregister during shutdown.
+     */
+    MemoryBudget() = default;
+
+    /**
+     * @brief Removes a consumer, waiting for its running callback.
+     */
+    void unregisterConsumer(const std::shared_ptr<Consumer>& consumer) noexcept;
+
+    /**
+     * @brief Copies the registered consumers, so that callbacks run without `m_mutex`.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<Consumer>> snapshot() const;
+
+    /**
+     * @brief Calls the usage callback of a consumer, 0 if it was unregistered meanwhile.
+     */
+    [[nodiscard]] static std::size_t usageOf(Consumer& consumer);
+
+    /**
+     * @brief Guards `m_consumers`.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Registered consumers.
+     */
+    std::vector<std::shared_ptr<Consumer>> m_consumers;
+
+    /**
+     * @brief Ceiling in bytes, 0 if unlimited.
+     */
+    std::atomic<std::size_t> m_ceiling_bytes{0};
+
+    /**
+     * @brief Clock stamping consumer uses.
+     */
+    std::atomic<std::uint64_t> m_clock{0};
+
+    /**
+     * @brief Set while an enforcement runs (a release callback may grow another consumer).
+     */
+    std::atomic<bool> m_enforcing{false};
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
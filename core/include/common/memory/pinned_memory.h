@@ -0,0 +1,53 @@
+/**
+ * @file pinned_memory.h
+ * @brief Page-locked host blocks for the staging of device transfers.
+ *
+ * @details
+ * A device transfer from pageable memory may fault pages in mid-copy, and the driver has to
+ * bounce it through its own locked buffer. Staging buffers (uploaded sources, downloaded
+ * display images) are instead taken from `BufferPool` and locked in physical memory
+ * (`mlock` / `VirtualLock`): they stay resident between transfers and never fault.
+ *
+ * Locking is best effort. Past `k_max_locked_bytes`, or when the system refuses (locked
+ * memory limit), blocks are returned unlocked and behave like any pooled block.
+ *
+ * Blocks carry their size in a header placed before the returned pointer, so they can be
+ * released from a one-argument deallocator (`Halide::Buffer::allocate`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @brief Upper bound on the bytes locked at once, process-wide.
+ */
+inline constexpr std::size_t k_max_locked_bytes = std::size_t{1} * 1024 * 1024 * 1024;
+
+/**
+ * @brief Returns a block of at least `bytes` bytes, page-locked if possible.
+ * @details The block is page-aligned; its pages past the header are locked.
+ * @throws std::bad_alloc if the allocation fails.
+ */
+[[nodiscard]] void* acquirePinned(std::size_t bytes);
+
+/**
+ * @brief Unlocks and returns a block obtained from `acquirePinned`. Null is ignored.
+ */
+void releasePinned(void* ptr) noexcept;
+
+/**
+ * @brief Bytes currently page-locked by `acquirePinned`.
+ */
+[[nodiscard]] std::size_t pinnedBytes() noexcept;
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,92 @@
+/**
+ * @file read_ahead_file.h
+ * @brief Declaration of ReadAheadFile (a whole file read into memory with parallel reads).
+ *
+ * @details
+ * Decoders read a file through many small, dependent reads: on SMB or NFS each one waits for a
+ * network round trip, and a 100 MB RAW file takes seconds to decode that a local disk serves in
+ * a fraction of one. Reading the file whole first, with several large reads in flight at once,
+ * pays the latency once; the decoder then reads from memory (`OIIO::Filesystem::IOMemReader`).
+ *
+ * The reads go through io_uring on Linux (`CAPTUREMOMENT_USE_LIBURING`), overlapped I/O on
+ * Windows, and concurrent positional reads from a few threads elsewhere (or when the kernel
+ * refuses io_uring).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class ReadAheadFile
+ * @brief Move-only owner of the contents of a file, read whole.
+ */
+class ReadAheadFile {
+public:
+    /**
+     * @brief Size of each read, in bytes.
+     */
+    static constexpr std::size_t k_chunk_bytes { std::size_t { 4 } << 20 };
+
+    /**
+     * @brief Reads in flight at once.
+     */
+    static constexpr unsigned k_queue_depth { 8 };
+
+    /**
+     * @brief Reads a whole file.
+     * @param path The file to read.
+     * @return The contents, `FileNotFound` if the file cannot be opened, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<ReadAheadFile, ErrorHandling::CoreError> read(const std::filesystem::path& path);
+
+    /**
+     * @brief true if a file sits on network storage (NFS, SMB, AFS, Ceph; a network drive or
+     *        UNC path on Windows), where reading it ahead pays.
+     */
+    [[nodiscard]] static bool isRemote(const std::filesystem::path& path) noexcept;
+
+    /**
+     * @brief Creates an empty file contents.
+     */
+    ReadAheadFile() noexcept = default;
+
+    ReadAheadFile(ReadAheadFile&&) noexcept = default;
+    ReadAheadFile& operator=(ReadAheadFile&&) noexcept = default;
+
+    ReadAheadFile(const ReadAheadFile&) = delete;
+    ReadAheadFile& operator=(const ReadAheadFile&) = delete;
+
+    /**
+     * @brief The contents of the file.
+     */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {m_data.get(), m_size}; }
+
+private:
+    /**
+     * @brief The contents (not zero-initialized before the reads).
+     */
+    std::unique_ptr<std::byte[]> m_data;
+
+    /**
+     * @brief Size of the contents, in bytes.
+     */
+    std::size_t m_size { 0 };
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
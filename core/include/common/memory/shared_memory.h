@@ -0,0 +1,125 @@
+/**
+ * @file shared_memory.h
+ * @brief Declaration of SharedMemory (an anonymous memory region shareable with another process).
+ *
+ * @details
+ * The region is a file descriptor with no name in the file system: a `memfd` on Linux, an
+ * unlinked POSIX shared-memory object elsewhere. Its descriptor is handed to another process
+ * over a Unix socket (`Export::RenderChannel`), which maps the same pages: an image crosses the
+ * process boundary without being serialized or copied.
+ *
+ * On Linux the region is sealed against resizing: a peer cannot truncate it under a mapping
+ * (which would fault the process reading it). `adopt` only accepts regions sealed that way
+ * there.
+ *
+ * POSIX only: on Windows, `create` and `adopt` fail with `Unexpected`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <cstddef>
+#include <expected>
+#include <span>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class SharedMemory
+ * @brief Move-only owner of a mapped shared-memory region and of its descriptor.
+ */
+class SharedMemory {
+public:
+    /**
+     * @brief Creates a zero-filled region, mapped read-write.
+     * @param size Size of the region, in bytes (at least 1).
+     * @return The region, or `AllocationFailed`.
+     */
+    [[nodiscard]] static std::expected<SharedMemory, ErrorHandling::CoreError> create(std::size_t size);
+
+    /**
+     * @brief Maps a region received from another process; takes ownership of the descriptor.
+     * @param descriptor The descriptor (closed on failure as well).
+     * @param writable true to map it read-write, false read-only.
+     * @return The region, `InvalidImageRegion` for an empty or resizable region, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<SharedMemory, ErrorHandling::CoreError> adopt(int descriptor, bool writable);
+
+    /**
+     * @brief Creates an empty region.
+     */
+    SharedMemory() noexcept = default;
+
+    /**
+     * @brief Unmaps the region and closes its descriptor.
+     */
+    ~SharedMemory();
+
+    SharedMemory(SharedMemory&& other) noexcept;
+    SharedMemory& operator=(SharedMemory&& other) noexcept;
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    /**
+     * @brief The mapped bytes (empty if nothing is mapped).
+     */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept
+    {
+        return {static_cast<const std::byte*>(m_data), m_size};
+    }
+
+    /**
+     * @brief The mapped bytes, for writing (empty if mapped read-only).
+     */
+    [[nodiscard]] std::span<std::byte> writableBytes() noexcept
+    {
+        return m_writable ? std::span<std::byte>(static_cast<std::byte*>(m_data), m_size) : std::span<std::byte>();
+    }
+
+    /**
+     * @brief The descriptor of the region, to send to another process (-1 if none).
+     */
+    [[nodiscard]] int descriptor() const noexcept { return m_descriptor; }
+
+    /**
+     * @brief true if a region is mapped.
+     */
+    [[nodiscard]] bool isMapped() const noexcept { return m_data != nullptr; }
+
+private:
+    /**
+     * @brief Unmaps the region and closes the descriptor, if any.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Start of the mapping.
+     */
+    void* m_data{nullptr};
+
+    /**
+     * @brief Size of the mapping, in bytes.
+     */
+    std::size_t m_size{0};
+
+    /**
+     * @brief Descriptor of the region.
+     */
+    int m_descriptor{-1};
+
+    /**
+     * @brief true if mapped read-write.
+     */
+    bool m_writable{false};
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
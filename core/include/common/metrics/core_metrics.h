@@ -0,0 +1,92 @@
+/**
+ * @file core_metrics.h
+ * @brief The instruments the library updates (requests, decoding, pipeline, device transfers).
+ *
+ * @details
+ * Registered in `MetricsRegistry::instance()` on first use of `coreMetrics()`, so that every
+ * name appears in the exports from the start, at zero. Durations are in milliseconds.
+ *
+ * | Metric | Updated by |
+ * |---|---|
+ * | `capturemoment_requests_submitted_total` | StateImageManager, per processing request |
+ * | `capturemoment_requests_completed_total` | ... per pass run to completion |
+ * | `capturemoment_requests_coalesced_total` | ... per request superseded before it ran |
+ * | `capturemoment_requests_dropped_total` | ... per pass aborted by a newer request |
+ * | `capturemoment_requests_cancelled_total` | ... per request cancelled explicitly |
+ * | `capturemoment_requests_failed_total` | ... per failed pass |
+ * | `capturemoment_request_latency_ms` | ... submission to completion |
+ * | `capturemoment_idle_waits_total` | ... per caller blocked until the engine is idle |
+ * | `capturemoment_idle_wait_ms` | ... time those callers were blocked |
+ * | `capturemoment_result_cache_hits_total` | ... per request served by the result cache |
+ * | `capturemoment_result_disk_cache_hits_total` | ResultCache, per hit read from its disk tier |
+ * | `capturemoment_source_decodes_total` | SourceManager, per file decoded |
+ * | `capturemoment_source_decoded_bytes_total` | ... bytes produced by the decodes |
+ * | `capturemoment_source_decode_ms` | ... decode duration |
+ * | `capturemoment_source_cache_hits_total` | ... decodes served by the in-memory cache |
+ * | `capturemoment_source_disk_cache_hits_total` | ... decodes mapped from the disk cache |
+ * | `capturemoment_pipeline_compiles_total` | OperationPipelineExecutor, per compilation (JIT or cached object) |
+ * | `capturemoment_pipeline_cache_hits_total` | ... per compiled pipeline reused |
+ * | `capturemoment_pipeline_disk_cache_hits_total` | ... per compiled pipeline loaded from the disk cache |
+ * | `capturemoment_pipeline_compile_ms` | ... JIT compilation duration |
+ * | `capturemoment_pipeline_realize_ms` | ... realization duration |
+ * | `capturemoment_gpu_uploaded_bytes_total` | WorkingImageGPU_Halide, host to device |
+ * | `capturemoment_gpu_downloaded_bytes_total` | ... device to host |
+ * | `capturemoment_gpu_pool_reuses_total` | HalideDevicePool, per buffer served from the pool |
+ * | `capturemoment_gpu_pool_allocations_total` | ... per buffer allocated anew |
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/metrics/metrics_registry.h"
+
+namespace CaptureMoment::Core {
+
+namespace Common::Metrics {
+
+/**
+ * @struct CoreMetrics
+ * @brief References to the library's instruments (see the table above).
+ */
+struct CoreMetrics {
+    Counter& m_requests_submitted;
+    Counter& m_requests_completed;
+    Counter& m_requests_coalesced;
+    Counter& m_requests_dropped;
+    Counter& m_requests_cancelled;
+    Counter& m_requests_failed;
+    Histogram& m_request_latency_ms;
+    Counter& m_idle_waits;
+    Histogram& m_idle_wait_ms;
+    Counter& m_result_cache_hits;
+    Counter& m_result_disk_cache_hits;
+
+    Counter& m_source_decodes;
+    Counter& m_source_decoded_bytes;
+    Histogram& m_source_decode_ms;
+    Counter& m_source_cache_hits;
+    Counter& m_source_disk_cache_hits;
+    Counter& m_source_compressed_cache_hits;
+
+    Counter& m_pipeline_compiles;
+    Counter& m_pipeline_cache_hits;
+    Counter& m_pipeline_disk_cache_hits;
+    Histogram& m_pipeline_compile_ms;
+    Histogram& m_pipeline_realize_ms;
+
+    Counter& m_gpu_uploaded_bytes;
+    Counter& m_gpu_downloaded_bytes;
+    Counter& m_gpu_pool_reuses;
+    Counter& m_gpu_pool_allocations;
+};
+
+/**
+ * @brief Returns the library's instruments, registering them on first call.
+ */
+[[nodiscard]] const CoreMetrics& coreMetrics();
+
+} // namespace Common::Metrics
+
+} // namespace CaptureMoment::Core
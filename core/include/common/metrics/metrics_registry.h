@@ -0,0 +1,202 @@
+/**
+ * @file metrics_registry.h
+ * @brief Declaration of MetricsRegistry (process-wide atomic counters and histograms).
+ *
+ * @details
+ * Instruments are registered once by name and live until exit: hot paths keep a reference
+ * and update it with relaxed atomics, without locks or allocation. The registry exports a
+ * `MetricsSnapshot` (for the embedding application) or Prometheus text exposition format
+ * (for a scrape endpoint or a textfile collector).
+ *
+ * The instruments updated by the library itself are listed in `core_metrics.h`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common::Metrics {
+
+/**
+ * @class Counter
+ * @brief Monotonic counter (events, bytes).
+ */
+class Counter {
+public:
+    /**
+     * @brief Adds to the counter (any thread).
+     */
+    void add(std::uint64_t amount = 1) noexcept { m_value.fetch_add(amount, std::memory_order_relaxed); }
+
+    /**
+     * @brief Current value.
+     */
+    [[nodiscard]] std::uint64_t value() const noexcept { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    friend class MetricsRegistry;
+
+    std::atomic<std::uint64_t> m_value { 0 };
+};
+
+/**
+ * @class Histogram
+ * @brief Distribution of observed values over fixed buckets (durations, sizes).
+ */
+class Histogram {
+public:
+    /**
+     * @param upper_bounds Inclusive upper bounds of the buckets, ascending. Values above the
+     *                     last bound fall in the implicit `+Inf` bucket.
+     */
+    explicit Histogram(std::span<const double> upper_bounds);
+
+    /**
+     * @brief Records one value (any thread).
+     */
+    void observe(double value) noexcept;
+
+    /**
+     * @brief Upper bounds of the finite buckets.
+     */
+    [[nodiscard]] const std::vector<double>& upperBounds() const noexcept { return m_upper_bounds; }
+
+private:
+    friend class MetricsRegistry;
+
+    std::vector<double> m_upper_bounds;
+    /** @brief Per-bucket counts (not cumulative); the last one is `+Inf`. */
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_bucket_counts;
+    std::atomic<double> m_sum { 0.0 };
+};
+
+/**
+ * @brief Value of a counter at snapshot time.
+ */
+struct CounterSnapshot {
+    std::string m_name;
+    std::string m_help;
+    std::uint64_t m_value { 0 };
+};
+
+/**
+ * @brief State of a histogram at snapshot time.
+ */
+struct HistogramSnapshot {
+    std::string m_name;
+    std::string m_help;
+    /** @brief Upper bounds of the finite buckets. */
+    std::vector<double> m_upper_bounds;
+    /** @brief Cumulative counts: values <= each bound, then the total (`+Inf`). */
+    std::vector<std::uint64_t> m_cumulative_counts;
+    std::uint64_t m_count { 0 };
+    double m_sum { 0.0 };
+
+    /**
+     * @brief Mean of the observed values (0 if none).
+     */
+    [[nodiscard]] double mean() const noexcept { return m_count > 0 ? m_sum / static_cast<double>(m_count) : 0.0; }
+};
+
+/**
+ * @brief All instruments, sorted by name.
+ */
+struct MetricsSnapshot {
+    std::vector<CounterSnapshot> m_counters;
+    std::vector<HistogramSnapshot> m_histograms;
+
+    /**
+     * @brief Finds a counter by name.
+     */
+    [[nodiscard]] std::optional<std::uint64_t> counter(std::string_view name) const;
+
+    /**
+     * @brief Finds a histogram by name.
+     */
+    [[nodiscard]] const HistogramSnapshot* histogram(std::string_view name) const;
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Process-wide registry of the counters and histograms.
+ */
+class MetricsRegistry {
+public:
+    /**
+     * @brief Returns the process-wide registry.
+     */
+    [[nodiscard]] static MetricsRegistry& instance();
+
+    /**
+     * @brief Returns the counter of that name, registering it on first use.
+     *
+     * @param name Prometheus metric name (`[a-zA-Z_:][a-zA-Z0-9_:]*`, `_total` suffix by convention).
+     * @param help One-line description.
+     * @return A reference valid until exit.
+     */
+    [[nodiscard]] Counter& counter(std::string_view name, std::string_view help);
+
+    /**
+     * @brief Returns the histogram of that name, registering it on first use.
+     *
+     * @param name Prometheus metric name.
+     * @param help One-line description.
+     * @param upper_bounds Bucket bounds, used on registration only.
+     * @return A reference valid until exit.
+     */
+    [[nodiscard]] Histogram& histogram(std::string_view name, std::string_view help, std::span<const double> upper_bounds);
+
+    /**
+     * @brief Copies the current values of all instruments.
+     * @details Each instrument is read atomically field by field, not as a whole.
+     */
+    [[nodiscard]] MetricsSnapshot snapshot() const;
+
+    /**
+     * @brief Renders all instruments in the Prometheus text exposition format (version 0.0.4).
+     */
+    [[nodiscard]] std::string toPrometheusText() const;
+
+    /**
+     * @brief Resets all instruments to zero (tests, per-job accounting).
+     */
+    void reset() noexcept;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+private:
+    MetricsRegistry() = default;
+
+    template <typename Instrument>
+    struct Entry {
+        std::string m_help;
+        std::unique_ptr<Instrument> m_instrument;
+    };
+
+    /**
+     * @brief Guards the maps (not the instruments, which are atomic).
+     */
+    mutable std::mutex m_mutex;
+
+    std::map<std::string, Entry<Counter>, std::less<>> m_counters;
+    std::map<std::string, Entry<Histogram>, std::less<>> m_histograms;
+};
+
+} // namespace Common::Metrics
+
+} // namespace CaptureMoment::Core
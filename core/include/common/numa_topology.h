@@ -0,0 +1,114 @@
+/**
+ * @file numa_topology.h
+ * @brief Declaration of NumaTopology (memory nodes of the host and thread pinning).
+ *
+ * @details
+ * On a multi-socket host each socket has its own memory: a page lives on the node of the
+ * thread that first wrote it, and reading it from another socket costs the interconnect.
+ * Buffers allocated on one thread and processed by workers running anywhere therefore pay
+ * remote accesses on every strip.
+ *
+ * `NumaTopology` reads the nodes and their CPUs (Linux sysfs; a single node elsewhere) and pins
+ * threads to a node. A pinned thread reports its node (`pinnedNode`), which the rest of the
+ * engine uses for placement:
+ * - `BufferPool` recycles a block only on the node that first touched it.
+ * - `Workers::ComputePool` runs the loops of a pinned caller on helpers of its node.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class NumaTopology
+ * @brief Process-wide, read-only description of the memory nodes and their CPUs.
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief Returns the topology of the host (read once).
+     */
+    [[nodiscard]] static const NumaTopology& instance();
+
+    /**
+     * @brief Number of memory nodes (1 on single-socket hosts and unsupported systems).
+     */
+    [[nodiscard]] std::size_t nodeCount() const noexcept { return m_node_cpus.size(); }
+
+    /**
+     * @brief CPUs of a node, or all the CPUs of the process for a single-node host.
+     */
+    [[nodiscard]] const std::vector<int>& cpusOf(std::size_t node) const { return m_node_cpus.at(node); }
+
+    /**
+     * @brief Pins the calling thread to the CPUs of a node.
+     * @return false if the node does not exist or the system refused (the thread is unchanged).
+     */
+    bool pinCurrentThread(std::size_t node) const;
+
+    /**
+     * @brief Lets the calling thread run on every CPU of the process again.
+     */
+    void unpinCurrentThread() const;
+
+    /**
+     * @brief Node the calling thread is pinned to, if any.
+     */
+    [[nodiscard]] static std::optional<std::size_t> pinnedNode() noexcept;
+
+    /**
+     * @class ScopedPin
+     * @brief Pins the calling thread to a node for its lifetime (no-op on a single node).
+     */
+    class ScopedPin {
+    public:
+        explicit ScopedPin(std::optional<std::size_t> node);
+        ~ScopedPin();
+
+        ScopedPin(const ScopedPin&) = delete;
+        ScopedPin& operator=(const ScopedPin&) = delete;
+
+    private:
+        /**
+         * @brief Pinning restored on destruction (nested scopes).
+         */
+        std::optional<std::size_t> m_previous;
+
+        /**
+         * @brief true if this scope changed the pinning.
+         */
+        bool m_pinned{false};
+    };
+
+    NumaTopology(const NumaTopology&) = delete;
+    NumaTopology& operator=(const NumaTopology&) = delete;
+
+private:
+    /**
+     * @brief Private: use `instance()`. Reads the topology.
+     */
+    NumaTopology();
+
+    /**
+     * @brief CPUs of each node, in node order.
+     */
+    std::vector<std::vector<int>> m_node_cpus;
+
+    /**
+     * @brief CPUs the process may run on, restored by `unpinCurrentThread`.
+     */
+    std::vector<int> m_process_cpus;
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 namespace CaptureMoment::Core {
 
@@ -62,6 +63,42 @@ enum class PixelFormat : std::uint8_t {
      * - **Usage:** Common for image files that do not contain an alpha channel.
      */
     RGB_F32,
+
+    /**
+     * @brief 4-channel format: Red, Green, Blue, Alpha in 16-bit (IEEE half) float.
+     *
+     * Each pixel is stored as 4 consecutive `Halide::float16_t` values.
+     * - **Size per pixel:** 8 bytes (4 channels * 2 bytes per half)
+     * - **Precision:** 11-bit mantissa, range up to 65504. Enough for edited
+     *                  photographs, half the memory and bandwidth of @ref RGBA_F32.
+     * - **Usage:** Optional storage of working images (see `AppConfig::setWorkingPixelFormat`).
+     *             Pipelines load halves, compute in float and store halves.
+     */
+    RGBA_F16,
+};
+
+/**
+ * @enum PixelLayout
+ * @brief Order of the elements of a pixel buffer.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ *
+ * @see Common::ImageRegionT
+ */
+enum class PixelLayout : std::uint8_t {
+    /**
+     * @brief Channels of a pixel next to each other: `data[(y * width + x) * channels + c]`.
+     *
+     * The layout of `ImageRegion`, of the working images and of the display buffers.
+     */
+    Interleaved,
+
+    /**
+     * @brief One full plane per channel: `data[(c * height + y) * width + x]`.
+     *
+     * Suits per-channel kernels and formats storing channels separately (EXR, YUV).
+     */
+    Planar,
 };
 
 /**
@@ -77,20 +114,32 @@ enum class PixelFormat : std::uint8_t {
         return 4;
     case PixelFormat::RGB_F32:
         return 3;
+    case PixelFormat::RGBA_F16:
+        return 4;
     default:
         std::unreachable();
     }
 }
 
+/**
+ * @brief Returns the size in bytes of a single channel value for a given PixelFormat.
+ * @param fmt The pixel format.
+ * @return 2 for half-float formats, 4 for float formats.
+ */
+[[nodiscard]] constexpr std::size_t getChannelSizeInBytes(PixelFormat fmt) noexcept
+{
+    return fmt == PixelFormat::RGBA_F16 ? 2 : sizeof(float);
+}
+
 /**
  * @brief Returns the size in bytes of a single pixel for a given PixelFormat.
  * @param fmt The pixel format.
- * @return The size in bytes (e.g., 12 for RGB_F32, 16 for RGBA_F32).
+ * @return The size in bytes (e.g., 12 for RGB_F32, 16 for RGBA_F32, 8 for RGBA_F16).
  *         Returns 0 if the format is invalid.
  */
 [[nodiscard]] constexpr std::size_t getPixelSizeInBytes(PixelFormat fmt) noexcept
 {
-    return static_cast<std::size_t>(getChannelCount(fmt)) * sizeof(float);
+    return static_cast<std::size_t>(getChannelCount(fmt)) * getChannelSizeInBytes(fmt);
 }
 
 } // namespace Common
@@ -0,0 +1,113 @@
+/**
+ * @file preview_histogram.h
+ * @brief Defines the PreviewHistogram structure: tone distribution of a display image.
+ *
+ * @details
+ * Counted over the display image (sRGB-encoded 8-bit codes), so the bins are what the
+ * viewport shows. Computed inside the pipeline as an extra output of the realization that
+ * encodes the display image (see `Pipeline::HistogramStage`); it travels with that image
+ * (`DisplayImage::m_histogram`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @struct PreviewHistogram
+ * @brief 256-bin histograms of the red, green, blue and luma codes, with their extremes and clipping.
+ */
+struct PreviewHistogram {
+    /**
+     * @brief Number of bins per channel (one per 8-bit code).
+     */
+    static constexpr std::size_t k_bins = 256;
+
+    /**
+     * @brief Number of histogrammed channels.
+     */
+    static constexpr std::size_t k_channels = 4;
+
+    /**
+     * @brief Histogrammed channels, in the order of `m_counts`.
+     */
+    enum class Channel : std::uint8_t {
+        Red,
+        Green,
+        Blue,
+        Luma    ///< Rec.709 weights applied to the encoded codes
+    };
+
+    /**
+     * @brief Pixel counts, channel-major: `m_counts[channel * k_bins + code]`.
+     */
+    std::array<std::uint32_t, k_bins * k_channels> m_counts{};
+
+    /**
+     * @brief Lowest and highest code present, per channel.
+     */
+    std::array<std::uint8_t, k_channels> m_min{};
+    std::array<std::uint8_t, k_channels> m_max{};
+
+    /**
+     * @brief Pixels at code 0 (crushed shadows) and at code 255 (blown highlights), per channel.
+     */
+    std::array<std::uint32_t, k_channels> m_shadow_clipped{};
+    std::array<std::uint32_t, k_channels> m_highlight_clipped{};
+
+    /**
+     * @brief Number of pixels counted (each channel sums to it).
+     */
+    std::uint64_t m_pixel_count{0};
+
+    /**
+     * @brief Count of one code of one channel.
+     */
+    [[nodiscard]] constexpr std::uint32_t count(Channel channel, std::uint8_t code) const noexcept
+    {
+        return m_counts[static_cast<std::size_t>(channel) * k_bins + code];
+    }
+
+    /**
+     * @brief Derives the extremes, the clipping and the pixel count from `m_counts`.
+     * @details A few hundred additions: cheaper than tracking them per pixel.
+     */
+    constexpr void updateStatistics() noexcept
+    {
+        m_pixel_count = 0;
+        for (std::size_t bin = 0; bin < k_bins; ++bin) {
+            m_pixel_count += m_counts[bin];
+        }
+
+        for (std::size_t channel = 0; channel < k_channels; ++channel) {
+            const std::uint32_t* counts { m_counts.data() + channel * k_bins };
+
+            std::size_t low { 0 };
+            while (low + 1 < k_bins && counts[low] == 0) {
+                ++low;
+            }
+            std::size_t high { k_bins - 1 };
+            while (high > low && counts[high] == 0) {
+                --high;
+            }
+
+            m_min[channel] = static_cast<std::uint8_t>(low);
+            m_max[channel] = static_cast<std::uint8_t>(high);
+            m_shadow_clipped[channel] = counts[0];
+            m_highlight_clipped[channel] = counts[k_bins - 1];
+        }
+    }
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,129 @@
+/**
+ * @file seqlock.h
+ * @brief Single-writer sequence lock publishing a trivially copyable value without blocking.
+ *
+ * @details
+ * The writer bumps a sequence counter to an odd value, copies the value in, then bumps it
+ * to the next even value. Readers copy the value out and retry if the counter was odd or
+ * changed meanwhile. Neither side allocates or takes a mutex, and the writer never waits
+ * for readers: publishing on every UI tick costs a handful of relaxed stores.
+ *
+ * The payload is stored as relaxed atomic words, so a torn read is detected rather than
+ * being a data race.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @class Seqlock
+ * @brief Latest-value cell written by one thread and read by any number of threads.
+ *
+ * @tparam T Trivially copyable payload (e.g. a POD parameter snapshot).
+ *
+ * @warning Only one thread may call `store` at a time.
+ */
+template<typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock payloads are copied word by word");
+
+public:
+    /**
+     * @brief Creates a cell holding a value-initialized payload (version 0).
+     */
+    Seqlock() noexcept { write(T{}); }
+
+    /**
+     * @brief Publishes a new value.
+     * @param value The value readers will see from now on.
+     */
+    void store(const T& value) noexcept
+    {
+        const std::uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        write(value);
+
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reads the latest fully published value.
+     * @details Spins only while a `store` is in progress.
+     */
+    [[nodiscard]] T load() const noexcept
+    {
+        while (true) {
+            const std::uint64_t before = m_sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                T value = read();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_sequence.load(std::memory_order_relaxed) == before) {
+                    return value;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Number of values published so far.
+     */
+    [[nodiscard]] std::uint64_t version() const noexcept
+    {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    /**
+     * @brief Number of 64-bit words holding the payload.
+     */
+    static constexpr std::size_t k_words = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    void write(const T& value) noexcept
+    {
+        std::array<std::uint64_t, k_words> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+        for (std::size_t i = 0; i < k_words; ++i) {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] T read() const noexcept
+    {
+        std::array<std::uint64_t, k_words> words{};
+        for (std::size_t i = 0; i < k_words; ++i) {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, words.data(), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Even when stable, odd while a `store` is in progress.
+     */
+    std::atomic<std::uint64_t> m_sequence{0};
+
+    /**
+     * @brief Payload, word by word.
+     */
+    std::array<std::atomic<std::uint64_t>, k_words> m_words{};
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
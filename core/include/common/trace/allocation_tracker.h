@@ -0,0 +1,236 @@
+/**
+ * @file allocation_tracker.h
+ * @brief Declaration of AllocationTracker (bytes, allocation counts and peak memory per trace scope).
+ *
+ * @details
+ * The large allocations of the engine go through a few choke points, which report to the tracker:
+ * - `BufferPool` (the pixels of `ImageRegion` and `WorkingImageData`),
+ * - Halide's `custom_malloc` / `custom_free` (the intermediate buffers of the JIT pipelines),
+ * - the decoded source images (counted, their lifetime is OIIO's),
+ * - the OIIO tile cache, sampled as a gauge (its allocations cannot be hooked).
+ *
+ * Each allocation is attributed to the innermost `CM_TRACE_SCOPE` open on the allocating thread
+ * (`SourceManager::load`, `SourceManager::getTile`, `realize`, `downsample`, `upload`, ...);
+ * the parallel loops of a realization inherit the scope of the thread that started it. Per
+ * stage, the tracker keeps the allocations and bytes, the bytes still live, their peak, and the
+ * high-water mark of all tracked memory reached while the stage allocated.
+ *
+ * - Runtime switch: while disabled (the default), a hook costs one relaxed atomic load. Setting
+ *   the `CAPTUREMOMENT_MEMORY_REPORT` environment variable to a file path enables tracking at
+ *   `Core::initialize()` and writes the report there at exit.
+ * - Stages are named by the trace scopes: with `ENABLE_TRACING=OFF`, everything is "untraced".
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common::Trace {
+
+/**
+ * @class AllocationTracker
+ * @brief Process-wide attribution of the tracked allocations to the trace scopes.
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief Name of the stage of allocations made outside any trace scope.
+     */
+    static constexpr std::string_view k_untraced_stage { "untraced" };
+
+    /**
+     * @brief Totals of one stage.
+     */
+    struct StageStats {
+        /** @brief Trace scope name. */
+        std::string m_stage;
+        /** @brief Number of allocations. */
+        std::uint64_t m_allocations { 0 };
+        /** @brief Bytes allocated in total. */
+        std::uint64_t m_allocated_bytes { 0 };
+        /** @brief Bytes allocated by the stage and not yet freed. */
+        std::uint64_t m_live_bytes { 0 };
+        /** @brief Peak of `m_live_bytes`. */
+        std::uint64_t m_peak_live_bytes { 0 };
+        /** @brief Peak of all tracked memory (every stage, and the gauges) when the stage allocated. */
+        std::uint64_t m_peak_total_bytes { 0 };
+    };
+
+    /**
+     * @brief Returns the process-wide tracker.
+     */
+    [[nodiscard]] static AllocationTracker& instance();
+
+    /**
+     * @brief Starts or stops attributing allocations (blocks already tracked are still released).
+     */
+    void setEnabled(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether allocations are being attributed.
+     */
+    [[nodiscard]] bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Stage of the calling thread (a trace scope name literal), or nullptr outside any scope.
+     */
+    [[nodiscard]] static const char* currentStage() noexcept;
+
+    /**
+     * @brief Sets the stage of the calling thread.
+     * @return The previous stage, to restore.
+     */
+    static const char* exchangeStage(const char* stage) noexcept;
+
+    /**
+     * @brief Attributes a new block to the stage of the calling thread.
+     */
+    void recordAllocation(const void* ptr, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Releases a block recorded by `recordAllocation` (unknown blocks are ignored).
+     */
+    void recordFree(const void* ptr) noexcept;
+
+    /**
+     * @brief Counts an allocation whose release is not observed (e.g. made by OIIO): it adds to the
+     *        allocations and bytes of the stage, not to its live bytes.
+     */
+    void countAllocation(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Sets the current size of an allocator that cannot be hooked (e.g. the OIIO tile cache).
+     * @param name Gauge name literal.
+     * @param bytes Bytes it holds now, counted in the total.
+     */
+    void sampleGauge(const char* name, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Totals of every stage, by decreasing peak of total memory.
+     */
+    [[nodiscard]] std::vector<StageStats> stageStats() const;
+
+    /**
+     * @brief High-water mark of all tracked memory.
+     */
+    [[nodiscard]] std::uint64_t peakTotalBytes() const;
+
+    /**
+     * @brief Drops the totals (live blocks stay tracked, so that their release is still matched).
+     */
+    void resetStats() noexcept;
+
+    /**
+     * @brief Writes the totals per stage and per gauge as a text table.
+     * @return Nothing on success, `CoreError::IOError` if the file cannot be written.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> writeReport(const std::filesystem::path& path) const;
+
+    AllocationTracker(const AllocationTracker&) = delete;
+    AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+    /**
+     * @class ScopedStage
+     * @brief Sets the stage of the calling thread for a scope (e.g. a pool task inheriting its caller's).
+     */
+    class ScopedStage {
+    public:
+        explicit ScopedStage(const char* stage) noexcept : m_previous(exchangeStage(stage)) {}
+        ~ScopedStage() { exchangeStage(m_previous); }
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+
+    private:
+        /** @brief Stage restored on exit. */
+        const char* m_previous;
+    };
+
+private:
+    AllocationTracker() = default;
+
+    /**
+     * @brief A tracked block.
+     */
+    struct Block {
+        /** @brief Stage it is attributed to. */
+        const char* m_stage;
+        /** @brief Size. */
+        std::size_t m_bytes;
+    };
+
+    /**
+     * @brief A gauge and its peak.
+     */
+    struct Gauge {
+        std::uint64_t m_bytes { 0 };
+        std::uint64_t m_peak_bytes { 0 };
+    };
+
+    /**
+     * @brief Totals of the stage of the calling thread (caller holds `m_mutex`).
+     */
+    [[nodiscard]] StageStats& stage_unsafe();
+
+    /**
+     * @brief Raises the high-water marks after the total grew (caller holds `m_mutex`).
+     */
+    void updatePeaks_unsafe(StageStats& stage) noexcept;
+
+    std::atomic<bool> m_enabled { false };
+
+    /**
+     * @brief Number of tracked blocks: `recordFree` returns at once while there are none.
+     */
+    std::atomic<std::size_t> m_tracked_blocks { 0 };
+
+    /**
+     * @brief Guards everything below.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Live tracked blocks.
+     */
+    std::unordered_map<const void*, Block> m_blocks;
+
+    /**
+     * @brief Totals per stage, keyed by the scope name pointer (merged by name in the results).
+     */
+    std::unordered_map<const char*, StageStats> m_stages;
+
+    /**
+     * @brief Gauges, keyed by name literal.
+     */
+    std::unordered_map<const char*, Gauge> m_gauges;
+
+    /**
+     * @brief Bytes of the live blocks plus the current gauges.
+     */
+    std::uint64_t m_total_bytes { 0 };
+
+    /**
+     * @brief Peak of `m_total_bytes`.
+     */
+    std::uint64_t m_peak_total_bytes { 0 };
+};
+
+} // namespace Common::Trace
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,147 @@
+/**
+ * @file perf_counters.h
+ * @brief Declaration of PerfCounters (hardware performance counters of the trace scopes).
+ *
+ * @details
+ * In the deep-dive profiling mode (`CAPTUREMOMENT_TRACE_COUNTERS`, with `CAPTUREMOMENT_TRACE`),
+ * every trace scope also records the cycles, instructions and last-level cache misses spent in
+ * it, and the exported trace shows them with the IPC and an estimate of the DRAM bandwidth
+ * (one cache line per LLC miss). A low IPC with a high bandwidth marks a bandwidth-bound stage.
+ *
+ * The counters of a thread are one `perf_event_open` group (user space only, so the default
+ * `perf_event_paranoid` level allows it), opened on the thread's first read. Work a scope hands
+ * to other threads (the parallel loops of a realization) is measured there and added to the
+ * scope through an `Accumulator`. Other platforms, and hosts refusing the events (containers,
+ * virtual machines), record no counters.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace CaptureMoment::Core {
+
+namespace Common::Trace {
+
+/**
+ * @struct CounterSample
+ * @brief Counter values (absolute, or the difference of two reads).
+ */
+struct CounterSample {
+    /** @brief CPU cycles. */
+    std::uint64_t m_cycles { 0 };
+    /** @brief Retired instructions. */
+    std::uint64_t m_instructions { 0 };
+    /** @brief Last-level cache misses. */
+    std::uint64_t m_llc_misses { 0 };
+
+    [[nodiscard]] CounterSample operator-(const CounterSample& other) const noexcept
+    {
+        return { m_cycles - other.m_cycles, m_instructions - other.m_instructions, m_llc_misses - other.m_llc_misses };
+    }
+
+    CounterSample& operator+=(const CounterSample& other) noexcept
+    {
+        m_cycles += other.m_cycles;
+        m_instructions += other.m_instructions;
+        m_llc_misses += other.m_llc_misses;
+        return *this;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept { return m_cycles == 0 && m_instructions == 0 && m_llc_misses == 0; }
+};
+
+/**
+ * @class PerfCounters
+ * @brief Process-wide switch and per-thread reads of the hardware counters.
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Bytes transferred per LLC miss in the bandwidth estimate.
+     */
+    static constexpr std::uint64_t k_cache_line_bytes { 64 };
+
+    /**
+     * @brief True if the platform has a counter implementation (Linux).
+     */
+    [[nodiscard]] static bool isSupported() noexcept;
+
+    /**
+     * @brief Starts or stops reading the counters in the trace scopes.
+     * @return False if enabling is not supported, or the counters cannot be opened on this host.
+     */
+    static bool setEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the trace scopes read the counters.
+     */
+    [[nodiscard]] static bool isEnabled() noexcept { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Reads the counters of the calling thread, plus the work accumulated for it.
+     * @return False if the thread's counters are unavailable.
+     */
+    static bool read(CounterSample& sample) noexcept;
+
+    /**
+     * @class Accumulator
+     * @brief Adds the counters of work run on other threads to the creating thread's, on destruction.
+     */
+    class Accumulator {
+    public:
+        Accumulator() noexcept = default;
+        ~Accumulator();
+
+        /**
+         * @brief Runs `work`, measuring it if it runs on another thread than the creating one
+         *        (whose own counters already include it).
+         */
+        template<typename Work>
+        decltype(auto) measure(Work&& work)
+        {
+            CounterSample begin;
+            if (std::this_thread::get_id() == m_owner || !PerfCounters::readThread(begin)) {
+                return work();
+            }
+            struct Finish {
+                Accumulator& m_accumulator;
+                CounterSample m_begin;
+                ~Finish() { m_accumulator.add(m_begin); }
+            } finish { *this, begin };
+            return work();
+        }
+
+        Accumulator(const Accumulator&) = delete;
+        Accumulator& operator=(const Accumulator&) = delete;
+
+    private:
+        /**
+         * @brief Adds the counters of the calling thread since `begin`.
+         */
+        void add(const CounterSample& begin) noexcept;
+
+        /** @brief Creating thread. */
+        std::thread::id m_owner { std::this_thread::get_id() };
+        std::atomic<std::uint64_t> m_cycles { 0 };
+        std::atomic<std::uint64_t> m_instructions { 0 };
+        std::atomic<std::uint64_t> m_llc_misses { 0 };
+    };
+
+private:
+    /**
+     * @brief Reads the hardware counters of the calling thread only.
+     */
+    static bool readThread(CounterSample& sample) noexcept;
+
+    static inline std::atomic<bool> s_enabled { false };
+};
+
+} // namespace Common::Trace
+
+} // namespace CaptureMoment::Core
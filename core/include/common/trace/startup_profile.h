@@ -0,0 +1,113 @@
+/**
+ * @file startup_profile.h
+ * @brief Declaration of StartupProfile (measured launch phases and the launch-time report).
+ *
+ * @details
+ * Each launch phase (logging, backend registration, backend decision, engine construction,
+ * QML load, first frame...) is timed with a `ScopedStartupPhase`. When the application is
+ * interactive, `finish()` logs the report once: every phase with its start offset and
+ * duration, and the time to interactive. Phases still running in the background (backend
+ * benchmark, JIT warm-up) are reported when they end.
+ *
+ * Times are offsets from the tracer origin, so call `StartupProfile::instance()` first thing
+ * in `main()`. The phases are also recorded as "startup" trace events when tracing is on.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common::Trace {
+
+/**
+ * @brief One measured phase.
+ */
+struct StartupPhase {
+    /** @brief Phase name (string literal). */
+    const char* m_name { nullptr };
+    /** @brief Start, in ms since the tracer origin. */
+    double m_begin_ms { 0.0 };
+    double m_duration_ms { 0.0 };
+    /** @brief Whether the phase ended after `finish()` (off the launch path). */
+    bool m_background { false };
+};
+
+/**
+ * @class StartupProfile
+ * @brief Process-wide record of the launch phases.
+ */
+class StartupProfile {
+public:
+    /**
+     * @brief Returns the process-wide profile.
+     */
+    [[nodiscard]] static StartupProfile& instance();
+
+    /**
+     * @brief Records a completed phase (any thread).
+     * @param name Phase name literal.
+     * @param begin_ns Start, from `Tracer::now()`.
+     * @param end_ns End, from `Tracer::now()`.
+     */
+    void record(const char* name, std::int64_t begin_ns, std::int64_t end_ns);
+
+    /**
+     * @brief Marks the application interactive and logs the report (first call only).
+     */
+    void finish();
+
+    /**
+     * @brief Time to interactive in ms, or a negative value before `finish()`.
+     */
+    [[nodiscard]] double interactiveMs() const;
+
+    /**
+     * @brief The phases recorded so far, in completion order.
+     */
+    [[nodiscard]] std::vector<StartupPhase> phases() const;
+
+    /**
+     * @brief Renders the report (one line per phase, then the time to interactive).
+     */
+    [[nodiscard]] std::string report() const;
+
+    StartupProfile(const StartupProfile&) = delete;
+    StartupProfile& operator=(const StartupProfile&) = delete;
+
+private:
+    StartupProfile() = default;
+
+    mutable std::mutex m_mutex;
+    std::vector<StartupPhase> m_phases;
+    /** @brief Time to interactive, in ms; negative until `finish()`. */
+    double m_interactive_ms { -1.0 };
+};
+
+/**
+ * @class ScopedStartupPhase
+ * @brief Records the lifetime of a scope as a launch phase.
+ */
+class ScopedStartupPhase {
+public:
+    explicit ScopedStartupPhase(const char* name) noexcept;
+    ~ScopedStartupPhase();
+
+    ScopedStartupPhase(const ScopedStartupPhase&) = delete;
+    ScopedStartupPhase& operator=(const ScopedStartupPhase&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_begin_ns;
+};
+
+} // namespace Common::Trace
+
+} // namespace CaptureMoment::Core
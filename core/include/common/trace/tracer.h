@@ -0,0 +1,260 @@
+/**
+ * @file tracer.h
+ * @brief Declaration of Tracer (low-overhead scoped timings, exported as a Chrome trace).
+ *
+ * @details
+ * Hot paths are instrumented with `CM_TRACE_SCOPE(category, name)`: the scope's begin and end
+ * times are stored in a ring buffer owned by the calling thread, without locks or allocation.
+ * The buffers are dumped on demand (`Tracer::writeChromeTrace`) as Chrome trace-event JSON,
+ * which chrome://tracing and the Perfetto UI (ui.perfetto.dev) open directly.
+ *
+ * - Compile-time removable: with `ENABLE_TRACING=OFF` (`CAPTUREMOMENT_USE_TRACING` 0), the
+ *   macro expands to nothing.
+ * - Runtime switch: while disabled (the default), a scope costs one relaxed atomic load (two
+ *   with the `AllocationTracker` check, which makes the scope the allocating stage of its thread).
+ *   Setting the `CAPTUREMOMENT_TRACE` environment variable to a file path enables tracing at
+ *   `Core::initialize()` and writes the trace there at exit.
+ * - Each thread keeps its last `k_events_per_thread` events: older ones are overwritten.
+ *
+ * With `CAPTUREMOMENT_TRACE_COUNTERS` also set, scopes record the hardware counters spent in
+ * them as well (`PerfCounters`), exported as the arguments of their events.
+ *
+ * Categories and names must be string literals (only the pointers are stored); dynamic names
+ * go through `Tracer::intern`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "config.h"
+#include "common/error_handling/core_error.h"
+#include "common/trace/allocation_tracker.h"
+#include "common/trace/perf_counters.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common::Trace {
+
+/**
+ * @class Tracer
+ * @brief Process-wide collector of the per-thread trace buffers.
+ */
+class Tracer {
+public:
+    /**
+     * @brief Events kept per thread (older events are overwritten).
+     */
+    static constexpr std::size_t k_events_per_thread { 16384 };
+
+    /**
+     * @brief Returns the process-wide tracer.
+     */
+    [[nodiscard]] static Tracer& instance();
+
+    /**
+     * @brief Starts or stops recording (events already recorded are kept).
+     */
+    void setEnabled(bool enabled) noexcept { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks whether scopes are being recorded.
+     */
+    [[nodiscard]] bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Nanoseconds since the tracer was created (monotonic).
+     */
+    [[nodiscard]] std::int64_t now() const noexcept;
+
+    /**
+     * @brief Records a completed scope in the calling thread's buffer (lock-free).
+     *
+     * @param category Category literal (e.g. "io", "pipeline").
+     * @param name Event name literal.
+     * @param begin_ns Start, from `now()`.
+     * @param end_ns End, from `now()`.
+     * @param counters Hardware counters spent in the scope, if read.
+     */
+    void record(const char* category, const char* name, std::int64_t begin_ns, std::int64_t end_ns,
+                const CounterSample& counters = {}) noexcept;
+
+    /**
+     * @brief Returns a copy of a dynamic name that lives until exit, usable as an event name.
+     * @details Takes a lock: intern once, not per event in hot paths.
+     */
+    [[nodiscard]] const char* intern(std::string_view name);
+
+    /**
+     * @brief Names the calling thread in the exported trace.
+     */
+    void setCurrentThreadName(std::string name);
+
+    /**
+     * @brief Drops the recorded events of all threads.
+     * @details Events recorded concurrently may survive.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Writes the recorded events as Chrome trace-event JSON (also read by Perfetto).
+     *
+     * @details Can be called while threads record: events overwritten during the copy are skipped.
+     *
+     * @param path Output file.
+     * @return Nothing on success, `CoreError::IOError` if the file cannot be written.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> writeChromeTrace(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Number of events currently held by all threads.
+     */
+    [[nodiscard]] std::size_t eventCount() const;
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+private:
+    /**
+     * @brief One recorded scope. Atomic fields: the exporter reads while the owner writes.
+     */
+    struct Event {
+        std::atomic<const char*> m_category { nullptr };
+        std::atomic<const char*> m_name { nullptr };
+        std::atomic<std::int64_t> m_begin_ns { 0 };
+        std::atomic<std::int64_t> m_end_ns { 0 };
+        std::atomic<std::uint64_t> m_cycles { 0 };
+        std::atomic<std::uint64_t> m_instructions { 0 };
+        std::atomic<std::uint64_t> m_llc_misses { 0 };
+    };
+
+    /**
+     * @brief Ring buffer of one thread (single writer: the owning thread).
+     */
+    struct ThreadBuffer {
+        /** @brief Trace thread id (registration order). */
+        std::uint32_t m_thread_id { 0 };
+        /** @brief Thread name, guarded by `Tracer::m_mutex`. */
+        std::string m_name;
+        /** @brief Number of events ever written; the next slot is `m_head % k_events_per_thread`. */
+        std::atomic<std::uint64_t> m_head { 0 };
+        /** @brief Index below which events were cleared. */
+        std::atomic<std::uint64_t> m_cleared { 0 };
+        /** @brief Events. */
+        std::array<Event, k_events_per_thread> m_events;
+    };
+
+    Tracer();
+
+    /**
+     * @brief Buffer of the calling thread, registered on first use.
+     */
+    [[nodiscard]] ThreadBuffer& threadBuffer();
+
+    /**
+     * @brief Registered buffers (kept after their thread exits, for export).
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<ThreadBuffer>> buffers() const;
+
+    /**
+     * @brief Clock origin of `now()`.
+     */
+    const std::int64_t m_origin_ns;
+
+    std::atomic<bool> m_enabled { false };
+
+    /**
+     * @brief Guards `m_buffers`, the thread names and `m_interned`.
+     */
+    mutable std::mutex m_mutex;
+
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+    /**
+     * @brief Interned names (node-based: the strings never move).
+     */
+    std::unordered_set<std::string> m_interned;
+};
+
+/**
+ * @class ScopedTrace
+ * @brief Records the lifetime of a scope (use `CM_TRACE_SCOPE`).
+ */
+class ScopedTrace {
+public:
+    ScopedTrace(const char* category, const char* name) noexcept
+        : m_category(category)
+        , m_name(name)
+        , m_begin_ns(Tracer::instance().isEnabled() ? Tracer::instance().now() : -1)
+        , m_tracks_allocations(AllocationTracker::instance().isEnabled())
+    {
+        if (m_tracks_allocations) {
+            m_previous_stage = AllocationTracker::exchangeStage(name);
+        }
+        // Read last: the setup above is not counted
+        m_reads_counters = m_begin_ns >= 0 && PerfCounters::isEnabled() && PerfCounters::read(m_counters_begin);
+    }
+
+    ~ScopedTrace()
+    {
+        if (m_tracks_allocations) {
+            AllocationTracker::exchangeStage(m_previous_stage);
+        }
+        if (m_begin_ns >= 0) {
+            CounterSample counters;
+            if (m_reads_counters && PerfCounters::read(counters)) {
+                counters = counters - m_counters_begin;
+            }
+            Tracer& tracer { Tracer::instance() };
+            tracer.record(m_category, m_name, m_begin_ns, tracer.now(), counters);
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* m_category;
+    const char* m_name;
+    /** @brief Start time, or -1 if tracing was disabled when the scope opened. */
+    std::int64_t m_begin_ns;
+    /** @brief True if the scope is the allocating stage of its thread (see `AllocationTracker`). */
+    bool m_tracks_allocations;
+    /** @brief Stage restored on exit. */
+    const char* m_previous_stage { nullptr };
+    /** @brief True if the hardware counters were read when the scope opened. */
+    bool m_reads_counters { false };
+    /** @brief Counters when the scope opened. */
+    CounterSample m_counters_begin;
+};
+
+} // namespace Common::Trace
+
+} // namespace CaptureMoment::Core
+
+#define CM_TRACE_CONCAT_INNER(a, b) a##b
+#define CM_TRACE_CONCAT(a, b) CM_TRACE_CONCAT_INNER(a, b)
+
+#if CAPTUREMOMENT_USE_TRACING
+/**
+ * @brief Times the enclosing scope under the given category and name (string literals).
+ */
+#define CM_TRACE_SCOPE(category, name) \
+    const ::CaptureMoment::Core::Common::Trace::ScopedTrace CM_TRACE_CONCAT(cm_trace_scope_, __LINE__) { category, name }
+#else
+#define CM_TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
@@ -0,0 +1,472 @@
+/**
+ * @file typed_image_region.h
+ * @brief Defines ImageRegionT: pixel buffers typed by element (U8, U16, F16, F32) and layout.
+ *
+ * @details
+ * `ImageRegion` holds linear float pixels, 16 bytes per RGBA pixel: the right format for
+ * processing, four times more than needed once pixels are display-encoded, thumbnails or
+ * 8-bit exports. `ImageRegionT<T, Layout>` carries the same region with the element type and
+ * layout in its type, so such buffers are stored at their own size with no type punning:
+ * - `ImageRegionU8` / `ImageRegionU16`: normalized integers (0 maps to 0.0, the maximum to 1.0).
+ * - `ImageRegionF16`: IEEE half floats (`Half`, bit-compatible with `Halide::float16_t`).
+ * - `ImageRegionF32`: floats, interchangeable with `ImageRegion` (`toImageRegion`).
+ * - `PlanarImageRegion<T>`: one plane per channel instead of interleaved channels.
+ *
+ * `convertImage` converts between any of them (and from `ImageRegion`), clamping and rounding
+ * into integer ranges.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "image_region.h"
+#include "pixel_format.h"
+#include "types/image_types.h"
+#include "memory/buffer_pool.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @struct Half
+ * @brief IEEE 754 binary16 storage (no arithmetic: convert to float to compute).
+ *
+ * @details Trivial on purpose (no member initializer), so pooled buffers of halves are not
+ *          zero-filled on resize, like float buffers.
+ */
+struct Half {
+    /**
+     * @brief Sign, 5 exponent and 10 mantissa bits.
+     */
+    std::uint16_t m_bits;
+
+    /**
+     * @brief Rounds a float to the nearest half (ties to even; overflow to infinity).
+     */
+    [[nodiscard]] static constexpr Half fromFloat(float value) noexcept
+    {
+        const std::uint32_t bits { std::bit_cast<std::uint32_t>(value) };
+        const std::uint32_t sign { (bits >> 16) & 0x8000u };
+        const std::uint32_t magnitude { bits & 0x7FFF'FFFFu };
+
+        // Infinity and NaN (kept quiet)
+        if (magnitude >= 0x7F80'0000u) {
+            return Half { static_cast<std::uint16_t>(sign | 0x7C00u | (magnitude > 0x7F80'0000u ? 0x0200u : 0u)) };
+        }
+        // 65520 and above round to infinity
+        if (magnitude >= 0x477F'F000u) {
+            return Half { static_cast<std::uint16_t>(sign | 0x7C00u) };
+        }
+
+        // Normal halves: rebias the exponent, round the mantissa from 23 to 10 bits
+        if (magnitude >= 0x3880'0000u) {
+            std::uint32_t half { (magnitude - 0x3800'0000u) >> 13 };
+            const std::uint32_t remainder { magnitude & 0x1FFFu };
+            if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0)) {
+                ++half;
+            }
+            return Half { static_cast<std::uint16_t>(sign | half) };
+        }
+
+        // Subnormal halves (units of 2^-24); 2^-25 and below round to zero
+        if (magnitude <= 0x3300'0000u) {
+            return Half { static_cast<std::uint16_t>(sign) };
+        }
+        const std::uint32_t shift { 126u - (magnitude >> 23) };
+        const std::uint32_t mantissa { (magnitude & 0x7F'FFFFu) | 0x80'0000u };
+        std::uint32_t half { mantissa >> shift };
+        const std::uint32_t remainder { mantissa & ((1u << shift) - 1u) };
+        const std::uint32_t halfway { 1u << (shift - 1u) };
+        if (remainder > halfway || (remainder == halfway && (half & 1u) != 0)) {
+            ++half;
+        }
+        return Half { static_cast<std::uint16_t>(sign | half) };
+    }
+
+    /**
+     * @brief The exact float value of the half.
+     */
+    [[nodiscard]] constexpr float toFloat() const noexcept
+    {
+        const std::uint32_t sign { static_cast<std::uint32_t>(m_bits & 0x8000u) << 16 };
+        const std::uint32_t exponent { (m_bits >> 10) & 0x1Fu };
+        std::uint32_t mantissa { m_bits & 0x3FFu };
+
+        if (exponent == 0x1Fu) {
+            return std::bit_cast<float>(sign | 0x7F80'0000u | (mantissa << 13));
+        }
+        if (exponent != 0) {
+            return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+        }
+        if (mantissa == 0) {
+            return std::bit_cast<float>(sign);
+        }
+
+        // Subnormal: normalize into a float exponent
+        std::uint32_t normalized_exponent { 113u };
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            --normalized_exponent;
+        }
+        return std::bit_cast<float>(sign | (normalized_exponent << 23) | ((mantissa & 0x3FFu) << 13));
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Half&) const noexcept = default;
+};
+
+static_assert(sizeof(Half) == 2 && std::is_trivially_default_constructible_v<Half>);
+
+/**
+ * @concept PixelComponent
+ * @brief The element types an ImageRegionT can hold.
+ */
+template<typename T>
+concept PixelComponent = std::same_as<T, std::uint8_t> || std::same_as<T, std::uint16_t>
+                         || std::same_as<T, Half> || std::same_as<T, float>;
+
+/**
+ * @struct PixelTraits
+ * @brief Conversion of an element type from and to the float values of `ImageRegion`.
+ *
+ * @details Integers are normalized: 0 is 0.0 and the largest value 1.0. Floats are clamped to
+ *          [0, 1] and rounded to the nearest integer on the way in.
+ */
+template<PixelComponent T>
+struct PixelTraits {
+    /**
+     * @brief The float value of an element.
+     */
+    [[nodiscard]] static constexpr float toFloat(T value) noexcept
+    {
+        if constexpr (std::same_as<T, float>) {
+            return value;
+        } else if constexpr (std::same_as<T, Half>) {
+            return value.toFloat();
+        } else {
+            return static_cast<float>(value) * (1.0f / static_cast<float>(std::numeric_limits<T>::max()));
+        }
+    }
+
+    /**
+     * @brief The element closest to a float value.
+     */
+    [[nodiscard]] static constexpr T fromFloat(float value) noexcept
+    {
+        if constexpr (std::same_as<T, float>) {
+            return value;
+        } else if constexpr (std::same_as<T, Half>) {
+            return Half::fromFloat(value);
+        } else {
+            // NaN compares false and ends at 0
+            const float clamped { value > 0.0f ? std::min(value, 1.0f) : 0.0f };
+            return static_cast<T>(clamped * static_cast<float>(std::numeric_limits<T>::max()) + 0.5f);
+        }
+    }
+};
+
+/**
+ * @brief Pooled storage of an ImageRegionT: aligned, recycled, not zero-filled on resize.
+ */
+template<PixelComponent T>
+using TypedPixelBuffer = std::vector<T, PooledAllocator<T>>;
+
+/**
+ * @struct ImageRegionT
+ * @brief A rectangular region of an image with its pixels, typed by element and layout.
+ *
+ * @details
+ * Same fields and accessors as `ImageRegion` (which is the float interleaved case, with a runtime
+ * `m_format` on top). Element `(x, y, c)` lives at:
+ * - Interleaved: `m_data[(y * width + x) * channels + c]`
+ * - Planar: `m_data[(c * height + y) * width + x]`
+ *
+ * @tparam T Element type (`std::uint8_t`, `std::uint16_t`, `Half`, `float`).
+ * @tparam Layout Element order.
+ */
+template<PixelComponent T, PixelLayout Layout = PixelLayout::Interleaved>
+struct ImageRegionT {
+
+    /**
+     * @brief Element type of the pixel data.
+     */
+    using value_type = T;
+
+    /**
+     * @brief Element order of the pixel data.
+     */
+    static constexpr PixelLayout k_layout { Layout };
+
+    /**
+     * @brief X-coordinate of the top-left corner of this region in the full source image.
+     */
+    ImageCoord m_x{0};
+
+    /**
+     * @brief Y-coordinate of the top-left corner of this region in the full source image.
+     */
+    ImageCoord m_y{0};
+
+    /**
+     * @brief Width of this image region in pixels.
+     */
+    ImageDim m_width{0};
+
+    /**
+     * @brief Height of this image region in pixels.
+     */
+    ImageDim m_height{0};
+
+    /**
+     * @brief Number of channels per pixel.
+     */
+    ImageChan m_channels{4};
+
+    /**
+     * @brief Pixel data, `width * height * channels` elements in `Layout` order.
+     */
+    TypedPixelBuffer<T> m_data;
+
+    /**
+     * @brief Creates an empty, invalid region.
+     */
+    ImageRegionT() = default;
+
+    /**
+     * @brief Takes ownership of existing pixel data (no copy).
+     */
+    ImageRegionT(TypedPixelBuffer<T>&& data, ImageDim w, ImageDim h, ImageChan ch)
+        : m_width(w)
+        , m_height(h)
+        , m_channels(ch)
+        , m_data(std::move(data))
+    {}
+
+    /**
+     * @brief Takes ownership of existing pixel data, placed at (x, y) in the source image.
+     */
+    ImageRegionT(ImageCoord x, ImageCoord y, TypedPixelBuffer<T>&& data, ImageDim w, ImageDim h, ImageChan ch)
+        : m_x(x)
+        , m_y(y)
+        , m_width(w)
+        , m_height(h)
+        , m_channels(ch)
+        , m_data(std::move(data))
+    {}
+
+    /**
+     * @brief Allocates a region of the given size; the elements are left uninitialized.
+     * @throws std::bad_alloc if the allocation fails.
+     */
+    [[nodiscard]] static ImageRegionT allocate(ImageDim w, ImageDim h, ImageChan ch)
+    {
+        return ImageRegionT(TypedPixelBuffer<T>(static_cast<std::size_t>(w) * h * ch), w, h, ch);
+    }
+
+    /**
+     * @brief Width of the region in pixels.
+     */
+    [[nodiscard]] constexpr ImageDim width() const noexcept { return m_width; }
+
+    /**
+     * @brief Height of the region in pixels.
+     */
+    [[nodiscard]] constexpr ImageDim height() const noexcept { return m_height; }
+
+    /**
+     * @brief Number of channels per pixel.
+     */
+    [[nodiscard]] constexpr ImageChan channels() const noexcept { return m_channels; }
+
+    /**
+     * @brief X-coordinate of the region in the source image.
+     */
+    [[nodiscard]] constexpr ImageCoord x() const noexcept { return m_x; }
+
+    /**
+     * @brief Y-coordinate of the region in the source image.
+     */
+    [[nodiscard]] constexpr ImageCoord y() const noexcept { return m_y; }
+
+    /**
+     * @brief Checks the dimensions (without overflow) against the size of the data.
+     */
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        if (m_width == 0 || m_height == 0 || m_channels == 0 || m_channels > 8) {
+            return false;
+        }
+
+        const std::size_t width { m_width };
+        const std::size_t height { m_height };
+        if (height > std::numeric_limits<std::size_t>::max() / width) {
+            return false;
+        }
+        const std::size_t pixels { width * height };
+        if (static_cast<std::size_t>(m_channels) > std::numeric_limits<std::size_t>::max() / pixels) {
+            return false;
+        }
+        return m_data.size() == pixels * m_channels;
+    }
+
+    /**
+     * @brief Size of the pixel data in bytes.
+     */
+    [[nodiscard]] constexpr ImageSize sizeInBytes() const noexcept { return m_data.size() * sizeof(T); }
+
+    /**
+     * @brief Number of elements (pixels * channels).
+     */
+    [[nodiscard]] constexpr ImageSize getDataSize() const noexcept { return m_data.size(); }
+
+    /**
+     * @brief Non-owning view over the pixel data.
+     */
+    [[nodiscard]] std::span<T> getBuffer() noexcept { return m_data; }
+
+    /**
+     * @brief Const overload of getBuffer().
+     */
+    [[nodiscard]] std::span<const T> getBuffer() const noexcept { return m_data; }
+
+    /**
+     * @brief Position of element (x, y, c) in `m_data`.
+     */
+    [[nodiscard]] constexpr std::size_t index(int y, int x, int c) const noexcept
+    {
+        assert(y >= 0 && static_cast<std::size_t>(y) < m_height);
+        assert(x >= 0 && static_cast<std::size_t>(x) < m_width);
+        assert(c >= 0 && static_cast<std::size_t>(c) < m_channels);
+        if constexpr (Layout == PixelLayout::Interleaved) {
+            return (static_cast<std::size_t>(y) * m_width + x) * m_channels + c;
+        } else {
+            return (static_cast<std::size_t>(c) * m_height + y) * m_width + x;
+        }
+    }
+
+    /**
+     * @brief Unchecked access to element (x, y, c) (asserts in Debug builds).
+     */
+    [[nodiscard]] T& operator()(int y, int x, int c) noexcept { return m_data[index(y, x, c)]; }
+
+    /**
+     * @brief Const overload of operator().
+     */
+    [[nodiscard]] const T& operator()(int y, int x, int c) const noexcept { return m_data[index(y, x, c)]; }
+
+    /**
+     * @brief The elements of row `y`, all channels interleaved.
+     */
+    [[nodiscard]] std::span<T> row(int y) noexcept
+        requires(Layout == PixelLayout::Interleaved)
+    {
+        const std::size_t length { static_cast<std::size_t>(m_width) * m_channels };
+        return std::span<T>(m_data).subspan(static_cast<std::size_t>(y) * length, length);
+    }
+
+    /**
+     * @brief The plane of channel `c`, row by row.
+     */
+    [[nodiscard]] std::span<T> plane(int c) noexcept
+        requires(Layout == PixelLayout::Planar)
+    {
+        const std::size_t length { static_cast<std::size_t>(m_width) * m_height };
+        return std::span<T>(m_data).subspan(static_cast<std::size_t>(c) * length, length);
+    }
+};
+
+/**
+ * @brief 8-bit interleaved region (display-encoded pixels, thumbnails, 8-bit exports).
+ */
+using ImageRegionU8 = ImageRegionT<std::uint8_t>;
+
+/**
+ * @brief 16-bit interleaved region (16-bit exports).
+ */
+using ImageRegionU16 = ImageRegionT<std::uint16_t>;
+
+/**
+ * @brief Half float interleaved region (half the memory of float, values above 1.0 kept).
+ */
+using ImageRegionF16 = ImageRegionT<Half>;
+
+/**
+ * @brief Float interleaved region: the layout of ImageRegion.
+ */
+using ImageRegionF32 = ImageRegionT<float>;
+
+/**
+ * @brief Region with one plane per channel.
+ */
+template<PixelComponent T>
+using PlanarImageRegion = ImageRegionT<T, PixelLayout::Planar>;
+
+static_assert(MutableTypedImageLike<ImageRegion>);
+static_assert(MutableTypedImageLike<ImageRegionU8> && MutableTypedImageLike<PlanarImageRegion<Half>>);
+static_assert(MutableImageLike<ImageRegionF32>, "Float regions work with the ImageLike algorithms");
+
+/**
+ * @brief Converts a region to another element type and layout (same size and position).
+ *
+ * @details Elements convert through float (`PixelTraits`): integers are normalized, values out of
+ *          an integer range are clamped. Interleaved to interleaved runs as one flat loop.
+ * @throws std::bad_alloc if the allocation fails.
+ */
+template<PixelComponent To, PixelLayout ToLayout = PixelLayout::Interleaved, TypedImageLike Source>
+[[nodiscard]] ImageRegionT<To, ToLayout> convertImage(const Source& source)
+{
+    using From = typename Source::value_type;
+    const auto convert = [](const From& value) {
+        if constexpr (std::same_as<From, To>) {
+            return value;
+        } else {
+            return PixelTraits<To>::fromFloat(PixelTraits<From>::toFloat(value));
+        }
+    };
+
+    auto target { ImageRegionT<To, ToLayout>::allocate(source.m_width, source.m_height, source.m_channels) };
+    target.m_x = source.m_x;
+    target.m_y = source.m_y;
+
+    if constexpr (Source::k_layout == ToLayout) {
+        std::ranges::transform(source.getBuffer(), target.m_data.begin(), convert);
+    } else {
+        for (int c = 0; c < static_cast<int>(source.m_channels); ++c) {
+            for (int y = 0; y < static_cast<int>(source.m_height); ++y) {
+                for (int x = 0; x < static_cast<int>(source.m_width); ++x) {
+                    target(y, x, c) = convert(source(y, x, c));
+                }
+            }
+        }
+    }
+    return target;
+}
+
+/**
+ * @brief Converts a region to the float interleaved ImageRegion the engine processes.
+ * @throws std::bad_alloc if the allocation fails.
+ */
+template<TypedImageLike Source>
+[[nodiscard]] ImageRegion toImageRegion(const Source& source)
+{
+    ImageRegionF32 converted { convertImage<float>(source) };
+    return ImageRegion(converted.m_x, converted.m_y, std::move(converted.m_data),
+                       converted.m_width, converted.m_height, converted.m_channels);
+}
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
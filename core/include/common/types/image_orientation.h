@@ -0,0 +1,113 @@
+/**
+ * @file image_orientation.h
+ * @brief EXIF orientation of a source image, carried as a view transform.
+ *
+ * @details
+ * Decoders leave the pixels in the order the file stores them; the orientation tells how they
+ * are shown. The pipeline and the working image stay in the stored frame, the display applies
+ * the orientation as a transform of its quad, and only exported images are rotated (see
+ * `Utils::orient_F32`): no full-frame pass at load time.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @enum ImageOrientation
+ * @brief EXIF orientation codes: how the stored pixels map to the upright image.
+ */
+enum class ImageOrientation : std::uint8_t {
+    Normal = 1,           ///< Stored upright.
+    MirrorHorizontal = 2, ///< Mirrored left to right.
+    Rotate180 = 3,        ///< Turned half a turn.
+    MirrorVertical = 4,   ///< Mirrored top to bottom.
+    Transpose = 5,        ///< Mirrored about the main diagonal.
+    Rotate90 = 6,         ///< Shown turned a quarter turn clockwise.
+    Transverse = 7,       ///< Mirrored about the anti-diagonal.
+    Rotate270 = 8         ///< Shown turned a quarter turn counterclockwise.
+};
+
+/**
+ * @brief Orientation of an EXIF "Orientation" value; out-of-range values are `Normal`.
+ */
+[[nodiscard]] constexpr ImageOrientation orientationFromExif(int code) noexcept
+{
+    return code >= 1 && code <= 8 ? static_cast<ImageOrientation>(code) : ImageOrientation::Normal;
+}
+
+/**
+ * @brief Whether the upright image swaps the stored width and height (codes 5 to 8).
+ */
+[[nodiscard]] constexpr bool swapsAxes(ImageOrientation orientation) noexcept
+{
+    return static_cast<std::uint8_t>(orientation) >= static_cast<std::uint8_t>(ImageOrientation::Transpose);
+}
+
+/**
+ * @brief Size of the upright image.
+ * @return (width, height) of a stored image of `width` x `height` once oriented.
+ */
+[[nodiscard]] constexpr std::pair<ImageDim, ImageDim> orientedSize(ImageOrientation orientation,
+                                                                   ImageDim width, ImageDim height) noexcept
+{
+    return swapsAxes(orientation) ? std::pair{ height, width } : std::pair{ width, height };
+}
+
+/**
+ * @brief Position in the upright image of a stored position.
+ * @details Continuous coordinates: the stored image spans [0, width] x [0, height], so pixel
+ *          centers (`i + 0.5`) map to pixel centers.
+ * @param width Stored width.
+ * @param height Stored height.
+ */
+[[nodiscard]] constexpr std::pair<double, double> storedToOriented(ImageOrientation orientation, double x, double y,
+                                                                   double width, double height) noexcept
+{
+    switch (orientation) {
+    case ImageOrientation::MirrorHorizontal: return { width - x, y };
+    case ImageOrientation::Rotate180:        return { width - x, height - y };
+    case ImageOrientation::MirrorVertical:   return { x, height - y };
+    case ImageOrientation::Transpose:        return { y, x };
+    case ImageOrientation::Rotate90:         return { height - y, x };
+    case ImageOrientation::Transverse:       return { height - y, width - x };
+    case ImageOrientation::Rotate270:        return { y, width - x };
+    case ImageOrientation::Normal:           break;
+    }
+    return { x, y };
+}
+
+/**
+ * @brief Stored position of a position in the upright image (inverse of `storedToOriented`).
+ * @param width Stored width.
+ * @param height Stored height.
+ */
+[[nodiscard]] constexpr std::pair<double, double> orientedToStored(ImageOrientation orientation, double x, double y,
+                                                                   double width, double height) noexcept
+{
+    switch (orientation) {
+    case ImageOrientation::MirrorHorizontal: return { width - x, y };
+    case ImageOrientation::Rotate180:        return { width - x, height - y };
+    case ImageOrientation::MirrorVertical:   return { x, height - y };
+    case ImageOrientation::Transpose:        return { y, x };
+    case ImageOrientation::Rotate90:         return { y, height - x };
+    case ImageOrientation::Transverse:       return { width - y, height - x };
+    case ImageOrientation::Rotate270:        return { width - y, x };
+    case ImageOrientation::Normal:           break;
+    }
+    return { x, y };
+}
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
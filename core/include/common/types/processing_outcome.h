@@ -0,0 +1,50 @@
+/**
+ * @file processing_outcome.h
+ * @brief Enum describing how a processing request settled.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @brief Final state of a processing request (the value of its future).
+ *
+ * @details
+ * Every request submitted to the engine settles with exactly one of these values:
+ * a request that never ran, or was aborted mid-pass, is not a failure.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class ProcessingOutcome : std::uint8_t {
+    /**
+     * @brief The pass ran to completion; the working image holds its result.
+     */
+    Completed = 0,
+
+    /**
+     * @brief A newer request replaced this one before or while it ran.
+     * @details The newer request's future reports the state of the image.
+     */
+    Superseded = 1,
+
+    /**
+     * @brief The request was cancelled explicitly (e.g. image change or shutdown).
+     */
+    Cancelled = 2,
+
+    /**
+     * @brief The pass failed (invalid image, pipeline error).
+     */
+    Failed = 3
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
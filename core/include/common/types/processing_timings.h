@@ -0,0 +1,84 @@
+/**
+ * @file processing_timings.h
+ * @brief Timestamps of a processing request, from submission to settlement.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/processing_outcome.h"
+#include "common/types/memory_type.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @brief Lifecycle of one processing request, reported when it settles.
+ *
+ * @details
+ * A request waits in the queue (`m_submitted` to `m_started`), then runs the pipeline
+ * (`m_started` to `m_settled`). A request superseded or cancelled before it ran has no start
+ * (`ran()` is false): it was coalesced into a newer request.
+ */
+struct ProcessingTimings {
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Generation number of the request (increasing in submission order).
+     */
+    std::uint64_t m_generation{0};
+
+    /**
+     * @brief How the request settled.
+     */
+    ProcessingOutcome m_outcome{ProcessingOutcome::Completed};
+
+    /**
+     * @brief true if the request processed the preview proxy.
+     */
+    bool m_use_proxy{false};
+
+    /**
+     * @brief Backend of the image the pass ran on (meaningful only if `ran()`).
+     */
+    MemoryType m_backend{MemoryType::CPU_RAM};
+
+    /**
+     * @brief When the request was submitted.
+     */
+    Clock::time_point m_submitted{};
+
+    /**
+     * @brief When its pass was launched, or the epoch if it never ran.
+     */
+    Clock::time_point m_started{};
+
+    /**
+     * @brief When its future settled.
+     */
+    Clock::time_point m_settled{};
+
+    /**
+     * @brief Checks whether the request reached the pipeline.
+     */
+    [[nodiscard]] bool ran() const noexcept { return m_started != Clock::time_point{}; }
+
+    /**
+     * @brief Time spent waiting for the previous pass (zero for a request that never ran).
+     */
+    [[nodiscard]] Clock::duration queueing() const noexcept { return ran() ? m_started - m_submitted : Clock::duration::zero(); }
+
+    /**
+     * @brief Time spent in the pipeline (zero for a request that never ran).
+     */
+    [[nodiscard]] Clock::duration pipeline() const noexcept { return ran() ? m_settled - m_started : Clock::duration::zero(); }
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
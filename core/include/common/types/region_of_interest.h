@@ -0,0 +1,116 @@
+/**
+ * @file region_of_interest.h
+ * @brief Rectangular region of interest used to restrict processing.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Common {
+
+/**
+ * @struct RegionOfInterest
+ * @brief Rectangle, in full-resolution image coordinates, that a pipeline should compute.
+ *
+ * @details
+ * Unlike `ImageRegion`, this structure carries no pixel data. It only describes which
+ * part of the working image must be realized, e.g. the part currently visible in the viewport.
+ */
+struct RegionOfInterest {
+    /** @brief Left edge (inclusive), in pixels. */
+    ImageCoord m_x{0};
+
+    /** @brief Top edge (inclusive), in pixels. */
+    ImageCoord m_y{0};
+
+    /** @brief Width of the region, in pixels. */
+    ImageDim m_width{0};
+
+    /** @brief Height of the region, in pixels. */
+    ImageDim m_height{0};
+
+    /**
+     * @brief Checks that the region is non-empty and has non-negative origin.
+     * @return true if the region can be used for processing.
+     */
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return m_x >= 0 && m_y >= 0 && m_width > 0 && m_height > 0;
+    }
+
+    /**
+     * @brief Checks whether the region covers the whole image.
+     * @param width Image width.
+     * @param height Image height.
+     * @return true if the region starts at the origin and spans the full image.
+     */
+    [[nodiscard]] constexpr bool coversImage(ImageDim width, ImageDim height) const noexcept
+    {
+        return m_x == 0 && m_y == 0 && m_width >= width && m_height >= height;
+    }
+
+    /**
+     * @brief Returns the intersection of this region with the image bounds.
+     * @param width Image width.
+     * @param height Image height.
+     * @return The clamped region. May be invalid (empty) if the region lies outside the image.
+     */
+    [[nodiscard]] constexpr RegionOfInterest clampedTo(ImageDim width, ImageDim height) const noexcept
+    {
+        const std::int64_t x0 = std::max<std::int64_t>(m_x, 0);
+        const std::int64_t y0 = std::max<std::int64_t>(m_y, 0);
+        const std::int64_t x1 = std::min<std::int64_t>(static_cast<std::int64_t>(m_x) + static_cast<std::int64_t>(m_width),
+                                                       static_cast<std::int64_t>(width));
+        const std::int64_t y1 = std::min<std::int64_t>(static_cast<std::int64_t>(m_y) + static_cast<std::int64_t>(m_height),
+                                                       static_cast<std::int64_t>(height));
+
+        if (x1 <= x0 || y1 <= y0) {
+            return {};
+        }
+
+        return RegionOfInterest{
+            static_cast<ImageCoord>(x0),
+            static_cast<ImageCoord>(y0),
+            static_cast<ImageDim>(x1 - x0),
+            static_cast<ImageDim>(y1 - y0)
+        };
+    }
+
+    /**
+     * @brief Returns the intersection of this region with another one.
+     * @param other The other region.
+     * @return The common part. May be invalid (empty) if the regions do not overlap.
+     */
+    [[nodiscard]] constexpr RegionOfInterest intersectedWith(const RegionOfInterest& other) const noexcept
+    {
+        const std::int64_t x0 = std::max<std::int64_t>(m_x, other.m_x);
+        const std::int64_t y0 = std::max<std::int64_t>(m_y, other.m_y);
+        const std::int64_t x1 = std::min<std::int64_t>(static_cast<std::int64_t>(m_x) + static_cast<std::int64_t>(m_width),
+                                                       static_cast<std::int64_t>(other.m_x) + static_cast<std::int64_t>(other.m_width));
+        const std::int64_t y1 = std::min<std::int64_t>(static_cast<std::int64_t>(m_y) + static_cast<std::int64_t>(m_height),
+                                                       static_cast<std::int64_t>(other.m_y) + static_cast<std::int64_t>(other.m_height));
+
+        if (x1 <= x0 || y1 <= y0) {
+            return {};
+        }
+
+        return RegionOfInterest{
+            static_cast<ImageCoord>(x0),
+            static_cast<ImageCoord>(y0),
+            static_cast<ImageDim>(x1 - x0),
+            static_cast<ImageDim>(y1 - y0)
+        };
+    }
+};
+
+} // namespace Common
+
+} // namespace CaptureMoment::Core
@@ -13,9 +13,27 @@
 
 #pragma once
 
+#include "common/memory/buffer_pool.h"
+#include "common/types/image_types.h"
 #include "common/types/memory_type.h"
+#include "common/pixel_format.h"
+#include "config/energy_policy.h"
+#include "config/smart_preview_policy.h"
+#include "image_processing/deciders/backend_cost_model.h"
+#include "image_processing/deciders/cpu_target.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+#include "pipeline/cpu_schedule.h"
+#include "pipeline/scheduling_strategy.h"
+#include "image_config/raw_settings.h"
+#include "workers/task_priority.h"
 #include "Halide.h"
 
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <shared_mutex>
+
 namespace CaptureMoment::Core {
 
 namespace Config {
@@ -31,6 +49,10 @@ namespace Config {
  *
  * It follows the Meyer's Singleton pattern for thread-safe initialization.
  *
+ * **Thread safety:** every setter and getter may be called concurrently (several engines
+ * run in one process). Scalar settings are atomics; paths, targets and the cost model are
+ * guarded by a shared mutex and returned by value, so a reader never sees a half-written value.
+ *
  * **Managed Settings:**
  * 1. **Memory Backend**: Whether the processing pipeline uses CPU RAM or GPU Memory
  *    (Common::MemoryType).
@@ -38,6 +60,9 @@ namespace Config {
  *    Vulkan, or Metal) to be used by all Halide operations. This ensures that
  *    once a backend is chosen by IBackendDecider, all image processing components
  *    use the same optimized target.
+ * 3. **Per-backend Targets & Cost Model**: When a GPU is usable, its target is kept even
+ *    if the CPU won globally, together with a cost model built from the benchmark.
+ *    `WorkingImageFactory` uses them to pick the backend per image.
  *
  * @note While a Singleton is used here for convenience, in highly decoupled
  *       subsystems (e.g., StateImageManager), consider passing the configured
@@ -78,6 +103,24 @@ public:
      */
     [[nodiscard]] Common::MemoryType getProcessingBackend() const noexcept;
 
+    /**
+     * @brief Forces the backend of the working images created afterwards.
+     *
+     * @details
+     * Overrides the per-image selection of `WorkingImageFactory` (cost model and energy plan),
+     * for hosts whose operators know better than the benchmark. `GPU_MEMORY` falls back to the
+     * selection when no GPU backend is registered.
+     *
+     * @param backend The forced backend, or `std::nullopt` to let the selection decide (default).
+     */
+    void setBackendOverride(std::optional<Common::MemoryType> backend);
+
+    /**
+     * @brief Gets the forced backend of the working images.
+     * @return The backend, `std::nullopt` unless configured.
+     */
+    [[nodiscard]] std::optional<Common::MemoryType> getBackendOverride() const;
+
     /**
      * @brief Sets the configured Halide Target object.
      *
@@ -102,9 +145,581 @@ public:
      * This target should be passed to Halide pipelines to ensure they compile
      * for the correct hardware (e.g., generating CUDA kernels instead of x86 code).
      *
-     * @return A const reference to the configured Halide::Target object.
+     * @return A copy of the configured Halide::Target object.
+     */
+    [[nodiscard]] static Halide::Target getHalideTarget();
+
+    /**
+     * @brief Sets the GPU Halide target, independently of the globally selected backend.
+     *
+     * @details
+     * Called at startup with the fastest GPU target found by the benchmark, so that
+     * GPU working images can be created for large images even when the CPU won globally.
+     * `setHalideTarget` also updates it when given a GPU target.
+     *
+     * @param target Host target plus a GPU feature (CUDA, Vulkan, ...).
+     */
+    static void setGpuHalideTarget(const Halide::Target& target);
+
+    /**
+     * @brief Gets the Halide target to use for a given backend.
+     *
+     * @param backend The backend a pipeline or buffer runs on.
+     * @return The host target (no GPU feature) for CPU_RAM, the GPU target for GPU_MEMORY.
+     *         Falls back to `getHalideTarget()` if no GPU target is configured.
+     */
+    [[nodiscard]] static Halide::Target getHalideTarget(Common::MemoryType backend);
+
+    /**
+     * @brief Counter incremented whenever one of the Halide targets changes.
+     * @details Lets hot paths keep a copy of a target and re-read it only after a change
+     *          (see `OperationPipelineExecutor::pipelineTarget`).
+     */
+    [[nodiscard]] static std::uint64_t targetGeneration() noexcept;
+
+    /**
+     * @brief Checks whether a GPU target is configured (GPU working images can be created).
+     */
+    [[nodiscard]] static bool hasGpuHalideTarget() noexcept;
+
+    /**
+     * @brief Sets the thread-block shape of the per-pixel GPU stages.
+     *
+     * @details
+     * Called at startup with the shape tuned by the backend benchmark for this GPU. Counts as a
+     * target change (`targetGeneration`), so pipelines built with the previous shape are rebuilt.
+     * Invalid shapes are ignored.
+     *
+     * @param schedule The tile shape.
+     */
+    static void setGpuTileSchedule(const ImageProcessing::GpuTileSchedule& schedule);
+
+    /**
+     * @brief Gets the thread-block shape of the per-pixel GPU stages (16x16, one pixel per thread, by default).
+     */
+    [[nodiscard]] static ImageProcessing::GpuTileSchedule getGpuTileSchedule();
+
+    /**
+     * @brief Selects the instruction set the JIT compiles the CPU code for.
+     *
+     * @details
+     * `Native` (default) uses every feature of the machine (AVX-512, AVX2, FMA, F16C, ARM dot
+     * product...). `Portable` keeps the architecture baseline, so that renders are identical on
+     * every machine. Replaces the CPU target at once; the GPU targets are built on it by the
+     * next backend decision, so call it before `Core::initialize()`. Decisions cached on disk are
+     * kept per mode. `CAPTUREMOMENT_CPU_TARGET=portable` selects it at initialization.
+     *
+     * @param mode The mode.
      */
-    [[nodiscard]] static const Halide::Target& getHalideTarget();
+    void setCpuTargetMode(ImageProcessing::CpuTargetMode mode);
+
+    /**
+     * @brief Gets the instruction-set mode of the CPU target.
+     */
+    [[nodiscard]] ImageProcessing::CpuTargetMode getCpuTargetMode() const noexcept;
+
+    /**
+     * @brief Sets the cost model used for per-image backend selection.
+     * @param model The model built from the benchmark, or `std::nullopt` to always use the global backend.
+     */
+    void setBackendCostModel(std::optional<ImageProcessing::BackendCostModel> model);
+
+    /**
+     * @brief Gets the cost model used for per-image backend selection.
+     * @return The model, or `std::nullopt` if none was configured.
+     */
+    [[nodiscard]] std::optional<ImageProcessing::BackendCostModel> getBackendCostModel() const;
+
+    /**
+     * @brief Sets the storage format of the Halide working images.
+     *
+     * @details
+     * `RGBA_F16` halves the memory and bandwidth of every working copy (pipelines still
+     * compute in float). Only `RGBA_F32` and `RGBA_F16` are accepted.
+     * Applies to working images created afterwards.
+     *
+     * @param format The storage format.
+     */
+    void setWorkingPixelFormat(Common::PixelFormat format);
+
+    /**
+     * @brief Gets the storage format of the Halide working images.
+     * @return `RGBA_F32` (default) or `RGBA_F16`.
+     */
+    [[nodiscard]] Common::PixelFormat getWorkingPixelFormat() const noexcept;
+
+    /**
+     * @brief Sets the layout of the CPU Halide working images.
+     *
+     * @details
+     * `Planar` stores one dense plane per channel: the pipelines load each channel of a vector
+     * of pixels without shuffles, which pays off on blurs, masks and LUT gathers. Images are
+     * converted once at load, and back to interleaved for display and export only.
+     * GPU working images stay interleaved. Applies to working images created afterwards.
+     *
+     * @param layout The storage layout.
+     */
+    void setWorkingPixelLayout(Common::PixelLayout layout);
+
+    /**
+     * @brief Gets the layout of the CPU Halide working images.
+     * @return `Interleaved` (default) or `Planar`.
+     */
+    [[nodiscard]] Common::PixelLayout getWorkingPixelLayout() const noexcept;
+
+    /**
+     * @brief Sets the loop structure of the CPU pipelines (strips or 2D tiles).
+     * @details Applies to pipelines built afterwards; both variants stay in the pipeline cache.
+     * @param schedule The CPU schedule.
+     */
+    void setCpuSchedule(Pipeline::CpuSchedule schedule);
+
+    /**
+     * @brief Gets the loop structure of the CPU pipelines.
+     * @return `CpuSchedule::Strips` (default) or `CpuSchedule::Tiles`.
+     */
+    [[nodiscard]] Pipeline::CpuSchedule getCpuSchedule() const noexcept;
+
+    /**
+     * @brief Default edge of a CPU tile with `CpuSchedule::Tiles` (a float luminance tile is 256 KiB).
+     */
+    static constexpr int k_default_cpu_tile_size { 256 };
+
+    /**
+     * @brief Sets the edge of the square CPU tiles of `CpuSchedule::Tiles`.
+     * @details Size it to the L2 cache of the host. Applies to pipelines built afterwards;
+     *          each size is cached separately.
+     * @param size Edge in pixels (clamped to [16, 2048]).
+     */
+    void setCpuTileSize(int size) noexcept;
+
+    /**
+     * @brief Gets the edge of the square CPU tiles.
+     * @return The edge in pixels (`k_default_cpu_tile_size` unless configured).
+     */
+    [[nodiscard]] int getCpuTileSize() const noexcept;
+
+    /**
+     * @brief Sets who schedules the fused pipelines (hand-written schedule or autoscheduler).
+     * @details Applies to pipelines built afterwards; manual and autoscheduled variants are
+     *          cached separately. Chains the autoscheduler cannot handle keep the manual schedule.
+     * @param strategy The scheduling strategy.
+     */
+    void setSchedulingStrategy(Pipeline::SchedulingStrategy strategy);
+
+    /**
+     * @brief Gets who schedules the fused pipelines.
+     * @return `SchedulingStrategy::Manual` (default) or one of the autoscheduled strategies.
+     */
+    [[nodiscard]] Pipeline::SchedulingStrategy getSchedulingStrategy() const noexcept;
+
+    /**
+     * @brief Sets the directory the schedules are exported to with `SchedulingStrategy::AutoscheduleOffline`.
+     * @param directory Destination directory, created on first export.
+     */
+    void setScheduleDirectory(std::filesystem::path directory);
+
+    /**
+     * @brief Gets the directory the autoscheduled schedules are exported to.
+     * @return `halide_schedules` (relative to the working directory) unless configured.
+     */
+    [[nodiscard]] std::filesystem::path getScheduleDirectory() const;
+
+    /**
+     * @brief Sets what RAW loads show first (embedded preview, draft or full demosaic).
+     * @param mode The RAW load mode.
+     */
+    void setRawLoadMode(ImageConfig::Raw::RawLoadMode mode) noexcept;
+
+    /**
+     * @brief Gets what RAW loads show first.
+     * @return `RawLoadMode::draft_first` unless configured.
+     */
+    [[nodiscard]] ImageConfig::Raw::RawLoadMode getRawLoadMode() const noexcept;
+
+    /**
+     * @brief Sets who demosaics RAW files (LibRaw or the Halide engine).
+     * @details Applies to the next decodes; images already decoded stay cached as they are.
+     * @param engine The demosaic engine.
+     */
+    void setRawDemosaicEngine(ImageConfig::Raw::RawDemosaicEngine engine) noexcept;
+
+    /**
+     * @brief Gets who demosaics RAW files.
+     * @return `RawDemosaicEngine::libraw` unless configured.
+     */
+    [[nodiscard]] ImageConfig::Raw::RawDemosaicEngine getRawDemosaicEngine() const noexcept;
+
+    /**
+     * @brief Sets the memory budget of the tile cache backing the tile-backed sources.
+     * @details Applies from the next load of a tile-backed source.
+     * @param size_mb Capacity in megabytes (clamped to at least 64).
+     */
+    void setSourceTileCacheSizeMB(float size_mb) noexcept;
+
+    /**
+     * @brief Gets the memory budget of the tile cache backing the tile-backed sources.
+     * @return The capacity in megabytes (2048 unless configured).
+     */
+    [[nodiscard]] float getSourceTileCacheSizeMB() const noexcept;
+
+    /**
+     * @brief Sets the size from which standard images (TIFF, EXR, ...) are opened tile-backed.
+     *
+     * @details
+     * A tile-backed source is not decoded at load: its tiles are read on demand through the
+     * tile cache, so only the regions requested are held in memory. RAW and HEIC files are
+     * always decoded whole.
+     *
+     * @param min_pixels Minimum width x height, or 0 to always decode whole.
+     */
+    void setTiledSourceMinPixels(std::uint64_t min_pixels) noexcept;
+
+    /**
+     * @brief Gets the size from which standard images are opened tile-backed.
+     * @return The minimum number of pixels (100 megapixels unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getTiledSourceMinPixels() const noexcept;
+
+    /**
+     * @brief Bounds the long edge of the preview proxy, whatever size the display asks for.
+     * @details Lower it on slow hosts driving large displays. Applies from the next proxy preparation.
+     * @param long_edge Maximum long edge in pixels, or 0 for no bound (default).
+     */
+    void setProxyMaxLongEdge(Common::ImageDim long_edge) noexcept;
+
+    /**
+     * @brief Gets the bound of the long edge of the preview proxy.
+     * @return The bound in pixels, 0 if unbounded.
+     */
+    [[nodiscard]] Common::ImageDim getProxyMaxLongEdge() const noexcept;
+
+    /**
+     * @brief Previews a gesture on an expensive detail operation at reduced resolution.
+     * @details The operations that allow it (`IOperationFusionLogic::upsamplesPreview`, e.g. denoise)
+     * then run on a reduced copy of their input while dragged, their effect transferred to the
+     * preview pixels (`Operations::GuidedUpsampling`). Enabled by default. Applies from the next gesture.
+     * @param enabled false to always preview at full quality.
+     */
+    void setGuidedPreviewUpsampling(bool enabled) noexcept;
+
+    /**
+     * @brief Checks whether gestures on expensive detail operations are previewed at reduced resolution.
+     */
+    [[nodiscard]] bool isGuidedPreviewUpsamplingEnabled() const noexcept;
+
+    /**
+     * @brief Sets the size of the scaled decode a JPEG load shows first.
+     *
+     * @details
+     * A JPEG at least twice as large is decoded by libjpeg at 1/2, 1/4 or 1/8 scale (the
+     * smallest covering `long_edge`) and shown as a preview, like a RAW draft: the full
+     * resolution is decoded once requested (zoom to 100%, export). Applies from the next load;
+     * ignored in builds without libjpeg.
+     *
+     * @param long_edge Minimum long edge of the preview in pixels, or 0 to always decode whole.
+     */
+    void setJpegPreviewLongEdge(Common::ImageDim long_edge) noexcept;
+
+    /**
+     * @brief Gets the size of the scaled decode a JPEG load shows first.
+     * @return The minimum long edge in pixels (2048 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] Common::ImageDim getJpegPreviewLongEdge() const noexcept;
+
+    /**
+     * @brief Sets the largest file on network storage read whole before decoding.
+     *
+     * @details
+     * A file on NFS or SMB up to this size is read into memory with parallel reads
+     * (`Common::ReadAheadFile`) and decoded from there, instead of through the decoder's many
+     * small reads, each waiting for a network round trip. Larger files are decoded in place.
+     *
+     * @param size_mb Size in megabytes, or 0 to decode every file in place.
+     */
+    void setNetworkReadAheadMaxMB(std::uint64_t size_mb) noexcept;
+
+    /**
+     * @brief Gets the largest file on network storage read whole before decoding.
+     * @return The size in megabytes (1024 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getNetworkReadAheadMaxMB() const noexcept;
+
+    /**
+     * @brief Sets the directory of the persistent cache of decoded RAW files.
+     * @param directory Destination directory (created on first store), or empty for the
+     *        default `capturemoment/decoded` under the system temporary directory.
+     */
+    void setDecodedDiskCacheDirectory(std::filesystem::path directory);
+
+    /**
+     * @brief Gets the directory of the persistent cache of decoded RAW files.
+     * @return The configured directory, empty for the default one.
+     */
+    [[nodiscard]] std::filesystem::path getDecodedDiskCacheDirectory() const;
+
+    /**
+     * @brief Sets the disk budget of the persistent cache of decoded RAW files.
+     * @details The least recently used entries are deleted past the budget.
+     * @param size_mb Capacity in megabytes, or 0 to disable the cache.
+     */
+    void setDecodedDiskCacheSizeMB(std::uint64_t size_mb) noexcept;
+
+    /**
+     * @brief Gets the disk budget of the persistent cache of decoded RAW files.
+     * @return The capacity in megabytes (8192 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getDecodedDiskCacheSizeMB() const noexcept;
+
+    /**
+     * @brief Sets the directory of the persistent cache of rendered edit states.
+     * @param directory Destination directory (created on first store), or empty for the
+     *        default `capturemoment/results` under the system temporary directory.
+     */
+    void setResultDiskCacheDirectory(std::filesystem::path directory);
+
+    /**
+     * @brief Gets the directory of the persistent cache of rendered edit states.
+     * @return The configured directory, empty for the default one.
+     */
+    [[nodiscard]] std::filesystem::path getResultDiskCacheDirectory() const;
+
+    /**
+     * @brief Sets the disk budget of the persistent cache of rendered edit states.
+     * @details The least recently used entries are deleted past the budget.
+     * @param size_mb Capacity in megabytes, or 0 to keep the rendered states in memory only.
+     */
+    void setResultDiskCacheSizeMB(std::uint64_t size_mb) noexcept;
+
+    /**
+     * @brief Gets the disk budget of the persistent cache of rendered edit states.
+     * @return The capacity in megabytes (512 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getResultDiskCacheSizeMB() const noexcept;
+
+    /**
+     * @brief Sets the directory of the persistent cache of compiled pipelines.
+     * @param directory Destination directory (created on first store), or empty for the
+     *        default `capturemoment/pipelines` under the system temporary directory.
+     */
+    void setPipelineDiskCacheDirectory(std::filesystem::path directory);
+
+    /**
+     * @brief Gets the directory of the persistent cache of compiled pipelines.
+     * @return The configured directory, empty for the default one.
+     */
+    [[nodiscard]] std::filesystem::path getPipelineDiskCacheDirectory() const;
+
+    /**
+     * @brief Sets the disk budget of the persistent cache of compiled pipelines.
+     * @details The least recently used entries are deleted past the budget.
+     * @param size_mb Capacity in megabytes, or 0 to JIT-compile the pipelines every session.
+     */
+    void setPipelineDiskCacheSizeMB(std::uint64_t size_mb) noexcept;
+
+    /**
+     * @brief Gets the disk budget of the persistent cache of compiled pipelines.
+     * @return The capacity in megabytes (256 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getPipelineDiskCacheSizeMB() const noexcept;
+
+    /**
+     * @brief Sets the number of compiled pipelines each executor keeps in memory.
+     * @details Least recently used pipelines are evicted past it, from the next compilation.
+     * @param capacity Pipelines kept, or 0 for `Pipeline::CompiledPipelineCache::k_default_capacity`.
+     */
+    void setPipelineCacheCapacity(std::size_t capacity) noexcept;
+
+    /**
+     * @brief Gets the number of compiled pipelines each executor keeps in memory.
+     * @return The capacity, 0 for the default.
+     */
+    [[nodiscard]] std::size_t getPipelineCacheCapacity() const noexcept;
+
+    /**
+     * @brief Sets the directory of the smart previews loads may edit instead of the originals.
+     * @details Usually `Managers::SmartPreviewStore::directoryFor` the catalog.
+     * @param directory The store (written by the import), or empty to never use smart previews.
+     */
+    void setSmartPreviewDirectory(std::filesystem::path directory);
+
+    /**
+     * @brief Gets the directory of the smart previews.
+     * @return The configured directory, empty if none.
+     */
+    [[nodiscard]] std::filesystem::path getSmartPreviewDirectory() const;
+
+    /**
+     * @brief Sets when a load edits the smart preview of an image instead of its original.
+     * @param policy The policy.
+     */
+    void setSmartPreviewPolicy(SmartPreviewPolicy policy) noexcept;
+
+    /**
+     * @brief Gets when a load edits the smart preview of an image.
+     * @return `SmartPreviewPolicy::WhenOffline` unless configured.
+     */
+    [[nodiscard]] SmartPreviewPolicy getSmartPreviewPolicy() const noexcept;
+
+    /**
+     * @brief Sets the SQLite database of the thumbnail cache.
+     * @param path Database file (created on first use), or empty for the default
+     *        `capturemoment/thumbnails.db` under the system temporary directory.
+     */
+    void setThumbnailCachePath(std::filesystem::path path);
+
+    /**
+     * @brief Gets the SQLite database of the thumbnail cache.
+     * @return The configured file, empty for the default one.
+     */
+    [[nodiscard]] std::filesystem::path getThumbnailCachePath() const;
+
+    /**
+     * @brief Sets the budget of the thumbnail cache.
+     * @details The least recently used thumbnails are deleted past the budget.
+     * @param size_mb Capacity in megabytes of encoded thumbnails, or 0 to disable the cache.
+     */
+    void setThumbnailCacheSizeMB(std::uint64_t size_mb) noexcept;
+
+    /**
+     * @brief Gets the budget of the thumbnail cache.
+     * @return The capacity in megabytes (1024 unless configured), 0 if disabled.
+     */
+    [[nodiscard]] std::uint64_t getThumbnailCacheSizeMB() const noexcept;
+
+    /**
+     * @brief Sets the memory ceiling shared by the caches and buffer pools of the process.
+     *
+     * @details
+     * Forwarded to `Common::MemoryBudget`, which evicts from the caches (least recently used
+     * first) whenever their total goes over it. Set it on hosts running several instances.
+     * `CAPTUREMOMENT_MEMORY_BUDGET_MB` sets it at initialization.
+     *
+     * @param size_mb Ceiling in megabytes, or 0 for no ceiling.
+     */
+    void setMemoryBudgetMB(std::uint64_t size_mb);
+
+    /**
+     * @brief Gets the memory ceiling shared by the caches and buffer pools.
+     * @return The ceiling in megabytes (0, no ceiling, unless configured).
+     */
+    [[nodiscard]] std::uint64_t getMemoryBudgetMB() const noexcept;
+
+    /**
+     * @brief Sets the pages the large image buffers are mapped on.
+     *
+     * @details
+     * Forwarded to `Common::BufferPool`: blocks of at least `BufferPool::k_huge_page_threshold`
+     * bytes (working images, sources, exports) go on huge pages, which cuts the TLB misses of
+     * their first touch and of strided walks. `CAPTUREMOMENT_HUGE_PAGES` (off, transparent or
+     * explicit) sets it at initialization. Measured by the `BM_BufferFirstTouch` and
+     * `BM_BufferColumnWalk` benchmarks.
+     *
+     * @param mode The pages (`HugePages::Off` unless configured).
+     */
+    void setHugePages(Common::BufferPool::HugePages mode);
+
+    /**
+     * @brief Gets the pages the large image buffers are mapped on.
+     * @return The mode (`HugePages::Off` unless configured).
+     */
+    [[nodiscard]] Common::BufferPool::HugePages getHugePages() const noexcept;
+
+    /**
+     * @brief Sets the number of threads computing at once in the process.
+     *
+     * @details
+     * Forwarded to `Workers::ComputePool`, which runs every Halide `parallel` loop (previews,
+     * exports, thumbnails), and to OpenImageIO's own pool. `CAPTUREMOMENT_THREADS` sets it at
+     * initialization. Lower it on hosts running several instances.
+     *
+     * @param threads Budget, or 0 for the number of hardware threads.
+     */
+    void setConcurrencyBudget(std::size_t threads);
+
+    /**
+     * @brief Gets the number of threads computing at once in the process.
+     * @return The budget (the number of hardware threads unless configured).
+     */
+    [[nodiscard]] std::size_t getConcurrencyBudget() const noexcept;
+
+    /**
+     * @brief Caps the threads helping the parallel loops of one priority.
+     *
+     * @details
+     * The thread running a loop always works on it; the cap bounds the others. Loops of a more
+     * urgent priority take the threads of less urgent ones between two iterations, whatever
+     * the caps. Thumbnails are capped to `Workers::ComputePool::k_default_thumbnail_cap`.
+     *
+     * @param priority The priority (scheduler lane) of the loops.
+     * @param threads Maximum helper threads, or 0 for no cap beyond the budget.
+     */
+    void setPriorityConcurrencyCap(Workers::TaskPriority priority, std::size_t threads);
+
+    /**
+     * @brief Gets the cap of the threads helping the parallel loops of one priority.
+     * @return The cap, 0 if uncapped.
+     */
+    [[nodiscard]] std::size_t getPriorityConcurrencyCap(Workers::TaskPriority priority) const;
+
+    /**
+     * @brief Pins the compute threads to the memory nodes of a multi-socket host.
+     *
+     * @details
+     * Forwarded to `Workers::ComputePool`: its helpers are pinned to the nodes in turn, and the
+     * loops of a thread pinned to a node only use helpers of that node. The batch exporter then
+     * runs one CPU processor per node, each file on a single node. Without effect on single-node
+     * hosts. `CAPTUREMOMENT_NUMA_PINNING=1` enables it at initialization.
+     *
+     * Off by default: an interactive session works on one image, which is faster on every
+     * socket than on the memory of one.
+     *
+     * @param enabled true to pin.
+     */
+    void setNumaPinning(bool enabled);
+
+    /**
+     * @brief Checks whether the compute threads are pinned to the memory nodes.
+     * @return true if pinning was requested and the host has several nodes.
+     */
+    [[nodiscard]] bool isNumaPinningEnabled() const noexcept;
+
+    /**
+     * @brief Sets how processing trades speed for power (see `energy_policy.h`).
+     *
+     * @details
+     * The plan of the policy limits the backend of the working images created afterwards,
+     * the threads computing at once (a share of the concurrency budget), and the scale of
+     * the preview proxy. `Balanced` (default) follows the power source and the thermal state,
+     * re-probed by `currentEnergyPlan`. `CAPTUREMOMENT_ENERGY_POLICY` ("performance",
+     * "balanced" or "battery") sets it at initialization.
+     *
+     * @param policy The policy.
+     */
+    void setEnergyPolicy(EnergyPolicy policy);
+
+    /**
+     * @brief Gets the energy policy.
+     */
+    [[nodiscard]] EnergyPolicy getEnergyPolicy() const noexcept;
+
+    /**
+     * @brief Gets the limits of the energy policy in the current power state.
+     *
+     * @details
+     * Probes the power state again if the last probe is older than `k_power_probe_interval_ms`
+     * (never under `Performance`, which ignores it), and applies the thread share of a changed
+     * plan to `Workers::ComputePool` at once. Called on image loads and when interactive input
+     * goes idle, so the plan follows the power cable without a polling thread.
+     *
+     * @return The plan.
+     */
+    [[nodiscard]] EnergyPlan currentEnergyPlan();
+
+    /**
+     * @brief Minimum interval between two probes of the power state.
+     */
+    static constexpr std::int64_t k_power_probe_interval_ms { 10'000 };
 
     // ============================================================
     // Testing Utilities
@@ -128,6 +743,16 @@ private:
      */
     AppConfig() = default;
 
+    /**
+     * @brief Resolves the plan of the policy (probing the power state unless `Performance`) and applies it if it changed.
+     */
+    void refreshEnergyPlan();
+
+    /**
+     * @brief Sets the threads of `Workers::ComputePool`: the requested budget times the plan's share.
+     */
+    void applyConcurrencyBudget();
+
     /**
      * @brief Deleted copy constructor to enforce singleton pattern.
      */
@@ -146,7 +771,193 @@ private:
      * CPU RAM or in GPU Memory. Influences how `WorkingImageFactory`
      * creates working image instances.
      */
-    Common::MemoryType m_processing_backend{Common::MemoryType::CPU_RAM};
+    std::atomic<Common::MemoryType> m_processing_backend{Common::MemoryType::CPU_RAM};
+
+    /**
+     * @brief Backend forced on the working images (guarded by `m_mutex`, `std::nullopt`: per-image selection).
+     */
+    std::optional<Common::MemoryType> m_backend_override;
+
+    /**
+     * @brief Instruction-set mode of the CPU target.
+     */
+    std::atomic<ImageProcessing::CpuTargetMode> m_cpu_target_mode{ImageProcessing::CpuTargetMode::Native};
+
+    /**
+     * @brief Guards the non-atomic settings (cost model, paths).
+     */
+    mutable std::shared_mutex m_mutex;
+
+    /**
+     * @brief Cost model for per-image backend selection.
+     * @details Set once at startup, read-only afterwards.
+     */
+    std::optional<ImageProcessing::BackendCostModel> m_backend_cost_model;
+
+    /**
+     * @brief Storage format of the Halide working images.
+     */
+    std::atomic<Common::PixelFormat> m_working_pixel_format{Common::PixelFormat::RGBA_F32};
+
+    /**
+     * @brief Layout of the CPU Halide working images.
+     */
+    std::atomic<Common::PixelLayout> m_working_pixel_layout{Common::PixelLayout::Interleaved};
+
+    /**
+     * @brief Loop structure of the CPU pipelines.
+     */
+    std::atomic<Pipeline::CpuSchedule> m_cpu_schedule{Pipeline::CpuSchedule::Strips};
+
+    /**
+     * @brief Edge of the CPU tiles, in pixels.
+     */
+    std::atomic<int> m_cpu_tile_size{k_default_cpu_tile_size};
+
+    /**
+     * @brief Origin of the schedule of the fused pipelines.
+     */
+    std::atomic<Pipeline::SchedulingStrategy> m_scheduling_strategy{Pipeline::SchedulingStrategy::Manual};
+
+    /**
+     * @brief Export directory of the autoscheduled schedules.
+     */
+    std::filesystem::path m_schedule_directory{"halide_schedules"};
+
+    /**
+     * @brief What RAW loads show first.
+     */
+    std::atomic<ImageConfig::Raw::RawLoadMode> m_raw_load_mode{ImageConfig::Raw::RawLoadMode::draft_first};
+
+    /**
+     * @brief Who demosaics RAW files.
+     */
+    std::atomic<ImageConfig::Raw::RawDemosaicEngine> m_raw_demosaic_engine{ImageConfig::Raw::RawDemosaicEngine::libraw};
+
+    /**
+     * @brief Capacity of the source tile cache, in megabytes.
+     */
+    std::atomic<float> m_source_tile_cache_size_mb{2048.0f};
+
+    /**
+     * @brief Minimum pixel count of a tile-backed source (0: disabled).
+     */
+    std::atomic<std::uint64_t> m_tiled_source_min_pixels{100'000'000};
+
+    /**
+     * @brief Bound of the long edge of the preview proxy, in pixels (0: none).
+     */
+    std::atomic<Common::ImageDim> m_proxy_max_long_edge{0};
+
+    /**
+     * @brief True if gestures on expensive detail operations are previewed at reduced resolution.
+     */
+    std::atomic<bool> m_guided_preview_upsampling{true};
+
+    /**
+     * @brief Minimum long edge of the scaled JPEG preview, in pixels (0: full decode at load).
+     */
+    std::atomic<Common::ImageDim> m_jpeg_preview_long_edge{2048};
+
+    /**
+     * @brief Largest network file read whole before decoding, in megabytes (0: none).
+     */
+    std::atomic<std::uint64_t> m_network_read_ahead_max_mb{1024};
+
+    /**
+     * @brief Directory of the persistent decoded-RAW cache (empty: system temporary directory).
+     */
+    std::filesystem::path m_decoded_disk_cache_directory;
+
+    /**
+     * @brief Capacity of the persistent decoded-RAW cache, in megabytes (0: disabled).
+     */
+    std::atomic<std::uint64_t> m_decoded_disk_cache_size_mb{8192};
+
+    /**
+     * @brief Directory of the persistent rendered-state cache (empty: system temporary directory).
+     */
+    std::filesystem::path m_result_disk_cache_directory;
+
+    /**
+     * @brief Capacity of the persistent rendered-state cache, in megabytes (0: disabled).
+     */
+    std::atomic<std::uint64_t> m_result_disk_cache_size_mb{512};
+
+    /**
+     * @brief Directory of the persistent compiled-pipeline cache (empty: system temporary directory).
+     */
+    std::filesystem::path m_pipeline_disk_cache_directory;
+
+    /**
+     * @brief Capacity of the persistent compiled-pipeline cache, in megabytes (0: disabled).
+     */
+    std::atomic<std::uint64_t> m_pipeline_disk_cache_size_mb{256};
+
+    /**
+     * @brief Compiled pipelines kept in memory per executor (0: default).
+     */
+    std::atomic<std::size_t> m_pipeline_cache_capacity{0};
+
+    /**
+     * @brief SQLite database of the thumbnail cache (empty: system temporary directory).
+     */
+    std::filesystem::path m_thumbnail_cache_path;
+
+    /**
+     * @brief Capacity of the thumbnail cache, in megabytes (0: disabled).
+     */
+    std::atomic<std::uint64_t> m_thumbnail_cache_size_mb{1024};
+
+    /**
+     * @brief Memory ceiling of the caches and pools, in megabytes (0: none).
+     */
+    std::atomic<std::uint64_t> m_memory_budget_mb{0};
+
+    /**
+     * @brief Pages of the large image buffers (see setHugePages).
+     */
+    std::atomic<Common::BufferPool::HugePages> m_huge_pages{Common::BufferPool::HugePages::Off};
+
+    /**
+     * @brief Concurrency budget requested by `setConcurrencyBudget` (0: hardware threads).
+     */
+    std::atomic<std::size_t> m_concurrency_request{0};
+
+    /**
+     * @brief How processing trades speed for power.
+     */
+    std::atomic<EnergyPolicy> m_energy_policy{EnergyPolicy::Balanced};
+
+    /**
+     * @brief Directory of the smart previews (empty: none).
+     */
+    std::filesystem::path m_smart_preview_directory;
+
+    /**
+     * @brief When loads edit the smart previews.
+     */
+    std::atomic<SmartPreviewPolicy> m_smart_preview_policy{SmartPreviewPolicy::WhenOffline};
+
+    /**
+     * @brief Limits of the policy in the last probed power state (guarded by `m_mutex`).
+     */
+    EnergyPlan m_energy_plan;
+
+    /**
+     * @brief Steady clock time of the last power state probe, in milliseconds (0: never probed).
+     */
+    std::atomic<std::int64_t> m_power_probed_at_ms{0};
+
+    /**
+     * @brief Guards the three Halide targets and the GPU tile shape.
+     */
+    static std::shared_mutex s_target_mutex;
+
+    /**
+     * @brief Incremented under `s_target_mutex` on every target change (see `targetGeneration`).
+     */
+    static std::atomic<std::uint64_t> s_target_generation;
 
     /**
      * @brief The active Halide Target object for the application.
@@ -157,6 +968,21 @@ private:
      * by `BenchmarkingBackendDecider` to include GPU features.
      */
     static Halide::Target s_halide_target;
+
+    /**
+     * @brief Host target without GPU features, used by CPU pipelines.
+     */
+    static Halide::Target s_cpu_halide_target;
+
+    /**
+     * @brief Thread-block shape of the per-pixel GPU stages (guarded by `s_target_mutex`).
+     */
+    static ImageProcessing::GpuTileSchedule s_gpu_tile_schedule;
+
+    /**
+     * @brief GPU target, if a usable GPU was found.
+     */
+    static std::optional<Halide::Target> s_gpu_halide_target;
 };
 
 } // namespace Config
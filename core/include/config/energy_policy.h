@@ -0,0 +1,159 @@
+/**
+ * @file energy_policy.h
+ * @brief Declaration of the energy policy (power source and thermal state driven processing limits).
+ *
+ * @details
+ * On a laptop, GPU compute and all-core CPU bursts drain the battery and heat the machine until
+ * it throttles, at which point every pass gets slower anyway. The energy policy trades speed
+ * for power according to the host's state:
+ * - **Performance**: the benchmark decides alone (per-image backend, every thread, full proxy).
+ * - **Balanced** (default): as Performance on mains power at a nominal temperature. On battery
+ *   or when the machine runs hot, the GPU is only used where the benchmark measured it at least
+ *   twice as fast as the CPU (it draws more power), and fewer threads compute at once.
+ * - **Battery**: CPU only, half the threads, and a smaller preview proxy, whatever the state.
+ * A critical thermal state halves the threads and the proxy pixels again.
+ *
+ * `PowerState::probe` reads the power source and the thermal zones (Linux sysfs; the power
+ * source on Windows). Other systems report mains power at a nominal temperature.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "image_processing/deciders/backend_cost_model.h"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Config {
+
+/**
+ * @brief How processing trades speed for power.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class EnergyPolicy : std::uint8_t {
+    /**
+     * @brief Fastest processing, whatever the power source.
+     */
+    Performance = 0,
+
+    /**
+     * @brief Fastest on mains power, restrained on battery or when hot.
+     */
+    Balanced = 1,
+
+    /**
+     * @brief Restrained at all times.
+     */
+    Battery = 2
+};
+
+/**
+ * @brief How close the machine is to thermal throttling.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class ThermalState : std::uint8_t {
+    /**
+     * @brief Below the throttling range (or unknown).
+     */
+    Nominal = 0,
+
+    /**
+     * @brief Within `PowerState::k_elevated_margin_millicelsius` of a throttling trip point.
+     */
+    Elevated = 1,
+
+    /**
+     * @brief At or past a throttling trip point: the machine is slowing itself down.
+     */
+    Critical = 2
+};
+
+/**
+ * @struct PowerState
+ * @brief Power source and thermal state of the host.
+ */
+struct PowerState {
+    /**
+     * @brief Distance to a throttling trip point from which the state is `Elevated`.
+     */
+    static constexpr int k_elevated_margin_millicelsius { 10'000 };
+
+    /**
+     * @brief true if the machine runs on its battery.
+     */
+    bool m_on_battery{false};
+
+    /**
+     * @brief Hottest state among the thermal zones.
+     */
+    ThermalState m_thermal{ThermalState::Nominal};
+
+    /**
+     * @brief Reads the state of the host (a few small file reads on Linux).
+     */
+    [[nodiscard]] static PowerState probe();
+
+    [[nodiscard]] bool operator==(const PowerState&) const noexcept = default;
+};
+
+/**
+ * @struct EnergyPlan
+ * @brief Processing limits resolved from a policy and a power state.
+ */
+struct EnergyPlan {
+    /**
+     * @brief GPU advantage required on battery or when hot: the GPU must take half the CPU time.
+     */
+    static constexpr double k_constrained_gpu_advantage { 0.5 };
+
+    /**
+     * @brief false to create every working image on the CPU.
+     */
+    bool m_allow_gpu{true};
+
+    /**
+     * @brief Ratio of the GPU to the CPU time under which an image goes to the GPU
+     *        (`BackendCostModel::selectBackend`).
+     */
+    double m_gpu_advantage_threshold{ImageProcessing::BackendCostModel::k_gpu_advantage_threshold};
+
+    /**
+     * @brief Share of the concurrency budget computing at once.
+     */
+    double m_thread_fraction{1.0};
+
+    /**
+     * @brief Scale of the preview proxy, relative to the display size.
+     */
+    double m_proxy_scale{1.0};
+
+    /**
+     * @brief Resolves the limits of `policy` in `state`.
+     */
+    [[nodiscard]] static EnergyPlan resolve(EnergyPolicy policy, const PowerState& state) noexcept;
+
+    /**
+     * @brief Name of a policy, as accepted by `parsePolicy` ("performance", "balanced", "battery").
+     */
+    [[nodiscard]] static std::string_view policyName(EnergyPolicy policy) noexcept;
+
+    /**
+     * @brief Parses a policy name.
+     * @return The policy, or `std::nullopt` if the name is unknown.
+     */
+    [[nodiscard]] static std::optional<EnergyPolicy> parsePolicy(std::string_view name) noexcept;
+
+    [[nodiscard]] bool operator==(const EnergyPlan&) const noexcept = default;
+};
+
+} // namespace Config
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,215 @@
+/**
+ * @file performance_profile.h
+ * @brief Declaration of PerformanceProfile (per-host performance settings read from a JSON file).
+ *
+ * @details
+ * Operators tune each host without a rebuild: `CAPTUREMOMENT_PERFORMANCE_PROFILE` names a JSON
+ * file read at `Core::initialize()` and applied to `AppConfig`, then read again whenever it
+ * changes on disk. Every key is optional; the ones present replace the current setting:
+ *
+ * @code{.json}
+ * {
+ *     "threads": { "budget": 16, "interactive": 0, "refine": 12, "export": 8, "thumbnail": 2 },
+ *     "memory_budget_mb": 24576,
+ *     "source_tile_cache_mb": 4096,
+ *     "proxy_max_long_edge": 2560,
+ *     "cpu_tile_size": 128,
+ *     "fp16": true,
+ *     "pipeline_cache_size": 32,
+ *     "backend": "gpu"
+ * }
+ * @endcode
+ *
+ * - `threads`: the concurrency budget (0: hardware threads) and the helper cap of each
+ *   priority (0: uncapped), see `AppConfig::setConcurrencyBudget` and `setPriorityConcurrencyCap`.
+ * - `memory_budget_mb`: the ceiling of the caches and pools (0: none).
+ * - `source_tile_cache_mb`: the OpenImageIO tile cache of the tile-backed sources.
+ * - `proxy_max_long_edge`: the bound of the preview proxy (0: the display size).
+ * - `cpu_tile_size`: the edge of the tiles of `CpuSchedule::Tiles`.
+ * - `fp16`: working images stored as `RGBA_F16` rather than `RGBA_F32`.
+ * - `pipeline_cache_size`: the compiled pipelines kept in memory per executor (0: default).
+ * - `backend`: `"cpu"` or `"gpu"` to force the backend of the working images, `"auto"` to let
+ *   the benchmark and the energy plan decide.
+ *
+ * Each setting takes effect as its `AppConfig` setter documents (the next image, pipeline or
+ * proxy). A file that does not parse, or holds a value of the wrong type, is rejected whole and
+ * the settings stay as they are. A key removed from the file keeps its last value.
+ *
+ * The environment variables of the same settings (`CAPTUREMOMENT_THREADS`,
+ * `CAPTUREMOMENT_MEMORY_BUDGET_MB`) are applied after the profile at launch and override it;
+ * a reload applies the file over them.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+#include "common/types/memory_type.h"
+#include "workers/task_priority.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+
+namespace CaptureMoment::Core {
+
+namespace Config {
+
+/**
+ * @struct PerformanceProfile
+ * @brief The settings of a performance profile file (`std::nullopt`: key absent).
+ */
+struct PerformanceProfile {
+    /** @brief `threads.budget`: threads computing at once (0: hardware threads). */
+    std::optional<std::size_t> m_threads;
+
+    /** @brief `threads.<priority>`: helper cap of each priority, indexed by `Workers::TaskPriority` (0: uncapped). */
+    std::array<std::optional<std::size_t>, Workers::k_task_priority_count> m_priority_threads;
+
+    /** @brief `memory_budget_mb`: ceiling of the caches and pools (0: none). */
+    std::optional<std::uint64_t> m_memory_budget_mb;
+
+    /** @brief `source_tile_cache_mb`: capacity of the OpenImageIO tile cache. */
+    std::optional<float> m_source_tile_cache_mb;
+
+    /** @brief `proxy_max_long_edge`: bound of the preview proxy (0: none). */
+    std::optional<Common::ImageDim> m_proxy_max_long_edge;
+
+    /** @brief `cpu_tile_size`: edge of the CPU tiles. */
+    std::optional<int> m_cpu_tile_size;
+
+    /** @brief `fp16`: working images stored in half floats. */
+    std::optional<bool> m_fp16;
+
+    /** @brief `pipeline_cache_size`: compiled pipelines kept in memory per executor (0: default). */
+    std::optional<std::size_t> m_pipeline_cache_size;
+
+    /**
+     * @brief `backend`: outer `std::nullopt` if absent, inner `std::nullopt` for `"auto"`.
+     */
+    std::optional<std::optional<Common::MemoryType>> m_backend;
+
+    /**
+     * @brief Parses the JSON text of a profile.
+     * @return The profile, or `CoreError::DecodingError` if the text is not a JSON object or a
+     *         known key holds a value of the wrong type (unknown keys are only warned about).
+     */
+    [[nodiscard]] static std::expected<PerformanceProfile, ErrorHandling::CoreError> parse(std::string_view json);
+
+    /**
+     * @brief Reads and parses a profile file.
+     * @return The profile, `CoreError::FileNotFound`, `CoreError::IOError` or `CoreError::DecodingError`.
+     */
+    [[nodiscard]] static std::expected<PerformanceProfile, ErrorHandling::CoreError> load(const std::filesystem::path& path);
+
+    /**
+     * @brief Applies the settings present to `AppConfig`.
+     */
+    void apply() const;
+
+    [[nodiscard]] bool operator==(const PerformanceProfile&) const = default;
+};
+
+/**
+ * @class PerformanceProfileWatcher
+ * @brief Applies a profile file, and again whenever its modification time changes.
+ *
+ * @details
+ * A background thread compares the modification time every `poll_interval` (one `stat`, so
+ * the profile may live in any directory). A rewrite identical to the applied profile is
+ * skipped, so touching the file does not log every setting again.
+ */
+class PerformanceProfileWatcher {
+public:
+    /**
+     * @brief Default interval between two checks of the file.
+     */
+    static constexpr std::chrono::milliseconds k_default_poll_interval { 2000 };
+
+    /**
+     * @brief Applies the profile at `path` (if it loads), then starts watching it.
+     */
+    explicit PerformanceProfileWatcher(std::filesystem::path path,
+                                       std::chrono::milliseconds poll_interval = k_default_poll_interval);
+
+    /**
+     * @brief Stops watching. No reload runs once it returns.
+     */
+    ~PerformanceProfileWatcher();
+
+    PerformanceProfileWatcher(const PerformanceProfileWatcher&) = delete;
+    PerformanceProfileWatcher& operator=(const PerformanceProfileWatcher&) = delete;
+
+    /**
+     * @brief Loads and applies the profile now.
+     * @return void, or the error of `PerformanceProfile::load` (the settings are then unchanged).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> reload();
+
+    /**
+     * @brief Gets the watched file.
+     */
+    [[nodiscard]] const std::filesystem::path& path() const noexcept { return m_path; }
+
+private:
+    /**
+     * @brief Loads and applies the profile (caller holds `m_mutex`).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> reload_unsafe();
+
+    /**
+     * @brief Loop of the watching thread.
+     */
+    void run(std::stop_token stop);
+
+    /**
+     * @brief The profile file.
+     */
+    std::filesystem::path m_path;
+
+    /**
+     * @brief Interval between two checks of the file.
+     */
+    std::chrono::milliseconds m_poll_interval;
+
+    /**
+     * @brief Serializes the reloads, guards the members below.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Modification time of the file at the last load (`std::nullopt`: missing then).
+     */
+    std::optional<std::filesystem::file_time_type> m_last_write_time;
+
+    /**
+     * @brief Last profile applied.
+     */
+    std::optional<PerformanceProfile> m_applied;
+
+    /**
+     * @brief Woken to stop the thread between two checks.
+     */
+    std::condition_variable_any m_wake;
+
+    /**
+     * @brief The watching thread (declared last: started once the members above are constructed).
+     */
+    std::jthread m_thread;
+};
+
+} // namespace Config
+
+} // namespace CaptureMoment::Core
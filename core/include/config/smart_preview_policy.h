@@ -0,0 +1,47 @@
+/**
+ * @file smart_preview_policy.h
+ * @brief Declaration of the smart preview policy (when loads edit a proxy instead of the original).
+ *
+ * @details
+ * Smart previews are lossy half-float proxies of cataloged images (`Managers::SmartPreviewStore`),
+ * kept next to the catalog. Editing against one stays fast when the originals sit on slow network
+ * storage, and possible when their drive is disconnected; full-quality decodes (zoom to 100%,
+ * export) still read the original.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Config {
+
+/**
+ * @brief When a load edits the smart preview of an image instead of decoding its original.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class SmartPreviewPolicy : std::uint8_t {
+    /**
+     * @brief Never: originals are always decoded.
+     */
+    Disabled = 0,
+
+    /**
+     * @brief Only when the original cannot be reached (disconnected drive, unmounted share).
+     */
+    WhenOffline = 1,
+
+    /**
+     * @brief Whenever a preview matching the original exists (originals on slow storage).
+     */
+    Always = 2
+};
+
+} // namespace Config
+
+} // namespace CaptureMoment::Core
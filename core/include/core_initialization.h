@@ -11,8 +11,24 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace CaptureMoment::Core {
 
+/**
+ * @enum BackendSelection
+ * @brief How `initialize()` selects the backend when no cached decision is valid.
+ */
+enum class BackendSelection : std::uint8_t {
+    /** @brief Run the benchmark before returning (tools, tests). */
+    Blocking,
+    /**
+     * @brief Return on the CPU defaults and benchmark on a background thread (interactive
+     *        launch). The result is applied by `applyBackgroundBackendDecision()`.
+     */
+    Background
+};
+
 /**
  * @brief Initializes the CaptureMoment Core library.
  *
@@ -23,14 +39,61 @@ namespace CaptureMoment::Core {
  * exactly once during the application's lifetime.
  *
  * **Initialization Sequence:**
+ * 0. Enables tracing if `CAPTUREMOMENT_TRACE` names an output file (Chrome trace written at
+ *    exit, see `Common::Trace::Tracer`), with the hardware counters of each scope if
+ *    `CAPTUREMOMENT_TRACE_COUNTERS` is set (`Common::Trace::PerfCounters`).
+ *    Tracks the allocations per trace scope if `CAPTUREMOMENT_MEMORY_REPORT` names an output
+ *    file (report written at exit, see `Common::Trace::AllocationTracker`).
+ *    Applies the performance profile of the host named by `CAPTUREMOMENT_PERFORMANCE_PROFILE`
+ *    (a JSON file, see `Config::PerformanceProfile`), if set, and again whenever the file changes.
+ *    Applies the memory ceiling of `CAPTUREMOMENT_MEMORY_BUDGET_MB` (megabytes), if set
+ *    (`AppConfig::setMemoryBudgetMB`).
+ *    Selects the CPU instruction set of `CAPTUREMOMENT_CPU_TARGET` (`native` or `portable`), if set
+ *    (`AppConfig::setCpuTargetMode`).
+ *    Selects the energy policy of `CAPTUREMOMENT_ENERGY_POLICY` (`performance`, `balanced` or
+ *    `battery`), if set, and applies its plan to the thread budget (`AppConfig::setEnergyPolicy`).
  * 1. Registers CPU/GPU backends into `WorkingImageFactory` (via `ImageProcessing::registerDefaultBackends`).
- * 2. Runs `BenchmarkingBackendDecider` to select optimal hardware (CPU vs GPU).
+ *    Loads the operation plugins of the directories of `CAPTUREMOMENT_PLUGIN_PATH`, if set
+ *    (`Operations::OperationPluginRegistry::loadDirectory`).
+ * 2. Loads the backend decision cached on disk by `BackendDecisionCache`. If there is none,
+ *    or the machine fingerprint (CPU target, Halide version, GPU driver) changed, runs
+ *    `BenchmarkingBackendDecider` to select optimal hardware (CPU vs GPU) and caches the result.
  * 3. Stores the selected backend in `AppConfig`.
  *
+ * With `BackendSelection::Background`, step 2 runs on a background thread when the benchmark
+ * is needed, followed by a warm-up of the Halide JIT; the launch continues on the CPU backend.
+ * Each step is recorded as a launch phase (`Common::Trace::StartupProfile`).
+ *
+ * @param force_benchmark Re-run the benchmark even if a valid cached decision exists.
+ *        Setting the `CAPTUREMOMENT_FORCE_BENCHMARK` environment variable (non-zero) has the same effect.
+ * @param selection Whether a needed benchmark blocks the call.
+ *
+ * @note This function is thread-safe. A background benchmark still running at exit is waited for.
+ */
+void initialize(bool force_benchmark = false, BackendSelection selection = BackendSelection::Blocking);
+
+/**
+ * @brief Applies the decision of a finished background benchmark, once.
+ *
+ * @details
+ * `AppConfig` is not synchronized, so call this where no processing runs (the engine calls it
+ * before loading an image). Images already loaded keep their backend.
+ *
+ * @return true if a decision was applied.
+ */
+bool applyBackgroundBackendDecision();
+
+/**
+ * @brief Applies the performance profile file again, without waiting for its change to be noticed.
+ *
+ * @details
+ * Call after `initialize()`. The profile is also reloaded on its own within
+ * `Config::PerformanceProfileWatcher::k_default_poll_interval` of a change.
  *
- * @note This function is thread-safe.
+ * @return true if the profile was read and applied, false if none is set or the file is rejected
+ *         (the settings are then unchanged).
  */
-void initialize();
+bool reloadPerformanceProfile();
 
 /*
  * @brief Sets the log level for the Core library.
@@ -19,15 +19,27 @@
 #include "managers/source_manager.h"
 #include "managers/state_image_manager.h"
 #include "operations/operation_descriptor.h"
+#include "operations/parameter_snapshot.h"
 #include "common/image_region.h"
+#include "common/image_view.h"
+#include "common/display_image.h"
+#include "common/cancellation_token.h"
 #include "common/error_handling/core_error.h"
+#include "common/types/image_orientation.h"
 #include "common/types/image_types.h"
+#include "common/types/region_of_interest.h"
+#include "common/types/processing_outcome.h"
 
+#include <filesystem>
 #include <memory>
+#include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 #include <expected>
+#include <functional>
 #include <future>
+#include <optional>
 
 namespace CaptureMoment::Core {
 
@@ -40,6 +52,11 @@ namespace Engine {
  * This class manages the dependencies between the SourceManager (file I/O) and
  * the StateImageManager (processing pipeline). It provides a simplified interface
  * for loading images, applying adjustments, and retrieving the processed result.
+ *
+ * Several engines may run in one process, each on its own image. They share only
+ * thread-safe resources: the configuration (`AppConfig`), the backend registries, the
+ * source tile cache, the memory budget and, if given one, the engine scheduler. Compiled
+ * pipelines stay per engine: they are bound to the input parameters of their executor.
  */
 class PhotoEngine
 {
@@ -51,8 +68,11 @@ public:
      * @brief Constructs a PhotoEngine instance.
      *
      * Initializes internal managers and the operation factory.
+     *
+     * @param scheduler Pool shared with the other engines of the process (e.g. a render
+     *        service processing several images at once), or nullptr for a private one.
      */
-    PhotoEngine();
+    explicit PhotoEngine(std::shared_ptr<Workers::EngineScheduler> scheduler = nullptr);
 
     /**
      * @brief Loads an image file and initializes the processing pipeline.
@@ -65,11 +85,133 @@ public:
      * The call blocks until the initial processing is complete to ensure a valid
      * image is available immediately after the function returns.
      *
+     * An original that is offline (or on slow storage, per `AppConfig::getSmartPreviewPolicy`)
+     * is edited through its smart preview (`isPreviewImage()`); `requestFullQualityImage()`
+     * renders from the original again, before export.
+     *
      * @param path Path to the image file.
      * @return `std::expected<void, CoreError>` indicating success or the specific error type.
      */
     [[nodiscard]] std::expected<void, ErrorHandling::CoreError> loadImage(std::string_view path);
 
+    /**
+     * @brief Creates a virtual copy: a second engine on the loaded image, with its own edits.
+     *
+     * @details
+     * The copy shares the immutable decoded source and the resident original with this engine
+     * (see `StateImageManager::shareSourceOf`), and its scheduler. Operations, proxy, result
+     * cache and working image are its own, so N copies of one photo hold one source plus N
+     * working images. The copy is reset to the original before it is returned.
+     *
+     * @return The copy, or CoreError on failure (SourceNotLoaded if no image is loaded).
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<PhotoEngine>, ErrorHandling::CoreError> createVirtualCopy() const;
+
+    /**
+     * @brief Decodes files in the background so that loading them later is instant.
+     *
+     * Meant for the neighbours of the current photo (e.g. next and previous in a filmstrip).
+     * Does not block; a later call drops the prefetches not started yet.
+     *
+     * @param paths The files to prefetch, most wanted first.
+     */
+    void prefetchImages(std::span<const std::string> paths);
+
+    /**
+     * @brief Compiles the pipeline of an image's operations in the background.
+     *
+     * Meant for the image being opened, as soon as its sidecar is parsed: the compilation runs
+     * alongside the decode, so that the first edit does not wait for it. Does not block.
+     *
+     * @param operations The operations the image will be rendered with.
+     */
+    void warmUpPipeline(std::vector<Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Reads the dimensions, orientation, capture date, camera and lens of files from
+     *        their headers, without decoding any pixel (catalog import and indexing).
+     *
+     * Blocks until every file is read; the files are read concurrently.
+     *
+     * @param paths The files to read.
+     * @param token Once cancelled, the files not read yet report `LoadCancelled`.
+     * @return One metadata (or error) per path, in the order of `paths`.
+     */
+    [[nodiscard]] std::vector<std::expected<Managers::ImageMetadata, ErrorHandling::CoreError>>
+    readImageMetadata(std::span<const std::string> paths, const Common::CancellationToken& token = {}) const;
+
+    /**
+     * @brief Gets the hit/miss counters and memory use of the source tile cache.
+     *
+     * Huge standard images are tile-backed: their tiles are read from the file on demand
+     * (see `AppConfig::setTiledSourceMinPixels` and `AppConfig::setSourceTileCacheSizeMB`).
+     *
+     * @return The counters, or zeros if the engine is not initialized.
+     */
+    [[nodiscard]] Managers::SourceTileCacheStats getSourceTileCacheStats() const;
+
+    /**
+     * @brief Debug API: writes the fused pipeline that ran last to a diagnostics folder.
+     *
+     * For slowness reports: a `pipeline-<time>` subfolder receives the lowered statement of the
+     * chain (text and HTML), its schedule, its target, and the bounds of the last realization,
+     * everything needed to reproduce a scheduling problem on another machine. Blocks the
+     * processing while the chain is lowered (about a compilation's time).
+     *
+     * @param directory Diagnostics folder, created if needed.
+     * @return The subfolder written, or the error (`IOError` if it cannot be written).
+     */
+    [[nodiscard]] std::expected<std::filesystem::path, ErrorHandling::CoreError>
+    dumpPipelineDiagnostics(const std::filesystem::path& directory) const;
+
+    /**
+     * @brief Sets the callback notified when the full-quality image of a loaded preview is ready.
+     *
+     * RAW files may load their embedded preview first (`AppConfig::getRawLoadMode`). The callback
+     * runs on a loader thread: it should only forward the path to the thread that calls
+     * `adoptRefinedImage`.
+     *
+     * @param callback The callback, or an empty function to stop notifications.
+     */
+    void setImageRefinedCallback(std::function<void(std::string_view path)> callback);
+
+    /**
+     * @brief Swaps the full-quality image in for its preview and resets the working image.
+     *
+     * Blocks until the reset pass completes. The caller re-applies its operations afterwards.
+     *
+     * @param path Path notified by the refined callback.
+     * @return true if swapped in, false if there was nothing to swap (another image was loaded
+     *         since), or CoreError on failure.
+     */
+    [[nodiscard]] std::expected<bool, ErrorHandling::CoreError> adoptRefinedImage(std::string_view path);
+
+    /**
+     * @brief true while the loaded image is a preview awaiting its full-quality decode.
+     */
+    [[nodiscard]] bool isPreviewImage() const;
+
+    /**
+     * @brief Requests the full-quality image of a loaded preview.
+     *
+     * RAW files loaded as a draft keep it until pixel-level detail is needed: call this on
+     * zoom to 100% and before export. Does not block; the refined callback follows.
+     */
+    void requestFullQualityImage();
+
+    /**
+     * @brief Develops the loaded RAW image again with other RAW settings and resets the working image.
+     *
+     * Only the development runs again: the file is neither re-read nor, with the Halide
+     * demosaic engine, decompressed. Blocks until the reset pass completes. The caller
+     * re-applies its operations afterwards.
+     *
+     * @param settings The development settings (highlight mode, demosaic, noise reduction, half size).
+     * @return void, or CoreError on failure (`UnsupportedFormat` if the image is not a RAW file).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    redevelopRawImage(const ImageConfig::Raw::RawSettings& settings);
+
     /**
      * @brief Commits the processed working image back to the source manager.
      *
@@ -110,6 +252,16 @@ public:
      */
     [[nodiscard]] Common::ImageChan channels() const noexcept;
 
+    /**
+     * @brief Gets the EXIF orientation of the loaded image.
+     *
+     * The pixels handed out (display images, tiles, results) are in the stored frame:
+     * the display turns them with this orientation, the exports turn their output.
+     *
+     * @return The orientation, `Normal` if no image is loaded.
+     */
+    [[nodiscard]] Common::ImageOrientation orientation() const noexcept;
+
     /**
      * @brief Applies a cumulative list of operations.
      *
@@ -121,10 +273,154 @@ public:
      * the result when ready.
      *
      * @param ops Vector of OperationDescriptors defining the adjustments.
-     * @return std::future<bool> Caller must call .get() to wait for completion and to allow
-     *         the internal working image and update flag to be updated; otherwise the result is never applied.
+     * A newer call supersedes this one: the running pass is aborted early and the future
+     * settles as `ProcessingOutcome::Superseded`.
+     *
+     * @param ops Vector of OperationDescriptors defining the adjustments.
+     * @return Future settling with the outcome of the request (completed, superseded, cancelled or failed).
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperations(std::vector<Operations::OperationDescriptor>&& ops);
+
+    /**
+     * @brief Applies a cumulative list of operations over a region of interest only.
+     *
+     * Interactive variant of `applyOperations`: only the pixels of `roi` (e.g. the
+     * viewport rectangle, in full-resolution coordinates) are recomputed, so latency
+     * scales with screen pixels rather than sensor pixels. Pixels outside the region
+     * are left untouched until the next full `applyOperations` call.
+     *
+     * @param ops Vector of OperationDescriptors defining the adjustments.
+     * @param roi Region to compute.
+     * @return Future settling with the outcome of the request.
      */
-    [[nodiscard]] std::future<bool> applyOperations(std::vector<Operations::OperationDescriptor>&& ops);
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperations(std::vector<Operations::OperationDescriptor>&& ops,
+                                                                         const Common::RegionOfInterest& roi);
+
+    /**
+     * @brief Prepares a preview-resolution proxy of the loaded image.
+     *
+     * Typically called once after loading, with the display downsample size.
+     *
+     * @param width Proxy width in pixels.
+     * @param height Proxy height in pixels.
+     * @return `std::expected<void, CoreError>` indicating success or failure.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> prepareProxy(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Predicts the processing time of a chain on an image, before running it.
+     *
+     * Sums the nominal costs of the operations (`Operations::chainCost`) and converts them with
+     * the cost model calibrated by the startup benchmark, on the backend the engine would pick
+     * for that size and chain. Lets a preview pick its proxy resolution up front, instead of
+     * after a few slow frames.
+     *
+     * @param ops The chain.
+     * @param width Width of the processed image (the proxy's, for a preview).
+     * @param height Height of the processed image.
+     * @return Milliseconds, or `std::nullopt` before the benchmark has run.
+     */
+    [[nodiscard]] std::optional<double> estimateRenderMilliseconds(std::span<const Operations::OperationDescriptor> ops,
+                                                                   Common::ImageDim width, Common::ImageDim height) const;
+
+    /**
+     * @brief Applies a cumulative list of operations to the preview proxy only.
+     *
+     * Used while the user is dragging a control: processing costs only the proxy
+     * pixels. Follow up with `applyOperations` once input goes idle to refresh
+     * the full-resolution image.
+     *
+     * @param ops Vector of OperationDescriptors defining the adjustments.
+     * @return Future settling with the outcome of the request.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperationsToProxy(std::vector<Operations::OperationDescriptor>&& ops);
+
+    /**
+     * @brief Applies a cumulative list of operations progressively.
+     *
+     * Emits a low-resolution result immediately (preview proxy, if prepared), then the
+     * full-resolution image band by band, each band downsampled to the display size, so
+     * the viewport sharpens in place. A newer request stops the refinement between bands.
+     * See `Managers::ProgressiveRefinement` for the sinks and their threading.
+     *
+     * @param ops Vector of OperationDescriptors defining the adjustments.
+     * @param refinement Display size and sinks.
+     * @return Future settling with the outcome of the request (after the last tile when completed).
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperationsProgressive(std::vector<Operations::OperationDescriptor>&& ops,
+                                                                                    Managers::ProgressiveRefinement refinement);
+
+    /**
+     * @brief Renders the image under several parameter snapshots of one edit.
+     *
+     * For preset browsers and slider hover previews: each snapshot overrides the slider
+     * values of `ops`, and all variants are rendered in one task from the proxy (or the
+     * source), reduced to `max_long_edge`. The chain compiles once for all of them, and the
+     * working and display images are left untouched.
+     *
+     * @param ops Vector of OperationDescriptors the variants derive from.
+     * @param variants The parameter sets to render, in order.
+     * @param max_long_edge Longest edge of the rendered variants, in pixels.
+     * @param token Stops the render between variants once cancelled.
+     * @return Future settling with one linear RGBA_F32 image per variant, or the error.
+     */
+    [[nodiscard]] std::future<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>>
+    renderVariants(std::vector<Operations::OperationDescriptor>&& ops,
+                   std::vector<Operations::ParameterSnapshot> variants,
+                   Common::ImageDim max_long_edge,
+                   Common::CancellationToken token = {});
+
+    /**
+     * @brief Cancels the running and pending processing requests.
+     *
+     * Their futures settle as `ProcessingOutcome::Cancelled` (unless the running pass
+     * completed first). Non-blocking.
+     */
+    void cancelProcessing();
+
+    /**
+     * @brief Tells the engine a control of one operation is pressed: a drag, or a click.
+     *
+     * Until `endInteraction`, edits are processed on the preview proxy (if prepared), the
+     * expensive operations after the dragged one are deferred, and the compiled chain holds
+     * for the whole gesture. See `StateImageManager::beginInteraction`.
+     *
+     * @param operation_id Id of the descriptor of the pressed control.
+     */
+    void beginInteraction(std::uint64_t operation_id);
+
+    /**
+     * @brief Tells the engine the control was released; schedules the full-quality refine.
+     * @return Future of the full-resolution refine, or an invalid future if the gesture made no edit.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> endInteraction();
+
+    /**
+     * @brief Publishes the latest slider values (lock-free, allocation-free).
+     *
+     * Requests launched afterwards use these values for the matching descriptors, so UI ticks
+     * can publish and coalesce into the next run instead of queueing a descriptor list each.
+     * Only one thread (the UI thread) may publish.
+     *
+     * @param snapshot The values, by operation slot.
+     */
+    void publishParameters(const Operations::ParameterSnapshot& snapshot) noexcept;
+
+    /**
+     * @brief Sets the callback notified with the queueing and pipeline timestamps of every
+     *        request as it settles (latency measurements).
+     *
+     * The callback must be cheap and must not call back into the engine.
+     *
+     * @param callback The callback, or an empty function to stop notifications.
+     */
+    void setProcessingTimingsCallback(Managers::StateImageManager::TimingsCallback callback);
+
+    /**
+     * @brief Number of processing requests not settled yet (running pass and pending request).
+     * @return The depth, or 0 if the engine is not initialized.
+     */
+    [[nodiscard]] std::size_t getQueueDepth() const;
 
     /**
      * @brief Gets the working image as a CPU-based copy.
@@ -139,6 +435,16 @@ public:
      */
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> getWorkingImageAsRegion() const;
 
+    /**
+     * @brief Gets a read-only view over the working image in CPU memory.
+     *
+     * Same data as `getWorkingImageAsRegion`, without the deep copy: the view keeps the
+     * pixels alive on its own. Use it for read-only consumers (export, histograms, ...).
+     *
+     * @return `std::expected` containing the view, or an error code.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError> getWorkingImageView() const;
+
 
     /*
      * @brief Gets a downsampled version of the working image for display purposes.
@@ -153,6 +459,64 @@ public:
     */
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     getDownsampledDisplayImage(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Requests a display image of the given size from subsequent full-image passes.
+     *
+     * @details
+     * The adjustment pipeline then also encodes the viewport image (sRGB RGBA8)
+     * in the same pass. See `takeDisplayImage()`.
+     *
+     * @param width Display width in pixels.
+     * @param height Display height in pixels.
+     */
+    void setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Lets GPU passes keep their display image on the device (zero-copy display).
+     *
+     * @details
+     * Call with true once the display can sample native GPU buffers; display images taken
+     * afterwards may then carry a `Common::DisplayDeviceBuffer` and no host bytes.
+     * Only Metal targets are concerned. Thread-safe.
+     *
+     * @param enabled true if the display samples device buffers.
+     */
+    void setDisplayOnDevice(bool enabled);
+
+    /**
+     * @brief Attaches a live histogram to the display images of subsequent passes.
+     *
+     * @details
+     * The red, green, blue and luma histograms of the display image, with their extremes and
+     * clipping counts (`DisplayImage::m_histogram`), are reduced from the display output in the
+     * same realization: no extra pass over the image. Thread-safe.
+     *
+     * @param enabled true to compute histograms (off by default).
+     */
+    void setHistogramEnabled(bool enabled);
+
+    /**
+     * @brief Suggests Exposure, Contrast, Whites and Blacks values for the image ("Auto").
+     *
+     * @details
+     * Read off the histogram the pipeline reduced from the latest display image (proxy or
+     * full pass, see `setHistogramEnabled`): no pass runs. `ops` must be the operations that
+     * image was rendered with; the suggestion refines their tone values
+     * (`Operations::AutoTone::suggest`).
+     *
+     * @param ops The current operations.
+     * @return `ops` with the four adjustments set (appended if absent), or `SourceNotLoaded`
+     *         if no display image carried a histogram since the image was loaded.
+     */
+    [[nodiscard]] std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+    suggestAutoTone(std::vector<Operations::OperationDescriptor> ops) const;
+
+    /**
+     * @brief Hands over the display image produced by the last completed pass, if any.
+     * @return The display image, or `std::nullopt` (fall back to `getDownsampledDisplayImage()`).
+     */
+    [[nodiscard]] std::optional<Common::DisplayImage> takeDisplayImage();
 };
 
 } // namespace Engine
@@ -0,0 +1,408 @@
+/**
+ * @file batch_exporter.h
+ * @brief Declaration of BatchExporter (headless export of many edited files).
+ *
+ * @details
+ * An export runs each file through three stages, on their own threads, so that the stages of
+ * different files overlap:
+ * 1. **Decode** on the decode service of a dedicated `SourceManager` (full quality, `Export`
+ *    lane, several files at once).
+ * 2. **Process** the operations of the file on a working image. There is one processor per
+ *    backend: a GPU one when a GPU target is configured, and a CPU one. A file takes whichever
+ *    is free, so both run at once. With node pinning on a multi-socket host
+ *    (`AppConfig::setNumaPinning`), there is one CPU processor per memory node, and a file's
+ *    whole pipeline (working copy, Halide loops, result) runs on the node of its processor.
+ *    Likewise, a host with several CUDA GPUs gets one GPU processor per device
+ *    (`ImageProcessing::GpuDevices`), and files are sharded across them.
+ *    While every processor is busy, one more file is uploaded to the GPU ahead of its turn,
+ *    so that its transfer overlaps the current file's compute.
+ * 3. **Resize** to the requested long edge and **encode** through OIIO (JPEG or 16-bit TIFF in
+ *    sRGB, half-float EXR in linear Rec.709), on the encode pool. Files are written aside and
+ *    renamed: an interrupted export leaves no partial output.
+ *
+ * Renditions (`ExportSettings::m_renditions`, e.g. a web JPEG and a thumbnail next to a
+ * full-size TIFF) come from the same processing pass. The outputs of a file are made from the
+ * largest down, each one a filtered downsample of the previous one rather than of the full
+ * image, and each is encoded on its own encode task as soon as it is resized: the encodes of a
+ * file run in parallel.
+ *
+ * A file is admitted only once its estimated footprint across the three stages fits in the
+ * memory budget, and holds it until it is written: the number of files in flight adapts to
+ * their size.
+ *
+ * Tile-backed files (larger than `AppConfig::getTiledSourceMinPixels`) are never decoded whole:
+ * their full-size outputs stream through `StripExporter`, the resized ones are read at the size
+ * of the largest of them.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/types/image_orientation.h"
+#include "common/types/image_types.h"
+#include "common/types/memory_type.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "pipeline/operation_pipeline_executor.h"
+#include "utils/quantize.h"
+#include "workers/engine_scheduler.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+class SourceManager;
+}
+
+namespace Export {
+
+class StripExporter;
+
+/**
+ * @brief File format of the exported images.
+ */
+enum class ExportFormat : std::uint8_t {
+    Jpeg,   ///< 8-bit sRGB
+    Tiff,   ///< 16-bit sRGB
+    Exr     ///< Half-float linear Rec.709
+};
+
+/**
+ * @brief An extra output of every file, rendered from the same processing pass as the main one.
+ */
+struct ExportRendition {
+    /** @brief Appended to the stem of the main output (e.g. `_web`: `IMG_0001_web.jpg`). */
+    std::string m_suffix;
+
+    ExportFormat m_format{ExportFormat::Jpeg};
+
+    /** @brief JPEG quality (1-100). */
+    int m_jpeg_quality{92};
+
+    /** @brief Longest edge, in pixels (0: full size). Images are never upscaled. */
+    Common::ImageDim m_max_long_edge{0};
+};
+
+/**
+ * @brief Output settings shared by every file of an export.
+ */
+struct ExportSettings {
+    ExportFormat m_format{ExportFormat::Jpeg};
+
+    /** @brief JPEG quality (1-100). */
+    int m_jpeg_quality{92};
+
+    /** @brief Dither added before rounding to 8 bits (JPEG) or 16 bits (TIFF); EXR is never dithered. */
+    Utils::DitherMode m_dither{Utils::DitherMode::None};
+
+    /** @brief Longest edge of the outputs, in pixels (0: full size). Images are never upscaled. */
+    Common::ImageDim m_max_long_edge{0};
+
+    /** @brief Directory of the outputs (created if missing). */
+    std::filesystem::path m_output_directory;
+
+    /** @brief true to replace existing outputs; otherwise their files fail with `IOError`. */
+    bool m_overwrite{false};
+
+    /**
+     * @brief Outputs written next to the main one, in the output directory, with the dither of
+     *        the main one (`BatchExporter` only: a sequence export writes the main output).
+     */
+    std::vector<ExportRendition> m_renditions;
+};
+
+/**
+ * @brief One file to export and its operations (e.g. read from its XMP sidecar).
+ */
+struct ExportJob {
+    std::string m_source_path;
+    std::vector<Operations::OperationDescriptor> m_operations;
+};
+
+/**
+ * @brief Outcome of one file.
+ */
+struct ExportResult {
+    std::string m_source_path;
+    std::filesystem::path m_output_path;
+    /** @brief Outputs of the renditions, in the order of `ExportSettings::m_renditions`. */
+    std::vector<std::filesystem::path> m_rendition_paths;
+    /** @brief Success when every output was written; otherwise the first failure. */
+    std::expected<void, ErrorHandling::CoreError> m_status;
+};
+
+/**
+ * @class BatchExporter
+ * @brief Decodes, processes and encodes many files, stages overlapping, within a memory budget.
+ */
+class BatchExporter {
+public:
+    /**
+     * @brief Receives the outcome of each file as soon as it is known (one call at a time, in
+     *        completion order, on an export thread).
+     */
+    using ProgressCallback = std::function<void(std::size_t index, const ExportResult& result)>;
+
+    /**
+     * @brief Default budget: about four 24 MP files in flight.
+     */
+    static constexpr std::size_t k_default_memory_budget_bytes = std::size_t{4096} << 20;
+
+    /**
+     * @brief Creates the exporter, its processors and pools.
+     * @param memory_budget_bytes Estimated bytes the files in flight may use together.
+     * @param encode_threads Number of files resized and encoded at once (0: half the hardware threads).
+     */
+    explicit BatchExporter(std::size_t memory_budget_bytes = k_default_memory_budget_bytes,
+                           std::size_t encode_threads = 0);
+
+    /**
+     * @brief Waits for the stages still running.
+     */
+    ~BatchExporter();
+
+    BatchExporter(const BatchExporter&) = delete;
+    BatchExporter& operator=(const BatchExporter&) = delete;
+
+    /**
+     * @brief Exports files and waits for all of them.
+     *
+     * The call blocks while admitting the files (memory budget), then until the last one is
+     * written. A cancelled token stops admitting files and drops the admitted ones at their next
+     * stage: their result is `LoadCancelled`.
+     *
+     * @param jobs The files and their operations.
+     * @param settings Output settings.
+     * @param on_progress Receives each outcome (optional).
+     * @param token Cancels the export.
+     * @return One outcome per job, in the order of `jobs`.
+     */
+    [[nodiscard]] std::vector<ExportResult> run(std::span<const ExportJob> jobs, const ExportSettings& settings,
+                                                const ProgressCallback& on_progress = {},
+                                                const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Renders one file to memory, on the calling thread: decode, process, resize.
+     *
+     * @details The decode goes through the decoded-image cache of the exporter and the
+     * processing through its processors, so a long-lived exporter (`RenderServer`)
+     * keeps both warm across calls. Calls from several threads share the processors like the
+     * files of `run`. Tile-backed files are read at `max_long_edge` (`UnsupportedFormat` at full size).
+     *
+     * @param job The file and its operations.
+     * @param max_long_edge Longest edge of the result (0: full size); never upscaled.
+     * @param token Cancels the render (`LoadCancelled`).
+     * @return The linear RGBA_F32 result, upright, or the error of the stage that failed.
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    render(const ExportJob& job, Common::ImageDim max_long_edge, const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Renders pixels already in memory (linear RGBA_F32), on the calling thread: process, resize.
+     * @see render
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    renderImage(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> operations,
+                Common::ImageDim max_long_edge, const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Output file of a source (its stem, the extension of the format) in the output directory.
+     */
+    [[nodiscard]] static std::filesystem::path outputPathFor(std::string_view source_path, const ExportSettings& settings);
+
+    /**
+     * @brief Output file of a rendition: the main output's stem, the rendition's suffix and extension.
+     */
+    [[nodiscard]] static std::filesystem::path renditionPathFor(const std::filesystem::path& output_path,
+                                                                const ExportRendition& rendition);
+
+    /**
+     * @brief Settings of a rendition: those of the export, with the rendition's format, quality and size.
+     */
+    [[nodiscard]] static ExportSettings renditionSettings(const ExportSettings& settings, const ExportRendition& rendition);
+
+    /**
+     * @brief Extension of a format, with its dot.
+     */
+    [[nodiscard]] static std::string_view extension(ExportFormat format) noexcept;
+
+    /**
+     * @brief Stage 3: resizes (never up) and encodes a processed image to a file, written aside and renamed.
+     * @details Also the encode stage of `SequenceExporter`.
+     * @param orientation EXIF orientation of the source: the image is turned upright (see `write`).
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError>
+    encode(Common::ImageRegion& image, const std::filesystem::path& output_path, const ExportSettings& settings,
+           Common::ImageOrientation orientation = Common::ImageOrientation::Normal);
+
+    /**
+     * @brief Downsamples an image to a long edge (filtered).
+     * @return The smaller image; nullptr when the image already fits (never upscaled); or `AllocationFailed`.
+     */
+    [[nodiscard]] static std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    fitLongEdge(const Common::ImageRegion& image, Common::ImageDim max_long_edge);
+
+    /**
+     * @brief Encodes an image as it is to a file, written aside and renamed.
+     * @details Processed images are in the stored frame of their source: an `orientation` other
+     *          than `Normal` turns them upright first, at the output size (the only pass that
+     *          rotates the pixels of an image).
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError>
+    write(const Common::ImageRegion& image, const std::filesystem::path& output_path, const ExportSettings& settings,
+          Common::ImageOrientation orientation = Common::ImageOrientation::Normal);
+
+    /**
+     * @brief Number of processors (1 on the CPU, or one per memory node with node pinning, plus 1
+     *        when a GPU target is configured).
+     */
+    [[nodiscard]] std::size_t processorCount() const noexcept { return m_processors.size(); }
+
+private:
+    /**
+     * @brief An executor bound to one backend; runs one file at a time.
+     */
+    struct Processor {
+        Common::MemoryType m_backend{Common::MemoryType::CPU_RAM};
+        /** @brief Memory node the files of this processor run on (unset: anywhere). */
+        std::optional<std::size_t> m_node;
+        /** @brief GPU the files of this processor run on (`ImageProcessing::GpuDevices`; unset: the default one). */
+        std::optional<std::size_t> m_gpu_device;
+        std::unique_ptr<Pipeline::OperationPipelineExecutor> m_executor;
+        std::mutex m_mutex;
+    };
+
+    /**
+     * @brief State of one `run()`, shared by its stages.
+     */
+    struct Batch;
+
+    /**
+     * @brief Stage 1 done: hands the decoded pixels over to a processor.
+     * @param camera_profile Profile of a camera-native RAW decode (`Operations::CameraProfile`).
+     * @param first_output First output (largest first) made from these pixels; the larger ones
+     *        are written otherwise (tile-backed files).
+     */
+    void onDecoded(const std::shared_ptr<Batch>& batch, std::size_t index,
+                   std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> decoded,
+                   std::optional<std::string> camera_profile = std::nullopt, std::size_t first_output = 0);
+
+    /**
+     * @brief `render` in the stored frame of the source.
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    renderStored(const ExportJob& job, Common::ImageDim max_long_edge, const Common::CancellationToken& token);
+
+    /**
+     * @brief Stage 2: applies the operations of a file on the first free processor.
+     * @details If none is free, a GPU file is uploaded before waiting for the GPU processor.
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    process(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> operations,
+            const Common::CancellationToken& token);
+
+    /**
+     * @brief Stage 3: makes the outputs of a processed file from `first_output` down, each
+     *        resized from the previous one and encoded on its own task.
+     */
+    void encodeOutputs(const std::shared_ptr<Batch>& batch, std::size_t index, std::unique_ptr<Common::ImageRegion> image,
+                       std::size_t first_output);
+
+    /**
+     * @brief EXIF orientation of a source file, read from its header (`Normal` if unreadable).
+     */
+    [[nodiscard]] Common::ImageOrientation sourceOrientation(std::string_view path) const;
+
+    /**
+     * @brief Records the outcome of outputs of a file; the last one completes the file and gives its budget back.
+     * @param outputs Outputs concluded by `status` (default: all those left).
+     */
+    void finish(const std::shared_ptr<Batch>& batch, std::size_t index, std::expected<void, ErrorHandling::CoreError> status,
+                std::size_t outputs = std::numeric_limits<std::size_t>::max());
+
+    /**
+     * @brief Blocks until `bytes` fit in the budget (or no file is in flight), then takes them.
+     * @return The bytes taken (clamped to the budget), to give back to `releaseBudget`.
+     */
+    [[nodiscard]] std::size_t acquireBudget(std::size_t bytes);
+
+    /**
+     * @brief Gives bytes back to the budget.
+     */
+    void releaseBudget(std::size_t bytes);
+
+    /**
+     * @brief Decodes the files (its decode service runs several at once).
+     */
+    std::unique_ptr<Managers::SourceManager> m_source;
+
+    /**
+     * @brief Creates the operations of the edits.
+     */
+    std::unique_ptr<Operations::OperationFactory> m_operation_factory;
+
+    /**
+     * @brief One per backend (per node for the CPU with node pinning), GPU first.
+     */
+    std::vector<std::unique_ptr<Processor>> m_processors;
+
+    std::size_t m_memory_budget_bytes;
+
+    /**
+     * @brief Guards `m_in_flight_bytes`.
+     */
+    std::mutex m_budget_mutex;
+
+    /**
+     * @brief Signalled when budget is given back.
+     */
+    std::condition_variable m_budget_released;
+
+    /**
+     * @brief Estimated bytes of the files in flight.
+     */
+    std::size_t m_in_flight_bytes{0};
+
+    /**
+     * @brief Exports the tile-backed files at full size, one at a time (on the encode pool).
+     */
+    std::unique_ptr<StripExporter> m_strip_exporter;
+
+    /**
+     * @brief Serializes the streaming exports.
+     */
+    std::mutex m_strip_mutex;
+
+    /**
+     * @brief Encode pool. Declared after what its tasks use: joined before it goes away.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_encode_pool;
+
+    /**
+     * @brief Processing pool, one thread per processor. Declared last: joined first.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_process_pool;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
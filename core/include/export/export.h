@@ -0,0 +1,68 @@
+/**
+ * @file export.h
+ * @brief Umbrella header for the Export module.
+ *
+ * @details
+ * This module writes edited images to files without a UI:
+ * - **Batch**: `BatchExporter` decodes, processes and encodes many files, stages overlapping,
+ *   within a memory budget (JPEG, TIFF or EXR through OIIO).
+ * - **Streaming**: `StripExporter` processes and writes images larger than memory in
+ *   horizontal strips; `OutputWriter` encodes rows as they come.
+ * - **Sequence**: `SequenceExporter` exports time-lapse frames with one keyframed edit stack,
+ *   the pipeline compiled once, with optional deflicker.
+ * - **Render farm**: `RenderFarmQueue` shares per-image export jobs between hosts through a
+ *   directory; `RenderFarmWorker` renders them on each node with a warm `BatchExporter`.
+ * - **Render server**: `RenderServer` keeps the engine warm in a long-running process and
+ *   renders the requests of local clients (`RenderClient`), the pixels passed in shared memory
+ *   (`RenderChannel`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+/**
+ * @brief Headless export of many edited files.
+ */
+#include "export/batch_exporter.h"
+
+/**
+ * @brief Row-by-row encoding of the outputs.
+ */
+#include "export/output_writer.h"
+
+/**
+ * @brief Export jobs shared by many hosts through a directory.
+ */
+#include "export/render_farm_queue.h"
+
+/**
+ * @brief A render-farm node: claims jobs and exports them.
+ */
+#include "export/render_farm_worker.h"
+
+/**
+ * @brief Messages between a render server and its clients, pixels in shared memory.
+ */
+#include "export/render_channel.h"
+
+/**
+ * @brief Renders through a running render server.
+ */
+#include "export/render_client.h"
+
+/**
+ * @brief A long-running render process serving local clients.
+ */
+#include "export/render_server.h"
+
+/**
+ * @brief Time-lapse export with keyframed edits and deflicker.
+ */
+#include "export/sequence_exporter.h"
+
+/**
+ * @brief Strip-based export of images larger than memory.
+ */
+#include "export/strip_exporter.h"
@@ -0,0 +1,104 @@
+/**
+ * @file output_writer.h
+ * @brief Declaration of OutputWriter (encodes exported pixels to a file, rows at a time).
+ *
+ * @details
+ * Shared by the whole-image export (`BatchExporter`) and the streaming one (`StripExporter`):
+ * rows arrive as linear RGBA_F32 and are written with `ImageOutput::write_scanlines`, so the
+ * file never needs to be held whole. JPEG and TIFF rows are sRGB-encoded and quantized by
+ * `Utils::quantizeRowsU8`/`quantizeRowsU16` straight into the scanline buffer, in the type of
+ * the file (no float conversion left to the encoder); EXR rows stay scene-linear floats. The file is written aside (`.part`) and renamed by `commit`: an interrupted
+ * export leaves no partial output.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/types/image_orientation.h"
+#include "common/types/image_types.h"
+#include "export/batch_exporter.h"
+
+#include <OpenImageIO/imageio.h>
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @class OutputWriter
+ * @brief Writes an export top to bottom, in bands of rows.
+ *
+ * @details Not thread-safe: one writer per file, rows written in order.
+ */
+class OutputWriter {
+public:
+    OutputWriter() = default;
+
+    /**
+     * @brief Removes the partial file of an export that was not committed.
+     */
+    ~OutputWriter();
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    /**
+     * @brief Creates the partial file (RGB, in the type of the format).
+     * @param output_path Final path, installed by `commit`.
+     * @param width Width of the output, in pixels.
+     * @param height Height of the output, in pixels.
+     * @param settings Format, JPEG quality and dither.
+     * @param orientation EXIF orientation recorded in the file, for rows written in the stored
+     *                    frame (a streamed export cannot turn its rows); `Normal` for upright rows.
+     * @return void, `UnsupportedFormat` without a writer for the format, or `IOError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    open(const std::filesystem::path& output_path, Common::ImageDim width, Common::ImageDim height,
+         const ExportSettings& settings, Common::ImageOrientation orientation = Common::ImageOrientation::Normal);
+
+    /**
+     * @brief Writes the next rows.
+     * @param y First row, the row following the previous call.
+     * @param rows Number of rows.
+     * @param rgba `width * rows` linear RGBA_F32 pixels (the alpha is dropped).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    writeRows(Common::ImageDim y, Common::ImageDim rows, const float* rgba);
+
+    /**
+     * @brief Closes the file and renames it to its final path.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> commit();
+
+private:
+    /**
+     * @brief Closes and deletes the partial file.
+     */
+    void discard() noexcept;
+
+    std::unique_ptr<OIIO::ImageOutput> m_output;
+    std::filesystem::path m_output_path;
+    std::filesystem::path m_partial_path;
+    Common::ImageDim m_width{0};
+    ExportFormat m_format{ExportFormat::Jpeg};
+    Utils::DitherMode m_dither{Utils::DitherMode::None};
+
+    /**
+     * @brief Quantized RGB rows of the last call (JPEG in `m_rows_u8`, TIFF in `m_rows_u16`).
+     */
+    std::vector<std::uint8_t> m_rows_u8;
+    std::vector<std::uint16_t> m_rows_u16;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,207 @@
+/**
+ * @file render_channel.h
+ * @brief Declaration of RenderChannel (the messages between a render server and its clients).
+ *
+ * @details
+ * A render server (`RenderServer`) is a long-running process that keeps the engine warm: the
+ * Halide pipelines it compiled, the backend decision, the decoded-image cache. Its clients (a
+ * web backend, a script) talk to it over a local Unix socket, one request at a time per
+ * connection.
+ *
+ * Messages are small: a header (magic, payload size) and a CBOR payload with the request
+ * fields (source path, edit stack in the binary edit layout, output size and pixel format) or
+ * the reply (status, image size and format). Pixels never go through the socket: they are in a
+ * `Common::SharedMemory` region whose descriptor travels with the message (`SCM_RIGHTS`), and
+ * the receiver maps the very pages the sender wrote.
+ *
+ * POSIX only: on Windows, `connect` and `pair` fail with `Unexpected`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/memory/shared_memory.h"
+#include "common/types/image_types.h"
+#include "utils/quantize.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @brief Layout of the pixels of a shared image (always RGBA, rows packed).
+ */
+enum class RenderPixelFormat : std::uint8_t {
+    Srgb8,      ///< 8-bit sRGB, ready to encode or display
+    LinearF32   ///< 32-bit float linear Rec.709, as the engine computes it
+};
+
+/**
+ * @brief An image in shared memory, handed to or received from the other process.
+ */
+struct SharedImage {
+    Common::SharedMemory m_memory;
+    Common::ImageDim m_width{0};
+    Common::ImageDim m_height{0};
+    RenderPixelFormat m_format{RenderPixelFormat::Srgb8};
+
+    /**
+     * @brief Bytes of the pixels of an image.
+     */
+    [[nodiscard]] static std::size_t byteSize(Common::ImageDim width, Common::ImageDim height,
+                                              RenderPixelFormat format) noexcept
+    {
+        return static_cast<std::size_t>(width) * height * 4 * (format == RenderPixelFormat::Srgb8 ? 1 : sizeof(float));
+    }
+
+    /**
+     * @brief Copies linear RGBA_F32 pixels into a new shared region (the input of a request).
+     * @return The image, `InvalidImageRegion` unless the image is RGBA, or `AllocationFailed`.
+     */
+    [[nodiscard]] static std::expected<SharedImage, ErrorHandling::CoreError> share(const Common::ImageRegion& image);
+};
+
+/**
+ * @brief A render: a file or pixels, the edits to apply and the output wanted.
+ */
+struct RenderRequest {
+    /** @brief File read by the server (it must see the same path); ignored when `m_input` is set. */
+    std::string m_source_path;
+
+    /** @brief Pixels to render instead of a file (`LinearF32`). */
+    std::optional<SharedImage> m_input;
+
+    /** @brief Edit stack in the binary edit layout (`Serializer::encodeEditStack`); empty: no edits. */
+    std::string m_edit_blob;
+
+    /** @brief Longest edge of the result, in pixels (0: full size). Images are never upscaled. */
+    Common::ImageDim m_max_long_edge{0};
+
+    RenderPixelFormat m_format{RenderPixelFormat::Srgb8};
+
+    /** @brief Dither added before rounding to 8 bits. */
+    Utils::DitherMode m_dither{Utils::DitherMode::None};
+};
+
+/**
+ * @brief Outcome of a render: the image, or the error of the stage that failed.
+ */
+struct RenderReply {
+    std::expected<SharedImage, ErrorHandling::CoreError> m_image;
+};
+
+/**
+ * @class RenderChannel
+ * @brief Move-only end of a connection between a render server and a client.
+ */
+class RenderChannel {
+public:
+    /**
+     * @brief Largest payload accepted, in bytes (the edit stacks are far smaller).
+     */
+    static constexpr std::uint32_t k_max_payload_bytes { 16u << 20 };
+
+    /**
+     * @brief Connects to the socket of a render server.
+     * @return The channel, `FileNotFound` if no server listens there, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<RenderChannel, ErrorHandling::CoreError> connect(const std::filesystem::path& socket_path);
+
+    /**
+     * @brief Creates two connected ends (in-process use and tests).
+     */
+    [[nodiscard]] static std::expected<std::pair<RenderChannel, RenderChannel>, ErrorHandling::CoreError> pair();
+
+    /**
+     * @brief Takes ownership of a connected socket.
+     */
+    explicit RenderChannel(int descriptor) noexcept
+        : m_descriptor(descriptor)
+    {
+    }
+
+    /**
+     * @brief Closes the socket.
+     */
+    ~RenderChannel();
+
+    RenderChannel(RenderChannel&& other) noexcept;
+    RenderChannel& operator=(RenderChannel&& other) noexcept;
+
+    RenderChannel(const RenderChannel&) = delete;
+    RenderChannel& operator=(const RenderChannel&) = delete;
+
+    /**
+     * @brief Waits until a message (or the end of the connection) can be read.
+     * @return true if readable, false on timeout.
+     */
+    [[nodiscard]] bool waitReadable(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Sends a request, with the descriptor of its input if any.
+     * @return Success, or `IOError`.
+     */
+    std::expected<void, ErrorHandling::CoreError> send(const RenderRequest& request);
+
+    /**
+     * @brief Sends a reply, with the descriptor of its image if any.
+     * @return Success, or `IOError`.
+     */
+    std::expected<void, ErrorHandling::CoreError> send(const RenderReply& reply);
+
+    /**
+     * @brief Receives a request, its input mapped read-only.
+     * @return The request, `IOError` at the end of the connection, or `DecodingError` for a malformed message.
+     */
+    [[nodiscard]] std::expected<RenderRequest, ErrorHandling::CoreError> receiveRequest();
+
+    /**
+     * @brief Receives a reply, its image mapped read-only.
+     * @return The reply, `IOError` at the end of the connection, or `DecodingError` for a malformed message.
+     */
+    [[nodiscard]] std::expected<RenderReply, ErrorHandling::CoreError> receiveReply();
+
+private:
+    /**
+     * @brief A received payload and the descriptor that came with it (owned; -1 if none).
+     */
+    struct Message;
+
+    /**
+     * @brief Sends a header, a payload and optionally a descriptor.
+     */
+    std::expected<void, ErrorHandling::CoreError> sendMessage(const std::vector<std::uint8_t>& payload, int descriptor);
+
+    /**
+     * @brief Receives a header, its payload and the descriptor that came with it.
+     */
+    [[nodiscard]] std::expected<Message, ErrorHandling::CoreError> receiveMessage();
+
+    /**
+     * @brief Closes the socket, if any.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief The connected socket.
+     */
+    int m_descriptor{-1};
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
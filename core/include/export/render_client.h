@@ -0,0 +1,61 @@
+/**
+ * @file render_client.h
+ * @brief Declaration of RenderClient (renders through a running render server).
+ *
+ * @details
+ * A client renders with the warm engine of a `RenderServer` instead of starting one: it sends
+ * the request over the server's socket and maps the result the server wrote in shared memory.
+ * A client holds one connection and sends one request at a time: a process rendering from
+ * several threads opens a client per thread (the server serves the connections concurrently).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "export/render_channel.h"
+
+#include <expected>
+#include <filesystem>
+#include <utility>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @class RenderClient
+ * @brief A connection to a render server.
+ */
+class RenderClient {
+public:
+    /**
+     * @brief Connects to the server listening on a socket.
+     * @return The client, `FileNotFound` if no server listens there, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<RenderClient, ErrorHandling::CoreError> connect(const std::filesystem::path& socket_path);
+
+    /**
+     * @brief Renders a file or shared pixels and waits for the result.
+     * @return The result, mapped read-only, or the error of the server (or `IOError` if the
+     *         connection was lost).
+     */
+    [[nodiscard]] std::expected<SharedImage, ErrorHandling::CoreError> render(const RenderRequest& request);
+
+private:
+    explicit RenderClient(RenderChannel channel) noexcept
+        : m_channel(std::move(channel))
+    {
+    }
+
+    /**
+     * @brief The connection to the server.
+     */
+    RenderChannel m_channel;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,193 @@
+/**
+ * @file render_farm_queue.h
+ * @brief Declaration of RenderFarmQueue (export jobs shared by many hosts through a directory).
+ *
+ * @details
+ * A render farm splits an export over many hosts: a coordinator submits one job per image,
+ * workers on every node claim jobs, render them with a warm `BatchExporter`
+ * (`RenderFarmWorker`) and report the outcome. The queue is a directory on storage every node
+ * mounts (NFS, SMB), next to the sources and outputs, so the farm needs no server:
+ *
+ * | Directory    | Content                                                              |
+ * |--------------|----------------------------------------------------------------------|
+ * | `jobs/`      | Jobs waiting for a worker: `<id>.job`                                 |
+ * | `claimed/`   | Jobs being rendered, moved there by the worker that claimed them     |
+ * | `results/`   | One `<id>.result` per finished job (output path, worker, status)     |
+ * | `pipelines/` | The compiled-pipeline disk cache shared by the workers               |
+ *
+ * A job holds its source path, its edit stack in the binary edit layout
+ * (`Serializer::encodeEditStack`) and its output settings. A worker claims a job by renaming
+ * it from `jobs/` to `claimed/`: renames are atomic on one file system, NFS and SMB included,
+ * so exactly one worker gets each job. Files are written aside and renamed: no one reads a
+ * partial job or result.
+ *
+ * The coordinator also records what each job should cost: the size of its source (read from
+ * the header) and the nominal cost of its edit stack (`Operations::chainCost`). Workers claim
+ * by predicted rendering time rather than by count: a node gets a few heavy RAW files or many
+ * light JPEGs, and the batches of an export finish together across the farm.
+ *
+ * A worker that dies leaves its claimed jobs behind: `requeueStale` (called by the coordinator
+ * while it waits) puts back those claimed too long ago. A job requeued from a worker that was
+ * only slow may render twice; the first result stands.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "export/batch_exporter.h"
+#include "operations/operation_cost.h"
+
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @brief One image of a farm export, as stored in the queue.
+ */
+struct FarmJob {
+    /** @brief Unique id: the submission, then the index of the image in it. */
+    std::string m_id;
+    std::string m_source_path;
+    /** @brief Edit stack in the binary edit layout (`Serializer::encodeEditStack`). */
+    std::string m_edit_blob;
+    ExportSettings m_settings;
+    /** @brief Width of the source (0 if its header could not be read at submission). */
+    Common::ImageDim m_width{0};
+    /** @brief Height of the source (0 if its header could not be read at submission). */
+    Common::ImageDim m_height{0};
+    /** @brief Nominal cost of the edit stack, for the worker's cost model to calibrate. */
+    Operations::ChainCost m_cost;
+};
+
+/**
+ * @brief Outcome of one job, as reported by the worker that rendered it.
+ */
+struct FarmResult {
+    std::string m_id;
+    std::string m_source_path;
+    std::filesystem::path m_output_path;
+    /** @brief Id of the worker that rendered the job. */
+    std::string m_worker;
+    std::expected<void, ErrorHandling::CoreError> m_status;
+};
+
+/**
+ * @class RenderFarmQueue
+ * @brief Submits, claims and completes export jobs in a shared directory.
+ *
+ * @details Stateless beyond its directory: any number of processes, on any number of hosts,
+ * may use the same queue at once.
+ */
+class RenderFarmQueue {
+public:
+    /**
+     * @brief Receives each result as `wait` collects it.
+     */
+    using ResultCallback = std::function<void(std::size_t index, const FarmResult& result)>;
+
+    /**
+     * @brief Predicts the rendering time of a job on the claiming worker, in milliseconds.
+     */
+    using JobEstimator = std::function<double(const FarmJob& job)>;
+
+    /**
+     * @brief Age after which a claimed job without a result is given to another worker.
+     */
+    static constexpr std::chrono::minutes k_default_stale_after { 10 };
+
+    /**
+     * @brief Interval between two looks at the queue of an idle worker or a waiting coordinator.
+     */
+    static constexpr std::chrono::milliseconds k_poll_interval { 500 };
+
+    /**
+     * @brief Opens the queue in a directory (its subdirectories are created on first use).
+     */
+    explicit RenderFarmQueue(std::filesystem::path root);
+
+    /**
+     * @brief The directory of the queue.
+     */
+    [[nodiscard]] const std::filesystem::path& root() const noexcept { return m_root; }
+
+    /**
+     * @brief The compiled-pipeline disk cache of the farm (`AppConfig::setPipelineDiskCacheDirectory`).
+     */
+    [[nodiscard]] std::filesystem::path pipelineCacheDirectory() const;
+
+    /**
+     * @brief Coordinator: queues one job per file.
+     * @param jobs The files and their operations.
+     * @param settings Output settings of every file (the output directory must be reachable
+     *        from the workers, under the same path).
+     * @return The ids of the jobs, in the order of `jobs`, or `IOError`.
+     */
+    [[nodiscard]] std::expected<std::vector<std::string>, ErrorHandling::CoreError>
+    submit(std::span<const ExportJob> jobs, const ExportSettings& settings) const;
+
+    /**
+     * @brief Coordinator: waits for the results of jobs, putting back stale claims meanwhile.
+     * @param ids The jobs (as returned by `submit`).
+     * @param on_result Receives each result as it is collected (optional).
+     * @param token Stops waiting: the jobs not finished get `LoadCancelled` (they stay queued).
+     * @param stale_after Age of a claim after which its job is requeued.
+     * @return One result per id, in the order of `ids`.
+     */
+    [[nodiscard]] std::vector<FarmResult> wait(std::span<const std::string> ids, const ResultCallback& on_result = {},
+                                               const Common::CancellationToken& token = {},
+                                               std::chrono::seconds stale_after = k_default_stale_after) const;
+
+    /**
+     * @brief Worker: claims up to `max_jobs` jobs, or fewer once they add up to `max_milliseconds`.
+     * @param estimate Predicts each job's rendering time (none: claims by count only).
+     * @param max_milliseconds Predicted time of the batch; the job reaching it is the last one
+     *        claimed (0: no limit).
+     * @return The jobs now owned by the caller (empty when the queue is empty). Unreadable jobs
+     *         are completed as `DecodingError` and skipped.
+     */
+    [[nodiscard]] std::vector<FarmJob> claim(std::string_view worker, std::size_t max_jobs,
+                                             const JobEstimator& estimate = {}, double max_milliseconds = 0.0) const;
+
+    /**
+     * @brief Worker: records the outcome of a claimed job and releases the claim.
+     * @details A result already recorded (the job was requeued, then rendered twice) is kept.
+     * @return Success, or `IOError`.
+     */
+    std::expected<void, ErrorHandling::CoreError> complete(const FarmResult& result) const;
+
+    /**
+     * @brief The result of a job, if it finished.
+     */
+    [[nodiscard]] std::optional<FarmResult> result(std::string_view id) const;
+
+    /**
+     * @brief Puts back the jobs claimed more than `stale_after` ago and still without a result.
+     * @return The number of jobs requeued.
+     */
+    std::size_t requeueStale(std::chrono::seconds stale_after = k_default_stale_after) const;
+
+private:
+    /**
+     * @brief Directory of the queue.
+     */
+    std::filesystem::path m_root;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,111 @@
+/**
+ * @file render_farm_worker.h
+ * @brief Declaration of RenderFarmWorker (a render-farm node: claims jobs and exports them).
+ *
+ * @details
+ * A worker keeps one `BatchExporter` for its lifetime: its processors, pools and compiled
+ * pipelines stay warm from one batch of jobs to the next. It claims a few jobs per processor at
+ * a time, enough for the decode, process and encode stages of the exporter to overlap, few
+ * enough that the last jobs of an export spread over the nodes. With the cost model of its
+ * startup benchmark, it claims by predicted rendering time instead (`k_claim_milliseconds_per_processor`),
+ * each job estimated on the backend that renders it fastest on this node. No node waits on another, so
+ * throughput grows with the nodes until the shared storage saturates.
+ *
+ * The worker points the compiled-pipeline disk cache (`AppConfig::setPipelineDiskCacheDirectory`)
+ * at the farm's: the first node to meet an edit stack compiles it, the others load the library
+ * (nodes of the same CPU target and build only; the others compile their own entries).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "export/batch_exporter.h"
+#include "export/render_farm_queue.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @class RenderFarmWorker
+ * @brief Renders the jobs of a farm queue until stopped (or until it is empty).
+ */
+class RenderFarmWorker {
+public:
+    /**
+     * @brief Jobs claimed at a time, per processor of the exporter.
+     */
+    static constexpr std::size_t k_jobs_per_processor { 4 };
+
+    /**
+     * @brief Predicted rendering time claimed at a time, per processor of the exporter, in
+     *        milliseconds (still at most `k_jobs_per_processor` jobs per processor).
+     */
+    static constexpr double k_claim_milliseconds_per_processor { 20'000.0 };
+
+    /**
+     * @brief Receives each result as soon as it is recorded (on an export thread).
+     */
+    using ResultCallback = std::function<void(const FarmResult& result)>;
+
+    /**
+     * @brief Creates the worker and its exporter.
+     * @param queue The farm queue.
+     * @param worker_id Id reported in the results (e.g. the host name and process id).
+     * @param memory_budget_bytes Budget of the exporter (`BatchExporter`).
+     * @param encode_threads Encode threads of the exporter (0: half the hardware threads).
+     */
+    RenderFarmWorker(RenderFarmQueue queue, std::string worker_id,
+                     std::size_t memory_budget_bytes = BatchExporter::k_default_memory_budget_bytes,
+                     std::size_t encode_threads = 0);
+
+    /**
+     * @brief Renders jobs until `token` is cancelled, or the queue is empty if `exit_when_idle`.
+     * @param on_result Receives each result (optional).
+     * @param token Stops the worker after the current batch (its unfinished jobs are dropped
+     *        and requeued once stale).
+     * @param exit_when_idle true to return as soon as no job is left to claim.
+     * @return The number of jobs rendered, successfully or not.
+     */
+    std::size_t run(const ResultCallback& on_result = {}, const Common::CancellationToken& token = {},
+                    bool exit_when_idle = false);
+
+    /**
+     * @brief Id of the worker.
+     */
+    [[nodiscard]] const std::string& id() const noexcept { return m_worker_id; }
+
+private:
+    /**
+     * @brief Exports a batch of claimed jobs, one `BatchExporter::run` per output settings.
+     */
+    void renderBatch(std::vector<FarmJob> jobs, const ResultCallback& on_result, const Common::CancellationToken& token);
+
+    /**
+     * @brief The farm queue.
+     */
+    RenderFarmQueue m_queue;
+
+    /**
+     * @brief Id reported in the results.
+     */
+    std::string m_worker_id;
+
+    /**
+     * @brief The warm exporter, kept across batches.
+     */
+    std::unique_ptr<BatchExporter> m_exporter;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
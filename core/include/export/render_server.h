@@ -0,0 +1,113 @@
+/**
+ * @file render_server.h
+ * @brief Declaration of RenderServer (a long-running render process serving local clients).
+ *
+ * @details
+ * Launching the engine for each render pays its startup every time: the backend decision,
+ * OIIO and Exiv2 initialization, the Halide JIT of every pipeline. A render server pays it
+ * once: it listens on a Unix socket (`RenderChannel`) and renders each request with one warm
+ * `BatchExporter`, whose processors keep their compiled pipelines and whose decoded-image
+ * cache keeps the files rendered last.
+ *
+ * Each connection is served on its own thread, one request at a time; requests of different
+ * connections run concurrently, sharing the processors like the files of a batch export. The
+ * result goes back in shared memory, in the pixel format asked for.
+ *
+ * The socket is created owner-only (mode 0600): the clients are the processes of the user
+ * running the server. POSIX only: on Windows, `run` fails with `Unexpected`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "export/batch_exporter.h"
+#include "export/render_channel.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+
+namespace CaptureMoment::Core {
+
+namespace Export {
+
+/**
+ * @class RenderServer
+ * @brief Serves render requests on a Unix socket with a warm exporter.
+ */
+class RenderServer {
+public:
+    /**
+     * @brief Interval at which idle connections and the listener look at the stop token.
+     */
+    static constexpr std::chrono::milliseconds k_poll_interval { 200 };
+
+    /**
+     * @brief Creates the server and its exporter (the socket is opened by `run`).
+     * @param socket_path Path of the socket (a stale socket there is replaced).
+     * @param memory_budget_bytes Budget of the exporter (`BatchExporter`).
+     * @param encode_threads Encode threads of the exporter (0: half the hardware threads).
+     */
+    explicit RenderServer(std::filesystem::path socket_path,
+                          std::size_t memory_budget_bytes = BatchExporter::k_default_memory_budget_bytes,
+                          std::size_t encode_threads = 0);
+
+    ~RenderServer();
+
+    RenderServer(const RenderServer&) = delete;
+    RenderServer& operator=(const RenderServer&) = delete;
+
+    /**
+     * @brief Serves clients until `token` is cancelled, then closes the connections and removes the socket.
+     * @return Success once stopped, or `IOError` if the socket cannot be opened.
+     */
+    std::expected<void, ErrorHandling::CoreError> run(const Common::CancellationToken& token);
+
+    /**
+     * @brief Renders one request (what a connection does for each message).
+     * @return The result in the pixel format of the request, or the error of the stage that failed.
+     */
+    [[nodiscard]] RenderReply render(const RenderRequest& request, const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Path of the socket.
+     */
+    [[nodiscard]] const std::filesystem::path& socketPath() const noexcept { return m_socket_path; }
+
+    /**
+     * @brief Number of requests served so far.
+     */
+    [[nodiscard]] std::size_t requestCount() const noexcept { return m_requests.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @brief Serves the requests of one connection until it closes or `token` is cancelled.
+     */
+    void serve(RenderChannel channel, const Common::CancellationToken& token);
+
+    /**
+     * @brief Path of the socket.
+     */
+    std::filesystem::path m_socket_path;
+
+    /**
+     * @brief The warm exporter, shared by the connections.
+     */
+    std::unique_ptr<BatchExporter> m_exporter;
+
+    /**
+     * @brief Requests served.
+     */
+    std::atomic<std::size_t> m_requests{0};
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,212 @@
+/**
+ * @file sequence_exporter.h
+ * @brief Declaration of SequenceExporter (time-lapse export: one keyframed edit stack, many frames).
+ *
+ * @details
+ * A time-lapse applies one edit stack to thousands of frames, its values keyframed. Every frame
+ * has the same chain structure, so the pipeline is compiled once: the first frame initializes
+ * the executor, the others only rebind the parameter values (`updateRuntimeParams`).
+ *
+ * The frames stream through three stages, like `BatchExporter`'s:
+ * 1. **Decode** on the decode service (full quality, `Export` lane), in frame order.
+ * 2. **Process** on one executor: the values of the frame are interpolated between the
+ *    keyframes around it (`operationsAt`), plus the deflicker offset.
+ * 3. **Resize** and **encode** on the encode pool (`BatchExporter::encode`).
+ *
+ * At most `SequenceSettings::m_frames_in_flight` frames are between their decode and their
+ * write, whatever the length of the sequence: memory stays bounded, and the stages keep each
+ * other busy, so the throughput is the decode's or the encode's.
+ *
+ * **Deflicker**: before the export, the median log-luminance of each frame is read from its
+ * histogram (on the embedded preview or draft demosaic, `SourceManager::decodeThumbnail`). Each
+ * frame's exposure is then shifted by the difference between the median of its neighbours
+ * (a centered moving average of `m_deflicker_window` frames) and its own: the slow changes of a
+ * sunset stay, the frame-to-frame flicker goes. The offset is added to the stack's Exposure
+ * (one is put first in the chain if the stack has none).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "export/batch_exporter.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "pipeline/operation_pipeline_executor.h"
+#include "workers/engine_scheduler.h"
+
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+class SourceManager;
+}
+
+namespace Export {
+
+/**
+ * @brief The values of the edit stack at one frame.
+ */
+struct SequenceKeyframe {
+    /** @brief Index of the frame in the sequence. */
+    std::size_t m_frame { 0 };
+
+    /** @brief The edit stack; every keyframe has the same structure (ids, types, order, enabled). */
+    std::vector<Operations::OperationDescriptor> m_operations;
+};
+
+/**
+ * @brief Settings of a sequence export.
+ */
+struct SequenceSettings {
+    /** @brief Format, size and directory of the frames written. */
+    ExportSettings m_export;
+
+    /** @brief Frames between their decode and their write at once (at least 1). */
+    std::size_t m_frames_in_flight { 4 };
+
+    /** @brief true to even out the frame-to-frame exposure changes. */
+    bool m_deflicker { false };
+
+    /** @brief Frames averaged around each frame by the deflicker (odd; the edges average fewer). */
+    std::size_t m_deflicker_window { 15 };
+
+    /** @brief Long edge of the previews the deflicker reads the luminance of. */
+    Common::ImageDim m_deflicker_analysis_edge { 256 };
+};
+
+/**
+ * @class SequenceExporter
+ * @brief Exports a sequence of frames with one keyframed edit stack, the pipeline compiled once.
+ *
+ * @details Not thread-safe: one `run()` at a time per instance.
+ */
+class SequenceExporter {
+public:
+    /**
+     * @brief Receives the outcome of each frame (one call at a time, in completion order).
+     */
+    using ProgressCallback = BatchExporter::ProgressCallback;
+
+    /**
+     * @brief Creates the exporter, its executor and pools.
+     * @param encode_threads Number of frames resized and encoded at once (0: half the hardware threads).
+     */
+    explicit SequenceExporter(std::size_t encode_threads = 0);
+
+    /**
+     * @brief Waits for the stages still running.
+     */
+    ~SequenceExporter();
+
+    SequenceExporter(const SequenceExporter&) = delete;
+    SequenceExporter& operator=(const SequenceExporter&) = delete;
+
+    /**
+     * @brief Exports the frames and waits for all of them.
+     * @param frames The files, in sequence order.
+     * @param keyframes The keyframes (any order); frames before the first or after the last take its values.
+     * @param settings Output and deflicker settings.
+     * @param on_progress Receives each outcome (optional).
+     * @param token Cancels the export: the frames not written yet get `LoadCancelled`.
+     * @return One outcome per frame, in the order of `frames`. Every frame fails with
+     *         `CoreError::Unexpected` if there are no keyframes or their structures differ.
+     */
+    [[nodiscard]] std::vector<ExportResult> run(std::span<const std::string> frames,
+                                                std::span<const SequenceKeyframe> keyframes,
+                                                const SequenceSettings& settings,
+                                                const ProgressCallback& on_progress = {},
+                                                const Common::CancellationToken& token = {});
+
+    /**
+     * @brief The edit stack of a frame: the float values interpolated linearly between the
+     *        keyframes around it, the others held from the earlier one.
+     * @param keyframes The keyframes, sorted by frame (not empty, same structure).
+     */
+    [[nodiscard]] static std::vector<Operations::OperationDescriptor>
+    operationsAt(std::span<const SequenceKeyframe> keyframes, std::size_t frame);
+
+    /**
+     * @brief Exposure offsets (stops) evening out a series of median log2 luminances.
+     * @param log_luminance Median log2 luminance of each frame (NaN: unknown, offset 0 and
+     *        left out of its neighbours' averages).
+     * @param window Frames averaged around each frame.
+     */
+    [[nodiscard]] static std::vector<float> deflickerOffsets(std::span<const float> log_luminance, std::size_t window);
+
+    /**
+     * @brief Median log2 luminance (Rec. 709) of a linear RGBA image, from a histogram of its pixels.
+     * @return The median, or NaN if the image has no lit pixel.
+     */
+    [[nodiscard]] static float medianLogLuminance(const Common::ImageRegion& image);
+
+private:
+    /**
+     * @brief State of one `run()`, shared by its stages.
+     */
+    struct Sequence;
+
+    /**
+     * @brief Reads the median log-luminance of every frame (on the encode pool, before the export).
+     */
+    [[nodiscard]] std::vector<float> analyzeFrames(std::span<const std::string> frames, const SequenceSettings& settings,
+                                                   const Common::CancellationToken& token);
+
+    /**
+     * @brief Stage 2: applies the frame's edits, then queues its encode.
+     */
+    void processFrame(const std::shared_ptr<Sequence>& sequence, std::size_t index,
+                      std::unique_ptr<Common::ImageRegion> image, std::optional<std::string> camera_profile);
+
+    /**
+     * @brief Records the outcome of a frame and frees its slot.
+     */
+    void finish(const std::shared_ptr<Sequence>& sequence, std::size_t index,
+                std::expected<void, ErrorHandling::CoreError> status);
+
+    /**
+     * @brief Decodes the frames.
+     */
+    std::unique_ptr<Managers::SourceManager> m_source;
+
+    /**
+     * @brief Creates the operations of the edits.
+     */
+    std::unique_ptr<Operations::OperationFactory> m_operation_factory;
+
+    /**
+     * @brief Runs every frame: initialized by the first, rebound by the others.
+     */
+    std::unique_ptr<Pipeline::OperationPipelineExecutor> m_executor;
+
+    /**
+     * @brief Serializes the frames on `m_executor`.
+     */
+    std::mutex m_executor_mutex;
+
+    /**
+     * @brief Encode pool (also runs the deflicker analysis). Declared after what its tasks use.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_encode_pool;
+
+    /**
+     * @brief Processing pool, one export thread. Declared last: joined first.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_process_pool;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
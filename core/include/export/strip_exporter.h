@@ -0,0 +1,136 @@
+/**
+ * @file strip_exporter.h
+ * @brief Declaration of StripExporter (streaming export of images larger than memory).
+ *
+ * @details
+ * A whole-image export holds the decoded frame, its working image and the encoded copy at
+ * once: gigapixel panoramas and stitched scans do not fit. The strip exporter never holds the
+ * frame. The file is opened tile-backed (`SourceManager::openStreaming`), then processed top to
+ * bottom in horizontal strips:
+ * 1. **Read** the strip through the tile cache as linear RGBA_F32, plus the halo rows the
+ *    spatial operations read above and below it (`IOperation::haloPixels`), from a row on the
+ *    grid of the blur pyramid (`GaussianBlur::k_alignment`): the exported rows then match a
+ *    whole-image pass exactly.
+ * 2. **Process** it with the fused pipeline (compiled once, reused by every strip).
+ * 3. **Write** its rows, halo cropped, with `ImageOutput::write_scanlines` (`OutputWriter`).
+ *
+ * Peak memory is a few strips (`k_default_strip_bytes` each) plus the tile cache capacity,
+ * whatever the image size. Outputs are written at full size: streaming exports do not resize.
+ * A crop is applied by the exporter (rows and columns of the rectangle), without its straighten
+ * angle: the rotated footprint of a strip would span most of the image. The lens correction is
+ * skipped for the same reason (and it is centered on the whole frame, not on a strip).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+#include "export/batch_exporter.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "pipeline/operation_pipeline_executor.h"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+class SourceManager;
+}
+
+namespace Export {
+
+/**
+ * @class StripExporter
+ * @brief Exports one file at a time in horizontal strips, within a bounded amount of memory.
+ *
+ * @details Not thread-safe: one export at a time per instance.
+ */
+class StripExporter {
+public:
+    /**
+     * @brief Default size of a strip (linear RGBA_F32 source pixels, halo excluded).
+     */
+    static constexpr std::size_t k_default_strip_bytes = std::size_t{64} << 20;
+
+    /**
+     * @brief Fewest rows per strip, however wide the image.
+     */
+    static constexpr Common::ImageDim k_min_strip_rows = 16;
+
+    /**
+     * @brief Creates the exporter and its executor.
+     * @param strip_bytes Size of a strip; the number of rows follows from the image width.
+     */
+    explicit StripExporter(std::size_t strip_bytes = k_default_strip_bytes);
+
+    ~StripExporter();
+
+    StripExporter(const StripExporter&) = delete;
+    StripExporter& operator=(const StripExporter&) = delete;
+
+    /**
+     * @brief Exports a file strip by strip.
+     * @param job The file and its operations.
+     * @param output_path The file to write (replaced if it exists).
+     * @param settings Output format; `m_max_long_edge` is ignored (full size).
+     * @param token Cancels the export between strips (the partial output is deleted).
+     * @return void, `UnsupportedFormat` for RAW files (demosaiced whole), `LoadCancelled`, or the
+     *         read, processing or write error.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    exportFile(const ExportJob& job, const std::filesystem::path& output_path, const ExportSettings& settings,
+               const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Rows a strip must read above and below it for these operations.
+     * @return The sum of the `IOperation::haloPixels` of the enabled operations (0 if all are per-pixel):
+     *         each spatial operation reads around the pixels the next one reads.
+     */
+    [[nodiscard]] static Common::ImageDim haloFor(std::span<const Operations::OperationDescriptor> operations,
+                                                  const Operations::OperationFactory& factory);
+
+    /**
+     * @brief Rows of a strip of an image of this width.
+     */
+    [[nodiscard]] Common::ImageDim stripRows(Common::ImageDim width, Common::ImageDim height) const noexcept;
+
+private:
+    /**
+     * @brief Processes and writes the strips of the opened file.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    streamStrips(const ExportJob& job, const std::filesystem::path& output_path, const ExportSettings& settings,
+                 const Common::CancellationToken& token);
+
+    std::size_t m_strip_bytes;
+
+    /**
+     * @brief Opens the files tile-backed.
+     */
+    std::unique_ptr<Managers::SourceManager> m_source;
+
+    /**
+     * @brief Creates the operations of the edits.
+     */
+    std::unique_ptr<Operations::OperationFactory> m_operation_factory;
+
+    /**
+     * @brief Runs the fused pipeline on each strip.
+     */
+    std::unique_ptr<Pipeline::OperationPipelineExecutor> m_executor;
+};
+
+} // namespace Export
+
+} // namespace CaptureMoment::Core
@@ -75,8 +75,9 @@ enum class AlphaMode : std::uint8_t {
  * - HEIF files from smartphones (iPhone, Android) are the most common use case.
  *
  * ## Default Configuration Rationale
- * - **reorient**: Enabled. HEIF files contain EXIF orientation metadata from smartphones.
- *                 Reorientation ensures correct display without manual rotation.
+ * - **reorient**: Disabled. HEIF files contain EXIF orientation metadata from smartphones;
+ *                 the pixels stay in their stored order and the orientation is carried as
+ *                 metadata (`ISourceManager::orientation`), applied by the display and the exports.
  * - **alpha_mode**: premultiply. Standard compositing convention, consistent with Core's
  *                    channel-agnostic F32 pipeline. Avoids special alpha handling in kernels.
  *
@@ -98,20 +99,21 @@ private:
     /**
      * @brief If nonzero, asks libheif to reorient images based on EXIF orientation.
      *
-     * When enabled (default), libheif rotates/flips the image pixels to match
+     * When enabled, libheif rotates/flips the image pixels to match
      * the orientation indicated by the camera, and sets the "Orientation"
      * metadata to 1 (meaning "no rotation needed"). The original orientation
      * is preserved in "oiio:OriginalOrientation" metadata.
      *
-     * When disabled, the pixels are left in their stored orientation and
-     * the "Orientation" metadata reflects the camera orientation.
+     * When disabled (default), the pixels are left in their stored orientation and
+     * the "Orientation" metadata reflects the camera orientation: the load saves a
+     * full-frame pass, and the display turns the image as a view transform.
      *
      * This is particularly important for HEIF files from smartphones, which
      * almost always store orientation metadata (portrait/landscape).
      *
      * @note Requires libheif >= 1.16.
      */
-    bool m_reorient{true};
+    bool m_reorient{false};
 
     /**
      * @brief Controls how unassociated alpha is handled during reading.
@@ -141,7 +143,7 @@ public:
 
     /**
      * @brief Enables or disables automatic reorientation.
-     * @param reorient true to reorient based on EXIF orientation (recommended).
+     * @param reorient true to reorient the pixels based on EXIF orientation.
      * @note Requires libheif >= 1.16.
      */
     constexpr void set_reorient(bool reorient) noexcept { m_reorient = reorient; }
@@ -189,7 +191,7 @@ public:
      * | alpha_mode    | premultiply     | Standard convention, no extra work      |
      *
      * @note Use for quick preview loading or when speed is critical.
-     * @warning Image may appear rotated incorrectly if reorient is disabled.
+     * @warning The "Orientation" metadata must then be applied by the caller.
      */
     [[nodiscard]] static constexpr HeicSettings fast_settings() noexcept {
         HeicSettings settings;
@@ -205,7 +207,7 @@ public:
      * ## Configuration Rationale
      * | Parameter     | Value           | Reason                                  |
      * |---------------|-----------------|-----------------------------------------|
-     * | reorient      | true            | Correct orientation from EXIF metadata  |
+     * | reorient      | false           | Orientation carried as metadata         |
      * | alpha_mode    | premultiply     | Consistent with channel-agnostic pipeline|
      *
      * @note This is the recommended configuration for all standard use cases.
@@ -12,6 +12,8 @@
 #pragma once
 #include <string>
 #include <array>
+#include <bit>
+#include <cstdint>
 #include <magic_enum/magic_enum.hpp>
 namespace CaptureMoment::Core::ImageConfig {
 
@@ -138,6 +140,40 @@ enum class WhiteBalanceMode : std::uint8_t {
     user_mul = 4    ///< Use user-specified custom white balance multipliers.
 };
 
+/**
+ * @enum RawLoadMode
+ * @brief What a RAW load shows first.
+ * A full demosaic takes seconds; most RAW files embed a camera-rendered JPEG that decodes
+ * in milliseconds and is good enough for display and culling.
+ */
+enum class RawLoadMode : std::uint8_t {
+    full_demosaic = 0,          ///< Demosaic before anything is shown.
+    embedded_preview_first = 1, ///< Show the embedded preview (else a draft), demosaic in the background and swap in.
+    draft_first = 2             ///< Show a draft demosaic; full quality only on demand (zoom to 100%, export) (default).
+};
+
+/**
+ * @enum RawQuality
+ * @brief Quality of a RAW demosaic.
+ * Selects the settings profile used by the source manager.
+ */
+enum class RawQuality : std::uint8_t {
+    draft = 0,  ///< Half size, PPG, no FBDD denoise (see RawSettings::draft_settings()). ~4x faster, 1/4 of the memory.
+    full = 1    ///< Full resolution, AMaZE, FBDD denoise. Reserved for pixel-level views and export.
+};
+
+/**
+ * @enum RawDemosaicEngine
+ * @brief Who demosaics RAW files.
+ * LibRaw demosaics the whole frame on one CPU core per file. The Halide engine reads the
+ * undemosaiced Bayer mosaic once, keeps it resident, and demosaics it on the CPU cores or the GPU:
+ * drafts are a 2x2 superpixel pass, full quality a Malvar-He-Cutler pass.
+ */
+enum class RawDemosaicEngine : std::uint8_t {
+    libraw = 0, ///< OIIO/LibRaw with the `RawSettings` of the quality (default).
+    halide = 1  ///< Halide demosaic of the resident mosaic; X-Trans and unreadable mosaics fall back to LibRaw.
+};
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // RAW SETTINGS STRUCTURE
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -717,6 +753,7 @@ public:
 private:
     int m_max_raw_memory_mb{4096}; ///< Maximum memory for RAW processing (MB)
     bool m_force_load{true};     ///< Force decompress during initialization
+    int m_decode_threads{0};     ///< Threads of one decode (0: the share of the concurrency budget of its lane)
 
 public:
 
@@ -743,6 +780,20 @@ public:
      * @param force true to force decompression during initialization.
      */
     constexpr void set_force_load(bool force) noexcept { m_force_load = force; }
+
+    /**
+     * @brief Gets the number of threads of one decode.
+     * @return The thread count, or 0 to follow the concurrency budget.
+     * The lossless decompression of tiled DNG and of some CR3/NEF variants, the demosaic and
+     * the format conversion run on these threads, when the decoder build supports it.
+     */
+    [[nodiscard]] constexpr int get_decode_threads() const noexcept { return m_decode_threads; }
+
+    /**
+     * @brief Sets the number of threads of one decode.
+     * @param threads The thread count (capped to the budget share of the decode's lane), or 0 to follow the budget.
+     */
+    constexpr void set_decode_threads(int threads) noexcept { m_decode_threads = threads > 0 ? threads : 0; }
     // ═════════════════════════════════════════════════════════════════════════
     // PRESET FACTORY METHODS
     // ═════════════════════════════════════════════════════════════════════════
@@ -810,6 +861,38 @@ public:
         return settings;
     }
 
+    /**
+     * @brief Creates a RawSettings configured for interactive draft previews.
+     * @return RawSettings with draft configuration.
+     * ## Configuration Rationale
+     * | Parameter | Value | Reason |
+     * |-----------|-------|--------|
+     * | demosaic | ppg | Fast, without the zippering of linear |
+     * | color_space | prophoto_linear | Same as the full-quality decode it is replaced by |
+     * | highlight_mode | blend | Same highlights as the full-quality decode |
+     * | half_size | true | Half resolution = 1/4 pixels, still above a fit-to-view display |
+     * | fbdd_noiserd | off | No pre-demosaic denoising |
+     * | force_load | false | Lazy loading |
+     * | balance_clamped | true | Prevents highlight color shifts |
+     * | use_camera_matrix | always | Same colors as the full-quality decode |
+     * @note Use for the interactive preview of RAW files; unlike fast_settings(), the rendering
+     *       matches quality_settings() closely enough to swap one for the other in place.
+     */
+    [[nodiscard]] static constexpr RawSettings draft_settings() noexcept {
+        RawSettings settings;
+        settings.m_demosaic = DemosaicAlgorithm::ppg;
+        settings.m_color_space = RawColorSpace::prophoto_linear;
+        settings.m_highlight_mode = HighlightMode::blend;
+        settings.m_balance_clamped = true;
+        settings.m_half_size = true;
+        settings.m_fbdd_noiserd = FbddNoiseRd::off;
+        settings.m_force_load = false;
+        settings.m_camera_matrix = CameraMatrixMode::always;
+        settings.m_use_camera_wb = true;
+        settings.m_use_auto_wb = false;
+        return settings;
+    }
+
     /**
      * @brief Creates a RawSettings configured for balanced performance and quality.
      * @return RawSettings with balanced configuration.
@@ -853,6 +936,47 @@ public:
         *this = RawSettings{};
     }
 
+    /**
+     * @brief Computes a fingerprint of every setting that affects the decoded pixels.
+     * @return A 64-bit FNV-1a hash; equal settings give equal fingerprints across runs.
+     * @note The memory and loading settings are left out: they do not change the pixels.
+     *       Used to key persisted decodes, so changing a setting invalidates them.
+     */
+    [[nodiscard]] constexpr std::uint64_t fingerprint() const noexcept {
+        std::uint64_t hash{14695981039346656037ull};
+        const auto mix = [&hash](std::uint32_t value) {
+            for (int byte = 0; byte < 4; ++byte) {
+                hash ^= (value >> (byte * 8)) & 0xFFu;
+                hash *= 1099511628211ull;
+            }
+        };
+        const auto mix_float = [&mix](float value) { mix(std::bit_cast<std::uint32_t>(value)); };
+
+        mix(static_cast<std::uint32_t>(m_demosaic));
+        mix(static_cast<std::uint32_t>(m_half_size));
+        mix(static_cast<std::uint32_t>(m_color_space));
+        mix(static_cast<std::uint32_t>(m_highlight_mode));
+        mix(static_cast<std::uint32_t>(m_balance_clamped));
+        mix(static_cast<std::uint32_t>(m_use_camera_wb));
+        mix(static_cast<std::uint32_t>(m_use_auto_wb));
+        for (const int value : m_grey_box) { mix(static_cast<std::uint32_t>(value)); }
+        for (const float value : m_user_mul) { mix_float(value); }
+        mix(static_cast<std::uint32_t>(m_camera_matrix));
+        mix_float(m_exposure);
+        mix(static_cast<std::uint32_t>(m_auto_bright));
+        mix(static_cast<std::uint32_t>(m_apply_scene_linear_scale));
+        mix_float(m_camera_to_scene_linear_scale);
+        mix(static_cast<std::uint32_t>(m_user_black));
+        mix(static_cast<std::uint32_t>(m_user_sat));
+        mix_float(m_adjust_maximum_thr);
+        mix(static_cast<std::uint32_t>(m_fbdd_noiserd));
+        mix_float(m_threshold);
+        for (const float value : m_aber) { mix_float(value); }
+        mix(static_cast<std::uint32_t>(m_user_flip));
+        for (const int value : m_crop_box) { mix(static_cast<std::uint32_t>(value)); }
+        return hash;
+    }
+
     /**
      * @brief Checks if the current configuration matches quality preset.
      * @return true if configuration uses quality-optimized settings.
@@ -874,6 +998,16 @@ public:
                m_demosaic == DemosaicAlgorithm::linear;
     }
 
+    /**
+     * @brief Checks if the current configuration matches draft preset.
+     * @return true if configuration uses draft preview settings.
+     */
+    [[nodiscard]] constexpr bool is_draft_configuration() const noexcept {
+        return m_half_size &&
+               m_demosaic == DemosaicAlgorithm::ppg &&
+               m_fbdd_noiserd == FbddNoiseRd::off;
+    }
+
     /**
      * @brief Checks if the current configuration matches performance preset.
      * @return true if configuration uses balanced performance settings.
@@ -1,6 +1,6 @@
 /**
  * @file working_image_cpu_default.h
- * @brief Default concrete implementation of IWorkingImageCPU using standard CPU memory (std::vector<float>).
+ * @brief Default concrete implementation of IWorkingImageCPU using standard CPU memory (Common::ImageRegion).
  *
  * This class holds image data within standard CPU memory (RAM) using a
  * Common::ImageRegion structure. It implements IWorkingImageCPU interface
@@ -28,7 +28,7 @@ namespace ImageProcessing {
  *
  * @details
  * This class serves as simplest implementation of `IWorkingImageHardware`.
- * It stores data directly in a `Common::ImageRegion` (which wraps a `std::vector<float>`).
+ * It stores data directly in a `Common::ImageRegion` (which wraps a pooled `Common::PixelBuffer`).
  * It does not utilize specific acceleration hardware (like Halide or SIMD) directly,
  * relying on standard C++ operations.
  *
@@ -104,6 +104,17 @@ public:
      */
     [[nodiscard]] std::expected<std::shared_ptr<Common::ImageRegion>, ErrorHandling::CoreError> exportToCPUShared() const;
 
+    /**
+     * @brief Exports a read-only view over the internal ImageRegion.
+     *
+     * @details
+     * Built on `exportToCPUShared()`: the view keeps the internal region alive, and
+     * `updateFromCPU()` replaces the region rather than overwriting it.
+     *
+     * @return std::expected<Common::ImageView, std::error_code> View on success, or error code if invalid.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError> exportToCPUView() override;
+
     /**
      * @brief Gets dimensions (width, height) of internal image data.
      *
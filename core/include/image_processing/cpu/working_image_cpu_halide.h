@@ -7,6 +7,7 @@
 
 #pragma once
 #include "image_processing/halide/working_image_halide.h"
+#include "image_processing/halide/halide_downsampler.h"
 #include "image_processing/cpu/working_image_cpu.h"
 
 #include <memory>
@@ -56,6 +57,29 @@ public:
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>,  ErrorHandling::CoreError>
     exportToCPUCopy() override;
 
+    /**
+     * @brief Exports a read-only view over the internal data.
+     *
+     * Interleaved float storage is shared as is (no copy); half-float or planar storage is
+     * widened (interleaved) into the view.
+     *
+     * @return std::expected<Common::ImageView, std::error_code>.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError>
+    exportToCPUView() override;
+
+    /**
+     * @brief Exports a downscaled version of the image for display.
+     *
+     * @details
+     * Runs the compiled Halide kernel (`HalideDownsampler`): area average for large
+     * reductions, bilinear for small ones, parallel over rows and vectorized over x.
+     * The kernel writes straight into the interleaved storage of the returned region.
+     * Called after every edit, so it replaces the generic OIIO resize of `WorkingImageCPU`.
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    downsample(Common::ImageDim target_width, Common::ImageDim target_height) override;
+
     /**
      * @brief Gets the dimensions (width, height) of the internal Halide buffer.
      *
@@ -110,6 +134,11 @@ private:
      */
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     convertHalideToImageRegion();
+
+    /**
+     * @brief Compiled display downsample kernel.
+     */
+    HalideDownsampler m_downsampler;
 };
 
 } // namespace ImageProcessing
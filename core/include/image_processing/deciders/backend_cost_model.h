@@ -0,0 +1,176 @@
+/**
+ * @file backend_cost_model.h
+ * @brief Declaration of BackendCostModel (per-image CPU/GPU selection).
+ *
+ * @details
+ * The startup benchmark picks one backend for the whole session. That is right for the
+ * "typical" image it measured, but not across sizes: on a small JPEG the fixed kernel launch
+ * and PCIe transfer costs dominate and the CPU wins, while on a 100 MP RAW the GPU throughput wins.
+ *
+ * This model turns the benchmark measurements into a linear cost per backend:
+ * \f$ t(N) = latency + N \cdot (compute + transfer) \f$ with N in megapixels,
+ * and selects the cheapest backend for a given image size.
+ *
+ * The measured compute cost is that of the benchmark's chain. Once `calibrate`d with the
+ * nominal cost of that chain (`Operations::benchmarkChainCost`), the model predicts any other
+ * chain from the nominal costs of its operations (`Operations::chainCost`): a denoised RAW and a
+ * brightened JPEG of the same size no longer get the same estimate, nor the same backend.
+ * A millisecond per megapixel is a nanosecond per pixel: the calibration is the ratio of the
+ * measured to the nominal cost, per backend.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+#include "common/types/memory_type.h"
+#include "operations/operation_cost.h"
+
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+struct BackendBenchmarkTiming;
+
+/**
+ * @struct BackendProfile
+ * @brief Cost coefficients of one backend for the fused edit pipeline.
+ */
+struct BackendProfile {
+    /**
+     * @brief Fixed cost of one pipeline run, in milliseconds.
+     */
+    double m_latency_ms{0.0};
+
+    /**
+     * @brief Compute cost, in milliseconds per megapixel.
+     */
+    double m_compute_ms_per_megapixel{0.0};
+
+    /**
+     * @brief Host <-> device transfer cost, in milliseconds per megapixel (0 on CPU).
+     */
+    double m_transfer_ms_per_megapixel{0.0};
+
+    /**
+     * @brief Estimates the duration of one run on an image of `megapixels`.
+     */
+    [[nodiscard]] constexpr double estimateMilliseconds(double megapixels) const noexcept
+    {
+        return m_latency_ms + megapixels * (m_compute_ms_per_megapixel + m_transfer_ms_per_megapixel);
+    }
+};
+
+/**
+ * @class BackendCostModel
+ * @brief Chooses CPU or GPU per image from the measured benchmark costs.
+ */
+class BackendCostModel {
+public:
+    /**
+     * @brief Relative advantage the GPU must have to be selected.
+     * @details Same margin as `BenchmarkingBackendDecider`: the GPU must be at least 10% faster.
+     */
+    static constexpr double k_gpu_advantage_threshold = 0.9;
+
+    /**
+     * @brief Constructs a model from explicit profiles.
+     * @param cpu CPU profile.
+     * @param gpu GPU profile, or `std::nullopt` if no GPU is usable.
+     */
+    BackendCostModel(BackendProfile cpu, std::optional<BackendProfile> gpu) noexcept;
+
+    /**
+     * @brief Builds a model from benchmark timings.
+     *
+     * @details The GPU profile is built from the fastest non-CPU timing, i.e. the GPU
+     * whose target `BenchmarkingBackendDecider::getBestGpuTarget` reports.
+     *
+     * @param timings Timings measured by `BenchmarkingBackendDecider` (or loaded from the cache).
+     * @return The model, or `std::nullopt` if the CPU timing is missing or incomplete.
+     */
+    [[nodiscard]] static std::optional<BackendCostModel> fromTimings(const std::vector<BackendBenchmarkTiming>& timings);
+
+    /**
+     * @brief Relates the nominal operation costs to the measured ones.
+     * @param benchmark_chain Nominal cost of the chain the profiles were measured with.
+     *        Uncalibrated, a nominal nanosecond per pixel is taken as measured.
+     */
+    void calibrate(const Operations::ChainCost& benchmark_chain) noexcept;
+
+    /**
+     * @brief Checks whether a GPU profile is available.
+     */
+    [[nodiscard]] bool hasGpu() const noexcept { return m_gpu.has_value(); }
+
+    /**
+     * @brief Estimates the duration of one pipeline run on the given backend.
+     * @return Milliseconds, or `std::nullopt` if the backend is not modeled.
+     */
+    [[nodiscard]] std::optional<double> estimateMilliseconds(Common::MemoryType backend,
+                                                             Common::ImageDim width,
+                                                             Common::ImageDim height) const noexcept;
+
+    /**
+     * @brief Estimates the duration of one run of a chain on the given backend.
+     * @param chain Nominal cost of the chain (`Operations::chainCost`).
+     * @return Milliseconds, or `std::nullopt` if the backend is not modeled.
+     */
+    [[nodiscard]] std::optional<double> estimateMilliseconds(Common::MemoryType backend,
+                                                             const Operations::ChainCost& chain,
+                                                             Common::ImageDim width,
+                                                             Common::ImageDim height) const noexcept;
+
+    /**
+     * @brief Selects the cheapest backend for an image.
+     * @param advantage_threshold Ratio of the GPU to the CPU time under which the GPU is selected
+     *        (lower under a restraining energy plan: the GPU draws more power).
+     * @return `GPU_MEMORY` only if a GPU is modeled and beats the CPU by `advantage_threshold`.
+     */
+    [[nodiscard]] Common::MemoryType selectBackend(Common::ImageDim width, Common::ImageDim height,
+                                                   double advantage_threshold = k_gpu_advantage_threshold) const noexcept;
+
+    /**
+     * @brief Selects the cheapest backend for a chain on an image.
+     * @details As `selectBackend(width, height)`, with the compute cost of the chain instead of the benchmark's.
+     */
+    [[nodiscard]] Common::MemoryType selectBackend(Common::ImageDim width, Common::ImageDim height,
+                                                   const Operations::ChainCost& chain,
+                                                   double advantage_threshold = k_gpu_advantage_threshold) const noexcept;
+
+private:
+    /**
+     * @brief Selects the backend of the lower estimate (the GPU by `advantage_threshold`).
+     */
+    [[nodiscard]] static Common::MemoryType cheaper(Common::ImageDim width, Common::ImageDim height,
+                                                    double cpu_ms, double gpu_ms, double advantage_threshold) noexcept;
+
+    /**
+     * @brief CPU cost profile.
+     */
+    BackendProfile m_cpu;
+
+    /**
+     * @brief GPU cost profile, if a GPU is usable.
+     */
+    std::optional<BackendProfile> m_gpu;
+
+    /**
+     * @brief Measured CPU milliseconds per megapixel for a nominal nanosecond per pixel.
+     */
+    double m_cpu_scale{1.0};
+
+    /**
+     * @brief Measured GPU milliseconds per megapixel for a nominal nanosecond per pixel.
+     */
+    double m_gpu_scale{1.0};
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
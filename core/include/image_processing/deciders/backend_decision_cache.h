@@ -0,0 +1,165 @@
+/**
+ * @file backend_decision_cache.h
+ * @brief Declaration of BackendDecisionCache (persistent result of the backend benchmark).
+ *
+ * @details
+ * Running `BenchmarkingBackendDecider` JIT-compiles and executes a probe on every available
+ * GPU API, which adds seconds to startup. The outcome only depends on the machine, so it is
+ * stored on disk and reused as long as the machine fingerprint (CPU target, Halide version,
+ * GPU driver) is unchanged.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/memory_type.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+
+#include "Halide.h"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @struct BackendBenchmarkTiming
+ * @brief Measured execution time of the benchmark on one backend.
+ */
+struct BackendBenchmarkTiming {
+    /**
+     * @brief Backend name ("CPU", "CUDA", "Vulkan", ...).
+     */
+    std::string m_backend;
+
+    /**
+     * @brief Measured (median) time, in milliseconds.
+     */
+    double m_milliseconds{0.0};
+
+    /**
+     * @brief Throughput of the benchmark workload, in megapixels per second.
+     */
+    double m_megapixels_per_second{0.0};
+
+    /**
+     * @brief Fixed per-run overhead, in milliseconds (measured on a tiny image).
+     */
+    double m_latency_ms{0.0};
+
+    /**
+     * @brief Part of `m_milliseconds` spent uploading and downloading the image (GPU only, 0 on CPU).
+     */
+    double m_transfer_ms{0.0};
+
+    /**
+     * @brief Size of the benchmark image, in megapixels.
+     */
+    double m_megapixels{0.0};
+};
+
+/**
+ * @struct BackendDecision
+ * @brief A backend decision together with the measurements it was based on.
+ */
+struct BackendDecision {
+    /**
+     * @brief Fingerprint of the machine the decision was made on.
+     */
+    std::string m_fingerprint;
+
+    /**
+     * @brief Selected memory type (CPU or GPU).
+     */
+    Common::MemoryType m_memory_type{Common::MemoryType::CPU_RAM};
+
+    /**
+     * @brief Selected Halide target (host target, plus the GPU feature if any).
+     */
+    Halide::Target m_target;
+
+    /**
+     * @brief Fastest GPU target, kept even when the CPU was selected globally.
+     */
+    std::optional<Halide::Target> m_gpu_target;
+
+    /**
+     * @brief Per-backend timings measured during the benchmark.
+     */
+    std::vector<BackendBenchmarkTiming> m_timings;
+
+    /**
+     * @brief GPU tile shape tuned on `m_gpu_target`, if a GPU was benchmarked.
+     */
+    std::optional<GpuTileSchedule> m_gpu_schedule;
+};
+
+/**
+ * @class BackendDecisionCache
+ * @brief Stores and retrieves the backend decision in a small key=value file.
+ *
+ * @details
+ * Default location:
+ * - Linux: `$XDG_CACHE_HOME/CaptureMoment` or `~/.cache/CaptureMoment`
+ * - macOS: `~/Library/Caches/CaptureMoment`
+ * - Windows: `%LOCALAPPDATA%\CaptureMoment`
+ */
+class BackendDecisionCache {
+public:
+    /**
+     * @brief Constructs a cache bound to a file.
+     * @param cache_file Path of the cache file. Defaults to `defaultCacheFile()`.
+     */
+    explicit BackendDecisionCache(std::filesystem::path cache_file = defaultCacheFile());
+
+    /**
+     * @brief Gets the default cache file for the current user.
+     */
+    [[nodiscard]] static std::filesystem::path defaultCacheFile();
+
+    /**
+     * @brief Computes the fingerprint of the current machine.
+     *
+     * @details
+     * Made of the CPU target string (the host's features, or the baseline in portable
+     * mode: `AppConfig::setCpuTargetMode`), the Halide version, the GPU driver
+     * description (vendor/device ids, driver name and version where the platform exposes them)
+     * and the version of the benchmark workload.
+     * A driver update or a new GPU therefore invalidates the cached decision, and the tuned GPU tile with it.
+     */
+    [[nodiscard]] static std::string currentFingerprint();
+
+    /**
+     * @brief Loads the cached decision if it was made for `fingerprint`.
+     * @return The decision, or `std::nullopt` if the file is missing, unreadable or stale.
+     */
+    [[nodiscard]] std::optional<BackendDecision> load(std::string_view fingerprint) const;
+
+    /**
+     * @brief Writes the decision, replacing any previous one.
+     * @return true if the file was written.
+     */
+    bool store(const BackendDecision& decision) const;
+
+    /**
+     * @brief Gets the cache file path.
+     */
+    [[nodiscard]] const std::filesystem::path& path() const noexcept { return m_cache_file; }
+
+private:
+    /**
+     * @brief Path of the cache file.
+     */
+    std::filesystem::path m_cache_file;
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
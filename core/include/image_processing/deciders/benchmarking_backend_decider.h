@@ -14,8 +14,10 @@
 #pragma once
 
 #include "image_processing/interfaces/i_backend_decider.h"
+#include "image_processing/deciders/backend_decision_cache.h"
 #include <chrono>
 #include <optional>
+#include <vector>
 
 #include "Halide.h"
 
@@ -28,12 +30,15 @@ namespace ImageProcessing {
  * @brief Implements IBackendDecider using a runtime performance comparison strategy.
  *
  * @details
- * This decider executes a small, representative image processing pipeline
- * (a simple brightness/contrast adjustment) on different hardware targets.
+ * This decider executes the fused tone chain used by interactive edits (Brightness, Contrast,
+ * Highlights, Shadows, Whites, Blacks) at a realistic photo resolution on different hardware targets.
  * It compares the execution time of the CPU backend against available GPU backends.
+ * GPU timings include the upload and download of the image, as paid by a real edit.
+ * Every backend is warmed up first, then timed as the median of several runs.
  *
  * The decision logic is as follows:
- * 1. **CPU Baseline**: Establishes a reference time by running the benchmark on the CPU.
+ * 1. **CPU Baseline**: Establishes a reference time by running the benchmark on the CPU target
+ *    selected for the engine (`AppConfig::getCpuTargetMode`: native features or portable baseline).
  * 2. **GPU Availability**: Scans the Halide host target to detect which GPU features are
  *    compiled in (e.g., CUDA, Vulkan, Metal).
  * 3. **Priority Testing**: Tests available GPU backends in a strict priority order:
@@ -42,15 +47,23 @@ namespace ImageProcessing {
  *    - Metal (macOS/iOS Native)
  *    - Vulkan (Cross-Platform)
  *    - OpenCL (Legacy Fallback)
- * 4. **Selection**: Selects the GPU backend only if it provides a significant speedup
+ * 4. **Tile Tuning**: On the fastest GPU backend, times the chain with each candidate thread-block
+ *    shape and vector width, keeps the fastest (`getGpuSchedule`), and measures that backend again
+ *    with it.
+ * 5. **Selection**: Selects the GPU backend only if it provides a significant speedup
  *    (defined by `k_gpu_advantage_threshold`) over the CPU baseline.
  *
  * @note
- * The benchmark incurs a startup cost (typically a few hundred milliseconds) to ensure
- * that the optimal hardware is used for the lifetime of the application.
+ * The benchmark incurs a startup cost (up to a few seconds) to ensure that the optimal
+ * hardware is used. The result is cached on disk by `BackendDecisionCache`.
  */
 class BenchmarkingBackendDecider final : public IBackendDecider {
 public:
+    /**
+     * @brief Duration type used for the measurements (fractional milliseconds).
+     */
+    using Duration = std::chrono::duration<double, std::milli>;
+
     ~BenchmarkingBackendDecider() override = default;
 
     /**
@@ -58,7 +71,7 @@ public:
      *
      * @details
      * This method executes the full benchmarking sequence:
-     * 1. Creates a dummy test image buffer.
+     * 1. Creates a gradient test image buffer.
      * 2. Runs a CPU benchmark.
      * 3. Iterates through available GPU APIs.
      * 4. Compares the best GPU time against the CPU time.
@@ -80,6 +93,28 @@ public:
      */
     [[nodiscard]] const Halide::Target& getWinningTarget() const { return m_winning_target; };
 
+    /**
+     * @brief Gets the timings measured by the last `decide()` call.
+     *
+     * @details
+     * One entry for the CPU baseline, then one per GPU backend that ran successfully,
+     * with the median time and the corresponding throughput in megapixels per second.
+     * Persisted alongside the decision by `BackendDecisionCache`.
+     */
+    [[nodiscard]] const std::vector<BackendBenchmarkTiming>& getTimings() const noexcept { return m_timings; }
+
+    /**
+     * @brief Gets the fastest GPU target found by the last `decide()` call, even if the CPU won.
+     * @return Host target plus the best GPU feature, or `std::nullopt` if no GPU benchmark succeeded.
+     */
+    [[nodiscard]] const std::optional<Halide::Target>& getBestGpuTarget() const noexcept { return m_best_gpu_target; }
+
+    /**
+     * @brief Gets the GPU tile shape tuned by the last `decide()` call on the best GPU target.
+     * @return The fastest shape, or `std::nullopt` if no GPU benchmark succeeded.
+     */
+    [[nodiscard]] const std::optional<GpuTileSchedule>& getGpuSchedule() const noexcept { return m_gpu_schedule; }
+
 private:
     // ============================================================
     // Configuration Constants
@@ -87,16 +122,16 @@ private:
 
     /**
      * @brief Width of the test image used for benchmarking.
-     * @details Set to 1920 (Full HD). This size is large enough to overcome
-     * kernel launch overhead but small enough to keep the benchmark fast (< 1s).
+     * @details Set to 4000 (12 MP with the height), a typical camera resolution. Smaller images
+     * mostly measure kernel launch and transfer latency rather than throughput.
      */
-    static constexpr int k_benchmark_width = 1920;
+    static constexpr int k_benchmark_width = 4000;
 
     /**
      * @brief Height of the test image used for benchmarking.
-     * @details Set to 1080 (Full HD).
+     * @details Set to 3000.
      */
-    static constexpr int k_benchmark_height = 1080;
+    static constexpr int k_benchmark_height = 3000;
 
     /**
      * @brief Number of color channels in the test image.
@@ -113,6 +148,28 @@ private:
      */
     static constexpr double k_gpu_advantage_threshold = 0.9;
 
+    /**
+     * @brief Number of untimed runs per backend.
+     * @details Absorbs first-run costs: device allocation, lazy driver initialization, cold caches.
+     */
+    static constexpr int k_warmup_runs = 2;
+
+    /**
+     * @brief Number of timed runs per backend. The median is kept.
+     */
+    static constexpr int k_timed_runs = 5;
+
+    /**
+     * @brief Side of the tiny image used to measure the fixed per-run overhead of a backend.
+     */
+    static constexpr int k_latency_size = 64;
+
+    /**
+     * @brief Number of timed runs per candidate GPU tile shape. The median is kept.
+     * @details Fewer than `k_timed_runs`: every candidate is compiled, and only kernels are timed.
+     */
+    static constexpr int k_tuning_runs = 3;
+
     // ============================================================
     // Benchmarking Methods
     // ============================================================
@@ -121,14 +178,16 @@ private:
      * @brief Benchmarks the CPU backend execution time.
      *
      * @details
-     * This method allocates a test buffer, fills it with dummy data, creates a
-     * simple Halide pipeline (arithmetic operations), and measures the time
+     * This method allocates the test buffers, builds the fused tone chain with the CPU
+     * schedule of the real pipeline, JIT-compiles it, and measures the median time
      * taken to `realize` the output.
      *
-     * @return std::chrono::milliseconds The duration of the CPU execution.
-     * @return std::chrono::milliseconds::max() If an exception occurs during the benchmark.
+     * The fixed per-run overhead is measured on a tiny output.
+     *
+     * @return The timing (median duration, throughput, latency). `m_backend` is left empty.
+     * @return std::nullopt If an exception occurs during the benchmark.
      */
-    [[nodiscard]] std::chrono::milliseconds benchmark_cpu() const;
+    [[nodiscard]] std::optional<BackendBenchmarkTiming> benchmark_cpu() const;
 
     /**
      * @brief Benchmarks a specific GPU backend feature.
@@ -137,22 +196,61 @@ private:
      * This method tests a specific Halide Target::Feature (e.g., CUDA, Vulkan).
      * It performs the following steps:
      * 1. Creates a Target object configured with the requested feature.
-     * 2. Schedules the Halide pipeline for GPU execution (using tiling).
-     * 3. Copies the test buffer to the device (Host -> Device).
-     * 4. Executes the pipeline and measures the time.
+     * 2. Schedules the Halide pipeline for GPU execution (tiled with `schedule`).
+     * 3. Probes the device by copying the test buffer (Host -> Device).
+     * 4. Measures the median of upload + execution + download.
+     * 5. Measures the transfers alone, and the fixed per-run overhead on a tiny output.
      *
      * @param feature The Halide::Target::Feature to benchmark (e.g., Target::CUDA).
      * @param test_buffer A reference to the input buffer defining dimensions and data.
-     * @return std::optional<std::chrono::milliseconds> The duration of the GPU execution if successful.
+     * @param schedule The GPU tile shape.
+     * @return The timing (round trip, transfers, latency) if successful. `m_backend` is left empty.
      * @return std::nullopt If the feature is unsupported, allocation fails, or copy_to_device fails.
      */
-    [[nodiscard]] std::optional<std::chrono::milliseconds>
-    benchmark_gpu_feature(Halide::Target::Feature feature, const Halide::Buffer<float>& test_buffer) const;
+    [[nodiscard]] std::optional<BackendBenchmarkTiming>
+    benchmark_gpu_feature(Halide::Target::Feature feature, const Halide::Buffer<float>& test_buffer,
+                          const GpuTileSchedule& schedule) const;
+
+    /**
+     * @brief Finds the fastest GPU tile shape for a backend.
+     *
+     * @details
+     * Uploads the test buffer once, then compiles the chain with each candidate shape and vector
+     * width and times its kernel alone (median of `k_tuning_runs`), the image staying on the device.
+     * Candidates that fail to compile or run are skipped.
+     *
+     * @param feature The GPU feature to tune (one that `benchmark_gpu_feature` ran successfully).
+     * @param test_buffer A fresh input buffer.
+     * @return The fastest shape, or `std::nullopt` if no candidate ran.
+     */
+    [[nodiscard]] std::optional<GpuTileSchedule>
+    tune_gpu_schedule(Halide::Target::Feature feature, const Halide::Buffer<float>& test_buffer) const;
+
+    /**
+     * @brief Converts a benchmark duration into throughput over the test image.
+     * @return Megapixels per second, or 0 for a null duration.
+     */
+    [[nodiscard]] static double to_megapixels_per_second(Duration duration);
 
     /**
      * @brief Stores the winning Halide Target object selected during `decide()`.
      */
     Halide::Target m_winning_target;
+
+    /**
+     * @brief Timings measured during the last `decide()` call.
+     */
+    std::vector<BackendBenchmarkTiming> m_timings;
+
+    /**
+     * @brief Fastest GPU target found during the last `decide()` call.
+     */
+    std::optional<Halide::Target> m_best_gpu_target;
+
+    /**
+     * @brief GPU tile shape tuned during the last `decide()` call.
+     */
+    std::optional<GpuTileSchedule> m_gpu_schedule;
 };
 
 } // namespace ImageProcessing
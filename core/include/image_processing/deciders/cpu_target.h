@@ -0,0 +1,84 @@
+/**
+ * @file cpu_target.h
+ * @brief Declaration of CpuTarget (selection of the CPU instruction set the JIT compiles for).
+ *
+ * @details
+ * Every Halide target of the engine (CPU pipelines, and the host part of the GPU targets) is
+ * built on the CPU target selected here:
+ * - **Native** (default): the features of the machine the engine runs on, probed by Halide
+ *   (CPUID and the OS-enabled register state on x86, the hardware capabilities on ARM): AVX-512
+ *   level, AVX2, FMA, F16C, SSE4.1, or the ARM dot product and half-float arithmetic.
+ * - **Portable**: the architecture baseline only (SSE2, NEON). The JIT output no longer depends on
+ *   the machine: images render bit-identically across a fleet of mixed hardware (FMA contraction
+ *   changes rounding), at the cost of vector width.
+ *
+ * The ahead-of-time tone kernel is not concerned: it is built with one variant per feature
+ * level, and the Halide runtime picks the best one the machine runs (see `core/generators`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @brief Instruction set the JIT compiles the CPU code for.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class CpuTargetMode : std::uint8_t {
+    /**
+     * @brief Every feature of the running machine.
+     */
+    Native = 0,
+
+    /**
+     * @brief The architecture baseline: the same code, and the same results, on every machine.
+     */
+    Portable = 1
+};
+
+/**
+ * @class CpuTarget
+ * @brief Builds and describes the CPU part of the Halide targets.
+ */
+class CpuTarget {
+public:
+    /**
+     * @brief Returns the CPU target (no GPU feature) for a mode.
+     * @details Native targets are probed once; the result is cached for the process.
+     */
+    [[nodiscard]] static Halide::Target select(CpuTargetMode mode);
+
+    /**
+     * @brief Lists the instruction-set features of a target, most specific first (e.g. "avx512_skylake avx2 fma f16c").
+     * @return The list, or "baseline" if the target has none.
+     */
+    [[nodiscard]] static std::string describeFeatures(const Halide::Target& target);
+
+    /**
+     * @brief Name of a mode, as accepted by `parseMode` ("native", "portable").
+     */
+    [[nodiscard]] static std::string_view modeName(CpuTargetMode mode) noexcept;
+
+    /**
+     * @brief Parses a mode name.
+     * @return The mode, or `std::nullopt` if the name is unknown.
+     */
+    [[nodiscard]] static std::optional<CpuTargetMode> parseMode(std::string_view name) noexcept;
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
@@ -13,6 +13,7 @@
 #include "common/types/memory_type.h"
 #include <memory>
 #include <functional>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace CaptureMoment::Core {
@@ -27,6 +28,8 @@ namespace ImageProcessing {
  * This factory uses a Registry Pattern (static map) instead of a hardcoded switch statement.
  * This allows new backends (e.g., `WorkingImageCUDA`, `WorkingImageTPU`) to be registered
  * at startup from anywhere in the codebase, without modifying this factory class.
+ * The registry is shared by every engine of the process and guarded by a shared mutex:
+ * creators run outside the lock, so engines create their working images concurrently.
  *
  * **Supported Implementations:**
  * - `WorkingImageCPU_Halide`: CPU-backed image using Halide buffers.
@@ -46,9 +49,10 @@ public:
      * @brief Creates a working image using the application's global configuration.
      *
      * @details
-     * This is the convenience method. It queries the global App Configuration
-     * to determine the preferred backend (CPU or GPU) and delegates to the
-     * specific create method.
+     * This is the convenience method. If `AppConfig` holds a backend cost model
+     * (built from the startup benchmark), the backend is chosen per image from its
+     * size; otherwise the globally preferred backend (CPU or GPU) is used.
+     * It then delegates to the specific create method.
      *
      * @param source_image The source image data.
      * @return A unique pointer to the created object.
@@ -109,6 +113,11 @@ private:
      * @brief Registry mapping backend type to its creator function.
      */
     static inline std::unordered_map<Common::MemoryType, CreatorFunction> s_registry;
+
+    /**
+     * @brief Guards `s_registry`.
+     */
+    static inline std::shared_mutex s_registry_mutex;
 };
 
 } // namespace ImageProcessing
@@ -0,0 +1,109 @@
+/**
+ * @file gpu_devices.h
+ * @brief Declaration of GpuDevices (one device context per GPU, selected per thread).
+ *
+ * @details
+ * Halide's CUDA runtime creates a single context, on one device, for the whole process: a
+ * workstation with two GPUs used one of them. `GpuDevices` keeps a context per CUDA device
+ * (the device's primary context, through the driver loaded at run time) and answers Halide's
+ * context requests (`custom_cuda_acquire_context`) with the context of the calling thread's
+ * device:
+ * - A thread selects a device with `ScopedDevice`. Unscoped threads use device 0.
+ * - Every realization, transfer and device free on that thread then runs on that device.
+ *   `WorkingImageGPU_Halide` records the device it was created on and scopes its own calls.
+ * - `BatchExporter` runs one GPU processor per device, so files are sharded across GPUs.
+ *
+ * Only the CUDA runtime lets the context be chosen: other backends (Metal, Vulkan, OpenCL)
+ * and single-GPU hosts report one device, and Halide's own context management is left as is.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @class GpuDevices
+ * @brief Process-wide registry of the CUDA device contexts.
+ */
+class GpuDevices {
+public:
+    /**
+     * @brief Returns the registry (the CUDA driver is probed on first call).
+     */
+    [[nodiscard]] static GpuDevices& instance();
+
+    /**
+     * @brief Number of devices the engine can shard across (1 unless several CUDA GPUs are usable).
+     */
+    [[nodiscard]] std::size_t deviceCount() const noexcept;
+
+    /**
+     * @brief Device selected on the calling thread, if any.
+     */
+    [[nodiscard]] static std::optional<std::size_t> currentDevice() noexcept;
+
+    /**
+     * @brief Installs the context handlers in `handlers` when several devices are usable.
+     * @details Left untouched otherwise, so that Halide keeps its own context.
+     */
+    void addContextHandlers(Halide::JITHandlers& handlers) const noexcept;
+
+    /**
+     * @class ScopedDevice
+     * @brief Selects a device on the calling thread for its lifetime (nested scopes restore).
+     */
+    class ScopedDevice {
+    public:
+        explicit ScopedDevice(std::optional<std::size_t> device) noexcept;
+        ~ScopedDevice();
+
+        ScopedDevice(const ScopedDevice&) = delete;
+        ScopedDevice& operator=(const ScopedDevice&) = delete;
+
+    private:
+        /**
+         * @brief Selection restored on destruction.
+         */
+        std::optional<std::size_t> m_previous;
+    };
+
+    GpuDevices(const GpuDevices&) = delete;
+    GpuDevices& operator=(const GpuDevices&) = delete;
+
+private:
+    /**
+     * @brief Private: use `instance()`. Never destroyed: device buffers freed during shutdown
+     *        still acquire their context.
+     */
+    GpuDevices();
+
+    /**
+     * @brief `custom_cuda_acquire_context` handler: the context of the calling thread's device.
+     */
+    static int acquireContext(Halide::JITUserContext* context, void** cuda_context, bool create);
+
+    /**
+     * @brief `custom_cuda_release_context` handler: primary contexts stay retained, nothing to do.
+     */
+    static int releaseContext(Halide::JITUserContext* context);
+
+    /**
+     * @brief Primary context of each usable device, in device order.
+     */
+    std::vector<void*> m_contexts;
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
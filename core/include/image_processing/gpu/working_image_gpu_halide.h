@@ -9,8 +9,10 @@
 
 #include "image_processing/gpu/interfaces/i_working_image_gpu.h"
 #include "image_processing/halide/working_image_halide.h"
+#include "image_processing/halide/halide_downsampler.h"
 #include "common/error_handling/core_error.h"
 
+#include <cstddef>
 #include <memory>
 #include <expected>
 
@@ -28,6 +30,17 @@ namespace ImageProcessing {
  * GPU Specifics:
  * - Manages Host-to-Device (updateFromCPU) and Device-to-Host (exportToCPUCopy) transfers.
  * - Uses `std::expected` for robust error reporting of GPU transfers.
+ *
+ * Device Residency:
+ * The source and destination buffers stay on the device for the lifetime of the image.
+ * `updateFromCPU` uploads the source once and initializes the destination with a device copy.
+ * Edits run device-to-device, and per edit only the `downsample` result crosses the bus.
+ * Full-resolution downloads only happen in `exportToCPUCopy` / `exportToCPUView` (commit / export).
+ *
+ * Multi-GPU:
+ * The image lives on the GPU selected on the thread that created it (`GpuDevices::ScopedDevice`)
+ * and selects that GPU again for its own transfers. Realizations reading it must run on a thread
+ * scoped to the same GPU (`getDevice`).
  */
 
 class WorkingImageGPU_Halide final : public IWorkingImageGPU, public WorkingImageHalide {
@@ -39,9 +52,9 @@ public:
     explicit WorkingImageGPU_Halide(std::unique_ptr<Common::ImageRegion> initial_image = nullptr);
 
     /**
-     * @brief Virtual destructor.
+     * @brief Virtual destructor. Parks the device-resident buffers in `HalideDevicePool`.
      */
-    ~WorkingImageGPU_Halide() override = default;
+    ~WorkingImageGPU_Halide() override;
 
     // ============================================================
     // IWorkingImageHardware Interface Implementation
@@ -49,7 +62,7 @@ public:
 
     /**
      * @brief Updates internal image data by COPYING from a CPU-based ImageRegion.
-     * Includes a copy to the GPU device.
+     * Includes a single upload to the GPU device (the destination is copied on the device).
      *
      * @param cpu_image The source image data.
      * @return std::expected<void, std::error_code>.
@@ -59,18 +72,28 @@ public:
 
     /**
      * @brief Exports current internal image data to a new CPU-based ImageRegion.
-     * Includes a copy from the GPU device to Host memory.
+     * Downloads the device buffer directly into the new region; the image stays device-resident.
      *
      * @return std::expected<std::unique_ptr<Common::ImageRegion>, std::error_code>.
      */
     [[maybe_unused]] [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     exportToCPUCopy() override;
 
+    /**
+     * @brief Exports a read-only view over the host mirror of the internal data.
+     * Synchronizes the mirror first (one download if the device copy is newer, none otherwise).
+     *
+     * @return std::expected<Common::ImageView, std::error_code>.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError>
+    exportToCPUView() override;
+
     /**
      * @brief Exports a downscaled version of the image directly from GPU.
      *
      * @details
-     * For GPU: Performs downsample on GPU, then transfers only the small result.
+     * For GPU: Box-filters on the GPU (`HalideDownsampler`), then transfers only the small
+     * result into a staging buffer reused across calls.
      * For CPU: Performs downsample on CPU.
      *
      * This is the preferred method for display purposes.
@@ -122,6 +145,28 @@ public:
      * @return MemoryType::GPU_MEMORY, indicating the data is stored in GPU memory.
      */
     [[nodiscard]] Common::MemoryType getMemoryType() const override { return Common::MemoryType::GPU_MEMORY;};
+
+    /**
+     * @brief GPU the image is allocated on (`GpuDevices`; 0 on single-GPU hosts).
+     */
+    [[nodiscard]] std::size_t getDevice() const noexcept { return m_device; }
+
+private:
+    /**
+     * @brief GPU the image is allocated on.
+     */
+    std::size_t m_device{0};
+
+    /**
+     * @brief Compiled display downsample kernel.
+     */
+    HalideDownsampler m_downsampler;
+
+    /**
+     * @brief Display-size staging buffer (device + host), reused across `downsample` calls
+     *        and swapped through `HalideDevicePool` when the display size changes.
+     */
+    Halide::Buffer<float> m_display_staging;
 };
 
 } // namespace ImageProcessing
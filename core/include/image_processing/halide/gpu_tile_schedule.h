@@ -0,0 +1,88 @@
+/**
+ * @file gpu_tile_schedule.h
+ * @brief GPU tile shape and vector width of the per-pixel pipeline stages.
+ *
+ * @details
+ * The best thread-block shape differs between GPU vendors (warp/wavefront width, register file,
+ * memory coalescing): 16x16 suits some, 32x8 or 64x4 others. The backend benchmark tunes the
+ * shape on the fused tone chain (`BenchmarkingBackendDecider`), `BackendDecisionCache` keeps it
+ * per machine fingerprint, and `Config::AppConfig::getGpuTileSchedule` hands it to the stages
+ * scheduled on the GPU.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @struct GpuTileSchedule
+ * @brief Thread-block shape of a per-pixel GPU stage.
+ */
+struct GpuTileSchedule {
+    /**
+     * @brief Threads per block along x.
+     */
+    int m_tile_width{16};
+
+    /**
+     * @brief Threads per block along y.
+     */
+    int m_tile_height{16};
+
+    /**
+     * @brief Adjacent pixels computed by each thread, as one vector (1: a pixel per thread).
+     */
+    int m_vector_width{1};
+
+    /**
+     * @brief Largest number of threads per block accepted (the lowest limit of the GPU APIs).
+     */
+    static constexpr int k_max_threads = 256;
+
+    /**
+     * @brief Checks that the shape is usable on every GPU API.
+     */
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return m_tile_width > 0 && m_tile_height > 0 && m_vector_width > 0 && m_vector_width <= 16
+            && m_tile_width * m_tile_height <= k_max_threads;
+    }
+
+    bool operator==(const GpuTileSchedule&) const = default;
+};
+
+/**
+ * @brief Tiles the x and y dimensions of `func` over GPU blocks and threads.
+ *
+ * @details
+ * x and y become the block indices, `xi` and `yi` the thread indices. With a vector width
+ * above 1, x is first split into vectors of adjacent pixels (guarded, so images narrower than
+ * a vector stay valid): each thread then computes one vector.
+ *
+ * @param func The stage to schedule.
+ * @param x The x dimension (block index once scheduled).
+ * @param y The y dimension (block index once scheduled).
+ * @param xi The thread index along x.
+ * @param yi The thread index along y.
+ * @param schedule The tile shape.
+ */
+inline void applyGpuTiles(Halide::Func func, const Halide::Var& x, const Halide::Var& y,
+                          const Halide::Var& xi, const Halide::Var& yi, const GpuTileSchedule& schedule)
+{
+    if (schedule.m_vector_width > 1) {
+        Halide::Var xv;
+        func.split(x, x, xv, schedule.m_vector_width, Halide::TailStrategy::GuardWithIf).vectorize(xv);
+    }
+    func.gpu_tile(x, y, xi, yi, schedule.m_tile_width, schedule.m_tile_height);
+}
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
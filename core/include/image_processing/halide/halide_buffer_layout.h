@@ -0,0 +1,192 @@
+/**
+ * @file halide_buffer_layout.h
+ * @brief Interleaved (and planar) RGBA layout helpers for Halide buffers and pipeline parameters.
+ *
+ * @details
+ * `Common::ImageRegion` stores pixels interleaved (`RGBARGBA...`): the channel is the
+ * innermost dimension. A plain `Halide::Buffer<float>(data, w, h, c)` assumes a planar
+ * layout (x innermost), which addresses interleaved memory incorrectly.
+ *
+ * Every buffer wrapping image data must therefore be created through these helpers:
+ * - x stride = channels
+ * - y stride = width * channels
+ * - c stride = 1
+ *
+ * Pipelines declare the same layout on their inputs and outputs (`constrainInterleaved`)
+ * so that Halide compiles dense, channel-unrolled code instead of generic strided access.
+ *
+ * Working images may store halves instead of floats (`Common::PixelFormat::RGBA_F16`);
+ * the layout is the same, only the element type differs (see `storageType`).
+ *
+ * CPU working images may also be stored planar (`Common::PixelLayout::Planar`, one dense
+ * plane per channel, x innermost): each channel of a vector of pixels is then one dense load,
+ * without the shuffles that split interleaved pixels. Pipelines declare it with `constrainPlanar`
+ * (or `constrainLayout`); the display and export paths convert back to interleaved.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/pixel_format.h"
+#include "common/image_view.h"
+
+#include "Halide.h"
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @brief Number of channels of every pipeline buffer (RGBA).
+ */
+inline constexpr int k_interleaved_channels = 4;
+
+/**
+ * @brief Wraps existing interleaved memory without copying.
+ *
+ * @param data Pointer to `width * height * channels` floats, channel innermost.
+ * @param width Image width.
+ * @param height Image height.
+ * @param channels Number of channels.
+ * @return A buffer view with interleaved strides.
+ */
+[[nodiscard]] inline Halide::Buffer<float> wrapInterleaved(float* data, int width, int height, int channels)
+{
+    return Halide::Buffer<float>::make_interleaved(data, width, height, channels);
+}
+
+/**
+ * @brief Wraps a read-only image view without copying, using the view's own strides.
+ *
+ * @param view A valid view. The buffer does not extend its lifetime: keep the view alive.
+ * @return A const buffer over the viewed elements.
+ */
+[[nodiscard]] inline Halide::Buffer<const float> wrapView(const Common::ImageView& view)
+{
+    const halide_dimension_t shape[3] = {
+        {0, static_cast<int32_t>(view.m_width), static_cast<int32_t>(view.m_x_stride), 0},
+        {0, static_cast<int32_t>(view.m_height), static_cast<int32_t>(view.m_y_stride), 0},
+        {0, static_cast<int32_t>(view.m_channels), static_cast<int32_t>(view.m_c_stride), 0},
+    };
+    return Halide::Buffer<const float>(view.m_data.data(), 3, shape);
+}
+
+/**
+ * @brief Allocates a new interleaved buffer.
+ */
+[[nodiscard]] inline Halide::Buffer<float> allocateInterleaved(int width, int height, int channels)
+{
+    return Halide::Buffer<float>::make_interleaved(width, height, channels);
+}
+
+/**
+ * @brief Allocates a new interleaved buffer of the given element type.
+ */
+[[nodiscard]] inline Halide::Buffer<> allocateInterleaved(Halide::Type type, int width, int height, int channels)
+{
+    return Halide::Buffer<>::make_interleaved(type, width, height, channels);
+}
+
+/**
+ * @brief Allocates a new buffer of the given element type and layout.
+ * @details Planar buffers are dense: x stride 1, y stride `width`, c stride `width * height`.
+ */
+[[nodiscard]] inline Halide::Buffer<> allocate(Halide::Type type, int width, int height, int channels,
+                                               Common::PixelLayout layout)
+{
+    return layout == Common::PixelLayout::Planar ? Halide::Buffer<>(type, width, height, channels)
+                                                 : allocateInterleaved(type, width, height, channels);
+}
+
+/**
+ * @brief Halide element type used to store a working image of the given format.
+ * @return `Float(16)` for `RGBA_F16`, `Float(32)` otherwise.
+ */
+[[nodiscard]] inline Halide::Type storageType(Common::PixelFormat format) noexcept
+{
+    return format == Common::PixelFormat::RGBA_F16 ? Halide::Float(16) : Halide::Float(32);
+}
+
+/**
+ * @brief Checks whether a buffer uses the interleaved layout.
+ */
+[[nodiscard]] inline bool isInterleaved(const Halide::Buffer<>& buffer) noexcept
+{
+    return buffer.defined()
+           && buffer.dimensions() == 3
+           && buffer.dim(2).stride() == 1
+           && buffer.dim(0).stride() == buffer.channels();
+}
+
+/**
+ * @brief Checks whether a buffer uses the dense planar layout.
+ */
+[[nodiscard]] inline bool isPlanar(const Halide::Buffer<>& buffer) noexcept
+{
+    return buffer.defined()
+           && buffer.dimensions() == 3
+           && buffer.dim(0).stride() == 1
+           && buffer.dim(1).stride() == buffer.width()
+           && buffer.dim(2).stride() == buffer.width() * buffer.height();
+}
+
+/**
+ * @brief Layout of a buffer: planar if `isPlanar`, interleaved otherwise.
+ */
+[[nodiscard]] inline Common::PixelLayout layoutOf(const Halide::Buffer<>& buffer) noexcept
+{
+    return isPlanar(buffer) ? Common::PixelLayout::Planar : Common::PixelLayout::Interleaved;
+}
+
+/**
+ * @brief Checks whether a buffer uses the given layout.
+ */
+[[nodiscard]] inline bool hasLayout(const Halide::Buffer<>& buffer, Common::PixelLayout layout) noexcept
+{
+    return layout == Common::PixelLayout::Planar ? isPlanar(buffer) : isInterleaved(buffer);
+}
+
+/**
+ * @brief Declares the interleaved RGBA layout on a pipeline input or output.
+ *
+ * @details
+ * Fixes the channel extent to `k_interleaved_channels`, the channel stride to 1 and the
+ * x stride to the channel count. Buffers passed at run time must match (see `wrapInterleaved`).
+ */
+inline void constrainInterleaved(Halide::OutputImageParam param)
+{
+    param.dim(0).set_stride(k_interleaved_channels);
+    param.dim(2).set_min(0).set_extent(k_interleaved_channels).set_stride(1);
+}
+
+/**
+ * @brief Declares the planar RGBA layout on a pipeline input or output.
+ *
+ * @details
+ * Fixes the channel extent to `k_interleaved_channels` and the x stride to 1, so that the
+ * vectorized loads and stores of each channel are dense. Buffers passed at run time must
+ * match (see `allocate`).
+ */
+inline void constrainPlanar(Halide::OutputImageParam param)
+{
+    param.dim(0).set_stride(1);
+    param.dim(2).set_min(0).set_extent(k_interleaved_channels);
+}
+
+/**
+ * @brief Declares `layout` on a pipeline input or output (`constrainInterleaved` or `constrainPlanar`).
+ */
+inline void constrainLayout(Halide::OutputImageParam param, Common::PixelLayout layout)
+{
+    if (layout == Common::PixelLayout::Planar) {
+        constrainPlanar(param);
+    } else {
+        constrainInterleaved(param);
+    }
+}
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
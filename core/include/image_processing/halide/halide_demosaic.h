@@ -0,0 +1,173 @@
+/**
+ * @file halide_demosaic.h
+ * @brief Declaration of RawMosaic and HalideDemosaic (Bayer demosaic of a resident mosaic).
+ *
+ * @details
+ * A RAW file is read once into a `RawMosaic`: the undemosaiced 16-bit sensor samples, one per
+ * photosite, with the layout of the color filter array and the black and white levels. The
+ * mosaic is half the size of an RGB decode in half floats and is kept resident, so every
+ * later demosaic (draft, full quality) starts from memory instead of the file.
+ *
+ * `HalideDemosaic` is a parameterized Halide pipeline, JIT-compiled once per target:
+ * - Half size (drafts, proxies): each 2x2 CFA quad becomes one pixel (red and blue samples,
+ *   average of the two greens). No interpolation, no false color.
+ * - Full size: Malvar-He-Cutler gradient-corrected bilinear interpolation (5x5 kernels).
+ *
+ * The output is camera-native linear RGBA (black level removed, white level at 1, no white
+ * balance), like the camera-native LibRaw decode.
+ *
+ * - GPU: one thread per output pixel.
+ * - CPU: parallel over row strips, vectorized across pixels.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+
+#include "Halide.h"
+
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @enum CfaPattern
+ * @brief Colors of the top-left 2x2 quad of a Bayer mosaic, row by row.
+ */
+enum class CfaPattern : std::uint8_t {
+    RGGB = 0,
+    GRBG = 1,
+    GBRG = 2,
+    BGGR = 3
+};
+
+/**
+ * @struct RawMosaic
+ * @brief Undemosaiced sensor samples of a RAW file.
+ */
+struct RawMosaic {
+    /**
+     * @brief One sample per photosite, row-major.
+     */
+    std::vector<std::uint16_t> m_data;
+
+    /**
+     * @brief Dimensions, in photosites.
+     */
+    Common::ImageDim m_width{0};
+    Common::ImageDim m_height{0};
+
+    /**
+     * @brief Layout of the color filter array.
+     */
+    CfaPattern m_pattern{CfaPattern::RGGB};
+
+    /**
+     * @brief Sample value of no light.
+     */
+    float m_black_level{0.0f};
+
+    /**
+     * @brief Sample value of a saturated photosite.
+     */
+    float m_white_level{65535.0f};
+
+    /**
+     * @brief Checks that the samples cover the dimensions and the levels are ordered.
+     */
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_width >= 2 && m_height >= 2
+            && m_data.size() == static_cast<std::size_t>(m_width) * m_height
+            && m_white_level > m_black_level;
+    }
+};
+
+/**
+ * @class HalideDemosaic
+ * @brief Reusable, compiled-once Halide Bayer demosaic.
+ *
+ * @note Not thread-safe: callers serialize `run` on an instance.
+ */
+class HalideDemosaic {
+public:
+    /**
+     * @brief Constructs the demosaic. Compilation is deferred to the first `run`.
+     */
+    HalideDemosaic();
+
+    /**
+     * @brief Demosaics `mosaic` into `output`.
+     *
+     * @details
+     * On a GPU target the mosaic is uploaded and the result is copied back to the host.
+     *
+     * @param mosaic The sensor samples.
+     * @param output Interleaved RGBA destination of `width x height` pixels, or of
+     *        `width / 2 x height / 2` pixels with `half_size`.
+     * @param half_size Superpixel demosaic at half resolution instead of a full one.
+     * @param target Target to run on. The pipeline is recompiled only if it changes.
+     * @return void on success, `InvalidImageRegion` / `InvalidHalideBuffer` for a bad mosaic or
+     *         output, or `Unexpected` on a Halide error.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    run(const RawMosaic& mosaic, Halide::Buffer<float>& output, bool half_size, const Halide::Target& target);
+
+private:
+    /**
+     * @brief Defines, schedules and JIT-compiles the pipeline for `target`.
+     */
+    void build(const Halide::Target& target);
+
+    /**
+     * @brief Sensor samples.
+     */
+    Halide::ImageParam m_mosaic;
+
+    /**
+     * @brief Black level, and the inverse of the white level above it.
+     */
+    Halide::Param<float> m_black;
+    Halide::Param<float> m_scale;
+
+    /**
+     * @brief Offsets bringing the mosaic to RGGB: red photosites are where
+     *        `(x + phase_x)` and `(y + phase_y)` are both even.
+     */
+    Halide::Param<int> m_phase_x;
+    Halide::Param<int> m_phase_y;
+
+    /**
+     * @brief Selects the superpixel path (half size) instead of the full interpolation.
+     */
+    Halide::Param<bool> m_half_size;
+
+    /**
+     * @brief The compiled output stage.
+     */
+    Halide::Func m_output;
+
+    /**
+     * @brief Target `m_output` was compiled for, if any.
+     */
+    std::optional<Halide::Target> m_compiled_target;
+
+    /**
+     * @brief GPU tile shape `m_output` was compiled with (GPU targets only).
+     */
+    GpuTileSchedule m_compiled_schedule;
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
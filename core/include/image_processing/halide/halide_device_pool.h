@@ -0,0 +1,191 @@
+/**
+ * @file halide_device_pool.h
+ * @brief Declaration of HalideDevicePool (recycling of device-resident Halide buffers).
+ *
+ * @details
+ * Opening an image on the GPU backend allocates its source buffer on the device, and every
+ * new display size reallocates the downsample staging buffer. Each realization also allocates
+ * the device intermediates of its pipeline. With Halide's default runtime every one of these
+ * is a driver allocation and a free, which on some drivers costs more than the kernel.
+ *
+ * Two levels of reuse:
+ * - **Runtime**: `halide_reuse_device_allocations` is enabled for the JIT runtimes. A device
+ *   allocation freed by Halide (pipeline intermediates, buffers dropped by their owner) goes to
+ *   the runtime's own free list and serves the next allocation that fits.
+ * - **Buffers**: buffers released to the pool keep their device allocation and host mirror, on
+ *   free lists bucketed by size class (`Common::BufferPool::sizeClass`). The next `acquire` of
+ *   the same type and shape gets one back without allocating: switching between photos of one
+ *   camera, or between two display sizes, no longer reaches the driver.
+ *
+ * The pool is registered with `Common::MemoryBudget` (device allocations and their host
+ * mirrors). Under pressure, or when a device allocation fails, `trim` drops the parked buffers
+ * and asks the runtimes to release their unused allocations (`halide_device_release_unused`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @class HalideDevicePool
+ * @brief Process-wide, thread-safe recycler of interleaved device-resident Halide buffers.
+ */
+class HalideDevicePool {
+public:
+    /**
+     * @brief Default upper bound on the bytes parked (device allocations plus host mirrors).
+     */
+    static constexpr std::size_t k_default_max_cached_bytes = std::size_t{1} * 1024 * 1024 * 1024;
+
+    /**
+     * @brief Returns the process-wide pool.
+     */
+    [[nodiscard]] static HalideDevicePool& instance();
+
+    /**
+     * @brief Returns an interleaved buffer of the given type and shape.
+     * @details The first call for a device enables the runtime's allocation reuse. A parked
+     *          buffer of the same type and shape, allocated on the device of `target` and on the
+     *          calling thread's GPU (`GpuDevices`), is returned with its device allocation
+     *          (contents undefined); otherwise a new host-only buffer is allocated on
+     *          page-locked memory (`allocatePinnedInterleaved`).
+     * @throws std::bad_alloc if the host allocation fails.
+     */
+    [[nodiscard]] Halide::Buffer<> acquire(Halide::Type type, int width, int height, int channels,
+                                           const Halide::Target& target);
+
+    /**
+     * @brief Parks a buffer obtained from `acquire` for reuse, on the calling thread's GPU.
+     * @details Only device-resident buffers are kept, within the cache limit; others are dropped.
+     *          The caller must hand over its last reference.
+     */
+    void release(Halide::Buffer<>&& buffer) noexcept;
+
+    /**
+     * @brief Drops every parked buffer and releases the runtimes' unused device allocations.
+     * @return The parked bytes dropped.
+     */
+    std::size_t trim() noexcept;
+
+    /**
+     * @brief Sets the upper bound on parked bytes, trimming if the pool is already above it.
+     */
+    void setMaxCachedBytes(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Bytes currently parked (device allocations plus host mirrors).
+     */
+    [[nodiscard]] std::size_t cachedBytes() const noexcept;
+
+    /**
+     * @brief Number of `acquire` calls served by a parked buffer since startup.
+     */
+    [[nodiscard]] std::size_t reuseCount() const noexcept;
+
+    /**
+     * @brief Number of `acquire` calls that allocated a new buffer since startup.
+     */
+    [[nodiscard]] std::size_t allocationCount() const noexcept;
+
+    HalideDevicePool(const HalideDevicePool&) = delete;
+    HalideDevicePool& operator=(const HalideDevicePool&) = delete;
+
+private:
+    /**
+     * @brief Private: use `instance()`. Never destroyed, so that working images destroyed
+     *        during shutdown can still release into it.
+     */
+    HalideDevicePool() = default;
+
+    /**
+     * @brief Bytes a parked buffer holds: its device allocation and its host mirror.
+     */
+    [[nodiscard]] static std::size_t footprintOf(const Halide::Buffer<>& buffer) noexcept;
+
+    /**
+     * @brief Device interface `copy_to_device(target)` allocates on, nullptr if the target has no GPU.
+     */
+    [[nodiscard]] static const halide_device_interface_t* deviceInterfaceOf(const Halide::Target& target) noexcept;
+
+    /**
+     * @brief Drops the oldest parked buffers until `m_cached_bytes <= limit`. Caller holds `m_mutex`.
+     */
+    void evict_unsafe(std::size_t limit) noexcept;
+
+    /**
+     * @brief Asks the JIT runtimes to free the device allocations on their reuse lists.
+     */
+    static void releaseUnusedDeviceMemory() noexcept;
+
+    /**
+     * @brief Guards the free lists and counters.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @struct Parked
+     * @brief A parked buffer and the GPU it is allocated on.
+     */
+    struct Parked {
+        /**
+         * @brief The buffer, with its device allocation.
+         */
+        Halide::Buffer<> m_buffer;
+
+        /**
+         * @brief Device of the allocation (`GpuDevices`), only reused on that device.
+         */
+        std::size_t m_device{0};
+    };
+
+    /**
+     * @brief Parked buffers by size class of their element bytes, oldest first.
+     */
+    std::unordered_map<std::size_t, std::vector<Parked>> m_free_lists;
+
+    /**
+     * @brief Size classes in parking order (oldest first), one entry per parked buffer.
+     */
+    std::vector<std::size_t> m_parking_order;
+
+    /**
+     * @brief Device interfaces whose runtime has allocation reuse enabled.
+     */
+    std::vector<const halide_device_interface_t*> m_reuse_interfaces;
+
+    /**
+     * @brief Sum of the footprints of the parked buffers.
+     */
+    std::size_t m_cached_bytes{0};
+
+    /**
+     * @brief Cache limit.
+     */
+    std::size_t m_max_cached_bytes{k_default_max_cached_bytes};
+
+    /**
+     * @brief `acquire` calls served by a parked buffer.
+     */
+    std::size_t m_reuses{0};
+
+    /**
+     * @brief `acquire` calls that allocated.
+     */
+    std::size_t m_allocations{0};
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
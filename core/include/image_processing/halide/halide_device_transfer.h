@@ -0,0 +1,93 @@
+/**
+ * @file halide_device_transfer.h
+ * @brief Device-side copies between Halide buffers (no host round trip).
+ *
+ * @details
+ * `Halide::Buffer::copy_from` only works on host memory: copying a GPU-resident buffer
+ * with it costs a full download, a host copy and a full upload. These helpers use the
+ * device interface of the source buffer instead, so that device-resident working images
+ * only cross the PCIe bus when the host actually needs the pixels.
+ *
+ * Buffers that are transferred repeatedly (pooled sources, display and export staging) are
+ * allocated with page-locked host memory (`allocatePinnedInterleaved`), so that their
+ * transfers never fault pages in.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @brief Allocates an interleaved buffer on page-locked host memory (`Common::acquirePinned`).
+ * @details Falls back to pageable memory when the system refuses the lock.
+ * @throws std::bad_alloc if the allocation fails.
+ */
+[[nodiscard]] Halide::Buffer<> allocatePinnedInterleaved(Halide::Type type, int width, int height, int channels);
+
+/**
+ * @brief Checks whether a buffer holds its up-to-date content on a device.
+ * @return true if the buffer has a device allocation and its host copy is not newer.
+ */
+[[nodiscard]] bool isDeviceResident(const Halide::Buffer<>& buffer) noexcept;
+
+/**
+ * @brief Copies `source` into `destination` on the device.
+ *
+ * @details
+ * Allocates `destination` on the device of `source` if needed. On success, `destination`
+ * is marked device-dirty: its host memory is stale until the next `copy_to_host`.
+ *
+ * The buffers may hold any element type (float or half working images); `destination`
+ * is a handle sharing storage with the caller's buffer.
+ *
+ * @pre Both buffers have the same shape and element type.
+ * @return true on success, false if `source` is not device-resident or the copy failed.
+ */
+[[nodiscard]] bool copyOnDevice(const Halide::Buffer<>& source, Halide::Buffer<> destination);
+
+/**
+ * @brief Downloads a device-resident buffer straight into the host memory of another buffer.
+ *
+ * @details
+ * Unlike `copy_to_host` followed by a host copy, this performs a single transfer and
+ * leaves `source` untouched (still device-resident, host copy still stale).
+ *
+ * @pre Both buffers have the same shape and element type. `destination` has host memory.
+ * @return true on success, false if `source` is not device-resident or the copy failed.
+ */
+[[nodiscard]] bool downloadInto(const Halide::Buffer<>& source, Halide::Buffer<> destination);
+
+/**
+ * @brief Native Metal buffer behind a device-resident Halide buffer.
+ */
+struct MetalBufferHandle {
+    std::uintptr_t m_buffer{0};  ///< `id<MTLBuffer>`, owned by the Halide buffer
+    std::size_t m_offset{0};     ///< Byte offset of the Halide buffer's first element
+};
+
+/**
+ * @brief Gets the native Metal buffer of a device-resident buffer, for zero-copy interop.
+ *
+ * @details
+ * Reads the device handle the way `halide_metal_get_buffer` / `halide_metal_get_crop_offset`
+ * do: those accessors live in the JIT runtime module and cannot be called from host code.
+ * The handle stays valid as long as a copy of `buffer` is alive.
+ *
+ * @return The handle, or `std::nullopt` if the buffer is not resident on a Metal device.
+ */
+[[nodiscard]] std::optional<MetalBufferHandle> metalBufferOf(const Halide::Buffer<>& buffer);
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
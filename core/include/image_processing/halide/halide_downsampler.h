@@ -0,0 +1,130 @@
+/**
+ * @file halide_downsampler.h
+ * @brief Declaration of HalideDownsampler (filtered display downsample).
+ *
+ * @details
+ * The display image is produced on every edit, so it must be cheap and free of aliasing.
+ * This class holds a parameterized Halide pipeline (box filter over the source footprint
+ * of each output pixel, or bilinear for small reductions) that is JIT-compiled once per
+ * target and then reused for any source or display size: only the `Halide::Param` values
+ * and the bound buffers change.
+ *
+ * - GPU: one thread per display pixel.
+ * - CPU: parallel over row strips, vectorized across pixels.
+ *
+ * The output uses the interleaved RGBA layout (see `halide_buffer_layout.h`); the source is
+ * interleaved or planar, so that planar working images are interleaved by the downsample itself.
+ * The source may store floats or halves (the filter computes in float); the output is float.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/pixel_format.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+
+#include "Halide.h"
+
+#include <expected>
+#include <optional>
+
+namespace CaptureMoment::Core {
+
+namespace ImageProcessing {
+
+/**
+ * @class HalideDownsampler
+ * @brief Reusable, compiled-once Halide downsample kernel.
+ *
+ * @note Not thread-safe: one instance per working image.
+ */
+class HalideDownsampler {
+public:
+    /**
+     * @brief Reduction factor from which area averaging replaces bilinear filtering.
+     * @details Below 2x, a 2x2 box is coarser than bilinear and both are alias-free.
+     */
+    static constexpr float k_area_average_threshold = 2.0f;
+
+    /**
+     * @brief Constructs the downsampler. Compilation is deferred to the first `run`.
+     */
+    HalideDownsampler();
+
+    /**
+     * @brief Downsamples `input` into `output`.
+     *
+     * @details
+     * For reductions of at least `k_area_average_threshold`, each output pixel averages the
+     * `ceil(scale)` x `ceil(scale)` source pixels centered on its footprint; smaller reductions
+     * use bilinear interpolation. Edges are clamped. On a GPU target the result stays on the
+     * device; the caller decides when to copy it to the host.
+     *
+     * @param input Interleaved or planar RGBA source (host or device-resident), Float(32) or Float(16).
+     * @param output Interleaved RGBA destination; its extent defines the display size.
+     * @param target Target to run on. The pipeline is recompiled only if it (or the input type or layout) changes.
+     * @return void on success, or `InvalidHalideBuffer` / `Unexpected` on failure.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    run(const Halide::Buffer<>& input, Halide::Buffer<float>& output, const Halide::Target& target);
+
+private:
+    /**
+     * @brief Defines, schedules and JIT-compiles the pipeline for `target` and an input of `input_type` in `input_layout`.
+     */
+    void build(const Halide::Target& target, const Halide::Type& input_type, Common::PixelLayout input_layout);
+
+    /**
+     * @brief Source image.
+     */
+    Halide::ImageParam m_input;
+
+    /**
+     * @brief Source pixels per output pixel, horizontally and vertically.
+     */
+    Halide::Param<float> m_scale_x;
+    Halide::Param<float> m_scale_y;
+
+    /**
+     * @brief Filter footprint, in source pixels.
+     */
+    Halide::Param<int> m_taps_x;
+    Halide::Param<int> m_taps_y;
+
+    /**
+     * @brief Selects the bilinear path (small reductions) instead of area averaging.
+     */
+    Halide::Param<bool> m_bilinear;
+
+    /**
+     * @brief The compiled output stage.
+     */
+    Halide::Func m_output;
+
+    /**
+     * @brief Target `m_output` was compiled for, if any.
+     */
+    std::optional<Halide::Target> m_compiled_target;
+
+    /**
+     * @brief GPU tile shape `m_output` was compiled with (GPU targets only).
+     */
+    GpuTileSchedule m_compiled_schedule;
+
+    /**
+     * @brief Element type of the input `m_output` was compiled for.
+     */
+    Halide::Type m_compiled_input_type{Halide::Float(32)};
+
+    /**
+     * @brief Layout of the input `m_output` was compiled for.
+     */
+    Common::PixelLayout m_compiled_input_layout{Common::PixelLayout::Interleaved};
+};
+
+} // namespace ImageProcessing
+
+} // namespace CaptureMoment::Core
@@ -9,9 +9,14 @@
 
 #include <vector>
 #include <cstddef>
+#include <expected>
+#include <memory>
 #include <span>
 
 #include "common/image_region.h"
+#include "common/image_view.h"
+#include "common/error_handling/core_error.h"
+#include "common/pixel_format.h"
 #include "common/types/image_types.h"
 
 #include "Halide.h"
@@ -26,6 +31,29 @@ namespace ImageProcessing {
  * This abstract base class manages the shared Halide buffer infrastructure
  * used by both CPU and GPU working image implementations. It provides the
  * common interface for direct buffer access during pipeline execution.
+ *
+ * **Double Buffering:**
+ * Two buffers of identical shape are maintained:
+ * - **Source** (`m_halide_source_buffer`): Snapshot of the last image uploaded via
+ *   `updateFromCPU`. Read-only input of the fused pipeline.
+ * - **Destination** (`m_halide_buffer`): Output of the fused pipeline, zero-copy view
+ *   over `WorkingImageData::m_data`. This is what export/downsample read.
+ *
+ * Because the pipeline never reads what it writes, re-running it does not require
+ * restoring the original first, and spatial (neighbourhood) operations are safe.
+ *
+ * **Storage Format:**
+ * - `RGBA_F32` (default): the destination is a view over `WorkingImageData::m_data`.
+ * - `RGBA_F16`: both buffers own half-float storage and `m_data` stays empty, halving
+ *   the footprint and the bandwidth of every pass. Pipelines widen to float on load.
+ *
+ * The buffers are therefore type-erased (`Halide::Buffer<>`); check `type()` or
+ * `getStorageFormat()` before converting to a typed buffer.
+ *
+ * **Storage Layout:**
+ * Both buffers are interleaved by default. A derived class may store them planar
+ * (`getStorageLayout()`, see `AppConfig::setWorkingPixelLayout`): the image is split into
+ * planes once at upload, and the exports (`makeHostView`, `copyToInterleaved`) interleave it again.
  */
 class WorkingImageHalide {
 public:
@@ -37,22 +65,60 @@ public:
     /**
      * @brief Gets a reference to the internal Halide buffer managed by this object.
      *
-     * This method provides direct access to the underlying Halide::Buffer<float>
-     * that holds the image data. The buffer shares memory with the internal m_data vector,
-     * allowing in-place modifications during pipeline execution. This enables the pipeline
-     * to operate directly on the managed data without requiring intermediate copies.
+     * This method provides direct access to the underlying Halide buffer
+     * that holds the image data. In `RGBA_F32` storage the buffer shares memory with the
+     * internal m_data vector, allowing in-place modifications during pipeline execution
+     * without intermediate copies.
+     *
+     * @return A Halide buffer (Float(32) or Float(16) elements) that references the internal data storage.
+     */
+    [[nodiscard]] Halide::Buffer<> getHalideBuffer() const { return m_halide_buffer; };
+
+    /**
+     * @brief Gets the source (pipeline input) buffer.
+     *
+     * @details
+     * Holds the image as last uploaded via `updateFromCPU`. Pipelines bind this buffer
+     * as their input and realize into `getHalideBuffer()`.
      *
-     * @return A Halide::Buffer<float> object that references the internal data storage.
-     * The returned buffer points to the same memory location as m_data.
+     * @return A Halide buffer referencing the source storage (same element type as `getHalideBuffer()`).
+     */
+    [[nodiscard]] Halide::Buffer<> getHalideSourceBuffer() const { return m_halide_source_buffer; };
+
+    /**
+     * @brief Gets the element format the buffers are stored in.
+     * @return `RGBA_F32` or `RGBA_F16`.
      */
-    [[nodiscard]] Halide::Buffer<float> getHalideBuffer() const { return m_halide_buffer; };
+    [[nodiscard]] Common::PixelFormat getStorageFormat() const noexcept { return m_storage_format; };
+
+    /**
+     * @brief Gets the layout the buffers are stored in.
+     * @return `Interleaved` or `Planar`.
+     */
+    [[nodiscard]] Common::PixelLayout getStorageLayout() const noexcept { return m_storage_layout; };
 
 protected:
     /**
-     * @brief Internal Halide buffer holding the image data.
+     * @brief Internal Halide buffer holding the image data (pipeline destination).
      * Managed directly by this object. Halide::Buffer handles its own memory allocation/deallocation.
      */
-    Halide::Buffer<float> m_halide_buffer;
+    Halide::Buffer<> m_halide_buffer;
+
+    /**
+     * @brief Snapshot of the uploaded image, used as the pipeline input (pipeline source).
+     * Owns its storage; reallocated only when the image dimensions change.
+     */
+    Halide::Buffer<> m_halide_source_buffer;
+
+    /**
+     * @brief Element format of both buffers. Set by derived classes before the first upload.
+     */
+    Common::PixelFormat m_storage_format{Common::PixelFormat::RGBA_F32};
+
+    /**
+     * @brief Layout of both buffers. Set by derived classes before the first upload.
+     */
+    Common::PixelLayout m_storage_layout{Common::PixelLayout::Interleaved};
 
     /**
      * @brief Protected constructor to prevent direct instantiation.
@@ -67,6 +133,10 @@ protected:
      * pixel data span. This method should be called by derived classes after
      * they have allocated and populated their data buffer.
      *
+     * **Layout:**
+     * Interleaved data (`RGBARGBA...`) is viewed with channel-innermost strides, planar data
+     * with x-innermost strides (see `halide_buffer_layout.h`). The source snapshot uses the same layout.
+     *
      * **Safety:**
      * Uses `std::span<float>` instead of raw pointer for bounds safety
      * and compatibility with any contiguous container.
@@ -75,11 +145,69 @@ protected:
      * @param width Image width in pixels.
      * @param height Image height in pixels.
      * @param channels Number of color channels.
+     * @param layout Layout of `data`.
      *
      * @pre !data.empty()
      * @post m_halide_buffer references the provided data
      */
-    void initializeHalide(std::span<float> data, Common::ImageDim width, Common::ImageDim height, Common::ImageChan channels);
+    void initializeHalide(std::span<float> data, Common::ImageDim width, Common::ImageDim height, Common::ImageChan channels,
+                          Common::PixelLayout layout = Common::PixelLayout::Interleaved);
+
+    /**
+     * @brief Allocates (or reuses) a half-float destination buffer and converts `cpu_image` into it.
+     *
+     * @details
+     * Used instead of `initializeHalide` in `RGBA_F16` storage. The conversion rounds to
+     * nearest; values beyond the half range saturate to infinity.
+     *
+     * @param cpu_image The float source image. Must be valid and interleaved.
+     * @post m_halide_buffer is a dense Float(16) buffer in `m_storage_layout` holding the image
+     */
+    void initializeHalideHalf(const Common::ImageRegion& cpu_image);
+
+    /**
+     * @brief Widens a host half-float interleaved buffer into float storage.
+     *
+     * @param source Float(16) buffer with up-to-date host memory.
+     * @param destination Span of `source.number_of_elements()` floats.
+     */
+    static void convertHalfToFloat(const Halide::Buffer<>& source, std::span<float> destination);
+
+    /**
+     * @brief Copies a host buffer of any storage format and layout into interleaved floats.
+     *
+     * @param source Float(32) or Float(16) buffer with up-to-date host memory.
+     * @param destination Span of `source.number_of_elements()` floats, filled interleaved.
+     */
+    static void copyToInterleaved(const Halide::Buffer<>& source, std::span<float> destination);
+
+    /**
+     * @brief Builds a read-only view over the host side of `m_halide_buffer`.
+     *
+     * @details
+     * - `RGBA_F32`: views `float_storage` (the derived class' `m_data`, which the destination
+     *   wraps) and keeps it alive; no copy.
+     * - `RGBA_F16` or planar storage: widens (interleaves) the pixels into a pooled float
+     *   buffer owned by the view.
+     *
+     * @param float_storage Storage the F32 destination wraps (ignored in half-float storage).
+     * @return The view, `InvalidWorkingImage` if the buffer is undefined, or `AllocationFailed`.
+     * @pre The host memory of `m_halide_buffer` is up to date.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError>
+    makeHostView(const std::shared_ptr<float[]>& float_storage) const;
+
+    /**
+     * @brief Snapshots the destination buffer into the source buffer.
+     *
+     * @details
+     * Must be called after `initializeHalide` whenever new image content is uploaded.
+     * The existing source allocation is reused when the shape is unchanged.
+     *
+     * @pre m_halide_buffer.defined()
+     * @post m_halide_source_buffer holds a copy of m_halide_buffer
+     */
+    void initializeHalideSource();
 
     /**
      * @brief
@@ -100,7 +228,7 @@ protected:
 
     /**
      * @brief Gets the total data element count from the Halide buffer.
-     * @return width × height × channels (total float elements), or 0 if buffer undefined.
+     * @return width × height × channels (total elements, whatever the storage format), or 0 if buffer undefined.
      */
     [[nodiscard]] Common::ImageSize getDataSizeByHalide() const noexcept;
 
@@ -45,6 +45,21 @@
 // --- Base Classes Halide ---
 #include "image_processing/halide/working_image_halide.h"
 
+/**
+ * @brief Interleaved RGBA layout helpers shared by buffers and pipelines.
+ */
+#include "image_processing/halide/halide_buffer_layout.h"
+
+/**
+ * @brief Device-side buffer copies for GPU-resident working images.
+ */
+#include "image_processing/halide/halide_device_transfer.h"
+
+/**
+ * @brief Compiled-once, filtered display downsample kernel.
+ */
+#include "image_processing/halide/halide_downsampler.h"
+
 // --- CPU Implementations ---
 #include "image_processing/cpu/working_image_cpu_default.h"
 #include "image_processing/cpu/working_image_cpu_halide.h"
@@ -85,6 +100,18 @@
  */
 #include "image_processing/deciders/benchmarking_backend_decider.h"
 
+/**
+ * @brief On-disk cache of the backend decision.
+ * Skips the startup benchmark while the machine fingerprint is unchanged.
+ */
+#include "image_processing/deciders/backend_decision_cache.h"
+
+/**
+ * @brief Per-image CPU/GPU selection from the benchmark measurements.
+ * Used by WorkingImageFactory to pick the backend from the image size.
+ */
+#include "image_processing/deciders/backend_cost_model.h"
+
 
 // ============================================================
 // 5. Contexts
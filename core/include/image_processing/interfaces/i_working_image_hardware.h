@@ -21,6 +21,7 @@
 
 #include "common/types/memory_type.h"
 #include "common/image_region.h"
+#include "common/image_view.h"
 #include "common/error_handling/core_error.h"
 #include "common/types/image_types.h"
 
@@ -66,16 +67,33 @@ public:
      *
      * **Performance Note:**
      * This method involves memory allocation and data copying. For large images,
-     * prefer `exportToCPUMove()` when the working image data is no longer needed.
+     * prefer `exportToCPUView()` when read-only access is enough.
      *
      * @return std::expected<std::unique_ptr<Common::ImageRegion>, std::error_code>
      *         Unique pointer to copied data on success.
      *
-     * @see exportToCPUMove() For zero-copy transfer when working image can be invalidated.
+     * @see exportToCPUView() For read-only access without a copy.
      */
     [[maybe_unused]] [[nodiscard]] virtual std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     exportToCPUCopy() = 0;
 
+    /**
+     * @brief Exports a read-only view over current internal image data (Zero-Copy).
+     *
+     * @details
+     * The view points into the image's own host storage and keeps that storage alive.
+     * Host-side float implementations hand out their buffer directly. Device-resident
+     * images are first synchronized into their host mirror (one transfer, no allocation).
+     * Half-float storage has no float buffer to share and is widened into a pooled copy.
+     *
+     * @return std::expected<Common::ImageView, CoreError> The view on success,
+     *         `InvalidWorkingImage` if the image holds no valid data.
+     *
+     * @see Common::ImageView for the lifetime and aliasing rules.
+     */
+    [[nodiscard]] virtual std::expected<Common::ImageView, ErrorHandling::CoreError>
+    exportToCPUView() = 0;
+
     /**
      * @brief Exports a downscaled version of the image directly from GPU.
      *
@@ -61,11 +61,67 @@ public:
      * If a WorkingImage already exists with the same dimensions, it is reused.
      * Otherwise, a new WorkingImage is created.
      * 
+     * The original tile is kept resident (immutable, shared) so that subsequent
+     * edits can restore the WorkingImage without re-reading the source file.
+     *
      * @param original_tile The original image data to initialize the WorkingImage with.
      * @return true if preparation was successful, false if there was an error (e.g. creation failed).
      */
     [[nodiscard]] bool prepare(std::unique_ptr<Common::ImageRegion>&& original_tile);
 
+    /**
+     * @brief Prepares a WorkingImage from an original shared with other contexts.
+     *
+     * @details
+     * Used by a virtual copy: the resident original is the other context's, not a copy.
+     * Only the WorkingImage is allocated.
+     *
+     * @param original_tile The shared, immutable original image data.
+     * @return true if preparation was successful, false if the tile is null or creation failed.
+     */
+    [[nodiscard]] bool prepare(std::shared_ptr<const Common::ImageRegion> original_tile);
+
+    /**
+     * @brief Restores the WorkingImage content from the resident original.
+     *
+     * @details
+     * Re-uploads the in-memory original into the WorkingImage (reusing its allocation)
+     * without touching the SourceManager. Needed only when the original changes,
+     * e.g. after a commit; regular edits read the WorkingImage source buffer directly.
+     *
+     * @return true if the restore was successful, false if no original or WorkingImage exists.
+     */
+    [[nodiscard]] bool restoreOriginal();
+
+    /**
+     * @brief Replaces the resident original with new image data.
+     *
+     * @details
+     * Used after a commit, when the processed result becomes the new baseline
+     * for future edits. The WorkingImage itself is left untouched.
+     *
+     * @param original_tile The new original image data.
+     * @return true if the original was replaced, false if the tile is null or invalid.
+     */
+    [[nodiscard]] bool setOriginal(std::unique_ptr<Common::ImageRegion>&& original_tile);
+
+    /**
+     * @brief Replaces the resident original with image data shared with its other owners.
+     *
+     * @details
+     * Used by a commit whose pixels also back the source: one buffer, two readers.
+     *
+     * @param original_tile The new original image data.
+     * @return true if the original was replaced, false if the tile is null or invalid.
+     */
+    [[nodiscard]] bool setOriginal(std::shared_ptr<const Common::ImageRegion> original_tile);
+
+    /**
+     * @brief Gets the resident original image.
+     * @return Shared, read-only pointer to the original image, or nullptr if none is loaded.
+     */
+    [[nodiscard]] std::shared_ptr<const Common::ImageRegion> getOriginalImage() const noexcept;
+
     /**
      * @brief Updates the existing WorkingImage with new image data.
      * 
@@ -96,6 +152,17 @@ public:
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     getWorkingImageAsRegion() const;
 
+    /**
+     * @brief Exports a read-only view over the WorkingImage data (Zero-Copy).
+     *
+     * Calls exportToCPUView() on the managed WorkingImage. Prefer this over
+     * getWorkingImageAsRegion() whenever the caller does not need to own or modify the pixels.
+     *
+     * @return The view, or `InvalidWorkingImage` if no WorkingImage is ready.
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError>
+    getWorkingImageView() const;
+
     /**
      * @brief Gets the WorkingImage for processing.
      * @return Reference to the IWorkingImageHardware instance, or an error if not ready.
@@ -128,6 +195,12 @@ private:
      * Managed WorkingImage instance (hardware abstraction). 
      * */
     std::shared_ptr<IWorkingImageHardware> m_working_image;
+
+    /**
+     * @brief Immutable copy of the source image, kept resident for the whole editing session.
+     * @details Shared and read-only so it can be handed to other consumers without copying.
+     */
+    std::shared_ptr<const Common::ImageRegion> m_original_image;
 };
 
 } // namespace ImageProcessing
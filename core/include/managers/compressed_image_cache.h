@@ -0,0 +1,205 @@
+/**
+ * @file compressed_image_cache.h
+ * @brief Declaration of CompressedImageCache (recently viewed images kept compressed in memory).
+ *
+ * @details
+ * `DecodedImageCache` holds a few RGBA_F32 decodes: about three 24 MP photos in its budget.
+ * Culling moves back and forth over more than that, and an image that left it had to be
+ * decoded again (a demosaic for a RAW file).
+ *
+ * The images evicted from the decoded cache move here instead, as half floats split into
+ * bands of rows. Each band is compressed on its own (zstd, when built with it): bands are
+ * compressed and decompressed concurrently on the `Workers::ComputePool`, and restoring an
+ * image costs a fraction of a decode. The half bytes are stored as two planes (low bytes, then
+ * high bytes), which compresses better than interleaved halves.
+ *
+ * The cache keeps at most `maxEntries()` images within a byte budget, least recently used
+ * evicted first, and is registered with `Common::MemoryBudget`.
+ *
+ * Half floats keep about three decimal digits: enough for the linear, scene-referred values of
+ * the preview and of the edits, not bit-exact with the decode. A restored image is a new
+ * decoded image, handed back to the decoded cache.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/memory/memory_budget.h"
+
+#include <OpenImageIO/imagebuf.h>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class CompressedImageCache
+ * @brief Thread-safe LRU cache of compressed decoded images, bounded in bytes and in entries.
+ */
+class CompressedImageCache {
+public:
+    /**
+     * @brief Default budget: a culling session's last dozen 24 MP photos, compressed.
+     */
+    static constexpr std::size_t k_default_capacity_bytes = std::size_t{768} << 20;
+
+    /**
+     * @brief Default number of images kept.
+     */
+    static constexpr std::size_t k_default_max_entries = 12;
+
+    /**
+     * @brief Rows per independently compressed band.
+     */
+    static constexpr int k_band_rows = 64;
+
+    /**
+     * @brief zstd level of the bands: the fastest levels already shrink half floats well.
+     */
+    static constexpr int k_compression_level = 1;
+
+    /**
+     * @brief Shared, read-only decoded image (as `DecodedImageCache::Buffer`).
+     */
+    using Buffer = std::shared_ptr<const OIIO::ImageBuf>;
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity_bytes Byte budget of the compressed images.
+     * @param max_entries Maximum number of images.
+     */
+    explicit CompressedImageCache(std::size_t capacity_bytes = k_default_capacity_bytes,
+                                  std::size_t max_entries = k_default_max_entries);
+
+    /**
+     * @brief Compresses the image of a path and inserts (or replaces) it, then evicts down to the limits.
+     * @details Compresses without holding the cache lock. An image of another layout than
+     *          float RGBA, or compressing to more than the whole budget, is not cached.
+     */
+    void store(std::string_view path, const OIIO::ImageBuf& image);
+
+    /**
+     * @brief Decompresses the image of a path and marks it most recently used.
+     * @details The entry stays cached: the image leaving the decoded cache again is not recompressed.
+     * @return The restored float image (spec and metadata of the stored one), or nullptr if not cached.
+     */
+    [[nodiscard]] Buffer load(std::string_view path);
+
+    /**
+     * @brief true if the path is cached (does not touch the LRU order).
+     */
+    [[nodiscard]] bool contains(std::string_view path) const;
+
+    /**
+     * @brief Removes the image of a path, if cached.
+     */
+    void erase(std::string_view path);
+
+    /**
+     * @brief Removes every image.
+     */
+    void clear();
+
+    /**
+     * @brief Byte budget of the compressed images.
+     */
+    [[nodiscard]] std::size_t capacityBytes() const;
+
+    /**
+     * @brief Maximum number of images.
+     */
+    [[nodiscard]] std::size_t maxEntries() const;
+
+    /**
+     * @brief Compressed bytes currently cached.
+     */
+    [[nodiscard]] std::size_t sizeBytes() const;
+
+    /**
+     * @brief Evicts least recently used images until at least `bytes` are freed or the cache is empty.
+     * @return The bytes freed.
+     */
+    std::size_t evictBytes(std::size_t bytes);
+
+private:
+    /**
+     * @brief Compressed image, in LRU order.
+     */
+    struct Entry {
+        /** @brief Source path (key). */
+        std::string m_path;
+        /** @brief Spec of the decoded image (float, metadata included). */
+        OIIO::ImageSpec m_spec;
+        /** @brief Compressed bands, top to bottom, `k_band_rows` rows each (the last one shorter). */
+        std::vector<std::vector<std::byte>> m_bands;
+        /** @brief Bytes of `m_bands`. */
+        std::size_t m_bytes{0};
+    };
+
+    /**
+     * @brief Compresses an image into an entry.
+     * @return false if a band could not be read or compressed.
+     */
+    [[nodiscard]] static bool compress(const OIIO::ImageBuf& image, Entry& entry);
+
+    /**
+     * @brief Decompresses an entry into a new float image.
+     * @return The image, or nullptr if a band is corrupt.
+     */
+    [[nodiscard]] static Buffer decompress(const OIIO::ImageSpec& spec, const std::vector<std::vector<std::byte>>& bands);
+
+    /**
+     * @brief Evicts least recently used entries until both limits hold. Caller holds `m_mutex`.
+     */
+    void evictToCapacity();
+
+    /**
+     * @brief Guards every member below.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Entries, most recently used first. Shared: `load` decompresses without the lock.
+     */
+    std::list<std::shared_ptr<const Entry>> m_entries;
+
+    /**
+     * @brief Path to entry.
+     */
+    std::unordered_map<std::string, std::list<std::shared_ptr<const Entry>>::iterator> m_index;
+
+    /**
+     * @brief Byte budget.
+     */
+    std::size_t m_capacity_bytes;
+
+    /**
+     * @brief Maximum number of entries.
+     */
+    std::size_t m_max_entries;
+
+    /**
+     * @brief Bytes currently cached.
+     */
+    std::size_t m_size_bytes{0};
+
+    /**
+     * @brief Registration with the memory budget (declared last: unregistered before the entries go away).
+     */
+    Common::MemoryBudget::Registration m_budget_registration;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,190 @@
+/**
+ * @file decode_service.h
+ * @brief Declaration of DecodeService (concurrent, memory-bounded decoding of many files).
+ *
+ * @details
+ * Filmstrip prefetch, thumbnail generation and batch export decode many files one after the
+ * other; a single loader thread leaves all but one core idle, while decoding everything at
+ * once would take one full-size buffer per file (plus LibRaw's working memory) at the same
+ * time. The decode service runs decodes on its own pool, one per worker, and admits a decode
+ * only once its estimated footprint fits in a byte budget.
+ *
+ * Each decode opens its own `OIIO::ImageInput` (hence its own LibRaw instance for RAW files):
+ * workers share no decoder state.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "image_config/raw_settings.h"
+#include "managers/decoded_image_cache.h"
+#include "workers/engine_scheduler.h"
+#include "workers/task_priority.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class DecodeService
+ * @brief Pool decoding files concurrently within a memory budget.
+ *
+ * @details
+ * The decoding itself is delegated to the owner (`Decoder`), so the service shares its
+ * caches and de-duplication. A decode holds its share of the budget until its callback
+ * returns, so a consumer processing the image in the callback (export, thumbnail) is
+ * bounded too. A decode larger than the whole budget runs alone.
+ */
+class DecodeService {
+public:
+    /**
+     * @brief Outcome of one decode.
+     */
+    using Result = std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>;
+
+    /**
+     * @brief Decodes one file (runs on a worker, possibly on several at once).
+     */
+    using Decoder = std::function<Result(const std::string& path, ImageConfig::Raw::RawQuality quality,
+                                         const Common::CancellationToken& token)>;
+
+    /**
+     * @brief Receives the outcome of a decode, on the worker that ran it.
+     */
+    using ResultCallback = std::function<void(const std::string& path, Result result)>;
+
+    /**
+     * @brief Default budget: four 24 MP RAW files in flight (RGBA_F32 plus LibRaw buffers).
+     */
+    static constexpr std::size_t k_default_memory_budget_bytes = std::size_t{3072} << 20;
+
+    /**
+     * @brief Creates the service and starts its workers.
+     * @param decoder Decodes one file.
+     * @param worker_count Number of concurrent decodes (0: one per hardware thread).
+     * @param memory_budget_bytes Estimated bytes the running decodes may use together.
+     */
+    explicit DecodeService(Decoder decoder, std::size_t worker_count = 0,
+                           std::size_t memory_budget_bytes = k_default_memory_budget_bytes);
+
+    /**
+     * @brief Waits for the queued decodes (cancel their tokens first to drop them).
+     */
+    ~DecodeService();
+
+    DecodeService(const DecodeService&) = delete;
+    DecodeService& operator=(const DecodeService&) = delete;
+
+    /**
+     * @brief Queues the decode of a file.
+     * @param path The file to decode.
+     * @param quality Demosaic quality (RAW files only).
+     * @param priority Scheduler lane (e.g. `Thumbnail` for prefetch, `Export` for a batch export).
+     * @param on_decoded Receives the outcome (`LoadCancelled` if the token was cancelled first).
+     * @param token Drops the decode if cancelled before it starts.
+     */
+    void decode(std::string path, ImageConfig::Raw::RawQuality quality, Workers::TaskPriority priority,
+                ResultCallback on_decoded, Common::CancellationToken token = {});
+
+    /**
+     * @brief Decodes files concurrently and waits for all of them.
+     * @return One outcome per path, in the order of `paths`.
+     */
+    [[nodiscard]] std::vector<Result> decodeBatch(std::span<const std::string> paths,
+                                                  ImageConfig::Raw::RawQuality quality,
+                                                  Workers::TaskPriority priority = Workers::TaskPriority::Export,
+                                                  const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Number of decodes that can run at once.
+     */
+    [[nodiscard]] std::size_t workerCount() const noexcept { return m_worker_count; }
+
+    /**
+     * @brief Estimated bytes the running decodes may use together.
+     */
+    [[nodiscard]] std::size_t memoryBudgetBytes() const noexcept { return m_memory_budget_bytes; }
+
+    /**
+     * @brief Estimated bytes used by the running decodes.
+     */
+    [[nodiscard]] std::size_t inFlightBytes() const;
+
+    /**
+     * @brief Estimates the peak memory of decoding a file, from its header only.
+     * @return RGBA_F32 size of the decode (doubled for LibRaw's buffers), or 0 if unreadable.
+     */
+    [[nodiscard]] static std::size_t estimateDecodeBytes(std::string_view path, ImageConfig::Raw::RawQuality quality);
+
+private:
+    /**
+     * @brief Runs one decode on a worker, within the budget.
+     */
+    void run(const std::string& path, ImageConfig::Raw::RawQuality quality,
+             const ResultCallback& on_decoded, const Common::CancellationToken& token);
+
+    /**
+     * @brief Blocks until `bytes` fit in the budget (or nothing else runs), then takes them.
+     * @return The bytes taken (clamped to the budget), to give back to `releaseBudget`.
+     */
+    [[nodiscard]] std::size_t acquireBudget(std::size_t bytes);
+
+    /**
+     * @brief Gives bytes back to the budget.
+     */
+    void releaseBudget(std::size_t bytes);
+
+    /**
+     * @brief Decodes one file.
+     */
+    Decoder m_decoder;
+
+    /**
+     * @brief Number of concurrent decodes.
+     */
+    std::size_t m_worker_count;
+
+    /**
+     * @brief Estimated bytes the running decodes may use together.
+     */
+    std::size_t m_memory_budget_bytes;
+
+    /**
+     * @brief Guards `m_in_flight_bytes`.
+     */
+    mutable std::mutex m_budget_mutex;
+
+    /**
+     * @brief Signalled when budget is given back.
+     */
+    std::condition_variable m_budget_released;
+
+    /**
+     * @brief Estimated bytes used by the running decodes.
+     */
+    std::size_t m_in_flight_bytes{0};
+
+    /**
+     * @brief Decoding pool. Declared last: joined first, while the members its tasks use are alive.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_pool;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,187 @@
+/**
+ * @file decoded_image_cache.h
+ * @brief Declaration of DecodedImageCache (bounded LRU cache of decoded source images).
+ *
+ * @details
+ * Decoding a RAW file (demosaic, color conversion) takes seconds; flipping back and forth
+ * between the photos of a shoot should not pay it again. The cache keeps the last decoded
+ * RGBA_F32 buffers, keyed by path, within a byte budget, and evicts the least recently
+ * used ones first. Buffers are shared read-only: an entry evicted while it is the loaded
+ * image stays alive until the SourceManager releases it.
+ *
+ * Each cache is registered with `Common::MemoryBudget`, which evicts from it (LRU first) when
+ * the process goes over its memory ceiling.
+ *
+ * Images pushed out by the byte budget are handed to an eviction handler, if one is set (the
+ * SourceManager keeps them compressed, see `CompressedImageCache`). Those dropped under memory
+ * pressure, replaced or erased are not.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <OpenImageIO/imagebuf.h>
+#include "common/memory/memory_budget.h"
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class DecodedImageCache
+ * @brief Thread-safe LRU cache of decoded images, bounded in bytes.
+ */
+class DecodedImageCache {
+public:
+    /**
+     * @brief Default budget: the current photo and its two filmstrip neighbours at 24 MP RGBA_F32.
+     */
+    static constexpr std::size_t k_default_capacity_bytes = std::size_t{1152} << 20;
+
+    /**
+     * @brief Shared, read-only decoded image.
+     */
+    using Buffer = std::shared_ptr<const OIIO::ImageBuf>;
+
+    /**
+     * @brief Receives an image evicted by the byte budget, with its path (called without the cache lock).
+     */
+    using EvictionHandler = std::function<void(const std::string& path, const Buffer& buffer)>;
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity_bytes Byte budget of the cached pixels.
+     */
+    explicit DecodedImageCache(std::size_t capacity_bytes = k_default_capacity_bytes);
+
+    /**
+     * @brief Looks a path up and marks it most recently used.
+     * @return The decoded image, or nullptr if not cached.
+     */
+    [[nodiscard]] Buffer find(std::string_view path);
+
+    /**
+     * @brief true if the path is cached (does not touch the LRU order).
+     */
+    [[nodiscard]] bool contains(std::string_view path) const;
+
+    /**
+     * @brief Inserts (or replaces) the image of a path, then evicts down to the budget.
+     * @details An image larger than the whole budget is not cached. Images wrapping a file
+     *          mapping (`OIIO::ImageBuf::APPBUFFER`) count as zero bytes: their pages belong
+     *          to the OS page cache, which reclaims them on its own.
+     */
+    void insert(std::string_view path, Buffer buffer);
+
+    /**
+     * @brief Removes the image of a path, if cached.
+     */
+    void erase(std::string_view path);
+
+    /**
+     * @brief Removes every image.
+     */
+    void clear();
+
+    /**
+     * @brief Changes the budget, evicting down to it.
+     */
+    void setCapacityBytes(std::size_t capacity_bytes);
+
+    /**
+     * @brief Sets the handler of the images evicted by the byte budget (empty: they are dropped).
+     * @details Mapped images (`OIIO::ImageBuf::APPBUFFER`) are never handed over: their file stays.
+     */
+    void setEvictionHandler(EvictionHandler handler);
+
+    /**
+     * @brief Byte budget of the cached pixels.
+     */
+    [[nodiscard]] std::size_t capacityBytes() const;
+
+    /**
+     * @brief Bytes of pixels currently cached.
+     */
+    [[nodiscard]] std::size_t sizeBytes() const;
+
+    /**
+     * @brief Evicts least recently used images until at least `bytes` are freed or the cache is empty.
+     * @return The bytes freed.
+     */
+    std::size_t evictBytes(std::size_t bytes);
+
+private:
+    /**
+     * @brief Cached image, in LRU order.
+     */
+    struct Entry {
+        /** @brief Source path (key). */
+        std::string m_path;
+        /** @brief Decoded image. */
+        Buffer m_buffer;
+        /** @brief Bytes of pixels of `m_buffer`. */
+        std::size_t m_bytes{0};
+    };
+
+    /**
+     * @brief Evicts least recently used entries until the budget holds. Caller holds `m_mutex`.
+     * @param evicted Receives the evicted entries, for the eviction handler.
+     */
+    void evictToCapacity(std::vector<Entry>& evicted);
+
+    /**
+     * @brief Hands evicted entries to the eviction handler. Caller does not hold `m_mutex`.
+     */
+    void handOver(std::vector<Entry>& evicted);
+
+    /**
+     * @brief Guards every member below.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Entries, most recently used first.
+     */
+    std::list<Entry> m_entries;
+
+    /**
+     * @brief Path to entry.
+     */
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+
+    /**
+     * @brief Byte budget.
+     */
+    std::size_t m_capacity_bytes;
+
+    /**
+     * @brief Bytes currently cached.
+     */
+    std::size_t m_size_bytes{0};
+
+    /**
+     * @brief Handler of the images evicted by the byte budget.
+     */
+    EvictionHandler m_eviction_handler;
+
+    /**
+     * @brief Registration with the memory budget (declared last: unregistered before the entries go away).
+     */
+    Common::MemoryBudget::Registration m_budget_registration;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
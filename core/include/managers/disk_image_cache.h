@@ -0,0 +1,157 @@
+/**
+ * @file disk_image_cache.h
+ * @brief Declaration of DiskImageCache (persistent cache of decoded RAW files).
+ *
+ * @details
+ * Demosaicing a RAW file takes seconds, every time the application opens it. The disk cache
+ * keeps the decoded linear RGBA of RAW files as uncompressed half-float blobs, keyed by the
+ * source path, its modification time and size, and the fingerprint of the `RawSettings` used.
+ *
+ * A hit maps the blob (`Common::MappedFile`) and wraps it as the decoded image, in O(1):
+ * nothing is read up front, pages are faulted in from the OS page cache as tiles are read,
+ * and the page cache is shared with other processes and kept across sessions.
+ *
+ * **Entry layout:** a fixed 64-byte header, the metadata of the decode as name/value
+ * strings, then the pixels (RGBA half, rows contiguous) at a page-aligned offset.
+ *
+ * Entries are written next to the loads (never on the latency path) through a temporary file
+ * renamed in place, and the least recently used ones are deleted past the budget
+ * (`AppConfig::getDecodedDiskCacheSizeMB`). A modified source file, or different settings,
+ * simply misses: stale entries age out.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+#include "managers/decoded_image_cache.h"
+
+#include <OpenImageIO/imagebuf.h>
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class DiskImageCache
+ * @brief Thread-safe persistent cache of decoded images, bounded in bytes on disk.
+ */
+class DiskImageCache {
+public:
+    /**
+     * @struct Key
+     * @brief Identity of a decode: equal keys decode to the same pixels.
+     */
+    struct Key {
+        /**
+         * @brief Absolute path of the source file.
+         */
+        std::string m_source_path;
+
+        /**
+         * @brief Modification time of the source file (file clock ticks).
+         */
+        std::int64_t m_source_mtime{0};
+
+        /**
+         * @brief Size of the source file, in bytes.
+         */
+        std::uintmax_t m_source_size{0};
+
+        /**
+         * @brief Fingerprint of the decoding settings (`RawSettings::fingerprint()`).
+         */
+        std::uint64_t m_settings_fingerprint{0};
+
+        /**
+         * @brief Every field but the path, as stored in the entry to detect name collisions.
+         */
+        [[nodiscard]] std::string identity() const;
+
+        /**
+         * @brief File name of the entry (hash of the key).
+         */
+        [[nodiscard]] std::string entryName() const;
+    };
+
+    /**
+     * @brief Builds the key of a source file decoded with given settings.
+     * @return The key, or `std::nullopt` if the file cannot be inspected.
+     */
+    [[nodiscard]] static std::optional<Key> makeKey(std::string_view path, std::uint64_t settings_fingerprint);
+
+    /**
+     * @brief Builds the key of an image made from several files (an HDR merge).
+     * @details The first file names the entry; the identities of all of them are folded into
+     *          the fingerprint, so modifying any file misses.
+     * @return The key, or `std::nullopt` if there is no file or one cannot be inspected.
+     */
+    [[nodiscard]] static std::optional<Key> makeKey(std::span<const std::string> paths, std::uint64_t settings_fingerprint);
+
+    /**
+     * @brief true if the cache is enabled (`AppConfig::getDecodedDiskCacheSizeMB() > 0`).
+     */
+    [[nodiscard]] static bool isEnabled() noexcept;
+
+    /**
+     * @brief Maps an entry as a read-only RGBA half image, and marks it most recently used.
+     * @details The image wraps the mapping (`OIIO::ImageBuf::APPBUFFER`), which lives as long
+     *          as the returned buffer: copy it (`ImageBuf::copy`) before writing.
+     * @return The decoded image, or `FileNotFound` on a miss (invalid entries are deleted).
+     */
+    [[nodiscard]] std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError> load(const Key& key) const;
+
+    /**
+     * @brief Writes a decoded RGBA_F32 image as the entry of a key, then evicts down to the budget.
+     * @details Writes hundreds of MB: call it off the latency path. Failures are logged only.
+     */
+    void store(const Key& key, const OIIO::ImageBuf& image);
+
+    /**
+     * @brief Fills `rows` rows of RGBA_F32 pixels from `first_row` (rows contiguous).
+     * @return false to abandon the entry (cancelled, read failed).
+     */
+    using RowSource = std::function<bool(Common::ImageDim first_row, Common::ImageDim rows, float* pixels)>;
+
+    /**
+     * @brief Writes an entry produced strip by strip, then evicts down to the budget.
+     * @details The image is never whole in memory: one strip of `strip_rows` rows at a time.
+     * @param spec Size and metadata of the image (4 channels).
+     * @return true if the entry was written; failures are logged.
+     */
+    bool storeRows(const Key& key, const OIIO::ImageSpec& spec, Common::ImageDim strip_rows, const RowSource& source);
+
+private:
+    /**
+     * @brief Directory of the entries (configured, or under the system temporary directory).
+     */
+    [[nodiscard]] static std::filesystem::path directory();
+
+    /**
+     * @brief Deletes the least recently used entries until they fit in the budget.
+     * Caller holds m_store_mutex.
+     */
+    static void evict_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes);
+
+    /**
+     * @brief Serializes the stores and evictions of this process.
+     */
+    std::mutex m_store_mutex;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,149 @@
+/**
+ * @file hdr_merger.h
+ * @brief Declaration of HdrMerger (bracketed exposures merged into one linear HDR source).
+ *
+ * @details
+ * A bracket is several exposures of one scene; merged, the shadows come from the long ones and
+ * the highlights from the short ones. The merge runs in three steps:
+ * 1. **Decode**: each frame is decoded once into the persistent cache and mapped
+ *    (`SourceManager::decodePersistent`); a frame is never held whole afterwards.
+ * 2. **Align**: a grey copy of each frame (long edge `HdrMergeSettings::m_alignment_edge`) is
+ *    aligned to the reference frame by median threshold bitmaps (Ward), coarse to fine over a
+ *    pyramid: a translation, insensitive to the exposure difference.
+ * 3. **Merge**: strip by strip, each output pixel is the weighted mean of the frames' pixels
+ *    scaled to the reference exposure: a hat weight avoids the clipped and the noisy values, and
+ *    longer exposures weigh more. Memory is one strip per frame: `m_strip_rows` × width × frames.
+ *
+ * The exposure of each frame is read from its metadata (time, aperture, ISO), or estimated from
+ * the grey copies if missing. The reference is the middle exposure.
+ *
+ * The result is written strip by strip to the decoded disk cache (`DiskImageCache::storeRows`),
+ * keyed by the identities of all the frames, then loaded into the `SourceManager` as a normal
+ * source (`mergedPath`): merging the same, unmodified frames again maps the entry at once. With
+ * the disk cache disabled, the result is built in memory.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+#include "managers/decoded_image_cache.h"
+#include "managers/disk_image_cache.h"
+
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+class SourceManager;
+
+/**
+ * @brief Settings of an HDR merge.
+ */
+struct HdrMergeSettings {
+    /** @brief Rows merged at once (memory: this × width × frames). */
+    Common::ImageDim m_strip_rows { 128 };
+
+    /** @brief Long edge of the grey copies the frames are aligned on (0: no alignment). */
+    Common::ImageDim m_alignment_edge { 4096 };
+
+    /** @brief Levels of the alignment pyramid (shifts up to 2^levels pixels of the grey copies). */
+    int m_alignment_levels { 6 };
+};
+
+/**
+ * @class HdrMerger
+ * @brief Aligns and merges a bracket of exposures into a linear HDR source.
+ *
+ * @details Not thread-safe: one `merge()` at a time per instance.
+ */
+class HdrMerger {
+public:
+    /**
+     * @brief 8-bit grey image the frames are aligned on.
+     */
+    struct GreyImage {
+        Common::ImageDim m_width { 0 };
+        Common::ImageDim m_height { 0 };
+        std::vector<std::uint8_t> m_pixels;
+    };
+
+    /**
+     * @brief Translation of a frame: its pixel (x + dx, y + dy) shows the reference's (x, y).
+     */
+    struct Offset {
+        int m_dx { 0 };
+        int m_dy { 0 };
+
+        [[nodiscard]] bool operator==(const Offset&) const = default;
+    };
+
+    /**
+     * @brief Merges into the source manager's loads.
+     */
+    explicit HdrMerger(SourceManager& source);
+
+    /**
+     * @brief Merges a bracket and loads the result into the source manager (under `mergedPath`).
+     * @param frames The exposures (at least 2, same size), any order.
+     * @return void, `InvalidImageRegion` (fewer than 2 frames, sizes differ), `LoadCancelled`,
+     *         or the decode error of a frame.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    merge(std::span<const std::string> frames, const HdrMergeSettings& settings = {},
+          const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Path the merged source is loaded under: `<first frame's stem>_HDR` in its directory
+     *        (no such file: a name for the sidecars and the UI).
+     */
+    [[nodiscard]] static std::string mergedPath(std::span<const std::string> frames);
+
+    /**
+     * @brief Offset of a frame against the reference by median threshold bitmaps.
+     * @param levels Pyramid levels below full size (each halves the images).
+     */
+    [[nodiscard]] static Offset alignMtb(const GreyImage& reference, const GreyImage& frame, int levels);
+
+    /**
+     * @brief Weight of a linear value in the merge: 0 at black and at clipping, 1 mid-range.
+     * @param value Largest channel of the pixel, in [0, 1] at the frame's white.
+     */
+    [[nodiscard]] static float weight(float value) noexcept;
+
+private:
+    /**
+     * @brief Rows of one frame around a strip, shifted by its offset (edges clamped).
+     */
+    struct FrameStrip;
+
+    /**
+     * @brief Decodes the merged source when a persisted one is missing.
+     */
+    [[nodiscard]] std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+    build(std::span<const std::string> frames, const DiskImageCache::Key* key, const HdrMergeSettings& settings,
+          const Common::CancellationToken& token);
+
+    /**
+     * @brief Source manager the frames are decoded by and the result is loaded into.
+     */
+    SourceManager& m_source;
+
+    /**
+     * @brief Persisted merges.
+     */
+    DiskImageCache m_disk_cache;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -16,15 +16,25 @@
 
 #pragma once
 
+#include "common/cancellation_token.h"
 #include "common/image_region.h"
+#include "common/image_view.h"
 #include "common/error_handling/core_error.h"
+#include "common/types/image_orientation.h"
 #include "common/types/image_types.h"
+#include "managers/image_metadata.h"
+#include "managers/source_tile_cache_stats.h"
+#include "image_config/raw_settings.h"
 
 #include <string>
 #include <string_view>
 #include <memory>
 #include <optional>
 #include <expected>
+#include <functional>
+#include <future>
+#include <span>
+#include <vector>
 
 namespace CaptureMoment::Core {
 
@@ -39,6 +49,11 @@ namespace Managers {
  */
 class ISourceManager {
 public:
+    /**
+     * @brief Notified when the full-quality image of a path replaced its preview.
+     */
+    using RefinedCallback = std::function<void(std::string_view path)>;
+
     virtual ~ISourceManager() = default;
 
     /**
@@ -55,6 +70,120 @@ public:
      */
     [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError> loadFile(std::string_view path) = 0;
 
+    /**
+     * @brief Loads an image file in the background.
+     *
+     * The loaded image is replaced only once the new one is decoded, so the previous image
+     * stays accessible meanwhile. A later load (or `cancelLoad`) supersedes this one.
+     *
+     * @param path The file system path to the image.
+     * @return Future settling with void once the image is loaded, or a CoreError
+     *         (`LoadCancelled` if superseded or cancelled before being installed).
+     */
+    [[nodiscard]] virtual std::future<std::expected<void, ErrorHandling::CoreError>> loadFileAsync(std::string_view path) = 0;
+
+    /**
+     * @brief Cancels the pending loads: they do not install their image.
+     */
+    virtual void cancelLoad() = 0;
+
+    /**
+     * @brief Decodes files in the background, ahead of their loads (e.g. filmstrip neighbours).
+     *
+     * Lower priority than the loads; a later call drops the prefetches not started yet.
+     *
+     * @param paths The files to prefetch, most wanted first.
+     */
+    virtual void prefetch(std::span<const std::string> paths) = 0;
+
+    /**
+     * @brief Decodes a file at thumbnail size, without loading or caching it.
+     *
+     * Implementations decode the cheapest rendition covering the requested size (e.g. a RAW
+     * file's embedded preview, or a reduced-resolution decode) and downsample it to fit.
+     * Safe to call from several threads at once, and while an image is loaded.
+     *
+     * @param path The file system path to the image.
+     * @param max_long_edge Longest edge of the result, in pixels (smaller images are not enlarged).
+     * @return The linear RGBA_F32 image, or a CoreError (FileNotFound, DecodingError, etc.).
+     */
+    [[nodiscard]] virtual std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    decodeThumbnail(std::string_view path, Common::ImageDim max_long_edge) const = 0;
+
+    /**
+     * @brief Reads the catalog metadata of a file (dimensions, orientation, date, camera, lens)
+     *        from its header, without decoding pixels or loading it.
+     *
+     * Safe to call from several threads at once, and while an image is loaded.
+     *
+     * @param path The file system path to the image.
+     * @return The metadata, or a CoreError (FileNotFound, UnsupportedFormat, etc.).
+     */
+    [[nodiscard]] virtual std::expected<ImageMetadata, ErrorHandling::CoreError>
+    readMetadata(std::string_view path) const = 0;
+
+    /**
+     * @brief Reads the catalog metadata of many files concurrently (see `readMetadata`).
+     *
+     * @param paths The files to read.
+     * @param token Once cancelled, the files not read yet report `LoadCancelled`.
+     * @return One metadata (or error) per path, in the order of `paths`.
+     */
+    [[nodiscard]] virtual std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>>
+    readMetadataBatch(std::span<const std::string> paths, const Common::CancellationToken& token = {}) const = 0;
+
+    /**
+     * @brief Checks if the loaded image is a preview (e.g. a RAW file's embedded JPEG)
+     *        whose full-quality decode is still running.
+     * @return true until the full-quality image replaced the preview.
+     */
+    [[nodiscard]] virtual bool isPreview() const = 0;
+
+    /**
+     * @brief Requests the full-quality decode of the loaded preview (e.g. zoom to 100%, export).
+     *
+     * Does nothing if the loaded image is not a preview or its decode is already queued.
+     * The refined callback is notified once the full-quality image is installed.
+     */
+    virtual void requestFullQuality() = 0;
+
+    /**
+     * @brief Develops the loaded RAW file again with other settings (highlights, demosaic, noise).
+     *
+     * Implementations keep what they can of the file's decode between calls (its bytes, its
+     * undemosaiced samples) so that a settings change repeats only the development.
+     * Blocks until the new image is installed; it replaces the loaded one (preview or not).
+     *
+     * @param settings The development settings. The output stays camera-native when the
+     *        pipeline develops the colors (see `Operations::CameraProfile`).
+     * @return void once installed, `UnsupportedFormat` if the loaded image is not a RAW file,
+     *         `LoadCancelled` if another image was loaded meanwhile, or the decode error.
+     */
+    [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError>
+    redevelopRaw(const ImageConfig::Raw::RawSettings& settings) = 0;
+
+    /**
+     * @brief Sets the callback notified when a preview is replaced by its full-quality image.
+     *
+     * The callback runs on a loader thread and must be cheap (e.g. forward to another thread).
+     * Once this returns, the previous callback is no longer running nor called.
+     *
+     * @param callback The callback, or an empty function to stop notifications.
+     */
+    virtual void setRefinedCallback(RefinedCallback callback) = 0;
+
+    /**
+     * @brief Checks if the loaded image is tile-backed: its tiles are read from the file on
+     *        demand instead of being decoded at load.
+     * @return true until the image is written to (`setTile` materializes it).
+     */
+    [[nodiscard]] virtual bool isTileBacked() const = 0;
+
+    /**
+     * @brief Gets the counters of the tile cache backing the tile-backed images.
+     */
+    [[nodiscard]] virtual SourceTileCacheStats tileCacheStats() const = 0;
+
     /**
      * @brief Unloads the currently loaded image and frees resources.
      */
@@ -91,6 +220,14 @@ public:
      */
     [[nodiscard]] virtual Common::ImageChan channels() const noexcept = 0;
 
+    /**
+     * @brief EXIF orientation of the loaded image.
+     * @details The pixels (`getTile`, `width`, `height`) are in the stored frame: decoders do not
+     *          turn them. The display applies the orientation, the exports turn their output.
+     * @return The orientation, or `Normal` if not loaded or untagged.
+     */
+    [[nodiscard]] virtual Common::ImageOrientation orientation() const noexcept = 0;
+
     /**
      * @brief Extracts a rectangular region (tile) of pixels from the image.
      *
@@ -121,6 +258,53 @@ public:
      */
     [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError> setTile(const Common::ImageRegion& tile) = 0;
 
+    /**
+     * @brief Writes pixel data from a read-only view back into the image buffer (no intermediate copy).
+     *
+     * The view's strides are honored, so any working image view can be written directly.
+     *
+     * @param tile The view containing the RGBA float pixels to write.
+     * @param x X-coordinate of the tile's top-left corner in the image.
+     * @param y Y-coordinate of the tile's top-left corner in the image.
+     * @return `std::expected<void, CoreError>`:
+     *         - Returns void on success.
+     *         - CoreError on failure (IOError, InvalidImageRegion, etc.).
+     */
+    [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError> setTile(
+        const Common::ImageView& tile, Common::ImageCoord x, Common::ImageCoord y
+        ) = 0;
+
+    /**
+     * @brief Makes `pixels` the loaded image, without copying them (e.g. a committed edit).
+     *
+     * The source keeps a reference: the pixels are shared with the caller and must not change
+     * afterwards. A later `setTile` copies them first. The file metadata is kept.
+     *
+     * @param pixels RGBA float pixels of the loaded image's dimensions.
+     * @return `std::expected<void, CoreError>`:
+     *         - Returns void on success.
+     *         - CoreError on failure (SourceNotLoaded, InvalidImageRegion).
+     */
+    [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError>
+    adoptPixels(std::shared_ptr<const Common::ImageRegion> pixels) = 0;
+
+    /**
+     * @brief Makes the image loaded by `other` the loaded image, sharing its decoded pixels.
+     *
+     * @details
+     * Backs a virtual copy: both sources read one decode, and a later `setTile` on either
+     * copies the pixels first, as for the decoded-image cache. The path, metadata and preview
+     * state follow `other`; nothing is read from disk.
+     *
+     * @param other Source to share with (unchanged).
+     * @return `std::expected<void, CoreError>`:
+     *         - Returns void on success.
+     *         - CoreError on failure (SourceNotLoaded, or UnsupportedFormat when `other` holds
+     *           no shareable decode: a tile-backed image or pixels it wrote).
+     */
+    [[nodiscard]] virtual std::expected<void, ErrorHandling::CoreError>
+    shareLoadedImage(const ISourceManager& other) = 0;
+
     /**
      * @brief Retrieves a specific metadata field from the source image.
      * @param key Name of the metadata field to search for.
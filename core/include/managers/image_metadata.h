@@ -0,0 +1,55 @@
+/**
+ * @file image_metadata.h
+ * @brief Declaration of ImageMetadata (catalog information read without decoding pixels).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <string>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @struct ImageMetadata
+ * @brief What catalog indexing and the filmstrip show of a file, from its header only.
+ *
+ * Text fields are empty when the file does not record them.
+ */
+struct ImageMetadata {
+    /**
+     * @brief Dimensions of the stored image, in pixels (before orientation).
+     */
+    Common::ImageDim m_width{0};
+    Common::ImageDim m_height{0};
+
+    /**
+     * @brief EXIF orientation code (1: as stored, to 8).
+     */
+    int m_orientation{1};
+
+    /**
+     * @brief Capture date and time, EXIF format (`YYYY:MM:DD HH:MM:SS`).
+     */
+    std::string m_capture_date;
+
+    /**
+     * @brief Camera manufacturer and model.
+     */
+    std::string m_camera_make;
+    std::string m_camera_model;
+
+    /**
+     * @brief Lens model.
+     */
+    std::string m_lens;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,72 @@
+/**
+ * @file jpeg_scaled_decoder.h
+ * @brief Declaration of JpegScaledDecoder (JPEG files decoded at 1/2, 1/4 or 1/8 scale).
+ *
+ * @details
+ * libjpeg can stop the inverse DCT early: decoding at 1/8 scale reads the DC coefficient of each
+ * block and skips the rest of the transform, for a fraction of the cost of a full decode (and of
+ * its memory). OIIO's JPEG reader always decodes whole, so thumbnails and load previews of JPEG
+ * files go through libjpeg directly when the build has it (`CAPTUREMOMENT_USE_LIBJPEG`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/types/image_types.h"
+
+#include <OpenImageIO/imagebuf.h>
+
+#include <expected>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class JpegScaledDecoder
+ * @brief Decodes a JPEG file at the smallest DCT scale covering a requested size.
+ *
+ * @details
+ * The result has the layout of every decode of `SourceManager`: linear RGBA_F32 (the samples
+ * are taken as sRGB, like OIIO tags JPEG files), with "oiio:ColorSpace" set to
+ * "lin_rec709_scene". Stateless and thread-safe.
+ */
+class JpegScaledDecoder {
+public:
+    /**
+     * @brief Whether the build links libjpeg (otherwise `decode` always fails).
+     */
+    [[nodiscard]] static bool isAvailable() noexcept;
+
+    /**
+     * @brief Whether a file path has a JPEG extension.
+     */
+    [[nodiscard]] static bool isJpegFile(std::string_view path) noexcept;
+
+    /**
+     * @brief The largest DCT scale denominator (8, 4, 2, or 1) keeping the long edge at least `min_long_edge`.
+     * @param width Full width of the image.
+     * @param height Full height of the image.
+     * @param min_long_edge Long edge the consumer needs.
+     */
+    [[nodiscard]] static int scaleDenominator(int width, int height, Common::ImageDim min_long_edge) noexcept;
+
+    /**
+     * @brief Decodes a JPEG file at the smallest scale whose long edge covers `min_long_edge`.
+     * @param path The JPEG file.
+     * @param min_long_edge Long edge the consumer needs.
+     * @return The linear RGBA_F32 image, `UnsupportedFormat` if there is nothing to gain
+     *         (no libjpeg, CMYK file, or no scale below 1 covering the request: the caller
+     *         decodes whole), or the decode error.
+     */
+    [[nodiscard]] static std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    decode(std::string_view path, Common::ImageDim min_long_edge);
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -36,7 +36,47 @@
  */
 #include "managers/source_manager.h"
 
+/**
+ * @brief Bounded LRU cache of decoded source images (instant reloads, filmstrip prefetch).
+ */
+#include "managers/decoded_image_cache.h"
+
+/**
+ * @brief Persistent cache of decoded RAW files (mapped half-float blobs, across sessions).
+ */
+#include "managers/disk_image_cache.h"
+
+/**
+ * @brief Bracketed exposures aligned and merged, strip by strip, into a linear HDR source.
+ */
+#include "managers/hdr_merger.h"
+
+/**
+ * @brief JPEG files decoded by libjpeg at 1/2, 1/4 or 1/8 scale (thumbnails, load previews).
+ */
+#include "managers/jpeg_scaled_decoder.h"
+
+/**
+ * @brief Lossy half-float proxies of cataloged images, edited when the originals are offline or slow.
+ */
+#include "managers/smart_preview_store.h"
+
+/**
+ * @brief Concurrent, memory-bounded decoding of many files (prefetch, thumbnails, batch export).
+ */
+#include "managers/decode_service.h"
+
+/**
+ * @brief Counters of the tile cache backing huge (tile-backed) source images.
+ */
+#include "managers/source_tile_cache_stats.h"
+
 /**
  * @brief Concrete implementation for managing cumulative image processing state.
  */
 #include "managers/state_image_manager.h"
+
+/**
+ * @brief Description of progressive requests (low-resolution preview, then refined tiles).
+ */
+#include "managers/progressive_refinement.h"
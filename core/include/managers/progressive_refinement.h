@@ -0,0 +1,99 @@
+/**
+ * @file progressive_refinement.h
+ * @brief Description of a progressive processing request (preview first, then refined tiles).
+ *
+ * @details
+ * A progressive request emits a low-resolution result of the whole frame (computed on the
+ * preview proxy) as soon as it is ready, then recomputes the full-resolution image band by
+ * band and emits each band, downsampled to the display size, as it completes. Combined with
+ * cancellation, the viewport reacts immediately and sharpens in place; a newer request stops
+ * the refinement between two bands.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/image_region.h"
+#include "common/types/image_types.h"
+#include "common/types/processing_outcome.h"
+
+#include <functional>
+#include <memory>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @struct ProgressiveRefinement
+ * @brief Display size and sinks of a progressive request.
+ *
+ * @details
+ * The callbacks run on an engine scheduler thread (`m_on_finished` possibly on the thread
+ * submitting a newer request); they must be cheap or forward the image to their own thread.
+ * Images are linear RGBA F32, positioned in display coordinates (suitable for
+ * `IRenderingItemBase::updateTile`).
+ */
+struct ProgressiveRefinement {
+    /**
+     * @brief Receives a display-sized image or band.
+     */
+    using ImageCallback = std::function<void(std::unique_ptr<Common::ImageRegion>)>;
+
+    /**
+     * @brief Receives the outcome of the request.
+     */
+    using OutcomeCallback = std::function<void(Common::ProcessingOutcome)>;
+
+    /**
+     * @brief Default height of a refined tile, in display rows.
+     */
+    static constexpr Common::ImageDim k_default_tile_rows = 64;
+
+    /**
+     * @brief Width of the display image the preview and the tiles belong to.
+     */
+    Common::ImageDim m_display_width{0};
+
+    /**
+     * @brief Height of the display image the preview and the tiles belong to.
+     */
+    Common::ImageDim m_display_height{0};
+
+    /**
+     * @brief Height of each refined tile, in display rows (full width).
+     */
+    Common::ImageDim m_tile_rows{k_default_tile_rows};
+
+    /**
+     * @brief Receives the low-resolution preview of the whole frame (skipped without a proxy).
+     */
+    ImageCallback m_on_preview;
+
+    /**
+     * @brief Receives each full-resolution band, downsampled to the display size, at `(0, y)`.
+     */
+    ImageCallback m_on_tile;
+
+    /**
+     * @brief Receives the outcome when the request settles, right before its future.
+     * @details Lets a caller that cannot block on the future (e.g. the thread the images are
+     *          forwarded to) learn the outcome. Runs under the engine's request lock: it must
+     *          not call back into the engine.
+     */
+    OutcomeCallback m_on_finished;
+
+    /**
+     * @brief true if the display size and the tile height are non-zero.
+     */
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_display_width > 0 && m_display_height > 0 && m_tile_rows > 0;
+    }
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,218 @@
+/**
+ * @file result_cache.h
+ * @brief Declaration of ResultCache (content-addressed cache of rendered edit states).
+ *
+ * @details
+ * The same edit state is often requested again: undo and redo, before/after toggles, a slider
+ * dragged back to a previous value, the same image re-opened. The cache keeps the display
+ * image (sRGB RGBA8, at the display size) of the states rendered, keyed by what determines
+ * it: the identity of the source, a hash of the normalized operations and the output size.
+ * A request for a cached state costs a lookup instead of a pipeline pass.
+ *
+ * - **Memory tier:** LRU within a byte budget, registered with `Common::MemoryBudget`.
+ * - **Disk tier:** results of full-resolution passes over a source file are also written to
+ *   small raw entries (`AppConfig::getResultDiskCacheSizeMB`), so a re-opened image shows its
+ *   last states without a pass. A modified source file has another identity: stale entries
+ *   simply age out.
+ *
+ * Each entry records whether it comes from a full-resolution pass or from the preview proxy:
+ * proxy results only serve proxy requests.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+#include "common/memory/memory_budget.h"
+#include "common/types/image_types.h"
+#include "operations/operation_descriptor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @class ResultCache
+ * @brief Thread-safe cache of rendered display images, keyed by (source, edits, output size).
+ */
+class ResultCache {
+public:
+    /**
+     * @brief Default memory budget: about fifty states at a 1920x1080 display size.
+     */
+    static constexpr std::size_t k_default_capacity_bytes = std::size_t{384} << 20;
+
+    /**
+     * @brief Shared, read-only rendered state.
+     */
+    using Image = std::shared_ptr<const Common::DisplayImage>;
+
+    /**
+     * @struct Key
+     * @brief Identity of a rendered state: equal keys render to the same pixels.
+     */
+    struct Key {
+        /** @brief Identity of the source (`sourceIdentity()`). */
+        std::uint64_t m_source{0};
+        /** @brief Hash of the normalized operations (`editHash()`). */
+        std::uint64_t m_edits{0};
+        /** @brief Output size. */
+        Common::ImageDim m_width{0};
+        Common::ImageDim m_height{0};
+
+        [[nodiscard]] bool operator==(const Key&) const = default;
+
+        /**
+         * @brief Hash of every field (also the name of the disk entry).
+         */
+        [[nodiscard]] std::uint64_t hash() const noexcept;
+    };
+
+    /**
+     * @brief Identity of a source file: its absolute path, modification time and size, and
+     *        whether it is the embedded preview of a RAW file.
+     * @return The identity, or `std::nullopt` if the file cannot be inspected.
+     */
+    [[nodiscard]] static std::optional<std::uint64_t> sourceIdentity(std::string_view path, bool preview);
+
+    /**
+     * @brief Hashes the operations as the pipeline sees them.
+     * @details Disabled operations are left out, and only the types and parameters of the
+     *          others count: identifiers and display names do not change the pixels.
+     *          A local mask counts by its contents version (`LocalMask::version`), not only
+     *          its id: a stroke misses the cache without touching the descriptors.
+     */
+    [[nodiscard]] static std::uint64_t editHash(std::span<const Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity_bytes Memory budget of the cached images.
+     */
+    explicit ResultCache(std::size_t capacity_bytes = k_default_capacity_bytes);
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /**
+     * @brief Looks a state up in memory, then on disk, and marks it most recently used.
+     * @param key The state.
+     * @param full_resolution_only true to ignore results of the preview proxy.
+     * @return The image, or nullptr on a miss.
+     */
+    [[nodiscard]] Image find(const Key& key, bool full_resolution_only);
+
+    /**
+     * @brief Inserts the image of a state, then evicts down to the budget.
+     * @details A proxy result never replaces a full-resolution one. Device-backed images
+     *          (`DisplayImage::isOnDevice()`) and images larger than the budget are not cached.
+     */
+    void insert(const Key& key, Image image, bool full_resolution);
+
+    /**
+     * @brief Writes the image of a state to the disk tier, then evicts it down to its budget.
+     * @details Blocking: call it off the latency path. Failures are logged only.
+     */
+    void storeOnDisk(const Key& key, const Common::DisplayImage& image);
+
+    /**
+     * @brief true if the disk tier is enabled (`AppConfig::getResultDiskCacheSizeMB() > 0`).
+     */
+    [[nodiscard]] static bool isDiskEnabled() noexcept;
+
+    /**
+     * @brief Removes every image from memory.
+     */
+    void clear();
+
+    /**
+     * @brief Bytes of images cached in memory.
+     */
+    [[nodiscard]] std::size_t sizeBytes() const;
+
+    /**
+     * @brief Evicts least recently used images until at least `bytes` are freed or the cache is empty.
+     * @return The bytes freed.
+     */
+    std::size_t evictBytes(std::size_t bytes);
+
+private:
+    /**
+     * @brief Cached image, in LRU order.
+     */
+    struct Entry {
+        Key m_key;
+        Image m_image;
+        bool m_full_resolution{false};
+        std::size_t m_bytes{0};
+    };
+
+    struct KeyHash {
+        [[nodiscard]] std::size_t operator()(const Key& key) const noexcept { return static_cast<std::size_t>(key.hash()); }
+    };
+
+    /**
+     * @brief Inserts under the lock. Caller holds `m_mutex`.
+     */
+    void insert_unsafe(const Key& key, Image image, bool full_resolution);
+
+    /**
+     * @brief Reads the disk entry of a state, if any.
+     */
+    [[nodiscard]] static Image loadFromDisk(const Key& key);
+
+    /**
+     * @brief Directory of the disk entries (configured, or under the system temporary directory).
+     */
+    [[nodiscard]] static std::filesystem::path directory();
+
+    /**
+     * @brief Deletes the least recently used disk entries until they fit in the budget.
+     * Caller holds `m_disk_mutex`.
+     */
+    static void evictDisk_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes);
+
+    /**
+     * @brief Guards the memory tier.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Entries, most recently used first.
+     */
+    std::list<Entry> m_entries;
+
+    /**
+     * @brief Key to entry.
+     */
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+
+    std::size_t m_capacity_bytes;
+    std::size_t m_size_bytes{0};
+
+    /**
+     * @brief Serializes the disk stores and evictions of this process.
+     */
+    std::mutex m_disk_mutex;
+
+    /**
+     * @brief Registration with the memory budget (declared last: unregistered before the entries go away).
+     */
+    Common::MemoryBudget::Registration m_budget_registration;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,125 @@
+/**
+ * @file smart_preview_store.h
+ * @brief Declaration of SmartPreviewStore (lossy half-float proxies of cataloged images).
+ *
+ * @details
+ * A smart preview is an image decoded once, at import, to `k_long_edge` pixels of linear
+ * RGBA and kept as a half-float OpenEXR with lossy DWAA compression (a few hundred kilobytes)
+ * in a directory next to the catalog. Loads edit it instead of the original under
+ * `AppConfig::getSmartPreviewPolicy`: when the original is offline, or always (originals on a
+ * slow NAS). It is installed as a preview (`ISourceManager::isPreview`), so zooming to 100% and
+ * exporting still decode the original, when it can be reached.
+ *
+ * Each entry records the modification time and size of its original: an original modified
+ * since the preview was made is decoded instead. An unreachable original cannot be checked,
+ * so its preview is used as it is.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/types/image_types.h"
+#include "config/smart_preview_policy.h"
+
+#include <OpenImageIO/imagebuf.h>
+
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+class ISourceManager;
+
+/**
+ * @class SmartPreviewStore
+ * @brief A directory of smart previews, one file per original.
+ *
+ * @details Stateless beyond its directory: thread-safe, cheap to construct. Entries are written
+ * through a temporary file renamed in place, so readers never see a partial one.
+ */
+class SmartPreviewStore {
+public:
+    /**
+     * @brief Long edge of the previews, in pixels.
+     */
+    static constexpr Common::ImageDim k_long_edge { 2560 };
+
+    /**
+     * @brief Creates a store over a directory (created on the first `store`).
+     */
+    explicit SmartPreviewStore(std::filesystem::path directory);
+
+    /**
+     * @brief The store configured in `AppConfig::getSmartPreviewDirectory`, if any.
+     */
+    [[nodiscard]] static std::optional<SmartPreviewStore> configured();
+
+    /**
+     * @brief The conventional store of a catalog: "<catalog name> Smart Previews" beside it.
+     */
+    [[nodiscard]] static std::filesystem::path directoryFor(const std::filesystem::path& catalog);
+
+    /**
+     * @brief The directory of the store.
+     */
+    [[nodiscard]] const std::filesystem::path& directory() const noexcept { return m_directory; }
+
+    /**
+     * @brief The file holding the preview of an original (whether it exists or not).
+     */
+    [[nodiscard]] std::filesystem::path entryPath(std::string_view source) const;
+
+    /**
+     * @brief Decodes an original at preview size and stores it.
+     * @param source The original.
+     * @param decoder Decodes the original (`ISourceManager::decodeThumbnail`).
+     * @return Success, or the decode or write error.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    generate(std::string_view source, const ISourceManager& decoder) const;
+
+    /**
+     * @brief Stores linear RGBA pixels as the preview of an original (replaces any previous one).
+     * @return Success, `FileNotFound` if the original cannot be inspected, or `IOError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    store(std::string_view source, const Common::ImageRegion& pixels) const;
+
+    /**
+     * @brief The preview a load of `source` should edit under `policy`, if any.
+     * @return The entry, or `std::nullopt` (no preview, stale preview, or the policy decodes
+     *         the original).
+     */
+    [[nodiscard]] std::optional<std::filesystem::path>
+    previewFor(std::string_view source, Config::SmartPreviewPolicy policy) const;
+
+    /**
+     * @brief Reads a preview as linear RGBA_F32.
+     * @return The image, or `DecodingError`.
+     */
+    [[nodiscard]] static std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    read(const std::filesystem::path& entry);
+
+    /**
+     * @brief Deletes the preview of an original (nothing if there is none).
+     */
+    void remove(std::string_view source) const;
+
+private:
+    /**
+     * @brief Directory of the entries.
+     */
+    std::filesystem::path m_directory;
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -6,10 +6,25 @@
  * Concrete implementation of ISourceManager.
  *
  * Features:
- * - Thread-safe access via `std::mutex`.
+ * - Thread-safe access via `std::mutex`, which is never held while decoding.
  * - Pre-conversion of source images to RGBA_F32 during `loadFile` to optimize
  *   subsequent tile access.
- * - Relies on a global OIIO ImageCache singleton for resource management.
+ * - Asynchronous, cancellable loads (`loadFileAsync`) and filmstrip prefetch (`prefetch`)
+ *   on a dedicated loader pool, backed by a bounded `DecodedImageCache`.
+ * - Optionally (`setKeepsRecentImages`), images leaving the decoded cache are kept compressed
+ *   (`CompressedImageCache`): going back to them restores them instead of decoding again.
+ * - RAW files first show a preview (embedded JPEG or half-size draft demosaic), then swap in
+ *   the full demosaic (`AppConfig::getRawLoadMode`).
+ * - Decodes straight into the final RGBA_F32 storage (no intermediate full-frame buffer).
+ * - Huge standard images (`AppConfig::getTiledSourceMinPixels`) are tile-backed: `getTile`
+ *   reads only the tiles it needs through a shared, bounded OIIO ImageCache.
+ * - Prefetches and batch decodes (`decodeBatch`, `decodeAsync`) run concurrently on a
+ *   memory-bounded `DecodeService`.
+ * - Thumbnails (`decodeThumbnail`) come from the embedded preview or the draft demosaic of
+ *   RAW files, from the tile cache for tile-backed files, and from a DCT-scaled decode for JPEG
+ *   files (`JpegScaledDecoder`), bypassing the decoded cache.
+ * - Catalog metadata (`readMetadata`, `readMetadataBatch`) comes from the file header alone:
+ *   the decoder opens the file and is closed before any pixel (or RAW sensor data) is read.
  *
  * @author CaptureMoment Team
  * @date 2025
@@ -18,13 +33,29 @@
 #pragma once
 
 #include "managers/i_source_manager.h"
+#include "managers/compressed_image_cache.h"
+#include "managers/decoded_image_cache.h"
+#include "managers/disk_image_cache.h"
+#include "managers/decode_service.h"
+#include "common/cancellation_token.h"
+#include "common/memory/memory_budget.h"
+#include "common/memory/read_ahead_file.h"
+#include "workers/engine_scheduler.h"
+#include "image_config/raw_settings.h"
+#include "image_processing/halide/halide_demosaic.h"
 
+#include <OpenImageIO/filesystem.h>
 #include <OpenImageIO/imagebuf.h>
 #include <OpenImageIO/imagecache.h>
 
+#include <atomic>
+#include <deque>
+#include <future>
 #include <mutex>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace CaptureMoment::Core {
 
@@ -36,6 +67,59 @@ namespace Managers {
  *
  * Manages the lifetime of an `OIIO::ImageBuf`. Ensures that all internal
  * representations are converted to the standard RGBA_F32 format upon loading.
+ *
+ * **Loading:**
+ * - Decoding runs without holding `m_mutex`; only the final swap of the loaded image takes it.
+ * - Every load (synchronous or not) supersedes the older ones: a superseded load that finishes
+ *   decoding keeps its image in the cache but does not install it (`CoreError::LoadCancelled`).
+ * - Loads run on the interactive lane of the loader pool. Prefetches run on the thumbnail lane
+ *   of the decode service, several at once within its memory budget, so a prefetch never delays
+ *   the image the user asked for. A path being decoded is never decoded twice: a load of a path
+ *   being prefetched waits for that decode.
+ *
+ * **RAW preview first:** unless `RawLoadMode::full_demosaic`, a RAW load that misses the
+ * full-quality cache entry installs a preview (`isPreview()`) and completes:
+ * - `embedded_preview_first`: the embedded JPEG (a draft if there is none); the full demosaic
+ *   is queued right away.
+ * - `draft_first`: a half-size draft demosaic (`RawSettings::draft_settings()`, cached as well);
+ *   the full demosaic waits for `requestFullQuality()` (zoom to 100%, export).
+ *
+ * The full demosaic runs on the refinement lane; once installed, the refined callback is
+ * notified. A newer load cancels it before the demosaic starts.
+ *
+ * **JPEG preview first:** a JPEG load that misses the full-resolution cache entry installs the
+ * file decoded by libjpeg at 1/2, 1/4 or 1/8 scale (`AppConfig::getJpegPreviewLongEdge`,
+ * `JpegScaledDecoder`) as a preview, like a RAW draft: the full decode waits for
+ * `requestFullQuality()`. The scaled decode is not cached (it takes a few milliseconds).
+ *
+ * **Smart previews:** with a `SmartPreviewStore` configured, a load whose original is offline
+ * (or any load, under `SmartPreviewPolicy::Always`) installs the stored proxy as a preview. A
+ * full-quality request then decodes the original; if it is still unreachable, the preview stays.
+ *
+ * Full-quality RAW decodes are also persisted (`DiskImageCache`, written on the thumbnail lane):
+ * re-opening a RAW file in a later session maps the cached decode instead of demosaicing.
+ *
+ * **Halide demosaic:** with `RawDemosaicEngine::halide`, a RAW decode reads the Bayer mosaic
+ * (no LibRaw processing) and demosaics it with `ImageProcessing::HalideDemosaic`, on the GPU
+ * when one is configured. The last mosaics stay resident (`k_resident_mosaics`): the draft shown
+ * at load and the full-quality decode requested later read the file once. Mosaics LibRaw cannot
+ * hand out undemosaiced (X-Trans, linear DNG) go through LibRaw.
+ *
+ * **RAW settings changes:** `redevelopRaw` develops the loaded RAW file again from memory: the
+ * resident mosaic with the Halide engine (no I/O, no decompression), otherwise LibRaw reading
+ * the file bytes kept for the loaded file (no I/O). OIIO reopens the file for each decode, so
+ * LibRaw still unpacks it.
+ *
+ * The loaded image shares its pixels with the cache; `setTile` copies them on the first write,
+ * so the cache always holds the file's decoded pixels. `adoptPixels` (a commit) installs pixels
+ * shared with the caller the same way, wrapped in an `ImageBuf` instead of copied, and
+ * `shareLoadedImage` (a virtual copy) the decode loaded by another source manager.
+ *
+ * **Tile-backed sources:** standard files of at least `AppConfig::getTiledSourceMinPixels()`
+ * pixels are not decoded at load (nor prefetched). `getTile` reads the requested region through
+ * the tile cache (`AppConfig::getSourceTileCacheSizeMB()`), converts it to linear RGBA_F32 and
+ * returns it, so only the tiles in use are held in memory. The first `setTile` materializes
+ * the whole frame, as the written pixels have nowhere else to live.
  */
 class SourceManager : public ISourceManager {
 public:
@@ -47,11 +131,28 @@ public:
     // -----------------------------------------------------------------
 
     [[nodiscard]] std::expected<void, ErrorHandling::CoreError> loadFile(std::string_view path) override;
+    [[nodiscard]] std::future<std::expected<void, ErrorHandling::CoreError>> loadFileAsync(std::string_view path) override;
+    void cancelLoad() override;
+    void prefetch(std::span<const std::string> paths) override;
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    decodeThumbnail(std::string_view path, Common::ImageDim max_long_edge) const override;
+    [[nodiscard]] std::expected<ImageMetadata, ErrorHandling::CoreError>
+    readMetadata(std::string_view path) const override;
+    [[nodiscard]] std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>>
+    readMetadataBatch(std::span<const std::string> paths, const Common::CancellationToken& token = {}) const override;
+    [[nodiscard]] bool isPreview() const override;
+    void requestFullQuality() override;
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    redevelopRaw(const ImageConfig::Raw::RawSettings& settings) override;
+    void setRefinedCallback(RefinedCallback callback) override;
+    [[nodiscard]] bool isTileBacked() const override;
+    [[nodiscard]] SourceTileCacheStats tileCacheStats() const override;
     void unload() override;
     [[nodiscard]] bool isLoaded() const override;
     [[nodiscard]] Common::ImageDim width() const noexcept override;
     [[nodiscard]] Common::ImageDim height() const noexcept override;
     [[nodiscard]] Common::ImageChan channels() const noexcept override;
+    [[nodiscard]] Common::ImageOrientation orientation() const noexcept override;
 
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> getTile(
         Common::ImageDim x, Common::ImageDim y, Common::ImageDim width, Common::ImageDim height
@@ -59,28 +160,110 @@ public:
 
     [[nodiscard]] std::expected<void, ErrorHandling::CoreError> setTile(const Common::ImageRegion& tile) override;
 
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> setTile(
+        const Common::ImageView& tile, Common::ImageCoord x, Common::ImageCoord y
+        ) override;
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    adoptPixels(std::shared_ptr<const Common::ImageRegion> pixels) override;
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    shareLoadedImage(const ISourceManager& other) override;
+
     [[nodiscard]] std::optional<std::string> getMetadata(std::string_view key) const override;
 
     [[nodiscard]] std::string getImageSourcePath() const override;
 
+    /**
+     * @brief Keeps the images evicted from the decoded cache compressed in memory (interactive browsing).
+     * @details Off by default: exports and thumbnails rarely come back to a file. Compressed on
+     *          the thumbnail lane of the loader pool, never on the latency path of a load.
+     *          Disabling drops the compressed images.
+     */
+    void setKeepsRecentImages(bool enabled);
+
+    // -----------------------------------------------------------------
+    // Batch decoding (export, thumbnails)
+    // -----------------------------------------------------------------
+
+    /**
+     * @brief Decodes files concurrently (through the decoded-image cache) and waits for them.
+     * @details Tile-backed files are not decoded whole: their result is `UnsupportedFormat`.
+     * @return One decoded image (or error) per path, in the order of `paths`.
+     */
+    [[nodiscard]] std::vector<DecodeService::Result> decodeBatch(
+        std::span<const std::string> paths,
+        ImageConfig::Raw::RawQuality quality = ImageConfig::Raw::RawQuality::full,
+        const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Queues the decode of a file on the decode service; does not load it.
+     * @param on_decoded Receives the decoded image (or error) on a decoding thread.
+     */
+    void decodeAsync(std::string path, ImageConfig::Raw::RawQuality quality, Workers::TaskPriority priority,
+                     DecodeService::ResultCallback on_decoded, Common::CancellationToken token = {});
+
+    /**
+     * @brief Loads a standard file tile-backed whatever its size, for a streaming export.
+     * @details `getTile` then reads any region through the tile cache; nothing is decoded whole.
+     * @return void, `UnsupportedFormat` for RAW and HEIC files (decoded whole), or the open error.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> openStreaming(std::string_view path);
+
+    // -----------------------------------------------------------------
+    // Derived sources (HDR merge)
+    // -----------------------------------------------------------------
+
+    /**
+     * @brief Decodes a file at full quality into the persistent cache and maps it, bypassing the
+     *        decoded-image cache: the frames of a merge are read strip by strip, never held whole.
+     * @details A persisted decode is mapped at once. With the disk cache disabled (or a failed
+     *          store), the decode is returned in memory.
+     * @return The decoded image (RGBA, half-float when mapped), or the decode error.
+     */
+    [[nodiscard]] std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+    decodePersistent(std::string_view path, const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Loads an image produced elsewhere (an HDR merge) as the source, under a path.
+     * @details Supersedes the pending loads; the image is also cached under the path, so a later
+     *          `loadFile` of it reuses the pixels while they are cached.
+     * @return void, `InvalidImageRegion` for a null image, or `LoadCancelled` if superseded.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    loadDecoded(std::string_view path, DecodedImageCache::Buffer buffer);
+
 private:
     /**
-     * @brief The main image buffer containing the loaded image data.
-     * Managed by std::unique_ptr (RAII).
+     * @brief Decoded pixels of the loaded image, shared with the cache (read-only).
+     */
+    DecodedImageCache::Buffer m_source_buf;
+
+    /**
+     * @brief Private copy of `m_source_buf`, made by the first `setTile` (then the loaded image).
      */
     std::unique_ptr<OIIO::ImageBuf> m_image_buf;
 
     /**
-     * @brief Mutex protecting access to m_image_buf, m_current_path, and state changes.
-     * Mutable to allow locking in const methods.
+     * @brief Tile-backed loaded image: bound to the tile cache, pixels read on demand.
      */
-    mutable std::mutex m_mutex;
+    std::unique_ptr<OIIO::ImageBuf> m_tiled_buf;
 
     /**
-     * @brief Pointer to OIIO's global image cache.
-     * This class does NOT manage the lifetime of the ImageCache object.
+     * @brief Number of channels of the tile-backed file.
      */
-    OIIO::ImageCache* m_cache;
+    int m_tiled_channels{0};
+
+    /**
+     * @brief Color space the tiles are converted from to linear (empty if already linear).
+     */
+    std::string m_tiled_color_space;
+
+    /**
+     * @brief Mutex protecting access to the buffers, m_current_path, and state changes.
+     * Mutable to allow locking in const methods. Never held while decoding.
+     */
+    mutable std::mutex m_mutex;
 
     /**
      * @brief The file path of the currently loaded image.
@@ -88,9 +271,274 @@ private:
     std::string m_current_path;
 
     /**
-     * @brief Provides access to OIIO's global ImageCache singleton.
+     * @brief true while the loaded image is a preview awaiting its full-quality decode.
+     */
+    bool m_is_preview{false};
+
+    /**
+     * @brief true once the full-quality decode of the loaded preview was queued.
+     */
+    bool m_refinement_queued{false};
+
+    /**
+     * @brief Guards `m_on_refined`; held while the callback runs.
+     */
+    std::mutex m_refined_mutex;
+
+    /**
+     * @brief Notified when a preview is replaced by its full-quality image.
+     */
+    RefinedCallback m_on_refined;
+
+    /**
+     * @brief Dimensions of the loaded image, readable without locking.
+     */
+    std::atomic<Common::ImageDim> m_width{0};
+    std::atomic<Common::ImageDim> m_height{0};
+    std::atomic<Common::ImageChan> m_channels{0};
+
+    /**
+     * @brief EXIF orientation of the loaded image (its pixels stay in the stored frame).
+     */
+    std::atomic<Common::ImageOrientation> m_orientation{Common::ImageOrientation::Normal};
+
+    /**
+     * @brief Recently viewed images evicted from `m_decoded_cache`, compressed (declared first:
+     *        outlives the decoded cache handing images to it).
+     */
+    CompressedImageCache m_compressed_cache;
+
+    /**
+     * @brief Last decoded images, by path.
+     */
+    DecodedImageCache m_decoded_cache;
+
+    /**
+     * @brief Persisted full-quality RAW decodes (across sessions).
+     */
+    DiskImageCache m_disk_cache;
+
+    /**
+     * @brief Guards `m_decoding`.
+     */
+    std::mutex m_decoding_mutex;
+
+    /**
+     * @brief Decodes in progress, by path: later requests for the same path wait on them.
+     */
+    std::unordered_map<std::string, std::shared_future<std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>>> m_decoding;
+
+    /**
+     * @brief Sensor mosaic of a RAW file and the file's metadata, kept for its next demosaic.
+     */
+    struct ResidentMosaic {
+        /**
+         * @brief Path of the RAW file.
+         */
+        std::string m_path;
+
+        /**
+         * @brief The undemosaiced samples.
+         */
+        ImageProcessing::RawMosaic m_mosaic;
+
+        /**
+         * @brief Metadata of the file, camera profile included, copied to each demosaic.
+         */
+        OIIO::ParamValueList m_metadata;
+    };
+
+    /**
+     * @brief Number of mosaics kept resident (the loaded file and the last prefetches).
+     */
+    static constexpr std::size_t k_resident_mosaics{2};
+
+    /**
+     * @brief Guards `m_resident_mosaics` and `m_demosaic`. Held while demosaicing, never while reading a file.
+     */
+    mutable std::mutex m_mosaic_mutex;
+
+    /**
+     * @brief Most recently used mosaics first.
+     */
+    mutable std::deque<std::shared_ptr<const ResidentMosaic>> m_resident_mosaics;
+
+    /**
+     * @brief Demosaic pipeline of the Halide engine (compiled on first use).
+     */
+    mutable ImageProcessing::HalideDemosaic m_demosaic;
+
+    /**
+     * @brief Contents of the RAW file last redeveloped, kept for its next settings change.
+     */
+    struct ResidentRawFile {
+        /**
+         * @brief Path of the RAW file.
+         */
+        std::string m_path;
+
+        /**
+         * @brief The file, as stored (compressed).
+         */
+        Common::ReadAheadFile m_contents;
+    };
+
+    /**
+     * @brief Guards `m_resident_raw_file`.
+     */
+    std::mutex m_raw_file_mutex;
+
+    /**
+     * @brief Bytes of the RAW file last redeveloped (replaced when another file is redeveloped).
+     */
+    std::shared_ptr<const ResidentRawFile> m_resident_raw_file;
+
+    /**
+     * @brief Latest load generation: bumped by every load and `cancelLoad`.
+     */
+    std::shared_ptr<Common::CancellationToken::Counter> m_load_generation;
+
+    /**
+     * @brief Latest prefetch generation: bumped by every `prefetch` call (drops stale prefetches).
+     */
+    std::shared_ptr<Common::CancellationToken::Counter> m_prefetch_generation;
+
+    /**
+     * @brief Concurrent decodes of many files (prefetches, batches), through `acquireDecoded`.
+     * @details Its decodes queue disk cache writes on `m_loader`: destroyed explicitly, first.
      */
-    static OIIO::ImageCache* getGlobalCache();
+    std::unique_ptr<DecodeService> m_decode_service;
+
+    /**
+     * @brief Loader pool (loads and refinements, disk cache writes on the thumbnail lane).
+     * @details Declared last: destroyed first, while the members its tasks use are alive.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_loader;
+
+    /**
+     * @brief Loads under a token: cache or decode, then installs unless the token was cancelled.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    loadWithToken(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Shared tile cache of the tile-backed sources (created on first use).
+     */
+    [[nodiscard]] static std::shared_ptr<OIIO::ImageCache> tileCache();
+
+    /**
+     * @brief Registration of the tile cache with the memory budget (created on first use).
+     * @details Under pressure the budget lowers the cache capacity; OIIO evicts down to it as
+     *          tiles are next read, and `openTiled` restores the configured capacity.
+     */
+    [[nodiscard]] static const Common::MemoryBudget::Registration& tileCacheBudget();
+
+    /**
+     * @brief Checks if a file is to be opened tile-backed (standard file, large enough).
+     * @details Reads the file header only (through the tile cache).
+     */
+    [[nodiscard]] bool shouldOpenTiled(std::string_view path) const;
+
+    /**
+     * @brief Binds a file to the tile cache and installs it as a tile-backed image.
+     * @return void if installed, `LoadCancelled` if superseded, or the open error.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    openTiled(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Reads a region of the tile-backed image as linear RGBA_F32. Caller holds m_mutex.
+     * @param dst Destination of `width * height` RGBA float pixels.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    readTiled_unsafe(Common::ImageDim x, Common::ImageDim y,
+                     Common::ImageDim width, Common::ImageDim height, float* dst) const;
+
+    /**
+     * @brief Returns the decoded image of a path: from the cache, from a decode in progress,
+     *        or decoded now (and cached).
+     * @param token Skips the decode if cancelled before it starts.
+     */
+    [[nodiscard]] std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+    acquireDecoded(const std::string& path, ImageConfig::Raw::RawQuality quality,
+                   const Common::CancellationToken& token);
+
+    /**
+     * @brief true if the decode of a cache key is in the decoded cache or in the compressed one.
+     */
+    [[nodiscard]] bool isDecodeCached(const std::string& key) const;
+
+    /**
+     * @brief Queues the persistence of a RAW decode on the thumbnail lane of the loader pool.
+     */
+    void storeOnDisk(DiskImageCache::Key key, DecodedImageCache::Buffer buffer);
+
+    /**
+     * @brief Decodes a file to RGBA_F32, dispatching on its type. Touches no member state
+     *        but the resident mosaics.
+     * @param quality Demosaic quality (RAW files only).
+     */
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    decodeFile(std::string_view path, ImageConfig::Raw::RawQuality quality) const;
+
+    /**
+     * @brief Installs the preview of a RAW file (embedded JPEG or draft, per `mode`);
+     *        queues its full demosaic with `embedded_preview_first`.
+     * @return void if the preview was installed, `LoadCancelled` if superseded, or the
+     *         decode error if no preview could be made.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    loadPreviewFirst(const std::string& path, ImageConfig::Raw::RawLoadMode mode,
+                     const Common::CancellationToken& token);
+
+    /**
+     * @brief Installs the smart preview of `path` if the policy prefers it to the original
+     *        (`AppConfig::getSmartPreviewPolicy`); the original is decoded on `requestFullQuality()`.
+     * @return void if the preview was installed, `LoadCancelled` if superseded, or an error if
+     *         the original is decoded instead (`UnsupportedFormat`: no preview to use).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    loadSmartPreview(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Installs a DCT-scaled decode of a large JPEG file as its preview
+     *        (`AppConfig::getJpegPreviewLongEdge`); the full decode waits for `requestFullQuality()`.
+     * @return void if the preview was installed, `LoadCancelled` if superseded, or an error if
+     *         the file is decoded whole instead (`UnsupportedFormat`: no scale to gain from).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    loadScaledJpegFirst(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Queues the full demosaic of the loaded preview of `path`, once.
+     */
+    void queueRefinement(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Demosaics a RAW file whose preview is loaded, installs it and notifies `m_on_refined`.
+     */
+    void refineFromPreview(const std::string& path, const Common::CancellationToken& token);
+
+    /**
+     * @brief Makes a decoded image the loaded one, unless the token was cancelled.
+     * @param is_preview true for a preview awaiting its full-quality decode.
+     * @return false if the token was cancelled (nothing installed).
+     */
+    [[nodiscard]] bool install(const std::string& path, DecodedImageCache::Buffer buffer,
+                               const Common::CancellationToken& token, bool is_preview = false);
+
+    /**
+     * @brief Loaded pixels (private copy if any, shared decode or tile-backed image otherwise).
+     *        Caller holds m_mutex.
+     */
+    [[nodiscard]] const OIIO::ImageBuf* buffer_unsafe() const noexcept;
+
+    /**
+     * @brief Writable loaded pixels, copying the shared decode (or reading the whole tile-backed
+     *        image) on first use. Caller holds m_mutex.
+     * @return The private copy, or nullptr if the tile-backed image could not be read.
+     */
+    [[nodiscard]] OIIO::ImageBuf* writableBuffer_unsafe();
 
     /**
      * @brief Internal helper to unload the image without locking.
@@ -106,13 +554,40 @@ private:
 
 
     /**
-     * @brief Loads an image file via OIIO ImageCache into an ImageBuf (F32).
+     * @brief Decodes an image file directly into an RGBA_F32 ImageBuf.
+     *
+     * The decoder writes the file channels (at most 4) into the first slots of each pixel of
+     * the final buffer with a 4-float stride, so no full-frame intermediate copy is made; the
+     * missing channels are then filled in place (`expandToRgba`). The file metadata is kept.
+     *
+     * Without a proxy, a file on network storage is read whole first (`Common::ReadAheadFile`,
+     * within `AppConfig::getNetworkReadAheadMaxMB`) and decoded from memory.
+     *
      * @param path The file path to load.
      * @param config Optional OIIO configuration attributes (for RAW, HEIF, etc.).
+     * @param proxy Optional in-memory contents of the file, used if the decoder reads proxies.
+     * @param threads Threads of the decoder and of its format conversion (0: OIIO's pool size).
      * @return The loaded ImageBuf on success, or a CoreError on failure.
      */
     [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
-    loadImageBuffer(std::string_view path, const OIIO::ImageSpec* config = nullptr);
+    loadImageBuffer(std::string_view path, const OIIO::ImageSpec* config = nullptr,
+                    OIIO::Filesystem::IOProxy* proxy = nullptr, int threads = 0) const;
+
+    /**
+     * @brief Decodes an sRGB-encoded 8/16-bit file straight to linear RGBA_F32, in one pass.
+     *
+     * Bands of rows are read in the file's sample type, then decoded through the sRGB table
+     * (`Utils::srgbToLinearTable`) and expanded to RGBA in parallel over rows, while the band is
+     * still in cache: no float copy in the file layout, no separate color conversion pass.
+     * A file on network storage is read ahead, as by `loadImageBuffer`.
+     *
+     * @param path The file path to load.
+     * @param config Optional OIIO configuration attributes (HEIF, etc.).
+     * @return The linear image, `UnsupportedFormat` if the file is not sRGB-encoded integers
+     *         (the caller falls back to `loadImageBuffer`), or the decode error.
+     */
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    loadSrgbLinearized(std::string_view path, const OIIO::ImageSpec* config = nullptr) const;
 
     // ============================================================
     // RAW File Handling
@@ -148,47 +623,147 @@ private:
      * This method handles RAW camera files (NEF, CR2, ARW, DNG, etc.) by configuring
      * OIIO/LibRaw with appropriate settings for photo editing:
      * - Full resolution output
-     * - AHD demosaicing algorithm
-     * - Linear color space (sRGB-linear)
-     * - Camera white balance preserved
+     * - AMaZE demosaicing algorithm
+     * - Camera-native linear colors: unity white balance, no color matrix
      * - Highlight recovery enabled
      *
+     * The as-shot white balance and the camera matrix are stored instead as a
+     * `Operations::CameraProfile` string attribute of the buffer, applied by the WhiteBalance
+     * operation of the pipeline. A file the decoder cannot describe is decoded again with
+     * both baked in (`developedRawSettings`), without the attribute.
+     *
+     * With `RawQuality::draft`, `RawSettings::draft_settings()` is used instead: half size,
+     * PPG, no FBDD (about 4x faster, a quarter of the memory), for interactive previews.
+     *
+     * With `RawDemosaicEngine::halide`, `demosaicResident` is tried first.
+     *
      * @param path The path to the RAW file.
-     * @return std::expected<void, CoreError> Success or error code.
+     * @param quality Demosaic quality.
+     * @return The decoded RGBA_F32 buffer, or an error code. The loaded image is not touched.
      */
-    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> loadRawFile(std::string_view path);
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    loadRawFile(std::string_view path, ImageConfig::Raw::RawQuality quality = ImageConfig::Raw::RawQuality::full) const;
+
+    /**
+     * @brief Demosaics a RAW file with the Halide engine, from its resident mosaic (read if needed).
+     *
+     * Drafts are half size (one pixel per CFA quad), full quality is a Malvar-He-Cutler
+     * interpolation. The result is camera-native and carries the camera profile, like a LibRaw
+     * decode; it is not oriented (LibRaw does not orient either, the metadata does).
+     *
+     * @param path The path to the RAW file.
+     * @param quality Demosaic quality.
+     * @return The decoded RGBA_F32 buffer, `UnsupportedFormat` if the file has no Bayer mosaic
+     *         or no camera profile (the caller uses LibRaw), or the error.
+     */
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    demosaicResident(std::string_view path, ImageConfig::Raw::RawQuality quality) const;
+
+    /**
+     * @brief Develops a RAW file with `settings` (made camera-native), reading it from memory.
+     *
+     * The Halide engine demosaics the resident mosaic (half size if `settings` asks for it).
+     * LibRaw decodes the file from its resident bytes (`residentRawFile`); a decoder that reads
+     * files only gets the path.
+     *
+     * @return The decoded RGBA_F32 buffer with its camera profile (or developed colors), or the error.
+     */
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+    developRaw(const std::string& path, const ImageConfig::Raw::RawSettings& settings);
+
+    /**
+     * @brief Bytes of a RAW file: the resident ones if they are this file's, else read now and kept.
+     */
+    [[nodiscard]] std::expected<std::shared_ptr<const ResidentRawFile>, ErrorHandling::CoreError>
+    residentRawFile(const std::string& path);
+
+    /**
+     * @brief Reads the undemosaiced Bayer mosaic of a RAW file and its metadata.
+     * @return The mosaic, `UnsupportedFormat` if the file has no 2x2 Bayer mosaic, or the read error.
+     */
+    [[nodiscard]] static std::expected<ResidentMosaic, ErrorHandling::CoreError> readRawMosaic(std::string_view path);
+
+    /**
+     * @brief Fingerprint of the persisted full-quality RAW decodes: the settings and the engine.
+     */
+    [[nodiscard]] static std::uint64_t rawDecodeFingerprint(ImageConfig::Raw::RawQuality quality) noexcept;
+
+    /**
+     * @brief Development settings of a RAW decode quality (full: AMaZE; draft: `draft_settings()`).
+     */
+    [[nodiscard]] static ImageConfig::Raw::RawSettings rawSettings(ImageConfig::Raw::RawQuality quality) noexcept;
+
+    /**
+     * @brief Threads of a RAW decode started from the calling thread.
+     * @details The concurrency budget, bounded by the helper cap of the caller's lane (a
+     *          prefetch in the thumbnail lane leaves the cores to the interactive work) and by
+     *          `RawSettings::get_decode_threads()`. Applied to OIIO's reader and, with OpenMP,
+     *          to LibRaw's parallel decompression and demosaic.
+     */
+    [[nodiscard]] static int rawDecodeThreads(const ImageConfig::Raw::RawSettings& settings) noexcept;
+
+    /**
+     * @brief `rawSettings` with the camera white balance and matrix baked in (ProPhoto linear).
+     * @details Fallback of the RAW files without a usable camera profile.
+     */
+    [[nodiscard]] static ImageConfig::Raw::RawSettings developedRawSettings(ImageConfig::Raw::RawQuality quality) noexcept;
+
+    /**
+     * @brief Decodes the embedded preview (camera JPEG) of a RAW file, without demosaicing.
+     *
+     * The preview is linearized like standard files. It is often smaller than the sensor
+     * image and carries the camera's rendering, so it serves display and culling only.
+     *
+     * @param path The path to the RAW file.
+     * @return The decoded RGBA_F32 preview, or `UnsupportedFormat` if there is none.
+     */
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> loadRawPreview(std::string_view path) const;
 
     /**
      * @brief Loads a HEIC image file with optimized libheif settings.
      *
      * This method handles HEIC files, which often require special handling for
      * orientation and alpha. It configures libheif to:
-     * - Automatically reorient based on EXIF metadata (recommended for smartphone photos).
+     * - Leave the pixels in their stored order; the EXIF orientation stays in the metadata.
      * - Preserve unassociated alpha if present.
      *
      * @param path The path to the HEIC file.
-     * @return std::expected<void, CoreError> Success or error code.
+     * @return The decoded RGBA_F32 buffer, or an error code. The loaded image is not touched.
      */
-    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> loadHeicFile(std::string_view path);
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> loadHeicFile(std::string_view path) const;
 
     /**
      * @brief Loads a standard image file (JPEG, PNG, TIFF, etc.).
      *
-     * This method handles non-RAW image formats using OIIO ImageCache.
+     * This method handles non-RAW image formats with a direct ImageInput read.
      * No special RAW processing is applied.
      *
      * @param path The path to the image file.
-     * @return std::expected<void, CoreError> Success or error code.
+     * @return The decoded RGBA_F32 buffer, or an error code. The loaded image is not touched.
      */
-    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> loadStandardFile(std::string_view path);
+    [[nodiscard]] std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> loadStandardFile(std::string_view path) const;
 
     /**
-     * @brief Converts an OIIO ImageBuf to RGBA_F32 internal format.
+     * @brief Fills the channels a decode into RGBA_F32 storage left out, in place.
+     *
+     * Gray is replicated to RGB (1 or 2 channels), gray+alpha keeps its alpha, and alpha
+     * defaults to 1 for sources without one.
+     *
+     * @param pixels RGBA float pixels holding `source_channels` decoded channels each.
+     * @param pixel_count Number of pixels.
+     * @param source_channels Number of channels of the file.
+     */
+    static void expandToRgba(float* pixels, std::size_t pixel_count, int source_channels) noexcept;
+
+    /**
+     * @brief Converts an OIIO ImageBuf to RGBA_F32 internal format (copy).
+     *
+     * Only used for embedded previews, which are small and come as an already decoded buffer.
      *
      * @param src_buf Source buffer (any format).
-     * @return std::expected<void, CoreError> Success or error code.
+     * @return The RGBA_F32 buffer, or an error code.
      */
-    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> convertToRgbaInternal(OIIO::ImageBuf&& src_buf);
+    [[nodiscard]] static std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> convertToRgbaInternal(const OIIO::ImageBuf& src_buf);
 };
 
 } // namespace Managers
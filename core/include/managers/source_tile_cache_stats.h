@@ -0,0 +1,58 @@
+/**
+ * @file source_tile_cache_stats.h
+ * @brief Counters of the tile cache backing the tile-backed image sources.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Managers {
+
+/**
+ * @struct SourceTileCacheStats
+ * @brief Snapshot of the OIIO ImageCache counters, cumulated since the application started.
+ */
+struct SourceTileCacheStats {
+    /**
+     * @brief Tile lookups served from memory.
+     */
+    std::uint64_t m_hits{0};
+
+    /**
+     * @brief Tile lookups that had to read the file.
+     */
+    std::uint64_t m_misses{0};
+
+    /**
+     * @brief Bytes read from the files (compressed size on disk).
+     */
+    std::uint64_t m_bytes_read{0};
+
+    /**
+     * @brief Memory currently held by the cached tiles, in bytes.
+     */
+    std::uint64_t m_memory_used_bytes{0};
+
+    /**
+     * @brief Configured capacity of the cache, in bytes.
+     */
+    std::uint64_t m_capacity_bytes{0};
+
+    /**
+     * @brief Fraction of the lookups served from memory (0 without lookups).
+     */
+    [[nodiscard]] double hitRate() const noexcept
+    {
+        const std::uint64_t lookups { m_hits + m_misses };
+        return lookups > 0 ? static_cast<double>(m_hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+} // namespace Managers
+
+} // namespace CaptureMoment::Core
@@ -11,10 +11,15 @@
  * - **Contexts:** Owns `PipelineContext` (Strategies) and `WorkerContext` (Executors).
  * - **Move Semantics:** All data processing methods accept ownership of data via `std::move`.
  * - **Thread-Safe:** Uses mutexes to protect the working image and status flags.
+ * - **Scheduled:** Passes run on the engine scheduler (proxy/ROI previews in the interactive
+ *   lane, full-resolution passes in the refinement lane); completion is a continuation, and
+ *   waiters block on a condition variable.
  * - **Stateless Processing:** Does not store operation lists; it receives, processes, and discards.
- * - **Coalescing Updates:** If an update is requested while another is in progress,
- *   the new request replaces any previously pending request, optimizing for the most
- *   recent state during rapid UI interactions (e.g., dragging a slider).
+ * - **Superseding Updates:** Requests are numbered by generation. A new request replaces
+ *   any pending one and cancels the running pass, which stops between Halide tasks, so
+ *   rapid UI interactions (e.g., dragging a slider) never wait for stale work.
+ * - **Result Cache:** Display images are cached by (source, edits, display size) in a
+ *   `ResultCache`; a request for a state rendered before completes without a pass.
  *
  * @author CaptureMoment Team
  * @date 2026
@@ -24,10 +29,27 @@
 
 #include "operations/operation_descriptor.h"
 #include "managers/i_source_manager.h"
+#include "managers/progressive_refinement.h"
+#include "managers/result_cache.h"
 #include "image_processing/interfaces/i_working_image_hardware.h"
 #include "operations/operation_factory.h"
+#include "operations/parameter_snapshot.h"
+#include "common/types/image_orientation.h"
 #include "common/types/image_types.h"
-
+#include "common/types/region_of_interest.h"
+#include "common/display_image.h"
+#include "common/image_view.h"
+#include "common/cancellation_token.h"
+#include "common/seqlock.h"
+#include "common/types/processing_outcome.h"
+#include "common/types/processing_timings.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -35,16 +57,19 @@
 #include <string_view>
 #include <string>
 #include <optional>
+#include <span>
 
 
 namespace CaptureMoment::Core {
 
 namespace Pipeline {
 class PipelineContext;
+class VariantRenderer;
 }
 
 namespace Workers {
 class WorkerContext;
+class EngineScheduler;
 }
 
 namespace ImageProcessing {
@@ -61,20 +86,24 @@ namespace Managers {
  * @details
  * This class receives processing requests (e.g., apply operations) from the engine,
  * prepares the working memory, delegates execution to workers via the WorkerContext,
- * and updates the final result. It implements a coalescing strategy for incoming
- * operations to optimize responsiveness during rapid UI interactions.
+ * and updates the final result. Newer requests supersede older ones to keep the
+ * engine responsive during rapid UI interactions.
+ *
+ * **Superseding Behavior:**
+ * - Every request receives the next generation number; the tokens of all older
+ *   requests report `isCancelled()` from then on.
+ * - When `applyOperations` is called while an update `isUpdatePending()`, the new request
+ *   is stored as pending. A request already pending is dropped and its future settles
+ *   as `ProcessingOutcome::Superseded`.
+ * - The running pass observes its cancelled token and aborts within one Halide task
+ *   (see `Pipeline::CancellableJITContext`); its future settles as `Superseded`, unless
+ *   it completed first. The pending request is then launched.
+ * - `cancelProcessing()` cancels the running and pending requests without a replacement
+ *   (`ProcessingOutcome::Cancelled`).
+ * - Every returned future settles exactly once: completed, superseded, cancelled or failed.
  *
- * **Coalescing Behavior:**
- * - When `applyOperations` is called and an update is already `isUpdatePending()`,
- *   the new operation list is stored as pending.
- * - If another `applyOperations` call occurs while a *previous* one is pending,
- *   the *newest* operation list **overwrites** the previously pending one.
- * - Once the currently running update finishes, if a pending operation exists,
- *   it is launched immediately, continuing the chain. If no pending operation exists,
- *   the update state is reset.
- * - The `std::future<bool>` returned by `applyOperations` resolves only when the
- *   operation *actually executed* (either the initial one or the final coalesced one)
- *   completes.
+ * An aborted pass leaves its target image partially updated; the superseding request
+ * (or the next full-resolution pass) rewrites it.
  */
 class StateImageManager {
 public:
@@ -84,9 +113,11 @@ public:
      * @details
      * Initializes the PipelineContext and WorkerContext.
      *
+     * @param scheduler Pool shared with other engines of the process, or nullptr for a
+     *        private one (see `Workers::WorkerContext`).
      * @throws std::invalid_argument if source_manager is null.
      */
-    explicit StateImageManager();
+    explicit StateImageManager(std::shared_ptr<Workers::EngineScheduler> scheduler = nullptr);
 
     /**
      * @brief Destructor.
@@ -104,12 +135,124 @@ public:
      */
     [[nodiscard]] bool loadImage(std::string_view path);
 
+    /**
+     * @brief Loads the image of `other` as a virtual copy, sharing its decoded source.
+     *
+     * @details
+     * The source decode (`ISourceManager::shareLoadedImage`) and the resident original are
+     * `other`'s, read-only; this manager allocates only its working image, and keeps its own
+     * operations, proxy and result cache. A commit on either side installs new pixels rather
+     * than writing the shared ones. When `other` holds no shareable decode (a tile-backed
+     * image), its file is loaded instead.
+     *
+     * @param other Manager whose image is copied (unchanged).
+     * @return void, or CoreError on failure (SourceNotLoaded if `other` has no image).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> shareSourceOf(const StateImageManager& other);
+
+    /**
+     * @brief Shares the engine scheduler this manager queues on (see `Workers::WorkerContext`).
+     */
+    [[nodiscard]] std::shared_ptr<Workers::EngineScheduler> shareScheduler() const noexcept;
+
+    /**
+     * @brief Decodes files in the background so that loading them later is instant.
+     *
+     * @details
+     * Typically the neighbours of the current photo in a filmstrip. The decoded images go to
+     * the SourceManager's bounded cache; a later call drops the prefetches not started yet.
+     *
+     * @param paths The files to prefetch, most wanted first.
+     */
+    void prefetchImages(std::span<const std::string> paths);
+
+    /**
+     * @brief Compiles the pipeline of an image's operations in the background, ahead of its first pass.
+     *
+     * @details
+     * Called as soon as the sidecar of the image being opened is parsed: the compilation (or the
+     * load from `Pipeline::PipelineObjectCache`) runs while the file decodes, and the first pass
+     * finds the pipeline compiled. Compiled for the settings of the last passes (backend, storage
+     * format, display outputs, camera profile), which the next image usually shares; a later
+     * call supersedes a warm-up not started yet.
+     *
+     * @param operations The operations the image will be rendered with (moved).
+     */
+    void warmUpPipeline(std::vector<Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Reads the catalog metadata of files from their headers, concurrently, without
+     *        decoding them (see `ISourceManager::readMetadataBatch`).
+     */
+    [[nodiscard]] std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>>
+    readImageMetadata(std::span<const std::string> paths, const Common::CancellationToken& token = {}) const;
+
+    /**
+     * @brief Gets the counters of the tile cache backing huge (tile-backed) sources.
+     */
+    [[nodiscard]] SourceTileCacheStats getSourceTileCacheStats() const;
+
+    /**
+     * @brief Writes the fused pipeline of the last pass to a diagnostics folder.
+     * @details See `Pipeline::OperationPipelineExecutor::dumpDiagnostics`.
+     * @return The folder written, or the error.
+     */
+    [[nodiscard]] std::expected<std::filesystem::path, ErrorHandling::CoreError>
+    dumpPipelineDiagnostics(const std::filesystem::path& directory) const;
+
+    /**
+     * @brief Rebuilds the working image once the full-quality source replaced its preview.
+     *
+     * @details
+     * RAW files may first load their embedded preview (see `SourceManager`). When the full
+     * demosaic is installed (`setSourceRefinedCallback`), this cancels the passes on the preview
+     * and prepares the working image from the full-quality source. The caller then resets or
+     * re-applies its operations.
+     *
+     * @param path Path notified by the refined callback.
+     * @return true if adopted, false if nothing to adopt (not a preview, or another image
+     *         was loaded since), or CoreError on failure.
+     */
+    [[nodiscard]] std::expected<bool, ErrorHandling::CoreError> adoptRefinedSource(std::string_view path);
+
+    /**
+     * @brief true while the working image was prepared from a preview awaiting its full-quality decode.
+     */
+    [[nodiscard]] bool isPreviewImage() const;
+
+    /**
+     * @brief Requests the full-quality decode of a preview source (zoom to 100%, export).
+     * @details Does not block: the refined callback reports when `adoptRefinedSource` can adopt it.
+     */
+    void requestFullQualitySource();
+
+    /**
+     * @brief Develops the loaded RAW source again with `settings` and prepares the working image from it.
+     *
+     * @details
+     * The source manager repeats only the development (see `ISourceManager::redevelopRaw`);
+     * the passes on the previous development are cancelled once the new one is ready. The
+     * result cache tells both developments apart. Blocks until the working image is prepared.
+     *
+     * @return void, or the error of the development (`UnsupportedFormat` for non-RAW sources).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+    redevelopRawSource(const ImageConfig::Raw::RawSettings& settings);
+
+    /**
+     * @brief Sets the callback notified (on a loader thread) when the full-quality source is ready.
+     * @param callback The callback, or an empty function to stop notifications.
+     */
+    void setSourceRefinedCallback(ISourceManager::RefinedCallback callback);
+
     /**
      * @brief Commits the current working image (with applied operations) back to the SourceManager.
      *
      * @details
      * This effectively overwrites the original image data with the processed version.
-     * Future resets or reloads will use this new "original" data.
+     * Future resets or reloads will use this new "original" data. The working image is copied
+     * to the host once; the source (`ISourceManager::adoptPixels`) and the resident original
+     * share that copy.
      *
      * @return std::expected with void or error.
      */
@@ -121,6 +264,7 @@ public:
      * @details
      * This method applies an empty list of operations (reset) and waits for completion.
      * It is used by `PhotoEngine::loadImage` to ensure the image is ready immediately.
+     * Being superseded by a newer request is not an error: that request processes the image.
      *
      * @return `std::expected<void, CoreError>` indicating success or failure.
      */
@@ -133,23 +277,189 @@ public:
      * This method is the primary entry point for image processing. It takes ownership
      * of the provided operation descriptors via `std::move` to avoid unnecessary copies.
      *
-     * **Coalescing Workflow:**
+     * **Superseding Workflow:**
      * 1. If `isUpdatePending()` is true, the `ops` are stored as the new pending request
-     *    (overwriting any older pending request) and a new `std::future<bool>` is returned.
-     *    The processing chain continues when the current operation finishes.
+     *    (superseding any older pending request) and the running pass is cancelled.
+     *    The new request is launched as soon as that pass has stopped.
      * 2. If `isUpdatePending()` is false, the `ops` are processed immediately via `launchProcessing`.
      *
      * **Standard Workflow (when no pending update):**
-     * 1. Creates a new working image from the source.
+     * 1. Reuses the working image: the pipeline reads its source buffer and writes its destination buffer.
      * 2. Initializes the Halide strategy from the context, transferring the operation data.
      * 3. Creates a worker and executes the pipeline asynchronously.
      * 4. Updates the internal working image state upon successful completion.
      *
      * @param ops The list of operation descriptors to apply (moved into the method).
-     * @return `std::future<bool>` representing the asynchronous result.
-     *         The future resolves when the operation actually executed completes.
+     * @return Future settling with the outcome of this request (completed, superseded, cancelled or failed).
      */
-    [[nodiscard]] std::future<bool> applyOperations(std::vector<Operations::OperationDescriptor>&& ops);
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperations(std::vector<Operations::OperationDescriptor>&& ops);
+
+    /**
+     * @brief Applies a list of operations, computing only a region of interest.
+     *
+     * @details
+     * Same workflow and superseding behavior as `applyOperations(ops)`, but the pipeline is
+     * realized only over `roi` (typically the rectangle visible in the viewport), so the
+     * cost is proportional to the visible pixels. Pixels outside the region keep their
+     * previous content; issue a full `applyOperations(ops)` once interaction ends.
+     *
+     * @param ops The list of operation descriptors to apply (moved into the method).
+     * @param roi The region to compute, in full-resolution coordinates.
+     * @return Future settling with the outcome of this request.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperations(std::vector<Operations::OperationDescriptor>&& ops,
+                                                                         const Common::RegionOfInterest& roi);
+
+    /**
+     * @brief Prepares the preview proxy image used for interactive editing.
+     *
+     * @details
+     * Builds a reduced-resolution copy of the resident original (e.g. at the display
+     * downsample size) in a dedicated WorkingImageContext. The proxy is never larger
+     * than the source. It is rebuilt automatically after a commit and released when
+     * a new image is loaded.
+     *
+     * @param width Proxy width in pixels.
+     * @param height Proxy height in pixels.
+     * @return `std::expected<void, CoreError>` indicating success or failure.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> prepareProxy(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Applies a list of operations to the preview proxy only.
+     *
+     * @details
+     * Interactive path for slider drags: the fused pipeline runs on the few megapixels
+     * of the proxy instead of the full-resolution image. Until the next full-resolution
+     * pass completes, `getDownsampledDisplayImage` serves the proxy result.
+     * Falls back to a full-resolution pass if no proxy has been prepared.
+     *
+     * @param ops The list of operation descriptors to apply (moved into the method).
+     * @return Future settling with the outcome of this request.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperationsToProxy(std::vector<Operations::OperationDescriptor>&& ops);
+
+    /**
+     * @brief Applies a list of operations progressively: low-resolution preview, then refined tiles.
+     *
+     * @details
+     * Same superseding behavior as `applyOperations(ops)`. The request runs in stages on the
+     * engine scheduler:
+     * 1. If a proxy is prepared, the proxy is processed (interactive lane) and its downsampled
+     *    result is handed to `refinement.m_on_preview`.
+     * 2. The full-resolution image is then recomputed in full-width bands (refinement lane),
+     *    each restricted to the rows backing `refinement.m_tile_rows` display rows. Each band,
+     *    box-downsampled to the display size, is handed to `refinement.m_on_tile`.
+     *
+     * The token is checked between (and inside) the bands: a newer request stops the refinement
+     * and the future settles as `Superseded`. It settles as `Completed` after the last tile.
+     *
+     * @param ops The list of operation descriptors to apply (moved into the method).
+     * @param refinement Display size and sinks (see `ProgressiveRefinement`).
+     * @return Future settling with the outcome of this request.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> applyOperationsProgressive(std::vector<Operations::OperationDescriptor>&& ops,
+                                                                                    ProgressiveRefinement refinement);
+
+    /**
+     * @brief Renders the image under several parameter snapshots of one edit (preset tiles, hover previews).
+     *
+     * @details
+     * Renders from the proxy if one is prepared, from the source otherwise, reduced to
+     * `max_long_edge` (see `Pipeline::VariantRenderer`). Runs on the interactive lane with its own
+     * executor: the working image, the display image and the queued requests are untouched.
+     *
+     * @param ops The edit the variants derive from (moved into the method).
+     * @param variants The parameter sets to render, in order.
+     * @param max_long_edge Longest edge of the rendered variants, in pixels.
+     * @param token Stops the render between variants once cancelled.
+     * @return Future settling with one linear RGBA_F32 image per variant, or the error
+     *         (`SourceNotLoaded` without an image).
+     */
+    [[nodiscard]] std::future<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>>
+    renderVariants(std::vector<Operations::OperationDescriptor>&& ops,
+                   std::vector<Operations::ParameterSnapshot> variants,
+                   Common::ImageDim max_long_edge,
+                   Common::CancellationToken token = {});
+
+    /**
+     * @brief Cancels the running and pending requests, without replacing them.
+     *
+     * @details
+     * The running pass aborts at its next cancellation check. The futures of both requests
+     * settle as `ProcessingOutcome::Cancelled` (unless the running pass completed first).
+     * Does not wait: use the futures, or a call that waits for processing, to synchronize.
+     */
+    void cancelProcessing();
+
+    /**
+     * @brief Publishes the latest values of the single-value adjustments.
+     *
+     * @details
+     * Lock-free and allocation-free: meant to be called on every UI tick. Every request
+     * launched afterwards refreshes the "value" of its descriptors from the snapshot (so a
+     * queued request picks up the ticks that arrived after it was built).
+     * Only one thread may publish.
+     *
+     * @param snapshot The values, by operation slot.
+     */
+    void publishParameters(const Operations::ParameterSnapshot& snapshot) noexcept;
+
+    /**
+     * @brief Starts a gesture on one operation (a control pressed and dragged).
+     *
+     * @details
+     * Until `endInteraction`, requests are interactive: full-resolution ones run on the preview
+     * proxy (if prepared), the chain keeps the operation bound and defers the expensive
+     * operations after it (`OperationPipelineExecutor::setInteractiveOperation`), and their
+     * results stay out of the result cache. Regions of interest and progressive requests are
+     * left as they are. A second call moves the gesture to another operation.
+     *
+     * @param operation_id Id of the descriptor under the gesture.
+     */
+    void beginInteraction(std::uint64_t operation_id);
+
+    /**
+     * @brief Ends the gesture and schedules the full-quality refine of its last edits.
+     *
+     * @details
+     * The refine is a full-resolution request of the operations last submitted during the
+     * gesture, with the latest published values, on the refinement lane; it supersedes as any
+     * request does.
+     *
+     * @return Future of the refine, or an invalid future if no gesture was running or it
+     *         submitted nothing.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> endInteraction();
+
+    /**
+     * @brief true between `beginInteraction` and `endInteraction`.
+     */
+    [[nodiscard]] bool isInteracting() const;
+
+    /**
+     * @brief Callback receiving the timings of each settled request.
+     */
+    using TimingsCallback = std::function<void(const Common::ProcessingTimings&)>;
+
+    /**
+     * @brief Sets the callback notified with the timings of every request as it settles.
+     *
+     * @details
+     * Meant for latency measurements (see the benchmark scenario runner). The callback runs
+     * under the request lock, on the submitting thread or a scheduler thread: it must be
+     * cheap and must not call back into the manager.
+     *
+     * @param callback The callback, or an empty function to stop notifications.
+     */
+    void setProcessingTimingsCallback(TimingsCallback callback);
+
+    /**
+     * @brief Number of requests not settled yet: the running pass and the pending request.
+     *
+     * @return 0 (idle), 1 (one pass running) or 2 (a request waits for the running pass).
+     */
+    [[nodiscard]] std::size_t getQueueDepth() const;
 
     /**
      * @brief Checks if a processing update is currently in progress.
@@ -189,6 +499,15 @@ public:
      */
     [[nodiscard]] Common::ImageChan getSourceChannels() const;
 
+    /**
+     * @brief Gets the EXIF orientation of the source image.
+     *
+     * @details The working image and every result stay in the stored frame; the display
+     *          applies the orientation as a view transform.
+     * @return The orientation, `Normal` if no image is loaded.
+     */
+    [[nodiscard]] Common::ImageOrientation getSourceOrientation() const;
+
     /**
      * @brief
      * Exports the current working image data to CPU memory as an ImageRegion.
@@ -196,6 +515,13 @@ public:
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     getWorkingImageAsRegion() const;
 
+    /**
+     * @brief
+     * Exports a read-only view over the current working image data (no copy on the host side).
+     */
+    [[nodiscard]] std::expected<Common::ImageView, ErrorHandling::CoreError>
+    getWorkingImageView() const;
+
     /**
      * @brief Gets a downsampled version of the working image for display.
      * Uses GPU-accelerated downsampling, much faster than exporting full image.
@@ -207,6 +533,61 @@ public:
     [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
     getDownsampledDisplayImage(Common::ImageDim target_width, Common::ImageDim target_height);
 
+    /**
+     * @brief Requests a fused display image of the given size from subsequent full-image passes.
+     *
+     * @details
+     * The pipeline then encodes the viewport image (sRGB RGBA8) in the same realization as the
+     * adjustments; retrieve it with `takeDisplayImage()` once the pass completed.
+     *
+     * @param width Display width in pixels.
+     * @param height Display height in pixels.
+     */
+    void setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Lets GPU passes hand out their display image as a device buffer (Thread-Safe).
+     *
+     * @details
+     * Set by a display that samples device buffers directly (see `Common::DisplayDeviceBuffer`).
+     * Applies from the next pass.
+     *
+     * @param enabled true to keep display images on the device when possible.
+     */
+    void setDisplayOnDevice(bool enabled);
+
+    /**
+     * @brief Attaches a histogram to the display images of subsequent passes (Thread-Safe).
+     *
+     * @details
+     * Computed by the pipeline with the display image; display images served from the result
+     * cache without one are counted on the host. Applies from the next pass.
+     *
+     * @param enabled true to fill `DisplayImage::m_histogram`.
+     */
+    void setHistogramEnabled(bool enabled);
+
+    /**
+     * @brief Hands over the display image produced by the last completed pass, if any.
+     *
+     * @details
+     * Passes restricted to a region of interest (or served by the AOT kernel) produce none:
+     * use `getDownsampledDisplayImage()` in that case.
+     *
+     * @return The display image, or `std::nullopt`.
+     */
+    [[nodiscard]] std::optional<Common::DisplayImage> takeDisplayImage();
+
+    /**
+     * @brief Histogram of the latest display image, taken or not (Thread-Safe).
+     *
+     * @details
+     * Kept after `takeDisplayImage()` hands the image over, until another image is loaded.
+     *
+     * @return The histogram, or nullptr (histograms disabled, or no pass since the load).
+     */
+    [[nodiscard]] std::shared_ptr<const Common::PreviewHistogram> latestHistogram() const;
+
 private:
 
     // ========================================================================
@@ -214,19 +595,133 @@ private:
     // ========================================================================
 
     /**
-     * @brief Launches async processing pipeline for operations.
-     * @param ops Operations to process.
+     * @brief A single processing request, as submitted.
+     */
+    struct ProcessingRequest {
+        /** @brief Operations to apply. */
+        std::vector<Operations::OperationDescriptor> m_operations;
+        /** @brief Optional region of interest (full-resolution coordinates). */
+        std::optional<Common::RegionOfInterest> m_roi;
+        /** @brief true to process the preview proxy instead of the full-resolution image. */
+        bool m_use_proxy{false};
+        /** @brief Generation number, assigned by `submitRequest`. */
+        std::uint64_t m_generation{0};
+        /** @brief Promise of the caller's future. */
+        std::promise<Common::ProcessingOutcome> m_promise;
+        /** @brief Set for progressive requests (preview, then refined tiles). */
+        std::shared_ptr<const ProgressiveRefinement> m_progressive;
+        /** @brief Submission time, assigned by `submitRequest`. */
+        Common::ProcessingTimings::Clock::time_point m_submitted_at{};
+        /** @brief Operation under the gesture the request was submitted in, assigned by `submitRequest`. */
+        std::optional<std::uint64_t> m_interaction;
+    };
+
+    /**
+     * @brief State of a progressive request, carried from one stage to the next.
      */
-    void launchProcessing(std::vector<Operations::OperationDescriptor> ops);
+    struct ProgressiveRun {
+        /** @brief Display size and sinks. */
+        std::shared_ptr<const ProgressiveRefinement> m_refinement;
+        /** @brief Generation of the request. */
+        std::uint64_t m_generation{0};
+        /** @brief Token of the request. */
+        Common::CancellationToken m_token;
+        /** @brief Promise of the caller's future. */
+        std::promise<Common::ProcessingOutcome> m_promise;
+        /** @brief true until the proxy preview stage has run. */
+        bool m_preview_pending{true};
+        /** @brief First display row not refined yet. */
+        Common::ImageDim m_next_row{0};
+    };
 
     /**
-     * @brief Handles processing completion and triggers pending ops if exists.
+     * @brief Launches async processing pipeline for a request.
+     * @param request The request to process.
+     */
+    void launchProcessing(ProcessingRequest request);
+
+    /**
+     * @brief Runs the next stage of a progressive request (preview or next band), or settles it.
+     * @details The Halide manager is already initialized with the request's operations.
+     * @param run The request state (moved from stage to stage).
+     */
+    void launchProgressiveStage(ProgressiveRun run);
+
+    /**
+     * @brief Shared implementation of the `applyOperations` entry points (numbering, superseding).
+     * @param request The request to process.
+     * @return Future settling with the outcome of the request.
+     */
+    [[nodiscard]] std::future<Common::ProcessingOutcome> submitRequest(ProcessingRequest&& request);
+
+    /**
+     * @brief Result cache key of a request (operations already refreshed), or `std::nullopt`
+     *        if its result is not cached (progressive, region of interest, no display size,
+     *        device display images, unknown source).
+     */
+    [[nodiscard]] std::optional<ResultCache::Key> resultKeyFor(const ProcessingRequest& request) const;
+
+    /**
+     * @brief Publishes the cached display image of a state instead of running a pass.
+     * @return false on a miss, or for a full-resolution request whose state the working image
+     *         does not hold.
+     */
+    [[nodiscard]] bool serveFromResultCache(const ResultCache::Key& key, bool use_proxy);
+
+    /**
+     * @brief Caches the display image of a completed pass (and, for full-resolution passes over
+     *        an unmodified source file, queues its write to the disk tier).
+     */
+    void storeResult(const ResultCache::Key& key, ResultCache::Image image, bool use_proxy);
+
+    /**
+     * @brief Builds the proxy from the resident original. Caller must hold `m_state_mutex`.
+     * @param width Proxy width in pixels.
+     * @param height Proxy height in pixels.
+     * @return `std::expected<void, CoreError>` indicating success or failure.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> buildProxy(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Prepares the working image from the whole loaded source and resets the state metadata.
+     * @param path Path of the loaded source.
+     * @return false if the working image could not be prepared.
+     */
+    [[nodiscard]] bool prepareWorkingImageFromSource(std::string_view path);
+
+    /**
+     * @brief Settles a finished request and launches the pending one, if any.
+     * @param generation Generation of the finished request.
+     * @param promise Promise of the finished request.
      * @param success Whether processing succeeded.
+     * @param aborted true if the pass stopped because its token was cancelled.
+     * @param progressive Refinement of a progressive request (notified of the outcome), or nullptr.
      */
-    void onProcessingComplete(bool success);
+    void onProcessingComplete(std::uint64_t generation, std::promise<Common::ProcessingOutcome> promise,
+                              bool success, bool aborted, const ProgressiveRefinement* progressive = nullptr);
 
     /**
-     * @brief Blocks until all pending processing completes.
+     * @brief Settles a request: notifies `progressive->m_on_finished` (if any), then fulfils the promise.
+     * @details Called under `m_pending_mutex`.
+     */
+    static void settle(std::promise<Common::ProcessingOutcome>& promise,
+                       const ProgressiveRefinement* progressive,
+                       Common::ProcessingOutcome outcome);
+
+    /**
+     * @brief Counts a settling request in the core metrics, and reports its timings to the
+     *        timings callback, if any.
+     * @details Called under `m_pending_mutex`.
+     * @param started Launch time of the request's pass, or the epoch if it never ran
+     *                (otherwise the request is the running pass, and reports its backend).
+     */
+    void reportTimings(std::uint64_t generation, Common::ProcessingOutcome outcome, bool use_proxy,
+                       Common::ProcessingTimings::Clock::time_point submitted,
+                       Common::ProcessingTimings::Clock::time_point started) const;
+
+    /**
+     * @brief Blocks until all pending processing completes (condition variable, no polling).
+     * @details Waits that block are timed into `capturemoment_idle_wait_ms` and traced.
      */
     void waitForPendingProcessing();
 
@@ -256,19 +751,99 @@ private:
      */
     std::unique_ptr<ImageProcessing::WorkingImageContext> m_working_image_context;
 
+    /**
+     * @brief Reduced-resolution preview image used for interactive editing.
+     * @details Empty until `prepareProxy()` is called.
+     */
+    std::unique_ptr<ImageProcessing::WorkingImageContext> m_proxy_image_context;
+
+    /**
+     * @brief Renderer of `renderVariants`, created on first use.
+     * @details Shared with its tasks: a render may outlive the manager.
+     */
+    std::shared_ptr<Pipeline::VariantRenderer> m_variant_renderer;
+
+    /** @brief Width of the prepared proxy (0 if none). */
+    Common::ImageDim m_proxy_width{0};
+
+    /** @brief Height of the prepared proxy (0 if none). */
+    Common::ImageDim m_proxy_height{0};
+
+    /**
+     * @brief true when the most recent completed pass ran on the proxy.
+     * @details Selects the image served by `getDownsampledDisplayImage`.
+     */
+    std::atomic<bool> m_display_from_proxy{false};
+
+    /**
+     * @brief Mutex protecting `m_display_size`, `m_display_on_device`, `m_histogram_enabled`, `m_latest_display_image` and `m_latest_histogram`.
+     */
+    mutable std::mutex m_display_mutex;
+
+    /**
+     * @brief Requested fused display size, forwarded to the Halide manager on each pass.
+     */
+    std::optional<std::pair<Common::ImageDim, Common::ImageDim>> m_display_size;
+
+    /**
+     * @brief Whether display images may stay on the device, forwarded to the Halide manager on each pass.
+     */
+    bool m_display_on_device{false};
+
+    /**
+     * @brief Whether display images carry a histogram, forwarded to the Halide manager on each pass.
+     */
+    bool m_histogram_enabled{false};
+
+    /**
+     * @brief Display image produced by the last completed pass, until taken.
+     */
+    std::optional<Common::DisplayImage> m_latest_display_image;
+
+    /**
+     * @brief Histogram of the last display image taken (see `latestHistogram()`).
+     */
+    std::shared_ptr<const Common::PreviewHistogram> m_latest_histogram;
+
     /**
      * @brief File path of the original source image.
      */
     std::string m_original_image_path;
 
     /**
-     * @brief Mutex protecting the atomic flag `m_is_updating`.
+     * @brief true if the working image was prepared from a preview source (see `adoptRefinedSource`).
+     */
+    bool m_working_from_preview{false};
+
+    /**
+     * @brief Identity of the source for the result cache (`ResultCache::sourceIdentity`), guarded
+     *        by `m_state_mutex`. Changed by each commit, which also clears `m_source_on_disk`.
+     */
+    std::optional<std::uint64_t> m_source_identity;
+
+    /**
+     * @brief Camera profile of a camera-native source (`Operations::CameraProfile`), guarded by
+     *        `m_state_mutex`. Handed to every request; cleared by a commit.
+     */
+    std::optional<std::string> m_source_profile;
+    bool m_source_on_disk{false};
+    std::uint64_t m_commit_count{0};
+
+    /**
+     * @brief State held by the working image after the last full-resolution pass, guarded by `m_state_mutex`.
+     */
+    std::optional<ResultCache::Key> m_working_result;
+
+    /**
+     * @brief Rendered states (shared with the disk writes queued on the scheduler).
      */
-    mutable std::mutex m_flag_mutex;
+    std::shared_ptr<ResultCache> m_result_cache;
 
     /**
      * @brief Flag preventing multiple concurrent update requests.
-     * @details Uses atomic<bool> for lock-free reads in `isUpdatePending()`.
+     * @details
+     * Written under `m_pending_mutex` (together with the coalescing decision);
+     * atomic for lock-free reads in `isUpdatePending()`.
      */
     std::atomic<bool> m_is_updating{false};
 
@@ -279,23 +854,84 @@ private:
 
 
     /**
-     * @brief Mutex protecting access to `m_pending_ops` and `m_pending_promise`.
+     * @brief Mutex protecting `m_pending_request`, `m_cancelled_generation`, the generation
+     *        increments and the transitions of `m_is_updating`.
      */
     mutable std::mutex m_pending_mutex;
 
     /**
-     * @brief Stores the most recent operation list requested while an update is in progress.
-     * @details If `has_value()`, this operation will be processed next.
+     * @brief Stores the most recent request submitted while an update is in progress.
+     * @details If `has_value()`, this request will be processed next.
+     */
+    std::optional<ProcessingRequest> m_pending_request;
+
+    /**
+     * @brief Operation under the running gesture, if any (see `beginInteraction`).
+     * @details Protected by `m_pending_mutex`.
+     */
+    std::optional<std::uint64_t> m_interaction_operation;
+
+    /**
+     * @brief Operations last submitted during the gesture: refined when it ends.
+     * @details Protected by `m_pending_mutex`.
+     */
+    std::optional<std::vector<Operations::OperationDescriptor>> m_interaction_operations;
+
+    /**
+     * @brief Latest generation issued (by a request or a cancellation).
+     * @details Shared with the tokens of the requests; bumped under `m_pending_mutex`.
+     */
+    std::shared_ptr<Common::CancellationToken::Counter> m_generation;
+
+    /**
+     * @brief Generation issued by the last `cancelProcessing()` call.
+     * @details Requests up to it were cancelled rather than superseded.
+     */
+    std::uint64_t m_cancelled_generation{0};
+
+    /**
+     * @brief Submission and launch times of the running pass (one pass runs at a time).
+     * @details Written by `launchProcessing`, read when the pass settles.
+     */
+    Common::ProcessingTimings::Clock::time_point m_running_submitted_at{};
+    Common::ProcessingTimings::Clock::time_point m_running_started_at{};
+    bool m_running_use_proxy{false};
+    Common::MemoryType m_running_backend{Common::MemoryType::CPU_RAM};
+
+    /**
+     * @brief Timings callback (see `setProcessingTimingsCallback`), guarded by `m_pending_mutex`.
+     */
+    TimingsCallback m_timings_callback;
+
+    /**
+     * @brief Signalled (under `m_pending_mutex`) when the last request settles and the manager becomes idle.
+     */
+    std::condition_variable m_idle_cv;
+
+    /**
+     * @brief Latest warm-up issued (see `warmUpPipeline`); earlier ones still queued are skipped.
+     */
+    std::atomic<std::uint64_t> m_warm_up_generation{0};
+
+    /**
+     * @brief Protects `m_warm_ups_in_flight`.
+     */
+    std::mutex m_warm_up_mutex;
+
+    /**
+     * @brief Warm-ups queued or running (they reference this manager).
+     */
+    std::size_t m_warm_ups_in_flight{0};
+
+    /**
+     * @brief Signalled (under `m_warm_up_mutex`) when a warm-up ends.
      */
-    std::optional<std::vector<Operations::OperationDescriptor>> m_pending_ops;
+    std::condition_variable m_warm_up_cv;
 
     /**
-     * @brief Promise associated with the currently executing or last completed operation chain.
-     * @details The future returned by the initial `applyOperations` call in a chain
-     *          is resolved by this promise when the chain (potentially including a coalesced
-     *          operation) finishes.
+     * @brief Latest parameter values published by the UI, read when a request launches.
      */
-    std::promise<bool> m_pending_promise;
+    Common::Seqlock<Operations::ParameterSnapshot> m_parameters;
 };
 
 } // namespace Managers
@@ -0,0 +1,120 @@
+/**
+ * @file auto_tone.h
+ * @brief Declaration of AutoTone (suggested Exposure, Contrast, Whites and Blacks from a histogram).
+ *
+ * @details
+ * The suggestion is read off a `Common::PreviewHistogram`, which the pipeline already reduces
+ * from the display output (see `Pipeline::HistogramStage`) and the thumbnail service counts on
+ * its thumbnail-size decode: a few hundred bins are scanned, no pixel is read again.
+ *
+ * From the luma histogram, decoded back to linear values:
+ * - the contrast grows the tonal spread (5th to 95th percentile) of a flat image, gently;
+ * - the exposure brings the median to middle gray, once the contrast is applied, without
+ *   pushing the 99.5th percentile past white;
+ * - the whites bring the 99.5th percentile to `k_target_white`, the blacks the 0.5th to
+ *   `k_target_black`, through the masks of those adjustments. Clipped ends are left alone.
+ *
+ * A histogram measures the image as rendered: the suggestion refines the current values
+ * (`suggest(histogram, current)`), so an image that is already balanced keeps them.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/preview_histogram.h"
+#include "operations/operation_descriptor.h"
+
+#include <span>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class AutoTone
+ * @brief Derives and applies auto-tone values.
+ */
+class AutoTone {
+public:
+    /**
+     * @struct Settings
+     * @brief Values of the four adjustments auto-tone sets (the defaults change nothing).
+     */
+    struct Settings {
+        float m_exposure{0.0f};     ///< Stops
+        float m_contrast{1.0f};     ///< Factor around mid-gray
+        float m_whites{0.0f};
+        float m_blacks{0.0f};
+
+        [[nodiscard]] bool operator==(const Settings&) const = default;
+    };
+
+    /**
+     * @brief Linear value the median is brought to (middle gray).
+     */
+    static constexpr float k_target_middle = 0.18f;
+
+    /**
+     * @brief Linear value the 99.5th percentile is brought to.
+     */
+    static constexpr float k_target_white = 0.95f;
+
+    /**
+     * @brief Linear value the 0.5th percentile is brought to (sRGB code 7).
+     */
+    static constexpr float k_target_black = 0.002f;
+
+    /**
+     * @brief Tonal spread, in encoded values, a balanced image spans from its 5th to its 95th percentile.
+     */
+    static constexpr float k_target_spread = 0.75f;
+
+    /**
+     * @brief Largest exposure change of one suggestion, in stops.
+     */
+    static constexpr float k_max_exposure_shift = 2.0f;
+
+    /**
+     * @brief Largest contrast factor of one suggestion (a wide image keeps its contrast).
+     */
+    static constexpr float k_max_contrast = 1.25f;
+
+    /**
+     * @brief Largest Whites and Blacks change of one suggestion.
+     */
+    static constexpr float k_max_end_shift = 0.5f;
+
+    /**
+     * @brief Suggests the values that balance an image.
+     *
+     * @param histogram Histogram of the image rendered with `current`.
+     * @param current Values the image was rendered with (see `read`).
+     * @return The suggested values, within the ranges of the operations; `current` if the
+     *         histogram counts no pixel.
+     */
+    [[nodiscard]] static Settings suggest(const Common::PreviewHistogram& histogram, const Settings& current) noexcept;
+
+    /**
+     * @brief Suggests the values that balance an image rendered without tone adjustments
+     *        (e.g. a thumbnail at import).
+     */
+    [[nodiscard]] static Settings suggest(const Common::PreviewHistogram& histogram) noexcept;
+
+    /**
+     * @brief Reads the current values (an absent or disabled adjustment reads as its default).
+     */
+    [[nodiscard]] static Settings read(std::span<const OperationDescriptor> operations) noexcept;
+
+    /**
+     * @brief Writes the values into the operations: each adjustment is updated and enabled, or
+     *        appended if absent.
+     */
+    static void applyTo(std::vector<OperationDescriptor>& operations, const Settings& settings);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
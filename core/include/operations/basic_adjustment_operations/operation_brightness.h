@@ -93,8 +93,9 @@ public:
      *          in the fused pipeline to ensure coordinate consistency.
      * @param c The Halide variable for the channel dimension, shared across all operations
      *          in the fused pipeline to ensure coordinate consistency.
-     * @param params The configuration/settings for this operation, containing the
-     *               brightness adjustment value and other relevant parameters.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_BRIGHTNESS_VALUE), updated without recompilation.
+     * @param luminance Shared luminance of the chain (unused: per-channel adjustment).
      * @return A new Halide::Func representing the output of this operation,
      *         which can be used as input for the next operation in the fused pipeline.
      *         The returned function encapsulates the logic to adjust the brightness
@@ -105,10 +106,19 @@ public:
         const Halide::Var& x,
         const Halide::Var& y,
         const Halide::Var& c,
-        const Halide::Param<float>& param 
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
         ) const override;
 
+    /**
+     * @brief True at the default value (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override { return hasNeutralValue(descriptor, DEFAULT_BRIGHTNESS_VALUE); }
 
+    /**
+     * @brief True while the value is at its default (specialized branch without the operation).
+     */
+    [[nodiscard]] Halide::Expr identityCondition(FusionParameterBlock& params) const override { return neutralValueCondition(params, DEFAULT_BRIGHTNESS_VALUE); }
 
     /**
      * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
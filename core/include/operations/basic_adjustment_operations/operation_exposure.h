@@ -0,0 +1,134 @@
+/**
+ * @file operation_exposure.h
+ * @brief Concrete implementation of Exposure adjustment
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationExposure
+ * @brief Adjusts the exposure of an image region.
+ *
+ * This operation simulates a change of the camera exposure by multiplying each pixel by a power of two.
+ * Each stop doubles (positive values) or halves (negative values) the light.
+ *
+ * **Algorithm**:
+ * For each pixel `p` and channel `c` (excluding alpha):
+ * \f$ p_c = p_c \cdot 2^{\text{value}} \f$
+ *
+ * **Parameters**:
+ * - `value` (float): The exposure adjustment, in stops (EV).
+ * - Range: Defined by OperationRanges::getExposureMinValue() and OperationRanges::getExposureMaxValue()
+ * - Default: OperationRanges::getExposureDefaultValue() (typically 0.0f, No change)
+ * - > 0: Increase exposure
+ * - < 0: Decrease exposure
+ */
+class OperationExposure : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Exposure; }
+    [[nodiscard]] const char* name() const override { return "Exposure"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed exposure value.
+     * Defined by OperationRanges::getExposureMinValue().
+     */
+    static constexpr float MIN_EXPOSURE_VALUE = OperationRanges::getExposureMinValue();
+
+    /**
+     * @brief Maximum allowed exposure value.
+     * Defined by OperationRanges::getExposureMaxValue().
+     */
+    static constexpr float MAX_EXPOSURE_VALUE = OperationRanges::getExposureMaxValue();
+
+    /**
+     * @brief Default exposure value.
+     * Defined by OperationRanges::getExposureDefaultValue().
+     */
+    static constexpr float DEFAULT_EXPOSURE_VALUE = OperationRanges::getExposureDefaultValue();
+
+    /**
+     * @brief Applies the exposure adjustment.
+     *
+     * This method provides sequential execution capability for the exposure adjustment operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Reads the "value" parameter from the descriptor and applies the exposure
+     * gain to every color channel (RGB) of every pixel in the working image.
+     * The alpha channel is left unchanged.
+     * Performs a validation check to ensure the value is within the defined range [MIN_EXPOSURE_VALUE, MAX_EXPOSURE_VALUE].
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Must contain a "value" (float) parameter.
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * This method is used by the PipelineBuilder to combine multiple operations
+     * into a single computational pass. It takes an input function and returns
+     * a new function representing the current operation applied to the input.
+     * This method implements the fusion logic specific to the Exposure adjustment,
+     * applying the adjustment without intermediate memory allocations, directly within the fused pipeline.
+     * All operations in the fused pipeline must use the same coordinate variables
+     * (x, y, c) to ensure consistency and proper chaining of operations.
+     * @param input_func The Halide function representing the input to this operation.
+     *                   This function contains the image data from the previous
+     *                   operation in the pipeline or the original image if this is the first operation.
+     * @param x The Halide variable for the x dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param y The Halide variable for the y dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param c The Halide variable for the channel dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_EXPOSURE_VALUE), updated without recompilation.
+     * @param luminance Shared luminance of the chain (unused: per-channel adjustment).
+     * @return A new Halide::Func representing the output of this operation,
+     *         which can be used as input for the next operation in the fused pipeline.
+     *         The returned function encapsulates the logic to adjust the exposure
+     *         operating directly on the pixel data stream using the shared coordinate variables.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief True at the default value (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override { return hasNeutralValue(descriptor, DEFAULT_EXPOSURE_VALUE); }
+
+    /**
+     * @brief True while the value is at its default (specialized branch without the operation).
+     */
+    [[nodiscard]] Halide::Expr identityCondition(FusionParameterBlock& params) const override { return neutralValueCondition(params, DEFAULT_EXPOSURE_VALUE); }
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -32,6 +32,10 @@ namespace Operations {
  * - `value` (float): The highlights adjustment factor.
  * - Range: Defined by OperationRanges::getHighlightsMinValue() and OperationRanges::getHighlightsMaxValue()
  * - Default: OperationRanges::getHighlightsDefaultValue() (typically 0.0f, No change)
+ * - `mask_mode` (int, optional): `ToneMaskMode`. `PerPixel` (default) masks each pixel by its own
+ *   luminance; `EdgeAware` masks it by the luminance smoothed with a bilateral grid, so textured
+ *   regions move as a whole and no halo is drawn along strong edges. Switching it rebuilds the
+ *   fused pipeline; the sequential `execute` always uses the per-pixel mask.
  * - > 0: Darken highlights (make them less bright)
  * - < 0: Brighten highlights (make them more bright)
  */
@@ -98,8 +102,9 @@ public:
      *          in the fused pipeline to ensure coordinate consistency.
      * @param c The Halide variable for the channel dimension, shared across all operations
      *          in the fused pipeline to ensure coordinate consistency.
-     * @param params The configuration/settings for this operation, containing the
-     *               highlight level adjustment value and other relevant parameters.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_HIGHLIGHTS_VALUE), updated without recompilation.
+     * @param luminance Shared luminance of the chain: read for the input, tracked for the output.
      * @return A new Halide::Func representing the output of this operation,
      *         which can be used as input for the next operation in the fused pipeline.
      *         The returned function encapsulates the logic to adjust the highlight levels
@@ -111,10 +116,29 @@ public:
         const Halide::Var& x,
         const Halide::Var& y,
         const Halide::Var& c,
-        const Halide::Param<float>& param
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
         ) const override;
 
+    /**
+     * @brief The mask mode of the descriptor (`ToneMaskMode`): each mode is a different graph.
+     */
+    [[nodiscard]] std::uint32_t fusionVariant(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief The edge-aware mask reads the grid cells around the pixel.
+     */
+    [[nodiscard]] bool readsNeighborhood(std::uint32_t variant) const override;
 
+    /**
+     * @brief True at the default value (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override { return hasNeutralValue(descriptor, DEFAULT_HIGHLIGHTS_VALUE); }
+
+    /**
+     * @brief True while the value is at its default; undefined for the blurred mask modes (root stages).
+     */
+    [[nodiscard]] Halide::Expr identityCondition(FusionParameterBlock& params) const override;
 
     /**
      * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
@@ -0,0 +1,134 @@
+/**
+ * @file operation_saturation.h
+ * @brief Concrete implementation of Saturation adjustment
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationSaturation
+ * @brief Adjusts the saturation of an image region.
+ *
+ * This operation scales the distance of each color channel to the pixel luminance.
+ * The luminance itself is kept (until a channel clips), only the colorfulness changes.
+ *
+ * **Algorithm**:
+ * For each pixel `p` of luminance `L` and channel `c` (excluding alpha):
+ * \f$ p_c = L + (p_c - L) \cdot \text{value} \f$
+ *
+ * **Parameters**:
+ * - `value` (float): The saturation factor.
+ * - Range: Defined by OperationRanges::getSaturationMinValue() and OperationRanges::getSaturationMaxValue()
+ * - Default: OperationRanges::getSaturationDefaultValue() (typically 1.0f, No change)
+ * - > 1: Increase saturation
+ * - < 1: Decrease saturation (0: grayscale)
+ */
+class OperationSaturation : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Saturation; }
+    [[nodiscard]] const char* name() const override { return "Saturation"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed saturation value.
+     * Defined by OperationRanges::getSaturationMinValue().
+     */
+    static constexpr float MIN_SATURATION_VALUE = OperationRanges::getSaturationMinValue();
+
+    /**
+     * @brief Maximum allowed saturation value.
+     * Defined by OperationRanges::getSaturationMaxValue().
+     */
+    static constexpr float MAX_SATURATION_VALUE = OperationRanges::getSaturationMaxValue();
+
+    /**
+     * @brief Default saturation value.
+     * Defined by OperationRanges::getSaturationDefaultValue().
+     */
+    static constexpr float DEFAULT_SATURATION_VALUE = OperationRanges::getSaturationDefaultValue();
+
+    /**
+     * @brief Applies the saturation adjustment.
+     *
+     * This method provides sequential execution capability for the saturation adjustment operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Reads the "value" parameter from the descriptor and applies the saturation
+     * formula to every color channel (RGB) of every pixel in the working image.
+     * The alpha channel is left unchanged.
+     * Performs a validation check to ensure the value is within the defined range [MIN_SATURATION_VALUE, MAX_SATURATION_VALUE].
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Must contain a "value" (float) parameter.
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * This method is used by the PipelineBuilder to combine multiple operations
+     * into a single computational pass. It takes an input function and returns
+     * a new function representing the current operation applied to the input.
+     * This method implements the fusion logic specific to the Saturation adjustment,
+     * applying the adjustment without intermediate memory allocations, directly within the fused pipeline.
+     * All operations in the fused pipeline must use the same coordinate variables
+     * (x, y, c) to ensure consistency and proper chaining of operations.
+     * @param input_func The Halide function representing the input to this operation.
+     *                   This function contains the image data from the previous
+     *                   operation in the pipeline or the original image if this is the first operation.
+     * @param x The Halide variable for the x dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param y The Halide variable for the y dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param c The Halide variable for the channel dimension, shared across all operations
+     *          in the fused pipeline to ensure coordinate consistency.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_SATURATION_VALUE), updated without recompilation.
+     * @param luminance Shared luminance of the chain (the luminance the channels are scaled around).
+     * @return A new Halide::Func representing the output of this operation,
+     *         which can be used as input for the next operation in the fused pipeline.
+     *         The returned function encapsulates the logic to adjust the saturation
+     *         operating directly on the pixel data stream using the shared coordinate variables.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief True at the default value (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override { return hasNeutralValue(descriptor, DEFAULT_SATURATION_VALUE); }
+
+    /**
+     * @brief True while the value is at its default (specialized branch without the operation).
+     */
+    [[nodiscard]] Halide::Expr identityCondition(FusionParameterBlock& params) const override { return neutralValueCondition(params, DEFAULT_SATURATION_VALUE); }
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
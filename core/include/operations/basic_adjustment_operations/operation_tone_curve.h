@@ -0,0 +1,107 @@
+/**
+ * @file operation_tone_curve.h
+ * @brief Concrete implementation of the Tone Curve adjustment
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationToneCurve
+ * @brief Remaps the R, G and B channels of an image region through a tone curve.
+ *
+ * The curve (see `ToneCurve`) is a parametric curve of four region offsets followed by a
+ * point curve. It is baked on the CPU into a `ToneCurve::k_table_size` entry table, which the
+ * graph samples through a lookup table input (`FusionParameterBlock::lut`). Editing the curve
+ * re-bakes and rebinds the table: the compiled pipeline is reused, on the CPU and the GPU alike.
+ *
+ * **Algorithm**:
+ * For each pixel `p` and channel `c` (excluding alpha):
+ * \f$ p_c = \text{table}(p_c) \f$ (linear interpolation between entries, input clamped to [0, 1])
+ *
+ * **Parameters**:
+ * - `curve_points` (string): Control points "x,y;x,y;..." in [0, 1]. Unset: no point curve.
+ * - `curve_shadows`, `curve_darks`, `curve_lights`, `curve_highlights` (float): Region offsets.
+ * - Range: Defined by OperationRanges::getToneCurveRegionMinValue() and OperationRanges::getToneCurveRegionMaxValue()
+ * - Default: OperationRanges::getToneCurveRegionDefaultValue() (typically 0.0f, No change)
+ */
+class OperationToneCurve : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::ToneCurve; }
+    [[nodiscard]] const char* name() const override { return "ToneCurve"; }
+
+    /**
+     * @brief Key of the curve table in the parameter block.
+     */
+    static constexpr std::string_view k_table_key = "curve_table";
+
+    /**
+     * @brief Applies the tone curve.
+     *
+     * This method provides sequential execution capability for the tone curve operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Bakes the descriptor's curve and samples it for every color channel (RGB) of every pixel
+     * in the working image. The alpha channel is left unchanged. An identity curve is skipped.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params The curve parameters (all optional).
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation.
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the curve table
+     *               (an identity table until `updateFusionParameters`).
+     * @param luminance Shared luminance of the chain. Not read; the output is not tracked
+     *                  (a per-channel curve does not map the luminance through itself).
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief Re-bakes the curve table from the descriptor and binds it (no recompilation).
+     */
+    void updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const override;
+
+    /**
+     * @brief True for the identity curve (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
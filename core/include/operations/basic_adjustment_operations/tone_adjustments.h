@@ -0,0 +1,555 @@
+/**
+ * @file tone_adjustments.h
+ * @brief Halide expressions of the basic adjustments (Exposure, Brightness, Contrast, Highlights, Shadows, Whites, Blacks, Saturation).
+ *
+ * @details
+ * These helpers only depend on Halide and `OperationRanges`, so the same graph is used by:
+ * - the operations themselves (standalone `execute` and `appendToFusedPipeline`, JIT),
+ * - the ahead-of-time tone generator (`core/generators`), which is built without the core library.
+ *
+ * The adjustment value is taken as a `Halide::Expr` so that both a `Halide::Param<float>` (JIT)
+ * and a generator scalar input (AOT) can be passed.
+ *
+ * The masked adjustments also come in a shared-luminance form, returning a `MaskedToneResult`:
+ * fused pipelines pass the luminance tracked by `FusedLuminance` instead of recomputing it.
+ * `toneLuminance` is the single definition of the luminance used by all of them.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_ranges.h"
+
+#include "Halide.h"
+
+#include <string>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief Computes the Rec. 601 luminance of the RGB channels.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Expr toneLuminance(const InputType& input, const Halide::Var& x, const Halide::Var& y)
+{
+    return 0.299f * input(x, y, 0) +
+           0.587f * input(x, y, 1) +
+           0.114f * input(x, y, 2);
+}
+
+/**
+ * @brief Additive brightness adjustment, clamped to [0, 1]. Alpha unchanged.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyBrightnessAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func brightness_func("brightness_op");
+
+    // Safety: Clamp the input parameter to the operation's defined valid range.
+    // This ensures robustness even if the cache passes an unexpected value.
+    Halide::Expr safe_brightness = Halide::clamp(
+        value,
+        OperationRanges::getBrightnessMinValue(),
+        OperationRanges::getBrightnessMaxValue()
+    );
+
+    brightness_func(x, y, c) = Halide::select(
+        c < 3, // R, G, B
+        Halide::clamp(input(x, y, c) + safe_brightness, 0.0f, 1.0f),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    return brightness_func;
+}
+
+/**
+ * @brief Exposure gain of `value` stops (`2^value`), clamped to [0, 1]. Alpha unchanged.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyExposureAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func exposure_func("exposure_op");
+
+    Halide::Expr safe_exposure = Halide::clamp(
+        value,
+        OperationRanges::getExposureMinValue(),
+        OperationRanges::getExposureMaxValue()
+    );
+
+    // The gain is uniform: hoisted out of the pixel loops by Halide
+    Halide::Expr gain = Halide::exp2(safe_exposure);
+
+    exposure_func(x, y, c) = Halide::select(
+        c < 3,
+        Halide::clamp(input(x, y, c) * gain, 0.0f, 1.0f),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    return exposure_func;
+}
+
+/**
+ * @brief Multiplicative contrast centered at mid-gray, clamped to [0, 1]. Alpha unchanged.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyContrastAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func contrast_func("contrast_op");
+
+    Halide::Expr safe_contrast = Halide::clamp(
+        value,
+        OperationRanges::getContrastMinValue(),
+        OperationRanges::getContrastMaxValue()
+    );
+
+    // Formula: 0.5 + (Input - 0.5) * ContrastFactor
+    contrast_func(x, y, c) = Halide::select(
+        c < 3,
+        Halide::clamp(0.5f + (input(x, y, c) - 0.5f) * safe_contrast, 0.0f, 1.0f),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    return contrast_func;
+}
+
+/**
+ * @struct MaskedToneResult
+ * @brief Output of a luminance-masked adjustment evaluated from a shared luminance.
+ */
+struct MaskedToneResult {
+    /**
+     * @brief The adjusted RGBA function.
+     */
+    Halide::Func m_output;
+
+    /**
+     * @brief Luminance of `m_output`: the input luminance plus the applied offset
+     *        (the same offset is added to R, G and B, and the luminance weights sum to 1).
+     */
+    Halide::Func m_luminance;
+};
+
+/**
+ * @brief Mask ramping from 0 at `low_threshold` to 1 at `high_threshold` (bright tones).
+ */
+[[nodiscard]] inline Halide::Expr brightToneMask(const Halide::Expr& luminance, float low_threshold, float high_threshold)
+{
+    return Halide::select(
+        luminance <= low_threshold,
+        0.0f,
+        luminance >= high_threshold,
+        1.0f,
+        (luminance - low_threshold) / (high_threshold - low_threshold)
+        );
+}
+
+/**
+ * @brief Mask ramping from 1 at `low_threshold` to 0 at `high_threshold` (dark tones).
+ */
+[[nodiscard]] inline Halide::Expr darkToneMask(const Halide::Expr& luminance, float low_threshold, float high_threshold)
+{
+    return Halide::select(
+        luminance >= high_threshold,
+        0.0f,
+        luminance <= low_threshold,
+        1.0f,
+        (high_threshold - luminance) / (high_threshold - low_threshold)
+        );
+}
+
+/**
+ * @brief Adds `safe_value` to R, G and B, weighted by `bright ? brightToneMask : darkToneMask` of `mask_luminance`.
+ * @details `luminance` must be the luminance of `input` (see `FusedLuminance`). `mask_luminance` is
+ *          `luminance` itself (per-pixel mask) or a smoothing of it (edge-aware mask, see `BilateralGrid`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyMaskedToneAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Func& mask_luminance,
+    const Halide::Expr& safe_value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    bool bright,
+    float low_threshold,
+    float high_threshold,
+    const char* name)
+{
+    MaskedToneResult result{Halide::Func(std::string(name) + "_op"), Halide::Func(std::string("luminance_after_") + name)};
+    Halide::Func mask_func(std::string("mask_") + name);
+
+    mask_func(x, y) = bright ? brightToneMask(mask_luminance(x, y), low_threshold, high_threshold)
+                             : darkToneMask(mask_luminance(x, y), low_threshold, high_threshold);
+
+    result.m_output(x, y, c) = Halide::select(
+        c < 3,
+        input(x, y, c) + safe_value * mask_func(x, y),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    result.m_luminance(x, y) = luminance(x, y) + safe_value * mask_func(x, y);
+
+    return result;
+}
+
+/**
+ * @brief Per-pixel mask variant: the mask reads `luminance` itself.
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyMaskedToneAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& safe_value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    bool bright,
+    float low_threshold,
+    float high_threshold,
+    const char* name)
+{
+    return applyMaskedToneAdjustment(input, luminance, luminance, safe_value, x, y, c,
+                                     bright, low_threshold, high_threshold, name);
+}
+
+/**
+ * @brief Adds `value`, weighted by a mask that ramps from 0 at `low_threshold` to 1 at `high_threshold`.
+ * @details Shared by Highlights and Whites (bright tones). Computes its own luminance.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyBrightToneAdjustment(
+    const InputType& input,
+    const Halide::Expr& safe_value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold,
+    float high_threshold,
+    const char* name)
+{
+    Halide::Func luminance_func(std::string("luminance_") + name);
+    luminance_func(x, y) = toneLuminance(input, x, y);
+
+    return applyMaskedToneAdjustment(input, luminance_func, safe_value, x, y, c,
+                                     true, low_threshold, high_threshold, name).m_output;
+}
+
+/**
+ * @brief Adds `value`, weighted by a mask that ramps from 1 at `low_threshold` to 0 at `high_threshold`.
+ * @details Shared by Shadows and Blacks (dark tones). Computes its own luminance.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyDarkToneAdjustment(
+    const InputType& input,
+    const Halide::Expr& safe_value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold,
+    float high_threshold,
+    const char* name)
+{
+    Halide::Func luminance_func(std::string("luminance_") + name);
+    luminance_func(x, y) = toneLuminance(input, x, y);
+
+    return applyMaskedToneAdjustment(input, luminance_func, safe_value, x, y, c,
+                                     false, low_threshold, high_threshold, name).m_output;
+}
+
+/**
+ * @brief Highlights adjustment (luminance 0.7 -> 1.0).
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyHighlightsAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.7f,
+    float high_threshold = 1.0f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getHighlightsMinValue(),
+        OperationRanges::getHighlightsMaxValue()
+    );
+    return applyBrightToneAdjustment(input, safe_val, x, y, c, low_threshold, high_threshold, "highlights");
+}
+
+/**
+ * @brief Highlights adjustment from a shared luminance (fused pipelines, see `FusedLuminance`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyHighlightsAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.7f,
+    float high_threshold = 1.0f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getHighlightsMinValue(),
+        OperationRanges::getHighlightsMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, safe_val, x, y, c,
+                                     true, low_threshold, high_threshold, "highlights");
+}
+
+/**
+ * @brief Highlights adjustment masked by `mask_luminance` (edge-aware mode, see `ToneMaskMode`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyHighlightsAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Func& mask_luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.7f,
+    float high_threshold = 1.0f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getHighlightsMinValue(),
+        OperationRanges::getHighlightsMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, mask_luminance, safe_val, x, y, c,
+                                     true, low_threshold, high_threshold, "highlights");
+}
+
+/**
+ * @brief Shadows adjustment (luminance 0.0 -> 0.3).
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyShadowsAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.0f,
+    float high_threshold = 0.3f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getShadowsMinValue(),
+        OperationRanges::getShadowsMaxValue()
+    );
+    return applyDarkToneAdjustment(input, safe_val, x, y, c, low_threshold, high_threshold, "shadows");
+}
+
+/**
+ * @brief Shadows adjustment from a shared luminance (fused pipelines, see `FusedLuminance`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyShadowsAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.0f,
+    float high_threshold = 0.3f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getShadowsMinValue(),
+        OperationRanges::getShadowsMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, safe_val, x, y, c,
+                                     false, low_threshold, high_threshold, "shadows");
+}
+
+/**
+ * @brief Shadows adjustment masked by `mask_luminance` (edge-aware mode, see `ToneMaskMode`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyShadowsAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Func& mask_luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.0f,
+    float high_threshold = 0.3f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getShadowsMinValue(),
+        OperationRanges::getShadowsMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, mask_luminance, safe_val, x, y, c,
+                                     false, low_threshold, high_threshold, "shadows");
+}
+
+/**
+ * @brief Whites adjustment (luminance 0.7 -> 1.0).
+ * @details Typically Whites targets the very top (e.g. > 0.9), adjusting low_threshold separates it from Highlights.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyWhitesAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.7f,
+    float high_threshold = 1.0f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getWhitesMinValue(),
+        OperationRanges::getWhitesMaxValue()
+    );
+    return applyBrightToneAdjustment(input, safe_val, x, y, c, low_threshold, high_threshold, "whites");
+}
+
+/**
+ * @brief Whites adjustment from a shared luminance (fused pipelines, see `FusedLuminance`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyWhitesAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.7f,
+    float high_threshold = 1.0f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getWhitesMinValue(),
+        OperationRanges::getWhitesMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, safe_val, x, y, c,
+                                     true, low_threshold, high_threshold, "whites");
+}
+
+/**
+ * @brief Blacks adjustment (luminance 0.0 -> 0.3).
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applyBlacksAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.0f,
+    float high_threshold = 0.3f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getBlacksMinValue(),
+        OperationRanges::getBlacksMaxValue()
+    );
+    return applyDarkToneAdjustment(input, safe_val, x, y, c, low_threshold, high_threshold, "blacks");
+}
+
+/**
+ * @brief Blacks adjustment from a shared luminance (fused pipelines, see `FusedLuminance`).
+ */
+template<typename InputType>
+[[nodiscard]] MaskedToneResult applyBlacksAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    float low_threshold = 0.0f,
+    float high_threshold = 0.3f)
+{
+    Halide::Expr safe_val = Halide::clamp(
+        value,
+        OperationRanges::getBlacksMinValue(),
+        OperationRanges::getBlacksMaxValue()
+    );
+    return applyMaskedToneAdjustment(input, luminance, safe_val, x, y, c,
+                                     false, low_threshold, high_threshold, "blacks");
+}
+
+/**
+ * @brief Saturation from a shared luminance: each channel moves away from (or towards) the luminance.
+ * @details
+ * Formula: `L + (Input - L) * SaturationFactor`, clamped to [0, 1]. 0 gives grayscale, 1 no change.
+ * The luminance is preserved (the weights sum to 1) until a channel clips.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applySaturationAdjustment(
+    const InputType& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func saturation_func("saturation_op");
+
+    Halide::Expr safe_saturation = Halide::clamp(
+        value,
+        OperationRanges::getSaturationMinValue(),
+        OperationRanges::getSaturationMaxValue()
+    );
+
+    saturation_func(x, y, c) = Halide::select(
+        c < 3,
+        Halide::clamp(luminance(x, y) + (input(x, y, c) - luminance(x, y)) * safe_saturation, 0.0f, 1.0f),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    return saturation_func;
+}
+
+/**
+ * @brief Saturation adjustment computing its own luminance.
+ */
+template<typename InputType>
+[[nodiscard]] Halide::Func applySaturationAdjustment(
+    const InputType& input,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func luminance_func("luminance_saturation");
+    luminance_func(x, y) = toneLuminance(input, x, y);
+
+    return applySaturationAdjustment(input, luminance_func, value, x, y, c);
+}
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
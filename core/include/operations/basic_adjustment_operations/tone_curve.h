@@ -0,0 +1,99 @@
+/**
+ * @file tone_curve.h
+ * @brief Declaration of ToneCurve (bakes the curve of the ToneCurve operation into a table).
+ *
+ * @details
+ * The curve is the composition of two curves, as in the usual raw editors:
+ * - the **parametric** curve: four region offsets (shadows, darks, lights, highlights), each
+ *   lifting or lowering a smooth bump centered on its quarter of the tonal range;
+ * - the **point** curve: control points joined by a monotone cubic (Fritsch-Carlson), so that
+ *   an increasing set of points never overshoots.
+ *
+ * Both are evaluated on the CPU, once per edit, into a `k_table_size` entry table that the
+ * fused pipeline samples through an `ImageParam` (`FusionParameterBlock::lut`). Editing the
+ * curve rewrites the table only; the compiled pipeline is unchanged.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+
+#include "Halide.h"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class ToneCurve
+ * @brief Parses, formats and bakes tone curves.
+ */
+class ToneCurve {
+public:
+    /**
+     * @struct Point
+     * @brief A control point of the point curve, both coordinates in [0, 1].
+     */
+    struct Point {
+        float m_x{0.0f};
+        float m_y{0.0f};
+
+        [[nodiscard]] bool operator==(const Point&) const = default;
+    };
+
+    /**
+     * @brief Entries of the baked table (4 KiB: uploaded with every curve edit on the GPU).
+     */
+    static constexpr int k_table_size = 1024;
+
+    /**
+     * @brief Largest shift of a parametric region, at its center and an offset of +/-1.
+     */
+    static constexpr float k_region_gain = 0.25f;
+
+    /**
+     * @brief Parses control points written as "x,y;x,y;...".
+     * @return The points, sorted by x and clamped to [0, 1]; `std::nullopt` if the text is malformed.
+     *         Points sharing an x keep the last one. An empty text is an empty curve.
+     */
+    [[nodiscard]] static std::optional<std::vector<Point>> parsePoints(std::string_view text);
+
+    /**
+     * @brief Writes control points in the format `parsePoints` reads.
+     */
+    [[nodiscard]] static std::string formatPoints(std::span<const Point> points);
+
+    /**
+     * @brief Whether the descriptor's curve is the identity (no point curve, all regions at 0).
+     */
+    [[nodiscard]] static bool isIdentity(const OperationDescriptor& descriptor);
+
+    /**
+     * @brief Evaluates the descriptor's curve into `table` (`table[i]` is the output for `i / (size - 1)`).
+     * @details Malformed points are logged and ignored (the point curve is then the identity).
+     */
+    static void bake(const OperationDescriptor& descriptor, std::span<float> table);
+
+    /**
+     * @brief Bakes the descriptor's curve into a new `k_table_size` entry buffer.
+     */
+    [[nodiscard]] static Halide::Buffer<float> bake(const OperationDescriptor& descriptor);
+
+    /**
+     * @brief The identity table (initial contents of the graph input).
+     */
+    [[nodiscard]] static Halide::Buffer<float> identity();
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,47 @@
+/**
+ * @file tone_mask_mode.h
+ * @brief Mask modes of the luminance-range adjustments (Highlights, Shadows).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief How a luminance-range adjustment selects the pixels it changes (`ParameterKey::MaskMode`).
+ */
+enum class ToneMaskMode : std::uint32_t {
+    /**
+     * @brief Mask from the luminance of each pixel: cheap, but textured regions are split
+     *        between masked and unmasked pixels, which flattens them.
+     */
+    PerPixel = 0,
+
+    /**
+     * @brief Mask from an edge-aware smoothing of the luminance (`BilateralGrid`): whole regions
+     *        move together, detail is kept, and no halo is drawn along strong edges.
+     */
+    EdgeAware = 1
+};
+
+/**
+ * @brief Mask mode of a descriptor; unset or unknown values select `ToneMaskMode::PerPixel`.
+ */
+[[nodiscard]] inline ToneMaskMode toneMaskModeOf(const OperationDescriptor& descriptor)
+{
+    const auto mode = descriptor.getParam<int>(ParameterKey::MaskMode);
+    return mode && mode.value() == static_cast<int>(ToneMaskMode::EdgeAware) ? ToneMaskMode::EdgeAware
+                                                                             : ToneMaskMode::PerPixel;
+}
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
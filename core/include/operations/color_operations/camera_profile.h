@@ -0,0 +1,126 @@
+/**
+ * @file camera_profile.h
+ * @brief Declaration of CameraProfile (white balance and color matrix of a RAW file).
+ *
+ * @details
+ * RAW files are decoded once, camera-native: demosaiced, black-subtracted and scaled, but with
+ * unity white balance multipliers and no color matrix. What the decoder used to bake in is
+ * kept as a profile instead:
+ * - the as-shot multipliers (LibRaw's `cam_mul`, normalized to green);
+ * - the camera to working space matrix (ProPhoto linear: `rgb_cam` composed with the
+ *   sRGB to ProPhoto conversion).
+ *
+ * The profile travels with the decoded image as a string attribute (`k_metadata_key`), so it
+ * survives the memory and disk caches, and the WhiteBalance operation applies it as one 3x3
+ * matrix per pixel at the head of the fused pipeline. A temperature or tint edit only changes
+ * the gains: no decode, no recompilation.
+ *
+ * Sources without a profile (JPEG, TIFF, RAWs the decoder could not describe) are already
+ * developed: their matrix is the identity and their multipliers are 1.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class CameraProfile
+ * @brief As-shot white balance and camera matrix of a decoded source.
+ */
+class CameraProfile {
+public:
+    /**
+     * @brief Attribute of the decoded image (and key of `ISourceManager::getMetadata`) holding the profile.
+     */
+    static constexpr std::string_view k_metadata_key = "CaptureMoment:CameraProfile";
+
+    /**
+     * @brief Id of the WhiteBalance descriptor `attachTo` inserts.
+     * @details Stable across requests (the executor keys the parameter blocks by id) and out of
+     *          the range of `OperationDescriptor::generateId`.
+     */
+    static constexpr std::uint64_t k_inserted_id = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * @brief Stops of red/blue ratio of a temperature shift of +/-1.
+     */
+    static constexpr float k_temperature_stops = 1.0f;
+
+    /**
+     * @brief Stops of green of a tint shift of +/-1.
+     */
+    static constexpr float k_tint_stops = 0.5f;
+
+    /**
+     * @brief As-shot multipliers of R, G and B (G is 1).
+     */
+    std::array<float, 3> m_multipliers{1.0f, 1.0f, 1.0f};
+
+    /**
+     * @brief Camera to working space matrix, row-major (identity for developed sources).
+     */
+    std::array<float, 9> m_matrix{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+    [[nodiscard]] bool operator==(const CameraProfile&) const = default;
+
+    /**
+     * @brief Builds a profile from LibRaw's color data.
+     * @param cam_mul As-shot multipliers (R, G, B, G2); at least 3 values.
+     * @param rgb_cam Camera to sRGB matrix, 3 rows of 4 (or 3) columns.
+     * @return The profile, or `std::nullopt` if the data is missing or degenerate.
+     */
+    [[nodiscard]] static std::optional<CameraProfile> fromLibRaw(std::span<const float> cam_mul, std::span<const float> rgb_cam);
+
+    /**
+     * @brief Parses a profile written by `format`: "r,g,b;m00,m01,...,m22".
+     * @return The profile, or `std::nullopt` if the text is malformed.
+     */
+    [[nodiscard]] static std::optional<CameraProfile> parse(std::string_view text);
+
+    /**
+     * @brief Writes the profile in the format `parse` reads.
+     */
+    [[nodiscard]] std::string format() const;
+
+    /**
+     * @brief Multipliers of R, G and B after a temperature and tint shift (each in [-1, 1]).
+     */
+    [[nodiscard]] std::array<float, 3> multipliers(float temperature, float tint) const noexcept;
+
+    /**
+     * @brief Level a saturated sensor sample reaches once balanced (the smallest multiplier).
+     * @details Balanced channels are clipped to it, so that blown highlights stay neutral
+     *          instead of turning magenta.
+     */
+    [[nodiscard]] float clipLevel(float temperature, float tint) const noexcept;
+
+    /**
+     * @brief Hands the source's profile to the WhiteBalance descriptor of a chain.
+     * @details Moves the chain's WhiteBalance descriptor to the front (the matrix is defined on
+     *          camera-native values), or inserts one at the as-shot balance, and sets its
+     *          `camera_profile`. Without a profile the chain is left unchanged.
+     * @param operations Descriptors of a request, updated in place.
+     * @param profile The profile text of the source, if it has one.
+     */
+    static void attachTo(std::vector<OperationDescriptor>& operations, const std::optional<std::string>& profile);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,105 @@
+/**
+ * @file cube_lut.h
+ * @brief Declaration of CubeLut (loading and sampling of .cube 3D LUTs).
+ *
+ * @details
+ * A 3D LUT maps an RGB triplet to another through an N x N x N lattice (N is 17, 33 or 65
+ * for most creative LUTs). `CubeLut` parses the Adobe/Resolve `.cube` text format into a
+ * `Halide::Buffer<float>` of dimensions (channel, r, g, b):
+ * - the channel is innermost and padded to `k_entry_channels` (4): the corner of a lookup is
+ *   one aligned 16-byte load (a float4 on the GPU), and the alpha channel of the pipeline
+ *   reads the padding instead of a clamped index;
+ * - r is next, then g and b: the file order, and neighboring corners along r are adjacent.
+ *
+ * Loaded tables are cached by path and modification time: a LUT is parsed once per session,
+ * and the same buffer (so the same device copy) is bound to every pipeline that applies it.
+ *
+ * `sampleTetrahedral` interpolates between 4 of the 8 corners of the enclosing cell (the
+ * tetrahedron the color falls into). It is exact for linear maps, does not tint grays, and
+ * needs half the gathers of a trilinear lookup. The tetrahedron is picked with selects, so
+ * the lookup stays branch-free and vectorizes on the CPU.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include "Halide.h"
+
+#include <array>
+#include <expected>
+#include <filesystem>
+#include <istream>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class CubeLut
+ * @brief Parses, caches and samples 3D LUTs.
+ */
+class CubeLut {
+public:
+    /**
+     * @brief Stored channels per lattice entry (RGB and one padding float).
+     */
+    static constexpr int k_entry_channels = 4;
+
+    /**
+     * @brief Largest accepted lattice size (`LUT_3D_SIZE`).
+     */
+    static constexpr int k_max_size = 256;
+
+    /**
+     * @brief Parses a .cube stream.
+     *
+     * @details Reads `LUT_3D_SIZE`, the optional `TITLE`, `DOMAIN_MIN` / `DOMAIN_MAX` and
+     *          `LUT_3D_INPUT_RANGE` (only the default [0, 1] domain is supported), and the N^3 entries.
+     * @return The table, or `UnsupportedFormat` (1D LUT, other domain) / `DecodingError` (malformed).
+     */
+    [[nodiscard]] static std::expected<Halide::Buffer<float>, ErrorHandling::CoreError> parse(std::istream& stream);
+
+    /**
+     * @brief Loads a .cube file, or returns the table already loaded for it.
+     * @details Thread-safe. A file modified since it was cached is parsed again.
+     * @return The table, or `FileNotFound` / `IOError` / a `parse` error.
+     */
+    [[nodiscard]] static std::expected<Halide::Buffer<float>, ErrorHandling::CoreError> load(const std::filesystem::path& path);
+
+    /**
+     * @brief Drops every cached table.
+     */
+    static void clearCache();
+
+    /**
+     * @brief The identity lattice of `size` entries per axis.
+     */
+    [[nodiscard]] static Halide::Buffer<float> identity(int size = 2);
+
+    /**
+     * @brief Tetrahedral lookup of channel `channel` of the color (r, g, b).
+     *
+     * @param table A (channel, r, g, b) table as built by `parse`; any lattice size.
+     * @param r, g, b The color; clamped to [0, 1].
+     * @param channel Channel to read, in [0, k_entry_channels).
+     */
+    [[nodiscard]] static Halide::Expr sampleTetrahedral(const Halide::ImageParam& table,
+                                                        const Halide::Expr& r,
+                                                        const Halide::Expr& g,
+                                                        const Halide::Expr& b,
+                                                        const Halide::Expr& channel);
+
+    /**
+     * @brief Host version of `sampleTetrahedral`: R, G and B of the color (r, g, b).
+     * @param table A (channel, r, g, b) table as built by `parse`, on the host.
+     */
+    [[nodiscard]] static std::array<float, 3> sampleTetrahedral(const Halide::Buffer<float>& table, float r, float g, float b);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
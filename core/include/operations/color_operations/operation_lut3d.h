@@ -0,0 +1,136 @@
+/**
+ * @file operation_lut3d.h
+ * @brief Concrete implementation of the 3D LUT (look) operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationLut3D
+ * @brief Maps the colors of an image region through a .cube 3D LUT.
+ *
+ * The LUT is loaded once (`CubeLut::load` caches it by path) into a padded, interleaved
+ * lattice, bound to the fused pipeline as a lookup table input: changing the amount or the
+ * file never recompiles, and every pipeline applying the same file shares one buffer (and its
+ * device copy on the GPU). The lookup is tetrahedral (4 gathers of 16 bytes per pixel),
+ * branch-free, and vectorized with the rest of the chain.
+ *
+ * **Algorithm**:
+ * For each pixel `p` and channel `c` (excluding alpha):
+ * \f$ p_c = p_c + \text{value} \cdot (\text{lut}(p_r, p_g, p_b)_c - p_c) \f$
+ *
+ * **Parameters**:
+ * - `lut_path` (string): The .cube file. Unset or unreadable: no change.
+ * - `value` (float): The amount the LUT is applied with.
+ * - Range: Defined by OperationRanges::getLut3DMinValue() and OperationRanges::getLut3DMaxValue()
+ * - Default: OperationRanges::getLut3DDefaultValue() (typically 1.0f, the LUT as authored)
+ */
+class OperationLut3D : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Lut3D; }
+    [[nodiscard]] const char* name() const override { return "Lut3D"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed amount.
+     * Defined by OperationRanges::getLut3DMinValue().
+     */
+    static constexpr float MIN_LUT3D_VALUE = OperationRanges::getLut3DMinValue();
+
+    /**
+     * @brief Maximum allowed amount.
+     * Defined by OperationRanges::getLut3DMaxValue().
+     */
+    static constexpr float MAX_LUT3D_VALUE = OperationRanges::getLut3DMaxValue();
+
+    /**
+     * @brief Default amount.
+     * Defined by OperationRanges::getLut3DDefaultValue().
+     */
+    static constexpr float DEFAULT_LUT3D_VALUE = OperationRanges::getLut3DDefaultValue();
+
+    /**
+     * @brief Key of the lattice in the parameter block.
+     */
+    static constexpr std::string_view k_table_key = "lut_table";
+
+    /**
+     * @brief Applies the 3D LUT.
+     *
+     * This method provides sequential execution capability for the 3D LUT operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Loads the "lut_path" file and maps every pixel of the working image through it, blended
+     * by "value". The alpha channel is left unchanged.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Should contain "lut_path" (string); "value" (float) is optional.
+     * @return std::expected<void, ErrorHandling::CoreError>; the load error if the file cannot be read.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation.
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_LUT3D_VALUE) and the lattice (identity until bound).
+     * @param luminance Shared luminance of the chain. Not read; the output is not tracked.
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief Binds the amount and the (cached) lattice of "lut_path" (no recompilation).
+     */
+    void updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const override;
+
+    /**
+     * @brief True without a LUT file or at a zero amount (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief Per-pixel, with the eight lattice cells of the trilinear lookup.
+     */
+    [[nodiscard]] OperationCost cost(const OperationDescriptor& /*params*/) const override { return OperationCost::perPixel(8.0); }
+
+    /**
+     * @brief True while the amount is zero (specialized branch without the lattice lookup).
+     */
+    [[nodiscard]] Halide::Expr identityCondition(FusionParameterBlock& params) const override { return neutralValueCondition(params, MIN_LUT3D_VALUE); }
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,136 @@
+/**
+ * @file operation_white_balance.h
+ * @brief Concrete implementation of the White Balance operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+#include <array>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationWhiteBalance
+ * @brief Balances and converts the colors of an image region with its source's camera profile.
+ *
+ * RAW files are decoded camera-native (see `CameraProfile`): this operation is their color
+ * development, one 3x3 matrix per pixel at the head of the fused pipeline. The gains (as-shot
+ * multipliers and temperature / tint shifts), the camera matrix and the clip level are runtime
+ * scalars: a white balance edit rebinds them, without decoding or recompiling.
+ * The core inserts the operation (and fills `camera_profile`) for every source with a profile;
+ * on developed sources it only shifts the temperature and tint of the rendered colors.
+ *
+ * **Algorithm**:
+ * For each pixel `p`, with the gains `g = CameraProfile::multipliers(temperature, tint)`:
+ * \f$ b_c = \min(p_c \cdot g_c, \text{clip}) \f$, then \f$ p = M \cdot b \f$
+ * (clip is the smallest gain for RAW sources, so that saturated highlights stay neutral).
+ *
+ * **Parameters**:
+ * - `temperature` (float): Shift of the red/blue balance (positive is warmer).
+ * - `tint` (float): Shift of the green/magenta balance (positive is magenta).
+ * - Range: Defined by OperationRanges::getWhiteBalanceShiftMinValue() and OperationRanges::getWhiteBalanceShiftMaxValue()
+ * - Default: OperationRanges::getWhiteBalanceShiftDefaultValue() (typically 0.0f, as shot)
+ * - `camera_profile` (string): The source's profile, set by the core. Unset: identity matrix, unity multipliers.
+ */
+class OperationWhiteBalance : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::WhiteBalance; }
+    [[nodiscard]] const char* name() const override { return "WhiteBalance"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed temperature or tint shift.
+     * Defined by OperationRanges::getWhiteBalanceShiftMinValue().
+     */
+    static constexpr float MIN_SHIFT_VALUE = OperationRanges::getWhiteBalanceShiftMinValue();
+
+    /**
+     * @brief Maximum allowed temperature or tint shift.
+     * Defined by OperationRanges::getWhiteBalanceShiftMaxValue().
+     */
+    static constexpr float MAX_SHIFT_VALUE = OperationRanges::getWhiteBalanceShiftMaxValue();
+
+    /**
+     * @brief Default temperature or tint shift.
+     * Defined by OperationRanges::getWhiteBalanceShiftDefaultValue().
+     */
+    static constexpr float DEFAULT_SHIFT_VALUE = OperationRanges::getWhiteBalanceShiftDefaultValue();
+
+    /**
+     * @brief Keys of the gains (R, G, B) in the parameter block.
+     */
+    static constexpr std::array<std::string_view, 3> k_gain_keys{ "wb_gain_r", "wb_gain_g", "wb_gain_b" };
+
+    /**
+     * @brief Keys of the matrix coefficients (row-major) in the parameter block.
+     */
+    static constexpr std::array<std::string_view, 9> k_matrix_keys{
+        "wb_m00", "wb_m01", "wb_m02", "wb_m10", "wb_m11", "wb_m12", "wb_m20", "wb_m21", "wb_m22"
+    };
+
+    /**
+     * @brief Key of the clip level in the parameter block.
+     */
+    static constexpr std::string_view k_clip_key = "wb_clip";
+
+    /**
+     * @brief Applies the white balance and the camera matrix.
+     *
+     * This method provides sequential execution capability for the white balance operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * The alpha channel is left unchanged.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params May contain "temperature", "tint" (float) and "camera_profile" (string).
+     * @return std::expected<void, ErrorHandling::CoreError>
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation.
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the gains, the matrix and the
+     *               clip level (identity until bound).
+     * @param luminance Shared luminance of the chain. Not read; the output is not tracked.
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief Binds the gains, matrix and clip level of the descriptor (no recompilation).
+     */
+    void updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const override;
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,84 @@
+/**
+ * @file bilateral_grid.h
+ * @brief Declaration of BilateralGrid (edge-aware smoothing building block of the spatial operations).
+ *
+ * @details
+ * Edge-aware tone masks need the luminance smoothed within regions but not across strong edges.
+ * A bilateral filter does that, at a cost growing with its radius; the bilateral grid
+ * approximates it in three steps:
+ *
+ * - **splat**: the luminance is accumulated into a coarse 3D grid, one cell per
+ *   `k_cell_size` x `k_cell_size` pixels and one bin per `k_range_sigma` of luminance
+ *   (sum and count of the pixels falling into each cell);
+ * - **blur**: the grid is blurred along its three axes with a 5-tap binomial kernel;
+ * - **slice**: each pixel reads the grid trilinearly at its position and luminance, and divides
+ *   the blurred sum by the blurred count.
+ *
+ * The grid holds about `(W / 32) * (H / 32) * 12` cells: the splat reads each pixel once, the
+ * slice does 16 reads per pixel, and the blur is negligible, whatever the smoothing radius.
+ * Pixels on both sides of an edge fall into different bins and do not average together.
+ *
+ * Like `GaussianBlur`, every stage is a function of the coordinates, computed at root over the
+ * region the output needs; the splat reads past the image edges (edge-clamped chain input).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class BilateralGrid
+ * @brief Builds edge-aware smoothings of fused-pipeline planes.
+ */
+class BilateralGrid {
+public:
+    /**
+     * @brief Pixels per grid cell along x and y (spatial extent of the smoothing).
+     */
+    static constexpr int k_cell_size = 32;
+
+    /**
+     * @brief Luminance per grid bin (range extent of the smoothing).
+     */
+    static constexpr float k_range_sigma = 0.1f;
+
+    /**
+     * @struct Result
+     * @brief The smoothed plane and the grid stages it reads.
+     */
+    struct Result {
+        /**
+         * @brief The smoothed plane (x, y).
+         */
+        Halide::Func m_output;
+
+        /**
+         * @brief Stages to compute at root (see `FusionParameterBlock::addSpatialStages`).
+         * @details The splat is a reduction whose update keeps x and y pure, so that the
+         *          executor can parallelize it over the cells (CPU) or tile it (GPU).
+         */
+        std::vector<Halide::Func> m_stages;
+    };
+
+    /**
+     * @brief Smooths a plane in [0, 1] (e.g. a luminance), preserving its edges.
+     *
+     * @param input The plane to smooth, defined past the image edges; values are clamped to [0, 1].
+     * @param x The shared x variable of the pipeline.
+     * @param y The shared y variable of the pipeline.
+     */
+    [[nodiscard]] static Result smooth(const Halide::Func& input, const Halide::Var& x, const Halide::Var& y);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
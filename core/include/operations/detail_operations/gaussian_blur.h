@@ -0,0 +1,139 @@
+/**
+ * @file gaussian_blur.h
+ * @brief Declaration of GaussianBlur (shared blur building block of the spatial operations).
+ *
+ * @details
+ * Clarity, dehaze, local contrast, sharpening and noise reduction all blur their input, often
+ * with radii of tens of pixels. Convolving with the full kernel costs `6 * sigma` taps per pass,
+ * which ruins interactivity on large radii. This building block keeps the cost bounded:
+ *
+ * - `sigma <= k_direct_max_sigma`: separable Gaussian at full resolution (at most 25 taps per pass);
+ * - larger sigmas: the input is decimated by 2x2 boxes down to the level where the remaining
+ *   sigma is at most `k_direct_max_sigma`, blurred there with the same separable kernel, and
+ *   upsampled bilinearly. The variance added by the decimation and the upsampling is subtracted
+ *   from the kernel's, so the result stays close to the requested Gaussian.
+ *
+ * Sigma is a graph input (typically a `FusionParameterBlock` scalar): the level is selected at
+ * run time and the unselected levels shrink to a single tap, so dragging a radius slider never
+ * recompiles and the per-pixel cost does not grow with the radius.
+ *
+ * Every stage is a pure function of the coordinates: Halide's bounds inference computes each
+ * level only over the region the output needs (the region of interest plus the kernel halo).
+ * Reads past the image edges rely on the chain input being edge-clamped, which the executor
+ * does for operations that declare `IOperationFusionLogic::readsNeighborhood`.
+ *
+ * A region processed as an image of its own (a strip of an export) matches the same pixels of
+ * a whole-image pass exactly when it is read with `haloFor(sigma)` extra pixels on each side and
+ * its origin is a multiple of `k_alignment` (the 2x2 boxes of the pyramid then group the same
+ * pixels). Within the image, the fused pipeline realizes regions in image coordinates and needs
+ * neither.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class GaussianBlur
+ * @brief Builds bounded-cost Gaussian blurs of fused-pipeline functions.
+ */
+class GaussianBlur {
+public:
+    /**
+     * @brief Largest sigma blurred directly, and largest per-level sigma of the pyramid.
+     */
+    static constexpr float k_direct_max_sigma = 4.0f;
+
+    /**
+     * @brief Number of decimated levels (each halves the resolution).
+     */
+    static constexpr int k_pyramid_levels = 5;
+
+    /**
+     * @brief Largest supported sigma, in pixels; larger values are clamped.
+     */
+    static constexpr float k_max_sigma = k_direct_max_sigma * static_cast<float>(1 << k_pyramid_levels);
+
+    /**
+     * @brief Origin alignment of regions processed separately (the spacing of the coarsest level).
+     */
+    static constexpr int k_alignment = 1 << k_pyramid_levels;
+
+    /**
+     * @struct Result
+     * @brief The blurred function and the intermediate stages it reads.
+     */
+    struct Result {
+        /**
+         * @brief The blurred function, with the dimensions of the input.
+         */
+        Halide::Func m_output;
+
+        /**
+         * @brief Stages to compute at root (see `FusionParameterBlock::addSpatialStages`).
+         * @details Inlined, each of them would be recomputed for every tap of its consumer.
+         */
+        std::vector<Halide::Func> m_stages;
+    };
+
+    /**
+     * @brief Blurs an RGBA function (x, y, c); every channel, alpha included, is blurred.
+     *
+     * @param input The function to blur, defined past the image edges.
+     * @param sigma Standard deviation in pixels, clamped to [0, `k_max_sigma`].
+     * @param x The shared x variable of the pipeline.
+     * @param y The shared y variable of the pipeline.
+     * @param c The shared channel variable of the pipeline.
+     */
+    [[nodiscard]] static Result apply(
+        const Halide::Func& input,
+        const Halide::Expr& sigma,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c);
+
+    /**
+     * @brief Blurs a single-plane function (x, y), e.g. a luminance.
+     */
+    [[nodiscard]] static Result applyPlane(
+        const Halide::Func& input,
+        const Halide::Expr& sigma,
+        const Halide::Var& x,
+        const Halide::Var& y);
+
+    /**
+     * @brief Pyramid level blurring `sigma` (0: full resolution).
+     */
+    [[nodiscard]] static int levelFor(float sigma) noexcept;
+
+    /**
+     * @brief Farthest input pixel read by the blur of `sigma`, in full-resolution pixels.
+     * @details Kernel radius at the selected level, plus the 2x2 boxes and the bilinear taps
+     *          of that level (see the class description for regions processed separately).
+     */
+    [[nodiscard]] static int haloFor(float sigma) noexcept;
+
+private:
+    /**
+     * @brief Shared implementation; `channels` holds the variables after (x, y), if any.
+     */
+    [[nodiscard]] static Result build(
+        const Halide::Func& input,
+        const Halide::Expr& sigma,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const std::vector<Halide::Var>& channels);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,114 @@
+/**
+ * @file guided_upsampling.h
+ * @brief Declaration of GuidedUpsampling (preview of an expensive operation computed at low resolution).
+ *
+ * @details
+ * While a detail slider is dragged, an expensive spatial operation (e.g. denoise) need not run on
+ * every pixel of the preview. Its effect is computed on a copy reduced `k_factor` times along each
+ * axis, then transferred to the full-resolution input (bilateral guided upsampling):
+ *
+ * - **reduce**: the operation's input is box-averaged over `k_factor` x `k_factor` blocks, and the
+ *   operation runs on that small image;
+ * - **fit**: for each cell of a bilateral grid (`k_cell_size` reduced pixels, one bin per
+ *   `k_range_sigma` of luminance), the moments of the reduced input and output pixels falling into
+ *   it are accumulated, blurred across neighboring cells, and fitted by one affine transform per
+ *   color channel, `out = a * in + b`;
+ * - **slice**: each full-resolution pixel reads the transforms trilinearly at its position and
+ *   luminance, and applies them to its own color.
+ *
+ * Tonal and color changes, and edge-aware smoothing coarser than a reduced pixel, carry over;
+ * detail finer than a reduced pixel does not (the full-quality render at the end of the gesture
+ * computes it). The transforms are regularized towards an offset, so flat regions stay stable.
+ *
+ * Like `BilateralGrid`, every stage is a function of the pipeline coordinates, computed at root
+ * over the region the output needs; the reduction reads past the image edges (edge-clamped input).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class GuidedUpsampling
+ * @brief Builds the reduced input of an operation and the full-resolution transfer of its effect.
+ */
+class GuidedUpsampling {
+public:
+    /**
+     * @brief Reduction of each axis: the operation runs on 1 / (k_factor * k_factor) of the pixels.
+     */
+    static constexpr int k_factor = 4;
+
+    /**
+     * @brief Reduced pixels per grid cell along x and y (`k_cell_size * k_factor` full-resolution pixels).
+     */
+    static constexpr int k_cell_size = 8;
+
+    /**
+     * @brief Luminance per grid bin.
+     */
+    static constexpr float k_range_sigma = 0.125f;
+
+    /**
+     * @brief Regularization of the fit: variances well below it give an offset (slope 1), not a slope.
+     */
+    static constexpr float k_regularization = 1.0e-4f;
+
+    /**
+     * @struct Result
+     * @brief An RGBA function and the stages it reads.
+     */
+    struct Result {
+        /**
+         * @brief The function (x, y, c).
+         */
+        Halide::Func m_output;
+
+        /**
+         * @brief Stages to compute at root (see `FusionParameterBlock::addSpatialStages`).
+         * @details The splat is a reduction whose update keeps x and y pure, so that the
+         *          executor can parallelize it over the cells (CPU) or tile it (GPU).
+         */
+        std::vector<Halide::Func> m_stages;
+    };
+
+    /**
+     * @brief Box-averages an RGBA function over `k_factor` x `k_factor` blocks.
+     *
+     * @param input The full-resolution function, defined past the image edges.
+     * @param x The shared x variable of the pipeline.
+     * @param y The shared y variable of the pipeline.
+     * @param c The shared c variable of the pipeline.
+     * @return The reduced function: pixel (x, y) covers the block starting at (x, y) * k_factor.
+     */
+    [[nodiscard]] static Result reduce(const Halide::Func& input, const Halide::Var& x, const Halide::Var& y,
+                                       const Halide::Var& c);
+
+    /**
+     * @brief Transfers the effect of an operation from the reduced image to the full-resolution one.
+     *
+     * @param input The full-resolution input of the operation.
+     * @param reduced_input The output of `reduce(input)`.
+     * @param reduced_output The operation applied to `reduced_input`.
+     * @param x The shared x variable of the pipeline.
+     * @param y The shared y variable of the pipeline.
+     * @param c The shared c variable of the pipeline.
+     * @return `input` with the fitted transforms applied to R, G and B; alpha unchanged.
+     */
+    [[nodiscard]] static Result upsample(const Halide::Func& input, const Halide::Func& reduced_input,
+                                         const Halide::Func& reduced_output, const Halide::Var& x,
+                                         const Halide::Var& y, const Halide::Var& c);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
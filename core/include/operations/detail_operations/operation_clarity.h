@@ -0,0 +1,159 @@
+/**
+ * @file operation_clarity.h
+ * @brief Concrete implementation of Clarity adjustment
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationClarity
+ * @brief Adjusts the local contrast (mid-frequency detail) of an image region.
+ *
+ * The luminance is split into an edge-preserving base and a detail layer. The base is the
+ * output of a guided filter of the luminance by itself: smooth within regions, sharp across
+ * strong edges, so boosting the detail does not draw halos along them. Its box means are
+ * `GaussianBlur`s of a large sigma, whose cost does not grow with the radius.
+ *
+ * The base only depends on the input of the operation, not on its value: it is declared as a
+ * cached stage (`FusionParameterBlock::cachedStage`). While the user drags the Clarity slider,
+ * the executor reads it back instead of recomputing the blurs, and the per-tick cost is that of
+ * a per-pixel adjustment.
+ *
+ * **Algorithm**:
+ * For each pixel of luminance `L` and base `B` (guided filter of `L`, radius `k_guide_sigma`):
+ * \f$ p_c = p_c + \text{value} \cdot k\_detail\_gain \cdot 4L(1 - L) \cdot (L - B) \f$
+ * The midtone weight `4L(1 - L)` leaves the ends of the range alone, so the detail does not clip.
+ *
+ * **Parameters**:
+ * - `value` (float): The clarity amount.
+ * - Range: Defined by OperationRanges::getClarityMinValue() and OperationRanges::getClarityMaxValue()
+ * - Default: OperationRanges::getClarityDefaultValue() (typically 0.0f, No change)
+ * - > 0: Increase local contrast
+ * - < 0: Smooth the detail (softer look)
+ */
+class OperationClarity : public IOperation,  public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Clarity; }
+    [[nodiscard]] const char* name() const override { return "Clarity"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed clarity value.
+     * Defined by OperationRanges::getClarityMinValue().
+     */
+    static constexpr float MIN_CLARITY_VALUE = OperationRanges::getClarityMinValue();
+
+    /**
+     * @brief Maximum allowed clarity value.
+     * Defined by OperationRanges::getClarityMaxValue().
+     */
+    static constexpr float MAX_CLARITY_VALUE = OperationRanges::getClarityMaxValue();
+
+    /**
+     * @brief Default clarity value.
+     * Defined by OperationRanges::getClarityDefaultValue().
+     */
+    static constexpr float DEFAULT_CLARITY_VALUE = OperationRanges::getClarityDefaultValue();
+
+    /**
+     * @brief Radius of the guided filter (sigma of its means), in pixels.
+     */
+    static constexpr float k_guide_sigma = 16.0f;
+
+    /**
+     * @brief Regularization of the guided filter: variances well below it are smoothed away,
+     *        edges of a larger variance are kept in the base.
+     */
+    static constexpr float k_guide_epsilon = 0.01f;
+
+    /**
+     * @brief Gain of the detail layer at `MAX_CLARITY_VALUE`, in the midtones.
+     */
+    static constexpr float k_detail_gain = 1.5f;
+
+    /**
+     * @brief Applies the clarity adjustment.
+     *
+     * This method provides sequential execution capability for the clarity adjustment operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Reads the "value" parameter from the descriptor and builds the same graph as the fused path,
+     * with the blur stages computed at root. The alpha channel is left unchanged.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Must contain a "value" (float) parameter.
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation
+     *                   (edge-clamped by the executor, see `readsNeighborhood`).
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_CLARITY_VALUE), the blur stages and the cached base.
+     * @param luminance Shared luminance of the chain (read at the pixel, and tracked).
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief The guided filter reads up to `3 * k_guide_sigma` pixels away.
+     */
+    [[nodiscard]] bool readsNeighborhood(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Kept by the executor: editing the operations after it does not redo the guide pyramid and the filter.
+     */
+    [[nodiscard]] bool memoizesOutput(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Reach of the two chained blurs of the guided filter (`GaussianBlur::haloFor`).
+     */
+    [[nodiscard]] Common::ImageDim haloPixels(const OperationDescriptor& params) const override;
+
+    /**
+     * @brief Spatial: the guide pyramid and the four blurred means of the guided filter.
+     * @details The memoized base is not recomputed while the slider moves; a chain is
+     *          predicted as rendered from scratch.
+     */
+    [[nodiscard]] OperationCost cost(const OperationDescriptor& params) const override;
+
+    /**
+     * @brief True at the default value (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override { return hasNeutralValue(descriptor, DEFAULT_CLARITY_VALUE); }
+
+    /**
+     * @brief Executes the adjustment on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,183 @@
+/**
+ * @file operation_denoise.h
+ * @brief Concrete implementation of the Noise Reduction operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+#include <array>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationDenoise
+ * @brief Reduces the luminance and the color noise of an image region (wavelet shrinkage).
+ *
+ * The image is split into a luminance and two color difference planes, then decomposed by an
+ * "à trous" B3-spline wavelet transform of `k_scales` scales. Noise lives in the small detail
+ * coefficients: each is shrunk towards zero by a threshold proportional to the strength of its
+ * plane, and to the expected noise of its scale. Edges and texture, of a larger amplitude, keep
+ * most of theirs.
+ *
+ * Every smoothing pass is a separable 5-tap filter, declared as a spatial stage: the executor
+ * computes it at root over the requested region plus its halo, in tiles (GPU) or vectorized
+ * rows (CPU). The cost does not depend on the strengths, and the strengths never recompile.
+ *
+ * **Algorithm**:
+ * With `v = sign(p) sqrt(|p|)` per channel (shot noise of about the same amplitude everywhere),
+ * `Y = (R + G + B) / 3`, `C1 = R - G`, `C2 = B - G`, and per plane the smoothings
+ * `s_0 = plane`, `s_{i+1} = B3(s_i, dilation 2^i)`:
+ * \f$ \text{plane}' = s_n + \sum_i \text{shrink}(s_i - s_{i+1}, t \cdot w_i) \f$
+ * where `shrink` is the soft threshold, then back to RGB and squared. Alpha is unchanged.
+ * With both strengths at 0, the sum telescopes back to the input.
+ *
+ * **Parameters**:
+ * - `value` (float): The luminance noise reduction.
+ * - `color_noise` (float): The color noise reduction.
+ * - Range: Defined by OperationRanges::getDenoiseMinValue() and OperationRanges::getDenoiseMaxValue()
+ * - Default: OperationRanges::getDenoiseDefaultValue() (typically 0.0f, No change)
+ */
+class OperationDenoise : public IOperation, public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Denoise; }
+    [[nodiscard]] const char* name() const override { return "Denoise"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed strength (luminance and color).
+     * Defined by OperationRanges::getDenoiseMinValue().
+     */
+    static constexpr float MIN_DENOISE_VALUE = OperationRanges::getDenoiseMinValue();
+
+    /**
+     * @brief Maximum allowed strength (luminance and color).
+     * Defined by OperationRanges::getDenoiseMaxValue().
+     */
+    static constexpr float MAX_DENOISE_VALUE = OperationRanges::getDenoiseMaxValue();
+
+    /**
+     * @brief Default strength (luminance and color).
+     * Defined by OperationRanges::getDenoiseDefaultValue().
+     */
+    static constexpr float DEFAULT_DENOISE_VALUE = OperationRanges::getDenoiseDefaultValue();
+
+    /**
+     * @brief Wavelet scales; the coarsest detail spans about `2^k_scales` pixels.
+     */
+    static constexpr int k_scales = 4;
+
+    /**
+     * @brief Finest-scale threshold of the luminance at `MAX_DENOISE_VALUE` (square root domain).
+     */
+    static constexpr float k_luma_threshold = 0.03f;
+
+    /**
+     * @brief Finest-scale threshold of the color differences at `MAX_DENOISE_VALUE` (square root domain).
+     */
+    static constexpr float k_chroma_threshold = 0.06f;
+
+    /**
+     * @brief Luminance threshold of each scale, relative to the finest (white noise falls off quickly).
+     */
+    static constexpr std::array<float, k_scales> k_luma_scale_weights{ 1.0f, 0.5f, 0.25f, 0.125f };
+
+    /**
+     * @brief Color threshold of each scale, relative to the finest (color blotches are coarse).
+     */
+    static constexpr std::array<float, k_scales> k_chroma_scale_weights{ 1.0f, 0.8f, 0.6f, 0.4f };
+
+    /**
+     * @brief Pixels read on each side: two taps at dilation `2^i` per pass and per scale.
+     */
+    static constexpr Common::ImageDim k_halo = 2 * ((Common::ImageDim{1} << k_scales) - 1);
+
+    /**
+     * @brief Applies the noise reduction.
+     *
+     * This method provides sequential execution capability for the noise reduction.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Builds the same graph as the fused path, with the wavelet passes computed at root.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Should contain "value" and "color_noise" (float); a missing one is 0.
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation
+     *                   (edge-clamped by the executor, see `readsNeighborhood`).
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the "value" and "color_noise"
+     *               scalars (default DEFAULT_DENOISE_VALUE) and the wavelet stages.
+     * @param luminance Shared luminance of the chain. Not read; the output is not tracked.
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief The wavelet passes read up to `k_halo` pixels away.
+     */
+    [[nodiscard]] bool readsNeighborhood(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Kept by the executor: editing the operations after it does not redo the wavelet transform.
+     */
+    [[nodiscard]] bool memoizesOutput(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Previewed at reduced resolution while dragged: the wavelet transform is the cost of every tick.
+     * @details The grain finer than a reduced pixel is only removed by the render ending the gesture.
+     */
+    [[nodiscard]] bool upsamplesPreview(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief `k_halo`, whatever the strengths.
+     */
+    [[nodiscard]] Common::ImageDim haloPixels(const OperationDescriptor& /*params*/) const override { return k_halo; }
+
+    /**
+     * @brief Spatial: two 5-tap passes per scale on each of the three planes, whatever the strengths.
+     */
+    [[nodiscard]] OperationCost cost(const OperationDescriptor& /*params*/) const override
+    {
+        return OperationCost::spatial(3.0 * k_scales * 2.0 * 5.0, k_halo);
+    }
+
+    /**
+     * @brief True when both strengths are at their minimum (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief Executes the noise reduction on a raw ImageRegion (CPU fallback, same graph).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,162 @@
+/**
+ * @file operation_sharpen.h
+ * @brief Concrete implementation of the Sharpen operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationSharpen
+ * @brief Sharpens an image region (unsharp mask of the luminance).
+ *
+ * The detail is the luminance minus its `GaussianBlur` of sigma `radius`. Small detail, at the
+ * level of the noise, is left out (soft threshold `k_noise_floor`); the rest is amplified and
+ * added to R, G and B alike, so that edges do not gain color fringes.
+ *
+ * Both the amount and the radius are runtime inputs: neither recompiles. The blur reads
+ * `GaussianBlur::haloFor(radius)` pixels around each output pixel, which `haloPixels` reports,
+ * so regions exported separately match a whole-image pass exactly.
+ *
+ * **Algorithm**:
+ * For each pixel of luminance `L` and blurred luminance `B` (sigma `radius`):
+ * \f$ p_c = p_c + \text{value} \cdot k\_detail\_gain \cdot \text{shrink}(L - B, k\_noise\_floor) \f$
+ * Alpha is unchanged.
+ *
+ * **Parameters**:
+ * - `value` (float): The sharpening amount.
+ * - Range: Defined by OperationRanges::getSharpenMinValue() and OperationRanges::getSharpenMaxValue()
+ * - Default: OperationRanges::getSharpenDefaultValue() (typically 0.0f, No change)
+ * - `radius` (float): The sigma of the blur, in pixels.
+ * - Range: Defined by OperationRanges::getSharpenRadiusMinValue() and OperationRanges::getSharpenRadiusMaxValue()
+ * - Default: OperationRanges::getSharpenRadiusDefaultValue() (typically 1.0f)
+ */
+class OperationSharpen : public IOperation, public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Sharpen; }
+    [[nodiscard]] const char* name() const override { return "Sharpen"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed amount.
+     * Defined by OperationRanges::getSharpenMinValue().
+     */
+    static constexpr float MIN_SHARPEN_VALUE = OperationRanges::getSharpenMinValue();
+
+    /**
+     * @brief Maximum allowed amount.
+     * Defined by OperationRanges::getSharpenMaxValue().
+     */
+    static constexpr float MAX_SHARPEN_VALUE = OperationRanges::getSharpenMaxValue();
+
+    /**
+     * @brief Default amount.
+     * Defined by OperationRanges::getSharpenDefaultValue().
+     */
+    static constexpr float DEFAULT_SHARPEN_VALUE = OperationRanges::getSharpenDefaultValue();
+
+    /**
+     * @brief Minimum allowed radius.
+     * Defined by OperationRanges::getSharpenRadiusMinValue().
+     */
+    static constexpr float MIN_SHARPEN_RADIUS = OperationRanges::getSharpenRadiusMinValue();
+
+    /**
+     * @brief Maximum allowed radius.
+     * Defined by OperationRanges::getSharpenRadiusMaxValue().
+     */
+    static constexpr float MAX_SHARPEN_RADIUS = OperationRanges::getSharpenRadiusMaxValue();
+
+    /**
+     * @brief Default radius.
+     * Defined by OperationRanges::getSharpenRadiusDefaultValue().
+     */
+    static constexpr float DEFAULT_SHARPEN_RADIUS = OperationRanges::getSharpenRadiusDefaultValue();
+
+    /**
+     * @brief Gain of the detail at `MAX_SHARPEN_VALUE`.
+     */
+    static constexpr float k_detail_gain = 2.0f;
+
+    /**
+     * @brief Detail amplitude treated as noise and not amplified (linear luminance).
+     */
+    static constexpr float k_noise_floor = 0.002f;
+
+    /**
+     * @brief Applies the sharpening.
+     *
+     * This method provides sequential execution capability for the sharpening operation.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     *
+     * Builds the same graph as the fused path, with the blur stages computed at root.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Should contain "value" (float); "radius" (float) is optional.
+     * @return std::expected<void, ErrorHandling::CoreError>.
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation
+     *                   (edge-clamped by the executor, see `readsNeighborhood`).
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the "value" and "radius" scalars
+     *               (defaults DEFAULT_SHARPEN_VALUE and DEFAULT_SHARPEN_RADIUS) and the blur stages.
+     * @param luminance Shared luminance of the chain (read at the pixel, and tracked).
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief The blur reads up to `haloPixels` pixels away.
+     */
+    [[nodiscard]] bool readsNeighborhood(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Reach of the blur of the descriptor's radius (`GaussianBlur::haloFor`).
+     */
+    [[nodiscard]] Common::ImageDim haloPixels(const OperationDescriptor& params) const override;
+
+    /**
+     * @brief Spatial: the two passes of the luminance blur, their taps bounded by `GaussianBlur`.
+     */
+    [[nodiscard]] OperationCost cost(const OperationDescriptor& params) const override;
+
+    /**
+     * @brief True at a zero amount (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief Executes the sharpening on a raw ImageRegion (CPU fallback, same graph).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,239 @@
+/**
+ * @file edit_history.h
+ * @brief Declaration of EditHistory (undo/redo of the edit stack).
+ *
+ * @details
+ * A history state is stored as the delta from the previous one, not as a copy of the
+ * descriptor list: a slider step records one `ParameterChange` (key, value before, value
+ * after). Deltas apply both ways, so undo and redo are a single delta.
+ *
+ * Every `k_snapshot_interval` states also keep the full list: jumping to any state replays at
+ * most `k_snapshot_interval - 1` deltas from the nearest snapshot (or from the current state
+ * when it is closer), whatever the length of the history.
+ *
+ * Each state can hold the display image rendered for it: stepping through the history shows it
+ * at once instead of running the pipeline. The previews live within a byte budget; the ones
+ * farthest from the current state are evicted first.
+ *
+ * Not thread-safe: the UI owns its history and uses it from its thread.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+#include "operations/operation_descriptor.h"
+#include "operations/parameter_key.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief Change of one parameter of an operation (std::nullopt: the parameter is absent).
+ */
+struct ParameterChange {
+    ParameterKey m_key;
+    std::optional<OperationValue> m_before;
+    std::optional<OperationValue> m_after;
+};
+
+/**
+ * @brief Change of one operation between two consecutive states.
+ */
+struct OperationDelta {
+    enum class Kind : std::uint8_t {
+        Added,      ///< `m_descriptor` inserted at `m_position` of the newer list
+        Removed,    ///< `m_descriptor` erased from `m_position` of the older list
+        Modified    ///< `m_parameters` and/or `m_enabled_toggled` changed in place
+    };
+
+    Kind m_kind { Kind::Modified };
+    std::uint64_t m_id { 0 };
+    std::size_t m_position { 0 };
+
+    /**
+     * @brief Full descriptor of an added or removed operation.
+     */
+    std::optional<OperationDescriptor> m_descriptor;
+
+    std::vector<ParameterChange> m_parameters;
+    bool m_enabled_toggled { false };
+};
+
+/**
+ * @class EditHistory
+ * @brief Undo/redo history of the operations, stored as deltas with periodic snapshots.
+ */
+class EditHistory {
+public:
+    /**
+     * @brief Shared, immutable preview of a state.
+     */
+    using Preview = std::shared_ptr<const Common::DisplayImage>;
+
+    /**
+     * @brief A full copy of the operations is kept every that many states.
+     */
+    static constexpr std::size_t k_snapshot_interval { 16 };
+
+    /**
+     * @brief Oldest states are dropped beyond that many (a snapshot interval at a time).
+     */
+    static constexpr std::size_t k_max_states { 512 };
+
+    /**
+     * @brief Default byte budget of the cached previews.
+     */
+    static constexpr std::size_t k_default_preview_budget { 128 * 1024 * 1024 };
+
+    /**
+     * @brief Starts with one state, without operations.
+     * @param preview_budget Bytes the cached previews may use (0 disables them).
+     */
+    explicit EditHistory(std::size_t preview_budget = k_default_preview_budget);
+
+    /**
+     * @brief Forgets everything: the history restarts at @p operations (e.g. a new image).
+     */
+    void reset(std::vector<OperationDescriptor> operations = {});
+
+    /**
+     * @brief Records @p operations as the state after the current one.
+     *
+     * The states after the current one (the redo branch) are discarded.
+     * @return false (nothing recorded) if @p operations equal the current state.
+     */
+    bool commit(std::vector<OperationDescriptor> operations, std::string label = {});
+
+    /**
+     * @brief Steps one state back.
+     * @return false at the oldest state.
+     */
+    bool undo();
+
+    /**
+     * @brief Steps one state forward.
+     * @return false at the newest state.
+     */
+    bool redo();
+
+    /**
+     * @brief Moves to any state.
+     * @return false if @p index is out of range.
+     */
+    bool jumpTo(std::size_t index);
+
+    /**
+     * @brief Operations of the current state.
+     */
+    [[nodiscard]] const std::vector<OperationDescriptor>& current() const noexcept { return m_current_operations; }
+
+    [[nodiscard]] std::size_t currentIndex() const noexcept { return m_current; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_states.size(); }
+    [[nodiscard]] bool canUndo() const noexcept { return m_current > 0; }
+    [[nodiscard]] bool canRedo() const noexcept { return m_current + 1 < m_states.size(); }
+
+    /**
+     * @brief Label given to a state by `commit()`.
+     */
+    [[nodiscard]] const std::string& label(std::size_t index) const;
+
+    /**
+     * @brief Identifier of the current state, unique for the lifetime of the history.
+     * @details Identifies a state across commits and trims, unlike its index (e.g. for a
+     *          preview rendered asynchronously).
+     */
+    [[nodiscard]] std::uint64_t currentStateId() const noexcept;
+
+    /**
+     * @brief Caches the preview rendered for a state.
+     * @return false if the state is gone (undone and overwritten, trimmed) or the preview
+     *         exceeds the whole budget.
+     */
+    bool storePreview(std::uint64_t state_id, Preview preview);
+
+    /**
+     * @brief Cached preview of the current state, or nullptr.
+     */
+    [[nodiscard]] Preview currentPreview() const noexcept;
+
+    /**
+     * @brief Bytes used by the cached previews.
+     */
+    [[nodiscard]] std::size_t previewBytes() const noexcept { return m_preview_bytes; }
+
+    /**
+     * @brief Delta from @p before to @p after, applicable both ways.
+     */
+    [[nodiscard]] static std::vector<OperationDelta> diff(std::span<const OperationDescriptor> before,
+                                                          std::span<const OperationDescriptor> after);
+
+    /**
+     * @brief Turns the operations of the older state into the newer one.
+     */
+    static void applyForward(std::vector<OperationDescriptor>& operations, std::span<const OperationDelta> delta);
+
+    /**
+     * @brief Turns the operations of the newer state into the older one.
+     */
+    static void applyBackward(std::vector<OperationDescriptor>& operations, std::span<const OperationDelta> delta);
+
+private:
+    struct State {
+        std::uint64_t m_id { 0 };
+        std::string m_label;
+
+        /**
+         * @brief Delta from the previous state (empty for the first one).
+         */
+        std::vector<OperationDelta> m_delta;
+
+        /**
+         * @brief Full operations, every `k_snapshot_interval` states and for the first one.
+         */
+        std::optional<std::vector<OperationDescriptor>> m_snapshot;
+
+        Preview m_preview;
+    };
+
+    /**
+     * @brief Drops the preview of a state and its bytes.
+     */
+    void dropPreview(State& state) noexcept;
+
+    /**
+     * @brief Evicts the previews farthest from the current state until they fit the budget.
+     */
+    void enforcePreviewBudget();
+
+    /**
+     * @brief Drops the oldest states beyond `k_max_states`; the first one left is a snapshot.
+     */
+    void trimOldest();
+
+    [[nodiscard]] static std::size_t previewSize(const Preview& preview) noexcept;
+
+    std::vector<State> m_states;
+    std::size_t m_current { 0 };
+    std::vector<OperationDescriptor> m_current_operations;
+
+    std::uint64_t m_next_state_id { 1 };
+
+    const std::size_t m_preview_budget;
+    std::size_t m_preview_bytes { 0 };
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
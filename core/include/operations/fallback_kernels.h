@@ -0,0 +1,75 @@
+/**
+ * @file fallback_kernels.h
+ * @brief Declaration of FallbackKernels (host kernels of the per-pixel operations, by type).
+ *
+ * @details
+ * The sequential fallback must run where no Halide JIT does. The per-pixel operations are
+ * plain loops over the interleaved region here, mirroring the Halide helpers of
+ * `tone_adjustments.h` (keep both in sync, as `ToneLutStage` does). They are stateless
+ * functions looked up in a constexpr table indexed by `OperationType`: the fallback runs
+ * them without creating an operation, allocating or casting, per operation and per run.
+ *
+ * Operations without an entry (neighborhood, geometry, curves) go through their
+ * `IOperationDefaultLogic`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "operations/operation_type.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+
+#include <expected>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class FallbackKernels
+ * @brief Table of the host kernels, and the kernels themselves.
+ */
+class FallbackKernels {
+public:
+    /**
+     * @brief A host kernel: applies the descriptor to the region, in place.
+     */
+    using Kernel = std::expected<void, ErrorHandling::CoreError> (*)(Common::ImageRegion& region,
+                                                                     const OperationDescriptor& descriptor);
+
+    /**
+     * @brief The kernel of `type`, or nullptr if the operation has none.
+     */
+    [[nodiscard]] static Kernel find(OperationType type) noexcept;
+
+    /**
+     * @brief Per-pixel kernels. Each clamps its value to the operation's range, leaves alpha
+     *        unchanged and fails with `InvalidImageRegion` on a region of fewer than 3 channels.
+     *
+     * @details
+     * Highlights and Shadows weight by the pixel's own luminance in both mask modes: the
+     * edge-aware mode smooths it with a bilateral grid in the fused pipeline only.
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> exposure(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> brightness(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> contrast(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> highlights(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> shadows(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> whites(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> blacks(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> saturation(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+
+    /**
+     * @brief Tetrahedral lookup through the descriptor's .cube file (cached by `CubeLut::load`).
+     * @details No file, or one that fails to load, leaves the region unchanged (as the fused identity lattice does).
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> lut3d(Common::ImageRegion& region, const OperationDescriptor& descriptor);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
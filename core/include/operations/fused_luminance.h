@@ -0,0 +1,80 @@
+/**
+ * @file fused_luminance.h
+ * @brief Declaration of FusedLuminance (luminance shared by the operations of a fused pipeline).
+ *
+ * @details
+ * Highlights, Shadows, Whites and Blacks weight their effect by the luminance of their input.
+ * Evaluated independently, each of them recomputes the dot product over R, G and B, and since
+ * the operation functions are inlined into an output whose channel loop is unrolled, it is
+ * recomputed for every channel as well.
+ *
+ * A fused pipeline owns one `FusedLuminance`. The luminance-dependent operations ask it for the
+ * luminance of their input instead of defining their own:
+ * - the first request after a change of input computes the dot product (`toneLuminance`);
+ * - a masked adjustment adds the same offset to R, G and B, so it hands back the luminance of its
+ *   output as `L + offset` (the weights sum to 1), and the next masked adjustment reuses it.
+ *
+ * Every luminance func is then scheduled once per pixel at the output's innermost loop
+ * (`compute_at`), shared by the four unrolled channels.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class FusedLuminance
+ * @brief Tracks the luminance func of the current image func along a fused chain.
+ */
+class FusedLuminance {
+public:
+    /**
+     * @brief Returns the luminance of `image`, reusing the tracked one if `image` is the tracked func.
+     *
+     * @param image The RGBA function a luminance-dependent operation reads.
+     * @param x The shared x variable of the pipeline.
+     * @param y The shared y variable of the pipeline.
+     * @return A 2D function (x, y).
+     */
+    [[nodiscard]] Halide::Func of(const Halide::Func& image, const Halide::Var& x, const Halide::Var& y);
+
+    /**
+     * @brief Records that `luminance` is the luminance of `image` (typically an operation's output).
+     */
+    void track(const Halide::Func& image, const Halide::Func& luminance);
+
+    /**
+     * @brief Every luminance func handed out or tracked, for scheduling.
+     */
+    [[nodiscard]] const std::vector<Halide::Func>& stages() const noexcept { return m_stages; }
+
+private:
+    /**
+     * @brief The image whose luminance is tracked, if any.
+     */
+    std::optional<Halide::Func> m_image;
+
+    /**
+     * @brief Luminance of `m_image`.
+     */
+    Halide::Func m_luminance;
+
+    /**
+     * @brief Luminance funcs to schedule.
+     */
+    std::vector<Halide::Func> m_stages;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,319 @@
+/**
+ * @file fusion_parameter_block.h
+ * @brief Declaration of FusionParameterBlock (runtime inputs of one fused operation).
+ *
+ * @details
+ * A fused pipeline is compiled once per chain structure; everything a user edits must
+ * therefore be a runtime input of the compiled graph. A single `Halide::Param<float>`
+ * is enough for a slider, not for white balance (temperature + tint), HSL (per-band
+ * values) or curves (a lookup table).
+ *
+ * Each fused operation gets one block. While building the graph it declares what it reads:
+ * - named scalars (`scalar`), bound to `Halide::Param<float>`;
+ * - named lookup tables (`lut`), bound to `Halide::ImageParam` (float tables, or any element
+ *   type, e.g. the 8-bit tiles of a local mask);
+ * - for operations reading neighboring pixels, the intermediate stages (blurs, pyramid levels)
+ *   the executor must compute at root instead of inlining (`addSpatialStages`);
+ * - stages depending on the operation's input only, reused across its parameter edits
+ *   (`cachedStage`).
+ *
+ * The executor then refreshes the block from the descriptor on every edit
+ * (`IOperationFusionLogic::updateFusionParameters`). Setting a Param or an ImageParam
+ * never recompiles, so every parameter kind stays on the fast path.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "operations/parameter_key.h"
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class FusionParameterBlock
+ * @brief Named scalar and lookup-table inputs of one operation in a fused pipeline.
+ *
+ * @details
+ * `Halide::Param` and `Halide::ImageParam` are handles: copies of a block refer to the same
+ * graph inputs. The pipeline cache keeps one copy per compiled pipeline, the executor
+ * another per live operation; setting either updates the compiled graph.
+ */
+class FusionParameterBlock {
+public:
+    /**
+     * @struct LookupTable
+     * @brief A lookup table input and the contents currently bound to it.
+     */
+    struct LookupTable {
+        /**
+         * @brief Graph input (element type and dimensions of the contents given at declaration).
+         */
+        Halide::ImageParam m_param;
+
+        /**
+         * @brief Bound contents; keeps the data alive while the pipeline may read it.
+         */
+        Halide::Buffer<> m_buffer;
+    };
+
+    /**
+     * @struct CachedStage
+     * @brief A stage computed once per input and read back while the input is unchanged.
+     */
+    struct CachedStage {
+        /**
+         * @brief Stage key, unique within the operation.
+         */
+        std::string m_name;
+
+        /**
+         * @brief Input the reusing pipeline reads the stage from (Float(32), full image).
+         */
+        Halide::ImageParam m_param;
+
+        /**
+         * @brief The stage, in the computing pipeline (an extra output); undefined when reused.
+         */
+        Halide::Func m_producer;
+    };
+
+    /**
+     * @brief Name of the scalar read by single-value operations (sliders).
+     */
+    static constexpr std::string_view k_value_key = ParameterKeys::name(ParameterKey::Value);
+
+    /**
+     * @brief Declares (or returns) the scalar input `name`.
+     *
+     * @details
+     * Called from `appendToFusedPipeline`. The first declaration sets `default_value`,
+     * which stays in effect until a descriptor provides the key.
+     *
+     * @param name Parameter name; a `ParameterKey` name binds it to `OperationDescriptor::params`
+     *             (interned once, here).
+     * @param default_value Initial value.
+     * @return The graph input, to be used in the operation's expressions.
+     */
+    [[nodiscard]] const Halide::Param<float>& scalar(std::string_view name, float default_value = 0.0f);
+
+    /**
+     * @brief Declares (or returns) the lookup table input `name`.
+     *
+     * @param name Table key.
+     * @param initial Initial contents (e.g. an identity table). Its element type and dimension
+     *                count are fixed for the compiled pipeline, its extent may change at every update.
+     * @return The graph input, to be sampled in the operation's expressions (see `sampleLinear`).
+     */
+    [[nodiscard]] const Halide::ImageParam& lut(std::string_view name, Halide::Buffer<> initial);
+
+    /**
+     * @brief Sets scalar `name`. Ignored (with a warning) if the operation never declared it.
+     */
+    void setScalar(std::string_view name, float value);
+
+    /**
+     * @brief Binds new contents to table `name`. Ignored (with a warning) if never declared.
+     * @param contents Buffer with the declared element type and dimension count.
+     */
+    void setLut(std::string_view name, Halide::Buffer<> contents);
+
+    /**
+     * @brief Sets every declared scalar whose key the descriptor provides.
+     *
+     * @details
+     * Float, int and bool values are accepted (converted to float); other value types
+     * and missing keys leave the current value. This is the default update of every
+     * operation (see `IOperationFusionLogic::updateFusionParameters`).
+     */
+    void bindScalars(const OperationDescriptor& descriptor);
+
+    /**
+     * @brief Declares stages that read neighboring pixels of the chain (e.g. `GaussianBlur::Result::m_stages`).
+     *
+     * @details
+     * The executor computes them at root over the region the output needs: inlined, each would
+     * be recomputed for every tap of its consumer. The operation must also report
+     * `IOperationFusionLogic::readsNeighborhood`, so that reads past the edges are clamped.
+     */
+    void addSpatialStages(const std::vector<Halide::Func>& stages);
+
+    /**
+     * @brief Stages declared by `addSpatialStages`, in declaration order.
+     */
+    [[nodiscard]] const std::vector<Halide::Func>& spatialStages() const noexcept { return m_spatial_stages; }
+
+    /**
+     * @brief Declares a stage that depends on the operation's input only (e.g. a guided-filter base).
+     *
+     * @details
+     * Expensive stages that no parameter of the operation affects need not be recomputed on every
+     * slider tick. The executor compiles two variants of the chain: one computes the stage and also
+     * writes it to a full-image buffer (an extra output), the other reads that buffer back through
+     * `CachedStage::m_param`. It runs the second while the stage's input is unchanged: same source,
+     * same upstream operations and values (see `setReuseCachedStages`).
+     *
+     * @param name Stage key, unique within the operation.
+     * @param dimensions 2 for a plane (x, y), 3 for an RGBA function (x, y, c).
+     * @param build Builds the stage from the operation's input; called in the computing variant only.
+     * @return The function the rest of the operation reads the stage from.
+     */
+    [[nodiscard]] Halide::Func cachedStage(std::string_view name, int dimensions, const std::function<Halide::Func()>& build);
+
+    /**
+     * @brief Selects the variant `cachedStage` builds: read back (true) or computed (false, default).
+     * @details Set by the executor before `appendToFusedPipeline`.
+     */
+    void setReuseCachedStages(bool reuse) noexcept { m_reuse_cached_stages = reuse; }
+
+    /**
+     * @brief Stages declared by `cachedStage`, in declaration order.
+     */
+    [[nodiscard]] const std::vector<CachedStage>& cachedStages() const noexcept { return m_cached_stages; }
+
+    /**
+     * @brief Names the graph inputs declared from now on `<prefix><name>` (tables `<prefix>lut_<name>`,
+     *        cached stages `<prefix>stage_<name>`) instead of letting Halide number them.
+     * @details Set by the executor before `appendToFusedPipeline`: the names order the arguments of a
+     *          compiled pipeline, which must not depend on the process that built it (see
+     *          `PipelineObjectCache`). The prefix must be unique within the pipeline.
+     */
+    void setNamePrefix(std::string prefix) { m_name_prefix = std::move(prefix); }
+
+    /**
+     * @brief Graph variant the block was built for (see `IOperationFusionLogic::fusionVariant`).
+     * @details Set by the executor before `appendToFusedPipeline`.
+     */
+    void setVariant(std::uint32_t variant) noexcept { m_variant = variant; }
+
+    /**
+     * @brief Graph variant the block was built for.
+     */
+    [[nodiscard]] std::uint32_t variant() const noexcept { return m_variant; }
+
+    /**
+     * @brief Sets the extent, in pixels, of the chain input (the whole image, from the origin).
+     * @details Set by the executor before `appendToFusedPipeline`. Read by the operations defined
+     *          relative to the image frame (e.g. the lens correction, centered on the image): the
+     *          realized region may be a part of the image only.
+     */
+    void setImageExtent(Halide::Expr width, Halide::Expr height)
+    {
+        m_image_width = std::move(width);
+        m_image_height = std::move(height);
+    }
+
+    /**
+     * @brief Width of the chain input (undefined until set).
+     */
+    [[nodiscard]] const Halide::Expr& imageWidth() const noexcept { return m_image_width; }
+
+    /**
+     * @brief Height of the chain input (undefined until set).
+     */
+    [[nodiscard]] const Halide::Expr& imageHeight() const noexcept { return m_image_height; }
+
+    /**
+     * @brief Number of declared scalars.
+     */
+    [[nodiscard]] std::size_t scalarCount() const noexcept { return m_scalars.size(); }
+
+    /**
+     * @brief Number of declared lookup tables.
+     */
+    [[nodiscard]] std::size_t lutCount() const noexcept { return m_luts.size(); }
+
+    /**
+     * @brief Samples a 1D table with linear interpolation, `u` in [0, 1] mapped across its extent.
+     *
+     * @details Out-of-range coordinates are clamped to the end entries.
+     */
+    [[nodiscard]] static Halide::Expr sampleLinear(const Halide::ImageParam& table, const Halide::Expr& u);
+
+private:
+    /**
+     * @struct ScalarInput
+     * @brief A declared scalar and the descriptor key it is bound to.
+     */
+    struct ScalarInput {
+        /**
+         * @brief Graph input.
+         */
+        Halide::Param<float> m_param;
+
+        /**
+         * @brief Interned key of the name, `std::nullopt` if set by the operation only.
+         */
+        std::optional<ParameterKey> m_key;
+    };
+
+    /**
+     * @brief Returns the name of the graph input `<prefix><kind><name>` (letters, digits and
+     *        underscores only), or empty without a prefix.
+     */
+    [[nodiscard]] std::string inputName(std::string_view kind, std::string_view name) const;
+
+    /**
+     * @brief Prefix of the input names, empty for names generated by Halide.
+     */
+    std::string m_name_prefix;
+
+    /**
+     * @brief Declared scalars, in declaration order (a handful per operation: linear search).
+     */
+    std::vector<std::pair<std::string, ScalarInput>> m_scalars;
+
+    /**
+     * @brief Declared lookup tables, in declaration order.
+     */
+    std::vector<std::pair<std::string, LookupTable>> m_luts;
+
+    /**
+     * @brief Stages reading neighboring pixels, to compute at root.
+     */
+    std::vector<Halide::Func> m_spatial_stages;
+
+    /**
+     * @brief Stages reused across parameter edits, in declaration order.
+     */
+    std::vector<CachedStage> m_cached_stages;
+
+    /**
+     * @brief Variant built by `cachedStage`.
+     */
+    bool m_reuse_cached_stages{false};
+
+    /**
+     * @brief Structural variant of the operation's graph.
+     */
+    std::uint32_t m_variant{0};
+
+    /**
+     * @brief Width of the chain input.
+     */
+    Halide::Expr m_image_width;
+
+    /**
+     * @brief Height of the chain input.
+     */
+    Halide::Expr m_image_height;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
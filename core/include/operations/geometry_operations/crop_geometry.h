@@ -0,0 +1,118 @@
+/**
+ * @file crop_geometry.h
+ * @brief Declaration of CropGeometry (crop rectangle and straighten angle of a chain).
+ *
+ * @details
+ * The Crop operation produces no cropped image. The working image keeps the source frame and
+ * the crop is a coordinate transform of the fused pipeline:
+ * - the rectangle bounds the realization (`region`): the pixels outside are never computed,
+ *   and the display output and the exports read the rectangle only;
+ * - the straighten angle is an affine map of the output coordinates to the source ones
+ *   (`sampling`), applied by the first Func of the chain (`Pipeline::GeometryStage`).
+ *
+ * The edges are normalized to the image size, so one descriptor serves the proxy, the
+ * full-resolution image and the thumbnails. Editing the crop rebinds a few scalars: no
+ * decode, no copy, and no recompilation unless the rotation is switched on or off.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "common/types/region_of_interest.h"
+#include "common/image_region.h"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class CropGeometry
+ * @brief Crop rectangle (normalized edges) and straighten angle (degrees) of a Crop descriptor.
+ */
+class CropGeometry {
+public:
+    /**
+     * @brief Left edge, in [0, 1] of the width.
+     */
+    float m_left{0.0f};
+
+    /**
+     * @brief Top edge, in [0, 1] of the height.
+     */
+    float m_top{0.0f};
+
+    /**
+     * @brief Right edge, in [0, 1] of the width (greater than `m_left`).
+     */
+    float m_right{1.0f};
+
+    /**
+     * @brief Bottom edge, in [0, 1] of the height (greater than `m_top`).
+     */
+    float m_bottom{1.0f};
+
+    /**
+     * @brief Straighten angle, in degrees (positive is counterclockwise).
+     */
+    float m_angle{0.0f};
+
+    [[nodiscard]] bool operator==(const CropGeometry&) const = default;
+
+    /**
+     * @brief Reads the geometry of a Crop descriptor.
+     * @details Edges are clamped to [0, 1] and put in order, the angle to its range;
+     *          missing or non-finite values keep their default.
+     */
+    [[nodiscard]] static CropGeometry fromDescriptor(const OperationDescriptor& descriptor);
+
+    /**
+     * @brief Geometry of a chain: its first enabled Crop descriptor.
+     * @return The geometry, or `std::nullopt` if the chain does not crop.
+     */
+    [[nodiscard]] static std::optional<CropGeometry> of(std::span<const OperationDescriptor> operations);
+
+    /**
+     * @brief Moves the first Crop descriptor of a chain to its front.
+     * @details The crop is applied to the chain input: the operations reading their neighborhood
+     *          (and their cached stages) must see it upstream, in the descriptor order too.
+     */
+    static void moveToFront(std::vector<OperationDescriptor>& operations);
+
+    /**
+     * @brief Whether the rectangle is straightened (the input is resampled).
+     */
+    [[nodiscard]] bool isRotated() const noexcept;
+
+    /**
+     * @brief Rectangle of an image of the given size, in pixels (at least one pixel).
+     */
+    [[nodiscard]] Common::RegionOfInterest region(Common::ImageDim width, Common::ImageDim height) const noexcept;
+
+    /**
+     * @brief Affine map from output pixels to the source position they sample.
+     * @details The rectangle turns about its center. For an output pixel (x, y), the source
+     *          position, in pixel indices, is `(a[0] x + a[1] y + a[2], a[3] x + a[4] y + a[5])`.
+     *          Unrotated geometries map every pixel to itself.
+     * @return The six coefficients, row-major.
+     */
+    [[nodiscard]] std::array<float, 6> sampling(Common::ImageDim width, Common::ImageDim height) const noexcept;
+
+    /**
+     * @brief Copies the rectangle out of a processed image.
+     * @return The cropped image (its origin is the rectangle's), or `nullptr` if `image` is invalid.
+     */
+    [[nodiscard]] std::unique_ptr<Common::ImageRegion> extractFrom(const Common::ImageRegion& image) const;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
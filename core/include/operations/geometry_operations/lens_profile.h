@@ -0,0 +1,137 @@
+/**
+ * @file lens_profile.h
+ * @brief Declaration of LensProfile (distortion, vignetting and lateral CA of a lens setting).
+ *
+ * @details
+ * A lens profile holds the models of lensfun for one lens at one focal length and aperture
+ * (the database lookup and the interpolation between calibrations are done by the caller):
+ * - distortion, `ptlens`: \f$ r_d = r_u (a r_u^3 + b r_u^2 + c r_u + 1 - a - b - c) \f$;
+ * - lateral chromatic aberration, `linear`: the red and blue radii are scaled by `vr` and `vb`;
+ * - vignetting, `pa`: the source was darkened by \f$ 1 + k_1 r^2 + k_2 r^4 + k_3 r^6 \f$.
+ *
+ * Radii are normalized to the half diagonal of the image (1 at the corners), so one profile
+ * serves every size and aspect ratio of the same frame (proxy, full resolution, thumbnails).
+ *
+ * All three corrections are radial. Instead of evaluating the polynomials per pixel, a profile
+ * is sampled once into a small radial table (`table`): per radius, the source radius scale of
+ * R, G and B and the vignetting gain. The table is cached by profile, so a lens setting is
+ * sampled once per session, and the correction costs one table lookup and one gather per pixel.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+
+#include "Halide.h"
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class LensProfile
+ * @brief Lens correction models of one lens setting, and their radial table.
+ */
+class LensProfile {
+public:
+    /**
+     * @brief Stored values per table entry: the radius scales of R, G and B, then the gain.
+     */
+    static constexpr int k_entry_channels = 4;
+
+    /**
+     * @brief Entry of the vignetting gain.
+     */
+    static constexpr int k_gain_entry = 3;
+
+    /**
+     * @brief Entries of a table, from the center (radius 0) to the corners (radius 1).
+     */
+    static constexpr int k_table_size = 256;
+
+    /**
+     * @brief Distortion coefficients a, b and c of the `ptlens` model.
+     */
+    std::array<float, 3> m_distortion{0.0f, 0.0f, 0.0f};
+
+    /**
+     * @brief Vignetting coefficients k1, k2 and k3 of the `pa` model.
+     */
+    std::array<float, 3> m_vignetting{0.0f, 0.0f, 0.0f};
+
+    /**
+     * @brief Radius scales of red and blue (`linear` chromatic aberration model).
+     */
+    std::array<float, 2> m_chromatic{1.0f, 1.0f};
+
+    [[nodiscard]] bool operator==(const LensProfile&) const = default;
+
+    /**
+     * @brief Parses a profile written by `format`: "a,b,c;k1,k2,k3;vr,vb".
+     * @return The profile, or `std::nullopt` if the text is malformed.
+     */
+    [[nodiscard]] static std::optional<LensProfile> parse(std::string_view text);
+
+    /**
+     * @brief Writes the profile in the format `parse` reads.
+     */
+    [[nodiscard]] std::string format() const;
+
+    /**
+     * @brief Whether the profile corrects nothing.
+     */
+    [[nodiscard]] bool isIdentity() const noexcept;
+
+    /**
+     * @brief Samples the profile into a (entry, radius) table of `k_table_size` radii.
+     */
+    [[nodiscard]] Halide::Buffer<float> sample() const;
+
+    /**
+     * @brief The table of a profile, sampled on the first request and cached.
+     * @details Thread-safe. Every pipeline correcting the same lens setting binds the same buffer.
+     */
+    [[nodiscard]] static Halide::Buffer<float> table(const LensProfile& profile);
+
+    /**
+     * @brief Drops every cached table.
+     */
+    static void clearCache();
+
+    /**
+     * @brief The table correcting nothing (two radii).
+     */
+    [[nodiscard]] static Halide::Buffer<float> identity();
+
+    /**
+     * @brief Linear lookup of entry `entry` at the normalized radius `radius` (clamped to [0, 1]).
+     */
+    [[nodiscard]] static Halide::Expr sampleRadial(const Halide::ImageParam& table,
+                                                   const Halide::Expr& radius,
+                                                   const Halide::Expr& entry);
+
+    /**
+     * @brief Linear lookup of the entries at `radius`, on the host (sequential and fallback paths).
+     */
+    [[nodiscard]] static std::array<float, k_entry_channels> lookup(const Halide::Buffer<float>& table, float radius);
+
+    /**
+     * @brief Moves the first LensCorrection descriptor of a chain to its front.
+     * @details The corrections are defined on the sensor frame: the operations reading their
+     *          neighborhood, and the straightening of the crop, must see the corrected image.
+     */
+    static void moveToFront(std::vector<OperationDescriptor>& operations);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
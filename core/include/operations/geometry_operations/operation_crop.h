@@ -0,0 +1,85 @@
+/**
+ * @file operation_crop.h
+ * @brief Concrete implementation of the Crop (and straighten) operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationCrop
+ * @brief Restricts an image to a rectangle, optionally straightened about its center.
+ *
+ * The operation has no fused logic: the fused executor applies the geometry itself
+ * (see `CropGeometry`), as the realization bounds and, when straightened, the input sampling
+ * of the first Func of the chain (`Pipeline::GeometryStage`). No cropped image is made.
+ * The sequential and fallback paths resample the rectangle in place, leaving the frame
+ * around it; the exports then copy the rectangle out.
+ *
+ * **Algorithm**:
+ * For each pixel `p` of the rectangle, with `c` its center and `R` the rotation by the angle:
+ * \f$ p' = \text{bilinear}(I, R (p - c) + c) \f$ (edge pixels repeated).
+ *
+ * **Parameters**:
+ * - `crop_left`, `crop_top`, `crop_right`, `crop_bottom` (float): Edges, normalized to the image size.
+ *   Range: OperationRanges::getCropEdgeMinValue() to OperationRanges::getCropEdgeMaxValue(); default: the full image.
+ * - `angle` (float): Straighten angle in degrees, positive counterclockwise.
+ *   Range: OperationRanges::getStraightenAngleMinValue() to OperationRanges::getStraightenAngleMaxValue();
+ *   default OperationRanges::getStraightenAngleDefaultValue().
+ */
+class OperationCrop : public IOperation, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::Crop; }
+    [[nodiscard]] const char* name() const override { return "Crop"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed straighten angle.
+     * Defined by OperationRanges::getStraightenAngleMinValue().
+     */
+    static constexpr float MIN_ANGLE_VALUE = OperationRanges::getStraightenAngleMinValue();
+
+    /**
+     * @brief Maximum allowed straighten angle.
+     * Defined by OperationRanges::getStraightenAngleMaxValue().
+     */
+    static constexpr float MAX_ANGLE_VALUE = OperationRanges::getStraightenAngleMaxValue();
+
+    /**
+     * @brief Default straighten angle.
+     * Defined by OperationRanges::getStraightenAngleDefaultValue().
+     */
+    static constexpr float DEFAULT_ANGLE_VALUE = OperationRanges::getStraightenAngleDefaultValue();
+
+    /**
+     * @brief Straightens the crop rectangle of the working image (sequential execution).
+     *
+     * The fused pipeline applies the crop without this pass; it remains available for the
+     * sequential pipeline, debugging and testing. Unrotated crops leave the pixels unchanged.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params May contain the four edges and "angle" (float).
+     * @return std::expected<void, ErrorHandling::CoreError>
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Executes the operation on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
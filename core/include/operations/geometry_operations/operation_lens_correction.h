@@ -0,0 +1,144 @@
+/**
+ * @file operation_lens_correction.h
+ * @brief Concrete implementation of the Lens Correction operation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/operation_ranges.h"
+
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+/**
+ * @class OperationLensCorrection
+ * @brief Corrects the distortion, vignetting and lateral chromatic aberration of a lens.
+ *
+ * The lens models (`LensProfile`) are sampled once per lens setting into a radial table, bound
+ * to the fused pipeline as a lookup table input: per pixel, one lookup gives the source radius
+ * of each channel and the vignetting gain, and one bilinear gather per channel resamples the
+ * image. Changing the amount or the lens never recompiles. The executor moves the operation to
+ * the front of the chain (see `LensProfile::moveToFront`): the models describe the sensor frame.
+ *
+ * **Algorithm**:
+ * For each pixel `p` at the normalized radius `r` from the image center `o`, and channel `c`:
+ * \f$ p_c = \text{gain}(r) \cdot \text{bilinear}(I_c, o + \text{scale}_c(r) (p - o)) \f$
+ * (scale and gain blended towards 1 by the amount; alpha follows green and is not scaled).
+ *
+ * **Parameters**:
+ * - `lens_profile` (string): The lens models, "a,b,c;k1,k2,k3;vr,vb". Unset or malformed: no change.
+ * - `value` (float): The amount the corrections are applied with.
+ * - Range: Defined by OperationRanges::getLensCorrectionMinValue() and OperationRanges::getLensCorrectionMaxValue()
+ * - Default: OperationRanges::getLensCorrectionDefaultValue() (typically 1.0f, fully corrected)
+ */
+class OperationLensCorrection : public IOperation, public IOperationFusionLogic, public IOperationDefaultLogic
+{
+public:
+    // --- Metadata ---
+    [[nodiscard]] OperationType type() const override { return OperationType::LensCorrection; }
+    [[nodiscard]] const char* name() const override { return "LensCorrection"; }
+
+    // --- Range Access (via the centralized ranges) ---
+    /**
+     * @brief Minimum allowed amount.
+     * Defined by OperationRanges::getLensCorrectionMinValue().
+     */
+    static constexpr float MIN_LENS_CORRECTION_VALUE = OperationRanges::getLensCorrectionMinValue();
+
+    /**
+     * @brief Maximum allowed amount.
+     * Defined by OperationRanges::getLensCorrectionMaxValue().
+     */
+    static constexpr float MAX_LENS_CORRECTION_VALUE = OperationRanges::getLensCorrectionMaxValue();
+
+    /**
+     * @brief Default amount.
+     * Defined by OperationRanges::getLensCorrectionDefaultValue().
+     */
+    static constexpr float DEFAULT_LENS_CORRECTION_VALUE = OperationRanges::getLensCorrectionDefaultValue();
+
+    /**
+     * @brief Key of the radial table in the parameter block.
+     */
+    static constexpr std::string_view k_table_key = "lens_table";
+
+    /**
+     * @brief Applies the lens corrections.
+     *
+     * This method provides sequential execution capability for the lens correction.
+     * While primarily replaced by the fused pipeline system (appendToFusedPipeline), it remains
+     * available for specific use cases such as debugging, testing, or standalone operation execution.
+     * @param working_image The hardware-agnostic image buffer to modify.
+     * @param params Should contain "lens_profile" (string); "value" (float) is optional.
+     * @return std::expected<void, ErrorHandling::CoreError>
+     */
+    [[maybe_unused]] [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware& working_image, const OperationDescriptor& params) override;
+
+    /**
+     * @brief Appends this operation's logic to a fused Halide pipeline.
+     * @param input_func The Halide function representing the input to this operation
+     *                   (edge-clamped by the executor, see `readsNeighborhood`).
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @param params Parameter block of this operation; declares the "value" scalar
+     *               (defaults to DEFAULT_LENS_CORRECTION_VALUE) and the radial table (identity
+     *               until bound). Reads the image extent (`FusionParameterBlock::imageWidth`).
+     * @param luminance Shared luminance of the chain. Not read; the output is not tracked.
+     * @return A new Halide::Func representing the output of this operation.
+     */
+    [[nodiscard]] Halide::Func appendToFusedPipeline(
+        const Halide::Func& input_func,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
+        ) const override;
+
+    /**
+     * @brief Binds the amount and the (cached) table of "lens_profile" (no recompilation).
+     */
+    void updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const override;
+
+    /**
+     * @brief The gather reads away from the pixel (up to the distortion of the corners).
+     */
+    [[nodiscard]] bool readsNeighborhood(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief Kept by the executor: editing the operations after it does not redo the resampling.
+     */
+    [[nodiscard]] bool memoizesOutput(std::uint32_t /*variant*/) const override { return true; }
+
+    /**
+     * @brief True without a profile to correct or at a zero amount (left out of the fused chain).
+     */
+    [[nodiscard]] bool isIdentity(const OperationDescriptor& descriptor) const override;
+
+    /**
+     * @brief Spatial: one bilinear gather (four reads) per channel.
+     */
+    [[nodiscard]] OperationCost cost(const OperationDescriptor& params) const override
+    {
+        return OperationCost::spatial(3.0 * 4.0, haloPixels(params));
+    }
+
+    /**
+     * @brief Executes the correction on a raw ImageRegion (CPU fallback).
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> executeOnImageRegion(
+        Common::ImageRegion& region,
+        const OperationDescriptor& params
+        ) const override;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
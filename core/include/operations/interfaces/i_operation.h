@@ -9,7 +9,9 @@
 
 #include "operations/operation_type.h"
 #include "operations/operation_descriptor.h"
+#include "operations/operation_cost.h"
 #include "image_processing/interfaces/i_working_image_hardware.h"
+#include "common/types/image_types.h"
 #include <expected>
 #include "common/error_handling/core_error.h"
 
@@ -78,6 +80,29 @@ public:
      * @return true by default.
      */
     [[nodiscard]] virtual bool isThreadSafe() const { return true; }
+
+    /**
+     * @brief Radius of the neighbourhood read around each output pixel.
+     * @details 0 for per-pixel operations. Region-based processing (strip export) reads
+     *          this many extra rows on each side of a region, so that its border matches
+     *          a whole-image pass.
+     * @return The radius in pixels for these settings.
+     */
+    [[nodiscard]] virtual Common::ImageDim haloPixels(const OperationDescriptor& /*params*/) const { return 0; }
+
+    /**
+     * @brief Estimated cost of one output pixel, per backend (nominal: see `OperationCost`).
+     * @details A per-pixel adjustment by default, spatial if `haloPixels` is not 0. Operations
+     *          reading more than their pixel (blurs, lookups, resampling) report their reads.
+     * @return The cost for these settings.
+     */
+    [[nodiscard]] virtual OperationCost cost(const OperationDescriptor& params) const
+    {
+        OperationCost cost { OperationCost::perPixel() };
+        cost.m_halo_pixels = haloPixels(params);
+        cost.m_spatial = cost.m_halo_pixels > 0;
+        return cost;
+    }
 };
 
 } // namespace Operations
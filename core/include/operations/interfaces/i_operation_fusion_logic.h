@@ -7,8 +7,16 @@
 
 #pragma once
 
+#include "operations/fusion_parameter_block.h"
+#include "operations/fused_luminance.h"
+#include "operations/operation_descriptor.h"
+
 #include "Halide.h"
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 namespace CaptureMoment::Core {
 
 namespace Operations {
@@ -44,8 +52,14 @@ public:
      *          in the fused pipeline to ensure coordinate consistency.
      * @param c The Halide variable for the channel dimension, shared across all operations
      *          in the fused pipeline to ensure coordinate consistency.
-     * @param param A Halide parameter that can be used to pass operation-specific parameters
-     * 
+     * @param params The operation's parameter block. The operation declares there every
+     *               runtime input it reads (`scalar`, `lut`) and uses the returned handles
+     *               in its expressions; values never get baked into the graph. Its `variant()`
+     *               is the operation's `fusionVariant` for the descriptor being fused.
+     * @param luminance Luminance shared along the fused chain. Luminance-dependent operations
+     *                  read it (`of`) and track the luminance of their output (`track`);
+     *                  the others ignore it.
+     *
      * @return A new Halide::Func representing the output of this operation,
      *         which can be used as input for the next operation in the fused pipeline.
      *         The returned function encapsulates the operation's logic,
@@ -56,8 +70,109 @@ public:
         const Halide::Var& x,
         const Halide::Var& y,
         const Halide::Var& c,
-        const Halide::Param<float>& param
+        FusionParameterBlock& params,
+        FusedLuminance& luminance
     ) const = 0;
+
+    /**
+     * @brief Structural option of the descriptor: selects between graphs a parameter update cannot switch.
+     * @details
+     * E.g. the mask mode of Highlights and Shadows. The executor passes it to the parameter block
+     * (`FusionParameterBlock::variant`) before `appendToFusedPipeline` and adds it to the compiled
+     * pipeline's cache key; a descriptor whose variant changed rebuilds the chain instead of
+     * updating the parameters. 0 (the default) is the operation's only or default graph.
+     */
+    [[nodiscard]] virtual std::uint32_t fusionVariant(const OperationDescriptor& /*descriptor*/) const { return 0; }
+
+    /**
+     * @brief Whether the operation reads pixels around the one it computes (blurs, local contrast).
+     * @details
+     * The executor then clamps the chain input to the image edges, so that kernels reaching
+     * past the borders read the edge pixels. Such operations declare their intermediate
+     * stages with `FusionParameterBlock::addSpatialStages`.
+     * @param variant The `fusionVariant` the operation is fused with.
+     */
+    [[nodiscard]] virtual bool readsNeighborhood(std::uint32_t /*variant*/) const { return false; }
+
+    /**
+     * @brief Whether the operation costs enough for its output to be kept (denoise, lens correction).
+     * @details
+     * The executor then writes the operation's output to a full-image buffer, an extra output of
+     * the pipeline. While the input and the operations up to this one are unchanged, it runs a
+     * variant of the chain that starts from that buffer: editing a parameter further down the
+     * chain does not recompute the operation.
+     * @param variant The `fusionVariant` the operation is fused with.
+     */
+    [[nodiscard]] virtual bool memoizesOutput(std::uint32_t /*variant*/) const { return false; }
+
+    /**
+     * @brief Whether the preview of a gesture on the operation may compute it at reduced resolution.
+     * @details
+     * While its control is dragged, the executor then runs the operation on a reduced copy of its
+     * input and transfers the effect to the full-resolution pixels (`GuidedUpsampling`). Suits
+     * expensive operations whose effect is smooth at the scale of a few pixels (tonal or color
+     * changes, coarse smoothing), not those whose effect is the finest detail (sharpening).
+     * Operations declaring cached stages keep the default: their per-tick cost is already low.
+     * @param variant The `fusionVariant` the operation is fused with.
+     */
+    [[nodiscard]] virtual bool upsamplesPreview(std::uint32_t /*variant*/) const { return false; }
+
+    /**
+     * @brief Whether the descriptor leaves every pixel unchanged (e.g. a slider at its neutral value).
+     * @details
+     * The executor leaves such operations out of the fused chain: the compiled pipeline neither
+     * computes them nor depends on them. When unsure, an operation answers false.
+     * @param descriptor The operation's current settings.
+     */
+    [[nodiscard]] virtual bool isIdentity(const OperationDescriptor& /*descriptor*/) const { return false; }
+
+    /**
+     * @brief Runtime condition under which the operation leaves every pixel unchanged, or an undefined Expr.
+     * @details
+     * Called after `appendToFusedPipeline`, with the same block: the condition reads the declared
+     * scalars (e.g. `value == 0`). The executor specializes the fused pipeline on it, so that a
+     * slider set back to neutral runs a kernel without the operation, without recompiling.
+     * Operations with root stages (blurs, cached stages) keep the default: those stages would be
+     * computed in every branch.
+     * @param params The block filled by `appendToFusedPipeline`.
+     */
+    [[nodiscard]] virtual Halide::Expr identityCondition(FusionParameterBlock& /*params*/) const { return Halide::Expr(); }
+
+    /**
+     * @brief Refreshes the parameter block from the descriptor, without recompiling.
+     * @details
+     * Called once after the graph is built (initial values) and on every parameter edit.
+     * The default sets each declared scalar from the descriptor parameter of the same
+     * name. Operations with derived inputs (e.g. a lookup table computed from curve
+     * points) override this and call `setScalar` / `setLut` themselves.
+     * @param descriptor The operation's current settings.
+     * @param params The block filled by `appendToFusedPipeline`.
+     */
+    virtual void updateFusionParameters(
+        const OperationDescriptor& descriptor,
+        FusionParameterBlock& params
+    ) const
+    {
+        params.bindScalars(descriptor);
+    }
+
+protected:
+    /**
+     * @brief True if the descriptor's `ParameterKey::Value` is absent or equal to `neutral`.
+     */
+    [[nodiscard]] static bool hasNeutralValue(const OperationDescriptor& descriptor, float neutral)
+    {
+        const float value = descriptor.getParam<float>(ParameterKey::Value).value_or(neutral);
+        return std::abs(value - neutral) < std::numeric_limits<float>::epsilon();
+    }
+
+    /**
+     * @brief Runtime counterpart of `hasNeutralValue`: true while the "value" scalar equals `neutral`.
+     */
+    [[nodiscard]] static Halide::Expr neutralValueCondition(FusionParameterBlock& params, float neutral)
+    {
+        return params.scalar(FusionParameterBlock::k_value_key, neutral) == neutral;
+    }
 };
 
 } // namespace Operations
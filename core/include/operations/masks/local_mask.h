@@ -0,0 +1,224 @@
+/**
+ * @file local_mask.h
+ * @brief Declaration of LocalMask (a painted local adjustment mask and its preview pyramid).
+ *
+ * @details
+ * A local adjustment applies an operation to part of the image only: the mask holds, for each
+ * pixel, how much of the operation's result replaces its input (see `MaskSampler`).
+ *
+ * The mask is stored at full resolution and at every coarser power of two, each level a sparse
+ * `MaskTiles`. A preview of the fit-to-window proxy samples the level closest to its own size
+ * instead of reading (and keeping resident) the full-resolution tiles.
+ *
+ * A brush stroke is a list of dabs (`paint`). It changes only the tiles the dabs touch, at the
+ * full resolution, then only their parents at the coarser levels, and reports the region that
+ * changed so that the caller re-renders that part of the view only.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/masks/mask_tiles.h"
+#include "common/types/region_of_interest.h"
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @struct BrushDab
+ * @brief One stamp of the brush, in full-resolution image coordinates.
+ */
+struct BrushDab {
+    /**
+     * @brief Center, in pixels.
+     */
+    float m_x{0.0f};
+
+    /**
+     * @brief Center, in pixels.
+     */
+    float m_y{0.0f};
+
+    /**
+     * @brief Outer radius, in pixels: no coverage is added past it.
+     */
+    float m_radius{1.0f};
+
+    /**
+     * @brief Fraction of the radius painted at full flow, in [0, 1]; the rest fades out smoothly.
+     */
+    float m_hardness{0.5f};
+
+    /**
+     * @brief Coverage added at the center, in [0, 1].
+     */
+    float m_flow{1.0f};
+
+    /**
+     * @brief Removes coverage instead of adding it.
+     */
+    bool m_erase{false};
+};
+
+/**
+ * @class LocalMask
+ * @brief Sparse, tiled, multi-resolution coverage of one local adjustment.
+ *
+ * @details Thread-safe: strokes, reads and atlas builds are serialized by an internal mutex.
+ */
+class LocalMask {
+public:
+    /**
+     * @struct Atlas
+     * @brief One level of the mask packed for a pipeline (see `MaskSampler`).
+     *
+     * @details
+     * `m_table(tx, ty)` is the slot of tile (tx, ty) in `m_tiles`, 0 for an empty tile; slot 0 is
+     * a tile of zeros. `m_tiles(x, y, slot)` is the coverage (0..255) of pixel (x, y) of a tile.
+     * Only the allocated tiles are packed. Both buffers are fresh after every change and never
+     * written once built, so a pipeline may read them while the mask is painted.
+     */
+    struct Atlas {
+        /**
+         * @brief Slot of each tile (tilesX x tilesY).
+         */
+        Halide::Buffer<std::int32_t> m_table;
+
+        /**
+         * @brief Packed tiles (k_tile_size x k_tile_size x slots).
+         */
+        Halide::Buffer<std::uint8_t> m_tiles;
+
+        /**
+         * @brief Width of the level, in pixels.
+         */
+        Common::ImageDim m_width{0};
+
+        /**
+         * @brief Height of the level, in pixels.
+         */
+        Common::ImageDim m_height{0};
+    };
+
+    /**
+     * @brief An empty mask over a `width` x `height` image.
+     */
+    LocalMask(Common::ImageDim width, Common::ImageDim height);
+
+    [[nodiscard]] Common::ImageDim width() const noexcept { return m_width; }
+    [[nodiscard]] Common::ImageDim height() const noexcept { return m_height; }
+
+    /**
+     * @brief Applies the dabs of a stroke, in order.
+     *
+     * @details
+     * Painting composites each dab over the coverage (`a + w * (1 - a)`), erasing scales it down
+     * (`a * (1 - w)`), `w` being the dab's flow faded by its hardness profile. Tiles erased to zero
+     * are released. The coarser levels are re-averaged under the touched tiles only.
+     *
+     * @return The changed region, in full-resolution pixels (empty if no dab reached the image).
+     */
+    [[nodiscard]] Common::RegionOfInterest paint(std::span<const BrushDab> dabs);
+
+    /**
+     * @brief Erases the whole mask (releases every tile).
+     */
+    void clear();
+
+    /**
+     * @brief Incremented by every change; folded into the result cache keys.
+     */
+    [[nodiscard]] std::uint64_t version() const;
+
+    /**
+     * @brief Number of pyramid levels (level 0 is the full resolution).
+     */
+    [[nodiscard]] std::size_t levelCount() const noexcept { return m_level_count; }
+
+    /**
+     * @brief Coarsest level still at least `width` pixels wide (0 if none is).
+     */
+    [[nodiscard]] std::size_t levelFor(Common::ImageDim width) const noexcept;
+
+    /**
+     * @brief Snapshot of a level (copy-on-write: shares the tiles).
+     * @pre `level < levelCount()`.
+     */
+    [[nodiscard]] MaskTiles level(std::size_t level) const;
+
+    /**
+     * @brief Coverage, in [0, 1], of a full-resolution pixel.
+     */
+    [[nodiscard]] float coverage(Common::ImageCoord x, Common::ImageCoord y) const;
+
+    /**
+     * @brief A level packed for a pipeline; built on first use after each change.
+     * @pre `level < levelCount()`.
+     */
+    [[nodiscard]] Atlas atlas(std::size_t level) const;
+
+    /**
+     * @brief An atlas with no tile (1x1 table of slot 0), bound while no mask is available.
+     */
+    [[nodiscard]] static Atlas emptyAtlas();
+
+    /**
+     * @brief Bytes of the allocated tiles, all levels.
+     */
+    [[nodiscard]] std::size_t bytes() const;
+
+private:
+    /**
+     * @brief Re-averages tile (tx, ty) of `level` from the 2x2 pixels below it at `level - 1`.
+     */
+    void downsampleTile(std::size_t level, int tx, int ty);
+
+    /**
+     * @brief Packs a level.
+     */
+    [[nodiscard]] static Atlas buildAtlas(const MaskTiles& tiles);
+
+    Common::ImageDim m_width{0};
+    Common::ImageDim m_height{0};
+
+    /**
+     * @brief Number of levels; the last one fits in a single tile.
+     */
+    std::size_t m_level_count{1};
+
+    /**
+     * @brief Serializes strokes, reads and atlas builds.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Coverage per level, level 0 at full resolution.
+     */
+    std::vector<MaskTiles> m_levels;
+
+    /**
+     * @brief Packed levels, reset by every change.
+     */
+    mutable std::vector<std::optional<Atlas>> m_atlases;
+
+    /**
+     * @brief Change counter.
+     */
+    std::uint64_t m_version{0};
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
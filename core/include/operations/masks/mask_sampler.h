@@ -0,0 +1,83 @@
+/**
+ * @file mask_sampler.h
+ * @brief Declaration of MaskSampler (restricts an operation of a pipeline to its local mask).
+ *
+ * @details
+ * A masked operation is fused like any other; its output is then blended with its input by the
+ * coverage of its mask: `out = in + coverage * (op(in) - in)` on R, G and B, alpha as the
+ * operation leaves it.
+ *
+ * The coverage is read from the mask's `LocalMask::Atlas`, bound as two lookup tables of the
+ * operation's `FusionParameterBlock` (the tile table and the packed 8-bit tiles) and two scalars
+ * (the size of the sampled level). Only the painted tiles are uploaded, a stroke rebinds new
+ * tables without recompiling, and a preview binds the pyramid level closest to its own size.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/fusion_parameter_block.h"
+#include "operations/masks/local_mask.h"
+#include "operations/operation_descriptor.h"
+#include "common/image_region.h"
+
+#include "Halide.h"
+
+#include <span>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class MaskSampler
+ * @brief Graph side (`append`, `bind`) and host side (`blend`) of the local masks.
+ */
+class MaskSampler {
+public:
+    /**
+     * @brief True if the descriptor names a mask (a non-empty `ParameterKey::Mask`).
+     */
+    [[nodiscard]] static bool isMasked(const OperationDescriptor& descriptor);
+
+    /**
+     * @brief Blends `after` (the operation's output) with `before` (its input) by the mask coverage.
+     *
+     * @details
+     * Declares the mask tables and scalars in `params`. Pixel (x, y) of the chain input, of size
+     * `params.imageWidth()` x `params.imageHeight()`, reads the nearest pixel of the bound level.
+     *
+     * @return The blended function.
+     */
+    [[nodiscard]] static Halide::Func append(
+        const Halide::Func& before,
+        const Halide::Func& after,
+        const Halide::Var& x,
+        const Halide::Var& y,
+        const Halide::Var& c,
+        FusionParameterBlock& params);
+
+    /**
+     * @brief Binds the descriptor's mask to the tables `append` declared.
+     *
+     * @details
+     * Binds the level of the mask closest to `image_width` (the size of the realized input).
+     * An unknown mask binds an empty one: the operation then leaves the image unchanged.
+     */
+    static void bind(const OperationDescriptor& descriptor, FusionParameterBlock& params, Common::ImageDim image_width);
+
+    /**
+     * @brief Host version of `append`, for the sequential CPU fallback.
+     *
+     * @param before The operation's input, interleaved like `after`.
+     * @param after The operation's output, blended in place.
+     * @param descriptor The masked operation.
+     */
+    static void blend(std::span<const float> before, Common::ImageRegion& after, const OperationDescriptor& descriptor);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
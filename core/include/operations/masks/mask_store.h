@@ -0,0 +1,89 @@
+/**
+ * @file mask_store.h
+ * @brief Declaration of MaskStore (the local masks of the session, by id).
+ *
+ * @details
+ * An operation descriptor refers to its mask by id (`ParameterKey::Mask`), a string: the
+ * descriptor stays a small value, copied into the history and compared by the result cache,
+ * while the tiles live here, shared by every pipeline that samples them.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/masks/local_mask.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class MaskStore
+ * @brief Process-wide registry of the local masks. Thread-safe.
+ */
+class MaskStore {
+public:
+    /**
+     * @brief Returns the process-wide store.
+     */
+    [[nodiscard]] static MaskStore& instance();
+
+    /**
+     * @brief Creates an empty mask over a `width` x `height` image.
+     * @return Its id, to be set as the `ParameterKey::Mask` of an operation.
+     */
+    [[nodiscard]] std::string create(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief The mask `id`, or nullptr if there is none.
+     * @details Shared: a released mask stays valid for the pipelines still holding it.
+     */
+    [[nodiscard]] std::shared_ptr<LocalMask> find(std::string_view id) const;
+
+    /**
+     * @brief Forgets the mask `id` (e.g. when its operation is removed).
+     */
+    void release(std::string_view id);
+
+    /**
+     * @brief Forgets every mask (e.g. when the image is closed).
+     */
+    void clear();
+
+    /**
+     * @brief Number of masks.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    MaskStore() = default;
+
+    /**
+     * @brief Guards `m_masks` and `m_next_id`.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Masks by id.
+     */
+    std::unordered_map<std::string, std::shared_ptr<LocalMask>> m_masks;
+
+    /**
+     * @brief Number of the next id; ids are never reused.
+     */
+    std::uint64_t m_next_id{1};
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,133 @@
+/**
+ * @file mask_tiles.h
+ * @brief Declaration of MaskTiles (sparse tiled 8-bit coverage of one mask level).
+ *
+ * @details
+ * A local adjustment mask is mostly empty: a brushed sky, a dodged face. Storing it as a
+ * full-resolution float plane would cost 4 bytes per pixel per adjustment (almost 100 MB for
+ * one mask of a 24 MP image). The coverage is stored instead in square tiles of
+ * `k_tile_size` pixels, 8 bits per pixel, and only the tiles that were painted are allocated:
+ * an unallocated tile reads as zero coverage everywhere.
+ *
+ * Tiles are shared, copy-on-write: copying a `MaskTiles` copies pointers only, and the first
+ * write to a shared tile clones that tile alone. Snapshots (undo, a render in flight) cost a
+ * pointer per tile.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class MaskTiles
+ * @brief Sparse coverage of one resolution of a mask, in copy-on-write tiles.
+ */
+class MaskTiles {
+public:
+    /**
+     * @brief Side of a tile, in pixels.
+     */
+    static constexpr int k_tile_size = 64;
+
+    /**
+     * @brief Stored coverage: 0 (unmasked) to `k_full_coverage` (fully masked).
+     */
+    using Coverage = std::uint8_t;
+
+    /**
+     * @brief Coverage of a fully masked pixel.
+     */
+    static constexpr Coverage k_full_coverage = 255;
+
+    /**
+     * @brief Pixels of a tile, row by row.
+     */
+    using Tile = std::array<Coverage, static_cast<std::size_t>(k_tile_size * k_tile_size)>;
+
+    /**
+     * @brief An empty 0x0 mask.
+     */
+    MaskTiles() = default;
+
+    /**
+     * @brief An empty mask of `width` x `height` pixels (no tile allocated).
+     */
+    MaskTiles(Common::ImageDim width, Common::ImageDim height);
+
+    [[nodiscard]] Common::ImageDim width() const noexcept { return m_width; }
+    [[nodiscard]] Common::ImageDim height() const noexcept { return m_height; }
+
+    /**
+     * @brief Number of tile columns.
+     */
+    [[nodiscard]] int tilesX() const noexcept { return m_tiles_x; }
+
+    /**
+     * @brief Number of tile rows.
+     */
+    [[nodiscard]] int tilesY() const noexcept { return m_tiles_y; }
+
+    /**
+     * @brief The tile at (`tx`, `ty`), or nullptr if it is empty (or out of the mask).
+     */
+    [[nodiscard]] const Tile* tile(int tx, int ty) const noexcept;
+
+    /**
+     * @brief The tile at (`tx`, `ty`) for writing: allocated (zeroed) if empty, cloned if shared.
+     * @pre (`tx`, `ty`) is a tile of the mask.
+     */
+    [[nodiscard]] Tile& writableTile(int tx, int ty);
+
+    /**
+     * @brief Drops the tile at (`tx`, `ty`): it reads as empty again.
+     */
+    void releaseTile(int tx, int ty) noexcept;
+
+    /**
+     * @brief Coverage of a pixel in [0, 1]; 0 outside the mask.
+     */
+    [[nodiscard]] float coverage(Common::ImageCoord x, Common::ImageCoord y) const noexcept;
+
+    /**
+     * @brief Number of allocated tiles.
+     */
+    [[nodiscard]] std::size_t allocatedTiles() const noexcept;
+
+    /**
+     * @brief Bytes of the allocated tiles (shared tiles counted by every owner).
+     */
+    [[nodiscard]] std::size_t bytes() const noexcept { return allocatedTiles() * sizeof(Tile); }
+
+private:
+    /**
+     * @brief Index of a tile in `m_tiles`, or -1 out of the mask.
+     */
+    [[nodiscard]] std::ptrdiff_t indexOf(int tx, int ty) const noexcept;
+
+    Common::ImageDim m_width{0};
+    Common::ImageDim m_height{0};
+    int m_tiles_x{0};
+    int m_tiles_y{0};
+
+    /**
+     * @brief Tiles row by row; nullptr for the empty ones.
+     */
+    std::vector<std::shared_ptr<Tile>> m_tiles;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,175 @@
+/**
+ * @file operation_cost.h
+ * @brief Declaration of OperationCost and ChainCost (estimated cost of the operations of an edit).
+ *
+ * @details
+ * Each operation reports what one output pixel costs it (`IOperation::cost`): nanoseconds per
+ * pixel on the CPU and on the GPU, whether it reads a neighbourhood, and how far. The values are
+ * nominal, for a reference machine: their ratios matter, not their scale. `BackendCostModel`
+ * calibrates them against the startup benchmark, which times a known chain
+ * (`benchmarkChainCost`), so that a chain of any other operations can be predicted on this host
+ * before it runs: the proxy resolution of a preview, the backend of an export, the jobs a farm
+ * worker claims.
+ *
+ * Per-pixel operations cost `k_per_pixel_cpu_ns` / `k_per_pixel_gpu_ns`; each neighbour or table
+ * entry read per output pixel ("tap") adds `k_tap_cpu_ns` / `k_tap_gpu_ns`. GPUs hide gathers
+ * better than CPUs: a spatial chain favours the GPU at smaller image sizes than a tone chain.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+#include "common/types/memory_type.h"
+
+#include <cstddef>
+#include <span>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+class OperationFactory;
+struct OperationDescriptor;
+
+/**
+ * @struct OperationCost
+ * @brief Nominal cost of one operation, per output pixel.
+ */
+struct OperationCost {
+    /**
+     * @brief Nominal CPU cost of a per-pixel adjustment, in nanoseconds per pixel.
+     */
+    static constexpr double k_per_pixel_cpu_ns = 0.5;
+
+    /**
+     * @brief Nominal GPU cost of a per-pixel adjustment, in nanoseconds per pixel.
+     */
+    static constexpr double k_per_pixel_gpu_ns = 0.05;
+
+    /**
+     * @brief Nominal CPU cost of one extra read per output pixel, in nanoseconds.
+     */
+    static constexpr double k_tap_cpu_ns = 0.06;
+
+    /**
+     * @brief Nominal GPU cost of one extra read per output pixel, in nanoseconds.
+     */
+    static constexpr double k_tap_gpu_ns = 0.003;
+
+    /**
+     * @brief CPU cost, in nanoseconds per pixel.
+     */
+    double m_cpu_ns_per_pixel{k_per_pixel_cpu_ns};
+
+    /**
+     * @brief GPU cost, in nanoseconds per pixel.
+     */
+    double m_gpu_ns_per_pixel{k_per_pixel_gpu_ns};
+
+    /**
+     * @brief true if an output pixel reads its neighbours (a blur, a resampling).
+     */
+    bool m_spatial{false};
+
+    /**
+     * @brief Radius of the neighbourhood read, in pixels (`IOperation::haloPixels`).
+     */
+    Common::ImageDim m_halo_pixels{0};
+
+    /**
+     * @brief Cost of a per-pixel operation reading `taps` values besides its pixel (a LUT's cells).
+     */
+    [[nodiscard]] static constexpr OperationCost perPixel(double taps = 0.0) noexcept
+    {
+        return OperationCost { k_per_pixel_cpu_ns + taps * k_tap_cpu_ns, k_per_pixel_gpu_ns + taps * k_tap_gpu_ns,
+                               false, 0 };
+    }
+
+    /**
+     * @brief Cost of a spatial operation reading `taps` values per output pixel, up to `halo_pixels` away.
+     */
+    [[nodiscard]] static constexpr OperationCost spatial(double taps, Common::ImageDim halo_pixels) noexcept
+    {
+        return OperationCost { k_per_pixel_cpu_ns + taps * k_tap_cpu_ns, k_per_pixel_gpu_ns + taps * k_tap_gpu_ns,
+                               true, halo_pixels };
+    }
+};
+
+/**
+ * @struct ChainCost
+ * @brief Summed cost of the operations of a chain.
+ */
+struct ChainCost {
+    /**
+     * @brief CPU cost, in nanoseconds per pixel.
+     */
+    double m_cpu_ns_per_pixel{0.0};
+
+    /**
+     * @brief GPU cost, in nanoseconds per pixel.
+     */
+    double m_gpu_ns_per_pixel{0.0};
+
+    /**
+     * @brief Rows a region must read around it: the halos add up, each spatial operation
+     *        reading around the pixels the next one reads.
+     */
+    Common::ImageDim m_halo_pixels{0};
+
+    /**
+     * @brief Number of spatial operations.
+     */
+    std::size_t m_spatial_operations{0};
+
+    /**
+     * @brief Adds the cost of one operation.
+     */
+    constexpr void add(const OperationCost& cost) noexcept
+    {
+        m_cpu_ns_per_pixel += cost.m_cpu_ns_per_pixel;
+        m_gpu_ns_per_pixel += cost.m_gpu_ns_per_pixel;
+        m_halo_pixels += cost.m_halo_pixels;
+        m_spatial_operations += cost.m_spatial ? 1 : 0;
+    }
+
+    /**
+     * @brief Cost on a backend, in nanoseconds per pixel.
+     */
+    [[nodiscard]] constexpr double nsPerPixel(Common::MemoryType backend) const noexcept
+    {
+        return backend == Common::MemoryType::GPU_MEMORY ? m_gpu_ns_per_pixel : m_cpu_ns_per_pixel;
+    }
+
+    /**
+     * @brief true if no operation costs anything (every one disabled or at its identity).
+     */
+    [[nodiscard]] constexpr bool isEmpty() const noexcept
+    {
+        return m_cpu_ns_per_pixel <= 0.0 && m_gpu_ns_per_pixel <= 0.0;
+    }
+};
+
+/**
+ * @brief Sums the costs of the enabled operations of a chain.
+ * @details Operations at their identity are left out of the fused chain, and of the sum.
+ *          Types the factory cannot create cost a per-pixel adjustment.
+ */
+[[nodiscard]] ChainCost chainCost(std::span<const OperationDescriptor> operations, const OperationFactory& factory);
+
+/**
+ * @brief Sums the costs of a chain with the built-in operations and the loaded plugins.
+ */
+[[nodiscard]] ChainCost chainCost(std::span<const OperationDescriptor> operations);
+
+/**
+ * @brief Cost of the chain the startup benchmark times (`BenchmarkingBackendDecider`): the six
+ *        basic tone adjustments, fused.
+ */
+[[nodiscard]] ChainCost benchmarkChainCost();
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
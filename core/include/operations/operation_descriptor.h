@@ -8,11 +8,12 @@
 #pragma once
 
 #include "operations/operation_type.h"
+#include "operations/operation_parameters.h"
+#include "operations/parameter_key.h"
 #include "common/error_handling/core_error.h"
 
 #include <string>
-#include <unordered_map>
-#include <variant>
+#include <string_view>
 #include <expected>
 #include <cstdint>
 #include <atomic>
@@ -21,12 +22,6 @@ namespace CaptureMoment::Core {
 
 namespace Operations {
 
-/**
- * @brief Supported types for operation parameters.
- * Using variant instead of std::any for compile-time type safety and performance.
- */
-using OperationValue = std::variant<float, int, bool, std::string>;
-
 /**
  * @struct OperationDescriptor
  * @brief A universal container for operation settings with unique identifier.
@@ -73,9 +68,9 @@ struct OperationDescriptor {
     bool enabled{true};
 
     /**
-     * @brief Generic parameter storage using variant (Type Safe).
+     * @brief Parameter values, stored inline and indexed by `ParameterKey` (Type Safe).
      */
-    std::unordered_map<std::string, OperationValue> params;
+    OperationParameters params;
 
     /**
      * @brief Generates a unique identifier for a new operation.
@@ -92,22 +87,27 @@ struct OperationDescriptor {
     /**
      * @brief Helper to get a parameter value safely with error handling.
      * @tparam T The expected type (must be one of OperationValue types).
-     * @param key The parameter name.
-     * @return std::expected<T, CoreError> The value or an error (NotFound, InvalidType).
+     * @param key The parameter key.
+     * @return std::expected<T, CoreError> The value or an error (missing key or other type).
      */
     template <typename T>
-    [[nodiscard]] std::expected<T, ErrorHandling::CoreError> getParam(const std::string& key) const
+    [[nodiscard]] std::expected<T, ErrorHandling::CoreError> getParam(ParameterKey key) const
     {
-        auto it = params.find(key);
-        if (it == params.end()) {
-            return std::unexpected(ErrorHandling::CoreError::Unexpected);
-        }
+        return params.get<T>(key);
+    }
 
-        if (std::holds_alternative<T>(it->second)) {
-            return std::get<T>(it->second);
-        } else {
+    /**
+     * @brief Helper to get a parameter value by name (interned first, e.g. for deserialized names).
+     * @return The value, or `CoreError::Unexpected` for an unknown name, a missing key or another type.
+     */
+    template <typename T>
+    [[nodiscard]] std::expected<T, ErrorHandling::CoreError> getParam(std::string_view name) const
+    {
+        const auto key = ParameterKeys::find(name);
+        if (!key) {
             return std::unexpected(ErrorHandling::CoreError::Unexpected);
         }
+        return params.get<T>(*key);
     }
 
     /**
@@ -115,9 +115,28 @@ struct OperationDescriptor {
      * @tparam T The type of the value (must be one of OperationValue types).
      */
     template <typename T>
-    void setParam(const std::string& key, const T& value) {
-        params[key] = value;
+    void setParam(ParameterKey key, const T& value) {
+        params.set(key, OperationValue{value});
     }
+
+    /**
+     * @brief Helper to set a parameter value by name.
+     * @return false (nothing stored) if no key has this name.
+     */
+    template <typename T>
+    [[nodiscard]] bool setParam(std::string_view name, const T& value) {
+        const auto key = ParameterKeys::find(name);
+        if (!key) {
+            return false;
+        }
+        params.set(*key, OperationValue{value});
+        return true;
+    }
+
+    /**
+     * @brief Compares type, identity, state and parameters.
+     */
+    [[nodiscard]] bool operator==(const OperationDescriptor&) const = default;
 };
 
 } // namespace Operations
@@ -13,6 +13,7 @@
 #include <unordered_map>
 #include <functional>
 #include <expected>
+#include <vector>
 
 namespace CaptureMoment::Core {
 
@@ -58,6 +59,11 @@ public:
      */
     [[nodiscard]] std::expected<std::unique_ptr<IOperation>, ErrorHandling::CoreError> create(const OperationDescriptor& descriptor) const;
 
+    /**
+     * @brief Lists the operation types that have a creator, in enum order.
+     */
+    [[nodiscard]] std::vector<OperationType> registeredTypes() const;
+
 private:
     using OperationCreator = std::function<std::unique_ptr<IOperation>()>;
     std::unordered_map<OperationType, OperationCreator> m_creators;
@@ -0,0 +1,139 @@
+/**
+ * @file operation_parameters.h
+ * @brief Declaration of OperationParameters (inline, typed parameter storage of a descriptor).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/parameter_key.h"
+#include "common/error_handling/core_error.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief Supported types for operation parameters.
+ * Using variant instead of std::any for compile-time type safety and performance.
+ */
+using OperationValue = std::variant<float, int, bool, std::string>;
+
+/**
+ * @class OperationParameters
+ * @brief Parameter values indexed by `ParameterKey`, stored inline.
+ *
+ * @details
+ * One slot per key plus a presence mask: lookups are an index and a bit test, copies
+ * do not allocate (unless a string value is held), and two sets compare member-wise.
+ * Numeric values are stored with the type of the key (e.g. an int read from a sidecar for
+ * `ParameterKey::Value` is kept as a float).
+ */
+class OperationParameters {
+public:
+    /**
+     * @brief true if a value is set for `key`.
+     */
+    [[nodiscard]] bool contains(ParameterKey key) const noexcept
+    {
+        return (m_present_mask & bit(key)) != 0;
+    }
+
+    /**
+     * @brief Value of `key`, or nullptr if unset.
+     */
+    [[nodiscard]] const OperationValue* find(ParameterKey key) const noexcept
+    {
+        return contains(key) ? &m_values[ParameterKeys::indexOf(key)] : nullptr;
+    }
+
+    /**
+     * @brief Typed value of `key`.
+     * @tparam T The expected type (must be one of OperationValue types).
+     * @return The value, or `CoreError::Unexpected` if unset or of another type.
+     */
+    template<typename T>
+    [[nodiscard]] std::expected<T, ErrorHandling::CoreError> get(ParameterKey key) const
+    {
+        const OperationValue* value = find(key);
+        if (!value || !std::holds_alternative<T>(*value)) {
+            return std::unexpected(ErrorHandling::CoreError::Unexpected);
+        }
+        return std::get<T>(*value);
+    }
+
+    /**
+     * @brief Sets the value of `key`, converted to the key's type if numeric.
+     */
+    void set(ParameterKey key, OperationValue value);
+
+    /**
+     * @brief Unsets `key`.
+     */
+    void erase(ParameterKey key) noexcept;
+
+    /**
+     * @brief Unsets every key.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Number of keys set.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief true if no key is set.
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_present_mask == 0; }
+
+    /**
+     * @brief Calls `visitor(key, value)` for every set key, in key order.
+     */
+    template<typename Visitor>
+    void forEach(Visitor&& visitor) const
+    {
+        for (std::size_t i = 0; i < ParameterKeys::k_count; ++i) {
+            const auto key = static_cast<ParameterKey>(i);
+            if (contains(key)) {
+                visitor(key, m_values[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Member-wise comparison (unset slots always hold their reset value).
+     */
+    [[nodiscard]] bool operator==(const OperationParameters&) const = default;
+
+private:
+    [[nodiscard]] static constexpr std::uint32_t bit(ParameterKey key) noexcept
+    {
+        return std::uint32_t{1} << ParameterKeys::indexOf(key);
+    }
+
+    static_assert(ParameterKeys::k_count <= 32, "The presence mask holds one bit per key");
+
+    /**
+     * @brief Values, indexed by key.
+     */
+    std::array<OperationValue, ParameterKeys::k_count> m_values{};
+
+    /**
+     * @brief Bit `indexOf(key)` is set when `key` has a value.
+     */
+    std::uint32_t m_present_mask{0};
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -168,6 +168,296 @@ struct OperationRanges {
         return 0.0f;
     }
 
+    // --- Exposure Operation Ranges and Default ---
+    /**
+     * @brief Gets the minimum allowed value for the Exposure operation.
+     * @return float The minimum exposure value, in stops (e.g., -5.0f).
+     */
+    [[nodiscard]] consteval static float getExposureMinValue() {
+        return -5.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed value for the Exposure operation.
+     * @return float The maximum exposure value, in stops (e.g., 5.0f).
+     */
+    [[nodiscard]] consteval static float getExposureMaxValue() {
+        return 5.0f;
+    }
+
+    /**
+     * @brief Gets the default value for the Exposure operation.
+     * @return float The default exposure value (e.g., 0.0f, representing no change).
+     */
+    [[nodiscard]] consteval static float getExposureDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- Saturation Operation Ranges and Default ---
+    /**
+     * @brief Gets the minimum allowed value for the Saturation operation.
+     * @return float The minimum saturation value (e.g., 0.0f, grayscale).
+     */
+    [[nodiscard]] consteval static float getSaturationMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed value for the Saturation operation.
+     * @return float The maximum saturation value (e.g., 2.0f).
+     */
+    [[nodiscard]] consteval static float getSaturationMaxValue() {
+        return 2.0f;
+    }
+
+    /**
+     * @brief Gets the default value for the Saturation operation.
+     * @return float The default saturation value (e.g., 1.0f, representing no change).
+     */
+    [[nodiscard]] consteval static float getSaturationDefaultValue() {
+        return 1.0f;
+    }
+
+    // --- Clarity Operation Ranges and Default ---
+    /**
+     * @brief Gets the minimum allowed value for the Clarity operation.
+     * @return float The minimum clarity value (e.g., -1.0f, smoothed detail).
+     */
+    [[nodiscard]] consteval static float getClarityMinValue() {
+        return -1.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed value for the Clarity operation.
+     * @return float The maximum clarity value (e.g., 1.0f).
+     */
+    [[nodiscard]] consteval static float getClarityMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default value for the Clarity operation.
+     * @return float The default clarity value (e.g., 0.0f, representing no change).
+     */
+    [[nodiscard]] consteval static float getClarityDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- Tone Curve Operation Ranges and Default (each parametric region) ---
+    /**
+     * @brief Gets the minimum allowed offset of a parametric tone curve region.
+     * @return float The minimum region offset (e.g., -1.0f, region darkened).
+     */
+    [[nodiscard]] consteval static float getToneCurveRegionMinValue() {
+        return -1.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed offset of a parametric tone curve region.
+     * @return float The maximum region offset (e.g., 1.0f, region brightened).
+     */
+    [[nodiscard]] consteval static float getToneCurveRegionMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default offset of a parametric tone curve region.
+     * @return float The default region offset (e.g., 0.0f, representing no change).
+     */
+    [[nodiscard]] consteval static float getToneCurveRegionDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- 3D LUT Operation Ranges and Default (amount) ---
+    /**
+     * @brief Gets the minimum allowed amount of the 3D LUT operation.
+     * @return float The minimum amount (e.g., 0.0f, original colors).
+     */
+    [[nodiscard]] consteval static float getLut3DMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed amount of the 3D LUT operation.
+     * @return float The maximum amount (e.g., 1.0f, colors fully mapped).
+     */
+    [[nodiscard]] consteval static float getLut3DMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default amount of the 3D LUT operation.
+     * @return float The default amount (e.g., 1.0f, the LUT as authored).
+     */
+    [[nodiscard]] consteval static float getLut3DDefaultValue() {
+        return 1.0f;
+    }
+
+    // --- White Balance Operation Ranges and Default (temperature and tint shifts) ---
+    /**
+     * @brief Gets the minimum allowed temperature or tint shift of the white balance.
+     * @return float The minimum shift (e.g., -1.0f, one stop cooler or greener).
+     */
+    [[nodiscard]] consteval static float getWhiteBalanceShiftMinValue() {
+        return -1.0f;
+    }
+
+    /**
+     * @brief Gets the maximum allowed temperature or tint shift of the white balance.
+     * @return float The maximum shift (e.g., 1.0f, one stop warmer or more magenta).
+     */
+    [[nodiscard]] consteval static float getWhiteBalanceShiftMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default temperature or tint shift of the white balance.
+     * @return float The default shift (e.g., 0.0f, the white balance as shot).
+     */
+    [[nodiscard]] consteval static float getWhiteBalanceShiftDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- Crop Operation Ranges (edges, normalized to the source size) and straighten angle ---
+    /**
+     * @brief Gets the smallest crop edge position.
+     * @return float The minimum edge (e.g., 0.0f, the left or top border of the source).
+     */
+    [[nodiscard]] consteval static float getCropEdgeMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the largest crop edge position.
+     * @return float The maximum edge (e.g., 1.0f, the right or bottom border of the source).
+     */
+    [[nodiscard]] consteval static float getCropEdgeMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the minimum straighten angle of the crop.
+     * @return float The minimum angle in degrees (e.g., -45.0f, clockwise).
+     */
+    [[nodiscard]] consteval static float getStraightenAngleMinValue() {
+        return -45.0f;
+    }
+
+    /**
+     * @brief Gets the maximum straighten angle of the crop.
+     * @return float The maximum angle in degrees (e.g., 45.0f, counterclockwise).
+     */
+    [[nodiscard]] consteval static float getStraightenAngleMaxValue() {
+        return 45.0f;
+    }
+
+    /**
+     * @brief Gets the default straighten angle of the crop.
+     * @return float The default angle (e.g., 0.0f, not rotated).
+     */
+    [[nodiscard]] consteval static float getStraightenAngleDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- Lens Correction Operation Ranges (amount of the lens profile's corrections) ---
+    /**
+     * @brief Gets the minimum amount of the lens correction.
+     * @return float The minimum amount (e.g., 0.0f, uncorrected).
+     */
+    [[nodiscard]] consteval static float getLensCorrectionMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the maximum amount of the lens correction.
+     * @return float The maximum amount (e.g., 1.0f, the corrections of the profile).
+     */
+    [[nodiscard]] consteval static float getLensCorrectionMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default amount of the lens correction.
+     * @return float The default amount (e.g., 1.0f, fully corrected).
+     */
+    [[nodiscard]] consteval static float getLensCorrectionDefaultValue() {
+        return 1.0f;
+    }
+
+    // --- Denoise Operation Ranges (luminance and color strengths) ---
+    /**
+     * @brief Gets the minimum noise reduction strength.
+     * @return float The minimum strength (e.g., 0.0f, no reduction).
+     */
+    [[nodiscard]] consteval static float getDenoiseMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the maximum noise reduction strength.
+     * @return float The maximum strength (e.g., 1.0f, the strongest shrinkage).
+     */
+    [[nodiscard]] consteval static float getDenoiseMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default noise reduction strength.
+     * @return float The default strength (e.g., 0.0f, no reduction).
+     */
+    [[nodiscard]] consteval static float getDenoiseDefaultValue() {
+        return 0.0f;
+    }
+
+    // --- Sharpen Operation Ranges (amount and radius) ---
+    /**
+     * @brief Gets the minimum sharpening amount.
+     * @return float The minimum amount (e.g., 0.0f, no sharpening).
+     */
+    [[nodiscard]] consteval static float getSharpenMinValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the maximum sharpening amount.
+     * @return float The maximum amount (e.g., 1.0f).
+     */
+    [[nodiscard]] consteval static float getSharpenMaxValue() {
+        return 1.0f;
+    }
+
+    /**
+     * @brief Gets the default sharpening amount.
+     * @return float The default amount (e.g., 0.0f, no sharpening).
+     */
+    [[nodiscard]] consteval static float getSharpenDefaultValue() {
+        return 0.0f;
+    }
+
+    /**
+     * @brief Gets the minimum sharpening radius.
+     * @return float The minimum radius in pixels (e.g., 0.5f, the finest detail).
+     */
+    [[nodiscard]] consteval static float getSharpenRadiusMinValue() {
+        return 0.5f;
+    }
+
+    /**
+     * @brief Gets the maximum sharpening radius.
+     * @return float The maximum radius in pixels (e.g., 3.0f; wider is local contrast, see Clarity).
+     */
+    [[nodiscard]] consteval static float getSharpenRadiusMaxValue() {
+        return 3.0f;
+    }
+
+    /**
+     * @brief Gets the default sharpening radius.
+     * @return float The default radius in pixels (e.g., 1.0f, capture sharpening).
+     */
+    [[nodiscard]] consteval static float getSharpenRadiusDefaultValue() {
+        return 1.0f;
+    }
+
 };
 
 } // namespace CaptureMoment::Core::Operations
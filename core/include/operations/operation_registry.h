@@ -60,11 +60,23 @@ private:
      */
     static void registerDetailOperations(OperationFactory& factory);
     
+    /**
+     * @brief Register geometry operations (crop, straighten, lens correction)
+     * @param factory OperationFactory
+     */
+    static void registerGeometryOperations(OperationFactory& factory);
+    
     /**
      * @brief Register effects operations (blur, vignette, grain)
      * @param factory OperationFactory
      */
     static void registerEffects(OperationFactory& factory);
+
+    /**
+     * @brief Register the operations added by plugins (see OperationPluginRegistry)
+     * @param factory OperationFactory
+     */
+    static void registerPluginOperations(OperationFactory& factory);
 };
 
 } // namespace Operations
@@ -17,6 +17,9 @@ namespace Operations {
  * * This enum acts as a registry for all available operations in the system.
  * It is used by the UI to list available tools and by the processing engine
  * to instantiate the correct IOperation implementation.
+ *
+ * The values are stored by the binary edit format (`Serializer::encodeEditStack`): new types
+ * are appended, existing ones are never renumbered.
  */
 enum class OperationType : uint8_t {
     /**
@@ -76,10 +79,57 @@ enum class OperationType : uint8_t {
      */
     Saturation,
 
+    /**
+     * @brief Clarity adjustment (Local contrast).
+     * Amplifies or smooths the luminance detail around an edge-preserving base.
+     */
+    Clarity,
+
+    /**
+     * @brief Tone curve (Point and parametric).
+     * Remaps R, G and B through a curve given by control points and four region offsets.
+     */
+    ToneCurve,
+
+    /**
+     * @brief 3D LUT (Look).
+     * Maps the colors through a .cube lattice, blended with the original by an amount.
+     */
+    Lut3D,
+
+    /**
+     * @brief White balance and camera color matrix.
+     * Balances the camera-native colors of a RAW file and converts them to the working space;
+     * shifts the temperature and tint of the other sources.
+     */
+    WhiteBalance,
+
+    /**
+     * @brief Crop and straighten.
+     * Restricts the image to a rectangle, optionally rotated about its center. Applied as a
+     * coordinate transform of the pipeline input: no cropped copy of the image is made.
+     */
+    Crop,
+
+    /**
+     * @brief Lens correction (distortion, vignetting and lateral chromatic aberration).
+     * Resamples the image through a radial table sampled once per lens setting.
+     */
+    LensCorrection,
+
+    /**
+     * @brief Noise reduction (Luminance and color).
+     * Shrinks the fine wavelet detail of the luminance and of the chroma separately.
+     */
+    Denoise,
+
+    /**
+     * @brief Sharpening (Unsharp mask).
+     * Adds the fine detail of the luminance back, amplified.
+     */
+    Sharpen,
+
     // Future operations can be added here
-    // WhiteBalance,
-    // Sharpen,
-    // Denoise,
     // ...
 };
 
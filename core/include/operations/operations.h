@@ -35,6 +35,21 @@
  */
 #include "operations/interfaces/i_operation_fusion_logic.h"
 
+/**
+ * @brief Runtime inputs (scalars, lookup tables) of a fused operation.
+ */
+#include "operations/fusion_parameter_block.h"
+
+/**
+ * @brief Luminance shared by the masked adjustments of a fused chain.
+ */
+#include "operations/fused_luminance.h"
+
+/**
+ * @brief POD snapshot of the single-value adjustments, published lock-free by the UI.
+ */
+#include "operations/parameter_snapshot.h"
+
 /**
  * @brief Interface for CPU fallback logic.
  */
@@ -45,6 +60,16 @@
  */
 #include "operations/operation_type.h"
 
+/**
+ * @brief Interned parameter keys, and the keys accepted by each operation type.
+ */
+#include "operations/parameter_key.h"
+
+/**
+ * @brief Inline, typed parameter storage of the operation descriptors.
+ */
+#include "operations/operation_parameters.h"
+
 // ============================================================
 // Infrastructure & Factory
 // ============================================================
@@ -54,6 +79,11 @@
  */
 #include "operations/operation_factory.h"
 
+/**
+ * @brief Estimated cost of the operations and of their chains.
+ */
+#include "operations/operation_cost.h"
+
 /**
  * @brief Registry for registering all available operations with the factory.
  */
@@ -88,17 +118,83 @@
  */
 #include "operations/basic_adjustment_operations/operation_contrast.h"
 
+/**
+ * @brief Implementation of the 'Exposure' adjustment.
+ */
+#include "operations/basic_adjustment_operations/operation_exposure.h"
+
+/**
+ * @brief Implementation of the 'Clarity' adjustment (local contrast).
+ */
+#include "operations/detail_operations/operation_clarity.h"
+
+/**
+ * @brief Implementation of the 'Denoise' operation (wavelet noise reduction).
+ */
+#include "operations/detail_operations/operation_denoise.h"
+
+/**
+ * @brief Implementation of the 'Sharpen' operation (unsharp mask).
+ */
+#include "operations/detail_operations/operation_sharpen.h"
+
+/**
+ * @brief Implementation of the '3D LUT' operation (.cube looks).
+ */
+#include "operations/color_operations/operation_lut3d.h"
+
+/**
+ * @brief Implementation of the 'White Balance' operation (camera profile of RAW sources).
+ */
+#include "operations/color_operations/operation_white_balance.h"
+
+/**
+ * @brief Implementation of the 'Crop' operation (crop and straighten).
+ */
+#include "operations/geometry_operations/operation_crop.h"
+
+/**
+ * @brief Implementation of the 'Lens Correction' operation (lens profile corrections).
+ */
+#include "operations/geometry_operations/operation_lens_correction.h"
+
+/**
+ * @brief Local adjustment masks: sparse tiles, pyramid and session store.
+ */
+#include "operations/masks/local_mask.h"
+#include "operations/masks/mask_store.h"
+
+/**
+ * @brief Blends a fused operation with its input by its local mask.
+ */
+#include "operations/masks/mask_sampler.h"
+
 /**
  * @brief Implementation of the 'Highlights' adjustment.
  */
 #include "operations/basic_adjustment_operations/operation_highlights.h"
 
+/**
+ * @brief Implementation of the 'Saturation' adjustment.
+ */
+#include "operations/basic_adjustment_operations/operation_saturation.h"
+
 /**
  * @brief Implementation of the 'Shadows' adjustment.
  */
 #include "operations/basic_adjustment_operations/operation_shadows.h"
 
+/**
+ * @brief Implementation of the 'Tone Curve' adjustment (point and parametric curve).
+ */
+#include "operations/basic_adjustment_operations/operation_tone_curve.h"
+
 /**
  * @brief Implementation of the 'Whites' adjustment.
  */
-#include "operations/basic_adjustment_operations/operation_whites.h"
\ No newline at end of file
+#include "operations/basic_adjustment_operations/operation_whites.h"
+
+/**
+ * @brief Shared Halide expressions of the basic adjustments (used by JIT and AOT).
+ */
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
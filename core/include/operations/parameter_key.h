@@ -0,0 +1,290 @@
+/**
+ * @file parameter_key.h
+ * @brief Interned parameter keys of the operations.
+ *
+ * @details
+ * Parameter names are resolved once (when a descriptor is deserialized or an operation
+ * declares its inputs) into a `ParameterKey`, a compile-time index into the inline value
+ * storage of `OperationParameters`. The hot paths (pipeline updates, `execute`) then look
+ * values up by index, without hashing or comparing strings.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_type.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief Identifier of an operation parameter.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ * New keys are appended before `Count`; the names are part of the sidecar format and the
+ * values part of the binary edit format.
+ */
+enum class ParameterKey : std::uint8_t {
+    /**
+     * @brief Value of the single-value adjustments (sliders), a float.
+     */
+    Value = 0,
+
+    /**
+     * @brief Mask of the luminance-range adjustments (Highlights, Shadows), an int
+     *        (see `ToneMaskMode`). Structural: switching it rebuilds the fused pipeline.
+     */
+    MaskMode = 1,
+
+    /**
+     * @brief Control points of the point curve (ToneCurve), a string "x,y;x,y;..." in [0, 1].
+     */
+    CurvePoints = 2,
+
+    /**
+     * @brief Parametric curve offset of the shadows region (ToneCurve), a float in [-1, 1].
+     */
+    CurveShadows = 3,
+
+    /**
+     * @brief Parametric curve offset of the darks region (ToneCurve), a float in [-1, 1].
+     */
+    CurveDarks = 4,
+
+    /**
+     * @brief Parametric curve offset of the lights region (ToneCurve), a float in [-1, 1].
+     */
+    CurveLights = 5,
+
+    /**
+     * @brief Parametric curve offset of the highlights region (ToneCurve), a float in [-1, 1].
+     */
+    CurveHighlights = 6,
+
+    /**
+     * @brief Path of the .cube file applied by Lut3D, a string.
+     */
+    LutPath = 7,
+
+    /**
+     * @brief Color temperature shift of WhiteBalance, a float in [-1, 1] (positive is warmer).
+     */
+    Temperature = 8,
+
+    /**
+     * @brief Green-magenta tint shift of WhiteBalance, a float in [-1, 1] (positive is magenta).
+     */
+    Tint = 9,
+
+    /**
+     * @brief Color profile of the source (WhiteBalance), a string (see `CameraProfile`).
+     *        Filled from the decoded file by the core, not edited by the user.
+     */
+    CameraProfile = 10,
+
+    /**
+     * @brief Left edge of the crop (Crop), a float in [0, 1] of the source width.
+     */
+    CropLeft = 11,
+
+    /**
+     * @brief Top edge of the crop (Crop), a float in [0, 1] of the source height.
+     */
+    CropTop = 12,
+
+    /**
+     * @brief Right edge of the crop (Crop), a float in [0, 1] of the source width.
+     */
+    CropRight = 13,
+
+    /**
+     * @brief Bottom edge of the crop (Crop), a float in [0, 1] of the source height.
+     */
+    CropBottom = 14,
+
+    /**
+     * @brief Straighten angle of the crop (Crop), a float in degrees (positive is counterclockwise).
+     *        Structural between zero and non-zero: a rotation adds a resampling stage.
+     */
+    Angle = 15,
+
+    /**
+     * @brief Lens models of the source (LensCorrection), a string (see `LensProfile`).
+     */
+    LensProfile = 16,
+
+    /**
+     * @brief Color (chroma) noise reduction of Denoise, a float in [0, 1]; `Value` is the luminance one.
+     */
+    ColorNoise = 17,
+
+    /**
+     * @brief Radius of Sharpen, the sigma of its blur in pixels (float).
+     */
+    Radius = 18,
+
+    /**
+     * @brief Local adjustment mask of any operation, a string: the id of a `MaskStore` mask.
+     * Unset or empty: the operation applies to the whole image.
+     */
+    Mask = 19,
+
+    /**
+     * @brief Number of keys (not a key).
+     */
+    Count
+};
+
+/**
+ * @struct ParameterKeys
+ * @brief Names of the keys, and the keys each operation type accepts.
+ */
+struct ParameterKeys {
+    /**
+     * @brief Number of keys (size of the inline storage of `OperationParameters`).
+     */
+    static constexpr std::size_t k_count = static_cast<std::size_t>(ParameterKey::Count);
+
+    /**
+     * @brief Index of a key in the inline storage.
+     */
+    [[nodiscard]] static constexpr std::size_t indexOf(ParameterKey key) noexcept
+    {
+        return static_cast<std::size_t>(key);
+    }
+
+    /**
+     * @brief Serialized name of a key (e.g. "value").
+     */
+    [[nodiscard]] static constexpr std::string_view name(ParameterKey key) noexcept
+    {
+        return k_names[indexOf(key)];
+    }
+
+    /**
+     * @brief Interns a name.
+     * @return The key named `name`, or `std::nullopt` if no key has this name.
+     */
+    [[nodiscard]] static constexpr std::optional<ParameterKey> find(std::string_view name) noexcept
+    {
+        for (std::size_t i = 0; i < k_count; ++i) {
+            if (k_names[i] == name) {
+                return static_cast<ParameterKey>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Keys accepted by an operation type, in declaration order.
+     * @details `ParameterKey::Mask` is accepted by every fused operation and is not listed.
+     */
+    [[nodiscard]] static constexpr std::span<const ParameterKey> keysOf(OperationType type) noexcept
+    {
+        switch (type) {
+        case OperationType::Highlights:
+        case OperationType::Shadows:
+            return k_masked_tone_keys;
+        case OperationType::Exposure:
+        case OperationType::Brightness:
+        case OperationType::Contrast:
+        case OperationType::Whites:
+        case OperationType::Blacks:
+        case OperationType::Saturation:
+        case OperationType::Clarity:
+            return k_single_value_keys;
+        case OperationType::ToneCurve:
+            return k_tone_curve_keys;
+        case OperationType::Lut3D:
+            return k_lut_keys;
+        case OperationType::WhiteBalance:
+            return k_white_balance_keys;
+        case OperationType::Crop:
+            return k_crop_keys;
+        case OperationType::LensCorrection:
+            return k_lens_correction_keys;
+        case OperationType::Denoise:
+            return k_denoise_keys;
+        case OperationType::Sharpen:
+            return k_sharpen_keys;
+        }
+        return {};
+    }
+
+private:
+    /**
+     * @brief Names, indexed by key.
+     */
+    static constexpr std::array<std::string_view, k_count> k_names{
+        "value", "mask_mode", "curve_points", "curve_shadows", "curve_darks", "curve_lights", "curve_highlights",
+        "lut_path", "temperature", "tint", "camera_profile", "crop_left", "crop_top", "crop_right", "crop_bottom",
+        "angle", "lens_profile", "color_noise", "radius", "mask"
+    };
+
+    /**
+     * @brief Keys of the single-value adjustments.
+     */
+    static constexpr std::array<ParameterKey, 1> k_single_value_keys{ ParameterKey::Value };
+
+    /**
+     * @brief Keys of the luminance-range adjustments with a selectable mask.
+     */
+    static constexpr std::array<ParameterKey, 2> k_masked_tone_keys{ ParameterKey::Value, ParameterKey::MaskMode };
+
+    /**
+     * @brief Keys of the tone curve: the point curve, then the parametric regions.
+     */
+    static constexpr std::array<ParameterKey, 5> k_tone_curve_keys{
+        ParameterKey::CurvePoints, ParameterKey::CurveShadows, ParameterKey::CurveDarks,
+        ParameterKey::CurveLights, ParameterKey::CurveHighlights
+    };
+
+    /**
+     * @brief Keys of the 3D LUT: the amount (`Value`) and the file.
+     */
+    static constexpr std::array<ParameterKey, 2> k_lut_keys{ ParameterKey::Value, ParameterKey::LutPath };
+
+    /**
+     * @brief Keys of the white balance: the two shifts, then the source profile.
+     */
+    static constexpr std::array<ParameterKey, 3> k_white_balance_keys{
+        ParameterKey::Temperature, ParameterKey::Tint, ParameterKey::CameraProfile
+    };
+
+    /**
+     * @brief Keys of the crop: the four edges, then the straighten angle.
+     */
+    static constexpr std::array<ParameterKey, 5> k_crop_keys{
+        ParameterKey::CropLeft, ParameterKey::CropTop, ParameterKey::CropRight, ParameterKey::CropBottom,
+        ParameterKey::Angle
+    };
+
+    /**
+     * @brief Keys of the lens correction: the amount (`Value`) and the lens models.
+     */
+    static constexpr std::array<ParameterKey, 2> k_lens_correction_keys{ ParameterKey::Value, ParameterKey::LensProfile };
+
+    /**
+     * @brief Keys of the noise reduction: the luminance (`Value`), then the color strength.
+     */
+    static constexpr std::array<ParameterKey, 2> k_denoise_keys{ ParameterKey::Value, ParameterKey::ColorNoise };
+
+    /**
+     * @brief Keys of the sharpening: the amount (`Value`), then the radius.
+     */
+    static constexpr std::array<ParameterKey, 2> k_sharpen_keys{ ParameterKey::Value, ParameterKey::Radius };
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,91 @@
+/**
+ * @file parameter_snapshot.h
+ * @brief Compact POD snapshot of the single-value adjustments, published by the UI.
+ *
+ * @details
+ * Dragging a slider changes one float many times per second. Instead of rebuilding and
+ * queueing a full descriptor list per tick, the UI writes the value into its slot of a
+ * `ParameterSnapshot` and publishes it through a `Common::Seqlock`. A processing run reads
+ * the latest snapshot when it starts and refreshes the "value" of the matching descriptors:
+ * ticks arriving while a run is queued coalesce into the run, with no allocation or mutex
+ * on the UI side.
+ *
+ * Structural changes (adding, removing or toggling an operation) still go through the
+ * descriptor list.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "operations/operation_type.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @struct ParameterSnapshot
+ * @brief Latest value of each single-value operation, indexed by `OperationType` slot.
+ */
+struct ParameterSnapshot {
+    /**
+     * @brief Number of slots (upper bound of the `OperationType` values).
+     */
+    static constexpr std::size_t k_slot_count = 32;
+
+    /**
+     * @brief Slot of an operation type.
+     */
+    [[nodiscard]] static constexpr std::size_t slotOf(OperationType type) noexcept
+    {
+        return static_cast<std::size_t>(type);
+    }
+
+    /**
+     * @brief Value of each slot, meaningful when its bit of `m_present_mask` is set.
+     */
+    std::array<float, k_slot_count> m_values{};
+
+    /**
+     * @brief Bit `slotOf(type)` is set once a value was published for `type`.
+     */
+    std::uint32_t m_present_mask{0};
+
+    /**
+     * @brief Sets the value of an operation type.
+     */
+    void set(OperationType type, float value) noexcept
+    {
+        m_values[slotOf(type)] = value;
+        m_present_mask |= std::uint32_t{1} << slotOf(type);
+    }
+
+    /**
+     * @brief true if a value was published for `type`.
+     */
+    [[nodiscard]] bool has(OperationType type) const noexcept
+    {
+        return (m_present_mask & (std::uint32_t{1} << slotOf(type))) != 0;
+    }
+
+    /**
+     * @brief Overwrites the "value" parameter of the descriptors whose type has a slot value.
+     * @param operations Descriptors of a request, refreshed in place.
+     */
+    void applyTo(std::vector<OperationDescriptor>& operations) const;
+};
+
+static_assert(static_cast<std::size_t>(OperationType::Sharpen) < ParameterSnapshot::k_slot_count,
+              "ParameterSnapshot::k_slot_count must cover every OperationType");
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
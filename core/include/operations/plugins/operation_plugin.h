@@ -0,0 +1,103 @@
+/**
+ * @file operation_plugin.h
+ * @brief Interface of the operation plugins (third-party operations loaded from shared libraries).
+ *
+ * @details
+ * A plugin is a shared library exporting the two entry points declared by
+ * `CAPTUREMOMENT_OPERATION_PLUGIN`. Its operations implement the same interfaces as the
+ * built-in ones: `IOperation`, and `IOperationFusionLogic` to join the fused Halide chain
+ * (with its runtime parameters, identity specialization, memoized outputs, neighbourhood reads
+ * and cache keys), `IOperationDefaultLogic` for the CPU fallback.
+ *
+ * @code
+ * class FilmGrain : public IOperation, public IOperationFusionLogic {
+ * public:
+ *     explicit FilmGrain(OperationType type) : m_type(type) {}
+ *     OperationType type() const override { return m_type; }
+ *     const char* name() const override { return "Film Grain"; }
+ *     // execute, appendToFusedPipeline, ...
+ * private:
+ *     OperationType m_type;
+ * };
+ *
+ * CAPTUREMOMENT_OPERATION_PLUGIN(registrar)
+ * {
+ *     registrar.addOperation("acme.FilmGrain", [](OperationType type) { return std::make_unique<FilmGrain>(type); });
+ * }
+ * @endcode
+ *
+ * The interface is the C++ one of these headers: a plugin is built against the headers of the
+ * version that loads it, with the same compiler and the same (shared) Halide library.
+ * `k_operation_plugin_api_version` is bumped whenever the operation interfaces change, and a
+ * plugin of another version is refused. The plugin resolves the core functions it calls
+ * (`FusionParameterBlock`, ...) from the application, which exports them (`ENABLE_EXPORTS`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/interfaces/i_operation.h"
+#include "operations/operation_type.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @brief Version of the operation interfaces a plugin is built against.
+ */
+inline constexpr std::uint32_t k_operation_plugin_api_version = 1;
+
+/**
+ * @brief Creates an instance of a plugin operation, given the type it was assigned.
+ */
+using PluginOperationCreator = std::function<std::unique_ptr<IOperation>(OperationType type)>;
+
+/**
+ * @interface IOperationPluginRegistrar
+ * @brief Receives the operations of a plugin while it is loaded.
+ */
+class IOperationPluginRegistrar {
+public:
+    virtual ~IOperationPluginRegistrar() = default;
+
+    /**
+     * @brief Adds an operation.
+     *
+     * @param type_name Stable, unique name of the operation, qualified by its vendor
+     *        (e.g. "acme.FilmGrain"): the sidecars store it, and it keys the compiled pipelines.
+     * @param creator Creates the instances; each reports the assigned type from `type()`.
+     * @return The type assigned to the operation, or std::nullopt if the name is invalid or
+     *         taken, or no type is left.
+     */
+    virtual std::optional<OperationType> addOperation(std::string_view type_name, PluginOperationCreator creator) = 0;
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
+
+#if defined(_WIN32)
+#define CAPTUREMOMENT_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define CAPTUREMOMENT_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+/**
+ * @brief Defines the entry points of a plugin; the body that follows registers its operations.
+ */
+#define CAPTUREMOMENT_OPERATION_PLUGIN(registrar)                                                          \
+    CAPTUREMOMENT_PLUGIN_EXPORT std::uint32_t capturemoment_plugin_api_version()                          \
+    {                                                                                                      \
+        return ::CaptureMoment::Core::Operations::k_operation_plugin_api_version;                          \
+    }                                                                                                      \
+    CAPTUREMOMENT_PLUGIN_EXPORT void capturemoment_register_operations(                                    \
+        ::CaptureMoment::Core::Operations::IOperationPluginRegistrar& registrar)
@@ -0,0 +1,92 @@
+/**
+ * @file operation_plugin_registry.h
+ * @brief Declaration of OperationPluginRegistry (the operations added by plugins).
+ *
+ * @details
+ * Plugin operations are given `OperationType` values above the built-in ones, from
+ * `k_first_plugin_type`. The value is derived from the type name (then probed on a collision),
+ * so that an operation keeps its value across sessions in the binary edit format; the sidecars
+ * store the name.
+ *
+ * `OperationRegistry::registerAll` copies the plugin creators into every factory: a factory
+ * created after a plugin is loaded builds its operations like the built-in ones, for the fused
+ * and the fallback executors alike. Libraries are never unloaded (compiled pipelines keep
+ * their code).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "operations/plugins/operation_plugin.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+class OperationFactory;
+
+/**
+ * @class OperationPluginRegistry
+ * @brief Process-wide registry of the plugin operations. Thread-safe.
+ */
+class OperationPluginRegistry {
+public:
+    /**
+     * @brief First `OperationType` value given to plugin operations (the built-in ones stay below).
+     */
+    static constexpr std::uint8_t k_first_plugin_type = 128;
+
+    /**
+     * @brief Loads a plugin library and registers its operations.
+     * @param library Path of the shared library.
+     * @return The number of operations added, or `PluginError`.
+     */
+    [[nodiscard]] static std::expected<std::size_t, ErrorHandling::CoreError> load(const std::filesystem::path& library);
+
+    /**
+     * @brief Loads every shared library of a directory (not recursive); failures are logged.
+     * @return The number of plugins loaded.
+     */
+    static std::size_t loadDirectory(const std::filesystem::path& directory);
+
+    /**
+     * @brief Adds an operation directly (plugins linked into the application, tests).
+     * @see IOperationPluginRegistrar::addOperation
+     */
+    static std::optional<OperationType> addOperation(std::string_view type_name, PluginOperationCreator creator);
+
+    /**
+     * @brief Registers the creators of every plugin operation into a factory.
+     */
+    static void registerAll(OperationFactory& factory);
+
+    /**
+     * @brief True if a plugin added an operation of this type.
+     */
+    [[nodiscard]] static bool contains(OperationType type);
+
+    /**
+     * @brief Name of a type: the enumerator of a built-in one, the type name of a plugin one,
+     *        empty if unknown.
+     */
+    [[nodiscard]] static std::string_view typeName(OperationType type);
+
+    /**
+     * @brief Type of a name written by `typeName`, if it is a built-in or a loaded one.
+     */
+    [[nodiscard]] static std::optional<OperationType> findType(std::string_view name);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
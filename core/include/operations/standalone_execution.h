@@ -0,0 +1,96 @@
+/**
+ * @file standalone_execution.h
+ * @brief Declaration of StandaloneExecution (runs one operation on a working image, outside a pipeline).
+ *
+ * @details
+ * `IOperation::execute` applies a single operation in place. It builds the operation's fused
+ * graph (`appendToFusedPipeline` then `updateFusionParameters`, mask included) exactly as the
+ * `OperationPipelineExecutor` does for a chain of one, and realizes it on the image's own
+ * buffers:
+ * - Halide working images (CPU or GPU): the graph reads the destination buffer and writes the
+ *   source buffer, on the image's device, then the result is copied back to the destination
+ *   (on the device for GPU images). Both buffers end up holding the result, as after
+ *   `updateFromCPU`, without exporting, allocating or uploading anything.
+ * - Other working images: through a host view and `updateFromCPU`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/operation_descriptor.h"
+#include "image_processing/interfaces/i_working_image_hardware.h"
+#include "common/error_handling/core_error.h"
+#include "common/pixel_format.h"
+
+#include "Halide.h"
+
+#include <expected>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Operations {
+
+/**
+ * @class StandaloneExecution
+ * @brief Realizes a single operation's fused graph in place on a working image.
+ */
+class StandaloneExecution {
+public:
+    /**
+     * @brief Applies `descriptor` to the working image through `operation`'s fused graph.
+     *
+     * @details
+     * The caller validates the image and skips disabled or neutral descriptors first.
+     *
+     * @return Nothing on success; `InvalidWorkingImage` if the image buffers are unusable,
+     *         the error of the export or upload on the host path, or `Unexpected` on a Halide error.
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> run(
+        const IOperationFusionLogic& operation,
+        const OperationDescriptor& descriptor,
+        ImageProcessing::IWorkingImageHardware& working_image);
+
+private:
+    /**
+     * @brief Builds and schedules the graph of `operation` over `input` (float RGBA).
+     *
+     * @param input The image to read (edge-clamped if the operation reads neighborhoods).
+     * @param width Width of the image, in pixels.
+     * @param height Height of the image, in pixels.
+     * @param stored_type Element type of the output (the image's storage type).
+     * @param target Target the graph is realized for: GPU targets get GPU tiles.
+     * @param layout Layout of the output (the image's storage layout).
+     * @return The scheduled output func.
+     */
+    [[nodiscard]] static Halide::Func build(
+        const IOperationFusionLogic& operation,
+        const OperationDescriptor& descriptor,
+        const Halide::Func& input,
+        int width,
+        int height,
+        const Halide::Type& stored_type,
+        const Halide::Target& target,
+        Common::PixelLayout layout = Common::PixelLayout::Interleaved);
+
+    /**
+     * @brief Schedules `stage` for `target`, as the executor schedules its root stages.
+     */
+    static void scheduleStage(Halide::Func stage, const Halide::Var& x, const Halide::Var& y, const Halide::Var& c,
+                              const Halide::Target& target);
+
+    /**
+     * @brief Path of the images that export a host view only (no Halide buffers).
+     */
+    [[nodiscard]] static std::expected<void, ErrorHandling::CoreError> runOnHostView(
+        const IOperationFusionLogic& operation,
+        const OperationDescriptor& descriptor,
+        ImageProcessing::IWorkingImageHardware& working_image);
+};
+
+} // namespace Operations
+
+} // namespace CaptureMoment::Core
@@ -56,6 +56,8 @@
 #include "domain/domain.h"            // Task interfaces, etc.
 #include "engine/engine.h"           // Orchestrators like PhotoEngine
 #include "serializer/serializer.h"   // Serialization interfaces, providers, etc.
+#include "thumbnails/thumbnails.h"   // Thumbnail rendering and SQLite cache
+#include "export/export.h"           // Headless batch export
 #include "workers/workers.h"         // Worker interfaces, builders, registries, etc.
 #include "image_config/image_config.h"   // Image operation configuration structures
 
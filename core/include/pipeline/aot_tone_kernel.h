@@ -0,0 +1,102 @@
+/**
+ * @file aot_tone_kernel.h
+ * @brief Declaration of AotToneKernel (ahead-of-time compiled tone adjustments).
+ *
+ * @details
+ * When the project is configured with `BUILD_AOT_KERNELS`, the six basic adjustments are
+ * compiled at build time into one parameterized kernel (see `core/generators`), with one
+ * variant per CPU feature level selected at runtime. Chains made only of these adjustments
+ * can then run immediately, without paying the JIT compilation of a fused pipeline.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "operations/operation_ranges.h"
+
+#include "Halide.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @struct ToneKernelArguments
+ * @brief Runtime arguments of the AOT tone kernel.
+ *
+ * @details
+ * Stages follow the canonical order of the kernel:
+ * Brightness, Contrast, Highlights, Shadows, Whites, Blacks.
+ */
+struct ToneKernelArguments {
+    /**
+     * @brief Bit `i` set means stage `i` is applied.
+     */
+    int m_enabled_mask{0};
+
+    /**
+     * @brief Value of each stage, in canonical order. Unused stages keep their default.
+     */
+    std::array<float, 6> m_values{
+        Operations::OperationRanges::getBrightnessDefaultValue(),
+        Operations::OperationRanges::getContrastDefaultValue(),
+        Operations::OperationRanges::getHighlightsDefaultValue(),
+        Operations::OperationRanges::getShadowsDefaultValue(),
+        Operations::OperationRanges::getWhitesDefaultValue(),
+        Operations::OperationRanges::getBlacksDefaultValue()
+    };
+};
+
+/**
+ * @class AotToneKernel
+ * @brief Entry point to the ahead-of-time compiled tone kernel.
+ *
+ * @details
+ * Only host-memory buffers are supported: the AOT code carries its own Halide runtime,
+ * which does not share device allocations with the JIT runtime used by the GPU backend.
+ */
+class AotToneKernel {
+public:
+    /**
+     * @brief Checks whether the kernel was compiled into this build.
+     */
+    [[nodiscard]] static bool isAvailable() noexcept;
+
+    /**
+     * @brief Maps an operation chain onto the kernel arguments.
+     *
+     * @details
+     * The chain matches if its enabled operations are all basic tone adjustments, appear in
+     * the canonical order, and each appears at most once. Fused operations do not commute,
+     * so any other order must go through the JIT pipeline.
+     *
+     * @param operations The operation chain, in application order.
+     * @return The kernel arguments, or `std::nullopt` if the chain cannot run on the kernel
+     *         (including when no operation is enabled).
+     */
+    [[nodiscard]] static std::optional<ToneKernelArguments> matchChain(const std::vector<Operations::OperationDescriptor>& operations);
+
+    /**
+     * @brief Runs the kernel from `input` into `output`.
+     *
+     * @param arguments The arguments built by `matchChain`.
+     * @param input The source buffer (host memory, 4 channels).
+     * @param output The destination buffer; may be a cropped view, only its region is computed.
+     * @return true on success, false if the kernel is unavailable or reported an error.
+     */
+    [[nodiscard]] static bool run(const ToneKernelArguments& arguments,
+                                  const Halide::Buffer<float>& input,
+                                  Halide::Buffer<float>& output);
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,83 @@
+/**
+ * @file autoscheduler.h
+ * @brief Declaration of Autoscheduler (Halide autoscheduler plugins applied to fused pipelines).
+ *
+ * @details
+ * The hand-written schedules are tuned for a typical machine; the autoscheduler searches a
+ * schedule for the actual target instead (AVX-512 servers and ARM laptops favour different
+ * tile sizes and fusion points). Plugins are loaded lazily, once per process: if a plugin is
+ * missing, `apply` fails and the executor keeps its manual schedule.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class Autoscheduler
+ * @brief Static helpers running the Halide autoscheduler on unscheduled pipelines.
+ */
+class Autoscheduler {
+public:
+    /**
+     * @brief Width the pipelines are tuned for (24 MP, 3:2).
+     */
+    static constexpr int k_estimate_width = 6000;
+
+    /**
+     * @brief Height the pipelines are tuned for.
+     */
+    static constexpr int k_estimate_height = 4000;
+
+    /**
+     * @brief Name of the autoscheduler used for a target.
+     * @return "Li2018" for GPU targets, "Adams2019" otherwise.
+     */
+    [[nodiscard]] static std::string_view nameFor(const Halide::Target& target) noexcept;
+
+    /**
+     * @brief Schedules a pipeline whose outputs carry estimates and whose funcs are unscheduled.
+     *
+     * @param pipeline The pipeline to schedule, before `compile_jit`.
+     * @param target The target the pipeline will be compiled for.
+     * @return The generated schedule source, or `std::nullopt` if the plugin could not be
+     *         loaded or the search failed (the pipeline is then left unscheduled).
+     */
+    [[nodiscard]] static std::optional<std::string> apply(Halide::Pipeline& pipeline, const Halide::Target& target);
+
+    /**
+     * @brief Writes a schedule source to `<directory>/<key>.schedule.h`.
+     * @details Characters of the key that are not valid in file names are replaced.
+     *          An existing file is kept (the first schedule found for a key is the exported one).
+     *
+     * @param directory Destination directory, created if needed.
+     * @param cache_key Compiled pipeline cache key the schedule belongs to.
+     * @param source Schedule source returned by `apply`.
+     */
+    static void exportSchedule(const std::filesystem::path& directory,
+                               std::string_view cache_key,
+                               const std::string& source);
+
+private:
+    /**
+     * @brief Loads the plugin of an autoscheduler once.
+     * @return true if the plugin is available.
+     */
+    [[nodiscard]] static bool loadPlugin(std::string_view name);
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
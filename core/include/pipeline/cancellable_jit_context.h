@@ -0,0 +1,139 @@
+/**
+ * @file cancellable_jit_context.h
+ * @brief Declaration of CancellableJITContext (JIT user context aborting stale realizations).
+ *
+ * @details
+ * Passed to `Halide::Pipeline::realize`, the context installs a custom `do_task` handler:
+ * Halide invokes it for every task of a `parallel` loop (one strip of rows with the CPU
+ * schedule), and it refuses to start new tasks once the request's token is cancelled.
+ * The realization then unwinds with `k_cancelled_status`, and `realize` throws a
+ * `Halide::RuntimeError` that the executor reports as an aborted pass instead of a failure.
+ *
+ * A newer request therefore stops a stale full-resolution pass within a strip worth of time.
+ * GPU realizations have no host-side tasks: their token is only checked before launch.
+ *
+ * The context also installs `doParFor`, which runs the `parallel` loops on the engine's
+ * `Workers::ComputePool` instead of Halide's thread pool, and, on multi-GPU hosts, the CUDA
+ * context handlers of `ImageProcessing::GpuDevices`. For tiny images (thumbnails, preset
+ * previews) `runSerially` replaces it with `doParForSerial`: the same compiled code, with its
+ * parallel loops run inline on the calling thread, without any pool dispatch.
+ *
+ * When allocation tracking is enabled at startup (`Common::Trace::AllocationTracker`), the
+ * default handlers also route Halide's heap allocations through `trackedMalloc`/`trackedFree`,
+ * and `doParFor` runs the iterations under the trace scope of the realizing thread.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @struct CancellableJITContext
+ * @brief `Halide::JITUserContext` carrying the cancellation token of the running request.
+ */
+struct CancellableJITContext : Halide::JITUserContext {
+    /**
+     * @brief Status returned by the aborted tasks (any non-zero value aborts the pipeline).
+     */
+    static constexpr int k_cancelled_status = -1;
+
+    /**
+     * @brief Binds the token and installs the task handler.
+     * @param token Token of the request being realized.
+     */
+    explicit CancellableJITContext(Common::CancellationToken token);
+
+    /**
+     * @brief Token polled before each parallel task.
+     */
+    Common::CancellationToken m_token;
+
+    /**
+     * @brief Appends the text Halide prints during the realization (e.g. the profiler report)
+     *        to `sink` instead of writing it to stderr.
+     * @param sink Receives the text; must outlive the realization.
+     */
+    void capturePrints(std::string& sink) noexcept;
+
+    /**
+     * @brief Runs the `parallel` loops of the realization inline on the calling thread (`doParForSerial`).
+     * @details For images so small that dispatching their strips to the pool costs more than computing them.
+     */
+    void runSerially() noexcept;
+
+    /**
+     * @brief `custom_do_par_for` handler: runs a `parallel` loop on `Workers::ComputePool`, in the
+     *        lane of the calling task, each iteration through the context's `custom_do_task`.
+     * @details Installed by every `CancellableJITContext`, and as the default handler of all JIT
+     *          pipelines by `installDefaultHandlers`.
+     */
+    static int doParFor(Halide::JITUserContext* context,
+                        int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                        int min,
+                        int extent,
+                        std::uint8_t* closure);
+
+    /**
+     * @brief Makes `doParFor` (and the multi-GPU context handlers) the default handlers of the
+     *        JIT pipelines realized without a `CancellableJITContext` (demosaic, downsampler,
+     *        benchmark, buffer transfers), and, while allocations are tracked, `trackedMalloc`
+     *        and `trackedFree` those of every JIT pipeline.
+     */
+    static void installDefaultHandlers();
+
+    /**
+     * @brief `custom_do_par_for` handler installed by `runSerially`: runs the iterations in order
+     *        on the calling thread, each through the context's `custom_do_task` (cancellation included).
+     */
+    static int doParForSerial(Halide::JITUserContext* context,
+                              int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                              int min,
+                              int extent,
+                              std::uint8_t* closure);
+
+private:
+    /**
+     * @brief Destination of `capturePrints`, or nullptr.
+     */
+    std::string* m_print_sink{nullptr};
+
+    /**
+     * @brief `custom_print` handler: appends to `m_print_sink`.
+     */
+    static void print(Halide::JITUserContext* context, const char* text);
+
+    /**
+     * @brief `custom_do_task` handler: runs the task unless the token is cancelled.
+     */
+    static int doTask(Halide::JITUserContext* context,
+                      int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                      int index,
+                      std::uint8_t* closure);
+
+    /**
+     * @brief `custom_malloc` handler: an aligned allocation reported to the `AllocationTracker`.
+     */
+    static void* trackedMalloc(Halide::JITUserContext* context, std::size_t bytes);
+
+    /**
+     * @brief `custom_free` handler releasing the blocks of `trackedMalloc`.
+     */
+    static void trackedFree(Halide::JITUserContext* context, void* ptr);
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
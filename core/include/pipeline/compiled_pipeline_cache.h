@@ -0,0 +1,143 @@
+/**
+ * @file compiled_pipeline_cache.h
+ * @brief Declaration of CompiledPipelineCache (LRU cache of JIT-compiled Halide pipelines).
+ *
+ * @details
+ * Compiling a fused pipeline with `compile_jit` costs hundreds of milliseconds.
+ * Since the compiled code only depends on the *structure* of the operation chain
+ * (which operations, in which order) and the Halide target, pipelines already seen
+ * can be reused as-is: only their parameter blocks (`Halide::Param` / `Halide::ImageParam`) have to be updated.
+ * Across sessions, CPU pipelines are kept on disk by `PipelineObjectCache`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/fusion_parameter_block.h"
+#include "operations/operation_type.h"
+#include "pipeline/pipeline_object_cache.h"
+
+#include "Halide.h"
+
+#include <cstddef>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @struct CompiledPipelineEntry
+ * @brief A compiled pipeline together with the parameters its graph reads.
+ */
+struct CompiledPipelineEntry {
+    /**
+     * @brief The compiled Halide pipeline.
+     */
+    Halide::Pipeline m_pipeline;
+
+    /**
+     * @brief The same pipeline loaded from the disk cache, run instead of the JIT code when valid.
+     * @details `m_pipeline` is then built but not JIT-compiled.
+     */
+    PipelineObject m_object;
+
+    /**
+     * @brief Runtime parameter blocks, one per fused operation, in chain order.
+     * @details Blocks hold handles: copies refer to the same inputs in the graph.
+     */
+    std::vector<Operations::FusionParameterBlock> m_params;
+
+    /**
+     * @brief Schedule source of an autoscheduled pipeline, empty for the manual schedule.
+     */
+    std::string m_schedule_source;
+};
+
+/**
+ * @class CompiledPipelineCache
+ * @brief Least-recently-used cache of compiled pipelines keyed by chain structure and target.
+ *
+ * @details
+ * **Not thread-safe:** owned by a single executor, whose callers already serialize access.
+ */
+class CompiledPipelineCache {
+public:
+    /**
+     * @brief Default maximum number of cached pipelines.
+     */
+    static constexpr std::size_t k_default_capacity { 16 };
+
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity Maximum number of entries kept before evicting the least recently used.
+     */
+    explicit CompiledPipelineCache(std::size_t capacity = k_default_capacity);
+
+    /**
+     * @brief Builds the cache key for a chain of fused operations.
+     *
+     * @param chain Ordered list of the operation types that are actually fused (enabled ones).
+     * @param target The Halide target the pipeline is compiled for.
+     * @return A string uniquely describing the structure, e.g. "x86-64-linux-avx2|Brightness,Contrast".
+     */
+    [[nodiscard]] static std::string makeKey(const std::vector<Operations::OperationType>& chain,
+                                             const Halide::Target& target);
+
+    /**
+     * @brief Looks up a compiled pipeline and marks it as most recently used.
+     * @param key Key produced by `makeKey`.
+     * @return A copy of the entry (cheap, handles only), or `std::nullopt` on a miss.
+     */
+    [[nodiscard]] std::optional<CompiledPipelineEntry> find(const std::string& key);
+
+    /**
+     * @brief Inserts (or replaces) a compiled pipeline, evicting the least recently used if full.
+     * @param key Key produced by `makeKey`.
+     * @param entry The compiled pipeline and its parameters.
+     */
+    void insert(const std::string& key, CompiledPipelineEntry entry);
+
+    /**
+     * @brief Changes the maximum number of entries, evicting the least recently used past it.
+     * @param capacity Maximum number of entries, or 0 for `k_default_capacity`.
+     */
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * @brief Removes all cached pipelines.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Gets the number of cached pipelines.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+    /**
+     * @brief Entries ordered from most to least recently used.
+     */
+    std::list<std::pair<std::string, CompiledPipelineEntry>> m_entries;
+
+    /**
+     * @brief Index from key to position in `m_entries`.
+     */
+    std::unordered_map<std::string, std::list<std::pair<std::string, CompiledPipelineEntry>>::iterator> m_index;
+
+    /**
+     * @brief Maximum number of entries.
+     */
+    std::size_t m_capacity;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
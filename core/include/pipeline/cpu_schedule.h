@@ -0,0 +1,39 @@
+/**
+ * @file cpu_schedule.h
+ * @brief Enum selecting how fused pipelines are scheduled on the CPU.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @brief Loop structure of the CPU schedule of the fused pipelines.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class CpuSchedule : std::uint8_t {
+    /**
+     * @brief Full-width strips of rows, one parallel task per strip.
+     * @details Shared per-pixel stages are recomputed for every vector of pixels (registers).
+     */
+    Strips = 0,
+
+    /**
+     * @brief Cache-sized 2D tiles, one parallel task per tile.
+     * @details Intermediate stages (luminance, masks) are realized once per tile into a
+     *          buffer that stays in L2, which spatial stages need and which improves the
+     *          locality of per-pixel chains on many-core machines.
+     */
+    Tiles = 1
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
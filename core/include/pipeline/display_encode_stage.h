@@ -0,0 +1,88 @@
+/**
+ * @file display_encode_stage.h
+ * @brief Declaration of DisplayEncodeStage (downsample + sRGB encode + RGBA8 quantize).
+ *
+ * @details
+ * Optional second output of the fused pipeline (see `OperationPipelineExecutor::setDisplayOutputSize`).
+ * It reads the linear float result of the chain and, within the same realization,
+ * produces the viewport image: box downsample, sRGB OETF, 8-bit quantization.
+ * The UI receives display-ready bytes and performs no conversion pass of its own.
+ *
+ * The display size is bound through `Halide::Param`s, so resizing the viewport does not recompile.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+#include "common/types/region_of_interest.h"
+
+#include "Halide.h"
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class DisplayEncodeStage
+ * @brief Builds and parameterizes the display output of a fused pipeline.
+ *
+ * @details
+ * The `Halide::Param`s are owned by the stage and shared by every pipeline it was appended to,
+ * so a single `bind` serves whichever cached pipeline runs next.
+ */
+class DisplayEncodeStage {
+public:
+    /**
+     * @brief Constructs the stage (no Halide graph is built yet).
+     */
+    DisplayEncodeStage();
+
+    /**
+     * @brief Appends the display output to a linear RGBA function.
+     *
+     * @param linear The processed, linear float RGBA result (the chain output).
+     *               Only the source rectangle of `bind` is read.
+     * @param target Target the pipeline is compiled for (picks the schedule).
+     * @return A UInt(8) function holding sRGB-encoded RGBA8 pixels, scheduled and constrained
+     *         to the interleaved layout. `linear` must be computed at root (pipeline output).
+     */
+    [[nodiscard]] Halide::Func append(const Halide::Func& linear, const Halide::Target& target);
+
+    /**
+     * @brief Sets the source rectangle and the scale parameters for the next realization.
+     *
+     * @param source Rectangle of the processed image shown: the whole image, or its crop.
+     * @param display_width Width of the display output.
+     * @param display_height Height of the display output.
+     */
+    void bind(const Common::RegionOfInterest& source,
+              Common::ImageDim display_width, Common::ImageDim display_height);
+
+private:
+    /**
+     * @brief Source pixels per display pixel.
+     */
+    Halide::Param<float> m_scale_x;
+    Halide::Param<float> m_scale_y;
+
+    /**
+     * @brief Box filter footprint, in source pixels.
+     */
+    Halide::Param<int> m_taps_x;
+    Halide::Param<int> m_taps_y;
+
+    /**
+     * @brief Source rectangle read, in pixels of the processed image.
+     */
+    Halide::Param<int> m_origin_x;
+    Halide::Param<int> m_origin_y;
+    Halide::Param<int> m_extent_x;
+    Halide::Param<int> m_extent_y;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -39,7 +39,8 @@ namespace Pipeline {
  * to an image when optimized execution paths are not available.
  * It works by:
  * 1. Exporting the image data to a CPU copy (`ImageRegion`).
- * 2. Applying each enabled operation sequentially to the CPU copy using `IOperationDefaultLogic`.
+ * 2. Applying each enabled operation sequentially to the CPU copy: per-pixel operations
+ *    through their `FallbackKernels` entry, the others through `IOperationDefaultLogic`.
  * 3. Updating the original image with the processed CPU copy.
  *
  * This is significantly slower than fused execution but ensures compatibility
@@ -68,10 +69,10 @@ public:
      *
      * @details
      * This method implements the fallback execution logic:
-     * 1. Exports the `working_image` to a CPU copy using `exportToCPUCopy()`.
-     * 2. Iterates through the stored operations, instantiates each one via the factory,
-     *    casts it to `IOperationDefaultLogic`, and applies its `executeOnImageRegion` logic
-     *    to the CPU copy.
+     * 1. Copies the `working_image` to a CPU region through `exportToCPUView()`.
+     * 2. Iterates through the stored operations. An operation with a `FallbackKernels` entry
+     *    runs it directly; the others are instantiated via the factory, cast to
+     *    `IOperationDefaultLogic`, and apply their `executeOnImageRegion` logic to the CPU copy.
      * 3. Updates the `working_image` with the processed CPU copy using `updateFromCPU()`.
      *
      * @param[in,out] working_image The hardware-agnostic image to process.
@@ -0,0 +1,74 @@
+/**
+ * @file geometry_stage.h
+ * @brief Declaration of GeometryStage (straightened input sampling of the fused pipeline).
+ *
+ * @details
+ * A straightened crop (see `Operations::CropGeometry`) is not a pass over the image: the first
+ * Func of the chain reads its input through an affine map of the output coordinates, with
+ * bilinear interpolation, and every operation downstream computes the straightened pixels
+ * directly. The realization bounds restrict it to the crop rectangle.
+ *
+ * The six coefficients are `Halide::Param`s, so turning the angle or moving the rectangle only
+ * rebinds them; one compiled variant serves every straightened chain of a structure.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/geometry_operations/crop_geometry.h"
+#include "common/types/image_types.h"
+
+#include "Halide.h"
+
+#include <array>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class GeometryStage
+ * @brief Builds and parameterizes the straightened sampling of a fused pipeline input.
+ *
+ * @details
+ * The `Halide::Param`s are owned by the stage and shared by every pipeline it was appended to,
+ * so a single `bind` serves whichever cached pipeline runs next.
+ */
+class GeometryStage {
+public:
+    /**
+     * @brief Constructs the stage, bound to the identity map.
+     */
+    GeometryStage();
+
+    /**
+     * @brief Resamples a function through the affine map.
+     *
+     * @param input The chain input, defined everywhere (edge-clamped by the executor).
+     * @param x The Halide variable for the x dimension, shared across all operations.
+     * @param y The Halide variable for the y dimension, shared across all operations.
+     * @param c The Halide variable for the channel dimension, shared across all operations.
+     * @return The bilinearly interpolated function, in output coordinates.
+     */
+    [[nodiscard]] Halide::Func append(const Halide::Func& input,
+                                      const Halide::Var& x,
+                                      const Halide::Var& y,
+                                      const Halide::Var& c) const;
+
+    /**
+     * @brief Sets the map of a geometry on an image of the given size, for the next realization.
+     */
+    void bind(const Operations::CropGeometry& geometry, Common::ImageDim width, Common::ImageDim height);
+
+private:
+    /**
+     * @brief Coefficients of the map, row-major (see `CropGeometry::sampling`).
+     */
+    std::array<Halide::Param<float>, 6> m_coefficients;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,95 @@
+/**
+ * @file histogram_stage.h
+ * @brief Declaration of HistogramStage (histogram of the display output, in the same realization).
+ *
+ * @details
+ * Optional third output of the fused pipeline (see `OperationPipelineExecutor::setHistogramOutput`).
+ * It reads the display output (`DisplayEncodeStage`), already computed by the realization, and
+ * reduces it into 256-bin red, green, blue and luma histograms: a Halide `RDom` update whose
+ * rows are split into chunks counted in parallel into partial histograms (`rfactor`), then summed.
+ * The display image being small, the histogram costs a fraction of the display encode and no
+ * pass over the full-resolution buffer.
+ *
+ * CPU targets only: GPU histograms need atomics the schedules do not use; there, the executor
+ * counts the downloaded display image on the host instead (`computeOnHost`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+#include "common/preview_histogram.h"
+#include "common/types/image_types.h"
+
+#include "Halide.h"
+
+#include <memory>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class HistogramStage
+ * @brief Builds and parameterizes the histogram output of a fused pipeline.
+ *
+ * @details
+ * Like `DisplayEncodeStage`, the `Halide::Param`s are owned by the stage and shared by every
+ * pipeline it was appended to.
+ */
+class HistogramStage {
+public:
+    /**
+     * @brief Display rows counted by each partial histogram.
+     */
+    static constexpr int k_rows_per_partial = 32;
+
+    /**
+     * @brief Constructs the stage (no Halide graph is built yet).
+     */
+    HistogramStage();
+
+    /**
+     * @brief Appends the histogram output to the display output.
+     *
+     * @param display The UInt(8) RGBA display function (a pipeline output).
+     * @param target Target the pipeline is compiled for (must be a CPU target).
+     * @return A UInt(32) function over (code, channel), `PreviewHistogram::k_bins` by
+     *         `PreviewHistogram::k_channels`, laid out as `PreviewHistogram::m_counts`.
+     */
+    [[nodiscard]] Halide::Func append(const Halide::Func& display, const Halide::Target& target);
+
+    /**
+     * @brief Sets the size of the display image for the next realization.
+     */
+    void bind(Common::ImageDim display_width, Common::ImageDim display_height);
+
+    /**
+     * @brief Allocates a buffer the histogram output can be realized into.
+     */
+    [[nodiscard]] static Halide::Buffer<uint32_t> makeBuffer();
+
+    /**
+     * @brief Copies a realized histogram buffer and derives its statistics.
+     */
+    [[nodiscard]] static std::shared_ptr<const Common::PreviewHistogram> read(const Halide::Buffer<uint32_t>& buffer);
+
+    /**
+     * @brief Counts a display image on the host (GPU passes, cached results).
+     * @return The histogram, or nullptr if the image has no host pixels.
+     */
+    [[nodiscard]] static std::shared_ptr<const Common::PreviewHistogram> computeOnHost(const Common::DisplayImage& image);
+
+private:
+    /**
+     * @brief Size of the display image the histogram counts.
+     */
+    Halide::Param<int> m_width;
+    Halide::Param<int> m_height;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
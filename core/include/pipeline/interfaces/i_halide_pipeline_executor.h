@@ -19,6 +19,8 @@
 
 #include "Halide.h"
 
+#include "image_processing/halide/halide_buffer_layout.h"
+
 namespace CaptureMoment::Core {
 
 namespace Pipeline {
@@ -40,13 +42,31 @@ public:
     virtual ~IHalidePipelineExecutor() = default;
 
     /**
-     * @brief Executes the compiled pipeline directly on a Halide buffer.
+     * @brief Executes the compiled pipeline from an input buffer into an output buffer.
+     *
+     * @details
+     * Input and output must be distinct buffers of identical shape: the pipeline reads
+     * `input` through `m_input` and realizes into `output`.
+     *
+     * @param[in] input The Halide buffer holding the source image.
+     *                  Must be a 4-channel Float32 buffer to match `m_input`.
+     * @param[out] output The Halide buffer receiving the processed image.
+     * @return true if pipeline executed successfully.
+     */
+    [[nodiscard]] virtual bool executeOnHalideBuffer(const Halide::Buffer<float>& input, Halide::Buffer<float>& output) = 0;
+
+    /**
+     * @brief Half-float variant of `executeOnHalideBuffer` (`RGBA_F16` working images).
+     *
+     * @details
+     * The pipeline reads `input` through `m_input_half`, computes in float and stores halves.
      *
-     * @param[in,out] buffer The Halide buffer pointing to image data.
-     *                       Must be a 4-channel Float32 buffer to match `m_input`.
+     * @param[in] input 4-channel Float16 interleaved source buffer.
+     * @param[out] output Float16 destination buffer, same shape as `input`.
      * @return true if pipeline executed successfully.
      */
-    [[nodiscard]] virtual bool executeOnHalideBuffer(Halide::Buffer<float>& buffer) = 0;
+    [[nodiscard]] virtual bool executeOnHalideBuffer(const Halide::Buffer<Halide::float16_t>& input,
+                                                     Halide::Buffer<Halide::float16_t>& output) = 0;
 
 protected:
     /**
@@ -55,15 +75,27 @@ protected:
      * Initializes the shared ImageParam with the application standard:
      * - Type: Float(32)
      * - Dimensions: 4 (x, y, c) where c is {R, G, B, A}
+     * - Layout: interleaved (x stride 4, c stride 1), matching `Common::ImageRegion`
+     * The planar parameters take planar working images (x stride 1).
      */
     IHalidePipelineExecutor()
-        : m_input(Halide::Float(32), 3){}
+        : m_input(Halide::Float(32), 3, "input")
+        , m_input_half(Halide::Float(16), 3, "input_half")
+        , m_input_planar(Halide::Float(32), 3, "input_planar")
+        , m_input_half_planar(Halide::Float(16), 3, "input_half_planar")
+    {
+        ImageProcessing::constrainInterleaved(m_input);
+        ImageProcessing::constrainInterleaved(m_input_half);
+        ImageProcessing::constrainPlanar(m_input_planar);
+        ImageProcessing::constrainPlanar(m_input_half_planar);
+    }
 
     /**
      * @brief The shared Halide Input Parameter.
      * @details
      * Fixed to 4 dimensions (0, 1, 2, 3 -> x, y, c, ?).
      * All pipeline definitions in derived classes should start from this `m_input`.
+     * Bound buffers must be interleaved (see `ImageProcessing::wrapInterleaved`).
      * 
      * Example usage in derived class:
      * @code
@@ -72,6 +104,22 @@ protected:
      * @endcode
      */
     Halide::ImageParam m_input;
+
+    /**
+     * @brief Input parameter for half-float (`RGBA_F16`) working images.
+     * @details Same layout as `m_input`. Pipelines widen it to float on load.
+     */
+    Halide::ImageParam m_input_half;
+
+    /**
+     * @brief Input parameter for planar float working images (see `AppConfig::setWorkingPixelLayout`).
+     */
+    Halide::ImageParam m_input_planar;
+
+    /**
+     * @brief Input parameter for planar half-float working images.
+     */
+    Halide::ImageParam m_input_half_planar;
 };
 
 } // namespace Pipeline
@@ -10,7 +10,45 @@
  * - **Inheritance**: Inherits `m_input` (4-channel Float32) from `IHalidePipelineExecutor`.
  * - **Single Compilation**: Uses `Halide::Pipeline` object to store the compiled JIT code.
  *   The compilation happens once in `init()` when operations change, not during execution.
+ *   Compiled pipelines are kept in an LRU cache keyed by chain structure and target.
+ * - **AOT Fast Path**: On the CPU backend, chains made only of the basic tone adjustments
+ *   (in canonical order) run on the ahead-of-time kernel when it is built, skipping JIT compilation.
+ * - **Parameter Blocks**: Each fused operation declares its runtime inputs (named scalars,
+ *   lookup tables) in a `FusionParameterBlock`; edits update the block, never the graph.
+ * - **Tone LUT**: Chains made only of basic tone adjustments (any order, at least two) are baked
+ *   on the CPU into a lookup table (`ToneLutStage`) that the pipeline interpolates: constant
+ *   per-pixel cost, and one compiled pipeline shared by all such chains.
+ * - **Shared Luminance**: The luminance-masked adjustments of a chain share one luminance
+ *   (`FusedLuminance`), propagated from stage to stage and computed once per pixel.
  * - **Zero-Copy**: Execution binds the user's buffer to the inherited `m_input` and runs the pipeline.
+ * - **Half-Float Storage**: `RGBA_F16` working images run a pipeline variant that loads halves
+ *   (`m_input_half`), computes in float and stores halves.
+ * - **Small Images**: CPU realizations of at most `k_serial_max_pixels` (thumbnails, preset
+ *   previews) run their parallel loops inline on the calling thread, and the target is cached
+ *   until the configured targets change.
+ * - **Planar Storage**: Planar working images run a variant constrained to planar strides on
+ *   both ends (`m_input_planar`): each channel of a vector of pixels is one dense load and store.
+ * - **Fused Display Output**: When a display size is set, the JIT pipeline gets a second output
+ *   (`DisplayEncodeStage`) that downsamples, sRGB-encodes and quantizes the result in the same
+ *   realization, so the viewport image needs no separate pass over the full-resolution buffer.
+ * - **Fused Histogram**: Optionally, a third output (`HistogramStage`) reduces the display output
+ *   into red, green, blue and luma histograms in the same realization (CPU targets).
+ * - **Crop as Coordinates**: A Crop descriptor is not a pass. Its rectangle bounds every
+ *   realization (the pixels outside are never computed) and the display output shows it alone;
+ *   a straightened crop samples the chain input through an affine map (`GeometryStage`), after
+ *   the lens correction if the chain has one (both are moved to the front of the chain).
+ * - **Cached Stages**: Stages an operation declares cacheable (`FusionParameterBlock::cachedStage`)
+ *   are extra outputs written to full-image buffers; while the input and the edits upstream of
+ *   the operation are unchanged, a second compiled variant reads the buffers instead.
+ * - **Memoized Outputs**: The output of an expensive operation (`memoizesOutput`: denoise, clarity,
+ *   lens correction) is written to a full-image buffer as well. While the input and the edits up to
+ *   that operation are unchanged, the chain resumes from the last valid one: a variant compiled
+ *   without the operations before it, which reads the buffer as its input.
+ * - **Interactive Chains**: While a control is dragged (`setInteractiveOperation`), its operation
+ *   stays in the graph even when neutral, and the expensive operations after it (whose memoized
+ *   output each tick would invalidate) are deferred: the graph holds for the whole gesture.
+ *   An expensive operation that allows it (`upsamplesPreview`, e.g. denoise) runs on a reduced copy
+ *   of its input for the gesture, its effect transferred to every pixel (`GuidedUpsampling`).
  *
  * @author CaptureMoment Team
  * @date 2026
@@ -22,12 +60,34 @@
 
 #include "pipeline/interfaces/i_pipeline_executor.h"
 #include "pipeline/interfaces/i_halide_pipeline_executor.h"
+#include "pipeline/compiled_pipeline_cache.h"
+#include "pipeline/aot_tone_kernel.h"
+#include "pipeline/display_encode_stage.h"
+#include "pipeline/geometry_stage.h"
+#include "pipeline/histogram_stage.h"
+#include "pipeline/tone_lut_stage.h"
+#include "pipeline/cpu_schedule.h"
+#include "pipeline/pipeline_stats.h"
 #include "operations/operation_descriptor.h"
 #include "operations/operation_factory.h"
+#include "operations/geometry_operations/crop_geometry.h"
 #include "common/types/memory_type.h"
+#include "common/pixel_format.h"
+#include "common/types/region_of_interest.h"
+#include "common/display_image.h"
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
 
 #include <vector>
+#include <expected>
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <cstdint>
+#include <string>
 
 namespace CaptureMoment::Core {
 
@@ -48,7 +108,8 @@ public:
      * @brief Default Constructor.
      *
      * @details
-     * Initializes the backend configuration (CPU/GPU) from AppConfig.
+     * Initializes the starting backend (CPU/GPU) from AppConfig. The backend then follows
+     * the working images passed to `execute`.
      * The `m_input` member is initialized by the base class.
      */
     OperationPipelineExecutor();
@@ -63,8 +124,9 @@ public:
      *
      * @details
      * This is the entry point for the generic `IPipelineExecutor` interface.
-     * It performs a dynamic cast to determine if the image is CPU or GPU Halide-compatible
-     * and dispatches to the template method `executeWithConcreteHalide`.
+     * It performs a dynamic cast to determine if the image is CPU or GPU Halide-compatible,
+     * switches the executor to that backend if needed, and dispatches to the template
+     * method `executeWithConcreteHalide`.
      *
      * @param[in,out] working_image The hardware-agnostic image to process.
      * @return true if execution succeeded, false otherwise.
@@ -76,12 +138,28 @@ public:
      *
      * @details
      * Implements the `IHalidePipelineExecutor` interface.
-     * Binds the provided buffer to the inherited `m_input` and executes the cached pipeline.
+     * Binds `input` to the inherited `m_input` and realizes the cached pipeline into `output`.
+     * If no chain is built (empty or all-disabled operations), `input` is copied to `output`.
      *
-     * @param[in,out] buffer The `Halide::Buffer<float>` pointing to image data (Must be 4-channel).
+     * @param[in] input The source `Halide::Buffer<float>` (Must be 4-channel, interleaved).
+     * @param[out] output The destination `Halide::Buffer<float>`, same shape and layout as `input`.
      * @return true if pipeline executed successfully.
      */
-    [[nodiscard]] virtual bool executeOnHalideBuffer(Halide::Buffer<float>& buffer) override;
+    [[nodiscard]] virtual bool executeOnHalideBuffer(const Halide::Buffer<float>& input, Halide::Buffer<float>& output) override;
+
+    /**
+     * @brief Half-float variant of the fast path (`RGBA_F16` working images).
+     *
+     * @details
+     * Switches the executor to the half-float pipeline variant if needed (input widened on
+     * load, result narrowed on store). The AOT tone kernel is float-only and is not used.
+     *
+     * @param[in] input The source `Halide::Buffer<Halide::float16_t>` (4-channel, interleaved).
+     * @param[out] output The destination buffer, same shape and layout as `input`.
+     * @return true if pipeline executed successfully.
+     */
+    [[nodiscard]] virtual bool executeOnHalideBuffer(const Halide::Buffer<Halide::float16_t>& input,
+                                                     Halide::Buffer<Halide::float16_t>& output) override;
 
     /**
      * @brief Updates the list of operations and rebuilds the graph.
@@ -107,6 +185,20 @@ public:
         const Operations::OperationFactory& factory
     );
 
+    /**
+     * @brief Compiles the pipeline of a chain into the pipeline cache ahead of its first execution.
+     *
+     * @details
+     * Built for the current backend, storage format and display outputs, without a region of
+     * interest (the first pass of an image renders all of it). The current chain is rebuilt
+     * afterwards (a cache hit), so a pass initialized before still runs its own operations; a
+     * later `init` with the warmed structure is then a cache hit as well.
+     *
+     * @param operations The list of operation descriptors (moved).
+     * @param factory The operation factory reference.
+     */
+    void warmUp(std::vector<Operations::OperationDescriptor>&& operations, const Operations::OperationFactory& factory);
+
     /**
      * @brief Updates the runtime values of the cached parameters WITHOUT recompiling.
      *
@@ -121,6 +213,154 @@ public:
      */
     void updateRuntimeParams(std::vector<Operations::OperationDescriptor>&& operations);
 
+    /**
+     * @brief Fingerprint of the structure of a chain: the id, type and state of each operation, in order.
+     *
+     * @details
+     * Parameter values are left out: two lists with the same fingerprint only differ by values,
+     * which `updateRuntimeParams` rebinds. Any other difference (an operation added, removed,
+     * moved, enabled or disabled) calls for `init`.
+     */
+    [[nodiscard]] static std::uint64_t structureFingerprint(std::span<const Operations::OperationDescriptor> operations) noexcept;
+
+    /**
+     * @brief `structureFingerprint` of the operations passed to the last `init`, or std::nullopt before it.
+     */
+    [[nodiscard]] std::optional<std::uint64_t> initializedStructure() const noexcept { return m_initialized_structure; }
+
+    /**
+     * @brief Restricts the next executions to a region of interest.
+     *
+     * @details
+     * When set, `executeOnHalideBuffer` realizes the pipeline into a cropped view of the
+     * output buffer, so only the pixels inside the region are computed. Pixels outside
+     * keep their previous content. The input is still bound in full, so operations may
+     * read neighbouring pixels across the region border. The region is intersected with
+     * the crop of the operations, which bounds every execution.
+     *
+     * @param roi The region to compute, in full-resolution coordinates, or `std::nullopt` for the full image.
+     */
+    void setRegionOfInterest(std::optional<Common::RegionOfInterest> roi) noexcept;
+
+    /**
+     * @brief Sets the token of the request the next executions belong to.
+     *
+     * @details
+     * CPU JIT realizations poll it before every parallel task (see `CancellableJITContext`)
+     * and stop early once it is cancelled; every execution also checks it before starting.
+     * An aborted execution returns false, leaves the output partially updated and
+     * produces no display image.
+     *
+     * @param token The request token (a default token is never cancelled).
+     */
+    void setCancellationToken(Common::CancellationToken token) noexcept;
+
+    /**
+     * @brief Requests a display image of the given size from the next executions.
+     *
+     * @details
+     * Full-image JIT executions then also produce an sRGB RGBA8 image of this size
+     * (see `takeDisplayImage`). Executions restricted to a region of interest, or served
+     * by the AOT kernel or the identity copy, produce none; the caller falls back to
+     * downsampling the working image. With a crop, the image shows the crop alone, fitted
+     * into this size (its aspect ratio kept).
+     * Only the first request (and a change of backend or chain) compiles; the size itself
+     * is a runtime parameter.
+     *
+     * @param width Display width in pixels (> 0).
+     * @param height Display height in pixels (> 0).
+     */
+    void setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Stops producing the display image and drops the display output from the pipeline.
+     */
+    void clearDisplayOutput();
+
+    /**
+     * @brief Keeps the display image of GPU executions on the device.
+     * @details
+     * When enabled and the pipeline runs on a Metal target, `takeDisplayImage` hands out
+     * the device buffer (`DisplayImage::m_device`) instead of downloading it. Each handed
+     * out buffer is left to its holder; the next execution realizes into a fresh one.
+     * Other GPU APIs keep the host copy (their runtimes expose no native handle).
+     * @param enabled true if the display consumer can sample device buffers.
+     */
+    void setDisplayOnDevice(bool enabled) noexcept { m_display_on_device = enabled; }
+
+    /**
+     * @brief Attaches a histogram to the display images of the next executions.
+     * @details
+     * On CPU targets, the histogram is a third output of the realization (see `HistogramStage`);
+     * the first execution after enabling it compiles the variant, both stay cached. On GPU
+     * targets, the downloaded display image is counted on the host. Device-resident display
+     * images get none.
+     * @param enabled true to fill `DisplayImage::m_histogram`.
+     */
+    void setHistogramOutput(bool enabled) noexcept { m_histogram_enabled = enabled; }
+
+    /**
+     * @brief Shapes the chain for a gesture on one operation, or back to full quality.
+     * @details
+     * While set, the operation is bound even when neutral (crossing its neutral value rebinds
+     * nothing), the memoizing operations after it in the chain are left out until the gesture
+     * ends, and it is computed at reduced resolution if it allows it (see
+     * `Config::AppConfig::setGuidedPreviewUpsampling`); its output is then not memoized.
+     * The next `init` rebuilds the chain; executions in between run the old one.
+     * @param operation_id Id of the operation under the gesture, or `std::nullopt` when it ends.
+     */
+    void setInteractiveOperation(std::optional<std::uint64_t> operation_id) noexcept;
+
+    /**
+     * @brief Hands over the display image produced by the last execution, if any.
+     * @return The image, or `std::nullopt` if the last execution produced none.
+     */
+    [[nodiscard]] std::optional<Common::DisplayImage> takeDisplayImage();
+
+    /**
+     * @brief Switches the profiling mode on or off (rebuilds the chain).
+     *
+     * @details
+     * Profiled chains are JIT-compiled with `Halide::Target::Profile`, without the AOT kernel,
+     * the tone table or the autoscheduler, and each operation is computed into its own buffer
+     * (see `PipelineStats`). Each realization then records its per-Func report, available from
+     * `lastPipelineStats()` and forwarded to the trace export when tracing is on.
+     *
+     * @param enabled true to profile the next executions.
+     */
+    void setProfiling(bool enabled);
+
+    /**
+     * @brief Checks whether executions are profiled.
+     */
+    [[nodiscard]] bool isProfiling() const noexcept { return m_profiling; }
+
+    /**
+     * @brief Profiler report of the last profiled realization, if any.
+     */
+    [[nodiscard]] const std::optional<PipelineStats>& lastPipelineStats() const noexcept { return m_last_stats; }
+
+    /**
+     * @brief Writes the current fused pipeline to a diagnostics folder, to reproduce a field report.
+     *
+     * @details
+     * Creates `<directory>/pipeline-<time>/` with:
+     * - `lowered.stmt.html` and `lowered.stmt`: the lowered statement for the pipeline target
+     *   (`compile_to_lowered_stmt`): loops, vectorization, allocations, GPU kernels;
+     * - `loop_nest.txt`: the schedule of every Func, as a loop nest;
+     * - `schedule.h`: the schedule found by the autoscheduler, for an autoscheduled chain;
+     * - `manifest.txt`: the target, backend, storage, scheduling options, cache key, operations,
+     *   and the bounds of the last realization (input, output region, display and histogram outputs).
+     *
+     * A chain run by the AOT tone kernel, or with nothing to realize, only gets the manifest.
+     * Lowering recompiles nothing that runs: call it between executions.
+     *
+     * @param directory Diagnostics folder, created if needed.
+     * @return The folder written, or `IOError`.
+     */
+    [[nodiscard]] std::expected<std::filesystem::path, ErrorHandling::CoreError>
+    dumpDiagnostics(const std::filesystem::path& directory) const;
+
 private:
     /**
      * @brief Stores the list of operations to be fused.
@@ -142,38 +382,526 @@ private:
      */
     Halide::Pipeline m_pipeline;
 
+    /**
+     * @brief `m_pipeline` loaded from the disk cache (CPU), run instead of the JIT code when valid.
+     */
+    PipelineObject m_pipeline_object;
+
+    /**
+     * @struct FusedBinding
+     * @brief A fused operation and the parameter block its part of the graph reads.
+     */
+    struct FusedBinding {
+        /**
+         * @brief The operation instance; kept to refresh the block on parameter edits.
+         */
+        std::unique_ptr<Operations::IOperation> m_operation;
+
+        /**
+         * @brief Fusion interface of `m_operation` (non-owning).
+         */
+        const Operations::IOperationFusionLogic* m_fusion_logic{nullptr};
+
+        /**
+         * @brief Handles on the runtime inputs used in the compiled graph.
+         */
+        Operations::FusionParameterBlock m_params;
+
+        /**
+         * @brief True if the graph blends the operation by its local mask (see `MaskSampler`).
+         */
+        bool m_masked{false};
+
+        /**
+         * @brief True if the operation's output is memoized (see `IOperationFusionLogic::memoizesOutput`).
+         */
+        bool m_memoizes{false};
+    };
+
     /**
      * @brief Cache of dynamic parameters for the current pipeline.
      * @details
      * Key: Operation id
-     * Value: The Halide::Param<float> object used in the compiled graph.
+     * Value: The operation and the parameter block (scalars, lookup tables) used in the compiled graph.
+     */
+    std::unordered_map<uint64_t, FusedBinding> m_pipeline_params;
+
+    /**
+     * @brief Operations left out of the current graph as identities (see `IOperationFusionLogic::isIdentity`).
+     * @details
+     * Key: Operation id. Kept to tell, on a parameter edit, when one of them starts changing
+     * pixels and the chain has to be rebuilt with it.
+     */
+    std::unordered_map<uint64_t, std::unique_ptr<Operations::IOperation>> m_identity_operations;
+
+    /**
+     * @brief Operation under the gesture, if any (see `setInteractiveOperation`).
+     */
+    std::optional<std::uint64_t> m_interactive_operation;
+
+    /**
+     * @brief Ids of the expensive operations left out of the chain until the gesture ends.
+     */
+    std::vector<std::uint64_t> m_deferred_operations;
+
+    /**
+     * @brief LRU cache of previously compiled pipelines.
+     * @details
+     * Keyed by the ordered list of fused operation types and the Halide target, so that
+     * toggling an operation off and back on reuses the earlier compilation.
+     */
+    CompiledPipelineCache m_pipeline_cache;
+
+    /**
+     * @brief Arguments of the AOT tone kernel when the current chain runs on it.
+     * @details `std::nullopt` means the JIT pipeline (or the identity copy) is used.
+     */
+    std::optional<ToneKernelArguments> m_aot_arguments;
+
+    /**
+     * @brief Table stage shared by every tone LUT pipeline.
+     */
+    ToneLutStage m_tone_lut;
+
+    /**
+     * @brief True if the current pipeline is the tone LUT one (parameters live in `m_tone_lut`).
+     */
+    bool m_tone_lut_active{false};
+
+    /**
+     * @brief Most operations given a branch of their own by `specializeNeutralOperations`.
+     * @details Each branch is another copy of the chain's kernel: code size and compilation
+     *          time grow with it.
+     */
+    static constexpr std::size_t k_max_single_operation_branches{4};
+
+    /**
+     * @brief Realized pixels up to which a CPU realization runs on the calling thread alone.
+     * @details Thumbnails and preset previews (256x170 and alike): their strips are computed
+     *          faster than they are dispatched to the pool, and a batch of them keeps every
+     *          worker busy with whole images instead.
+     */
+    static constexpr std::int64_t k_serial_max_pixels{std::int64_t{1} << 17};
+
+    /**
+     * @brief Copy of the pipeline target, for `m_target_generation` of the configured targets.
+     * @details Reset when the backend or the profiling mode changes (see `pipelineTarget`).
+     */
+    mutable std::optional<Halide::Target> m_target;
+
+    /**
+     * @brief `Config::AppConfig::targetGeneration()` `m_target` was read at.
+     */
+    mutable std::uint64_t m_target_generation{0};
+
+    /**
+     * @brief CPU loop structure the current pipeline is built with.
+     * @details Read from AppConfig at every build.
+     */
+    CpuSchedule m_cpu_schedule{CpuSchedule::Strips};
+
+    /**
+     * @brief Edge of the CPU tiles of the current pipeline with `CpuSchedule::Tiles`.
+     * @details Read from AppConfig at every build.
      */
-    std::unordered_map<uint64_t, Halide::Param<float>> m_pipeline_params;
+    int m_cpu_tile_size{0};
 
     /**
-     * @brief Cached backend type (CPU/GPU) from AppConfig.
+     * @brief Backend (CPU/GPU) the current pipeline is built for.
+     * @details Initialized from AppConfig, then follows the executed working images.
      */
     Common::MemoryType m_backend{Common::MemoryType::CPU_RAM};
 
+    /**
+     * @brief Storage format (element type) of the buffers the current pipeline is built for.
+     * @details Follows the executed working images, like `m_backend`.
+     */
+    Common::PixelFormat m_storage_format{Common::PixelFormat::RGBA_F32};
+
+    /**
+     * @brief Layout of the buffers the current pipeline is built for.
+     * @details Follows the executed working images, like `m_storage_format`.
+     */
+    Common::PixelLayout m_storage_layout{Common::PixelLayout::Interleaved};
+
     /**
      * @brief Flag indicating if the pipeline has been successfully built and compiled.
      */
     bool m_chain_built{false};
 
+    /**
+     * @brief `structureFingerprint` of the operations passed to the last `init`.
+     */
+    std::optional<std::uint64_t> m_initialized_structure;
+
+    /**
+     * @brief Optional region restricting the realized output.
+     */
+    std::optional<Common::RegionOfInterest> m_roi;
+
+    /**
+     * @brief Token of the request being executed.
+     */
+    Common::CancellationToken m_cancellation;
+
+    /**
+     * @brief Crop of the current operations, if any (see `Operations::CropGeometry`).
+     */
+    std::optional<Operations::CropGeometry> m_crop;
+
+    /**
+     * @brief Builds and parameterizes the straightened sampling of the chain input.
+     */
+    GeometryStage m_geometry_stage;
+
+    /**
+     * @brief True if the last JIT build samples its input through the geometry stage.
+     */
+    bool m_pipeline_has_geometry{false};
+
+    /**
+     * @brief Builds and parameterizes the display output appended to the chain.
+     */
+    DisplayEncodeStage m_display_stage;
+
+    /**
+     * @brief Requested display size, or `std::nullopt` when no display output is wanted.
+     */
+    std::optional<std::pair<Common::ImageDim, Common::ImageDim>> m_display_size;
+
+    /**
+     * @brief True if the last JIT build included the display output.
+     */
+    bool m_pipeline_has_display{false};
+
+    /**
+     * @brief Display output buffer (interleaved RGBA8), reused while the size is unchanged.
+     */
+    Halide::Buffer<uint8_t> m_display_buffer;
+
+    /**
+     * @brief Builds and parameterizes the histogram output appended to the display output.
+     */
+    HistogramStage m_histogram_stage;
+
+    /**
+     * @brief True if display images carry a histogram (see `setHistogramOutput`).
+     */
+    bool m_histogram_enabled{false};
+
+    /**
+     * @brief True if the last JIT build included the histogram output.
+     */
+    bool m_pipeline_has_histogram{false};
+
+    /**
+     * @brief Histogram output buffer, reused by every execution.
+     */
+    Halide::Buffer<uint32_t> m_histogram_buffer;
+
+    /**
+     * @struct CachedStageBuffer
+     * @brief Full-image result of a cached stage (see `FusionParameterBlock::cachedStage`).
+     */
+    struct CachedStageBuffer {
+        Halide::Buffer<float> m_buffer;
+
+        /**
+         * @brief Input and upstream edits the buffer was computed from (see `cachedStageSignature`).
+         */
+        std::uint64_t m_signature{0};
+
+        /**
+         * @brief False until a realization completed into the buffer.
+         */
+        bool m_valid{false};
+    };
+
+    /**
+     * @brief Cached stage buffers, by operation id and stage name.
+     * @details Kept across rebuilds: toggling or reordering another operation does not
+     *          invalidate a stage whose upstream edits are unchanged.
+     */
+    std::map<std::pair<uint64_t, std::string>, CachedStageBuffer> m_cached_stage_buffers;
+
+    /**
+     * @brief True if the fused chain declares cached stages.
+     */
+    bool m_pipeline_has_cached_stages{false};
+
+    /**
+     * @brief Memoized outputs of the expensive operations, by operation id.
+     * @details Kept across rebuilds, like the cached stage buffers.
+     */
+    std::map<uint64_t, CachedStageBuffer> m_memoized_outputs;
+
+    /**
+     * @brief True if the last JIT build writes memoized outputs.
+     */
+    bool m_pipeline_has_memoized_outputs{false};
+
+    /**
+     * @brief Operation whose memoized output the last JIT build starts from, if any.
+     */
+    std::optional<uint64_t> m_resume_from;
+
+    /**
+     * @brief Input of the resumed variant, bound to the memoized output of `m_resume_from`.
+     */
+    Halide::ImageParam m_resume_input{Halide::Float(32), 3, "resume_input"};
+
+    /**
+     * @brief True if the last JIT build reads the cached stages instead of computing them.
+     */
+    bool m_reuse_cached_stages{false};
+
+    /**
+     * @brief True if GPU display images may stay on the device (see `setDisplayOnDevice`).
+     */
+    bool m_display_on_device{false};
+
+    /**
+     * @brief Row alignment of device-resident display buffers, in bytes.
+     * @details The strictest linear-texture alignment Metal devices require.
+     */
+    static constexpr int k_device_row_alignment{256};
+
+    /**
+     * @brief Display image of the last execution, until taken.
+     */
+    std::optional<Common::DisplayImage> m_display_image;
+
+    /**
+     * @brief True in profiling mode (see `setProfiling`).
+     */
+    bool m_profiling{false};
+
+    /**
+     * @brief Report of the last profiled realization.
+     */
+    std::optional<PipelineStats> m_last_stats;
+
+    /**
+     * @brief Compiled pipeline cache key of `m_pipeline` (see `dumpDiagnostics`).
+     */
+    std::string m_pipeline_key;
+
+    /**
+     * @brief Autoscheduler source of `m_pipeline`, empty for the manual schedule.
+     */
+    std::string m_schedule_source;
+
+    /**
+     * @brief Region of the working image written by the last realization.
+     */
+    std::optional<Common::RegionOfInterest> m_last_output_region;
+
     /**
      * @brief Builds the Halide function graph based on `m_operations`.
      * @details
      * Iterates through operations, creates concrete instances, and chains them
      * using `m_input` as the source.
+     *
+     * With an autoscheduled `SchedulingStrategy`, the graph is left unscheduled and handed to
+     * the autoscheduler instead of `applyScheduling()` (pipelines with a display output keep
+     * the manual schedule, the display stage being scheduled by hand). If the search fails,
+     * the manual schedule is applied and cached under the same key, so it is not retried.
      */
     void buildOperationChain();
 
+    /**
+     * @brief Records a fused operation and its parameter block, then sets the block from the descriptor.
+     * @details Used on both cache paths: a fresh block (miss) or the cached pipeline's block (hit).
+     */
+    void bindFusedStep(const Operations::OperationDescriptor* descriptor,
+                       std::unique_ptr<Operations::IOperation> operation,
+                       Operations::FusionParameterBlock params,
+                       bool masked);
+
+    /**
+     * @brief Binds the local masks of the fused operations, at the level closest to `image_width`.
+     * @details Called before every realization: a stroke changes the mask, not the descriptors.
+     */
+    void bindMasks(Common::ImageDim image_width);
+
+    /**
+     * @brief Whether the next execution should produce the display output.
+     * @return true if a display size is set and the full image is processed.
+     */
+    [[nodiscard]] bool wantsDisplayOutput() const noexcept;
+
+    /**
+     * @brief Whether the chain input is resampled by the geometry stage.
+     * @return true if the operations crop with a straighten angle.
+     */
+    [[nodiscard]] bool wantsGeometry() const noexcept;
+
+    /**
+     * @brief Whether the next execution should compute the histogram in the pipeline.
+     * @return true if the histogram is enabled, the display output wanted and the backend is the CPU.
+     */
+    [[nodiscard]] bool wantsHistogramOutput() const noexcept;
+
+    /**
+     * @brief Identity of the input of the fused step at `index`: the source buffer and the
+     *        enabled operations before it (see `Managers::ResultCache::editHash`).
+     */
+    [[nodiscard]] std::uint64_t cachedStageSignature(const Halide::Buffer<>& input, std::size_t index) const;
+
+    /**
+     * @brief Whether every cached stage of the operations from `first` on holds a result valid for `input`.
+     */
+    [[nodiscard]] bool cachedStagesReusable(const Halide::Buffer<>& input, std::size_t first) const;
+
+    /**
+     * @brief Last memoizing operation whose output holds a result valid for `input`, if any.
+     */
+    [[nodiscard]] std::optional<uint64_t> resumePoint(const Halide::Buffer<>& input) const;
+
+    /**
+     * @brief Index in `m_operations` of the first operation the current variant computes.
+     * @details 0, or the one after `m_resume_from` when resuming.
+     */
+    [[nodiscard]] std::size_t firstComputedOperation() const noexcept;
+
+    /**
+     * @brief Prepares the memoized outputs for the next realization.
+     * @details Binds the one the variant resumes from, and (re)allocates those it computes at the
+     *          size of `input`, appended to `outputs` in the pipeline's order.
+     * @return The signatures to record once the realization succeeded.
+     */
+    [[nodiscard]] std::vector<std::pair<CachedStageBuffer*, std::uint64_t>> prepareMemoizedOutputs(
+        const Halide::Buffer<>& input, std::vector<Halide::Buffer<>>& outputs);
+
+    /**
+     * @brief Prepares the cached stages for the next realization.
+     * @details Reuse variant: binds the buffers to the stages' inputs. Compute variant: (re)allocates
+     *          them at the size of `input` and appends them to `outputs`, in the pipeline's order.
+     * @return The signatures to record once the realization succeeded (compute variant only).
+     */
+    [[nodiscard]] std::vector<std::pair<CachedStageBuffer*, std::uint64_t>> prepareCachedStages(
+        const Halide::Buffer<>& input, std::vector<Halide::Buffer<>>& outputs);
+
+    /**
+     * @brief Drops the cached stage buffers and memoized outputs no fused operation declares anymore.
+     */
+    void pruneCachedStageBuffers();
+
+    /**
+     * @brief Attaches the histogram of this execution to `m_display_image`.
+     * @details Read from the histogram output when the pipeline has it, counted on the host otherwise.
+     */
+    void captureHistogram();
+
+    /**
+     * @brief Copies the realized display buffer into `m_display_image`.
+     * @details In device mode, hands the device buffer over instead (see `captureDeviceDisplayImage`);
+     * if that fails, no display image is produced and the caller downsamples.
+     */
+    void captureDisplayImage();
+
+    /**
+     * @brief Wraps the device-resident display buffer into `m_display_image`, without a download.
+     * @return false if the buffer is not on a Metal device or the kernel did not complete.
+     */
+    [[nodiscard]] bool captureDeviceDisplayImage();
+
+    /**
+     * @brief Allocates a device-only display buffer whose rows can back a linear texture.
+     * @return The buffer, or an undefined buffer if the device allocation failed.
+     */
+    [[nodiscard]] static Halide::Buffer<uint8_t> allocateDeviceDisplayBuffer(int width, int height,
+                                                                             const Halide::Target& target);
+
+    /**
+     * @brief True if this execution keeps its display image on the device (Metal targets only).
+     */
+    [[nodiscard]] bool displaysOnDevice() const noexcept;
+
+    /**
+     * @brief Rebuilds the current chain for `m_backend` (AOT kernel, cached or new JIT pipeline).
+     */
+    void rebuild();
+
+    /**
+     * @brief Switches the executor to another backend and rebuilds the chain if it changed.
+     * @param backend The backend of the working image about to be processed.
+     */
+    void switchBackend(Common::MemoryType backend);
+
+    /**
+     * @brief Switches the executor to another storage format and rebuilds the chain if it changed.
+     * @param format `RGBA_F32` or `RGBA_F16`, from the buffers about to be processed.
+     */
+    void switchStorageFormat(Common::PixelFormat format);
+
+    /**
+     * @brief Switches the executor to another storage layout and rebuilds the chain if it changed.
+     * @param layout `Interleaved` or `Planar`, from the buffers about to be processed.
+     */
+    void switchStorageLayout(Common::PixelLayout layout);
+
+    /**
+     * @brief Matches `m_operations` against the AOT tone kernel.
+     * @return The kernel arguments if the kernel is built, the backend is CPU and the chain matches.
+     */
+    [[nodiscard]] std::optional<ToneKernelArguments> matchAotToneKernel() const;
+
     /**
      * @brief Applies scheduling directives (Vectorization/Parallelism/GPU tiling).
      * @details
      * Called during the build phase to optimize `m_output_func`.
+     * Buffers are interleaved RGBA, so the channel loop is innermost and unrolled,
+     * and the vectors span consecutive pixels (`target`'s natural width) rather than channels.
+     *
+     * CPU loop structure (`m_cpu_schedule`):
+     * - `Strips`: parallel strips of rows; shared per-pixel funcs (the chain's luminance) are
+     *   computed once per vector of pixels at the innermost pixel loop, so the unrolled
+     *   channels reuse them.
+     * - `Tiles`: parallel square tiles of `m_cpu_tile_size`; the shared funcs are realized
+     *   once per tile into a tile-sized buffer that stays in L2.
+     *
+     * @param target The target the pipeline is compiled for (picks the vector width).
+     * @param per_pixel Funcs over (x, y) read by several channels of `pipeline`.
+     */
+    void applyScheduling(Halide::Func& pipeline, Halide::Var& x, Halide::Var& y, Halide::Var& c,
+                         const Halide::Target& target, const std::vector<Halide::Func>& per_pixel) const;
+
+    /**
+     * @brief Specializes the scheduled output on the operations being neutral at runtime.
+     *
+     * @details
+     * Adds a branch where every operation with an `identityCondition` is neutral (the kernel
+     * leaves them out, a stack at defaults copies the image) and, for up to
+     * `k_max_single_operation_branches` such operations, one branch per operation where it alone
+     * is active. The branches inherit the schedule of `pipeline` and are picked per realization
+     * from the bound values: no recompilation.
+     * @param conditions `identityCondition` of each computed step (undefined ones are ignored).
      */
-    void applyScheduling(Halide::Func& pipeline, Halide::Var& x, Halide::Var& y, Halide::Var& c) const;
+    static void specializeNeutralOperations(Halide::Func& pipeline, const std::vector<Halide::Expr>& conditions);
+
+    /**
+     * @brief Computes each stage at root: profiled stages (so the profiler reports each on its
+     *        own line) and the spatial stages of neighborhood operations (over the region the
+     *        output needs, halo included, instead of once per tap of their consumer).
+     * @param stages Funcs over (x, y, c), (x, y) or (x, y, ...); their update definitions, if
+     *               any, must keep x and y pure.
+     */
+    void applyRootSchedule(const std::vector<Halide::Func>& stages, Halide::Var& x, Halide::Var& y,
+                           Halide::Var& c, const Halide::Target& target) const;
+
+    /**
+     * @brief Target of the JIT pipeline: the backend's target, plus `Profile` in profiling mode.
+     * @details Cached: the configured targets are only read again after they changed.
+     */
+    [[nodiscard]] Halide::Target pipelineTarget() const;
+
+    /**
+     * @brief Parses the profiler report of a realization into `m_last_stats` and the trace.
+     * @param report Text printed by Halide during the realization.
+     * @param realize_begin_ns Start of the realization (`Trace::Tracer::now()`).
+     */
+    void collectProfile(const std::string& report, std::int64_t realize_begin_ns);
 
     /**
      * @brief Helper template to execute on specific image types.
@@ -182,6 +910,14 @@ private:
      */
     template<typename ConcreteImage>
     [[nodiscard]] bool executeWithConcreteHalide(ConcreteImage& concrete_image);
+
+    /**
+     * @brief Shared implementation of both `executeOnHalideBuffer` overloads.
+     *
+     * @tparam Element `float` or `Halide::float16_t`.
+     */
+    template<typename Element>
+    [[nodiscard]] bool executeOnBuffers(const Halide::Buffer<Element>& input, Halide::Buffer<Element>& output);
 };
 
 } // namespace Pipeline
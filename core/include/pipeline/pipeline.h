@@ -50,6 +50,38 @@
  */
 #include "pipeline/fallback_pipeline_executor.h"
 
+/**
+ * @brief LRU cache of JIT-compiled pipelines keyed by operation-chain structure and target.
+ * Avoids recompiling a chain structure that was already seen.
+ */
+#include "pipeline/compiled_pipeline_cache.h"
+
+/**
+ * @brief Ahead-of-time compiled kernel for the basic tone adjustments.
+ * Used instead of the JIT pipeline when the chain matches and the kernel is built.
+ */
+#include "pipeline/aot_tone_kernel.h"
+
+/**
+ * @brief Optional display output of the fused pipeline (downsample, sRGB encode, RGBA8).
+ */
+#include "pipeline/display_encode_stage.h"
+
+/**
+ * @brief Tone-only chains baked into a lookup table interpolated by the fused pipeline.
+ */
+#include "pipeline/tone_lut_stage.h"
+
+/**
+ * @brief JIT user context aborting the parallel tasks of a cancelled request.
+ */
+#include "pipeline/cancellable_jit_context.h"
+
+/**
+ * @brief Halide autoscheduler plugins applied to the fused pipelines.
+ */
+#include "pipeline/autoscheduler.h"
+
 // ============================================================
 // 3. Core Infrastructure (The "Factory")
 // ============================================================
@@ -81,3 +113,13 @@
  * Used as a key in the registry.
  */
 #include "pipeline/pipeline_type.h"
+
+/**
+ * @brief Enumeration selecting the CPU loop structure of fused pipelines (strips or 2D tiles).
+ */
+#include "pipeline/cpu_schedule.h"
+
+/**
+ * @brief Enumeration selecting the origin of the fused pipelines' schedule (manual or autoscheduled).
+ */
+#include "pipeline/scheduling_strategy.h"
@@ -25,6 +25,7 @@
 #include "pipeline/interfaces/i_pipeline_executor.h"
 
 #include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <functional>
 
@@ -127,6 +128,12 @@ private:
      * @return Reference to the unordered_map storing creators.
      */
     static std::unordered_map<PipelineType, CreatorFunc>& getRegistry();
+
+    /**
+     * @brief Guards the registry, shared by every engine of the process.
+     * @details Creators are copied out and run outside the lock.
+     */
+    static std::shared_mutex& getRegistryMutex();
 };
 
 } // namespace Pipeline
@@ -0,0 +1,167 @@
+/**
+ * @file pipeline_object_cache.h
+ * @brief Declaration of PipelineObjectCache (persistent cache of compiled fused pipelines).
+ *
+ * @details
+ * `CompiledPipelineCache` keeps compiled pipelines for the session only: every launch JIT-compiles
+ * again each operation stack the user edits, hundreds of milliseconds apiece. This cache keeps
+ * the machine code on disk instead:
+ * - On a miss, the pipeline is compiled ahead of time (`compile_to_object`) for the CPU target,
+ *   linked into a shared library by the system compiler driver (`$CC`, or `cc`), and loaded.
+ *   This replaces the JIT compilation, it does not add to it.
+ * - The next sessions build the graph as usual (milliseconds), then load the library: nothing
+ *   is compiled.
+ *
+ * Entries are keyed by the cache key of the chain (structure, options, target string), the
+ * Halide version and the identity of the engine binary: an update of the application or of
+ * Halide misses, and stale entries age out (least recently used first, past
+ * `AppConfig::getPipelineDiskCacheSizeMB`). A loaded library is also checked against the graph:
+ * same inputs (names, kinds, types, dimensions) in the same order, same number of outputs.
+ *
+ * A library runs with the current values of the graph's parameters, like the JIT pipeline, and
+ * its runtime is redirected to the engine's: parallel loops through the context's handlers
+ * (`CancellableJITContext`: cancellation, `Workers::ComputePool`), errors raised as
+ * `Halide::RuntimeError`.
+ *
+ * Only CPU pipelines are cached (GPU runtimes keep per-process device state). Platforms without
+ * `dlopen` (Windows), hosts without a compiler driver, and graphs embedding constant buffers or
+ * reading unnamed parameters (their generated names change from one process to the next) fall
+ * back to the JIT.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "Halide.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class PipelineObject
+ * @brief A pipeline loaded from the disk cache, bound to the parameters of one graph.
+ *
+ * @details Copies share the library (handles, like `Halide::Pipeline`).
+ */
+class PipelineObject {
+public:
+    /**
+     * @brief true if a library is bound.
+     */
+    [[nodiscard]] bool isValid() const noexcept { return m_library != nullptr; }
+
+    /**
+     * @brief Runs the pipeline into `outputs` (in the order of the pipeline's outputs), with the
+     *        current values of the graph's parameters.
+     * @param context Passed to the runtime's handlers, as `realize` does.
+     * @throws Halide::RuntimeError if the pipeline fails or is aborted.
+     */
+    void realize(Halide::JITUserContext* context, const std::vector<Halide::Buffer<>>& outputs) const;
+
+private:
+    friend class PipelineObjectCache;
+
+    struct Library;
+
+    /**
+     * @brief The loaded library (closed with its last copy).
+     */
+    std::shared_ptr<const Library> m_library;
+
+    /**
+     * @brief Input parameters of the graph, in argument order.
+     */
+    std::vector<Halide::Internal::Parameter> m_inputs;
+};
+
+/**
+ * @class PipelineObjectCache
+ * @brief Process-wide, thread-safe persistent cache of compiled CPU pipelines.
+ */
+class PipelineObjectCache {
+public:
+    /**
+     * @brief Returns the process-wide cache.
+     */
+    [[nodiscard]] static PipelineObjectCache& instance();
+
+    /**
+     * @brief true if pipelines for `target` can be cached (CPU target, budget above 0, platform support).
+     */
+    [[nodiscard]] static bool isEnabled(const Halide::Target& target) noexcept;
+
+    /**
+     * @brief Loads the entry of `key`, bound to the parameters of `pipeline`.
+     * @return The object, or `std::nullopt` on a miss (entries that do not match the graph are deleted).
+     */
+    [[nodiscard]] std::optional<PipelineObject> load(const std::string& key, const Halide::Pipeline& pipeline);
+
+    /**
+     * @brief Compiles `pipeline` for `target` into the entry of `key`, evicts down to the budget,
+     *        then loads it.
+     * @details Replaces `compile_jit`: call it instead. Failures are logged.
+     * @return The object, or `std::nullopt` if the pipeline cannot be cached (JIT-compile it then).
+     */
+    [[nodiscard]] std::optional<PipelineObject> compile(const std::string& key, Halide::Pipeline& pipeline,
+                                                        const Halide::Target& target);
+
+    PipelineObjectCache(const PipelineObjectCache&) = delete;
+    PipelineObjectCache& operator=(const PipelineObjectCache&) = delete;
+
+private:
+    PipelineObjectCache() = default;
+
+    /**
+     * @brief Directory of the entries (configured, or under the system temporary directory).
+     */
+    [[nodiscard]] static std::filesystem::path directory();
+
+    /**
+     * @brief File name of the entry of `key` (hash of the key, Halide version and engine binary).
+     */
+    [[nodiscard]] static std::string entryName(const std::string& key);
+
+    /**
+     * @brief Input arguments of `pipeline` with their parameters, sorted as Halide sorts them.
+     * @return The arguments, or `std::nullopt` if the graph embeds a constant buffer or has
+     *         parameters named by Halide.
+     */
+    [[nodiscard]] static std::optional<std::vector<Halide::Internal::InferredArgument>> inferInputs(const Halide::Pipeline& pipeline);
+
+    /**
+     * @brief Opens a library and binds it to `inputs` if its arguments match them.
+     */
+    [[nodiscard]] static std::optional<PipelineObject> open(const std::filesystem::path& path,
+                                                            const std::vector<Halide::Internal::InferredArgument>& inputs,
+                                                            std::size_t output_count);
+
+    /**
+     * @brief true if the compiler driver runs (probed once).
+     */
+    [[nodiscard]] static bool linkerAvailable();
+
+    /**
+     * @brief Deletes the least recently used entries until they fit in the budget. Caller holds m_store_mutex.
+     */
+    static void evict_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes);
+
+    /**
+     * @brief Serializes the compilations and evictions of this process.
+     */
+    std::mutex m_store_mutex;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,74 @@
+/**
+ * @file pipeline_stats.h
+ * @brief Per-Func timings and memory of a profiled pipeline run (Halide profiler report).
+ *
+ * @details
+ * In profiling mode (`OperationPipelineExecutor::setProfiling`), the fused pipeline is
+ * JIT-compiled with `Halide::Target::Profile` and every operation of the chain is computed
+ * into its own buffer, named `op<index>_<OperationType>`, so that the sampling profiler
+ * attributes time to each operation of the user's stack. After each realization Halide
+ * prints its report through the JIT context; `PipelineStats::parseReport` reads it back.
+ *
+ * The profiled schedule is slower than the fused one (one buffer per operation): compare the
+ * operations with each other, not with normal runs.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @struct FuncStats
+ * @brief One line of the profiler report (one Func, or the pipeline overhead).
+ */
+struct FuncStats {
+    /** @brief Func name (`op<index>_<OperationType>` for the operations of the chain). */
+    std::string m_name;
+    /** @brief Time spent in the Func per run, in milliseconds. */
+    double m_time_ms{0.0};
+    /** @brief Share of the pipeline time, in percent. */
+    double m_percent{0.0};
+    /** @brief Peak heap memory of the Func's buffers, in bytes (0 if not reported). */
+    std::size_t m_peak_bytes{0};
+    /** @brief Number of heap allocations of the Func (0 if not reported). */
+    std::size_t m_allocations{0};
+};
+
+/**
+ * @struct PipelineStats
+ * @brief Profiler report of the last profiled realization.
+ */
+struct PipelineStats {
+    /** @brief Pipeline name, as reported by Halide. */
+    std::string m_pipeline;
+    /** @brief Total time per run, in milliseconds. */
+    double m_time_per_run_ms{0.0};
+    /** @brief Number of runs aggregated in the report. */
+    int m_runs{0};
+    /** @brief Peak heap usage of the pipeline, in bytes. */
+    std::size_t m_peak_heap_bytes{0};
+    /** @brief Per-Func lines, slowest first. */
+    std::vector<FuncStats> m_funcs;
+
+    /**
+     * @brief Parses the text printed by `halide_profiler_report`.
+     * @param report The captured report (one pipeline).
+     * @return The statistics, or `std::nullopt` if no Func line was found.
+     */
+    [[nodiscard]] static std::optional<PipelineStats> parseReport(std::string_view report);
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,46 @@
+/**
+ * @file scheduling_strategy.h
+ * @brief Enum selecting who writes the schedule of the fused pipelines.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @brief Origin of the schedule of the fused pipelines.
+ *
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class SchedulingStrategy : std::uint8_t {
+    /**
+     * @brief Hand-written schedule of the executor (strips or tiles, see `CpuSchedule`).
+     */
+    Manual = 0,
+
+    /**
+     * @brief Halide autoscheduler run when a chain is compiled.
+     * @details Adams2019 on the CPU, Li2018 on the GPU. The search runs once per chain structure
+     *          and target: the result stays in the compiled pipeline cache.
+     */
+    AutoscheduleJit = 1,
+
+    /**
+     * @brief Like `AutoscheduleJit`, and the schedule found for each chain structure and target
+     *        is exported to the schedule directory.
+     * @details The exported sources are meant to be reviewed and baked into the ahead-of-time
+     *          generators, which can also be autoscheduled at build time
+     *          (`CAPTUREMOMENT_AOT_AUTOSCHEDULER`).
+     */
+    AutoscheduleOffline = 2
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,117 @@
+/**
+ * @file tone_lut_stage.h
+ * @brief Declaration of ToneLutStage (basic tone chains collapsed into one lookup table).
+ *
+ * @details
+ * Exposure, Brightness and Contrast are per-channel curves; Highlights, Shadows, Whites and Blacks
+ * add an amount weighted by a luminance mask, and Saturation scales the distance to the luminance.
+ * A chain made only of these adjustments is therefore a function of two inputs per channel: the
+ * channel value and the pixel luminance.
+ *
+ * Instead of fusing one stage per operation, the executor bakes the whole chain on the CPU into
+ * a table over (value, luminance) and the pipeline only interpolates it. The per-pixel cost is
+ * constant however many tone adjustments are stacked, in any order, and since the table is a
+ * `Halide::ImageParam`, every tone chain shares one compiled pipeline: adding, removing or
+ * reordering tone adjustments never recompiles.
+ *
+ * - Chains of curves only use a 1D table (`k_curve_entries` values).
+ * - Otherwise, a 2D table (`k_masked_value_entries` x `k_luminance_entries`). The luminance is
+ *   tracked through the chain alongside the value: exact for the masked adjustments and Saturation
+ *   (the Rec. 601 weights sum to 1), approximate after an adjustment clips some channels but not
+ *   the luminance.
+ *
+ * Input values and luminances are clamped to [0, 1] before the lookup.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+
+#include "Halide.h"
+
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class ToneLutStage
+ * @brief Bakes tone chains into a lookup table and appends its interpolation to a pipeline.
+ *
+ * @details
+ * The table parameter is owned by the stage and shared by every pipeline it was appended to,
+ * so a single `bind` serves whichever cached pipeline runs next.
+ */
+class ToneLutStage {
+public:
+    /**
+     * @brief Table size of per-channel-only chains.
+     */
+    static constexpr int k_curve_entries = 4096;
+
+    /**
+     * @brief Value axis of the 2D table (chains with masked adjustments).
+     */
+    static constexpr int k_masked_value_entries = 1024;
+
+    /**
+     * @brief Luminance axis of the 2D table.
+     */
+    static constexpr int k_luminance_entries = 256;
+
+    /**
+     * @brief Smallest chain worth collapsing: a single adjustment is cheaper evaluated directly.
+     */
+    static constexpr int k_min_stages = 2;
+
+    /**
+     * @brief Constructs the stage, bound to the identity table.
+     */
+    ToneLutStage();
+
+    /**
+     * @brief Checks whether a chain can run on the table.
+     * @return true if it has at least `k_min_stages` enabled operations, all of them basic tone adjustments
+     *         (a Crop aside: the executor applies it around the table).
+     */
+    [[nodiscard]] static bool matchChain(const std::vector<Operations::OperationDescriptor>& operations);
+
+    /**
+     * @brief Builds the pipeline cache key of the (structure-independent) table pipeline.
+     */
+    [[nodiscard]] static std::string makeKey(const Halide::Target& target);
+
+    /**
+     * @brief Appends the table lookup to an RGBA function. Alpha is unchanged.
+     */
+    [[nodiscard]] Halide::Func append(const Halide::Func& input,
+                                      const Halide::Var& x,
+                                      const Halide::Var& y,
+                                      const Halide::Var& c) const;
+
+    /**
+     * @brief Bakes the chain into the table for the next realization.
+     * @param operations A chain accepted by `matchChain`; a missing "value" uses the default.
+     */
+    void bind(const std::vector<Operations::OperationDescriptor>& operations);
+
+private:
+    /**
+     * @brief Table input of the pipelines, 2 dimensions (value, luminance).
+     */
+    Halide::ImageParam m_table;
+
+    /**
+     * @brief Contents currently bound to `m_table`; reused while its extents match.
+     */
+    Halide::Buffer<float> m_buffer;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,120 @@
+/**
+ * @file variant_renderer.h
+ * @brief Declaration of VariantRenderer (one image rendered under many parameter sets).
+ *
+ * @details
+ * Preset browsers and slider hover previews show the same image under K parameter sets.
+ * Rendering them as K ordinary requests would queue K full passes, each replacing the
+ * display image. The renderer instead:
+ * 1. Reduces the image once to the preview size (`max_long_edge`).
+ * 2. Compiles (or fetches from the pipeline cache) the chain of the first variant.
+ * 3. For each variant, rebinds the slider values of its `ParameterSnapshot`
+ *    (`updateRuntimeParams`: no recompilation while the structure is unchanged) and realizes
+ *    the chain into the variant's own output, from the same small input that stays cache-hot.
+ *    Expensive operations upstream of the varied ones are memoized by the executor and
+ *    computed once for all variants.
+ *
+ * Each realization is parallel over rows; the variants run back to back on one thread.
+ * The renderer owns its executor: the interactive pipeline and its display image are untouched.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/types/image_types.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "operations/parameter_snapshot.h"
+#include "pipeline/operation_pipeline_executor.h"
+
+#include <expected>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Pipeline {
+
+/**
+ * @class VariantRenderer
+ * @brief Renders an image under several parameter snapshots of one operation list.
+ */
+class VariantRenderer {
+public:
+    /**
+     * @brief One linear RGBA_F32 image per variant, in the order of the variants.
+     */
+    using Result = std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>;
+
+    /**
+     * @brief Default longest edge of the rendered variants, in pixels (a preset tile).
+     */
+    static constexpr Common::ImageDim k_default_long_edge = 256;
+
+    /**
+     * @brief Creates the renderer, its operation factory and its executor.
+     */
+    VariantRenderer();
+
+    ~VariantRenderer();
+
+    VariantRenderer(const VariantRenderer&) = delete;
+    VariantRenderer& operator=(const VariantRenderer&) = delete;
+
+    /**
+     * @brief Renders `image` edited by `operations`, once per snapshot of `variants`.
+     *
+     * @details
+     * Variant k is `operations` with `variants[k].applyTo` applied. A snapshot that leaves
+     * an operation at its neutral value may change the chain structure (identity operations
+     * are not fused): the chain is then rebuilt, from the pipeline cache when possible.
+     * A crop edit hands out the cropped rectangle of each variant.
+     *
+     * Concurrent calls are serialized.
+     *
+     * @param image Linear RGBA_F32 image, typically the proxy source.
+     * @param operations The edit the variants derive from.
+     * @param variants The parameter sets to render (at least one).
+     * @param max_long_edge Longest edge of the rendered variants; larger images are reduced first.
+     * @param token Stops between variants once cancelled (`LoadCancelled`).
+     * @return The rendered variants, or the first error.
+     */
+    [[nodiscard]] Result render(const Common::ImageRegion& image,
+                                std::span<const Operations::OperationDescriptor> operations,
+                                std::span<const Operations::ParameterSnapshot> variants,
+                                Common::ImageDim max_long_edge = k_default_long_edge,
+                                const Common::CancellationToken& token = {});
+
+private:
+    /**
+     * @brief Copy of `image` reduced to fit `max_long_edge` (area filter), or unchanged if it fits.
+     */
+    [[nodiscard]] static std::expected<Common::ImageRegion, ErrorHandling::CoreError>
+    reduce(const Common::ImageRegion& image, Common::ImageDim max_long_edge);
+
+    /**
+     * @brief Creates the operations of the variants.
+     */
+    std::unique_ptr<Operations::OperationFactory> m_operation_factory;
+
+    /**
+     * @brief Runs the variants (compiled chains are shared through the pipeline cache).
+     */
+    std::unique_ptr<OperationPipelineExecutor> m_executor;
+
+    /**
+     * @brief Guards `m_executor`: one render at a time.
+     */
+    std::mutex m_mutex;
+};
+
+} // namespace Pipeline
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,126 @@
+/**
+ * @file binary_edit_format.h
+ * @brief Compact binary layout of an edit stack (the `.cmedit` files).
+ *
+ * @details
+ * XMP stays the interchange format; this one is the fast store: loading an edit stack is a
+ * header check and a walk over fixed-size records, no parsing or text conversion. All fields
+ * are little-endian and naturally aligned, so a mapped file (`Common::MappedFile`) is read in
+ * place.
+ *
+ * | Part        | Content                                                           |
+ * |-------------|-------------------------------------------------------------------|
+ * | Header      | `EditFileHeader` (magic, version, counts), 32 bytes                |
+ * | Operations  | `operation_count` x `EditOperationRecord`, 24 bytes each           |
+ * | Parameters  | `parameter_count` x `EditParameterRecord`, 12 bytes each, by operation |
+ * | Strings     | `string_bytes` bytes: operation names and string values            |
+ *
+ * Operation types and parameter keys are stored by value: `OperationType` and `ParameterKey`
+ * values must never be renumbered (new ones are appended). A change of layout bumps
+ * `k_edit_format_version`; files of another version are rejected (the XMP sidecar remains).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+#include "operations/operation_descriptor.h"
+#include "serializer/strategy/i_xmp_path_strategy.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Serializer {
+
+/**
+ * @brief Extension of the binary edit files, next to the XMP sidecars.
+ */
+inline constexpr std::string_view k_edit_file_extension { ".cmedit" };
+
+/**
+ * @brief Current layout version.
+ */
+inline constexpr std::uint32_t k_edit_format_version { 1 };
+
+/**
+ * @brief Start of a binary edit file.
+ */
+struct EditFileHeader {
+    static constexpr std::array<char, 8> k_magic { 'C', 'M', 'E', 'D', 'I', 'T', 'S', '\0' };
+
+    std::array<char, 8> m_magic { k_magic };
+    std::uint32_t m_version { k_edit_format_version };
+    std::uint32_t m_operation_count { 0 };
+    std::uint32_t m_parameter_count { 0 };
+    std::uint32_t m_string_bytes { 0 };
+    std::uint64_t m_reserved { 0 };
+};
+static_assert(sizeof(EditFileHeader) == 32 && std::is_trivially_copyable_v<EditFileHeader>);
+
+/**
+ * @brief One operation; its parameters are `[m_first_parameter, m_first_parameter + m_parameter_count)`.
+ */
+struct EditOperationRecord {
+    std::uint64_t m_id { 0 };
+    /** @brief Name, in the string block. */
+    std::uint32_t m_name_offset { 0 };
+    std::uint32_t m_name_size { 0 };
+    /** @brief `OperationType` value. */
+    std::uint8_t m_type { 0 };
+    std::uint8_t m_enabled { 1 };
+    std::uint16_t m_parameter_count { 0 };
+    std::uint32_t m_first_parameter { 0 };
+};
+static_assert(sizeof(EditOperationRecord) == 24 && std::is_trivially_copyable_v<EditOperationRecord>);
+
+/**
+ * @brief Alternative held by a parameter (`OperationValue` index).
+ */
+enum class EditValueKind : std::uint8_t { Float = 0, Int = 1, Bool = 2, String = 3 };
+
+/**
+ * @brief One parameter. Numbers are in `m_value` (float bits for `Float`); a string is
+ *        `m_value` bytes at `m_string_offset` in the string block.
+ */
+struct EditParameterRecord {
+    /** @brief `ParameterKey` value. */
+    std::uint8_t m_key { 0 };
+    EditValueKind m_kind { EditValueKind::Float };
+    std::uint16_t m_reserved { 0 };
+    std::uint32_t m_value { 0 };
+    std::uint32_t m_string_offset { 0 };
+};
+static_assert(sizeof(EditParameterRecord) == 12 && std::is_trivially_copyable_v<EditParameterRecord>);
+
+/**
+ * @brief Path of the binary edit file of an image: its XMP path with `k_edit_file_extension`.
+ */
+[[nodiscard]] std::string editFilePathForImage(const IXmpPathStrategy& path_strategy, std::string_view source_image_path);
+
+/**
+ * @brief Encodes an edit stack in the binary layout.
+ */
+[[nodiscard]] std::string encodeEditStack(std::span<const Operations::OperationDescriptor> operations);
+
+/**
+ * @brief Decodes an edit stack (e.g. a mapped file).
+ * @return The operations, `CoreError::UnsupportedFormat` for another format or version, or
+ *         `CoreError::DecodingError` for a truncated or inconsistent file.
+ */
+[[nodiscard]] std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+decodeEditStack(std::span<const std::byte> bytes);
+
+} // namespace Serializer
+
+} // namespace CaptureMoment::Core
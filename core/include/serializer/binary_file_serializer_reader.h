@@ -0,0 +1,72 @@
+/**
+ * @file binary_file_serializer_reader.h
+ * @brief Declaration of BinaryFileSerializerReader class
+ * @details Reads edit stacks from the binary edit format, falling back to the XMP sidecar.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "serializer/i_file_serializer_reader.h"
+#include "serializer/strategy/i_xmp_path_strategy.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Serializer {
+
+/**
+ * @brief IFileSerializerReader loading the operations from a `.cmedit` file (see `binary_edit_format.h`).
+ *
+ * The file is mapped and decoded in place. Without a valid binary file (an image edited by
+ * another application, or a file of another format version), the XMP reader, if given, reads
+ * the sidecar instead.
+ */
+class BinaryFileSerializerReader final : public IFileSerializerReader {
+public:
+    /**
+     * @brief Constructs a BinaryFileSerializerReader.
+     *
+     * @param path_strategy Locates the files (the binary file is the XMP path with the `.cmedit` extension).
+     *                      Must not be null.
+     * @param xmp_reader Reads the sidecar when there is no valid binary file (nullptr: none).
+     */
+    explicit BinaryFileSerializerReader(
+        std::unique_ptr<IXmpPathStrategy> path_strategy,
+        std::unique_ptr<IFileSerializerReader> xmp_reader = nullptr
+        );
+
+    ~BinaryFileSerializerReader() override = default;
+
+    BinaryFileSerializerReader(const BinaryFileSerializerReader&) = delete;
+    BinaryFileSerializerReader& operator=(const BinaryFileSerializerReader&) = delete;
+    BinaryFileSerializerReader(BinaryFileSerializerReader&&) = delete;
+    BinaryFileSerializerReader& operator=(BinaryFileSerializerReader&&) = delete;
+
+    /**
+     * @brief Loads the operations of an image from its binary file, or else its XMP sidecar.
+     *
+     * @param source_image_path The path to the source image file.
+     * @return The operations, or an empty vector if none could be loaded.
+     */
+    [[nodiscard]] std::vector<Operations::OperationDescriptor> loadFromFile(std::string_view source_image_path) const override;
+
+private:
+    /**
+     * @brief Strategy responsible for determining the file paths.
+     */
+    std::unique_ptr<IXmpPathStrategy> m_path_strategy;
+
+    /**
+     * @brief Reader of the interchange sidecar (nullptr: none).
+     */
+    std::unique_ptr<IFileSerializerReader> m_xmp_reader;
+};
+
+} // namespace Serializer
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,88 @@
+/**
+ * @file binary_file_serializer_writer.h
+ * @brief Declaration of BinaryFileSerializerWriter class
+ * @details Writes edit stacks in the binary edit format, with the XMP sidecar written lazily.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "serializer/i_file_serializer_writer.h"
+#include "serializer/strategy/i_xmp_path_strategy.h"
+#include "serializer/xmp_autosaver.h"
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace CaptureMoment::Core {
+
+namespace Serializer {
+
+/**
+ * @brief IFileSerializerWriter storing the operations in a `.cmedit` file (see `binary_edit_format.h`).
+ *
+ * The binary file is the primary store: it is written synchronously, atomically (temporary
+ * file, then rename), in a few microseconds. When an XMP writer is given, the XMP sidecar is
+ * kept in sync for other applications, in the background and debounced (`XmpAutosaver`).
+ */
+class BinaryFileSerializerWriter final : public IFileSerializerWriter {
+public:
+    /**
+     * @brief Constructs a BinaryFileSerializerWriter.
+     *
+     * @param path_strategy Locates the files (the binary file is the XMP path with the `.cmedit` extension).
+     *                      Must not be null.
+     * @param xmp_writer Writes the interchange sidecar (nullptr: binary only).
+     * @param xmp_delay Idle time after the last save before the sidecar is written.
+     */
+    explicit BinaryFileSerializerWriter(
+        std::unique_ptr<IXmpPathStrategy> path_strategy,
+        std::unique_ptr<IFileSerializerWriter> xmp_writer = nullptr,
+        std::chrono::milliseconds xmp_delay = XmpAutosaver::k_default_debounce
+        );
+
+    /**
+     * @brief Writes the pending sidecar, if any.
+     */
+    ~BinaryFileSerializerWriter() override;
+
+    BinaryFileSerializerWriter(const BinaryFileSerializerWriter&) = delete;
+    BinaryFileSerializerWriter& operator=(const BinaryFileSerializerWriter&) = delete;
+    BinaryFileSerializerWriter(BinaryFileSerializerWriter&&) = delete;
+    BinaryFileSerializerWriter& operator=(BinaryFileSerializerWriter&&) = delete;
+
+    /**
+     * @brief Writes the operations to the binary file and schedules the XMP sidecar.
+     *
+     * @param source_image_path The path to the source image file.
+     * @param operations The span of OperationDescriptors to serialize.
+     * @return true if the binary file was written (the sidecar is reported by the log).
+     */
+    [[nodiscard]] bool saveToFile(
+        std::string_view source_image_path,
+        std::span<const Operations::OperationDescriptor> operations
+        ) const override;
+
+private:
+    /**
+     * @brief Strategy responsible for determining the file paths.
+     */
+    std::unique_ptr<IXmpPathStrategy> m_path_strategy;
+
+    /**
+     * @brief Writer of the interchange sidecar (nullptr: none).
+     */
+    std::unique_ptr<IFileSerializerWriter> m_xmp_writer;
+
+    /**
+     * @brief Writes the sidecar in the background. Declared after its writer: destroyed (and flushed) first.
+     */
+    std::unique_ptr<XmpAutosaver> m_xmp_autosaver;
+};
+
+} // namespace Serializer
+
+} // namespace CaptureMoment::Core
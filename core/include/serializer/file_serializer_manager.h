@@ -11,8 +11,11 @@
 #include "serializer/i_file_serializer_writer.h"
 #include "serializer/i_file_serializer_reader.h"
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <span>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -34,6 +37,16 @@ namespace Serializer {
  */
 class FileSerializerManager {
 public:
+    /**
+     * @brief Receives the operations of one file of a batch (index into the paths, operations).
+     */
+    using BatchCallback = std::function<void(std::size_t index, std::vector<Operations::OperationDescriptor> operations)>;
+
+    /**
+     * @brief Default number of sidecars read at once by `loadFromFiles`.
+     */
+    static constexpr std::size_t k_default_batch_threads = 4;
+
     /**
      * @brief Constructs a FileSerializerManager.
      *
@@ -81,6 +94,27 @@ public:
      */
     [[nodiscard]] std::vector<Operations::OperationDescriptor> loadFromFile(std::string_view source_image_path) const;
 
+    /**
+     * @brief Loads the operations of many files (e.g. a catalog import), several at once.
+     *
+     * Exiv2 is initialized once before the batch; the sidecars are then read by a pool of
+     * @p thread_count threads. Each result is handed to @p on_loaded as soon as it is read
+     * (completion order, one call at a time, on a pool thread), so it can stream into a
+     * catalog. Returns once every file has been read.
+     *
+     * @param source_image_paths The image files.
+     * @param on_loaded Called once per file, also for files without operations (empty vector).
+     * @param thread_count Number of sidecars read at once (at least 1).
+     * @return The number of files that had operations.
+     */
+    std::size_t loadFromFiles(std::span<const std::string> source_image_paths, const BatchCallback& on_loaded,
+                              std::size_t thread_count = k_default_batch_threads) const;
+
+    /**
+     * @brief The injected writer (e.g. for an `XmpAutosaver`).
+     */
+    [[nodiscard]] const IFileSerializerWriter& writer() const noexcept { return *m_writer; }
+
 private:
     /**
      * @brief The serializer responsible for writing operation data.
@@ -12,10 +12,18 @@
 #include "serializer/provider/i_xmp_provider.h"
 #include "serializer/strategy/i_xmp_path_strategy.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <string>
 
+namespace Exiv2 {
+class XmpData;
+}
+
 namespace CaptureMoment::Core {
 
 namespace Serializer {
@@ -25,9 +33,18 @@ namespace Serializer {
  * and an IXmpPathStrategy to determine where to store/read the XMP file.
  *
  * This class handles converting OperationDescriptors to XMP format and writing them to the designated XMP file.
+ *
+ * The XMP properties of the operations are built once per edit (`XmpAutosaver::editHash`) and kept
+ * in a small LRU: a batch writing the same edits to many images only sets the source path and
+ * encodes, and saving the same edits of the same image again reuses the encoded packet.
  */
 class FileSerializerWriter final : public IFileSerializerWriter {
 public:
+    /**
+     * @brief Number of edits whose XMP properties are kept.
+     */
+    static constexpr std::size_t k_packet_cache_entries = 8;
+
     /**
      * @brief Constructs a FileSerializerWriter.
      *
@@ -75,10 +92,35 @@ private:
      */
     std::unique_ptr<IXmpPathStrategy> m_xmp_path_strategy;
 
+    /**
+     * @brief XMP properties of an edit, and its last encoded packet.
+     */
+    struct PacketCacheEntry {
+        /** @brief `XmpAutosaver::editHash` of the operations (key). */
+        std::uint64_t m_edit_hash{0};
+        /** @brief Properties of the operations, with an empty source image path. */
+        std::shared_ptr<const Exiv2::XmpData> m_properties;
+        /** @brief Source image path of `m_packet`. */
+        std::string m_source_image_path;
+        /** @brief Packet last encoded from `m_properties` for `m_source_image_path`. */
+        std::string m_packet;
+    };
+
+    /**
+     * @brief Guards `m_packet_cache`; `saveToFile` may be called from several threads.
+     */
+    mutable std::mutex m_packet_cache_mutex;
+
+    /**
+     * @brief Recent edits, most recently used first, at most `k_packet_cache_entries`.
+     */
+    mutable std::list<PacketCacheEntry> m_packet_cache;
+
     /**
      * @brief Converts a span of OperationDescriptors into an XMP packet string representation.
      *
-     * Includes the source image path as a metadata field within the XMP.
+     * Includes the source image path as a metadata field within the XMP. Reuses the cached
+     * properties (and packet) of the same edit.
      *
      * @param operations The span of OperationDescriptors to convert.
      * @param source_image_path The path of the source image, to be included in the XMP metadata.
@@ -88,6 +130,17 @@ private:
         std::span<const Operations::OperationDescriptor> operations,
         std::string_view source_image_path
         ) const;
+
+    /**
+     * @brief Builds the XMP properties of the operations, with an empty source image path.
+     *
+     * Keys and values are formatted into two buffers reused across the properties.
+     *
+     * @param operations The span of OperationDescriptors to convert.
+     * @return The properties, or nullptr on an Exiv2 error.
+     */
+    [[nodiscard]] static std::shared_ptr<const Exiv2::XmpData> buildOperationProperties(
+        std::span<const Operations::OperationDescriptor> operations);
 };
 
 } // namespace Serializer
@@ -22,13 +22,23 @@ namespace Serializer {
 /**
  * @brief Serializes a single OperationValue (variant) to a string representation.
  * This function converts the value directly to a string without type tags.
- * For example: Float 3.14 -> "3.14", Bool true -> "true", String "hello" -> "hello".
+ * For example: Float 3.14 -> "3.14", Float 1 -> "1.0", Bool true -> "true", String "hello" -> "hello".
  *
  * @param value The OperationValue (variant) to serialize.
  * @return A string representing the value. Returns an empty string if the type is unsupported.
  */
 [[nodiscard]] std::string serializeParameter(const Operations::OperationValue& value);
 
+/**
+ * @brief Appends the representation of `serializeParameter` to a string, without a temporary.
+ * @details Numbers are formatted with `std::to_chars`: floats in the shortest form that reads back
+ *          to the same value, always with a decimal point or an exponent so they read back as floats.
+ *
+ * @param out The string to append to; callers reuse it across values.
+ * @param value The OperationValue (variant) to serialize.
+ */
+void appendParameter(std::string& out, const Operations::OperationValue& value);
+
 /**
  * @brief Deserializes a string representation back into an OperationValue.
  * This function attempts to infer the type from the string content (e.g., "true" -> Bool, "3.14" -> Float, "10" -> Int).
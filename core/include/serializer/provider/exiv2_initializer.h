@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <mutex> // for std::once_flag
+#include <mutex> // for std::once_flag, std::recursive_mutex
 
 namespace CaptureMoment::Core {
 
@@ -17,11 +17,25 @@ namespace Serializer {
  * @brief Singleton-like class to handle Exiv2 XMP parser initialization and termination.
  *
  * Ensures Exiv2::XmpParser::initialize() is called exactly once before any XMP operations,
+ * registering the CaptureMoment ("cm") namespace at the same time,
  * and Exiv2::XmpParser::terminate() is called once at program end.
  * Uses std::call_once for thread safety during initialization.
+ *
+ * The XMP toolkit is not reentrant: it is initialized with a lock function, so sidecars can be
+ * read and written from several threads (autosave, thumbnails, UI).
  */
 class Exiv2Initializer {
 public:
+    /**
+     * @brief URI of the CaptureMoment XMP namespace.
+     */
+    static constexpr const char* k_namespace_uri = "https://github.com/YacinoBen/CaptureMoment/";
+
+    /**
+     * @brief Prefix of the CaptureMoment XMP keys ("Xmp.cm.*").
+     */
+    static constexpr const char* k_namespace_prefix = "cm";
+
     /**
      * @brief Initializes the Exiv2 XMP parser if not already done.
      * This function is thread-safe.
@@ -36,10 +50,20 @@ public:
     static void terminate(); // Made public so it can be registered with atexit
 
 private:
+    /**
+     * @brief Lock function given to the XMP toolkit (`Exiv2::XmpParser::XmpLockFct`).
+     */
+    static void lockUnlock(void* lock_data, bool lock);
+
     /**
      * @brief Ensures initialization happens only once across all threads.
      */
     static std::once_flag m_init_flag;
+
+    /**
+     * @brief Serializes the calls into the XMP toolkit.
+     */
+    static std::recursive_mutex m_xmp_mutex;
 };
 
 } // namespace Serializer
@@ -0,0 +1,157 @@
+/**
+ * @file session_snapshot.h
+ * @brief Declaration of SessionSnapshot (the editing session, saved for the next launch).
+ *
+ * @details
+ * A relaunch would otherwise start blank until the last image is decoded and rendered again.
+ * The snapshot holds what the UI needs to show the last state at once: the open file, its edit
+ * stack, the viewport and the last display image as a JPEG. The UI displays the preview, then
+ * loads the image behind it; the rendered result replaces the preview once ready. The backend
+ * benchmark and the compiled pipelines are already kept across launches
+ * (`BackendDecisionCache`, `PipelineObjectCache`).
+ *
+ * | Part       | Content                                                      |
+ * |------------|--------------------------------------------------------------|
+ * | Header     | `SessionFileHeader` (magic, version, sizes, viewport), 48 bytes |
+ * | Path       | `m_path_bytes` bytes, UTF-8                                  |
+ * | Edit stack | `m_edit_bytes` bytes, the binary edit layout (`encodeEditStack`) |
+ * | Preview    | `m_preview_bytes` bytes, JPEG                                |
+ *
+ * The file is written aside, then renamed: a crash while saving leaves the previous session.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/types/image_types.h"
+#include "operations/operation_descriptor.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Serializer {
+
+/**
+ * @brief Current layout version of the session files.
+ */
+inline constexpr std::uint32_t k_session_format_version { 1 };
+
+/**
+ * @brief Start of a session file (little-endian, like the binary edit layout).
+ */
+struct SessionFileHeader {
+    static constexpr std::array<char, 8> k_magic { 'C', 'M', 'S', 'E', 'S', 'S', 'N', '\0' };
+
+    std::array<char, 8> m_magic { k_magic };
+    std::uint32_t m_version { k_session_format_version };
+    std::uint32_t m_path_bytes { 0 };
+    std::uint32_t m_source_width { 0 };
+    std::uint32_t m_source_height { 0 };
+    float m_zoom { 1.0f };
+    float m_pan_x { 0.0f };
+    float m_pan_y { 0.0f };
+    std::uint32_t m_edit_bytes { 0 };
+    std::uint64_t m_preview_bytes { 0 };
+};
+static_assert(sizeof(SessionFileHeader) == 48 && std::is_trivially_copyable_v<SessionFileHeader>);
+
+/**
+ * @struct SessionSnapshot
+ * @brief The open image, its edits, the viewport and the last preview.
+ */
+struct SessionSnapshot {
+    /**
+     * @brief JPEG quality of the preview.
+     */
+    static constexpr int k_preview_quality { 85 };
+
+    /**
+     * @brief Path of the open image.
+     */
+    std::string m_source_path;
+
+    /**
+     * @brief Width of the open image, in source pixels (maps the viewport before it loads).
+     */
+    Common::ImageDim m_source_width { 0 };
+
+    /**
+     * @brief Height of the open image, in source pixels.
+     */
+    Common::ImageDim m_source_height { 0 };
+
+    /**
+     * @brief The edit stack the preview was rendered with.
+     */
+    std::vector<Operations::OperationDescriptor> m_operations;
+
+    /**
+     * @brief Zoom of the viewport.
+     */
+    float m_zoom { 1.0f };
+
+    /**
+     * @brief Pan of the viewport, horizontal.
+     */
+    float m_pan_x { 0.0f };
+
+    /**
+     * @brief Pan of the viewport, vertical.
+     */
+    float m_pan_y { 0.0f };
+
+    /**
+     * @brief The last display image, JPEG-encoded (see `encodePreview`); empty if none.
+     */
+    std::vector<std::byte> m_preview_jpeg;
+
+    /**
+     * @brief Default session file: `CaptureMoment/session.cmsession` in the user cache directory.
+     */
+    [[nodiscard]] static std::filesystem::path defaultPath();
+
+    /**
+     * @brief Encodes a display image (linear RGBA, as `getDownsampledDisplayImage` returns it).
+     * @param image The image, converted to sRGB in place.
+     * @return The JPEG bytes, or `CoreError::InvalidImageRegion`, `UnsupportedFormat` or `IOError`.
+     */
+    [[nodiscard]] static std::expected<std::vector<std::byte>, ErrorHandling::CoreError>
+    encodePreview(Common::ImageRegion& image);
+
+    /**
+     * @brief Decodes `m_preview_jpeg` into display-ready pixels.
+     * @return The image, `CoreError::SourceNotLoaded` if there is no preview, or
+     *         `CoreError::DecodingError`.
+     */
+    [[nodiscard]] std::expected<Common::DisplayImage, ErrorHandling::CoreError> decodePreview() const;
+
+    /**
+     * @brief Writes the snapshot (aside, then renamed over `path`).
+     * @return void, or `CoreError::IOError`.
+     */
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Reads a snapshot.
+     * @return The snapshot, `CoreError::FileNotFound`, `CoreError::IOError`,
+     *         `CoreError::UnsupportedFormat` (another format or version) or `CoreError::DecodingError`.
+     */
+    [[nodiscard]] static std::expected<SessionSnapshot, ErrorHandling::CoreError> load(const std::filesystem::path& path);
+};
+
+} // namespace Serializer
+
+} // namespace CaptureMoment::Core
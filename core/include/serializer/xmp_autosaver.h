@@ -0,0 +1,174 @@
+/**
+ * @file xmp_autosaver.h
+ * @brief Declaration of XmpAutosaver (debounced, background saving of the edits to XMP).
+ *
+ * @details
+ * Every edit hands the current operations to `scheduleSave()`, which returns at once. The
+ * autosaver waits until the edits have been idle for the debounce delay (500 ms by default),
+ * then serializes and writes them on its own thread: a slider drag produces one write, and the
+ * UI thread never waits on Exiv2 or the disk. Only the latest operations of a burst are written.
+ *
+ * A write is skipped when the edits hash to what the sidecar already holds (last write, or
+ * `markSaved()` after loading them). The XMP provider writes atomically (temporary file, then
+ * rename), so an interrupted save leaves the previous sidecar intact.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "operations/operation_descriptor.h"
+#include "serializer/i_file_serializer_writer.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Serializer {
+
+/**
+ * @class XmpAutosaver
+ * @brief Saves the edits of the current image in the background, once they settle.
+ */
+class XmpAutosaver {
+public:
+    /**
+     * @brief Receives the outcome of each write, on the autosave thread.
+     */
+    using SaveCallback = std::function<void(const std::string& source_image_path, bool success)>;
+
+    /**
+     * @brief Default idle time after the last edit before writing.
+     */
+    static constexpr std::chrono::milliseconds k_default_debounce { 500 };
+
+    /**
+     * @brief Starts the autosave thread.
+     * @param writer Writes the operations (must outlive the autosaver).
+     * @param debounce Idle time after the last edit before writing.
+     * @param on_saved Notified after each save (a skipped write counts as a success).
+     */
+    explicit XmpAutosaver(const IFileSerializerWriter& writer,
+                          std::chrono::milliseconds debounce = k_default_debounce,
+                          SaveCallback on_saved = {});
+
+    /**
+     * @brief Writes the pending edits, if any, and stops the thread.
+     */
+    ~XmpAutosaver();
+
+    XmpAutosaver(const XmpAutosaver&) = delete;
+    XmpAutosaver& operator=(const XmpAutosaver&) = delete;
+
+    /**
+     * @brief Queues the edits of an image, written after the debounce delay.
+     *
+     * Replaces the pending edits of that image and restarts its delay. Pending edits of another
+     * image (the previous one, after a switch) are written right away.
+     */
+    void scheduleSave(std::string_view source_image_path, std::vector<Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Queues the edits of an image, written after @p delay (0: as soon as possible).
+     */
+    void scheduleSave(std::string_view source_image_path, std::vector<Operations::OperationDescriptor> operations,
+                      std::chrono::milliseconds delay);
+
+    /**
+     * @brief Writes the pending edits now and waits for the write (e.g. before switching images).
+     * @return Whether the last write succeeded (true if there was nothing to write).
+     */
+    bool flush();
+
+    /**
+     * @brief Records that the sidecar of an image holds @p operations (e.g. just loaded from it).
+     */
+    void markSaved(std::string_view source_image_path, std::span<const Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Hashes a list of operations as they are serialized (0 for none).
+     */
+    [[nodiscard]] static std::uint64_t editHash(std::span<const Operations::OperationDescriptor> operations);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Edits waiting for their write.
+     */
+    struct PendingSave {
+        std::string m_source_image_path;
+        std::vector<Operations::OperationDescriptor> m_operations;
+        Clock::time_point m_deadline;
+    };
+
+    /**
+     * @brief Autosave thread: waits for the deadline of the pending edits, then writes them.
+     */
+    void run(std::stop_token stop);
+
+    /**
+     * @brief Writes the edits of one save to the sidecar.
+     * @return false if the write failed.
+     */
+    bool write(const PendingSave& save);
+
+    const IFileSerializerWriter& m_writer;
+    const std::chrono::milliseconds m_debounce;
+    const SaveCallback m_on_saved;
+
+    /**
+     * @brief Guards the members below.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Wakes the thread: new edits, flush or stop.
+     */
+    std::condition_variable_any m_wake;
+
+    /**
+     * @brief Wakes `flush()` when nothing is pending or being written.
+     */
+    std::condition_variable m_idle;
+
+    /**
+     * @brief Edits waiting for their write, at most one entry per image.
+     */
+    std::vector<PendingSave> m_pending;
+
+    /**
+     * @brief Bumped by every `scheduleSave`: the thread re-reads the deadlines.
+     */
+    std::uint64_t m_generation { 0 };
+
+    bool m_writing { false };
+    bool m_flush_requested { false };
+    bool m_last_success { true };
+
+    /**
+     * @brief Hash of the edits held by each sidecar written or loaded.
+     */
+    std::unordered_map<std::string, std::uint64_t> m_saved_hashes;
+
+    /**
+     * @brief Autosave thread. Declared last: stopped and joined first, while the members it uses are alive.
+     */
+    std::jthread m_thread;
+};
+
+} // namespace Serializer
+
+} // namespace CaptureMoment::Core
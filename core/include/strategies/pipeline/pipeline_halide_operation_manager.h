@@ -16,9 +16,13 @@
 #include "operations/operation_factory.h"
 #include "operations/operation_descriptor.h"
 
+#include <cstdint>
 #include <vector>
+#include <expected>
+#include <filesystem>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 namespace CaptureMoment::Core {
 namespace Strategies {
@@ -54,12 +58,97 @@ public:
      * @brief Initializes the manager with a new list of operations (Thread-Safe).
      *
      * @details
-     * Uses the stored builder to create a new executor and swaps it atomically.
+     * Compares `OperationPipelineExecutor::structureFingerprint` of the list with the one of the
+     * last initialization: a new structure (operation added, removed, moved, enabled or disabled)
+     * rebuilds the executor's chain, the same structure only rebinds the parameter values.
      *
      * @param operations The list of operation descriptors (moved).
      */
     void init(std::vector<Operations::OperationDescriptor>&& operations);
 
+    /**
+     * @brief Compiles the pipeline of a list of operations ahead of its first execution (Thread-Safe).
+     *
+     * @details
+     * See `OperationPipelineExecutor::warmUp`. Blocks executions for the compilation: call it
+     * from a background thread. The executor keeps running its current operations.
+     *
+     * @param operations The list of operation descriptors (moved).
+     */
+    void warmUp(std::vector<Operations::OperationDescriptor>&& operations);
+
+    /**
+     * @brief Restricts subsequent executions to a region of interest (Thread-Safe).
+     *
+     * @param roi The region to compute, or `std::nullopt` to process the full image.
+     */
+    void setRegionOfInterest(std::optional<Common::RegionOfInterest> roi);
+
+    /**
+     * @brief Sets the cancellation token of the request run by subsequent executions (Thread-Safe).
+     *
+     * @param token The request token; a cancelled token aborts the running realization.
+     */
+    void setCancellationToken(Common::CancellationToken token);
+
+    /**
+     * @brief Requests a fused display image of the given size from subsequent executions (Thread-Safe).
+     *
+     * @param width Display width in pixels.
+     * @param height Display height in pixels.
+     */
+    void setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height);
+
+    /**
+     * @brief Keeps GPU display images on the device for subsequent executions (Thread-Safe).
+     * @param enabled true if the display consumer samples device buffers.
+     */
+    void setDisplayOnDevice(bool enabled);
+
+    /**
+     * @brief Attaches a histogram to the display images of subsequent executions (Thread-Safe).
+     * @param enabled true to fill `DisplayImage::m_histogram`.
+     */
+    void setHistogramOutput(bool enabled);
+
+    /**
+     * @brief Shapes subsequent chains for a gesture on one operation (Thread-Safe).
+     * @details See `OperationPipelineExecutor::setInteractiveOperation`.
+     * @param operation_id Id of the operation under the gesture, or `std::nullopt` for full quality.
+     */
+    void setInteractiveOperation(std::optional<std::uint64_t> operation_id);
+
+    /**
+     * @brief Hands over the display image produced by the last execution, if any (Thread-Safe).
+     * @return The sRGB RGBA8 display image, or `std::nullopt` if the last execution produced none.
+     */
+    [[nodiscard]] std::optional<Common::DisplayImage> takeDisplayImage();
+
+    /**
+     * @brief Compiles subsequent pipelines with the Halide profiler (Thread-Safe).
+     *
+     * @details Toggling rebuilds the pipeline. See `pipeline/pipeline_stats.h`.
+     *
+     * @param enabled true to profile each operation of the chain.
+     */
+    void setProfiling(bool enabled);
+
+    /**
+     * @brief Returns the per-operation timings of the last profiled execution (Thread-Safe).
+     * @return The statistics, or `std::nullopt` if profiling is off or nothing ran yet.
+     */
+    [[nodiscard]] std::optional<Pipeline::PipelineStats> getPipelineStats() const;
+
+    /**
+     * @brief Writes the pipeline of the last execution to a diagnostics folder (Thread-Safe).
+     *
+     * @details See `OperationPipelineExecutor::dumpDiagnostics`. Blocks executions for the lowering.
+     *
+     * @return The folder written, or the error.
+     */
+    [[nodiscard]] std::expected<std::filesystem::path, ErrorHandling::CoreError>
+    dumpDiagnostics(const std::filesystem::path& directory) const;
+
 private:
     /**
      * @brief Mutex to protect m_executor during concurrent init() and execute().
@@ -73,11 +162,6 @@ private:
      */
     std::unique_ptr<Pipeline::OperationPipelineExecutor> m_executor;
 
-    /**
-     * @brief Cache of the previous operation list to detect structural changes.
-     */
-    std::vector<Operations::OperationDescriptor> m_last_operations;
-
     /**
      * @brief Factory for creating concrete operation instances.
      */
@@ -0,0 +1,62 @@
+/**
+ * @file thumbnail.h
+ * @brief Encoded thumbnail of an image, as rendered for grid views.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/preview_histogram.h"
+#include "common/types/image_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Thumbnails {
+
+/**
+ * @struct Thumbnail
+ * @brief Compressed, display-referred (sRGB) rendition of an image with its edits applied.
+ */
+struct Thumbnail {
+    /**
+     * @brief The encoded file (e.g. a JPEG), ready for any image decoder.
+     */
+    std::vector<std::byte> m_encoded;
+
+    /**
+     * @brief Width of the encoded image, in pixels.
+     */
+    Common::ImageDim m_width{0};
+
+    /**
+     * @brief Height of the encoded image, in pixels.
+     */
+    Common::ImageDim m_height{0};
+
+    /**
+     * @brief Encoding of `m_encoded`, as an OIIO format name (`"jpeg"`).
+     */
+    std::string m_format;
+
+    /**
+     * @brief Difference hash of the image before its edits (`Utils::differenceHash`, 0: unknown).
+     */
+    std::uint64_t m_perceptual_hash{0};
+
+    /**
+     * @brief Tone histogram of the image before its edits, for batch auto-tone
+     *        (`Operations::AutoTone`). Only on freshly rendered thumbnails: nullptr from the cache.
+     */
+    std::shared_ptr<const Common::PreviewHistogram> m_histogram;
+};
+
+} // namespace Thumbnails
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,165 @@
+/**
+ * @file thumbnail_cache.h
+ * @brief Declaration of ThumbnailCache (persistent SQLite cache of encoded thumbnails).
+ *
+ * @details
+ * A grid view over a folder of thousands of images cannot decode them each time it opens.
+ * The thumbnail cache keeps every rendered thumbnail as a blob in a SQLite database, keyed by
+ * the source path and the thumbnail size, and valid as long as the source file (modification
+ * time, size) and its edits (hash of the saved operations) are unchanged. A modified source or
+ * new edits simply miss; the next render replaces the row.
+ *
+ * The database runs in WAL mode, so readers never wait for the writer, and other processes
+ * (or a later session) share it. The statements are prepared once. Past the budget
+ * (`AppConfig::getThumbnailCacheSizeMB`), the least recently used thumbnails are deleted.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+#include "thumbnails/thumbnail.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace CaptureMoment::Core {
+
+namespace Thumbnails {
+
+/**
+ * @class ThumbnailCache
+ * @brief Thread-safe SQLite table of encoded thumbnails, bounded in bytes.
+ *
+ * @details
+ * If the database cannot be opened, the cache logs once and behaves as always empty.
+ */
+class ThumbnailCache {
+public:
+    /**
+     * @struct Key
+     * @brief Identity of a thumbnail: equal keys render the same pixels.
+     */
+    struct Key {
+        /**
+         * @brief Absolute path of the source file.
+         */
+        std::string m_source_path;
+
+        /**
+         * @brief Modification time of the source file (file clock ticks).
+         */
+        std::int64_t m_source_mtime{0};
+
+        /**
+         * @brief Size of the source file, in bytes.
+         */
+        std::uint64_t m_source_size{0};
+
+        /**
+         * @brief Hash of the operations applied to the thumbnail (0: none).
+         */
+        std::uint64_t m_edit_hash{0};
+
+        /**
+         * @brief Longest edge the thumbnail was rendered for, in pixels.
+         */
+        Common::ImageDim m_max_long_edge{0};
+    };
+
+    /**
+     * @brief Builds the key of a source file rendered with given edits and size.
+     * @return The key, or `std::nullopt` if the file cannot be inspected.
+     */
+    [[nodiscard]] static std::optional<Key> makeKey(std::string_view path, std::uint64_t edit_hash,
+                                                    Common::ImageDim max_long_edge);
+
+    /**
+     * @brief Opens (or creates) the database.
+     * @param database The database file, or empty for `AppConfig::getThumbnailCachePath()`.
+     */
+    explicit ThumbnailCache(std::filesystem::path database = {});
+
+    /**
+     * @brief Finalizes the statements and closes the database.
+     */
+    ~ThumbnailCache();
+
+    ThumbnailCache(const ThumbnailCache&) = delete;
+    ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+    /**
+     * @brief true if the database is open and the cache enabled.
+     */
+    [[nodiscard]] bool isEnabled() const noexcept;
+
+    /**
+     * @brief Looks a thumbnail up, and marks it most recently used.
+     * @return The thumbnail, or `std::nullopt` on a miss (including a stale row).
+     */
+    [[nodiscard]] std::optional<Thumbnail> find(const Key& key);
+
+    /**
+     * @brief Stores the thumbnail of a key (replacing the previous one of the same source and
+     *        size), then evicts down to the budget. Failures are logged only.
+     */
+    void store(const Key& key, const Thumbnail& thumbnail);
+
+private:
+    /**
+     * @brief Database file (configured, or under the system temporary directory).
+     */
+    [[nodiscard]] static std::filesystem::path defaultDatabase();
+
+    /**
+     * @brief Creates the schema and prepares the statements. Caller holds m_mutex.
+     * @return false if the database is unusable.
+     */
+    [[nodiscard]] bool prepare_unsafe();
+
+    /**
+     * @brief Deletes the least recently used thumbnails until they fit in the budget.
+     * Caller holds m_mutex.
+     */
+    void evict_unsafe(std::uint64_t capacity_bytes);
+
+    /**
+     * @brief Finalizes the statements and closes the database. Caller holds m_mutex.
+     */
+    void close_unsafe() noexcept;
+
+    /**
+     * @brief Serializes the use of the connection and its statements.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief The connection (nullptr if the database could not be opened).
+     */
+    sqlite3* m_db{nullptr};
+
+    /**
+     * @brief Prepared statements: lookup, access-time update and insertion.
+     */
+    sqlite3_stmt* m_find_statement{nullptr};
+    sqlite3_stmt* m_touch_statement{nullptr};
+    sqlite3_stmt* m_store_statement{nullptr};
+
+    /**
+     * @brief Encoded bytes in the table, as of the last count (kept up to date by `store`).
+     */
+    std::uint64_t m_total_bytes{0};
+};
+
+} // namespace Thumbnails
+
+} // namespace CaptureMoment::Core
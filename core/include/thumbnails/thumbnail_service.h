@@ -0,0 +1,300 @@
+/**
+ * @file thumbnail_service.h
+ * @brief Declaration of ThumbnailService (edited thumbnails for grid views, cached in SQLite).
+ *
+ * @details
+ * Rendering a thumbnail never goes through a full-resolution load:
+ * 1. The saved edits of the file are read (`IFileSerializerReader`) and hashed, to build the
+ *    cache key with the file's modification time and size.
+ * 2. On a cache hit (`ThumbnailCache`), the stored JPEG is returned as is.
+ * 3. Otherwise the file is decoded at thumbnail size (`ISourceManager::decodeThumbnail`: the
+ *    embedded preview or a draft demosaic for RAW files), the edits are applied at that size
+ *    on a CPU working image, and the result is encoded to sRGB JPEG and stored.
+ *
+ * Requests run on the thumbnail pool, a few at once: a reduced decode of a standard file still
+ * decodes it at full size first, so the pool size bounds the memory in use.
+ *
+ * `requestThumbnails` hands the pool batches of `batchSize()` files. The files of a batch with
+ * the same per-pixel edits (a preset synced across a shoot) are packed one above the other into
+ * a single working image: one execution of the chain, on the backend the cost model predicts
+ * faster for the packed size, produces the sRGB RGBA8 pixels of all of them in the same
+ * realization (the display output of the executor), downloaded in one transfer and cut back
+ * into thumbnails. One small image is not worth its transfers to a GPU; a batch of them can be.
+ * Edits reading neighbouring pixels or depending on the position (crop, lens correction,
+ * plugins) would mix the packed images: such files are rendered one by one.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/cancellation_token.h"
+#include "common/error_handling/core_error.h"
+#include "common/image_region.h"
+#include "common/types/image_types.h"
+#include "managers/i_source_manager.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "pipeline/operation_pipeline_executor.h"
+#include "serializer/i_file_serializer_reader.h"
+#include "thumbnails/thumbnail.h"
+#include "thumbnails/thumbnail_cache.h"
+#include "workers/engine_scheduler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Thumbnails {
+
+/**
+ * @class ThumbnailService
+ * @brief Renders, caches and serves the thumbnails of image files.
+ */
+class ThumbnailService {
+public:
+    /**
+     * @brief Outcome of a thumbnail request.
+     */
+    using Result = std::expected<Thumbnail, ErrorHandling::CoreError>;
+
+    /**
+     * @brief Receives the outcome of a request, on a thumbnail thread.
+     */
+    using ThumbnailCallback = std::function<void(const std::string& path, Result result)>;
+
+    /**
+     * @brief Default longest edge of a thumbnail, in pixels (a grid cell on a HiDPI screen).
+     */
+    static constexpr Common::ImageDim k_default_long_edge = 512;
+
+    /**
+     * @brief JPEG quality of the encoded thumbnails.
+     */
+    static constexpr int k_jpeg_quality = 85;
+
+    /**
+     * @brief Default number of thumbnails rendered at once.
+     */
+    static constexpr std::size_t k_default_worker_count = 4;
+
+    /**
+     * @brief Default number of files per task of `requestThumbnails` (decoded one after the other).
+     */
+    static constexpr std::size_t k_default_batch_size = 8;
+
+    /**
+     * @brief Creates the service and opens the cache.
+     * @param reader Reads the saved edits of a file (nullptr: thumbnails without edits).
+     * @param source Decodes the files (nullptr: a dedicated `SourceManager`).
+     * @param worker_count Number of thumbnails rendered at once.
+     * @param cache Cache of the rendered thumbnails (nullptr: the configured database).
+     */
+    explicit ThumbnailService(std::unique_ptr<Serializer::IFileSerializerReader> reader = nullptr,
+                              std::unique_ptr<Managers::ISourceManager> source = nullptr,
+                              std::size_t worker_count = k_default_worker_count,
+                              std::unique_ptr<ThumbnailCache> cache = nullptr);
+
+    /**
+     * @brief Drops the requests not started yet and waits for the running ones.
+     */
+    ~ThumbnailService();
+
+    ThumbnailService(const ThumbnailService&) = delete;
+    ThumbnailService& operator=(const ThumbnailService&) = delete;
+
+    /**
+     * @brief Returns the thumbnail of a file, from the cache or rendered now (blocking).
+     * @param path The image file.
+     * @param max_long_edge Longest edge of the thumbnail, in pixels.
+     * @param token Stops the render before its next step if cancelled.
+     */
+    [[nodiscard]] Result getThumbnail(std::string_view path, Common::ImageDim max_long_edge = k_default_long_edge,
+                                      const Common::CancellationToken& token = {});
+
+    /**
+     * @brief Queues the thumbnails of files (e.g. the visible cells of a grid), in order.
+     *
+     * A later call (or `cancelRequests`) drops the requests of this one not started yet:
+     * their callback receives `LoadCancelled`.
+     *
+     * @param paths The image files, most wanted first.
+     * @param max_long_edge Longest edge of the thumbnails, in pixels.
+     * @param on_ready Receives each thumbnail (or error) as soon as it is available.
+     */
+    void requestThumbnails(std::span<const std::string> paths, Common::ImageDim max_long_edge,
+                           ThumbnailCallback on_ready);
+
+    /**
+     * @brief Drops the queued requests.
+     */
+    void cancelRequests();
+
+    /**
+     * @brief Sets the number of files per task of `requestThumbnails` (not thread-safe: set it before).
+     * @param batch_size Files per task; 1 renders every file on its own, as `getThumbnail`.
+     */
+    void setBatchSize(std::size_t batch_size) noexcept { m_batch_size = std::max<std::size_t>(batch_size, 1); }
+
+    /**
+     * @brief Number of files per task of `requestThumbnails`.
+     */
+    [[nodiscard]] std::size_t batchSize() const noexcept { return m_batch_size; }
+
+    /**
+     * @brief Hashes a list of operations: equal hashes render the same edits (0 for none).
+     */
+    [[nodiscard]] static std::uint64_t editHash(std::span<const Operations::OperationDescriptor> operations);
+
+private:
+    /**
+     * @brief A file decoded at thumbnail size, with what is measured before its edits.
+     */
+    struct DecodedThumbnail {
+        /** @brief Linear RGBA_F32 image. */
+        std::unique_ptr<Common::ImageRegion> m_image;
+        /** @brief Perceptual hash of the unedited image. */
+        std::uint64_t m_perceptual_hash{0};
+        /** @brief Histogram of the unedited image. */
+        std::shared_ptr<const Common::PreviewHistogram> m_histogram;
+    };
+
+    /**
+     * @brief A file of a batch waiting for the execution of its edits.
+     */
+    struct BatchItem {
+        /** @brief The image file. */
+        std::string m_path;
+        /** @brief Cache key of its thumbnail. */
+        ThumbnailCache::Key m_key;
+        /** @brief `editHash` of its edits: equal hashes share an execution. */
+        std::uint64_t m_edit_hash{0};
+        /** @brief Its saved edits. */
+        std::vector<Operations::OperationDescriptor> m_edits;
+        /** @brief Its decoded image, already upright. */
+        DecodedThumbnail m_decoded;
+    };
+
+    /**
+     * @brief Reads the saved edits of a file (serialized: the XMP toolkit is not reentrant).
+     */
+    [[nodiscard]] std::vector<Operations::OperationDescriptor> loadEdits(std::string_view path);
+
+    /**
+     * @brief Decodes, edits and encodes a thumbnail (no cache).
+     */
+    [[nodiscard]] Result render(std::string_view path, Common::ImageDim max_long_edge,
+                                std::vector<Operations::OperationDescriptor> edits,
+                                const Common::CancellationToken& token);
+
+    /**
+     * @brief Decodes a file at thumbnail size and measures its unedited pixels.
+     */
+    [[nodiscard]] std::expected<DecodedThumbnail, ErrorHandling::CoreError>
+    decode(std::string_view path, Common::ImageDim max_long_edge, const Common::CancellationToken& token);
+
+    /**
+     * @brief Turns an image of a file upright (EXIF orientation of the file).
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    upright(std::string_view path, std::unique_ptr<Common::ImageRegion> image) const;
+
+    /**
+     * @brief Serves the thumbnails of one task of `requestThumbnails`, from the cache or rendered.
+     * @details Files whose edits cannot be packed are rendered one by one; the others are
+     *          grouped by edits and rendered with `renderGroup`.
+     */
+    void renderBatch(std::span<const std::string> paths, Common::ImageDim max_long_edge,
+                     const Common::CancellationToken& token, const ThumbnailCallback& on_ready);
+
+    /**
+     * @brief Renders files with the same edits in one execution of the chain.
+     * @return The thumbnails, in the order of `items`, or the error shared by all of them.
+     */
+    [[nodiscard]] std::expected<std::vector<Thumbnail>, ErrorHandling::CoreError>
+    renderGroup(std::span<BatchItem> items, const Common::CancellationToken& token);
+
+    /**
+     * @brief true if the edits compute each pixel from that pixel alone, wherever it is:
+     *        packed images then do not interact.
+     */
+    [[nodiscard]] bool isBatchable(std::span<const Operations::OperationDescriptor> edits) const;
+
+    /**
+     * @brief Applies operations to a linear RGBA_F32 image on the CPU.
+     * @return The edited image, or the error.
+     */
+    [[nodiscard]] std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+    applyEdits(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> edits,
+               const Common::CancellationToken& token);
+
+    /**
+     * @brief Encodes a linear RGBA_F32 image to an sRGB JPEG (alpha dropped).
+     */
+    [[nodiscard]] static Result encode(Common::ImageRegion& image);
+
+    /**
+     * @brief Reads the saved edits (nullptr: none).
+     */
+    std::unique_ptr<Serializer::IFileSerializerReader> m_reader;
+
+    /**
+     * @brief Guards `m_reader`.
+     */
+    std::mutex m_reader_mutex;
+
+    /**
+     * @brief Decodes the files at thumbnail size.
+     */
+    std::unique_ptr<Managers::ISourceManager> m_source;
+
+    /**
+     * @brief Rendered thumbnails.
+     */
+    std::unique_ptr<ThumbnailCache> m_cache;
+
+    /**
+     * @brief Creates the operations of the edits.
+     */
+    std::unique_ptr<Operations::OperationFactory> m_operation_factory;
+
+    /**
+     * @brief Runs the edits (compiled chains are shared through the pipeline cache).
+     */
+    std::unique_ptr<Pipeline::OperationPipelineExecutor> m_executor;
+
+    /**
+     * @brief Guards `m_executor`: edits are applied one thumbnail at a time.
+     */
+    std::mutex m_executor_mutex;
+
+    /**
+     * @brief Latest request generation: bumped by every `requestThumbnails` and `cancelRequests`.
+     */
+    std::shared_ptr<Common::CancellationToken::Counter> m_request_generation;
+
+    /**
+     * @brief Files per task of `requestThumbnails`.
+     */
+    std::size_t m_batch_size{k_default_batch_size};
+
+    /**
+     * @brief Thumbnail pool. Declared last: joined first, while the members its tasks use are alive.
+     */
+    std::unique_ptr<Workers::EngineScheduler> m_pool;
+};
+
+} // namespace Thumbnails
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,29 @@
+/**
+ * @file thumbnails.h
+ * @brief Umbrella header for the Thumbnails module.
+ *
+ * @details
+ * This module renders the thumbnails of grid views without full-resolution loads:
+ * - **Service**: `ThumbnailService` decodes at thumbnail size, applies the saved edits and encodes to JPEG.
+ * - **Cache**: `ThumbnailCache` keeps the encoded thumbnails in a SQLite database, across sessions.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+/**
+ * @brief Encoded thumbnail and its dimensions.
+ */
+#include "thumbnails/thumbnail.h"
+
+/**
+ * @brief Persistent SQLite cache of the thumbnails, keyed by source file, edits and size.
+ */
+#include "thumbnails/thumbnail_cache.h"
+
+/**
+ * @brief Rendering and serving of the thumbnails (thumbnail pool).
+ */
+#include "thumbnails/thumbnail_service.h"
@@ -6,7 +6,8 @@
  *
  * Provides functions to:
  * - Detect if an image's pixel data is linear via OIIO metadata.
- * - Convert an image to a target color space via OIIO colorconvert.
+ * - Convert an image to a target color space via lookup tables or cached OCIO processors.
+ * - Decode sRGB-encoded integer samples to linear through lookup tables.
  *
  * OIIO automatically detects and stores the color space in the
  * "oiio:ColorSpace" ImageSpec attribute when reading a file.
@@ -19,7 +20,9 @@
 #include "common/error_handling/core_error.h"
 
 #include <expected>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace CaptureMoment::Core::Utils {
@@ -47,6 +50,28 @@ using ColorSpaceInfo = std::pair<bool, std::string>;
  */
 [[nodiscard]] bool isLinearToken(std::string_view colorspace) noexcept;
 
+/**
+ * @brief Checks whether an OIIO-detected color space token is sRGB-encoded (Rec.709 primaries).
+ *
+ * Matches "sRGB" and the CIF tokens "srgb_rec709_scene", "srgb_rec709_display", "srgb_tx"
+ * (case-insensitive).
+ *
+ * @param colorspace The color space name from OIIO metadata.
+ * @return true if the data decodes to "lin_rec709_scene" through the sRGB EOTF alone.
+ */
+[[nodiscard]] bool isSrgbToken(std::string_view colorspace) noexcept;
+
+/**
+ * @brief Table decoding sRGB-encoded integer samples to linear floats.
+ *
+ * Indexed by the raw sample value: 256 entries for `UINT8`, 65536 for `UINT16` (files with
+ * 10 or 12 bits per sample are read as full-range 16-bit samples). Built once, on first use.
+ *
+ * @param format The sample type.
+ * @return The table, or an empty span for any other type.
+ */
+[[nodiscard]] std::span<const float> srgbToLinearTable(OIIO::TypeDesc format);
+
 /**
  * @brief Analyzes whether an image's pixel data is stored in a linear color space.
  *
@@ -67,6 +92,12 @@ using ColorSpaceInfo = std::pair<bool, std::string>;
  * Reads the source color space from the buffer's OIIO metadata
  * ("oiio:ColorSpace") and converts to the specified target.
  *
+ * Local float buffers in sRGB, Rec.709, gamma 2.2/2.4 Rec.709 or Display P3 going to linear
+ * Rec.709 take a fast path: a 16-bit decoding table per transfer function (exact for 8/16-bit
+ * sources), then a 3x3 matrix for P3, in parallel over rows. Anything else goes through an
+ * OCIO processor, built once per (config, source, target) and cached for the process (shared
+ * by concurrent conversions), then applied in parallel over blocks of rows.
+ *
  * @param image The image buffer to convert (modified in-place).
  * @param target_cs The target color space CIF token (e.g., "lin_rec709_scene").
  * @return Success or CoreError on failure.
@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include "common/display_image.h"
 #include "common/image_region.h"
+#include "common/image_view.h"
+#include "common/types/image_orientation.h"
+#include "utils/quantize.h"
 #include <vector>
 #include <memory>
 
@@ -17,11 +21,58 @@ namespace CaptureMoment::Core {
 namespace Utils {
 
 /**
- * @brief Converts an RGBA_F32 ImageRegion to a new RGBA_U8 ImageRegion.
+ * @brief Converts a linear RGBA_F32 ImageRegion to a new sRGB-encoded RGBA8 image.
+ * @details Quantized by `quantizeRowsU8` straight into the image (no intermediate buffer).
  * @param input The source RGBA_F32 region.
- * @return A new ImageRegion with RGBA_U8 data, or nullptr if input is invalid.
+ * @param dither Dither added before rounding.
+ * @return A new DisplayImage, or nullptr if input is invalid.
  */
-[[nodiscard]] std::unique_ptr<Common::ImageRegion> convert_RGBA_F32_to_RGBA_U8(const Common::ImageRegion& input);
+[[nodiscard]] std::unique_ptr<Common::DisplayImage> convert_RGBA_F32_to_RGBA_U8(const Common::ImageRegion& input,
+                                                                               DitherMode dither = DitherMode::None);
+
+/**
+ * @brief Resizes an F32 ImageRegion to new dimensions using a filtered resize.
+ * @param input The source F32 region.
+ * @param target_width Target width in pixels.
+ * @param target_height Target height in pixels.
+ * @return A new ImageRegion of the requested size, or nullptr if input or target size is invalid.
+ */
+[[nodiscard]] std::unique_ptr<Common::ImageRegion> resize_F32(const Common::ImageRegion& input,
+                                                             Common::ImageDim target_width,
+                                                             Common::ImageDim target_height);
+
+/**
+ * @brief Copies an F32 ImageRegion upright: applies its EXIF orientation to the pixels.
+ * @details The one pass that turns the stored pixels, made on the exported image only
+ *          (after the crop and before the resize); the size swaps for codes 5 to 8.
+ * @param input The source F32 region, in the stored frame.
+ * @param orientation The orientation of the source.
+ * @return A new, upright ImageRegion, or nullptr if input is invalid.
+ */
+[[nodiscard]] std::unique_ptr<Common::ImageRegion> orient_F32(const Common::ImageRegion& input,
+                                                             Common::ImageOrientation orientation);
+
+/**
+ * @brief Box-downsamples a horizontal band of a view to a band of a smaller image.
+ *
+ * @details
+ * Target pixel `(tx, ty)` averages the source pixels `[tx * W / target_width, (tx + 1) * W / target_width)`
+ * by `[ty * H / target_height, (ty + 1) * H / target_height)`, so consecutive bands tile the target
+ * exactly and each only reads the source rows they cover. Used to stream display tiles of a
+ * full-resolution result as its bands complete.
+ *
+ * @param input The full-size source view (F32).
+ * @param target_width Width of the whole target image.
+ * @param target_height Height of the whole target image.
+ * @param target_y First target row of the band.
+ * @param target_rows Number of target rows of the band.
+ * @return The band, positioned at `(0, target_y)` in the target image, or nullptr if the input or the band is invalid.
+ */
+[[nodiscard]] std::unique_ptr<Common::ImageRegion> downsample_rows_F32(const Common::ImageView& input,
+                                                                      Common::ImageDim target_width,
+                                                                      Common::ImageDim target_height,
+                                                                      Common::ImageDim target_y,
+                                                                      Common::ImageDim target_rows);
 
 } // namespace Utils
 } // namespace CaptureMoment::Core
\ No newline at end of file
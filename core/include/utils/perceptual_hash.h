@@ -0,0 +1,50 @@
+/**
+ * @file perceptual_hash.h
+ * @brief 64-bit perceptual hash (difference hash) of an image, for duplicate and burst detection.
+ *
+ * @details
+ * The luminance is box-averaged down to 9x8 cells and each bit tells whether a cell is darker
+ * than its right neighbour. The hash survives resizing, recompression, small exposure changes and
+ * most of a raw/JPEG pair's rendering differences: two images are near-duplicates when their
+ * hashes differ in a few bits (`hammingDistance`), not when they are equal.
+ *
+ * The hash is computed on the decoded thumbnail, before the edits, so editing an image does
+ * not move it away from its duplicates.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <bit>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Utils {
+
+/**
+ * @brief Difference hash of interleaved float pixels (RGB or RGBA, linear or not).
+ * @param pixels First pixel, rows packed.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param channels Samples per pixel (1: grey; 3 or more: R, G, B first).
+ * @return The hash, or 0 for an empty image (0 is never a meaningful hash: it is "unknown").
+ */
+[[nodiscard]] std::uint64_t differenceHash(const float* pixels, Common::ImageDim width, Common::ImageDim height,
+                                           Common::ImageChan channels);
+
+/**
+ * @brief Number of differing bits between two hashes (0: same picture, 64: opposites).
+ */
+[[nodiscard]] constexpr int hammingDistance(std::uint64_t a, std::uint64_t b) noexcept
+{
+    return std::popcount(a ^ b);
+}
+
+} // namespace Utils
+
+} // namespace CaptureMoment::Core
@@ -0,0 +1,94 @@
+/**
+ * @file quantize.h
+ * @brief Table-driven quantization of linear float RGBA rows to 8-bit and 16-bit samples.
+ *
+ * @details
+ * The output transfer function (sRGB OETF) is read from tables built once, never computed per
+ * sample, and the clamp and table indexing run over blocks of samples so the compiler
+ * vectorizes them. Large images are split in bands of rows quantized in parallel.
+ *
+ * The destination is any row layout (RGB or RGBA, any row stride): callers quantize straight
+ * into the scanline buffer of an encoder or into a display image, without an intermediate copy.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/types/image_types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Utils {
+
+/**
+ * @brief Transfer function applied to the color channels before quantization.
+ */
+enum class OutputTransfer : std::uint8_t {
+    Linear,     ///< Values quantized as they are
+    Srgb        ///< sRGB OETF (piecewise, 2.4 exponent)
+};
+
+/**
+ * @brief Dither added to the color channels before rounding (alpha is never dithered).
+ *
+ * @details
+ * Dithering trades banding in smooth gradients (skies, vignettes) for noise below one code.
+ * Both patterns depend on the pixel position only: strips of one image quantized separately
+ * match a single pass when given their `m_origin_y`.
+ */
+enum class DitherMode : std::uint8_t {
+    None,       ///< Round to nearest
+    Ordered,    ///< 8x8 Bayer matrix: regular, cheapest, visible on flat areas at 8 bits
+    Noise       ///< Interleaved gradient noise: blue-ish, no visible pattern (same as the display shader)
+};
+
+/**
+ * @brief How rows are quantized.
+ */
+struct QuantizeSettings {
+    OutputTransfer m_transfer{OutputTransfer::Srgb};
+    DitherMode m_dither{DitherMode::None};
+
+    /** @brief Position of the first row in the whole image (dither pattern continuity). */
+    Common::ImageDim m_origin_y{0};
+};
+
+/**
+ * @brief Quantizes linear RGBA float rows to 8-bit samples.
+ *
+ * @details
+ * Color channels are clamped to [0, 1], encoded and rounded; alpha stays linear. NaN lands on 0.
+ * Without dither, the sRGB encode reads an 8-bit code table indexed on 14 bits (a step moves the
+ * output by a fifth of a code even near black); with dither, it interpolates the float curve.
+ *
+ * @param src First source row (RGBA floats).
+ * @param src_stride Distance between source rows, in floats.
+ * @param dst First destination row.
+ * @param dst_stride Distance between destination rows, in samples.
+ * @param width Width in pixels.
+ * @param rows Number of rows.
+ * @param dst_channels 4 (RGBA) or 3 (RGB, alpha dropped).
+ * @param settings Transfer function and dither.
+ */
+void quantizeRowsU8(const float* src, std::size_t src_stride, std::uint8_t* dst, std::size_t dst_stride,
+                    Common::ImageDim width, Common::ImageDim rows, int dst_channels,
+                    const QuantizeSettings& settings = {});
+
+/**
+ * @brief Quantizes linear RGBA float rows to 16-bit samples.
+ *
+ * @details Same as `quantizeRowsU8`; the sRGB encode interpolates a 65536-entry float table
+ *          (within a hundredth of a code of the exact curve).
+ */
+void quantizeRowsU16(const float* src, std::size_t src_stride, std::uint16_t* dst, std::size_t dst_stride,
+                     Common::ImageDim width, Common::ImageDim rows, int dst_channels,
+                     const QuantizeSettings& settings = {});
+
+} // namespace Utils
+
+} // namespace CaptureMoment::Core
@@ -23,6 +23,16 @@
  */
 #include "utils/image_conversion.h"
 
+/**
+ * @brief Quantization of linear float rows to 8-bit and 16-bit samples
+ */
+#include "utils/quantize.h"
+
+/**
+ * @brief Perceptual (difference) hash of an image
+ */
+#include "utils/perceptual_hash.h"
+
 /**
  * @brief Definition of supported pixel formats (e.g., RGBA_U8, RGBA_F32).
  */
@@ -0,0 +1,292 @@
+/**
+ * @file compute_pool.h
+ * @brief Declaration of ComputePool (process-wide threads of the data-parallel loops).
+ *
+ * @details
+ * Halide's `parallel` loops used to run on Halide's own thread pool, sized to the machine,
+ * while the engine schedulers, the decode pool and Qt's pools ran their own threads beside
+ * it: an export realizing next to an interactive pass put two machine-wide loops on the
+ * same cores, and the preview stuttered behind the export's strips.
+ *
+ * Every parallel loop now runs on this single pool, under one concurrency budget:
+ * - **Budget**: at most `concurrency()` threads compute at once, the caller of each loop
+ *   included (the caller always works on its own loop, so loops never wait for a thread).
+ * - **Lanes**: a loop runs in the lane of the task that started it
+ *   (`EngineScheduler::currentPriority`). A lane may be capped to fewer helper threads.
+ * - **Preemption**: a helper finishing an iteration leaves its loop as soon as a loop of a
+ *   more urgent lane waits for threads. An interactive pass therefore takes the threads of
+ *   a running export within one iteration (one strip of rows), not at the end of the export.
+ * - **Nodes** (optional, multi-socket hosts): helpers are pinned to the memory nodes in turn,
+ *   and the loop of a caller pinned to a node (`Common::NumaTopology`) only takes helpers of
+ *   that node, so its strips are computed next to its buffers.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "workers/task_priority.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Workers {
+
+/**
+ * @class ComputePool
+ * @brief Process-wide, thread-safe pool running the iterations of parallel loops by lane.
+ */
+class ComputePool {
+public:
+    /**
+     * @brief Default cap of the thumbnail lane: the thumbnail service already renders several
+     *        images at once.
+     */
+    static constexpr std::size_t k_default_thumbnail_cap = 2;
+
+    /**
+     * @brief Most nodes helpers can be pinned to (the preemption mask has a slot per node).
+     */
+    static constexpr std::size_t k_max_pinned_nodes = 15;
+
+    /**
+     * @brief Returns the process-wide pool (sized to the machine until `setConcurrency`).
+     */
+    [[nodiscard]] static ComputePool& instance();
+
+    /**
+     * @brief Sets the number of threads computing at once, callers of the loops included.
+     * @param threads Budget, or 0 for the number of hardware threads.
+     */
+    void setConcurrency(std::size_t threads);
+
+    /**
+     * @brief Number of threads computing at once, callers of the loops included.
+     */
+    [[nodiscard]] std::size_t concurrency() const noexcept;
+
+    /**
+     * @brief Caps the helper threads working on the loops of one lane.
+     * @param priority The lane.
+     * @param threads Maximum helpers (the caller of a loop is not counted), or 0 for no cap.
+     */
+    void setLaneCap(TaskPriority priority, std::size_t threads);
+
+    /**
+     * @brief Helper threads allowed on the loops of one lane (0: no cap).
+     */
+    [[nodiscard]] std::size_t laneCap(TaskPriority priority) const;
+
+    /**
+     * @brief Pins the helpers to the memory nodes, and keeps the loops of pinned callers on their node.
+     * @details Ignored on single-node hosts. Unpinned callers' loops still take any helper.
+     */
+    void setNodePinning(bool enabled);
+
+    /**
+     * @brief true if the helpers are pinned to the memory nodes.
+     */
+    [[nodiscard]] bool nodePinning() const noexcept;
+
+    /**
+     * @brief Runs `body(i)` for every `i` in `[0, extent)`, on the calling thread and the helpers.
+     *
+     * @details
+     * Iterations run in any order and concurrently. A non-zero status skips the iterations not
+     * started yet. Loops may nest: an iteration starting a loop runs it like any caller.
+     *
+     * @param priority Lane of the loop.
+     * @param extent Number of iterations.
+     * @param body `int(int)`: 0 on success, any other value aborts the loop.
+     * @return 0, or the first non-zero status returned by an iteration.
+     */
+    template<typename Body>
+    int parallelFor(TaskPriority priority, int extent, Body&& body)
+    {
+        using BodyType = std::remove_reference_t<Body>;
+
+        Loop loop;
+        loop.m_priority = priority;
+        loop.m_node = callerNode();
+        loop.m_extent = extent;
+        loop.m_body = const_cast<void*>(static_cast<const void*>(&body));
+        loop.m_invoke = [](void* data, int index) { return (*static_cast<BodyType*>(data))(index); };
+        return run(loop);
+    }
+
+    ComputePool(const ComputePool&) = delete;
+    ComputePool& operator=(const ComputePool&) = delete;
+
+private:
+    /**
+     * @brief One running loop, owned by the stack of its caller.
+     */
+    struct Loop {
+        /**
+         * @brief Lane of the loop.
+         */
+        TaskPriority m_priority{TaskPriority::Interactive};
+
+        /**
+         * @brief Node of the caller, whose helpers only may join (unset: any helper).
+         */
+        std::optional<std::size_t> m_node;
+
+        /**
+         * @brief Number of iterations.
+         */
+        int m_extent{0};
+
+        /**
+         * @brief The body, called through `m_invoke`.
+         */
+        void* m_body{nullptr};
+
+        /**
+         * @brief Calls the body for one iteration.
+         */
+        int (*m_invoke)(void*, int){nullptr};
+
+        /**
+         * @brief Next iteration to claim.
+         */
+        std::atomic<int> m_next{0};
+
+        /**
+         * @brief First non-zero status, 0 so far.
+         */
+        std::atomic<int> m_status{0};
+
+        /**
+         * @brief Helpers working on the loop (guarded by the pool's mutex).
+         */
+        std::size_t m_helpers{0};
+    };
+
+    /**
+     * @brief Private: use `instance()`. Never destroyed, so that loops started during
+     *        shutdown (static destructors, background benchmark) still find their helpers.
+     */
+    ComputePool();
+
+    /**
+     * @brief Node the loops of the calling thread are kept on (unset: any helper).
+     */
+    [[nodiscard]] std::optional<std::size_t> callerNode() const noexcept;
+
+    /**
+     * @brief Runs a loop to completion (see `parallelFor`).
+     */
+    int run(Loop& loop);
+
+    /**
+     * @brief Claims and runs the iterations of a loop until none is left, or until a loop the
+     *        helper could serve instead is wanted (`m_wanted_lanes & preempt_mask`).
+     * @param preempt_mask 0 for callers, which never leave their loop.
+     */
+    void work(Loop& loop, std::uint64_t preempt_mask);
+
+    /**
+     * @brief Helper thread body.
+     * @param index Rank of the helper, which picks its node when pinned.
+     */
+    void helper(std::size_t index);
+
+    /**
+     * @brief The loop a helper should join, or nullptr. Caller holds `m_mutex`.
+     * @param helper_node Node of the helper, unset if it is not pinned.
+     */
+    [[nodiscard]] Loop* selectLoop_unsafe(std::optional<std::size_t> helper_node) const;
+
+    /**
+     * @brief Bits of `m_wanted_lanes` a helper working in `lane` leaves its loop for.
+     */
+    [[nodiscard]] static std::uint64_t preemptMask(std::size_t lane, std::optional<std::size_t> helper_node) noexcept;
+
+    /**
+     * @brief Slot of a loop's node in `m_wanted_lanes` (0: any node).
+     */
+    [[nodiscard]] static std::size_t slotOf(std::optional<std::size_t> node) noexcept;
+
+    /**
+     * @brief Recomputes `m_wanted_lanes`. Caller holds `m_mutex`.
+     */
+    void refreshWantedLanes_unsafe();
+
+    /**
+     * @brief Starts helpers until `concurrency() - 1` exist. Caller holds `m_mutex`.
+     */
+    void startHelpers_unsafe();
+
+    /**
+     * @brief Guards the lanes, the counters and the caps.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Signalled when a loop is started or a helper slot frees up.
+     */
+    std::condition_variable m_work_available;
+
+    /**
+     * @brief Signalled when the last helper leaves a loop.
+     */
+    std::condition_variable m_helper_left;
+
+    /**
+     * @brief Running loops per lane, oldest first, indexed by `TaskPriority`.
+     */
+    std::array<std::vector<Loop*>, k_task_priority_count> m_lanes;
+
+    /**
+     * @brief Helpers working per lane.
+     */
+    std::array<std::size_t, k_task_priority_count> m_lane_helpers{};
+
+    /**
+     * @brief Cap of helpers per lane (0: no cap).
+     */
+    std::array<std::size_t, k_task_priority_count> m_lane_caps{};
+
+    /**
+     * @brief Helpers working, all lanes.
+     */
+    std::size_t m_busy_helpers{0};
+
+    /**
+     * @brief Threads computing at once, callers included.
+     */
+    std::atomic<std::size_t> m_concurrency{1};
+
+    /**
+     * @brief true once the helpers are pinned to the nodes.
+     */
+    std::atomic<bool> m_node_pinning{false};
+
+    /**
+     * @brief Bit `slot * k_task_priority_count + lane` per lane having a loop of a node slot
+     *        with iterations left and room under its cap: working helpers poll it between
+     *        iterations to leave for a more urgent lane.
+     */
+    std::atomic<std::uint64_t> m_wanted_lanes{0};
+
+    /**
+     * @brief The helpers (`concurrency() - 1` of them at most are busy).
+     */
+    std::vector<std::thread> m_helpers;
+};
+
+} // namespace Workers
+
+} // namespace CaptureMoment::Core
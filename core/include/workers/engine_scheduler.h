@@ -0,0 +1,179 @@
+/**
+ * @file engine_scheduler.h
+ * @brief Declaration of EngineScheduler (persistent worker pool with priority lanes).
+ *
+ * @details
+ * Processing passes used to run on a thread created per edit, whose only job was to block on
+ * a deferred future, while waiters polled a flag every millisecond. The scheduler replaces
+ * both: a fixed set of threads, created once, pulls tasks from priority lanes
+ * (see `TaskPriority`), and completion is reported by the tasks themselves (continuations
+ * or futures), never by polling.
+ *
+ * **Lanes:**
+ * - Idle threads take the oldest task of the most urgent non-empty lane.
+ * - The first thread only serves `TaskPriority::Interactive`: a preview pass always finds a
+ *   thread, even while long exports or thumbnails occupy the others.
+ *
+ * Data parallelism inside a task (Halide's `parallel` loops) runs on the process-wide
+ * `ComputePool`, in the lane of the task that started it (`currentPriority`); the scheduler
+ * only orders the coarse tasks.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "workers/task_priority.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core {
+
+namespace Workers {
+
+/**
+ * @class EngineScheduler
+ * @brief Fixed pool of threads executing tasks by priority.
+ *
+ * @details
+ * Thread-safe. Tasks must not throw (exceptions escaping a task are caught and logged);
+ * `submit` wraps its callable so that exceptions reach the returned future instead.
+ */
+class EngineScheduler {
+public:
+    /**
+     * @brief Type of the tasks queued in the lanes.
+     */
+    using Task = std::move_only_function<void()>;
+
+    /**
+     * @brief Default number of threads: one reserved for interactive work, one for everything.
+     */
+    static constexpr std::size_t k_default_thread_count = 2;
+
+    /**
+     * @brief Starts the threads.
+     * @param thread_count Number of threads (at least 2: the reserved interactive one plus one general).
+     */
+    explicit EngineScheduler(std::size_t thread_count = k_default_thread_count);
+
+    /**
+     * @brief Runs every task still queued, then joins the threads.
+     */
+    ~EngineScheduler();
+
+    EngineScheduler(const EngineScheduler&) = delete;
+    EngineScheduler& operator=(const EngineScheduler&) = delete;
+    EngineScheduler(EngineScheduler&&) = delete;
+    EngineScheduler& operator=(EngineScheduler&&) = delete;
+
+    /**
+     * @brief Queues a fire-and-forget task.
+     * @details The task typically reports its own completion (continuation, promise).
+     */
+    void post(TaskPriority priority, Task task);
+
+    /**
+     * @brief Queues a callable and returns a future for its result (or exception).
+     */
+    template<typename Callable>
+    [[nodiscard]] auto submit(TaskPriority priority, Callable&& callable)
+        -> std::future<std::invoke_result_t<std::decay_t<Callable>&>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<Callable>&>;
+
+        std::packaged_task<Result()> packaged(std::forward<Callable>(callable));
+        auto future = packaged.get_future();
+        post(priority, [packaged = std::move(packaged)]() mutable { packaged(); });
+        return future;
+    }
+
+    /**
+     * @brief Number of threads of the pool.
+     */
+    [[nodiscard]] std::size_t threadCount() const noexcept { return m_threads.size(); }
+
+    /**
+     * @brief Number of tasks queued (not yet started) in a lane.
+     */
+    [[nodiscard]] std::size_t pendingCount(TaskPriority priority) const;
+
+    /**
+     * @brief Lane of the task running on the calling thread, if any.
+     * @details Set while a scheduler task (or a `ComputePool` loop of one) runs.
+     */
+    [[nodiscard]] static std::optional<TaskPriority> currentPriority() noexcept;
+
+    /**
+     * @class ScopedPriority
+     * @brief Sets `currentPriority()` of the calling thread for its lifetime.
+     */
+    class ScopedPriority {
+    public:
+        explicit ScopedPriority(TaskPriority priority) noexcept;
+        ~ScopedPriority();
+
+        ScopedPriority(const ScopedPriority&) = delete;
+        ScopedPriority& operator=(const ScopedPriority&) = delete;
+
+    private:
+        /**
+         * @brief Value restored on destruction (nested scopes).
+         */
+        std::optional<TaskPriority> m_previous;
+    };
+
+private:
+    /**
+     * @brief Thread body.
+     * @param interactive_only true for the thread reserved to the interactive lane.
+     */
+    void run(bool interactive_only);
+
+    /**
+     * @brief Pops the most urgent task the calling thread may run. Caller holds `m_mutex`.
+     * @return false if no such task is queued.
+     */
+    [[nodiscard]] bool popTask(bool interactive_only, Task& task, TaskPriority& priority);
+
+    /**
+     * @brief Guards the lanes and `m_stopping`.
+     */
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief Signalled when a task is queued or the scheduler stops.
+     */
+    std::condition_variable m_task_available;
+
+    /**
+     * @brief One FIFO per priority, indexed by `TaskPriority`.
+     */
+    std::array<std::deque<Task>, k_task_priority_count> m_lanes;
+
+    /**
+     * @brief Set by the destructor: threads exit once the lanes they serve are empty.
+     */
+    bool m_stopping{false};
+
+    /**
+     * @brief The pool. `m_threads[0]` is the interactive-only thread.
+     */
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace Workers
+
+} // namespace CaptureMoment::Core
@@ -11,7 +11,7 @@
  * **Architecture:**
  * - **Stateless:** Does not own operation descriptors.
  * - **Contextual:** Retrieves the necessary manager from `PipelineContext` during execution.
- * - **Async Wrapper:** Wraps the synchronous manager execution into a `std::future`.
+ * - **Scheduled:** Queues the synchronous manager execution on the `EngineScheduler`.
  *
  * @author CaptureMoment Team
  * @date 2026
@@ -20,11 +20,9 @@
 #pragma once
 
 #include "workers/interfaces/i_worker_request.h"
+#include "workers/engine_scheduler.h"
 #include "pipeline/pipeline_context.h"
 
-#include <future>
-#include <memory>
-
 namespace CaptureMoment::Core {
 
 namespace Workers {
@@ -41,10 +39,13 @@ class HalideOperationWorker : public IWorkerRequest {
 public:
     /**
      * @brief Constructor.
-     * @details
-     * Default constructor as this worker holds no state.
+     * @details The worker holds no processing state, only the scheduler it queues on.
+     * @param scheduler The engine scheduler; must outlive the worker.
      */
-    HalideOperationWorker() = default;
+    explicit HalideOperationWorker(EngineScheduler& scheduler) noexcept
+        : m_scheduler(&scheduler)
+    {
+    }
 
     /**
      * @brief Destructor.
@@ -52,20 +53,30 @@ public:
     ~HalideOperationWorker() override = default;
 
     /**
-     * @brief Executes the Halide pipeline asynchronously.
+     * @brief Queues the Halide pipeline execution.
      *
      * @details
+     * On a scheduler thread:
      * 1. Retrieves the `HalideOperationManager` from the provided context.
      * 2. Invokes the manager's `execute` method on the working image.
-     * 3. Wraps the result in a `std::future`.
+     * 3. Invokes `on_complete` with the result.
      *
      * @param context Reference to the global pipeline infrastructure.
      * @param working_image Reference to the target image buffer.
-     * @return `std::future<bool>` indicating success or failure of the execution.
+     * @param priority Scheduler lane of the pass.
+     * @param on_complete Continuation receiving the result.
      */
-    [[nodiscard]] std::future<bool> execute(
+    void dispatch(
         Pipeline::PipelineContext& context,
-        ImageProcessing::IWorkingImageHardware& working_image) override;
+        ImageProcessing::IWorkingImageHardware& working_image,
+        TaskPriority priority,
+        CompletionHandler on_complete) override;
+
+private:
+    /**
+     * @brief Scheduler the passes are queued on (non-owning).
+     */
+    EngineScheduler* m_scheduler;
 };
 
 } // namespace Workers
@@ -8,8 +8,9 @@
  * and the worker handles the specific execution logic and data.
  *
  * **Architecture:**
- * - **Async Execution:** The primary method `execute` returns a `std::future<bool>`, allowing
- *   the implementation to handle threading (e.g., via `std::async` or a thread pool) internally.
+ * - **Async Execution:** Implementations queue their work on the engine scheduler
+ *   (`EngineScheduler`) in the lane given by the caller, and report completion through a
+ *   continuation (`dispatch`) or a `std::future<bool>` (`execute`). No thread is created per request.
  * - **Context Injection:** Receives a `PipelineContext` to access compiled managers and infrastructure.
  * - **Data Ownership:** Derived classes (e.g., `HalideOperationWorker`) are responsible for
  *   storing and managing their specific data (e.g., operation vectors, AI parameters).
@@ -20,10 +21,12 @@
 
 #pragma once
 
+#include "workers/task_priority.h"
+
+#include <functional>
 #include <future>
 #include <memory>
 
-
 namespace CaptureMoment::Core {
 
 
@@ -43,29 +46,56 @@ namespace Workers {
  */
 class IWorkerRequest {
 public:
+    /**
+     * @brief Continuation invoked with the result, on the scheduler thread that ran the work.
+     */
+    using CompletionHandler = std::move_only_function<void(bool)>;
+
     /**
      * @brief Virtual destructor.
      */
     virtual ~IWorkerRequest() = default;
 
     /**
-     * @brief Executes the specific processing logic asynchronously.
+     * @brief Queues the specific processing logic and returns immediately.
      *
      * @details
-     * This method is responsible for:
+     * The queued task is responsible for:
      * 1. Accessing the appropriate manager from the `PipelineContext` (e.g., `context.getHalideManager()`).
-     * 2. Initializing that manager with the worker's internal data (e.g., operations).
-     * 3. Running the pipeline on the provided image.
-     * 4. Returning a `std::future` that resolves to `true` on success, or `false` on failure.
+     * 2. Running the pipeline on the provided image.
+     * 3. Invoking `on_complete` with `true` on success, or `false` on failure (exactly once).
+     *
+     * @param context Reference to the global pipeline infrastructure; must outlive the task.
+     * @param working_image Reference to the target image buffer; must outlive the task.
+     * @param priority Scheduler lane of the task.
+     * @param on_complete Continuation receiving the result.
+     */
+    virtual void dispatch(
+        Pipeline::PipelineContext& context,
+        ImageProcessing::IWorkingImageHardware& working_image,
+        TaskPriority priority,
+        CompletionHandler on_complete
+    ) = 0;
+
+    /**
+     * @brief Future-based form of `dispatch`.
      *
      * @param context Reference to the global pipeline infrastructure.
      * @param working_image Reference to the target image buffer to process.
+     * @param priority Scheduler lane of the task.
      * @return `std::future<bool>` representing the asynchronous result of the processing.
      */
-    [[nodiscard]] virtual std::future<bool> execute(
+    [[nodiscard]] std::future<bool> execute(
         Pipeline::PipelineContext& context,
-        ImageProcessing::IWorkingImageHardware& working_image
-    ) = 0;
+        ImageProcessing::IWorkingImageHardware& working_image,
+        TaskPriority priority = TaskPriority::Interactive)
+    {
+        std::promise<bool> promise;
+        auto future = promise.get_future();
+        dispatch(context, working_image, priority,
+                 [promise = std::move(promise)](bool success) mutable { promise.set_value(success); });
+        return future;
+    }
 
 protected:
     /**
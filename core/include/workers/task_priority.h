@@ -0,0 +1,56 @@
+/**
+ * @file task_priority.h
+ * @brief Enumeration defining the priority lanes of the engine scheduler.
+ *
+ * @details
+ * Every task submitted to the `EngineScheduler` is queued in one lane. Idle threads always
+ * take the oldest task of the most urgent non-empty lane, so a slider drag is never queued
+ * behind an export or a batch of thumbnails.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CaptureMoment::Core {
+
+namespace Workers {
+
+/**
+ * @enum TaskPriority
+ * @brief Scheduler lane of a task, from the most to the least urgent.
+ */
+enum class TaskPriority : std::uint8_t {
+    /**
+     * @brief Interactive preview (proxy or region-of-interest passes while editing).
+     */
+    Interactive = 0,
+
+    /**
+     * @brief Full-resolution refinement once the interaction settles.
+     */
+    Refine = 1,
+
+    /**
+     * @brief Export of the processed image.
+     */
+    Export = 2,
+
+    /**
+     * @brief Thumbnail and other background work.
+     */
+    Thumbnail = 3,
+};
+
+/**
+ * @brief Number of lanes (one per `TaskPriority` value).
+ */
+inline constexpr std::size_t k_task_priority_count = 4;
+
+} // namespace Workers
+
+} // namespace CaptureMoment::Core
@@ -9,9 +9,9 @@
  * without modifying existing manager code.
  *
  * **Usage:**
- * 1. Register a creator at startup: `WorkerBuilder::registerCreator(Type, []{ return std::make_unique<ConcreteWorker>(); });`
- * 2. Build an instance: `auto worker = WorkerBuilder::build(Type);`
- * 3. Execute the worker: `worker->execute(context, image);`
+ * 1. Register a creator at startup: `WorkerBuilder::registerCreator(Type, [](EngineScheduler& s){ return std::make_unique<ConcreteWorker>(s); });`
+ * 2. Build an instance: `auto worker = WorkerBuilder::build(Type, scheduler);`
+ * 3. Execute the worker: `worker->execute(context, image, priority);`
  *
  * @author CaptureMoment Team
  * @date 2026
@@ -21,8 +21,10 @@
 
 #include "workers/worker_type.h"
 #include "workers/interfaces/i_worker_request.h"
+#include "workers/engine_scheduler.h"
 
 #include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <functional>
 
@@ -39,24 +41,23 @@ public:
     /**
      * @brief Definition of the creator function signature.
      * @details
-     * A creator function is a lambda that takes no arguments and returns
-     * a unique pointer to the interface, calling the default constructor
-     * of the concrete implementation.
+     * A creator function is a lambda that takes the engine scheduler the worker will
+     * queue its tasks on, and returns a unique pointer to the interface.
      */
-    using CreatorFunc = std::function<std::unique_ptr<IWorkerRequest>()>;
+    using CreatorFunc = std::function<std::unique_ptr<IWorkerRequest>(EngineScheduler&)>;
 
     /**
      * @brief Retrieves an instance of the worker for the specified type.
      *
      * @details
      * This method looks up the `WorkerType` in the registry. If found,
-     * it invokes the registered creator to construct a new instance using
-     * the default constructor.
+     * it invokes the registered creator to construct a new instance bound to `scheduler`.
      *
      * @param type The enum identifier for the desired worker.
+     * @param scheduler The scheduler the worker queues on; must outlive the worker.
      * @return A unique pointer to the worker, or nullptr if type is not registered.
      */
-    [[nodiscard]] static std::unique_ptr<IWorkerRequest> build(WorkerType type);
+    [[nodiscard]] static std::unique_ptr<IWorkerRequest> build(WorkerType type, EngineScheduler& scheduler);
 
     /**
      * @brief Registers a creator function for a specific worker type.
@@ -76,6 +77,12 @@ private:
      * @return Reference to the unordered_map storing creators.
      */
     static std::unordered_map<WorkerType, CreatorFunc>& getRegistry();
+
+    /**
+     * @brief Guards the registry, shared by every engine of the process.
+     * @details Creators are copied out and run outside the lock.
+     */
+    static std::shared_mutex& getRegistryMutex();
 };
 
 } // namespace Workers
@@ -8,6 +8,7 @@
  * It does NOT manage image state or processing data.
  *
  * **Responsibilities:**
+ * - Owns (or shares) the `EngineScheduler` (persistent worker pool) every worker queues on.
  * - Owns and initializes the `WorkerBuilder` registry.
  * - Owns and initializes `IWorkerRequest` instances (e.g., Halide).
  * - Provides access to workers via references.
@@ -19,6 +20,7 @@
 #pragma once
 
 #include "workers/worker_builder.h"
+#include "workers/engine_scheduler.h"
 #include "workers/halide/halide_operation_worker.h"
 #include "workers/worker_type.h"
 
@@ -42,12 +44,20 @@ public:
      * @brief Constructor.
      *
      * @details
-     * Initializes the global `WorkerBuilder` and creates the worker instances.
+     * Starts the scheduler (unless one is given), initializes the global `WorkerBuilder` and
+     * creates the worker instances.
+     *
+     * @param scheduler Pool shared by several engines of the process, or nullptr to start a
+     *        private one. A shared pool serves the interactive lanes of all its engines on the
+     *        same reserved thread: size it for the number of engines.
      */
-    explicit WorkerContext();
+    explicit WorkerContext(std::shared_ptr<EngineScheduler> scheduler = nullptr);
 
     /**
      * @brief Destructor.
+     * @details Workers are destroyed first. A private scheduler then runs what is still queued
+     *          and joins; a shared one keeps running for the other engines, so the owner waits
+     *          for its own tasks first (`StateImageManager` does).
      */
     ~WorkerContext() = default;
 
@@ -77,7 +87,26 @@ public:
         return *m_halide_worker;
     }
 
+    /**
+     * @brief Gets the engine scheduler, for work that does not go through a worker.
+     */
+    [[nodiscard]] EngineScheduler& getScheduler() noexcept {
+        return *m_scheduler;
+    }
+
+    /**
+     * @brief Shares the engine scheduler, for another engine running on the same pool.
+     */
+    [[nodiscard]] std::shared_ptr<EngineScheduler> shareScheduler() const noexcept {
+        return m_scheduler;
+    }
+
 private:
+    /**
+     * @brief The engine scheduler. Declared first: destroyed after the workers bound to it.
+     */
+    std::shared_ptr<EngineScheduler> m_scheduler;
+
     /**
      * @brief The single global builder instance.
      * @details
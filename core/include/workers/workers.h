@@ -11,7 +11,8 @@
  * **Architecture:**
  * - **Interface**: `IWorkerRequest` defines the contract for all workers (`execute(context, image)`).
  * - **Registry**: `WorkerBuilder` and `WorkerRegistry` manage the creation of concrete worker types.
- * - **Context**: `WorkerContext` owns the builder and provides access to specific worker instances.
+ * - **Scheduler**: `EngineScheduler` is the fixed thread pool (priority lanes) every worker queues on.
+ * - **Context**: `WorkerContext` owns the scheduler and the builder, and provides access to specific worker instances.
  * - **Concrete**: `HalideOperationWorker` implements the execution logic for Halide-based adjustments.
  *
  * @author CaptureMoment Team
@@ -59,6 +60,22 @@
  */
 #include "workers/worker_type.h"
 
+/**
+ * @brief Priority lanes of the engine scheduler (interactive, refine, export, thumbnail).
+ */
+#include "workers/task_priority.h"
+
+/**
+ * @brief Persistent worker pool executing the workers' tasks by priority.
+ * Owned by `WorkerContext`.
+ */
+#include "workers/engine_scheduler.h"
+
+/**
+ * @brief Process-wide pool running the Halide parallel loops under one thread budget.
+ */
+#include "workers/compute_pool.h"
+
 // ============================================================
 // 3. Concrete Workers
 // ============================================================
@@ -0,0 +1,561 @@
+/**
+ * @file card_importer.cpp
+ * @brief Implementation of CardImporter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/card_importer.h"
+#include "managers/smart_preview_store.h"
+#include "managers/source_manager.h"
+#include "operations/basic_adjustment_operations/auto_tone.h"
+#include "thumbnails/thumbnail_service.h"
+
+#include <spdlog/spdlog.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Suffix of a copy in progress, renamed away once complete.
+ */
+constexpr std::string_view k_part_suffix { ".part" };
+
+/**
+ * @class BlockFile
+ * @brief Unbuffered file read or written in large blocks, opened with a sequential-access hint.
+ */
+class BlockFile {
+public:
+    /**
+     * @brief Opens a file to read, with the system's read-ahead for sequential access.
+     * @return The file, or `FileNotFound`.
+     */
+    [[nodiscard]] static std::expected<BlockFile, ErrorHandling::CoreError> openRead(const std::filesystem::path& path)
+    {
+        BlockFile file;
+#if defined(_WIN32)
+        file.m_handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file.m_handle == INVALID_HANDLE_VALUE) {
+            return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+        }
+#else
+        file.m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file.m_fd < 0) {
+            return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+        }
+#if defined(__APPLE__)
+        ::fcntl(file.m_fd, F_RDAHEAD, 1);
+#else
+        ::posix_fadvise(file.m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#endif
+        return file;
+    }
+
+    /**
+     * @brief Creates a file to write (it must not exist).
+     * @return The file, or `IOError`.
+     */
+    [[nodiscard]] static std::expected<BlockFile, ErrorHandling::CoreError> create(const std::filesystem::path& path)
+    {
+        BlockFile file;
+#if defined(_WIN32)
+        file.m_handle = CreateFileW(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW,
+                                    FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file.m_handle == INVALID_HANDLE_VALUE) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+#else
+        file.m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (file.m_fd < 0) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+#endif
+        return file;
+    }
+
+    BlockFile() noexcept = default;
+
+    ~BlockFile()
+    {
+        close();
+    }
+
+    BlockFile(BlockFile&& other) noexcept
+#if defined(_WIN32)
+        : m_handle(std::exchange(other.m_handle, INVALID_HANDLE_VALUE))
+#else
+        : m_fd(std::exchange(other.m_fd, -1))
+#endif
+    {
+    }
+
+    BlockFile& operator=(BlockFile&&) = delete;
+    BlockFile(const BlockFile&) = delete;
+    BlockFile& operator=(const BlockFile&) = delete;
+
+    /**
+     * @brief Reads up to `buffer.size()` bytes (fewer only at the end of the file).
+     * @return The bytes read (0 at the end), or `IOError`.
+     */
+    [[nodiscard]] std::expected<std::size_t, ErrorHandling::CoreError> read(std::span<std::byte> buffer)
+    {
+        std::size_t total { 0 };
+        while (total < buffer.size()) {
+#if defined(_WIN32)
+            DWORD count { 0 };
+            const DWORD wanted { static_cast<DWORD>(std::min<std::size_t>(buffer.size() - total, 1u << 30)) };
+            if (!ReadFile(m_handle, buffer.data() + total, wanted, &count, nullptr)) {
+                return std::unexpected(ErrorHandling::CoreError::IOError);
+            }
+#else
+            const ssize_t count { ::read(m_fd, buffer.data() + total, buffer.size() - total) };
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return std::unexpected(ErrorHandling::CoreError::IOError);
+            }
+#endif
+            if (count == 0) {
+                break;
+            }
+            total += static_cast<std::size_t>(count);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Writes all of `bytes`.
+     */
+    [[nodiscard]] bool write(std::span<const std::byte> bytes)
+    {
+        std::size_t total { 0 };
+        while (total < bytes.size()) {
+#if defined(_WIN32)
+            DWORD count { 0 };
+            const DWORD wanted { static_cast<DWORD>(std::min<std::size_t>(bytes.size() - total, 1u << 30)) };
+            if (!WriteFile(m_handle, bytes.data() + total, wanted, &count, nullptr)) {
+                return false;
+            }
+#else
+            const ssize_t count { ::write(m_fd, bytes.data() + total, bytes.size() - total) };
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+#endif
+            total += static_cast<std::size_t>(count);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Closes the file.
+     * @return false if the system reported a write error at close.
+     */
+    bool close() noexcept
+    {
+#if defined(_WIN32)
+        if (m_handle == INVALID_HANDLE_VALUE) {
+            return true;
+        }
+        return CloseHandle(std::exchange(m_handle, INVALID_HANDLE_VALUE)) != 0;
+#else
+        if (m_fd < 0) {
+            return true;
+        }
+        return ::close(std::exchange(m_fd, -1)) == 0;
+#endif
+    }
+
+private:
+#if defined(_WIN32)
+    HANDLE m_handle{INVALID_HANDLE_VALUE};
+#else
+    int m_fd{-1};
+#endif
+};
+
+/**
+ * @brief XXH3 streaming state, freed with the scope.
+ */
+struct HashState {
+    HashState()
+        : m_state(XXH3_createState())
+    {
+        XXH3_64bits_reset(m_state);
+    }
+
+    ~HashState()
+    {
+        XXH3_freeState(m_state);
+    }
+
+    HashState(const HashState&) = delete;
+    HashState& operator=(const HashState&) = delete;
+
+    XXH3_state_t* m_state;
+};
+
+} // anonymous namespace
+
+struct CardImporter::RunState {
+    /**
+     * @brief Guards the members below and the progress callback.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Destinations taken by this run, so two files of the same name (different card
+     *        folders) never get the same one.
+     */
+    std::set<std::filesystem::path> m_claimed;
+
+    /**
+     * @brief Files kept by this run, by content (hash, size).
+     */
+    std::map<std::pair<std::uint64_t, std::uint64_t>, std::filesystem::path> m_imported;
+
+    /**
+     * @brief Records not added to the catalog yet.
+     */
+    std::vector<ImageRecord> m_records;
+};
+
+CardImporter::CardImporter(CatalogDatabase& catalog,
+                           std::unique_ptr<Managers::ISourceManager> source,
+                           Thumbnails::ThumbnailService* thumbnails,
+                           std::unique_ptr<Serializer::IFileSerializerWriter> writer)
+    : m_catalog(catalog)
+    , m_source(source ? std::move(source) : std::make_unique<Managers::SourceManager>())
+    , m_thumbnails(thumbnails)
+    , m_writer(std::move(writer))
+{
+}
+
+CardImporter::~CardImporter() = default;
+
+std::vector<ImportResult> CardImporter::run(std::span<const std::string> sources, const ImportSettings& settings,
+                                            const ProgressCallback& on_progress,
+                                            const Common::CancellationToken& token)
+{
+    std::vector<ImportResult> results(sources.size());
+    if (sources.empty()) {
+        return results;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(settings.m_destination, ec);
+    if (!std::filesystem::is_directory(settings.m_destination, ec)) {
+        spdlog::error("[CardImporter::run]: Cannot create '{}'", settings.m_destination.string());
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            results[i].m_source_path = sources[i];
+            results[i].m_status = std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+        return results;
+    }
+
+    RunState state;
+    std::atomic<std::size_t> next { 0 };
+    const std::size_t thread_count { std::clamp<std::size_t>(settings.m_parallel_files, 1, sources.size()) };
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&]() {
+                std::vector<std::byte> buffer(k_block_bytes);
+                for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < sources.size();) {
+                    results[i] = importFile(sources[i], settings, state, buffer, token);
+
+                    std::lock_guard lock(state.m_mutex);
+                    if (on_progress) {
+                        on_progress(i, results[i]);
+                    }
+                }
+            });
+        }
+    }
+
+    flushRecords(state);
+
+    const auto copied { std::ranges::count_if(results, [](const ImportResult& result) {
+        return result.m_status && *result.m_status == ImportOutcome::Copied;
+    }) };
+    spdlog::info("[CardImporter::run]: {} of {} file(s) copied to '{}'", copied, sources.size(),
+                 settings.m_destination.string());
+    return results;
+}
+
+ImportResult CardImporter::importFile(const std::string& source, const ImportSettings& settings, RunState& state,
+                                      std::span<std::byte> buffer, const Common::CancellationToken& token)
+{
+    ImportResult result;
+    result.m_source_path = source;
+
+    if (token.isCancelled()) {
+        result.m_status = std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        return result;
+    }
+
+    // ============================================================
+    // Destination: the file name, made unique against the disk and the other files of the run
+    // ============================================================
+    const std::filesystem::path name { std::filesystem::path(source).filename() };
+    std::filesystem::path destination { settings.m_destination / name };
+    {
+        std::lock_guard lock(state.m_mutex);
+        std::error_code ec;
+        for (int suffix = 1; state.m_claimed.contains(destination) || std::filesystem::exists(destination, ec); ++suffix) {
+            destination = settings.m_destination
+                          / (name.stem().string() + "-" + std::to_string(suffix) + name.extension().string());
+        }
+        state.m_claimed.insert(destination);
+    }
+    std::filesystem::path part { destination };
+    part += k_part_suffix;
+
+    // Content this file claimed in the run, released if the file is not kept
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> claimed;
+    const auto discard = [&]() {
+        std::error_code ec;
+        std::filesystem::remove(part, ec);
+        if (claimed) {
+            std::lock_guard lock(state.m_mutex);
+            state.m_imported.erase(*claimed);
+        }
+    };
+    const auto fail = [&](ErrorHandling::CoreError error) {
+        discard();
+        result.m_status = std::unexpected(error);
+        return result;
+    };
+
+    // ============================================================
+    // Copy (the only read of the card) and hash
+    // ============================================================
+    const auto hash { copyFile(source, part, buffer, token) };
+    if (!hash) {
+        if (hash.error() != ErrorHandling::CoreError::LoadCancelled) {
+            spdlog::error("[CardImporter::importFile]: Copy of '{}' failed", source);
+        }
+        return fail(hash.error());
+    }
+    result.m_content_hash = *hash;
+
+    std::error_code ec;
+    const std::uint64_t size { std::filesystem::file_size(part, ec) };
+    if (ec) {
+        return fail(ErrorHandling::CoreError::IOError);
+    }
+
+    // ============================================================
+    // Duplicates: this run first, then the catalog
+    // ============================================================
+    if (settings.m_skip_duplicates) {
+        const std::pair content { *hash, size };
+        std::optional<std::filesystem::path> original;
+        {
+            // Checked and claimed at once: of two equal files copied together, one is kept
+            std::lock_guard lock(state.m_mutex);
+            if (const auto [found, inserted] = state.m_imported.try_emplace(content, destination); inserted) {
+                claimed = content;
+            } else {
+                original = found->second;
+            }
+        }
+        if (!original) {
+            const auto cataloged { m_catalog.findDuplicate(*hash, size) };
+            if (cataloged && *cataloged && std::filesystem::exists((*cataloged)->m_path, ec)) {
+                original = (*cataloged)->m_path;
+            }
+        }
+        if (original) {
+            spdlog::debug("[CardImporter::importFile]: '{}' duplicates '{}'", source, original->string());
+            discard();
+            result.m_destination_path = std::move(*original);
+            result.m_status = ImportOutcome::Duplicate;
+            return result;
+        }
+    }
+
+    // ============================================================
+    // Verify (reads the copy back, from the page cache) and keep
+    // ============================================================
+    if (settings.m_verify) {
+        const auto written { hashFile(part, buffer) };
+        if (!written || *written != *hash) {
+            spdlog::error("[CardImporter::importFile]: Verification of the copy of '{}' failed", source);
+            return fail(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    std::filesystem::rename(part, destination, ec);
+    if (ec) {
+        spdlog::error("[CardImporter::importFile]: Cannot rename '{}': {}", part.string(), ec.message());
+        return fail(ErrorHandling::CoreError::IOError);
+    }
+    // The capture's file time, not the import's
+    if (const auto time = std::filesystem::last_write_time(source, ec); !ec) {
+        std::filesystem::last_write_time(destination, time, ec);
+    }
+
+    result.m_destination_path = destination;
+    result.m_status = ImportOutcome::Copied;
+
+    // ============================================================
+    // Metadata and thumbnail, while the copy is in the page cache
+    // ============================================================
+    const std::string path { destination.string() };
+    const auto metadata { m_source->readMetadata(path) };
+    if (!metadata) {
+        // Not an image (a clip, a camera database): copied, not cataloged
+        spdlog::debug("[CardImporter::importFile]: '{}' copied without metadata", path);
+        return result;
+    }
+
+    std::uint64_t perceptual_hash { 0 };
+    if (m_thumbnails) {
+        // Rendered into the thumbnail cache, where the grid finds it
+        if (const auto thumbnail = m_thumbnails->getThumbnail(path, Thumbnails::ThumbnailService::k_default_long_edge, token)) {
+            perceptual_hash = thumbnail->m_perceptual_hash;
+
+            // Auto-tone from the statistics the thumbnail was rendered with
+            if (settings.m_auto_tone && m_writer && thumbnail->m_histogram) {
+                std::vector<Operations::OperationDescriptor> edits;
+                Operations::AutoTone::applyTo(edits, Operations::AutoTone::suggest(*thumbnail->m_histogram));
+                std::lock_guard lock(m_writer_mutex);
+                result.m_auto_toned = m_writer->saveToFile(path, edits);
+                if (!result.m_auto_toned) {
+                    spdlog::warn("[CardImporter::importFile]: Auto-tone of '{}' not saved", path);
+                }
+            }
+        }
+    }
+
+    // Smart preview, decoded from the copy still in the page cache
+    if (!settings.m_smart_preview_directory.empty()) {
+        const Managers::SmartPreviewStore store(settings.m_smart_preview_directory);
+        result.m_smart_preview = store.generate(path, *m_source).has_value();
+    }
+
+    auto record { CatalogDatabase::makeRecord(path, *metadata) };
+    if (record) {
+        record->m_content_hash = *hash;
+        record->m_perceptual_hash = perceptual_hash;
+        bool full { false };
+        {
+            std::lock_guard lock(state.m_mutex);
+            state.m_records.push_back(std::move(*record));
+            full = state.m_records.size() >= CatalogDatabase::k_import_batch_rows;
+        }
+        if (full) {
+            flushRecords(state);
+        }
+    }
+
+    return result;
+}
+
+void CardImporter::flushRecords(RunState& state)
+{
+    std::vector<ImageRecord> records;
+    {
+        std::lock_guard lock(state.m_mutex);
+        records.swap(state.m_records);
+    }
+    if (records.empty()) {
+        return;
+    }
+
+    if (auto written = m_catalog.addImages(records); !written) {
+        spdlog::error("[CardImporter::flushRecords]: {} record(s) not cataloged", records.size());
+    }
+}
+
+std::expected<std::uint64_t, ErrorHandling::CoreError>
+CardImporter::copyFile(const std::filesystem::path& source, const std::filesystem::path& destination,
+                       std::span<std::byte> buffer, const Common::CancellationToken& token)
+{
+    auto input { BlockFile::openRead(source) };
+    if (!input) {
+        return std::unexpected(input.error());
+    }
+    auto output { BlockFile::create(destination) };
+    if (!output) {
+        return std::unexpected(output.error());
+    }
+
+    HashState hash;
+    for (;;) {
+        if (token.isCancelled()) {
+            return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        }
+        const auto count { input->read(buffer) };
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+        if (*count == 0) {
+            break;
+        }
+        const auto block { buffer.first(*count) };
+        XXH3_64bits_update(hash.m_state, block.data(), block.size());
+        if (!output->write(block)) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    if (!output->close()) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return XXH3_64bits_digest(hash.m_state);
+}
+
+std::expected<std::uint64_t, ErrorHandling::CoreError>
+CardImporter::hashFile(const std::filesystem::path& path, std::span<std::byte> buffer)
+{
+    auto input { BlockFile::openRead(path) };
+    if (!input) {
+        return std::unexpected(input.error());
+    }
+
+    HashState hash;
+    for (;;) {
+        const auto count { input->read(buffer) };
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+        if (*count == 0) {
+            break;
+        }
+        XXH3_64bits_update(hash.m_state, buffer.data(), *count);
+    }
+    return XXH3_64bits_digest(hash.m_state);
+}
+
+} // namespace CaptureMoment::Core::Catalog
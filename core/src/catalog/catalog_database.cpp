@@ -0,0 +1,1169 @@
+/**
+ * @file catalog_database.cpp
+ * @brief Implementation of CatalogDatabase
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/catalog_database.h"
+#include "serializer/binary_edit_format.h"
+
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Schema: folders, images, edit stacks, keywords and thumbnails.
+ *
+ * The grid indexes end with the id, so a page continues exactly where the previous one ended
+ * even among images of the same capture date.
+ */
+constexpr const char* k_schema {
+    "CREATE TABLE IF NOT EXISTS folders ("
+    "  id INTEGER PRIMARY KEY,"
+    "  path TEXT NOT NULL UNIQUE);"
+    "CREATE TABLE IF NOT EXISTS images ("
+    "  id INTEGER PRIMARY KEY,"
+    "  folder_id INTEGER NOT NULL REFERENCES folders (id),"
+    "  file_name TEXT NOT NULL,"
+    "  file_size INTEGER NOT NULL,"
+    "  file_mtime INTEGER NOT NULL,"
+    "  width INTEGER NOT NULL,"
+    "  height INTEGER NOT NULL,"
+    "  orientation INTEGER NOT NULL,"
+    "  capture_date TEXT NOT NULL,"
+    "  camera_make TEXT NOT NULL,"
+    "  camera_model TEXT NOT NULL,"
+    "  lens TEXT NOT NULL,"
+    "  rating INTEGER NOT NULL DEFAULT 0,"
+    "  import_time INTEGER NOT NULL,"
+    "  sidecar_mtime INTEGER NOT NULL DEFAULT 0,"
+    "  content_hash INTEGER NOT NULL DEFAULT 0,"
+    "  perceptual_hash INTEGER NOT NULL DEFAULT 0,"
+    "  sidecar_size INTEGER NOT NULL DEFAULT 0,"
+    "  UNIQUE (folder_id, file_name));"
+    "CREATE INDEX IF NOT EXISTS images_folder_grid ON images (folder_id, capture_date, id);"
+    "CREATE INDEX IF NOT EXISTS images_grid ON images (capture_date, id);"
+    "CREATE INDEX IF NOT EXISTS images_content ON images (content_hash);"
+    "CREATE TABLE IF NOT EXISTS edits ("
+    "  image_id INTEGER PRIMARY KEY REFERENCES images (id) ON DELETE CASCADE,"
+    "  data BLOB NOT NULL,"
+    "  modified INTEGER NOT NULL);"
+    "CREATE TABLE IF NOT EXISTS keywords ("
+    "  id INTEGER PRIMARY KEY,"
+    "  name TEXT NOT NULL UNIQUE COLLATE NOCASE);"
+    "CREATE TABLE IF NOT EXISTS image_keywords ("
+    "  keyword_id INTEGER NOT NULL REFERENCES keywords (id) ON DELETE CASCADE,"
+    "  image_id INTEGER NOT NULL REFERENCES images (id) ON DELETE CASCADE,"
+    "  PRIMARY KEY (keyword_id, image_id)) WITHOUT ROWID;"
+    "CREATE INDEX IF NOT EXISTS image_keywords_image ON image_keywords (image_id);"
+    "CREATE TABLE IF NOT EXISTS thumbnails ("
+    "  image_id INTEGER PRIMARY KEY REFERENCES images (id) ON DELETE CASCADE,"
+    "  edit_hash INTEGER NOT NULL,"
+    "  width INTEGER NOT NULL,"
+    "  height INTEGER NOT NULL,"
+    "  format TEXT NOT NULL,"
+    "  data BLOB NOT NULL);"
+};
+
+/**
+ * @brief Upgrades of the schema: entry N brings version N + 1 to N + 2.
+ */
+constexpr std::array k_migrations {
+    "ALTER TABLE images ADD COLUMN sidecar_mtime INTEGER NOT NULL DEFAULT 0;",
+    "ALTER TABLE images ADD COLUMN content_hash INTEGER NOT NULL DEFAULT 0;"
+    "CREATE INDEX IF NOT EXISTS images_content ON images (content_hash);",
+    "ALTER TABLE images ADD COLUMN perceptual_hash INTEGER NOT NULL DEFAULT 0;",
+    "ALTER TABLE images ADD COLUMN sidecar_size INTEGER NOT NULL DEFAULT 0;",
+};
+
+/**
+ * @brief Columns of an image record, in the order `readImage` expects.
+ */
+#define CM_CATALOG_IMAGE_COLUMNS                                                                    \
+    "i.id, f.path, i.file_name, i.file_size, i.file_mtime, i.width, i.height, i.orientation,"       \
+    " i.capture_date, i.camera_make, i.camera_model, i.lens, i.rating, i.import_time, i.sidecar_mtime," \
+    " i.content_hash, i.perceptual_hash, i.sidecar_size"
+
+// The grid queries walk the grid index in order and stop at the limit: CROSS JOIN keeps the
+// images as the outer loop (SQLite never reorders it), the folder of each row is a rowid lookup.
+// Parameters: ?1 cursor date, ?2 cursor id, ?3 minimum rating, ?4 limit.
+
+/**
+ * @brief SQL of each `Statement`, by value.
+ */
+constexpr std::array k_statement_sql {
+    // InsertFolder
+    "INSERT OR IGNORE INTO folders (path) VALUES (?1);",
+    // FindFolder
+    "SELECT id FROM folders WHERE path = ?1;",
+    // UpsertImage (keeps the rating, the first import time and the perceptual hash of an unchanged file)
+    "INSERT INTO images (folder_id, file_name, file_size, file_mtime, width, height, orientation,"
+    " capture_date, camera_make, camera_model, lens, import_time, content_hash, perceptual_hash)"
+    " VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10, ?11, ?12, ?13, ?14)"
+    " ON CONFLICT (folder_id, file_name) DO UPDATE SET"
+    " perceptual_hash = CASE WHEN excluded.perceptual_hash = 0 AND excluded.file_size = file_size"
+    " AND excluded.file_mtime = file_mtime THEN perceptual_hash ELSE excluded.perceptual_hash END,"
+    " file_size = excluded.file_size, file_mtime = excluded.file_mtime, width = excluded.width,"
+    " height = excluded.height, orientation = excluded.orientation, capture_date = excluded.capture_date,"
+    " camera_make = excluded.camera_make, camera_model = excluded.camera_model, lens = excluded.lens,"
+    " content_hash = excluded.content_hash;",
+    // FindImage
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM folders f CROSS JOIN images i"
+    " WHERE f.path = ?1 AND i.folder_id = f.id AND i.file_name = ?2;",
+    // FindDuplicate
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM images i CROSS JOIN folders f"
+    " WHERE i.content_hash = ?1 AND i.file_size = ?2 AND f.id = i.folder_id LIMIT 1;",
+    // GridAll
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM images i CROSS JOIN folders f"
+    " WHERE (i.capture_date, i.id) > (?1, ?2) AND i.rating >= ?3 AND f.id = i.folder_id"
+    " ORDER BY i.capture_date, i.id LIMIT ?4;",
+    // GridFolder (?5 folder path)
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM images i CROSS JOIN folders f"
+    " WHERE i.folder_id = (SELECT id FROM folders WHERE path = ?5)"
+    " AND (i.capture_date, i.id) > (?1, ?2) AND i.rating >= ?3 AND f.id = i.folder_id"
+    " ORDER BY i.capture_date, i.id LIMIT ?4;",
+    // GridKeyword (?5 keyword, ?6 folder path or NULL)
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM image_keywords k CROSS JOIN images i CROSS JOIN folders f"
+    " WHERE k.keyword_id = (SELECT id FROM keywords WHERE name = ?5) AND i.id = k.image_id"
+    " AND (i.capture_date, i.id) > (?1, ?2) AND i.rating >= ?3 AND f.id = i.folder_id"
+    " AND (?6 IS NULL OR f.path = ?6)"
+    " ORDER BY i.capture_date, i.id LIMIT ?4;",
+    // FolderImages
+    "SELECT " CM_CATALOG_IMAGE_COLUMNS " FROM folders f CROSS JOIN images i"
+    " WHERE f.path = ?1 AND i.folder_id = f.id;",
+    // FoldersUnder (?1 root, ?2 root and separator, ?3 root and the character after the separator)
+    "SELECT path FROM folders WHERE path = ?1 OR (path > ?2 AND path < ?3);",
+    // RemoveImage
+    "DELETE FROM images WHERE folder_id = (SELECT id FROM folders WHERE path = ?1) AND file_name = ?2;",
+    // CountImages
+    "SELECT COUNT(*) FROM images;",
+    // SetRating
+    "UPDATE images SET rating = ?2 WHERE id = ?1;",
+    // SaveEdits
+    "INSERT OR REPLACE INTO edits (image_id, data, modified) VALUES (?1, ?2, ?3);",
+    // SetSidecarMtime
+    "UPDATE images SET sidecar_mtime = ?2, sidecar_size = ?3 WHERE id = ?1;",
+    // SetPerceptualHash
+    "UPDATE images SET perceptual_hash = ?2 WHERE id = ?1;",
+    // PerceptualHashes (walks the grid index: already in capture order)
+    "SELECT id, perceptual_hash, capture_date FROM images WHERE perceptual_hash <> 0 ORDER BY capture_date, id;",
+    // LoadEdits
+    "SELECT data FROM edits WHERE image_id = ?1;",
+    // FindSidecarEdits (the image by path, and its edits if any, in one lookup)
+    "SELECT i.id, i.sidecar_mtime, i.sidecar_size, e.data FROM folders f CROSS JOIN images i"
+    " LEFT JOIN edits e ON e.image_id = i.id"
+    " WHERE f.path = ?1 AND i.folder_id = f.id AND i.file_name = ?2;",
+    // InsertKeyword
+    "INSERT OR IGNORE INTO keywords (name) VALUES (?1);",
+    // FindKeyword
+    "SELECT id FROM keywords WHERE name = ?1;",
+    // TagImage
+    "INSERT OR IGNORE INTO image_keywords (keyword_id, image_id) VALUES (?1, ?2);",
+    // KeywordsOfImage
+    "SELECT k.name FROM image_keywords ik CROSS JOIN keywords k"
+    " WHERE ik.image_id = ?1 AND k.id = ik.keyword_id ORDER BY k.name;",
+    // StoreThumbnail
+    "INSERT OR REPLACE INTO thumbnails (image_id, edit_hash, width, height, format, data)"
+    " VALUES (?1, ?2, ?3, ?4, ?5, ?6);",
+    // LoadThumbnail
+    "SELECT width, height, format, data FROM thumbnails WHERE image_id = ?1 AND edit_hash = ?2;",
+};
+
+#undef CM_CATALOG_IMAGE_COLUMNS
+
+/**
+ * @brief Settings of both connections: a 64 MiB page cache (negative: in KiB), in-memory temporary tables.
+ */
+constexpr const char* k_connection_pragmas { "PRAGMA cache_size = -65536; PRAGMA temp_store = MEMORY;" };
+
+/**
+ * @brief Resets a statement when leaving the scope.
+ *
+ * A read statement left stepped keeps its read transaction open, which stops the WAL from
+ * being checkpointed: every use ends with a reset.
+ */
+class ScopedStatement {
+public:
+    explicit ScopedStatement(sqlite3_stmt* statement) noexcept
+        : m_statement(statement)
+    {
+    }
+
+    ~ScopedStatement()
+    {
+        sqlite3_reset(m_statement);
+    }
+
+    ScopedStatement(const ScopedStatement&) = delete;
+    ScopedStatement& operator=(const ScopedStatement&) = delete;
+
+private:
+    sqlite3_stmt* m_statement;
+};
+
+/**
+ * @brief Write transaction, rolled back unless committed.
+ */
+class Transaction {
+public:
+    explicit Transaction(sqlite3* db) noexcept
+        : m_db(db)
+    {
+    }
+
+    ~Transaction()
+    {
+        if (m_open) {
+            sqlite3_exec(m_db, "ROLLBACK;", nullptr, nullptr, nullptr);
+        }
+    }
+
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+    /**
+     * @brief Starts the transaction, taking the write lock at once (no deadlock on upgrade).
+     */
+    [[nodiscard]] bool begin() noexcept
+    {
+        m_open = sqlite3_exec(m_db, "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr) == SQLITE_OK;
+        return m_open;
+    }
+
+    [[nodiscard]] bool commit() noexcept
+    {
+        if (sqlite3_exec(m_db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            return false;
+        }
+        m_open = false;
+        return true;
+    }
+
+private:
+    sqlite3* m_db;
+    bool m_open{false};
+};
+
+/**
+ * @brief Seconds since the epoch.
+ */
+[[nodiscard]] std::int64_t now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Logs the last SQLite error of a connection.
+ * @return `CoreError::CatalogError`.
+ */
+[[nodiscard]] std::unexpected<ErrorHandling::CoreError> databaseError(sqlite3* db, std::string_view where)
+{
+    spdlog::error("[CatalogDatabase::{}]: {}", where, sqlite3_errmsg(db));
+    return std::unexpected(ErrorHandling::CoreError::CatalogError);
+}
+
+/**
+ * @brief Error of a failed write: `NotInCatalog` if it referenced an unknown image.
+ */
+[[nodiscard]] std::unexpected<ErrorHandling::CoreError> writeError(sqlite3* db, std::string_view where)
+{
+    if (sqlite3_extended_errcode(db) == SQLITE_CONSTRAINT_FOREIGNKEY) {
+        spdlog::warn("[CatalogDatabase::{}]: Image not in the catalog", where);
+        return std::unexpected(ErrorHandling::CoreError::NotInCatalog);
+    }
+    return databaseError(db, where);
+}
+
+void bindText(sqlite3_stmt* statement, int index, std::string_view text)
+{
+    sqlite3_bind_text(statement, index, text.data(), static_cast<int>(text.size()), SQLITE_STATIC);
+}
+
+[[nodiscard]] std::string columnText(sqlite3_stmt* statement, int column)
+{
+    const auto* text { sqlite3_column_text(statement, column) };
+    return text ? std::string(reinterpret_cast<const char*>(text), static_cast<std::size_t>(sqlite3_column_bytes(statement, column)))
+                : std::string();
+}
+
+/**
+ * @brief Reads the image record of the current row (`CM_CATALOG_IMAGE_COLUMNS`).
+ */
+[[nodiscard]] ImageRecord readImage(sqlite3_stmt* statement)
+{
+    ImageRecord record;
+    record.m_id = sqlite3_column_int64(statement, 0);
+    record.m_path = (std::filesystem::path(columnText(statement, 1)) / columnText(statement, 2)).string();
+    record.m_file_size = std::bit_cast<std::uint64_t>(sqlite3_column_int64(statement, 3));
+    record.m_file_mtime = sqlite3_column_int64(statement, 4);
+    record.m_metadata.m_width = static_cast<Common::ImageDim>(sqlite3_column_int64(statement, 5));
+    record.m_metadata.m_height = static_cast<Common::ImageDim>(sqlite3_column_int64(statement, 6));
+    record.m_metadata.m_orientation = sqlite3_column_int(statement, 7);
+    record.m_metadata.m_capture_date = columnText(statement, 8);
+    record.m_metadata.m_camera_make = columnText(statement, 9);
+    record.m_metadata.m_camera_model = columnText(statement, 10);
+    record.m_metadata.m_lens = columnText(statement, 11);
+    record.m_rating = sqlite3_column_int(statement, 12);
+    record.m_import_time = sqlite3_column_int64(statement, 13);
+    record.m_sidecar_mtime = sqlite3_column_int64(statement, 14);
+    record.m_content_hash = std::bit_cast<std::uint64_t>(sqlite3_column_int64(statement, 15));
+    record.m_perceptual_hash = std::bit_cast<std::uint64_t>(sqlite3_column_int64(statement, 16));
+    record.m_sidecar_size = std::bit_cast<std::uint64_t>(sqlite3_column_int64(statement, 17));
+    return record;
+}
+
+} // anonymous namespace
+
+std::expected<std::unique_ptr<CatalogDatabase>, ErrorHandling::CoreError>
+CatalogDatabase::open(const std::filesystem::path& database)
+{
+    std::error_code ec;
+    if (database.has_parent_path()) {
+        std::filesystem::create_directories(database.parent_path(), ec);
+    }
+
+    std::unique_ptr<CatalogDatabase> catalog { new CatalogDatabase() };
+    Connection& write { catalog->m_write };
+    Connection& read { catalog->m_read };
+
+    // Each connection is serialized by its own mutex: SQLite's mutexes are not needed
+    if (sqlite3_open_v2(database.string().c_str(), &write.m_db,
+                        SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+        spdlog::error("[CatalogDatabase::open]: Cannot open '{}': {}", database.string(),
+                      write.m_db ? sqlite3_errmsg(write.m_db) : "out of memory");
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    // WAL: readers never wait for the writer; NORMAL sync loses no committed transaction on a
+    // process crash and syncs at checkpoints only
+    sqlite3_busy_timeout(write.m_db, 5000);
+    sqlite3_extended_result_codes(write.m_db, 1);
+    if (sqlite3_exec(write.m_db, "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL; PRAGMA foreign_keys = ON;",
+                     nullptr, nullptr, nullptr) != SQLITE_OK
+        || sqlite3_exec(write.m_db, k_connection_pragmas, nullptr, nullptr, nullptr) != SQLITE_OK) {
+        return databaseError(write.m_db, "open");
+    }
+
+    // ============================================================
+    // Schema
+    // ============================================================
+    int version { 0 };
+    sqlite3_stmt* user_version { nullptr };
+    if (sqlite3_prepare_v2(write.m_db, "PRAGMA user_version;", -1, &user_version, nullptr) != SQLITE_OK) {
+        return databaseError(write.m_db, "open");
+    }
+    if (sqlite3_step(user_version) == SQLITE_ROW) {
+        version = sqlite3_column_int(user_version, 0);
+    }
+    sqlite3_finalize(user_version);
+
+    if (version > k_schema_version) {
+        spdlog::error("[CatalogDatabase::open]: '{}' has schema {}, newer than {}", database.string(), version, k_schema_version);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+    if (version < k_schema_version) {
+        static_assert(k_migrations.size() == k_schema_version - 1);
+
+        // A new catalog gets the current schema, an older one its missing upgrades
+        Transaction transaction { write.m_db };
+        if (!transaction.begin()) {
+            return databaseError(write.m_db, "open");
+        }
+        if (version == 0) {
+            if (sqlite3_exec(write.m_db, k_schema, nullptr, nullptr, nullptr) != SQLITE_OK) {
+                return databaseError(write.m_db, "open");
+            }
+        } else {
+            for (int step = version - 1; step < k_schema_version - 1; ++step) {
+                if (sqlite3_exec(write.m_db, k_migrations[static_cast<std::size_t>(step)], nullptr, nullptr, nullptr) != SQLITE_OK) {
+                    return databaseError(write.m_db, "open");
+                }
+            }
+            spdlog::info("[CatalogDatabase::open]: '{}' upgraded from schema {} to {}", database.string(), version, k_schema_version);
+        }
+        const std::string set_version { "PRAGMA user_version = " + std::to_string(k_schema_version) + ";" };
+        if (sqlite3_exec(write.m_db, set_version.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK || !transaction.commit()) {
+            return databaseError(write.m_db, "open");
+        }
+    }
+
+    // ============================================================
+    // Read connection (the WAL exists now)
+    // ============================================================
+    if (sqlite3_open_v2(database.string().c_str(), &read.m_db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+        spdlog::error("[CatalogDatabase::open]: Cannot open '{}' for reading: {}", database.string(),
+                      read.m_db ? sqlite3_errmsg(read.m_db) : "out of memory");
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+    sqlite3_busy_timeout(read.m_db, 5000);
+    if (sqlite3_exec(read.m_db, k_connection_pragmas, nullptr, nullptr, nullptr) != SQLITE_OK
+        || sqlite3_exec(read.m_db, "PRAGMA mmap_size = 268435456;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        return databaseError(read.m_db, "open");
+    }
+
+    spdlog::info("[CatalogDatabase::open]: '{}' opened (schema {})", database.string(), k_schema_version);
+
+    return catalog;
+}
+
+std::expected<ImageRecord, ErrorHandling::CoreError>
+CatalogDatabase::makeRecord(std::string_view path, const Managers::ImageMetadata& metadata)
+{
+    std::error_code ec;
+    const std::filesystem::path source { std::filesystem::absolute(std::filesystem::path(path), ec).lexically_normal() };
+    if (ec) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    const auto size { std::filesystem::file_size(source, ec) };
+    if (ec) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    const auto mtime { fileTime(source) };
+    if (!mtime) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    ImageRecord record;
+    record.m_path = source.string();
+    record.m_file_size = static_cast<std::uint64_t>(size);
+    record.m_file_mtime = *mtime;
+    record.m_metadata = metadata;
+    return record;
+}
+
+std::optional<std::int64_t> CatalogDatabase::fileTime(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    const auto mtime { std::filesystem::last_write_time(path, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+    return static_cast<std::int64_t>(mtime.time_since_epoch().count());
+}
+
+CatalogDatabase::~CatalogDatabase()
+{
+    {
+        std::lock_guard lock(m_read.m_mutex);
+        close_unsafe(m_read);
+    }
+    std::lock_guard lock(m_write.m_mutex);
+    close_unsafe(m_write);
+}
+
+std::expected<std::size_t, ErrorHandling::CoreError> CatalogDatabase::addImages(std::span<const ImageRecord> records)
+{
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* upsert { statement_unsafe(m_write, Statement::UpsertImage) };
+    if (!upsert) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    const auto failed = [this](std::string_view where) {
+        // Folders inserted by the rolled back batch are gone
+        m_folder_ids.clear();
+        return databaseError(m_write.m_db, where);
+    };
+
+    const std::int64_t import_time { now() };
+    std::size_t written { 0 };
+
+    for (std::size_t begin = 0; begin < records.size(); begin += k_import_batch_rows) {
+        const auto batch { records.subspan(begin, std::min(k_import_batch_rows, records.size() - begin)) };
+
+        Transaction transaction { m_write.m_db };
+        if (!transaction.begin()) {
+            return failed("addImages");
+        }
+
+        for (const ImageRecord& record : batch) {
+            const std::filesystem::path path { record.m_path };
+            const auto folder { folderId_unsafe(path.parent_path().string()) };
+            if (!folder) {
+                return failed("addImages");
+            }
+            const std::string file_name { path.filename().string() };
+            const auto& metadata { record.m_metadata };
+
+            ScopedStatement scope { upsert };
+            sqlite3_bind_int64(upsert, 1, *folder);
+            bindText(upsert, 2, file_name);
+            sqlite3_bind_int64(upsert, 3, std::bit_cast<sqlite3_int64>(record.m_file_size));
+            sqlite3_bind_int64(upsert, 4, record.m_file_mtime);
+            sqlite3_bind_int64(upsert, 5, static_cast<sqlite3_int64>(metadata.m_width));
+            sqlite3_bind_int64(upsert, 6, static_cast<sqlite3_int64>(metadata.m_height));
+            sqlite3_bind_int(upsert, 7, metadata.m_orientation);
+            bindText(upsert, 8, metadata.m_capture_date);
+            bindText(upsert, 9, metadata.m_camera_make);
+            bindText(upsert, 10, metadata.m_camera_model);
+            bindText(upsert, 11, metadata.m_lens);
+            sqlite3_bind_int64(upsert, 12, import_time);
+            sqlite3_bind_int64(upsert, 13, std::bit_cast<sqlite3_int64>(record.m_content_hash));
+            sqlite3_bind_int64(upsert, 14, std::bit_cast<sqlite3_int64>(record.m_perceptual_hash));
+            if (sqlite3_step(upsert) != SQLITE_DONE) {
+                return failed("addImages");
+            }
+        }
+
+        if (!transaction.commit()) {
+            return failed("addImages");
+        }
+        written += batch.size();
+    }
+
+    spdlog::debug("[CatalogDatabase::addImages]: {} image(s) written", written);
+
+    return written;
+}
+
+std::expected<std::optional<ImageRecord>, ErrorHandling::CoreError>
+CatalogDatabase::findImage(std::string_view path) const
+{
+    std::error_code ec;
+    const std::filesystem::path file { std::filesystem::absolute(std::filesystem::path(path), ec).lexically_normal() };
+    if (ec) {
+        return std::nullopt;
+    }
+    const std::string folder { file.parent_path().string() };
+    const std::string file_name { file.filename().string() };
+
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* find { statement_unsafe(m_read, Statement::FindImage) };
+    if (!find) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { find };
+    bindText(find, 1, folder);
+    bindText(find, 2, file_name);
+
+    switch (sqlite3_step(find)) {
+    case SQLITE_ROW:
+        return readImage(find);
+    case SQLITE_DONE:
+        return std::nullopt;
+    default:
+        return databaseError(m_read.m_db, "findImage");
+    }
+}
+
+std::expected<std::optional<ImageRecord>, ErrorHandling::CoreError>
+CatalogDatabase::findDuplicate(std::uint64_t content_hash, std::uint64_t file_size) const
+{
+    if (content_hash == 0) {
+        return std::nullopt;
+    }
+
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* find { statement_unsafe(m_read, Statement::FindDuplicate) };
+    if (!find) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { find };
+    sqlite3_bind_int64(find, 1, std::bit_cast<sqlite3_int64>(content_hash));
+    sqlite3_bind_int64(find, 2, std::bit_cast<sqlite3_int64>(file_size));
+
+    switch (sqlite3_step(find)) {
+    case SQLITE_ROW:
+        return readImage(find);
+    case SQLITE_DONE:
+        return std::nullopt;
+    default:
+        return databaseError(m_read.m_db, "findDuplicate");
+    }
+}
+
+std::expected<std::vector<ImageRecord>, ErrorHandling::CoreError>
+CatalogDatabase::queryGrid(const GridQuery& query) const
+{
+    std::vector<ImageRecord> page;
+    if (query.m_limit == 0) {
+        return page;
+    }
+
+    const Statement kind { query.m_keyword ? Statement::GridKeyword
+                         : query.m_folder ? Statement::GridFolder
+                                          : Statement::GridAll };
+
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* grid { statement_unsafe(m_read, kind) };
+    if (!grid) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { grid };
+    bindText(grid, 1, query.m_after.m_capture_date);
+    sqlite3_bind_int64(grid, 2, query.m_after.m_id);
+    sqlite3_bind_int(grid, 3, query.m_min_rating);
+    sqlite3_bind_int64(grid, 4, static_cast<sqlite3_int64>(std::min<std::size_t>(query.m_limit, INT64_MAX)));
+    if (kind == Statement::GridKeyword) {
+        bindText(grid, 5, *query.m_keyword);
+        if (query.m_folder) {
+            bindText(grid, 6, *query.m_folder);
+        }
+    } else if (kind == Statement::GridFolder) {
+        bindText(grid, 5, *query.m_folder);
+    }
+
+    page.reserve(std::min<std::size_t>(query.m_limit, 1024));
+    int result { SQLITE_ROW };
+    while ((result = sqlite3_step(grid)) == SQLITE_ROW) {
+        page.push_back(readImage(grid));
+    }
+    if (result != SQLITE_DONE) {
+        return databaseError(m_read.m_db, "queryGrid");
+    }
+
+    return page;
+}
+
+std::expected<std::vector<ImageRecord>, ErrorHandling::CoreError> CatalogDatabase::folderImages(std::string_view folder) const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* list { statement_unsafe(m_read, Statement::FolderImages) };
+    if (!list) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { list };
+    bindText(list, 1, folder);
+
+    std::vector<ImageRecord> images;
+    int result { SQLITE_ROW };
+    while ((result = sqlite3_step(list)) == SQLITE_ROW) {
+        images.push_back(readImage(list));
+    }
+    if (result != SQLITE_DONE) {
+        return databaseError(m_read.m_db, "folderImages");
+    }
+    return images;
+}
+
+std::expected<std::vector<std::string>, ErrorHandling::CoreError>
+CatalogDatabase::foldersUnder(const std::filesystem::path& root) const
+{
+    // The folders below `root` sort after "root/" and before "root" and the character after the separator
+    std::string base { root.lexically_normal().string() };
+    while (base.size() > 1 && (base.back() == '/' || base.back() == static_cast<char>(std::filesystem::path::preferred_separator))) {
+        base.pop_back();
+    }
+    const char separator { static_cast<char>(std::filesystem::path::preferred_separator) };
+    const std::string lower { base + separator };
+    const std::string upper { base + static_cast<char>(separator + 1) };
+
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* list { statement_unsafe(m_read, Statement::FoldersUnder) };
+    if (!list) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { list };
+    bindText(list, 1, base);
+    bindText(list, 2, lower);
+    bindText(list, 3, upper);
+
+    std::vector<std::string> folders;
+    int result { SQLITE_ROW };
+    while ((result = sqlite3_step(list)) == SQLITE_ROW) {
+        folders.push_back(columnText(list, 0));
+    }
+    if (result != SQLITE_DONE) {
+        return databaseError(m_read.m_db, "foldersUnder");
+    }
+    return folders;
+}
+
+std::expected<std::size_t, ErrorHandling::CoreError> CatalogDatabase::removeImages(std::span<const std::string> paths)
+{
+    if (paths.empty()) {
+        return 0;
+    }
+
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* remove { statement_unsafe(m_write, Statement::RemoveImage) };
+    if (!remove) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    Transaction transaction { m_write.m_db };
+    if (!transaction.begin()) {
+        return databaseError(m_write.m_db, "removeImages");
+    }
+
+    std::size_t removed { 0 };
+    for (const std::string& path : paths) {
+        const std::filesystem::path file { path };
+        const std::string folder { file.parent_path().string() };
+        const std::string file_name { file.filename().string() };
+
+        ScopedStatement scope { remove };
+        bindText(remove, 1, folder);
+        bindText(remove, 2, file_name);
+        if (sqlite3_step(remove) != SQLITE_DONE) {
+            return databaseError(m_write.m_db, "removeImages");
+        }
+        removed += static_cast<std::size_t>(sqlite3_changes(m_write.m_db));
+    }
+
+    if (!transaction.commit()) {
+        return databaseError(m_write.m_db, "removeImages");
+    }
+    return removed;
+}
+
+std::expected<std::uint64_t, ErrorHandling::CoreError> CatalogDatabase::imageCount() const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* count { statement_unsafe(m_read, Statement::CountImages) };
+    if (!count) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { count };
+    if (sqlite3_step(count) != SQLITE_ROW) {
+        return databaseError(m_read.m_db, "imageCount");
+    }
+    return static_cast<std::uint64_t>(sqlite3_column_int64(count, 0));
+}
+
+std::expected<void, ErrorHandling::CoreError> CatalogDatabase::setRating(ImageId image, int rating)
+{
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* update { statement_unsafe(m_write, Statement::SetRating) };
+    if (!update) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { update };
+    sqlite3_bind_int64(update, 1, image);
+    sqlite3_bind_int(update, 2, std::clamp(rating, 0, 5));
+    if (sqlite3_step(update) != SQLITE_DONE) {
+        return databaseError(m_write.m_db, "setRating");
+    }
+    if (sqlite3_changes(m_write.m_db) == 0) {
+        return std::unexpected(ErrorHandling::CoreError::NotInCatalog);
+    }
+    return {};
+}
+
+std::expected<std::vector<PerceptualHashEntry>, ErrorHandling::CoreError> CatalogDatabase::perceptualHashes() const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* hashes { statement_unsafe(m_read, Statement::PerceptualHashes) };
+    if (!hashes) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { hashes };
+    std::vector<PerceptualHashEntry> entries;
+    int result { SQLITE_ROW };
+    while ((result = sqlite3_step(hashes)) == SQLITE_ROW) {
+        entries.push_back(PerceptualHashEntry {
+            sqlite3_column_int64(hashes, 0),
+            std::bit_cast<std::uint64_t>(sqlite3_column_int64(hashes, 1)),
+            columnText(hashes, 2) });
+    }
+    if (result != SQLITE_DONE) {
+        return databaseError(m_read.m_db, "perceptualHashes");
+    }
+    return entries;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogDatabase::saveEdits(ImageId image, std::span<const Operations::OperationDescriptor> operations)
+{
+    const std::string encoded { Serializer::encodeEditStack(operations) };
+
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* save { statement_unsafe(m_write, Statement::SaveEdits) };
+    if (!save) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { save };
+    sqlite3_bind_int64(save, 1, image);
+    sqlite3_bind_blob(save, 2, encoded.data(), static_cast<int>(encoded.size()), SQLITE_STATIC);
+    sqlite3_bind_int64(save, 3, now());
+    if (sqlite3_step(save) != SQLITE_DONE) {
+        return writeError(m_write.m_db, "saveEdits");
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogDatabase::setSidecarMtime(ImageId image, std::int64_t mtime, std::uint64_t size)
+{
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* update { statement_unsafe(m_write, Statement::SetSidecarMtime) };
+    if (!update) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { update };
+    sqlite3_bind_int64(update, 1, image);
+    sqlite3_bind_int64(update, 2, mtime);
+    sqlite3_bind_int64(update, 3, std::bit_cast<std::int64_t>(size));
+    if (sqlite3_step(update) != SQLITE_DONE) {
+        return databaseError(m_write.m_db, "setSidecarMtime");
+    }
+    if (sqlite3_changes(m_write.m_db) == 0) {
+        return std::unexpected(ErrorHandling::CoreError::NotInCatalog);
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogDatabase::saveSidecarEdits(ImageId image, std::span<const Operations::OperationDescriptor> operations,
+                                  std::int64_t sidecar_mtime, std::uint64_t sidecar_size)
+{
+    const std::string encoded { Serializer::encodeEditStack(operations) };
+
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* save { statement_unsafe(m_write, Statement::SaveEdits) };
+    sqlite3_stmt* update { statement_unsafe(m_write, Statement::SetSidecarMtime) };
+    if (!save || !update) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    // Both or neither: edits recorded against a sidecar they were not read from would be served as its own
+    Transaction transaction { m_write.m_db };
+    if (!transaction.begin()) {
+        return databaseError(m_write.m_db, "saveSidecarEdits");
+    }
+
+    {
+        ScopedStatement scope { save };
+        sqlite3_bind_int64(save, 1, image);
+        sqlite3_bind_blob(save, 2, encoded.data(), static_cast<int>(encoded.size()), SQLITE_STATIC);
+        sqlite3_bind_int64(save, 3, now());
+        if (sqlite3_step(save) != SQLITE_DONE) {
+            return writeError(m_write.m_db, "saveSidecarEdits");
+        }
+    }
+    {
+        ScopedStatement scope { update };
+        sqlite3_bind_int64(update, 1, image);
+        sqlite3_bind_int64(update, 2, sidecar_mtime);
+        sqlite3_bind_int64(update, 3, std::bit_cast<std::int64_t>(sidecar_size));
+        if (sqlite3_step(update) != SQLITE_DONE) {
+            return databaseError(m_write.m_db, "saveSidecarEdits");
+        }
+    }
+
+    if (!transaction.commit()) {
+        return databaseError(m_write.m_db, "saveSidecarEdits");
+    }
+    return {};
+}
+
+std::expected<std::optional<SidecarEdits>, ErrorHandling::CoreError>
+CatalogDatabase::findSidecarEdits(std::string_view path) const
+{
+    std::error_code ec;
+    const std::filesystem::path file { std::filesystem::absolute(std::filesystem::path(path), ec).lexically_normal() };
+    if (ec) {
+        return std::nullopt;
+    }
+    const std::string folder { file.parent_path().string() };
+    const std::string file_name { file.filename().string() };
+
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* find { statement_unsafe(m_read, Statement::FindSidecarEdits) };
+    if (!find) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { find };
+    bindText(find, 1, folder);
+    bindText(find, 2, file_name);
+
+    switch (sqlite3_step(find)) {
+    case SQLITE_ROW: {
+        SidecarEdits edits;
+        edits.m_id = sqlite3_column_int64(find, 0);
+        edits.m_sidecar_mtime = sqlite3_column_int64(find, 1);
+        edits.m_sidecar_size = std::bit_cast<std::uint64_t>(sqlite3_column_int64(find, 2));
+        if (sqlite3_column_type(find, 3) != SQLITE_NULL) {
+            // Decoded in place: the blob is valid until the statement is reset
+            const auto* data { static_cast<const std::byte*>(sqlite3_column_blob(find, 3)) };
+            const auto size { static_cast<std::size_t>(sqlite3_column_bytes(find, 3)) };
+            if (auto operations = Serializer::decodeEditStack(std::span<const std::byte>(data, size))) {
+                edits.m_operations = std::move(*operations);
+            } else {
+                spdlog::warn("[CatalogDatabase::findSidecarEdits]: Unreadable edits of '{}', ignored", path);
+            }
+        }
+        return edits;
+    }
+    case SQLITE_DONE:
+        return std::nullopt;
+    default:
+        return databaseError(m_read.m_db, "findSidecarEdits");
+    }
+}
+
+std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+CatalogDatabase::loadEdits(ImageId image) const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* load { statement_unsafe(m_read, Statement::LoadEdits) };
+    if (!load) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { load };
+    sqlite3_bind_int64(load, 1, image);
+
+    switch (sqlite3_step(load)) {
+    case SQLITE_ROW: {
+        // Decoded in place: the blob is valid until the statement is reset
+        const auto* data { static_cast<const std::byte*>(sqlite3_column_blob(load, 0)) };
+        const auto size { static_cast<std::size_t>(sqlite3_column_bytes(load, 0)) };
+        return Serializer::decodeEditStack(std::span<const std::byte>(data, size));
+    }
+    case SQLITE_DONE:
+        return std::vector<Operations::OperationDescriptor>{};
+    default:
+        return databaseError(m_read.m_db, "loadEdits");
+    }
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogDatabase::tagImages(std::span<const ImageId> images, std::string_view keyword)
+{
+    if (images.empty()) {
+        return {};
+    }
+    if (keyword.empty()) {
+        spdlog::warn("[CatalogDatabase::tagImages]: Empty keyword");
+        return {};
+    }
+
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* insert_keyword { statement_unsafe(m_write, Statement::InsertKeyword) };
+    sqlite3_stmt* find_keyword { statement_unsafe(m_write, Statement::FindKeyword) };
+    sqlite3_stmt* tag { statement_unsafe(m_write, Statement::TagImage) };
+    if (!insert_keyword || !find_keyword || !tag) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    Transaction transaction { m_write.m_db };
+    if (!transaction.begin()) {
+        return databaseError(m_write.m_db, "tagImages");
+    }
+
+    std::int64_t keyword_id { 0 };
+    {
+        ScopedStatement insert_scope { insert_keyword };
+        ScopedStatement find_scope { find_keyword };
+        bindText(insert_keyword, 1, keyword);
+        bindText(find_keyword, 1, keyword);
+        if (sqlite3_step(insert_keyword) != SQLITE_DONE || sqlite3_step(find_keyword) != SQLITE_ROW) {
+            return databaseError(m_write.m_db, "tagImages");
+        }
+        keyword_id = sqlite3_column_int64(find_keyword, 0);
+    }
+
+    for (const ImageId image : images) {
+        ScopedStatement scope { tag };
+        sqlite3_bind_int64(tag, 1, keyword_id);
+        sqlite3_bind_int64(tag, 2, image);
+        if (sqlite3_step(tag) != SQLITE_DONE) {
+            return writeError(m_write.m_db, "tagImages");
+        }
+    }
+
+    if (!transaction.commit()) {
+        return databaseError(m_write.m_db, "tagImages");
+    }
+    return {};
+}
+
+std::expected<std::vector<std::string>, ErrorHandling::CoreError> CatalogDatabase::keywordsOf(ImageId image) const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* keywords { statement_unsafe(m_read, Statement::KeywordsOfImage) };
+    if (!keywords) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { keywords };
+    sqlite3_bind_int64(keywords, 1, image);
+
+    std::vector<std::string> names;
+    int result { SQLITE_ROW };
+    while ((result = sqlite3_step(keywords)) == SQLITE_ROW) {
+        names.push_back(columnText(keywords, 0));
+    }
+    if (result != SQLITE_DONE) {
+        return databaseError(m_read.m_db, "keywordsOf");
+    }
+    return names;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogDatabase::storeThumbnail(ImageId image, std::uint64_t edit_hash, const Thumbnails::Thumbnail& thumbnail)
+{
+    if (thumbnail.m_encoded.empty()) {
+        return {};
+    }
+
+    std::lock_guard lock(m_write.m_mutex);
+
+    sqlite3_stmt* store { statement_unsafe(m_write, Statement::StoreThumbnail) };
+    sqlite3_stmt* set_hash { statement_unsafe(m_write, Statement::SetPerceptualHash) };
+    if (!store || !set_hash) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    Transaction transaction { m_write.m_db };
+    if (!transaction.begin()) {
+        return databaseError(m_write.m_db, "storeThumbnail");
+    }
+
+    {
+        ScopedStatement scope { store };
+        sqlite3_bind_int64(store, 1, image);
+        sqlite3_bind_int64(store, 2, std::bit_cast<sqlite3_int64>(edit_hash));
+        sqlite3_bind_int64(store, 3, static_cast<sqlite3_int64>(thumbnail.m_width));
+        sqlite3_bind_int64(store, 4, static_cast<sqlite3_int64>(thumbnail.m_height));
+        bindText(store, 5, thumbnail.m_format);
+        sqlite3_bind_blob(store, 6, thumbnail.m_encoded.data(), static_cast<int>(thumbnail.m_encoded.size()), SQLITE_STATIC);
+        if (sqlite3_step(store) != SQLITE_DONE) {
+            return writeError(m_write.m_db, "storeThumbnail");
+        }
+    }
+
+    if (thumbnail.m_perceptual_hash != 0) {
+        ScopedStatement scope { set_hash };
+        sqlite3_bind_int64(set_hash, 1, image);
+        sqlite3_bind_int64(set_hash, 2, std::bit_cast<sqlite3_int64>(thumbnail.m_perceptual_hash));
+        if (sqlite3_step(set_hash) != SQLITE_DONE) {
+            return databaseError(m_write.m_db, "storeThumbnail");
+        }
+    }
+
+    if (!transaction.commit()) {
+        return databaseError(m_write.m_db, "storeThumbnail");
+    }
+    return {};
+}
+
+std::expected<std::optional<Thumbnails::Thumbnail>, ErrorHandling::CoreError>
+CatalogDatabase::loadThumbnail(ImageId image, std::uint64_t edit_hash) const
+{
+    std::lock_guard lock(m_read.m_mutex);
+
+    sqlite3_stmt* load { statement_unsafe(m_read, Statement::LoadThumbnail) };
+    if (!load) {
+        return std::unexpected(ErrorHandling::CoreError::CatalogError);
+    }
+
+    ScopedStatement scope { load };
+    sqlite3_bind_int64(load, 1, image);
+    sqlite3_bind_int64(load, 2, std::bit_cast<sqlite3_int64>(edit_hash));
+
+    switch (sqlite3_step(load)) {
+    case SQLITE_ROW: {
+        Thumbnails::Thumbnail thumbnail;
+        thumbnail.m_width = static_cast<Common::ImageDim>(sqlite3_column_int64(load, 0));
+        thumbnail.m_height = static_cast<Common::ImageDim>(sqlite3_column_int64(load, 1));
+        thumbnail.m_format = columnText(load, 2);
+        const void* data { sqlite3_column_blob(load, 3) };
+        const int size { sqlite3_column_bytes(load, 3) };
+        thumbnail.m_encoded.resize(static_cast<std::size_t>(size));
+        if (size > 0) {
+            std::memcpy(thumbnail.m_encoded.data(), data, static_cast<std::size_t>(size));
+        }
+        return thumbnail;
+    }
+    case SQLITE_DONE:
+        return std::nullopt;
+    default:
+        return databaseError(m_read.m_db, "loadThumbnail");
+    }
+}
+
+sqlite3_stmt* CatalogDatabase::statement_unsafe(Connection& connection, Statement statement)
+{
+    static_assert(k_statement_sql.size() == static_cast<std::size_t>(Statement::Count));
+
+    sqlite3_stmt*& prepared { connection.m_statements[static_cast<std::size_t>(statement)] };
+    if (prepared) {
+        sqlite3_clear_bindings(prepared);
+        return prepared;
+    }
+
+    const char* sql { k_statement_sql[static_cast<std::size_t>(statement)] };
+    if (sqlite3_prepare_v3(connection.m_db, sql, -1, SQLITE_PREPARE_PERSISTENT, &prepared, nullptr) != SQLITE_OK) {
+        spdlog::error("[CatalogDatabase::statement_unsafe]: Cannot prepare '{}': {}", sql, sqlite3_errmsg(connection.m_db));
+        prepared = nullptr;
+    }
+    return prepared;
+}
+
+std::optional<std::int64_t> CatalogDatabase::folderId_unsafe(const std::string& folder)
+{
+    if (const auto it = m_folder_ids.find(folder); it != m_folder_ids.end()) {
+        return it->second;
+    }
+
+    sqlite3_stmt* insert { statement_unsafe(m_write, Statement::InsertFolder) };
+    sqlite3_stmt* find { statement_unsafe(m_write, Statement::FindFolder) };
+    if (!insert || !find) {
+        return std::nullopt;
+    }
+
+    ScopedStatement insert_scope { insert };
+    ScopedStatement find_scope { find };
+    bindText(insert, 1, folder);
+    bindText(find, 1, folder);
+    if (sqlite3_step(insert) != SQLITE_DONE || sqlite3_step(find) != SQLITE_ROW) {
+        return std::nullopt;
+    }
+
+    const std::int64_t id { sqlite3_column_int64(find, 0) };
+    m_folder_ids.emplace(folder, id);
+    return id;
+}
+
+void CatalogDatabase::close_unsafe(Connection& connection) noexcept
+{
+    for (sqlite3_stmt*& statement : connection.m_statements) {
+        sqlite3_finalize(std::exchange(statement, nullptr));
+    }
+    sqlite3_close(std::exchange(connection.m_db, nullptr));
+}
+
+} // namespace CaptureMoment::Core::Catalog
@@ -0,0 +1,78 @@
+/**
+ * @file catalog_edits_reader.cpp
+ * @brief Implementation of CatalogEditsReader
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/catalog_edits_reader.h"
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace CaptureMoment::Core::Catalog {
+
+CatalogEditsReader::CatalogEditsReader(CatalogDatabase& catalog,
+                                       std::unique_ptr<Serializer::IXmpPathStrategy> xmp_paths,
+                                       std::unique_ptr<Serializer::IFileSerializerReader> reader)
+    : m_catalog(catalog)
+    , m_xmp_paths(std::move(xmp_paths))
+    , m_reader(std::move(reader))
+{
+    if (!m_xmp_paths || !m_reader) {
+        spdlog::error("[CatalogEditsReader::CatalogEditsReader]: Constructor received a null IXmpPathStrategy or IFileSerializerReader.");
+        throw std::invalid_argument("CatalogEditsReader: IXmpPathStrategy and IFileSerializerReader cannot be null.");
+    }
+}
+
+std::vector<Operations::OperationDescriptor> CatalogEditsReader::loadFromFile(std::string_view source_image_path) const
+{
+    CM_TRACE_SCOPE("xmp", "CatalogEditsReader::loadFromFile");
+
+    if (source_image_path.empty()) {
+        spdlog::error("[CatalogEditsReader::loadFromFile]: Source image path is empty.");
+        return {};
+    }
+
+    // ============================================================
+    // The sidecar's stamp; without a sidecar there is nothing to parse
+    // ============================================================
+    const std::filesystem::path sidecar { m_xmp_paths->getXmpPathForImage(source_image_path) };
+    std::error_code ec;
+    const auto sidecar_size { std::filesystem::file_size(sidecar, ec) };
+    const auto sidecar_mtime { ec ? std::nullopt : CatalogDatabase::fileTime(sidecar) };
+    if (!sidecar_mtime) {
+        return m_reader->loadFromFile(source_image_path);
+    }
+
+    // ============================================================
+    // Unchanged since the catalog parsed it: one indexed lookup
+    // ============================================================
+    const auto cataloged { m_catalog.findSidecarEdits(source_image_path) };
+    if (cataloged && *cataloged && (*cataloged)->m_operations && (*cataloged)->m_sidecar_mtime == *sidecar_mtime
+        && (*cataloged)->m_sidecar_size == sidecar_size) {
+        spdlog::debug("[CatalogEditsReader::loadFromFile]: {} operations of '{}' from the catalog",
+                      (*cataloged)->m_operations->size(), source_image_path);
+        return std::move(*(*cataloged)->m_operations);
+    }
+
+    // ============================================================
+    // Changed (or never read): parse, and catalog the result for the next open
+    // ============================================================
+    std::vector<Operations::OperationDescriptor> operations { m_reader->loadFromFile(source_image_path) };
+    if (cataloged && *cataloged) {
+        if (auto saved = m_catalog.saveSidecarEdits((*cataloged)->m_id, operations, *sidecar_mtime, sidecar_size); !saved) {
+            spdlog::warn("[CatalogEditsReader::loadFromFile]: Cannot catalog the edits of '{}' (error {})",
+                         source_image_path, static_cast<int>(saved.error()));
+        }
+    }
+    return operations;
+}
+
+} // namespace CaptureMoment::Core::Catalog
@@ -0,0 +1,410 @@
+/**
+ * @file catalog_sync.cpp
+ * @brief Implementation of CatalogSync
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/catalog_sync.h"
+#include "managers/source_manager.h"
+#include "serializer/strategy/sidecar_xmp_path_strategy.h"
+
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Absolute, normalized form of a path, without a trailing separator (the catalog's form).
+ */
+[[nodiscard]] std::filesystem::path normalized(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    std::filesystem::path result { std::filesystem::absolute(path, ec).lexically_normal() };
+    if (!result.has_filename() && result.has_relative_path()) {
+        result = result.parent_path();
+    }
+    return result;
+}
+
+/**
+ * @brief Lower-case extension of a path, with its dot.
+ */
+[[nodiscard]] std::string lowerExtension(const std::filesystem::path& path)
+{
+    std::string extension { path.extension().string() };
+    std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+} // anonymous namespace
+
+CatalogSync::CatalogSync(CatalogDatabase& catalog,
+                         std::unique_ptr<Serializer::IFileSerializerReader> reader,
+                         std::unique_ptr<Serializer::IXmpPathStrategy> xmp_paths,
+                         std::unique_ptr<Managers::ISourceManager> source,
+                         std::chrono::seconds reconcile_interval)
+    : m_catalog(catalog)
+    , m_reader(std::move(reader))
+    , m_xmp_paths(xmp_paths ? std::move(xmp_paths) : std::make_unique<Serializer::SidecarXmpPathStrategy>())
+    , m_source(source ? std::move(source) : std::make_unique<Managers::SourceManager>())
+    , m_reconcile_interval(reconcile_interval)
+{
+    m_thread = std::thread([this]() { run(); });
+
+    if (FolderWatcher::isSupported()) {
+        m_watcher = std::make_unique<FolderWatcher>([this](std::vector<std::filesystem::path> paths) {
+            onChanges(std::move(paths));
+        });
+    } else {
+        spdlog::warn("[CatalogSync::CatalogSync]: No change notifications on this platform: periodic reconciliation only");
+    }
+}
+
+CatalogSync::~CatalogSync()
+{
+    // No change arrives once the watcher is gone
+    m_watcher.reset();
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+std::expected<void, ErrorHandling::CoreError> CatalogSync::watch(const std::filesystem::path& root)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_directory(root, ec)) {
+        spdlog::warn("[CatalogSync::watch]: '{}' is not a directory", root.string());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+    const std::filesystem::path tree { normalized(root) };
+
+    if (m_watcher) {
+        if (auto watched = m_watcher->watch(tree); !watched) {
+            // A share without notifications: the periodic reconciliation keeps it in sync
+            spdlog::warn("[CatalogSync::watch]: No change notifications for '{}': periodic reconciliation only", tree.string());
+        }
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        if (std::ranges::find(m_roots, tree) == m_roots.end()) {
+            m_roots.push_back(tree);
+        }
+        m_unreconciled.push_back(tree);
+    }
+    m_wake.notify_all();
+    return {};
+}
+
+void CatalogSync::unwatch(const std::filesystem::path& root)
+{
+    const std::filesystem::path tree { normalized(root) };
+    if (m_watcher) {
+        m_watcher->unwatch(tree);
+    }
+
+    std::lock_guard lock(m_mutex);
+    std::erase(m_roots, tree);
+    std::erase(m_unreconciled, tree);
+}
+
+std::expected<SyncStats, ErrorHandling::CoreError> CatalogSync::reconcile(const std::filesystem::path& root)
+{
+    std::lock_guard lock(m_sync_mutex);
+    SyncStats stats;
+    if (auto reconciled = reconcile_unsafe(normalized(root), stats); !reconciled) {
+        return std::unexpected(reconciled.error());
+    }
+    return stats;
+}
+
+void CatalogSync::onChanges(std::vector<std::filesystem::path> paths)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        const auto now { std::chrono::steady_clock::now() };
+        if (m_pending.empty()) {
+            m_first_change = now;
+        }
+        m_last_change = now;
+        for (auto& path : paths) {
+            m_pending.insert(path.string());
+        }
+    }
+    m_wake.notify_all();
+}
+
+void CatalogSync::run()
+{
+    std::unique_lock lock(m_mutex);
+    auto next_reconcile { std::chrono::steady_clock::now() + m_reconcile_interval };
+
+    while (!m_stopping) {
+        auto deadline { next_reconcile };
+        if (!m_pending.empty()) {
+            deadline = std::min({ deadline, m_last_change + k_debounce, m_first_change + k_max_delay });
+        }
+        if (m_unreconciled.empty()) {
+            m_wake.wait_until(lock, deadline);
+        }
+        if (m_stopping) {
+            break;
+        }
+
+        const auto now { std::chrono::steady_clock::now() };
+        std::vector<std::filesystem::path> reconciled;
+        if (now >= next_reconcile) {
+            reconciled = m_roots;
+            m_unreconciled.clear();
+            next_reconcile = now + m_reconcile_interval;
+        } else {
+            reconciled = std::exchange(m_unreconciled, {});
+        }
+
+        std::vector<std::filesystem::path> changed;
+        if (!m_pending.empty() && (now >= m_last_change + k_debounce || now >= m_first_change + k_max_delay)) {
+            changed.assign(m_pending.begin(), m_pending.end());
+            m_pending.clear();
+        }
+
+        if (reconciled.empty() && changed.empty()) {
+            continue;
+        }
+
+        lock.unlock();
+        {
+            std::lock_guard sync(m_sync_mutex);
+            SyncStats stats;
+            for (const auto& root : reconciled) {
+                if (auto result = reconcile_unsafe(root, stats); !result) {
+                    spdlog::error("[CatalogSync::run]: Reconciliation of '{}' failed", root.string());
+                }
+            }
+            if (!changed.empty()) {
+                if (auto applied = applyChanges_unsafe(changed, stats); !applied) {
+                    spdlog::error("[CatalogSync::run]: {} changes not applied", changed.size());
+                }
+            }
+            spdlog::debug("[CatalogSync::run]: {} images updated, {} removed, {} edits refreshed",
+                          stats.m_images_updated, stats.m_images_removed, stats.m_edits_refreshed);
+        }
+        lock.lock();
+    }
+}
+
+std::expected<void, ErrorHandling::CoreError>
+CatalogSync::applyChanges_unsafe(const std::vector<std::filesystem::path>& paths, SyncStats& stats)
+{
+    std::vector<std::filesystem::path> trees;
+    std::unordered_set<std::string> images;
+
+    for (const auto& path : paths) {
+        std::error_code ec;
+        const auto status { std::filesystem::status(path, ec) };
+
+        if (lowerExtension(path) == ".xmp") {
+            // A sidecar changed: its image's edits are looked at
+            images.insert(normalized(m_xmp_paths->getImagePathFromXmp(path.string())).string());
+        } else if (std::filesystem::is_directory(status)) {
+            // A directory moved in, or an overflow: its tree is reconciled
+            trees.push_back(path);
+        } else if (isImageFile(path)) {
+            images.insert(path.string());
+        } else if (!std::filesystem::exists(status)) {
+            // Possibly a directory removed or moved out: what the catalog has under it goes
+            trees.push_back(path);
+        }
+    }
+
+    for (const auto& tree : trees) {
+        if (auto result = reconcile_unsafe(tree, stats); !result) {
+            return result;
+        }
+    }
+
+    std::vector<Candidate> candidates;
+    candidates.reserve(images.size());
+    for (const auto& image : images) {
+        auto record { m_catalog.findImage(image) };
+        if (!record) {
+            return std::unexpected(record.error());
+        }
+        candidates.push_back(Candidate { image, std::move(*record) });
+    }
+    return refresh_unsafe(std::move(candidates), stats);
+}
+
+std::expected<void, ErrorHandling::CoreError> CatalogSync::reconcile_unsafe(const std::filesystem::path& root, SyncStats& stats)
+{
+    // Image files on disk, by folder (a stat per file, nothing is opened)
+    std::map<std::string, std::vector<std::string>> on_disk;
+    std::error_code ec;
+    if (std::filesystem::is_directory(root, ec)) {
+        on_disk[root.string()];
+        for (std::filesystem::recursive_directory_iterator it { root, std::filesystem::directory_options::skip_permission_denied, ec }, end;
+             !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec)) {
+                on_disk[it->path().string()];
+            } else if (it->is_regular_file(ec) && isImageFile(it->path())) {
+                on_disk[it->path().parent_path().string()].push_back(it->path().string());
+            }
+        }
+    }
+
+    auto cataloged { m_catalog.foldersUnder(root) };
+    if (!cataloged) {
+        return std::unexpected(cataloged.error());
+    }
+    for (const auto& folder : *cataloged) {
+        on_disk.try_emplace(folder);
+    }
+
+    for (auto& [folder, files] : on_disk) {
+        auto records { m_catalog.folderImages(folder) };
+        if (!records) {
+            return std::unexpected(records.error());
+        }
+
+        std::unordered_map<std::string, ImageRecord> known;
+        for (auto& record : *records) {
+            known.emplace(record.m_path, std::move(record));
+        }
+
+        std::vector<Candidate> candidates;
+        candidates.reserve(files.size() + known.size());
+        for (auto& file : files) {
+            std::optional<ImageRecord> record;
+            if (auto found = known.find(file); found != known.end()) {
+                record = std::move(found->second);
+                known.erase(found);
+            }
+            candidates.push_back(Candidate { std::move(file), std::move(record) });
+        }
+        // Cataloged but no longer on disk
+        for (auto& [path, record] : known) {
+            candidates.push_back(Candidate { path, std::move(record) });
+        }
+
+        if (auto result = refresh_unsafe(std::move(candidates), stats); !result) {
+            return result;
+        }
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError> CatalogSync::refresh_unsafe(std::vector<Candidate> candidates, SyncStats& stats)
+{
+    std::vector<std::string> removed;
+    std::vector<std::string> stale;
+    std::vector<std::pair<std::string, std::int64_t>> sidecars;
+
+    for (auto& candidate : candidates) {
+        std::error_code ec;
+        const auto size { std::filesystem::file_size(candidate.m_path, ec) };
+        const auto mtime { ec ? std::nullopt : CatalogDatabase::fileTime(candidate.m_path) };
+        if (!mtime) {
+            if (candidate.m_record) {
+                removed.push_back(std::move(candidate.m_path));
+            }
+            continue;
+        }
+
+        if (!candidate.m_record || candidate.m_record->m_file_size != size || candidate.m_record->m_file_mtime != *mtime) {
+            stale.push_back(candidate.m_path);
+        }
+
+        // Edits are re-read only from a sidecar the catalog has not read yet
+        const auto sidecar { CatalogDatabase::fileTime(m_xmp_paths->getXmpPathForImage(candidate.m_path)).value_or(0) };
+        const std::int64_t known_sidecar { candidate.m_record ? candidate.m_record->m_sidecar_mtime : 0 };
+        if (sidecar != known_sidecar) {
+            sidecars.emplace_back(std::move(candidate.m_path), sidecar);
+        }
+    }
+
+    if (!removed.empty()) {
+        auto count { m_catalog.removeImages(removed) };
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+        stats.m_images_removed += *count;
+    }
+
+    if (!stale.empty()) {
+        const auto metadata { m_source->readMetadataBatch(stale) };
+        std::vector<ImageRecord> records;
+        records.reserve(stale.size());
+        for (std::size_t i = 0; i < stale.size(); ++i) {
+            if (!metadata[i]) {
+                spdlog::warn("[CatalogSync::refresh_unsafe]: Cannot read the metadata of '{}'", stale[i]);
+                continue;
+            }
+            if (auto record = CatalogDatabase::makeRecord(stale[i], *metadata[i])) {
+                records.push_back(std::move(*record));
+            }
+        }
+        auto written { m_catalog.addImages(records) };
+        if (!written) {
+            return std::unexpected(written.error());
+        }
+        stats.m_images_updated += *written;
+    }
+
+    for (const auto& [path, sidecar] : sidecars) {
+        const auto record { m_catalog.findImage(path) };
+        if (!record) {
+            return std::unexpected(record.error());
+        }
+        if (!*record) {
+            // Its metadata could not be read: not cataloged
+            continue;
+        }
+
+        const ImageId id { (*record)->m_id };
+        // A removed sidecar leaves the cataloged edits as they are
+        if (sidecar != 0 && m_reader) {
+            // Stamped with the size as well: the edits are then served as this sidecar's on open
+            std::error_code ec;
+            const auto size { std::filesystem::file_size(m_xmp_paths->getXmpPathForImage(path), ec) };
+            const auto edits { m_reader->loadFromFile(path) };
+            if (auto saved = m_catalog.saveSidecarEdits(id, edits, sidecar, ec ? 0 : size); !saved) {
+                return saved;
+            }
+            ++stats.m_edits_refreshed;
+            continue;
+        }
+        if (auto recorded = m_catalog.setSidecarMtime(id, sidecar); !recorded) {
+            return recorded;
+        }
+    }
+    return {};
+}
+
+bool CatalogSync::isImageFile(const std::filesystem::path& path)
+{
+    // Every extension of the formats OIIO reads (RAW formats included)
+    static const std::unordered_set<std::string> extensions = [] {
+        std::unordered_set<std::string> result;
+        for (const auto& [format, format_extensions] : OIIO::get_extension_map()) {
+            for (const auto& extension : format_extensions) {
+                result.insert(lowerExtension("x." + extension));
+            }
+        }
+        return result;
+    }();
+
+    return extensions.contains(lowerExtension(path));
+}
+
+} // namespace CaptureMoment::Core::Catalog
@@ -0,0 +1,547 @@
+/**
+ * @file folder_watcher.cpp
+ * @brief Implementation of FolderWatcher (inotify, ReadDirectoryChangesW, FSEvents).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/folder_watcher.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <unordered_map>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <string_view>
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <CoreServices/CoreServices.h>
+#include <dispatch/dispatch.h>
+#endif
+
+namespace CaptureMoment::Core::Catalog {
+
+/**
+ * @brief Absolute, normalized form of a root, without a trailing separator.
+ */
+[[nodiscard]] static std::filesystem::path normalizedRoot(const std::filesystem::path& root)
+{
+    std::error_code ec;
+    std::filesystem::path normalized { std::filesystem::absolute(root, ec).lexically_normal() };
+    if (!normalized.has_filename() && normalized.has_relative_path()) {
+        normalized = normalized.parent_path();
+    }
+    return normalized;
+}
+
+#if defined(__linux__)
+
+// ============================================================
+// Linux: inotify
+// ============================================================
+
+/**
+ * @brief Events of interest on every watched directory. A file written in place is reported
+ *        once it is closed, not at every write.
+ */
+constexpr std::uint32_t k_inotify_mask {
+    IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB
+    | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR
+};
+
+/**
+ * @brief true if `path` is `root` or below it.
+ */
+[[nodiscard]] static bool isWithin(const std::filesystem::path& path, const std::filesystem::path& root)
+{
+    const auto [root_end, path_end] { std::mismatch(root.begin(), root.end(), path.begin(), path.end()) };
+    return root_end == root.end();
+}
+
+struct FolderWatcher::Platform {
+    explicit Platform(ChangeCallback callback)
+        : m_callback(std::move(callback))
+        , m_inotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+        , m_wake(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+        if (m_inotify < 0 || m_wake < 0) {
+            spdlog::error("[FolderWatcher::Platform]: inotify unavailable: {}", std::strerror(errno));
+            return;
+        }
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    ~Platform()
+    {
+        if (m_thread.joinable()) {
+            const std::uint64_t wake { 1 };
+            [[maybe_unused]] const auto written { ::write(m_wake, &wake, sizeof(wake)) };
+            m_thread.join();
+        }
+        if (m_inotify >= 0) {
+            ::close(m_inotify);
+        }
+        if (m_wake >= 0) {
+            ::close(m_wake);
+        }
+    }
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path& root)
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_thread.joinable() || !addTree_unsafe(root)) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+        m_roots.push_back(root);
+        return {};
+    }
+
+    void unwatch(const std::filesystem::path& root)
+    {
+        std::lock_guard lock(m_mutex);
+        std::erase(m_roots, root);
+        std::erase_if(m_directories, [this, &root](const auto& entry) {
+            if (!isWithin(entry.second, root)) {
+                return false;
+            }
+            inotify_rm_watch(m_inotify, entry.first);
+            return true;
+        });
+    }
+
+private:
+    /**
+     * @brief Watches a directory and the directories below it. Caller holds m_mutex.
+     * @return false if the directory itself cannot be watched.
+     */
+    bool addTree_unsafe(const std::filesystem::path& directory)
+    {
+        if (!addDirectory_unsafe(directory)) {
+            return false;
+        }
+
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator it { directory, std::filesystem::directory_options::skip_permission_denied, ec }, end;
+             !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec) && !it->is_symlink(ec)) {
+                // A subdirectory that cannot be watched is still reconciled periodically
+                addDirectory_unsafe(it->path());
+            }
+        }
+        return true;
+    }
+
+    bool addDirectory_unsafe(const std::filesystem::path& directory)
+    {
+        const int descriptor { inotify_add_watch(m_inotify, directory.c_str(), k_inotify_mask) };
+        if (descriptor < 0) {
+            // ENOSPC: fs.inotify.max_user_watches is too low for the tree
+            spdlog::warn("[FolderWatcher::Platform]: Cannot watch '{}': {}", directory.string(), std::strerror(errno));
+            return false;
+        }
+        m_directories[descriptor] = directory;
+        return true;
+    }
+
+    void run()
+    {
+        alignas(inotify_event) char buffer[64 * 1024];
+        std::array<pollfd, 2> descriptors {{ { m_inotify, POLLIN, 0 }, { m_wake, POLLIN, 0 } }};
+
+        for (;;) {
+            if (::poll(descriptors.data(), descriptors.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                spdlog::error("[FolderWatcher::Platform::run]: poll failed: {}", std::strerror(errno));
+                return;
+            }
+            if (descriptors[1].revents != 0) {
+                return;
+            }
+
+            std::vector<std::filesystem::path> changed;
+            for (ssize_t length; (length = ::read(m_inotify, buffer, sizeof(buffer))) > 0;) {
+                std::lock_guard lock(m_mutex);
+                for (const char* next = buffer; next < buffer + length;) {
+                    const auto* event { reinterpret_cast<const inotify_event*>(next) };
+                    next += sizeof(inotify_event) + event->len;
+
+                    if (event->mask & IN_Q_OVERFLOW) {
+                        changed.insert(changed.end(), m_roots.begin(), m_roots.end());
+                        continue;
+                    }
+                    const auto directory { m_directories.find(event->wd) };
+                    if (directory == m_directories.end()) {
+                        continue;
+                    }
+                    if (event->mask & IN_IGNORED) {
+                        m_directories.erase(directory);
+                        continue;
+                    }
+
+                    std::filesystem::path path { event->len > 0 ? directory->second / event->name : directory->second };
+                    if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO))) {
+                        addTree_unsafe(path);
+                    }
+                    changed.push_back(std::move(path));
+                }
+            }
+
+            if (!changed.empty()) {
+                m_callback(std::move(changed));
+            }
+        }
+    }
+
+    ChangeCallback m_callback;
+
+    /**
+     * @brief The inotify instance, and the event that stops the thread.
+     */
+    int m_inotify{-1};
+    int m_wake{-1};
+
+    /**
+     * @brief Guards m_directories and m_roots.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief Watched directory of each watch descriptor.
+     */
+    std::unordered_map<int, std::filesystem::path> m_directories;
+
+    /**
+     * @brief Roots given to `watch` (reported whole on an overflow).
+     */
+    std::vector<std::filesystem::path> m_roots;
+
+    std::thread m_thread;
+};
+
+bool FolderWatcher::isSupported() noexcept
+{
+    return true;
+}
+
+#elif defined(_WIN32)
+
+// ============================================================
+// Windows: ReadDirectoryChangesW, one overlapped read per root
+// ============================================================
+
+struct FolderWatcher::Platform {
+    explicit Platform(ChangeCallback callback)
+        : m_callback(std::move(callback))
+    {
+    }
+
+    ~Platform()
+    {
+        std::lock_guard lock(m_mutex);
+        for (auto& root : m_roots) {
+            stop(*root);
+        }
+    }
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path& root)
+    {
+        auto watched { std::make_unique<Root>() };
+        watched->m_path = root;
+        watched->m_directory = CreateFileW(root.c_str(), FILE_LIST_DIRECTORY,
+                                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                           OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (watched->m_directory == INVALID_HANDLE_VALUE) {
+            spdlog::warn("[FolderWatcher::Platform]: Cannot watch '{}' (error {})", root.string(), GetLastError());
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+        watched->m_stop = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        Root* raw { watched.get() };
+        watched->m_thread = std::thread([this, raw]() { run(*raw); });
+
+        std::lock_guard lock(m_mutex);
+        m_roots.push_back(std::move(watched));
+        return {};
+    }
+
+    void unwatch(const std::filesystem::path& root)
+    {
+        std::lock_guard lock(m_mutex);
+        std::erase_if(m_roots, [&root](const std::unique_ptr<Root>& watched) {
+            if (watched->m_path != root) {
+                return false;
+            }
+            stop(*watched);
+            return true;
+        });
+    }
+
+private:
+    struct Root {
+        std::filesystem::path m_path;
+        HANDLE m_directory{INVALID_HANDLE_VALUE};
+        HANDLE m_stop{nullptr};
+        std::thread m_thread;
+    };
+
+    static void stop(Root& root)
+    {
+        SetEvent(root.m_stop);
+        root.m_thread.join();
+        CloseHandle(root.m_directory);
+        CloseHandle(root.m_stop);
+    }
+
+    void run(Root& root)
+    {
+        constexpr DWORD k_filter { FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME
+                                   | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE };
+        alignas(DWORD) std::array<std::byte, 64 * 1024> buffer;
+        OVERLAPPED overlapped {};
+        overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        for (;;) {
+            ResetEvent(overlapped.hEvent);
+            if (!ReadDirectoryChangesW(root.m_directory, buffer.data(), static_cast<DWORD>(buffer.size()), TRUE,
+                                       k_filter, nullptr, &overlapped, nullptr)) {
+                spdlog::error("[FolderWatcher::Platform::run]: Watch of '{}' failed (error {})", root.m_path.string(), GetLastError());
+                break;
+            }
+
+            const std::array<HANDLE, 2> handles { overlapped.hEvent, root.m_stop };
+            DWORD bytes { 0 };
+            if (WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(), FALSE, INFINITE) != WAIT_OBJECT_0) {
+                CancelIoEx(root.m_directory, &overlapped);
+                GetOverlappedResult(root.m_directory, &overlapped, &bytes, TRUE);
+                break;
+            }
+
+            std::vector<std::filesystem::path> changed;
+            if (!GetOverlappedResult(root.m_directory, &overlapped, &bytes, FALSE) || bytes == 0) {
+                // The buffer overflowed (ERROR_NOTIFY_ENUM_DIR or no entries): rescan the root
+                changed.push_back(root.m_path);
+            } else {
+                for (DWORD offset = 0;;) {
+                    const auto* info { reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer.data() + offset) };
+                    changed.push_back(root.m_path / std::wstring_view(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+                    if (info->NextEntryOffset == 0) {
+                        break;
+                    }
+                    offset += info->NextEntryOffset;
+                }
+            }
+            m_callback(std::move(changed));
+        }
+
+        CloseHandle(overlapped.hEvent);
+    }
+
+    ChangeCallback m_callback;
+
+    /**
+     * @brief Guards m_roots.
+     */
+    std::mutex m_mutex;
+
+    std::vector<std::unique_ptr<Root>> m_roots;
+};
+
+bool FolderWatcher::isSupported() noexcept
+{
+    return true;
+}
+
+#elif defined(__APPLE__)
+
+// ============================================================
+// macOS: one FSEvents stream over every root, recreated when the roots change
+// ============================================================
+
+struct FolderWatcher::Platform {
+    explicit Platform(ChangeCallback callback)
+        : m_callback(std::move(callback))
+        , m_queue(dispatch_queue_create("capturemoment.folder_watcher", DISPATCH_QUEUE_SERIAL))
+    {
+    }
+
+    ~Platform()
+    {
+        std::lock_guard lock(m_mutex);
+        stop_unsafe();
+        dispatch_release(m_queue);
+    }
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path& root)
+    {
+        std::lock_guard lock(m_mutex);
+        m_roots.push_back(root);
+        if (!restart_unsafe()) {
+            m_roots.pop_back();
+            restart_unsafe();
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+        return {};
+    }
+
+    void unwatch(const std::filesystem::path& root)
+    {
+        std::lock_guard lock(m_mutex);
+        std::erase(m_roots, root);
+        restart_unsafe();
+    }
+
+private:
+    bool restart_unsafe()
+    {
+        stop_unsafe();
+        if (m_roots.empty()) {
+            return true;
+        }
+
+        CFMutableArrayRef paths { CFArrayCreateMutable(nullptr, 0, &kCFTypeArrayCallBacks) };
+        for (const auto& root : m_roots) {
+            CFStringRef path { CFStringCreateWithCString(nullptr, root.c_str(), kCFStringEncodingUTF8) };
+            CFArrayAppendValue(paths, path);
+            CFRelease(path);
+        }
+
+        // File-level events, delivered within 300 ms (coalesced by the sync anyway)
+        FSEventStreamContext context { 0, this, nullptr, nullptr, nullptr };
+        m_stream = FSEventStreamCreate(nullptr, &Platform::onEvents, &context, paths, kFSEventStreamEventIdSinceNow, 0.3,
+                                       kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer);
+        CFRelease(paths);
+        if (!m_stream) {
+            spdlog::error("[FolderWatcher::Platform]: FSEventStreamCreate failed");
+            return false;
+        }
+
+        FSEventStreamSetDispatchQueue(m_stream, m_queue);
+        if (!FSEventStreamStart(m_stream)) {
+            spdlog::error("[FolderWatcher::Platform]: FSEventStreamStart failed");
+            stop_unsafe();
+            return false;
+        }
+        return true;
+    }
+
+    void stop_unsafe()
+    {
+        if (!m_stream) {
+            return;
+        }
+        FSEventStreamStop(m_stream);
+        FSEventStreamInvalidate(m_stream);
+        FSEventStreamRelease(m_stream);
+        m_stream = nullptr;
+
+        // Waits for a callback still running on the queue
+        dispatch_sync_f(m_queue, nullptr, [](void*) {});
+    }
+
+    static void onEvents(ConstFSEventStreamRef, void* info, std::size_t count, void* event_paths,
+                         const FSEventStreamEventFlags[], const FSEventStreamEventId[])
+    {
+        auto* self { static_cast<Platform*>(info) };
+        const auto* const* paths { static_cast<const char* const*>(event_paths) };
+
+        std::vector<std::filesystem::path> changed;
+        changed.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            // With kFSEventStreamEventFlagMustScanSubDirs (dropped events) the path is a
+            // directory, rescanned whole by the receiver
+            std::filesystem::path path { std::filesystem::path(paths[i]).lexically_normal() };
+            if (!path.has_filename() && path.has_relative_path()) {
+                path = path.parent_path();
+            }
+            changed.push_back(std::move(path));
+        }
+        self->m_callback(std::move(changed));
+    }
+
+    ChangeCallback m_callback;
+
+    /**
+     * @brief Guards m_roots and m_stream.
+     */
+    std::mutex m_mutex;
+
+    std::vector<std::filesystem::path> m_roots;
+
+    FSEventStreamRef m_stream{nullptr};
+
+    /**
+     * @brief Serial queue the callbacks run on.
+     */
+    dispatch_queue_t m_queue;
+};
+
+bool FolderWatcher::isSupported() noexcept
+{
+    return true;
+}
+
+#else
+
+// ============================================================
+// Other platforms: no notifications (periodic reconciliation only)
+// ============================================================
+
+struct FolderWatcher::Platform {
+    explicit Platform(ChangeCallback) {}
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> watch(const std::filesystem::path&)
+    {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    void unwatch(const std::filesystem::path&) {}
+};
+
+bool FolderWatcher::isSupported() noexcept
+{
+    return false;
+}
+
+#endif
+
+FolderWatcher::FolderWatcher(ChangeCallback callback)
+    : m_platform(std::make_unique<Platform>(std::move(callback)))
+{
+}
+
+FolderWatcher::~FolderWatcher() = default;
+
+std::expected<void, ErrorHandling::CoreError> FolderWatcher::watch(const std::filesystem::path& root)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_directory(root, ec)) {
+        spdlog::warn("[FolderWatcher::watch]: '{}' is not a directory", root.string());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+    return m_platform->watch(normalizedRoot(root));
+}
+
+void FolderWatcher::unwatch(const std::filesystem::path& root)
+{
+    m_platform->unwatch(normalizedRoot(root));
+}
+
+} // namespace CaptureMoment::Core::Catalog
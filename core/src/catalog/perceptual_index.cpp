@@ -0,0 +1,302 @@
+/**
+ * @file perceptual_index.cpp
+ * @brief Implementation of PerceptualIndex
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/perceptual_index.h"
+#include "utils/perceptual_hash.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Disjoint sets of entry indices (union by index, path halving).
+ */
+class DisjointSets {
+public:
+    explicit DisjointSets(std::size_t size)
+        : m_parent(size)
+    {
+        std::iota(m_parent.begin(), m_parent.end(), std::uint32_t{0});
+    }
+
+    [[nodiscard]] std::uint32_t find(std::uint32_t item) noexcept
+    {
+        while (m_parent[item] != item) {
+            m_parent[item] = m_parent[m_parent[item]];
+            item = m_parent[item];
+        }
+        return item;
+    }
+
+    /**
+     * @brief Joins two sets; the root is the lowest index, so a group is named by its first entry.
+     */
+    void unite(std::uint32_t a, std::uint32_t b) noexcept
+    {
+        a = find(a);
+        b = find(b);
+        if (a != b) {
+            m_parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+private:
+    std::vector<std::uint32_t> m_parent;
+};
+
+/**
+ * @brief Parses `count` digits at `text[offset]`.
+ */
+[[nodiscard]] std::optional<int> parseField(std::string_view text, std::size_t offset, std::size_t count)
+{
+    int value { 0 };
+    const char* first { text.data() + offset };
+    const auto [end, error] { std::from_chars(first, first + count, value) };
+    if (error != std::errc{} || end != first + count) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+} // anonymous namespace
+
+PerceptualIndex::PerceptualIndex(std::vector<PerceptualHashEntry> entries)
+    : m_entries(std::move(entries))
+{
+    std::erase_if(m_entries, [](const PerceptualHashEntry& entry) { return entry.m_hash == 0; });
+
+    // Counting sort of the entries by chunk value, per table
+    for (std::size_t chunk = 0; chunk < k_chunks; ++chunk) {
+        auto& offsets { m_offsets[chunk] };
+        auto& members { m_members[chunk] };
+
+        offsets.assign(k_chunk_values + 1, 0);
+        for (const PerceptualHashEntry& entry : m_entries) {
+            ++offsets[chunkOf(entry.m_hash, chunk) + 1];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        auto& hashes { m_hashes[chunk] };
+        members.resize(m_entries.size());
+        hashes.resize(m_entries.size());
+        std::vector<std::uint32_t> next(offsets.begin(), offsets.end() - 1);
+        for (std::uint32_t index = 0; index < m_entries.size(); ++index) {
+            const std::uint32_t slot { next[chunkOf(m_entries[index].m_hash, chunk)]++ };
+            members[slot] = index;
+            hashes[slot] = m_entries[index].m_hash;
+        }
+    }
+
+    spdlog::debug("[PerceptualIndex::PerceptualIndex]: {} hashes indexed", m_entries.size());
+}
+
+std::size_t PerceptualIndex::size() const noexcept
+{
+    return m_entries.size();
+}
+
+std::uint32_t PerceptualIndex::chunkOf(std::uint64_t hash, std::size_t chunk) noexcept
+{
+    return static_cast<std::uint32_t>(hash >> (chunk * k_chunk_bits)) & static_cast<std::uint32_t>(k_chunk_values - 1);
+}
+
+template <typename Visitor>
+void PerceptualIndex::forEachNear(std::uint64_t hash, int radius, Visitor&& visit) const
+{
+    if (radius < 0) {
+        return;
+    }
+    // Pigeonhole: some chunk of a match is within this many bits of the query's
+    const int chunk_radius { std::min(radius / static_cast<int>(k_chunks), k_chunk_bits) };
+
+    for (std::size_t chunk = 0; chunk < k_chunks; ++chunk) {
+        const std::uint32_t query { chunkOf(hash, chunk) };
+        const auto& offsets { m_offsets[chunk] };
+        const auto& members { m_members[chunk] };
+        const auto& hashes { m_hashes[chunk] };
+
+        const auto probe = [&](std::uint32_t value) {
+            for (std::uint32_t i = offsets[value]; i < offsets[value + 1]; ++i) {
+                if (Utils::hammingDistance(hashes[i], hash) <= radius) {
+                    visit(members[i]);
+                }
+            }
+        };
+
+        // Every flip of 0 to chunk_radius bits, masks of each weight in increasing order (Gosper)
+        probe(query);
+        for (int bits = 1; bits <= chunk_radius; ++bits) {
+            std::uint32_t mask { (std::uint32_t{1} << bits) - 1 };
+            while (mask < k_chunk_values) {
+                probe(query ^ mask);
+                const std::uint32_t lowest { mask & (~mask + 1) };
+                const std::uint32_t ripple { mask + lowest };
+                mask = (((ripple ^ mask) >> 2) / lowest) | ripple;
+            }
+        }
+    }
+}
+
+std::vector<ImageId> PerceptualIndex::near(std::uint64_t hash, int radius) const
+{
+    std::vector<std::uint32_t> found;
+    forEachNear(hash, radius, [&found](std::uint32_t index) { found.push_back(index); });
+
+    // A match sharing several close chunks was found once per chunk
+    std::ranges::sort(found);
+    const auto [first, last] { std::ranges::unique(found) };
+    found.erase(first, last);
+
+    std::vector<ImageId> images;
+    images.reserve(found.size());
+    for (const std::uint32_t index : found) {
+        images.push_back(m_entries[index].m_id);
+    }
+    return images;
+}
+
+std::vector<std::vector<ImageId>> PerceptualIndex::duplicateGroups(int radius) const
+{
+    DisjointSets sets { m_entries.size() };
+    if (radius < 0) {
+        return {};
+    }
+    const int chunk_radius { std::min(radius / static_cast<int>(k_chunks), k_chunk_bits) };
+
+    // Bucket against bucket rather than entry by entry: the tables are read in order
+    for (std::size_t chunk = 0; chunk < k_chunks; ++chunk) {
+        const auto& offsets { m_offsets[chunk] };
+        const auto& members { m_members[chunk] };
+        const auto& hashes { m_hashes[chunk] };
+
+        const auto join = [&](std::uint32_t begin, std::uint32_t end, std::uint32_t other_begin, std::uint32_t other_end) {
+            for (std::uint32_t i = begin; i < end; ++i) {
+                for (std::uint32_t j = std::max(other_begin, i + 1); j < other_end; ++j) {
+                    if (Utils::hammingDistance(hashes[i], hashes[j]) <= radius) {
+                        sets.unite(members[i], members[j]);
+                    }
+                }
+            }
+        };
+
+        for (std::uint32_t value = 0; value < k_chunk_values; ++value) {
+            const std::uint32_t begin { offsets[value] };
+            const std::uint32_t end { offsets[value + 1] };
+            if (begin == end) {
+                continue;
+            }
+            join(begin, end, begin, end);
+
+            // Each pair of close buckets once, from the lower value
+            for (int bits = 1; bits <= chunk_radius; ++bits) {
+                std::uint32_t mask { (std::uint32_t{1} << bits) - 1 };
+                while (mask < k_chunk_values) {
+                    const std::uint32_t other { value ^ mask };
+                    if (other > value) {
+                        join(begin, end, offsets[other], offsets[other + 1]);
+                    }
+                    const std::uint32_t lowest { mask & (~mask + 1) };
+                    const std::uint32_t ripple { mask + lowest };
+                    mask = (((ripple ^ mask) >> 2) / lowest) | ripple;
+                }
+            }
+        }
+    }
+
+    // A root is the first entry of its group: groups come out ordered by their first image
+    std::vector<std::uint32_t> roots(m_entries.size());
+    std::vector<std::uint32_t> sizes(m_entries.size(), 0);
+    for (std::uint32_t index = 0; index < m_entries.size(); ++index) {
+        roots[index] = sets.find(index);
+        ++sizes[roots[index]];
+    }
+
+    constexpr std::uint32_t k_alone { std::numeric_limits<std::uint32_t>::max() };
+    std::vector<std::uint32_t> group_of(m_entries.size(), k_alone);
+    std::vector<std::vector<ImageId>> groups;
+    for (std::uint32_t index = 0; index < m_entries.size(); ++index) {
+        const std::uint32_t root { roots[index] };
+        if (sizes[root] < 2) {
+            continue;
+        }
+        if (group_of[root] == k_alone) {
+            group_of[root] = static_cast<std::uint32_t>(groups.size());
+            groups.emplace_back().reserve(sizes[root]);
+        }
+        groups[group_of[root]].push_back(m_entries[index].m_id);
+    }
+    return groups;
+}
+
+std::vector<std::vector<ImageId>>
+PerceptualIndex::burstGroups(std::span<const PerceptualHashEntry> entries, int radius, std::chrono::seconds max_gap)
+{
+    std::vector<std::vector<ImageId>> bursts;
+    std::vector<ImageId> current;
+
+    const auto close = [&bursts, &current]() {
+        if (current.size() > 1) {
+            bursts.push_back(std::move(current));
+        }
+        current.clear();
+    };
+
+    std::optional<std::int64_t> previous_time;
+    std::uint64_t previous_hash { 0 };
+    for (const PerceptualHashEntry& entry : entries) {
+        const auto time { captureSeconds(entry.m_capture_date) };
+        const bool continues { time && previous_time && entry.m_hash != 0 && previous_hash != 0
+                               && *time - *previous_time <= max_gap.count()
+                               && Utils::hammingDistance(entry.m_hash, previous_hash) <= radius };
+        if (!continues) {
+            close();
+        }
+        current.push_back(entry.m_id);
+        previous_time = time;
+        previous_hash = entry.m_hash;
+    }
+    close();
+    return bursts;
+}
+
+std::optional<std::int64_t> PerceptualIndex::captureSeconds(std::string_view date)
+{
+    // YYYY:MM:DD HH:MM:SS, possibly followed by subseconds or a zone
+    if (date.size() < 19 || (date[4] != ':' && date[4] != '-') || date[7] != date[4] || date[13] != ':' || date[16] != ':') {
+        return std::nullopt;
+    }
+
+    const auto year { parseField(date, 0, 4) };
+    const auto month { parseField(date, 5, 2) };
+    const auto day { parseField(date, 8, 2) };
+    const auto hour { parseField(date, 11, 2) };
+    const auto minute { parseField(date, 14, 2) };
+    const auto second { parseField(date, 17, 2) };
+    if (!year || !month || !day || !hour || !minute || !second) {
+        return std::nullopt;
+    }
+
+    const std::chrono::year_month_day ymd { std::chrono::year { *year }, std::chrono::month { static_cast<unsigned>(*month) },
+                                            std::chrono::day { static_cast<unsigned>(*day) } };
+    if (!ymd.ok()) {
+        // Cameras without a clock write "0000:00:00 00:00:00"
+        return std::nullopt;
+    }
+
+    const auto days { std::chrono::sys_days { ymd }.time_since_epoch() };
+    return std::chrono::duration_cast<std::chrono::seconds>(days).count() + *hour * 3600 + *minute * 60 + *second;
+}
+
+} // namespace CaptureMoment::Core::Catalog
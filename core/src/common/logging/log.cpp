@@ -0,0 +1,90 @@
+/**
+ * @file log.cpp
+ * @brief Runtime subsystem filters of the logging macros.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/logging/log.h"
+
+#include <magic_enum/magic_enum.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <string>
+
+namespace CaptureMoment::Core::Common::Logging {
+
+namespace {
+
+[[nodiscard]] std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+[[nodiscard]] std::optional<spdlog::level::level_enum> parseLevel(std::string_view name)
+{
+    const std::string lower { [&] {
+        std::string text(name);
+        std::ranges::transform(text, text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    }() };
+
+    // spdlog maps unknown names to `off`: only accept the real ones
+    const spdlog::level::level_enum level { spdlog::level::from_str(lower) };
+    if (level == spdlog::level::off && lower != "off") {
+        return std::nullopt;
+    }
+    return level;
+}
+
+} // anonymous namespace
+
+void setSubsystemLevel(Subsystem subsystem, spdlog::level::level_enum level) noexcept
+{
+    if (subsystem >= Subsystem::Count) {
+        return;
+    }
+    g_subsystem_levels[static_cast<std::size_t>(subsystem)].store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+bool applySubsystemLevels(std::string_view spec)
+{
+    bool valid { true };
+
+    while (!spec.empty()) {
+        const std::size_t comma { spec.find(',') };
+        const std::string_view entry { trim(spec.substr(0, comma)) };
+        spec = comma == std::string_view::npos ? std::string_view() : spec.substr(comma + 1);
+
+        if (entry.empty()) {
+            continue;
+        }
+
+        const std::size_t equals { entry.find('=') };
+        const auto subsystem { equals == std::string_view::npos
+                                   ? std::nullopt
+                                   : magic_enum::enum_cast<Subsystem>(trim(entry.substr(0, equals)),
+                                                                      magic_enum::case_insensitive) };
+        const auto level { equals == std::string_view::npos ? std::nullopt : parseLevel(trim(entry.substr(equals + 1))) };
+
+        if (!subsystem || *subsystem == Subsystem::Count || !level) {
+            spdlog::warn("[Logging::applySubsystemLevels]: Ignoring '{}' (expected <subsystem>=<level>).", entry);
+            valid = false;
+            continue;
+        }
+
+        setSubsystemLevel(*subsystem, *level);
+    }
+
+    return valid;
+}
+
+} // namespace CaptureMoment::Core::Common::Logging
@@ -0,0 +1,359 @@
+/**
+ * @file buffer_pool.cpp
+ * @brief Implementation of BufferPool.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/buffer_pool.h"
+#include "common/memory/memory_budget.h"
+#include "common/numa_topology.h"
+#include "common/trace/allocation_tracker.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief Alignment used for a block of the given size class.
+ */
+constexpr std::align_val_t alignmentFor(std::size_t capacity) noexcept
+{
+    return std::align_val_t{capacity >= BufferPool::k_page_threshold
+                                ? BufferPool::k_page_alignment
+                                : BufferPool::k_cache_line_alignment};
+}
+
+#if defined(_WIN32)
+/**
+ * @brief Grants the process the "Lock pages in memory" right large pages need, once.
+ * @return true if the right is held (it must be assigned to the user by the administrator).
+ */
+bool enableLargePagePrivilege() noexcept
+{
+    static const bool enabled { [] {
+        HANDLE token { nullptr };
+        if (!::OpenProcessToken(::GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) {
+            return false;
+        }
+        TOKEN_PRIVILEGES privileges {};
+        privileges.PrivilegeCount = 1;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+        const bool adjusted { ::LookupPrivilegeValueW(nullptr, L"SeLockMemoryPrivilege", &privileges.Privileges[0].Luid)
+                              && ::AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr)
+                              && ::GetLastError() == ERROR_SUCCESS };
+        ::CloseHandle(token);
+        return adjusted;
+    }() };
+    return enabled;
+}
+#endif
+
+/**
+ * @brief Length of the huge-page mapping of a block of `capacity` bytes (whole huge pages).
+ */
+std::size_t hugeMappingLength(std::size_t capacity) noexcept
+{
+    std::size_t page { BufferPool::k_huge_page_size };
+#if defined(_WIN32)
+    page = std::max<std::size_t>(page, ::GetLargePageMinimum());
+#endif
+    return (capacity + page - 1) / page * page;
+}
+
+/**
+ * @brief Maps `length` bytes on huge pages.
+ * @return The mapping, or nullptr if huge pages are unavailable (the caller falls back to regular pages).
+ */
+void* mapHugePages(std::size_t length, BufferPool::HugePages mode) noexcept
+{
+#if defined(__linux__)
+    if (mode == BufferPool::HugePages::Explicit) {
+        void* reserved { ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0) };
+        if (reserved != MAP_FAILED) {
+            return reserved;
+        }
+        // No reserved pages left (or none configured): transparent ones
+    }
+
+    // Only huge-page-aligned ranges get huge pages: map one more and trim both ends to the boundary
+    const std::size_t span { length + BufferPool::k_huge_page_size };
+    void* mapped { ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+    auto* raw { static_cast<std::byte*>(mapped) };
+    const auto address { reinterpret_cast<std::uintptr_t>(raw) };
+    const std::size_t head { (BufferPool::k_huge_page_size - address % BufferPool::k_huge_page_size) % BufferPool::k_huge_page_size };
+    if (head > 0) {
+        ::munmap(raw, head);
+    }
+    if (const std::size_t tail { span - head - length }; tail > 0) {
+        ::munmap(raw + head + length, tail);
+    }
+    // Advisory: with THP disabled system-wide the block is still usable, on regular pages
+    ::madvise(raw + head, length, MADV_HUGEPAGE);
+    return raw + head;
+#elif defined(_WIN32)
+    if (mode != BufferPool::HugePages::Explicit || ::GetLargePageMinimum() == 0 || !enableLargePagePrivilege()) {
+        return nullptr;
+    }
+    return ::VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+#else
+    static_cast<void>(length);
+    static_cast<void>(mode);
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Frees a block: unmapped if it was mapped on huge pages (`mapped_length` > 0), else
+ *        returned to the system allocator.
+ */
+void freeBlock(void* ptr, std::size_t capacity, std::size_t mapped_length = 0) noexcept
+{
+    if (mapped_length > 0) {
+#if defined(__linux__)
+        ::munmap(ptr, mapped_length);
+#elif defined(_WIN32)
+        ::VirtualFree(ptr, 0, MEM_RELEASE);
+#endif
+        return;
+    }
+    ::operator delete(ptr, capacity, alignmentFor(capacity));
+}
+
+/**
+ * @brief Free list of a size class on a node (`std::nullopt`: blocks acquired unpinned).
+ */
+constexpr std::size_t listKey(std::size_t capacity, std::optional<std::size_t> node) noexcept
+{
+    return capacity + (node ? *node + 1 : 0);
+}
+
+/**
+ * @brief Size class of a free list key.
+ */
+constexpr std::size_t capacityOf(std::size_t key) noexcept
+{
+    return key & ~(BufferPool::k_page_alignment - 1);
+}
+
+} // namespace
+
+BufferPool& BufferPool::instance()
+{
+    // Intentionally leaked, see the constructor
+    static BufferPool* pool = new BufferPool();
+
+    // Counted against the memory ceiling; under pressure the free lists go first (never the live blocks)
+    static const auto* registration = new MemoryBudget::Registration(MemoryBudget::instance().registerConsumer(
+        "Buffer pool",
+        [] { return pool->liveBytes() + pool->cachedBytes(); },
+        [](std::size_t) {
+            const std::size_t cached { pool->cachedBytes() };
+            pool->trim();
+            return cached;
+        }));
+    static_cast<void>(registration);
+
+    return *pool;
+}
+
+void* BufferPool::acquire(std::size_t bytes)
+{
+    const std::size_t capacity = sizeClass(bytes > 0 ? bytes : 1);
+
+    // A pinned thread only gets blocks of its node; fresh ones are first touched there
+    const auto node { NumaTopology::pinnedNode() };
+
+    if (capacity >= k_page_threshold) {
+        std::lock_guard lock(m_mutex);
+        auto it = m_free_lists.find(listKey(capacity, node));
+        if (it != m_free_lists.end() && !it->second.empty()) {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            m_cached_bytes -= capacity;
+            m_live_bytes += capacity;
+            if (node) {
+                m_block_nodes[ptr] = *node;
+            }
+            Trace::AllocationTracker::instance().recordAllocation(ptr, capacity);
+            return ptr;
+        }
+    }
+
+    // Large images on huge pages, if enabled and available
+    void* ptr { nullptr };
+    std::size_t mapped_length { 0 };
+    if (const HugePages mode { hugePages() }; mode != HugePages::Off && capacity >= k_huge_page_threshold) {
+        mapped_length = hugeMappingLength(capacity);
+        ptr = mapHugePages(mapped_length, mode);
+        if (!ptr) {
+            spdlog::debug("[BufferPool::acquire]: No huge pages for a block of {} bytes, using regular pages", capacity);
+            mapped_length = 0;
+        }
+    }
+
+    // Throws std::bad_alloc, reported by the callers as AllocationFailed
+    if (!ptr) {
+        ptr = ::operator new(capacity, alignmentFor(capacity));
+    }
+
+    if (capacity >= k_page_threshold) {
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_system_allocations;
+            m_live_bytes += capacity;
+            if (mapped_length > 0) {
+                try {
+                    m_mapped_blocks.emplace(ptr, mapped_length);
+                    ++m_huge_page_allocations;
+                } catch (const std::bad_alloc&) {
+                    freeBlock(ptr, capacity, mapped_length);
+                    m_live_bytes -= capacity;
+                    throw;
+                }
+            }
+            if (node) {
+                try {
+                    m_block_nodes[ptr] = *node;
+                } catch (const std::bad_alloc&) {
+                    // Untracked: recycled as an unpinned block
+                }
+            }
+        }
+        // Only fresh system memory grows the footprint: recycled blocks were already counted
+        MemoryBudget::instance().enforce();
+    }
+
+    Trace::AllocationTracker::instance().recordAllocation(ptr, capacity);
+    return ptr;
+}
+
+void BufferPool::release(void* ptr, std::size_t bytes) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+
+    Trace::AllocationTracker::instance().recordFree(ptr);
+
+    const std::size_t capacity = sizeClass(bytes > 0 ? bytes : 1);
+    std::size_t mapped_length { 0 };
+
+    if (capacity >= k_page_threshold) {
+        std::lock_guard lock(m_mutex);
+        m_live_bytes -= std::min(m_live_bytes, capacity);
+
+        std::optional<std::size_t> node;
+        if (const auto it = m_block_nodes.find(ptr); it != m_block_nodes.end()) {
+            node = it->second;
+            m_block_nodes.erase(it);
+        }
+
+        if (m_cached_bytes + capacity <= m_max_cached_bytes) {
+            try {
+                m_free_lists[listKey(capacity, node)].push_back(ptr);
+                m_cached_bytes += capacity;
+                return;
+            } catch (const std::bad_alloc&) {
+                // Free list growth failed: fall through and free the block
+            }
+        }
+
+        if (const auto mapped = m_mapped_blocks.find(ptr); mapped != m_mapped_blocks.end()) {
+            mapped_length = mapped->second;
+            m_mapped_blocks.erase(mapped);
+        }
+    }
+
+    freeBlock(ptr, capacity, mapped_length);
+}
+
+void BufferPool::trim() noexcept
+{
+    std::lock_guard lock(m_mutex);
+
+    for (auto& [key, blocks] : m_free_lists) {
+        for (void* ptr : blocks) {
+            std::size_t mapped_length { 0 };
+            if (const auto mapped = m_mapped_blocks.find(ptr); mapped != m_mapped_blocks.end()) {
+                mapped_length = mapped->second;
+                m_mapped_blocks.erase(mapped);
+            }
+            freeBlock(ptr, capacityOf(key), mapped_length);
+        }
+    }
+
+    spdlog::debug("[BufferPool::trim]: Released {} cached bytes", m_cached_bytes);
+
+    m_free_lists.clear();
+    m_cached_bytes = 0;
+}
+
+void BufferPool::setMaxCachedBytes(std::size_t bytes) noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_max_cached_bytes = bytes;
+        if (m_cached_bytes <= m_max_cached_bytes) {
+            return;
+        }
+    }
+
+    trim();
+}
+
+void BufferPool::setHugePages(HugePages mode) noexcept
+{
+    std::lock_guard lock(m_mutex);
+    m_huge_pages = mode;
+}
+
+BufferPool::HugePages BufferPool::hugePages() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_huge_pages;
+}
+
+std::size_t BufferPool::hugePageAllocationCount() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_huge_page_allocations;
+}
+
+std::size_t BufferPool::cachedBytes() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_cached_bytes;
+}
+
+std::size_t BufferPool::liveBytes() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_live_bytes;
+}
+
+std::size_t BufferPool::systemAllocationCount() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_system_allocations;
+}
+
+} // namespace CaptureMoment::Core::Common
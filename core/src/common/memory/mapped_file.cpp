@@ -0,0 +1,124 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation of MappedFile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/mapped_file.h"
+
+#include <spdlog/spdlog.h>
+
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+std::expected<MappedFile, ErrorHandling::CoreError> MappedFile::open(const std::filesystem::path& path)
+{
+    MappedFile mapped;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    // The view keeps the mapping (and the file) alive: both handles can be closed right away
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        spdlog::warn("[MappedFile::open]: CreateFileMapping failed for '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    mapped.m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!mapped.m_data) {
+        spdlog::warn("[MappedFile::open]: MapViewOfFile failed for '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    mapped.m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    // Shared: the pages are those of the page cache, common to every process mapping the file
+    void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        spdlog::warn("[MappedFile::open]: mmap failed for '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    mapped.m_data = data;
+    mapped.m_size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    return mapped;
+}
+
+MappedFile::~MappedFile()
+{
+    reset();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+void MappedFile::reset() noexcept
+{
+    if (!m_data) {
+        return;
+    }
+
+#if defined(_WIN32)
+    UnmapViewOfFile(m_data);
+#else
+    ::munmap(m_data, m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+} // namespace CaptureMoment::Core::Common
@@ -0,0 +1,223 @@
+/**
+ * @file memory_budget.cpp
+ * @brief Implementation of MemoryBudget.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/memory_budget.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace CaptureMoment::Core::Common {
+
+// ============================================================
+// Registration
+// ============================================================
+
+MemoryBudget::Registration::Registration(std::shared_ptr<Consumer> consumer) noexcept
+    : m_consumer(std::move(consumer))
+{
+}
+
+MemoryBudget::Registration::~Registration()
+{
+    reset();
+}
+
+MemoryBudget::Registration::Registration(Registration&& other) noexcept
+    : m_consumer(std::move(other.m_consumer))
+{
+}
+
+MemoryBudget::Registration& MemoryBudget::Registration::operator=(Registration&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_consumer = std::move(other.m_consumer);
+    }
+    return *this;
+}
+
+void MemoryBudget::Registration::touch() const noexcept
+{
+    if (m_consumer) {
+        m_consumer->m_last_use.store(MemoryBudget::instance().m_clock.fetch_add(1, std::memory_order_relaxed) + 1,
+                                     std::memory_order_relaxed);
+    }
+}
+
+void MemoryBudget::Registration::notifyGrowth() const
+{
+    if (!m_consumer) {
+        return;
+    }
+
+    touch();
+    MemoryBudget::instance().enforce();
+}
+
+void MemoryBudget::Registration::reset() noexcept
+{
+    if (m_consumer) {
+        MemoryBudget::instance().unregisterConsumer(m_consumer);
+        m_consumer.reset();
+    }
+}
+
+// ============================================================
+// MemoryBudget
+// ============================================================
+
+MemoryBudget& MemoryBudget::instance()
+{
+    // Intentionally leaked, see the constructor
+    static MemoryBudget* budget = new MemoryBudget();
+    return *budget;
+}
+
+MemoryBudget::Registration MemoryBudget::registerConsumer(std::string name, UsageFunction usage, ReleaseFunction release)
+{
+    auto consumer { std::make_shared<Consumer>() };
+    consumer->m_name = std::move(name);
+    consumer->m_usage = std::move(usage);
+    consumer->m_release = std::move(release);
+    consumer->m_last_use.store(m_clock.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_consumers.push_back(consumer);
+    }
+
+    spdlog::debug("[MemoryBudget::registerConsumer]: '{}' ({})", consumer->m_name,
+                  consumer->m_release ? "evictable" : "usage only");
+    return Registration(std::move(consumer));
+}
+
+void MemoryBudget::unregisterConsumer(const std::shared_ptr<Consumer>& consumer) noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        std::erase(m_consumers, consumer);
+    }
+
+    // A snapshot taken before the erase may still be calling back: wait for it, then disarm
+    std::lock_guard call_lock(consumer->m_call_mutex);
+    consumer->m_alive = false;
+}
+
+void MemoryBudget::setCeilingBytes(std::size_t bytes)
+{
+    m_ceiling_bytes.store(bytes, std::memory_order_relaxed);
+
+    if (bytes == 0) {
+        spdlog::info("[MemoryBudget::setCeilingBytes]: No memory ceiling");
+        return;
+    }
+
+    spdlog::info("[MemoryBudget::setCeilingBytes]: Memory ceiling: {} MB", bytes >> 20);
+    enforce();
+}
+
+std::size_t MemoryBudget::ceilingBytes() const noexcept
+{
+    return m_ceiling_bytes.load(std::memory_order_relaxed);
+}
+
+std::vector<std::shared_ptr<MemoryBudget::Consumer>> MemoryBudget::snapshot() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_consumers;
+}
+
+std::size_t MemoryBudget::usageOf(Consumer& consumer)
+{
+    std::lock_guard call_lock(consumer.m_call_mutex);
+    return consumer.m_alive && consumer.m_usage ? consumer.m_usage() : 0;
+}
+
+std::size_t MemoryBudget::usageBytes() const
+{
+    std::size_t total { 0 };
+    for (const auto& consumer : snapshot()) {
+        total += usageOf(*consumer);
+    }
+    return total;
+}
+
+std::vector<MemoryBudget::ConsumerUsage> MemoryBudget::report() const
+{
+    std::vector<ConsumerUsage> usages;
+    for (const auto& consumer : snapshot()) {
+        usages.push_back({consumer->m_name, usageOf(*consumer), static_cast<bool>(consumer->m_release)});
+    }
+    return usages;
+}
+
+std::size_t MemoryBudget::enforce()
+{
+    const std::size_t ceiling { ceilingBytes() };
+    if (ceiling == 0) {
+        return 0;
+    }
+
+    // One enforcement at a time; a release that grows another consumer does not recurse
+    bool expected { false };
+    if (!m_enforcing.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+        return 0;
+    }
+
+    struct EnforcingGuard {
+        std::atomic<bool>& m_flag;
+        ~EnforcingGuard() { m_flag.store(false, std::memory_order_release); }
+    } enforcing_guard { m_enforcing };
+
+    auto consumers { snapshot() };
+
+    std::size_t total { 0 };
+    for (const auto& consumer : consumers) {
+        total += usageOf(*consumer);
+    }
+
+    std::size_t freed { 0 };
+
+    if (total > ceiling)
+    {
+        std::erase_if(consumers, [](const auto& consumer) { return !consumer->m_release; });
+        std::ranges::sort(consumers, {}, [](const auto& consumer) {
+            return consumer->m_last_use.load(std::memory_order_relaxed);
+        });
+
+        for (const auto& consumer : consumers)
+        {
+            if (total - freed <= ceiling) {
+                break;
+            }
+
+            const std::size_t excess { total - freed - ceiling };
+
+            std::lock_guard call_lock(consumer->m_call_mutex);
+            if (!consumer->m_alive) {
+                continue;
+            }
+
+            const std::size_t released { std::min(consumer->m_release(excess), total - freed) };
+            freed += released;
+            spdlog::debug("[MemoryBudget::enforce]: '{}' released {} MB", consumer->m_name, released >> 20);
+        }
+
+        if (total - freed > ceiling) {
+            spdlog::warn("[MemoryBudget::enforce]: {} MB in use after eviction, ceiling {} MB",
+                         (total - freed) >> 20, ceiling >> 20);
+        } else {
+            spdlog::info("[MemoryBudget::enforce]: Released {} MB, {} MB in use", freed >> 20, (total - freed) >> 20);
+        }
+    }
+
+    return freed;
+}
+
+} // namespace CaptureMoment::Core::Common
@@ -0,0 +1,124 @@
+/**
+ * @file pinned_memory.cpp
+ * @brief Implementation of the page-locked host blocks.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/pinned_memory.h"
+#include "common/memory/buffer_pool.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @struct PinnedHeader
+ * @brief Stored at the start of every block, one page before the returned pointer.
+ */
+struct PinnedHeader {
+    /**
+     * @brief Bytes acquired from the pool, header included.
+     */
+    std::size_t m_total{0};
+
+    /**
+     * @brief Bytes locked past the header (0: the lock was refused or skipped).
+     */
+    std::size_t m_locked{0};
+};
+
+/**
+ * @brief Space before the returned pointer: one page, so that the locked range starts on a page.
+ */
+constexpr std::size_t k_header_bytes = BufferPool::k_page_alignment;
+
+/**
+ * @brief Bytes locked by live blocks.
+ */
+std::atomic<std::size_t> s_locked_bytes{0};
+
+/**
+ * @brief Set once a lock was refused, to warn only once.
+ */
+std::atomic<bool> s_lock_refused{false};
+
+bool lockPages(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    return VirtualLock(ptr, bytes) != 0;
+#else
+    return mlock(ptr, bytes) == 0;
+#endif
+}
+
+void unlockPages(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    VirtualUnlock(ptr, bytes);
+#else
+    munlock(ptr, bytes);
+#endif
+}
+
+} // anonymous namespace
+
+void* acquirePinned(std::size_t bytes)
+{
+    // Pooled blocks from the page threshold on are whole pages: a lock never spans a neighbour
+    const std::size_t total { std::max(k_header_bytes + bytes, BufferPool::k_page_threshold) };
+    auto* block { static_cast<std::byte*>(BufferPool::instance().acquire(total)) };
+    auto* header { ::new (block) PinnedHeader{ total, 0 } };
+    std::byte* data { block + k_header_bytes };
+
+    // Reserve the budget first, so that concurrent acquisitions never overshoot it
+    const std::size_t payload { total - k_header_bytes };
+    if (s_locked_bytes.fetch_add(payload, std::memory_order_relaxed) + payload <= k_max_locked_bytes
+        && lockPages(data, payload)) {
+        header->m_locked = payload;
+    } else {
+        s_locked_bytes.fetch_sub(payload, std::memory_order_relaxed);
+        if (!s_lock_refused.exchange(true, std::memory_order_relaxed)) {
+            spdlog::info("[acquirePinned]: Staging memory could not be page-locked ({} bytes), using pageable memory.", payload);
+        }
+    }
+
+    return data;
+}
+
+void releasePinned(void* ptr) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+
+    std::byte* block { static_cast<std::byte*>(ptr) - k_header_bytes };
+    const PinnedHeader header { *reinterpret_cast<const PinnedHeader*>(block) };
+    if (header.m_locked != 0) {
+        unlockPages(ptr, header.m_locked);
+        s_locked_bytes.fetch_sub(header.m_locked, std::memory_order_relaxed);
+    }
+    BufferPool::instance().release(block, header.m_total);
+}
+
+std::size_t pinnedBytes() noexcept
+{
+    return s_locked_bytes.load(std::memory_order_relaxed);
+}
+
+} // namespace CaptureMoment::Core::Common
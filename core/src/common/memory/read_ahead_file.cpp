@@ -0,0 +1,390 @@
+/**
+ * @file read_ahead_file.cpp
+ * @brief Implementation of ReadAheadFile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/read_ahead_file.h"
+#include "common/trace/tracer.h"
+
+#include "config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/mount.h>
+#include <sys/param.h>
+#elif defined(__linux__)
+#include <linux/magic.h>
+#include <sys/vfs.h>
+#endif
+#if CAPTUREMOMENT_USE_LIBURING
+#include <liburing.h>
+#endif
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+#if defined(_WIN32)
+
+/**
+ * @brief A Windows handle, closed with its scope.
+ */
+struct ScopedHandle {
+    ~ScopedHandle()
+    {
+        if (m_handle && m_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_handle);
+        }
+    }
+
+    HANDLE m_handle { nullptr };
+};
+
+/**
+ * @brief Reads a file with `ReadAheadFile::k_queue_depth` overlapped reads in flight.
+ */
+[[nodiscard]] bool readOverlapped(HANDLE file, std::byte* data, std::size_t size)
+{
+    struct Request {
+        OVERLAPPED m_overlapped {};
+        ScopedHandle m_event;
+        std::size_t m_offset { 0 };
+        std::size_t m_length { 0 };
+        bool m_pending { false };
+    };
+    std::array<Request, ReadAheadFile::k_queue_depth> requests;
+
+    std::size_t next { 0 };
+    bool failed { false };
+
+    const auto issue = [&](Request& request) {
+        request.m_overlapped = OVERLAPPED {};
+        request.m_overlapped.hEvent = request.m_event.m_handle;
+        request.m_overlapped.Offset = static_cast<DWORD>(request.m_offset);
+        request.m_overlapped.OffsetHigh = static_cast<DWORD>(static_cast<std::uint64_t>(request.m_offset) >> 32);
+        // A read completing at once still signals its event
+        if (!ReadFile(file, data + request.m_offset, static_cast<DWORD>(request.m_length), nullptr, &request.m_overlapped)
+            && GetLastError() != ERROR_IO_PENDING) {
+            return false;
+        }
+        request.m_pending = true;
+        return true;
+    };
+
+    const auto assign = [&](Request& request) {
+        request.m_offset = next;
+        request.m_length = std::min(ReadAheadFile::k_chunk_bytes, size - next);
+        next += request.m_length;
+        return issue(request);
+    };
+
+    for (Request& request : requests) {
+        request.m_event.m_handle = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!request.m_event.m_handle) {
+            return false;
+        }
+    }
+    for (Request& request : requests) {
+        if (next < size && !assign(request)) {
+            failed = true;
+            break;
+        }
+    }
+
+    // The requests were issued in file order: waiting on them in turn keeps the queue full
+    bool pending { true };
+    while (pending) {
+        pending = false;
+        for (Request& request : requests) {
+            if (!request.m_pending) {
+                continue;
+            }
+            if (failed) {
+                CancelIoEx(file, &request.m_overlapped);
+            }
+
+            DWORD count { 0 };
+            const bool done { GetOverlappedResult(file, &request.m_overlapped, &count, TRUE) != FALSE };
+            request.m_pending = false;
+            if (failed) {
+                continue;
+            }
+            if (!done || count == 0) {
+                failed = true;
+                continue;
+            }
+
+            request.m_offset += count;
+            request.m_length -= count;
+            const bool issued { request.m_length > 0 ? issue(request) : (next >= size || assign(request)) };
+            failed = !issued;
+            pending = pending || request.m_pending;
+        }
+    }
+    return !failed;
+}
+
+#else
+
+/**
+ * @brief Reads `length` bytes at `offset`, retrying short and interrupted reads.
+ */
+[[nodiscard]] bool readAt(int fd, std::byte* data, std::size_t length, std::size_t offset) noexcept
+{
+    while (length > 0) {
+        const ssize_t count { ::pread(fd, data, length, static_cast<off_t>(offset)) };
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        length -= static_cast<std::size_t>(count);
+        offset += static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a file in chunks from `ReadAheadFile::k_queue_depth` threads at once.
+ */
+[[nodiscard]] bool readThreaded(int fd, std::byte* data, std::size_t size)
+{
+    const std::size_t chunks { (size + ReadAheadFile::k_chunk_bytes - 1) / ReadAheadFile::k_chunk_bytes };
+    if (chunks == 0) {
+        return true;
+    }
+    std::atomic<std::size_t> next_chunk { 0 };
+    std::atomic<bool> failed { false };
+
+    const auto reader = [&]() {
+        for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+             chunk < chunks && !failed.load(std::memory_order_relaxed);
+             chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+            const std::size_t offset { chunk * ReadAheadFile::k_chunk_bytes };
+            if (!readAt(fd, data + offset, std::min(ReadAheadFile::k_chunk_bytes, size - offset), offset)) {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    {
+        const std::size_t helpers { std::min<std::size_t>(ReadAheadFile::k_queue_depth, chunks) - 1 };
+        std::vector<std::jthread> threads;
+        threads.reserve(helpers);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            threads.emplace_back(reader);
+        }
+        reader();
+    }
+    return !failed.load(std::memory_order_relaxed);
+}
+
+#if CAPTUREMOMENT_USE_LIBURING
+
+/**
+ * @brief Reads a file with `ReadAheadFile::k_queue_depth` io_uring reads in flight.
+ */
+[[nodiscard]] bool readUring(io_uring& ring, int fd, std::byte* data, std::size_t size)
+{
+    struct Request {
+        std::size_t m_offset { 0 };
+        std::size_t m_length { 0 };
+    };
+    std::array<Request, ReadAheadFile::k_queue_depth> requests {};
+
+    std::size_t next { 0 };
+    unsigned in_flight { 0 };
+    bool failed { false };
+
+    // Never more requests than entries in the ring: a submission entry is always free
+    const auto issue = [&](Request& request) {
+        io_uring_sqe* sqe { io_uring_get_sqe(&ring) };
+        io_uring_prep_read(sqe, fd, data + request.m_offset, static_cast<unsigned>(request.m_length),
+                           static_cast<std::uint64_t>(request.m_offset));
+        io_uring_sqe_set_data(sqe, &request);
+    };
+
+    const auto assign = [&](Request& request) {
+        request.m_offset = next;
+        request.m_length = std::min(ReadAheadFile::k_chunk_bytes, size - next);
+        next += request.m_length;
+        issue(request);
+        ++in_flight;
+    };
+
+    for (Request& request : requests) {
+        if (next < size) {
+            assign(request);
+        }
+    }
+    io_uring_submit(&ring);
+
+    // The buffer belongs to the caller: every read in flight completes before returning
+    while (in_flight > 0) {
+        io_uring_cqe* cqe { nullptr };
+        const int waited { io_uring_wait_cqe(&ring, &cqe) };
+        if (waited == -EINTR) {
+            continue;
+        }
+        if (waited < 0) {
+            // The ring is unusable: its reads cannot be waited for, nor the buffer released
+            spdlog::critical("[ReadAheadFile::read]: io_uring wait failed ({})", -waited);
+            std::terminate();
+        }
+
+        auto& request { *static_cast<Request*>(io_uring_cqe_get_data(cqe)) };
+        const int result { cqe->res };
+        io_uring_cqe_seen(&ring, cqe);
+        --in_flight;
+
+        if (failed) {
+            continue;
+        }
+        if (result == -EINTR || result == -EAGAIN) {
+            issue(request);
+            ++in_flight;
+        } else if (result <= 0) {
+            failed = true;
+        } else if (static_cast<std::size_t>(result) < request.m_length) {
+            request.m_offset += static_cast<std::size_t>(result);
+            request.m_length -= static_cast<std::size_t>(result);
+            issue(request);
+            ++in_flight;
+        } else if (next < size) {
+            assign(request);
+        }
+        io_uring_submit(&ring);
+    }
+    return !failed;
+}
+
+#endif
+
+#endif
+
+} // namespace
+
+std::expected<ReadAheadFile, ErrorHandling::CoreError> ReadAheadFile::read(const std::filesystem::path& path)
+{
+    CM_TRACE_SCOPE("io", "ReadAheadFile::read");
+
+    ReadAheadFile contents;
+
+#if defined(_WIN32)
+    ScopedHandle file { CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                    OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+    if (file.m_handle == INVALID_HANDLE_VALUE) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    LARGE_INTEGER size {};
+    if (!GetFileSizeEx(file.m_handle, &size) || size.QuadPart < 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    contents.m_size = static_cast<std::size_t>(size.QuadPart);
+    contents.m_data = std::make_unique_for_overwrite<std::byte[]>(contents.m_size);
+
+    const bool done { readOverlapped(file.m_handle, contents.m_data.get(), contents.m_size) };
+#else
+    const int fd { ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+    if (fd < 0) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size < 0) {
+        ::close(fd);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    contents.m_size = static_cast<std::size_t>(info.st_size);
+    contents.m_data = std::make_unique_for_overwrite<std::byte[]>(contents.m_size);
+
+    bool done { false };
+#if CAPTUREMOMENT_USE_LIBURING
+    io_uring ring {};
+    if (const int created = io_uring_queue_init(k_queue_depth, &ring, 0); created == 0) {
+        done = readUring(ring, fd, contents.m_data.get(), contents.m_size);
+        io_uring_queue_exit(&ring);
+    } else {
+        // Disabled by the kernel or a sandbox (seccomp, io_uring_disabled)
+        spdlog::debug("[ReadAheadFile::read]: No io_uring ({}), reading from threads", -created);
+        done = readThreaded(fd, contents.m_data.get(), contents.m_size);
+    }
+#else
+    done = readThreaded(fd, contents.m_data.get(), contents.m_size);
+#endif
+    ::close(fd);
+#endif
+
+    if (!done) {
+        spdlog::warn("[ReadAheadFile::read]: Failed to read '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::debug("[ReadAheadFile::read]: Read the {} bytes of '{}'", contents.m_size, path.string());
+    return contents;
+}
+
+bool ReadAheadFile::isRemote(const std::filesystem::path& path) noexcept
+{
+#if defined(_WIN32)
+    std::error_code error;
+    const std::filesystem::path absolute { std::filesystem::absolute(path, error) };
+    if (error) {
+        return false;
+    }
+    const std::wstring root { absolute.root_path().wstring() };
+    // UNC paths (\\server\share\...) name network storage by construction
+    return root.starts_with(L"\\\\") || GetDriveTypeW(root.c_str()) == DRIVE_REMOTE;
+#elif defined(__APPLE__)
+    struct statfs info {};
+    return ::statfs(path.c_str(), &info) == 0 && (info.f_flags & MNT_LOCAL) == 0;
+#elif defined(__linux__)
+    struct statfs info {};
+    if (::statfs(path.c_str(), &info) != 0) {
+        return false;
+    }
+    switch (static_cast<unsigned long>(info.f_type)) {
+    case NFS_SUPER_MAGIC:
+    case SMB_SUPER_MAGIC:
+    case CIFS_SUPER_MAGIC:
+    case SMB2_SUPER_MAGIC:
+    case AFS_SUPER_MAGIC:
+    case AFS_FS_MAGIC:
+    case CEPH_SUPER_MAGIC:
+        return true;
+    default:
+        return false;
+    }
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+} // namespace CaptureMoment::Core::Common
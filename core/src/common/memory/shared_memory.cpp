@@ -0,0 +1,175 @@
+/**
+ * @file shared_memory.cpp
+ * @brief Implementation of SharedMemory.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/shared_memory.h"
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+#if !defined(_WIN32)
+namespace {
+
+/**
+ * @brief Creates the descriptor of an anonymous region (-1 on failure).
+ */
+[[nodiscard]] int createDescriptor()
+{
+#if defined(__linux__)
+    return ::memfd_create("capturemoment", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#else
+    // A unique name, unlinked at once: the descriptor is the only reference left
+    static std::atomic<unsigned> s_sequence { 0 };
+    const std::string name { "/capturemoment-" + std::to_string(::getpid()) + "-"
+                             + std::to_string(s_sequence.fetch_add(1, std::memory_order_relaxed)) };
+    const int descriptor { ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600) };
+    if (descriptor >= 0) {
+        ::shm_unlink(name.c_str());
+        ::fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+    }
+    return descriptor;
+#endif
+}
+
+} // anonymous namespace
+#endif
+
+std::expected<SharedMemory, ErrorHandling::CoreError> SharedMemory::create(std::size_t size)
+{
+#if defined(_WIN32)
+    (void)size;
+    spdlog::error("[SharedMemory::create]: Not available on Windows");
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    if (size == 0) {
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+
+    SharedMemory memory;
+    memory.m_descriptor = createDescriptor();
+    if (memory.m_descriptor < 0) {
+        spdlog::error("[SharedMemory::create]: Cannot create a region: {}", std::strerror(errno));
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    if (::ftruncate(memory.m_descriptor, static_cast<off_t>(size)) != 0) {
+        spdlog::error("[SharedMemory::create]: Cannot size a region of {} bytes: {}", size, std::strerror(errno));
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+#if defined(__linux__)
+    // Its size is final: the peer can map it without fearing a truncation
+    if (::fcntl(memory.m_descriptor, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+        spdlog::error("[SharedMemory::create]: Cannot seal a region: {}", std::strerror(errno));
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+#endif
+
+    void* data { ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, memory.m_descriptor, 0) };
+    if (data == MAP_FAILED) {
+        spdlog::error("[SharedMemory::create]: Cannot map a region of {} bytes: {}", size, std::strerror(errno));
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    memory.m_data = data;
+    memory.m_size = size;
+    memory.m_writable = true;
+    return memory;
+#endif
+}
+
+std::expected<SharedMemory, ErrorHandling::CoreError> SharedMemory::adopt(int descriptor, bool writable)
+{
+#if defined(_WIN32)
+    (void)descriptor;
+    (void)writable;
+    spdlog::error("[SharedMemory::adopt]: Not available on Windows");
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    SharedMemory memory;
+    memory.m_descriptor = descriptor;
+
+    struct stat info{};
+    if (::fstat(descriptor, &info) != 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    if (info.st_size <= 0) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+#if defined(__linux__)
+    const int seals { ::fcntl(descriptor, F_GET_SEALS) };
+    if (seals < 0 || (seals & F_SEAL_SHRINK) == 0) {
+        spdlog::warn("[SharedMemory::adopt]: Refused a region its sender can still shrink");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+#endif
+
+    const auto size { static_cast<std::size_t>(info.st_size) };
+    void* data { ::mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor, 0) };
+    if (data == MAP_FAILED) {
+        spdlog::warn("[SharedMemory::adopt]: Cannot map a region of {} bytes: {}", size, std::strerror(errno));
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    memory.m_data = data;
+    memory.m_size = size;
+    memory.m_writable = writable;
+    return memory;
+#endif
+}
+
+SharedMemory::~SharedMemory()
+{
+    reset();
+}
+
+SharedMemory::SharedMemory(SharedMemory&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+    , m_descriptor(std::exchange(other.m_descriptor, -1))
+    , m_writable(std::exchange(other.m_writable, false))
+{
+}
+
+SharedMemory& SharedMemory::operator=(SharedMemory&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_descriptor = std::exchange(other.m_descriptor, -1);
+        m_writable = std::exchange(other.m_writable, false);
+    }
+    return *this;
+}
+
+void SharedMemory::reset() noexcept
+{
+#if !defined(_WIN32)
+    if (m_data) {
+        ::munmap(m_data, m_size);
+    }
+    if (m_descriptor >= 0) {
+        ::close(m_descriptor);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_descriptor = -1;
+    m_writable = false;
+}
+
+} // namespace CaptureMoment::Core::Common
@@ -0,0 +1,94 @@
+/**
+ * @file core_metrics.cpp
+ * @brief Registration of the library's instruments.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/metrics/core_metrics.h"
+
+#include <array>
+
+namespace CaptureMoment::Core::Common::Metrics {
+
+namespace {
+
+/**
+ * @brief Millisecond buckets from an interactive frame to a cold RAW decode or JIT compile.
+ */
+constexpr std::array<double, 14> k_duration_buckets_ms { 1.0, 2.0, 5.0, 10.0, 16.0, 33.0, 50.0, 100.0,
+                                                          250.0, 500.0, 1000.0, 2500.0, 5000.0, 10000.0 };
+
+} // anonymous namespace
+
+const CoreMetrics& coreMetrics()
+{
+    static const CoreMetrics metrics = [] {
+        MetricsRegistry& registry { MetricsRegistry::instance() };
+        return CoreMetrics{
+            .m_requests_submitted = registry.counter("capturemoment_requests_submitted_total",
+                                                     "Processing requests submitted."),
+            .m_requests_completed = registry.counter("capturemoment_requests_completed_total",
+                                                     "Processing passes run to completion."),
+            .m_requests_coalesced = registry.counter("capturemoment_requests_coalesced_total",
+                                                     "Requests superseded by a newer one before they ran."),
+            .m_requests_dropped = registry.counter("capturemoment_requests_dropped_total",
+                                                   "Passes aborted mid-run by a newer request."),
+            .m_requests_cancelled = registry.counter("capturemoment_requests_cancelled_total",
+                                                     "Requests cancelled explicitly (image change, shutdown)."),
+            .m_requests_failed = registry.counter("capturemoment_requests_failed_total",
+                                                  "Processing passes that failed."),
+            .m_request_latency_ms = registry.histogram("capturemoment_request_latency_ms",
+                                                       "Submission to completion of the completed requests, in ms.",
+                                                       k_duration_buckets_ms),
+            .m_idle_waits = registry.counter("capturemoment_idle_waits_total",
+                                             "Callers blocked until the running pass finished (load, shutdown)."),
+            .m_idle_wait_ms = registry.histogram("capturemoment_idle_wait_ms",
+                                                 "Time those callers were blocked, in ms.",
+                                                 k_duration_buckets_ms),
+            .m_result_cache_hits = registry.counter("capturemoment_result_cache_hits_total",
+                                                    "Requests served by the rendered-state result cache."),
+            .m_result_disk_cache_hits = registry.counter("capturemoment_result_disk_cache_hits_total",
+                                                         "Result cache hits read from its disk tier."),
+
+            .m_source_decodes = registry.counter("capturemoment_source_decodes_total",
+                                                 "Image files decoded."),
+            .m_source_decoded_bytes = registry.counter("capturemoment_source_decoded_bytes_total",
+                                                       "Bytes of pixel data produced by the decodes."),
+            .m_source_decode_ms = registry.histogram("capturemoment_source_decode_ms",
+                                                     "Duration of the decodes, in ms.",
+                                                     k_duration_buckets_ms),
+            .m_source_cache_hits = registry.counter("capturemoment_source_cache_hits_total",
+                                                    "Decodes served by the in-memory decoded-image cache."),
+            .m_source_disk_cache_hits = registry.counter("capturemoment_source_disk_cache_hits_total",
+                                                         "Decodes mapped from the persistent disk cache."),
+            .m_source_compressed_cache_hits = registry.counter("capturemoment_source_compressed_cache_hits_total",
+                                                               "Decodes restored from the compressed in-memory cache."),
+
+            .m_pipeline_compiles = registry.counter("capturemoment_pipeline_compiles_total",
+                                                    "Fused pipelines compiled (JIT or into the disk cache)."),
+            .m_pipeline_cache_hits = registry.counter("capturemoment_pipeline_cache_hits_total",
+                                                      "Operation chains served by the compiled pipeline cache."),
+            .m_pipeline_disk_cache_hits = registry.counter("capturemoment_pipeline_disk_cache_hits_total",
+                                                           "Fused pipelines loaded from the persistent disk cache."),
+            .m_pipeline_compile_ms = registry.histogram("capturemoment_pipeline_compile_ms",
+                                                        "Duration of the JIT compilations, in ms.",
+                                                        k_duration_buckets_ms),
+            .m_pipeline_realize_ms = registry.histogram("capturemoment_pipeline_realize_ms",
+                                                        "Duration of the pipeline realizations, in ms.",
+                                                        k_duration_buckets_ms),
+
+            .m_gpu_uploaded_bytes = registry.counter("capturemoment_gpu_uploaded_bytes_total",
+                                                     "Bytes copied from host to device memory."),
+            .m_gpu_downloaded_bytes = registry.counter("capturemoment_gpu_downloaded_bytes_total",
+                                                       "Bytes copied from device to host memory."),
+            .m_gpu_pool_reuses = registry.counter("capturemoment_gpu_pool_reuses_total",
+                                                  "Device buffers served from the device pool."),
+            .m_gpu_pool_allocations = registry.counter("capturemoment_gpu_pool_allocations_total",
+                                                       "Device buffers the device pool had to allocate."),
+        };
+    }();
+    return metrics;
+}
+
+} // namespace CaptureMoment::Core::Common::Metrics
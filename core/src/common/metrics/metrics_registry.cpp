@@ -0,0 +1,164 @@
+/**
+ * @file metrics_registry.cpp
+ * @brief Implementation of MetricsRegistry.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/metrics/metrics_registry.h"
+
+#include <algorithm>
+#include <format>
+
+namespace CaptureMoment::Core::Common::Metrics {
+
+namespace {
+
+/**
+ * @brief Formats a sample value as Prometheus expects (shortest round-trip form).
+ */
+[[nodiscard]] std::string formatValue(double value)
+{
+    return std::format("{}", value);
+}
+
+} // anonymous namespace
+
+Histogram::Histogram(std::span<const double> upper_bounds)
+    : m_upper_bounds(upper_bounds.begin(), upper_bounds.end())
+    , m_bucket_counts(std::make_unique<std::atomic<std::uint64_t>[]>(upper_bounds.size() + 1))
+{
+    std::ranges::sort(m_upper_bounds);
+}
+
+void Histogram::observe(double value) noexcept
+{
+    // Few buckets: a linear scan beats a binary search
+    std::size_t bucket { 0 };
+    while (bucket < m_upper_bounds.size() && value > m_upper_bounds[bucket]) {
+        ++bucket;
+    }
+
+    m_bucket_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+std::optional<std::uint64_t> MetricsSnapshot::counter(std::string_view name) const
+{
+    const auto it { std::ranges::find(m_counters, name, &CounterSnapshot::m_name) };
+    return it != m_counters.end() ? std::optional(it->m_value) : std::nullopt;
+}
+
+const HistogramSnapshot* MetricsSnapshot::histogram(std::string_view name) const
+{
+    const auto it { std::ranges::find(m_histograms, name, &HistogramSnapshot::m_name) };
+    return it != m_histograms.end() ? &*it : nullptr;
+}
+
+MetricsRegistry& MetricsRegistry::instance()
+{
+    // Intentionally leaked: instruments are updated until the last static destructor
+    static MetricsRegistry* registry = new MetricsRegistry();
+    return *registry;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name, std::string_view help)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto it { m_counters.find(name) };
+    if (it == m_counters.end()) {
+        it = m_counters.emplace(std::string(name), Entry<Counter>{ std::string(help), std::make_unique<Counter>() }).first;
+    }
+    return *it->second.m_instrument;
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::string_view help, std::span<const double> upper_bounds)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto it { m_histograms.find(name) };
+    if (it == m_histograms.end()) {
+        it = m_histograms.emplace(std::string(name),
+                                  Entry<Histogram>{ std::string(help), std::make_unique<Histogram>(upper_bounds) }).first;
+    }
+    return *it->second.m_instrument;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const
+{
+    std::lock_guard lock(m_mutex);
+
+    MetricsSnapshot snapshot;
+    snapshot.m_counters.reserve(m_counters.size());
+    for (const auto& [name, entry] : m_counters) {
+        snapshot.m_counters.push_back({ name, entry.m_help, entry.m_instrument->value() });
+    }
+
+    snapshot.m_histograms.reserve(m_histograms.size());
+    for (const auto& [name, entry] : m_histograms) {
+        const Histogram& histogram { *entry.m_instrument };
+
+        HistogramSnapshot sample;
+        sample.m_name = name;
+        sample.m_help = entry.m_help;
+        sample.m_upper_bounds = histogram.m_upper_bounds;
+        sample.m_cumulative_counts.reserve(histogram.m_upper_bounds.size() + 1);
+
+        std::uint64_t cumulative { 0 };
+        for (std::size_t bucket = 0; bucket <= histogram.m_upper_bounds.size(); ++bucket) {
+            cumulative += histogram.m_bucket_counts[bucket].load(std::memory_order_relaxed);
+            sample.m_cumulative_counts.push_back(cumulative);
+        }
+        // The count is the +Inf bucket, as the format requires
+        sample.m_count = cumulative;
+        sample.m_sum = histogram.m_sum.load(std::memory_order_relaxed);
+
+        snapshot.m_histograms.push_back(std::move(sample));
+    }
+
+    return snapshot;
+}
+
+std::string MetricsRegistry::toPrometheusText() const
+{
+    const MetricsSnapshot values { snapshot() };
+
+    std::string text;
+    for (const CounterSnapshot& counter : values.m_counters) {
+        text += std::format("# HELP {} {}\n# TYPE {} counter\n{} {}\n",
+                            counter.m_name, counter.m_help, counter.m_name, counter.m_name, counter.m_value);
+    }
+
+    for (const HistogramSnapshot& histogram : values.m_histograms) {
+        text += std::format("# HELP {} {}\n# TYPE {} histogram\n", histogram.m_name, histogram.m_help, histogram.m_name);
+        for (std::size_t bucket = 0; bucket < histogram.m_upper_bounds.size(); ++bucket) {
+            text += std::format("{}_bucket{{le=\"{}\"}} {}\n", histogram.m_name,
+                                formatValue(histogram.m_upper_bounds[bucket]), histogram.m_cumulative_counts[bucket]);
+        }
+        text += std::format("{}_bucket{{le=\"+Inf\"}} {}\n{}_sum {}\n{}_count {}\n",
+                            histogram.m_name, histogram.m_count,
+                            histogram.m_name, formatValue(histogram.m_sum),
+                            histogram.m_name, histogram.m_count);
+    }
+
+    return text;
+}
+
+void MetricsRegistry::reset() noexcept
+{
+    std::lock_guard lock(m_mutex);
+
+    for (auto& [name, entry] : m_counters) {
+        entry.m_instrument->m_value.store(0, std::memory_order_relaxed);
+    }
+    for (auto& [name, entry] : m_histograms) {
+        Histogram& histogram { *entry.m_instrument };
+        for (std::size_t bucket = 0; bucket <= histogram.m_upper_bounds.size(); ++bucket) {
+            histogram.m_bucket_counts[bucket].store(0, std::memory_order_relaxed);
+        }
+        histogram.m_sum.store(0.0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace CaptureMoment::Core::Common::Metrics
@@ -0,0 +1,181 @@
+/**
+ * @file numa_topology.cpp
+ * @brief Implementation of NumaTopology.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/numa_topology.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief Node the calling thread is pinned to.
+ */
+thread_local std::optional<std::size_t> t_pinned_node;
+
+/**
+ * @brief Parses a sysfs list such as "0-7,16-23".
+ */
+[[nodiscard]] std::vector<int> parseList(std::string_view text)
+{
+    std::vector<int> values;
+    while (!text.empty()) {
+        const auto comma { text.find(',') };
+        const std::string_view range { text.substr(0, comma) };
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+        int first { 0 };
+        int last { 0 };
+        const auto dash { range.find('-') };
+        const std::string_view first_text { range.substr(0, dash) };
+        if (std::from_chars(first_text.data(), first_text.data() + first_text.size(), first).ec != std::errc{}) {
+            continue;
+        }
+        last = first;
+        if (dash != std::string_view::npos) {
+            const std::string_view last_text { range.substr(dash + 1) };
+            if (std::from_chars(last_text.data(), last_text.data() + last_text.size(), last).ec != std::errc{}) {
+                continue;
+            }
+        }
+        for (int value = first; value <= last; ++value) {
+            values.push_back(value);
+        }
+    }
+    return values;
+}
+
+/**
+ * @brief First line of a file, without its line break (empty if unreadable).
+ */
+[[nodiscard]] std::string readLine(const std::string& path)
+{
+    std::ifstream file { path };
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+#if defined(__linux__)
+/**
+ * @brief Restricts the calling thread to a set of CPUs.
+ */
+bool setAffinity(const std::vector<int>& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+#endif
+
+} // anonymous namespace
+
+const NumaTopology& NumaTopology::instance()
+{
+    static const NumaTopology s_instance;
+    return s_instance;
+}
+
+NumaTopology::NumaTopology()
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                m_process_cpus.push_back(cpu);
+            }
+        }
+    }
+
+    // Nodes without an allowed CPU (memory-only, or excluded by the affinity mask) are skipped
+    for (const int node : parseList(readLine("/sys/devices/system/node/online"))) {
+        std::vector<int> cpus { parseList(readLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")) };
+        std::erase_if(cpus, [this](int cpu) { return !std::ranges::binary_search(m_process_cpus, cpu); });
+        if (!cpus.empty()) {
+            m_node_cpus.push_back(std::move(cpus));
+        }
+    }
+#endif
+
+    if (m_node_cpus.size() < 2) {
+        m_node_cpus.assign(1, m_process_cpus);
+    }
+    spdlog::debug("[NumaTopology::NumaTopology]: {} node(s), {} CPU(s).", m_node_cpus.size(),
+                  m_process_cpus.empty() ? std::thread::hardware_concurrency() : m_process_cpus.size());
+}
+
+bool NumaTopology::pinCurrentThread(std::size_t node) const
+{
+#if defined(__linux__)
+    if (node < m_node_cpus.size() && !m_node_cpus[node].empty() && setAffinity(m_node_cpus[node])) {
+        t_pinned_node = node;
+        return true;
+    }
+#else
+    static_cast<void>(node);
+#endif
+    return false;
+}
+
+void NumaTopology::unpinCurrentThread() const
+{
+#if defined(__linux__)
+    if (t_pinned_node && !m_process_cpus.empty()) {
+        setAffinity(m_process_cpus);
+    }
+#endif
+    t_pinned_node.reset();
+}
+
+std::optional<std::size_t> NumaTopology::pinnedNode() noexcept
+{
+    return t_pinned_node;
+}
+
+NumaTopology::ScopedPin::ScopedPin(std::optional<std::size_t> node)
+    : m_previous(t_pinned_node)
+{
+    const auto& topology { NumaTopology::instance() };
+    if (node && topology.nodeCount() > 1 && node != m_previous) {
+        m_pinned = topology.pinCurrentThread(*node);
+    }
+}
+
+NumaTopology::ScopedPin::~ScopedPin()
+{
+    if (!m_pinned) {
+        return;
+    }
+    const auto& topology { NumaTopology::instance() };
+    if (m_previous) {
+        topology.pinCurrentThread(*m_previous);
+    } else {
+        topology.unpinCurrentThread();
+    }
+}
+
+} // namespace CaptureMoment::Core::Common
@@ -0,0 +1,243 @@
+/**
+ * @file allocation_tracker.cpp
+ * @brief Implementation of AllocationTracker.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/trace/allocation_tracker.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <map>
+#include <new>
+#include <utility>
+
+namespace CaptureMoment::Core::Common::Trace {
+
+namespace {
+
+/**
+ * @brief Stage of the calling thread.
+ */
+thread_local const char* t_stage { nullptr };
+
+[[nodiscard]] std::string_view stageName(const char* stage) noexcept
+{
+    return stage ? std::string_view { stage } : AllocationTracker::k_untraced_stage;
+}
+
+[[nodiscard]] double toMiB(std::uint64_t bytes) noexcept
+{
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // anonymous namespace
+
+AllocationTracker& AllocationTracker::instance()
+{
+    // Intentionally leaked: blocks are released in static destructors, and the report is written at exit
+    static AllocationTracker* tracker = new AllocationTracker();
+    return *tracker;
+}
+
+const char* AllocationTracker::currentStage() noexcept
+{
+    return t_stage;
+}
+
+const char* AllocationTracker::exchangeStage(const char* stage) noexcept
+{
+    return std::exchange(t_stage, stage);
+}
+
+AllocationTracker::StageStats& AllocationTracker::stage_unsafe()
+{
+    return m_stages[t_stage];
+}
+
+void AllocationTracker::updatePeaks_unsafe(StageStats& stage) noexcept
+{
+    m_peak_total_bytes = std::max(m_peak_total_bytes, m_total_bytes);
+    stage.m_peak_live_bytes = std::max(stage.m_peak_live_bytes, stage.m_live_bytes);
+    stage.m_peak_total_bytes = std::max(stage.m_peak_total_bytes, m_total_bytes);
+}
+
+void AllocationTracker::recordAllocation(const void* ptr, std::size_t bytes) noexcept
+{
+    if (!ptr || !isEnabled()) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    try {
+        const auto [it, inserted] = m_blocks.try_emplace(ptr, Block { t_stage, bytes });
+        if (!inserted) {
+            // Released without being reported: forget the stale block
+            m_total_bytes -= std::min<std::uint64_t>(m_total_bytes, it->second.m_bytes);
+            it->second = Block { t_stage, bytes };
+        } else {
+            m_tracked_blocks.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        StageStats& stage { stage_unsafe() };
+        ++stage.m_allocations;
+        stage.m_allocated_bytes += bytes;
+        stage.m_live_bytes += bytes;
+        m_total_bytes += bytes;
+        updatePeaks_unsafe(stage);
+    } catch (const std::bad_alloc&) {
+        // Out of memory for the bookkeeping: the block stays untracked
+    }
+}
+
+void AllocationTracker::recordFree(const void* ptr) noexcept
+{
+    if (!ptr || m_tracked_blocks.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    const auto it = m_blocks.find(ptr);
+    if (it == m_blocks.end()) {
+        return;
+    }
+
+    const Block block { it->second };
+    m_blocks.erase(it);
+    m_tracked_blocks.fetch_sub(1, std::memory_order_relaxed);
+    m_total_bytes -= std::min<std::uint64_t>(m_total_bytes, block.m_bytes);
+
+    // Attributed to the allocating stage, whichever thread frees it
+    if (const auto stage = m_stages.find(block.m_stage); stage != m_stages.end()) {
+        stage->second.m_live_bytes -= std::min<std::uint64_t>(stage->second.m_live_bytes, block.m_bytes);
+    }
+}
+
+void AllocationTracker::countAllocation(std::size_t bytes) noexcept
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    try {
+        StageStats& stage { stage_unsafe() };
+        ++stage.m_allocations;
+        stage.m_allocated_bytes += bytes;
+        stage.m_peak_total_bytes = std::max(stage.m_peak_total_bytes, m_total_bytes + bytes);
+        m_peak_total_bytes = std::max(m_peak_total_bytes, m_total_bytes + bytes);
+    } catch (const std::bad_alloc&) {
+    }
+}
+
+void AllocationTracker::sampleGauge(const char* name, std::size_t bytes) noexcept
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    try {
+        Gauge& gauge { m_gauges[name] };
+        m_total_bytes = m_total_bytes - std::min<std::uint64_t>(m_total_bytes, gauge.m_bytes) + bytes;
+        gauge.m_bytes = bytes;
+        gauge.m_peak_bytes = std::max<std::uint64_t>(gauge.m_peak_bytes, bytes);
+
+        // The growth happened within the sampling stage
+        updatePeaks_unsafe(stage_unsafe());
+    } catch (const std::bad_alloc&) {
+    }
+}
+
+std::vector<AllocationTracker::StageStats> AllocationTracker::stageStats() const
+{
+    // Equal names from different translation units may have different pointers
+    std::map<std::string_view, StageStats> merged;
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& [key, stats] : m_stages) {
+            StageStats& stage { merged[stageName(key)] };
+            stage.m_allocations += stats.m_allocations;
+            stage.m_allocated_bytes += stats.m_allocated_bytes;
+            stage.m_live_bytes += stats.m_live_bytes;
+            stage.m_peak_live_bytes = std::max(stage.m_peak_live_bytes, stats.m_peak_live_bytes);
+            stage.m_peak_total_bytes = std::max(stage.m_peak_total_bytes, stats.m_peak_total_bytes);
+        }
+    }
+
+    std::vector<StageStats> stages;
+    stages.reserve(merged.size());
+    for (auto& [name, stats] : merged) {
+        stats.m_stage = std::string(name);
+        stages.push_back(std::move(stats));
+    }
+    std::ranges::stable_sort(stages, std::ranges::greater {}, &StageStats::m_peak_total_bytes);
+    return stages;
+}
+
+std::uint64_t AllocationTracker::peakTotalBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_peak_total_bytes;
+}
+
+void AllocationTracker::resetStats() noexcept
+{
+    std::lock_guard lock(m_mutex);
+
+    // Keep the live bytes of the stages: the blocks still to be released are subtracted from them
+    for (auto& [key, stats] : m_stages) {
+        stats = StageStats { .m_live_bytes = stats.m_live_bytes,
+                             .m_peak_live_bytes = stats.m_live_bytes,
+                             .m_peak_total_bytes = m_total_bytes };
+    }
+    for (auto& [name, gauge] : m_gauges) {
+        gauge.m_peak_bytes = gauge.m_bytes;
+    }
+    m_peak_total_bytes = m_total_bytes;
+}
+
+std::expected<void, ErrorHandling::CoreError> AllocationTracker::writeReport(const std::filesystem::path& path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        spdlog::error("[AllocationTracker::writeReport]: Cannot open '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    const auto stages { stageStats() };
+
+    out << std::format("Peak tracked memory: {:.1f} MiB\n\n", toMiB(peakTotalBytes()));
+    out << std::format("{:<40} {:>12} {:>14} {:>12} {:>14} {:>15}\n",
+                       "stage", "allocations", "allocated MiB", "live MiB", "peak live MiB", "peak total MiB");
+    for (const auto& stage : stages) {
+        out << std::format("{:<40} {:>12} {:>14.1f} {:>12.1f} {:>14.1f} {:>15.1f}\n", stage.m_stage, stage.m_allocations,
+                           toMiB(stage.m_allocated_bytes), toMiB(stage.m_live_bytes), toMiB(stage.m_peak_live_bytes),
+                           toMiB(stage.m_peak_total_bytes));
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_gauges.empty()) {
+            out << std::format("\n{:<40} {:>12} {:>14}\n", "gauge", "MiB", "peak MiB");
+            for (const auto& [name, gauge] : m_gauges) {
+                out << std::format("{:<40} {:>12.1f} {:>14.1f}\n", name, toMiB(gauge.m_bytes), toMiB(gauge.m_peak_bytes));
+            }
+        }
+    }
+
+    out.flush();
+    if (!out) {
+        spdlog::error("[AllocationTracker::writeReport]: Write to '{}' failed", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::info("[AllocationTracker::writeReport]: {} stage(s) written to '{}'", stages.size(), path.string());
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Common::Trace
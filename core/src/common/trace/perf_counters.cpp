@@ -0,0 +1,194 @@
+/**
+ * @file perf_counters.cpp
+ * @brief Implementation of PerfCounters.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/trace/perf_counters.h"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace CaptureMoment::Core::Common::Trace {
+
+namespace {
+
+/**
+ * @brief Counter added to the calling thread's reads by the accumulators it created.
+ */
+thread_local CounterSample t_accumulated {};
+
+#if defined(__linux__)
+
+/**
+ * @brief The counter group of a thread, closed when the thread exits.
+ */
+class ThreadCounters {
+public:
+    ThreadCounters()
+    {
+        constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, 3> k_events { {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        } };
+
+        for (std::size_t index = 0; index < k_events.size(); ++index) {
+            perf_event_attr attr {};
+            attr.size = sizeof(attr);
+            attr.type = k_events[index].first;
+            attr.config = k_events[index].second;
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // The group starts with its leader
+            attr.disabled = index == 0 ? 1 : 0;
+
+            const int group { index == 0 ? -1 : m_fds[0] };
+            m_fds[index] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+            if (m_fds[index] < 0) {
+                m_error = errno;
+                close();
+                return;
+            }
+        }
+
+        ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    ~ThreadCounters() { close(); }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    [[nodiscard]] bool isOpen() const noexcept { return m_fds[0] >= 0; }
+
+    /**
+     * @brief errno of the failed open, 0 if open.
+     */
+    [[nodiscard]] int error() const noexcept { return m_error; }
+
+    bool read(CounterSample& sample) const noexcept
+    {
+        if (!isOpen()) {
+            return false;
+        }
+
+        // PERF_FORMAT_GROUP: the number of events, then their values in group order
+        std::array<std::uint64_t, 4> values {};
+        if (::read(m_fds[0], values.data(), sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[0] != 3) {
+            return false;
+        }
+        sample = { values[1], values[2], values[3] };
+        return true;
+    }
+
+private:
+    void close() noexcept
+    {
+        for (int& fd : m_fds) {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    std::array<int, 3> m_fds { -1, -1, -1 };
+    int m_error { 0 };
+};
+
+[[nodiscard]] const ThreadCounters& threadCounters()
+{
+    thread_local const ThreadCounters counters;
+    return counters;
+}
+
+#endif
+
+} // anonymous namespace
+
+bool PerfCounters::isSupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PerfCounters::setEnabled(bool enabled)
+{
+    if (!enabled) {
+        s_enabled.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+#if defined(__linux__)
+    // Probed on the calling thread: a host refusing the events refuses them on every thread
+    if (const ThreadCounters& counters { threadCounters() }; !counters.isOpen()) {
+        spdlog::warn("[PerfCounters::setEnabled]: perf_event_open failed ({}): no hardware counters on this host, "
+                     "or kernel.perf_event_paranoid above 2", std::strerror(counters.error()));
+        return false;
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    spdlog::warn("[PerfCounters::setEnabled]: Hardware counters are only read on Linux");
+    return false;
+#endif
+}
+
+bool PerfCounters::readThread(CounterSample& sample) noexcept
+{
+#if defined(__linux__)
+    return threadCounters().read(sample);
+#else
+    static_cast<void>(sample);
+    return false;
+#endif
+}
+
+bool PerfCounters::read(CounterSample& sample) noexcept
+{
+    if (!readThread(sample)) {
+        return false;
+    }
+    sample += t_accumulated;
+    return true;
+}
+
+void PerfCounters::Accumulator::add(const CounterSample& begin) noexcept
+{
+    CounterSample end;
+    if (!readThread(end)) {
+        return;
+    }
+    const CounterSample spent { end - begin };
+    m_cycles.fetch_add(spent.m_cycles, std::memory_order_relaxed);
+    m_instructions.fetch_add(spent.m_instructions, std::memory_order_relaxed);
+    m_llc_misses.fetch_add(spent.m_llc_misses, std::memory_order_relaxed);
+}
+
+PerfCounters::Accumulator::~Accumulator()
+{
+    // Destroyed on the creating thread, after the work completed
+    t_accumulated += CounterSample { m_cycles.load(std::memory_order_relaxed),
+                                     m_instructions.load(std::memory_order_relaxed),
+                                     m_llc_misses.load(std::memory_order_relaxed) };
+}
+
+} // namespace CaptureMoment::Core::Common::Trace
@@ -0,0 +1,106 @@
+/**
+ * @file startup_profile.cpp
+ * @brief Implementation of StartupProfile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/trace/startup_profile.h"
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <format>
+
+namespace CaptureMoment::Core::Common::Trace {
+
+namespace {
+
+[[nodiscard]] constexpr double toMs(std::int64_t ns) noexcept
+{
+    return static_cast<double>(ns) / 1.0e6;
+}
+
+} // anonymous namespace
+
+StartupProfile& StartupProfile::instance()
+{
+    static StartupProfile profile;
+    return profile;
+}
+
+void StartupProfile::record(const char* name, std::int64_t begin_ns, std::int64_t end_ns)
+{
+    Tracer& tracer { Tracer::instance() };
+    if (tracer.isEnabled()) {
+        tracer.record("startup", name, begin_ns, end_ns);
+    }
+
+    StartupPhase phase { name, toMs(begin_ns), toMs(end_ns - begin_ns), false };
+    {
+        std::lock_guard lock(m_mutex);
+        phase.m_background = m_interactive_ms >= 0.0;
+        m_phases.push_back(phase);
+    }
+
+    if (phase.m_background) {
+        spdlog::info("[StartupProfile]: Background phase '{}' took {:.1f} ms (ended at {:.1f} ms).",
+                     name, phase.m_duration_ms, phase.m_begin_ms + phase.m_duration_ms);
+    }
+}
+
+void StartupProfile::finish()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_interactive_ms >= 0.0) {
+            return;
+        }
+        m_interactive_ms = toMs(Tracer::instance().now());
+    }
+
+    spdlog::info("[StartupProfile]: Launch report\n{}", report());
+}
+
+double StartupProfile::interactiveMs() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_interactive_ms;
+}
+
+std::vector<StartupPhase> StartupProfile::phases() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_phases;
+}
+
+std::string StartupProfile::report() const
+{
+    std::lock_guard lock(m_mutex);
+
+    std::string text { std::format("  {:<32} {:>10} {:>10}\n", "phase", "start ms", "ms") };
+    for (const StartupPhase& phase : m_phases) {
+        text += std::format("  {:<32} {:>10.1f} {:>10.1f}{}\n", phase.m_name, phase.m_begin_ms, phase.m_duration_ms,
+                            phase.m_background ? "  (background)" : "");
+    }
+
+    if (m_interactive_ms >= 0.0) {
+        text += std::format("  interactive after {:.1f} ms", m_interactive_ms);
+    } else {
+        text += "  not interactive yet";
+    }
+    return text;
+}
+
+ScopedStartupPhase::ScopedStartupPhase(const char* name) noexcept
+    : m_name(name)
+    , m_begin_ns(Tracer::instance().now())
+{
+}
+
+ScopedStartupPhase::~ScopedStartupPhase()
+{
+    StartupProfile::instance().record(m_name, m_begin_ns, Tracer::instance().now());
+}
+
+} // namespace CaptureMoment::Core::Common::Trace
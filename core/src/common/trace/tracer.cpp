@@ -0,0 +1,246 @@
+/**
+ * @file tracer.cpp
+ * @brief Implementation of Tracer.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace CaptureMoment::Core::Common::Trace {
+
+namespace {
+
+[[nodiscard]] std::int64_t steadyNowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Writes a JSON string literal (names are literals, escaping covers the general case).
+ */
+void writeJsonString(std::ostream& out, std::string_view text)
+{
+    out << '"';
+    for (const char c : text) {
+        switch (c) {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << std::format("\\u{:04x}", static_cast<unsigned>(c));
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+/**
+ * @brief Writes the hardware counters of an event, with its IPC and estimated DRAM bandwidth.
+ */
+void writeCounterArgs(std::ostream& out, const CounterSample& counters, std::int64_t duration_ns)
+{
+    const double ipc { counters.m_cycles > 0
+                           ? static_cast<double>(counters.m_instructions) / static_cast<double>(counters.m_cycles)
+                           : 0.0 };
+    // Bytes per nanosecond are GB/s
+    const double dram_gbps { duration_ns > 0 ? static_cast<double>(counters.m_llc_misses * PerfCounters::k_cache_line_bytes)
+                                                   / static_cast<double>(duration_ns)
+                                             : 0.0 };
+    out << std::format(",\"args\":{{\"cycles\":{},\"instructions\":{},\"ipc\":{:.3f},\"llc_misses\":{},"
+                       "\"dram_gbps_est\":{:.3f}}}",
+                       counters.m_cycles, counters.m_instructions, ipc, counters.m_llc_misses, dram_gbps);
+}
+
+} // anonymous namespace
+
+Tracer& Tracer::instance()
+{
+    // Intentionally leaked: scopes may close in static destructors and at-exit dumps
+    static Tracer* tracer = new Tracer();
+    return *tracer;
+}
+
+Tracer::Tracer()
+    : m_origin_ns(steadyNowNs())
+{
+}
+
+std::int64_t Tracer::now() const noexcept
+{
+    return steadyNowNs() - m_origin_ns;
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer()
+{
+    // The registry keeps a reference, so the events outlive the thread
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [this] {
+        auto created { std::make_shared<ThreadBuffer>() };
+        std::lock_guard lock(m_mutex);
+        created->m_thread_id = static_cast<std::uint32_t>(m_buffers.size() + 1);
+        m_buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void Tracer::record(const char* category, const char* name, std::int64_t begin_ns, std::int64_t end_ns,
+                    const CounterSample& counters) noexcept
+{
+    ThreadBuffer& buffer { threadBuffer() };
+
+    const std::uint64_t index { buffer.m_head.load(std::memory_order_relaxed) };
+    Event& event { buffer.m_events[index % k_events_per_thread] };
+    event.m_category.store(category, std::memory_order_relaxed);
+    event.m_name.store(name, std::memory_order_relaxed);
+    event.m_begin_ns.store(begin_ns, std::memory_order_relaxed);
+    event.m_end_ns.store(end_ns, std::memory_order_relaxed);
+    event.m_cycles.store(counters.m_cycles, std::memory_order_relaxed);
+    event.m_instructions.store(counters.m_instructions, std::memory_order_relaxed);
+    event.m_llc_misses.store(counters.m_llc_misses, std::memory_order_relaxed);
+    buffer.m_head.store(index + 1, std::memory_order_release);
+}
+
+const char* Tracer::intern(std::string_view name)
+{
+    std::lock_guard lock(m_mutex);
+    return m_interned.emplace(name).first->c_str();
+}
+
+void Tracer::setCurrentThreadName(std::string name)
+{
+    ThreadBuffer& buffer { threadBuffer() };
+    std::lock_guard lock(m_mutex);
+    buffer.m_name = std::move(name);
+}
+
+std::vector<std::shared_ptr<Tracer::ThreadBuffer>> Tracer::buffers() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_buffers;
+}
+
+void Tracer::clear() noexcept
+{
+    std::lock_guard lock(m_mutex);
+    for (const auto& buffer : m_buffers) {
+        buffer->m_cleared.store(buffer->m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
+
+std::size_t Tracer::eventCount() const
+{
+    std::size_t count { 0 };
+    for (const auto& buffer : buffers()) {
+        const std::uint64_t head { buffer->m_head.load(std::memory_order_acquire) };
+        const std::uint64_t first { std::max(buffer->m_cleared.load(std::memory_order_relaxed),
+                                             head > k_events_per_thread ? head - k_events_per_thread : 0) };
+        count += static_cast<std::size_t>(head - first);
+    }
+    return count;
+}
+
+std::expected<void, ErrorHandling::CoreError> Tracer::writeChromeTrace(const std::filesystem::path& path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        spdlog::error("[Tracer::writeChromeTrace]: Cannot open '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    struct CopiedEvent {
+        const char* m_category;
+        const char* m_name;
+        std::int64_t m_begin_ns;
+        std::int64_t m_end_ns;
+        CounterSample m_counters;
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first_entry { true };
+    std::size_t written { 0 };
+
+    const auto separator = [&] {
+        if (!first_entry) {
+            out << ",\n";
+        }
+        first_entry = false;
+    };
+
+    std::vector<CopiedEvent> copied;
+    for (const auto& buffer : buffers())
+    {
+        std::string thread_name;
+        {
+            std::lock_guard lock(m_mutex);
+            thread_name = buffer->m_name.empty() ? std::format("thread {}", buffer->m_thread_id) : buffer->m_name;
+        }
+
+        separator();
+        out << std::format("{{\"ph\":\"M\",\"pid\":1,\"tid\":{},\"name\":\"thread_name\",\"args\":{{\"name\":", buffer->m_thread_id);
+        writeJsonString(out, thread_name);
+        out << "}}";
+
+        // Copy, then keep only the events the owner did not overwrite meanwhile
+        const std::uint64_t head { buffer->m_head.load(std::memory_order_acquire) };
+        const std::uint64_t first { std::max(buffer->m_cleared.load(std::memory_order_relaxed),
+                                             head > k_events_per_thread ? head - k_events_per_thread : 0) };
+
+        copied.clear();
+        for (std::uint64_t index = first; index < head; ++index) {
+            const Event& event { buffer->m_events[index % k_events_per_thread] };
+            copied.push_back({ event.m_category.load(std::memory_order_relaxed), event.m_name.load(std::memory_order_relaxed),
+                               event.m_begin_ns.load(std::memory_order_relaxed), event.m_end_ns.load(std::memory_order_relaxed),
+                               { event.m_cycles.load(std::memory_order_relaxed), event.m_instructions.load(std::memory_order_relaxed),
+                                 event.m_llc_misses.load(std::memory_order_relaxed) } });
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t head_after { buffer->m_head.load(std::memory_order_relaxed) };
+        // The write of event `head_after` may be in progress: it reuses the slot of `head_after - N`
+        const std::uint64_t stable_from { head_after + 1 > k_events_per_thread ? head_after + 1 - k_events_per_thread : 0 };
+
+        for (std::uint64_t index = first; index < head; ++index) {
+            const CopiedEvent& event { copied[index - first] };
+            if (index < stable_from || !event.m_name) {
+                continue;
+            }
+
+            separator();
+            out << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->m_thread_id << ",\"cat\":";
+            writeJsonString(out, event.m_category ? event.m_category : "");
+            out << ",\"name\":";
+            writeJsonString(out, event.m_name);
+            out << std::format(",\"ts\":{:.3f},\"dur\":{:.3f}", static_cast<double>(event.m_begin_ns) / 1000.0,
+                               static_cast<double>(event.m_end_ns - event.m_begin_ns) / 1000.0);
+            if (!event.m_counters.isEmpty()) {
+                writeCounterArgs(out, event.m_counters, event.m_end_ns - event.m_begin_ns);
+            }
+            out << '}';
+            ++written;
+        }
+    }
+
+    out << "]}\n";
+    if (!out) {
+        spdlog::error("[Tracer::writeChromeTrace]: Write to '{}' failed", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::info("[Tracer::writeChromeTrace]: {} events written to '{}'", written, path.string());
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Common::Trace
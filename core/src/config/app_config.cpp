@@ -6,8 +6,18 @@
  */
 
 #include "config/app_config.h"
+#include "common/memory/memory_budget.h"
+#include "workers/compute_pool.h"
+#include <OpenImageIO/imageio.h>
+#include <magic_enum/magic_enum.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
 namespace CaptureMoment::Core::Config {
 
 // ============================================================
@@ -16,6 +26,11 @@ namespace CaptureMoment::Core::Config {
 
 
 Halide::Target AppConfig::s_halide_target = Halide::get_host_target();
+Halide::Target AppConfig::s_cpu_halide_target = Halide::get_host_target();
+std::optional<Halide::Target> AppConfig::s_gpu_halide_target;
+ImageProcessing::GpuTileSchedule AppConfig::s_gpu_tile_schedule;
+std::shared_mutex AppConfig::s_target_mutex;
+std::atomic<std::uint64_t> AppConfig::s_target_generation{0};
 
 // ============================================================
 // Singleton Instance
@@ -34,9 +49,8 @@ AppConfig& AppConfig::instance()
 
 void AppConfig::setProcessingBackend(Common::MemoryType backend)
 {
-    if (m_processing_backend != backend)
+    if (m_processing_backend.exchange(backend, std::memory_order_relaxed) != backend)
     {
-        m_processing_backend = backend;
 
         const auto backend_str = (backend == Common::MemoryType::CPU_RAM)
                                      ? "CPU_RAM"
@@ -48,7 +62,27 @@ void AppConfig::setProcessingBackend(Common::MemoryType backend)
 
 Common::MemoryType AppConfig::getProcessingBackend() const noexcept
 {
-    return m_processing_backend;
+    return m_processing_backend.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setBackendOverride(std::optional<Common::MemoryType> backend)
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_backend_override = backend;
+    }
+
+    if (!backend) {
+        spdlog::info("[AppConfig] Backend selected per image.");
+    } else {
+        spdlog::info("[AppConfig] Backend forced to {}.", *backend == Common::MemoryType::CPU_RAM ? "CPU_RAM" : "GPU_MEMORY");
+    }
+}
+
+std::optional<Common::MemoryType> AppConfig::getBackendOverride() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_backend_override;
 }
 
 // ============================================================
@@ -57,8 +91,16 @@ Common::MemoryType AppConfig::getProcessingBackend() const noexcept
 
 void AppConfig::setHalideTarget(const Halide::Target& target)
 {
-    // Update the global static target
-    s_halide_target = target;
+    {
+        // Update the global static target
+        std::unique_lock lock(s_target_mutex);
+        s_halide_target = target;
+
+        if (target.has_gpu_feature()) {
+            s_gpu_halide_target = target;
+        }
+        s_target_generation.fetch_add(1, std::memory_order_release);
+    }
 
     // Log the specific features configured in this target (helpful for debugging)
     std::string features_str;
@@ -72,11 +114,590 @@ void AppConfig::setHalideTarget(const Halide::Target& target)
                  target.to_string(), features_str);
 }
 
-const Halide::Target& AppConfig::getHalideTarget()
+Halide::Target AppConfig::getHalideTarget()
 {
+    std::shared_lock lock(s_target_mutex);
     return s_halide_target;
 }
 
+void AppConfig::setGpuHalideTarget(const Halide::Target& target)
+{
+    {
+        std::unique_lock lock(s_target_mutex);
+        s_gpu_halide_target = target;
+        s_target_generation.fetch_add(1, std::memory_order_release);
+    }
+    spdlog::info("[AppConfig] GPU Halide Target set: {}", target.to_string());
+}
+
+Halide::Target AppConfig::getHalideTarget(Common::MemoryType backend)
+{
+    std::shared_lock lock(s_target_mutex);
+    if (backend == Common::MemoryType::CPU_RAM) {
+        return s_cpu_halide_target;
+    }
+    if (s_gpu_halide_target) {
+        return *s_gpu_halide_target;
+    }
+    return s_halide_target;
+}
+
+std::uint64_t AppConfig::targetGeneration() noexcept
+{
+    return s_target_generation.load(std::memory_order_acquire);
+}
+
+bool AppConfig::hasGpuHalideTarget() noexcept
+{
+    std::shared_lock lock(s_target_mutex);
+    return s_gpu_halide_target.has_value();
+}
+
+void AppConfig::setGpuTileSchedule(const ImageProcessing::GpuTileSchedule& schedule)
+{
+    if (!schedule.isValid()) {
+        spdlog::warn("[AppConfig] Ignoring invalid GPU tile {}x{} (vector {}).",
+                     schedule.m_tile_width, schedule.m_tile_height, schedule.m_vector_width);
+        return;
+    }
+    {
+        std::unique_lock lock(s_target_mutex);
+        if (s_gpu_tile_schedule == schedule) {
+            return;
+        }
+        s_gpu_tile_schedule = schedule;
+        s_target_generation.fetch_add(1, std::memory_order_release);
+    }
+    spdlog::info("[AppConfig] GPU tile: {}x{}, vector {}.", schedule.m_tile_width, schedule.m_tile_height,
+                 schedule.m_vector_width);
+}
+
+ImageProcessing::GpuTileSchedule AppConfig::getGpuTileSchedule()
+{
+    std::shared_lock lock(s_target_mutex);
+    return s_gpu_tile_schedule;
+}
+
+void AppConfig::setCpuTargetMode(ImageProcessing::CpuTargetMode mode)
+{
+    m_cpu_target_mode = mode;
+
+    const Halide::Target cpu_target { ImageProcessing::CpuTarget::select(mode) };
+    {
+        std::unique_lock lock(s_target_mutex);
+        s_cpu_halide_target = cpu_target;
+        if (!s_halide_target.has_gpu_feature()) {
+            s_halide_target = cpu_target;
+        }
+        s_target_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    spdlog::info("[AppConfig] CPU target: {} ({}).", ImageProcessing::CpuTarget::modeName(mode),
+                 ImageProcessing::CpuTarget::describeFeatures(cpu_target));
+}
+
+ImageProcessing::CpuTargetMode AppConfig::getCpuTargetMode() const noexcept
+{
+    return m_cpu_target_mode.load(std::memory_order_relaxed);
+}
+
+// ============================================================
+// Per-image Backend Selection
+// ============================================================
+
+void AppConfig::setBackendCostModel(std::optional<ImageProcessing::BackendCostModel> model)
+{
+    const bool enabled { model.has_value() };
+    {
+        std::unique_lock lock(m_mutex);
+        m_backend_cost_model = std::move(model);
+    }
+    spdlog::info("[AppConfig] Per-image backend selection {}.", enabled ? "enabled" : "disabled");
+}
+
+std::optional<ImageProcessing::BackendCostModel> AppConfig::getBackendCostModel() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_backend_cost_model;
+}
+
+// ============================================================
+// Working Image Storage
+// ============================================================
+
+void AppConfig::setWorkingPixelFormat(Common::PixelFormat format)
+{
+    if (format != Common::PixelFormat::RGBA_F32 && format != Common::PixelFormat::RGBA_F16) {
+        spdlog::warn("[AppConfig] Unsupported working pixel format, keeping the current one.");
+        return;
+    }
+
+    m_working_pixel_format.store(format, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] Working images stored as {}.",
+                 format == Common::PixelFormat::RGBA_F16 ? "RGBA_F16" : "RGBA_F32");
+}
+
+Common::PixelFormat AppConfig::getWorkingPixelFormat() const noexcept
+{
+    return m_working_pixel_format.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setWorkingPixelLayout(Common::PixelLayout layout)
+{
+    m_working_pixel_layout.store(layout, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] CPU working images stored {}.",
+                 layout == Common::PixelLayout::Planar ? "planar" : "interleaved");
+}
+
+Common::PixelLayout AppConfig::getWorkingPixelLayout() const noexcept
+{
+    return m_working_pixel_layout.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setCpuSchedule(Pipeline::CpuSchedule schedule)
+{
+    m_cpu_schedule.store(schedule, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] CPU pipelines scheduled in {}.",
+                 schedule == Pipeline::CpuSchedule::Tiles ? "2D tiles" : "row strips");
+}
+
+Pipeline::CpuSchedule AppConfig::getCpuSchedule() const noexcept
+{
+    return m_cpu_schedule.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setCpuTileSize(int size) noexcept
+{
+    const int clamped { std::clamp(size, 16, 2048) };
+    m_cpu_tile_size.store(clamped, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] CPU tiles of {}x{} pixels.", clamped, clamped);
+}
+
+int AppConfig::getCpuTileSize() const noexcept
+{
+    return m_cpu_tile_size.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setSchedulingStrategy(Pipeline::SchedulingStrategy strategy)
+{
+    m_scheduling_strategy.store(strategy, std::memory_order_relaxed);
+
+    const auto strategy_str = strategy == Pipeline::SchedulingStrategy::Manual ? "manual"
+        : strategy == Pipeline::SchedulingStrategy::AutoscheduleJit ? "autoscheduled at JIT time"
+        : "autoscheduled and exported";
+    spdlog::info("[AppConfig] Fused pipelines {}.", strategy_str);
+}
+
+Pipeline::SchedulingStrategy AppConfig::getSchedulingStrategy() const noexcept
+{
+    return m_scheduling_strategy.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setScheduleDirectory(std::filesystem::path directory)
+{
+    spdlog::info("[AppConfig] Schedules exported to '{}'.", directory.string());
+    std::unique_lock lock(m_mutex);
+    m_schedule_directory = std::move(directory);
+}
+
+std::filesystem::path AppConfig::getScheduleDirectory() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_schedule_directory;
+}
+
+void AppConfig::setRawLoadMode(ImageConfig::Raw::RawLoadMode mode) noexcept
+{
+    m_raw_load_mode.store(mode, std::memory_order_relaxed);
+    const auto mode_str = mode == ImageConfig::Raw::RawLoadMode::embedded_preview_first ? "the embedded preview"
+        : mode == ImageConfig::Raw::RawLoadMode::draft_first ? "a draft demosaic"
+        : "the full demosaic";
+    spdlog::info("[AppConfig] RAW loads show {} first.", mode_str);
+}
+
+ImageConfig::Raw::RawLoadMode AppConfig::getRawLoadMode() const noexcept
+{
+    return m_raw_load_mode.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setRawDemosaicEngine(ImageConfig::Raw::RawDemosaicEngine engine) noexcept
+{
+    m_raw_demosaic_engine.store(engine, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] RAW files demosaiced by {}.",
+                 engine == ImageConfig::Raw::RawDemosaicEngine::halide ? "the Halide engine" : "LibRaw");
+}
+
+ImageConfig::Raw::RawDemosaicEngine AppConfig::getRawDemosaicEngine() const noexcept
+{
+    return m_raw_demosaic_engine.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setSourceTileCacheSizeMB(float size_mb) noexcept
+{
+    const float clamped_mb { std::max(size_mb, 64.0f) };
+    m_source_tile_cache_size_mb.store(clamped_mb, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] Source tile cache: {} MB.", clamped_mb);
+}
+
+float AppConfig::getSourceTileCacheSizeMB() const noexcept
+{
+    return m_source_tile_cache_size_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setTiledSourceMinPixels(std::uint64_t min_pixels) noexcept
+{
+    m_tiled_source_min_pixels.store(min_pixels, std::memory_order_relaxed);
+    if (min_pixels == 0) {
+        spdlog::info("[AppConfig] Tile-backed sources disabled.");
+    } else {
+        spdlog::info("[AppConfig] Images of {} pixels or more are opened tile-backed.", min_pixels);
+    }
+}
+
+std::uint64_t AppConfig::getTiledSourceMinPixels() const noexcept
+{
+    return m_tiled_source_min_pixels.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setProxyMaxLongEdge(Common::ImageDim long_edge) noexcept
+{
+    m_proxy_max_long_edge.store(long_edge, std::memory_order_relaxed);
+    if (long_edge == 0) {
+        spdlog::info("[AppConfig] Preview proxy sized to the display.");
+    } else {
+        spdlog::info("[AppConfig] Preview proxy long edge bounded to {} pixels.", long_edge);
+    }
+}
+
+Common::ImageDim AppConfig::getProxyMaxLongEdge() const noexcept
+{
+    return m_proxy_max_long_edge.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setGuidedPreviewUpsampling(bool enabled) noexcept
+{
+    m_guided_preview_upsampling.store(enabled, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] Reduced-resolution previews of detail gestures {}.", enabled ? "enabled" : "disabled");
+}
+
+bool AppConfig::isGuidedPreviewUpsamplingEnabled() const noexcept
+{
+    return m_guided_preview_upsampling.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setJpegPreviewLongEdge(Common::ImageDim long_edge) noexcept
+{
+    m_jpeg_preview_long_edge.store(long_edge, std::memory_order_relaxed);
+    if (long_edge == 0) {
+        spdlog::info("[AppConfig] JPEG files decoded at full resolution on load.");
+    } else {
+        spdlog::info("[AppConfig] Large JPEG files show a scaled decode of at least {} pixels first.", long_edge);
+    }
+}
+
+Common::ImageDim AppConfig::getJpegPreviewLongEdge() const noexcept
+{
+    return m_jpeg_preview_long_edge.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setNetworkReadAheadMaxMB(std::uint64_t size_mb) noexcept
+{
+    m_network_read_ahead_max_mb.store(size_mb, std::memory_order_relaxed);
+    if (size_mb == 0) {
+        spdlog::info("[AppConfig] Network files decoded in place.");
+    } else {
+        spdlog::info("[AppConfig] Network files up to {} MB read whole before decoding.", size_mb);
+    }
+}
+
+std::uint64_t AppConfig::getNetworkReadAheadMaxMB() const noexcept
+{
+    return m_network_read_ahead_max_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setDecodedDiskCacheDirectory(std::filesystem::path directory)
+{
+    spdlog::info("[AppConfig] Decoded RAW files cached in '{}'.", directory.string());
+    std::unique_lock lock(m_mutex);
+    m_decoded_disk_cache_directory = std::move(directory);
+}
+
+std::filesystem::path AppConfig::getDecodedDiskCacheDirectory() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_decoded_disk_cache_directory;
+}
+
+void AppConfig::setDecodedDiskCacheSizeMB(std::uint64_t size_mb) noexcept
+{
+    m_decoded_disk_cache_size_mb.store(size_mb, std::memory_order_relaxed);
+    if (size_mb == 0) {
+        spdlog::info("[AppConfig] Decoded RAW disk cache disabled.");
+    } else {
+        spdlog::info("[AppConfig] Decoded RAW disk cache: {} MB.", size_mb);
+    }
+}
+
+std::uint64_t AppConfig::getDecodedDiskCacheSizeMB() const noexcept
+{
+    return m_decoded_disk_cache_size_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setResultDiskCacheDirectory(std::filesystem::path directory)
+{
+    spdlog::info("[AppConfig] Rendered edit states cached in '{}'.", directory.string());
+    std::unique_lock lock(m_mutex);
+    m_result_disk_cache_directory = std::move(directory);
+}
+
+std::filesystem::path AppConfig::getResultDiskCacheDirectory() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_result_disk_cache_directory;
+}
+
+void AppConfig::setResultDiskCacheSizeMB(std::uint64_t size_mb) noexcept
+{
+    m_result_disk_cache_size_mb.store(size_mb, std::memory_order_relaxed);
+    if (size_mb == 0) {
+        spdlog::info("[AppConfig] Rendered-state disk cache disabled.");
+    } else {
+        spdlog::info("[AppConfig] Rendered-state disk cache: {} MB.", size_mb);
+    }
+}
+
+std::uint64_t AppConfig::getResultDiskCacheSizeMB() const noexcept
+{
+    return m_result_disk_cache_size_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setPipelineDiskCacheDirectory(std::filesystem::path directory)
+{
+    spdlog::info("[AppConfig] Compiled pipelines cached in '{}'.", directory.string());
+    std::unique_lock lock(m_mutex);
+    m_pipeline_disk_cache_directory = std::move(directory);
+}
+
+std::filesystem::path AppConfig::getPipelineDiskCacheDirectory() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_pipeline_disk_cache_directory;
+}
+
+void AppConfig::setPipelineDiskCacheSizeMB(std::uint64_t size_mb) noexcept
+{
+    m_pipeline_disk_cache_size_mb.store(size_mb, std::memory_order_relaxed);
+    if (size_mb == 0) {
+        spdlog::info("[AppConfig] Compiled-pipeline disk cache disabled.");
+    } else {
+        spdlog::info("[AppConfig] Compiled-pipeline disk cache: {} MB.", size_mb);
+    }
+}
+
+std::uint64_t AppConfig::getPipelineDiskCacheSizeMB() const noexcept
+{
+    return m_pipeline_disk_cache_size_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setPipelineCacheCapacity(std::size_t capacity) noexcept
+{
+    m_pipeline_cache_capacity.store(capacity, std::memory_order_relaxed);
+    if (capacity == 0) {
+        spdlog::info("[AppConfig] Compiled pipelines kept in memory: default.");
+    } else {
+        spdlog::info("[AppConfig] Compiled pipelines kept in memory: {} per executor.", capacity);
+    }
+}
+
+std::size_t AppConfig::getPipelineCacheCapacity() const noexcept
+{
+    return m_pipeline_cache_capacity.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setSmartPreviewDirectory(std::filesystem::path directory)
+{
+    if (directory.empty()) {
+        spdlog::info("[AppConfig] Smart previews disabled.");
+    } else {
+        spdlog::info("[AppConfig] Smart previews stored in '{}'.", directory.string());
+    }
+    std::unique_lock lock(m_mutex);
+    m_smart_preview_directory = std::move(directory);
+}
+
+std::filesystem::path AppConfig::getSmartPreviewDirectory() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_smart_preview_directory;
+}
+
+void AppConfig::setSmartPreviewPolicy(SmartPreviewPolicy policy) noexcept
+{
+    m_smart_preview_policy.store(policy, std::memory_order_relaxed);
+    const auto policy_str = policy == SmartPreviewPolicy::Always ? "whenever one exists"
+        : policy == SmartPreviewPolicy::WhenOffline ? "when the original is offline"
+        : "never";
+    spdlog::info("[AppConfig] Loads edit smart previews {}.", policy_str);
+}
+
+SmartPreviewPolicy AppConfig::getSmartPreviewPolicy() const noexcept
+{
+    return m_smart_preview_policy.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setThumbnailCachePath(std::filesystem::path path)
+{
+    spdlog::info("[AppConfig] Thumbnails cached in '{}'.", path.string());
+    std::unique_lock lock(m_mutex);
+    m_thumbnail_cache_path = std::move(path);
+}
+
+std::filesystem::path AppConfig::getThumbnailCachePath() const
+{
+    std::shared_lock lock(m_mutex);
+    return m_thumbnail_cache_path;
+}
+
+void AppConfig::setThumbnailCacheSizeMB(std::uint64_t size_mb) noexcept
+{
+    m_thumbnail_cache_size_mb.store(size_mb, std::memory_order_relaxed);
+    if (size_mb == 0) {
+        spdlog::info("[AppConfig] Thumbnail cache disabled.");
+    } else {
+        spdlog::info("[AppConfig] Thumbnail cache: {} MB.", size_mb);
+    }
+}
+
+std::uint64_t AppConfig::getThumbnailCacheSizeMB() const noexcept
+{
+    return m_thumbnail_cache_size_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setMemoryBudgetMB(std::uint64_t size_mb)
+{
+    m_memory_budget_mb.store(size_mb, std::memory_order_relaxed);
+    Common::MemoryBudget::instance().setCeilingBytes(static_cast<std::size_t>(size_mb) << 20);
+}
+
+std::uint64_t AppConfig::getMemoryBudgetMB() const noexcept
+{
+    return m_memory_budget_mb.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setHugePages(Common::BufferPool::HugePages mode)
+{
+    m_huge_pages.store(mode, std::memory_order_relaxed);
+    Common::BufferPool::instance().setHugePages(mode);
+    spdlog::info("[AppConfig] Huge pages for the large image buffers: {}.", magic_enum::enum_name(mode));
+}
+
+Common::BufferPool::HugePages AppConfig::getHugePages() const noexcept
+{
+    return m_huge_pages.load(std::memory_order_relaxed);
+}
+
+void AppConfig::setConcurrencyBudget(std::size_t threads)
+{
+    m_concurrency_request.store(threads, std::memory_order_relaxed);
+    applyConcurrencyBudget();
+}
+
+void AppConfig::applyConcurrencyBudget()
+{
+    double fraction { 1.0 };
+    {
+        std::shared_lock lock(m_mutex);
+        fraction = m_energy_plan.m_thread_fraction;
+    }
+
+    std::size_t threads { m_concurrency_request.load(std::memory_order_relaxed) };
+    if (fraction < 1.0) {
+        const std::size_t budget { threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency()) };
+        threads = std::max<std::size_t>(1, static_cast<std::size_t>(std::lround(static_cast<double>(budget) * fraction)));
+    }
+
+    auto& pool = Workers::ComputePool::instance();
+    pool.setConcurrency(threads);
+
+    // OIIO's pool (tile cache, format conversions) shares the same cores
+    OIIO::attribute("threads", static_cast<int>(pool.concurrency()));
+    spdlog::info("[AppConfig] Concurrency budget: {} threads.", pool.concurrency());
+}
+
+std::size_t AppConfig::getConcurrencyBudget() const noexcept
+{
+    return Workers::ComputePool::instance().concurrency();
+}
+
+void AppConfig::setPriorityConcurrencyCap(Workers::TaskPriority priority, std::size_t threads)
+{
+    Workers::ComputePool::instance().setLaneCap(priority, threads);
+}
+
+std::size_t AppConfig::getPriorityConcurrencyCap(Workers::TaskPriority priority) const
+{
+    return Workers::ComputePool::instance().laneCap(priority);
+}
+
+void AppConfig::setNumaPinning(bool enabled)
+{
+    Workers::ComputePool::instance().setNodePinning(enabled);
+}
+
+bool AppConfig::isNumaPinningEnabled() const noexcept
+{
+    return Workers::ComputePool::instance().nodePinning();
+}
+
+void AppConfig::setEnergyPolicy(EnergyPolicy policy)
+{
+    m_energy_policy.store(policy, std::memory_order_relaxed);
+    spdlog::info("[AppConfig] Energy policy: {}.", EnergyPlan::policyName(policy));
+    refreshEnergyPlan();
+}
+
+EnergyPolicy AppConfig::getEnergyPolicy() const noexcept
+{
+    return m_energy_policy.load(std::memory_order_relaxed);
+}
+
+EnergyPlan AppConfig::currentEnergyPlan()
+{
+    const std::int64_t now_ms { std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count() };
+
+    // One caller probes per interval; the others read the plan it leaves
+    std::int64_t probed_at_ms { m_power_probed_at_ms.load(std::memory_order_relaxed) };
+    if (getEnergyPolicy() != EnergyPolicy::Performance && now_ms - probed_at_ms >= k_power_probe_interval_ms
+        && m_power_probed_at_ms.compare_exchange_strong(probed_at_ms, now_ms, std::memory_order_relaxed)) {
+        refreshEnergyPlan();
+    }
+
+    std::shared_lock lock(m_mutex);
+    return m_energy_plan;
+}
+
+void AppConfig::refreshEnergyPlan()
+{
+    const EnergyPolicy policy { getEnergyPolicy() };
+    const PowerState state { policy == EnergyPolicy::Performance ? PowerState{} : PowerState::probe() };
+    const EnergyPlan plan { EnergyPlan::resolve(policy, state) };
+
+    {
+        std::unique_lock lock(m_mutex);
+        if (plan == m_energy_plan) {
+            return;
+        }
+        m_energy_plan = plan;
+    }
+
+    spdlog::info("[AppConfig] Energy plan ({}, {}, thermal {}): GPU {}, {:.0f}% of the threads, proxy scale {:.2f}.",
+                 EnergyPlan::policyName(policy), state.m_on_battery ? "battery" : "mains",
+                 magic_enum::enum_name(state.m_thermal), plan.m_allow_gpu ? "allowed" : "off",
+                 plan.m_thread_fraction * 100.0, plan.m_proxy_scale);
+    applyConcurrencyBudget();
+}
+
 // ============================================================
 // Testing Utilities
 // ============================================================
@@ -90,7 +711,59 @@ void AppConfig::reset()
     m_processing_backend = Common::MemoryType::CPU_RAM;
 
     // Reset target to default host (removes GPU features)
-    s_halide_target = Halide::get_host_target();
+    {
+        std::unique_lock lock(s_target_mutex);
+        s_halide_target = Halide::get_host_target();
+        s_cpu_halide_target = Halide::get_host_target();
+        s_gpu_halide_target.reset();
+        s_target_generation.fetch_add(1, std::memory_order_release);
+    }
+    m_cpu_target_mode = ImageProcessing::CpuTargetMode::Native;
+    m_cpu_tile_size = k_default_cpu_tile_size;
+    m_proxy_max_long_edge = 0;
+    m_guided_preview_upsampling = true;
+    m_jpeg_preview_long_edge = 2048;
+    m_network_read_ahead_max_mb = 1024;
+    m_pipeline_cache_capacity = 0;
+
+    std::unique_lock lock(m_mutex);
+    m_backend_cost_model.reset();
+    m_backend_override.reset();
+    m_working_pixel_format = Common::PixelFormat::RGBA_F32;
+    m_working_pixel_layout = Common::PixelLayout::Interleaved;
+    m_cpu_schedule = Pipeline::CpuSchedule::Strips;
+    m_scheduling_strategy = Pipeline::SchedulingStrategy::Manual;
+    m_schedule_directory = "halide_schedules";
+    m_raw_load_mode = ImageConfig::Raw::RawLoadMode::draft_first;
+    m_raw_demosaic_engine = ImageConfig::Raw::RawDemosaicEngine::libraw;
+    m_source_tile_cache_size_mb = 2048.0f;
+    m_tiled_source_min_pixels = 100'000'000;
+    m_decoded_disk_cache_directory.clear();
+    m_decoded_disk_cache_size_mb = 8192;
+    m_result_disk_cache_directory.clear();
+    m_result_disk_cache_size_mb = 512;
+    m_pipeline_disk_cache_directory.clear();
+    m_pipeline_disk_cache_size_mb = 256;
+    m_smart_preview_directory.clear();
+    m_smart_preview_policy = SmartPreviewPolicy::WhenOffline;
+    m_thumbnail_cache_path.clear();
+    m_thumbnail_cache_size_mb = 1024;
+    m_memory_budget_mb = 0;
+    Common::MemoryBudget::instance().setCeilingBytes(0);
+    m_huge_pages = Common::BufferPool::HugePages::Off;
+    Common::BufferPool::instance().setHugePages(Common::BufferPool::HugePages::Off);
+    m_concurrency_request = 0;
+    m_energy_policy = EnergyPolicy::Balanced;
+    m_energy_plan = EnergyPlan{};
+    m_power_probed_at_ms = 0;
+
+    auto& pool = Workers::ComputePool::instance();
+    pool.setConcurrency(0);
+    pool.setNodePinning(false);
+    pool.setLaneCap(Workers::TaskPriority::Interactive, 0);
+    pool.setLaneCap(Workers::TaskPriority::Refine, 0);
+    pool.setLaneCap(Workers::TaskPriority::Export, 0);
+    pool.setLaneCap(Workers::TaskPriority::Thumbnail, Workers::ComputePool::k_default_thumbnail_cap);
 }
 #endif
 
@@ -0,0 +1,193 @@
+/**
+ * @file energy_policy.cpp
+ * @brief Implementation of PowerState and EnergyPlan.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "config/energy_policy.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace CaptureMoment::Core::Config {
+
+namespace {
+
+/**
+ * @brief Thread share kept when the machine runs hot.
+ */
+constexpr double k_elevated_thread_fraction { 0.75 };
+
+/**
+ * @brief Proxy scale halving the pixels (one level of `AdaptivePreviewQuality`).
+ */
+constexpr double k_half_pixels_scale { 0.7071 };
+
+#if defined(__linux__)
+
+/**
+ * @brief First line of a sysfs attribute, without its newline (empty if unreadable).
+ */
+[[nodiscard]] std::string readAttribute(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+/**
+ * @brief Integer value of a sysfs attribute.
+ */
+[[nodiscard]] std::optional<long long> readInteger(const std::filesystem::path& path)
+{
+    const std::string text { readAttribute(path) };
+    long long value { 0 };
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc{} || end == text.data()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/**
+ * @brief true if a battery discharges (`/sys/class/power_supply`).
+ */
+[[nodiscard]] bool probeOnBattery()
+{
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/class/power_supply", ec)) {
+        if (readAttribute(entry.path() / "type") == "Battery"
+            && readAttribute(entry.path() / "status") == "Discharging") {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Hottest state of the thermal zones (`/sys/class/thermal`), relative to their
+ *        first throttling trip point ("passive" or "hot").
+ */
+[[nodiscard]] ThermalState probeThermal()
+{
+    ThermalState hottest { ThermalState::Nominal };
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/class/thermal", ec)) {
+        if (!entry.path().filename().string().starts_with("thermal_zone")) {
+            continue;
+        }
+        const auto temperature { readInteger(entry.path() / "temp") };
+        if (!temperature) {
+            continue;
+        }
+
+        std::optional<long long> trip;
+        for (int index { 0 };; ++index) {
+            const std::string prefix { "trip_point_" + std::to_string(index) };
+            const std::string type { readAttribute(entry.path() / (prefix + "_type")) };
+            if (type.empty()) {
+                break;
+            }
+            const auto trip_temperature { readInteger(entry.path() / (prefix + "_temp")) };
+            // Disabled trip points read 0 or less
+            if ((type == "passive" || type == "hot") && trip_temperature && *trip_temperature > 0) {
+                trip = std::min(trip.value_or(*trip_temperature), *trip_temperature);
+            }
+        }
+        if (!trip) {
+            continue;
+        }
+
+        if (*temperature >= *trip) {
+            return ThermalState::Critical;
+        }
+        if (*temperature >= *trip - PowerState::k_elevated_margin_millicelsius) {
+            hottest = ThermalState::Elevated;
+        }
+    }
+    return hottest;
+}
+
+#endif
+
+} // anonymous namespace
+
+PowerState PowerState::probe()
+{
+    PowerState state;
+#if defined(__linux__)
+    state.m_on_battery = probeOnBattery();
+    state.m_thermal = probeThermal();
+#elif defined(_WIN32)
+    if (SYSTEM_POWER_STATUS status; GetSystemPowerStatus(&status)) {
+        state.m_on_battery = status.ACLineStatus == 0;
+    }
+#endif
+    return state;
+}
+
+EnergyPlan EnergyPlan::resolve(EnergyPolicy policy, const PowerState& state) noexcept
+{
+    EnergyPlan plan;
+    if (policy == EnergyPolicy::Performance) {
+        return plan;
+    }
+
+    if (policy == EnergyPolicy::Battery) {
+        plan.m_allow_gpu = false;
+        plan.m_thread_fraction = 0.5;
+        plan.m_proxy_scale = k_half_pixels_scale;
+    } else if (state.m_on_battery || state.m_thermal != ThermalState::Nominal) {
+        plan.m_gpu_advantage_threshold = k_constrained_gpu_advantage;
+        plan.m_thread_fraction = k_elevated_thread_fraction;
+    }
+
+    if (state.m_thermal == ThermalState::Critical) {
+        plan.m_thread_fraction *= 0.5;
+        plan.m_proxy_scale *= k_half_pixels_scale;
+    }
+    return plan;
+}
+
+std::string_view EnergyPlan::policyName(EnergyPolicy policy) noexcept
+{
+    switch (policy) {
+    case EnergyPolicy::Performance:
+        return "performance";
+    case EnergyPolicy::Balanced:
+        return "balanced";
+    case EnergyPolicy::Battery:
+        return "battery";
+    }
+    return "balanced";
+}
+
+std::optional<EnergyPolicy> EnergyPlan::parsePolicy(std::string_view name) noexcept
+{
+    if (name == "performance") {
+        return EnergyPolicy::Performance;
+    }
+    if (name == "balanced") {
+        return EnergyPolicy::Balanced;
+    }
+    if (name == "battery") {
+        return EnergyPolicy::Battery;
+    }
+    return std::nullopt;
+}
+
+} // namespace CaptureMoment::Core::Config
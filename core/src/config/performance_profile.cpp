@@ -0,0 +1,288 @@
+/**
+ * @file performance_profile.cpp
+ * @brief Implementation of PerformanceProfile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "config/performance_profile.h"
+#include "config/app_config.h"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace CaptureMoment::Core::Config {
+
+namespace {
+
+using Json = nlohmann::json;
+
+/**
+ * @brief Keys of `threads` naming the priorities, indexed by `Workers::TaskPriority`.
+ */
+constexpr std::array<std::string_view, Workers::k_task_priority_count> k_priority_keys {
+    "interactive", "refine", "export", "thumbnail"
+};
+
+/**
+ * @brief Reads a non-negative integer, if present.
+ * @return false if present with another type (or out of the range of `T`).
+ */
+template<typename T>
+[[nodiscard]] bool readUnsigned(const Json& object, std::string_view key, std::optional<T>& value)
+{
+    const auto it = object.find(std::string(key));
+    if (it == object.end()) {
+        return true;
+    }
+
+    if (!it->is_number_unsigned() || it->get<std::uint64_t>() > std::numeric_limits<T>::max()) {
+        spdlog::error("[PerformanceProfile::parse]: '{}' must be a non-negative integer.", key);
+        return false;
+    }
+    value = static_cast<T>(it->get<std::uint64_t>());
+    return true;
+}
+
+[[nodiscard]] bool readThreads(const Json& object, PerformanceProfile& profile)
+{
+    const auto it = object.find("threads");
+    if (it == object.end()) {
+        return true;
+    }
+
+    if (!it->is_object()) {
+        spdlog::error("[PerformanceProfile::parse]: 'threads' must be an object.");
+        return false;
+    }
+
+    for (const auto& [key, value] : it->items()) {
+        if (key != "budget" && std::ranges::find(k_priority_keys, key) == k_priority_keys.end()) {
+            spdlog::warn("[PerformanceProfile::parse]: Ignoring unknown key 'threads.{}'.", key);
+        }
+    }
+
+    if (!readUnsigned(*it, "budget", profile.m_threads)) {
+        return false;
+    }
+    for (std::size_t priority = 0; priority < k_priority_keys.size(); ++priority) {
+        if (!readUnsigned(*it, k_priority_keys[priority], profile.m_priority_threads[priority])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] bool readBackend(const Json& object, PerformanceProfile& profile)
+{
+    const auto it = object.find("backend");
+    if (it == object.end()) {
+        return true;
+    }
+
+    const std::string name { it->is_string() ? it->get<std::string>() : std::string {} };
+    if (name == "auto") {
+        profile.m_backend.emplace(std::nullopt);
+    } else if (name == "cpu") {
+        profile.m_backend = Common::MemoryType::CPU_RAM;
+    } else if (name == "gpu") {
+        profile.m_backend = Common::MemoryType::GPU_MEMORY;
+    } else {
+        spdlog::error("[PerformanceProfile::parse]: 'backend' must be \"auto\", \"cpu\" or \"gpu\".");
+        return false;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+std::expected<PerformanceProfile, ErrorHandling::CoreError> PerformanceProfile::parse(std::string_view json)
+{
+    // Comments allowed: operators annotate why a host is tuned the way it is
+    const Json object = Json::parse(json.begin(), json.end(), nullptr, false, true);
+    if (object.is_discarded() || !object.is_object()) {
+        spdlog::error("[PerformanceProfile::parse]: The profile is not a JSON object.");
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    constexpr std::array<std::string_view, 8> k_keys {
+        "threads", "memory_budget_mb", "source_tile_cache_mb", "proxy_max_long_edge",
+        "cpu_tile_size", "fp16", "pipeline_cache_size", "backend"
+    };
+    for (const auto& [key, value] : object.items()) {
+        if (std::ranges::find(k_keys, key) == k_keys.end()) {
+            spdlog::warn("[PerformanceProfile::parse]: Ignoring unknown key '{}'.", key);
+        }
+    }
+
+    PerformanceProfile profile;
+    std::optional<std::uint32_t> tile_size;
+    if (!readThreads(object, profile)
+        || !readUnsigned(object, "memory_budget_mb", profile.m_memory_budget_mb)
+        || !readUnsigned(object, "proxy_max_long_edge", profile.m_proxy_max_long_edge)
+        || !readUnsigned(object, "cpu_tile_size", tile_size)
+        || !readUnsigned(object, "pipeline_cache_size", profile.m_pipeline_cache_size)
+        || !readBackend(object, profile)) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    if (tile_size) {
+        profile.m_cpu_tile_size = static_cast<int>(std::min<std::uint32_t>(*tile_size, std::numeric_limits<int>::max()));
+    }
+
+    if (const auto it = object.find("source_tile_cache_mb"); it != object.end()) {
+        if (!it->is_number() || it->get<double>() < 0.0) {
+            spdlog::error("[PerformanceProfile::parse]: 'source_tile_cache_mb' must be a non-negative number.");
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        profile.m_source_tile_cache_mb = it->get<float>();
+    }
+
+    if (const auto it = object.find("fp16"); it != object.end()) {
+        if (!it->is_boolean()) {
+            spdlog::error("[PerformanceProfile::parse]: 'fp16' must be true or false.");
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        profile.m_fp16 = it->get<bool>();
+    }
+
+    return profile;
+}
+
+std::expected<PerformanceProfile, ErrorHandling::CoreError> PerformanceProfile::load(const std::filesystem::path& path)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        spdlog::error("[PerformanceProfile::load]: '{}' does not exist.", path.string());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        spdlog::error("[PerformanceProfile::load]: Cannot read '{}'.", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    const std::string text { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+    return parse(text);
+}
+
+void PerformanceProfile::apply() const
+{
+    auto& config = AppConfig::instance();
+
+    if (m_memory_budget_mb) {
+        config.setMemoryBudgetMB(*m_memory_budget_mb);
+    }
+    for (std::size_t priority = 0; priority < m_priority_threads.size(); ++priority) {
+        if (m_priority_threads[priority]) {
+            config.setPriorityConcurrencyCap(static_cast<Workers::TaskPriority>(priority), *m_priority_threads[priority]);
+        }
+    }
+    if (m_threads) {
+        config.setConcurrencyBudget(*m_threads);
+    }
+    if (m_source_tile_cache_mb) {
+        config.setSourceTileCacheSizeMB(*m_source_tile_cache_mb);
+    }
+    if (m_proxy_max_long_edge) {
+        config.setProxyMaxLongEdge(*m_proxy_max_long_edge);
+    }
+    if (m_cpu_tile_size) {
+        config.setCpuTileSize(*m_cpu_tile_size);
+    }
+    if (m_fp16) {
+        config.setWorkingPixelFormat(*m_fp16 ? Common::PixelFormat::RGBA_F16 : Common::PixelFormat::RGBA_F32);
+    }
+    if (m_pipeline_cache_size) {
+        config.setPipelineCacheCapacity(*m_pipeline_cache_size);
+    }
+    if (m_backend) {
+        config.setBackendOverride(*m_backend);
+    }
+}
+
+// ============================================================
+// Watcher
+// ============================================================
+
+PerformanceProfileWatcher::PerformanceProfileWatcher(std::filesystem::path path, std::chrono::milliseconds poll_interval)
+    : m_path(std::move(path))
+    , m_poll_interval(poll_interval)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        static_cast<void>(reload_unsafe());
+    }
+    m_thread = std::jthread([this](std::stop_token stop) { run(stop); });
+}
+
+PerformanceProfileWatcher::~PerformanceProfileWatcher()
+{
+    m_thread.request_stop();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+std::expected<void, ErrorHandling::CoreError> PerformanceProfileWatcher::reload()
+{
+    std::lock_guard lock(m_mutex);
+    return reload_unsafe();
+}
+
+std::expected<void, ErrorHandling::CoreError> PerformanceProfileWatcher::reload_unsafe()
+{
+    // Taken before reading: a write during the read is seen by the next check
+    std::error_code error;
+    const auto write_time { std::filesystem::last_write_time(m_path, error) };
+    m_last_write_time = error ? std::nullopt : std::optional { write_time };
+
+    auto profile { PerformanceProfile::load(m_path) };
+    if (!profile) {
+        spdlog::warn("[PerformanceProfileWatcher::reload]: Keeping the current settings.");
+        return std::unexpected(profile.error());
+    }
+
+    if (m_applied == *profile) {
+        spdlog::debug("[PerformanceProfileWatcher::reload]: '{}' unchanged.", m_path.string());
+        return {};
+    }
+
+    profile->apply();
+    m_applied = std::move(*profile);
+    spdlog::info("[PerformanceProfileWatcher::reload]: Performance profile '{}' applied.", m_path.string());
+    return {};
+}
+
+void PerformanceProfileWatcher::run(std::stop_token stop)
+{
+    std::unique_lock lock(m_mutex);
+
+    while (!stop.stop_requested()) {
+        // Woken early by the stop request only
+        static_cast<void>(m_wake.wait_for(lock, stop, m_poll_interval, [] { return false; }));
+        if (stop.stop_requested()) {
+            break;
+        }
+
+        std::error_code error;
+        const auto write_time { std::filesystem::last_write_time(m_path, error) };
+        const std::optional current { error ? std::nullopt : std::optional { write_time } };
+        if (current && current != m_last_write_time) {
+            static_cast<void>(reload_unsafe());
+        } else {
+            // Deleted: applied again once it reappears
+            m_last_write_time = current;
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Config
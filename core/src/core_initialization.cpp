@@ -9,11 +9,33 @@
 #include "core_initialization.h"
 #include "image_processing/registration/working_image_registration.h"
 #include "image_processing/deciders/benchmarking_backend_decider.h"
+#include "image_processing/deciders/backend_decision_cache.h"
+#include "image_processing/deciders/backend_cost_model.h"
+#include "image_processing/deciders/cpu_target.h"
 #include "config/app_config.h"
+#include "config/performance_profile.h"
+#include "operations/operation_cost.h"
+#include "pipeline/cancellable_jit_context.h"
+#include "common/trace/allocation_tracker.h"
+#include "common/trace/perf_counters.h"
+#include "common/trace/tracer.h"
+#include "common/trace/startup_profile.h"
+#include "common/logging/log.h"
+#include "operations/plugins/operation_plugin_registry.h"
+#include <Halide.h>
 #include <spdlog/spdlog.h>
 #include <spdlog/cfg/env.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace CaptureMoment::Core {
 
@@ -49,6 +71,11 @@ void init_logging()
         // This will override the level set above if the env var is present.
         spdlog::cfg::load_env_levels(); // This checks the SPDLOG_LEVEL environment variable
 
+        // Per-subsystem thresholds of the hot-path macros (CAPTUREMOMENT_LOG=pipeline=warn,render=off)
+        if (const char* subsystems = std::getenv("CAPTUREMOMENT_LOG"); subsystems && *subsystems) {
+            CaptureMoment::Core::Common::Logging::applySubsystemLevels(subsystems);
+        }
+
         // 4. Register the logger and set it as the default
         spdlog::set_default_logger(console_logger);
 
@@ -110,52 +137,496 @@ void init_backends()
     CaptureMoment::Core::ImageProcessing::registerDefaultBackends();
 }
 
+// ============================================================
+// Helper: Per-image Backend Selection
+// ============================================================
+void init_backend_cost_model(const std::optional<Halide::Target>& gpu_target,
+                             const std::vector<CaptureMoment::Core::ImageProcessing::BackendBenchmarkTiming>& timings)
+{
+    auto& config = CaptureMoment::Core::Config::AppConfig::instance();
+
+    if (gpu_target) {
+        CaptureMoment::Core::Config::AppConfig::setGpuHalideTarget(*gpu_target);
+    }
+
+    // Without a GPU target the model could still pick the GPU on paper, keep it CPU-only
+    auto model = CaptureMoment::Core::ImageProcessing::BackendCostModel::fromTimings(timings);
+    if (model && !CaptureMoment::Core::Config::AppConfig::hasGpuHalideTarget()) {
+        model.reset();
+    }
+    if (model) {
+        // The measured chain relates the nominal costs of every operation to this host
+        model->calibrate(CaptureMoment::Core::Operations::benchmarkChainCost());
+    }
+
+    config.setBackendCostModel(std::move(model));
+}
+
 // ============================================================
 // Helper: Backend Decider & Configuration
 // ============================================================
-void init_backend_decider()
+
+// Decision of a benchmark run in the background, until applyBackgroundBackendDecision() takes it
+std::mutex s_background_mutex;
+std::optional<CaptureMoment::Core::ImageProcessing::BackendDecision> s_background_decision;
+
+// Joined at exit: a benchmark still running delays the exit rather than touching destroyed state
+std::jthread s_background_thread;
+
+void apply_backend_decision(const CaptureMoment::Core::ImageProcessing::BackendDecision& decision)
 {
+    // 1. Store the selected MemoryType in global Config
+    CaptureMoment::Core::Config::AppConfig::instance().setProcessingBackend(decision.m_memory_type);
+
+    // 2. The GPU tile tuned for this machine, before the target so GPU pipelines are built with it
+    if (decision.m_gpu_schedule) {
+        CaptureMoment::Core::Config::AppConfig::setGpuTileSchedule(*decision.m_gpu_schedule);
+    }
+
+    // 3. Store the specific Halide Target (Host+CUDA, Host+Vulkan, etc.) in Config
+    // This allows WorkingImageGPU_Halide to retrieve the correct target.
+    CaptureMoment::Core::Config::AppConfig::setHalideTarget(decision.m_target);
+
+    // 4. Keep the GPU target and the measurements for per-image backend selection
+    init_backend_cost_model(decision.m_gpu_target, decision.m_timings);
+}
+
+CaptureMoment::Core::ImageProcessing::BackendDecision run_backend_benchmark(const std::string& fingerprint)
+{
+    CaptureMoment::Core::Common::Trace::ScopedStartupPhase phase { "core.backend_benchmark" };
     spdlog::info("[CoreInitialization] Starting backend selection benchmark...");
 
-    // 1. Create the decider
+    // Run benchmark (CPU vs GPU comparison)
     CaptureMoment::Core::ImageProcessing::BenchmarkingBackendDecider benchmark_decider;
+    const auto backend = benchmark_decider.decide();
 
-    // 2. Run benchmark (CPU vs GPU comparison)
-    auto backend = benchmark_decider.decide();
+    CaptureMoment::Core::ImageProcessing::BackendDecision decision {
+        fingerprint, backend, benchmark_decider.getWinningTarget(),
+        benchmark_decider.getBestGpuTarget(), benchmark_decider.getTimings(),
+        benchmark_decider.getGpuSchedule()
+    };
 
-    // 3. Store the selected MemoryType in global Config
-    CaptureMoment::Core::Config::AppConfig::instance().setProcessingBackend(backend);
+    // Persist the decision for the next launches
+    CaptureMoment::Core::ImageProcessing::BackendDecisionCache cache;
+    cache.store(decision);
 
-    // 4. Store the specific Halide Target (Host+CUDA, Host+Vulkan, etc.) in Config
-    // This allows WorkingImageGPU_Halide to retrieve the correct target.
-    CaptureMoment::Core::Config::AppConfig::setHalideTarget(benchmark_decider.getWinningTarget());
+    spdlog::info("[CoreInitialization] Backend benchmark complete.");
+    return decision;
+}
+
+/**
+ * @brief Compiles a trivial pipeline so the first real compilation skips the JIT's one-time setup.
+ * @details Only reads the CPU target, which is settled before the backend decision.
+ */
+void warm_up_jit()
+{
+    CaptureMoment::Core::Common::Trace::ScopedStartupPhase phase { "core.jit_warmup" };
+    try {
+        Halide::Var x;
+        Halide::Func warm_up { "jit_warm_up" };
+        warm_up(x) = x * 2.0f;
+        warm_up.compile_jit(CaptureMoment::Core::Config::AppConfig::getHalideTarget(
+            CaptureMoment::Core::Common::MemoryType::CPU_RAM));
+    } catch (const Halide::Error& e) {
+        spdlog::warn("[CoreInitialization] JIT warm-up failed: {}", e.what());
+    }
+}
+
+void init_backend_decider(bool force_benchmark, CaptureMoment::Core::BackendSelection selection)
+{
+    CaptureMoment::Core::ImageProcessing::BackendDecisionCache cache;
+    const std::string fingerprint = CaptureMoment::Core::ImageProcessing::BackendDecisionCache::currentFingerprint();
+
+    // 1. Reuse the previous decision if this machine has already been benchmarked
+    if (!force_benchmark) {
+        if (auto cached = cache.load(fingerprint)) {
+            spdlog::info("[CoreInitialization] Using cached backend decision from '{}'.", cache.path().string());
+            apply_backend_decision(*cached);
+            if (selection == CaptureMoment::Core::BackendSelection::Background) {
+                s_background_thread = std::jthread([] { warm_up_jit(); });
+            }
+            return;
+        }
+    } else {
+        spdlog::info("[CoreInitialization] Backend benchmark forced.");
+    }
+
+    // 2. Measure now, or start on the CPU defaults and measure in the background
+    if (selection == CaptureMoment::Core::BackendSelection::Blocking) {
+        apply_backend_decision(run_backend_benchmark(fingerprint));
+        return;
+    }
+
+    spdlog::info("[CoreInitialization] Starting on the CPU backend, benchmarking in the background.");
+    s_background_thread = std::jthread([fingerprint] {
+        auto decision = run_backend_benchmark(fingerprint);
+        {
+            std::lock_guard lock(s_background_mutex);
+            s_background_decision = std::move(decision);
+        }
+        warm_up_jit();
+    });
+}
+
+/**
+ * @brief Checks whether the CAPTUREMOMENT_FORCE_BENCHMARK environment variable requests a new benchmark.
+ */
+bool is_benchmark_forced_by_env()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_FORCE_BENCHMARK");
+    return value && *value && std::string_view(value) != "0";
+}
+
+/**
+ * @brief The watcher of the performance profile, if one is set.
+ * @details Constructed after AppConfig, so destroyed (and its thread joined) before it.
+ */
+std::unique_ptr<CaptureMoment::Core::Config::PerformanceProfileWatcher>& profile_watcher()
+{
+    static_cast<void>(CaptureMoment::Core::Config::AppConfig::instance());
+    static std::unique_ptr<CaptureMoment::Core::Config::PerformanceProfileWatcher> s_watcher;
+    return s_watcher;
+}
+
+/**
+ * @brief Applies the performance profile named by the CAPTUREMOMENT_PERFORMANCE_PROFILE
+ *        environment variable, if set, and applies it again whenever the file changes.
+ */
+void init_performance_profile()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_PERFORMANCE_PROFILE");
+    if (!value || !*value) {
+        return;
+    }
+
+    // Missing or invalid files are watched too: the profile applies once fixed
+    profile_watcher() = std::make_unique<CaptureMoment::Core::Config::PerformanceProfileWatcher>(value);
+    spdlog::info("[CoreInitialization] Watching the performance profile '{}'.", value);
+}
+
+/**
+ * @brief Applies the memory ceiling from the CAPTUREMOMENT_MEMORY_BUDGET_MB environment variable, if set.
+ */
+void init_memory_budget()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_MEMORY_BUDGET_MB");
+    if (!value || !*value) {
+        return;
+    }
+
+    char* end = nullptr;
+    const unsigned long long size_mb = std::strtoull(value, &end, 10);
+    if (end == value || *end != '\0') {
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_MEMORY_BUDGET_MB='{}' (expected megabytes).", value);
+        return;
+    }
+
+    CaptureMoment::Core::Config::AppConfig::instance().setMemoryBudgetMB(size_mb);
+}
+
+/**
+ * @brief Maps the large image buffers on huge pages per the CAPTUREMOMENT_HUGE_PAGES environment
+ *        variable ("off", "transparent" or "explicit"), if set.
+ */
+void init_huge_pages()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_HUGE_PAGES");
+    if (!value || !*value) {
+        return;
+    }
+
+    using HugePages = CaptureMoment::Core::Common::BufferPool::HugePages;
+    const std::string_view mode { value };
+    if (mode == "off") {
+        CaptureMoment::Core::Config::AppConfig::instance().setHugePages(HugePages::Off);
+    } else if (mode == "transparent") {
+        CaptureMoment::Core::Config::AppConfig::instance().setHugePages(HugePages::Transparent);
+    } else if (mode == "explicit") {
+        CaptureMoment::Core::Config::AppConfig::instance().setHugePages(HugePages::Explicit);
+    } else {
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_HUGE_PAGES='{}' (expected off, transparent or explicit).", value);
+    }
+}
+
+/**
+ * @brief Runs the Halide parallel loops on the engine's pool, under the budget from the
+ *        CAPTUREMOMENT_THREADS environment variable if set, pinned to the memory nodes if
+ *        CAPTUREMOMENT_NUMA_PINNING is set.
+ */
+void init_concurrency_budget()
+{
+    CaptureMoment::Core::Pipeline::CancellableJITContext::installDefaultHandlers();
+
+    if (const char* pinning = std::getenv("CAPTUREMOMENT_NUMA_PINNING"); pinning && *pinning && std::string_view(pinning) != "0") {
+        CaptureMoment::Core::Config::AppConfig::instance().setNumaPinning(true);
+    }
+
+    const char* value = std::getenv("CAPTUREMOMENT_THREADS");
+    if (!value || !*value) {
+        return;
+    }
+
+    char* end = nullptr;
+    const unsigned long long threads = std::strtoull(value, &end, 10);
+    if (end == value || *end != '\0') {
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_THREADS='{}' (expected a thread count).", value);
+        return;
+    }
+
+    CaptureMoment::Core::Config::AppConfig::instance().setConcurrencyBudget(static_cast<std::size_t>(threads));
+}
+
+/**
+ * @brief Selects the CPU instruction set from the CAPTUREMOMENT_CPU_TARGET environment variable
+ *        ("native" or "portable"), if set.
+ */
+void init_cpu_target()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_CPU_TARGET");
+    if (!value || !*value) {
+        return;
+    }
 
-    spdlog::info("[CoreInitialization] Backend configuration complete.");
+    const auto mode = CaptureMoment::Core::ImageProcessing::CpuTarget::parseMode(value);
+    if (!mode) {
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_CPU_TARGET='{}' (expected native or portable).", value);
+        return;
+    }
+
+    CaptureMoment::Core::Config::AppConfig::instance().setCpuTargetMode(*mode);
+}
+
+/**
+ * @brief Selects the layout of the CPU working images from the CAPTUREMOMENT_WORKING_LAYOUT
+ *        environment variable ("interleaved" or "planar"), if set.
+ */
+void init_working_layout()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_WORKING_LAYOUT");
+    if (!value || !*value) {
+        return;
+    }
+
+    const std::string_view name { value };
+    if (name != "interleaved" && name != "planar") {
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_WORKING_LAYOUT='{}' (expected interleaved or planar).", value);
+        return;
+    }
+
+    CaptureMoment::Core::Config::AppConfig::instance().setWorkingPixelLayout(
+        name == "planar" ? CaptureMoment::Core::Common::PixelLayout::Planar
+                         : CaptureMoment::Core::Common::PixelLayout::Interleaved);
+}
+
+/**
+ * @brief Loads the operation plugins of the directories listed in the CAPTUREMOMENT_PLUGIN_PATH
+ *        environment variable (separated by ':', or ';' on Windows), if set.
+ */
+void init_plugins()
+{
+    const char* value = std::getenv("CAPTUREMOMENT_PLUGIN_PATH");
+    if (!value || !*value) {
+        return;
+    }
+
+#if defined(_WIN32)
+    constexpr char separator { ';' };
+#else
+    constexpr char separator { ':' };
+#endif
+
+    std::size_t loaded { 0 };
+    std::string_view remaining { value };
+    while (!remaining.empty()) {
+        const std::size_t end { std::min(remaining.find(separator), remaining.size()) };
+        if (const std::string_view directory { remaining.substr(0, end) }; !directory.empty()) {
+            loaded += CaptureMoment::Core::Operations::OperationPluginRegistry::loadDirectory(std::string(directory));
+        }
+        remaining.remove_prefix(std::min(end + 1, remaining.size()));
+    }
+
+    spdlog::info("[CoreInitialization] {} operation plugin(s) loaded from CAPTUREMOMENT_PLUGIN_PATH.", loaded);
+}
+
+/**
+ * @brief Selects the energy policy from the CAPTUREMOMENT_ENERGY_POLICY environment variable
+ *        ("performance", "balanced" or "battery"), if set, and applies its plan to the thread budget.
+ */
+void init_energy_policy()
+{
+    auto& config = CaptureMoment::Core::Config::AppConfig::instance();
+
+    if (const char* value = std::getenv("CAPTUREMOMENT_ENERGY_POLICY"); value && *value) {
+        if (const auto policy = CaptureMoment::Core::Config::EnergyPlan::parsePolicy(value)) {
+            config.setEnergyPolicy(*policy);
+            return;
+        }
+        spdlog::warn("[CoreInitialization] Ignoring CAPTUREMOMENT_ENERGY_POLICY='{}' (expected performance, balanced or battery).", value);
+    }
+
+    // First probe of the power state under the default policy
+    static_cast<void>(config.currentEnergyPlan());
+}
+
+/**
+ * @brief Enables tracing if CAPTUREMOMENT_TRACE names an output file, written at exit, with the
+ *        hardware counters of the scopes if CAPTUREMOMENT_TRACE_COUNTERS is set.
+ */
+void init_tracing()
+{
+    static std::string s_trace_path;
+
+    const char* value = std::getenv("CAPTUREMOMENT_TRACE");
+    if (!value || !*value) {
+        return;
+    }
+
+    if (!CAPTUREMOMENT_USE_TRACING) {
+        spdlog::warn("[CoreInitialization] CAPTUREMOMENT_TRACE is set, but tracing is not compiled in (ENABLE_TRACING=OFF).");
+        return;
+    }
+
+    s_trace_path = value;
+    CaptureMoment::Core::Common::Trace::Tracer::instance().setEnabled(true);
+
+    // Deep-dive profiling: hardware counters per scope
+    if (const char* counters = std::getenv("CAPTUREMOMENT_TRACE_COUNTERS"); counters && *counters && std::string_view(counters) != "0") {
+        if (CaptureMoment::Core::Common::Trace::PerfCounters::setEnabled(true)) {
+            spdlog::info("[CoreInitialization] Hardware counters recorded in the trace scopes.");
+        }
+    }
+    std::atexit([] {
+        static_cast<void>(CaptureMoment::Core::Common::Trace::Tracer::instance().writeChromeTrace(s_trace_path));
+    });
+
+    spdlog::info("[CoreInitialization] Tracing enabled, trace written to '{}' at exit.", s_trace_path);
+}
+
+/**
+ * @brief Enables allocation tracking if CAPTUREMOMENT_MEMORY_REPORT names an output file,
+ *        where the peak memory per stage is written at exit.
+ */
+void init_memory_report()
+{
+    static std::string s_report_path;
+
+    const char* value = std::getenv("CAPTUREMOMENT_MEMORY_REPORT");
+    if (!value || !*value) {
+        return;
+    }
+
+    if (!CAPTUREMOMENT_USE_TRACING) {
+        spdlog::warn("[CoreInitialization] CAPTUREMOMENT_MEMORY_REPORT is set, but tracing is not compiled in "
+                     "(ENABLE_TRACING=OFF): every allocation is reported as untraced.");
+    }
+
+    s_report_path = value;
+    CaptureMoment::Core::Common::Trace::AllocationTracker::instance().setEnabled(true);
+    std::atexit([] {
+        static_cast<void>(CaptureMoment::Core::Common::Trace::AllocationTracker::instance().writeReport(s_report_path));
+    });
+
+    spdlog::info("[CoreInitialization] Allocation tracking enabled, report written to '{}' at exit.", s_report_path);
 }
 
 // ============================================================
 // Main Initialization Logic
 // ============================================================
-void perform_initialization()
+void perform_initialization(bool force_benchmark, CaptureMoment::Core::BackendSelection selection)
 {
+    using CaptureMoment::Core::Common::Trace::ScopedStartupPhase;
+
     // Step 1: Initialize Logging
-    init_logging();
+    {
+        ScopedStartupPhase phase { "core.logging" };
+        init_logging();
+    }
+
+    // Step 1a: Tracing, before the first traced scope
+    init_tracing();
+
+    // Allocation tracking likewise, and before step 1c installs the Halide handlers
+    init_memory_report();
+
+    // Step 1b: Performance profile of the host, before the environment variables overriding it
+    {
+        ScopedStartupPhase phase { "core.performance_profile" };
+        init_performance_profile();
+    }
+
+    // Memory ceiling for shared hosts, before any cache fills up
+    init_memory_budget();
+
+    // Huge pages for the image buffers, before the first image is allocated
+    init_huge_pages();
+
+    // Step 1c: One thread budget for every parallel loop, before the first realization
+    init_concurrency_budget();
+
+    // Step 1d: CPU instruction set, before the backend decision builds the targets on it
+    init_cpu_target();
+
+    // Step 1e: Layout of the CPU working images, before the first image is loaded
+    init_working_layout();
+
+    // Step 1f: Energy policy, scaling the thread budget on battery or when hot
+    init_energy_policy();
 
     // Step 2: Register Factories
-    init_backends();
+    {
+        ScopedStartupPhase phase { "core.backends" };
+        init_backends();
+    }
+
+    // Step 2a: Operation plugins, before the first factory is populated
+    {
+        ScopedStartupPhase phase { "core.plugins" };
+        init_plugins();
+    }
 
     // Step 3: Run Benchmark Decider & Setup Config
-    init_backend_decider();
+    {
+        ScopedStartupPhase phase { "core.backend_decision" };
+        init_backend_decider(force_benchmark || is_benchmark_forced_by_env(), selection);
+    }
 }
 
 } 
 
-void initialize()
+void initialize(bool force_benchmark, BackendSelection selection)
 {
     // std::call_once ensures that 'perform_initialization' is executed exactly once.
     // It is thread-safe: if multiple threads call initialize(), they will synchronize,
     // and only one will execute the registration and benchmarking.
-    std::call_once(s_init_flag, perform_initialization);
+    Common::Trace::ScopedStartupPhase phase { "core.initialize" };
+    std::call_once(s_init_flag, perform_initialization, force_benchmark, selection);
+}
+
+bool applyBackgroundBackendDecision()
+{
+    std::optional<ImageProcessing::BackendDecision> decision;
+    {
+        std::lock_guard lock(s_background_mutex);
+        decision = std::exchange(s_background_decision, std::nullopt);
+    }
+
+    if (!decision) {
+        return false;
+    }
+
+    spdlog::info("[CoreInitialization] Applying the background backend decision.");
+    apply_backend_decision(*decision);
+    return true;
+}
+
+bool reloadPerformanceProfile()
+{
+    auto& watcher = profile_watcher();
+    if (!watcher) {
+        spdlog::warn("[CoreInitialization] No performance profile to reload (CAPTUREMOMENT_PERFORMANCE_PROFILE unset).");
+        return false;
+    }
+    return watcher->reload().has_value();
 }
 
 } // namespace CaptureMoment::Core
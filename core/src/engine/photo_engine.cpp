@@ -7,7 +7,11 @@
 
 #include "engine/photo_engine.h"
 #include "managers/state_image_manager.h"
+#include "config/app_config.h"
+#include "operations/operation_cost.h"
+#include "operations/basic_adjustment_operations/auto_tone.h"
 
+#include <future>
 #include <string_view>
 #include <memory>
 #include <spdlog/spdlog.h>
@@ -15,8 +19,22 @@
 
 namespace CaptureMoment::Core::Engine {
 
-PhotoEngine::PhotoEngine()
-    : m_state_manager(std::make_unique<Managers::StateImageManager>())
+namespace {
+
+/**
+ * @brief Future of a request that could not be submitted.
+ */
+[[nodiscard]] std::future<Common::ProcessingOutcome> failedRequest()
+{
+    std::promise<Common::ProcessingOutcome> promise;
+    promise.set_value(Common::ProcessingOutcome::Failed);
+    return promise.get_future();
+}
+
+} // namespace
+
+PhotoEngine::PhotoEngine(std::shared_ptr<Workers::EngineScheduler> scheduler)
+    : m_state_manager(std::make_unique<Managers::StateImageManager>(std::move(scheduler)))
 {
     spdlog::debug("PhotoEngine: Constructed with StateImageManager.");
 }
@@ -47,6 +65,145 @@ std::expected<void, ErrorHandling::CoreError> PhotoEngine::loadImage(std::string
     return {};
 }
 
+std::expected<std::unique_ptr<PhotoEngine>, ErrorHandling::CoreError> PhotoEngine::createVirtualCopy() const
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::createVirtualCopy: StateImageManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    auto copy = std::make_unique<PhotoEngine>(m_state_manager->shareScheduler());
+
+    if (auto shared = copy->m_state_manager->shareSourceOf(*m_state_manager); !shared) {
+        spdlog::error("PhotoEngine::createVirtualCopy: Failed to share the loaded image.");
+        return std::unexpected(shared.error());
+    }
+
+    if (auto process_result = copy->m_state_manager->resetToOriginal(); !process_result) {
+        return std::unexpected(process_result.error());
+    }
+
+    spdlog::info("PhotoEngine: Virtual copy of '{}' created.", m_state_manager->getImageSourcePath());
+    return copy;
+}
+
+void PhotoEngine::prefetchImages(std::span<const std::string> paths)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::prefetchImages: StateImageManager is null.");
+        return;
+    }
+
+    m_state_manager->prefetchImages(paths);
+}
+
+void PhotoEngine::warmUpPipeline(std::vector<Operations::OperationDescriptor> operations)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::warmUpPipeline: StateImageManager is null.");
+        return;
+    }
+
+    m_state_manager->warmUpPipeline(std::move(operations));
+}
+
+std::vector<std::expected<Managers::ImageMetadata, ErrorHandling::CoreError>>
+PhotoEngine::readImageMetadata(std::span<const std::string> paths, const Common::CancellationToken& token) const
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::readImageMetadata: StateImageManager is null.");
+        return std::vector<std::expected<Managers::ImageMetadata, ErrorHandling::CoreError>>(
+            paths.size(), std::unexpected(ErrorHandling::CoreError::Unexpected));
+    }
+
+    return m_state_manager->readImageMetadata(paths, token);
+}
+
+Managers::SourceTileCacheStats PhotoEngine::getSourceTileCacheStats() const
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::getSourceTileCacheStats: StateImageManager is null.");
+        return {};
+    }
+
+    return m_state_manager->getSourceTileCacheStats();
+}
+
+std::expected<std::filesystem::path, ErrorHandling::CoreError>
+PhotoEngine::dumpPipelineDiagnostics(const std::filesystem::path& directory) const
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::dumpPipelineDiagnostics: StateImageManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    return m_state_manager->dumpPipelineDiagnostics(directory);
+}
+
+void PhotoEngine::setImageRefinedCallback(std::function<void(std::string_view path)> callback)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::setImageRefinedCallback: StateImageManager is null.");
+        return;
+    }
+
+    m_state_manager->setSourceRefinedCallback(std::move(callback));
+}
+
+std::expected<bool, ErrorHandling::CoreError> PhotoEngine::adoptRefinedImage(std::string_view path)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::adoptRefinedImage: StateImageManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    auto adopted = m_state_manager->adoptRefinedSource(path);
+    if (!adopted || !adopted.value()) {
+        return adopted;
+    }
+
+    if (auto process_result = m_state_manager->resetToOriginal(); !process_result) {
+        return std::unexpected(process_result.error());
+    }
+
+    spdlog::info("PhotoEngine: Full-quality image '{}' swapped in.", path);
+    return true;
+}
+
+bool PhotoEngine::isPreviewImage() const
+{
+    return m_state_manager && m_state_manager->isPreviewImage();
+}
+
+void PhotoEngine::requestFullQualityImage()
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::requestFullQualityImage: StateImageManager is null.");
+        return;
+    }
+
+    m_state_manager->requestFullQualitySource();
+}
+
+std::expected<void, ErrorHandling::CoreError> PhotoEngine::redevelopRawImage(const ImageConfig::Raw::RawSettings& settings)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::redevelopRawImage: StateImageManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    if (auto developed = m_state_manager->redevelopRawSource(settings); !developed) {
+        return developed;
+    }
+
+    if (auto process_result = m_state_manager->resetToOriginal(); !process_result) {
+        return std::unexpected(process_result.error());
+    }
+
+    spdlog::info("PhotoEngine: RAW image redeveloped.");
+    return {};
+}
+
 std::expected<void, ErrorHandling::CoreError> PhotoEngine::commitWorkingImageToSource()
 {
     if (!m_state_manager) {
@@ -78,17 +235,147 @@ Common::ImageChan PhotoEngine::channels() const noexcept
     return m_state_manager->getSourceChannels();
 }
 
-std::future<bool> PhotoEngine::applyOperations(std::vector<Operations::OperationDescriptor>&& ops)
+Common::ImageOrientation PhotoEngine::orientation() const noexcept
+{
+    return m_state_manager->getSourceOrientation();
+}
+
+std::future<Common::ProcessingOutcome> PhotoEngine::applyOperations(std::vector<Operations::OperationDescriptor>&& ops)
 {
     if (!m_state_manager) {
         spdlog::error("PhotoEngine::applyOperations: StateImageManager is null.");
-        return std::async(std::launch::deferred, []() { return false; });
+        return failedRequest();
     }
 
     spdlog::info("PhotoEngine::applyOperations: Received {} operations.", ops.size());
     return m_state_manager->applyOperations(std::move(ops));
 }
 
+std::future<Common::ProcessingOutcome> PhotoEngine::applyOperations(std::vector<Operations::OperationDescriptor>&& ops,
+                                               const Common::RegionOfInterest& roi)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::applyOperations: StateImageManager is null.");
+        return failedRequest();
+    }
+
+    spdlog::info("PhotoEngine::applyOperations: Received {} operations (ROI {}x{}).", ops.size(), roi.m_width, roi.m_height);
+    return m_state_manager->applyOperations(std::move(ops), roi);
+}
+
+std::expected<void, ErrorHandling::CoreError> PhotoEngine::prepareProxy(Common::ImageDim width, Common::ImageDim height)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::prepareProxy: StateImageManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    return m_state_manager->prepareProxy(width, height);
+}
+
+std::optional<double> PhotoEngine::estimateRenderMilliseconds(std::span<const Operations::OperationDescriptor> ops,
+                                                              Common::ImageDim width, Common::ImageDim height) const
+{
+    auto& config = Config::AppConfig::instance();
+    const auto cost_model = config.getBackendCostModel();
+    if (!cost_model) {
+        return std::nullopt;
+    }
+
+    const Operations::ChainCost chain { Operations::chainCost(ops) };
+    const auto energy_plan = config.currentEnergyPlan();
+    const Common::MemoryType backend { energy_plan.m_allow_gpu
+                                           ? cost_model->selectBackend(width, height, chain, energy_plan.m_gpu_advantage_threshold)
+                                           : Common::MemoryType::CPU_RAM };
+    return cost_model->estimateMilliseconds(backend, chain, width, height);
+}
+
+std::future<Common::ProcessingOutcome> PhotoEngine::applyOperationsToProxy(std::vector<Operations::OperationDescriptor>&& ops)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::applyOperationsToProxy: StateImageManager is null.");
+        return failedRequest();
+    }
+
+    return m_state_manager->applyOperationsToProxy(std::move(ops));
+}
+
+std::future<Common::ProcessingOutcome> PhotoEngine::applyOperationsProgressive(std::vector<Operations::OperationDescriptor>&& ops,
+                                                                             Managers::ProgressiveRefinement refinement)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::applyOperationsProgressive: StateImageManager is null.");
+        return failedRequest();
+    }
+
+    return m_state_manager->applyOperationsProgressive(std::move(ops), std::move(refinement));
+}
+
+std::future<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>>
+PhotoEngine::renderVariants(std::vector<Operations::OperationDescriptor>&& ops,
+                            std::vector<Operations::ParameterSnapshot> variants,
+                            Common::ImageDim max_long_edge,
+                            Common::CancellationToken token)
+{
+    if (!m_state_manager) {
+        spdlog::error("PhotoEngine::renderVariants: StateImageManager is null.");
+        std::promise<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>> failed;
+        failed.set_value(std::unexpected(ErrorHandling::CoreError::Unexpected));
+        return failed.get_future();
+    }
+
+    return m_state_manager->renderVariants(std::move(ops), std::move(variants), max_long_edge, std::move(token));
+}
+
+void PhotoEngine::cancelProcessing()
+{
+    if (!m_state_manager) return;
+
+    spdlog::debug("PhotoEngine::cancelProcessing: Cancelling running and pending requests.");
+    m_state_manager->cancelProcessing();
+}
+
+void PhotoEngine::beginInteraction(std::uint64_t operation_id)
+{
+    if (!m_state_manager) return;
+
+    m_state_manager->beginInteraction(operation_id);
+}
+
+std::future<Common::ProcessingOutcome> PhotoEngine::endInteraction()
+{
+    if (!m_state_manager) return {};
+
+    return m_state_manager->endInteraction();
+}
+
+void PhotoEngine::publishParameters(const Operations::ParameterSnapshot& snapshot) noexcept
+{
+    if (!m_state_manager) return;
+
+    m_state_manager->publishParameters(snapshot);
+}
+
+void PhotoEngine::setProcessingTimingsCallback(Managers::StateImageManager::TimingsCallback callback)
+{
+    if (!m_state_manager) {
+        spdlog::error("[PhotoEngine::setProcessingTimingsCallback]: StateManager is null.");
+        return;
+    }
+
+    m_state_manager->setProcessingTimingsCallback(std::move(callback));
+}
+
+std::size_t PhotoEngine::getQueueDepth() const
+{
+    if (!m_state_manager) {
+        spdlog::error("[PhotoEngine::getQueueDepth]: StateManager is null.");
+        return 0;
+    }
+
+    return m_state_manager->getQueueDepth();
+}
+
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> PhotoEngine::getWorkingImageAsRegion() const
 {
     if (!m_state_manager) {
@@ -106,6 +393,16 @@ std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> Ph
     return result;
 }
 
+std::expected<Common::ImageView, ErrorHandling::CoreError> PhotoEngine::getWorkingImageView() const
+{
+    if (!m_state_manager) {
+        spdlog::error("[PhotoEngine::getWorkingImageView]: StateManager is null.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    return m_state_manager->getWorkingImageView();
+}
+
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
 PhotoEngine::getDownsampledDisplayImage(Common::ImageDim width, Common::ImageDim height)
 {
@@ -115,4 +412,51 @@ PhotoEngine::getDownsampledDisplayImage(Common::ImageDim width, Common::ImageDim
     return m_state_manager->getDownsampledDisplayImage(width, height);
 }
 
+void PhotoEngine::setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height)
+{
+    if (m_state_manager) {
+        m_state_manager->setDisplayOutputSize(width, height);
+    }
+}
+
+void PhotoEngine::setDisplayOnDevice(bool enabled)
+{
+    if (m_state_manager) {
+        m_state_manager->setDisplayOnDevice(enabled);
+    }
+}
+
+void PhotoEngine::setHistogramEnabled(bool enabled)
+{
+    if (m_state_manager) {
+        m_state_manager->setHistogramEnabled(enabled);
+    }
+}
+
+std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+PhotoEngine::suggestAutoTone(std::vector<Operations::OperationDescriptor> ops) const
+{
+    const auto histogram { m_state_manager ? m_state_manager->latestHistogram() : nullptr };
+    if (!histogram) {
+        spdlog::warn("[PhotoEngine::suggestAutoTone]: No histogram of the image yet");
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+    }
+
+    const auto current { Operations::AutoTone::read(ops) };
+    const auto suggested { Operations::AutoTone::suggest(*histogram, current) };
+    spdlog::debug("[PhotoEngine::suggestAutoTone]: Exposure {:.2f}, contrast {:.2f}, whites {:.2f}, blacks {:.2f}",
+                  suggested.m_exposure, suggested.m_contrast, suggested.m_whites, suggested.m_blacks);
+
+    Operations::AutoTone::applyTo(ops, suggested);
+    return ops;
+}
+
+std::optional<Common::DisplayImage> PhotoEngine::takeDisplayImage()
+{
+    if (!m_state_manager) {
+        return std::nullopt;
+    }
+    return m_state_manager->takeDisplayImage();
+}
+
 } // namespace CaptureMoment::Core::Engine
@@ -0,0 +1,716 @@
+/**
+ * @file batch_exporter.cpp
+ * @brief Implementation of BatchExporter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/batch_exporter.h"
+#include "export/output_writer.h"
+#include "export/strip_exporter.h"
+#include "config/app_config.h"
+#include "common/numa_topology.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "image_processing/gpu/gpu_devices.h"
+#include "managers/source_manager.h"
+#include "operations/color_operations/camera_profile.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/operation_cost.h"
+#include "operations/operation_registry.h"
+#include "pipeline/pipeline_builder.h"
+#include "utils/image_conversion.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <thread>
+#include <utility>
+
+namespace CaptureMoment::Core::Export {
+
+/**
+ * @brief Footprint of a file in flight, in decode estimates: the decode itself (with LibRaw's
+ *        buffers for RAW files), then the copies of the process and encode stages.
+ */
+constexpr std::size_t k_footprint_factor { 3 };
+
+/**
+ * @brief Long edge of an output, for ordering them (0, full size, is the largest).
+ */
+[[nodiscard]] static Common::ImageDim orderingEdge(const ExportSettings& settings) noexcept
+{
+    return settings.m_max_long_edge == 0 ? std::numeric_limits<Common::ImageDim>::max() : settings.m_max_long_edge;
+}
+
+struct BatchExporter::Batch {
+    std::span<const ExportJob> m_jobs;
+    const ProgressCallback* m_on_progress { nullptr };
+    Common::CancellationToken m_token;
+
+    std::vector<ExportResult> m_results;
+
+    /** @brief Settings of the outputs of every file, the largest first: the main one and the renditions. */
+    std::vector<ExportSettings> m_outputs;
+
+    /** @brief Paths of the outputs of each file, in the order of `m_outputs`. */
+    std::vector<std::vector<std::filesystem::path>> m_output_paths;
+
+    /** @brief Outputs of each file not concluded yet. */
+    std::vector<std::size_t> m_outputs_left;
+
+    /** @brief Budget taken by each admitted file. */
+    std::vector<std::size_t> m_budget;
+
+    /** @brief Guards the results, the remaining count and the progress calls. */
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    std::size_t m_remaining { 0 };
+};
+
+namespace {
+
+/**
+ * @brief A decoded image copied out as linear RGBA_F32, with the profile of a camera-native RAW
+ *        decode (`Operations::CameraProfile`).
+ */
+struct DecodedRegion {
+    std::unique_ptr<Common::ImageRegion> m_image;
+    std::optional<std::string> m_camera_profile;
+};
+
+/**
+ * @brief Copies a decoded image out (`IOError` if its pixels cannot be read).
+ */
+[[nodiscard]] std::expected<DecodedRegion, ErrorHandling::CoreError> regionOf(const OIIO::ImageBuf& buffer, std::string_view path)
+{
+    const auto width { static_cast<Common::ImageDim>(buffer.spec().width) };
+    const auto height { static_cast<Common::ImageDim>(buffer.spec().height) };
+    Common::PixelBuffer data(static_cast<std::size_t>(width) * height * 4);
+    if (!buffer.get_pixels(OIIO::ROI(0, buffer.spec().width, 0, buffer.spec().height, 0, 1, 0, 4),
+                           OIIO::TypeDesc::FLOAT, data.data())) {
+        spdlog::error("[BatchExporter]: get_pixels of '{}' failed: {}", path, buffer.geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    DecodedRegion decoded { std::make_unique<Common::ImageRegion>(std::move(data), width, height,
+                                                                  static_cast<Common::ImageChan>(4)),
+                            std::nullopt };
+    if (std::string profile { buffer.spec().get_string_attribute(std::string(Operations::CameraProfile::k_metadata_key)) };
+        !profile.empty()) {
+        decoded.m_camera_profile = std::move(profile);
+    }
+    return decoded;
+}
+
+} // anonymous namespace
+
+[[nodiscard]] static std::unique_ptr<Pipeline::OperationPipelineExecutor> makeExecutor()
+{
+    auto base_executor = Pipeline::PipelineBuilder::build(Pipeline::PipelineType::HalideOperation);
+    if (auto* concrete = dynamic_cast<Pipeline::OperationPipelineExecutor*>(base_executor.get())) {
+        base_executor.release();
+        return std::unique_ptr<Pipeline::OperationPipelineExecutor>(concrete);
+    }
+    return nullptr;
+}
+
+BatchExporter::BatchExporter(std::size_t memory_budget_bytes, std::size_t encode_threads)
+    : m_source(std::make_unique<Managers::SourceManager>())
+    , m_operation_factory(std::make_unique<Operations::OperationFactory>())
+    , m_memory_budget_bytes(std::max<std::size_t>(memory_budget_bytes, 1))
+    , m_strip_exporter(std::make_unique<StripExporter>())
+{
+    Operations::OperationRegistry::registerAll(*m_operation_factory);
+
+    // GPU first: a file takes the first free processor
+    std::vector<Common::MemoryType> backends;
+    if (Config::AppConfig::hasGpuHalideTarget()) {
+        backends.push_back(Common::MemoryType::GPU_MEMORY);
+    }
+    backends.push_back(Common::MemoryType::CPU_RAM);
+
+    // Multi-socket hosts: one CPU processor per node, each file staying on the node of its processor
+    const std::size_t cpu_nodes { Config::AppConfig::instance().isNumaPinningEnabled()
+                                      ? Common::NumaTopology::instance().nodeCount() : 1 };
+
+    // Multi-GPU hosts (CUDA): one GPU processor per device, files sharded across them
+    const bool cuda { Config::AppConfig::hasGpuHalideTarget()
+                      && Config::AppConfig::getHalideTarget(Common::MemoryType::GPU_MEMORY).has_feature(Halide::Target::CUDA) };
+    const std::size_t gpu_devices { cuda ? ImageProcessing::GpuDevices::instance().deviceCount() : 1 };
+
+    for (const auto backend : backends) {
+        const bool cpu { backend == Common::MemoryType::CPU_RAM };
+        const std::size_t count { cpu ? cpu_nodes : gpu_devices };
+        for (std::size_t index = 0; index < count; ++index) {
+            auto processor { std::make_unique<Processor>() };
+            processor->m_backend = backend;
+            if (count > 1 && cpu) {
+                processor->m_node = index;
+            } else if (count > 1) {
+                processor->m_gpu_device = index;
+            }
+            processor->m_executor = makeExecutor();
+            if (!processor->m_executor) {
+                spdlog::error("[BatchExporter::BatchExporter]: No Halide executor: edits cannot be applied.");
+                break;
+            }
+            m_processors.push_back(std::move(processor));
+        }
+    }
+
+    if (encode_threads == 0) {
+        encode_threads = std::max(1u, std::thread::hardware_concurrency() / 2);
+    }
+
+    // The first scheduler thread only runs interactive work: one more for the export lane.
+    // Processing has a thread per processor plus a staging one, which uploads the next file
+    // while every processor is busy (see process()).
+    m_encode_pool = std::make_unique<Workers::EngineScheduler>(encode_threads + 1);
+    m_process_pool = std::make_unique<Workers::EngineScheduler>(std::max<std::size_t>(m_processors.size(), 1) + 2);
+}
+
+BatchExporter::~BatchExporter()
+{
+    // Upstream first: decodes queue processing, which queues encodes
+    m_source.reset();
+    m_process_pool.reset();
+    m_encode_pool.reset();
+}
+
+std::string_view BatchExporter::extension(ExportFormat format) noexcept
+{
+    switch (format) {
+    case ExportFormat::Jpeg:
+        return ".jpg";
+    case ExportFormat::Tiff:
+        return ".tif";
+    case ExportFormat::Exr:
+        return ".exr";
+    }
+    return ".jpg";
+}
+
+std::filesystem::path BatchExporter::outputPathFor(std::string_view source_path, const ExportSettings& settings)
+{
+    std::filesystem::path name { std::filesystem::path(source_path).stem() };
+    name += extension(settings.m_format);
+    return settings.m_output_directory / name;
+}
+
+std::filesystem::path BatchExporter::renditionPathFor(const std::filesystem::path& output_path,
+                                                     const ExportRendition& rendition)
+{
+    std::filesystem::path name { output_path.stem() };
+    name += rendition.m_suffix;
+    name += extension(rendition.m_format);
+    return output_path.parent_path() / name;
+}
+
+ExportSettings BatchExporter::renditionSettings(const ExportSettings& settings, const ExportRendition& rendition)
+{
+    ExportSettings rendition_settings { settings };
+    rendition_settings.m_format = rendition.m_format;
+    rendition_settings.m_jpeg_quality = rendition.m_jpeg_quality;
+    rendition_settings.m_max_long_edge = rendition.m_max_long_edge;
+    rendition_settings.m_renditions.clear();
+    return rendition_settings;
+}
+
+std::vector<ExportResult> BatchExporter::run(std::span<const ExportJob> jobs, const ExportSettings& settings,
+                                             const ProgressCallback& on_progress, const Common::CancellationToken& token)
+{
+    auto batch { std::make_shared<Batch>() };
+    batch->m_jobs = jobs;
+    batch->m_on_progress = on_progress ? &on_progress : nullptr;
+    batch->m_token = token;
+    batch->m_results.resize(jobs.size());
+    batch->m_budget.resize(jobs.size(), 0);
+    batch->m_remaining = jobs.size();
+
+    // ============================================================
+    // Outputs of every file, the largest first: each is resized from the previous one
+    // ============================================================
+    // Slot 0 is the main output, slot r + 1 the rendition r
+    std::vector<ExportSettings> slot_settings { renditionSettings(settings, { {}, settings.m_format, settings.m_jpeg_quality,
+                                                                              settings.m_max_long_edge }) };
+    for (const ExportRendition& rendition : settings.m_renditions) {
+        slot_settings.push_back(renditionSettings(settings, rendition));
+    }
+    std::vector<std::size_t> slots(slot_settings.size());
+    std::iota(slots.begin(), slots.end(), std::size_t { 0 });
+    std::ranges::stable_sort(slots, std::ranges::greater {}, [&](std::size_t slot) { return orderingEdge(slot_settings[slot]); });
+    for (const std::size_t slot : slots) {
+        batch->m_outputs.push_back(slot_settings[slot]);
+    }
+    batch->m_outputs_left.resize(jobs.size(), batch->m_outputs.size());
+    batch->m_output_paths.resize(jobs.size());
+
+    std::set<std::string> names { std::string(extension(settings.m_format)) };
+    for (const ExportRendition& rendition : settings.m_renditions) {
+        if (!names.insert(rendition.m_suffix + std::string(extension(rendition.m_format))).second) {
+            spdlog::error("[BatchExporter::run]: Rendition '{}' overwrites another output of each file.", rendition.m_suffix);
+            for (std::size_t i = 0; i < jobs.size(); ++i) {
+                batch->m_results[i].m_source_path = jobs[i].m_source_path;
+                finish(batch, i, std::unexpected(ErrorHandling::CoreError::IOError));
+            }
+            return std::move(batch->m_results);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(settings.m_output_directory, ec);
+    if (ec) {
+        spdlog::error("[BatchExporter::run]: Cannot create '{}': {}", settings.m_output_directory.string(), ec.message());
+    }
+
+    // Sources with the same name in different directories get distinct outputs
+    std::set<std::filesystem::path> taken;
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        auto& result { batch->m_results[i] };
+        result.m_source_path = jobs[i].m_source_path;
+        for (int n = 1;; ++n) {
+            std::filesystem::path name { std::filesystem::path(jobs[i].m_source_path).stem() };
+            if (n > 1) {
+                name += "_" + std::to_string(n);
+            }
+            name += extension(settings.m_format);
+            result.m_output_path = settings.m_output_directory / name;
+            result.m_rendition_paths.clear();
+            for (const ExportRendition& rendition : settings.m_renditions) {
+                result.m_rendition_paths.push_back(renditionPathFor(result.m_output_path, rendition));
+            }
+            if (!taken.contains(result.m_output_path)
+                && std::ranges::none_of(result.m_rendition_paths, [&taken](const auto& path) { return taken.contains(path); })) {
+                break;
+            }
+        }
+        taken.insert(result.m_output_path);
+        taken.insert(result.m_rendition_paths.begin(), result.m_rendition_paths.end());
+
+        for (const std::size_t slot : slots) {
+            batch->m_output_paths[i].push_back(slot == 0 ? result.m_output_path : result.m_rendition_paths[slot - 1]);
+        }
+    }
+
+    spdlog::info("[BatchExporter::run]: Exporting {} file(s) to '{}' ({} processor(s)).", jobs.size(),
+                 settings.m_output_directory.string(), m_processors.size());
+
+    // ============================================================
+    // Admit the files within the budget; the stages take over from the decode
+    // ============================================================
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        const std::string& path { jobs[i].m_source_path };
+        if (token.isCancelled()) {
+            finish(batch, i, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+            continue;
+        }
+        if (const auto existing { std::ranges::find_if(batch->m_output_paths[i], [&ec](const auto& output_path) {
+                return std::filesystem::exists(output_path, ec);
+            }) };
+            !settings.m_overwrite && existing != batch->m_output_paths[i].end()) {
+            spdlog::warn("[BatchExporter::run]: '{}' exists, not overwritten.", existing->string());
+            finish(batch, i, std::unexpected(ErrorHandling::CoreError::IOError));
+            continue;
+        }
+
+        const std::size_t estimate { Managers::DecodeService::estimateDecodeBytes(path, ImageConfig::Raw::RawQuality::full) };
+        if (estimate == 0) {
+            spdlog::warn("[BatchExporter::run]: Cannot read '{}'.", path);
+            finish(batch, i, std::unexpected(ErrorHandling::CoreError::FileNotFound));
+            continue;
+        }
+        // Renditions hold one more copy, at most the size of the processed image
+        batch->m_budget[i] = acquireBudget(estimate * (k_footprint_factor + (settings.m_renditions.empty() ? 0 : 1)));
+
+        m_source->decodeAsync(path, ImageConfig::Raw::RawQuality::full, Workers::TaskPriority::Export,
+                              [this, batch, i](const std::string& decoded_path, Managers::DecodeService::Result decoded) {
+            if (!decoded && decoded.error() == ErrorHandling::CoreError::UnsupportedFormat) {
+                // Tile-backed files are not decoded whole: full-size outputs stream strip by strip...
+                const auto& outputs { batch->m_outputs };
+                const auto full_size { static_cast<std::size_t>(std::ranges::count_if(outputs, [](const ExportSettings& output) {
+                    return output.m_max_long_edge == 0;
+                })) };
+                if (full_size > 0) {
+                    m_encode_pool->post(Workers::TaskPriority::Export, [this, batch, i, full_size] {
+                        std::lock_guard lock(m_strip_mutex);
+                        for (std::size_t k = 0; k < full_size; ++k) {
+                            finish(batch, i, m_strip_exporter->exportFile(batch->m_jobs[i], batch->m_output_paths[i][k],
+                                                                          batch->m_outputs[k], batch->m_token), 1);
+                        }
+                    });
+                }
+                // ... the resized ones are read at the size of the largest of them
+                if (full_size < outputs.size()) {
+                    onDecoded(batch, i, m_source->decodeThumbnail(decoded_path, outputs[full_size].m_max_long_edge),
+                              std::nullopt, full_size);
+                }
+                return;
+            }
+            if (!decoded) {
+                onDecoded(batch, i, std::unexpected(decoded.error()));
+                return;
+            }
+
+            auto region { regionOf(**decoded, decoded_path) };
+            if (!region) {
+                onDecoded(batch, i, std::unexpected(region.error()));
+                return;
+            }
+            onDecoded(batch, i, std::move(region->m_image), std::move(region->m_camera_profile));
+        }, token);
+    }
+
+    std::unique_lock lock(batch->m_mutex);
+    batch->m_done.wait(lock, [&batch] { return batch->m_remaining == 0; });
+
+    const auto failed { std::ranges::count_if(batch->m_results, [](const ExportResult& result) { return !result.m_status; }) };
+    spdlog::info("[BatchExporter::run]: Export done: {} written, {} failed.", jobs.size() - static_cast<std::size_t>(failed), failed);
+    return std::move(batch->m_results);
+}
+
+void BatchExporter::onDecoded(const std::shared_ptr<Batch>& batch, std::size_t index,
+                              std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> decoded,
+                              std::optional<std::string> camera_profile, std::size_t first_output)
+{
+    // The outputs made from these pixels (the larger ones conclude on their own)
+    const std::size_t outputs { batch->m_outputs.size() - first_output };
+    if (!decoded) {
+        if (decoded.error() != ErrorHandling::CoreError::LoadCancelled) {
+            spdlog::warn("[BatchExporter::onDecoded]: Cannot decode '{}': {}", batch->m_jobs[index].m_source_path,
+                         ErrorHandling::to_string(decoded.error()));
+        }
+        finish(batch, index, std::unexpected(decoded.error()), outputs);
+        return;
+    }
+
+    m_process_pool->post(Workers::TaskPriority::Export, [this, batch, index, outputs, first_output, image = std::move(*decoded),
+                                                         camera_profile = std::move(camera_profile)]() mutable {
+        const ExportJob& job { batch->m_jobs[index] };
+        if (batch->m_token.isCancelled()) {
+            finish(batch, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled), outputs);
+            return;
+        }
+
+        std::vector<Operations::OperationDescriptor> operations { job.m_operations };
+        Operations::CameraProfile::attachTo(operations, camera_profile);
+        auto processed { process(*image, std::move(operations), batch->m_token) };
+        image.reset();
+        if (!processed) {
+            if (processed.error() != ErrorHandling::CoreError::LoadCancelled) {
+                spdlog::warn("[BatchExporter::onDecoded]: Edits of '{}' not applied: {}", job.m_source_path,
+                             ErrorHandling::to_string(processed.error()));
+            }
+            finish(batch, index, std::unexpected(processed.error()), outputs);
+            return;
+        }
+
+        m_encode_pool->post(Workers::TaskPriority::Export, [this, batch, index, outputs, first_output,
+                                                            result = std::move(*processed)]() mutable {
+            if (batch->m_token.isCancelled()) {
+                finish(batch, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled), outputs);
+                return;
+            }
+            encodeOutputs(batch, index, std::move(result), first_output);
+        });
+    });
+}
+
+void BatchExporter::encodeOutputs(const std::shared_ptr<Batch>& batch, std::size_t index,
+                                  std::unique_ptr<Common::ImageRegion> image, std::size_t first_output)
+{
+    const std::size_t count { batch->m_outputs.size() };
+    // Each output is turned upright at its own size, as it is written
+    const Common::ImageOrientation orientation { sourceOrientation(batch->m_jobs[index].m_source_path) };
+    std::shared_ptr<const Common::ImageRegion> previous { std::move(image) };
+
+    for (std::size_t k = first_output; k < count; ++k) {
+        if (batch->m_token.isCancelled()) {
+            finish(batch, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled), count - k);
+            return;
+        }
+        // From the previous output, not the full image: each downsample reads a smaller source
+        auto resized { fitLongEdge(*previous, batch->m_outputs[k].m_max_long_edge) };
+        if (!resized) {
+            finish(batch, index, std::unexpected(resized.error()), count - k);
+            return;
+        }
+        if (*resized) {
+            previous = std::move(*resized);
+        }
+
+        // The smallest is encoded on this task, the others on their own, while the next ones resize
+        if (k + 1 == count) {
+            finish(batch, index, write(*previous, batch->m_output_paths[index][k], batch->m_outputs[k], orientation), 1);
+            return;
+        }
+        m_encode_pool->post(Workers::TaskPriority::Export, [this, batch, index, k, orientation, output = previous]() {
+            if (batch->m_token.isCancelled()) {
+                finish(batch, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled), 1);
+                return;
+            }
+            finish(batch, index, write(*output, batch->m_output_paths[index][k], batch->m_outputs[k], orientation), 1);
+        });
+    }
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+BatchExporter::render(const ExportJob& job, Common::ImageDim max_long_edge, const Common::CancellationToken& token)
+{
+    auto rendered { renderStored(job, max_long_edge, token) };
+    const Common::ImageOrientation orientation { sourceOrientation(job.m_source_path) };
+    if (!rendered || orientation == Common::ImageOrientation::Normal) {
+        return rendered;
+    }
+    // Turned upright at the output size
+    auto upright { Utils::orient_F32(**rendered, orientation) };
+    if (!upright) {
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    return upright;
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+BatchExporter::renderStored(const ExportJob& job, Common::ImageDim max_long_edge, const Common::CancellationToken& token)
+{
+    auto decoded { m_source->decodeBatch(std::span(&job.m_source_path, 1), ImageConfig::Raw::RawQuality::full, token) };
+    if (!decoded.front()) {
+        // Tile-backed files are read at the output size, never whole
+        if (decoded.front().error() != ErrorHandling::CoreError::UnsupportedFormat || max_long_edge == 0) {
+            return std::unexpected(decoded.front().error());
+        }
+        auto thumbnail { m_source->decodeThumbnail(job.m_source_path, max_long_edge) };
+        if (!thumbnail) {
+            return std::unexpected(thumbnail.error());
+        }
+        return renderImage(**thumbnail, job.m_operations, max_long_edge, token);
+    }
+
+    auto region { regionOf(**decoded.front(), job.m_source_path) };
+    decoded.clear();
+    if (!region) {
+        return std::unexpected(region.error());
+    }
+    std::vector<Operations::OperationDescriptor> operations { job.m_operations };
+    Operations::CameraProfile::attachTo(operations, region->m_camera_profile);
+    return renderImage(*region->m_image, std::move(operations), max_long_edge, token);
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+BatchExporter::renderImage(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> operations,
+                           Common::ImageDim max_long_edge, const Common::CancellationToken& token)
+{
+    auto processed { process(image, std::move(operations), token) };
+    if (!processed) {
+        return processed;
+    }
+    auto resized { fitLongEdge(**processed, max_long_edge) };
+    if (!resized) {
+        return std::unexpected(resized.error());
+    }
+    return *resized ? std::move(*resized) : std::move(*processed);
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+BatchExporter::process(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> operations,
+                       const Common::CancellationToken& token)
+{
+    if (m_processors.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    // The backend predicted faster for this file and its edits: a light edit of a small file
+    // is not worth its transfers to the GPU, a denoised 100 MP RAW is
+    std::optional<Common::MemoryType> preferred;
+    if (const auto cost_model = Config::AppConfig::instance().getBackendCostModel(); cost_model && cost_model->hasGpu()) {
+        preferred = cost_model->selectBackend(image.m_width, image.m_height,
+                                              Operations::chainCost(operations, *m_operation_factory),
+                                              Config::AppConfig::instance().currentEnergyPlan().m_gpu_advantage_threshold);
+    }
+
+    // The first free processor of the preferred backend, else the first free one (the GPU one
+    // when several are): a free processor is never left idle
+    Processor* processor { nullptr };
+    std::unique_lock<std::mutex> lock;
+    for (const bool preferred_only : { true, false }) {
+        for (const auto& candidate : m_processors) {
+            if (preferred_only && (!preferred || candidate->m_backend != *preferred)) {
+                continue;
+            }
+            lock = std::unique_lock(candidate->m_mutex, std::try_to_lock);
+            if (lock.owns_lock()) {
+                processor = candidate.get();
+                break;
+            }
+        }
+        if (processor) {
+            break;
+        }
+    }
+
+    std::unique_ptr<ImageProcessing::IWorkingImageHardware> working;
+    if (!processor) {
+        // All busy: this is the staging thread. With a GPU processor, the file is uploaded
+        // now, during the GPU's current file, and starts computing as soon as the GPU is free.
+        processor = m_processors.front().get();
+        if (processor->m_backend == Common::MemoryType::GPU_MEMORY && preferred != Common::MemoryType::CPU_RAM) {
+            const ImageProcessing::GpuDevices::ScopedDevice device { processor->m_gpu_device };
+            working = ImageProcessing::WorkingImageFactory::create(image, processor->m_backend);
+        } else {
+            processor = m_processors.back().get();
+        }
+        lock = std::unique_lock(processor->m_mutex);
+    }
+
+    // The working copy is first touched, processed and copied out on the processor's node (or GPU)
+    const Common::NumaTopology::ScopedPin pin { processor->m_node };
+    const ImageProcessing::GpuDevices::ScopedDevice device { processor->m_gpu_device };
+
+    if (!working) {
+        working = ImageProcessing::WorkingImageFactory::create(image, processor->m_backend);
+    }
+    if (!working && processor->m_backend != Common::MemoryType::CPU_RAM) {
+        // Out of device memory: this file runs on the CPU
+        working = ImageProcessing::WorkingImageFactory::create(image, Common::MemoryType::CPU_RAM);
+    }
+    if (!working) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    const auto crop { Operations::CropGeometry::of(operations) };
+    processor->m_executor->init(std::move(operations), *m_operation_factory);
+    processor->m_executor->setCancellationToken(token);
+    if (!processor->m_executor->execute(*working)) {
+        return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                   : ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    auto processed { working->exportToCPUCopy() };
+    if (!processed || !crop) {
+        return processed;
+    }
+    // Only the crop was computed: hand out that rectangle
+    auto cropped { crop->extractFrom(**processed) };
+    if (!cropped) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+    return cropped;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+BatchExporter::encode(Common::ImageRegion& image, const std::filesystem::path& output_path, const ExportSettings& settings,
+                      Common::ImageOrientation orientation)
+{
+    auto resized { fitLongEdge(image, settings.m_max_long_edge) };
+    if (!resized) {
+        return std::unexpected(resized.error());
+    }
+    return write(*resized ? **resized : image, output_path, settings, orientation);
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+BatchExporter::fitLongEdge(const Common::ImageRegion& image, Common::ImageDim max_long_edge)
+{
+    const Common::ImageDim long_edge { std::max(image.m_width, image.m_height) };
+    if (max_long_edge == 0 || long_edge <= max_long_edge) {
+        return nullptr;
+    }
+    const double scale { static_cast<double>(max_long_edge) / static_cast<double>(long_edge) };
+    const auto width { std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(image.m_width * scale + 0.5)) };
+    const auto height { std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(image.m_height * scale + 0.5)) };
+    auto resized { Utils::resize_F32(image, width, height) };
+    if (!resized) {
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    return resized;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+BatchExporter::write(const Common::ImageRegion& image, const std::filesystem::path& output_path,
+                     const ExportSettings& settings, Common::ImageOrientation orientation)
+{
+    // The stored frame turned upright, once, at the output size
+    std::unique_ptr<Common::ImageRegion> upright;
+    if (orientation != Common::ImageOrientation::Normal) {
+        upright = Utils::orient_F32(image, orientation);
+        if (!upright) {
+            return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+        }
+    }
+    const Common::ImageRegion& output { upright ? *upright : image };
+
+    // Encode aside, then rename
+    OutputWriter writer;
+    if (auto opened = writer.open(output_path, output.m_width, output.m_height, settings); !opened) {
+        return opened;
+    }
+    if (auto written = writer.writeRows(0, output.m_height, output.m_data.data()); !written) {
+        return written;
+    }
+    if (auto committed = writer.commit(); !committed) {
+        return committed;
+    }
+
+    spdlog::debug("[BatchExporter::write]: Wrote '{}' ({}x{})", output_path.string(), output.m_width, output.m_height);
+    return {};
+}
+
+Common::ImageOrientation BatchExporter::sourceOrientation(std::string_view path) const
+{
+    const auto metadata { m_source->readMetadata(path) };
+    return metadata ? Common::orientationFromExif(metadata->m_orientation) : Common::ImageOrientation::Normal;
+}
+
+void BatchExporter::finish(const std::shared_ptr<Batch>& batch, std::size_t index,
+                           std::expected<void, ErrorHandling::CoreError> status, std::size_t outputs)
+{
+    std::lock_guard lock(batch->m_mutex);
+    ExportResult& result { batch->m_results[index] };
+    if (!status && result.m_status) {
+        // The first failure of the file stands
+        result.m_status = status;
+    }
+    std::size_t& left { batch->m_outputs_left[index] };
+    left -= std::min(outputs, left);
+    if (left > 0) {
+        return;
+    }
+
+    releaseBudget(std::exchange(batch->m_budget[index], 0));
+    if (batch->m_on_progress) {
+        (*batch->m_on_progress)(index, result);
+    }
+    if (--batch->m_remaining == 0) {
+        batch->m_done.notify_all();
+    }
+}
+
+std::size_t BatchExporter::acquireBudget(std::size_t bytes)
+{
+    const std::size_t taken { std::min(bytes, m_memory_budget_bytes) };
+
+    std::unique_lock lock(m_budget_mutex);
+    // A file larger than the whole budget runs alone
+    m_budget_released.wait(lock, [this, taken] {
+        return m_in_flight_bytes == 0 || m_in_flight_bytes + taken <= m_memory_budget_bytes;
+    });
+    m_in_flight_bytes += taken;
+    return taken;
+}
+
+void BatchExporter::releaseBudget(std::size_t bytes)
+{
+    if (bytes == 0) {
+        return;
+    }
+    {
+        std::lock_guard lock(m_budget_mutex);
+        m_in_flight_bytes -= bytes;
+    }
+    m_budget_released.notify_all();
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,149 @@
+/**
+ * @file output_writer.cpp
+ * @brief Implementation of OutputWriter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/output_writer.h"
+#include "utils/quantize.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+
+namespace CaptureMoment::Core::Export {
+
+OutputWriter::~OutputWriter()
+{
+    discard();
+}
+
+std::expected<void, ErrorHandling::CoreError>
+OutputWriter::open(const std::filesystem::path& output_path, Common::ImageDim width, Common::ImageDim height,
+                   const ExportSettings& settings, Common::ImageOrientation orientation)
+{
+    const char* format_name { "jpeg" };
+    OIIO::TypeDesc type { OIIO::TypeDesc::UINT8 };
+    std::string compression { "jpeg:" + std::to_string(std::clamp(settings.m_jpeg_quality, 1, 100)) };
+    if (settings.m_format == ExportFormat::Tiff) {
+        format_name = "tiff";
+        type = OIIO::TypeDesc::UINT16;
+        compression = "zip";
+    } else if (settings.m_format == ExportFormat::Exr) {
+        format_name = "openexr";
+        type = OIIO::TypeDesc::HALF;
+        compression = "zip";
+    }
+
+    m_output = OIIO::ImageOutput::create(format_name);
+    if (!m_output) {
+        spdlog::error("[OutputWriter::open]: No {} writer: {}", format_name, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    m_format = settings.m_format;
+    m_dither = settings.m_dither;
+    m_width = width;
+    const bool display_referred { m_format != ExportFormat::Exr };
+
+    OIIO::ImageSpec spec(static_cast<int>(width), static_cast<int>(height), 3, type);
+    spec.attribute("Compression", compression);
+    spec.attribute("oiio:ColorSpace", display_referred ? "sRGB" : "lin_rec709_scene");
+    if (orientation != Common::ImageOrientation::Normal) {
+        spec.attribute("Orientation", static_cast<int>(orientation));
+    }
+
+    m_output_path = output_path;
+    m_partial_path = output_path;
+    m_partial_path += ".part";
+
+    if (!m_output->open(m_partial_path.string(), spec)) {
+        spdlog::error("[OutputWriter::open]: Cannot create '{}': {}", m_partial_path.string(), m_output->geterror());
+        m_output.reset();
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+OutputWriter::writeRows(Common::ImageDim y, Common::ImageDim rows, const float* rgba)
+{
+    if (!m_output) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    const std::size_t src_stride { static_cast<std::size_t>(m_width) * 4 };
+    const std::size_t dst_stride { static_cast<std::size_t>(m_width) * 3 };
+    const Utils::QuantizeSettings quantize { .m_transfer = Utils::OutputTransfer::Srgb, .m_dither = m_dither, .m_origin_y = y };
+
+    OIIO::TypeDesc type { OIIO::TypeDesc::FLOAT };
+    const void* data { rgba };
+    OIIO::stride_t pixel_stride { OIIO::AutoStride };
+
+    switch (m_format) {
+    case ExportFormat::Jpeg:
+        m_rows_u8.resize(dst_stride * rows);
+        Utils::quantizeRowsU8(rgba, src_stride, m_rows_u8.data(), dst_stride, m_width, rows, 3, quantize);
+        type = OIIO::TypeDesc::UINT8;
+        data = m_rows_u8.data();
+        break;
+    case ExportFormat::Tiff:
+        m_rows_u16.resize(dst_stride * rows);
+        Utils::quantizeRowsU16(rgba, src_stride, m_rows_u16.data(), dst_stride, m_width, rows, 3, quantize);
+        type = OIIO::TypeDesc::UINT16;
+        data = m_rows_u16.data();
+        break;
+    case ExportFormat::Exr:
+        // Scene-linear RGB: the alpha is skipped through the pixel stride
+        pixel_stride = static_cast<OIIO::stride_t>(4 * sizeof(float));
+        break;
+    }
+
+    if (!m_output->write_scanlines(static_cast<int>(y), static_cast<int>(y + rows), 0, type, data, pixel_stride)) {
+        spdlog::error("[OutputWriter::writeRows]: Writing '{}' failed: {}", m_output_path.string(), m_output->geterror());
+        discard();
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError> OutputWriter::commit()
+{
+    if (!m_output) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    if (!m_output->close()) {
+        spdlog::error("[OutputWriter::commit]: Writing '{}' failed: {}", m_output_path.string(), m_output->geterror());
+        discard();
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    m_output.reset();
+
+    std::error_code ec;
+    std::filesystem::rename(m_partial_path, m_output_path, ec);
+    if (ec) {
+        spdlog::error("[OutputWriter::commit]: Cannot install '{}': {}", m_output_path.string(), ec.message());
+        std::filesystem::remove(m_partial_path, ec);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    m_partial_path.clear();
+    return {};
+}
+
+void OutputWriter::discard() noexcept
+{
+    if (m_output) {
+        m_output->close();
+        m_output.reset();
+    }
+    if (!m_partial_path.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(m_partial_path, ec);
+        m_partial_path.clear();
+    }
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,475 @@
+/**
+ * @file render_channel.cpp
+ * @brief Implementation of RenderChannel.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_channel.h"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+using Json = nlohmann::json;
+
+/**
+ * @brief Layout version of the payloads (CBOR); messages of another version are refused.
+ */
+constexpr int k_channel_format_version { 1 };
+
+/**
+ * @brief First bytes of every message ("CMRD").
+ */
+constexpr std::uint32_t k_magic { 0x434D5244 };
+
+/**
+ * @brief Precedes every payload (same host: native byte order).
+ */
+struct Header {
+    std::uint32_t m_magic;
+    std::uint32_t m_size;
+};
+
+#if !defined(_WIN32)
+#if defined(MSG_NOSIGNAL)
+constexpr int k_send_flags { MSG_NOSIGNAL };
+#else
+constexpr int k_send_flags { 0 };
+#endif
+
+/**
+ * @brief Sends the whole buffer (the peer closing the connection is an error, not a signal).
+ */
+[[nodiscard]] bool sendAll(int socket, const std::byte* data, std::size_t size)
+{
+    while (size > 0) {
+        const ssize_t sent { ::send(socket, data, size, k_send_flags) };
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * @brief Receives exactly `size` bytes (false at the end of the connection).
+ */
+[[nodiscard]] bool receiveAll(int socket, std::byte* data, std::size_t size)
+{
+    while (size > 0) {
+        const ssize_t received { ::recv(socket, data, size, 0) };
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+#endif
+
+/**
+ * @brief Describes a shared image (its pixels travel as the descriptor of the message).
+ */
+[[nodiscard]] Json imageToJson(const SharedImage& image)
+{
+    return Json {
+        { "width", image.m_width },
+        { "height", image.m_height },
+        { "format", static_cast<int>(image.m_format) },
+    };
+}
+
+/**
+ * @brief Maps the received descriptor as the pixels of an image described by `object`.
+ * @return The image, or `DecodingError` if the region is missing or smaller than the pixels.
+ */
+[[nodiscard]] std::expected<SharedImage, ErrorHandling::CoreError> imageFromJson(const Json& object, int& descriptor)
+{
+    if (descriptor < 0) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    SharedImage image;
+    image.m_width = object.at("width").get<Common::ImageDim>();
+    image.m_height = object.at("height").get<Common::ImageDim>();
+    image.m_format = static_cast<RenderPixelFormat>(object.at("format").get<int>());
+    if (image.m_format != RenderPixelFormat::Srgb8 && image.m_format != RenderPixelFormat::LinearF32) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    auto memory { Common::SharedMemory::adopt(std::exchange(descriptor, -1), false) };
+    if (!memory) {
+        return std::unexpected(memory.error());
+    }
+    if (image.m_width == 0 || image.m_height == 0
+        || memory->bytes().size() < SharedImage::byteSize(image.m_width, image.m_height, image.m_format)) {
+        spdlog::warn("[RenderChannel]: A {}x{} image came in a region of {} bytes", image.m_width, image.m_height,
+                     memory->bytes().size());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    image.m_memory = std::move(*memory);
+    return image;
+}
+
+} // anonymous namespace
+
+struct RenderChannel::Message {
+    Message() = default;
+    Message(Message&& other) noexcept
+        : m_payload(std::move(other.m_payload))
+        , m_descriptor(std::exchange(other.m_descriptor, -1))
+    {
+    }
+    Message& operator=(Message&&) = delete;
+
+    ~Message()
+    {
+#if !defined(_WIN32)
+        if (m_descriptor >= 0) {
+            ::close(m_descriptor);
+        }
+#endif
+    }
+
+    std::vector<std::uint8_t> m_payload;
+    /** @brief Descriptor that came with the message, until adopted (-1 if none). */
+    int m_descriptor{-1};
+};
+
+std::expected<SharedImage, ErrorHandling::CoreError> SharedImage::share(const Common::ImageRegion& image)
+{
+    if (!image.isValid() || image.m_channels != 4) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+    const std::size_t size { byteSize(image.m_width, image.m_height, RenderPixelFormat::LinearF32) };
+    auto memory { Common::SharedMemory::create(size) };
+    if (!memory) {
+        return std::unexpected(memory.error());
+    }
+    std::memcpy(memory->writableBytes().data(), image.m_data.data(), size);
+    return SharedImage { std::move(*memory), image.m_width, image.m_height, RenderPixelFormat::LinearF32 };
+}
+
+std::expected<RenderChannel, ErrorHandling::CoreError> RenderChannel::connect(const std::filesystem::path& socket_path)
+{
+#if defined(_WIN32)
+    (void)socket_path;
+    spdlog::error("[RenderChannel::connect]: Not available on Windows");
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path { socket_path.string() };
+    if (path.size() >= sizeof(address.sun_path)) {
+        spdlog::error("[RenderChannel::connect]: Socket path too long: '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    RenderChannel channel(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (channel.m_descriptor < 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    ::fcntl(channel.m_descriptor, F_SETFD, FD_CLOEXEC);
+#if defined(SO_NOSIGPIPE)
+    const int on { 1 };
+    ::setsockopt(channel.m_descriptor, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    if (::connect(channel.m_descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        const bool absent { errno == ENOENT || errno == ECONNREFUSED };
+        spdlog::debug("[RenderChannel::connect]: Cannot connect to '{}': {}", path, std::strerror(errno));
+        return std::unexpected(absent ? ErrorHandling::CoreError::FileNotFound : ErrorHandling::CoreError::IOError);
+    }
+    return channel;
+#endif
+}
+
+std::expected<std::pair<RenderChannel, RenderChannel>, ErrorHandling::CoreError> RenderChannel::pair()
+{
+#if defined(_WIN32)
+    spdlog::error("[RenderChannel::pair]: Not available on Windows");
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    std::array<int, 2> descriptors {};
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors.data()) != 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    for (const int descriptor : descriptors) {
+        ::fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+#if defined(SO_NOSIGPIPE)
+        const int on { 1 };
+        ::setsockopt(descriptor, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    }
+    return std::pair { RenderChannel(descriptors[0]), RenderChannel(descriptors[1]) };
+#endif
+}
+
+RenderChannel::~RenderChannel()
+{
+    reset();
+}
+
+RenderChannel::RenderChannel(RenderChannel&& other) noexcept
+    : m_descriptor(std::exchange(other.m_descriptor, -1))
+{
+}
+
+RenderChannel& RenderChannel::operator=(RenderChannel&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        m_descriptor = std::exchange(other.m_descriptor, -1);
+    }
+    return *this;
+}
+
+void RenderChannel::reset() noexcept
+{
+#if !defined(_WIN32)
+    if (m_descriptor >= 0) {
+        ::close(m_descriptor);
+    }
+#endif
+    m_descriptor = -1;
+}
+
+bool RenderChannel::waitReadable(std::chrono::milliseconds timeout) const
+{
+#if defined(_WIN32)
+    (void)timeout;
+    return false;
+#else
+    pollfd entry { m_descriptor, POLLIN, 0 };
+    return ::poll(&entry, 1, static_cast<int>(timeout.count())) > 0;
+#endif
+}
+
+std::expected<void, ErrorHandling::CoreError> RenderChannel::send(const RenderRequest& request)
+{
+    const std::string& blob { request.m_edit_blob };
+    Json object {
+        { "version", k_channel_format_version },
+        { "source", request.m_source_path },
+        { "edits", Json::binary(std::vector<std::uint8_t>(blob.begin(), blob.end())) },
+        { "max_long_edge", request.m_max_long_edge },
+        { "format", static_cast<int>(request.m_format) },
+        { "dither", static_cast<int>(request.m_dither) },
+    };
+    if (request.m_input) {
+        object["input"] = imageToJson(*request.m_input);
+    }
+    return sendMessage(Json::to_cbor(object), request.m_input ? request.m_input->m_memory.descriptor() : -1);
+}
+
+std::expected<void, ErrorHandling::CoreError> RenderChannel::send(const RenderReply& reply)
+{
+    Json object {
+        { "version", k_channel_format_version },
+        { "status", reply.m_image ? 0 : static_cast<int>(reply.m_image.error()) },
+    };
+    if (reply.m_image) {
+        object["image"] = imageToJson(*reply.m_image);
+    }
+    return sendMessage(Json::to_cbor(object), reply.m_image ? reply.m_image->m_memory.descriptor() : -1);
+}
+
+std::expected<RenderRequest, ErrorHandling::CoreError> RenderChannel::receiveRequest()
+{
+    auto message { receiveMessage() };
+    if (!message) {
+        return std::unexpected(message.error());
+    }
+
+    try {
+        const Json object = Json::from_cbor(message->m_payload);
+        if (object.at("version").get<int>() != k_channel_format_version) {
+            spdlog::warn("[RenderChannel::receiveRequest]: Request of another version");
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        RenderRequest request;
+        request.m_source_path = object.at("source").get<std::string>();
+        const auto& edits { object.at("edits").get_binary() };
+        request.m_edit_blob.assign(edits.begin(), edits.end());
+        request.m_max_long_edge = object.at("max_long_edge").get<Common::ImageDim>();
+        request.m_format = static_cast<RenderPixelFormat>(object.at("format").get<int>());
+        request.m_dither = static_cast<Utils::DitherMode>(object.at("dither").get<int>());
+        if (const auto input { object.find("input") }; input != object.end()) {
+            auto image { imageFromJson(*input, message->m_descriptor) };
+            if (!image) {
+                return std::unexpected(image.error());
+            }
+            request.m_input = std::move(*image);
+        }
+        return request;
+    } catch (const Json::exception& error) {
+        spdlog::warn("[RenderChannel::receiveRequest]: Malformed request: {}", error.what());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+}
+
+std::expected<RenderReply, ErrorHandling::CoreError> RenderChannel::receiveReply()
+{
+    auto message { receiveMessage() };
+    if (!message) {
+        return std::unexpected(message.error());
+    }
+
+    try {
+        const Json object = Json::from_cbor(message->m_payload);
+        if (object.at("version").get<int>() != k_channel_format_version) {
+            spdlog::warn("[RenderChannel::receiveReply]: Reply of another version");
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        if (const int status { object.at("status").get<int>() }; status != 0) {
+            return RenderReply { std::unexpected(static_cast<ErrorHandling::CoreError>(status)) };
+        }
+        auto image { imageFromJson(object.at("image"), message->m_descriptor) };
+        if (!image) {
+            return std::unexpected(image.error());
+        }
+        return RenderReply { std::move(*image) };
+    } catch (const Json::exception& error) {
+        spdlog::warn("[RenderChannel::receiveReply]: Malformed reply: {}", error.what());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+}
+
+std::expected<void, ErrorHandling::CoreError>
+RenderChannel::sendMessage(const std::vector<std::uint8_t>& payload, int descriptor)
+{
+#if defined(_WIN32)
+    (void)payload;
+    (void)descriptor;
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    if (payload.size() > k_max_payload_bytes) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    Header header { k_magic, static_cast<std::uint32_t>(payload.size()) };
+
+    // The descriptor rides on the header bytes
+    iovec vector { &header, sizeof(header) };
+    msghdr message{};
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    alignas(cmsghdr) std::array<std::byte, CMSG_SPACE(sizeof(int))> control {};
+    if (descriptor >= 0) {
+        message.msg_control = control.data();
+        message.msg_controllen = control.size();
+        cmsghdr* entry { CMSG_FIRSTHDR(&message) };
+        entry->cmsg_level = SOL_SOCKET;
+        entry->cmsg_type = SCM_RIGHTS;
+        entry->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(entry), &descriptor, sizeof(int));
+    }
+
+    ssize_t sent;
+    do {
+        sent = ::sendmsg(m_descriptor, &message, k_send_flags);
+    } while (sent < 0 && errno == EINTR);
+    if (sent <= 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    const auto* header_bytes { reinterpret_cast<const std::byte*>(&header) };
+    if (!sendAll(m_descriptor, header_bytes + sent, sizeof(header) - static_cast<std::size_t>(sent))
+        || !sendAll(m_descriptor, reinterpret_cast<const std::byte*>(payload.data()), payload.size())) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return {};
+#endif
+}
+
+std::expected<RenderChannel::Message, ErrorHandling::CoreError> RenderChannel::receiveMessage()
+{
+#if defined(_WIN32)
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    Message received;
+    Header header {};
+
+    iovec vector { &header, sizeof(header) };
+    msghdr message{};
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    alignas(cmsghdr) std::array<std::byte, CMSG_SPACE(sizeof(int))> control {};
+    message.msg_control = control.data();
+    message.msg_controllen = control.size();
+
+#if defined(MSG_CMSG_CLOEXEC)
+    constexpr int k_receive_flags { MSG_CMSG_CLOEXEC };
+#else
+    constexpr int k_receive_flags { 0 };
+#endif
+    ssize_t header_read;
+    do {
+        header_read = ::recvmsg(m_descriptor, &message, k_receive_flags);
+    } while (header_read < 0 && errno == EINTR);
+    if (header_read <= 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    for (cmsghdr* entry { CMSG_FIRSTHDR(&message) }; entry; entry = CMSG_NXTHDR(&message, entry)) {
+        if (entry->cmsg_level != SOL_SOCKET || entry->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        // One descriptor per message: any other one is closed
+        const std::size_t count { (entry->cmsg_len - CMSG_LEN(0)) / sizeof(int) };
+        for (std::size_t i = 0; i < count; ++i) {
+            int descriptor;
+            std::memcpy(&descriptor, CMSG_DATA(entry) + i * sizeof(int), sizeof(int));
+            if (received.m_descriptor < 0) {
+                received.m_descriptor = descriptor;
+            } else {
+                ::close(descriptor);
+            }
+        }
+    }
+    if ((message.msg_flags & MSG_CTRUNC) != 0) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    auto* header_bytes { reinterpret_cast<std::byte*>(&header) };
+    if (!receiveAll(m_descriptor, header_bytes + header_read, sizeof(header) - static_cast<std::size_t>(header_read))) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    if (header.m_magic != k_magic || header.m_size > k_max_payload_bytes) {
+        spdlog::warn("[RenderChannel::receiveMessage]: Not a render message");
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    received.m_payload.resize(header.m_size);
+    if (!receiveAll(m_descriptor, reinterpret_cast<std::byte*>(received.m_payload.data()), header.m_size)) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return received;
+#endif
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,38 @@
+/**
+ * @file render_client.cpp
+ * @brief Implementation of RenderClient.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_client.h"
+
+#include <spdlog/spdlog.h>
+
+#include <utility>
+
+namespace CaptureMoment::Core::Export {
+
+std::expected<RenderClient, ErrorHandling::CoreError> RenderClient::connect(const std::filesystem::path& socket_path)
+{
+    auto channel { RenderChannel::connect(socket_path) };
+    if (!channel) {
+        return std::unexpected(channel.error());
+    }
+    return RenderClient(std::move(*channel));
+}
+
+std::expected<SharedImage, ErrorHandling::CoreError> RenderClient::render(const RenderRequest& request)
+{
+    if (auto sent = m_channel.send(request); !sent) {
+        spdlog::warn("[RenderClient::render]: The server is gone");
+        return std::unexpected(sent.error());
+    }
+    auto reply { m_channel.receiveReply() };
+    if (!reply) {
+        return std::unexpected(reply.error());
+    }
+    return std::move(reply->m_image);
+}
+
+} // namespace CaptureMoment::Core::Export
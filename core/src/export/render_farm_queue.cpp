@@ -0,0 +1,440 @@
+/**
+ * @file render_farm_queue.cpp
+ * @brief Implementation of RenderFarmQueue.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_farm_queue.h"
+#include "managers/source_manager.h"
+#include "serializer/binary_edit_format.h"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+using Json = nlohmann::json;
+
+/**
+ * @brief Layout version of the job and result files (CBOR); files of another version are skipped.
+ */
+constexpr int k_farm_format_version { 1 };
+
+constexpr std::string_view k_job_extension { ".job" };
+constexpr std::string_view k_result_extension { ".result" };
+constexpr std::string_view k_part_extension { ".part" };
+
+[[nodiscard]] std::filesystem::path jobsDirectory(const std::filesystem::path& root) { return root / "jobs"; }
+[[nodiscard]] std::filesystem::path claimedDirectory(const std::filesystem::path& root) { return root / "claimed"; }
+[[nodiscard]] std::filesystem::path resultsDirectory(const std::filesystem::path& root) { return root / "results"; }
+
+/**
+ * @brief Writes a file aside, then renames it in place.
+ * @param replace false to keep an existing file (then nothing is written).
+ */
+[[nodiscard]] std::expected<void, ErrorHandling::CoreError>
+writeFile(const std::filesystem::path& path, const std::vector<std::uint8_t>& bytes, bool replace = true)
+{
+    std::error_code ec;
+    if (!replace && std::filesystem::exists(path, ec)) {
+        return {};
+    }
+
+    std::filesystem::path part { path };
+    part += k_part_extension;
+    {
+        std::ofstream stream(part, std::ios::binary | std::ios::trunc);
+        if (!stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+            spdlog::error("[RenderFarmQueue::writeFile]: Cannot write '{}'", part.string());
+            std::filesystem::remove(part, ec);
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    std::filesystem::rename(part, path, ec);
+    if (ec) {
+        spdlog::error("[RenderFarmQueue::writeFile]: Cannot rename '{}': {}", part.string(), ec.message());
+        std::filesystem::remove(part, ec);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    return {};
+}
+
+/**
+ * @brief Reads a CBOR file.
+ * @return The object, or `std::nullopt` if the file is missing, not CBOR or of another version.
+ */
+[[nodiscard]] std::optional<Json> readFile(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return std::nullopt;
+    }
+    const std::vector<std::uint8_t> bytes { std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+    Json object = Json::from_cbor(bytes, true, false);
+    if (object.is_discarded() || !object.is_object() || object.value("version", 0) != k_farm_format_version) {
+        spdlog::warn("[RenderFarmQueue::readFile]: Skipping '{}' (not a farm file of version {})",
+                     path.string(), k_farm_format_version);
+        return std::nullopt;
+    }
+    return object;
+}
+
+[[nodiscard]] Json settingsToJson(const ExportSettings& settings)
+{
+    Json renditions = Json::array();
+    for (const ExportRendition& rendition : settings.m_renditions) {
+        renditions.push_back({
+            { "suffix", rendition.m_suffix },
+            { "format", static_cast<int>(rendition.m_format) },
+            { "jpeg_quality", rendition.m_jpeg_quality },
+            { "max_long_edge", rendition.m_max_long_edge },
+        });
+    }
+    return Json {
+        { "format", static_cast<int>(settings.m_format) },
+        { "jpeg_quality", settings.m_jpeg_quality },
+        { "dither", static_cast<int>(settings.m_dither) },
+        { "max_long_edge", settings.m_max_long_edge },
+        { "output_directory", settings.m_output_directory.string() },
+        { "overwrite", settings.m_overwrite },
+        { "renditions", std::move(renditions) },
+    };
+}
+
+[[nodiscard]] ExportSettings settingsFromJson(const Json& object)
+{
+    ExportSettings settings;
+    settings.m_format = static_cast<ExportFormat>(object.at("format").get<int>());
+    settings.m_jpeg_quality = object.at("jpeg_quality").get<int>();
+    settings.m_dither = static_cast<Utils::DitherMode>(object.at("dither").get<int>());
+    settings.m_max_long_edge = object.at("max_long_edge").get<Common::ImageDim>();
+    settings.m_output_directory = object.at("output_directory").get<std::string>();
+    settings.m_overwrite = object.at("overwrite").get<bool>();
+    // Absent from the jobs of earlier builds
+    if (const auto renditions { object.find("renditions") }; renditions != object.end()) {
+        for (const Json& rendition : *renditions) {
+            settings.m_renditions.push_back({
+                rendition.at("suffix").get<std::string>(),
+                static_cast<ExportFormat>(rendition.at("format").get<int>()),
+                rendition.at("jpeg_quality").get<int>(),
+                rendition.at("max_long_edge").get<Common::ImageDim>(),
+            });
+        }
+    }
+    return settings;
+}
+
+/**
+ * @brief Id of a submission: unique across the hosts and processes sharing a queue.
+ */
+[[nodiscard]] std::string newSubmissionId()
+{
+    std::random_device device;
+    const auto now { std::chrono::system_clock::now().time_since_epoch() };
+    return std::format("{:x}-{:08x}", std::chrono::duration_cast<std::chrono::milliseconds>(now).count(), device());
+}
+
+/**
+ * @brief A failed result of a job, reported by the queue itself.
+ */
+[[nodiscard]] FarmResult failedResult(std::string id, std::string source_path, ErrorHandling::CoreError error)
+{
+    return FarmResult { std::move(id), std::move(source_path), {}, {}, std::unexpected(error) };
+}
+
+} // namespace
+
+RenderFarmQueue::RenderFarmQueue(std::filesystem::path root)
+    : m_root(std::move(root))
+{
+}
+
+std::filesystem::path RenderFarmQueue::pipelineCacheDirectory() const
+{
+    return m_root / "pipelines";
+}
+
+std::expected<std::vector<std::string>, ErrorHandling::CoreError>
+RenderFarmQueue::submit(std::span<const ExportJob> jobs, const ExportSettings& settings) const
+{
+    std::error_code ec;
+    for (const auto& directory : { jobsDirectory(m_root), claimedDirectory(m_root), resultsDirectory(m_root) }) {
+        std::filesystem::create_directories(directory, ec);
+        if (ec) {
+            spdlog::error("[RenderFarmQueue::submit]: Cannot create '{}': {}", directory.string(), ec.message());
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    const std::string submission { newSubmissionId() };
+    const Json settings_object = settingsToJson(settings);
+
+    // Sizes from the headers alone, for the workers to predict each job's rendering time
+    std::vector<std::string> paths;
+    paths.reserve(jobs.size());
+    for (const ExportJob& job : jobs) {
+        paths.push_back(job.m_source_path);
+    }
+    const auto headers { Managers::SourceManager().readMetadataBatch(paths) };
+
+    std::vector<std::string> ids;
+    ids.reserve(jobs.size());
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        std::string id { std::format("{}-{:06}", submission, index) };
+        const std::string blob { Serializer::encodeEditStack(jobs[index].m_operations) };
+
+        const Operations::ChainCost cost { Operations::chainCost(jobs[index].m_operations) };
+        const bool sized { index < headers.size() && headers[index].has_value() };
+
+        const Json job {
+            { "version", k_farm_format_version },
+            { "id", id },
+            { "source", jobs[index].m_source_path },
+            { "edits", Json::binary(std::vector<std::uint8_t>(blob.begin(), blob.end())) },
+            { "settings", settings_object },
+            { "cost", {
+                { "width", sized ? headers[index]->m_width : 0 },
+                { "height", sized ? headers[index]->m_height : 0 },
+                { "cpu_ns_per_pixel", cost.m_cpu_ns_per_pixel },
+                { "gpu_ns_per_pixel", cost.m_gpu_ns_per_pixel },
+                { "halo_pixels", cost.m_halo_pixels },
+                { "spatial_operations", cost.m_spatial_operations },
+            } },
+        };
+
+        auto written { writeFile(jobsDirectory(m_root) / (id + std::string(k_job_extension)), Json::to_cbor(job)) };
+        if (!written) {
+            return std::unexpected(written.error());
+        }
+        ids.push_back(std::move(id));
+    }
+
+    spdlog::info("[RenderFarmQueue::submit]: {} job(s) queued in '{}' (submission {})", ids.size(), m_root.string(), submission);
+    return ids;
+}
+
+std::vector<FarmResult> RenderFarmQueue::wait(std::span<const std::string> ids, const ResultCallback& on_result,
+                                              const Common::CancellationToken& token,
+                                              std::chrono::seconds stale_after) const
+{
+    std::vector<std::optional<FarmResult>> results(ids.size());
+    std::unordered_map<std::string, std::size_t> pending;
+    pending.reserve(ids.size());
+    for (std::size_t index = 0; index < ids.size(); ++index) {
+        pending.emplace(ids[index], index);
+    }
+
+    // One listing per round: polling every id would cost a round trip each on network storage
+    while (!pending.empty() && !token.isCancelled()) {
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(resultsDirectory(m_root), ec), end; !ec && it != end; it.increment(ec)) {
+            const std::filesystem::path& path { it->path() };
+            if (path.extension() != k_result_extension) {
+                continue;
+            }
+            const auto found { pending.find(path.stem().string()) };
+            if (found == pending.end()) {
+                continue;
+            }
+            auto collected { result(found->first) };
+            if (!collected) {
+                continue;
+            }
+
+            const std::size_t index { found->second };
+            pending.erase(found);
+            results[index] = std::move(collected);
+            if (on_result) {
+                on_result(index, *results[index]);
+            }
+        }
+
+        if (!pending.empty()) {
+            requeueStale(stale_after);
+            std::this_thread::sleep_for(k_poll_interval);
+        }
+    }
+
+    std::vector<FarmResult> ordered;
+    ordered.reserve(ids.size());
+    for (std::size_t index = 0; index < ids.size(); ++index) {
+        ordered.push_back(results[index] ? std::move(*results[index])
+                                         : failedResult(ids[index], {}, ErrorHandling::CoreError::LoadCancelled));
+    }
+    return ordered;
+}
+
+std::vector<FarmJob> RenderFarmQueue::claim(std::string_view worker, std::size_t max_jobs,
+                                            const JobEstimator& estimate, double max_milliseconds) const
+{
+    std::vector<FarmJob> claimed;
+    double claimed_milliseconds { 0.0 };
+    const bool timed { estimate && max_milliseconds > 0.0 };
+    std::error_code ec;
+    std::filesystem::create_directories(claimedDirectory(m_root), ec);
+
+    for (std::filesystem::directory_iterator it(jobsDirectory(m_root), ec), end;
+         !ec && it != end && claimed.size() < max_jobs && (!timed || claimed_milliseconds < max_milliseconds);
+         it.increment(ec)) {
+        const std::filesystem::path& path { it->path() };
+        if (path.extension() != k_job_extension) {
+            continue;
+        }
+
+        // The rename is the claim: another worker that got there first makes it fail
+        const std::filesystem::path target { claimedDirectory(m_root) / path.filename() };
+        std::error_code rename_error;
+        std::filesystem::rename(path, target, rename_error);
+        if (rename_error) {
+            continue;
+        }
+        // The age of a claim (`requeueStale`) counts from now
+        std::filesystem::last_write_time(target, std::filesystem::file_time_type::clock::now(), rename_error);
+
+        // An unreadable job fails at once: no worker could render it
+        const auto reject = [&](std::string_view reason) {
+            spdlog::error("[RenderFarmQueue::claim]: Invalid job '{}': {}", target.string(), reason);
+            FarmResult failed { failedResult(path.stem().string(), {}, ErrorHandling::CoreError::DecodingError) };
+            failed.m_worker = std::string(worker);
+            (void)complete(failed);
+        };
+
+        const auto object { readFile(target) };
+        if (!object) {
+            reject("unreadable");
+            continue;
+        }
+        try {
+            const auto& edits { object->at("edits").get_binary() };
+            FarmJob job {
+                object->at("id").get<std::string>(),
+                object->at("source").get<std::string>(),
+                std::string(edits.begin(), edits.end()),
+                settingsFromJson(object->at("settings")),
+            };
+            // Absent from the jobs of earlier builds: their cost is unknown
+            if (const auto cost { object->find("cost") }; cost != object->end()) {
+                job.m_width = cost->at("width").get<Common::ImageDim>();
+                job.m_height = cost->at("height").get<Common::ImageDim>();
+                job.m_cost.m_cpu_ns_per_pixel = cost->at("cpu_ns_per_pixel").get<double>();
+                job.m_cost.m_gpu_ns_per_pixel = cost->at("gpu_ns_per_pixel").get<double>();
+                job.m_cost.m_halo_pixels = cost->at("halo_pixels").get<Common::ImageDim>();
+                job.m_cost.m_spatial_operations = cost->at("spatial_operations").get<std::size_t>();
+            }
+            claimed.push_back(std::move(job));
+        } catch (const Json::exception& e) {
+            reject(e.what());
+            continue;
+        }
+
+        if (timed) {
+            claimed_milliseconds += estimate(claimed.back());
+        }
+    }
+
+    if (!claimed.empty()) {
+        spdlog::debug("[RenderFarmQueue::claim]: '{}' claimed {} job(s) (predicted {:.0f} ms)", worker, claimed.size(),
+                      claimed_milliseconds);
+    }
+    return claimed;
+}
+
+std::expected<void, ErrorHandling::CoreError> RenderFarmQueue::complete(const FarmResult& result) const
+{
+    const Json object {
+        { "version", k_farm_format_version },
+        { "id", result.m_id },
+        { "source", result.m_source_path },
+        { "output", result.m_output_path.string() },
+        { "worker", result.m_worker },
+        { "status", static_cast<int>(result.m_status ? ErrorHandling::CoreError::Success : result.m_status.error()) },
+    };
+
+    std::error_code ec;
+    std::filesystem::create_directories(resultsDirectory(m_root), ec);
+    auto written { writeFile(resultsDirectory(m_root) / (result.m_id + std::string(k_result_extension)),
+                             Json::to_cbor(object), false) };
+    if (!written) {
+        return written;
+    }
+
+    std::filesystem::remove(claimedDirectory(m_root) / (result.m_id + std::string(k_job_extension)), ec);
+    return {};
+}
+
+std::optional<FarmResult> RenderFarmQueue::result(std::string_view id) const
+{
+    const auto object { readFile(resultsDirectory(m_root) / (std::string(id) + std::string(k_result_extension))) };
+    if (!object) {
+        return std::nullopt;
+    }
+
+    try {
+        const auto status { static_cast<ErrorHandling::CoreError>(object->at("status").get<int>()) };
+        FarmResult result {
+            object->at("id").get<std::string>(),
+            object->at("source").get<std::string>(),
+            object->at("output").get<std::string>(),
+            object->at("worker").get<std::string>(),
+            {},
+        };
+        if (status != ErrorHandling::CoreError::Success) {
+            result.m_status = std::unexpected(status);
+        }
+        return result;
+    } catch (const Json::exception& e) {
+        spdlog::error("[RenderFarmQueue::result]: Invalid result '{}': {}", id, e.what());
+        return std::nullopt;
+    }
+}
+
+std::size_t RenderFarmQueue::requeueStale(std::chrono::seconds stale_after) const
+{
+    const auto now { std::filesystem::file_time_type::clock::now() };
+    std::size_t requeued { 0 };
+
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(claimedDirectory(m_root), ec), end; !ec && it != end; it.increment(ec)) {
+        const std::filesystem::path& path { it->path() };
+        if (path.extension() != k_job_extension) {
+            continue;
+        }
+
+        std::error_code entry_error;
+        const auto claimed_at { std::filesystem::last_write_time(path, entry_error) };
+        if (entry_error || now - claimed_at < stale_after) {
+            continue;
+        }
+
+        // Finished, its claim not yet released: nothing to render again
+        const std::filesystem::path result_path { resultsDirectory(m_root) / (path.stem().string() + std::string(k_result_extension)) };
+        if (std::filesystem::exists(result_path, entry_error)) {
+            std::filesystem::remove(path, entry_error);
+            continue;
+        }
+
+        std::filesystem::rename(path, jobsDirectory(m_root) / path.filename(), entry_error);
+        if (!entry_error) {
+            spdlog::warn("[RenderFarmQueue::requeueStale]: Job '{}' requeued (claimed {} s ago)", path.stem().string(),
+                         std::chrono::duration_cast<std::chrono::seconds>(now - claimed_at).count());
+            ++requeued;
+        }
+    }
+    return requeued;
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,148 @@
+/**
+ * @file render_farm_worker.cpp
+ * @brief Implementation of RenderFarmWorker.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_farm_worker.h"
+#include "config/app_config.h"
+#include "serializer/binary_edit_format.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <format>
+#include <map>
+#include <span>
+#include <thread>
+#include <utility>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+/**
+ * @brief Key grouping the jobs exported with the same settings (one `BatchExporter::run` each).
+ */
+[[nodiscard]] std::string settingsKey(const ExportSettings& settings)
+{
+    std::string key { std::format("{}|{}|{}|{}|{}|{}", static_cast<int>(settings.m_format), settings.m_jpeg_quality,
+                                  static_cast<int>(settings.m_dither), settings.m_max_long_edge,
+                                  static_cast<int>(settings.m_overwrite), settings.m_output_directory.string()) };
+    for (const ExportRendition& rendition : settings.m_renditions) {
+        key += std::format("|{}:{}:{}:{}", rendition.m_suffix, static_cast<int>(rendition.m_format), rendition.m_jpeg_quality,
+                           rendition.m_max_long_edge);
+    }
+    return key;
+}
+
+} // namespace
+
+RenderFarmWorker::RenderFarmWorker(RenderFarmQueue queue, std::string worker_id, std::size_t memory_budget_bytes,
+                                   std::size_t encode_threads)
+    : m_queue(std::move(queue))
+    , m_worker_id(std::move(worker_id))
+{
+    // Before the exporter builds its executors: their pipelines load from the farm's cache
+    Config::AppConfig::instance().setPipelineDiskCacheDirectory(m_queue.pipelineCacheDirectory());
+    m_exporter = std::make_unique<BatchExporter>(memory_budget_bytes, encode_threads);
+
+    spdlog::info("[RenderFarmWorker]: '{}' serving '{}' with {} processor(s)", m_worker_id, m_queue.root().string(),
+                 m_exporter->processorCount());
+}
+
+std::size_t RenderFarmWorker::run(const ResultCallback& on_result, const Common::CancellationToken& token,
+                                  bool exit_when_idle)
+{
+    const std::size_t claim_size { k_jobs_per_processor * m_exporter->processorCount() };
+    const double claim_milliseconds { k_claim_milliseconds_per_processor * static_cast<double>(m_exporter->processorCount()) };
+
+    // Each job on the backend fastest for it here; a job of unknown size counts as an average share
+    RenderFarmQueue::JobEstimator estimate;
+    if (const auto cost_model = Config::AppConfig::instance().getBackendCostModel()) {
+        estimate = [cost_model, share = claim_milliseconds / static_cast<double>(std::max<std::size_t>(claim_size, 1))](const FarmJob& job) {
+            if (job.m_width == 0 || job.m_height == 0) {
+                return share;
+            }
+            const auto backend { cost_model->selectBackend(job.m_width, job.m_height, job.m_cost) };
+            return cost_model->estimateMilliseconds(backend, job.m_cost, job.m_width, job.m_height).value_or(share);
+        };
+    }
+
+    std::size_t rendered { 0 };
+
+    while (!token.isCancelled()) {
+        auto jobs { m_queue.claim(m_worker_id, claim_size, estimate, claim_milliseconds) };
+        if (jobs.empty()) {
+            if (exit_when_idle) {
+                break;
+            }
+            std::this_thread::sleep_for(RenderFarmQueue::k_poll_interval);
+            continue;
+        }
+
+        rendered += jobs.size();
+        renderBatch(std::move(jobs), on_result, token);
+    }
+
+    spdlog::info("[RenderFarmWorker::run]: '{}' rendered {} job(s)", m_worker_id, rendered);
+    return rendered;
+}
+
+void RenderFarmWorker::renderBatch(std::vector<FarmJob> jobs, const ResultCallback& on_result,
+                                   const Common::CancellationToken& token)
+{
+    const auto report = [&](const FarmJob& job, std::filesystem::path output_path,
+                            std::expected<void, ErrorHandling::CoreError> status) {
+        const FarmResult result { job.m_id, job.m_source_path, std::move(output_path), m_worker_id, std::move(status) };
+        if (!m_queue.complete(result)) {
+            spdlog::error("[RenderFarmWorker::renderBatch]: Cannot record the result of job '{}'", job.m_id);
+        }
+        if (on_result) {
+            on_result(result);
+        }
+    };
+
+    // ============================================================
+    // Decode the edit stacks; group the jobs by output settings
+    // ============================================================
+    std::map<std::string, std::vector<std::size_t>> groups;
+    std::vector<ExportJob> exports(jobs.size());
+    for (std::size_t index = 0; index < jobs.size(); ++index) {
+        const std::string& blob { jobs[index].m_edit_blob };
+        auto operations { Serializer::decodeEditStack(std::as_bytes(std::span(blob.data(), blob.size()))) };
+        if (!operations) {
+            spdlog::error("[RenderFarmWorker::renderBatch]: Invalid edit stack in job '{}'", jobs[index].m_id);
+            report(jobs[index], {}, std::unexpected(operations.error()));
+            continue;
+        }
+        exports[index] = ExportJob { jobs[index].m_source_path, std::move(operations.value()) };
+        groups[settingsKey(jobs[index].m_settings)].push_back(index);
+    }
+
+    // ============================================================
+    // Export each group on the warm exporter, reporting each file as it completes
+    // ============================================================
+    for (const auto& [key, indices] : groups) {
+        std::vector<ExportJob> group_jobs;
+        group_jobs.reserve(indices.size());
+        for (const std::size_t index : indices) {
+            group_jobs.push_back(std::move(exports[index]));
+        }
+
+        const ExportSettings& settings { jobs[indices.front()].m_settings };
+        (void)m_exporter->run(group_jobs, settings,
+            [&](std::size_t position, const ExportResult& result) {
+                const FarmJob& job { jobs[indices[position]] };
+                // A cancelled job is not a result: its claim goes stale and another worker takes it
+                if (!result.m_status && result.m_status.error() == ErrorHandling::CoreError::LoadCancelled) {
+                    return;
+                }
+                report(job, result.m_output_path, result.m_status);
+            },
+            token);
+    }
+}
+
+} // namespace CaptureMoment::Core::Export
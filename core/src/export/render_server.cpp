@@ -0,0 +1,210 @@
+/**
+ * @file render_server.cpp
+ * @brief Implementation of RenderServer.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_server.h"
+#include "serializer/binary_edit_format.h"
+#include "utils/quantize.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstring>
+#include <list>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+/**
+ * @brief Copies a result out to shared memory in the requested pixel format.
+ */
+[[nodiscard]] std::expected<SharedImage, ErrorHandling::CoreError>
+toSharedImage(const Common::ImageRegion& image, RenderPixelFormat format, Utils::DitherMode dither)
+{
+    auto memory { Common::SharedMemory::create(SharedImage::byteSize(image.m_width, image.m_height, format)) };
+    if (!memory) {
+        return std::unexpected(memory.error());
+    }
+
+    const std::size_t row_floats { static_cast<std::size_t>(image.m_width) * image.m_channels };
+    if (format == RenderPixelFormat::Srgb8) {
+        // Quantized straight into the shared pages
+        Utils::quantizeRowsU8(image.m_data.data(), row_floats, reinterpret_cast<std::uint8_t*>(memory->writableBytes().data()),
+                              static_cast<std::size_t>(image.m_width) * 4, image.m_width, image.m_height, 4,
+                              { Utils::OutputTransfer::Srgb, dither });
+    } else {
+        std::memcpy(memory->writableBytes().data(), image.m_data.data(), memory->bytes().size());
+    }
+    return SharedImage { std::move(*memory), image.m_width, image.m_height, format };
+}
+
+/**
+ * @brief A connection and whether its thread returned.
+ */
+struct Connection {
+    std::atomic<bool> m_done { false };
+    std::jthread m_thread;
+};
+
+} // anonymous namespace
+
+RenderServer::RenderServer(std::filesystem::path socket_path, std::size_t memory_budget_bytes, std::size_t encode_threads)
+    : m_socket_path(std::move(socket_path))
+    , m_exporter(std::make_unique<BatchExporter>(memory_budget_bytes, encode_threads))
+{
+    spdlog::info("[RenderServer]: Ready with {} processor(s)", m_exporter->processorCount());
+}
+
+RenderServer::~RenderServer() = default;
+
+std::expected<void, ErrorHandling::CoreError> RenderServer::run(const Common::CancellationToken& token)
+{
+#if defined(_WIN32)
+    (void)token;
+    spdlog::error("[RenderServer::run]: Not available on Windows");
+    return std::unexpected(ErrorHandling::CoreError::Unexpected);
+#else
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path { m_socket_path.string() };
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        spdlog::error("[RenderServer::run]: Invalid socket path '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    // A socket left by a server that did not stop cleanly; never another kind of file
+    std::error_code ec;
+    if (std::filesystem::is_socket(m_socket_path, ec)) {
+        std::filesystem::remove(m_socket_path, ec);
+    }
+
+    const int listener { ::socket(AF_UNIX, SOCK_STREAM, 0) };
+    if (listener < 0) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    ::fcntl(listener, F_SETFD, FD_CLOEXEC);
+
+    // Owner-only from its creation
+    const mode_t previous_mask { ::umask(0077) };
+    const bool bound { ::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0 };
+    ::umask(previous_mask);
+    if (!bound || ::listen(listener, SOMAXCONN) != 0) {
+        spdlog::error("[RenderServer::run]: Cannot listen on '{}': {}", path, std::strerror(errno));
+        ::close(listener);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    spdlog::info("[RenderServer::run]: Listening on '{}'", path);
+
+    std::list<Connection> connections;
+    while (!token.isCancelled()) {
+        std::erase_if(connections, [](const Connection& connection) { return connection.m_done.load(); });
+
+        pollfd entry { listener, POLLIN, 0 };
+        if (::poll(&entry, 1, static_cast<int>(k_poll_interval.count())) <= 0) {
+            continue;
+        }
+        const int client { ::accept(listener, nullptr, nullptr) };
+        if (client < 0) {
+            continue;
+        }
+        ::fcntl(client, F_SETFD, FD_CLOEXEC);
+#if defined(SO_NOSIGPIPE)
+        const int on { 1 };
+        ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+
+        Connection& connection { connections.emplace_back() };
+        connection.m_thread = std::jthread([this, &connection, channel = RenderChannel(client), token]() mutable {
+            serve(std::move(channel), token);
+            connection.m_done = true;
+        });
+    }
+
+    // The connections see the token within a poll interval
+    connections.clear();
+    ::close(listener);
+    std::filesystem::remove(m_socket_path, ec);
+    spdlog::info("[RenderServer::run]: Stopped after {} request(s)", requestCount());
+    return {};
+#endif
+}
+
+void RenderServer::serve(RenderChannel channel, const Common::CancellationToken& token)
+{
+    while (!token.isCancelled()) {
+        if (!channel.waitReadable(k_poll_interval)) {
+            continue;
+        }
+        auto request { channel.receiveRequest() };
+        if (!request) {
+            // The client closed the connection (or sent garbage: it is dropped)
+            if (request.error() != ErrorHandling::CoreError::IOError) {
+                (void)channel.send(RenderReply { std::unexpected(request.error()) });
+            }
+            return;
+        }
+        if (!channel.send(render(*request, token))) {
+            return;
+        }
+    }
+}
+
+RenderReply RenderServer::render(const RenderRequest& request, const Common::CancellationToken& token)
+{
+    m_requests.fetch_add(1, std::memory_order_relaxed);
+
+    std::vector<Operations::OperationDescriptor> operations;
+    if (!request.m_edit_blob.empty()) {
+        const std::string& blob { request.m_edit_blob };
+        auto decoded { Serializer::decodeEditStack(std::as_bytes(std::span(blob.data(), blob.size()))) };
+        if (!decoded) {
+            spdlog::warn("[RenderServer::render]: Invalid edit stack");
+            return { std::unexpected(decoded.error()) };
+        }
+        operations = std::move(*decoded);
+    }
+
+    std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> rendered;
+    if (request.m_input) {
+        const SharedImage& input { *request.m_input };
+        if (input.m_format != RenderPixelFormat::LinearF32) {
+            return { std::unexpected(ErrorHandling::CoreError::UnsupportedFormat) };
+        }
+        // The working copy is made from the client's pages: nothing was serialized
+        const auto* pixels { reinterpret_cast<const float*>(input.m_memory.bytes().data()) };
+        Common::PixelBuffer data(pixels, pixels + static_cast<std::size_t>(input.m_width) * input.m_height * 4);
+        const Common::ImageRegion image(std::move(data), input.m_width, input.m_height, static_cast<Common::ImageChan>(4));
+        rendered = m_exporter->renderImage(image, std::move(operations), request.m_max_long_edge, token);
+    } else {
+        rendered = m_exporter->render({ request.m_source_path, std::move(operations) }, request.m_max_long_edge, token);
+    }
+    if (!rendered) {
+        if (rendered.error() != ErrorHandling::CoreError::LoadCancelled) {
+            spdlog::warn("[RenderServer::render]: Cannot render '{}': {}",
+                         request.m_input ? std::string("<shared image>") : request.m_source_path,
+                         ErrorHandling::to_string(rendered.error()));
+        }
+        return { std::unexpected(rendered.error()) };
+    }
+    return { toSharedImage(**rendered, request.m_format, request.m_dither) };
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,473 @@
+/**
+ * @file sequence_exporter.cpp
+ * @brief Implementation of SequenceExporter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/sequence_exporter.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "managers/source_manager.h"
+#include "operations/color_operations/camera_profile.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/operation_ranges.h"
+#include "operations/operation_registry.h"
+#include "pipeline/pipeline_builder.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <condition_variable>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <variant>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+/**
+ * @brief Range of the luminance histogram, in stops (log2 of linear luminance).
+ */
+constexpr float k_histogram_min_stops { -16.0f };
+constexpr float k_histogram_max_stops { 4.0f };
+constexpr std::size_t k_histogram_bins { 512 };
+
+[[nodiscard]] std::unique_ptr<Pipeline::OperationPipelineExecutor> makeExecutor()
+{
+    auto base_executor = Pipeline::PipelineBuilder::build(Pipeline::PipelineType::HalideOperation);
+    if (auto* concrete = dynamic_cast<Pipeline::OperationPipelineExecutor*>(base_executor.get())) {
+        base_executor.release();
+        return std::unique_ptr<Pipeline::OperationPipelineExecutor>(concrete);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Adds the deflicker offset of a frame to its Exposure (clamped to the range of the slider).
+ */
+void addExposureOffset(std::vector<Operations::OperationDescriptor>& operations, float offset)
+{
+    auto it { std::ranges::find(operations, Operations::OperationType::Exposure, &Operations::OperationDescriptor::type) };
+    if (it == operations.end()) {
+        return;
+    }
+    const float value { it->getParam<float>(Operations::ParameterKey::Value).value_or(0.0f) };
+    it->setParam(Operations::ParameterKey::Value,
+                 std::clamp(value + offset, Operations::OperationRanges::getExposureMinValue(),
+                            Operations::OperationRanges::getExposureMaxValue()));
+}
+
+} // anonymous namespace
+
+struct SequenceExporter::Sequence {
+    std::span<const std::string> m_frames;
+    /** @brief Sorted by frame, same structure. */
+    std::vector<SequenceKeyframe> m_keyframes;
+    SequenceSettings m_settings;
+    /** @brief Deflicker offset of each frame, in stops (empty: no deflicker). */
+    std::vector<float> m_offsets;
+    const ProgressCallback* m_on_progress { nullptr };
+    Common::CancellationToken m_token;
+
+    std::vector<ExportResult> m_results;
+
+    /** @brief Guards the results, the counts and the progress calls. */
+    std::mutex m_mutex;
+    /** @brief Signalled when a frame is done. */
+    std::condition_variable m_changed;
+    /** @brief Frames between their admission and their outcome. */
+    std::size_t m_in_flight { 0 };
+    std::size_t m_remaining { 0 };
+};
+
+SequenceExporter::SequenceExporter(std::size_t encode_threads)
+    : m_source(std::make_unique<Managers::SourceManager>())
+    , m_operation_factory(std::make_unique<Operations::OperationFactory>())
+    , m_executor(makeExecutor())
+{
+    Operations::OperationRegistry::registerAll(*m_operation_factory);
+
+    if (!m_executor) {
+        spdlog::error("[SequenceExporter::SequenceExporter]: No Halide executor: edits cannot be applied.");
+    }
+
+    if (encode_threads == 0) {
+        encode_threads = std::max(1u, std::thread::hardware_concurrency() / 2);
+    }
+
+    // The first scheduler thread only runs interactive work: one more for the export lane.
+    // One processing thread: the frames share the executor, and its compiled pipeline.
+    m_encode_pool = std::make_unique<Workers::EngineScheduler>(encode_threads + 1);
+    m_process_pool = std::make_unique<Workers::EngineScheduler>(2);
+}
+
+SequenceExporter::~SequenceExporter()
+{
+    // Upstream first: decodes queue processing, which queues encodes
+    m_source.reset();
+    m_process_pool.reset();
+    m_encode_pool.reset();
+}
+
+std::vector<ExportResult> SequenceExporter::run(std::span<const std::string> frames,
+                                                std::span<const SequenceKeyframe> keyframes,
+                                                const SequenceSettings& settings,
+                                                const ProgressCallback& on_progress,
+                                                const Common::CancellationToken& token)
+{
+    auto sequence { std::make_shared<Sequence>() };
+    sequence->m_frames = frames;
+    sequence->m_keyframes.assign(keyframes.begin(), keyframes.end());
+    std::ranges::sort(sequence->m_keyframes, {}, &SequenceKeyframe::m_frame);
+    sequence->m_settings = settings;
+    sequence->m_settings.m_frames_in_flight = std::max<std::size_t>(settings.m_frames_in_flight, 1);
+    sequence->m_on_progress = on_progress ? &on_progress : nullptr;
+    sequence->m_token = token;
+    sequence->m_results.resize(frames.size());
+    sequence->m_remaining = frames.size();
+
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        sequence->m_results[i].m_source_path = frames[i];
+        sequence->m_results[i].m_output_path = BatchExporter::outputPathFor(frames[i], settings.m_export);
+    }
+
+    // ============================================================
+    // One structure for every frame: the pipeline compiles once
+    // ============================================================
+    const bool keyframes_valid { !sequence->m_keyframes.empty() && m_executor
+        && std::ranges::all_of(sequence->m_keyframes, [&sequence](const SequenceKeyframe& keyframe) {
+               return Pipeline::OperationPipelineExecutor::structureFingerprint(keyframe.m_operations)
+                      == Pipeline::OperationPipelineExecutor::structureFingerprint(sequence->m_keyframes.front().m_operations);
+           }) };
+    if (!keyframes_valid) {
+        spdlog::error("[SequenceExporter::run]: The keyframes are missing or differ in structure (operations, order, state).");
+        for (std::size_t i = 0; i < frames.size(); ++i) {
+            finish(sequence, i, std::unexpected(ErrorHandling::CoreError::Unexpected));
+        }
+        return std::move(sequence->m_results);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(settings.m_export.m_output_directory, ec);
+    if (ec) {
+        spdlog::error("[SequenceExporter::run]: Cannot create '{}': {}", settings.m_export.m_output_directory.string(), ec.message());
+    }
+
+    if (settings.m_deflicker) {
+        // The offsets go to an Exposure: one, with the same id in every keyframe, if the stack has none
+        if (std::ranges::none_of(sequence->m_keyframes.front().m_operations, [](const auto& operation) {
+                return operation.type == Operations::OperationType::Exposure;
+            })) {
+            Operations::OperationDescriptor exposure;
+            exposure.id = Operations::OperationDescriptor::generateId();
+            exposure.type = Operations::OperationType::Exposure;
+            exposure.name = "Exposure";
+            exposure.setParam(Operations::ParameterKey::Value, Operations::OperationRanges::getExposureDefaultValue());
+            for (auto& keyframe : sequence->m_keyframes) {
+                keyframe.m_operations.insert(keyframe.m_operations.begin(), exposure);
+            }
+        }
+
+        const auto log_luminance { analyzeFrames(frames, settings, token) };
+        sequence->m_offsets = deflickerOffsets(log_luminance, settings.m_deflicker_window);
+    }
+
+    spdlog::info("[SequenceExporter::run]: Exporting {} frame(s), {} keyframe(s), to '{}'{}.", frames.size(),
+                 sequence->m_keyframes.size(), settings.m_export.m_output_directory.string(),
+                 settings.m_deflicker ? " with deflicker" : "");
+
+    // ============================================================
+    // Admit the frames in order, a bounded number at once; the stages take over from the decode
+    // ============================================================
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        {
+            std::unique_lock lock(sequence->m_mutex);
+            sequence->m_changed.wait(lock, [&sequence] {
+                return sequence->m_in_flight < sequence->m_settings.m_frames_in_flight;
+            });
+            ++sequence->m_in_flight;
+        }
+
+        if (token.isCancelled()) {
+            finish(sequence, i, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+            continue;
+        }
+        if (!settings.m_export.m_overwrite && std::filesystem::exists(sequence->m_results[i].m_output_path, ec)) {
+            spdlog::warn("[SequenceExporter::run]: '{}' exists, not overwritten.", sequence->m_results[i].m_output_path.string());
+            finish(sequence, i, std::unexpected(ErrorHandling::CoreError::IOError));
+            continue;
+        }
+
+        m_source->decodeAsync(frames[i], ImageConfig::Raw::RawQuality::full, Workers::TaskPriority::Export,
+                              [this, sequence, i](const std::string& decoded_path, Managers::DecodeService::Result decoded) {
+            if (!decoded && decoded.error() == ErrorHandling::CoreError::UnsupportedFormat
+                && sequence->m_settings.m_export.m_max_long_edge > 0) {
+                // Tile-backed frames are not decoded whole: read them at the output size
+                auto thumbnail { m_source->decodeThumbnail(decoded_path, sequence->m_settings.m_export.m_max_long_edge) };
+                if (!thumbnail) {
+                    finish(sequence, i, std::unexpected(thumbnail.error()));
+                    return;
+                }
+                m_process_pool->post(Workers::TaskPriority::Export, [this, sequence, i, image = std::move(*thumbnail)]() mutable {
+                    processFrame(sequence, i, std::move(image), std::nullopt);
+                });
+                return;
+            }
+            if (!decoded) {
+                if (decoded.error() != ErrorHandling::CoreError::LoadCancelled) {
+                    spdlog::warn("[SequenceExporter::run]: Cannot decode '{}': {}", decoded_path,
+                                 ErrorHandling::to_string(decoded.error()));
+                }
+                finish(sequence, i, std::unexpected(decoded.error()));
+                return;
+            }
+
+            const OIIO::ImageBuf& buffer { **decoded };
+            const auto width { static_cast<Common::ImageDim>(buffer.spec().width) };
+            const auto height { static_cast<Common::ImageDim>(buffer.spec().height) };
+            Common::PixelBuffer data(static_cast<std::size_t>(width) * height * 4);
+            if (!buffer.get_pixels(OIIO::ROI(0, buffer.spec().width, 0, buffer.spec().height, 0, 1, 0, 4),
+                                   OIIO::TypeDesc::FLOAT, data.data())) {
+                spdlog::error("[SequenceExporter::run]: get_pixels of '{}' failed: {}", decoded_path, buffer.geterror());
+                finish(sequence, i, std::unexpected(ErrorHandling::CoreError::IOError));
+                return;
+            }
+            std::optional<std::string> camera_profile;
+            if (std::string profile { buffer.spec().get_string_attribute(std::string(Operations::CameraProfile::k_metadata_key)) };
+                !profile.empty()) {
+                camera_profile = std::move(profile);
+            }
+
+            m_process_pool->post(Workers::TaskPriority::Export,
+                                 [this, sequence, i, camera_profile = std::move(camera_profile),
+                                  image = std::make_unique<Common::ImageRegion>(std::move(data), width, height,
+                                                                                static_cast<Common::ImageChan>(4))]() mutable {
+                processFrame(sequence, i, std::move(image), std::move(camera_profile));
+            });
+        }, token);
+    }
+
+    std::unique_lock lock(sequence->m_mutex);
+    sequence->m_changed.wait(lock, [&sequence] { return sequence->m_remaining == 0; });
+
+    const auto failed { std::ranges::count_if(sequence->m_results, [](const ExportResult& result) { return !result.m_status; }) };
+    spdlog::info("[SequenceExporter::run]: Sequence done: {} written, {} failed.", frames.size() - static_cast<std::size_t>(failed), failed);
+    return std::move(sequence->m_results);
+}
+
+void SequenceExporter::processFrame(const std::shared_ptr<Sequence>& sequence, std::size_t index,
+                                    std::unique_ptr<Common::ImageRegion> image, std::optional<std::string> camera_profile)
+{
+    if (sequence->m_token.isCancelled()) {
+        finish(sequence, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+        return;
+    }
+
+    auto operations { operationsAt(sequence->m_keyframes, index) };
+    if (!sequence->m_offsets.empty()) {
+        addExposureOffset(operations, sequence->m_offsets[index]);
+    }
+    Operations::CameraProfile::attachTo(operations, camera_profile);
+
+    std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> processed;
+    {
+        std::lock_guard lock(m_executor_mutex);
+
+        auto working { ImageProcessing::WorkingImageFactory::create(*image) };
+        image.reset();
+        if (!working) {
+            finish(sequence, index, std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage));
+            return;
+        }
+
+        // Same structure as the previous frame: the values are rebound, nothing is rebuilt
+        const auto crop { Operations::CropGeometry::of(operations) };
+        if (m_executor->initializedStructure() != Pipeline::OperationPipelineExecutor::structureFingerprint(operations)) {
+            m_executor->init(std::move(operations), *m_operation_factory);
+        } else {
+            m_executor->updateRuntimeParams(std::move(operations));
+        }
+        m_executor->setCancellationToken(sequence->m_token);
+        if (!m_executor->execute(*working)) {
+            finish(sequence, index, std::unexpected(sequence->m_token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                                                    : ErrorHandling::CoreError::InvalidWorkingImage));
+            return;
+        }
+
+        processed = working->exportToCPUCopy();
+        if (processed && crop) {
+            // Only the crop was computed: hand out that rectangle
+            if (auto cropped = crop->extractFrom(**processed)) {
+                processed = std::move(cropped);
+            } else {
+                processed = std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+            }
+        }
+    }
+
+    if (!processed) {
+        spdlog::warn("[SequenceExporter::processFrame]: Edits of '{}' not applied: {}", sequence->m_frames[index],
+                     ErrorHandling::to_string(processed.error()));
+        finish(sequence, index, std::unexpected(processed.error()));
+        return;
+    }
+
+    m_encode_pool->post(Workers::TaskPriority::Export, [this, sequence, index, result = std::move(*processed)]() {
+        if (sequence->m_token.isCancelled()) {
+            finish(sequence, index, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+            return;
+        }
+        // Frames are processed as stored: the encode turns them upright
+        const auto metadata { m_source->readMetadata(sequence->m_frames[index]) };
+        const Common::ImageOrientation orientation { metadata ? Common::orientationFromExif(metadata->m_orientation)
+                                                              : Common::ImageOrientation::Normal };
+        finish(sequence, index, BatchExporter::encode(*result, sequence->m_results[index].m_output_path,
+                                                      sequence->m_settings.m_export, orientation));
+    });
+}
+
+void SequenceExporter::finish(const std::shared_ptr<Sequence>& sequence, std::size_t index,
+                              std::expected<void, ErrorHandling::CoreError> status)
+{
+    {
+        std::lock_guard lock(sequence->m_mutex);
+        ExportResult& result { sequence->m_results[index] };
+        result.m_status = status;
+        if (sequence->m_on_progress) {
+            (*sequence->m_on_progress)(index, result);
+        }
+        if (sequence->m_in_flight > 0) {
+            --sequence->m_in_flight;
+        }
+        --sequence->m_remaining;
+    }
+    sequence->m_changed.notify_all();
+}
+
+std::vector<float> SequenceExporter::analyzeFrames(std::span<const std::string> frames, const SequenceSettings& settings,
+                                                   const Common::CancellationToken& token)
+{
+    std::vector<float> log_luminance(frames.size(), std::numeric_limits<float>::quiet_NaN());
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::size_t remaining { frames.size() };
+
+    // Previews only (embedded JPEG or draft demosaic): the analysis is a small part of the export
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        m_encode_pool->post(Workers::TaskPriority::Export, [&, i] {
+            if (!token.isCancelled()) {
+                if (auto preview = m_source->decodeThumbnail(frames[i], settings.m_deflicker_analysis_edge)) {
+                    log_luminance[i] = medianLogLuminance(**preview);
+                } else {
+                    spdlog::warn("[SequenceExporter::analyzeFrames]: No preview of '{}': not deflickered", frames[i]);
+                }
+            }
+            std::lock_guard lock(mutex);
+            if (--remaining == 0) {
+                done.notify_all();
+            }
+        });
+    }
+
+    std::unique_lock lock(mutex);
+    done.wait(lock, [&remaining] { return remaining == 0; });
+    return log_luminance;
+}
+
+std::vector<Operations::OperationDescriptor>
+SequenceExporter::operationsAt(std::span<const SequenceKeyframe> keyframes, std::size_t frame)
+{
+    // The keyframes around the frame (the same one at and beyond the ends)
+    const auto next { std::ranges::upper_bound(keyframes, frame, {}, &SequenceKeyframe::m_frame) };
+    if (next == keyframes.begin()) {
+        return next->m_operations;
+    }
+    const SequenceKeyframe& before { *std::prev(next) };
+    if (next == keyframes.end() || before.m_frame == frame) {
+        return before.m_operations;
+    }
+    const SequenceKeyframe& after { *next };
+
+    const float t { static_cast<float>(frame - before.m_frame) / static_cast<float>(after.m_frame - before.m_frame) };
+    auto operations { before.m_operations };
+    for (std::size_t i = 0; i < operations.size() && i < after.m_operations.size(); ++i) {
+        auto& operation { operations[i] };
+        operation.params.forEach([&](Operations::ParameterKey key, const Operations::OperationValue& value) {
+            const auto* from { std::get_if<float>(&value) };
+            const auto to { after.m_operations[i].getParam<float>(key) };
+            if (from && to) {
+                operation.params.set(key, *from + (*to - *from) * t);
+            }
+        });
+    }
+    return operations;
+}
+
+std::vector<float> SequenceExporter::deflickerOffsets(std::span<const float> log_luminance, std::size_t window)
+{
+    const std::size_t radius { std::max<std::size_t>(window, 1) / 2 };
+    std::vector<float> offsets(log_luminance.size(), 0.0f);
+
+    for (std::size_t i = 0; i < log_luminance.size(); ++i) {
+        if (std::isnan(log_luminance[i])) {
+            continue;
+        }
+        const std::size_t first { i > radius ? i - radius : 0 };
+        const std::size_t last { std::min(i + radius, log_luminance.size() - 1) };
+        double sum { 0.0 };
+        std::size_t count { 0 };
+        for (std::size_t j = first; j <= last; ++j) {
+            if (!std::isnan(log_luminance[j])) {
+                sum += log_luminance[j];
+                ++count;
+            }
+        }
+        offsets[i] = static_cast<float>(sum / static_cast<double>(count)) - log_luminance[i];
+    }
+    return offsets;
+}
+
+float SequenceExporter::medianLogLuminance(const Common::ImageRegion& image)
+{
+    std::array<std::size_t, k_histogram_bins> histogram {};
+    std::size_t lit { 0 };
+
+    const std::size_t channels { image.m_channels };
+    const std::size_t pixels { static_cast<std::size_t>(image.m_width) * image.m_height };
+    if (channels < 3) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+
+    constexpr float k_scale { static_cast<float>(k_histogram_bins) / (k_histogram_max_stops - k_histogram_min_stops) };
+    for (std::size_t p = 0; p < pixels; ++p) {
+        const float* pixel { image.m_data.data() + p * channels };
+        const float luminance { 0.2126f * pixel[0] + 0.7152f * pixel[1] + 0.0722f * pixel[2] };
+        if (!(luminance > 0.0f)) {
+            continue;
+        }
+        const float bin { (std::log2(luminance) - k_histogram_min_stops) * k_scale };
+        ++histogram[static_cast<std::size_t>(std::clamp(bin, 0.0f, static_cast<float>(k_histogram_bins - 1)))];
+        ++lit;
+    }
+    if (lit == 0) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+
+    std::size_t seen { 0 };
+    for (std::size_t bin = 0; bin < k_histogram_bins; ++bin) {
+        seen += histogram[bin];
+        if (seen * 2 >= lit) {
+            // Center of the bin
+            return k_histogram_min_stops + (static_cast<float>(bin) + 0.5f) / k_scale;
+        }
+    }
+    return k_histogram_max_stops;
+}
+
+} // namespace CaptureMoment::Core::Export
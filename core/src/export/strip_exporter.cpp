@@ -0,0 +1,213 @@
+/**
+ * @file strip_exporter.cpp
+ * @brief Implementation of StripExporter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/strip_exporter.h"
+#include "export/output_writer.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "managers/source_manager.h"
+#include "operations/interfaces/i_operation.h"
+#include "operations/detail_operations/gaussian_blur.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/masks/mask_sampler.h"
+#include "operations/operation_registry.h"
+#include "pipeline/pipeline_builder.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+[[nodiscard]] std::unique_ptr<Pipeline::OperationPipelineExecutor> makeExecutor()
+{
+    auto base_executor = Pipeline::PipelineBuilder::build(Pipeline::PipelineType::HalideOperation);
+    if (auto* concrete = dynamic_cast<Pipeline::OperationPipelineExecutor*>(base_executor.get())) {
+        base_executor.release();
+        return std::unique_ptr<Pipeline::OperationPipelineExecutor>(concrete);
+    }
+    return nullptr;
+}
+
+} // anonymous namespace
+
+StripExporter::StripExporter(std::size_t strip_bytes)
+    : m_strip_bytes(strip_bytes)
+    , m_source(std::make_unique<Managers::SourceManager>())
+    , m_operation_factory(std::make_unique<Operations::OperationFactory>())
+    , m_executor(makeExecutor())
+{
+    Operations::OperationRegistry::registerAll(*m_operation_factory);
+    if (!m_executor) {
+        spdlog::error("[StripExporter::StripExporter]: No Halide executor: edits cannot be applied.");
+    }
+}
+
+StripExporter::~StripExporter() = default;
+
+Common::ImageDim StripExporter::haloFor(std::span<const Operations::OperationDescriptor> operations,
+                                        const Operations::OperationFactory& factory)
+{
+    Common::ImageDim halo { 0 };
+    for (const auto& descriptor : operations) {
+        if (!descriptor.enabled) {
+            continue;
+        }
+        if (auto operation = factory.create(descriptor)) {
+            halo += (*operation)->haloPixels(descriptor);
+        }
+    }
+    return halo;
+}
+
+Common::ImageDim StripExporter::stripRows(Common::ImageDim width, Common::ImageDim height) const noexcept
+{
+    const std::size_t row_bytes { std::max<std::size_t>(width, 1) * 4 * sizeof(float) };
+    const Common::ImageDim rows { std::max<Common::ImageDim>(m_strip_bytes / row_bytes, k_min_strip_rows) };
+    return std::clamp<Common::ImageDim>(rows, 1, std::max<Common::ImageDim>(height, 1));
+}
+
+std::expected<void, ErrorHandling::CoreError>
+StripExporter::exportFile(const ExportJob& job, const std::filesystem::path& output_path, const ExportSettings& settings,
+                          const Common::CancellationToken& token)
+{
+    if (!m_executor) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    if (auto opened = m_source->openStreaming(job.m_source_path); !opened) {
+        if (opened.error() != ErrorHandling::CoreError::UnsupportedFormat) {
+            spdlog::warn("[StripExporter::exportFile]: Cannot open '{}': {}", job.m_source_path,
+                         ErrorHandling::to_string(opened.error()));
+        }
+        return opened;
+    }
+
+    auto result { streamStrips(job, output_path, settings, token) };
+    m_source->unload();
+    return result;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+StripExporter::streamStrips(const ExportJob& job, const std::filesystem::path& output_path, const ExportSettings& settings,
+                            const Common::CancellationToken& token)
+{
+    const Common::ImageDim width { m_source->width() };
+    const Common::ImageDim height { m_source->height() };
+    const Common::ImageDim halo { haloFor(job.m_operations, *m_operation_factory) };
+
+    // The crop is normalized to the image: strips would each resolve it to their own size.
+    // The exporter reads and writes the rectangle itself, the executor gets the other edits.
+    auto operations { job.m_operations };
+    const auto crop { Operations::CropGeometry::of(operations) };
+    const Common::RegionOfInterest rect { crop ? crop->region(width, height) : Common::RegionOfInterest{0, 0, width, height} };
+    if (crop && crop->isRotated()) {
+        spdlog::warn("[StripExporter::streamStrips]: Streamed exports are not straightened: '{}' is cropped unrotated.",
+                     job.m_source_path);
+    }
+    // The lens correction is centered on the whole frame, and may move pixels across strips
+    const bool corrects_lens { std::ranges::any_of(operations, [](const Operations::OperationDescriptor& descriptor) {
+        return descriptor.enabled && descriptor.type == Operations::OperationType::LensCorrection;
+    }) };
+    if (corrects_lens) {
+        spdlog::warn("[StripExporter::streamStrips]: Streamed exports are not lens corrected: '{}' is exported uncorrected.",
+                     job.m_source_path);
+    }
+    // Local masks are laid over the whole frame, a strip would sample them from its own origin
+    const bool masks_locally { std::ranges::any_of(operations, [](const Operations::OperationDescriptor& descriptor) {
+        return descriptor.enabled && Operations::MaskSampler::isMasked(descriptor);
+    }) };
+    if (masks_locally) {
+        spdlog::warn("[StripExporter::streamStrips]: Streamed exports skip the local adjustments: '{}' is exported without them.",
+                     job.m_source_path);
+    }
+    std::erase_if(operations, [](const Operations::OperationDescriptor& descriptor) {
+        return descriptor.type == Operations::OperationType::Crop
+            || descriptor.type == Operations::OperationType::LensCorrection
+            || Operations::MaskSampler::isMasked(descriptor);
+    });
+
+    const Common::ImageDim rows { stripRows(width, rect.m_height) };
+
+    // Strips cannot be turned: the file is tagged with the source orientation instead
+    OutputWriter writer;
+    if (auto opened = writer.open(output_path, rect.m_width, rect.m_height, settings, m_source->orientation()); !opened) {
+        return opened;
+    }
+
+    // Compiled on the first strip, reused by the others
+    m_executor->init(std::move(operations), *m_operation_factory);
+    m_executor->setCancellationToken(token);
+
+    spdlog::info("[StripExporter::streamStrips]: Exporting '{}' ({}x{}) in strips of {} rows (halo {}).",
+                 job.m_source_path, rect.m_width, rect.m_height, rows, halo);
+
+    // Rows of a strip narrower than the source, packed for the writer
+    std::vector<float> packed;
+
+    for (Common::ImageDim y = 0; y < rect.m_height; y += rows) {
+        if (token.isCancelled()) {
+            return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        }
+
+        // 1. The strip and the rows its spatial operations read around it, in source rows.
+        //    Blurred strips start on the grid of the blur pyramid, so that its boxes group the
+        //    same rows as in a whole-image pass and the strip matches it exactly.
+        const Common::ImageDim strip_rows { std::min(rows, rect.m_height - y) };
+        const Common::ImageDim source_y { static_cast<Common::ImageDim>(rect.m_y) + y };
+        Common::ImageDim read_y { source_y - std::min(halo, source_y) };
+        if (halo > 0) {
+            read_y -= read_y % Operations::GaussianBlur::k_alignment;
+        }
+        const Common::ImageDim read_end { std::min(height, source_y + strip_rows + halo) };
+
+        auto strip { m_source->getTile(0, read_y, width, read_end - read_y) };
+        if (!strip) {
+            return std::unexpected(strip.error());
+        }
+
+        // 2. Process it
+        auto working { ImageProcessing::WorkingImageFactory::create(**strip) };
+        strip->reset();
+        if (!working) {
+            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+        if (!m_executor->execute(*working)) {
+            return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                       : ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+
+        auto processed { working->exportToCPUCopy() };
+        working.reset();
+        if (!processed) {
+            return std::unexpected(processed.error());
+        }
+
+        // 3. Write its rows, halo (and the columns outside the crop) cropped
+        const float* first_row { (*processed)->m_data.data()
+                                 + (static_cast<std::size_t>(source_y - read_y) * width + static_cast<std::size_t>(rect.m_x)) * 4 };
+        if (rect.m_width != width) {
+            const std::size_t row_floats { static_cast<std::size_t>(rect.m_width) * 4 };
+            packed.resize(row_floats * strip_rows);
+            for (Common::ImageDim row = 0; row < strip_rows; ++row) {
+                std::memcpy(packed.data() + row * row_floats, first_row + row * width * 4, row_floats * sizeof(float));
+            }
+            first_row = packed.data();
+        }
+        if (auto written = writer.writeRows(y, strip_rows, first_row); !written) {
+            return written;
+        }
+    }
+
+    return writer.commit();
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -6,11 +6,91 @@
  */
 
 #include "image_processing/common/working_image_data.h"
+#include "common/memory/buffer_pool.h"
+#include "common/logging/log.h"
+#include "workers/compute_pool.h"
+#include "workers/engine_scheduler.h"
+
+#include <algorithm>
+#include <cstring>
 #include <spdlog/spdlog.h>
 
 namespace CaptureMoment::Core::ImageProcessing {
 
-std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeData(const Common::ImageRegion& cpu_image)
+namespace {
+
+/**
+ * @brief Below this many bytes the copy runs on the calling thread.
+ */
+constexpr std::size_t k_parallel_copy_min_bytes = std::size_t{8} << 20;
+
+/**
+ * @brief Rows copied per iteration of the parallel copy (about 1 MB).
+ */
+[[nodiscard]] std::size_t rowsPerStrip(std::size_t row_floats) noexcept
+{
+    return std::max<std::size_t>(1, (std::size_t{1} << 20) / std::max<std::size_t>(row_floats * sizeof(float), 1));
+}
+
+/**
+ * @brief Runs `copy(first_row, row_count)` over the rows, in strips on `Workers::ComputePool` for large images.
+ *
+ * @details
+ * A fresh block is placed by this first write: copied by the caller and the helpers of its
+ * node (`Workers::ComputePool` keeps a pinned caller's loops there), its pages end up on the
+ * node whose workers then process the strips.
+ */
+template<typename StripCopy>
+void forEachStrip(std::size_t rows, std::size_t row_floats, StripCopy&& copy)
+{
+    if (rows * row_floats * sizeof(float) < k_parallel_copy_min_bytes) {
+        copy(std::size_t{0}, rows);
+        return;
+    }
+
+    const std::size_t strip_rows { rowsPerStrip(row_floats) };
+    const int strips { static_cast<int>((rows + strip_rows - 1) / strip_rows) };
+    const auto priority { Workers::EngineScheduler::currentPriority().value_or(Workers::TaskPriority::Interactive) };
+    Workers::ComputePool::instance().parallelFor(priority, strips, [&](int strip) {
+        const std::size_t first { static_cast<std::size_t>(strip) * strip_rows };
+        copy(first, std::min(strip_rows, rows - first));
+        return 0;
+    });
+}
+
+/**
+ * @brief Copies whole rows (same layout on both sides).
+ */
+void copyRows(float* destination, const float* source, std::size_t rows, std::size_t row_floats)
+{
+    forEachStrip(rows, row_floats, [&](std::size_t first, std::size_t count) {
+        std::memcpy(destination + first * row_floats, source + first * row_floats, count * row_floats * sizeof(float));
+    });
+}
+
+/**
+ * @brief Splits interleaved rows into one dense plane per channel.
+ */
+void copyRowsToPlanes(float* destination, const float* source, std::size_t width, std::size_t rows, std::size_t channels)
+{
+    const std::size_t plane { width * rows };
+    forEachStrip(rows, width * channels, [&](std::size_t first, std::size_t count) {
+        for (std::size_t y = first; y < first + count; ++y) {
+            const float* row { source + y * width * channels };
+            for (std::size_t c = 0; c < channels; ++c) {
+                float* out { destination + c * plane + y * width };
+                for (std::size_t x = 0; x < width; ++x) {
+                    out[x] = row[x * channels + c];
+                }
+            }
+        }
+    });
+}
+
+} // anonymous namespace
+
+std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeData(const Common::ImageRegion& cpu_image,
+                                                                              Common::PixelLayout layout)
 {
     if (!cpu_image.isValid()) {
         spdlog::warn("[WorkingImageData::initializeData]: Input ImageRegion is invalid");
@@ -22,14 +102,23 @@ std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeData(c
                                cpu_image.m_height *
                                cpu_image.m_channels;
 
-        // Check allocation size and use No-Init allocation
-        if (!m_data || m_data_size != required_size) {
-            m_data = std::make_unique_for_overwrite<float[]>(required_size);
-            m_data_size = required_size;
+        // Reuse the block while the size class matches, otherwise borrow one from the pool (no zero-fill).
+        // A block still referenced by an ImageView is left to the view rather than overwritten.
+        if (!m_data || m_data.use_count() > 1
+            || Common::BufferPool::sizeClass(m_data_size * sizeof(float))
+                   != Common::BufferPool::sizeClass(required_size * sizeof(float))) {
+            m_data = Common::makeSharedPooledArray<float>(required_size);
         }
+        m_data_size = required_size;
 
-        // Fast memory copy
-        std::memcpy(m_data.get(), cpu_image.m_data.data(), required_size * sizeof(float));
+        if (layout == Common::PixelLayout::Planar) {
+            copyRowsToPlanes(m_data.get(), cpu_image.m_data.data(), cpu_image.m_width, cpu_image.m_height,
+                             cpu_image.m_channels);
+        } else {
+            copyRows(m_data.get(), cpu_image.m_data.data(), cpu_image.m_height,
+                     static_cast<std::size_t>(cpu_image.m_width) * cpu_image.m_channels);
+        }
+        m_layout = layout;
 
         // Cache dimensions and validity
         m_width = cpu_image.m_width;
@@ -37,8 +126,8 @@ std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeData(c
         m_channels = cpu_image.m_channels;
         m_valid = true;
 
-        spdlog::debug("[WorkingImageData::initializeData]: Copied {} elements ({}x{}, {} ch)",
-                      required_size, m_width, m_height, m_channels);
+        CM_LOG_DEBUG(Image, "[WorkingImageData::initializeData]: Copied {} elements ({}x{}, {} ch)",
+                            required_size, m_width, m_height, m_channels);
 
         return {};
 
@@ -48,4 +137,24 @@ std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeData(c
     }
 }
 
+std::expected<void, ErrorHandling::CoreError> WorkingImageData::initializeMetadata(const Common::ImageRegion& cpu_image)
+{
+    if (!cpu_image.isValid()) {
+        spdlog::warn("[WorkingImageData::initializeMetadata]: Input ImageRegion is invalid");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    // The pixels live in the derived class storage
+    m_data.reset();
+    m_data_size = 0;
+    m_layout = Common::PixelLayout::Interleaved;
+
+    m_width = cpu_image.m_width;
+    m_height = cpu_image.m_height;
+    m_channels = cpu_image.m_channels;
+    m_valid = true;
+
+    return {};
+}
+
 } // namespace CaptureMoment::Core::ImageProcessing
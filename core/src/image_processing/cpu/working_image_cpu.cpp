@@ -71,7 +71,7 @@ WorkingImageCPU::downsample(Common::ImageDim target_width, Common::ImageDim targ
         // Step 4: Extract pixels to result vector
         // ============================================================
         const size_t result_size = target_width * target_height * m_channels;
-        std::vector<float> result_data(result_size);
+        Common::PixelBuffer result_data(result_size);
 
         if (!dst_buf.get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, result_data.data())) {
             spdlog::error("[WorkingImageCPU::downsample]: Failed to extract pixels from OIIO buffer");
@@ -136,6 +136,20 @@ WorkingImageCPU_Default::exportToCPUShared() const
     return shared_ref;
 }
 
+std::expected<Common::ImageView, ErrorHandling::CoreError>
+WorkingImageCPU_Default::exportToCPUView()
+{
+    auto shared_result = exportToCPUShared();
+    if (!shared_result) {
+        return std::unexpected(shared_result.error());
+    }
+
+    std::shared_ptr<Common::ImageRegion> region = std::move(shared_result.value());
+    const std::span<const float> data = region->getBuffer();
+
+    return Common::ImageView::interleaved(data, region->m_width, region->m_height, region->m_channels, std::move(region));
+}
+
 std::pair<Common::ImageDim, Common::ImageDim> WorkingImageCPU_Default::getSize() const
 {
     if (!isValid())
@@ -6,6 +6,8 @@
  */
 
 #include "image_processing/cpu/working_image_cpu_halide.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "config/app_config.h"
 
 #include <spdlog/spdlog.h>
 #include <utility>
@@ -15,6 +17,9 @@ namespace CaptureMoment::Core::ImageProcessing {
 
 WorkingImageCPU_Halide::WorkingImageCPU_Halide(std::unique_ptr<Common::ImageRegion> initial_image)
 {
+    m_storage_format = Config::AppConfig::instance().getWorkingPixelFormat();
+    m_storage_layout = Config::AppConfig::instance().getWorkingPixelLayout();
+
     if (initial_image && initial_image->isValid()) {
         // Use move semantics to initialize efficiently
         auto result = updateFromCPU(std::move(*initial_image));
@@ -42,15 +47,21 @@ WorkingImageCPU_Halide::convertHalideToImageRegion()
         cpu_image_copy->m_channels = static_cast<int>(m_halide_buffer.channels());
         cpu_image_copy->m_format = Common::PixelFormat::RGBA_F32; // Assuming F32 for now
 
-        std::span<const float> data_span = getDataSpan();
-        if (data_span.empty()) {
-            spdlog::warn("[WorkingImageCPU_Halide::convertHalideToImageRegion]: Data span is empty, cannot export");
-            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+        if (m_storage_format == Common::PixelFormat::RGBA_F16 || m_storage_layout == Common::PixelLayout::Planar) {
+            // Widen (interleave) the stored pixels into the exported float region
+            cpu_image_copy->m_data.resize(static_cast<std::size_t>(m_halide_buffer.number_of_elements()));
+            copyToInterleaved(m_halide_buffer, cpu_image_copy->m_data);
+        } else {
+            std::span<const float> data_span = getDataSpan();
+            if (data_span.empty()) {
+                spdlog::warn("[WorkingImageCPU_Halide::convertHalideToImageRegion]: Data span is empty, cannot export");
+                return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+            }
+
+            // Deep copy from unique_ptr back to ImageRegion's vector
+            cpu_image_copy->m_data.assign(data_span.begin(), data_span.end());
         }
 
-        // Deep copy from unique_ptr back to ImageRegion's vector
-        cpu_image_copy->m_data.assign(data_span.begin(), data_span.end());
-
         if (!cpu_image_copy->isValid()) {
             spdlog::warn("[WorkingImageCPU_Halide::convertHalideToImageRegion]: Created ImageRegion is invalid after copying data");
             return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
@@ -79,18 +90,29 @@ WorkingImageCPU_Halide::updateFromCPU(const Common::ImageRegion& cpu_image)
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto result = initializeData(cpu_image);
+    const bool half_storage = m_storage_format == Common::PixelFormat::RGBA_F16;
+
+    // Planar storage is split into planes once, here: the pipelines and the downsample read it as is
+    auto result = half_storage ? initializeMetadata(cpu_image) : initializeData(cpu_image, m_storage_layout);
     if (!result) {
         spdlog::error("[WorkingImageCPU_Halide::updateFromCPU]: Failed to initialize and copy from CPU image. Reason: {}",
                     ErrorHandling::to_string(result.error()));
         return std::unexpected(result.error());
     }
 
-    initializeHalide(getDataSpan(),
-                     static_cast<int>(m_width),
-                     static_cast<int>(m_height),
-                     static_cast<int>(m_channels));
+    if (half_storage) {
+        // Half-float storage: the Halide buffer owns the pixels, m_data stays empty
+        initializeHalideHalf(cpu_image);
+    } else {
+        initializeHalide(getDataSpan(),
+                         static_cast<int>(m_width),
+                         static_cast<int>(m_height),
+                         static_cast<int>(m_channels),
+                         m_layout);
+    }
 
+    // Snapshot the uploaded content as the pipeline input
+    initializeHalideSource();
 
     spdlog::debug("[WorkingImageCPU_Halide::updateFromCPU]: Updated from CPU image ({}x{}, {} ch)",
                       m_width, m_height, m_channels);
@@ -109,6 +131,62 @@ WorkingImageCPU_Halide::exportToCPUCopy()
     return convertHalideToImageRegion();
 }
 
+std::expected<Common::ImageView, ErrorHandling::CoreError>
+WorkingImageCPU_Halide::exportToCPUView()
+{
+    if (!isValid()) {
+        spdlog::warn("[WorkingImageCPU_Halide::exportToCPUView]: Current Halide buffer is invalid, cannot export");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    // Host memory is always current on the CPU backend
+    return makeHostView(m_data);
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+WorkingImageCPU_Halide::downsample(Common::ImageDim target_width, Common::ImageDim target_height)
+{
+    if (!isValid()) {
+        spdlog::warn("[WorkingImageCPU_Halide::downsample]: Current Halide buffer is invalid");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (target_width == 0 || target_height == 0) {
+        spdlog::error("[WorkingImageCPU_Halide::downsample]: Invalid target dimensions: {}x{}", target_width, target_height);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    try {
+        Common::PixelBuffer result_data(static_cast<std::size_t>(target_width) * target_height * m_channels);
+
+        // Realize directly into the region storage (interleaved on both sides, no repack)
+        Halide::Buffer<float> result_buf = wrapInterleaved(result_data.data(),
+                                                           static_cast<int>(target_width),
+                                                           static_cast<int>(target_height),
+                                                           static_cast<int>(m_channels));
+
+        const Halide::Target target = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM);
+        if (auto result = m_downsampler.run(m_halide_buffer, result_buf, target); !result) {
+            return std::unexpected(result.error());
+        }
+
+        auto region = std::make_unique<Common::ImageRegion>(
+            std::move(result_data),
+            static_cast<int>(target_width),
+            static_cast<int>(target_height),
+            static_cast<int>(m_channels));
+        region->m_format = Common::PixelFormat::RGBA_F32;
+
+        spdlog::debug("[WorkingImageCPU_Halide::downsample]: Downsampled {}x{} -> {}x{}",
+                      m_width, m_height, target_width, target_height);
+        return region;
+    }
+    catch (const std::bad_alloc& e) {
+        spdlog::critical("[WorkingImageCPU_Halide::downsample]: Allocation failed: {}", e.what());
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+}
+
 std::pair<Common::ImageDim, Common::ImageDim> WorkingImageCPU_Halide::getSize() const
 {
     if (!isValid()) {
@@ -0,0 +1,161 @@
+/**
+ * @file backend_cost_model.cpp
+ * @brief Implementation of BackendCostModel
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/deciders/backend_cost_model.h"
+#include "image_processing/deciders/backend_decision_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+/**
+ * @brief Converts one benchmark timing into cost coefficients.
+ * @return The profile, or std::nullopt if the timing lacks the image size.
+ */
+std::optional<BackendProfile> to_profile(const BackendBenchmarkTiming& timing)
+{
+    if (timing.m_megapixels <= 0.0 || timing.m_milliseconds <= 0.0) {
+        return std::nullopt;
+    }
+
+    BackendProfile profile;
+    profile.m_latency_ms = std::max(timing.m_latency_ms, 0.0);
+    profile.m_transfer_ms_per_megapixel = std::max(timing.m_transfer_ms, 0.0) / timing.m_megapixels;
+
+    // Whatever is neither fixed overhead nor transfer is compute. Keep it strictly positive
+    // so that a noisy measurement never models a backend as free.
+    const double compute_ms = std::max(timing.m_milliseconds - timing.m_transfer_ms - timing.m_latency_ms,
+                                       timing.m_milliseconds * 0.05);
+    profile.m_compute_ms_per_megapixel = compute_ms / timing.m_megapixels;
+    return profile;
+}
+
+} // namespace
+
+BackendCostModel::BackendCostModel(BackendProfile cpu, std::optional<BackendProfile> gpu) noexcept
+    : m_cpu(cpu)
+    , m_gpu(gpu)
+{
+}
+
+std::optional<BackendCostModel> BackendCostModel::fromTimings(const std::vector<BackendBenchmarkTiming>& timings)
+{
+    const BackendBenchmarkTiming* cpu_timing = nullptr;
+    const BackendBenchmarkTiming* gpu_timing = nullptr;
+
+    for (const auto& timing : timings) {
+        if (timing.m_backend == "CPU") {
+            cpu_timing = &timing;
+        } else if (!gpu_timing || timing.m_milliseconds < gpu_timing->m_milliseconds) {
+            gpu_timing = &timing;
+        }
+    }
+
+    if (!cpu_timing) {
+        return std::nullopt;
+    }
+
+    auto cpu_profile = to_profile(*cpu_timing);
+    if (!cpu_profile) {
+        return std::nullopt;
+    }
+
+    std::optional<BackendProfile> gpu_profile;
+    if (gpu_timing) {
+        gpu_profile = to_profile(*gpu_timing);
+    }
+
+    return BackendCostModel(*cpu_profile, gpu_profile);
+}
+
+void BackendCostModel::calibrate(const Operations::ChainCost& benchmark_chain) noexcept
+{
+    if (benchmark_chain.m_cpu_ns_per_pixel > 0.0) {
+        m_cpu_scale = m_cpu.m_compute_ms_per_megapixel / benchmark_chain.m_cpu_ns_per_pixel;
+    }
+    if (m_gpu && benchmark_chain.m_gpu_ns_per_pixel > 0.0) {
+        m_gpu_scale = m_gpu->m_compute_ms_per_megapixel / benchmark_chain.m_gpu_ns_per_pixel;
+    }
+    spdlog::debug("[BackendCostModel::calibrate]: Measured/nominal cost: CPU {:.2f}, GPU {:.2f}", m_cpu_scale, m_gpu_scale);
+}
+
+std::optional<double> BackendCostModel::estimateMilliseconds(Common::MemoryType backend,
+                                                             Common::ImageDim width,
+                                                             Common::ImageDim height) const noexcept
+{
+    const double megapixels = static_cast<double>(width) * static_cast<double>(height) / 1.0e6;
+
+    if (backend == Common::MemoryType::CPU_RAM) {
+        return m_cpu.estimateMilliseconds(megapixels);
+    }
+    if (backend == Common::MemoryType::GPU_MEMORY && m_gpu) {
+        return m_gpu->estimateMilliseconds(megapixels);
+    }
+    return std::nullopt;
+}
+
+std::optional<double> BackendCostModel::estimateMilliseconds(Common::MemoryType backend,
+                                                             const Operations::ChainCost& chain,
+                                                             Common::ImageDim width,
+                                                             Common::ImageDim height) const noexcept
+{
+    const double megapixels = static_cast<double>(width) * static_cast<double>(height) / 1.0e6;
+
+    // The profile with the chain's compute cost in place of the benchmark's
+    if (backend == Common::MemoryType::CPU_RAM) {
+        BackendProfile profile { m_cpu };
+        profile.m_compute_ms_per_megapixel = chain.m_cpu_ns_per_pixel * m_cpu_scale;
+        return profile.estimateMilliseconds(megapixels);
+    }
+    if (backend == Common::MemoryType::GPU_MEMORY && m_gpu) {
+        BackendProfile profile { *m_gpu };
+        profile.m_compute_ms_per_megapixel = chain.m_gpu_ns_per_pixel * m_gpu_scale;
+        return profile.estimateMilliseconds(megapixels);
+    }
+    return std::nullopt;
+}
+
+Common::MemoryType BackendCostModel::selectBackend(Common::ImageDim width, Common::ImageDim height,
+                                                   double advantage_threshold) const noexcept
+{
+    if (!m_gpu) {
+        return Common::MemoryType::CPU_RAM;
+    }
+
+    return cheaper(width, height, *estimateMilliseconds(Common::MemoryType::CPU_RAM, width, height),
+                   *estimateMilliseconds(Common::MemoryType::GPU_MEMORY, width, height), advantage_threshold);
+}
+
+Common::MemoryType BackendCostModel::selectBackend(Common::ImageDim width, Common::ImageDim height,
+                                                   const Operations::ChainCost& chain,
+                                                   double advantage_threshold) const noexcept
+{
+    if (!m_gpu) {
+        return Common::MemoryType::CPU_RAM;
+    }
+
+    return cheaper(width, height, *estimateMilliseconds(Common::MemoryType::CPU_RAM, chain, width, height),
+                   *estimateMilliseconds(Common::MemoryType::GPU_MEMORY, chain, width, height), advantage_threshold);
+}
+
+Common::MemoryType BackendCostModel::cheaper(Common::ImageDim width, Common::ImageDim height,
+                                             double cpu_ms, double gpu_ms, double advantage_threshold) noexcept
+{
+    const auto selected = (gpu_ms < cpu_ms * advantage_threshold) ? Common::MemoryType::GPU_MEMORY
+                                                                         : Common::MemoryType::CPU_RAM;
+
+    spdlog::debug("[BackendCostModel::selectBackend]: {}x{} -> CPU {:.2f} ms, GPU {:.2f} ms, selecting {}.",
+                  width, height, cpu_ms, gpu_ms,
+                  selected == Common::MemoryType::GPU_MEMORY ? "GPU" : "CPU");
+    return selected;
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
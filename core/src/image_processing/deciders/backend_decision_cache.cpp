@@ -0,0 +1,310 @@
+/**
+ * @file backend_decision_cache.cpp
+ * @brief Implementation of BackendDecisionCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/deciders/backend_decision_cache.h"
+#include "config/app_config.h"
+
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <system_error>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+/**
+ * @brief Version of the benchmark workload. Bump it whenever `BenchmarkingBackendDecider`
+ * measures something different, so that decisions made with the old workload are discarded.
+ */
+constexpr int k_benchmark_version { 5 };
+
+constexpr std::string_view k_fingerprint_key { "fingerprint" };
+constexpr std::string_view k_memory_type_key { "memory_type" };
+constexpr std::string_view k_target_key { "target" };
+constexpr std::string_view k_gpu_target_key { "gpu_target" };
+constexpr std::string_view k_timing_prefix { "timing." };
+
+/**
+ * @brief Fields of the tuned GPU tile, stored as "<key>=<value>".
+ */
+constexpr std::array<std::pair<std::string_view, int GpuTileSchedule::*>, 3> k_gpu_schedule_fields { {
+    { "gpu_tile_width", &GpuTileSchedule::m_tile_width },
+    { "gpu_tile_height", &GpuTileSchedule::m_tile_height },
+    { "gpu_vector_width", &GpuTileSchedule::m_vector_width },
+} };
+
+/**
+ * @brief Secondary per-backend fields, stored as "<prefix><backend>=<value>".
+ */
+constexpr std::array<std::pair<std::string_view, double BackendBenchmarkTiming::*>, 4> k_timing_fields { {
+    { "throughput.", &BackendBenchmarkTiming::m_megapixels_per_second },
+    { "latency.", &BackendBenchmarkTiming::m_latency_ms },
+    { "transfer.", &BackendBenchmarkTiming::m_transfer_ms },
+    { "megapixels.", &BackendBenchmarkTiming::m_megapixels },
+} };
+
+/**
+ * @brief Reads the first line of a small text file (sysfs/procfs entries).
+ * @return The line, or an empty string if the file cannot be read.
+ */
+std::string read_first_line(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    if (file) {
+        std::getline(file, line);
+    }
+    return line;
+}
+
+/**
+ * @brief Describes the installed GPUs and their driver versions.
+ *
+ * @details
+ * Only Linux exposes this without a vendor SDK (sysfs/procfs). On other platforms
+ * the fingerprint falls back to the host target and Halide version.
+ */
+std::string gpu_driver_description()
+{
+    std::string description;
+
+#if defined(__linux__)
+    std::error_code ec;
+    std::vector<std::filesystem::path> cards;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/class/drm", ec)) {
+        const std::string name = entry.path().filename().string();
+        // "card0", not connectors such as "card0-HDMI-A-1"
+        if (name.starts_with("card") && name.find('-') == std::string::npos) {
+            cards.push_back(entry.path());
+        }
+    }
+    std::ranges::sort(cards);
+
+    for (const auto& card : cards) {
+        const auto device_dir = card / "device";
+        const std::string driver = std::filesystem::read_symlink(device_dir / "driver", ec).filename().string();
+
+        description += card.filename().string();
+        description += ':' + read_first_line(device_dir / "vendor");
+        description += ':' + read_first_line(device_dir / "device");
+        description += ':' + driver;
+        if (!driver.empty()) {
+            description += ':' + read_first_line(std::filesystem::path("/sys/module") / driver / "version");
+        }
+        description += ';';
+    }
+
+    // The proprietary NVIDIA driver reports its exact version here
+    description += read_first_line("/proc/driver/nvidia/version");
+#endif
+
+    return description.empty() ? std::string("unknown") : description;
+}
+
+} // namespace
+
+BackendDecisionCache::BackendDecisionCache(std::filesystem::path cache_file)
+    : m_cache_file(std::move(cache_file))
+{
+}
+
+std::filesystem::path BackendDecisionCache::defaultCacheFile()
+{
+    std::filesystem::path base;
+
+#if defined(_WIN32)
+    if (const char* local_app_data = std::getenv("LOCALAPPDATA")) {
+        base = local_app_data;
+    }
+#elif defined(__APPLE__)
+    if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / "Library" / "Caches";
+    }
+#else
+    if (const char* xdg_cache = std::getenv("XDG_CACHE_HOME"); xdg_cache && *xdg_cache) {
+        base = xdg_cache;
+    } else if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / ".cache";
+    }
+#endif
+
+    if (base.empty()) {
+        std::error_code ec;
+        base = std::filesystem::temp_directory_path(ec);
+    }
+
+    return base / "CaptureMoment" / "backend_decision.cache";
+}
+
+std::string BackendDecisionCache::currentFingerprint()
+{
+    std::string fingerprint = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM).to_string();
+    fingerprint += "|halide-" + std::to_string(HALIDE_VERSION_MAJOR) + '.' +
+                   std::to_string(HALIDE_VERSION_MINOR) + '.' + std::to_string(HALIDE_VERSION_PATCH);
+    fingerprint += '|' + gpu_driver_description();
+    fingerprint += "|benchmark-v" + std::to_string(k_benchmark_version);
+
+    // Keep the file line-oriented
+    std::ranges::replace(fingerprint, '\n', ' ');
+    return fingerprint;
+}
+
+std::optional<BackendDecision> BackendDecisionCache::load(std::string_view fingerprint) const
+{
+    std::ifstream file(m_cache_file);
+    if (!file) {
+        spdlog::debug("[BackendDecisionCache::load]: No cache file at '{}'.", m_cache_file.string());
+        return std::nullopt;
+    }
+
+    BackendDecision decision;
+    bool has_memory_type = false;
+    bool has_target = false;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.find('=');
+        if (separator == std::string::npos) {
+            continue;
+        }
+
+        const std::string_view key = std::string_view(line).substr(0, separator);
+        const std::string value = line.substr(separator + 1);
+
+        if (key == k_fingerprint_key) {
+            decision.m_fingerprint = value;
+        } else if (key == k_memory_type_key) {
+            if (auto type = magic_enum::enum_cast<Common::MemoryType>(value)) {
+                decision.m_memory_type = *type;
+                has_memory_type = true;
+            }
+        } else if (key == k_target_key) {
+            if (Halide::Target::validate_target_string(value)) {
+                decision.m_target = Halide::Target(value);
+                has_target = true;
+            }
+        } else if (key.starts_with(k_timing_prefix)) {
+            try {
+                decision.m_timings.push_back(BackendBenchmarkTiming{
+                    std::string(key.substr(k_timing_prefix.size())),
+                    std::stod(value)
+                });
+            } catch (const std::exception&) {
+                spdlog::warn("[BackendDecisionCache::load]: Ignoring malformed timing '{}'.", line);
+            }
+        } else if (key == k_gpu_target_key) {
+            if (Halide::Target::validate_target_string(value)) {
+                decision.m_gpu_target = Halide::Target(value);
+            }
+        } else if (auto field = std::ranges::find(k_gpu_schedule_fields, key, [](const auto& entry) { return entry.first; });
+                   field != k_gpu_schedule_fields.end()) {
+            try {
+                if (!decision.m_gpu_schedule) {
+                    decision.m_gpu_schedule.emplace();
+                }
+                (*decision.m_gpu_schedule).*(field->second) = std::stoi(value);
+            } catch (const std::exception&) {
+                spdlog::warn("[BackendDecisionCache::load]: Ignoring malformed GPU tile '{}'.", line);
+            }
+        } else {
+            for (const auto& [prefix, field] : k_timing_fields) {
+                if (!key.starts_with(prefix)) {
+                    continue;
+                }
+                const std::string_view backend = key.substr(prefix.size());
+                auto it = std::ranges::find(decision.m_timings, backend, &BackendBenchmarkTiming::m_backend);
+                if (it != decision.m_timings.end()) {
+                    try {
+                        (*it).*field = std::stod(value);
+                    } catch (const std::exception&) {
+                        spdlog::warn("[BackendDecisionCache::load]: Ignoring malformed value '{}'.", line);
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    if (!has_memory_type || !has_target) {
+        spdlog::warn("[BackendDecisionCache::load]: Cache file '{}' is incomplete, ignoring it.", m_cache_file.string());
+        return std::nullopt;
+    }
+
+    if (decision.m_gpu_schedule && !decision.m_gpu_schedule->isValid()) {
+        spdlog::warn("[BackendDecisionCache::load]: Ignoring invalid GPU tile in '{}'.", m_cache_file.string());
+        decision.m_gpu_schedule.reset();
+    }
+
+    if (decision.m_fingerprint != fingerprint) {
+        spdlog::info("[BackendDecisionCache::load]: Machine fingerprint changed, cached decision is stale.");
+        return std::nullopt;
+    }
+
+    return decision;
+}
+
+bool BackendDecisionCache::store(const BackendDecision& decision) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_cache_file.parent_path(), ec);
+    if (ec) {
+        spdlog::warn("[BackendDecisionCache::store]: Cannot create '{}': {}", m_cache_file.parent_path().string(), ec.message());
+        return false;
+    }
+
+    // Write to a temporary file first so a crash never leaves a truncated cache behind
+    std::filesystem::path temp_file = m_cache_file;
+    temp_file += ".tmp";
+
+    {
+        std::ofstream file(temp_file, std::ios::trunc);
+        if (!file) {
+            spdlog::warn("[BackendDecisionCache::store]: Cannot open '{}' for writing.", temp_file.string());
+            return false;
+        }
+
+        file << k_fingerprint_key << '=' << decision.m_fingerprint << '\n';
+        file << k_memory_type_key << '=' << magic_enum::enum_name(decision.m_memory_type) << '\n';
+        file << k_target_key << '=' << decision.m_target.to_string() << '\n';
+        if (decision.m_gpu_target) {
+            file << k_gpu_target_key << '=' << decision.m_gpu_target->to_string() << '\n';
+        }
+        if (decision.m_gpu_schedule) {
+            for (const auto& [key, field] : k_gpu_schedule_fields) {
+                file << key << '=' << (*decision.m_gpu_schedule).*field << '\n';
+            }
+        }
+        for (const auto& timing : decision.m_timings) {
+            file << k_timing_prefix << timing.m_backend << '=' << timing.m_milliseconds << '\n';
+            for (const auto& [prefix, field] : k_timing_fields) {
+                file << prefix << timing.m_backend << '=' << timing.*field << '\n';
+            }
+        }
+
+        if (!file) {
+            spdlog::warn("[BackendDecisionCache::store]: Failed writing '{}'.", temp_file.string());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp_file, m_cache_file, ec);
+    if (ec) {
+        spdlog::warn("[BackendDecisionCache::store]: Cannot replace '{}': {}", m_cache_file.string(), ec.message());
+        std::filesystem::remove(temp_file, ec);
+        return false;
+    }
+
+    spdlog::info("[BackendDecisionCache::store]: Backend decision saved to '{}'.", m_cache_file.string());
+    return true;
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
@@ -7,10 +7,17 @@
  */
 
 #include "image_processing/deciders/benchmarking_backend_decider.h"
+#include "image_processing/deciders/cpu_target.h"
+#include "config/app_config.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
 #include <spdlog/spdlog.h>
 #include "Halide.h"
+#include <algorithm>
 #include <array>
 #include <string>
+#include <vector>
 
 namespace CaptureMoment::Core::ImageProcessing {
 
@@ -36,6 +43,20 @@ static std::string feature_to_string(Halide::Target::Feature feature)
     }
 }
 
+/**
+ * @brief Thread-block shapes tried by `tune_gpu_schedule`, the default first.
+ * @details Blocks of 64 to 256 threads, square and wide (wide blocks coalesce the interleaved
+ * rows better on some GPUs), each with 1, 2 and 4 pixels per thread.
+ */
+static constexpr std::array<GpuTileSchedule, 18> k_gpu_schedule_candidates { {
+    {16, 16, 1}, {16, 16, 2}, {16, 16, 4},
+    {32, 8, 1},  {32, 8, 2},  {32, 8, 4},
+    {64, 4, 1},  {64, 4, 2},  {64, 4, 4},
+    {32, 4, 1},  {32, 4, 2},  {32, 4, 4},
+    {16, 8, 1},  {16, 8, 2},  {16, 8, 4},
+    {8, 8, 1},   {8, 8, 2},   {8, 8, 4},
+} };
+
 /**
  * @brief Checks if a GPU feature should be tested on the current platform.
  * @param feature The GPU feature to check.
@@ -71,6 +92,7 @@ static bool should_test_feature(Halide::Target::Feature feature)
     }
 }
 
+
 /**
  * @brief Creates a fresh test buffer filled with gradient data.
  * @return A new Halide::Buffer<float> ready for GPU testing.
@@ -82,24 +104,25 @@ static bool should_test_feature(Halide::Target::Feature feature)
  */
 static Halide::Buffer<float> create_fresh_test_buffer(int width, int height, int channels)
 {
-    Halide::Buffer<float> buffer(width, height, channels);
+    // Same interleaved layout as the working images
+    Halide::Buffer<float> buffer = allocateInterleaved(width, height, channels);
 
-    for (int c = 0; c < channels; ++c)
-    {
-        for (int y = 0; y < height; ++y)
-        {
-            for (int x = 0; x < width; ++x)
-            {
-                buffer(x, y, c) = static_cast<float>((x + y + c) % 256) / 255.0f;
-            }
-        }
-    }
+    // Gradient covering shadows, midtones and highlights so every luminance mask is exercised
+    buffer.for_each_element([&buffer](int x, int y, int c) {
+        buffer(x, y, c) = static_cast<float>((x + y + c) % 256) / 255.0f;
+    });
 
     return buffer;
 }
 
 /**
- * @brief Creates a simple brightness adjustment pipeline for benchmarking.
+ * @brief Creates the benchmark pipeline: the fused tone chain used by interactive edits.
+ *
+ * @details
+ * Chains the six basic adjustments (Brightness, Contrast, Highlights, Shadows, Whites, Blacks)
+ * with the same Halide expressions as `OperationPipelineExecutor`. Values are bound through
+ * `Halide::Param` so that, as in the real pipeline, nothing is constant-folded away.
+ *
  * @param input The input buffer to process.
  * @param x The x dimension variable.
  * @param y The y dimension variable.
@@ -109,8 +132,24 @@ static Halide::Buffer<float> create_fresh_test_buffer(int width, int height, int
 static Halide::Func create_benchmark_pipeline(const Halide::Buffer<float>& input,
                                               Halide::Var& x, Halide::Var& y, Halide::Var& c)
 {
+    auto make_param = [](const char* name, float value) {
+        Halide::Param<float> param(name);
+        param.set(value);
+        return param;
+    };
+
+    Halide::Func current("benchmark_input");
+    current(x, y, c) = input(x, y, c);
+
+    current = Operations::applyBrightnessAdjustment(current, make_param("bench_brightness", 0.05f), x, y, c);
+    current = Operations::applyContrastAdjustment(current, make_param("bench_contrast", 1.1f), x, y, c);
+    current = Operations::applyHighlightsAdjustment(current, make_param("bench_highlights", -0.2f), x, y, c);
+    current = Operations::applyShadowsAdjustment(current, make_param("bench_shadows", 0.2f), x, y, c);
+    current = Operations::applyWhitesAdjustment(current, make_param("bench_whites", 0.1f), x, y, c);
+    current = Operations::applyBlacksAdjustment(current, make_param("bench_blacks", -0.05f), x, y, c);
+
     Halide::Func pipeline("benchmark_pipeline");
-    pipeline(x, y, c) = input(x, y, c) * 1.1f + 0.05f;
+    pipeline(x, y, c) = current(x, y, c);
     return pipeline;
 }
 
@@ -133,24 +172,76 @@ static bool try_compile_jit(Halide::Func& pipeline, const Halide::Target& target
     }
 }
 
+/**
+ * @brief Runs `run_once` a few times to warm up, then returns the median of the timed runs.
+ * @param run_once One complete iteration. Returns false on failure.
+ * @return The median duration, or std::nullopt if any run failed.
+ */
+template<typename RunOnce>
+static std::optional<BenchmarkingBackendDecider::Duration> median_of_runs(RunOnce&& run_once, int warmup_runs, int timed_runs)
+{
+    for (int i = 0; i < warmup_runs; ++i)
+    {
+        if (!run_once())
+        {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<BenchmarkingBackendDecider::Duration> samples;
+    samples.reserve(static_cast<std::size_t>(timed_runs));
+
+    for (int i = 0; i < timed_runs; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        if (!run_once())
+        {
+            return std::nullopt;
+        }
+        auto end = std::chrono::steady_clock::now();
+        samples.emplace_back(end - start);
+    }
+
+    const auto middle = samples.begin() + static_cast<std::ptrdiff_t>(samples.size() / 2);
+    std::nth_element(samples.begin(), middle, samples.end());
+    return *middle;
+}
+
+double BenchmarkingBackendDecider::to_megapixels_per_second(Duration duration)
+{
+    const double megapixels = static_cast<double>(k_benchmark_width) * static_cast<double>(k_benchmark_height) / 1.0e6;
+    const double seconds = duration.count() / 1000.0;
+    return seconds > 0.0 ? megapixels / seconds : 0.0;
+}
+
 Common::MemoryType BenchmarkingBackendDecider::decide()
 {
-    spdlog::info("[BackendDecider] Starting backend performance benchmark...");
+    spdlog::info("[BackendDecider] Starting backend performance benchmark ({}x{}, fused tone chain, median of {})...",
+                 k_benchmark_width, k_benchmark_height, k_timed_runs);
+    m_timings.clear();
+    m_best_gpu_target.reset();
+    m_gpu_schedule.reset();
 
     // --- Phase 1: Log Host Target Info ---
-    Halide::Target host_target = Halide::get_host_target();
-    spdlog::info("[BackendDecider] Host target: {}", host_target.to_string());
+    // The CPU target selected for the engine (native features or portable baseline), GPU targets included
+    Halide::Target host_target = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM);
+    spdlog::info("[BackendDecider] Host target: {} ({} mode, features: {})", host_target.to_string(),
+                 CpuTarget::modeName(Config::AppConfig::instance().getCpuTargetMode()),
+                 CpuTarget::describeFeatures(host_target));
 
     // --- Phase 2: CPU Benchmark ---
-    auto cpu_time = benchmark_cpu();
+    auto cpu_timing = benchmark_cpu();
 
-    if (cpu_time == std::chrono::milliseconds::max())
+    if (!cpu_timing.has_value())
     {
         spdlog::warn("[BackendDecider] CPU benchmark failed completely. Defaulting to CPU.");
         m_winning_target = host_target;
         return Common::MemoryType::CPU_RAM;
     }
-    spdlog::info("[BackendDecider] CPU Baseline: {} ms", cpu_time.count());
+    cpu_timing->m_backend = "CPU";
+    spdlog::info("[BackendDecider] CPU Baseline: {:.2f} ms ({:.1f} MP/s, latency {:.2f} ms)",
+                 cpu_timing->m_milliseconds, cpu_timing->m_megapixels_per_second, cpu_timing->m_latency_ms);
+    m_timings.push_back(*cpu_timing);
 
     // --- Phase 3: Detect & Benchmark GPUs (Strict Priority Order) ---
 
@@ -163,8 +254,7 @@ Common::MemoryType BenchmarkingBackendDecider::decide()
             {Halide::Target::OpenCL, "OpenCL"}
         } };
 
-    std::optional<std::chrono::milliseconds> best_gpu_time;
-    std::string best_gpu_name = "None";
+    std::optional<BackendBenchmarkTiming> best_gpu_timing;
     Halide::Target::Feature best_gpu_feature = Halide::Target::OpenCL;
 
     for (const auto& [feature, name] : gpu_priorities)
@@ -183,96 +273,151 @@ Common::MemoryType BenchmarkingBackendDecider::decide()
         Halide::Buffer<float> fresh_buffer = create_fresh_test_buffer(
             k_benchmark_width, k_benchmark_height, k_benchmark_channels);
 
-        auto result = benchmark_gpu_feature(feature, fresh_buffer);
+        auto result = benchmark_gpu_feature(feature, fresh_buffer, GpuTileSchedule{});
 
         if (result.has_value())
         {
-            if (!best_gpu_time.has_value() || result < best_gpu_time)
+            result->m_backend = name;
+            m_timings.push_back(*result);
+
+            if (!best_gpu_timing.has_value() || result->m_milliseconds < best_gpu_timing->m_milliseconds)
             {
-                best_gpu_time = result;
-                best_gpu_name = name;
+                best_gpu_timing = result;
                 best_gpu_feature = feature;
-                spdlog::info("[BackendDecider] {} benchmarked in {} ms (Current Best)",
-                             name, result.value().count());
+                spdlog::info("[BackendDecider] {} benchmarked in {:.2f} ms (Current Best)",
+                             name, result->m_milliseconds);
             }
             else
             {
-                spdlog::debug("[BackendDecider] {} benchmarked in {} ms (Slower than {})",
-                              name, result.value().count(), best_gpu_name);
+                spdlog::debug("[BackendDecider] {} benchmarked in {:.2f} ms (Slower than {})",
+                              name, result->m_milliseconds, best_gpu_timing->m_backend);
             }
         }
     }
 
-    // --- Phase 4: Final Decision ---
-    if (!best_gpu_time.has_value())
+    if (!best_gpu_timing.has_value())
     {
         spdlog::info("[BackendDecider] No GPU benchmark succeeded. Using CPU backend.");
         m_winning_target = host_target;
         return Common::MemoryType::CPU_RAM;
     }
 
-    spdlog::info("[BackendDecider] Best GPU: {} at {} ms", best_gpu_name, best_gpu_time.value().count());
+    // --- Phase 4: Tune the tile shape on the best GPU, then measure it again with that shape ---
+    m_gpu_schedule = tune_gpu_schedule(best_gpu_feature, create_fresh_test_buffer(
+        k_benchmark_width, k_benchmark_height, k_benchmark_channels));
+
+    if (m_gpu_schedule.has_value() && *m_gpu_schedule != GpuTileSchedule{})
+    {
+        auto tuned = benchmark_gpu_feature(best_gpu_feature, create_fresh_test_buffer(
+            k_benchmark_width, k_benchmark_height, k_benchmark_channels), *m_gpu_schedule);
+
+        if (tuned.has_value() && tuned->m_milliseconds < best_gpu_timing->m_milliseconds)
+        {
+            tuned->m_backend = best_gpu_timing->m_backend;
+            auto it = std::ranges::find(m_timings, tuned->m_backend, &BackendBenchmarkTiming::m_backend);
+            if (it != m_timings.end())
+            {
+                *it = *tuned;
+            }
+            best_gpu_timing = tuned;
+        }
+    }
+
+    // --- Phase 5: Final Decision ---
+    spdlog::info("[BackendDecider] Best GPU: {} at {:.2f} ms", best_gpu_timing->m_backend, best_gpu_timing->m_milliseconds);
+
+    // Keep the best GPU even if the CPU wins globally: large images may still run faster on it
+    m_best_gpu_target = host_target;
+    m_best_gpu_target->set_feature(best_gpu_feature);
 
-    long long threshold_ms = static_cast<long long>(cpu_time.count() * k_gpu_advantage_threshold);
+    const double threshold_ms = cpu_timing->m_milliseconds * k_gpu_advantage_threshold;
 
-    if (best_gpu_time.value().count() < threshold_ms)
+    if (best_gpu_timing->m_milliseconds < threshold_ms)
     {
-        spdlog::info("[BackendDecider] GPU ({} ms) is significantly faster than CPU ({} ms). SELECTING GPU.",
-                     best_gpu_time.value().count(), cpu_time.count());
+        spdlog::info("[BackendDecider] GPU ({:.2f} ms) is significantly faster than CPU ({:.2f} ms). SELECTING GPU.",
+                     best_gpu_timing->m_milliseconds, cpu_timing->m_milliseconds);
 
-        m_winning_target = host_target;
-        m_winning_target.set_feature(best_gpu_feature);
+        m_winning_target = *m_best_gpu_target;
 
         return Common::MemoryType::GPU_MEMORY;
     }
     else
     {
-        spdlog::info("[BackendDecider] CPU ({} ms) is comparable or faster than GPU ({} ms). SELECTING CPU.",
-                     cpu_time.count(), best_gpu_time.value().count());
+        spdlog::info("[BackendDecider] CPU ({:.2f} ms) is comparable or faster than GPU ({:.2f} ms). SELECTING CPU.",
+                     cpu_timing->m_milliseconds, best_gpu_timing->m_milliseconds);
         m_winning_target = host_target;
         return Common::MemoryType::CPU_RAM;
     }
 }
 
-std::chrono::milliseconds BenchmarkingBackendDecider::benchmark_cpu() const
+std::optional<BackendBenchmarkTiming> BenchmarkingBackendDecider::benchmark_cpu() const
 {
     try
     {
-        Halide::Var x, y, c;
-        Halide::Buffer<float> buffer = create_fresh_test_buffer(
+        Halide::Var x, y, c, yo, yi;
+        Halide::Buffer<float> input = create_fresh_test_buffer(
             k_benchmark_width, k_benchmark_height, k_benchmark_channels);
+        Halide::Buffer<float> output = allocateInterleaved(k_benchmark_width, k_benchmark_height, k_benchmark_channels);
+        Halide::Buffer<float> small_output = allocateInterleaved(k_latency_size, k_latency_size, k_benchmark_channels);
 
-        auto pipeline = create_benchmark_pipeline(buffer, x, y, c);
+        // Same schedule as the fused CPU pipeline
+        Halide::Target host_target = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM);
+        auto pipeline = create_benchmark_pipeline(input, x, y, c);
+        pipeline.bound(c, 0, k_interleaved_channels).reorder(c, x, y).unroll(c)
+            .split(y, yo, yi, 8).parallel(yo).vectorize(x, host_target.natural_vector_size<float>());
 
-        auto start = std::chrono::high_resolution_clock::now();
-        pipeline.realize(buffer);
-        auto end = std::chrono::high_resolution_clock::now();
+        pipeline.compile_jit(host_target);
+
+        auto duration = median_of_runs([&]() {
+            pipeline.realize(output, host_target);
+            return true;
+        }, k_warmup_runs, k_timed_runs);
+
+        // Fixed per-run overhead (thread pool wake-up, call overhead): time a tiny realization
+        auto latency = median_of_runs([&]() {
+            pipeline.realize(small_output, host_target);
+            return true;
+        }, k_warmup_runs, k_timed_runs);
+
+        if (!duration.has_value() || !latency.has_value())
+        {
+            return std::nullopt;
+        }
 
-        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        BackendBenchmarkTiming timing;
+        timing.m_milliseconds = duration->count();
+        timing.m_megapixels_per_second = to_megapixels_per_second(*duration);
+        timing.m_latency_ms = latency->count();
+        timing.m_megapixels = static_cast<double>(k_benchmark_width) * static_cast<double>(k_benchmark_height) / 1.0e6;
+        return timing;
     }
     catch (const std::exception& e)
     {
         spdlog::error("[BackendDecider] CPU Benchmark Exception: {}", e.what());
-        return std::chrono::milliseconds::max();
+        return std::nullopt;
     }
 }
 
-std::optional<std::chrono::milliseconds>
+std::optional<BackendBenchmarkTiming>
 BenchmarkingBackendDecider::benchmark_gpu_feature(Halide::Target::Feature feature,
-                                                  const Halide::Buffer<float>& ref_buffer) const
+                                                  const Halide::Buffer<float>& ref_buffer,
+                                                  const GpuTileSchedule& schedule) const
 {
     try
     {
         // Step 1: Create target with GPU feature
-        Halide::Target target = Halide::get_host_target();
+        Halide::Target target = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM);
         target.set_feature(feature);
 
         // Step 2: Create pipeline
         // Note: ref_buffer is already fresh (created in decide() for each backend)
         Halide::Buffer<float> work_buffer(ref_buffer);
-        Halide::Var x, y, c, xo, yo, xi, yi;
+        Halide::Buffer<float> output = allocateInterleaved(k_benchmark_width, k_benchmark_height, k_benchmark_channels);
+        Halide::Buffer<float> small_output = allocateInterleaved(k_latency_size, k_latency_size, k_benchmark_channels);
+        Halide::Var x, y, c, xi, yi;
         auto pipeline = create_benchmark_pipeline(work_buffer, x, y, c);
-        pipeline.gpu_tile(x, y, xo, yo, xi, yi, 16, 16);
+        pipeline.bound(c, 0, k_interleaved_channels).reorder(c, x, y).unroll(c);
+        applyGpuTiles(pipeline, x, y, xi, yi, schedule);
 
         // Step 3: Try JIT compilation FIRST
         if (!try_compile_jit(pipeline, target))
@@ -284,7 +429,7 @@ BenchmarkingBackendDecider::benchmark_gpu_feature(Halide::Target::Feature featur
 
         spdlog::debug("[BackendDecider] {} - JIT compilation successful", feature_to_string(feature));
 
-        // Step 4: Copy to device
+        // Step 4: Probe the device
         // The buffer is fresh, so no interface conflict can occur
         work_buffer.set_host_dirty();
         int copy_res = work_buffer.copy_to_device(target);
@@ -295,27 +440,77 @@ BenchmarkingBackendDecider::benchmark_gpu_feature(Halide::Target::Feature featur
             return std::nullopt;
         }
 
-        // Step 5: Benchmark execution
-        auto start = std::chrono::high_resolution_clock::now();
+        // Step 5: Benchmark a full round trip, as paid by an edit on a freshly loaded image:
+        // upload (Host -> Device), kernel, download (Device -> Host).
+        auto run_once = [&]() {
+            try
+            {
+                work_buffer.set_host_dirty();
+                if (work_buffer.copy_to_device(target) != 0)
+                {
+                    return false;
+                }
+                pipeline.realize(output, target);
+                return output.copy_to_host() == 0;
+            }
+            catch (const Halide::Error& e)
+            {
+                spdlog::debug("[BackendDecider] {} - realize failed: {}", feature_to_string(feature), e.what());
+                return false;
+            }
+        };
 
-        Halide::Buffer<float> result;
-        try
+        auto duration = median_of_runs(run_once, k_warmup_runs, k_timed_runs);
+        if (!duration.has_value())
         {
-            result = pipeline.realize(
-                {k_benchmark_width, k_benchmark_height, k_benchmark_channels}, target);
+            return std::nullopt;
         }
-        catch (const Halide::Error& e)
+
+        // Step 6: Transfers alone (upload of the input, download of the output)
+        auto transfer_once = [&]() {
+            work_buffer.set_host_dirty();
+            if (work_buffer.copy_to_device(target) != 0)
+            {
+                return false;
+            }
+            output.set_device_dirty();
+            return output.copy_to_host() == 0;
+        };
+
+        auto transfer = median_of_runs(transfer_once, k_warmup_runs, k_timed_runs);
+
+        // Step 7: Fixed per-run overhead (kernel launch, synchronization) on a tiny output,
+        // with the input already resident on the device
+        auto latency_once = [&]() {
+            try
+            {
+                pipeline.realize(small_output, target);
+                return small_output.copy_to_host() == 0;
+            }
+            catch (const Halide::Error&)
+            {
+                return false;
+            }
+        };
+
+        auto latency = median_of_runs(latency_once, k_warmup_runs, k_timed_runs);
+
+        if (!transfer.has_value() || !latency.has_value())
         {
-            spdlog::debug("[BackendDecider] {} - realize failed: {}", feature_to_string(feature), e.what());
             return std::nullopt;
         }
 
-        auto end = std::chrono::high_resolution_clock::now();
-
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-        spdlog::info("[BackendDecider] {} benchmark success: {} ms",
-                     feature_to_string(feature), duration.count());
-        return duration;
+        BackendBenchmarkTiming timing;
+        timing.m_milliseconds = duration->count();
+        timing.m_megapixels_per_second = to_megapixels_per_second(*duration);
+        timing.m_latency_ms = latency->count();
+        timing.m_transfer_ms = transfer->count();
+        timing.m_megapixels = static_cast<double>(k_benchmark_width) * static_cast<double>(k_benchmark_height) / 1.0e6;
+
+        spdlog::info("[BackendDecider] {} benchmark success: {:.2f} ms ({:.1f} MP/s, transfers {:.2f} ms, latency {:.2f} ms)",
+                     feature_to_string(feature), timing.m_milliseconds, timing.m_megapixels_per_second,
+                     timing.m_transfer_ms, timing.m_latency_ms);
+        return timing;
     }
     catch (const Halide::Error& e)
     {
@@ -334,4 +529,84 @@ BenchmarkingBackendDecider::benchmark_gpu_feature(Halide::Target::Feature featur
     }
 }
 
+std::optional<GpuTileSchedule>
+BenchmarkingBackendDecider::tune_gpu_schedule(Halide::Target::Feature feature,
+                                              const Halide::Buffer<float>& ref_buffer) const
+{
+    try
+    {
+        Halide::Target target = Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM);
+        target.set_feature(feature);
+
+        // Uploaded once: only the kernels differ between candidates
+        Halide::Buffer<float> work_buffer(ref_buffer);
+        Halide::Buffer<float> output = allocateInterleaved(k_benchmark_width, k_benchmark_height, k_benchmark_channels);
+        work_buffer.set_host_dirty();
+        if (work_buffer.copy_to_device(target) != 0)
+        {
+            return std::nullopt;
+        }
+
+        std::optional<GpuTileSchedule> best;
+        Duration best_duration{};
+
+        for (const GpuTileSchedule& candidate : k_gpu_schedule_candidates)
+        {
+            Halide::Var x, y, c, xi, yi;
+            auto pipeline = create_benchmark_pipeline(work_buffer, x, y, c);
+            pipeline.bound(c, 0, k_interleaved_channels).reorder(c, x, y).unroll(c);
+            applyGpuTiles(pipeline, x, y, xi, yi, candidate);
+
+            if (!try_compile_jit(pipeline, target))
+            {
+                spdlog::debug("[BackendDecider] {} - tile {}x{} (vector {}) does not compile",
+                              feature_to_string(feature), candidate.m_tile_width, candidate.m_tile_height,
+                              candidate.m_vector_width);
+                continue;
+            }
+
+            // The output stays on the device: wait for the kernel, not for a download
+            auto duration = median_of_runs([&]() {
+                try
+                {
+                    pipeline.realize(output, target);
+                    output.device_sync();
+                    return true;
+                }
+                catch (const Halide::Error&)
+                {
+                    return false;
+                }
+            }, k_warmup_runs, k_tuning_runs);
+
+            if (!duration.has_value())
+            {
+                continue;
+            }
+
+            spdlog::debug("[BackendDecider] {} - tile {}x{} (vector {}): {:.3f} ms", feature_to_string(feature),
+                          candidate.m_tile_width, candidate.m_tile_height, candidate.m_vector_width, duration->count());
+
+            if (!best.has_value() || *duration < best_duration)
+            {
+                best = candidate;
+                best_duration = *duration;
+            }
+        }
+
+        if (best.has_value())
+        {
+            spdlog::info("[BackendDecider] {} tuned tile: {}x{}, vector {} ({:.3f} ms per kernel)",
+                         feature_to_string(feature), best->m_tile_width, best->m_tile_height,
+                         best->m_vector_width, best_duration.count());
+        }
+        return best;
+    }
+    catch (const std::exception& e)
+    {
+        spdlog::debug("[BackendDecider] {} tile tuning failed: {}", feature_to_string(feature), e.what());
+        return std::nullopt;
+    }
+}
+
 } // namespace CaptureMoment::Core::ImageProcessing
@@ -0,0 +1,80 @@
+/**
+ * @file cpu_target.cpp
+ * @brief Implementation of CpuTarget.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/deciders/cpu_target.h"
+
+#include <array>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+/**
+ * @brief Instruction-set features worth reporting, most specific first.
+ */
+constexpr std::array k_isa_features {
+    Halide::Target::AVX512_SapphireRapids,
+    Halide::Target::AVX512_Zen4,
+    Halide::Target::AVX512_Cannonlake,
+    Halide::Target::AVX512_Skylake,
+    Halide::Target::AVX512_KNL,
+    Halide::Target::AVX512,
+    Halide::Target::AVXVNNI,
+    Halide::Target::AVX2,
+    Halide::Target::FMA,
+    Halide::Target::F16C,
+    Halide::Target::AVX,
+    Halide::Target::SSE41,
+    Halide::Target::SVE2,
+    Halide::Target::ARMDotProd,
+    Halide::Target::ARMFp16,
+};
+
+} // anonymous namespace
+
+Halide::Target CpuTarget::select(CpuTargetMode mode)
+{
+    // Probed once: the features of the machine do not change while the process runs
+    static const Halide::Target s_host { Halide::get_host_target() };
+
+    if (mode == CpuTargetMode::Portable) {
+        return Halide::Target { s_host.os, s_host.arch, s_host.bits };
+    }
+    return s_host;
+}
+
+std::string CpuTarget::describeFeatures(const Halide::Target& target)
+{
+    std::string features;
+    for (const auto feature : k_isa_features) {
+        if (target.has_feature(feature)) {
+            if (!features.empty()) {
+                features += ' ';
+            }
+            features += Halide::Target::feature_to_name(feature);
+        }
+    }
+    return features.empty() ? std::string { "baseline" } : features;
+}
+
+std::string_view CpuTarget::modeName(CpuTargetMode mode) noexcept
+{
+    return mode == CpuTargetMode::Portable ? "portable" : "native";
+}
+
+std::optional<CpuTargetMode> CpuTarget::parseMode(std::string_view name) noexcept
+{
+    if (name == "native") {
+        return CpuTargetMode::Native;
+    }
+    if (name == "portable") {
+        return CpuTargetMode::Portable;
+    }
+    return std::nullopt;
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
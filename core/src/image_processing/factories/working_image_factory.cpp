@@ -10,26 +10,63 @@
 #include "config/app_config.h"
 #include <spdlog/spdlog.h>
 
+#include <mutex>
+
 namespace CaptureMoment::Core::ImageProcessing {
 
 std::unique_ptr<IWorkingImageHardware> WorkingImageFactory::create(
     const Common::ImageRegion& source_image)
 {
-    auto backend = Config::AppConfig::instance().getProcessingBackend();
-    
-    spdlog::trace("WorkingImageFactory::create (global config): Using global backend config: {}", static_cast<int>(backend));
-    
+    auto& config = Config::AppConfig::instance();
+    auto backend = config.getProcessingBackend();
+    const auto energy_plan = config.currentEnergyPlan();
+
+    bool has_gpu_creator { false };
+    {
+        std::shared_lock lock(s_registry_mutex);
+        has_gpu_creator = s_registry.contains(Common::MemoryType::GPU_MEMORY);
+    }
+
+    // Per-image selection: small images are usually faster on CPU (transfers dominate),
+    // very large ones on GPU (throughput dominates).
+    if (const auto forced = config.getBackendOverride();
+        forced && (*forced == Common::MemoryType::CPU_RAM || has_gpu_creator)) {
+        // The host's performance profile decides
+        backend = *forced;
+        spdlog::debug("WorkingImageFactory::create (override): {}x{} -> backend {}",
+                      source_image.m_width, source_image.m_height, static_cast<int>(backend));
+    } else if (!energy_plan.m_allow_gpu) {
+        // The energy plan keeps the GPU idle, whatever it would gain
+        backend = Common::MemoryType::CPU_RAM;
+        spdlog::debug("WorkingImageFactory::create (energy plan): {}x{} -> CPU only",
+                      source_image.m_width, source_image.m_height);
+    } else if (const auto cost_model = config.getBackendCostModel(); cost_model && has_gpu_creator) {
+        backend = cost_model->selectBackend(source_image.m_width, source_image.m_height,
+                                            energy_plan.m_gpu_advantage_threshold);
+        spdlog::debug("WorkingImageFactory::create (cost model): {}x{} -> backend {}",
+                      source_image.m_width, source_image.m_height, static_cast<int>(backend));
+    } else {
+        spdlog::trace("WorkingImageFactory::create (global config): Using global backend config: {}", static_cast<int>(backend));
+    }
+
     return create(backend, source_image);
 }
+
 std::unique_ptr<IWorkingImageHardware> WorkingImageFactory::create(
     Common::MemoryType backend,
     const Common::ImageRegion& source_image
     )
 {
-    // Look up creator for the requested backend
-    auto it = s_registry.find(backend);
+    // Look up creator for the requested backend; it runs outside the lock
+    CreatorFunction creator;
+    {
+        std::shared_lock lock(s_registry_mutex);
+        if (const auto it = s_registry.find(backend); it != s_registry.end()) {
+            creator = it->second;
+        }
+    }
 
-    if (it == s_registry.end()) {
+    if (!creator) {
         spdlog::error("WorkingImageFactory::create: No creator registered for backend type {}. Unable to create working image.",
                       static_cast<int>(backend));
         return nullptr;
@@ -37,7 +74,6 @@ std::unique_ptr<IWorkingImageHardware> WorkingImageFactory::create(
 
     // Execute creator function
     try {
-        auto creator = it->second;
         return creator(source_image);
     } catch (const std::exception& e) {
         spdlog::critical("WorkingImageFactory::create: Exception thrown by creator for backend {}: {}",
@@ -51,6 +87,7 @@ void WorkingImageFactory::registerCreator(
     CreatorFunction creator
     )
 {
+    std::unique_lock lock(s_registry_mutex);
     if (s_registry.contains(type)) {
         spdlog::warn("WorkingImageFactory::registerCreator: Overriding existing creator for backend type {}.", static_cast<int>(type));
     }
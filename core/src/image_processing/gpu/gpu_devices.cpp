@@ -0,0 +1,145 @@
+/**
+ * @file gpu_devices.cpp
+ * @brief Implementation of GpuDevices.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/gpu/gpu_devices.h"
+
+#include <spdlog/spdlog.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+/**
+ * @brief Device selected on the calling thread.
+ */
+thread_local std::optional<std::size_t> t_device;
+
+/**
+ * @brief Status returned to Halide when the selected device has no context.
+ */
+constexpr int k_context_error = -1;
+
+// Driver API entry points (cuda.h is not a build dependency: the driver is loaded at run time)
+using CuInit = int (*)(unsigned int);
+using CuDeviceGetCount = int (*)(int*);
+using CuDeviceGet = int (*)(int*, int);
+using CuDevicePrimaryCtxRetain = int (*)(void**, int);
+
+/**
+ * @brief Looks a symbol up in the CUDA driver, loading it on first call (nullptr if absent).
+ */
+void* driverSymbol(const char* name)
+{
+#if defined(_WIN32)
+    static HMODULE library { LoadLibraryA("nvcuda.dll") };
+    return library ? reinterpret_cast<void*>(GetProcAddress(library, name)) : nullptr;
+#else
+    static void* library { dlopen("libcuda.so.1", RTLD_NOW | RTLD_LOCAL) };
+    return library ? dlsym(library, name) : nullptr;
+#endif
+}
+
+} // anonymous namespace
+
+GpuDevices& GpuDevices::instance()
+{
+    static GpuDevices* s_instance { new GpuDevices() };
+    return *s_instance;
+}
+
+GpuDevices::GpuDevices()
+{
+    const auto cu_init { reinterpret_cast<CuInit>(driverSymbol("cuInit")) };
+    const auto cu_device_get_count { reinterpret_cast<CuDeviceGetCount>(driverSymbol("cuDeviceGetCount")) };
+    const auto cu_device_get { reinterpret_cast<CuDeviceGet>(driverSymbol("cuDeviceGet")) };
+    const auto cu_primary_retain { reinterpret_cast<CuDevicePrimaryCtxRetain>(driverSymbol("cuDevicePrimaryCtxRetain")) };
+    if (!cu_init || !cu_device_get_count || !cu_device_get || !cu_primary_retain || cu_init(0) != 0) {
+        spdlog::debug("[GpuDevices::GpuDevices]: No CUDA driver: one device.");
+        return;
+    }
+
+    int count { 0 };
+    if (cu_device_get_count(&count) != 0) {
+        return;
+    }
+
+    for (int ordinal = 0; ordinal < count; ++ordinal) {
+        int device { 0 };
+        void* context { nullptr };
+        if (cu_device_get(&device, ordinal) != 0 || cu_primary_retain(&context, device) != 0 || !context) {
+            spdlog::warn("[GpuDevices::GpuDevices]: CUDA device {} unusable, skipped.", ordinal);
+            continue;
+        }
+        m_contexts.push_back(context);
+    }
+
+    spdlog::info("[GpuDevices::GpuDevices]: {} CUDA device(s).", m_contexts.size());
+}
+
+std::size_t GpuDevices::deviceCount() const noexcept
+{
+    return m_contexts.size() > 1 ? m_contexts.size() : 1;
+}
+
+std::optional<std::size_t> GpuDevices::currentDevice() noexcept
+{
+    return t_device;
+}
+
+void GpuDevices::addContextHandlers(Halide::JITHandlers& handlers) const noexcept
+{
+    if (m_contexts.size() < 2) {
+        return;
+    }
+    handlers.custom_cuda_acquire_context = &GpuDevices::acquireContext;
+    handlers.custom_cuda_release_context = &GpuDevices::releaseContext;
+}
+
+int GpuDevices::acquireContext(Halide::JITUserContext* context, void** cuda_context, bool create)
+{
+    static_cast<void>(context);
+    static_cast<void>(create);
+
+    // Installed only with several contexts, retained at startup: there is nothing to create
+    const auto& contexts { instance().m_contexts };
+    const std::size_t device { t_device.value_or(0) };
+    if (device >= contexts.size()) {
+        return k_context_error;
+    }
+    *cuda_context = contexts[device];
+    return 0;
+}
+
+int GpuDevices::releaseContext(Halide::JITUserContext* context)
+{
+    static_cast<void>(context);
+    return 0;
+}
+
+GpuDevices::ScopedDevice::ScopedDevice(std::optional<std::size_t> device) noexcept
+    : m_previous(t_device)
+{
+    if (device) {
+        t_device = device;
+    }
+}
+
+GpuDevices::ScopedDevice::~ScopedDevice()
+{
+    t_device = m_previous;
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
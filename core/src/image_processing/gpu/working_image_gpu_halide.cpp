@@ -8,7 +8,14 @@
  */
 
 #include "image_processing/gpu/working_image_gpu_halide.h"
+#include "image_processing/gpu/gpu_devices.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "image_processing/halide/halide_device_pool.h"
+#include "image_processing/halide/halide_device_transfer.h"
+#include "image_processing/halide/halide_downsampler.h"
 #include "config/app_config.h"
+#include "common/metrics/core_metrics.h"
+#include "common/trace/tracer.h"
 #include <spdlog/spdlog.h>
 #include <utility>
 #include <cstring>
@@ -17,10 +24,47 @@
 
 namespace CaptureMoment::Core::ImageProcessing {
 
+namespace {
+
+/**
+ * @brief Swaps a buffer for a pooled one of the given shape, unless it already has that shape.
+ * @details The previous buffer is parked with its device allocation for the next image.
+ */
+void reshapeFromPool(Halide::Buffer<>& buffer, Halide::Type type, int width, int height, int channels,
+                     const Halide::Target& target)
+{
+    if (isInterleaved(buffer) && buffer.type() == type && buffer.width() == width
+        && buffer.height() == height && buffer.channels() == channels) {
+        return;
+    }
+
+    auto& pool { HalideDevicePool::instance() };
+    pool.release(std::move(buffer));
+    buffer = pool.acquire(type, width, height, channels, target);
+}
+
+/**
+ * @brief Uploads a buffer; if the device is out of memory, trims the device pool and retries once.
+ */
+int uploadOrTrim(Halide::Buffer<>& buffer, const Halide::Target& target)
+{
+    int result { buffer.copy_to_device(target) };
+    if (result != 0) {
+        spdlog::warn("[WorkingImageGPU_Halide::uploadOrTrim]: copy_to_device failed ({}), trimming the device pool.", result);
+        HalideDevicePool::instance().trim();
+        result = buffer.copy_to_device(target);
+    }
+    return result;
+}
+
+} // anonymous namespace
 
 WorkingImageGPU_Halide::WorkingImageGPU_Halide(std::unique_ptr<Common::ImageRegion> initial_image)
+    : m_device(GpuDevices::currentDevice().value_or(0))
 {
-    // We assume AppConfig::getHalideTarget() has been correctly initialized
+    m_storage_format = Config::AppConfig::instance().getWorkingPixelFormat();
+
+    // We assume AppConfig::getHalideTarget(GPU_MEMORY) has been correctly initialized
     // by IBackendDecider at application startup.
     if (initial_image && initial_image->isValid())
     {
@@ -37,29 +81,74 @@ WorkingImageGPU_Halide::WorkingImageGPU_Halide(std::unique_ptr<Common::ImageRegi
     }
 }
 
+WorkingImageGPU_Halide::~WorkingImageGPU_Halide()
+{
+    // The next image of the same shape (on this GPU) takes these device allocations over
+    const GpuDevices::ScopedDevice device_scope { m_device };
+    auto& pool { HalideDevicePool::instance() };
+    pool.release(std::move(m_halide_source_buffer));
+    pool.release(Halide::Buffer<>(std::move(m_display_staging)));
+    if (m_storage_format == Common::PixelFormat::RGBA_F16) {
+        // Float storage wraps the host data of this image and is not pooled
+        pool.release(std::move(m_halide_buffer));
+    }
+}
+
 
 std::expected<void, ErrorHandling::CoreError>
 WorkingImageGPU_Halide::updateFromCPU(const Common::ImageRegion& cpu_image)
 {
-    auto result = initializeData(cpu_image);
+    CM_TRACE_SCOPE("gpu", "upload");
+    const GpuDevices::ScopedDevice device_scope { m_device };
+    const bool half_storage = m_storage_format == Common::PixelFormat::RGBA_F16;
+    const Halide::Target target = Config::AppConfig::getHalideTarget(Common::MemoryType::GPU_MEMORY);
+    const int width = static_cast<int>(cpu_image.m_width);
+    const int height = static_cast<int>(cpu_image.m_height);
+    const int channels = static_cast<int>(cpu_image.m_channels);
+
+    auto result = half_storage ? initializeMetadata(cpu_image) : initializeData(cpu_image);
     if (!result) {
         return result;
     }
 
-    initializeHalide(getDataSpan(),
-                     static_cast<int>(m_width),
-                     static_cast<int>(m_height),
-                     static_cast<int>(m_channels));
+    if (half_storage) {
+        // Half-float storage: host and device buffers are both half the size
+        reshapeFromPool(m_halide_buffer, Halide::Float(16), width, height, channels, target);
+        initializeHalideHalf(cpu_image);
+    } else {
+        initializeHalide(getDataSpan(),
+                         static_cast<int>(m_width),
+                         static_cast<int>(m_height),
+                         static_cast<int>(m_channels));
+    }
+
+    // Snapshot the uploaded content as the pipeline input (into a pooled buffer if the shape changed)
+    reshapeFromPool(m_halide_source_buffer, m_halide_buffer.type(), width, height, channels, target);
+    initializeHalideSource();
 
-    // Transfer to GPU
-    Halide::Target target = Config::AppConfig::getHalideTarget();
-    m_halide_buffer.set_host_dirty();
-    int gpu_result = m_halide_buffer.copy_to_device(target);
+    // Upload the source once. From here on both buffers stay on the device:
+    // edits realize source -> destination there, and only the display image comes back.
+    m_halide_source_buffer.set_host_dirty();
+    int gpu_result = uploadOrTrim(m_halide_source_buffer, target);
 
     if (gpu_result != 0) {
-        spdlog::critical("[WorkingImageGPU_Halide::updateFromCPU]: copy_to_device failed: {}", gpu_result);
+        spdlog::critical("[WorkingImageGPU_Halide::updateFromCPU]: copy_to_device (source) failed: {}", gpu_result);
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
     }
+    Common::Metrics::coreMetrics().m_gpu_uploaded_bytes.add(m_halide_source_buffer.size_in_bytes());
+
+    // The destination starts equal to the source: copy it on the device instead of uploading it again
+    if (!copyOnDevice(m_halide_source_buffer, m_halide_buffer)) {
+        spdlog::warn("[WorkingImageGPU_Halide::updateFromCPU]: Device copy failed, uploading the destination.");
+        m_halide_buffer.set_host_dirty();
+        gpu_result = uploadOrTrim(m_halide_buffer, target);
+
+        if (gpu_result != 0) {
+            spdlog::critical("[WorkingImageGPU_Halide::updateFromCPU]: copy_to_device failed: {}", gpu_result);
+            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+        Common::Metrics::coreMetrics().m_gpu_uploaded_bytes.add(m_halide_buffer.size_in_bytes());
+    }
 
     spdlog::debug("[WorkingImageGPU_Halide::updateFromCPU]: Updated ({}x{}, {} ch)",
                   m_width, m_height, m_channels);
@@ -71,6 +160,8 @@ WorkingImageGPU_Halide::updateFromCPU(const Common::ImageRegion& cpu_image)
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
 WorkingImageGPU_Halide::exportToCPUCopy()
 {
+    const GpuDevices::ScopedDevice device_scope { m_device };
+
     if (!isValid())
     {
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
@@ -78,16 +169,40 @@ WorkingImageGPU_Halide::exportToCPUCopy()
 
     try
     {
-        // Sync GPU → CPU
-        int result = m_halide_buffer.copy_to_host();
-        if (result != 0) {
-            spdlog::critical("[WorkingImageGPU_Halide::exportToCPUCopy]: copy_to_host failed: {}", result);
-            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+        // Download the device-resident result straight into the exported region.
+        // The working buffer stays on the device (its host mirror is left stale):
+        // one transfer, no intermediate host copy.
+        Common::PixelBuffer copied_data(static_cast<std::size_t>(m_halide_buffer.number_of_elements()));
+
+        if (m_storage_format == Common::PixelFormat::RGBA_F16) {
+            // Download the halves (half the bus traffic), then widen on the host
+            Halide::Buffer<> half_staging = allocatePinnedInterleaved(Halide::Float(16),
+                                                                      static_cast<int>(m_width),
+                                                                      static_cast<int>(m_height),
+                                                                      static_cast<int>(m_channels));
+            if (!downloadInto(m_halide_buffer, half_staging)) {
+                if (int result = m_halide_buffer.copy_to_host(); result != 0) {
+                    spdlog::critical("[WorkingImageGPU_Halide::exportToCPUCopy]: copy_to_host failed: {}", result);
+                    return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+                }
+                half_staging = m_halide_buffer;
+            }
+            convertHalfToFloat(half_staging, copied_data);
         }
-
-        // Copy to ImageRegion
-        std::vector<float> copied_data(m_data_size);
-        std::memcpy(copied_data.data(), m_data.get(), m_data_size * sizeof(float));
+        else if (Halide::Buffer<float> export_buffer = wrapInterleaved(copied_data.data(),
+                                                                       static_cast<int>(m_width),
+                                                                       static_cast<int>(m_height),
+                                                                       static_cast<int>(m_channels));
+                 !downloadInto(m_halide_buffer, export_buffer)) {
+            // Not on the device (or the direct copy failed): go through the host mirror
+            if (int result = m_halide_buffer.copy_to_host(); result != 0) {
+                spdlog::critical("[WorkingImageGPU_Halide::exportToCPUCopy]: copy_to_host failed: {}", result);
+                return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+            }
+            std::memcpy(copied_data.data(), m_data.get(), m_data_size * sizeof(float));
+        }
+        // The full working image in its storage format, whichever path brought it back
+        Common::Metrics::coreMetrics().m_gpu_downloaded_bytes.add(m_halide_buffer.size_in_bytes());
 
         auto region = std::make_unique<Common::ImageRegion>(
             std::move(copied_data),
@@ -112,64 +227,71 @@ WorkingImageGPU_Halide::exportToCPUCopy()
     }
 }
 
-std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
-WorkingImageGPU_Halide::downsample(Common::ImageDim target_width, Common::ImageDim target_height)
+std::expected<Common::ImageView, ErrorHandling::CoreError>
+WorkingImageGPU_Halide::exportToCPUView()
 {
-    if (!m_valid) {
+    const GpuDevices::ScopedDevice device_scope { m_device };
+
+    if (!isValid())
+    {
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
     }
 
-    try {
-        Halide::Target target = Config::AppConfig::getHalideTarget();
-
-        // GPU downsample
-        Halide::Func downsample("downsample_gpu");
-        Halide::Var x, y, c;
-
-        float scale_x = static_cast<float>(m_width) / target_width;
-        float scale_y = static_cast<float>(m_height) / target_height;
-
-        // Use bilinear interpolation for better quality
-        Halide::Expr src_x = x * scale_x;
-        Halide::Expr src_y = y * scale_y;
-
-        downsample(x, y, c) = m_halide_buffer(
-            Halide::cast<int>(src_x),
-            Halide::cast<int>(src_y),
-            c
-            );
+    // Bring the host mirror up to date (no-op unless the device copy is newer)
+    const bool downloads { m_halide_buffer.device_dirty() };
+    if (int result = m_halide_buffer.copy_to_host(); result != 0) {
+        spdlog::critical("[WorkingImageGPU_Halide::exportToCPUView]: copy_to_host failed: {}", result);
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+    if (downloads) {
+        Common::Metrics::coreMetrics().m_gpu_downloaded_bytes.add(m_halide_buffer.size_in_bytes());
+    }
 
-        Halide::Var xi, yi;
-        downsample.gpu_tile(x, y, xi, yi, 16, 16);
+    return makeHostView(m_data);
+}
 
-        // Realize to a temporary buffer
-        Halide::Buffer<float> result_buf = downsample.realize(
-            {static_cast<int>(target_width),
-             static_cast<int>(target_height),
-             static_cast<int>(m_channels)},
-            target
-            );
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+WorkingImageGPU_Halide::downsample(Common::ImageDim target_width, Common::ImageDim target_height)
+{
+    const GpuDevices::ScopedDevice device_scope { m_device };
 
-        // Copy to host
-        result_buf.copy_to_host();
+    if (!m_valid) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
 
-        // Check strides
-        spdlog::debug("[WorkingImageGPU_Halide::downsample]: strides = {}, {}, {}",
-                      result_buf.dim(0).stride(), result_buf.dim(1).stride(), result_buf.dim(2).stride());
+    if (target_width == 0 || target_height == 0) {
+        spdlog::error("[WorkingImageGPU_Halide::downsample]: Invalid target dimensions: {}x{}", target_width, target_height);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
 
-        // Copy data to contiguous vector
-        size_t result_size = target_width * target_height * m_channels;
-        std::vector<float> result_data(result_size);
+    try {
+        Halide::Target target = Config::AppConfig::getHalideTarget(Common::MemoryType::GPU_MEMORY);
+
+        // The staging buffer is reused across edits. When the display size changes, it is
+        // swapped through the device pool, so going back to a previous size does not allocate.
+        Halide::Buffer<> staging { std::move(m_display_staging) };
+        reshapeFromPool(staging, Halide::Float(32),
+                        static_cast<int>(target_width),
+                        static_cast<int>(target_height),
+                        static_cast<int>(m_channels),
+                        target);
+        m_display_staging = std::move(staging);
+
+        // Filtered downsample on the device, reading the device-resident result
+        if (auto result = m_downsampler.run(m_halide_buffer, m_display_staging, target); !result) {
+            return std::unexpected(result.error());
+        }
 
-        // Manual copy respecting strides
-        for (int c = 0; c < static_cast<int>(m_channels); ++c) {
-            for (int y = 0; y < static_cast<int>(target_height); ++y) {
-                for (int x = 0; x < static_cast<int>(target_width); ++x) {
-                    size_t dst_idx = (y * target_width + x) * m_channels + c;
-                    result_data[dst_idx] = result_buf(x, y, c);
-                }
-            }
+        // Only the display-size image crosses the bus
+        if (int result = m_display_staging.copy_to_host(); result != 0) {
+            spdlog::critical("[WorkingImageGPU_Halide::downsample]: copy_to_host failed: {}", result);
+            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
         }
+        Common::Metrics::coreMetrics().m_gpu_downloaded_bytes.add(m_display_staging.size_in_bytes());
+
+        // Both sides are interleaved: a single contiguous copy
+        Common::PixelBuffer result_data(m_display_staging.data(),
+                                        m_display_staging.data() + m_display_staging.number_of_elements());
 
         auto region = std::make_unique<Common::ImageRegion>(
             std::move(result_data),
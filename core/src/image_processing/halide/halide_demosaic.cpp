@@ -0,0 +1,157 @@
+/**
+ * @file halide_demosaic.cpp
+ * @brief Implementation of HalideDemosaic.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/halide/halide_demosaic.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "config/app_config.h"
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+HalideDemosaic::HalideDemosaic()
+    : m_mosaic(Halide::UInt(16), 2, "demosaic_mosaic")
+    , m_black("demosaic_black")
+    , m_scale("demosaic_scale")
+    , m_phase_x("demosaic_phase_x")
+    , m_phase_y("demosaic_phase_y")
+    , m_half_size("demosaic_half_size")
+{
+}
+
+void HalideDemosaic::build(const Halide::Target& target)
+{
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Var xi("xi"), yi("yi"), yo("yo");
+
+    // Mirroring around the edge samples keeps the CFA phase of the mirrored photosites
+    Halide::Func edge = Halide::BoundaryConditions::mirror_interior(m_mosaic);
+    Halide::Func raw("demosaic_raw");
+    raw(x, y) = Halide::max(Halide::cast<float>(edge(x, y)) - m_black, 0.0f) * m_scale;
+
+    // --- Full size: Malvar-He-Cutler, in RGGB terms ---
+    Halide::Expr px = (x + m_phase_x) % 2;
+    Halide::Expr py = (y + m_phase_y) % 2;
+    Halide::Expr red_site = px == 0 && py == 0;
+    Halide::Expr blue_site = px == 1 && py == 1;
+    Halide::Expr green_in_red_row = px == 1 && py == 0;
+
+    Halide::Expr centre = raw(x, y);
+    Halide::Expr horizontal = raw(x - 1, y) + raw(x + 1, y);
+    Halide::Expr vertical = raw(x, y - 1) + raw(x, y + 1);
+    Halide::Expr far_horizontal = raw(x - 2, y) + raw(x + 2, y);
+    Halide::Expr far_vertical = raw(x, y - 2) + raw(x, y + 2);
+    Halide::Expr diagonal = raw(x - 1, y - 1) + raw(x + 1, y - 1) + raw(x - 1, y + 1) + raw(x + 1, y + 1);
+
+    // Green at a red or blue site; blue at red and red at blue; the color of the row
+    // (respectively column) neighbors at a green site
+    Halide::Expr green_at_rb = (4.0f * centre + 2.0f * (horizontal + vertical) - (far_horizontal + far_vertical)) * 0.125f;
+    Halide::Expr opposite_at_rb = (6.0f * centre + 2.0f * diagonal - 1.5f * (far_horizontal + far_vertical)) * 0.125f;
+    Halide::Expr row_at_green = (5.0f * centre + 4.0f * horizontal - far_horizontal - diagonal + 0.5f * far_vertical) * 0.125f;
+    Halide::Expr column_at_green = (5.0f * centre + 4.0f * vertical - far_vertical - diagonal + 0.5f * far_horizontal) * 0.125f;
+
+    Halide::Expr full_red = Halide::select(red_site, centre, blue_site, opposite_at_rb,
+                                           green_in_red_row, row_at_green, column_at_green);
+    Halide::Expr full_green = Halide::select(red_site || blue_site, green_at_rb, centre);
+    Halide::Expr full_blue = Halide::select(blue_site, centre, red_site, opposite_at_rb,
+                                            green_in_red_row, column_at_green, row_at_green);
+
+    // --- Half size: one pixel per quad, red at (phase_x, phase_y), blue diagonal to it ---
+    Halide::Expr qx = 2 * x;
+    Halide::Expr qy = 2 * y;
+    Halide::Expr half_red = raw(qx + m_phase_x, qy + m_phase_y);
+    Halide::Expr half_blue = raw(qx + 1 - m_phase_x, qy + 1 - m_phase_y);
+    Halide::Expr half_green = 0.5f * (raw(qx + 1 - m_phase_x, qy + m_phase_y) + raw(qx + m_phase_x, qy + 1 - m_phase_y));
+
+    // The interpolation undershoots at sharp edges: no negative light
+    Halide::Func rgb("demosaic_rgb");
+    rgb(x, y) = Halide::select(m_half_size,
+                               Halide::Tuple(half_red, half_green, half_blue),
+                               Halide::Tuple(Halide::max(full_red, 0.0f), Halide::max(full_green, 0.0f),
+                                             Halide::max(full_blue, 0.0f)));
+
+    Halide::Func output("demosaic");
+    output(x, y, c) = Halide::select(c == 0, rgb(x, y)[0], c == 1, rgb(x, y)[1], c == 2, rgb(x, y)[2], 1.0f);
+
+    // Interleaved RGBA: the four channels of a pixel are written together
+    output.bound(c, 0, k_interleaved_channels).reorder(c, x, y).unroll(c);
+    constrainInterleaved(output.output_buffer());
+
+    if (target.has_gpu_feature()) {
+        m_compiled_schedule = Config::AppConfig::getGpuTileSchedule();
+        applyGpuTiles(output, x, y, xi, yi, m_compiled_schedule);
+        rgb.compute_at(output, xi);
+    } else {
+        const int vector_size = target.natural_vector_size<float>();
+        output.split(y, yo, yi, 16).parallel(yo).vectorize(x, vector_size);
+        rgb.compute_at(output, x).vectorize(x, vector_size);
+    }
+
+    // Both paths as separate code instead of a per-pixel select.
+    // Must come last: a specialization copies the schedule defined so far.
+    output.specialize(m_half_size);
+
+    output.compile_jit(target);
+
+    m_output = output;
+    m_compiled_target = target;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+HalideDemosaic::run(const RawMosaic& mosaic, Halide::Buffer<float>& output, bool half_size, const Halide::Target& target)
+{
+    if (!mosaic.isValid()) {
+        spdlog::error("[HalideDemosaic::run]: Invalid mosaic ({}x{}).", mosaic.m_width, mosaic.m_height);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const int width = static_cast<int>(half_size ? mosaic.m_width / 2 : mosaic.m_width);
+    const int height = static_cast<int>(half_size ? mosaic.m_height / 2 : mosaic.m_height);
+    if (!isInterleaved(output) || output.channels() != k_interleaved_channels
+        || output.width() != width || output.height() != height) {
+        spdlog::error("[HalideDemosaic::run]: Output must be {}x{} interleaved RGBA.", width, height);
+        return std::unexpected(ErrorHandling::CoreError::InvalidHalideBuffer);
+    }
+
+    try {
+        if (!m_compiled_target || *m_compiled_target != target
+            || (target.has_gpu_feature() && m_compiled_schedule != Config::AppConfig::getGpuTileSchedule())) {
+            spdlog::debug("[HalideDemosaic::run]: Compiling demosaic for target {}.", target.to_string());
+            build(target);
+        }
+
+        // Red photosite of the top-left quad, as an offset to RGGB
+        const bool red_on_odd_column = mosaic.m_pattern == CfaPattern::GRBG || mosaic.m_pattern == CfaPattern::BGGR;
+        const bool red_on_odd_row = mosaic.m_pattern == CfaPattern::GBRG || mosaic.m_pattern == CfaPattern::BGGR;
+
+        m_black.set(mosaic.m_black_level);
+        m_scale.set(1.0f / (mosaic.m_white_level - mosaic.m_black_level));
+        m_phase_x.set(red_on_odd_column ? 1 : 0);
+        m_phase_y.set(red_on_odd_row ? 1 : 0);
+        m_half_size.set(half_size);
+
+        // Read only: the pipeline never writes its input
+        Halide::Buffer<std::uint16_t> samples(const_cast<std::uint16_t*>(mosaic.m_data.data()),
+                                              static_cast<int>(mosaic.m_width), static_cast<int>(mosaic.m_height));
+        m_mosaic.set(samples);
+
+        m_output.realize(output, target);
+        if (target.has_gpu_feature()) {
+            output.copy_to_host();
+            output.device_free();
+        }
+        m_mosaic.reset();
+        return {};
+    }
+    catch (const std::exception& e) {
+        spdlog::critical("[HalideDemosaic::run]: Demosaic failed: {}", e.what());
+        m_compiled_target.reset();
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
@@ -0,0 +1,240 @@
+/**
+ * @file halide_device_pool.cpp
+ * @brief Implementation of HalideDevicePool.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/halide/halide_device_pool.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "image_processing/halide/halide_device_transfer.h"
+#include "image_processing/gpu/gpu_devices.h"
+#include "common/memory/buffer_pool.h"
+#include "common/memory/memory_budget.h"
+#include "common/metrics/core_metrics.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+/**
+ * @brief true if a parked buffer can serve a request of this type and shape.
+ */
+bool matches(const Halide::Buffer<>& buffer, Halide::Type type, int width, int height, int channels,
+             const halide_device_interface_t* device_interface) noexcept
+{
+    return buffer.raw_buffer()->device_interface == device_interface
+           && isInterleaved(buffer)
+           && buffer.type() == type
+           && buffer.width() == width
+           && buffer.height() == height
+           && buffer.channels() == channels;
+}
+
+} // anonymous namespace
+
+HalideDevicePool& HalideDevicePool::instance()
+{
+    // Intentionally leaked, see the constructor
+    static HalideDevicePool* pool = new HalideDevicePool();
+
+    // Device memory shares the ceiling: on unified-memory GPUs it is system memory
+    static const auto* registration = new Common::MemoryBudget::Registration(Common::MemoryBudget::instance().registerConsumer(
+        "GPU device pool",
+        [] { return pool->cachedBytes(); },
+        [](std::size_t) { return pool->trim(); }));
+    static_cast<void>(registration);
+
+    return *pool;
+}
+
+Halide::Buffer<> HalideDevicePool::acquire(Halide::Type type, int width, int height, int channels,
+                                           const Halide::Target& target)
+{
+    // A buffer cannot move to another device: after a backend change, parked buffers only age out
+    const halide_device_interface_t* device_interface { deviceInterfaceOf(target) };
+    const std::size_t device { GpuDevices::currentDevice().value_or(0) };
+
+    const std::size_t bytes { static_cast<std::size_t>(width) * static_cast<std::size_t>(height)
+                              * static_cast<std::size_t>(channels) * type.bytes() };
+    const std::size_t size_class { Common::BufferPool::sizeClass(bytes) };
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        // Only runtimes already loaded take the setting: enable it once the device's runtime exists
+        if (device_interface && std::ranges::find(m_reuse_interfaces, device_interface) == m_reuse_interfaces.end()) {
+            m_reuse_interfaces.push_back(device_interface);
+            Halide::Internal::JITSharedRuntime::reuse_device_allocations(true);
+            spdlog::debug("[HalideDevicePool::acquire]: Device allocation reuse enabled.");
+        }
+
+        if (auto it = m_free_lists.find(size_class); device_interface && it != m_free_lists.end()) {
+            auto& buffers { it->second };
+            const auto found { std::ranges::find_if(buffers, [&](const Parked& parked) {
+                return parked.m_device == device
+                       && matches(parked.m_buffer, type, width, height, channels, device_interface);
+            }) };
+            if (found != buffers.end()) {
+                Halide::Buffer<> buffer { std::move(found->m_buffer) };
+                buffers.erase(found);
+                m_parking_order.erase(std::ranges::find(m_parking_order, size_class));
+                m_cached_bytes -= std::min(m_cached_bytes, footprintOf(buffer));
+                ++m_reuses;
+                Common::Metrics::coreMetrics().m_gpu_pool_reuses.add(1);
+                return buffer;
+            }
+        }
+        ++m_allocations;
+    }
+
+    Common::Metrics::coreMetrics().m_gpu_pool_allocations.add(1);
+    return allocatePinnedInterleaved(type, width, height, channels);
+}
+
+void HalideDevicePool::release(Halide::Buffer<>&& buffer) noexcept
+{
+    Halide::Buffer<> parked { std::move(buffer) };
+    if (!parked.defined() || parked.raw_buffer()->device == 0 || !isInterleaved(parked)) {
+        return;
+    }
+
+    const std::size_t footprint { footprintOf(parked) };
+    const std::size_t size_class { Common::BufferPool::sizeClass(parked.size_in_bytes()) };
+
+    bool evicted { false };
+    {
+        std::lock_guard lock(m_mutex);
+        if (footprint > m_max_cached_bytes) {
+            return;
+        }
+        evicted = m_cached_bytes + footprint > m_max_cached_bytes;
+        evict_unsafe(m_max_cached_bytes - footprint);
+
+        try {
+            m_parking_order.push_back(size_class);
+            m_free_lists[size_class].push_back(Parked { std::move(parked), GpuDevices::currentDevice().value_or(0) });
+            m_cached_bytes += footprint;
+        } catch (const std::bad_alloc&) {
+            // Free list growth failed: the buffer is freed, an order entry left behind is skipped
+        }
+    }
+
+    // The evicted allocations sit in the runtimes' reuse lists, which have no limit of their own
+    if (evicted) {
+        releaseUnusedDeviceMemory();
+    }
+}
+
+std::size_t HalideDevicePool::trim() noexcept
+{
+    std::size_t freed { 0 };
+    {
+        std::lock_guard lock(m_mutex);
+        freed = m_cached_bytes;
+        // Frees the device allocations (each in the context of its GPU) into the runtimes' reuse lists...
+        for (auto& [size_class, buffers] : m_free_lists) {
+            for (Parked& parked : buffers) {
+                const GpuDevices::ScopedDevice device_scope { parked.m_device };
+                parked.m_buffer = Halide::Buffer<>();
+            }
+        }
+        m_free_lists.clear();
+        m_parking_order.clear();
+        m_cached_bytes = 0;
+    }
+
+    // ... and out of them
+    releaseUnusedDeviceMemory();
+
+    spdlog::debug("[HalideDevicePool::trim]: Released {} parked bytes", freed);
+    return freed;
+}
+
+void HalideDevicePool::setMaxCachedBytes(std::size_t bytes) noexcept
+{
+    bool evicted { false };
+    {
+        std::lock_guard lock(m_mutex);
+        m_max_cached_bytes = bytes;
+        evicted = m_cached_bytes > m_max_cached_bytes;
+        evict_unsafe(m_max_cached_bytes);
+    }
+
+    if (evicted) {
+        releaseUnusedDeviceMemory();
+    }
+}
+
+std::size_t HalideDevicePool::cachedBytes() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_cached_bytes;
+}
+
+std::size_t HalideDevicePool::reuseCount() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_reuses;
+}
+
+std::size_t HalideDevicePool::allocationCount() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_allocations;
+}
+
+std::size_t HalideDevicePool::footprintOf(const Halide::Buffer<>& buffer) noexcept
+{
+    const std::size_t bytes { buffer.size_in_bytes() };
+    return buffer.data() ? bytes * 2 : bytes;
+}
+
+const halide_device_interface_t* HalideDevicePool::deviceInterfaceOf(const Halide::Target& target) noexcept
+{
+    if (!target.has_gpu_feature()) {
+        return nullptr;
+    }
+
+    try {
+        return Halide::get_device_interface_for_device_api(Halide::DeviceAPI::Default_GPU, target);
+    } catch (const Halide::Error& e) {
+        spdlog::debug("[HalideDevicePool::deviceInterfaceOf]: No device interface: {}", e.what());
+        return nullptr;
+    }
+}
+
+void HalideDevicePool::evict_unsafe(std::size_t limit) noexcept
+{
+    while (m_cached_bytes > limit && !m_parking_order.empty()) {
+        const auto it { m_free_lists.find(m_parking_order.front()) };
+        m_parking_order.erase(m_parking_order.begin());
+        if (it == m_free_lists.end() || it->second.empty()) {
+            continue;
+        }
+        auto& buffers { it->second };
+
+        m_cached_bytes -= std::min(m_cached_bytes, footprintOf(buffers.front().m_buffer));
+        // Freed in the context of its own GPU
+        const GpuDevices::ScopedDevice device_scope { buffers.front().m_device };
+        buffers.erase(buffers.begin());
+    }
+}
+
+void HalideDevicePool::releaseUnusedDeviceMemory() noexcept
+{
+    try {
+        // Disabling reuse frees what the runtimes hold (halide_device_release_unused)
+        Halide::Internal::JITSharedRuntime::reuse_device_allocations(false);
+        Halide::Internal::JITSharedRuntime::reuse_device_allocations(true);
+    } catch (const Halide::Error& e) {
+        spdlog::warn("[HalideDevicePool::releaseUnusedDeviceMemory]: {}", e.what());
+    }
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
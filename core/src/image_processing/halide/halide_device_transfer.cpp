@@ -0,0 +1,130 @@
+/**
+ * @file halide_device_transfer.cpp
+ * @brief Implementation of device-side Halide buffer copies.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/halide/halide_device_transfer.h"
+
+#include "config/app_config.h"
+#include "common/memory/pinned_memory.h"
+
+#include "HalideRuntime.h"
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+Halide::Buffer<> allocatePinnedInterleaved(Halide::Type type, int width, int height, int channels)
+{
+    // Shape first, then host memory from the pinned allocator (freed through it as well)
+    Halide::Buffer<> buffer { Halide::Buffer<>::make_interleaved(type, static_cast<void*>(nullptr), width, height, channels) };
+    buffer.allocate(&Common::acquirePinned, &Common::releasePinned);
+    return buffer;
+}
+
+bool isDeviceResident(const Halide::Buffer<>& buffer) noexcept
+{
+    if (!buffer.defined()) {
+        return false;
+    }
+
+    const halide_buffer_t* raw = buffer.raw_buffer();
+    return raw->device != 0 && raw->device_interface != nullptr && !raw->host_dirty();
+}
+
+bool copyOnDevice(const Halide::Buffer<>& source, Halide::Buffer<> destination)
+{
+    if (!isDeviceResident(source) || !destination.defined() || destination.type() != source.type()) {
+        return false;
+    }
+
+    const halide_device_interface_t* device_interface = source.raw_buffer()->device_interface;
+
+    // Allocate the destination next to the source (a buffer cannot switch device interfaces)
+    halide_buffer_t* raw_destination = destination.raw_buffer();
+    if (raw_destination->device_interface && raw_destination->device_interface != device_interface) {
+        spdlog::warn("[copyOnDevice]: Destination lives on another device interface.");
+        return false;
+    }
+    if (raw_destination->device == 0) {
+        if (const int result = destination.get()->device_malloc(device_interface); result != 0) {
+            spdlog::error("[copyOnDevice]: device_malloc failed: {}", result);
+            return false;
+        }
+    }
+
+    if (const int result = device_interface->buffer_copy(nullptr,
+                                                         const_cast<halide_buffer_t*>(source.raw_buffer()),
+                                                         device_interface,
+                                                         raw_destination);
+        result != 0) {
+        spdlog::error("[copyOnDevice]: buffer_copy failed: {}", result);
+        return false;
+    }
+
+    destination.set_host_dirty(false);
+    destination.set_device_dirty(true);
+    return true;
+}
+
+bool downloadInto(const Halide::Buffer<>& source, Halide::Buffer<> destination)
+{
+    if (!isDeviceResident(source) || !destination.defined() || !destination.data()
+        || destination.type() != source.type()) {
+        return false;
+    }
+
+    const halide_device_interface_t* device_interface = source.raw_buffer()->device_interface;
+
+    // A null destination interface means "copy into the destination's host memory"
+    if (const int result = device_interface->buffer_copy(nullptr,
+                                                         const_cast<halide_buffer_t*>(source.raw_buffer()),
+                                                         nullptr,
+                                                         destination.raw_buffer());
+        result != 0) {
+        spdlog::error("[downloadInto]: buffer_copy failed: {}", result);
+        return false;
+    }
+
+    destination.set_host_dirty(false);
+    destination.set_device_dirty(false);
+    return true;
+}
+
+std::optional<MetalBufferHandle> metalBufferOf(const Halide::Buffer<>& buffer)
+{
+    if (!isDeviceResident(buffer)) {
+        return std::nullopt;
+    }
+
+    const halide_buffer_t* raw = buffer.raw_buffer();
+
+    try {
+        const halide_device_interface_t* metal_interface =
+            Halide::get_device_interface_for_device_api(Halide::DeviceAPI::Metal,
+                                                        Config::AppConfig::getHalideTarget(Common::MemoryType::GPU_MEMORY));
+        if (metal_interface == nullptr || raw->device_interface != metal_interface) {
+            return std::nullopt;
+        }
+    }
+    catch (const Halide::Error& e) {
+        spdlog::debug("[metalBufferOf]: No Metal device interface: {}", e.what());
+        return std::nullopt;
+    }
+
+    // Layout of the Metal runtime's device handle (src/runtime/metal.cpp)
+    struct MetalDeviceHandle {
+        std::uint64_t offset;
+        void* buffer;
+    };
+
+    const auto* handle = reinterpret_cast<const MetalDeviceHandle*>(raw->device);
+    return MetalBufferHandle {
+        reinterpret_cast<std::uintptr_t>(handle->buffer),
+        static_cast<std::size_t>(handle->offset)
+    };
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
@@ -0,0 +1,151 @@
+/**
+ * @file halide_downsampler.cpp
+ * @brief Implementation of HalideDownsampler.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/halide/halide_downsampler.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "config/app_config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+HalideDownsampler::HalideDownsampler()
+    : m_input(Halide::Float(32), 3, "downsample_input")
+    , m_scale_x("downsample_scale_x")
+    , m_scale_y("downsample_scale_y")
+    , m_taps_x("downsample_taps_x")
+    , m_taps_y("downsample_taps_y")
+    , m_bilinear("downsample_bilinear")
+{
+    constrainInterleaved(m_input);
+}
+
+void HalideDownsampler::build(const Halide::Target& target, const Halide::Type& input_type, Common::PixelLayout input_layout)
+{
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Var xi("xi"), yi("yi"), yo("yo");
+
+    if (m_input.type() != input_type || input_layout != m_compiled_input_layout) {
+        m_input = Halide::ImageParam(input_type, 3, "downsample_input");
+        constrainLayout(m_input, input_layout);
+    }
+
+    // Half-float sources are widened on load, the filter always accumulates in float
+    Halide::Func edge = Halide::BoundaryConditions::repeat_edge(m_input);
+    Halide::Func clamped("downsample_source");
+    clamped(x, y, c) = Halide::cast<float>(edge(x, y, c));
+
+    // --- Area average: the footprint is centered on the output pixel center ---
+    auto footprint_start = [](const Halide::Var& v, const Halide::Param<float>& scale, const Halide::Param<int>& taps) {
+        Halide::Expr center = (Halide::cast<float>(v) + 0.5f) * scale;
+        return Halide::cast<int>(Halide::floor(center - Halide::cast<float>(taps) * 0.5f + 0.5f));
+    };
+
+    Halide::RDom r(0, m_taps_x, 0, m_taps_y, "footprint");
+
+    Halide::Func sum("downsample_sum");
+    sum(x, y, c) = 0.0f;
+    sum(x, y, c) += clamped(footprint_start(x, m_scale_x, m_taps_x) + r.x,
+                            footprint_start(y, m_scale_y, m_taps_y) + r.y,
+                            c);
+
+    Halide::Expr area = sum(x, y, c) / Halide::cast<float>(m_taps_x * m_taps_y);
+
+    // --- Bilinear: four taps around the mapped output pixel center ---
+    Halide::Expr src_x = (Halide::cast<float>(x) + 0.5f) * m_scale_x - 0.5f;
+    Halide::Expr src_y = (Halide::cast<float>(y) + 0.5f) * m_scale_y - 0.5f;
+    Halide::Expr ix = Halide::cast<int>(Halide::floor(src_x));
+    Halide::Expr iy = Halide::cast<int>(Halide::floor(src_y));
+    Halide::Expr fx = src_x - Halide::cast<float>(ix);
+    Halide::Expr fy = src_y - Halide::cast<float>(iy);
+
+    Halide::Expr top = Halide::lerp(clamped(ix, iy, c), clamped(ix + 1, iy, c), fx);
+    Halide::Expr bottom = Halide::lerp(clamped(ix, iy + 1, c), clamped(ix + 1, iy + 1, c), fx);
+    Halide::Expr bilinear = Halide::lerp(top, bottom, fy);
+
+    Halide::Func output("downsample");
+    output(x, y, c) = Halide::select(m_bilinear, bilinear, area);
+
+    // Interleaved RGBA: the four channels of a pixel are computed together
+    output.bound(c, 0, k_interleaved_channels).reorder(c, x, y).unroll(c);
+    constrainInterleaved(output.output_buffer());
+
+    if (target.has_gpu_feature()) {
+        // One thread per display pixel (or vector of pixels), accumulating in registers
+        m_compiled_schedule = Config::AppConfig::getGpuTileSchedule();
+        applyGpuTiles(output, x, y, xi, yi, m_compiled_schedule);
+        sum.compute_at(output, xi).reorder(c, x, y).unroll(c);
+        sum.update().reorder(c, r.x, r.y).unroll(c);
+    } else {
+        // Parallel over row strips, vectorized across pixels
+        const int vector_size = target.natural_vector_size<float>();
+        output.split(y, yo, yi, 16).parallel(yo).vectorize(x, vector_size);
+        sum.compute_at(output, x).reorder(c, x, y).unroll(c).vectorize(x, vector_size);
+        sum.update().reorder(c, x, r.x, r.y).unroll(c).vectorize(x, vector_size);
+    }
+
+    // Compile both filters as separate code paths instead of a per-pixel select.
+    // Must come last: a specialization copies the schedule defined so far.
+    output.specialize(m_bilinear);
+
+    output.compile_jit(target);
+
+    m_output = output;
+    m_compiled_target = target;
+    m_compiled_input_type = input_type;
+    m_compiled_input_layout = input_layout;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+HalideDownsampler::run(const Halide::Buffer<>& input, Halide::Buffer<float>& output, const Halide::Target& target)
+{
+    if ((!isInterleaved(input) && !isPlanar(input)) || !isInterleaved(output)
+        || input.channels() != k_interleaved_channels || output.channels() != k_interleaved_channels) {
+        spdlog::error("[HalideDownsampler::run]: Buffers must be RGBA, interleaved (or a planar input).");
+        return std::unexpected(ErrorHandling::CoreError::InvalidHalideBuffer);
+    }
+
+    if (input.type() != Halide::Float(32) && input.type() != Halide::Float(16)) {
+        spdlog::error("[HalideDownsampler::run]: Unsupported input element type.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidHalideBuffer);
+    }
+
+    try {
+        const Common::PixelLayout input_layout = layoutOf(input);
+        if (!m_compiled_target || *m_compiled_target != target || m_compiled_input_type != input.type()
+            || m_compiled_input_layout != input_layout
+            || (target.has_gpu_feature() && m_compiled_schedule != Config::AppConfig::getGpuTileSchedule())) {
+            spdlog::debug("[HalideDownsampler::run]: Compiling downsample for target {} ({}-bit {} input).",
+                          target.to_string(), input.type().bits(),
+                          input_layout == Common::PixelLayout::Planar ? "planar" : "interleaved");
+            build(target, input.type(), input_layout);
+        }
+
+        const float scale_x = static_cast<float>(input.width()) / static_cast<float>(output.width());
+        const float scale_y = static_cast<float>(input.height()) / static_cast<float>(output.height());
+
+        m_scale_x.set(scale_x);
+        m_scale_y.set(scale_y);
+        m_taps_x.set(std::max(1, static_cast<int>(std::ceil(scale_x))));
+        m_taps_y.set(std::max(1, static_cast<int>(std::ceil(scale_y))));
+        m_bilinear.set(std::max(scale_x, scale_y) < k_area_average_threshold);
+        m_input.set(input);
+
+        m_output.realize(output, target);
+        return {};
+    }
+    catch (const std::exception& e) {
+        spdlog::critical("[HalideDownsampler::run]: Downsample failed: {}", e.what());
+        m_compiled_target.reset();
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
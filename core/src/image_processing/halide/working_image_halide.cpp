@@ -6,11 +6,15 @@
  */
 
 #include "image_processing/halide/working_image_halide.h"
+#include "image_processing/halide/halide_buffer_layout.h"
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+
 namespace CaptureMoment::Core::ImageProcessing {
 
-void WorkingImageHalide::initializeHalide(std::span<float> data, Common::ImageDim width, Common::ImageDim height, Common::ImageChan channels)
+void WorkingImageHalide::initializeHalide(std::span<float> data, Common::ImageDim width, Common::ImageDim height, Common::ImageChan channels,
+                                          Common::PixelLayout layout)
 {
     if (data.empty()) {
         spdlog::error("[WorkingImageHalide::initializeHalide]: Cannot initialize Halide buffer: data span is empty.");
@@ -18,15 +22,155 @@ void WorkingImageHalide::initializeHalide(std::span<float> data, Common::ImageDi
     }
 
     // Create Halide Buffer View (Zero-Copy)
-    // std::span::data() returns the underlying pointer safely.
-    m_halide_buffer = Halide::Buffer<float>(data.data(), width, height, channels);
+    // Interleaved data (RGBARGBA...) needs channel-innermost strides; planes are Halide's default layout.
+    const bool planar = layout == Common::PixelLayout::Planar;
+    m_halide_buffer = planar ? Halide::Buffer<float>(data.data(),
+                                                     static_cast<int>(width),
+                                                     static_cast<int>(height),
+                                                     static_cast<int>(channels))
+                             : wrapInterleaved(data.data(),
+                                               static_cast<int>(width),
+                                               static_cast<int>(height),
+                                               static_cast<int>(channels));
 
     if (!m_halide_buffer.defined()) {
         spdlog::error("[WorkingImageHalide::initializeHalide]: Failed to define Halide::Buffer.");
     } else {
-        spdlog::debug("[WorkingImageHalide::initializeHalide]: Halide buffer initialized ({}x{}, {} ch, zero-copy).",
-                      width, height, channels);
+        spdlog::debug("[WorkingImageHalide::initializeHalide]: Halide buffer initialized ({}x{}, {} ch, {}, zero-copy).",
+                      width, height, channels, planar ? "planar" : "interleaved");
+    }
+}
+
+void WorkingImageHalide::initializeHalideHalf(const Common::ImageRegion& cpu_image)
+{
+    const int width = static_cast<int>(cpu_image.m_width);
+    const int height = static_cast<int>(cpu_image.m_height);
+    const int channels = static_cast<int>(cpu_image.m_channels);
+
+    const bool same_shape = hasLayout(m_halide_buffer, m_storage_layout)
+                            && m_halide_buffer.type() == Halide::Float(16)
+                            && m_halide_buffer.width() == width
+                            && m_halide_buffer.height() == height
+                            && m_halide_buffer.channels() == channels;
+
+    if (!same_shape) {
+        m_halide_buffer = allocate(Halide::Float(16), width, height, channels, m_storage_layout);
     }
+
+    Halide::Buffer<Halide::float16_t> half_buffer = m_halide_buffer;
+    if (m_storage_layout == Common::PixelLayout::Planar) {
+        // Split into planes while narrowing: Halide walks both layouts together
+        const auto source = Halide::Buffer<const float>::make_interleaved(cpu_image.m_data.data(), width, height, channels);
+        half_buffer.for_each_value([](Halide::float16_t& dst, const float& src) { dst = Halide::float16_t(src); }, source);
+    } else {
+        // Dense interleaved on both sides: a flat, element-wise narrowing
+        Halide::float16_t* dst = half_buffer.data();
+        const float* src = cpu_image.m_data.data();
+        const std::size_t count = half_buffer.number_of_elements();
+
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = Halide::float16_t(src[i]);
+        }
+    }
+    m_halide_buffer.set_host_dirty();
+
+    spdlog::debug("[WorkingImageHalide::initializeHalideHalf]: Half-float buffer initialized ({}x{}, {} ch).",
+                  width, height, channels);
+}
+
+void WorkingImageHalide::convertHalfToFloat(const Halide::Buffer<>& source, std::span<float> destination)
+{
+    const Halide::Buffer<Halide::float16_t> half_buffer = source;
+    const Halide::float16_t* src = half_buffer.data();
+    const std::size_t count = std::min<std::size_t>(destination.size(), half_buffer.number_of_elements());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        destination[i] = static_cast<float>(src[i]);
+    }
+}
+
+void WorkingImageHalide::copyToInterleaved(const Halide::Buffer<>& source, std::span<float> destination)
+{
+    if (isInterleaved(source) && source.type() == Halide::Float(16)) {
+        convertHalfToFloat(source, destination);
+        return;
+    }
+
+    Halide::Buffer<float> interleaved = wrapInterleaved(destination.data(), source.width(), source.height(), source.channels());
+    if (source.type() == Halide::Float(16)) {
+        const Halide::Buffer<const Halide::float16_t> half_source = source;
+        interleaved.for_each_value([](float& dst, const Halide::float16_t& src) { dst = static_cast<float>(src); }, half_source);
+    } else {
+        // Same element type: Halide's copy handles the differing strides
+        interleaved.copy_from(Halide::Buffer<const float>(source));
+    }
+}
+
+std::expected<Common::ImageView, ErrorHandling::CoreError>
+WorkingImageHalide::makeHostView(const std::shared_ptr<float[]>& float_storage) const
+{
+    if (!m_halide_buffer.defined()) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    const auto width = static_cast<Common::ImageDim>(m_halide_buffer.width());
+    const auto height = static_cast<Common::ImageDim>(m_halide_buffer.height());
+    const auto channels = static_cast<Common::ImageChan>(m_halide_buffer.channels());
+    const auto count = static_cast<std::size_t>(m_halide_buffer.number_of_elements());
+
+    if (m_halide_buffer.type() == Halide::Float(16) || !isInterleaved(m_halide_buffer)) {
+        try {
+            // No interleaved float buffer to share: the view owns a widened (interleaved) copy
+            auto widened = std::make_shared<Common::PixelBuffer>(count);
+            copyToInterleaved(m_halide_buffer, *widened);
+            const std::span<const float> data = *widened;
+            return Common::ImageView::interleaved(data, width, height, channels, std::move(widened));
+        } catch (const std::bad_alloc& e) {
+            spdlog::critical("[WorkingImageHalide::makeHostView]: Allocation failed: {}", e.what());
+            return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+        }
+    }
+
+    if (!float_storage) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    // The destination wraps float_storage: share it (aliasing keep-alive, no copy)
+    return Common::ImageView::interleaved(std::span<const float>(float_storage.get(), count),
+                                          width, height, channels,
+                                          std::shared_ptr<const void>(float_storage, float_storage.get()));
+}
+
+void WorkingImageHalide::initializeHalideSource()
+{
+    if (!m_halide_buffer.defined()) {
+        spdlog::error("[WorkingImageHalide::initializeHalideSource]: Destination buffer is undefined.");
+        return;
+    }
+
+    const Common::PixelLayout layout = layoutOf(m_halide_buffer);
+    const bool same_shape = hasLayout(m_halide_source_buffer, layout)
+                            && m_halide_source_buffer.type() == m_halide_buffer.type()
+                            && m_halide_source_buffer.width() == m_halide_buffer.width()
+                            && m_halide_source_buffer.height() == m_halide_buffer.height()
+                            && m_halide_source_buffer.channels() == m_halide_buffer.channels();
+
+    if (same_shape) {
+        // Reuse the existing allocation
+        m_halide_source_buffer.copy_from(m_halide_buffer);
+        m_halide_source_buffer.set_host_dirty();
+    } else {
+        // Allocate a dense buffer of the same layout and copy the content
+        m_halide_source_buffer = allocate(m_halide_buffer.type(),
+                                          m_halide_buffer.width(),
+                                          m_halide_buffer.height(),
+                                          m_halide_buffer.channels(),
+                                          layout);
+        m_halide_source_buffer.copy_from(m_halide_buffer);
+    }
+
+    spdlog::debug("[WorkingImageHalide::initializeHalideSource]: Source buffer snapshot taken ({}x{}, {} ch).",
+                  m_halide_source_buffer.width(), m_halide_source_buffer.height(), m_halide_source_buffer.channels());
 }
 
 std::pair<Common::ImageDim, Common::ImageDim> WorkingImageHalide::getSizeByHalide() const noexcept
@@ -59,7 +203,7 @@ Common::ImageSize WorkingImageHalide::getDataSizeByHalide() const noexcept
     if (!m_halide_buffer.defined()) {
         return 0;
     }
-    return static_cast<Common::ImageSize>(m_halide_buffer.size_in_bytes() / sizeof(float));
+    return static_cast<Common::ImageSize>(m_halide_buffer.number_of_elements());
 }
 
 } // namespace CaptureMoment::Core::ImageProcessing
@@ -9,6 +9,7 @@
 #include "image_processing/working_image_context.h"
 #include "common/error_handling/core_error.h"
 #include "image_processing/factories/working_image_factory.h"
+#include "common/trace/tracer.h"
 
 #include <spdlog/spdlog.h>
 #include <expected>
@@ -21,7 +22,7 @@ bool WorkingImageContext::prepare(std::unique_ptr<Common::ImageRegion>&& origina
         return false;
     }
 
-    auto new_image = WorkingImageFactory::create(std::move(*original_tile));
+    auto new_image = WorkingImageFactory::create(*original_tile);
 
     if (!new_image) {
         spdlog::error("[WorkingImageContext::prepare]: Failed to create WorkingImage.");
@@ -29,10 +30,70 @@ bool WorkingImageContext::prepare(std::unique_ptr<Common::ImageRegion>&& origina
     }
 
     m_working_image = std::move(new_image);
-    spdlog::debug("[WorkingImageContext::prepare]: Created new WorkingImage.");
+    m_original_image = std::shared_ptr<const Common::ImageRegion>(std::move(original_tile));
+    spdlog::debug("[WorkingImageContext::prepare]: Created new WorkingImage, original kept resident.");
     return true;
 }
 
+bool WorkingImageContext::prepare(std::shared_ptr<const Common::ImageRegion> original_tile)
+{
+    if (!original_tile || !original_tile->isValid()) {
+        return false;
+    }
+
+    auto new_image = WorkingImageFactory::create(*original_tile);
+
+    if (!new_image) {
+        spdlog::error("[WorkingImageContext::prepare]: Failed to create WorkingImage.");
+        return false;
+    }
+
+    m_working_image = std::move(new_image);
+    m_original_image = std::move(original_tile);
+    spdlog::debug("[WorkingImageContext::prepare]: Created new WorkingImage over a shared original.");
+    return true;
+}
+
+bool WorkingImageContext::restoreOriginal()
+{
+    if (!m_original_image) {
+        spdlog::error("[WorkingImageContext::restoreOriginal]: No resident original image.");
+        return false;
+    }
+
+    return update(*m_original_image);
+}
+
+bool WorkingImageContext::setOriginal(std::unique_ptr<Common::ImageRegion>&& original_tile)
+{
+    if (!original_tile || !original_tile->isValid()) {
+        spdlog::error("[WorkingImageContext::setOriginal]: Invalid original tile.");
+        return false;
+    }
+
+    m_original_image = std::shared_ptr<const Common::ImageRegion>(std::move(original_tile));
+    spdlog::debug("[WorkingImageContext::setOriginal]: Resident original replaced.");
+    return true;
+}
+
+bool WorkingImageContext::setOriginal(std::shared_ptr<const Common::ImageRegion> original_tile)
+{
+    if (!original_tile || !original_tile->isValid()) {
+        spdlog::error("[WorkingImageContext::setOriginal]: Invalid original tile.");
+        return false;
+    }
+
+    m_original_image = std::move(original_tile);
+    spdlog::debug("[WorkingImageContext::setOriginal]: Resident original replaced (shared).");
+    return true;
+}
+
+std::shared_ptr<const Common::ImageRegion>
+WorkingImageContext::getOriginalImage() const noexcept
+{
+    return m_original_image;
+}
+
 bool WorkingImageContext::update(const Common::ImageRegion& original_tile)
 {
     if (!m_working_image) {
@@ -71,6 +132,15 @@ WorkingImageContext::getWorkingImageAsRegion() const
     return m_working_image->exportToCPUCopy();
 }
 
+std::expected<Common::ImageView, ErrorHandling::CoreError>
+WorkingImageContext::getWorkingImageView() const
+{
+    if (!m_working_image) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+    return m_working_image->exportToCPUView();
+}
+
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
 WorkingImageContext::getDownsampled(Common::ImageDim target_width, Common::ImageDim target_height)
 {
@@ -78,12 +148,14 @@ WorkingImageContext::getDownsampled(Common::ImageDim target_width, Common::Image
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
     }
 
+    CM_TRACE_SCOPE("display", "downsample");
     return m_working_image->downsample(target_width, target_height);
 }
 
 void WorkingImageContext::release() noexcept
 {
     m_working_image.reset();
+    m_original_image.reset();
 }
 
 } // namespace CaptureMoment::Core::ImageProcessing
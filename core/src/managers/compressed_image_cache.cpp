@@ -0,0 +1,294 @@
+/**
+ * @file compressed_image_cache.cpp
+ * @brief Implementation of CompressedImageCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/compressed_image_cache.h"
+#include "workers/compute_pool.h"
+#include "workers/engine_scheduler.h"
+
+#include "config.h"
+
+#include <spdlog/spdlog.h>
+
+#if CAPTUREMOMENT_USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+/**
+ * @brief Number of bands of an image of `height` rows.
+ */
+[[nodiscard]] int bandCount(int height)
+{
+    return (height + CompressedImageCache::k_band_rows - 1) / CompressedImageCache::k_band_rows;
+}
+
+/**
+ * @brief Rows `[first, first + rows)` of band `band`, as an ROI of the image.
+ */
+[[nodiscard]] OIIO::ROI bandRoi(const OIIO::ImageSpec& spec, int band)
+{
+    const int first { band * CompressedImageCache::k_band_rows };
+    const int rows { std::min(CompressedImageCache::k_band_rows, spec.height - first) };
+    return OIIO::ROI(spec.x, spec.x + spec.width, spec.y + first, spec.y + first + rows, 0, 1, 0, spec.nchannels);
+}
+
+} // anonymous namespace
+
+CompressedImageCache::CompressedImageCache(std::size_t capacity_bytes, std::size_t max_entries)
+    : m_capacity_bytes(capacity_bytes)
+    , m_max_entries(max_entries)
+    , m_budget_registration(Common::MemoryBudget::instance().registerConsumer(
+          "Compressed image cache",
+          [this] { return sizeBytes(); },
+          [this](std::size_t bytes) { return evictBytes(bytes); }))
+{
+}
+
+void CompressedImageCache::store(std::string_view path, const OIIO::ImageBuf& image)
+{
+    if (!image.initialized() || image.spec().width <= 0 || image.spec().height <= 0) {
+        return;
+    }
+
+    const auto begin { std::chrono::steady_clock::now() };
+    auto entry { std::make_shared<Entry>() };
+    entry->m_path = std::string(path);
+    if (!compress(image, *entry)) {
+        spdlog::warn("[CompressedImageCache::store]: Cannot compress '{}', not cached", path);
+        return;
+    }
+
+    const std::size_t raw_bytes { image.spec().image_bytes() };
+    spdlog::debug("[CompressedImageCache::store]: '{}' {} MB -> {} MB in {:.0f} ms", path, raw_bytes >> 20,
+                  entry->m_bytes >> 20,
+                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (const auto it = m_index.find(entry->m_path); it != m_index.end()) {
+            m_size_bytes -= (*it->second)->m_bytes;
+            m_entries.erase(it->second);
+            m_index.erase(it);
+        }
+
+        if (entry->m_bytes > m_capacity_bytes || m_max_entries == 0) {
+            spdlog::debug("[CompressedImageCache::store]: '{}' ({} MB) exceeds the budget, not cached", path, entry->m_bytes >> 20);
+            return;
+        }
+
+        m_size_bytes += entry->m_bytes;
+        m_entries.push_front(std::move(entry));
+        m_index.emplace(m_entries.front()->m_path, m_entries.begin());
+
+        evictToCapacity();
+    }
+
+    // Outside the lock: the budget may call back into evictBytes
+    m_budget_registration.notifyGrowth();
+}
+
+CompressedImageCache::Buffer CompressedImageCache::load(std::string_view path)
+{
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard lock(m_mutex);
+
+        const auto it = m_index.find(std::string(path));
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        entry = *it->second;
+    }
+    m_budget_registration.touch();
+
+    // Decompressed without the lock: an eviction meanwhile leaves this copy of the entry alive
+    const auto begin { std::chrono::steady_clock::now() };
+    auto image { decompress(entry->m_spec, entry->m_bands) };
+    if (!image) {
+        spdlog::warn("[CompressedImageCache::load]: Corrupt entry for '{}', dropped", path);
+        erase(path);
+        return nullptr;
+    }
+
+    spdlog::debug("[CompressedImageCache::load]: '{}' restored in {:.0f} ms", path,
+                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    return image;
+}
+
+bool CompressedImageCache::contains(std::string_view path) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_index.contains(std::string(path));
+}
+
+void CompressedImageCache::erase(std::string_view path)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (const auto it = m_index.find(std::string(path)); it != m_index.end()) {
+        m_size_bytes -= (*it->second)->m_bytes;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+}
+
+void CompressedImageCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_size_bytes = 0;
+}
+
+std::size_t CompressedImageCache::capacityBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_capacity_bytes;
+}
+
+std::size_t CompressedImageCache::maxEntries() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_max_entries;
+}
+
+std::size_t CompressedImageCache::sizeBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_size_bytes;
+}
+
+std::size_t CompressedImageCache::evictBytes(std::size_t bytes)
+{
+    std::lock_guard lock(m_mutex);
+
+    std::size_t freed { 0 };
+    while (freed < bytes && !m_entries.empty()) {
+        const Entry& victim = *m_entries.back();
+        spdlog::debug("[CompressedImageCache::evictBytes]: Evicting '{}'", victim.m_path);
+        freed += victim.m_bytes;
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_path);
+        m_entries.pop_back();
+    }
+    return freed;
+}
+
+void CompressedImageCache::evictToCapacity()
+{
+    while ((m_size_bytes > m_capacity_bytes || m_entries.size() > m_max_entries) && !m_entries.empty()) {
+        const Entry& victim = *m_entries.back();
+        spdlog::debug("[CompressedImageCache::evictToCapacity]: Evicting '{}'", victim.m_path);
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_path);
+        m_entries.pop_back();
+    }
+}
+
+bool CompressedImageCache::compress(const OIIO::ImageBuf& image, Entry& entry)
+{
+    entry.m_spec = image.spec();
+    entry.m_spec.set_format(OIIO::TypeDesc::FLOAT);
+
+    const int bands { bandCount(entry.m_spec.height) };
+    entry.m_bands.resize(static_cast<std::size_t>(bands));
+
+    // Off the latency path (the loader's background lane) unless called from a more urgent task
+    const auto priority { Workers::EngineScheduler::currentPriority().value_or(Workers::TaskPriority::Thumbnail) };
+    const int status { Workers::ComputePool::instance().parallelFor(priority, bands, [&](int band) {
+        const OIIO::ROI roi { bandRoi(entry.m_spec, band) };
+        const std::size_t values { static_cast<std::size_t>(roi.npixels()) * static_cast<std::size_t>(roi.nchannels()) };
+
+        std::vector<std::uint16_t> halves(values);
+        if (!image.get_pixels(roi, OIIO::TypeDesc::HALF, halves.data())) {
+            return 1;
+        }
+
+        // Low bytes, then high bytes: the high bytes (sign, exponent) repeat and compress well
+        std::vector<std::byte> planes(values * 2);
+        for (std::size_t i = 0; i < values; ++i) {
+            planes[i] = static_cast<std::byte>(halves[i] & 0xFFu);
+            planes[values + i] = static_cast<std::byte>(halves[i] >> 8);
+        }
+
+#if CAPTUREMOMENT_USE_ZSTD
+        std::vector<std::byte> compressed(ZSTD_compressBound(planes.size()));
+        const std::size_t size { ZSTD_compress(compressed.data(), compressed.size(), planes.data(), planes.size(),
+                                               k_compression_level) };
+        if (ZSTD_isError(size)) {
+            return 1;
+        }
+        compressed.resize(size);
+        compressed.shrink_to_fit();
+        entry.m_bands[static_cast<std::size_t>(band)] = std::move(compressed);
+#else
+        entry.m_bands[static_cast<std::size_t>(band)] = std::move(planes);
+#endif
+        return 0;
+    }) };
+    if (status != 0) {
+        return false;
+    }
+
+    entry.m_bytes = 0;
+    for (const auto& band : entry.m_bands) {
+        entry.m_bytes += band.size();
+    }
+    return true;
+}
+
+CompressedImageCache::Buffer CompressedImageCache::decompress(const OIIO::ImageSpec& spec,
+                                                             const std::vector<std::vector<std::byte>>& bands)
+{
+    // Every pixel is written by a band: no zero fill
+    auto image { std::make_shared<OIIO::ImageBuf>(spec, OIIO::InitializePixels::No) };
+
+    // A load waits on it: in the lane of the load, the interactive one by default
+    const auto priority { Workers::EngineScheduler::currentPriority().value_or(Workers::TaskPriority::Interactive) };
+    const int status { Workers::ComputePool::instance().parallelFor(priority, static_cast<int>(bands.size()), [&](int band) {
+        const OIIO::ROI roi { bandRoi(spec, band) };
+        const std::size_t values { static_cast<std::size_t>(roi.npixels()) * static_cast<std::size_t>(roi.nchannels()) };
+        const auto& stored { bands[static_cast<std::size_t>(band)] };
+
+#if CAPTUREMOMENT_USE_ZSTD
+        std::vector<std::byte> planes(values * 2);
+        const std::size_t size { ZSTD_decompress(planes.data(), planes.size(), stored.data(), stored.size()) };
+        if (ZSTD_isError(size) || size != planes.size()) {
+            return 1;
+        }
+#else
+        if (stored.size() != values * 2) {
+            return 1;
+        }
+        const auto& planes { stored };
+#endif
+
+        std::vector<std::uint16_t> halves(values);
+        for (std::size_t i = 0; i < values; ++i) {
+            halves[i] = static_cast<std::uint16_t>(std::to_integer<std::uint16_t>(planes[i])
+                                                   | (std::to_integer<std::uint16_t>(planes[values + i]) << 8));
+        }
+        return image->set_pixels(roi, OIIO::TypeDesc::HALF, halves.data()) ? 0 : 1;
+    }) };
+
+    if (status != 0) {
+        return nullptr;
+    }
+    return image;
+}
+
+} // namespace CaptureMoment::Core::Managers
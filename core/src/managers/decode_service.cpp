@@ -0,0 +1,152 @@
+/**
+ * @file decode_service.cpp
+ * @brief Implementation of DecodeService.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/decode_service.h"
+
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <utility>
+
+namespace CaptureMoment::Core::Managers {
+
+DecodeService::DecodeService(Decoder decoder, std::size_t worker_count, std::size_t memory_budget_bytes)
+    : m_decoder(std::move(decoder))
+    , m_worker_count(worker_count != 0 ? worker_count : std::max(2u, std::thread::hardware_concurrency()))
+    , m_memory_budget_bytes(std::max<std::size_t>(memory_budget_bytes, 1))
+    // The first scheduler thread only runs interactive work: one more for the decoding lanes
+    , m_pool(std::make_unique<Workers::EngineScheduler>(m_worker_count + 1))
+{
+    spdlog::debug("[DecodeService::DecodeService]: {} workers, {} MB budget",
+                  m_worker_count, m_memory_budget_bytes >> 20);
+}
+
+DecodeService::~DecodeService()
+{
+    m_pool.reset();
+}
+
+void DecodeService::decode(std::string path, ImageConfig::Raw::RawQuality quality, Workers::TaskPriority priority,
+                           ResultCallback on_decoded, Common::CancellationToken token)
+{
+    m_pool->post(priority, [this, path = std::move(path), quality, on_decoded = std::move(on_decoded),
+                            token = std::move(token)]() {
+        run(path, quality, on_decoded, token);
+    });
+}
+
+std::vector<DecodeService::Result> DecodeService::decodeBatch(std::span<const std::string> paths,
+                                                              ImageConfig::Raw::RawQuality quality,
+                                                              Workers::TaskPriority priority,
+                                                              const Common::CancellationToken& token)
+{
+    std::vector<std::promise<Result>> promises(paths.size());
+    std::vector<std::future<Result>> futures;
+    futures.reserve(paths.size());
+
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+        futures.push_back(promises[i].get_future());
+        decode(paths[i], quality, priority,
+               [&promise = promises[i]](const std::string&, Result result) { promise.set_value(std::move(result)); },
+               token);
+    }
+
+    std::vector<Result> results;
+    results.reserve(paths.size());
+    for (auto& future : futures) {
+        results.push_back(future.get());
+    }
+    return results;
+}
+
+std::size_t DecodeService::inFlightBytes() const
+{
+    std::lock_guard lock(m_budget_mutex);
+    return m_in_flight_bytes;
+}
+
+std::size_t DecodeService::estimateDecodeBytes(std::string_view path, ImageConfig::Raw::RawQuality quality)
+{
+    auto input = OIIO::ImageInput::open(std::string(path));
+    if (!input) {
+        // The decode reports the error
+        return 0;
+    }
+
+    const auto& spec = input->spec();
+    std::size_t bytes = static_cast<std::size_t>(spec.width) * static_cast<std::size_t>(spec.height)
+                        * 4 * sizeof(float);
+
+    if (std::string_view(input->format_name()) == "raw") {
+        // LibRaw holds the mosaic and its 16-bit RGB image while the RGBA_F32 copy is made
+        bytes *= 2;
+        if (quality == ImageConfig::Raw::RawQuality::draft) {
+            // Half-size demosaic: a quarter of the pixels
+            bytes /= 4;
+        }
+    }
+
+    input->close();
+    return bytes;
+}
+
+void DecodeService::run(const std::string& path, ImageConfig::Raw::RawQuality quality,
+                        const ResultCallback& on_decoded, const Common::CancellationToken& token)
+{
+    if (token.isCancelled()) {
+        on_decoded(path, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+        return;
+    }
+
+    const std::size_t reserved = acquireBudget(estimateDecodeBytes(path, quality));
+
+    // Gives the budget back however the decode or the callback ends
+    struct BudgetRelease {
+        DecodeService& service;
+        std::size_t bytes;
+        ~BudgetRelease() { service.releaseBudget(bytes); }
+    } release{*this, reserved};
+
+    Result result = token.isCancelled() ? Result(std::unexpected(ErrorHandling::CoreError::LoadCancelled))
+                                        : m_decoder(path, quality, token);
+    if (!result) {
+        spdlog::debug("[DecodeService::run]: '{}' not decoded: {}", path,
+                      ErrorHandling::to_string(result.error()));
+    }
+
+    on_decoded(path, std::move(result));
+}
+
+std::size_t DecodeService::acquireBudget(std::size_t bytes)
+{
+    bytes = std::min(bytes, m_memory_budget_bytes);
+
+    std::unique_lock lock(m_budget_mutex);
+    // An oversized decode (clamped to the whole budget) waits until it runs alone
+    m_budget_released.wait(lock, [this, bytes]() {
+        return m_in_flight_bytes == 0 || m_in_flight_bytes + bytes <= m_memory_budget_bytes;
+    });
+    m_in_flight_bytes += bytes;
+    return bytes;
+}
+
+void DecodeService::releaseBudget(std::size_t bytes)
+{
+    if (bytes == 0) {
+        return;
+    }
+    {
+        std::lock_guard lock(m_budget_mutex);
+        m_in_flight_bytes -= bytes;
+    }
+    m_budget_released.notify_all();
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,182 @@
+/**
+ * @file decoded_image_cache.cpp
+ * @brief Implementation of DecodedImageCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/decoded_image_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+DecodedImageCache::DecodedImageCache(std::size_t capacity_bytes)
+    : m_capacity_bytes(capacity_bytes)
+    , m_budget_registration(Common::MemoryBudget::instance().registerConsumer(
+          "Decoded image cache",
+          [this] { return sizeBytes(); },
+          [this](std::size_t bytes) { return evictBytes(bytes); }))
+{
+}
+
+DecodedImageCache::Buffer DecodedImageCache::find(std::string_view path)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto it = m_index.find(std::string(path));
+    if (it == m_index.end()) {
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    m_budget_registration.touch();
+    return it->second->m_buffer;
+}
+
+bool DecodedImageCache::contains(std::string_view path) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_index.contains(std::string(path));
+}
+
+void DecodedImageCache::insert(std::string_view path, Buffer buffer)
+{
+    if (!buffer) {
+        return;
+    }
+
+    // Mapped decodes (DiskImageCache) live in the OS page cache, not on the heap
+    const std::size_t bytes = buffer->storage() == OIIO::ImageBuf::APPBUFFER ? 0 : buffer->spec().image_bytes();
+
+    std::vector<Entry> evicted;
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (const auto it = m_index.find(std::string(path)); it != m_index.end()) {
+            m_size_bytes -= it->second->m_bytes;
+            m_entries.erase(it->second);
+            m_index.erase(it);
+        }
+
+        if (bytes > m_capacity_bytes) {
+            spdlog::debug("[DecodedImageCache::insert]: '{}' ({} MB) exceeds the budget, not cached", path, bytes >> 20);
+            return;
+        }
+
+        m_entries.push_front(Entry{std::string(path), std::move(buffer), bytes});
+        m_index.emplace(m_entries.front().m_path, m_entries.begin());
+        m_size_bytes += bytes;
+
+        evictToCapacity(evicted);
+    }
+
+    // Outside the lock: the budget may call back into evictBytes, the handler may take its time
+    handOver(evicted);
+    m_budget_registration.notifyGrowth();
+}
+
+void DecodedImageCache::erase(std::string_view path)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (const auto it = m_index.find(std::string(path)); it != m_index.end()) {
+        m_size_bytes -= it->second->m_bytes;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+}
+
+void DecodedImageCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_size_bytes = 0;
+}
+
+void DecodedImageCache::setCapacityBytes(std::size_t capacity_bytes)
+{
+    std::vector<Entry> evicted;
+    {
+        std::lock_guard lock(m_mutex);
+        m_capacity_bytes = capacity_bytes;
+        evictToCapacity(evicted);
+    }
+    handOver(evicted);
+}
+
+void DecodedImageCache::setEvictionHandler(EvictionHandler handler)
+{
+    std::lock_guard lock(m_mutex);
+    m_eviction_handler = std::move(handler);
+}
+
+std::size_t DecodedImageCache::capacityBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_capacity_bytes;
+}
+
+std::size_t DecodedImageCache::sizeBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_size_bytes;
+}
+
+std::size_t DecodedImageCache::evictBytes(std::size_t bytes)
+{
+    std::lock_guard lock(m_mutex);
+
+    std::size_t freed { 0 };
+    while (freed < bytes && !m_entries.empty()) {
+        const Entry& victim = m_entries.back();
+        spdlog::debug("[DecodedImageCache::evictBytes]: Evicting '{}'", victim.m_path);
+        freed += victim.m_bytes;
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_path);
+        m_entries.pop_back();
+    }
+    return freed;
+}
+
+void DecodedImageCache::evictToCapacity(std::vector<Entry>& evicted)
+{
+    while (m_size_bytes > m_capacity_bytes && !m_entries.empty()) {
+        Entry& victim = m_entries.back();
+        spdlog::debug("[DecodedImageCache::evictToCapacity]: Evicting '{}'", victim.m_path);
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_path);
+        if (m_eviction_handler) {
+            evicted.push_back(std::move(victim));
+        }
+        m_entries.pop_back();
+    }
+}
+
+void DecodedImageCache::handOver(std::vector<Entry>& evicted)
+{
+    if (evicted.empty()) {
+        return;
+    }
+
+    EvictionHandler handler;
+    {
+        std::lock_guard lock(m_mutex);
+        handler = m_eviction_handler;
+    }
+    if (!handler) {
+        return;
+    }
+    for (const Entry& entry : evicted) {
+        // Mapped decodes stay on disk (DiskImageCache): nothing to keep
+        if (entry.m_buffer->storage() != OIIO::ImageBuf::APPBUFFER) {
+            handler(entry.m_path, entry.m_buffer);
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,465 @@
+/**
+ * @file disk_image_cache.cpp
+ * @brief Implementation of DiskImageCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/disk_image_cache.h"
+#include "config/app_config.h"
+#include "common/memory/mapped_file.h"
+
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+/**
+ * @brief Extension of the entries.
+ */
+constexpr std::string_view k_entry_extension { ".cmdecoded" };
+
+/**
+ * @brief Metadata stored in each entry to check it against the key that found it.
+ */
+constexpr std::string_view k_source_path_attribute { "CaptureMoment:SourcePath" };
+constexpr std::string_view k_identity_attribute { "CaptureMoment:SourceIdentity" };
+
+/**
+ * @brief Alignment of the pixels in an entry (a page, so the mapping starts rows on one).
+ */
+constexpr std::uint64_t k_pixels_alignment { 4096 };
+
+/**
+ * @brief Rows converted at once when storing a whole decoded image.
+ */
+constexpr Common::ImageDim k_store_strip_rows { 64 };
+
+/**
+ * @brief Fixed header at the start of every entry (native endianness).
+ */
+struct BlobHeader {
+    static constexpr std::array<char, 8> k_magic { 'C', 'M', 'D', 'E', 'C', 'O', 'D', 'E' };
+    static constexpr std::uint32_t k_version { 1 };
+
+    std::array<char, 8> m_magic { k_magic };
+    std::uint32_t m_version { k_version };
+    std::uint32_t m_width { 0 };
+    std::uint32_t m_height { 0 };
+    std::uint32_t m_channels { 4 };
+    std::uint32_t m_bytes_per_channel { 2 };
+    std::uint32_t m_reserved { 0 };
+    std::uint64_t m_metadata_offset { 0 };
+    std::uint64_t m_metadata_size { 0 };
+    std::uint64_t m_pixels_offset { 0 };
+    std::uint64_t m_pixels_size { 0 };
+};
+static_assert(sizeof(BlobHeader) == 64 && std::is_trivially_copyable_v<BlobHeader>);
+
+/**
+ * @brief Name/value metadata of an entry, in file order.
+ */
+using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Appends a length-prefixed string to a metadata block.
+ */
+static void appendString(std::string& block, std::string_view text)
+{
+    const auto size { static_cast<std::uint32_t>(text.size()) };
+    block.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    block.append(text);
+}
+
+/**
+ * @brief Parses a metadata block (pairs of length-prefixed strings).
+ * @return The pairs, or `std::nullopt` if the block is truncated.
+ */
+[[nodiscard]] static std::optional<Metadata> parseMetadata(std::span<const std::byte> block)
+{
+    Metadata metadata;
+    std::size_t offset { 0 };
+
+    const auto read_string = [&block, &offset]() -> std::optional<std::string> {
+        std::uint32_t size { 0 };
+        if (block.size() - offset < sizeof(size)) {
+            return std::nullopt;
+        }
+        std::memcpy(&size, block.data() + offset, sizeof(size));
+        offset += sizeof(size);
+        if (block.size() - offset < size) {
+            return std::nullopt;
+        }
+        std::string text(reinterpret_cast<const char*>(block.data() + offset), size);
+        offset += size;
+        return text;
+    };
+
+    while (offset < block.size()) {
+        auto name { read_string() };
+        auto value { read_string() };
+        if (!name || !value) {
+            return std::nullopt;
+        }
+        metadata.emplace_back(std::move(*name), std::move(*value));
+    }
+    return metadata;
+}
+
+/**
+ * @brief Decoded image wrapping the mapping it lives in.
+ */
+struct MappedImage {
+    Common::MappedFile m_file;
+    OIIO::ImageBuf m_image;
+};
+
+/**
+ * @brief 64-bit FNV-1a hash of a string (stable across runs, unlike std::hash).
+ */
+[[nodiscard]] static std::uint64_t fnv1a(std::string_view text) noexcept
+{
+    std::uint64_t hash { 14695981039346656037ull };
+    for (const char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string DiskImageCache::Key::identity() const
+{
+    return std::to_string(m_source_mtime) + '|' + std::to_string(m_source_size) + '|'
+         + std::to_string(m_settings_fingerprint);
+}
+
+std::string DiskImageCache::Key::entryName() const
+{
+    static constexpr char k_hex[] { "0123456789abcdef" };
+
+    std::uint64_t hash { fnv1a(m_source_path + '|' + identity()) };
+    std::string name(16, '0');
+    for (auto it = name.rbegin(); it != name.rend(); ++it, hash >>= 4) {
+        *it = k_hex[hash & 0xF];
+    }
+    return name + std::string(k_entry_extension);
+}
+
+std::optional<DiskImageCache::Key> DiskImageCache::makeKey(std::string_view path, std::uint64_t settings_fingerprint)
+{
+    std::error_code ec;
+    const std::filesystem::path source { std::filesystem::absolute(std::filesystem::path(path), ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto size { std::filesystem::file_size(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto mtime { std::filesystem::last_write_time(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    Key key;
+    key.m_source_path = source.string();
+    key.m_source_mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+    key.m_source_size = size;
+    key.m_settings_fingerprint = settings_fingerprint;
+    return key;
+}
+
+std::optional<DiskImageCache::Key> DiskImageCache::makeKey(std::span<const std::string> paths,
+                                                         std::uint64_t settings_fingerprint)
+{
+    if (paths.empty()) {
+        return std::nullopt;
+    }
+
+    auto key { makeKey(paths.front(), settings_fingerprint) };
+    if (!key) {
+        return std::nullopt;
+    }
+
+    std::string identities;
+    for (const auto& path : paths) {
+        const auto frame { makeKey(path, settings_fingerprint) };
+        if (!frame) {
+            return std::nullopt;
+        }
+        identities += frame->m_source_path + '|' + frame->identity() + '\n';
+    }
+    key->m_settings_fingerprint = fnv1a(identities);
+    return key;
+}
+
+bool DiskImageCache::isEnabled() noexcept
+{
+    return Config::AppConfig::instance().getDecodedDiskCacheSizeMB() > 0;
+}
+
+std::filesystem::path DiskImageCache::directory()
+{
+    const auto& configured { Config::AppConfig::instance().getDecodedDiskCacheDirectory() };
+    if (!configured.empty()) {
+        return configured;
+    }
+
+    std::error_code ec;
+    const auto temp { std::filesystem::temp_directory_path(ec) };
+    return ec ? std::filesystem::path() : temp / "capturemoment" / "decoded";
+}
+
+std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError> DiskImageCache::load(const Key& key) const
+{
+    const std::filesystem::path dir { directory() };
+    if (!isEnabled() || dir.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    const std::filesystem::path entry { dir / key.entryName() };
+    auto mapped { Common::MappedFile::open(entry) };
+    if (!mapped) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    // A truncated or foreign entry is a miss; it is deleted so the next decode replaces it
+    const auto discard = [&entry](std::string_view reason) {
+        spdlog::warn("[DiskImageCache::load]: Discarding '{}': {}", entry.string(), reason);
+        std::error_code remove_ec;
+        std::filesystem::remove(entry, remove_ec);
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    };
+
+    // ============================================================
+    // Validate the header and the layout
+    // ============================================================
+    const std::span<const std::byte> bytes { mapped->bytes() };
+    BlobHeader header;
+    if (bytes.size() < sizeof(header)) {
+        return discard("truncated header");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    const std::uint64_t expected_pixels_size {
+        std::uint64_t{header.m_width} * header.m_height * header.m_channels * header.m_bytes_per_channel };
+    if (header.m_magic != BlobHeader::k_magic || header.m_version != BlobHeader::k_version
+        || header.m_channels != 4 || header.m_bytes_per_channel != 2
+        || header.m_pixels_size != expected_pixels_size
+        || header.m_metadata_offset + header.m_metadata_size > bytes.size()
+        || header.m_pixels_offset + header.m_pixels_size > bytes.size()) {
+        return discard("invalid header");
+    }
+
+    const auto metadata { parseMetadata(bytes.subspan(header.m_metadata_offset, header.m_metadata_size)) };
+    if (!metadata) {
+        return discard("truncated metadata");
+    }
+
+    const auto find = [&metadata](std::string_view name) -> std::string_view {
+        const auto it = std::ranges::find(*metadata, name, [](const auto& pair) -> std::string_view { return pair.first; });
+        return it != metadata->end() ? std::string_view(it->second) : std::string_view();
+    };
+    if (find(k_source_path_attribute) != key.m_source_path || find(k_identity_attribute) != key.identity()) {
+        // Another source hashed to the same name: keep the entry, it is valid for that one
+        spdlog::debug("[DiskImageCache::load]: '{}' belongs to another source", entry.string());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    // ============================================================
+    // Wrap the mapped pixels (nothing is read until a tile is)
+    // ============================================================
+    OIIO::ImageSpec spec(static_cast<int>(header.m_width), static_cast<int>(header.m_height), 4, OIIO::TypeDesc::HALF);
+    spec.alpha_channel = 3;
+    for (const auto& [name, value] : *metadata) {
+        if (name != k_source_path_attribute && name != k_identity_attribute) {
+            spec.attribute(name, value);
+        }
+    }
+
+    auto image { std::make_shared<MappedImage>() };
+    image->m_file = std::move(mapped.value());
+    // The mapping is read-only: the buffer is shared as const and copied before any write
+    auto* pixels { const_cast<std::byte*>(image->m_file.bytes().data() + header.m_pixels_offset) };
+    image->m_image = OIIO::ImageBuf(spec, pixels);
+
+    // Most recently used: eviction deletes the oldest modification times first
+    std::error_code ec;
+    std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), ec);
+
+    spdlog::debug("[DiskImageCache::load]: Mapped '{}' ({}x{})", key.m_source_path, header.m_width, header.m_height);
+    return DecodedImageCache::Buffer(image, &image->m_image);
+}
+
+void DiskImageCache::store(const Key& key, const OIIO::ImageBuf& image)
+{
+    const OIIO::ImageSpec& source_spec { image.spec() };
+    if (source_spec.nchannels != 4 || source_spec.format != OIIO::TypeDesc::FLOAT || !image.localpixels()) {
+        spdlog::warn("[DiskImageCache::store]: '{}' is not a local RGBA_F32 image, not cached", key.m_source_path);
+        return;
+    }
+
+    const auto* pixels { static_cast<const float*>(image.localpixels()) };
+    const std::size_t row_values { static_cast<std::size_t>(source_spec.width) * 4 };
+    static_cast<void>(storeRows(key, source_spec, k_store_strip_rows,
+                                [pixels, row_values](Common::ImageDim first_row, Common::ImageDim rows, float* out) {
+        std::memcpy(out, pixels + first_row * row_values, rows * row_values * sizeof(float));
+        return true;
+    }));
+}
+
+bool DiskImageCache::storeRows(const Key& key, const OIIO::ImageSpec& spec, Common::ImageDim strip_rows,
+                               const RowSource& source)
+{
+    const std::uint64_t capacity_mb { Config::AppConfig::instance().getDecodedDiskCacheSizeMB() };
+    const std::filesystem::path dir { directory() };
+    if (capacity_mb == 0 || dir.empty()) {
+        return false;
+    }
+    if (spec.nchannels != 4 || spec.width <= 0 || spec.height <= 0 || strip_rows == 0) {
+        spdlog::warn("[DiskImageCache::storeRows]: '{}' is not an RGBA image, not cached", key.m_source_path);
+        return false;
+    }
+
+    std::lock_guard lock(m_store_mutex);
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        spdlog::warn("[DiskImageCache::storeRows]: Cannot create '{}': {}", dir.string(), ec.message());
+        return false;
+    }
+
+    // ============================================================
+    // Header and metadata (every attribute as a string)
+    // ============================================================
+    std::string metadata;
+    appendString(metadata, k_source_path_attribute);
+    appendString(metadata, key.m_source_path);
+    appendString(metadata, k_identity_attribute);
+    appendString(metadata, key.identity());
+    for (const auto& attribute : spec.extra_attribs) {
+        appendString(metadata, attribute.name().string());
+        appendString(metadata, attribute.get_string());
+    }
+
+    BlobHeader header;
+    header.m_width = static_cast<std::uint32_t>(spec.width);
+    header.m_height = static_cast<std::uint32_t>(spec.height);
+    header.m_metadata_offset = sizeof(BlobHeader);
+    header.m_metadata_size = metadata.size();
+    header.m_pixels_offset = (header.m_metadata_offset + header.m_metadata_size + k_pixels_alignment - 1)
+                           / k_pixels_alignment * k_pixels_alignment;
+    header.m_pixels_size = std::uint64_t{header.m_width} * header.m_height * header.m_channels * header.m_bytes_per_channel;
+
+    // Written aside, then renamed: a reader never maps a partial entry
+    const std::filesystem::path entry { dir / key.entryName() };
+    std::filesystem::path partial { entry };
+    partial.replace_extension(".part");
+
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+        const std::string padding(header.m_pixels_offset - header.m_metadata_offset - header.m_metadata_size, '\0');
+        out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+        // ============================================================
+        // Pixels as RGBA half, produced and converted one strip at a time
+        // ============================================================
+        const auto height { static_cast<Common::ImageDim>(spec.height) };
+        const std::size_t row_values { static_cast<std::size_t>(spec.width) * 4 };
+        const Common::ImageDim strip_height { std::min(strip_rows, height) };
+        std::vector<float> strip(strip_height * row_values);
+        std::vector<std::uint16_t> converted(strip_height * row_values);
+
+        bool produced { true };
+        for (Common::ImageDim y = 0; y < height && out; y += strip_height) {
+            const Common::ImageDim rows { std::min(strip_height, height - y) };
+            if (!source(y, rows, strip.data())) {
+                produced = false;
+                break;
+            }
+            const std::size_t values { rows * row_values };
+            OIIO::convert_pixel_values(OIIO::TypeDesc::FLOAT, strip.data(), OIIO::TypeDesc::HALF, converted.data(),
+                                       static_cast<int>(values));
+            out.write(reinterpret_cast<const char*>(converted.data()), static_cast<std::streamsize>(values * sizeof(std::uint16_t)));
+        }
+
+        if (!produced || !out.flush()) {
+            if (produced) {
+                spdlog::warn("[DiskImageCache::storeRows]: Failed to write '{}'", partial.string());
+            }
+            out.close();
+            std::filesystem::remove(partial, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(partial, entry, ec);
+    if (ec) {
+        spdlog::warn("[DiskImageCache::storeRows]: Failed to install '{}': {}", entry.string(), ec.message());
+        std::filesystem::remove(partial, ec);
+        return false;
+    }
+
+    spdlog::debug("[DiskImageCache::storeRows]: Cached '{}' as '{}'", key.m_source_path, entry.string());
+    evict_unsafe(dir, capacity_mb << 20);
+    return true;
+}
+
+void DiskImageCache::evict_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes)
+{
+    struct Entry {
+        std::filesystem::path m_path;
+        std::filesystem::file_time_type m_last_used;
+        std::uintmax_t m_size;
+    };
+
+    std::vector<Entry> entries;
+    std::uint64_t total_bytes { 0 };
+
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(dir, ec)) {
+        std::error_code file_ec;
+        if (!file.is_regular_file(file_ec) || file.path().extension() != k_entry_extension) {
+            continue;
+        }
+
+        Entry entry { file.path(), file.last_write_time(file_ec), file.file_size(file_ec) };
+        if (!file_ec) {
+            total_bytes += entry.m_size;
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    if (total_bytes <= capacity_bytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.m_last_used < b.m_last_used; });
+
+    for (const auto& entry : entries) {
+        if (total_bytes <= capacity_bytes) {
+            break;
+        }
+        if (std::filesystem::remove(entry.m_path, ec)) {
+            total_bytes -= entry.m_size;
+            spdlog::debug("[DiskImageCache::evict_unsafe]: Evicted '{}'", entry.m_path.string());
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,524 @@
+/**
+ * @file hdr_merger.cpp
+ * @brief Implementation of HdrMerger
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/hdr_merger.h"
+#include "managers/source_manager.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+/**
+ * @brief Version of the merge, in the key of the persisted results: bump it when the output changes.
+ */
+constexpr std::uint64_t k_merge_version { 1 };
+
+/**
+ * @brief Values at or above this (largest channel) are taken as clipped.
+ */
+constexpr float k_clip_level { 0.95f };
+
+/**
+ * @brief Grey levels within this of the median are left out of the alignment (noise).
+ */
+constexpr int k_exclusion_range { 4 };
+
+/**
+ * @brief Smallest side of an alignment level.
+ */
+constexpr Common::ImageDim k_min_level_side { 16 };
+
+/**
+ * @brief Long edge of the grey copies when they only serve to estimate exposures.
+ */
+constexpr Common::ImageDim k_estimation_edge { 1024 };
+
+/**
+ * @brief Grey levels trusted when estimating an exposure ratio (neither black nor clipped).
+ */
+constexpr int k_estimation_low { 20 };
+constexpr int k_estimation_high { 235 };
+
+/**
+ * @brief Median threshold bitmap of a grey image, and the mask of its pixels away from the median.
+ */
+struct Bitmaps {
+    Common::ImageDim m_width { 0 };
+    Common::ImageDim m_height { 0 };
+    std::vector<std::uint8_t> m_threshold;
+    std::vector<std::uint8_t> m_exclusion;
+};
+
+[[nodiscard]] Bitmaps bitmapsOf(const HdrMerger::GreyImage& image)
+{
+    std::array<std::size_t, 256> histogram {};
+    for (const std::uint8_t value : image.m_pixels) {
+        ++histogram[value];
+    }
+    int median { 0 };
+    for (std::size_t seen { 0 }; median < 255; ++median) {
+        seen += histogram[static_cast<std::size_t>(median)];
+        if (seen * 2 >= image.m_pixels.size()) {
+            break;
+        }
+    }
+
+    Bitmaps bitmaps { image.m_width, image.m_height, std::vector<std::uint8_t>(image.m_pixels.size()),
+                      std::vector<std::uint8_t>(image.m_pixels.size()) };
+    for (std::size_t i = 0; i < image.m_pixels.size(); ++i) {
+        const int value { image.m_pixels[i] };
+        bitmaps.m_threshold[i] = value > median ? 1 : 0;
+        bitmaps.m_exclusion[i] = std::abs(value - median) > k_exclusion_range ? 1 : 0;
+    }
+    return bitmaps;
+}
+
+/**
+ * @brief Pixels whose bitmaps differ between the reference and the frame shifted by an offset.
+ */
+[[nodiscard]] std::size_t difference(const Bitmaps& reference, const Bitmaps& frame, HdrMerger::Offset offset)
+{
+    const auto width { static_cast<std::ptrdiff_t>(reference.m_width) };
+    const auto height { static_cast<std::ptrdiff_t>(reference.m_height) };
+    std::size_t count { 0 };
+    for (std::ptrdiff_t y = std::max<std::ptrdiff_t>(0, -offset.m_dy); y < std::min(height, height - offset.m_dy); ++y) {
+        const std::ptrdiff_t reference_row { y * width };
+        const std::ptrdiff_t frame_row { (y + offset.m_dy) * width + offset.m_dx };
+        for (std::ptrdiff_t x = std::max<std::ptrdiff_t>(0, -offset.m_dx); x < std::min(width, width - offset.m_dx); ++x) {
+            const auto r { static_cast<std::size_t>(reference_row + x) };
+            const auto f { static_cast<std::size_t>(frame_row + x) };
+            count += (reference.m_threshold[r] ^ frame.m_threshold[f]) & reference.m_exclusion[r] & frame.m_exclusion[f];
+        }
+    }
+    return count;
+}
+
+[[nodiscard]] HdrMerger::GreyImage halve(const HdrMerger::GreyImage& image)
+{
+    HdrMerger::GreyImage half { image.m_width / 2, image.m_height / 2, {} };
+    half.m_pixels.resize(half.m_width * half.m_height);
+    for (Common::ImageDim y = 0; y < half.m_height; ++y) {
+        const std::uint8_t* top { image.m_pixels.data() + 2 * y * image.m_width };
+        const std::uint8_t* bottom { top + image.m_width };
+        for (Common::ImageDim x = 0; x < half.m_width; ++x) {
+            half.m_pixels[y * half.m_width + x] = static_cast<std::uint8_t>(
+                (top[2 * x] + top[2 * x + 1] + bottom[2 * x] + bottom[2 * x + 1] + 2) / 4);
+        }
+    }
+    return half;
+}
+
+[[nodiscard]] float fromGrey(int value) noexcept
+{
+    return std::pow(static_cast<float>(value) / 255.0f, 2.2f);
+}
+
+/**
+ * @brief Grey copy of a frame, box-downsampled by an integer factor, read a block of rows at a time.
+ */
+[[nodiscard]] std::optional<HdrMerger::GreyImage> greyOf(const OIIO::ImageBuf& frame, Common::ImageDim factor)
+{
+    const auto width { static_cast<Common::ImageDim>(frame.spec().width) };
+    const auto height { static_cast<Common::ImageDim>(frame.spec().height) };
+    HdrMerger::GreyImage grey { std::max<Common::ImageDim>(width / factor, 1), std::max<Common::ImageDim>(height / factor, 1), {} };
+    grey.m_pixels.resize(grey.m_width * grey.m_height);
+
+    const Common::ImageDim block_rows { std::min(factor, height) };
+    std::vector<float> block(block_rows * width * 3);
+    std::vector<float> sums(grey.m_width);
+    for (Common::ImageDim gy = 0; gy < grey.m_height; ++gy) {
+        const auto y0 { static_cast<int>(gy * block_rows) };
+        if (!frame.get_pixels(OIIO::ROI(0, static_cast<int>(width), y0, y0 + static_cast<int>(block_rows), 0, 1, 0, 3),
+                              OIIO::TypeDesc::FLOAT, block.data())) {
+            return std::nullopt;
+        }
+
+        std::ranges::fill(sums, 0.0f);
+        const Common::ImageDim block_columns { std::min(factor, width) };
+        for (Common::ImageDim row = 0; row < block_rows; ++row) {
+            const float* pixel { block.data() + row * width * 3 };
+            for (Common::ImageDim gx = 0; gx < grey.m_width; ++gx) {
+                for (Common::ImageDim column = 0; column < block_columns; ++column) {
+                    const float* rgb { pixel + (gx * block_columns + column) * 3 };
+                    sums[gx] += 0.2126f * rgb[0] + 0.7152f * rgb[1] + 0.0722f * rgb[2];
+                }
+            }
+        }
+
+        const float samples { static_cast<float>(block_rows * block_columns) };
+        for (Common::ImageDim gx = 0; gx < grey.m_width; ++gx) {
+            // Display-like encoding: the bitmaps need a monotonic one, the estimate inverts it
+            const float luminance { std::clamp(sums[gx] / samples, 0.0f, 1.0f) };
+            grey.m_pixels[gy * grey.m_width + gx] = static_cast<std::uint8_t>(std::lround(std::pow(luminance, 1.0f / 2.2f) * 255.0f));
+        }
+    }
+    return grey;
+}
+
+/**
+ * @brief Exposure of a frame from its metadata (time × ISO / aperture²), if its time is known.
+ */
+[[nodiscard]] std::optional<double> exposureOf(const OIIO::ImageSpec& spec)
+{
+    // Persisted decodes keep their metadata as strings: get_float converts them
+    const auto value = [&spec](std::string_view name) -> double {
+        const OIIO::ParamValue* attribute { spec.find_attribute(name) };
+        return attribute ? attribute->get_float(0.0f) : 0.0;
+    };
+
+    const double time { value("ExposureTime") };
+    if (time <= 0.0) {
+        return std::nullopt;
+    }
+    double iso { value("Exif:PhotographicSensitivity") };
+    if (iso <= 0.0) {
+        iso = value("Exif:ISOSpeedRatings");
+    }
+    const double aperture { value("FNumber") };
+    return time * (iso > 0.0 ? iso : 1.0) / (aperture > 0.0 ? aperture * aperture : 1.0);
+}
+
+/**
+ * @brief Exposure of a frame relative to the reference, from their aligned grey copies.
+ */
+[[nodiscard]] std::optional<double> estimateScale(const HdrMerger::GreyImage& reference, const HdrMerger::GreyImage& frame,
+                                                  HdrMerger::Offset offset)
+{
+    double log_sum { 0.0 };
+    std::size_t count { 0 };
+    const auto width { static_cast<std::ptrdiff_t>(reference.m_width) };
+    const auto height { static_cast<std::ptrdiff_t>(reference.m_height) };
+    for (std::ptrdiff_t y = std::max<std::ptrdiff_t>(0, -offset.m_dy); y < std::min(height, height - offset.m_dy); ++y) {
+        for (std::ptrdiff_t x = std::max<std::ptrdiff_t>(0, -offset.m_dx); x < std::min(width, width - offset.m_dx); ++x) {
+            const int r { reference.m_pixels[static_cast<std::size_t>(y * width + x)] };
+            const int f { frame.m_pixels[static_cast<std::size_t>((y + offset.m_dy) * width + x + offset.m_dx)] };
+            if (r >= k_estimation_low && r <= k_estimation_high && f >= k_estimation_low && f <= k_estimation_high) {
+                log_sum += std::log2(fromGrey(f) / fromGrey(r));
+                ++count;
+            }
+        }
+    }
+    if (count == 0) {
+        return std::nullopt;
+    }
+    return std::exp2(log_sum / static_cast<double>(count));
+}
+
+} // anonymous namespace
+
+struct HdrMerger::FrameStrip {
+    std::vector<float> m_pixels;
+    /** @brief First source row held. */
+    std::ptrdiff_t m_first_row { 0 };
+    /** @brief Rows held. */
+    std::ptrdiff_t m_rows { 0 };
+};
+
+HdrMerger::HdrMerger(SourceManager& source)
+    : m_source(source)
+{
+}
+
+std::expected<void, ErrorHandling::CoreError> HdrMerger::merge(std::span<const std::string> frames,
+                                                               const HdrMergeSettings& settings,
+                                                               const Common::CancellationToken& token)
+{
+    if (frames.size() < 2) {
+        spdlog::warn("[HdrMerger::merge]: A merge needs at least 2 frames, got {}", frames.size());
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const std::string path { mergedPath(frames) };
+    std::optional<DiskImageCache::Key> key;
+    if (DiskImageCache::isEnabled()) {
+        key = DiskImageCache::makeKey(frames, k_merge_version);
+    }
+
+    // Merged before, frames unchanged: the persisted result is mapped at once
+    if (key) {
+        if (auto mapped = m_disk_cache.load(*key)) {
+            spdlog::info("[HdrMerger::merge]: '{}' merged before, reusing it", path);
+            return m_source.loadDecoded(path, std::move(*mapped));
+        }
+    }
+
+    auto merged { build(frames, key ? &*key : nullptr, settings, token) };
+    if (!merged) {
+        return std::unexpected(merged.error());
+    }
+    return m_source.loadDecoded(path, std::move(*merged));
+}
+
+std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+HdrMerger::build(std::span<const std::string> frames, const DiskImageCache::Key* key, const HdrMergeSettings& settings,
+                 const Common::CancellationToken& token)
+{
+    // ============================================================
+    // 1. Decode every frame once, mapped from the persistent cache
+    // ============================================================
+    std::vector<DecodedImageCache::Buffer> decoded;
+    decoded.reserve(frames.size());
+    for (const auto& frame : frames) {
+        auto buffer { m_source.decodePersistent(frame, token) };
+        if (!buffer) {
+            spdlog::warn("[HdrMerger::build]: Cannot decode '{}': {}", frame, ErrorHandling::to_string(buffer.error()));
+            return std::unexpected(buffer.error());
+        }
+        if (!decoded.empty() && ((*buffer)->spec().width != decoded.front()->spec().width
+                                 || (*buffer)->spec().height != decoded.front()->spec().height)) {
+            spdlog::warn("[HdrMerger::build]: '{}' is not the size of '{}'", frame, frames.front());
+            return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+        }
+        decoded.push_back(std::move(*buffer));
+    }
+
+    const auto width { static_cast<Common::ImageDim>(decoded.front()->spec().width) };
+    const auto height { static_cast<Common::ImageDim>(decoded.front()->spec().height) };
+    const std::size_t count { decoded.size() };
+
+    // ============================================================
+    // 2. Exposures, reference, alignment
+    // ============================================================
+    std::vector<std::optional<double>> exposures(count);
+    std::ranges::transform(decoded, exposures.begin(), [](const auto& buffer) { return exposureOf(buffer->spec()); });
+    const bool metered { std::ranges::all_of(exposures, [](const auto& exposure) { return exposure.has_value(); }) };
+
+    // The middle exposure (the middle frame when they are unknown)
+    std::vector<std::size_t> order(count);
+    std::iota(order.begin(), order.end(), std::size_t { 0 });
+    if (metered) {
+        std::ranges::sort(order, {}, [&exposures](std::size_t i) { return *exposures[i]; });
+    }
+    const std::size_t reference { order[count / 2] };
+
+    std::vector<Offset> offsets(count);
+    std::vector<double> scales(count, 1.0);
+    const Common::ImageDim grey_edge { settings.m_alignment_edge > 0 ? settings.m_alignment_edge
+                                                                     : (metered ? 0 : k_estimation_edge) };
+    if (grey_edge > 0) {
+        const Common::ImageDim long_edge { std::max(width, height) };
+        const Common::ImageDim factor { std::max<Common::ImageDim>((long_edge + grey_edge - 1) / grey_edge, 1) };
+
+        std::vector<GreyImage> greys;
+        greys.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (token.isCancelled()) {
+                return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+            }
+            auto grey { greyOf(*decoded[i], factor) };
+            if (!grey) {
+                spdlog::warn("[HdrMerger::build]: Cannot read '{}': {}", frames[i], decoded[i]->geterror());
+                return std::unexpected(ErrorHandling::CoreError::IOError);
+            }
+            greys.push_back(std::move(*grey));
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i == reference) {
+                continue;
+            }
+            Offset grey_offset;
+            if (settings.m_alignment_edge > 0) {
+                grey_offset = alignMtb(greys[reference], greys[i], settings.m_alignment_levels);
+                offsets[i] = { grey_offset.m_dx * static_cast<int>(factor), grey_offset.m_dy * static_cast<int>(factor) };
+            }
+            if (!metered) {
+                scales[i] = estimateScale(greys[reference], greys[i], grey_offset).value_or(1.0);
+            }
+            spdlog::debug("[HdrMerger::build]: '{}': offset ({}, {}), exposure x{:.3f}", frames[i], offsets[i].m_dx,
+                          offsets[i].m_dy, metered ? *exposures[i] / *exposures[reference] : scales[i]);
+        }
+    }
+    if (metered) {
+        std::ranges::transform(exposures, scales.begin(), [&exposures, reference](const auto& exposure) {
+            return *exposure / *exposures[reference];
+        });
+    }
+
+    // Darkest and brightest frames: the fallbacks where every frame is clipped, or black
+    const auto [darkest, brightest] { std::ranges::minmax_element(scales) };
+    const auto darkest_index { static_cast<std::size_t>(darkest - scales.begin()) };
+    const auto brightest_index { static_cast<std::size_t>(brightest - scales.begin()) };
+
+    // ============================================================
+    // 3. Merge strip by strip
+    // ============================================================
+    std::vector<FrameStrip> strips(count);
+    const auto read_strip = [&](std::size_t i, Common::ImageDim first_row, Common::ImageDim rows) {
+        FrameStrip& strip { strips[i] };
+        const auto last { static_cast<std::ptrdiff_t>(height) - 1 };
+        const std::ptrdiff_t begin { std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(first_row) + offsets[i].m_dy, 0, last) };
+        const std::ptrdiff_t end { std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(first_row + rows) + offsets[i].m_dy, begin + 1, last + 1) };
+        strip.m_first_row = begin;
+        strip.m_rows = end - begin;
+        strip.m_pixels.resize(static_cast<std::size_t>(strip.m_rows) * width * 4);
+        return decoded[i]->get_pixels(OIIO::ROI(0, static_cast<int>(width), static_cast<int>(begin), static_cast<int>(end), 0, 1, 0, 4),
+                                      OIIO::TypeDesc::FLOAT, strip.m_pixels.data());
+    };
+
+    const DiskImageCache::RowSource merge_rows = [&](Common::ImageDim first_row, Common::ImageDim rows, float* out) {
+        if (token.isCancelled()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!read_strip(i, first_row, rows)) {
+                spdlog::warn("[HdrMerger::build]: Cannot read '{}': {}", frames[i], decoded[i]->geterror());
+                return false;
+            }
+        }
+
+        // Source pixel of frame i for output (x, y), edges clamped
+        const auto sample = [&](std::size_t i, Common::ImageDim x, Common::ImageDim y) {
+            const FrameStrip& strip { strips[i] };
+            const std::ptrdiff_t row { std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(y) + offsets[i].m_dy - strip.m_first_row,
+                                                                  0, strip.m_rows - 1) };
+            const std::ptrdiff_t column { std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(x) + offsets[i].m_dx, 0,
+                                                                     static_cast<std::ptrdiff_t>(width) - 1) };
+            return strip.m_pixels.data() + (static_cast<std::size_t>(row) * width + static_cast<std::size_t>(column)) * 4;
+        };
+
+        for (Common::ImageDim y = first_row; y < first_row + rows; ++y) {
+            float* pixel { out + (y - first_row) * width * 4 };
+            for (Common::ImageDim x = 0; x < width; ++x, pixel += 4) {
+                std::array<double, 3> sum {};
+                double weights { 0.0 };
+                for (std::size_t i = 0; i < count; ++i) {
+                    const float* rgb { sample(i, x, y) };
+                    // Longer exposures are less noisy: their weight scales with the exposure
+                    const double w { weight(std::max({ rgb[0], rgb[1], rgb[2] })) * scales[i] };
+                    for (std::size_t c = 0; c < 3; ++c) {
+                        sum[c] += w * rgb[c] / scales[i];
+                    }
+                    weights += w;
+                }
+
+                if (weights > 0.0) {
+                    for (std::size_t c = 0; c < 3; ++c) {
+                        pixel[c] = static_cast<float>(sum[c] / weights);
+                    }
+                } else {
+                    // Clipped even in the darkest frame, or black even in the brightest
+                    const float* dark { sample(darkest_index, x, y) };
+                    const bool clipped { std::max({ dark[0], dark[1], dark[2] }) >= k_clip_level };
+                    const std::size_t fallback { clipped ? darkest_index : brightest_index };
+                    const float* rgb { clipped ? dark : sample(brightest_index, x, y) };
+                    for (std::size_t c = 0; c < 3; ++c) {
+                        pixel[c] = static_cast<float>(rgb[c] / scales[fallback]);
+                    }
+                }
+                pixel[3] = 1.0f;
+            }
+        }
+        return true;
+    };
+
+    OIIO::ImageSpec spec(static_cast<int>(width), static_cast<int>(height), 4, OIIO::TypeDesc::FLOAT);
+    spec.alpha_channel = 3;
+    spec.extra_attribs = decoded[reference]->spec().extra_attribs;
+    spec.attribute("CaptureMoment:HdrFrames", static_cast<int>(count));
+    const Common::ImageDim strip_rows { std::max<Common::ImageDim>(settings.m_strip_rows, 1) };
+
+    if (key) {
+        if (m_disk_cache.storeRows(*key, spec, strip_rows, merge_rows)) {
+            if (auto mapped = m_disk_cache.load(*key)) {
+                spdlog::info("[HdrMerger::build]: Merged {} frames of '{}' ({}x{})", count, frames.front(), width, height);
+                return mapped;
+            }
+        }
+        if (token.isCancelled()) {
+            return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        }
+        spdlog::warn("[HdrMerger::build]: Merge of '{}' not persisted, built in memory", frames.front());
+    }
+
+    // No disk cache: the same strips, into memory
+    auto merged { std::make_shared<OIIO::ImageBuf>(spec) };
+    auto* pixels { static_cast<float*>(merged->localpixels()) };
+    for (Common::ImageDim y = 0; y < height; y += strip_rows) {
+        if (!merge_rows(y, std::min(strip_rows, height - y), pixels + y * width * 4)) {
+            return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled : ErrorHandling::CoreError::IOError);
+        }
+    }
+    spdlog::info("[HdrMerger::build]: Merged {} frames of '{}' ({}x{}) in memory", count, frames.front(), width, height);
+    return merged;
+}
+
+std::string HdrMerger::mergedPath(std::span<const std::string> frames)
+{
+    if (frames.empty()) {
+        return {};
+    }
+    const std::filesystem::path first { frames.front() };
+    return (first.parent_path() / (first.stem().string() + "_HDR")).string();
+}
+
+HdrMerger::Offset HdrMerger::alignMtb(const GreyImage& reference, const GreyImage& frame, int levels)
+{
+    if (reference.m_width != frame.m_width || reference.m_height != frame.m_height || reference.m_pixels.empty()) {
+        return {};
+    }
+
+    // Pyramids, full size first
+    std::vector<GreyImage> reference_levels { reference };
+    std::vector<GreyImage> frame_levels { frame };
+    for (int level = 0; level < levels; ++level) {
+        const GreyImage& last { reference_levels.back() };
+        if (std::min(last.m_width, last.m_height) / 2 < k_min_level_side) {
+            break;
+        }
+        reference_levels.push_back(halve(last));
+        frame_levels.push_back(halve(frame_levels.back()));
+    }
+
+    // Coarse to fine: each level refines the doubled offset of the one below by a pixel at most
+    Offset offset;
+    for (std::size_t level = reference_levels.size(); level-- > 0;) {
+        offset = { offset.m_dx * 2, offset.m_dy * 2 };
+        const Bitmaps reference_bitmaps { bitmapsOf(reference_levels[level]) };
+        const Bitmaps frame_bitmaps { bitmapsOf(frame_levels[level]) };
+
+        Offset best { offset };
+        std::size_t best_difference { difference(reference_bitmaps, frame_bitmaps, offset) };
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const Offset candidate { offset.m_dx + dx, offset.m_dy + dy };
+                if (const std::size_t candidate_difference { difference(reference_bitmaps, frame_bitmaps, candidate) };
+                    candidate_difference < best_difference) {
+                    best = candidate;
+                    best_difference = candidate_difference;
+                }
+            }
+        }
+        offset = best;
+    }
+    return offset;
+}
+
+float HdrMerger::weight(float value) noexcept
+{
+    if (!(value > 0.0f) || value >= k_clip_level) {
+        return 0.0f;
+    }
+    // Broad hat: flat mid-range, falling to 0 at black and at clipping
+    const float t { 2.0f * value / k_clip_level - 1.0f };
+    const float t2 { t * t };
+    const float t4 { t2 * t2 };
+    return 1.0f - t4 * t4 * t4;
+}
+
+} // namespace CaptureMoment::Core::Managers
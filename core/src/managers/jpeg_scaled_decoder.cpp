@@ -0,0 +1,258 @@
+/**
+ * @file jpeg_scaled_decoder.cpp
+ * @brief Implementation of JpegScaledDecoder.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/jpeg_scaled_decoder.h"
+#include "common/memory/mapped_file.h"
+#include "common/trace/tracer.h"
+#include "utils/color_space_utils.h"
+
+#include "config.h"
+
+#include <OpenImageIO/parallel.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#if CAPTUREMOMENT_USE_LIBJPEG
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+#endif
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+#if CAPTUREMOMENT_USE_LIBJPEG
+
+/**
+ * @brief Rows decoded per band (linearized in parallel while the band is in cache).
+ */
+constexpr int k_band_rows { 64 };
+
+/**
+ * @brief libjpeg error manager returning to `guarded` instead of exiting the process.
+ */
+struct ErrorManager {
+    jpeg_error_mgr m_manager {};
+    std::jmp_buf m_jump {};
+};
+
+void onFatalError(j_common_ptr info)
+{
+    std::array<char, JMSG_LENGTH_MAX> message {};
+    (*info->err->format_message)(info, message.data());
+    spdlog::warn("[JpegScaledDecoder::decode]: {}", message.data());
+    std::longjmp(reinterpret_cast<ErrorManager*>(info->err)->m_jump, 1);
+}
+
+void onMessage(j_common_ptr info)
+{
+    // Warnings of damaged files go to the log, not to stderr
+    std::array<char, JMSG_LENGTH_MAX> message {};
+    (*info->err->format_message)(info, message.data());
+    spdlog::debug("[JpegScaledDecoder::decode]: {}", message.data());
+}
+
+/**
+ * @brief Runs libjpeg calls, returning false if one of them failed.
+ *
+ * The error handler jumps back here: nothing between this frame and libjpeg has a destructor.
+ */
+template <typename Call>
+[[nodiscard]] bool guarded(ErrorManager& errors, Call&& call)
+{
+    if (setjmp(errors.m_jump) != 0) {
+        return false;
+    }
+    call();
+    return true;
+}
+
+/**
+ * @brief A decompressor, destroyed with its scope.
+ */
+struct Decompressor {
+    Decompressor()
+    {
+        m_info.err = jpeg_std_error(&m_errors.m_manager);
+        m_errors.m_manager.error_exit = onFatalError;
+        m_errors.m_manager.output_message = onMessage;
+        jpeg_create_decompress(&m_info);
+    }
+
+    ~Decompressor() { jpeg_destroy_decompress(&m_info); }
+
+    Decompressor(const Decompressor&) = delete;
+    Decompressor& operator=(const Decompressor&) = delete;
+
+    jpeg_decompress_struct m_info {};
+    ErrorManager m_errors;
+};
+
+/**
+ * @brief Decodes a row of 8-bit sRGB samples (gray or RGB) to linear RGBA.
+ */
+void linearizeRow(const JSAMPLE* src, float* dst, JDIMENSION width, int components,
+                  std::span<const float> table) noexcept
+{
+    for (JDIMENSION x = 0; x < width; ++x, src += components, dst += 4) {
+        if (components == 1) {
+            dst[0] = dst[1] = dst[2] = table[src[0]];
+        } else {
+            dst[0] = table[src[0]];
+            dst[1] = table[src[1]];
+            dst[2] = table[src[2]];
+        }
+        dst[3] = 1.0f;
+    }
+}
+
+#endif
+
+} // namespace
+
+bool JpegScaledDecoder::isAvailable() noexcept
+{
+    return CAPTUREMOMENT_USE_LIBJPEG != 0;
+}
+
+bool JpegScaledDecoder::isJpegFile(std::string_view path) noexcept
+{
+    static constexpr std::array<std::string_view, 3> k_extensions { ".jpg", ".jpeg", ".jpe" };
+
+    return std::ranges::any_of(k_extensions, [path](std::string_view extension) {
+        return path.size() >= extension.size()
+            && std::ranges::equal(path.substr(path.size() - extension.size()), extension, [](char a, char b) {
+                   return std::tolower(static_cast<unsigned char>(a)) == b;
+               });
+    });
+}
+
+int JpegScaledDecoder::scaleDenominator(int width, int height, Common::ImageDim min_long_edge) noexcept
+{
+    const auto long_edge { static_cast<Common::ImageDim>(std::max(width, height)) };
+    for (const int denominator : { 8, 4, 2 }) {
+        // libjpeg rounds the scaled dimensions up
+        if ((long_edge + denominator - 1) / denominator >= min_long_edge) {
+            return denominator;
+        }
+    }
+    return 1;
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+JpegScaledDecoder::decode(std::string_view path, Common::ImageDim min_long_edge)
+{
+#if CAPTUREMOMENT_USE_LIBJPEG
+    CM_TRACE_SCOPE("io", "JpegScaledDecoder::decode");
+
+    auto file { Common::MappedFile::open(std::string(path)) };
+    if (!file) {
+        return std::unexpected(file.error());
+    }
+    const std::span<const std::byte> bytes { file->bytes() };
+
+    Decompressor decompressor;
+    jpeg_decompress_struct& info { decompressor.m_info };
+
+    // ============================================================
+    // Header: pick the scale
+    // ============================================================
+    const bool read_header { guarded(decompressor.m_errors, [&] {
+        jpeg_mem_src(&info, const_cast<unsigned char*>(reinterpret_cast<const unsigned char*>(bytes.data())),
+                     static_cast<unsigned long>(bytes.size()));
+        jpeg_read_header(&info, TRUE);
+    }) };
+    if (!read_header) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    if (info.jpeg_color_space == JCS_CMYK || info.jpeg_color_space == JCS_YCCK) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    const int denominator { scaleDenominator(static_cast<int>(info.image_width), static_cast<int>(info.image_height), min_long_edge) };
+    if (denominator == 1) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    info.out_color_space = info.jpeg_color_space == JCS_GRAYSCALE ? JCS_GRAYSCALE : JCS_RGB;
+    info.scale_num = 1;
+    info.scale_denom = static_cast<unsigned int>(denominator);
+
+    if (!guarded(decompressor.m_errors, [&] { jpeg_start_decompress(&info); })) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    // ============================================================
+    // Allocate the final linear RGBA_F32 storage
+    // ============================================================
+    const JDIMENSION width { info.output_width };
+    const JDIMENSION height { info.output_height };
+    const int components { info.output_components };
+
+    OIIO::ImageSpec spec(static_cast<int>(width), static_cast<int>(height), 4, OIIO::TypeDesc::FLOAT);
+    spec.alpha_channel = 3;
+    spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+    spec.attribute("jpeg:ScaleDenominator", denominator);
+
+    OIIO::ImageBuf buf(spec);
+    float* const pixels { static_cast<float*>(buf.localpixels()) };
+
+    // ============================================================
+    // Decode a band, then linearize its rows in parallel
+    // ============================================================
+    const std::span<const float> table { Utils::srgbToLinearTable(OIIO::TypeDesc::UINT8) };
+    const std::size_t row_samples { static_cast<std::size_t>(width) * static_cast<std::size_t>(components) };
+    std::vector<JSAMPLE> band(row_samples * k_band_rows);
+    std::array<JSAMPROW, k_band_rows> rows {};
+
+    while (info.output_scanline < height) {
+        const JDIMENSION band_begin { info.output_scanline };
+        const JDIMENSION band_end { std::min<JDIMENSION>(height, band_begin + k_band_rows) };
+        for (JDIMENSION y = band_begin; y < band_end; ++y) {
+            rows[y - band_begin] = band.data() + static_cast<std::size_t>(y - band_begin) * row_samples;
+        }
+
+        // libjpeg hands out a few rows per call
+        const bool read_band { guarded(decompressor.m_errors, [&] {
+            while (info.output_scanline < band_end) {
+                jpeg_read_scanlines(&info, rows.data() + (info.output_scanline - band_begin),
+                                    band_end - info.output_scanline);
+            }
+        }) };
+        if (!read_band) {
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+
+        OIIO::parallel_for(static_cast<int64_t>(band_begin), static_cast<int64_t>(band_end), [&](int64_t y) {
+            linearizeRow(rows[static_cast<std::size_t>(y) - band_begin],
+                         pixels + static_cast<std::size_t>(y) * static_cast<std::size_t>(width) * 4,
+                         width, components, table);
+        });
+    }
+
+    // Trailing markers only: a failure there leaves the pixels intact
+    (void)guarded(decompressor.m_errors, [&] { jpeg_finish_decompress(&info); });
+
+    spdlog::debug("[JpegScaledDecoder::decode]: '{}' decoded at 1/{}: {}x{}", path, denominator, width, height);
+    return buf;
+#else
+    (void)path;
+    (void)min_long_edge;
+    return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+#endif
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,418 @@
+/**
+ * @file result_cache.cpp
+ * @brief Implementation of ResultCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/result_cache.h"
+#include "config/app_config.h"
+#include "common/memory/mapped_file.h"
+#include "common/metrics/core_metrics.h"
+#include "operations/masks/mask_store.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+/**
+ * @brief Extension of the disk entries.
+ */
+constexpr std::string_view k_entry_extension { ".cmresult" };
+
+/**
+ * @brief Fixed header of a disk entry (native endianness), followed by the RGBA8 rows.
+ */
+struct ResultEntryHeader {
+    static constexpr std::array<char, 8> k_magic { 'C', 'M', 'R', 'E', 'S', 'U', 'L', 'T' };
+    static constexpr std::uint32_t k_version { 1 };
+
+    std::array<char, 8> m_magic { k_magic };
+    std::uint32_t m_version { k_version };
+    std::uint32_t m_width { 0 };
+    std::uint32_t m_height { 0 };
+    std::uint32_t m_reserved { 0 };
+    /** @brief The key, to detect hash collisions. */
+    std::uint64_t m_source { 0 };
+    std::uint64_t m_edits { 0 };
+};
+static_assert(sizeof(ResultEntryHeader) == 40 && std::is_trivially_copyable_v<ResultEntryHeader>);
+
+/**
+ * @brief Folds bytes into a 64-bit FNV-1a hash (stable across runs, unlike std::hash).
+ */
+[[nodiscard]] static std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t size) noexcept
+{
+    const auto* bytes { static_cast<const unsigned char*>(data) };
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template<typename T>
+[[nodiscard]] static std::uint64_t fnv1a(std::uint64_t hash, const T& value) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    return fnv1a(hash, &value, sizeof(value));
+}
+
+constexpr std::uint64_t k_fnv_offset { 14695981039346656037ull };
+
+std::uint64_t ResultCache::Key::hash() const noexcept
+{
+    std::uint64_t hash { fnv1a(k_fnv_offset, m_source) };
+    hash = fnv1a(hash, m_edits);
+    hash = fnv1a(hash, m_width);
+    return fnv1a(hash, m_height);
+}
+
+std::optional<std::uint64_t> ResultCache::sourceIdentity(std::string_view path, bool preview)
+{
+    std::error_code ec;
+    const std::filesystem::path source { std::filesystem::absolute(std::filesystem::path(path), ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto size { std::filesystem::file_size(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto mtime { std::filesystem::last_write_time(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const std::string absolute { source.string() };
+    std::uint64_t hash { fnv1a(k_fnv_offset, absolute.data(), absolute.size()) };
+    hash = fnv1a(hash, static_cast<std::int64_t>(mtime.time_since_epoch().count()));
+    hash = fnv1a(hash, static_cast<std::uint64_t>(size));
+    return fnv1a(hash, preview);
+}
+
+std::uint64_t ResultCache::editHash(std::span<const Operations::OperationDescriptor> operations)
+{
+    std::uint64_t hash { k_fnv_offset };
+    for (const auto& operation : operations) {
+        if (!operation.enabled) {
+            continue;
+        }
+
+        hash = fnv1a(hash, operation.type);
+        operation.params.forEach([&hash](Operations::ParameterKey key, const Operations::OperationValue& value) {
+            hash = fnv1a(hash, key);
+            hash = fnv1a(hash, value.index());
+            std::visit([&hash](const auto& held) {
+                using T = std::decay_t<decltype(held)>;
+                if constexpr (std::is_same_v<T, std::string>) {
+                    hash = fnv1a(hash, held.data(), held.size());
+                } else {
+                    hash = fnv1a(hash, held);
+                }
+            }, value);
+            // A stroke changes the mask, not its id: the contents are keyed by its version
+            if (key == Operations::ParameterKey::Mask) {
+                if (const auto* id = std::get_if<std::string>(&value)) {
+                    const auto mask = Operations::MaskStore::instance().find(*id);
+                    hash = fnv1a(hash, mask ? mask->version() : std::uint64_t{0});
+                }
+            }
+        });
+        // Separates the operations: (A, B) and a single operation with the same bytes differ
+        hash = fnv1a(hash, std::uint8_t{0xFF});
+    }
+    return hash;
+}
+
+ResultCache::ResultCache(std::size_t capacity_bytes)
+    : m_capacity_bytes(capacity_bytes)
+    , m_budget_registration(Common::MemoryBudget::instance().registerConsumer(
+          "Result cache",
+          [this] { return sizeBytes(); },
+          [this](std::size_t bytes) { return evictBytes(bytes); }))
+{
+}
+
+ResultCache::Image ResultCache::find(const Key& key, bool full_resolution_only)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        if (const auto it = m_index.find(key); it != m_index.end()) {
+            if (full_resolution_only && !it->second->m_full_resolution) {
+                return nullptr;
+            }
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            m_budget_registration.touch();
+            return it->second->m_image;
+        }
+    }
+
+    // Only full-resolution results are written to disk
+    Image image { loadFromDisk(key) };
+    if (!image) {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        insert_unsafe(key, image, true);
+    }
+    m_budget_registration.notifyGrowth();
+    Common::Metrics::coreMetrics().m_result_disk_cache_hits.add();
+    return image;
+}
+
+void ResultCache::insert(const Key& key, Image image, bool full_resolution)
+{
+    if (!image || image->isOnDevice() || !image->isValid()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        insert_unsafe(key, std::move(image), full_resolution);
+    }
+
+    // Outside the lock: the budget may call back into evictBytes
+    m_budget_registration.notifyGrowth();
+}
+
+void ResultCache::insert_unsafe(const Key& key, Image image, bool full_resolution)
+{
+    if (const auto it = m_index.find(key); it != m_index.end()) {
+        if (it->second->m_full_resolution && !full_resolution) {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return;
+        }
+        m_size_bytes -= it->second->m_bytes;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+    }
+
+    const std::size_t bytes { image->m_data.size() };
+    if (bytes > m_capacity_bytes) {
+        return;
+    }
+
+    m_entries.push_front(Entry{key, std::move(image), full_resolution, bytes});
+    m_index.emplace(key, m_entries.begin());
+    m_size_bytes += bytes;
+
+    while (m_size_bytes > m_capacity_bytes && !m_entries.empty()) {
+        const Entry& victim = m_entries.back();
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_key);
+        m_entries.pop_back();
+    }
+}
+
+void ResultCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_size_bytes = 0;
+}
+
+std::size_t ResultCache::sizeBytes() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_size_bytes;
+}
+
+std::size_t ResultCache::evictBytes(std::size_t bytes)
+{
+    std::lock_guard lock(m_mutex);
+
+    std::size_t freed { 0 };
+    while (freed < bytes && !m_entries.empty()) {
+        const Entry& victim = m_entries.back();
+        freed += victim.m_bytes;
+        m_size_bytes -= victim.m_bytes;
+        m_index.erase(victim.m_key);
+        m_entries.pop_back();
+    }
+    return freed;
+}
+
+bool ResultCache::isDiskEnabled() noexcept
+{
+    return Config::AppConfig::instance().getResultDiskCacheSizeMB() > 0;
+}
+
+std::filesystem::path ResultCache::directory()
+{
+    const auto& configured { Config::AppConfig::instance().getResultDiskCacheDirectory() };
+    if (!configured.empty()) {
+        return configured;
+    }
+
+    std::error_code ec;
+    const auto temp { std::filesystem::temp_directory_path(ec) };
+    return ec ? std::filesystem::path() : temp / "capturemoment" / "results";
+}
+
+/**
+ * @brief File name of the disk entry of a key.
+ */
+[[nodiscard]] static std::string entryName(const ResultCache::Key& key)
+{
+    static constexpr char k_hex[] { "0123456789abcdef" };
+
+    std::uint64_t hash { key.hash() };
+    std::string name(16, '0');
+    for (auto it = name.rbegin(); it != name.rend(); ++it, hash >>= 4) {
+        *it = k_hex[hash & 0xF];
+    }
+    return name + std::string(k_entry_extension);
+}
+
+ResultCache::Image ResultCache::loadFromDisk(const Key& key)
+{
+    const std::filesystem::path dir { directory() };
+    if (!isDiskEnabled() || dir.empty()) {
+        return nullptr;
+    }
+
+    const std::filesystem::path entry { dir / entryName(key) };
+    auto mapped { Common::MappedFile::open(entry) };
+    if (!mapped) {
+        return nullptr;
+    }
+
+    const std::span<const std::byte> bytes { mapped->bytes() };
+    ResultEntryHeader header;
+    if (bytes.size() < sizeof(header)) {
+        return nullptr;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    const std::uint64_t pixels_size { std::uint64_t{header.m_width} * header.m_height * Common::DisplayImage::k_channels };
+    if (header.m_magic != ResultEntryHeader::k_magic || header.m_version != ResultEntryHeader::k_version
+        || header.m_width != key.m_width || header.m_height != key.m_height
+        || header.m_source != key.m_source || header.m_edits != key.m_edits
+        || bytes.size() != sizeof(header) + pixels_size) {
+        // Truncated, foreign or colliding: a miss, replaced by the next store
+        spdlog::debug("[ResultCache::loadFromDisk]: '{}' does not match the requested state", entry.string());
+        return nullptr;
+    }
+
+    auto image { std::make_shared<Common::DisplayImage>() };
+    image->m_width = header.m_width;
+    image->m_height = header.m_height;
+    image->m_data.resize(pixels_size);
+    std::memcpy(image->m_data.data(), bytes.data() + sizeof(header), pixels_size);
+
+    // Most recently used: eviction deletes the oldest modification times first
+    std::error_code ec;
+    std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), ec);
+
+    spdlog::debug("[ResultCache::loadFromDisk]: Loaded '{}' ({}x{})", entry.string(), header.m_width, header.m_height);
+    return image;
+}
+
+void ResultCache::storeOnDisk(const Key& key, const Common::DisplayImage& image)
+{
+    const std::uint64_t capacity_mb { Config::AppConfig::instance().getResultDiskCacheSizeMB() };
+    const std::filesystem::path dir { directory() };
+    if (capacity_mb == 0 || dir.empty() || image.isOnDevice() || !image.isValid()) {
+        return;
+    }
+
+    std::lock_guard lock(m_disk_mutex);
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        spdlog::warn("[ResultCache::storeOnDisk]: Cannot create '{}': {}", dir.string(), ec.message());
+        return;
+    }
+
+    ResultEntryHeader header;
+    header.m_width = image.m_width;
+    header.m_height = image.m_height;
+    header.m_source = key.m_source;
+    header.m_edits = key.m_edits;
+
+    // Written aside, then renamed: a reader never maps a partial entry
+    const std::filesystem::path entry { dir / entryName(key) };
+    std::filesystem::path partial { entry };
+    partial.replace_extension(".part");
+
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(image.m_data.data()), static_cast<std::streamsize>(image.m_data.size()));
+        if (!out.flush()) {
+            spdlog::warn("[ResultCache::storeOnDisk]: Failed to write '{}'", partial.string());
+            out.close();
+            std::filesystem::remove(partial, ec);
+            return;
+        }
+    }
+
+    std::filesystem::rename(partial, entry, ec);
+    if (ec) {
+        spdlog::warn("[ResultCache::storeOnDisk]: Failed to install '{}': {}", entry.string(), ec.message());
+        std::filesystem::remove(partial, ec);
+        return;
+    }
+
+    evictDisk_unsafe(dir, capacity_mb << 20);
+}
+
+void ResultCache::evictDisk_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes)
+{
+    struct DiskEntry {
+        std::filesystem::path m_path;
+        std::filesystem::file_time_type m_last_used;
+        std::uintmax_t m_size;
+    };
+
+    std::vector<DiskEntry> entries;
+    std::uint64_t total_bytes { 0 };
+
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(dir, ec)) {
+        std::error_code file_ec;
+        if (!file.is_regular_file(file_ec) || file.path().extension() != k_entry_extension) {
+            continue;
+        }
+
+        DiskEntry entry { file.path(), file.last_write_time(file_ec), file.file_size(file_ec) };
+        if (!file_ec) {
+            total_bytes += entry.m_size;
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    if (total_bytes <= capacity_bytes) {
+        return;
+    }
+
+    std::ranges::sort(entries, {}, &DiskEntry::m_last_used);
+    for (const auto& entry : entries) {
+        if (total_bytes <= capacity_bytes) {
+            break;
+        }
+        if (std::filesystem::remove(entry.m_path, ec)) {
+            total_bytes -= entry.m_size;
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,198 @@
+/**
+ * @file smart_preview_store.cpp
+ * @brief Implementation of SmartPreviewStore.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/smart_preview_store.h"
+#include "managers/disk_image_cache.h"
+#include "managers/i_source_manager.h"
+#include "config/app_config.h"
+#include "common/trace/tracer.h"
+
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+#include <xxhash.h>
+
+#include <format>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+/**
+ * @brief OpenEXR compression of the entries: lossy DWAA, at OpenEXR's default level.
+ */
+constexpr std::string_view k_compression { "dwaa:45" };
+
+/**
+ * @brief Attribute of an entry holding the identity of its original (`DiskImageCache::Key::identity`).
+ */
+constexpr std::string_view k_identity_attribute { "capturemoment:SourceIdentity" };
+
+/**
+ * @brief Attribute of an entry holding the path of its original.
+ */
+constexpr std::string_view k_source_attribute { "capturemoment:SourcePath" };
+
+/**
+ * @brief Identity of an original (modification time and size), or empty if it cannot be inspected.
+ */
+[[nodiscard]] std::string sourceIdentity(std::string_view source)
+{
+    const auto key { DiskImageCache::makeKey(source, 0) };
+    return key ? key->identity() : std::string{};
+}
+
+} // namespace
+
+SmartPreviewStore::SmartPreviewStore(std::filesystem::path directory)
+    : m_directory(std::move(directory))
+{
+}
+
+std::optional<SmartPreviewStore> SmartPreviewStore::configured()
+{
+    auto directory { Config::AppConfig::instance().getSmartPreviewDirectory() };
+    if (directory.empty()) {
+        return std::nullopt;
+    }
+    return SmartPreviewStore(std::move(directory));
+}
+
+std::filesystem::path SmartPreviewStore::directoryFor(const std::filesystem::path& catalog)
+{
+    return catalog.parent_path() / (catalog.stem().string() + " Smart Previews");
+}
+
+std::filesystem::path SmartPreviewStore::entryPath(std::string_view source) const
+{
+    return m_directory / std::format("{:016x}.exr", XXH3_64bits(source.data(), source.size()));
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SmartPreviewStore::generate(std::string_view source, const ISourceManager& decoder) const
+{
+    CM_TRACE_SCOPE("io", "SmartPreviewStore::generate");
+
+    auto pixels { decoder.decodeThumbnail(source, k_long_edge) };
+    if (!pixels) {
+        spdlog::warn("[SmartPreviewStore::generate]: Cannot decode '{}': {}", source, pixels.error());
+        return std::unexpected(pixels.error());
+    }
+    return store(source, **pixels);
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SmartPreviewStore::store(std::string_view source, const Common::ImageRegion& pixels) const
+{
+    const std::string identity { sourceIdentity(source) };
+    if (identity.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+    if (pixels.channels() != 4) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+
+    const std::filesystem::path entry { entryPath(source) };
+    std::filesystem::path part { entry };
+    part += ".part";
+
+    // ============================================================
+    // Half-float RGBA, DWAA: the pixels are converted by the writer
+    // ============================================================
+    OIIO::ImageSpec spec(static_cast<int>(pixels.width()), static_cast<int>(pixels.height()), 4, OIIO::TypeDesc::HALF);
+    spec.alpha_channel = 3;
+    spec.attribute("compression", std::string(k_compression));
+    spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+    spec.attribute(std::string(k_source_attribute), std::string(source));
+    spec.attribute(std::string(k_identity_attribute), identity);
+
+    auto output { OIIO::ImageOutput::create("openexr") };
+    if (!output) {
+        spdlog::error("[SmartPreviewStore::store]: No OpenEXR writer: {}", OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    if (!output->open(part.string(), spec)
+        || !output->write_image(OIIO::TypeDesc::FLOAT, pixels.getBuffer().data())
+        || !output->close()) {
+        spdlog::error("[SmartPreviewStore::store]: Cannot write the preview of '{}': {}", source, output->geterror());
+        std::filesystem::remove(part, ec);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    std::filesystem::rename(part, entry, ec);
+    if (ec) {
+        spdlog::error("[SmartPreviewStore::store]: Cannot rename '{}': {}", part.string(), ec.message());
+        std::filesystem::remove(part, ec);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::debug("[SmartPreviewStore::store]: '{}' -> '{}' ({}x{})", source, entry.string(), pixels.width(), pixels.height());
+    return {};
+}
+
+std::optional<std::filesystem::path>
+SmartPreviewStore::previewFor(std::string_view source, Config::SmartPreviewPolicy policy) const
+{
+    if (policy == Config::SmartPreviewPolicy::Disabled) {
+        return std::nullopt;
+    }
+
+    std::filesystem::path entry { entryPath(source) };
+    std::error_code ec;
+    if (!std::filesystem::exists(entry, ec)) {
+        return std::nullopt;
+    }
+
+    // An unreachable original cannot be compared: its preview is all there is
+    const std::string identity { sourceIdentity(source) };
+    if (identity.empty()) {
+        return entry;
+    }
+    if (policy == Config::SmartPreviewPolicy::WhenOffline) {
+        return std::nullopt;
+    }
+
+    auto input { OIIO::ImageInput::open(entry.string()) };
+    if (!input) {
+        spdlog::warn("[SmartPreviewStore::previewFor]: Cannot open '{}': {}", entry.string(), OIIO::geterror());
+        return std::nullopt;
+    }
+    const OIIO::ImageSpec& spec { input->spec() };
+    if (spec.get_string_attribute(k_identity_attribute) != identity
+        || spec.get_string_attribute(k_source_attribute) != source) {
+        spdlog::debug("[SmartPreviewStore::previewFor]: Preview of '{}' is stale", source);
+        return std::nullopt;
+    }
+    return entry;
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> SmartPreviewStore::read(const std::filesystem::path& entry)
+{
+    CM_TRACE_SCOPE("io", "SmartPreviewStore::read");
+
+    OIIO::ImageBuf buf(entry.string());
+    if (!buf.read(0, 0, true, OIIO::TypeDesc::FLOAT) || buf.spec().nchannels != 4) {
+        spdlog::error("[SmartPreviewStore::read]: Cannot read '{}': {}", entry.string(), buf.geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    buf.specmod().attribute("oiio:ColorSpace", "lin_rec709_scene");
+    return buf;
+}
+
+void SmartPreviewStore::remove(std::string_view source) const
+{
+    std::error_code ec;
+    std::filesystem::remove(entryPath(source), ec);
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -6,22 +6,43 @@
  */
 
 #include "managers/source_manager.h"
+#include "managers/jpeg_scaled_decoder.h"
+#include "managers/smart_preview_store.h"
 #include "image_config/raw_settings.h"
 #include "image_config/heic_settings.h"
+#include "operations/color_operations/camera_profile.h"
+#include "operations/color_operations/operation_white_balance.h"
 #include "utils/color_space_utils.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "config/app_config.h"
+#include "common/trace/allocation_tracker.h"
+#include "common/trace/tracer.h"
+#include "common/metrics/core_metrics.h"
+#include "workers/compute_pool.h"
+
+#include "config.h"
 
 #include <OpenImageIO/imagebufalgo.h>
 #include <OpenImageIO/imageio.h>
+#include <OpenImageIO/parallel.h>
 #include <spdlog/spdlog.h>
 #include <mutex>
+#include <chrono>
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <utility>
+
+#if CAPTUREMOMENT_USE_OPENMP
+#include <omp.h>
+#endif
 
 namespace CaptureMoment::Core::Managers {
 
-// Global static members for cache management
-static std::shared_ptr<OIIO::ImageCache> s_global_cache_ptr { nullptr };
-static std::once_flag s_cache_init_flag;
-
 /**
  * @brief Checks if a file path has one of the specified extensions.
  * @param path The file path to check.
@@ -45,58 +66,1298 @@ static std::once_flag s_cache_init_flag;
     return false;
 }
 
-OIIO::ImageCache* SourceManager::getGlobalCache()
+/**
+ * @brief Key of a decode in the decoded-image cache: drafts are cached beside the full decodes.
+ */
+[[nodiscard]] static std::string cacheKey(std::string_view path, ImageConfig::Raw::RawQuality quality)
 {
-    std::call_once(s_cache_init_flag, []() {
-        s_global_cache_ptr = OIIO::ImageCache::create();
+    std::string key(path);
+    if (quality == ImageConfig::Raw::RawQuality::draft) {
+        key += "#draft";
+    }
+    return key;
+}
 
-        if (s_global_cache_ptr) {
-            s_global_cache_ptr->attribute("max_memory_MB", 2048.0f);
-            spdlog::debug("[SourceManager::getGlobalCache]: OIIO ImageCache created: 2GB limit");
-        } else {
-            spdlog::critical("[SourceManager::getGlobalCache]: Failed to create OIIO ImageCache");
+/**
+ * @brief OIIO/LibRaw decoder attributes of RAW settings.
+ */
+[[nodiscard]] static OIIO::ImageSpec rawDecoderConfig(const ImageConfig::Raw::RawSettings& settings)
+{
+    OIIO::ImageSpec config;
+    config.attribute("raw:half_size", static_cast<int>(settings.get_half_size()));
+    config.attribute("raw:Demosaic", settings.get_demosaic_string());
+    config.attribute("raw:ColorSpace", settings.get_color_space_string());
+    config.attribute("raw:HighlightMode", settings.get_highlight_mode_value());
+    config.attribute("raw:balance_clamped", static_cast<int>(settings.get_balance_clamped()));
+    config.attribute("raw:use_camera_matrix", settings.get_camera_matrix_value());
+    config.attribute("raw:use_camera_wb", static_cast<int>(settings.get_use_camera_wb()));
+    config.attribute("raw:use_auto_wb", static_cast<int>(settings.get_use_auto_wb()));
+    config.attribute("raw:fbdd_noiserd", settings.get_fbdd_noiserd_value());
+    config.attribute("raw:user_flip", settings.get_user_flip_value());
+    if (!settings.get_use_camera_wb() && !settings.get_use_auto_wb()) {
+        config.attribute("raw:user_mul", OIIO::TypeDesc(OIIO::TypeDesc::FLOAT, 4), settings.get_user_mul().data());
+    }
+    return config;
+}
+
+/**
+ * @brief Bounds LibRaw's OpenMP loops (lossless DNG tiles, CR3/NEF slices, demosaic) started
+ *        from the calling thread, for its lifetime.
+ * @details The OpenMP thread count is a per-thread setting: decodes on other threads keep theirs.
+ *          Does nothing without OpenMP (LibRaw then runs single-threaded or on its own default).
+ */
+class ScopedRawDecodeThreads {
+public:
+    explicit ScopedRawDecodeThreads([[maybe_unused]] int threads)
+    {
+#if CAPTUREMOMENT_USE_OPENMP
+        m_previous = omp_get_max_threads();
+        omp_set_num_threads(threads);
+#endif
+    }
+
+    ~ScopedRawDecodeThreads()
+    {
+#if CAPTUREMOMENT_USE_OPENMP
+        omp_set_num_threads(m_previous);
+#endif
+    }
+
+    ScopedRawDecodeThreads(const ScopedRawDecodeThreads&) = delete;
+    ScopedRawDecodeThreads& operator=(const ScopedRawDecodeThreads&) = delete;
+
+private:
+    /**
+     * @brief OpenMP thread count of the calling thread before the decode.
+     */
+    [[maybe_unused]] int m_previous{1};
+};
+
+/**
+ * @brief EXIF orientation recorded in a spec (`Normal` if untagged).
+ * @details Read as text: a decode mapped from the disk cache holds its attributes as strings.
+ */
+[[nodiscard]] static Common::ImageOrientation orientationOf(const OIIO::ImageSpec& spec)
+{
+    const OIIO::ParamValue* param { spec.find_attribute("Orientation") };
+    if (!param) {
+        return Common::ImageOrientation::Normal;
+    }
+    const std::string text { param->get_string() };
+    int code { 1 };
+    std::from_chars(text.data(), text.data() + text.size(), code);
+    return Common::orientationFromExif(code);
+}
+
+/**
+ * @brief Float values of a spec attribute (empty if it is missing or not a float array).
+ */
+[[nodiscard]] static std::span<const float> floatAttribute(const OIIO::ImageSpec& spec, std::string_view name)
+{
+    const OIIO::ParamValue* param { spec.find_attribute(name) };
+    if (!param || param->type().basetype != OIIO::TypeDesc::FLOAT) {
+        return {};
+    }
+    return { static_cast<const float*>(param->data()), param->type().basevalues() };
+}
+
+/**
+ * @brief Camera profile of a camera-native decode, from the LibRaw color data OIIO exposes.
+ */
+[[nodiscard]] static std::optional<Operations::CameraProfile> cameraProfileOf(const OIIO::ImageSpec& spec)
+{
+    return Operations::CameraProfile::fromLibRaw(floatAttribute(spec, "raw:cam_mul"), floatAttribute(spec, "raw:rgb_cam"));
+}
+
+/**
+ * @brief Mean of the first (up to four, one per CFA color) values of a numeric spec attribute.
+ * @return `fallback` if the attribute is missing.
+ */
+[[nodiscard]] static float meanAttribute(const OIIO::ImageSpec& spec, std::string_view name, float fallback)
+{
+    const OIIO::ParamValue* param { spec.find_attribute(name) };
+    if (!param || param->type().basevalues() == 0) {
+        return fallback;
+    }
+    const int count { std::min(static_cast<int>(param->type().basevalues()), 4) };
+    float sum { 0.0f };
+    for (int i = 0; i < count; ++i) {
+        sum += param->get_float_indexed(i, fallback);
+    }
+    return sum / static_cast<float>(count);
+}
+
+/**
+ * @brief CFA layout of an undemosaiced RAW read (2x2 Bayer quads only: X-Trans is 6x6).
+ */
+[[nodiscard]] static std::optional<ImageProcessing::CfaPattern> cfaPatternOf(const OIIO::ImageSpec& spec)
+{
+    static constexpr std::array<std::pair<std::string_view, ImageProcessing::CfaPattern>, 4> k_patterns {{
+        { "RGGB", ImageProcessing::CfaPattern::RGGB },
+        { "GRBG", ImageProcessing::CfaPattern::GRBG },
+        { "GBRG", ImageProcessing::CfaPattern::GBRG },
+        { "BGGR", ImageProcessing::CfaPattern::BGGR },
+    }};
+
+    const std::string pattern { spec.get_string_attribute("raw:FilterPattern") };
+    for (const auto& [name, value] : k_patterns) {
+        if (pattern == name) {
+            return value;
         }
-    });
-    return s_global_cache_ptr.get();
+    }
+    return std::nullopt;
 }
 
-SourceManager::SourceManager()
-    : m_cache(getGlobalCache())
+/**
+ * @brief Rows decoded per band by `loadSrgbLinearized` (a band stays in the L2 cache).
+ */
+constexpr int k_linearize_band_rows { 64 };
+
+/**
+ * @brief Decodes a row of sRGB-encoded samples to linear RGBA through a table.
+ * @param channels Samples per source pixel (1 to 4); alpha is scaled, not decoded.
+ */
+template <typename Sample>
+static void linearizeRow(const Sample* src, float* dst, int width, int channels,
+                         std::span<const float> table, float alpha_scale) noexcept
 {
-    if (!m_cache) {
-        spdlog::critical("[SourceManager::SourceManager]: Failed to get global ImageCache");
-        throw std::runtime_error("SourceManager: Initialization failed");
+    for (int x = 0; x < width; ++x, src += channels, dst += 4) {
+        switch (channels) {
+        case 1:
+            dst[0] = dst[1] = dst[2] = table[src[0]];
+            dst[3] = 1.0f;
+            break;
+        case 2:
+            dst[0] = dst[1] = dst[2] = table[src[0]];
+            dst[3] = static_cast<float>(src[1]) * alpha_scale;
+            break;
+        case 3:
+            dst[0] = table[src[0]];
+            dst[1] = table[src[1]];
+            dst[2] = table[src[2]];
+            dst[3] = 1.0f;
+            break;
+        default:
+            dst[0] = table[src[0]];
+            dst[1] = table[src[1]];
+            dst[2] = table[src[2]];
+            dst[3] = static_cast<float>(src[3]) * alpha_scale;
+            break;
+        }
     }
 }
 
+/**
+ * @brief A network file read ahead whole, and the decoder's reader over it.
+ */
+struct ReadAheadInput {
+    explicit ReadAheadInput(Common::ReadAheadFile contents)
+        : m_contents(std::move(contents))
+        , m_reader(m_contents.bytes().data(), m_contents.bytes().size())
+    {
+    }
+
+    /**
+     * @brief The contents of the file.
+     */
+    Common::ReadAheadFile m_contents;
+
+    /**
+     * @brief Reader of `m_contents`, handed to `OIIO::ImageInput::open`.
+     */
+    OIIO::Filesystem::IOMemReader m_reader;
+};
+
+/**
+ * @brief Reads a file whole when it sits on network storage, within `AppConfig::getNetworkReadAheadMaxMB`.
+ * @return The contents, or nullptr: a local or large file is decoded in place (so is one that
+ *         failed to read, the decoder reports the error).
+ */
+[[nodiscard]] static std::unique_ptr<ReadAheadInput> readAhead(std::string_view path)
+{
+    const std::uint64_t max_mb { Config::AppConfig::instance().getNetworkReadAheadMaxMB() };
+    const std::filesystem::path file(path);
+    if (max_mb == 0 || !Common::ReadAheadFile::isRemote(file)) {
+        return nullptr;
+    }
+
+    std::error_code error;
+    const auto size { std::filesystem::file_size(file, error) };
+    if (error || size > (max_mb << 20)) {
+        return nullptr;
+    }
+
+    auto contents { Common::ReadAheadFile::read(file) };
+    if (!contents) {
+        return nullptr;
+    }
+    spdlog::debug("[SourceManager::readAhead]: '{}' read ahead ({} bytes)", path, size);
+    return std::make_unique<ReadAheadInput>(std::move(contents.value()));
+}
+
+SourceManager::SourceManager()
+    : m_load_generation(std::make_shared<Common::CancellationToken::Counter>(0))
+    , m_prefetch_generation(std::make_shared<Common::CancellationToken::Counter>(0))
+    , m_decode_service(std::make_unique<DecodeService>(
+          [this](const std::string& path, ImageConfig::Raw::RawQuality quality, const Common::CancellationToken& token)
+              -> DecodeService::Result {
+              // Tile-backed files are never decoded whole
+              if (shouldOpenTiled(path)) {
+                  return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+              }
+              return acquireDecoded(path, quality, token);
+          }))
+    , m_loader(std::make_unique<Workers::EngineScheduler>())
+{
+}
+
 SourceManager::~SourceManager()
 {
+    // Queued loads and prefetches bail out, then the pools join before the members go away
+    // (the decode service first: its decodes queue disk cache writes on the loader)
+    cancelLoad();
+    m_prefetch_generation->fetch_add(1, std::memory_order_relaxed);
+    m_decode_service.reset();
+    m_loader.reset();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
     unloadInternal();
 }
 
-std::expected<void, ErrorHandling::CoreError> SourceManager::loadFile(std::string_view path)
+std::expected<void, ErrorHandling::CoreError> SourceManager::loadFile(std::string_view path)
+{
+    if (path.empty()) {
+        spdlog::warn("[SourceManager::loadFile]: Empty file path");
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    // Supersedes the pending asynchronous loads
+    const auto generation = m_load_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    return loadWithToken(std::string(path), Common::CancellationToken(m_load_generation, generation));
+}
+
+std::future<std::expected<void, ErrorHandling::CoreError>> SourceManager::loadFileAsync(std::string_view path)
+{
+    if (path.empty()) {
+        spdlog::warn("[SourceManager::loadFileAsync]: Empty file path");
+        std::promise<std::expected<void, ErrorHandling::CoreError>> failed;
+        failed.set_value(std::unexpected(ErrorHandling::CoreError::FileNotFound));
+        return failed.get_future();
+    }
+
+    const auto generation = m_load_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    Common::CancellationToken token(m_load_generation, generation);
+
+    return m_loader->submit(Workers::TaskPriority::Interactive,
+                            [this, path = std::string(path), token = std::move(token)]() {
+        return loadWithToken(path, token);
+    });
+}
+
+void SourceManager::cancelLoad()
+{
+    m_load_generation->fetch_add(1, std::memory_order_relaxed);
+}
+
+void SourceManager::prefetch(std::span<const std::string> paths)
+{
+    const auto generation = m_prefetch_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    const Common::CancellationToken token(m_prefetch_generation, generation);
+
+    const bool draft_raws = Config::AppConfig::instance().getRawLoadMode() == ImageConfig::Raw::RawLoadMode::draft_first;
+
+    for (const auto& path : paths) {
+        // Prefetch what a load shows first: the draft of a RAW file in draft-first mode
+        const auto quality = (draft_raws && isRawFile(path)) ? ImageConfig::Raw::RawQuality::draft
+                                                             : ImageConfig::Raw::RawQuality::full;
+        if (path.empty() || isDecodeCached(cacheKey(path, quality))) {
+            continue;
+        }
+
+        m_decode_service->decode(path, quality, Workers::TaskPriority::Thumbnail,
+                                 [](const std::string& decoded_path, DecodeService::Result decoded) {
+            if (decoded) {
+                spdlog::debug("[SourceManager::prefetch]: Prefetched '{}'", decoded_path);
+            }
+        }, token);
+    }
+}
+
+std::vector<DecodeService::Result> SourceManager::decodeBatch(std::span<const std::string> paths,
+                                                              ImageConfig::Raw::RawQuality quality,
+                                                              const Common::CancellationToken& token)
+{
+    return m_decode_service->decodeBatch(paths, quality, Workers::TaskPriority::Export, token);
+}
+
+void SourceManager::decodeAsync(std::string path, ImageConfig::Raw::RawQuality quality, Workers::TaskPriority priority,
+                                DecodeService::ResultCallback on_decoded, Common::CancellationToken token)
+{
+    m_decode_service->decode(std::move(path), quality, priority, std::move(on_decoded), std::move(token));
+}
+
+std::expected<void, ErrorHandling::CoreError> SourceManager::openStreaming(std::string_view path)
+{
+    if (isRawFile(path) || isHeicFile(path)) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+    return openTiled(std::string(path), Common::CancellationToken{});
+}
+
+std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+SourceManager::decodePersistent(std::string_view path, const Common::CancellationToken& token)
+{
+    if (path.empty()) {
+        spdlog::warn("[SourceManager::decodePersistent]: Empty file path");
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    constexpr auto quality { ImageConfig::Raw::RawQuality::full };
+    std::optional<DiskImageCache::Key> disk_key;
+    if (DiskImageCache::isEnabled()) {
+        disk_key = DiskImageCache::makeKey(path, isRawFile(path) ? rawDecodeFingerprint(quality) : 0);
+    }
+    if (disk_key) {
+        if (auto mapped = m_disk_cache.load(*disk_key)) {
+            Common::Metrics::coreMetrics().m_source_disk_cache_hits.add();
+            return mapped;
+        }
+    }
+
+    std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> decoded { std::unexpected(ErrorHandling::CoreError::Unexpected) };
+    try {
+        decoded = decodeFile(path, quality);
+    } catch (const std::bad_alloc&) {
+        spdlog::error("[SourceManager::decodePersistent]: Out of memory decoding '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    if (!decoded) {
+        return std::unexpected(decoded.error());
+    }
+
+    // Stored synchronously, then the decode is dropped for its mapping
+    if (disk_key) {
+        m_disk_cache.store(*disk_key, *decoded);
+        if (auto mapped = m_disk_cache.load(*disk_key)) {
+            return mapped;
+        }
+        spdlog::warn("[SourceManager::decodePersistent]: '{}' not persisted, kept in memory", path);
+    }
+    return std::make_shared<const OIIO::ImageBuf>(std::move(decoded.value()));
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::loadDecoded(std::string_view path, DecodedImageCache::Buffer buffer)
+{
+    if (!buffer || !buffer->initialized()) {
+        spdlog::warn("[SourceManager::loadDecoded]: No image for '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    // Supersedes the pending asynchronous loads
+    const auto generation = m_load_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    const std::string key { cacheKey(path, ImageConfig::Raw::RawQuality::full) };
+    m_compressed_cache.erase(key);
+    m_decoded_cache.insert(key, buffer);
+    if (!install(std::string(path), std::move(buffer), Common::CancellationToken(m_load_generation, generation))) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadDecoded]: Loaded '{}': {}x{}", path, width(), height());
+    return {};
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+SourceManager::decodeThumbnail(std::string_view path, Common::ImageDim max_long_edge) const
+{
+    if (path.empty()) {
+        spdlog::warn("[SourceManager::decodeThumbnail]: Empty file path");
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+    if (max_long_edge == 0) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const auto long_edge = [](const OIIO::ImageSpec& spec) {
+        return static_cast<Common::ImageDim>(std::max(spec.width, spec.height));
+    };
+
+    // ============================================================
+    // Decode the cheapest rendition covering the thumbnail
+    // ============================================================
+    std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> source { std::unexpected(ErrorHandling::CoreError::UnsupportedFormat) };
+    std::unique_ptr<OIIO::ImageBuf> tiled;
+
+    if (isRawFile(path)) {
+        // The embedded JPEG when it is large enough, a half-size demosaic otherwise
+        source = loadRawPreview(path);
+        if (!source || long_edge(source->spec()) < max_long_edge) {
+            source = loadRawFile(path, ImageConfig::Raw::RawQuality::draft);
+        }
+    } else if (shouldOpenTiled(path)) {
+        // Never decoded whole: the resize streams the file through the tile cache
+        tiled = std::make_unique<OIIO::ImageBuf>(std::string(path), 0, 0, tileCache());
+        if (!tiled->read(0, 0, false)) {
+            spdlog::error("[SourceManager::decodeThumbnail]: Failed to open '{}': {}", path, tiled->geterror());
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+    } else {
+        // JPEG: libjpeg skips most of the inverse DCT at 1/2 to 1/8 scale
+        if (JpegScaledDecoder::isJpegFile(path)) {
+            source = JpegScaledDecoder::decode(path, max_long_edge);
+        }
+        if (!source) {
+            source = decodeFile(path, ImageConfig::Raw::RawQuality::full);
+        }
+    }
+
+    if (!tiled && !source) {
+        return std::unexpected(source.error());
+    }
+    const OIIO::ImageBuf& full { tiled ? *tiled : *source };
+
+    // ============================================================
+    // Downsample to fit (filtered; never enlarged)
+    // ============================================================
+    const OIIO::ImageSpec& spec { full.spec() };
+    const double scale { std::min(1.0, static_cast<double>(max_long_edge) / static_cast<double>(long_edge(spec))) };
+    const int width { std::max(1, static_cast<int>(std::lround(spec.width * scale))) };
+    const int height { std::max(1, static_cast<int>(std::lround(spec.height * scale))) };
+
+    OIIO::ImageBuf resized;
+    if (scale < 1.0) {
+        resized = OIIO::ImageBufAlgo::resize(full, {}, OIIO::ROI(0, width, 0, height, 0, 1, 0, spec.nchannels));
+        if (resized.has_error()) {
+            spdlog::error("[SourceManager::decodeThumbnail]: Resize of '{}' failed: {}", path, resized.geterror());
+            return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+        }
+    }
+    const OIIO::ImageBuf& fitted { scale < 1.0 ? resized : full };
+
+    // ============================================================
+    // Tile-backed files were resized in their own layout: expand and linearize now
+    // ============================================================
+    std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> rgba { std::unexpected(ErrorHandling::CoreError::Unexpected) };
+    if (tiled) {
+        rgba = convertToRgbaInternal(fitted);
+        if (!rgba) {
+            return std::unexpected(rgba.error());
+        }
+        auto [is_linear, cs_name] = Utils::analyzeColorSpace(tiled->spec());
+        if (!is_linear && !cs_name.empty()) {
+            rgba->specmod().attribute("oiio:ColorSpace", cs_name);
+            if (auto conversion = Utils::transformToColorSpace(*rgba, "lin_rec709_scene"); !conversion) {
+                return std::unexpected(conversion.error());
+            }
+        }
+    }
+    const OIIO::ImageBuf& linear { tiled ? *rgba : fitted };
+
+    // ============================================================
+    // Copy out as an ImageRegion
+    // ============================================================
+    const auto region_width { static_cast<Common::ImageDim>(linear.spec().width) };
+    const auto region_height { static_cast<Common::ImageDim>(linear.spec().height) };
+    Common::PixelBuffer data(static_cast<std::size_t>(region_width) * region_height * 4);
+    if (!linear.get_pixels(OIIO::ROI(0, linear.spec().width, 0, linear.spec().height, 0, 1, 0, 4),
+                           OIIO::TypeDesc::FLOAT, data.data())) {
+        spdlog::error("[SourceManager::decodeThumbnail]: get_pixels failed: {}", linear.geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    auto region { std::make_unique<Common::ImageRegion>(std::move(data), region_width, region_height,
+                                                        static_cast<Common::ImageChan>(4)) };
+
+    // ============================================================
+    // A camera-native draft is developed at its as-shot white balance
+    // ============================================================
+    if (const std::string profile { spec.get_string_attribute(std::string(Operations::CameraProfile::k_metadata_key)) };
+        !profile.empty()) {
+        Operations::OperationDescriptor develop;
+        develop.type = Operations::OperationType::WhiteBalance;
+        develop.name = "WhiteBalance";
+        develop.setParam(Operations::ParameterKey::CameraProfile, profile);
+        if (auto developed = Operations::OperationWhiteBalance{}.executeOnImageRegion(*region, develop); !developed) {
+            return std::unexpected(developed.error());
+        }
+    }
+
+    spdlog::debug("[SourceManager::decodeThumbnail]: '{}' -> {}x{}", path, region_width, region_height);
+
+    return region;
+}
+
+std::expected<ImageMetadata, ErrorHandling::CoreError>
+SourceManager::readMetadata(std::string_view path) const
+{
+    if (path.empty()) {
+        spdlog::warn("[SourceManager::readMetadata]: Empty file path");
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        spdlog::warn("[SourceManager::readMetadata]: No such file '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    // ============================================================
+    // Open the header only: no pixel is read, and the RAW sensor data is not unpacked
+    // ============================================================
+    auto in { OIIO::ImageInput::open(std::string(path)) };
+    if (!in) {
+        spdlog::warn("[SourceManager::readMetadata]: Cannot open '{}': {}", path, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+    const OIIO::ImageSpec spec { in->spec() };
+    in->close();
+
+    ImageMetadata metadata;
+    metadata.m_width = static_cast<Common::ImageDim>(spec.width);
+    metadata.m_height = static_cast<Common::ImageDim>(spec.height);
+    metadata.m_orientation = std::clamp(spec.get_int_attribute("Orientation", 1), 1, 8);
+    metadata.m_capture_date = spec.get_string_attribute("Exif:DateTimeOriginal");
+    if (metadata.m_capture_date.empty()) {
+        metadata.m_capture_date = spec.get_string_attribute("DateTime");
+    }
+    metadata.m_camera_make = spec.get_string_attribute("Make");
+    metadata.m_camera_model = spec.get_string_attribute("Model");
+    metadata.m_lens = spec.get_string_attribute("Exif:LensModel");
+
+    return metadata;
+}
+
+std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>>
+SourceManager::readMetadataBatch(std::span<const std::string> paths, const Common::CancellationToken& token) const
+{
+    CM_TRACE_SCOPE("io", "SourceManager::readMetadataBatch");
+
+    std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>> results(
+        paths.size(), std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+
+    // Header reads are latency-bound (open, seek, small reads): overlap them on the pool
+    OIIO::parallel_for(int64_t { 0 }, static_cast<int64_t>(paths.size()), [&](int64_t i) {
+        if (token.isCancelled()) {
+            return;
+        }
+        results[static_cast<std::size_t>(i)] = readMetadata(paths[static_cast<std::size_t>(i)]);
+    });
+
+    spdlog::debug("[SourceManager::readMetadataBatch]: {} file(s) read", paths.size());
+
+    return results;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::loadWithToken(const std::string& path, const Common::CancellationToken& token)
+{
+    CM_TRACE_SCOPE("io", "SourceManager::load");
+
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadWithToken]: Loading: '{}'", path);
+
+    // Smart preview instead of an original that is offline or on slow storage
+    if (!isDecodeCached(cacheKey(path, ImageConfig::Raw::RawQuality::full))) {
+        auto preview = loadSmartPreview(path, token);
+        if (preview || preview.error() == ErrorHandling::CoreError::LoadCancelled) {
+            return preview;
+        }
+    }
+
+    // RAW without a full-quality decode yet: show a preview (embedded JPEG or draft) first
+    const auto raw_mode = Config::AppConfig::instance().getRawLoadMode();
+    if (isRawFile(path)
+        && raw_mode != ImageConfig::Raw::RawLoadMode::full_demosaic
+        && !isDecodeCached(cacheKey(path, ImageConfig::Raw::RawQuality::full))) {
+        auto preview = loadPreviewFirst(path, raw_mode, token);
+        if (preview || preview.error() == ErrorHandling::CoreError::LoadCancelled) {
+            return preview;
+        }
+        spdlog::debug("[SourceManager::loadWithToken]: No usable preview of '{}', demosaicing", path);
+    }
+
+    // Huge standard image not decoded yet: read its tiles on demand instead
+    if (!isDecodeCached(cacheKey(path, ImageConfig::Raw::RawQuality::full)) && shouldOpenTiled(path)) {
+        return openTiled(path, token);
+    }
+
+    // Large JPEG not decoded whole yet: show a scaled decode until full quality is requested
+    if (JpegScaledDecoder::isJpegFile(path)
+        && !isDecodeCached(cacheKey(path, ImageConfig::Raw::RawQuality::full))) {
+        auto preview = loadScaledJpegFirst(path, token);
+        if (preview || preview.error() == ErrorHandling::CoreError::LoadCancelled) {
+            return preview;
+        }
+    }
+
+    auto decoded = acquireDecoded(path, ImageConfig::Raw::RawQuality::full, token);
+    if (!decoded) {
+        return std::unexpected(decoded.error());
+    }
+
+    if (!install(path, std::move(decoded.value()), token)) {
+        spdlog::debug("[SourceManager::loadWithToken]: Load of '{}' superseded, kept in cache only", path);
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadWithToken]: Loaded '{}': {}x{} RGBA_F32", path, width(), height());
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::loadPreviewFirst(const std::string& path, ImageConfig::Raw::RawLoadMode mode,
+                                const Common::CancellationToken& token)
+{
+    DecodedImageCache::Buffer preview;
+
+    // The embedded preview is not cached (it decodes in milliseconds); drafts are
+    if (mode == ImageConfig::Raw::RawLoadMode::embedded_preview_first) {
+        if (auto embedded = loadRawPreview(path); embedded) {
+            preview = std::make_shared<const OIIO::ImageBuf>(std::move(embedded.value()));
+        }
+    }
+
+    if (!preview) {
+        auto draft = acquireDecoded(path, ImageConfig::Raw::RawQuality::draft, token);
+        if (!draft) {
+            return std::unexpected(draft.error());
+        }
+        preview = std::move(draft.value());
+    }
+
+    if (!install(path, std::move(preview), token, true)) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadPreviewFirst]: Showing preview of '{}' ({}x{})", path, width(), height());
+
+    // Draft-first keeps the draft until full quality is requested (zoom to 100%, export)
+    if (mode == ImageConfig::Raw::RawLoadMode::embedded_preview_first) {
+        queueRefinement(path, token);
+    }
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::loadSmartPreview(const std::string& path, const Common::CancellationToken& token)
+{
+    const auto store { SmartPreviewStore::configured() };
+    if (!store) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    const auto entry { store->previewFor(path, Config::AppConfig::instance().getSmartPreviewPolicy()) };
+    if (!entry) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    auto preview = SmartPreviewStore::read(*entry);
+    if (!preview) {
+        return std::unexpected(preview.error());
+    }
+
+    if (!install(path, std::make_shared<const OIIO::ImageBuf>(std::move(preview.value())), token, true)) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadSmartPreview]: Editing the smart preview of '{}' ({}x{})", path, width(), height());
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::loadScaledJpegFirst(const std::string& path, const Common::CancellationToken& token)
+{
+    const Common::ImageDim preview_edge { Config::AppConfig::instance().getJpegPreviewLongEdge() };
+    if (preview_edge == 0) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    auto scaled = JpegScaledDecoder::decode(path, preview_edge);
+    if (!scaled) {
+        return std::unexpected(scaled.error());
+    }
+
+    if (!install(path, std::make_shared<const OIIO::ImageBuf>(std::move(scaled.value())), token, true)) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::loadScaledJpegFirst]: Showing scaled decode of '{}' ({}x{})", path, width(), height());
+    return {};
+}
+
+void SourceManager::requestFullQuality()
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_is_preview) {
+            return;
+        }
+        path = m_current_path;
+    }
+
+    // Bound to the current load: the next one cancels the refinement
+    const Common::CancellationToken token(m_load_generation, m_load_generation->load(std::memory_order_relaxed));
+    queueRefinement(path, token);
+}
+
+std::expected<void, ErrorHandling::CoreError> SourceManager::redevelopRaw(const ImageConfig::Raw::RawSettings& settings)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!isLoaded_unsafe()) {
+            return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+        }
+        path = m_current_path;
+    }
+
+    if (!isRawFile(path)) {
+        spdlog::warn("[SourceManager::redevelopRaw]: '{}' is not a RAW file", path);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    // Bound to the current load: a newer one supersedes the development
+    const Common::CancellationToken token(m_load_generation, m_load_generation->load(std::memory_order_relaxed));
+
+    auto developed = developRaw(path, settings);
+    if (!developed) {
+        spdlog::error("[SourceManager::redevelopRaw]: Development of '{}' failed: {}",
+                      path, ErrorHandling::to_string(developed.error()));
+        return std::unexpected(developed.error());
+    }
+
+    if (!install(path, std::make_shared<const OIIO::ImageBuf>(std::move(developed.value())), token)) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    spdlog::info("[SourceManager::redevelopRaw]: '{}' redeveloped ({}x{})", path, width(), height());
+    return {};
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+SourceManager::developRaw(const std::string& path, const ImageConfig::Raw::RawSettings& settings)
+{
+    CM_TRACE_SCOPE("io", "SourceManager::developRaw");
+    const auto quality { settings.get_half_size() ? ImageConfig::Raw::RawQuality::draft
+                                                  : ImageConfig::Raw::RawQuality::full };
+
+    // ============================================================
+    // Halide engine: the resident mosaic, no file access at all
+    // ============================================================
+    if (Config::AppConfig::instance().getRawDemosaicEngine() == ImageConfig::Raw::RawDemosaicEngine::halide) {
+        if (auto demosaiced = demosaicResident(path, quality)) {
+            return demosaiced;
+        }
+        spdlog::debug("[SourceManager::developRaw]: No Halide demosaic for '{}', using LibRaw", path);
+    }
+
+    // ============================================================
+    // LibRaw: camera-native, from the resident file bytes
+    // ============================================================
+    ImageConfig::Raw::RawSettings native { settings };
+    native.set_color_space(ImageConfig::Raw::RawColorSpace::raw);
+    native.set_user_mul(1.0f, 1.0f, 1.0f, 1.0f);
+
+    auto file { residentRawFile(path) };
+    std::optional<OIIO::Filesystem::IOMemReader> proxy;
+    if (file) {
+        const std::span<const std::byte> bytes { file.value()->m_contents.bytes() };
+        proxy.emplace(bytes.data(), bytes.size());
+    }
+
+    const int threads { rawDecodeThreads(settings) };
+    const ScopedRawDecodeThreads decode_threads(threads);
+
+    const OIIO::ImageSpec config { rawDecoderConfig(native) };
+    auto buf_result = loadImageBuffer(path, &config, proxy ? &*proxy : nullptr, threads);
+    if (!buf_result) {
+        return std::unexpected(buf_result.error());
+    }
+
+    if (auto profile = cameraProfileOf(buf_result->spec())) {
+        buf_result->specmod().attribute(std::string(Operations::CameraProfile::k_metadata_key), profile->format());
+        return buf_result;
+    }
+
+    // No camera profile: the settings develop the colors, as given
+    spdlog::warn("[SourceManager::developRaw]: No camera profile for '{}', white balance baked in the decode", path);
+    const OIIO::ImageSpec developed_config { rawDecoderConfig(settings) };
+    if (proxy) {
+        proxy->seek(0);
+    }
+    return loadImageBuffer(path, &developed_config, proxy ? &*proxy : nullptr, threads);
+}
+
+std::expected<std::shared_ptr<const SourceManager::ResidentRawFile>, ErrorHandling::CoreError>
+SourceManager::residentRawFile(const std::string& path)
+{
+    std::lock_guard lock(m_raw_file_mutex);
+    if (m_resident_raw_file && m_resident_raw_file->m_path == path) {
+        return m_resident_raw_file;
+    }
+
+    auto contents { Common::ReadAheadFile::read(path) };
+    if (!contents) {
+        spdlog::warn("[SourceManager::residentRawFile]: Failed to read '{}': {}", path, contents.error());
+        return std::unexpected(contents.error());
+    }
+
+    auto file { std::make_shared<ResidentRawFile>() };
+    file->m_path = path;
+    file->m_contents = std::move(contents.value());
+
+    spdlog::debug("[SourceManager::residentRawFile]: Keeping the {} bytes of '{}'", file->m_contents.bytes().size(), path);
+    m_resident_raw_file = std::move(file);
+    return m_resident_raw_file;
+}
+
+void SourceManager::queueRefinement(const std::string& path, const Common::CancellationToken& token)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_is_preview || m_refinement_queued || m_current_path != path) {
+            return;
+        }
+        m_refinement_queued = true;
+    }
+
+    spdlog::debug("[SourceManager::queueRefinement]: Full-quality demosaic of '{}' queued", path);
+    m_loader->post(Workers::TaskPriority::Refine, [this, path, token]() {
+        refineFromPreview(path, token);
+    });
+}
+
+void SourceManager::refineFromPreview(const std::string& path, const Common::CancellationToken& token)
+{
+    // A newer load makes the demosaic pointless (unless it already started: then it is cached)
+    if (token.isCancelled()) {
+        return;
+    }
+
+    auto decoded = acquireDecoded(path, ImageConfig::Raw::RawQuality::full, token);
+    if (!decoded) {
+        spdlog::warn("[SourceManager::refineFromPreview]: Demosaic of '{}' failed ({}), keeping the preview",
+                     path, ErrorHandling::to_string(decoded.error()));
+        return;
+    }
+
+    if (!install(path, std::move(decoded.value()), token)) {
+        return;
+    }
+
+    spdlog::info("[SourceManager::refineFromPreview]: Full demosaic of '{}' swapped in ({}x{})", path, width(), height());
+
+    std::lock_guard lock(m_refined_mutex);
+    if (m_on_refined) {
+        m_on_refined(path);
+    }
+}
+
+bool SourceManager::isPreview() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_is_preview;
+}
+
+void SourceManager::setRefinedCallback(RefinedCallback callback)
+{
+    std::lock_guard lock(m_refined_mutex);
+    m_on_refined = std::move(callback);
+}
+
+bool SourceManager::isTileBacked() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tiled_buf && !m_image_buf;
+}
+
+SourceTileCacheStats SourceManager::tileCacheStats() const
+{
+    const auto cache { tileCache() };
+    if (!cache) {
+        return {};
+    }
+
+    std::int64_t find_tile_calls { 0 };
+    int cache_misses { 0 };
+    std::int64_t bytes_read { 0 };
+    std::int64_t memory_used { 0 };
+    float capacity_mb { 0.0f };
+    cache->getattribute("stat:find_tile_calls", OIIO::TypeInt64, &find_tile_calls);
+    cache->getattribute("stat:find_tile_cache_misses", OIIO::TypeInt, &cache_misses);
+    cache->getattribute("stat:bytes_read", OIIO::TypeInt64, &bytes_read);
+    cache->getattribute("stat:cache_memory_used", OIIO::TypeInt64, &memory_used);
+    cache->getattribute("max_memory_MB", OIIO::TypeFloat, &capacity_mb);
+
+    SourceTileCacheStats stats;
+    stats.m_misses = static_cast<std::uint64_t>(std::max(cache_misses, 0));
+    stats.m_hits = static_cast<std::uint64_t>(std::max<std::int64_t>(find_tile_calls - cache_misses, 0));
+    stats.m_bytes_read = static_cast<std::uint64_t>(std::max<std::int64_t>(bytes_read, 0));
+    stats.m_memory_used_bytes = static_cast<std::uint64_t>(std::max<std::int64_t>(memory_used, 0));
+    stats.m_capacity_bytes = static_cast<std::uint64_t>(capacity_mb) * 1024 * 1024;
+    return stats;
+}
+
+std::shared_ptr<OIIO::ImageCache> SourceManager::tileCache()
+{
+    static const std::shared_ptr<OIIO::ImageCache> s_tile_cache = []() {
+        auto cache { OIIO::ImageCache::create() };
+        if (!cache) {
+            spdlog::critical("[SourceManager::tileCache]: Failed to create OIIO ImageCache");
+            return cache;
+        }
+        // Scanline files are served in tiles too, so a region never pulls whole strips
+        cache->attribute("autotile", 256);
+        cache->attribute("max_memory_MB", Config::AppConfig::instance().getSourceTileCacheSizeMB());
+        return cache;
+    }();
+    return s_tile_cache;
+}
+
+const Common::MemoryBudget::Registration& SourceManager::tileCacheBudget()
+{
+    static const Common::MemoryBudget::Registration s_registration {
+        Common::MemoryBudget::instance().registerConsumer(
+            "Source tile cache",
+            [] {
+                std::int64_t memory_used { 0 };
+                if (const auto cache { tileCache() }) {
+                    cache->getattribute("stat:cache_memory_used", OIIO::TypeInt64, &memory_used);
+                }
+                return static_cast<std::size_t>(std::max<std::int64_t>(memory_used, 0));
+            },
+            [](std::size_t bytes) -> std::size_t {
+                const auto cache { tileCache() };
+                if (!cache) {
+                    return 0;
+                }
+
+                std::int64_t memory_used { 0 };
+                cache->getattribute("stat:cache_memory_used", OIIO::TypeInt64, &memory_used);
+                const std::size_t used { static_cast<std::size_t>(std::max<std::int64_t>(memory_used, 0)) };
+
+                // Same floor as AppConfig; the tiles over the new capacity are evicted on the next reads
+                constexpr std::size_t k_min_capacity { std::size_t{64} << 20 };
+                const std::size_t capacity { std::max(used > bytes ? used - bytes : 0, k_min_capacity) };
+                cache->attribute("max_memory_MB", static_cast<float>(capacity >> 20));
+
+                spdlog::debug("[SourceManager::tileCacheBudget]: Tile cache capacity lowered to {} MB", capacity >> 20);
+                return used > capacity ? used - capacity : 0;
+            })
+    };
+    return s_registration;
+}
+
+bool SourceManager::shouldOpenTiled(std::string_view path) const
+{
+    const std::uint64_t min_pixels { Config::AppConfig::instance().getTiledSourceMinPixels() };
+    if (min_pixels == 0 || isRawFile(path) || isHeicFile(path)) {
+        return false;
+    }
+
+    const auto cache { tileCache() };
+    OIIO::ImageSpec spec;
+    if (!cache || !cache->get_imagespec(OIIO::ustring(path), spec)) {
+        // The decode reports the error
+        return false;
+    }
+
+    return static_cast<std::uint64_t>(spec.width) * static_cast<std::uint64_t>(spec.height) >= min_pixels;
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::openTiled(const std::string& path, const Common::CancellationToken& token)
+{
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    const auto cache { tileCache() };
+    cache->attribute("max_memory_MB", Config::AppConfig::instance().getSourceTileCacheSizeMB());
+    tileCacheBudget().touch();
+
+    // Binds the file to the cache without reading pixels (converting the type would force a full read)
+    auto buf { std::make_unique<OIIO::ImageBuf>(path, 0, 0, cache) };
+    if (!buf->read(0, 0, false)) {
+        spdlog::error("[SourceManager::openTiled]: Failed to open '{}': {}", path, buf->geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    const OIIO::ImageSpec& spec { buf->spec() };
+    auto [is_linear, cs_name] = Utils::analyzeColorSpace(spec);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    if (isLoaded_unsafe()) {
+        unloadInternal();
+    }
+
+    // Tiles are served as RGBA whatever the file layout
+    m_width.store(static_cast<Common::ImageDim>(spec.width), std::memory_order_relaxed);
+    m_height.store(static_cast<Common::ImageDim>(spec.height), std::memory_order_relaxed);
+    m_channels.store(static_cast<Common::ImageChan>(4), std::memory_order_relaxed);
+    m_orientation.store(orientationOf(spec), std::memory_order_relaxed);
+
+    m_tiled_channels = spec.nchannels;
+    m_tiled_color_space = (!is_linear && !cs_name.empty()) ? cs_name : std::string();
+    m_tiled_buf = std::move(buf);
+    m_current_path = path;
+    m_is_preview = false;
+    m_refinement_queued = false;
+
+    spdlog::info("[SourceManager::openTiled]: '{}' opened tile-backed: {}x{} ({} channels)",
+                 path, spec.width, spec.height, spec.nchannels);
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::readTiled_unsafe(Common::ImageDim x, Common::ImageDim y,
+                                Common::ImageDim width, Common::ImageDim height, float* dst) const
+{
+    // The file channels land in the first slots of each RGBA pixel
+    const OIIO::ROI roi(
+        static_cast<int>(x), static_cast<int>(x + width),
+        static_cast<int>(y), static_cast<int>(y + height),
+        0, 1,
+        0, std::min(m_tiled_channels, 4)
+        );
+
+    constexpr OIIO::stride_t pixel_stride { 4 * sizeof(float) };
+    if (!m_tiled_buf->get_pixels(roi, OIIO::TypeDesc::FLOAT, dst, pixel_stride, pixel_stride * static_cast<OIIO::stride_t>(width))) {
+        spdlog::warn("[SourceManager::readTiled_unsafe]: get_pixels failed: {}", m_tiled_buf->geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    // The tile cache allocates inside OIIO: its footprint is sampled after each read
+    if (auto& tracker { Common::Trace::AllocationTracker::instance() }; tracker.isEnabled()) {
+        if (const auto cache { tileCache() }) {
+            std::int64_t memory_used { 0 };
+            cache->getattribute("stat:cache_memory_used", OIIO::TypeInt64, &memory_used);
+            tracker.sampleGauge("OIIO tile cache", static_cast<std::size_t>(std::max<std::int64_t>(memory_used, 0)));
+        }
+    }
+
+    expandToRgba(dst, static_cast<std::size_t>(width) * static_cast<std::size_t>(height), m_tiled_channels);
+
+    // The read may have pulled new tiles into the cache (the budget callbacks never take m_mutex)
+    tileCacheBudget().notifyGrowth();
+
+    if (!m_tiled_color_space.empty()) {
+        OIIO::ImageSpec tile_spec(static_cast<int>(width), static_cast<int>(height), 4, OIIO::TypeDesc::FLOAT);
+        tile_spec.alpha_channel = 3;
+        tile_spec.attribute("oiio:ColorSpace", m_tiled_color_space);
+
+        // Wraps the destination: converted in place
+        OIIO::ImageBuf tile_buf(tile_spec, dst);
+        if (auto conversion = Utils::transformToColorSpace(tile_buf, "lin_rec709_scene"); !conversion) {
+            return std::unexpected(conversion.error());
+        }
+    }
+
+    return {};
+}
+
+std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>
+SourceManager::acquireDecoded(const std::string& path, ImageConfig::Raw::RawQuality quality,
+                              const Common::CancellationToken& token)
+{
+    using Result = std::expected<DecodedImageCache::Buffer, ErrorHandling::CoreError>;
+
+    const std::string key = cacheKey(path, quality);
+    std::promise<Result> promise;
+    std::shared_future<Result> in_progress;
+    {
+        std::lock_guard lock(m_decoding_mutex);
+
+        if (auto cached = m_decoded_cache.find(key)) {
+            spdlog::debug("[SourceManager::acquireDecoded]: Cache hit for '{}'", key);
+            Common::Metrics::coreMetrics().m_source_cache_hits.add();
+            return cached;
+        }
+
+        if (const auto it = m_decoding.find(key); it != m_decoding.end()) {
+            in_progress = it->second;
+        } else if (token.isCancelled()) {
+            return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        } else {
+            m_decoding.emplace(key, promise.get_future().share());
+        }
+    }
+
+    // Another thread is decoding this path: share its result
+    if (in_progress.valid()) {
+        return in_progress.get();
+    }
+
+    // Full-quality RAW decodes persist across sessions (drafts are cheap enough to redo)
+    std::optional<DiskImageCache::Key> disk_key;
+    if (quality == ImageConfig::Raw::RawQuality::full && isRawFile(path) && DiskImageCache::isEnabled()) {
+        disk_key = DiskImageCache::makeKey(path, rawDecodeFingerprint(quality));
+    }
+
+    Result result = std::unexpected(ErrorHandling::CoreError::Unexpected);
+    try {
+        // A recently viewed image is restored from its compressed copy, faster than any decode
+        if (auto restored = m_compressed_cache.load(key)) {
+            spdlog::debug("[SourceManager::acquireDecoded]: Compressed cache hit for '{}'", key);
+            Common::Metrics::coreMetrics().m_source_compressed_cache_hits.add();
+            m_decoded_cache.insert(key, restored);
+            result = std::move(restored);
+        } else if (auto mapped = disk_key ? m_disk_cache.load(*disk_key) : Result(std::unexpected(ErrorHandling::CoreError::FileNotFound))) {
+            Common::Metrics::coreMetrics().m_source_disk_cache_hits.add();
+            m_decoded_cache.insert(key, *mapped);
+            result = std::move(mapped);
+        } else if (auto buf = decodeFile(path, quality)) {
+            auto shared = std::make_shared<const OIIO::ImageBuf>(std::move(buf.value()));
+            m_decoded_cache.insert(key, shared);
+            if (disk_key) {
+                storeOnDisk(std::move(*disk_key), shared);
+            }
+            result = std::move(shared);
+        } else {
+            result = std::unexpected(buf.error());
+        }
+    } catch (const std::bad_alloc&) {
+        spdlog::error("[SourceManager::acquireDecoded]: Out of memory decoding '{}'", path);
+        result = std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+
+    {
+        std::lock_guard lock(m_decoding_mutex);
+        m_decoding.erase(key);
+    }
+    promise.set_value(result);
+    return result;
+}
+
+bool SourceManager::isDecodeCached(const std::string& key) const
+{
+    return m_decoded_cache.contains(key) || m_compressed_cache.contains(key);
+}
+
+void SourceManager::setKeepsRecentImages(bool enabled)
+{
+    if (!enabled) {
+        m_decoded_cache.setEvictionHandler({});
+        m_compressed_cache.clear();
+        return;
+    }
+
+    // Compressing takes a fraction of a decode, still too long for the latency path
+    m_decoded_cache.setEvictionHandler([this](const std::string& key, const DecodedImageCache::Buffer& buffer) {
+        m_loader->post(Workers::TaskPriority::Thumbnail, [this, key, buffer]() {
+            m_compressed_cache.store(key, *buffer);
+        });
+    });
+}
+
+void SourceManager::storeOnDisk(DiskImageCache::Key key, DecodedImageCache::Buffer buffer)
+{
+    // Compressing takes about as long as loading the EXR back: never on the latency path
+    m_loader->post(Workers::TaskPriority::Thumbnail, [this, key = std::move(key), buffer = std::move(buffer)]() {
+        m_disk_cache.store(key, *buffer);
+    });
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+SourceManager::decodeFile(std::string_view path, ImageConfig::Raw::RawQuality quality) const
+{
+    CM_TRACE_SCOPE("io", "SourceManager::decode");
+    const auto begin { std::chrono::steady_clock::now() };
+
+    // Dispatch based on file type (only RAW files have a draft quality)
+    auto decoded = isRawFile(path)  ? loadRawFile(path, quality)
+                 : isHeicFile(path) ? loadHeicFile(path)
+                                    : loadStandardFile(path);
+
+    if (decoded) {
+        const auto& metrics { Common::Metrics::coreMetrics() };
+        metrics.m_source_decodes.add();
+        metrics.m_source_decoded_bytes.add(static_cast<std::uint64_t>(decoded->spec().image_bytes()));
+        Common::Trace::AllocationTracker::instance().countAllocation(static_cast<std::size_t>(decoded->spec().image_bytes()));
+        metrics.m_source_decode_ms.observe(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    }
+    return decoded;
+}
+
+bool SourceManager::install(const std::string& path, DecodedImageCache::Buffer buffer,
+                            const Common::CancellationToken& token, bool is_preview)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Checked under the lock: a newer load bumps the generation before it can install
+    if (token.isCancelled()) {
+        return false;
+    }
+
+    if (isLoaded_unsafe()) {
+        unloadInternal();
+    }
+
+    const auto& spec = buffer->spec();
+    m_width.store(static_cast<Common::ImageDim>(spec.width), std::memory_order_relaxed);
+    m_height.store(static_cast<Common::ImageDim>(spec.height), std::memory_order_relaxed);
+    m_channels.store(static_cast<Common::ImageChan>(spec.nchannels), std::memory_order_relaxed);
+    m_orientation.store(orientationOf(spec), std::memory_order_relaxed);
+
+    m_source_buf = std::move(buffer);
+    m_current_path = path;
+    m_is_preview = is_preview;
+    m_refinement_queued = false;
+    return true;
+}
+
+const OIIO::ImageBuf* SourceManager::buffer_unsafe() const noexcept
 {
-    if (path.empty()) {
-        spdlog::warn("[SourceManager::loadFile]: Empty file path");
-        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    if (m_image_buf) {
+        return m_image_buf.get();
     }
+    return m_source_buf ? m_source_buf.get() : m_tiled_buf.get();
+}
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
-    if (isLoaded_unsafe()) {
-        unloadInternal();
+OIIO::ImageBuf* SourceManager::writableBuffer_unsafe()
+{
+    // Copy-on-write: the shared decode stays the file's pixels for the cache. A deep RGBA_F32
+    // copy, as a persisted decode is a read-only half-float mapping (its ImageBuf copy would alias it)
+    if (!m_image_buf && m_source_buf) {
+        m_image_buf = std::make_unique<OIIO::ImageBuf>(m_source_buf->copy(OIIO::TypeDesc::FLOAT));
+        m_source_buf.reset();
     }
 
-    spdlog::info("[SourceManager::loadFile]: Loading: '{}'", path);
+    // The written pixels need a home: the tile-backed image is read whole, once
+    if (!m_image_buf && m_tiled_buf) {
+        const OIIO::ImageSpec& tiled_spec { m_tiled_buf->spec() };
+        OIIO::ImageSpec rgba_spec(tiled_spec.width, tiled_spec.height, 4, OIIO::TypeDesc::FLOAT);
+        rgba_spec.extra_attribs = tiled_spec.extra_attribs;
+        rgba_spec.alpha_channel = 3;
+        if (!m_tiled_color_space.empty()) {
+            rgba_spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+        }
 
-    // Dispatch based on file type
-    if (isRawFile(path)) {
-        return loadRawFile(path);
-    } else if (isHeicFile(path)) {
-        return loadHeicFile(path);
-    }
+        auto materialized { std::make_unique<OIIO::ImageBuf>(rgba_spec) };
+        if (!readTiled_unsafe(0, 0, static_cast<Common::ImageDim>(tiled_spec.width),
+                              static_cast<Common::ImageDim>(tiled_spec.height),
+                              static_cast<float*>(materialized->localpixels()))) {
+            spdlog::error("[SourceManager::writableBuffer_unsafe]: Failed to materialize '{}'", m_current_path);
+            return nullptr;
+        }
 
-    return loadStandardFile(path);
+        spdlog::debug("[SourceManager::writableBuffer_unsafe]: Tile-backed '{}' materialized", m_current_path);
+        m_image_buf = std::move(materialized);
+        m_tiled_buf.reset();
+    }
+    return m_image_buf.get();
 }
 
 bool SourceManager::isRawFile(std::string_view path) const
@@ -120,14 +1381,36 @@ bool SourceManager::isHeicFile(std::string_view path) const
     return hasExtension(path, heic_extensions);
 }
 
-std::expected<void, ErrorHandling::CoreError> SourceManager::loadRawFile(std::string_view path)
+std::uint64_t SourceManager::rawDecodeFingerprint(ImageConfig::Raw::RawQuality quality) noexcept
+{
+    // The Halide engine asks LibRaw for no demosaic: its decodes never match LibRaw's
+    ImageConfig::Raw::RawSettings settings { rawSettings(quality) };
+    if (Config::AppConfig::instance().getRawDemosaicEngine() == ImageConfig::Raw::RawDemosaicEngine::halide) {
+        settings.set_demosaic(ImageConfig::Raw::DemosaicAlgorithm::none);
+    }
+    return settings.fingerprint();
+}
+
+ImageConfig::Raw::RawSettings SourceManager::rawSettings(ImageConfig::Raw::RawQuality quality) noexcept
 {
-    spdlog::debug("[SourceManager::loadRawFile]: Processing RAW file: {}", path);
+    // Camera-native: the white balance and the matrix are applied by the pipeline
+    ImageConfig::Raw::RawSettings settings { developedRawSettings(quality) };
+    settings.set_color_space(ImageConfig::Raw::RawColorSpace::raw);
+    settings.set_user_mul(1.0f, 1.0f, 1.0f, 1.0f);
+    return settings;
+}
+
+ImageConfig::Raw::RawSettings SourceManager::developedRawSettings(ImageConfig::Raw::RawQuality quality) noexcept
+{
+    // LibRaw leaves the sensor frame as stored: the orientation is metadata (see `orientation`)
+    if (quality == ImageConfig::Raw::RawQuality::draft) {
+        ImageConfig::Raw::RawSettings draft { ImageConfig::Raw::RawSettings::draft_settings() };
+        draft.set_user_flip(ImageConfig::Raw::Orientation::normal);
+        return draft;
+    }
 
-    // ============================================================
-    // Configure OIIO/LibRaw with optimized settings
-    // ============================================================
     ImageConfig::Raw::RawSettings settings;
+    settings.set_user_flip(ImageConfig::Raw::Orientation::normal);
     settings.set_demosaic(ImageConfig::Raw::DemosaicAlgorithm::amaze);
     settings.set_color_space(ImageConfig::Raw::RawColorSpace::prophoto_linear);
     settings.set_highlight_mode(ImageConfig::Raw::HighlightMode::blend);
@@ -135,41 +1418,256 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::loadRawFile(std::st
     settings.set_use_camera_wb(true);
     settings.set_fbdd_noiserd(ImageConfig::Raw::FbddNoiseRd::light);
     settings.set_camera_matrix(ImageConfig::Raw::CameraMatrixMode::always);
+    return settings;
+}
 
-    OIIO::ImageSpec config;
-    config.attribute("raw:Demosaic", settings.get_demosaic_string());
-    config.attribute("raw:ColorSpace", settings.get_color_space_string());
-    config.attribute("raw:HighlightMode", settings.get_highlight_mode_value());
-    config.attribute("raw:balance_clamped", static_cast<int>(settings.get_balance_clamped()));
-    config.attribute("raw:use_camera_matrix", settings.get_camera_matrix_value());
-    config.attribute("raw:use_camera_wb", static_cast<int>(settings.get_use_camera_wb()));
-    config.attribute("raw:use_auto_wb", static_cast<int>(settings.get_use_auto_wb()));
-    config.attribute("raw:fbdd_noiserd", settings.get_fbdd_noiserd_value());
+int SourceManager::rawDecodeThreads(const ImageConfig::Raw::RawSettings& settings) noexcept
+{
+    const auto& pool = Workers::ComputePool::instance();
+    std::size_t threads { std::max<std::size_t>(1, pool.concurrency()) };
+
+    // The share of the lane the decode runs in: a lane capped to n helpers computes on n + 1 threads
+    const auto priority { Workers::EngineScheduler::currentPriority().value_or(Workers::TaskPriority::Interactive) };
+    if (const std::size_t cap { pool.laneCap(priority) }; cap != 0) {
+        threads = std::min(threads, cap + 1);
+    }
+    if (const int requested { settings.get_decode_threads() }; requested > 0) {
+        threads = std::min(threads, static_cast<std::size_t>(requested));
+    }
+    return static_cast<int>(threads);
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+SourceManager::loadRawFile(std::string_view path, ImageConfig::Raw::RawQuality quality) const
+{
+    const bool draft { quality == ImageConfig::Raw::RawQuality::draft };
+    spdlog::debug("[SourceManager::loadRawFile]: Processing RAW file ({}): {}", draft ? "draft" : "full quality", path);
+
+    if (Config::AppConfig::instance().getRawDemosaicEngine() == ImageConfig::Raw::RawDemosaicEngine::halide) {
+        if (auto demosaiced = demosaicResident(path, quality)) {
+            return demosaiced;
+        }
+        spdlog::debug("[SourceManager::loadRawFile]: No Halide demosaic for '{}', using LibRaw", path);
+    }
 
     // ============================================================
-    // Load via OIIO ImageCache
+    // Decode camera-native into RGBA_F32
     // ============================================================
-    auto buf_result = loadImageBuffer(path, &config);
+    const ImageConfig::Raw::RawSettings settings { rawSettings(quality) };
+    const int threads { rawDecodeThreads(settings) };
+    const ScopedRawDecodeThreads decode_threads(threads);
+
+    const OIIO::ImageSpec config { rawDecoderConfig(settings) };
+    auto buf_result = loadImageBuffer(path, &config, nullptr, threads);
     if (!buf_result) {
         spdlog::error("[SourceManager::loadRawFile]: Failed to load RAW file '{}': {}", path, buf_result.error());
         return std::unexpected(buf_result.error());
     }
 
     // ============================================================
-    // Convert and store
+    // Keep the white balance and matrix for the pipeline, or develop in the decoder
     // ============================================================
-    m_current_path = path;
-    auto result { convertToRgbaInternal(std::move(buf_result.value())) };
+    if (auto profile = cameraProfileOf(buf_result->spec())) {
+        buf_result->specmod().attribute(std::string(Operations::CameraProfile::k_metadata_key), profile->format());
+    } else {
+        spdlog::warn("[SourceManager::loadRawFile]: No camera profile for '{}', white balance baked in the decode", path);
+        const OIIO::ImageSpec developed_config { rawDecoderConfig(developedRawSettings(quality)) };
+        buf_result = loadImageBuffer(path, &developed_config, nullptr, threads);
+        if (!buf_result) {
+            spdlog::error("[SourceManager::loadRawFile]: Failed to load RAW file '{}': {}", path, buf_result.error());
+            return std::unexpected(buf_result.error());
+        }
+    }
+
+    spdlog::debug("[SourceManager::loadRawFile]: Decoded '{}': {}x{} RGBA_F32 ({} threads)",
+                  path, buf_result->spec().width, buf_result->spec().height, threads);
+
+    return buf_result;
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+SourceManager::demosaicResident(std::string_view path, ImageConfig::Raw::RawQuality quality) const
+{
+    CM_TRACE_SCOPE("io", "SourceManager::demosaicResident");
+    const bool draft { quality == ImageConfig::Raw::RawQuality::draft };
 
-    if (result) {
-        spdlog::info("[SourceManager::loadRawFile]: Loaded '{}': {}x{} RGBA_F32",
-                     path, m_image_buf->spec().width, m_image_buf->spec().height);
+    // ============================================================
+    // The resident mosaic, or read the file once
+    // ============================================================
+    std::shared_ptr<const ResidentMosaic> resident;
+    {
+        std::lock_guard lock(m_mosaic_mutex);
+        const auto it = std::find_if(m_resident_mosaics.begin(), m_resident_mosaics.end(),
+                                     [path](const auto& entry) { return entry->m_path == path; });
+        if (it != m_resident_mosaics.end()) {
+            resident = *it;
+            m_resident_mosaics.erase(it);
+            m_resident_mosaics.push_front(resident);
+        }
     }
 
-    return result;
+    if (!resident) {
+        auto read { readRawMosaic(path) };
+        if (!read) {
+            return std::unexpected(read.error());
+        }
+        resident = std::make_shared<const ResidentMosaic>(std::move(read.value()));
+
+        std::lock_guard lock(m_mosaic_mutex);
+        m_resident_mosaics.push_front(resident);
+        if (m_resident_mosaics.size() > k_resident_mosaics) {
+            m_resident_mosaics.pop_back();
+        }
+    }
+
+    // ============================================================
+    // Camera-native RGBA_F32 with the file metadata, like a LibRaw decode
+    // ============================================================
+    const ImageProcessing::RawMosaic& mosaic { resident->m_mosaic };
+    const Common::ImageDim width { draft ? mosaic.m_width / 2 : mosaic.m_width };
+    const Common::ImageDim height { draft ? mosaic.m_height / 2 : mosaic.m_height };
+
+    OIIO::ImageSpec spec(static_cast<int>(width), static_cast<int>(height), 4, OIIO::TypeDesc::FLOAT);
+    spec.extra_attribs = resident->m_metadata;
+    spec.alpha_channel = 3;
+
+    const auto profile { cameraProfileOf(spec) };
+    if (!profile) {
+        spdlog::debug("[SourceManager::demosaicResident]: No camera profile for '{}'", path);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+    spec.attribute(std::string(Operations::CameraProfile::k_metadata_key), profile->format());
+
+    OIIO::ImageBuf buf(spec);
+    Halide::Buffer<float> output { ImageProcessing::wrapInterleaved(static_cast<float*>(buf.localpixels()),
+                                                                    spec.width, spec.height, 4) };
+
+    const Halide::Target target { Config::AppConfig::hasGpuHalideTarget()
+                                      ? Config::AppConfig::getHalideTarget(Common::MemoryType::GPU_MEMORY)
+                                      : Config::AppConfig::getHalideTarget(Common::MemoryType::CPU_RAM) };
+    {
+        std::lock_guard lock(m_mosaic_mutex);
+        if (auto demosaiced = m_demosaic.run(mosaic, output, draft, target); !demosaiced) {
+            return std::unexpected(demosaiced.error());
+        }
+    }
+
+    spdlog::debug("[SourceManager::demosaicResident]: Demosaiced '{}' ({}): {}x{} RGBA_F32",
+                  path, draft ? "half size" : "full size", spec.width, spec.height);
+    return buf;
+}
+
+std::expected<SourceManager::ResidentMosaic, ErrorHandling::CoreError>
+SourceManager::readRawMosaic(std::string_view path)
+{
+    CM_TRACE_SCOPE("io", "SourceManager::readRawMosaic");
+
+    // LibRaw unpacks the sensor data and stops there: no scaling, demosaic or color conversion
+    // The unpacking is the part LibRaw parallelizes (tiles of lossless DNG, slices of CR3/NEF)
+    const int threads { rawDecodeThreads(rawSettings(ImageConfig::Raw::RawQuality::full)) };
+    const ScopedRawDecodeThreads decode_threads(threads);
+
+    OIIO::ImageSpec config;
+    config.attribute("raw:Demosaic", "none");
+    auto in { OIIO::ImageInput::open(std::string(path), &config) };
+    if (!in) {
+        spdlog::error("[SourceManager::readRawMosaic]: Failed to open '{}': {}", path, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    in->threads(threads);
+
+    const OIIO::ImageSpec& spec { in->spec() };
+    const auto pattern { cfaPatternOf(spec) };
+    if (spec.nchannels != 1 || !pattern) {
+        spdlog::debug("[SourceManager::readRawMosaic]: '{}' has no Bayer mosaic", path);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    ResidentMosaic resident;
+    resident.m_path = path;
+    resident.m_metadata = spec.extra_attribs;
+
+    ImageProcessing::RawMosaic& mosaic { resident.m_mosaic };
+    mosaic.m_width = static_cast<Common::ImageDim>(spec.width);
+    mosaic.m_height = static_cast<Common::ImageDim>(spec.height);
+    mosaic.m_pattern = *pattern;
+
+    // Levels in sample units; without them, the full range of the stored bit depth
+    const int bits { std::clamp(spec.get_int_attribute("oiio:BitsPerSample", 16), 8, 16) };
+    mosaic.m_black_level = meanAttribute(spec, "raw:black_level", 0.0f);
+    mosaic.m_white_level = meanAttribute(spec, "raw:white_level", static_cast<float>((1 << bits) - 1));
+
+    mosaic.m_data.resize(static_cast<std::size_t>(mosaic.m_width) * mosaic.m_height);
+    if (!in->read_image(0, 0, 0, 1, OIIO::TypeDesc::UINT16, mosaic.m_data.data())) {
+        spdlog::error("[SourceManager::readRawMosaic]: Failed to read '{}': {}", path, in->geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    in->close();
+
+    if (!mosaic.isValid()) {
+        spdlog::warn("[SourceManager::readRawMosaic]: Unusable mosaic levels in '{}' (black {}, white {})",
+                     path, mosaic.m_black_level, mosaic.m_white_level);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    spdlog::debug("[SourceManager::readRawMosaic]: Read the {}x{} mosaic of '{}'", mosaic.m_width, mosaic.m_height, path);
+    return resident;
 }
 
-std::expected<void, ErrorHandling::CoreError> SourceManager::loadHeicFile(std::string_view path)
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> SourceManager::loadRawPreview(std::string_view path) const
+{
+    spdlog::debug("[SourceManager::loadRawPreview]: Extracting embedded preview: {}", path);
+
+    // ============================================================
+    // Open the container only: the thumbnail is read without unpacking the sensor data
+    // ============================================================
+    auto in { OIIO::ImageInput::open(std::string(path)) };
+    if (!in) {
+        spdlog::error("[SourceManager::loadRawPreview]: Failed to open '{}': {}", path, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    OIIO::ImageBuf thumbnail;
+    if (!in->get_thumbnail(thumbnail, 0) || !thumbnail.initialized()) {
+        spdlog::debug("[SourceManager::loadRawPreview]: '{}' has no embedded preview", path);
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+    in->close();
+
+    // ============================================================
+    // Convert to RGBA_F32 in one pass (the thumbnail is small and 8-bit)
+    // ============================================================
+    auto rgba_result { convertToRgbaInternal(thumbnail) };
+    if (!rgba_result) {
+        return std::unexpected(rgba_result.error());
+    }
+    OIIO::ImageBuf& float_buf { *rgba_result };
+
+    // ============================================================
+    // Convert to linear (camera previews are sRGB JPEGs)
+    // ============================================================
+
+    auto [is_linear, cs_name] = Utils::analyzeColorSpace(float_buf.spec());
+    if (cs_name.empty()) {
+        float_buf.specmod().attribute("oiio:ColorSpace", "sRGB");
+        is_linear = false;
+    }
+
+    if (!is_linear) {
+        auto conversion { Utils::transformToColorSpace(float_buf, "lin_rec709_scene") };
+        if (!conversion) {
+            spdlog::error("[SourceManager::loadRawPreview]: Color space conversion failed for '{}': {}", path, conversion.error());
+            return std::unexpected(conversion.error());
+        }
+    }
+
+    spdlog::debug("[SourceManager::loadRawPreview]: Decoded preview of '{}': {}x{} RGBA_F32",
+                  path, float_buf.spec().width, float_buf.spec().height);
+
+    return rgba_result;
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> SourceManager::loadHeicFile(std::string_view path) const
 {
     spdlog::debug("[SourceManager::loadHeicFile]: Processing HEIC file: {}", path);
 
@@ -183,7 +1681,19 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::loadHeicFile(std::s
     config.attribute("oiio:UnassociatedAlpha", settings.get_unassociated_alpha_value());
 
     // ============================================================
-    // Load via OIIO ImageCache
+    // Fast path: 8/10-bit sRGB decoded, linearized and expanded in one pass
+    // ============================================================
+    if (auto linear = loadSrgbLinearized(path, &config);
+        linear || linear.error() != ErrorHandling::CoreError::UnsupportedFormat) {
+        if (linear) {
+            spdlog::debug("[SourceManager::loadHeicFile]: Decoded '{}': {}x{} linear RGBA_F32",
+                          path, linear->spec().width, linear->spec().height);
+        }
+        return linear;
+    }
+
+    // ============================================================
+    // Decode into RGBA_F32
     // ============================================================
     auto buf_result = loadImageBuffer(path, &config);
     if (!buf_result) {
@@ -205,26 +1715,18 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::loadHeicFile(std::s
         }
 
     }
-    // ============================================================
-    // Convert and store
-    // ============================================================
-    m_current_path = path;
-    auto result { convertToRgbaInternal(std::move(buf_result.value())) };
-
-    if (result) {
-        spdlog::info("[SourceManager::loadHeicFile]: Loaded '{}': {}x{} RGBA_F32",
-                     path, m_image_buf->spec().width, m_image_buf->spec().height);
-    }
+    spdlog::debug("[SourceManager::loadHeicFile]: Decoded '{}': {}x{} RGBA_F32",
+                  path, buf_result->spec().width, buf_result->spec().height);
 
-    return result;
+    return buf_result;
 }
 
-std::expected<void, ErrorHandling::CoreError> SourceManager::loadStandardFile(std::string_view path)
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> SourceManager::loadStandardFile(std::string_view path) const
 {
     spdlog::debug("[SourceManager::loadStandardFile]: Processing standard image: {}", path);
 
     // ============================================================
-    // Load via OIIO ImageCache (no special config)
+    // Decode into RGBA_F32 (no special config)
     // ============================================================
     auto buf_result = loadImageBuffer(path, nullptr);
     if (!buf_result) {
@@ -251,57 +1753,166 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::loadStandardFile(st
                       is_linear, cs_name);
     }
 
+    spdlog::debug("[SourceManager::loadStandardFile]: Decoded '{}': {}x{} RGBA_F32",
+                  path, buf_result->spec().width, buf_result->spec().height);
+
+    return buf_result;
+}
+
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
+SourceManager::loadImageBuffer(std::string_view path, const OIIO::ImageSpec* config,
+                               OIIO::Filesystem::IOProxy* proxy, int threads) const
+{
+    // ImageInput::open applies the decoder attributes (RAW, HEIF) when a config is given
+    const auto read_ahead { proxy ? nullptr : readAhead(path) };
+    if (read_ahead) {
+        proxy = &read_ahead->m_reader;
+    }
+    auto in { OIIO::ImageInput::open(std::string(path), config, proxy) };
+    if (!in && proxy) {
+        // The decoder reads files only
+        in = OIIO::ImageInput::open(std::string(path), config);
+    }
+    if (!in) {
+        spdlog::error("[SourceManager::loadImageBuffer]: Failed to open '{}': {}", path, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    if (threads > 0) {
+        in->threads(threads);
+    }
+
     // ============================================================
-    // Convert and store
+    // Allocate the final RGBA_F32 storage (the file metadata is kept)
     // ============================================================
-    m_current_path = path;
-    auto result = convertToRgbaInternal(std::move(buf_result.value()));
+    const OIIO::ImageSpec& file_spec { in->spec() };
+    const int src_ch { file_spec.nchannels };
+    const int read_ch { std::min(src_ch, 4) };
+
+    OIIO::ImageSpec rgba_spec { file_spec };
+    rgba_spec.nchannels = 4;
+    rgba_spec.set_format(OIIO::TypeDesc::FLOAT);
+    rgba_spec.channelformats.clear();
+    rgba_spec.default_channel_names();
+    rgba_spec.alpha_channel = 3;
+
+    OIIO::ImageBuf buf(rgba_spec);
+
+    // ============================================================
+    // Decode straight into it: the file channels land in the first slots of each pixel
+    // ============================================================
+    constexpr OIIO::stride_t pixel_stride { 4 * sizeof(float) };
+    const OIIO::stride_t row_stride { pixel_stride * rgba_spec.width };
 
-    if (result) {
-        spdlog::info("[SourceManager::loadStandardFile]: Loaded '{}': {}x{} RGBA_F32",
-                     path, m_image_buf->spec().width, m_image_buf->spec().height);
+    if (!in->read_image(0, 0, 0, read_ch, OIIO::TypeDesc::FLOAT, buf.localpixels(), pixel_stride, row_stride)) {
+        spdlog::error("[SourceManager::loadImageBuffer]: Failed to read '{}': {}", path, in->geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
     }
+    in->close();
 
-    return result;
+    expandToRgba(static_cast<float*>(buf.localpixels()),
+                 static_cast<std::size_t>(rgba_spec.width) * static_cast<std::size_t>(rgba_spec.height), src_ch);
+
+    spdlog::debug("[SourceManager::loadImageBuffer]: {}x{} ({} channels) decoded to RGBA_F32",
+                  rgba_spec.width, rgba_spec.height, src_ch);
+    return buf;
 }
 
 std::expected<OIIO::ImageBuf, ErrorHandling::CoreError>
-SourceManager::loadImageBuffer(std::string_view path, const OIIO::ImageSpec* config)
+SourceManager::loadSrgbLinearized(std::string_view path, const OIIO::ImageSpec* config) const
 {
-    if (config)
-    {
-        // Config path: ImageInput::open applies attributes (RAW, HEIF)
-        auto in { OIIO::ImageInput::open(std::string(path), config) };
-        if (!in) {
-            spdlog::error("[SourceManager::loadImageBuffer]: Failed to open '{}': {}", path, OIIO::geterror());
-            return std::unexpected(ErrorHandling::CoreError::DecodingError);
-        }
+    CM_TRACE_SCOPE("color", "SourceManager::loadSrgbLinearized");
+
+    const auto read_ahead { readAhead(path) };
+    auto in { OIIO::ImageInput::open(std::string(path), config, read_ahead ? &read_ahead->m_reader : nullptr) };
+    if (!in && read_ahead) {
+        // The decoder reads files only
+        in = OIIO::ImageInput::open(std::string(path), config);
+    }
+    if (!in) {
+        spdlog::error("[SourceManager::loadSrgbLinearized]: Failed to open '{}': {}", path, OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    // ============================================================
+    // Only sRGB-encoded integer samples of a single type take the table path
+    // ============================================================
+    const OIIO::ImageSpec& file_spec { in->spec() };
+    const OIIO::TypeDesc sample_type { file_spec.format };
+    const std::span<const float> table { Utils::srgbToLinearTable(sample_type) };
+    const auto [is_linear, cs_name] = Utils::analyzeColorSpace(file_spec);
+
+    if (table.empty() || !file_spec.channelformats.empty() || !Utils::isSrgbToken(cs_name)) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    // ============================================================
+    // Allocate the final linear RGBA_F32 storage (the file metadata is kept)
+    // ============================================================
+    const int width { file_spec.width };
+    const int height { file_spec.height };
+    const int read_ch { std::min(file_spec.nchannels, 4) };
 
-        OIIO::ImageSpec float_spec { in->spec() };
-        float_spec.set_format(OIIO::TypeDesc::FLOAT);
+    OIIO::ImageSpec rgba_spec { file_spec };
+    rgba_spec.nchannels = 4;
+    rgba_spec.set_format(OIIO::TypeDesc::FLOAT);
+    rgba_spec.channelformats.clear();
+    rgba_spec.default_channel_names();
+    rgba_spec.alpha_channel = 3;
+    rgba_spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
 
-        OIIO::ImageBuf buf(float_spec);
+    OIIO::ImageBuf buf(rgba_spec);
+    float* const pixels { static_cast<float*>(buf.localpixels()) };
 
-        if (!in->read_image(0, 0, 0, -1, OIIO::TypeDesc::FLOAT, buf.localpixels())) {
-            spdlog::error("[SourceManager::loadImageBuffer]: Failed to read '{}': {}", path, in->geterror());
+    // ============================================================
+    // Read a band in the file's sample type, then decode its rows in parallel
+    // ============================================================
+    const std::size_t row_bytes { static_cast<std::size_t>(width) * read_ch * sample_type.size() };
+    std::vector<std::byte> band(row_bytes * k_linearize_band_rows);
+    const float alpha_scale { 1.0f / static_cast<float>(table.size() - 1) };
+
+    for (int band_begin = 0; band_begin < height; band_begin += k_linearize_band_rows) {
+        const int band_end { std::min(height, band_begin + k_linearize_band_rows) };
+        if (!in->read_scanlines(0, 0, band_begin, band_end, 0, 0, read_ch, sample_type, band.data())) {
+            spdlog::error("[SourceManager::loadSrgbLinearized]: Failed to read '{}': {}", path, in->geterror());
             return std::unexpected(ErrorHandling::CoreError::DecodingError);
         }
 
-        in->close();
-        return buf;
+        OIIO::parallel_for(band_begin, band_end, [&](int64_t y) {
+            const std::byte* src { band.data() + static_cast<std::size_t>(y - band_begin) * row_bytes };
+            float* dst { pixels + static_cast<std::size_t>(y) * static_cast<std::size_t>(width) * 4 };
+            if (table.size() == 256) {
+                linearizeRow(reinterpret_cast<const std::uint8_t*>(src), dst, width, read_ch, table, alpha_scale);
+            } else {
+                linearizeRow(reinterpret_cast<const std::uint16_t*>(src), dst, width, read_ch, table, alpha_scale);
+            }
+        });
     }
+    in->close();
 
-    // Standard path: ImageCache
-    OIIO::ImageBuf buf(std::string(path), 0, 0, s_global_cache_ptr);
-    if (!buf.read(0, 0, true, OIIO::TypeDesc::FLOAT)) {
-        spdlog::error("[SourceManager::loadImageBuffer]: Failed to read '{}': {}", path, buf.geterror());
-        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    spdlog::debug("[SourceManager::loadSrgbLinearized]: {}x{} ({} channels, {}) decoded to linear RGBA_F32",
+                  width, height, file_spec.nchannels, cs_name);
+    return buf;
+}
+
+void SourceManager::expandToRgba(float* pixels, std::size_t pixel_count, int source_channels) noexcept
+{
+    if (source_channels >= 4) {
+        return;
     }
 
-    return buf;
+    float* pixel { pixels };
+    for (std::size_t i = 0; i < pixel_count; ++i, pixel += 4)
+    {
+        switch (source_channels)
+        {
+        case 1:  pixel[1] = pixel[0]; pixel[2] = pixel[0]; pixel[3] = 1.0f; break;
+        case 2:  pixel[3] = pixel[1]; pixel[1] = pixel[0]; pixel[2] = pixel[0]; break;
+        default: pixel[3] = 1.0f; break;
+        }
+    }
 }
 
-std::expected<void, ErrorHandling::CoreError> SourceManager::convertToRgbaInternal(OIIO::ImageBuf&& src_buf)
+std::expected<OIIO::ImageBuf, ErrorHandling::CoreError> SourceManager::convertToRgbaInternal(const OIIO::ImageBuf& src_buf)
 {
     // ============================================================
     // Get dimensions
@@ -313,9 +1924,11 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::convertToRgbaIntern
     spdlog::debug("[SourceManager::convertToRgbaInternal]: {}x{} ({} channels)", w, h, src_ch);
 
     // ============================================================
-    // Convert to RGBA_F32
+    // Convert to RGBA_F32 (the pixel type is converted along the way)
     // ============================================================
     OIIO::ImageSpec target_spec(static_cast<int>(w), static_cast<int>(h), 4, OIIO::TypeDesc::FLOAT);
+    target_spec.extra_attribs = src_buf.spec().extra_attribs;
+    target_spec.alpha_channel = 3;
     OIIO::ImageBuf rgba_buf(target_spec);
 
     std::vector<int> channel_order = {0, 1, 2, 3};
@@ -334,12 +1947,7 @@ std::expected<void, ErrorHandling::CoreError> SourceManager::convertToRgbaIntern
         return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
     }
 
-    // ============================================================
-    // Store final buffer
-    // ============================================================
-    m_image_buf = std::make_unique<OIIO::ImageBuf>(std::move(rgba_buf));
-
-    return {};
+    return rgba_buf;
 }
 
 void SourceManager::unload()
@@ -350,11 +1958,21 @@ void SourceManager::unload()
 
 void SourceManager::unloadInternal()
 {
-    if (m_image_buf && m_image_buf->initialized()) {
+    if (isLoaded_unsafe()) {
         spdlog::debug("[SourceManager::unloadInternal]: Unloading '{}'", m_current_path);
     }
     m_image_buf.reset();
+    m_source_buf.reset();
+    m_tiled_buf.reset();
+    m_tiled_channels = 0;
+    m_tiled_color_space.clear();
     m_current_path.clear();
+    m_is_preview = false;
+    m_refinement_queued = false;
+    m_width.store(0, std::memory_order_relaxed);
+    m_height.store(0, std::memory_order_relaxed);
+    m_channels.store(0, std::memory_order_relaxed);
+    m_orientation.store(Common::ImageOrientation::Normal, std::memory_order_relaxed);
 }
 
 bool SourceManager::isLoaded() const
@@ -365,28 +1983,36 @@ bool SourceManager::isLoaded() const
 
 bool SourceManager::isLoaded_unsafe() const
 {
-    return m_image_buf && m_image_buf->initialized();
+    const OIIO::ImageBuf* buf = buffer_unsafe();
+    return buf && buf->initialized();
 }
 
 Common::ImageDim SourceManager::width() const noexcept
 {
-    return m_image_buf ? static_cast<Common::ImageDim>(m_image_buf->spec().width) : 0;
+    return m_width.load(std::memory_order_relaxed);
 }
 
 Common::ImageDim SourceManager::height() const noexcept
 {
-    return m_image_buf ? static_cast<Common::ImageDim>(m_image_buf->spec().height) : 0;
+    return m_height.load(std::memory_order_relaxed);
 }
 
 Common::ImageChan SourceManager::channels() const noexcept
 {
-    return m_image_buf ? static_cast<Common::ImageChan>(m_image_buf->spec().nchannels) : 0;
+    return m_channels.load(std::memory_order_relaxed);
+}
+
+Common::ImageOrientation SourceManager::orientation() const noexcept
+{
+    return m_orientation.load(std::memory_order_relaxed);
 }
 
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
 SourceManager::getTile(Common::ImageDim x, Common::ImageDim y,
                        Common::ImageDim width, Common::ImageDim height)
 {
+    CM_TRACE_SCOPE("io", "SourceManager::getTile");
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (!isLoaded_unsafe()) {
@@ -408,11 +2034,18 @@ SourceManager::getTile(Common::ImageDim x, Common::ImageDim y,
 
     // Allocate result
     const size_t data_size { static_cast<size_t>(width) * static_cast<size_t>(height) * 4 };
-    std::vector<float> data(data_size);
+    Common::PixelBuffer data(data_size);
 
-    if (!m_image_buf->get_pixels(roi, OIIO::TypeDesc::FLOAT, data.data())) {
-        spdlog::warn("[SourceManager::getTile]: get_pixels failed: {}", m_image_buf->geterror());
-        return std::unexpected(ErrorHandling::CoreError::IOError);
+    if (m_tiled_buf && !m_image_buf) {
+        if (auto read = readTiled_unsafe(x, y, width, height, data.data()); !read) {
+            return std::unexpected(read.error());
+        }
+    } else {
+        const OIIO::ImageBuf* buf = buffer_unsafe();
+        if (!buf->get_pixels(roi, OIIO::TypeDesc::FLOAT, data.data())) {
+            spdlog::warn("[SourceManager::getTile]: get_pixels failed: {}", buf->geterror());
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
     }
 
     // Create ImageRegion
@@ -456,11 +2089,145 @@ SourceManager::setTile(const Common::ImageRegion& tile)
         0, 4
         );
 
-    if (!m_image_buf->set_pixels(roi, OIIO::TypeDesc::FLOAT, tile.m_data.data())) {
-        spdlog::error("[SourceManager::setTile] set_pixels failed: {}", m_image_buf->geterror());
+    OIIO::ImageBuf* buf = writableBuffer_unsafe();
+    if (!buf) {
         return std::unexpected(ErrorHandling::CoreError::IOError);
     }
+    if (!buf->set_pixels(roi, OIIO::TypeDesc::FLOAT, tile.m_data.data())) {
+        spdlog::error("[SourceManager::setTile] set_pixels failed: {}", buf->geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::setTile(const Common::ImageView& tile, Common::ImageCoord x, Common::ImageCoord y)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!isLoaded_unsafe()) {
+        spdlog::warn("[SourceManager::setTile] No image loaded");
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+    }
+
+    // OIIO takes pixel and row strides, but channels must be adjacent
+    if (!tile.isValid() || tile.m_channels != 4 || tile.m_c_stride != 1) {
+        spdlog::error("[SourceManager::setTile] Invalid view: expected RGBA float with adjacent channels");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    OIIO::ROI roi(
+        static_cast<int>(x), static_cast<int>(x + static_cast<Common::ImageCoord>(tile.m_width)),
+        static_cast<int>(y), static_cast<int>(y + static_cast<Common::ImageCoord>(tile.m_height)),
+        0, 1,
+        0, 4
+        );
+
+    const auto x_stride = static_cast<OIIO::stride_t>(tile.m_x_stride * sizeof(float));
+    const auto y_stride = static_cast<OIIO::stride_t>(tile.m_y_stride * sizeof(float));
+
+    OIIO::ImageBuf* buf = writableBuffer_unsafe();
+    if (!buf) {
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    if (!buf->set_pixels(roi, OIIO::TypeDesc::FLOAT, tile.m_data.data(), x_stride, y_stride)) {
+        spdlog::error("[SourceManager::setTile] set_pixels failed: {}", buf->geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    return {};
+}
+
+/**
+ * @brief Adopted pixels and the ImageBuf wrapping them: the buffer lives as long as the pixels.
+ */
+struct AdoptedPixels {
+    std::shared_ptr<const Common::ImageRegion> m_pixels;
+    OIIO::ImageBuf m_buffer;
+};
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::adoptPixels(std::shared_ptr<const Common::ImageRegion> pixels)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const OIIO::ImageBuf* current { buffer_unsafe() };
+    if (!current) {
+        spdlog::warn("[SourceManager::adoptPixels] No image loaded");
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+    }
+
+    if (!pixels || !pixels->isValid() || pixels->m_channels != 4
+        || pixels->m_width != m_width.load(std::memory_order_relaxed)
+        || pixels->m_height != m_height.load(std::memory_order_relaxed)) {
+        spdlog::error("[SourceManager::adoptPixels] Expected RGBA float pixels of the loaded image's size");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    // The file metadata over the adopted pixels (linear, like every decoded source)
+    OIIO::ImageSpec spec(static_cast<int>(pixels->m_width), static_cast<int>(pixels->m_height), 4, OIIO::TypeDesc::FLOAT);
+    spec.extra_attribs = current->spec().extra_attribs;
+    spec.alpha_channel = 3;
+    if (m_tiled_buf && !m_image_buf && !m_tiled_color_space.empty()) {
+        spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+    }
+
+    // Wrapped, not copied: OIIO never writes a read-only source (setTile copies it first)
+    auto adopted { std::make_shared<AdoptedPixels>() };
+    adopted->m_pixels = std::move(pixels);
+    adopted->m_buffer.reset(spec, const_cast<float*>(adopted->m_pixels->m_data.data()));
+
+    m_source_buf = DecodedImageCache::Buffer(adopted, &adopted->m_buffer);
+    m_image_buf.reset();
+    m_tiled_buf.reset();
+    m_tiled_channels = 0;
+    m_tiled_color_space.clear();
+    m_channels.store(4, std::memory_order_relaxed);
+
+    spdlog::debug("[SourceManager::adoptPixels] {}x{} pixels adopted for '{}'", spec.width, spec.height, m_current_path);
+    return {};
+}
+
+std::expected<void, ErrorHandling::CoreError>
+SourceManager::shareLoadedImage(const ISourceManager& other)
+{
+    const auto* source { dynamic_cast<const SourceManager*>(&other) };
+    if (source == this) {
+        return {};
+    }
+    if (!source) {
+        spdlog::warn("[SourceManager::shareLoadedImage]: Only another SourceManager can share its decode");
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    // Taken from the other source first: the two mutexes are never held together
+    DecodedImageCache::Buffer buffer;
+    std::string path;
+    bool is_preview { false };
+    {
+        std::lock_guard<std::mutex> lock(source->m_mutex);
+        if (!source->isLoaded_unsafe()) {
+            spdlog::warn("[SourceManager::shareLoadedImage]: No image loaded to share");
+            return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+        }
+        // A private copy (pixels written by `setTile`) or a tile-backed image has no shared decode
+        if (source->m_image_buf || !source->m_source_buf) {
+            spdlog::debug("[SourceManager::shareLoadedImage]: '{}' holds no shareable decode", source->m_current_path);
+            return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+        }
+        buffer = source->m_source_buf;
+        path = source->m_current_path;
+        is_preview = source->m_is_preview;
+    }
+
+    cancelLoad();
+    if (!install(path, std::move(buffer), {}, is_preview)) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
 
+    spdlog::debug("[SourceManager::shareLoadedImage]: '{}' shared ({}x{})", path,
+                  m_width.load(std::memory_order_relaxed), m_height.load(std::memory_order_relaxed));
     return {};
 }
 
@@ -468,11 +2235,12 @@ std::optional<std::string> SourceManager::getMetadata(std::string_view key) cons
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    if (!m_image_buf) {
+    const OIIO::ImageBuf* buf = buffer_unsafe();
+    if (!buf) {
         return std::nullopt;
     }
 
-    const auto& spec { m_image_buf->spec() };
+    const auto& spec { buf->spec() };
     const auto* attr { spec.find_attribute(std::string(key)) };
 
     return attr ? std::optional{attr->get_string()} : std::nullopt;
@@ -8,21 +8,40 @@
 #include "managers/state_image_manager.h"
 
 #include "image_processing/factories/working_image_factory.h"
+#include "pipeline/histogram_stage.h"
 #include "pipeline/pipeline_context.h"
+#include "pipeline/variant_renderer.h"
 #include "workers/worker_context.h"
 #include "image_processing/working_image_context.h"
 #include "managers/source_manager.h"
+#include "utils/image_conversion.h"
+#include "operations/color_operations/camera_profile.h"
+#include "common/metrics/core_metrics.h"
+#include "common/trace/tracer.h"
+#include "config/app_config.h"
+#include "core_initialization.h"
 
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <utility>
 
 namespace CaptureMoment::Core::Managers {
 
-StateImageManager::StateImageManager()
+StateImageManager::StateImageManager(std::shared_ptr<Workers::EngineScheduler> scheduler)
     : m_pipeline_context(std::make_unique<Pipeline::PipelineContext>())
-    , m_worker_context(std::make_unique<Workers::WorkerContext>())
+    , m_worker_context(std::make_unique<Workers::WorkerContext>(std::move(scheduler)))
     , m_working_image_context(std::make_unique<ImageProcessing::WorkingImageContext>())
-    , m_source_manager(std::make_unique<Managers::SourceManager>())
+    , m_proxy_image_context(std::make_unique<ImageProcessing::WorkingImageContext>())
+    , m_source_manager([] {
+          auto source { std::make_unique<Managers::SourceManager>() };
+          // Culling goes back and forth: images leaving the decoded cache stay, compressed
+          source->setKeepsRecentImages(true);
+          return source;
+      }())
+    , m_generation(std::make_shared<Common::CancellationToken::Counter>(0))
+    , m_result_cache(std::make_shared<ResultCache>())
 {
     if (!m_source_manager) {
         spdlog::critical("[StateImageManager::StateImageManager]: Null dependency provided during construction.");
@@ -32,9 +51,17 @@ StateImageManager::StateImageManager()
 
 StateImageManager::~StateImageManager()
 {
-    // Wait for any pending processing to complete before destruction
-    while (m_is_updating) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Stop the running pass early, then wait for it before destruction:
+    // queued tasks reference this manager and its images.
+    m_source_manager->setRefinedCallback({});
+    cancelProcessing();
+    waitForPendingProcessing();
+
+    // Warm-ups still queued are skipped; a running one completes its compilation
+    m_warm_up_generation.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::unique_lock lock(m_warm_up_mutex);
+        m_warm_up_cv.wait(lock, [this] { return m_warm_ups_in_flight == 0; });
     }
     spdlog::debug("[StateImageManager::~StateImageManager]: Destroyed.");
 }
@@ -45,43 +72,263 @@ StateImageManager::~StateImageManager()
 
 bool StateImageManager::loadImage(std::string_view path)
 {
-    // 1. Wait for any pending processing to complete
+    // 1. Edits of the previous image are obsolete: cancel them. The file decodes (or comes
+    // from the decoded-image cache) while the running pass winds down.
+    cancelProcessing();
+    auto loading = m_source_manager->loadFileAsync(path);
     waitForPendingProcessing();
 
-    // 2. Load the file into the INTERNAL SourceManager
-    auto load_result = m_source_manager->loadFile(path);
+    // 2. Wait for the INTERNAL SourceManager to install the file
+    auto load_result = loading.get();
+
+    // Nothing runs now: safe point to switch to a backend benchmarked in the background
+    applyBackgroundBackendDecision();
 
     if (!load_result) {
         spdlog::error("[StateImageManager::loadImage]: Failed to load file '{}': {}", path, static_cast<int>(load_result.error()));
         return false;
     }
 
+    if (!prepareWorkingImageFromSource(path)) {
+        return false;
+    }
+
+    spdlog::info("[StateImageManager::loadImage]: Image '{}' loaded successfully ({}x{}).",
+                 path, m_source_manager->width(), m_source_manager->height());
+
+    return true;
+}
+
+bool StateImageManager::prepareWorkingImageFromSource(std::string_view path)
+{
+    const bool is_preview = m_source_manager->isPreview();
     const Common::ImageDim w = m_source_manager->width();
     const Common::ImageDim h = m_source_manager->height();
     auto tile = m_source_manager->getTile(0, 0, w, h);
 
     if (!tile || !m_working_image_context->prepare(std::move(tile.value()))) {
-        spdlog::error("[StateImageManager::loadImage]: Failed to prepare WorkingImage.");
+        spdlog::error("[StateImageManager::prepareWorkingImageFromSource]: Failed to prepare WorkingImage.");
         return false;
     }
-    // 3. Update State Metadata
+
+    // Identity of the source for the result cache (outside the lock: it inspects the file)
+    const auto source_identity = ResultCache::sourceIdentity(path, is_preview);
+    // Camera-native RAW decodes are developed by the pipeline (see Operations::CameraProfile)
+    auto source_profile = m_source_manager->getMetadata(Operations::CameraProfile::k_metadata_key);
+
     {
-        std::lock_guard lock(m_state_mutex);
-        m_original_image_path = std::string(path);
+        std::lock_guard display_lock(m_display_mutex);
+        m_latest_histogram.reset();
+    }
+
+    // Update State Metadata (a proxy from a previous image is no longer valid)
+    std::lock_guard lock(m_state_mutex);
+    m_original_image_path = std::string(path);
+    m_working_from_preview = is_preview;
+    m_source_identity = source_identity;
+    m_source_profile = std::move(source_profile);
+    m_source_on_disk = true;
+    m_working_result.reset();
+    m_proxy_image_context->release();
+    m_proxy_width = 0;
+    m_proxy_height = 0;
+    m_display_from_proxy.store(false, std::memory_order_release);
+    return true;
+}
+
+std::expected<void, ErrorHandling::CoreError> StateImageManager::shareSourceOf(const StateImageManager& other)
+{
+    if (&other == this) {
+        return {};
     }
 
-    // 4. Clear any pending operations from previous image
+    // The copied state, read as a whole: a concurrent load of `other` changes all of it
+    std::string path;
+    bool is_preview { false };
+    std::optional<std::uint64_t> source_identity;
+    std::optional<std::string> source_profile;
+    bool source_on_disk { false };
     {
-        std::lock_guard lock(m_pending_mutex);
-        m_pending_ops.reset();
+        std::lock_guard lock(other.m_state_mutex);
+        path = other.m_original_image_path;
+        is_preview = other.m_working_from_preview;
+        source_identity = other.m_source_identity;
+        source_profile = other.m_source_profile;
+        source_on_disk = other.m_source_on_disk;
+    }
+    auto original = other.m_working_image_context->getOriginalImage();
+    if (!original || path.empty()) {
+        spdlog::error("[StateImageManager::shareSourceOf]: No image loaded to copy.");
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
     }
 
-    spdlog::info("[StateImageManager::loadImage]: Image '{}' loaded successfully ({}x{}).",
+    cancelProcessing();
+    waitForPendingProcessing();
+
+    if (auto shared = m_source_manager->shareLoadedImage(*other.m_source_manager); !shared) {
+        if (shared.error() != ErrorHandling::CoreError::UnsupportedFormat) {
+            return std::unexpected(shared.error());
+        }
+        // Nothing resident to share: the copy reads the file like any load
+        spdlog::debug("[StateImageManager::shareSourceOf]: '{}' not shareable, loading it.", path);
+        if (!loadImage(path)) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+        return {};
+    }
+
+    if (!m_working_image_context->prepare(std::move(original))) {
+        spdlog::error("[StateImageManager::shareSourceOf]: Failed to prepare WorkingImage.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    std::lock_guard lock(m_state_mutex);
+    m_original_image_path = path;
+    m_working_from_preview = is_preview;
+    m_source_identity = source_identity;
+    m_source_profile = std::move(source_profile);
+    m_source_on_disk = source_on_disk;
+    m_working_result.reset();
+    m_proxy_image_context->release();
+    m_proxy_width = 0;
+    m_proxy_height = 0;
+    m_display_from_proxy.store(false, std::memory_order_release);
+
+    spdlog::info("[StateImageManager::shareSourceOf]: Virtual copy of '{}' ({}x{}).",
                  path, m_source_manager->width(), m_source_manager->height());
+    return {};
+}
+
+std::shared_ptr<Workers::EngineScheduler> StateImageManager::shareScheduler() const noexcept
+{
+    return m_worker_context->shareScheduler();
+}
 
+std::expected<bool, ErrorHandling::CoreError> StateImageManager::adoptRefinedSource(std::string_view path)
+{
+    {
+        std::lock_guard lock(m_state_mutex);
+        if (!m_working_from_preview || m_original_image_path != path) {
+            return false;
+        }
+    }
+
+    if (m_source_manager->isPreview() || m_source_manager->getImageSourcePath() != path) {
+        return false;
+    }
+
+    // Passes on the preview are obsolete: the caller re-applies its operations on the full image
+    cancelProcessing();
+    waitForPendingProcessing();
+
+    if (!prepareWorkingImageFromSource(path)) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    spdlog::info("[StateImageManager::adoptRefinedSource]: Full-quality '{}' adopted ({}x{}).",
+                 path, m_source_manager->width(), m_source_manager->height());
     return true;
 }
 
+bool StateImageManager::isPreviewImage() const
+{
+    std::lock_guard lock(m_state_mutex);
+    return m_working_from_preview;
+}
+
+void StateImageManager::requestFullQualitySource()
+{
+    m_source_manager->requestFullQuality();
+}
+
+std::expected<void, ErrorHandling::CoreError>
+StateImageManager::redevelopRawSource(const ImageConfig::Raw::RawSettings& settings)
+{
+    const std::string path = m_source_manager->getImageSourcePath();
+    if (auto developed = m_source_manager->redevelopRaw(settings); !developed) {
+        return std::unexpected(developed.error());
+    }
+
+    // Passes on the previous development are obsolete: the caller re-applies its operations
+    cancelProcessing();
+    waitForPendingProcessing();
+
+    if (!prepareWorkingImageFromSource(path)) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    // Same file, other pixels: results of the previous development must not match
+    {
+        std::lock_guard lock(m_state_mutex);
+        if (m_source_identity) {
+            *m_source_identity ^= settings.fingerprint();
+        }
+    }
+
+    spdlog::info("[StateImageManager::redevelopRawSource]: '{}' redeveloped ({}x{}).",
+                 path, m_source_manager->width(), m_source_manager->height());
+    return {};
+}
+
+void StateImageManager::setSourceRefinedCallback(ISourceManager::RefinedCallback callback)
+{
+    m_source_manager->setRefinedCallback(std::move(callback));
+}
+
+void StateImageManager::prefetchImages(std::span<const std::string> paths)
+{
+    m_source_manager->prefetch(paths);
+}
+
+void StateImageManager::warmUpPipeline(std::vector<Operations::OperationDescriptor> operations)
+{
+    if (operations.empty()) {
+        return;
+    }
+
+    const std::uint64_t generation { m_warm_up_generation.fetch_add(1, std::memory_order_relaxed) + 1 };
+    {
+        std::lock_guard lock(m_warm_up_mutex);
+        ++m_warm_ups_in_flight;
+    }
+
+    spdlog::debug("[StateImageManager::warmUpPipeline]: Warming up a chain of {} operations.", operations.size());
+
+    // Beside the decode, ahead of the passes of the image still shown
+    m_worker_context->getScheduler().post(Workers::TaskPriority::Refine,
+                                          [this, generation, operations = std::move(operations)]() mutable {
+        if (generation == m_warm_up_generation.load(std::memory_order_relaxed)) {
+            // The structure the requests will have: the profile of a camera-native RAW adds a white balance
+            {
+                std::lock_guard lock(m_state_mutex);
+                Operations::CameraProfile::attachTo(operations, m_source_profile);
+            }
+            m_pipeline_context->getHalideManager().warmUp(std::move(operations));
+        }
+
+        std::lock_guard lock(m_warm_up_mutex);
+        --m_warm_ups_in_flight;
+        m_warm_up_cv.notify_all();
+    });
+}
+
+std::vector<std::expected<ImageMetadata, ErrorHandling::CoreError>>
+StateImageManager::readImageMetadata(std::span<const std::string> paths, const Common::CancellationToken& token) const
+{
+    return m_source_manager->readMetadataBatch(paths, token);
+}
+
+SourceTileCacheStats StateImageManager::getSourceTileCacheStats() const
+{
+    return m_source_manager->tileCacheStats();
+}
+
+std::expected<std::filesystem::path, ErrorHandling::CoreError>
+StateImageManager::dumpPipelineDiagnostics(const std::filesystem::path& directory) const
+{
+    return m_pipeline_context->getHalideManager().dumpDiagnostics(directory);
+}
+
 std::expected<void, ErrorHandling::CoreError> StateImageManager::commitWorkingImageToSource()
 {
     // 1. Retrieve the current working image
@@ -99,20 +346,56 @@ std::expected<void, ErrorHandling::CoreError> StateImageManager::commitWorkingIm
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
     }
 
-    // 2. Export to CPU memory
-    auto cpu_copy_result = working_image_hw->exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("[StateImageManager::commitWorkingImageToSource]: CPU export failed: {}",
-                       ErrorHandling::to_string(cpu_copy_result.error()));
-        return std::unexpected(cpu_copy_result.error());
-    }
+    // 2. The one copy of the commit: the new original, shared by the source and the resident original
+    std::shared_ptr<const Common::ImageRegion> committed;
+    {
+        auto view_result = working_image_hw->exportToCPUView();
+        if (!view_result) {
+            spdlog::error("[StateImageManager::commitWorkingImageToSource]: CPU export failed: {}",
+                           ErrorHandling::to_string(view_result.error()));
+            return std::unexpected(view_result.error());
+        }
 
-    std::unique_ptr<Common::ImageRegion> cpu_copy = std::move(cpu_copy_result.value());
+        // The view is released at the end of this scope, before restoreOriginal() overwrites the working image
+        try {
+            committed = std::make_shared<const Common::ImageRegion>(view_result.value().toImageRegion());
+        } catch (const std::bad_alloc& e) {
+            spdlog::critical("[StateImageManager::commitWorkingImageToSource]: Allocation failed: {}", e.what());
+            return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+        }
+    }
 
-    // 3. Write back to the INTERNAL SourceManager
-    if (!m_source_manager->setTile(*cpu_copy)) {
+    // 3. The INTERNAL SourceManager adopts the pixels (wrapped, not copied)
+    if (auto adopted = m_source_manager->adoptPixels(committed); !adopted) {
         spdlog::error("[StateImageManager::commitWorkingImageToSource]: Write to source failed.");
-        return std::unexpected(ErrorHandling::CoreError::IOError);
+        return std::unexpected(adopted.error());
+    }
+
+    // 4. The committed result becomes the resident original for future edits
+    {
+        std::lock_guard lock(m_state_mutex);
+        if (!m_working_image_context->setOriginal(std::move(committed))
+            || !m_working_image_context->restoreOriginal()) {
+            spdlog::error("[StateImageManager::commitWorkingImageToSource]: Failed to replace resident original.");
+            return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+
+        // Rebuild the proxy from the new original
+        if (m_proxy_image_context->isReady()) {
+            if (auto proxy_result = buildProxy(m_proxy_width, m_proxy_height); !proxy_result) {
+                return proxy_result;
+            }
+        }
+        m_display_from_proxy.store(false, std::memory_order_release);
+
+        // The committed pixels are no longer the file's: results of this source are only kept in memory
+        if (m_source_identity) {
+            m_source_identity = *m_source_identity ^ (0x9E3779B97F4A7C15ull * ++m_commit_count);
+        }
+        m_source_on_disk = false;
+        // The committed pixels are developed: the white balance of later edits is relative
+        m_source_profile.reset();
+        m_working_result.reset();
     }
 
     spdlog::info("[StateImageManager::commitWorkingImageToSource]: Changes committed to source.");
@@ -126,21 +409,78 @@ std::expected<void, ErrorHandling::CoreError> StateImageManager::resetToOriginal
 
     // 2. Block and wait for the operation to complete
     // This allows the caller (PhotoEngine) to assume the image is ready when this returns.
-    bool success = future.get();
+    const Common::ProcessingOutcome outcome = future.get();
+
+    // 3. Convert the outcome to std::expected (a superseding request processes the image instead)
+    switch (outcome) {
+    case Common::ProcessingOutcome::Completed:
+    case Common::ProcessingOutcome::Superseded:
+        return {};
+    case Common::ProcessingOutcome::Cancelled:
+        spdlog::warn("[StateImageManager::resetToOriginal]: Reset cancelled.");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    case Common::ProcessingOutcome::Failed:
+        break;
+    }
 
-    // 3. Convert boolean result to std::expected
-    if (!success) {
-        spdlog::error("[StateImageManager::resetToOriginal]: Processing failed.");
-        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    spdlog::error("[StateImageManager::resetToOriginal]: Processing failed.");
+    return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+}
+
+void StateImageManager::publishParameters(const Operations::ParameterSnapshot& snapshot) noexcept
+{
+    m_parameters.store(snapshot);
+}
+
+void StateImageManager::beginInteraction(std::uint64_t operation_id)
+{
+    std::lock_guard lock(m_pending_mutex);
+    spdlog::debug("[StateImageManager::beginInteraction]: Gesture on operation {}.", operation_id);
+    m_interaction_operation = operation_id;
+}
+
+std::future<Common::ProcessingOutcome> StateImageManager::endInteraction()
+{
+    std::optional<std::vector<Operations::OperationDescriptor>> operations;
+    {
+        std::lock_guard lock(m_pending_mutex);
+        if (!m_interaction_operation) {
+            return {};
+        }
+        m_interaction_operation.reset();
+        operations = std::exchange(m_interaction_operations, std::nullopt);
     }
 
-    return {};
+    if (!operations) {
+        spdlog::debug("[StateImageManager::endInteraction]: Gesture ended without edits.");
+        return {};
+    }
+
+    spdlog::debug("[StateImageManager::endInteraction]: Gesture ended, refining {} operations at full resolution.", operations->size());
+    return submitRequest(ProcessingRequest{std::move(*operations), std::nullopt, false});
+}
+
+bool StateImageManager::isInteracting() const
+{
+    std::lock_guard lock(m_pending_mutex);
+    return m_interaction_operation.has_value();
+}
+
+void StateImageManager::setProcessingTimingsCallback(TimingsCallback callback)
+{
+    std::lock_guard lock(m_pending_mutex);
+    m_timings_callback = std::move(callback);
+}
+
+std::size_t StateImageManager::getQueueDepth() const
+{
+    std::lock_guard lock(m_pending_mutex);
+    return (m_is_updating.load(std::memory_order_relaxed) ? 1 : 0) + (m_pending_request ? 1 : 0);
 }
 
 bool StateImageManager::isUpdatePending() const
 {
-    std::lock_guard lock(m_flag_mutex);
-    return m_is_updating;
+    return m_is_updating.load(std::memory_order_acquire);
 }
 
 std::string StateImageManager::getImageSourcePath() const
@@ -148,148 +488,611 @@ std::string StateImageManager::getImageSourcePath() const
    return m_source_manager->getImageSourcePath();
 }
 
-std::future<bool> StateImageManager::applyOperations(std::vector<Operations::OperationDescriptor>&& ops)
+std::future<Common::ProcessingOutcome> StateImageManager::applyOperations(std::vector<Operations::OperationDescriptor>&& ops)
 {
     spdlog::info("[StateImageManager::applyOperations]: Received {} operations (Move semantics).", ops.size());
+    return submitRequest(ProcessingRequest{std::move(ops), std::nullopt, false});
+}
+
+std::future<Common::ProcessingOutcome> StateImageManager::applyOperations(std::vector<Operations::OperationDescriptor>&& ops,
+                                                     const Common::RegionOfInterest& roi)
+{
+    spdlog::info("[StateImageManager::applyOperations]: Received {} operations for ROI ({},{} {}x{}).",
+                 ops.size(), roi.m_x, roi.m_y, roi.m_width, roi.m_height);
+    return submitRequest(ProcessingRequest{std::move(ops), roi, false});
+}
+
+std::future<Common::ProcessingOutcome> StateImageManager::applyOperationsToProxy(std::vector<Operations::OperationDescriptor>&& ops)
+{
+    spdlog::info("[StateImageManager::applyOperationsToProxy]: Received {} operations.", ops.size());
+
+    if (!m_proxy_image_context->isReady()) {
+        // No proxy prepared: fall back to a full-resolution pass
+        spdlog::debug("[StateImageManager::applyOperationsToProxy]: No proxy prepared, processing full resolution.");
+        return submitRequest(ProcessingRequest{std::move(ops), std::nullopt, false});
+    }
+
+    return submitRequest(ProcessingRequest{std::move(ops), std::nullopt, true});
+}
+
+std::future<Common::ProcessingOutcome>
+StateImageManager::applyOperationsProgressive(std::vector<Operations::OperationDescriptor>&& ops,
+                                              ProgressiveRefinement refinement)
+{
+    spdlog::info("[StateImageManager::applyOperationsProgressive]: Received {} operations ({}x{} display, {} rows per tile).",
+                 ops.size(), refinement.m_display_width, refinement.m_display_height, refinement.m_tile_rows);
+
+    if (!refinement.isValid()) {
+        // Nothing to stream to: plain full-resolution pass
+        spdlog::warn("[StateImageManager::applyOperationsProgressive]: Invalid display size or tile height, processing without refinement.");
+        return submitRequest(ProcessingRequest{std::move(ops), std::nullopt, false});
+    }
+
+    ProcessingRequest request{std::move(ops), std::nullopt, false};
+    request.m_progressive = std::make_shared<const ProgressiveRefinement>(std::move(refinement));
+    return submitRequest(std::move(request));
+}
+
+std::expected<void, ErrorHandling::CoreError>
+StateImageManager::prepareProxy(Common::ImageDim width, Common::ImageDim height)
+{
+    waitForPendingProcessing();
+
+    std::lock_guard lock(m_state_mutex);
+    return buildProxy(width, height);
+}
+
+std::expected<void, ErrorHandling::CoreError>
+StateImageManager::buildProxy(Common::ImageDim width, Common::ImageDim height)
+{
+    auto original = m_working_image_context->getOriginalImage();
+    if (!original) {
+        spdlog::error("[StateImageManager::buildProxy]: No original image loaded.");
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+    }
+
+    if (width == 0 || height == 0) {
+        spdlog::error("[StateImageManager::buildProxy]: Invalid proxy size {}x{}.", width, height);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    // The host's bound on the long edge, keeping the aspect ratio
+    if (const Common::ImageDim max_long_edge { Config::AppConfig::instance().getProxyMaxLongEdge() };
+        max_long_edge != 0 && std::max(width, height) > max_long_edge) {
+        const double scale { static_cast<double>(max_long_edge) / static_cast<double>(std::max(width, height)) };
+        width = std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(std::lround(static_cast<double>(width) * scale)));
+        height = std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(std::lround(static_cast<double>(height) * scale)));
+    }
+
+    // Never upscale: a proxy larger than the source is the source itself
+    width = std::min(width, original->m_width);
+    height = std::min(height, original->m_height);
+
+    auto proxy = Utils::resize_F32(*original, width, height);
+    if (!proxy || !m_proxy_image_context->prepare(std::move(proxy))) {
+        spdlog::error("[StateImageManager::buildProxy]: Failed to prepare proxy image.");
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+
+    m_proxy_width = width;
+    m_proxy_height = height;
+    m_display_from_proxy.store(false, std::memory_order_release);
+
+    spdlog::info("[StateImageManager::buildProxy]: Proxy prepared ({}x{}).", width, height);
+    return {};
+}
+
+std::future<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>>
+StateImageManager::renderVariants(std::vector<Operations::OperationDescriptor>&& ops,
+                                  std::vector<Operations::ParameterSnapshot> variants,
+                                  Common::ImageDim max_long_edge,
+                                  Common::CancellationToken token)
+{
+    std::shared_ptr<const Common::ImageRegion> image;
+    std::shared_ptr<Pipeline::VariantRenderer> renderer;
+    {
+        std::lock_guard lock(m_state_mutex);
+        image = m_proxy_image_context->isReady() ? m_proxy_image_context->getOriginalImage()
+                                                 : m_working_image_context->getOriginalImage();
+        if (image && !m_variant_renderer) {
+            m_variant_renderer = std::make_shared<Pipeline::VariantRenderer>();
+        }
+        renderer = m_variant_renderer;
+    }
+
+    if (!image) {
+        spdlog::error("[StateImageManager::renderVariants]: No image loaded.");
+        std::promise<std::expected<std::vector<Common::ImageRegion>, ErrorHandling::CoreError>> failed;
+        failed.set_value(std::unexpected(ErrorHandling::CoreError::SourceNotLoaded));
+        return failed.get_future();
+    }
+
+    spdlog::debug("[StateImageManager::renderVariants]: {} variants of {} operations.", variants.size(), ops.size());
+    return m_worker_context->getScheduler().submit(
+        Workers::TaskPriority::Interactive,
+        [renderer, image, ops = std::move(ops), variants = std::move(variants), max_long_edge, token]() {
+            return renderer->render(*image, ops, variants, max_long_edge, token);
+        });
+}
+
+void StateImageManager::cancelProcessing()
+{
+    std::lock_guard lock(m_pending_mutex);
+
+    // A new generation without a request: every issued token reports cancelled
+    m_cancelled_generation = m_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (m_pending_request.has_value()) {
+        reportTimings(m_pending_request->m_generation, Common::ProcessingOutcome::Cancelled,
+                      m_pending_request->m_use_proxy, m_pending_request->m_submitted_at, {});
+        settle(m_pending_request->m_promise, m_pending_request->m_progressive.get(), Common::ProcessingOutcome::Cancelled);
+        m_pending_request.reset();
+    }
+
+    spdlog::debug("[StateImageManager::cancelProcessing]: Requests up to generation {} cancelled.", m_cancelled_generation);
+}
+
+std::future<Common::ProcessingOutcome> StateImageManager::submitRequest(ProcessingRequest&& request)
+{
+    std::unique_lock lock(m_pending_mutex);
+
+    // Number the request: from now on, the tokens of all older requests report cancelled
+    request.m_generation = m_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    request.m_submitted_at = Common::ProcessingTimings::Clock::now();
+    auto future = request.m_promise.get_future();
+
+    // During a gesture: the proxy resolution and the interactive chain, and its edits are refined when it ends
+    if (m_interaction_operation && !request.m_roi && !request.m_progressive) {
+        request.m_interaction = m_interaction_operation;
+        request.m_use_proxy = request.m_use_proxy || m_proxy_image_context->isReady();
+        m_interaction_operations = request.m_operations;
+    }
+    Common::Metrics::coreMetrics().m_requests_submitted.add();
 
     // ============================================================
-    // CASE 1: Processing already in progress → COALESCE
+    // CASE 1: Processing already in progress → SUPERSEDE
     // ============================================================
     if (m_is_updating.load(std::memory_order_acquire))
     {
-        std::lock_guard lock(m_pending_mutex);
-
-        // Overwrite any previous pending operations
-        m_pending_ops = std::move(ops);
-
-        // Create a new promise for this caller
-        // The previous promise will be fulfilled when the current chain completes
-        m_pending_promise = std::promise<bool>();
+        // The previous pending request never ran: settle it now
+        if (m_pending_request.has_value()) {
+            reportTimings(m_pending_request->m_generation, Common::ProcessingOutcome::Superseded,
+                          m_pending_request->m_use_proxy, m_pending_request->m_submitted_at, {});
+            settle(m_pending_request->m_promise, m_pending_request->m_progressive.get(), Common::ProcessingOutcome::Superseded);
+        }
+        m_pending_request = std::move(request);
 
-        spdlog::debug("[StateImageManager::applyOperations]: Processing in progress, "
-                      "ops stored as pending (coalesced).");
+        spdlog::debug("[StateImageManager::submitRequest]: Processing in progress, "
+                      "request {} stored as pending (running pass cancelled).", m_pending_request->m_generation);
 
-        return m_pending_promise.get_future();
+        return future;
     }
 
     // ============================================================
     // CASE 2: No processing in progress → LAUNCH DIRECTLY
     // ============================================================
 
-    // Create promise for this request
-    m_pending_promise = std::promise<bool>();
-    auto future = m_pending_promise.get_future();
+    // Set the updating flag (cleared by onProcessingComplete when the last request settles)
+    m_is_updating.store(true, std::memory_order_release);
+    lock.unlock();
 
     // Launch the processing
-    launchProcessing(std::move(ops));
+    launchProcessing(std::move(request));
 
     return future;
 }
 
-void StateImageManager::launchProcessing(
-    std::vector<Operations::OperationDescriptor> ops)
+void StateImageManager::launchProcessing(ProcessingRequest request)
 {
-    spdlog::trace("[StateImageManager::launchProcessing]: Starting async processing.");
+    spdlog::trace("[StateImageManager::launchProcessing]: Starting async processing (proxy={}).", request.m_use_proxy);
 
-    // Set the updating flag
-    m_is_updating.store(true, std::memory_order_release);
+    // 1. Select the target image: the full-resolution working image or the preview proxy.
+    // No restore step is needed: the working image keeps the uploaded original
+    // as a separate source buffer, and the pipeline realizes source -> destination.
+    auto& image_context = request.m_use_proxy ? *m_proxy_image_context : *m_working_image_context;
 
-    // 1. Retrieve the original image data from the SourceManager.
-    Common::ImageDim source_width = m_source_manager->width();
-    Common::ImageDim source_height = m_source_manager->height();
-    auto tile = m_source_manager->getTile(0, 0, source_width, source_height);
+    const std::uint64_t generation = request.m_generation;
+    Common::CancellationToken token(m_generation, generation);
 
-    if (!tile)
-    {
-        spdlog::error("[StateImageManager::launchProcessing]: Failed to retrieve original tile.");
-        onProcessingComplete(false);
-        return;
-    }
+    // Read back when the pass settles (no other pass runs until then)
+    m_running_submitted_at = request.m_submitted_at;
+    m_running_started_at = Common::ProcessingTimings::Clock::now();
+    m_running_use_proxy = request.m_use_proxy;
 
-    if (!m_working_image_context->update(std::move(*tile.value()))) {
-        spdlog::error("[StateImageManager::launchProcessing]: Failed to update working image.");
-        onProcessingComplete(false);
+    if (!image_context.isReady()) {
+        spdlog::error("[StateImageManager::launchProcessing]: Working image is not ready.");
+        onProcessingComplete(generation, std::move(request.m_promise), false, token.isCancelled());
         return;
     }
+    m_running_backend = image_context.getWorkingImage()->getMemoryType();
 
     // 3. Retrieve the Halide Manager from the Pipeline Context.
     auto& halide_manager = m_pipeline_context->getHalideManager();
 
-    // 4. Initialize the Manager with the Operations (Move Data Transfer).
-    halide_manager.init(std::move(ops));
+    // 4. Initialize the Manager with the Operations (Move Data Transfer), refreshed with the
+    // latest published values. The ROI is expressed in full-resolution coordinates and is ignored for the proxy.
+    m_parameters.load().applyTo(request.m_operations);
+    {
+        std::lock_guard lock(m_state_mutex);
+        Operations::CameraProfile::attachTo(request.m_operations, m_source_profile);
+    }
 
-    // 5. Retrieve the specific Worker for Halide operations.
-    auto worker = m_worker_context->getHalideOperationWorker();
+    // A state rendered before is served from the result cache, without a pass
+    const auto result_key = resultKeyFor(request);
+    if (result_key && serveFromResultCache(*result_key, request.m_use_proxy)) {
+        onProcessingComplete(generation, std::move(request.m_promise), true, false);
+        return;
+    }
 
-    // 6. Execute the processing asynchronously.
-    // Note: We pass a raw reference since working_image_to_use is kept alive by m_working_image
-    auto worker_future = worker.execute(*m_pipeline_context, *m_working_image_context->getWorkingImage());
+    halide_manager.setInteractiveOperation(request.m_interaction);
+    halide_manager.init(std::move(request.m_operations));
+    halide_manager.setRegionOfInterest(request.m_use_proxy ? std::nullopt : request.m_roi);
+    halide_manager.setCancellationToken(token);
+    {
+        std::lock_guard display_lock(m_display_mutex);
+        m_latest_display_image.reset();
+        if (m_display_size) {
+            halide_manager.setDisplayOutputSize(m_display_size->first, m_display_size->second);
+        }
+        halide_manager.setDisplayOnDevice(m_display_on_device);
+        halide_manager.setHistogramOutput(m_histogram_enabled);
+    }
 
-    // 8. Launch async continuation to handle completion
-    std::thread([this, worker_future = std::move(worker_future)]() mutable {
-        // Wait for worker to complete
-        bool success = worker_future.get();
+    // Progressive requests run in stages (preview, then bands), all with these operations
+    if (request.m_progressive) {
+        launchProgressiveStage(ProgressiveRun{std::move(request.m_progressive), generation, std::move(token),
+                                              std::move(request.m_promise)});
+        return;
+    }
+
+    // 5. Retrieve the specific Worker for Halide operations.
+    auto& worker = m_worker_context->getHalideOperationWorker();
+
+    // 6. Queue the processing on the engine scheduler. Previews (proxy, region of interest)
+    // take the interactive lane, full-resolution passes the refinement lane.
+    // Note: We pass a raw reference since the image is kept alive by its context
+    const bool use_proxy = request.m_use_proxy;
+    // An interactive chain may defer operations: its result is not the state's image
+    const auto store_key = request.m_interaction ? std::optional<ResultCache::Key>{} : result_key;
+    const auto priority = (use_proxy || request.m_roi) ? Workers::TaskPriority::Interactive
+                                                       : Workers::TaskPriority::Refine;
+
+    // 7. The continuation runs on the scheduler thread once the pass is done
+    worker.dispatch(*m_pipeline_context, *image_context.getWorkingImage(), priority,
+                    [this, &halide_manager, use_proxy, generation, store_key, token = std::move(token),
+                     promise = std::move(request.m_promise)](bool success) mutable {
+        const bool aborted = !success && token.isCancelled();
 
         if (success) {
             spdlog::info("[StateImageManager::launchProcessing]: Processing completed.");
+            // The most recent result now lives in the image that was just processed
+            m_display_from_proxy.store(use_proxy, std::memory_order_release);
+
+            // Keep the fused display image (if produced) before the caller's future resolves
+            ResultCache::Image result;
+            {
+                std::lock_guard display_lock(m_display_mutex);
+                m_latest_display_image = halide_manager.takeDisplayImage();
+                if (store_key && m_latest_display_image && !m_latest_display_image->isOnDevice()) {
+                    result = std::make_shared<const Common::DisplayImage>(*m_latest_display_image);
+                }
+            }
+            if (result) {
+                storeResult(*store_key, std::move(result), use_proxy);
+            }
+        } else if (aborted) {
+            spdlog::debug("[StateImageManager::launchProcessing]: Processing of request {} aborted.", generation);
         } else {
             spdlog::error("[StateImageManager::launchProcessing]: Processing failed.");
         }
 
-        // Handle completion (check for pending ops)
-        onProcessingComplete(success);
-    }).detach();
+        // Settle the request and launch the pending one, if any
+        onProcessingComplete(generation, std::move(promise), success, aborted);
+    });
 }
 
-void StateImageManager::onProcessingComplete(bool success)
+std::optional<ResultCache::Key> StateImageManager::resultKeyFor(const ProcessingRequest& request) const
 {
-    spdlog::trace("[StateImageManager::onProcessingComplete]: Checking for pending operations.");
+    // Progressive and region-restricted passes do not produce one display image of the state
+    if (request.m_progressive || (!request.m_use_proxy && request.m_roi)) {
+        return std::nullopt;
+    }
 
-    // ============================================================
-    // Check for pending operations
-    // ============================================================
-    std::optional<std::vector<Operations::OperationDescriptor>> next_ops;
+    ResultCache::Key key;
     {
-        std::lock_guard lock(m_pending_mutex);
-        next_ops = std::move(m_pending_ops);
-        m_pending_ops.reset();
+        std::lock_guard display_lock(m_display_mutex);
+        if (!m_display_size || m_display_on_device) {
+            return std::nullopt;
+        }
+        key.m_width = m_display_size->first;
+        key.m_height = m_display_size->second;
+    }
+    {
+        std::lock_guard lock(m_state_mutex);
+        if (!m_source_identity) {
+            return std::nullopt;
+        }
+        key.m_source = *m_source_identity;
+    }
+    key.m_edits = ResultCache::editHash(request.m_operations);
+    return key;
+}
+
+bool StateImageManager::serveFromResultCache(const ResultCache::Key& key, bool use_proxy)
+{
+    // A full-resolution pass also leaves its result in the working image (deep zoom, export):
+    // it is only skipped when the working image already holds that state
+    if (!use_proxy) {
+        std::lock_guard lock(m_state_mutex);
+        if (m_working_result != key) {
+            return false;
+        }
+    }
+
+    const ResultCache::Image image = m_result_cache->find(key, !use_proxy);
+    if (!image) {
+        return false;
+    }
+
+    if (!use_proxy) {
+        m_display_from_proxy.store(false, std::memory_order_release);
+    }
+    {
+        std::lock_guard display_lock(m_display_mutex);
+        m_latest_display_image = *image;
+        // Results read back from the disk tier carry no histogram
+        if (m_histogram_enabled && !m_latest_display_image->m_histogram) {
+            m_latest_display_image->m_histogram = Pipeline::HistogramStage::computeOnHost(*m_latest_display_image);
+        }
+    }
+
+    Common::Metrics::coreMetrics().m_result_cache_hits.add();
+    spdlog::debug("[StateImageManager::serveFromResultCache]: State {:016x} served from the result cache (proxy={}).",
+                  key.hash(), use_proxy);
+    return true;
+}
+
+void StateImageManager::storeResult(const ResultCache::Key& key, ResultCache::Image image, bool use_proxy)
+{
+    m_result_cache->insert(key, image, !use_proxy);
+    if (use_proxy) {
+        return;
+    }
+
+    bool persist { false };
+    {
+        std::lock_guard lock(m_state_mutex);
+        m_working_result = key;
+        persist = m_source_on_disk;
+    }
+
+    // Written off the latency path, in the lowest lane; the cache outlives the task
+    if (persist && ResultCache::isDiskEnabled()) {
+        m_worker_context->getScheduler().post(Workers::TaskPriority::Thumbnail,
+                                              [cache = m_result_cache, key, image = std::move(image)] {
+            cache->storeOnDisk(key, *image);
+        });
+    }
+}
+
+void StateImageManager::launchProgressiveStage(ProgressiveRun run)
+{
+    auto& halide_manager = m_pipeline_context->getHalideManager();
+    auto& worker = m_worker_context->getHalideOperationWorker();
+    const ProgressiveRefinement& refinement = *run.m_refinement;
+
+    // Stop between stages as soon as a newer request exists
+    if (run.m_token.isCancelled()) {
+        onProcessingComplete(run.m_generation, std::move(run.m_promise), false, true, run.m_refinement.get());
+        return;
     }
 
     // ============================================================
-    // CASE A: Pending operations exist → RELAUNCH
+    // STAGE 1: Low-resolution preview on the proxy
     // ============================================================
-    if (next_ops.has_value() && !next_ops->empty()) {
-        spdlog::debug("[StateImageManager::onProcessingComplete]: "
-                      "Launching {} pending operations.", next_ops->size());
-
-        // Keep m_is_updating = true, launch next processing
-        launchProcessing(std::move(*next_ops));
+    if (run.m_preview_pending && m_proxy_image_context->isReady()) {
+        halide_manager.setRegionOfInterest(std::nullopt);
+
+        worker.dispatch(*m_pipeline_context, *m_proxy_image_context->getWorkingImage(), Workers::TaskPriority::Interactive,
+                        [this, run = std::move(run)](bool success) mutable {
+            if (!success) {
+                const bool aborted = run.m_token.isCancelled();
+                onProcessingComplete(run.m_generation, std::move(run.m_promise), false, aborted, run.m_refinement.get());
+                return;
+            }
+
+            m_display_from_proxy.store(true, std::memory_order_release);
+
+            const ProgressiveRefinement& sink = *run.m_refinement;
+            if (sink.m_on_preview) {
+                auto preview = m_proxy_image_context->getDownsampled(sink.m_display_width, sink.m_display_height);
+                if (preview) {
+                    sink.m_on_preview(std::move(preview.value()));
+                } else {
+                    spdlog::warn("[StateImageManager::launchProgressiveStage]: Preview downsample failed: {}",
+                                 ErrorHandling::to_string(preview.error()));
+                }
+            }
+
+            run.m_preview_pending = false;
+            launchProgressiveStage(std::move(run));
+        });
         return;
     }
+    run.m_preview_pending = false;
 
     // ============================================================
-    // CASE B: No pending operations → COMPLETE
+    // STAGE 2: Full-resolution bands
     // ============================================================
+    auto working_image = m_working_image_context->getWorkingImage();
+    const auto [image_width, image_height] = working_image->getSize();
+
+    // Never upscale: the display image is at most the full-resolution image
+    const Common::ImageDim display_width = std::min(refinement.m_display_width, image_width);
+    const Common::ImageDim display_height = std::min(refinement.m_display_height, image_height);
+
+    const Common::ImageDim first_row = run.m_next_row;
+    const Common::ImageDim rows = std::min(refinement.m_tile_rows, display_height - first_row);
+
+    // Source rows backing the display rows [first_row, first_row + rows), as in downsample_rows_F32
+    const Common::ImageDim y_begin = first_row * image_height / display_height;
+    const Common::ImageDim y_end = (first_row + rows) * image_height / display_height;
+    halide_manager.setRegionOfInterest(Common::RegionOfInterest{
+        0, static_cast<Common::ImageCoord>(y_begin), image_width, y_end - y_begin});
+
+    worker.dispatch(*m_pipeline_context, *working_image, Workers::TaskPriority::Refine,
+                    [this, run = std::move(run), display_width, display_height, first_row, rows](bool success) mutable {
+        if (!success) {
+            const bool aborted = run.m_token.isCancelled();
+            if (!aborted) {
+                spdlog::error("[StateImageManager::launchProgressiveStage]: Refinement of rows {}+{} failed.", first_row, rows);
+            }
+            onProcessingComplete(run.m_generation, std::move(run.m_promise), false, aborted, run.m_refinement.get());
+            return;
+        }
+
+        const ProgressiveRefinement& sink = *run.m_refinement;
+        if (sink.m_on_tile) {
+            auto view = m_working_image_context->getWorkingImageView();
+            auto tile = view ? Utils::downsample_rows_F32(view.value(), display_width, display_height, first_row, rows)
+                             : nullptr;
+            if (tile) {
+                sink.m_on_tile(std::move(tile));
+            } else {
+                spdlog::warn("[StateImageManager::launchProgressiveStage]: Could not produce the tile of rows {}+{}.", first_row, rows);
+            }
+        }
+
+        run.m_next_row = first_row + rows;
+        if (run.m_next_row < display_height) {
+            launchProgressiveStage(std::move(run));
+            return;
+        }
+
+        // Every band is refined: the full-resolution image holds the result
+        spdlog::info("[StateImageManager::launchProgressiveStage]: Refinement completed.");
+        m_display_from_proxy.store(false, std::memory_order_release);
+        onProcessingComplete(run.m_generation, std::move(run.m_promise), true, false, run.m_refinement.get());
+    });
+}
+
+void StateImageManager::settle(std::promise<Common::ProcessingOutcome>& promise,
+                               const ProgressiveRefinement* progressive,
+                               Common::ProcessingOutcome outcome)
+{
+    if (progressive && progressive->m_on_finished) {
+        progressive->m_on_finished(outcome);
+    }
+    promise.set_value(outcome);
+}
+
+void StateImageManager::reportTimings(std::uint64_t generation, Common::ProcessingOutcome outcome, bool use_proxy,
+                                      Common::ProcessingTimings::Clock::time_point submitted,
+                                      Common::ProcessingTimings::Clock::time_point started) const
+{
+    const auto settled { Common::ProcessingTimings::Clock::now() };
+    const auto& metrics { Common::Metrics::coreMetrics() };
+    const bool ran { started != Common::ProcessingTimings::Clock::time_point{} };
+    switch (outcome) {
+    case Common::ProcessingOutcome::Completed:
+        metrics.m_requests_completed.add();
+        metrics.m_request_latency_ms.observe(
+            std::chrono::duration<double, std::milli>(settled - submitted).count());
+        break;
+    case Common::ProcessingOutcome::Superseded:
+        (ran ? metrics.m_requests_dropped : metrics.m_requests_coalesced).add();
+        break;
+    case Common::ProcessingOutcome::Cancelled:
+        metrics.m_requests_cancelled.add();
+        break;
+    case Common::ProcessingOutcome::Failed:
+        metrics.m_requests_failed.add();
+        break;
+    }
+
+    if (!m_timings_callback) {
+        return;
+    }
+
+    Common::ProcessingTimings timings;
+    timings.m_generation = generation;
+    timings.m_outcome = outcome;
+    timings.m_use_proxy = use_proxy;
+    timings.m_submitted = submitted;
+    timings.m_started = started;
+    if (ran) {
+        timings.m_backend = m_running_backend;
+    }
+    timings.m_settled = settled;
+    m_timings_callback(timings);
+}
+
+void StateImageManager::onProcessingComplete(std::uint64_t generation, std::promise<Common::ProcessingOutcome> promise,
+                                              bool success, bool aborted, const ProgressiveRefinement* progressive)
+{
+    spdlog::trace("[StateImageManager::onProcessingComplete]: Request {} finished, checking for pending operations.", generation);
+
+    std::optional<ProcessingRequest> next_request;
+    {
+        std::lock_guard lock(m_pending_mutex);
+
+        Common::ProcessingOutcome outcome = Common::ProcessingOutcome::Completed;
+        if (aborted) {
+            outcome = generation <= m_cancelled_generation ? Common::ProcessingOutcome::Cancelled
+                                                           : Common::ProcessingOutcome::Superseded;
+        } else if (!success) {
+            outcome = Common::ProcessingOutcome::Failed;
+        }
 
-    // Reset the updating flag
-    m_is_updating.store(false, std::memory_order_release);
+        next_request = std::exchange(m_pending_request, std::nullopt);
+        reportTimings(generation, outcome, m_running_use_proxy, m_running_submitted_at, m_running_started_at);
+
+        // ============================================================
+        // CASE B: No pending request → COMPLETE
+        // ============================================================
+        // Clearing the flag, settling the promise and waking the waiters happen under the
+        // same lock as the superseding check in submitRequest: a request submitted meanwhile
+        // either becomes pending here or starts a new pass, never gets lost. Releasing the
+        // lock is the last access to this object (the destructor may run right after).
+        if (!next_request.has_value()) {
+            m_is_updating.store(false, std::memory_order_release);
+            settle(promise, progressive, outcome);
+
+            spdlog::debug("[StateImageManager::onProcessingComplete]: All processing complete.");
+            m_idle_cv.notify_all();
+            return;
+        }
 
-    // Fulfill the promise
-    try {
-        m_pending_promise.set_value(success);
-    } catch (const std::future_error& e) {
-        // Promise already satisfied (should not happen, but log just in case)
-        spdlog::warn("[StateImageManager::onProcessingComplete]: Promise error: {}", e.what());
+        settle(promise, progressive, outcome);
     }
 
-    spdlog::debug("[StateImageManager::onProcessingComplete]: All processing complete.");
+    // ============================================================
+    // CASE A: Pending request exists → RELAUNCH
+    // ============================================================
+    spdlog::debug("[StateImageManager::onProcessingComplete]: "
+                  "Launching {} pending operations.", next_request->m_operations.size());
+
+    // Keep m_is_updating = true, launch next processing
+    launchProcessing(std::move(*next_request));
 }
 
 void StateImageManager::waitForPendingProcessing()
 {
-    while (m_is_updating.load(std::memory_order_acquire)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::unique_lock lock(m_pending_mutex);
+    if (!m_is_updating.load(std::memory_order_acquire)) {
+        return;
     }
+
+    // Only the waits that actually block are recorded
+    CM_TRACE_SCOPE("engine", "StateImageManager::waitForPendingProcessing");
+    const auto begin { std::chrono::steady_clock::now() };
+    m_idle_cv.wait(lock, [this]() { return !m_is_updating.load(std::memory_order_acquire); });
+    const double waited_ms { std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count() };
+
+    const auto& metrics { Common::Metrics::coreMetrics() };
+    metrics.m_idle_waits.add();
+    metrics.m_idle_wait_ms.observe(waited_ms);
+    spdlog::debug("[StateImageManager::waitForPendingProcessing]: Blocked {:.2f} ms on the running pass.", waited_ms);
 }
 
 Common::ImageDim StateImageManager::getSourceWidth() const
@@ -310,6 +1113,12 @@ Common::ImageChan StateImageManager::getSourceChannels() const
     return m_source_manager ? m_source_manager->channels() : 0;
 }
 
+Common::ImageOrientation StateImageManager::getSourceOrientation() const
+{
+    std::lock_guard lock(m_state_mutex);
+    return m_source_manager ? m_source_manager->orientation() : Common::ImageOrientation::Normal;
+}
+
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> StateImageManager::getWorkingImageAsRegion() const
 {
     std::lock_guard lock(m_state_mutex);
@@ -321,6 +1130,17 @@ std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError> St
     return m_working_image_context->getWorkingImageAsRegion();
 }
 
+std::expected<Common::ImageView, ErrorHandling::CoreError> StateImageManager::getWorkingImageView() const
+{
+    std::lock_guard lock(m_state_mutex);
+
+    if (!m_working_image_context) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    return m_working_image_context->getWorkingImageView();
+}
+
 std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
 StateImageManager::getDownsampledDisplayImage(Common::ImageDim target_width, Common::ImageDim target_height)
 {
@@ -331,7 +1151,48 @@ StateImageManager::getDownsampledDisplayImage(Common::ImageDim target_width, Com
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
     }
 
+    // The latest result lives in the proxy after an interactive (preview) pass
+    if (m_display_from_proxy.load(std::memory_order_acquire) && m_proxy_image_context->isReady()) {
+        return m_proxy_image_context->getDownsampled(target_width, target_height);
+    }
+
     return m_working_image_context->getDownsampled(target_width, target_height);
 }
 
+void StateImageManager::setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height)
+{
+    std::lock_guard lock(m_display_mutex);
+    m_display_size = std::make_pair(width, height);
+}
+
+void StateImageManager::setDisplayOnDevice(bool enabled)
+{
+    std::lock_guard lock(m_display_mutex);
+    m_display_on_device = enabled;
+}
+
+void StateImageManager::setHistogramEnabled(bool enabled)
+{
+    std::lock_guard lock(m_display_mutex);
+    m_histogram_enabled = enabled;
+}
+
+std::optional<Common::DisplayImage> StateImageManager::takeDisplayImage()
+{
+    std::lock_guard lock(m_display_mutex);
+    if (m_latest_display_image && m_latest_display_image->m_histogram) {
+        m_latest_histogram = m_latest_display_image->m_histogram;
+    }
+    return std::exchange(m_latest_display_image, std::nullopt);
+}
+
+std::shared_ptr<const Common::PreviewHistogram> StateImageManager::latestHistogram() const
+{
+    std::lock_guard lock(m_display_mutex);
+    if (m_latest_display_image && m_latest_display_image->m_histogram) {
+        return m_latest_display_image->m_histogram;
+    }
+    return m_latest_histogram;
+}
+
 } // namespace CaptureMoment::Core::Managers
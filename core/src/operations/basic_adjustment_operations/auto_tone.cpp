@@ -0,0 +1,191 @@
+/**
+ * @file auto_tone.cpp
+ * @brief Implementation of AutoTone
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/auto_tone.h"
+#include "operations/operation_ranges.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Luminance range of the Whites mask (see `applyWhitesAdjustment`).
+ */
+constexpr float k_whites_low { 0.7f };
+constexpr float k_whites_high { 1.0f };
+
+/**
+ * @brief Luminance range of the Blacks mask (see `applyBlacksAdjustment`).
+ */
+constexpr float k_blacks_low { 0.0f };
+constexpr float k_blacks_high { 0.3f };
+
+/**
+ * @brief Smallest mask weight an end is corrected through (below, the adjustment barely reaches it).
+ */
+constexpr float k_min_mask { 0.05f };
+
+/**
+ * @brief Encoded value of the first luma code holding `fraction` of the pixels.
+ */
+[[nodiscard]] float percentile(const Common::PreviewHistogram& histogram, double fraction) noexcept
+{
+    constexpr std::size_t bins { Common::PreviewHistogram::k_bins };
+    const auto threshold { static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(histogram.m_pixel_count))) };
+
+    std::uint64_t cumulative { 0 };
+    for (std::size_t code = 0; code < bins; ++code) {
+        cumulative += histogram.count(Common::PreviewHistogram::Channel::Luma, static_cast<std::uint8_t>(code));
+        if (cumulative >= std::max<std::uint64_t>(threshold, 1)) {
+            return static_cast<float>(code) / static_cast<float>(bins - 1);
+        }
+    }
+    return 1.0f;
+}
+
+/**
+ * @brief sRGB EOTF: encoded value to linear.
+ */
+[[nodiscard]] float srgbToLinear(float value) noexcept
+{
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+/**
+ * @brief The contrast of the pipeline (pivot at 0.5, clamped).
+ */
+[[nodiscard]] float applyContrast(float value, float contrast) noexcept
+{
+    return std::clamp(0.5f + (value - 0.5f) * contrast, 0.0f, 1.0f);
+}
+
+} // anonymous namespace
+
+AutoTone::Settings AutoTone::suggest(const Common::PreviewHistogram& histogram, const Settings& current) noexcept
+{
+    if (histogram.m_pixel_count == 0) {
+        return current;
+    }
+
+    const float low_encoded { percentile(histogram, 0.005) };
+    const float spread_low { percentile(histogram, 0.05) };
+    const float median_encoded { percentile(histogram, 0.5) };
+    const float spread_high { percentile(histogram, 0.95) };
+    const float high_encoded { percentile(histogram, 0.995) };
+
+    constexpr float epsilon { 1.0e-4f };
+    const float low { srgbToLinear(low_encoded) };
+    const float median { std::max(srgbToLinear(median_encoded), epsilon) };
+    const float high { std::max(srgbToLinear(high_encoded), epsilon) };
+
+    // ============================================================
+    // Contrast: a flat image is spread, gently (the pivot of the operation is bright)
+    // ============================================================
+    const float spread { std::max(spread_high - spread_low, epsilon) };
+    const float contrast { std::clamp(std::sqrt(k_target_spread / spread), 1.0f, k_max_contrast) };
+
+    // ============================================================
+    // Exposure: the median lands on middle gray once the contrast is applied
+    // ============================================================
+    // 0.5 + (median * gain - 0.5) * contrast = target
+    float gain { (0.5f + (k_target_middle - 0.5f) / contrast) / median };
+    if (gain > 1.0f) {
+        // Brightening stops where the highlights would reach white
+        gain = std::max(1.0f, std::min(gain, (0.5f + 0.5f / contrast) / high));
+    }
+    gain = std::clamp(gain, std::exp2(-k_max_exposure_shift), std::exp2(k_max_exposure_shift));
+
+    const float low_after { applyContrast(low * gain, contrast) };
+    const float high_after { applyContrast(high * gain, contrast) };
+
+    // ============================================================
+    // Whites and Blacks: the ends, through the masks of the adjustments
+    // ============================================================
+    float whites { 0.0f };
+    const float white_mask { std::clamp((high_after - k_whites_low) / (k_whites_high - k_whites_low), 0.0f, 1.0f) };
+    // Clipped ends hold no detail to bring back
+    if (high_encoded < 1.0f && white_mask >= k_min_mask) {
+        whites = std::clamp((k_target_white - high_after) / white_mask, -k_max_end_shift, k_max_end_shift);
+    }
+
+    float blacks { 0.0f };
+    const float black_mask { std::clamp((k_blacks_high - low_after) / (k_blacks_high - k_blacks_low), 0.0f, 1.0f) };
+    if (low_encoded > 0.0f && black_mask >= k_min_mask) {
+        blacks = std::clamp((k_target_black - low_after) / black_mask, -k_max_end_shift, k_max_end_shift);
+    }
+
+    // ============================================================
+    // Composed with the values the histogram was rendered with
+    // ============================================================
+    Settings suggested;
+    suggested.m_exposure = std::clamp(current.m_exposure + std::log2(gain),
+                                      OperationRanges::getExposureMinValue(), OperationRanges::getExposureMaxValue());
+    suggested.m_contrast = std::clamp(current.m_contrast * contrast,
+                                      OperationRanges::getContrastMinValue(), OperationRanges::getContrastMaxValue());
+    suggested.m_whites = std::clamp(current.m_whites + whites,
+                                    OperationRanges::getWhitesMinValue(), OperationRanges::getWhitesMaxValue());
+    suggested.m_blacks = std::clamp(current.m_blacks + blacks,
+                                    OperationRanges::getBlacksMinValue(), OperationRanges::getBlacksMaxValue());
+    return suggested;
+}
+
+AutoTone::Settings AutoTone::suggest(const Common::PreviewHistogram& histogram) noexcept
+{
+    return suggest(histogram, Settings{});
+}
+
+AutoTone::Settings AutoTone::read(std::span<const OperationDescriptor> operations) noexcept
+{
+    Settings settings;
+    for (const auto& operation : operations) {
+        if (!operation.enabled) {
+            continue;
+        }
+        const auto value { operation.getParam<float>(ParameterKey::Value) };
+        if (!value) {
+            continue;
+        }
+        switch (operation.type) {
+        case OperationType::Exposure: settings.m_exposure = *value; break;
+        case OperationType::Contrast: settings.m_contrast = *value; break;
+        case OperationType::Whites: settings.m_whites = *value; break;
+        case OperationType::Blacks: settings.m_blacks = *value; break;
+        default: break;
+        }
+    }
+    return settings;
+}
+
+void AutoTone::applyTo(std::vector<OperationDescriptor>& operations, const Settings& settings)
+{
+    const auto set = [&operations](OperationType type, const char* name, float value) {
+        auto it { std::ranges::find(operations, type, &OperationDescriptor::type) };
+        if (it == operations.end()) {
+            OperationDescriptor descriptor;
+            descriptor.id = OperationDescriptor::generateId();
+            descriptor.type = type;
+            descriptor.name = name;
+            it = operations.insert(operations.end(), std::move(descriptor));
+        }
+        it->enabled = true;
+        it->setParam(ParameterKey::Value, value);
+    };
+
+    // Absent ones are appended in the order `suggest` models them
+    set(OperationType::Exposure, "Exposure", settings.m_exposure);
+    set(OperationType::Contrast, "Contrast", settings.m_contrast);
+    set(OperationType::Whites, "Whites", settings.m_whites);
+    set(OperationType::Blacks, "Blacks", settings.m_blacks);
+}
+
+} // namespace CaptureMoment::Core::Operations
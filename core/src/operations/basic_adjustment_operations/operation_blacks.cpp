@@ -6,7 +6,12 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_blacks.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -15,55 +20,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyBlacksAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_blacks,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c,
-    float low_threshold = 0.0f,
-    float high_threshold = 0.3f)
-{
-    Halide::Func blacks_func("blacks_op");
-    Halide::Func luminance_func("luminance_blacks");
-    Halide::Func mask_func("mask_blacks");
-
-    // Calculate Luminance (Rec. 709)
-    luminance_func(x, y) = 0.299f * input(x, y, 0) +
-                           0.587f * input(x, y, 1) +
-                           0.114f * input(x, y, 2);
-
-    // Calculate Mask: 1.0 in deep blacks, fading to 0.0 at high_threshold
-    mask_func(x, y) = Halide::select(
-        luminance_func(x, y) >= high_threshold,
-        0.0f,
-        luminance_func(x, y) <= low_threshold,
-        1.0f,
-        (high_threshold - luminance_func(x, y)) / (high_threshold - low_threshold)
-        );
-
-
-    Halide::Expr safe_blacks_val = Halide::clamp(
-        param_blacks, 
-        OperationBlacks::MIN_BLACKS_VALUE, 
-        OperationBlacks::MAX_BLACKS_VALUE
-    );
-
-    // Apply Adjustment
-    blacks_func(x, y, c) = Halide::select(
-        c < 3,
-        input(x, y, c) + safe_blacks_val * mask_func(x, y),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return blacks_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -79,12 +35,12 @@ std::expected<void, ErrorHandling::CoreError> OperationBlacks::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationBlacks::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationBlacks::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationBlacks::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -93,59 +49,16 @@ std::expected<void, ErrorHandling::CoreError> OperationBlacks::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(blacks_value - OperationBlacks::DEFAULT_BLACKS_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationBlacks::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationBlacks::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     blacks_value = std::clamp(blacks_value, OperationBlacks::MIN_BLACKS_VALUE, OperationBlacks::MAX_BLACKS_VALUE);
-    spdlog::debug("OperationBlacks::execute: Applying blacks adjustment with value={:.2f}", blacks_value);
-
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationBlacks::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
-
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
+    CM_LOG_DEBUG(Operations, "OperationBlacks::execute: Applying blacks adjustment with value={:.2f}", blacks_value);
 
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-
-        Halide::Param<float> temp_param;
-        temp_param.set(blacks_value);
-
-        auto blacks_func = applyBlacksAdjustment(input_buf, temp_param, x, y, c);
-        blacks_func.compute_root().parallel(y).vectorize(x, 8);
-        blacks_func.realize(input_buf);
-
-        // Update Working Image
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationBlacks::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
-
-        return {};
-
-    } catch (const Halide::CompileError& e) {
-        spdlog::critical("OperationBlacks::execute: Halide Compile Error: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    } catch (const Halide::RuntimeError& e) {
-        spdlog::critical("OperationBlacks::execute: Halide Runtime Error: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationBlacks::execute: Unexpected Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -157,11 +70,19 @@ Halide::Func OperationBlacks::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
     ) const
 {
-    spdlog::trace("OperationBlacks::appendToFusedPipeline: Fusing with Halide Param");
-    return applyBlacksAdjustment(input_func, param, x, y, c);
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_BLACKS_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationBlacks::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    // The luminance of the input is shared with the other masked adjustments of the chain
+    auto result = applyBlacksAdjustment(input_func, luminance.of(input_func, x, y), value, x, y, c);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
 }
 
 // ============================================================================
@@ -178,15 +99,13 @@ std::expected<void, ErrorHandling::CoreError> OperationBlacks::executeOnImageReg
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationBlacks] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::blacks(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
@@ -6,7 +6,12 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_brightness.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -14,38 +19,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyBrightnessAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_brightness,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c)
-{
-    Halide::Func brightness_func("brightness_op");
-
-    // Safety: Clamp the input parameter to the operation's defined valid range.
-    // This ensures robustness even if the cache passes an unexpected value.
-    Halide::Expr safe_brightness = Halide::clamp(
-        param_brightness, 
-        OperationBrightness::MIN_BRIGHTNESS_VALUE, 
-        OperationBrightness::MAX_BRIGHTNESS_VALUE
-    );
-
-    // Additive brightness adjustment
-    brightness_func(x, y, c) = Halide::select(
-        c < 3, // R, G, B
-        Halide::clamp(input(x, y, c) + safe_brightness, 0.0f, 1.0f),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return brightness_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -61,12 +34,12 @@ std::expected<void, ErrorHandling::CoreError> OperationBrightness::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationBrightness::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationBrightness::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationBrightness::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -75,52 +48,16 @@ std::expected<void, ErrorHandling::CoreError> OperationBrightness::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(brightness_value - OperationBrightness::DEFAULT_BRIGHTNESS_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationBrightness::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationBrightness::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     brightness_value = std::clamp(brightness_value, OperationBrightness::MIN_BRIGHTNESS_VALUE, OperationBrightness::MAX_BRIGHTNESS_VALUE);
-    spdlog::debug("OperationBrightness::execute: Applying brightness with value={:.2f}", brightness_value);
-
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationBrightness::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
-
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
+    CM_LOG_DEBUG(Operations, "OperationBrightness::execute: Applying brightness with value={:.2f}", brightness_value);
 
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-
-        Halide::Param<float> temp_param;
-        temp_param.set(brightness_value);
-
-        auto brightness_func = applyBrightnessAdjustment(input_buf, temp_param, x, y, c);
-        brightness_func.compute_root().parallel(y).vectorize(x, 8);
-        brightness_func.realize(input_buf);
-
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationBrightness::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
-
-        return {};
-
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationBrightness::execute: Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -132,13 +69,16 @@ Halide::Func OperationBrightness::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    [[maybe_unused]] FusedLuminance& luminance
     ) const
 {
-    // to allow dynamic updates via the cache without recompilation.
-    // Halide's optimizer (Constant Folding) will handle the math if the value is 0.
-    spdlog::trace("OperationBrightness::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
-    return applyBrightnessAdjustment(input_func, param, x, y, c);
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_BRIGHTNESS_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationBrightness::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    return applyBrightnessAdjustment(input_func, value, x, y, c);
 }
 
 // ============================================================================
@@ -155,15 +95,13 @@ std::expected<void, ErrorHandling::CoreError> OperationBrightness::executeOnImag
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationBrightness] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::brightness(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
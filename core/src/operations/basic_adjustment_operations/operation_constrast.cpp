@@ -6,7 +6,12 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_contrast.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -14,39 +19,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyContrastAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_contrast,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c)
-{
-    Halide::Func contrast_func("contrast_op");
-
-    // Safety: Clamp the input parameter to the operation's defined valid range.
-    Halide::Expr safe_contrast = Halide::clamp(
-        param_contrast, 
-        OperationContrast::MIN_CONTRAST_VALUE, 
-        OperationContrast::MAX_CONTRAST_VALUE
-    );
-
-    // Multiplicative contrast centered at 0.5 (Mid-gray)
-    // Formula: 0.5 + (Input - 0.5) * ContrastFactor
-    // Result is clamped to [0.0, 1.0] to maintain valid color space.
-    contrast_func(x, y, c) = Halide::select(
-        c < 3,
-        Halide::clamp(0.5f + (input(x, y, c) - 0.5f) * safe_contrast, 0.0f, 1.0f),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return contrast_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -62,12 +34,12 @@ std::expected<void, ErrorHandling::CoreError> OperationContrast::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationContrast::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationContrast::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationContrast::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -76,52 +48,16 @@ std::expected<void, ErrorHandling::CoreError> OperationContrast::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(contrast_value - OperationContrast::DEFAULT_CONTRAST_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationContrast::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationContrast::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     contrast_value = std::clamp(contrast_value, OperationContrast::MIN_CONTRAST_VALUE, OperationContrast::MAX_CONTRAST_VALUE);
-    spdlog::debug("OperationContrast::execute: Applying contrast with value={:.2f}", contrast_value);
+    CM_LOG_DEBUG(Operations, "OperationContrast::execute: Applying contrast with value={:.2f}", contrast_value);
 
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationContrast::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
-
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
-
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-            
-        Halide::Param<float> temp_param;
-        temp_param.set(contrast_value);
-
-        auto contrast_func = applyContrastAdjustment(input_buf, temp_param, x, y, c);
-        contrast_func.compute_root().parallel(y).vectorize(x, 8);
-        contrast_func.realize(input_buf);
-
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationContrast::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
-
-        return {};
-
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationContrast::execute: Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -133,12 +69,16 @@ Halide::Func OperationContrast::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    [[maybe_unused]] FusedLuminance& luminance
     ) const
 {
-    // Halide's optimizer will simplify the math if the contrast factor is 1.0.
-    spdlog::trace("OperationContrast::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
-    return applyContrastAdjustment(input_func, param, x, y, c);
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_CONTRAST_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationContrast::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    return applyContrastAdjustment(input_func, value, x, y, c);
 }
 
 // ============================================================================
@@ -155,15 +95,13 @@ std::expected<void, ErrorHandling::CoreError> OperationContrast::executeOnImageR
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationContrast] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::contrast(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
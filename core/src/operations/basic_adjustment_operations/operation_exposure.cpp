@@ -0,0 +1,107 @@
+/**
+ * @file operation_exposure.cpp
+ * @brief Implementation of OperationExposure
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/operation_exposure.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+namespace CaptureMoment::Core::Operations {
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationExposure::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationExposure::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationExposure::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: Extract Parameters
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::error("OperationExposure::execute: Failed to get 'value' parameter");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    float exposure_value = value_res.value();
+
+    // Step 3: No-Op Optimization
+    if (std::abs(exposure_value - OperationExposure::DEFAULT_EXPOSURE_VALUE) < std::numeric_limits<float>::epsilon()) {
+        CM_LOG_TRACE(Operations, "OperationExposure::execute: Value is default, skipping");
+        return {};
+    }
+
+    // Step 4: Clamp Value
+    exposure_value = std::clamp(exposure_value, OperationExposure::MIN_EXPOSURE_VALUE, OperationExposure::MAX_EXPOSURE_VALUE);
+    CM_LOG_DEBUG(Operations, "OperationExposure::execute: Applying exposure with value={:.2f}", exposure_value);
+
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationExposure::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    [[maybe_unused]] FusedLuminance& luminance
+    ) const
+{
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_EXPOSURE_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationExposure::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    return applyExposureAdjustment(input_func, value, x, y, c);
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationExposure::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationExposure] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    auto value_res = params.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::warn("[OperationExposure] executeOnImageRegion: Param 'value' missing, skipping.");
+        return {};
+    }
+
+    return FallbackKernels::exposure(region, params);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -6,7 +6,14 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_highlights.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "operations/basic_adjustment_operations/tone_mask_mode.h"
+#include "operations/detail_operations/bilateral_grid.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -14,55 +21,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyHighlightsAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_highlights,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c,
-    float low_threshold = 0.7f,
-    float high_threshold = 1.0f)
-{
-    Halide::Func highlights_func("highlights_op");
-    Halide::Func luminance_func("luminance_highlights");
-    Halide::Func mask_func("mask_highlights");
-
-    // Calculate Luminance
-    luminance_func(x, y) = 0.299f * input(x, y, 0) +
-                           0.587f * input(x, y, 1) +
-                           0.114f * input(x, y, 2);
-
-    // Mask: 0.0 below 0.7, ramp to 1.0 at 1.0
-    mask_func(x, y) = Halide::select(
-        luminance_func(x, y) <= low_threshold,
-        0.0f,
-        luminance_func(x, y) >= high_threshold,
-        1.0f,
-        (luminance_func(x, y) - low_threshold) / (high_threshold - low_threshold)
-        );
-
-    // Safety: Clamp the input parameter to the operation's defined valid range.
-    Halide::Expr safe_val = Halide::clamp(
-        param_highlights, 
-        OperationHighlights::MIN_HIGHLIGHTS_VALUE, 
-        OperationHighlights::MAX_HIGHLIGHTS_VALUE
-    );
-
-    // Apply Adjustment
-    highlights_func(x, y, c) = Halide::select(
-        c < 3,
-        input(x, y, c) + safe_val * mask_func(x, y),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return highlights_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -78,12 +36,12 @@ std::expected<void, ErrorHandling::CoreError> OperationHighlights::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationHighlights::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationHighlights::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationHighlights::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -92,52 +50,16 @@ std::expected<void, ErrorHandling::CoreError> OperationHighlights::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(highlights_value - OperationHighlights::DEFAULT_HIGHLIGHTS_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationHighlights::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationHighlights::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     highlights_value = std::clamp(highlights_value, OperationHighlights::MIN_HIGHLIGHTS_VALUE, OperationHighlights::MAX_HIGHLIGHTS_VALUE);
-    spdlog::debug("OperationHighlights::execute: Applying highlights with value={:.2f}", highlights_value);
-
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationHighlights::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
-
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
-
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-
-        Halide::Param<float> temp_param;
-        temp_param.set(highlights_value);
-
-        auto highlights_func = applyHighlightsAdjustment(input_buf, temp_param, x, y, c);
-        highlights_func.compute_root().parallel(y).vectorize(x, 8);
-        highlights_func.realize(input_buf);
-
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationHighlights::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
+    CM_LOG_DEBUG(Operations, "OperationHighlights::execute: Applying highlights with value={:.2f}", highlights_value);
 
-        return {};
-
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationHighlights::execute: Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -149,14 +71,45 @@ Halide::Func OperationHighlights::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
     ) const
 {
-const Halide::Param<float>& param_highlights = param;
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_HIGHLIGHTS_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationHighlights::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    // The luminance of the input is shared with the other masked adjustments of the chain
+    const Halide::Func input_luminance = luminance.of(input_func, x, y);
+
+    if (params.variant() == static_cast<std::uint32_t>(ToneMaskMode::EdgeAware)) {
+        // The mask follows the smoothed luminance; the offset still applies to every pixel's own value
+        auto grid = BilateralGrid::smooth(input_luminance, x, y);
+        params.addSpatialStages(grid.m_stages);
+        auto result = applyHighlightsAdjustment(input_func, input_luminance, grid.m_output, value, x, y, c);
+        luminance.track(result.m_output, result.m_luminance);
+        return result.m_output;
+    }
+
+    auto result = applyHighlightsAdjustment(input_func, input_luminance, value, x, y, c);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
+}
 
-    // Halide's optimizer will simplify the math if the highlights adjustment is effectively zero.
-    spdlog::trace("OperationHighlights::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
-    return applyHighlightsAdjustment(input_func, param_highlights, x, y, c);
+std::uint32_t OperationHighlights::fusionVariant(const OperationDescriptor& descriptor) const
+{
+    return static_cast<std::uint32_t>(toneMaskModeOf(descriptor));
+}
+
+bool OperationHighlights::readsNeighborhood(std::uint32_t variant) const
+{
+    return variant == static_cast<std::uint32_t>(ToneMaskMode::EdgeAware);
+}
+
+Halide::Expr OperationHighlights::identityCondition(FusionParameterBlock& params) const
+{
+    return readsNeighborhood(params.variant()) ? Halide::Expr() : neutralValueCondition(params, DEFAULT_HIGHLIGHTS_VALUE);
 }
 
 // ============================================================================
@@ -173,15 +126,13 @@ std::expected<void, ErrorHandling::CoreError> OperationHighlights::executeOnImag
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationHighlights] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::highlights(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
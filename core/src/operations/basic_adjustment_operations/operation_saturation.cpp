@@ -0,0 +1,109 @@
+/**
+ * @file operation_saturation.cpp
+ * @brief Implementation of OperationSaturation
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/operation_saturation.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+namespace CaptureMoment::Core::Operations {
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationSaturation::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationSaturation::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationSaturation::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: Extract Parameters
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::error("OperationSaturation::execute: Failed to get 'value' parameter");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    float saturation_value = value_res.value();
+
+    // Step 3: No-Op Optimization
+    if (std::abs(saturation_value - OperationSaturation::DEFAULT_SATURATION_VALUE) < std::numeric_limits<float>::epsilon()) {
+        CM_LOG_TRACE(Operations, "OperationSaturation::execute: Value is default, skipping");
+        return {};
+    }
+
+    // Step 4: Clamp Value
+    saturation_value = std::clamp(saturation_value, OperationSaturation::MIN_SATURATION_VALUE, OperationSaturation::MAX_SATURATION_VALUE);
+    CM_LOG_DEBUG(Operations, "OperationSaturation::execute: Applying saturation with value={:.2f}", saturation_value);
+
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationSaturation::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
+    ) const
+{
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_SATURATION_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationSaturation::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    // The luminance of the input is shared with the masked adjustments of the chain.
+    // The output is not tracked: clipped channels change its luminance.
+    return applySaturationAdjustment(input_func, luminance.of(input_func, x, y), value, x, y, c);
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationSaturation::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationSaturation] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    auto value_res = params.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::warn("[OperationSaturation] executeOnImageRegion: Param 'value' missing, skipping.");
+        return {};
+    }
+
+    return FallbackKernels::saturation(region, params);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -6,7 +6,14 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_shadows.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "operations/basic_adjustment_operations/tone_mask_mode.h"
+#include "operations/detail_operations/bilateral_grid.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -14,55 +21,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyShadowsAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_shadows,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c,
-    float low_threshold = 0.0f,
-    float high_threshold = 0.3f)
-{
-    Halide::Func shadows_func("shadows_op");
-    Halide::Func luminance_func("luminance_shadows");
-    Halide::Func mask_func("mask_shadows");
-
-    // Calculate Luminance
-    luminance_func(x, y) = 0.299f * input(x, y, 0) +
-                           0.587f * input(x, y, 1) +
-                           0.114f * input(x, y, 2);
-
-    // Mask: 1.0 below 0.0, ramp to 0.0 at 0.3
-    mask_func(x, y) = Halide::select(
-        luminance_func(x, y) >= high_threshold,
-        0.0f,
-        luminance_func(x, y) <= low_threshold,
-        1.0f,
-        (high_threshold - luminance_func(x, y)) / (high_threshold - low_threshold)
-        );
-
-    // Safety: Clamp the input parameter to the operation's defined valid range.
-    Halide::Expr safe_val = Halide::clamp(
-        param_shadows, 
-        OperationShadows::MIN_SHADOWS_VALUE, 
-        OperationShadows::MAX_SHADOWS_VALUE
-    );
-
-    // Apply Adjustment
-    shadows_func(x, y, c) = Halide::select(
-        c < 3,
-        input(x, y, c) + safe_val * mask_func(x, y),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return shadows_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -78,12 +36,12 @@ std::expected<void, ErrorHandling::CoreError> OperationShadows::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationShadows::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationShadows::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationShadows::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -92,52 +50,16 @@ std::expected<void, ErrorHandling::CoreError> OperationShadows::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(shadows_value - OperationShadows::DEFAULT_SHADOWS_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationShadows::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationShadows::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     shadows_value = std::clamp(shadows_value, OperationShadows::MIN_SHADOWS_VALUE, OperationShadows::MAX_SHADOWS_VALUE);
-    spdlog::debug("OperationShadows::execute: Applying shadows with value={:.2f}", shadows_value);
-
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationShadows::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
-
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
-
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-
-        Halide::Param<float> temp_param;
-        temp_param.set(shadows_value);
-
-        auto shadows_func = applyShadowsAdjustment(input_buf, temp_param, x, y, c);
-        shadows_func.compute_root().parallel(y).vectorize(x, 8);
-        shadows_func.realize(input_buf);
-
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationShadows::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
+    CM_LOG_DEBUG(Operations, "OperationShadows::execute: Applying shadows with value={:.2f}", shadows_value);
 
-        return {};
-
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationShadows::execute: Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -149,12 +71,45 @@ Halide::Func OperationShadows::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
     ) const
 {
-    // Zero adjustments are optimized out by Halide internally.
-    spdlog::trace("OperationShadows::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
-    return applyShadowsAdjustment(input_func, param, x, y, c);
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_SHADOWS_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationShadows::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    // The luminance of the input is shared with the other masked adjustments of the chain
+    const Halide::Func input_luminance = luminance.of(input_func, x, y);
+
+    if (params.variant() == static_cast<std::uint32_t>(ToneMaskMode::EdgeAware)) {
+        // The mask follows the smoothed luminance; the offset still applies to every pixel's own value
+        auto grid = BilateralGrid::smooth(input_luminance, x, y);
+        params.addSpatialStages(grid.m_stages);
+        auto result = applyShadowsAdjustment(input_func, input_luminance, grid.m_output, value, x, y, c);
+        luminance.track(result.m_output, result.m_luminance);
+        return result.m_output;
+    }
+
+    auto result = applyShadowsAdjustment(input_func, input_luminance, value, x, y, c);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
+}
+
+std::uint32_t OperationShadows::fusionVariant(const OperationDescriptor& descriptor) const
+{
+    return static_cast<std::uint32_t>(toneMaskModeOf(descriptor));
+}
+
+bool OperationShadows::readsNeighborhood(std::uint32_t variant) const
+{
+    return variant == static_cast<std::uint32_t>(ToneMaskMode::EdgeAware);
+}
+
+Halide::Expr OperationShadows::identityCondition(FusionParameterBlock& params) const
+{
+    return readsNeighborhood(params.variant()) ? Halide::Expr() : neutralValueCondition(params, DEFAULT_SHADOWS_VALUE);
 }
 
 // ============================================================================
@@ -171,15 +126,13 @@ std::expected<void, ErrorHandling::CoreError> OperationShadows::executeOnImageRe
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationShadows] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::shadows(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
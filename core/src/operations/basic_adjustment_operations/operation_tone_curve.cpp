@@ -0,0 +1,143 @@
+/**
+ * @file operation_tone_curve.cpp
+ * @brief Implementation of OperationToneCurve
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/operation_tone_curve.h"
+#include "operations/standalone_execution.h"
+#include "operations/basic_adjustment_operations/tone_curve.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <span>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Samples the curve table for R, G and B; alpha unchanged.
+ */
+[[nodiscard]] Halide::Func applyToneCurve(
+    const Halide::Func& input,
+    const Halide::ImageParam& table,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    Halide::Func curve_func("tone_curve_op");
+    curve_func(x, y, c) = Halide::select(
+        c < 3,
+        FusionParameterBlock::sampleLinear(table, input(x, y, c)),
+        input(x, y, c) // Alpha unchanged
+        );
+    return curve_func;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationToneCurve::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationToneCurve::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationToneCurve::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: No-Op Optimization
+    if (ToneCurve::isIdentity(descriptor)) {
+        CM_LOG_TRACE(Operations, "OperationToneCurve::execute: Identity curve, skipping");
+        return {};
+    }
+    CM_LOG_DEBUG(Operations, "OperationToneCurve::execute: Applying tone curve");
+
+    // Step 3: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationToneCurve::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& /*luminance*/
+    ) const
+{
+    // Declared as a runtime input of the graph: curve edits rebind the table without recompilation.
+    const Halide::ImageParam& table = params.lut(k_table_key, ToneCurve::identity());
+
+    CM_LOG_TRACE(Operations, "OperationToneCurve::appendToFusedPipeline: Fusing with a {}-entry curve table", ToneCurve::k_table_size);
+    return applyToneCurve(input_func, table, x, y, c);
+}
+
+void OperationToneCurve::updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const
+{
+    // A fresh buffer: the previous one may still be in use (or resident on the device) for a frame in flight
+    params.setLut(k_table_key, ToneCurve::bake(descriptor));
+}
+
+bool OperationToneCurve::isIdentity(const OperationDescriptor& descriptor) const
+{
+    return ToneCurve::isIdentity(descriptor);
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationToneCurve::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationToneCurve] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    if (ToneCurve::isIdentity(params)) {
+        return {};
+    }
+
+    // The table is small and the mapping per sample: no Halide pipeline needed
+    std::vector<float> table(ToneCurve::k_table_size);
+    ToneCurve::bake(params, table);
+    const float last = static_cast<float>(ToneCurve::k_table_size - 1);
+
+    const std::span<float> pixels = region.getBuffer();
+    const std::size_t channels = region.channels();
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+        if (i % channels >= 3) {
+            continue; // Alpha unchanged
+        }
+        const float position = std::clamp(pixels[i], 0.0f, 1.0f) * last;
+        const auto index = std::min(static_cast<std::size_t>(position), table.size() - 2);
+        pixels[i] = std::lerp(table[index], table[index + 1], position - static_cast<float>(index));
+    }
+
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -6,7 +6,12 @@
  */
 
 #include "operations/basic_adjustment_operations/operation_whites.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
 #include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -14,58 +19,6 @@
 
 namespace CaptureMoment::Core::Operations {
 
-// ============================================================================
-// Internal Helper: Shared Halide Logic
-// ============================================================================
-
-template<typename InputType>
-Halide::Func applyWhitesAdjustment(
-    const InputType& input,
-    const Halide::Param<float>& param_whites,
-    const Halide::Var& x,
-    const Halide::Var& y,
-    const Halide::Var& c,
-    float low_threshold = 0.7f,
-    float high_threshold = 1.0f)
-{
-    Halide::Func whites_func("whites_op");
-    Halide::Func luminance_func("luminance_whites");
-    Halide::Func mask_func("mask_whites");
-
-    // Calculate Luminance
-    luminance_func(x, y) = 0.299f * input(x, y, 0) +
-                           0.587f * input(x, y, 1) +
-                           0.114f * input(x, y, 2);
-
-    // Mask: 0.0 below 0.7, ramp to 1.0 at 1.0
-    // Note: Typically Whites targets the very top (e.g. > 0.9),
-    // adjusting low_threshold separates it from Highlights.
-    mask_func(x, y) = Halide::select(
-        luminance_func(x, y) <= low_threshold,
-        0.0f,
-        luminance_func(x, y) >= high_threshold,
-        1.0f,
-        (luminance_func(x, y) - low_threshold) / (high_threshold - low_threshold)
-        );
-
-    
-    // Safety: Clamp the input parameter to the operation's defined valid range.
-    Halide::Expr safe_val = Halide::clamp(
-        param_whites, 
-        OperationWhites::MIN_WHITES_VALUE, 
-        OperationWhites::MAX_WHITES_VALUE
-    );
-
-    // Apply Adjustment
-    whites_func(x, y, c) = Halide::select(
-        c < 3,
-        input(x, y, c) + safe_val * mask_func(x, y),
-        input(x, y, c) // Alpha unchanged
-        );
-
-    return whites_func;
-}
-
 // ============================================================================
 // IOperation Implementation
 // ============================================================================
@@ -81,12 +34,12 @@ std::expected<void, ErrorHandling::CoreError> OperationWhites::execute(
     }
 
     if (!descriptor.enabled) {
-        spdlog::trace("OperationWhites::execute: Operation is disabled, skipping");
+        CM_LOG_TRACE(Operations, "OperationWhites::execute: Operation is disabled, skipping");
         return {};
     }
 
     // Step 2: Extract Parameters
-    auto value_res = descriptor.getParam<float>("value");
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::error("OperationWhites::execute: Failed to get 'value' parameter");
         return std::unexpected(ErrorHandling::CoreError::Unexpected);
@@ -95,52 +48,16 @@ std::expected<void, ErrorHandling::CoreError> OperationWhites::execute(
 
     // Step 3: No-Op Optimization
     if (std::abs(whites_value - OperationWhites::DEFAULT_WHITES_VALUE) < std::numeric_limits<float>::epsilon()) {
-        spdlog::trace("OperationWhites::execute: Value is default, skipping");
+        CM_LOG_TRACE(Operations, "OperationWhites::execute: Value is default, skipping");
         return {};
     }
 
     // Step 4: Clamp Value
     whites_value = std::clamp(whites_value, OperationWhites::MIN_WHITES_VALUE, OperationWhites::MAX_WHITES_VALUE);
-    spdlog::debug("OperationWhites::execute: Applying whites with value={:.2f}", whites_value);
-
-    // Step 5: Export & Execute
-    auto cpu_copy_result = working_image.exportToCPUCopy();
-    if (!cpu_copy_result) {
-        spdlog::error("OperationWhites::execute: Failed to export working image to CPU");
-        return std::unexpected(cpu_copy_result.error());
-    }
-    auto& cpu_region_ptr = cpu_copy_result.value();
+    CM_LOG_DEBUG(Operations, "OperationWhites::execute: Applying whites with value={:.2f}", whites_value);
 
-    try {
-        Halide::Var x, y, c;
-        std::span<float> data_span = cpu_region_ptr->getBuffer();
-
-        Halide::Buffer<float> input_buf(
-            data_span.data(),
-            static_cast<int>(cpu_region_ptr->m_width),
-            static_cast<int>(cpu_region_ptr->m_height),
-            static_cast<int>(cpu_region_ptr->m_channels)
-            );
-
-        Halide::Param<float> temp_param;
-        temp_param.set(whites_value);
-
-        auto whites_func = applyWhitesAdjustment(input_buf, temp_param, x, y, c);
-        whites_func.compute_root().parallel(y).vectorize(x, 8);
-        whites_func.realize(input_buf);
-
-        auto update_res = working_image.updateFromCPU(std::move(*cpu_region_ptr));
-        if (!update_res) {
-            spdlog::error("OperationWhites::execute: Failed to update working image from CPU");
-            return std::unexpected(update_res.error());
-        }
-
-        return {};
-
-    } catch (const std::exception& e) {
-        spdlog::critical("OperationWhites::execute: Exception: {}", e.what());
-        return std::unexpected(ErrorHandling::CoreError::Unexpected);
-    }
+    // Step 5: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
 }
 
 // ============================================================================
@@ -152,12 +69,19 @@ Halide::Func OperationWhites::appendToFusedPipeline(
     const Halide::Var& x,
     const Halide::Var& y,
     const Halide::Var& c,
-    const Halide::Param<float>& param
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
     ) const
 {
-    // Halide's constant folding will optimize away additions by zero.
-    spdlog::trace("OperationWhites::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
-    return applyWhitesAdjustment(input_func, param, x, y, c);
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    // Halide's optimizer (Constant Folding) will handle the math if the value is neutral.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_WHITES_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationWhites::appendToFusedPipeline: Fusing with Halide Param (In-Graph Clamped)");
+    // The luminance of the input is shared with the other masked adjustments of the chain
+    auto result = applyWhitesAdjustment(input_func, luminance.of(input_func, x, y), value, x, y, c);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
 }
 
 // ============================================================================
@@ -174,15 +98,13 @@ std::expected<void, ErrorHandling::CoreError> OperationWhites::executeOnImageReg
         return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
     }
 
-    auto value_res = params.getParam<float>("value");
+    auto value_res = params.getParam<float>(ParameterKey::Value);
     if (!value_res) {
         spdlog::warn("[OperationWhites] executeOnImageRegion: Param 'value' missing, skipping.");
         return {};
     }
 
-    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
-
-    return {};
+    return FallbackKernels::whites(region, params);
 }
 
 } // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,261 @@
+/**
+ * @file tone_curve.cpp
+ * @brief Implementation of ToneCurve.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/tone_curve.h"
+#include "operations/operation_ranges.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <numbers>
+#include <system_error>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Parametric region keys, from the darkest region to the brightest.
+ */
+constexpr std::array<ParameterKey, 4> k_region_keys{
+    ParameterKey::CurveShadows, ParameterKey::CurveDarks, ParameterKey::CurveLights, ParameterKey::CurveHighlights
+};
+
+/**
+ * @brief Half width of a region bump (each bump spans two quarters of the range).
+ */
+constexpr float k_region_half_width = 0.25f;
+
+[[nodiscard]] std::optional<float> parseFloat(std::string_view text)
+{
+    while (!text.empty() && text.front() == ' ') text.remove_prefix(1);
+    while (!text.empty() && text.back() == ' ') text.remove_suffix(1);
+
+    float value = 0.0f;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size() || !std::isfinite(value)) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/**
+ * @brief Clamped region offsets of a descriptor (missing keys are 0).
+ */
+[[nodiscard]] std::array<float, 4> regionOffsets(const OperationDescriptor& descriptor)
+{
+    std::array<float, 4> offsets{};
+    for (std::size_t i = 0; i < k_region_keys.size(); ++i) {
+        offsets[i] = std::clamp(descriptor.getParam<float>(k_region_keys[i]).value_or(OperationRanges::getToneCurveRegionDefaultValue()),
+                                OperationRanges::getToneCurveRegionMinValue(), OperationRanges::getToneCurveRegionMaxValue());
+    }
+    return offsets;
+}
+
+/**
+ * @brief Parametric curve: a raised-cosine bump per region, pinned to 0 and 1 at the ends.
+ */
+[[nodiscard]] float evaluateParametric(const std::array<float, 4>& offsets, float u) noexcept
+{
+    float shift = 0.0f;
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        const float center = (2.0f * static_cast<float>(i) + 1.0f) / 8.0f;
+        const float distance = std::abs(u - center);
+        if (offsets[i] != 0.0f && distance < k_region_half_width) {
+            const float bump = 0.5f * (1.0f + std::cos(std::numbers::pi_v<float> * distance / k_region_half_width));
+            shift += offsets[i] * ToneCurve::k_region_gain * bump;
+        }
+    }
+    // The black and white points stay put: the shift fades in over the outer eighths
+    const float pin = std::min({1.0f, 8.0f * u, 8.0f * (1.0f - u)});
+    return std::clamp(u + shift * pin, 0.0f, 1.0f);
+}
+
+/**
+ * @brief Monotone cubic through the control points (Fritsch-Carlson tangents).
+ */
+class PointCurve {
+public:
+    explicit PointCurve(std::vector<ToneCurve::Point> points)
+        : m_points(std::move(points))
+        , m_tangents(m_points.size(), 0.0f)
+    {
+        const std::size_t n = m_points.size();
+        if (n < 2) {
+            return;
+        }
+
+        std::vector<float> secants(n - 1);
+        for (std::size_t k = 0; k + 1 < n; ++k) {
+            secants[k] = (m_points[k + 1].m_y - m_points[k].m_y) / (m_points[k + 1].m_x - m_points[k].m_x);
+        }
+
+        m_tangents.front() = secants.front();
+        m_tangents.back() = secants.back();
+        for (std::size_t k = 1; k + 1 < n; ++k) {
+            // Zero at local extrema, so that the curve never overshoots its points
+            m_tangents[k] = secants[k - 1] * secants[k] > 0.0f ? 0.5f * (secants[k - 1] + secants[k]) : 0.0f;
+        }
+
+        for (std::size_t k = 0; k + 1 < n; ++k) {
+            if (secants[k] == 0.0f) {
+                m_tangents[k] = 0.0f;
+                m_tangents[k + 1] = 0.0f;
+                continue;
+            }
+            const float a = m_tangents[k] / secants[k];
+            const float b = m_tangents[k + 1] / secants[k];
+            const float norm = a * a + b * b;
+            if (norm > 9.0f) {
+                const float scale = 3.0f / std::sqrt(norm);
+                m_tangents[k] = scale * a * secants[k];
+                m_tangents[k + 1] = scale * b * secants[k];
+            }
+        }
+    }
+
+    [[nodiscard]] float operator()(float u) const noexcept
+    {
+        if (m_points.size() < 2) {
+            return u;
+        }
+        if (u <= m_points.front().m_x) return m_points.front().m_y;
+        if (u >= m_points.back().m_x) return m_points.back().m_y;
+
+        const auto next = std::ranges::upper_bound(m_points, u, {}, &ToneCurve::Point::m_x);
+        const std::size_t k = static_cast<std::size_t>(next - m_points.begin()) - 1;
+        const float h = m_points[k + 1].m_x - m_points[k].m_x;
+        const float t = (u - m_points[k].m_x) / h;
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+
+        const float value = (2.0f * t3 - 3.0f * t2 + 1.0f) * m_points[k].m_y
+                            + (t3 - 2.0f * t2 + t) * h * m_tangents[k]
+                            + (-2.0f * t3 + 3.0f * t2) * m_points[k + 1].m_y
+                            + (t3 - t2) * h * m_tangents[k + 1];
+        return std::clamp(value, 0.0f, 1.0f);
+    }
+
+private:
+    std::vector<ToneCurve::Point> m_points;
+    std::vector<float> m_tangents;
+};
+
+} // anonymous namespace
+
+std::optional<std::vector<ToneCurve::Point>> ToneCurve::parsePoints(std::string_view text)
+{
+    std::vector<Point> points;
+    while (!text.empty()) {
+        const std::size_t end = text.find(';');
+        const std::string_view entry = text.substr(0, end);
+        text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+
+        if (entry.find_first_not_of(' ') == std::string_view::npos) {
+            continue; // Tolerates a trailing separator
+        }
+        const std::size_t comma = entry.find(',');
+        if (comma == std::string_view::npos) {
+            return std::nullopt;
+        }
+        const auto x = parseFloat(entry.substr(0, comma));
+        const auto y = parseFloat(entry.substr(comma + 1));
+        if (!x || !y) {
+            return std::nullopt;
+        }
+        points.push_back({std::clamp(*x, 0.0f, 1.0f), std::clamp(*y, 0.0f, 1.0f)});
+    }
+
+    // Stable: of the points sharing an x, the last one written is kept
+    std::ranges::stable_sort(points, {}, &Point::m_x);
+    std::vector<Point> unique;
+    unique.reserve(points.size());
+    for (const Point& point : points) {
+        if (!unique.empty() && unique.back().m_x == point.m_x) {
+            unique.back() = point;
+        } else {
+            unique.push_back(point);
+        }
+    }
+    return unique;
+}
+
+std::string ToneCurve::formatPoints(std::span<const Point> points)
+{
+    std::string text;
+    for (const Point& point : points) {
+        if (!text.empty()) {
+            text += ';';
+        }
+        text += std::format("{},{}", point.m_x, point.m_y);
+    }
+    return text;
+}
+
+bool ToneCurve::isIdentity(const OperationDescriptor& descriptor)
+{
+    for (const float offset : regionOffsets(descriptor)) {
+        if (offset != 0.0f) {
+            return false;
+        }
+    }
+    const auto text = descriptor.getParam<std::string>(ParameterKey::CurvePoints);
+    if (!text) {
+        return true;
+    }
+    const auto points = parsePoints(text.value());
+    // On the diagonal and spanning the range (the curve is flat past its end points)
+    return !points || points->size() < 2
+           || (points->front() == Point{0.0f, 0.0f} && points->back() == Point{1.0f, 1.0f}
+               && std::ranges::all_of(*points, [](const Point& point) { return point.m_x == point.m_y; }));
+}
+
+void ToneCurve::bake(const OperationDescriptor& descriptor, std::span<float> table)
+{
+    std::vector<Point> points;
+    if (const auto text = descriptor.getParam<std::string>(ParameterKey::CurvePoints)) {
+        if (auto parsed = parsePoints(text.value())) {
+            points = std::move(*parsed);
+        } else {
+            spdlog::warn("[ToneCurve::bake]: Malformed curve points '{}'. Point curve ignored.", text.value());
+        }
+    }
+
+    const PointCurve point_curve{std::move(points)};
+    const auto offsets = regionOffsets(descriptor);
+    const float last = static_cast<float>(table.size() - 1);
+
+    float previous = 0.0f;
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        const float u = static_cast<float>(i) / last;
+        // Overlapping bumps may fold the parametric curve: keep it non-decreasing
+        previous = std::max(previous, evaluateParametric(offsets, u));
+        table[i] = point_curve(previous);
+    }
+}
+
+Halide::Buffer<float> ToneCurve::bake(const OperationDescriptor& descriptor)
+{
+    Halide::Buffer<float> table(k_table_size);
+    bake(descriptor, std::span<float>(table.data(), static_cast<std::size_t>(k_table_size)));
+    return table;
+}
+
+Halide::Buffer<float> ToneCurve::identity()
+{
+    Halide::Buffer<float> table(k_table_size);
+    for (int i = 0; i < k_table_size; ++i) {
+        table(i) = static_cast<float>(i) / static_cast<float>(k_table_size - 1);
+    }
+    return table;
+}
+
+} // namespace CaptureMoment::Core::Operations
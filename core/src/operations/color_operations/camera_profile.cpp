@@ -0,0 +1,174 @@
+/**
+ * @file camera_profile.cpp
+ * @brief Implementation of CameraProfile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/camera_profile.h"
+#include "operations/operation_ranges.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <system_error>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Linear sRGB (D65) to linear ProPhoto RGB (D50, Bradford adapted), row-major.
+ */
+constexpr std::array<float, 9> k_srgb_to_prophoto{
+    0.529280f, 0.330152f, 0.140567f,
+    0.098366f, 0.873463f, 0.028172f,
+    0.016882f, 0.117663f, 0.865455f
+};
+
+/**
+ * @brief Parses `values.size()` comma-separated floats.
+ */
+[[nodiscard]] bool parseFloats(std::string_view text, std::span<float> values)
+{
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const std::size_t end = text.find(',');
+        if ((end == std::string_view::npos) != (i + 1 == values.size())) {
+            return false;
+        }
+        const std::string_view entry = text.substr(0, end);
+        const auto [last, error] = std::from_chars(entry.data(), entry.data() + entry.size(), values[i]);
+        if (error != std::errc{} || last != entry.data() + entry.size() || !std::isfinite(values[i])) {
+            return false;
+        }
+        text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+    }
+    return true;
+}
+
+[[nodiscard]] float clampShift(float shift) noexcept
+{
+    return std::isfinite(shift) ? std::clamp(shift, OperationRanges::getWhiteBalanceShiftMinValue(),
+                                             OperationRanges::getWhiteBalanceShiftMaxValue())
+                                : OperationRanges::getWhiteBalanceShiftDefaultValue();
+}
+
+} // anonymous namespace
+
+std::optional<CameraProfile> CameraProfile::fromLibRaw(std::span<const float> cam_mul, std::span<const float> rgb_cam)
+{
+    const std::size_t columns = rgb_cam.size() / 3;
+    if (cam_mul.size() < 3 || (columns != 3 && columns != 4) || rgb_cam.size() != 3 * columns) {
+        return std::nullopt;
+    }
+
+    // Normalized to green; a zero green (no as-shot data) or a non-positive multiplier is unusable
+    const float green = cam_mul[1];
+    if (!(green > 0.0f)) {
+        return std::nullopt;
+    }
+    CameraProfile profile;
+    for (std::size_t i = 0; i < 3; ++i) {
+        profile.m_multipliers[i] = cam_mul[i] / green;
+        if (!(profile.m_multipliers[i] > 0.0f) || !std::isfinite(profile.m_multipliers[i])) {
+            return std::nullopt;
+        }
+    }
+
+    // Camera -> sRGB (LibRaw), then sRGB -> ProPhoto (the working space)
+    bool any = false;
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 3; ++col) {
+            float sum = 0.0f;
+            for (std::size_t k = 0; k < 3; ++k) {
+                sum += k_srgb_to_prophoto[row * 3 + k] * rgb_cam[k * columns + col];
+            }
+            if (!std::isfinite(sum)) {
+                return std::nullopt;
+            }
+            any = any || sum != 0.0f;
+            profile.m_matrix[row * 3 + col] = sum;
+        }
+    }
+    if (!any) {
+        return std::nullopt;
+    }
+    return profile;
+}
+
+std::optional<CameraProfile> CameraProfile::parse(std::string_view text)
+{
+    const std::size_t separator = text.find(';');
+    if (separator == std::string_view::npos) {
+        return std::nullopt;
+    }
+    CameraProfile profile;
+    if (!parseFloats(text.substr(0, separator), profile.m_multipliers)
+        || !parseFloats(text.substr(separator + 1), profile.m_matrix)) {
+        return std::nullopt;
+    }
+    if (std::ranges::any_of(profile.m_multipliers, [](float multiplier) { return !(multiplier > 0.0f); })) {
+        return std::nullopt;
+    }
+    return profile;
+}
+
+std::string CameraProfile::format() const
+{
+    std::string text = std::format("{},{},{};", m_multipliers[0], m_multipliers[1], m_multipliers[2]);
+    for (std::size_t i = 0; i < m_matrix.size(); ++i) {
+        if (i > 0) {
+            text += ',';
+        }
+        text += std::format("{}", m_matrix[i]);
+    }
+    return text;
+}
+
+std::array<float, 3> CameraProfile::multipliers(float temperature, float tint) const noexcept
+{
+    // Warmer: more red, less blue (the ratio moves by k_temperature_stops); magenta: less green
+    const float half_stops = 0.5f * k_temperature_stops * clampShift(temperature);
+    return {
+        m_multipliers[0] * std::exp2(half_stops),
+        m_multipliers[1] * std::exp2(-k_tint_stops * clampShift(tint)),
+        m_multipliers[2] * std::exp2(-half_stops)
+    };
+}
+
+float CameraProfile::clipLevel(float temperature, float tint) const noexcept
+{
+    return std::ranges::min(multipliers(temperature, tint));
+}
+
+void CameraProfile::attachTo(std::vector<OperationDescriptor>& operations, const std::optional<std::string>& profile)
+{
+    if (!profile) {
+        return;
+    }
+
+    auto it = std::ranges::find(operations, OperationType::WhiteBalance, &OperationDescriptor::type);
+    if (it == operations.end()) {
+        OperationDescriptor descriptor;
+        descriptor.id = k_inserted_id;
+        descriptor.type = OperationType::WhiteBalance;
+        descriptor.name = "WhiteBalance";
+        it = operations.insert(operations.begin(), std::move(descriptor));
+    } else if (it != operations.begin()) {
+        std::rotate(operations.begin(), it, it + 1);
+        it = operations.begin();
+    }
+
+    // A disabled white balance still develops the RAW: only the shifts are dropped
+    if (!it->enabled) {
+        it->enabled = true;
+        it->params.set(ParameterKey::Temperature, OperationRanges::getWhiteBalanceShiftDefaultValue());
+        it->params.set(ParameterKey::Tint, OperationRanges::getWhiteBalanceShiftDefaultValue());
+    }
+    it->setParam(ParameterKey::CameraProfile, *profile);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,275 @@
+/**
+ * @file cube_lut.cpp
+ * @brief Implementation of CubeLut.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/cube_lut.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @struct CachedTable
+ * @brief A loaded table and the modification time of its file.
+ */
+struct CachedTable {
+    std::filesystem::file_time_type m_modified;
+    Halide::Buffer<float> m_table;
+};
+
+std::mutex& cacheMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<std::string, CachedTable>& cache()
+{
+    static std::unordered_map<std::string, CachedTable> tables;
+    return tables;
+}
+
+/**
+ * @brief Whether three domain bounds are all `expected` (the only supported domain).
+ */
+[[nodiscard]] bool isDefaultDomain(std::istringstream& line, float expected)
+{
+    float a = 0.0f, b = 0.0f, c = 0.0f;
+    return static_cast<bool>(line >> a >> b >> c) && a == expected && b == expected && c == expected;
+}
+
+} // anonymous namespace
+
+std::expected<Halide::Buffer<float>, ErrorHandling::CoreError> CubeLut::parse(std::istream& stream)
+{
+    Halide::Buffer<float> table;
+    int size = 0;
+    std::size_t entry = 0;
+    std::size_t entry_count = 0;
+    float* data = nullptr;
+
+    std::string text;
+    while (std::getline(stream, text)) {
+        if (const auto comment = text.find('#'); comment != std::string::npos) {
+            text.resize(comment);
+        }
+        std::istringstream line(text);
+        std::string keyword;
+        if (!(line >> keyword)) {
+            continue; // Blank line
+        }
+
+        if (keyword == "TITLE") {
+            continue;
+        }
+        if (keyword == "LUT_1D_SIZE") {
+            spdlog::warn("[CubeLut::parse]: 1D LUTs are not supported.");
+            return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+        }
+        if (keyword == "DOMAIN_MIN" || keyword == "DOMAIN_MAX") {
+            if (!isDefaultDomain(line, keyword == "DOMAIN_MIN" ? 0.0f : 1.0f)) {
+                spdlog::warn("[CubeLut::parse]: Only the [0, 1] input domain is supported.");
+                return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+            }
+            continue;
+        }
+        if (keyword == "LUT_3D_INPUT_RANGE") {
+            float low = 0.0f, high = 0.0f;
+            if (!(line >> low >> high) || low != 0.0f || high != 1.0f) {
+                spdlog::warn("[CubeLut::parse]: Only the [0, 1] input range is supported.");
+                return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+            }
+            continue;
+        }
+        if (keyword == "LUT_3D_SIZE") {
+            if (!(line >> size) || size < 2 || size > k_max_size || data) {
+                spdlog::warn("[CubeLut::parse]: Invalid or repeated LUT_3D_SIZE.");
+                return std::unexpected(ErrorHandling::CoreError::DecodingError);
+            }
+            table = Halide::Buffer<float>(k_entry_channels, size, size, size);
+            table.fill(0.0f);
+            data = table.data();
+            entry_count = static_cast<std::size_t>(size) * size * size;
+            continue;
+        }
+
+        // An entry: "r g b", r varying fastest, which is the table's memory order
+        std::istringstream values(text);
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        if (!(values >> r >> g >> b)) {
+            spdlog::warn("[CubeLut::parse]: Unknown keyword '{}'.", keyword);
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        if (!data || entry >= entry_count) {
+            spdlog::warn("[CubeLut::parse]: Entry outside of the declared LUT_3D_SIZE.");
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        float* out = data + entry * k_entry_channels;
+        out[0] = r;
+        out[1] = g;
+        out[2] = b;
+        ++entry;
+    }
+
+    if (!data || entry != entry_count) {
+        spdlog::warn("[CubeLut::parse]: Expected {} entries, read {}.", entry_count, entry);
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    return table;
+}
+
+std::expected<Halide::Buffer<float>, ErrorHandling::CoreError> CubeLut::load(const std::filesystem::path& path)
+{
+    std::error_code error;
+    const auto modified = std::filesystem::last_write_time(path, error);
+    if (error) {
+        spdlog::warn("[CubeLut::load]: Cannot find '{}': {}", path.string(), error.message());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    std::lock_guard lock(cacheMutex());
+    auto& tables = cache();
+    if (auto it = tables.find(path.string()); it != tables.end() && it->second.m_modified == modified) {
+        return it->second.m_table;
+    }
+
+    std::ifstream file(path);
+    if (!file) {
+        spdlog::warn("[CubeLut::load]: Cannot open '{}'.", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+    auto parsed = parse(file);
+    if (!parsed) {
+        spdlog::error("[CubeLut::load]: Failed to parse '{}'.", path.string());
+        return parsed;
+    }
+
+    spdlog::debug("[CubeLut::load]: Loaded '{}' ({}^3 entries).", path.string(), parsed->dim(1).extent());
+    tables.insert_or_assign(path.string(), CachedTable{modified, *parsed});
+    return parsed;
+}
+
+void CubeLut::clearCache()
+{
+    std::lock_guard lock(cacheMutex());
+    cache().clear();
+}
+
+Halide::Buffer<float> CubeLut::identity(int size)
+{
+    Halide::Buffer<float> table(k_entry_channels, size, size, size);
+    const float last = static_cast<float>(size - 1);
+    for (int b = 0; b < size; ++b) {
+        for (int g = 0; g < size; ++g) {
+            for (int r = 0; r < size; ++r) {
+                table(0, r, g, b) = static_cast<float>(r) / last;
+                table(1, r, g, b) = static_cast<float>(g) / last;
+                table(2, r, g, b) = static_cast<float>(b) / last;
+                table(3, r, g, b) = 0.0f;
+            }
+        }
+    }
+    return table;
+}
+
+Halide::Expr CubeLut::sampleTetrahedral(const Halide::ImageParam& table,
+                                        const Halide::Expr& r,
+                                        const Halide::Expr& g,
+                                        const Halide::Expr& b,
+                                        const Halide::Expr& channel)
+{
+    // Lattice cell and position inside it, per axis (the table is a cube: one size for all axes)
+    const Halide::Expr last = table.dim(1).extent() - 1;
+    auto cell = [&last](const Halide::Expr& value) {
+        const Halide::Expr position = Halide::clamp(value, 0.0f, 1.0f) * Halide::cast<float>(last);
+        const Halide::Expr index = Halide::clamp(Halide::cast<int>(Halide::floor(position)), 0, last - 1);
+        return std::make_pair(index, position - Halide::cast<float>(index));
+    };
+    const auto [r0, fr] = cell(r);
+    const auto [g0, fg] = cell(g);
+    const auto [b0, fb] = cell(b);
+
+    // The tetrahedron runs from the cell origin along the axis of the largest fraction (corner A),
+    // then the next largest (corner B), to the far corner. Ties pick either side: both agree there.
+    const Halide::Expr r_a = Halide::select(fr >= fg && fr >= fb, 1, 0);
+    const Halide::Expr g_a = Halide::select(r_a == 0 && fg >= fb, 1, 0);
+    const Halide::Expr b_a = 1 - r_a - g_a;
+
+    const Halide::Expr r_lo = Halide::select(r_a == 1, 0, g_a == 1, Halide::select(fr < fb, 1, 0), Halide::select(fr < fg, 1, 0));
+    const Halide::Expr g_lo = Halide::select(r_a == 1, Halide::select(fg < fb, 1, 0), g_a == 1, 0, Halide::select(fg <= fr, 1, 0));
+    const Halide::Expr b_lo = 1 - r_lo - g_lo;
+
+    const Halide::Expr high = Halide::max(fr, fg, fb);
+    const Halide::Expr low = Halide::min(fr, fg, fb);
+    const Halide::Expr middle = fr + fg + fb - high - low;
+
+    auto corner = [&](const Halide::Expr& dr, const Halide::Expr& dg, const Halide::Expr& db) {
+        return table(table.dim(0).min() + channel,
+                     table.dim(1).min() + r0 + dr,
+                     table.dim(2).min() + g0 + dg,
+                     table.dim(3).min() + b0 + db);
+    };
+
+    return (1.0f - high) * corner(0, 0, 0)
+           + (high - middle) * corner(r_a, g_a, b_a)
+           + (middle - low) * corner(1 - r_lo, 1 - g_lo, 1 - b_lo)
+           + low * corner(1, 1, 1);
+}
+
+std::array<float, 3> CubeLut::sampleTetrahedral(const Halide::Buffer<float>& table, float r, float g, float b)
+{
+    // Same cell, tetrahedron and weights as the Halide version above
+    const int last = table.dim(1).extent() - 1;
+    auto cell = [last](float value) {
+        const float position = std::clamp(value, 0.0f, 1.0f) * static_cast<float>(last);
+        const int index = std::clamp(static_cast<int>(std::floor(position)), 0, last - 1);
+        return std::make_pair(index, position - static_cast<float>(index));
+    };
+    const auto [r0, fr] = cell(r);
+    const auto [g0, fg] = cell(g);
+    const auto [b0, fb] = cell(b);
+
+    const int r_a = fr >= fg && fr >= fb ? 1 : 0;
+    const int g_a = r_a == 0 && fg >= fb ? 1 : 0;
+    const int b_a = 1 - r_a - g_a;
+
+    const int r_lo = r_a == 1 ? 0 : (g_a == 1 ? (fr < fb ? 1 : 0) : (fr < fg ? 1 : 0));
+    const int g_lo = r_a == 1 ? (fg < fb ? 1 : 0) : (g_a == 1 ? 0 : (fg <= fr ? 1 : 0));
+    const int b_lo = 1 - r_lo - g_lo;
+
+    const float high = std::max({fr, fg, fb});
+    const float low = std::min({fr, fg, fb});
+    const float middle = fr + fg + fb - high - low;
+
+    std::array<float, 3> color{};
+    for (int channel = 0; channel < 3; ++channel) {
+        auto corner = [&](int dr, int dg, int db) {
+            return table(table.dim(0).min() + channel,
+                         table.dim(1).min() + r0 + dr,
+                         table.dim(2).min() + g0 + dg,
+                         table.dim(3).min() + b0 + db);
+        };
+        color[channel] = (1.0f - high) * corner(0, 0, 0)
+                         + (high - middle) * corner(r_a, g_a, b_a)
+                         + (middle - low) * corner(1 - r_lo, 1 - g_lo, 1 - b_lo)
+                         + low * corner(1, 1, 1);
+    }
+    return color;
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,164 @@
+/**
+ * @file operation_lut3d.cpp
+ * @brief Implementation of OperationLut3D
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/operation_lut3d.h"
+#include "operations/standalone_execution.h"
+#include "operations/fallback_kernels.h"
+#include "operations/color_operations/cube_lut.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <string>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Blends R, G and B towards their image through the lattice; alpha unchanged.
+ */
+[[nodiscard]] Halide::Func applyLut3D(
+    const Halide::Func& input,
+    const Halide::ImageParam& table,
+    const Halide::Expr& amount,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    const Halide::Expr safe_amount = Halide::clamp(amount, OperationLut3D::MIN_LUT3D_VALUE, OperationLut3D::MAX_LUT3D_VALUE);
+
+    // The lookup reads channel c of the lattice: the padding entry for alpha, discarded below
+    Halide::Func lut_func("lut3d_op");
+    lut_func(x, y, c) = Halide::select(
+        c < 3,
+        Halide::lerp(input(x, y, c),
+                     CubeLut::sampleTetrahedral(table, input(x, y, 0), input(x, y, 1), input(x, y, 2), c),
+                     safe_amount),
+        input(x, y, c) // Alpha unchanged
+        );
+    return lut_func;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationLut3D::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationLut3D::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationLut3D::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: Extract Parameters
+    const auto path_res = descriptor.getParam<std::string>(ParameterKey::LutPath);
+    if (!path_res || path_res.value().empty()) {
+        CM_LOG_TRACE(Operations, "OperationLut3D::execute: No LUT file, skipping");
+        return {};
+    }
+    const float amount = std::clamp(descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_LUT3D_VALUE),
+                                    MIN_LUT3D_VALUE, MAX_LUT3D_VALUE);
+
+    // Step 3: No-Op Optimization
+    if (amount <= MIN_LUT3D_VALUE) {
+        CM_LOG_TRACE(Operations, "OperationLut3D::execute: Amount is zero, skipping");
+        return {};
+    }
+
+    // A missing file is an error here (the fused graph would bind the identity). The load is cached.
+    auto table_res = CubeLut::load(path_res.value());
+    if (!table_res) {
+        spdlog::error("OperationLut3D::execute: Failed to load LUT '{}'", path_res.value());
+        return std::unexpected(table_res.error());
+    }
+    CM_LOG_DEBUG(Operations, "OperationLut3D::execute: Applying '{}' with amount={:.2f}", path_res.value(), amount);
+
+    // Step 4: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationLut3D::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& /*luminance*/
+    ) const
+{
+    // Declared as runtime inputs of the graph: the amount and the file change without recompilation.
+    const Halide::Param<float>& amount = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_LUT3D_VALUE);
+    const Halide::ImageParam& table = params.lut(k_table_key, CubeLut::identity());
+
+    CM_LOG_TRACE(Operations, "OperationLut3D::appendToFusedPipeline: Fusing with a tetrahedral lattice lookup");
+    return applyLut3D(input_func, table, amount, x, y, c);
+}
+
+void OperationLut3D::updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const
+{
+    params.bindScalars(descriptor);
+
+    // Cached after the first load: a stat and a map lookup per edit, and the same buffer is rebound
+    const auto path_res = descriptor.getParam<std::string>(ParameterKey::LutPath);
+    if (path_res && !path_res.value().empty()) {
+        if (auto table_res = CubeLut::load(path_res.value())) {
+            params.setLut(k_table_key, std::move(table_res.value()));
+            return;
+        }
+        spdlog::warn("OperationLut3D::updateFusionParameters: LUT '{}' unavailable, applying the identity", path_res.value());
+    }
+    params.setLut(k_table_key, CubeLut::identity());
+}
+
+bool OperationLut3D::isIdentity(const OperationDescriptor& descriptor) const
+{
+    const auto path_res = descriptor.getParam<std::string>(ParameterKey::LutPath);
+    return !path_res || path_res.value().empty()
+           || descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_LUT3D_VALUE) <= MIN_LUT3D_VALUE;
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationLut3D::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationLut3D] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    auto path_res = params.getParam<std::string>(ParameterKey::LutPath);
+    if (!path_res) {
+        spdlog::warn("[OperationLut3D] executeOnImageRegion: Param 'lut_path' missing, skipping.");
+        return {};
+    }
+
+    return FallbackKernels::lut3d(region, params);
+}
+
+} // namespace CaptureMoment::Core::Operations
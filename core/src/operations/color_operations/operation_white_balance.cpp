@@ -0,0 +1,202 @@
+/**
+ * @file operation_white_balance.cpp
+ * @brief Implementation of OperationWhiteBalance
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/operation_white_balance.h"
+#include "operations/standalone_execution.h"
+#include "operations/color_operations/camera_profile.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <string>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @struct Coefficients
+ * @brief Gains, matrix and clip level of a descriptor.
+ */
+struct Coefficients {
+    std::array<float, 3> m_gains{};
+    std::array<float, 9> m_matrix{};
+    float m_clip{std::numeric_limits<float>::max()};
+};
+
+/**
+ * @brief Resolves the coefficients of a descriptor (identity profile if it has none).
+ */
+[[nodiscard]] Coefficients coefficientsOf(const OperationDescriptor& descriptor)
+{
+    CameraProfile profile;
+    bool from_raw = false;
+    if (const auto text = descriptor.getParam<std::string>(ParameterKey::CameraProfile); text && !text.value().empty()) {
+        if (auto parsed = CameraProfile::parse(text.value())) {
+            profile = *parsed;
+            from_raw = true;
+        } else {
+            spdlog::warn("[OperationWhiteBalance]: Malformed camera profile '{}'. Identity applied.", text.value());
+        }
+    }
+
+    const float temperature = descriptor.getParam<float>(ParameterKey::Temperature).value_or(OperationWhiteBalance::DEFAULT_SHIFT_VALUE);
+    const float tint = descriptor.getParam<float>(ParameterKey::Tint).value_or(OperationWhiteBalance::DEFAULT_SHIFT_VALUE);
+
+    Coefficients coefficients;
+    coefficients.m_gains = profile.multipliers(temperature, tint);
+    coefficients.m_matrix = profile.m_matrix;
+    // Developed sources are not clipped: their highlights were handled by their own decoder
+    if (from_raw) {
+        coefficients.m_clip = profile.clipLevel(temperature, tint);
+    }
+    return coefficients;
+}
+
+/**
+ * @brief Balances (and clips) R, G and B, then applies the matrix; alpha unchanged.
+ */
+[[nodiscard]] Halide::Func applyWhiteBalance(
+    const Halide::Func& input,
+    const std::array<Halide::Expr, 3>& gains,
+    const std::array<Halide::Expr, 9>& matrix,
+    const Halide::Expr& clip,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    std::array<Halide::Expr, 3> balanced;
+    for (int i = 0; i < 3; ++i) {
+        balanced[i] = Halide::min(input(x, y, i) * gains[i], clip);
+    }
+    auto row = [&](int r) {
+        return matrix[r * 3] * balanced[0] + matrix[r * 3 + 1] * balanced[1] + matrix[r * 3 + 2] * balanced[2];
+    };
+
+    Halide::Func wb_func("white_balance_op");
+    wb_func(x, y, c) = Halide::select(
+        c == 0, row(0),
+        c == 1, row(1),
+        c == 2, row(2),
+        input(x, y, c) // Alpha unchanged
+        );
+    return wb_func;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationWhiteBalance::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationWhiteBalance::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationWhiteBalance::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: Extract Parameters
+    const Coefficients coefficients = coefficientsOf(descriptor);
+    CM_LOG_DEBUG(Operations, "OperationWhiteBalance::execute: Applying gains ({:.3f}, {:.3f}, {:.3f})",
+                 coefficients.m_gains[0], coefficients.m_gains[1], coefficients.m_gains[2]);
+
+    // Step 3: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationWhiteBalance::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& /*luminance*/
+    ) const
+{
+    // Declared as runtime inputs of the graph: 13 scalars, rebound on every white balance edit.
+    // They have no descriptor key: updateFusionParameters computes them.
+    std::array<Halide::Expr, 3> gains;
+    for (std::size_t i = 0; i < gains.size(); ++i) {
+        gains[i] = params.scalar(k_gain_keys[i], 1.0f);
+    }
+    std::array<Halide::Expr, 9> matrix;
+    for (std::size_t i = 0; i < matrix.size(); ++i) {
+        matrix[i] = params.scalar(k_matrix_keys[i], i % 4 == 0 ? 1.0f : 0.0f);
+    }
+    const Halide::Param<float>& clip = params.scalar(k_clip_key, std::numeric_limits<float>::max());
+
+    CM_LOG_TRACE(Operations, "OperationWhiteBalance::appendToFusedPipeline: Fusing with a 3x3 color matrix");
+    return applyWhiteBalance(input_func, gains, matrix, clip, x, y, c);
+}
+
+void OperationWhiteBalance::updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const
+{
+    const Coefficients coefficients = coefficientsOf(descriptor);
+    for (std::size_t i = 0; i < k_gain_keys.size(); ++i) {
+        params.setScalar(k_gain_keys[i], coefficients.m_gains[i]);
+    }
+    for (std::size_t i = 0; i < k_matrix_keys.size(); ++i) {
+        params.setScalar(k_matrix_keys[i], coefficients.m_matrix[i]);
+    }
+    params.setScalar(k_clip_key, coefficients.m_clip);
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationWhiteBalance::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationWhiteBalance] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const std::size_t channels = region.channels();
+    if (channels < 3) {
+        spdlog::warn("[OperationWhiteBalance] executeOnImageRegion: {} channel(s), skipping.", channels);
+        return {};
+    }
+
+    const Coefficients coefficients = coefficientsOf(params);
+    const auto& gains = coefficients.m_gains;
+    const auto& m = coefficients.m_matrix;
+
+    const std::span<float> pixels = region.getBuffer();
+    for (std::size_t i = 0; i + channels <= pixels.size(); i += channels) {
+        const float r = std::min(pixels[i] * gains[0], coefficients.m_clip);
+        const float g = std::min(pixels[i + 1] * gains[1], coefficients.m_clip);
+        const float b = std::min(pixels[i + 2] * gains[2], coefficients.m_clip);
+        pixels[i] = m[0] * r + m[1] * g + m[2] * b;
+        pixels[i + 1] = m[3] * r + m[4] * g + m[5] * b;
+        pixels[i + 2] = m[6] * r + m[7] * g + m[8] * b;
+    }
+
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Operations
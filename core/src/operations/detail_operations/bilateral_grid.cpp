@@ -0,0 +1,81 @@
+/**
+ * @file bilateral_grid.cpp
+ * @brief Implementation of BilateralGrid.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/bilateral_grid.h"
+
+#include <string>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief 5-tap binomial blur (1 4 6 4 1) of `grid` along the axis `offset` moves.
+ * @details Unnormalized: the slice divides the blurred sum by the blurred count.
+ */
+template<typename OffsetFunction>
+[[nodiscard]] Halide::Expr binomial(const OffsetFunction& offset)
+{
+    return offset(-2) + 4.0f * offset(-1) + 6.0f * offset(0) + 4.0f * offset(1) + offset(2);
+}
+
+} // anonymous namespace
+
+BilateralGrid::Result BilateralGrid::smooth(const Halide::Func& input, const Halide::Var& x, const Halide::Var& y)
+{
+    Result result;
+    Halide::Var z("grid_z"), k("grid_k");
+
+    // Splat: (sum, count) of the pixels of each cell, by luminance bin.
+    // Cell (i, j) is centered on pixel (i * s, j * s), as the slice below expects.
+    constexpr int s = k_cell_size;
+    Halide::RDom cell(0, s, 0, s, "grid_cell");
+    const Halide::Expr sample = Halide::clamp(input(x * s + cell.x - s / 2, y * s + cell.y - s / 2), 0.0f, 1.0f);
+    const Halide::Expr bin = Halide::cast<int>(sample / k_range_sigma + 0.5f);
+
+    Halide::Func histogram("grid_histogram");
+    histogram(x, y, z, k) = 0.0f;
+    histogram(x, y, bin, k) += Halide::select(k == 0, sample, 1.0f);
+    result.m_stages.push_back(histogram);
+
+    // Blur along the bins, then x, then y
+    Halide::Func blur_z("grid_blur_z");
+    blur_z(x, y, z, k) = binomial([&](int d) { return histogram(x, y, z + d, k); });
+    Halide::Func blur_x("grid_blur_x");
+    blur_x(x, y, z, k) = binomial([&](int d) { return blur_z(x + d, y, z, k); });
+    Halide::Func blur_y("grid_blur_y");
+    blur_y(x, y, z, k) = binomial([&](int d) { return blur_x(x, y + d, z, k); });
+    result.m_stages.push_back(blur_z);
+    result.m_stages.push_back(blur_x);
+    result.m_stages.push_back(blur_y);
+
+    // Slice: trilinear read at the pixel's position and luminance
+    const Halide::Expr value = Halide::clamp(input(x, y), 0.0f, 1.0f);
+    const Halide::Expr zv = value / k_range_sigma;
+    const Halide::Expr zi = Halide::cast<int>(Halide::floor(zv));
+    const Halide::Expr zf = zv - Halide::cast<float>(zi);
+    const Halide::Expr xi = x / s;
+    const Halide::Expr yi = y / s;
+    const Halide::Expr xf = Halide::cast<float>(x % s) / static_cast<float>(s);
+    const Halide::Expr yf = Halide::cast<float>(y % s) / static_cast<float>(s);
+
+    auto at_bin = [&](const Halide::Expr& bin_index, int component) {
+        return Halide::lerp(
+            Halide::lerp(blur_y(xi, yi, bin_index, component), blur_y(xi + 1, yi, bin_index, component), xf),
+            Halide::lerp(blur_y(xi, yi + 1, bin_index, component), blur_y(xi + 1, yi + 1, bin_index, component), xf),
+            yf);
+    };
+    const Halide::Expr sum = Halide::lerp(at_bin(zi, 0), at_bin(zi + 1, 0), zf);
+    const Halide::Expr count = Halide::lerp(at_bin(zi, 1), at_bin(zi + 1, 1), zf);
+
+    // The pixel's own cells always hold some weight; the guard keeps the division finite
+    result.m_output = Halide::Func("bilateral_grid");
+    result.m_output(x, y) = Halide::select(count > 1.0e-6f, sum / count, value);
+    return result;
+}
+
+} // namespace CaptureMoment::Core::Operations
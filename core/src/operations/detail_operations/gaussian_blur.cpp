@@ -0,0 +1,206 @@
+/**
+ * @file gaussian_blur.cpp
+ * @brief Implementation of GaussianBlur.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/gaussian_blur.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Kernel radius in standard deviations.
+ */
+constexpr float k_radius_sigmas = 3.0f;
+
+/**
+ * @brief Lower bound of the kernel sigma, keeping the weights finite at zero radius.
+ */
+constexpr float k_min_kernel_sigma = 0.01f;
+
+/**
+ * @brief Variance the pyramid itself adds at `level`, in pixels of that level.
+ * @details 2-tap boxes at spacings 1, 2, ..., 2^(level-1) add (4^level - 1) / 12 full-resolution
+ *          pixels squared; the bilinear upsample from spacing 2^level adds 4^level / 6.
+ */
+[[nodiscard]] float pyramidVariance(int level) noexcept
+{
+    const double area = std::ldexp(1.0, 2 * level);
+    return static_cast<float>(((area - 1.0) / 12.0 + area / 6.0) / area);
+}
+
+/**
+ * @brief Arguments (x, y, channels...), with x and y replaced.
+ */
+[[nodiscard]] std::vector<Halide::Expr> at(const Halide::Expr& x, const Halide::Expr& y,
+                                           const std::vector<Halide::Var>& channels)
+{
+    std::vector<Halide::Expr> args{x, y};
+    args.insert(args.end(), channels.begin(), channels.end());
+    return args;
+}
+
+/**
+ * @brief Normalized Gaussian weights over [-radius, radius], computed once per realization.
+ */
+[[nodiscard]] Halide::Func makeWeights(const Halide::Expr& kernel_sigma, const Halide::Expr& radius, const std::string& name)
+{
+    Halide::Var i("i");
+    const Halide::Expr safe_sigma = Halide::max(kernel_sigma, k_min_kernel_sigma);
+    auto gaussian = [&](const Halide::Expr& offset) {
+        const Halide::Expr distance = Halide::cast<float>(offset);
+        return Halide::exp(-(distance * distance) / (2.0f * safe_sigma * safe_sigma));
+    };
+
+    Halide::RDom taps(-radius, 2 * radius + 1, name + "_taps");
+    Halide::Func weights(name);
+    weights(i) = gaussian(i) / Halide::sum(gaussian(taps));
+
+    // A handful of entries: on the host, before the passes that read them
+    weights.compute_root();
+    return weights;
+}
+
+/**
+ * @brief Horizontal then vertical pass of the kernel; the horizontal pass is a stage.
+ */
+[[nodiscard]] Halide::Func separable(const Halide::Func& source, const Halide::Func& weights, const Halide::Expr& radius,
+                                     const Halide::Var& x, const Halide::Var& y, const std::vector<Halide::Var>& channels,
+                                     const std::string& name, std::vector<Halide::Func>& stages)
+{
+    Halide::RDom rx(-radius, 2 * radius + 1, name + "_rx");
+    Halide::RDom ry(-radius, 2 * radius + 1, name + "_ry");
+
+    Halide::Func horizontal(name + "_h");
+    horizontal(at(x, y, channels)) = Halide::sum(source(at(x + rx, y, channels)) * weights(rx));
+    stages.push_back(horizontal);
+
+    Halide::Func vertical(name + "_v");
+    vertical(at(x, y, channels)) = Halide::sum(horizontal(at(x, y + ry, channels)) * weights(ry));
+    return vertical;
+}
+
+} // anonymous namespace
+
+int GaussianBlur::levelFor(float sigma) noexcept
+{
+    sigma = std::clamp(sigma, 0.0f, k_max_sigma);
+    if (sigma <= k_direct_max_sigma) {
+        return 0;
+    }
+    return std::clamp(static_cast<int>(std::ceil(std::log2(sigma / k_direct_max_sigma))), 1, k_pyramid_levels);
+}
+
+int GaussianBlur::haloFor(float sigma) noexcept
+{
+    sigma = std::clamp(sigma, 0.0f, k_max_sigma);
+    const int level = levelFor(sigma);
+    if (level == 0) {
+        // Same float expression as the graph's radius0
+        return static_cast<int>(std::ceil(sigma * k_radius_sigmas));
+    }
+
+    // The level's kernel is narrower than sigma / scale (the pyramid adds its own blur); the
+    // bilinear taps and the boxes reach less than 2 level pixels further
+    const int scale = 1 << level;
+    return scale * (static_cast<int>(std::ceil(sigma / static_cast<float>(scale) * k_radius_sigmas)) + 2);
+}
+
+GaussianBlur::Result GaussianBlur::apply(const Halide::Func& input, const Halide::Expr& sigma,
+                                         const Halide::Var& x, const Halide::Var& y, const Halide::Var& c)
+{
+    return build(input, sigma, x, y, {c});
+}
+
+GaussianBlur::Result GaussianBlur::applyPlane(const Halide::Func& input, const Halide::Expr& sigma,
+                                              const Halide::Var& x, const Halide::Var& y)
+{
+    return build(input, sigma, x, y, {});
+}
+
+GaussianBlur::Result GaussianBlur::build(const Halide::Func& input, const Halide::Expr& sigma,
+                                         const Halide::Var& x, const Halide::Var& y,
+                                         const std::vector<Halide::Var>& channels)
+{
+    Result result;
+    auto& stages = result.m_stages;
+
+    // Scalar part of the graph, evaluated once per realization (same logic as levelFor)
+    const Halide::Expr safe_sigma = Halide::clamp(sigma, 0.0f, k_max_sigma);
+    const Halide::Expr level = Halide::select(
+        safe_sigma <= k_direct_max_sigma,
+        0,
+        Halide::clamp(Halide::cast<int>(Halide::ceil(Halide::log(safe_sigma / k_direct_max_sigma) / std::log(2.0f))),
+                      1, k_pyramid_levels));
+
+    // The chain is materialized once: every tap and the pyramid read it
+    Halide::Func source("blur_source");
+    source(at(x, y, channels)) = input(at(x, y, channels));
+    stages.push_back(source);
+
+    // Level 0: direct blur (one tap when a coarser level is selected)
+    const Halide::Expr radius0 = Halide::select(
+        level == 0, Halide::cast<int>(Halide::ceil(safe_sigma * k_radius_sigmas)), 0);
+    const Halide::Func weights0 = makeWeights(safe_sigma, radius0, "blur_weights0");
+    const Halide::Func direct = separable(source, weights0, radius0, x, y, channels, "blur_level0", stages);
+
+    std::vector<std::pair<Halide::Expr, Halide::Expr>> upsampled;
+    Halide::Func previous = source;
+
+    for (int k = 1; k <= k_pyramid_levels; ++k) {
+        const std::string suffix = std::to_string(k);
+
+        // Decimation: 2x2 box of the previous (unblurred) level
+        Halide::Func decimated("blur_pyramid" + suffix);
+        decimated(at(x, y, channels)) = 0.25f * (previous(at(2 * x, 2 * y, channels))
+                                                 + previous(at(2 * x + 1, 2 * y, channels))
+                                                 + previous(at(2 * x, 2 * y + 1, channels))
+                                                 + previous(at(2 * x + 1, 2 * y + 1, channels)));
+        stages.push_back(decimated);
+        previous = decimated;
+
+        // Remaining sigma in pixels of this level, after the pyramid's own blur
+        const float scale = static_cast<float>(1 << k);
+        const Halide::Expr level_sigma = Halide::sqrt(Halide::max(
+            (safe_sigma / scale) * (safe_sigma / scale) - pyramidVariance(k), 0.0f));
+        const Halide::Expr radius = Halide::select(
+            level == k, Halide::cast<int>(Halide::ceil(level_sigma * k_radius_sigmas)), 0);
+        const Halide::Func weights = makeWeights(level_sigma, radius, "blur_weights" + suffix);
+
+        Halide::Func blurred = separable(decimated, weights, radius, x, y, channels, "blur_level" + suffix, stages);
+        stages.push_back(blurred);
+
+        // Bilinear upsample, pixel centers aligned
+        const Halide::Expr u = (Halide::cast<float>(x) + 0.5f) / scale - 0.5f;
+        const Halide::Expr v = (Halide::cast<float>(y) + 0.5f) / scale - 0.5f;
+        const Halide::Expr iu = Halide::cast<int>(Halide::floor(u));
+        const Halide::Expr iv = Halide::cast<int>(Halide::floor(v));
+        const Halide::Expr fu = u - Halide::cast<float>(iu);
+        const Halide::Expr fv = v - Halide::cast<float>(iv);
+
+        const Halide::Expr top = Halide::lerp(blurred(at(iu, iv, channels)), blurred(at(iu + 1, iv, channels)), fu);
+        const Halide::Expr bottom = Halide::lerp(blurred(at(iu, iv + 1, channels)), blurred(at(iu + 1, iv + 1, channels)), fu);
+
+        upsampled.emplace_back(level == k, Halide::lerp(top, bottom, fv));
+    }
+
+    // Unselected levels are single-tap copies: the cost stays bounded whatever the sigma
+    Halide::Expr blurred = direct(at(x, y, channels));
+    for (auto it = upsampled.rbegin(); it != upsampled.rend(); ++it) {
+        blurred = Halide::select(it->first, it->second, blurred);
+    }
+
+    result.m_output = Halide::Func("gaussian_blur");
+    result.m_output(at(x, y, channels)) = blurred;
+    return result;
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,166 @@
+/**
+ * @file guided_upsampling.cpp
+ * @brief Implementation of GuidedUpsampling.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/guided_upsampling.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Moments accumulated per cell and channel: sum of in, out, in * in, in * out.
+ * @details Component 0 of the grid is the pixel count, channel `ch` uses components 1 + 4 * ch to 4 + 4 * ch.
+ */
+constexpr int k_moments = 4;
+
+/**
+ * @brief Components of the fitted grid: the weight, then (a * weight, b * weight) per color channel.
+ */
+constexpr int k_fit_components = 7;
+
+/**
+ * @brief 5-tap binomial blur (1 4 6 4 1) of a grid along the axis `offset` moves.
+ * @details Unnormalized: the fit only reads ratios of moments.
+ */
+template<typename OffsetFunction>
+[[nodiscard]] Halide::Expr binomial(const OffsetFunction& offset)
+{
+    return offset(-2) + 4.0f * offset(-1) + 6.0f * offset(0) + 4.0f * offset(1) + offset(2);
+}
+
+} // anonymous namespace
+
+GuidedUpsampling::Result GuidedUpsampling::reduce(const Halide::Func& input, const Halide::Var& x,
+                                                  const Halide::Var& y, const Halide::Var& c)
+{
+    Result result;
+    constexpr int f = k_factor;
+    constexpr float normalization = 1.0f / static_cast<float>(f * f);
+
+    // Separable box: rows first, then columns
+    Halide::Func rows("guided_reduce_rows");
+    Halide::Expr row_sum = input(x * f, y, c);
+    for (int i = 1; i < f; ++i) {
+        row_sum = row_sum + input(x * f + i, y, c);
+    }
+    rows(x, y, c) = row_sum;
+    result.m_stages.push_back(rows);
+
+    Halide::Expr block_sum = rows(x, y * f, c);
+    for (int j = 1; j < f; ++j) {
+        block_sum = block_sum + rows(x, y * f + j, c);
+    }
+    result.m_output = Halide::Func("guided_reduced");
+    result.m_output(x, y, c) = block_sum * normalization;
+    result.m_stages.push_back(result.m_output);
+    return result;
+}
+
+GuidedUpsampling::Result GuidedUpsampling::upsample(const Halide::Func& input, const Halide::Func& reduced_input,
+                                                    const Halide::Func& reduced_output, const Halide::Var& x,
+                                                    const Halide::Var& y, const Halide::Var& c)
+{
+    Result result;
+    Halide::Var z("guided_z"), k("guided_k");
+
+    // Splat: moments of the reduced pixels of each cell, by luminance bin of the reduced input.
+    // Cell (i, j) is centered on reduced pixel (i * s, j * s), as the slice below expects.
+    constexpr int s = k_cell_size;
+    Halide::Func reduced_luminance("guided_reduced_luminance");
+    reduced_luminance(x, y) = Halide::clamp(toneLuminance(reduced_input, x, y), 0.0f, 1.0f);
+
+    Halide::RDom cell(0, s, 0, s, "guided_cell");
+    const Halide::Expr px = x * s + cell.x - s / 2;
+    const Halide::Expr py = y * s + cell.y - s / 2;
+    const Halide::Expr bin = Halide::cast<int>(reduced_luminance(px, py) / k_range_sigma + 0.5f);
+
+    const Halide::Expr channel = Halide::clamp((k - 1) / k_moments, 0, 2);
+    const Halide::Expr moment = (k - 1) % k_moments;
+    const Halide::Expr in = reduced_input(px, py, channel);
+    const Halide::Expr out = reduced_output(px, py, channel);
+
+    Halide::Func moments("guided_moments");
+    moments(x, y, z, k) = 0.0f;
+    moments(x, y, bin, k) += Halide::select(k == 0, 1.0f,
+                                            moment == 0, in,
+                                            moment == 1, out,
+                                            moment == 2, in * in,
+                                            in * out);
+    result.m_stages.push_back(moments);
+
+    // Blur along the bins, then x, then y: neighboring cells share their fits
+    Halide::Func blur_z("guided_blur_z");
+    blur_z(x, y, z, k) = binomial([&](int d) { return moments(x, y, z + d, k); });
+    Halide::Func blur_x("guided_blur_x");
+    blur_x(x, y, z, k) = binomial([&](int d) { return blur_z(x + d, y, z, k); });
+    Halide::Func blur_y("guided_blur_y");
+    blur_y(x, y, z, k) = binomial([&](int d) { return blur_x(x, y + d, z, k); });
+    result.m_stages.push_back(blur_z);
+    result.m_stages.push_back(blur_x);
+    result.m_stages.push_back(blur_y);
+
+    // Fit: per channel, least squares of out = a * in + b over the cell, regularized towards a = 1.
+    // Stored weighted by the cell's count, so that the slice ignores cells no pixel fell into.
+    const Halide::Expr weight = blur_y(x, y, z, 0);
+    const Halide::Expr safe_weight = Halide::max(weight, 1.0e-6f);
+    const Halide::Expr fit_channel = Halide::clamp((k - 1) / 2, 0, 2);
+    auto mean = [&](int offset) { return blur_y(x, y, z, 1 + k_moments * fit_channel + offset) / safe_weight; };
+    const Halide::Expr mean_in = mean(0);
+    const Halide::Expr mean_out = mean(1);
+    const Halide::Expr variance = Halide::max(mean(2) - mean_in * mean_in, 0.0f);
+    const Halide::Expr covariance = mean(3) - mean_in * mean_out;
+    const Halide::Expr slope = (covariance + k_regularization) / (variance + k_regularization);
+    const Halide::Expr offset = mean_out - slope * mean_in;
+
+    Halide::Func fit("guided_fit");
+    fit(x, y, z, k) = Halide::select(k == 0, weight,
+                                     (k - 1) % 2 == 0, slope * weight,
+                                     offset * weight);
+    fit.bound(k, 0, k_fit_components);
+    result.m_stages.push_back(fit);
+
+    // Slice: trilinear read at the pixel's position (in reduced pixels) and luminance
+    const Halide::Expr level = Halide::clamp(toneLuminance(input, x, y), 0.0f, 1.0f);
+    const Halide::Expr zv = level / k_range_sigma;
+    const Halide::Expr zi = Halide::cast<int>(Halide::floor(zv));
+    const Halide::Expr zf = zv - Halide::cast<float>(zi);
+
+    constexpr float reduced_scale = 1.0f / static_cast<float>(k_factor * s);
+    const Halide::Expr gx = (Halide::cast<float>(x) + 0.5f) * reduced_scale - 0.5f / static_cast<float>(s);
+    const Halide::Expr gy = (Halide::cast<float>(y) + 0.5f) * reduced_scale - 0.5f / static_cast<float>(s);
+    const Halide::Expr xi = Halide::cast<int>(Halide::floor(gx));
+    const Halide::Expr yi = Halide::cast<int>(Halide::floor(gy));
+    const Halide::Expr xf = gx - Halide::cast<float>(xi);
+    const Halide::Expr yf = gy - Halide::cast<float>(yi);
+
+    auto at_bin = [&](const Halide::Expr& bin_index, const Halide::Expr& component) {
+        return Halide::lerp(
+            Halide::lerp(fit(xi, yi, bin_index, component), fit(xi + 1, yi, bin_index, component), xf),
+            Halide::lerp(fit(xi, yi + 1, bin_index, component), fit(xi + 1, yi + 1, bin_index, component), xf),
+            yf);
+    };
+    auto sliced = [&](const Halide::Expr& component) {
+        return Halide::lerp(at_bin(zi, component), at_bin(zi + 1, component), zf);
+    };
+
+    const Halide::Expr color = Halide::clamp(c, 0, 2);
+    const Halide::Expr sliced_weight = sliced(0);
+    const Halide::Expr sliced_slope = sliced(1 + 2 * color);
+    const Halide::Expr sliced_offset = sliced(2 + 2 * color);
+
+    // The pixel's own cells always hold some weight; the guard keeps the division finite
+    const Halide::Expr transformed = Halide::select(sliced_weight > 1.0e-6f,
+                                                   (sliced_slope * input(x, y, c) + sliced_offset) / sliced_weight,
+                                                   input(x, y, c));
+
+    result.m_output = Halide::Func("guided_upsampled");
+    result.m_output(x, y, c) = Halide::select(c < 3, transformed, input(x, y, c));
+    return result;
+}
+
+} // namespace CaptureMoment::Core::Operations
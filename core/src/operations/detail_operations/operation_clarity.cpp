@@ -0,0 +1,201 @@
+/**
+ * @file operation_clarity.cpp
+ * @brief Implementation of OperationClarity
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/operation_clarity.h"
+#include "operations/standalone_execution.h"
+#include "operations/detail_operations/gaussian_blur.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <cmath>
+#include <limits>
+#include <string_view>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Key of the cached guided-filter base.
+ */
+constexpr std::string_view k_base_stage = "clarity_base";
+
+/**
+ * @brief Edge-preserving base of the luminance of `input`: guided filter of the luminance by itself.
+ * @details Registers the blur stages in `params`. Depends on the input only, never on the value.
+ */
+[[nodiscard]] Halide::Func guidedBase(const Halide::Func& input, const Halide::Var& x, const Halide::Var& y,
+                                      FusionParameterBlock& params)
+{
+    // Own luminance func: the shared one is scheduled per pixel of the output, not at root
+    Halide::Func guide("clarity_guide");
+    guide(x, y) = toneLuminance(input, x, y);
+
+    Halide::Func guide_squared("clarity_guide_squared");
+    guide_squared(x, y) = guide(x, y) * guide(x, y);
+
+    const Halide::Expr sigma { OperationClarity::k_guide_sigma };
+    const auto mean = GaussianBlur::applyPlane(guide, sigma, x, y);
+    const auto mean_squared = GaussianBlur::applyPlane(guide_squared, sigma, x, y);
+    params.addSpatialStages(mean.m_stages);
+    params.addSpatialStages(mean_squared.m_stages);
+
+    // Per-window linear model base = a * guide + b: a -> 1 on edges, a -> 0 in flat regions
+    const Halide::Expr variance = Halide::max(mean_squared.m_output(x, y) - mean.m_output(x, y) * mean.m_output(x, y), 0.0f);
+    Halide::Func coefficient_a("clarity_a");
+    coefficient_a(x, y) = variance / (variance + OperationClarity::k_guide_epsilon);
+    Halide::Func coefficient_b("clarity_b");
+    coefficient_b(x, y) = (1.0f - coefficient_a(x, y)) * mean.m_output(x, y);
+
+    const auto mean_a = GaussianBlur::applyPlane(coefficient_a, sigma, x, y);
+    const auto mean_b = GaussianBlur::applyPlane(coefficient_b, sigma, x, y);
+    params.addSpatialStages(mean_a.m_stages);
+    params.addSpatialStages(mean_b.m_stages);
+
+    Halide::Func base("clarity_base");
+    base(x, y) = mean_a.m_output(x, y) * guide(x, y) + mean_b.m_output(x, y);
+    return base;
+}
+
+/**
+ * @brief Adds the weighted detail `luminance - base` to R, G and B.
+ */
+[[nodiscard]] MaskedToneResult applyClarityAdjustment(
+    const Halide::Func& input,
+    const Halide::Func& luminance,
+    const Halide::Func& base,
+    const Halide::Expr& value,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    MaskedToneResult result{Halide::Func("clarity_op"), Halide::Func("luminance_after_clarity")};
+
+    const Halide::Expr safe_value = Halide::clamp(value, OperationClarity::MIN_CLARITY_VALUE, OperationClarity::MAX_CLARITY_VALUE);
+    const Halide::Expr level = Halide::clamp(luminance(x, y), 0.0f, 1.0f);
+
+    Halide::Func offset("clarity_offset");
+    offset(x, y) = safe_value * OperationClarity::k_detail_gain * 4.0f * level * (1.0f - level) * (luminance(x, y) - base(x, y));
+
+    result.m_output(x, y, c) = Halide::select(
+        c < 3,
+        input(x, y, c) + offset(x, y),
+        input(x, y, c) // Alpha unchanged
+        );
+    result.m_luminance(x, y) = luminance(x, y) + offset(x, y);
+
+    return result;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationClarity::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationClarity::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationClarity::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: Extract Parameters
+    auto value_res = descriptor.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::error("OperationClarity::execute: Failed to get 'value' parameter");
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    const float clarity_value = value_res.value();
+
+    // Step 3: No-Op Optimization
+    if (std::abs(clarity_value - OperationClarity::DEFAULT_CLARITY_VALUE) < std::numeric_limits<float>::epsilon()) {
+        CM_LOG_TRACE(Operations, "OperationClarity::execute: Value is default, skipping");
+        return {};
+    }
+    CM_LOG_DEBUG(Operations, "OperationClarity::execute: Applying clarity with value={:.2f}", clarity_value);
+
+    // Step 4: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+Common::ImageDim OperationClarity::haloPixels(const OperationDescriptor& /*params*/) const
+{
+    // The coefficients read the means of the guide, and the base reads the means of the coefficients
+    return static_cast<Common::ImageDim>(2 * GaussianBlur::haloFor(k_guide_sigma));
+}
+
+OperationCost OperationClarity::cost(const OperationDescriptor& params) const
+{
+    // Four means (I, I^2, a, b), each decimated, blurred on a small level and upsampled:
+    // about a dozen reads per output pixel each
+    constexpr double k_taps_per_mean { 12.0 };
+    return OperationCost::spatial(4.0 * k_taps_per_mean, haloPixels(params));
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationClarity::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
+    ) const
+{
+    // Declared as a runtime input of the graph: updates reach the cached pipeline without recompilation.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_CLARITY_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationClarity::appendToFusedPipeline: Fusing with a cached guided-filter base");
+    // The base does not depend on the value: computed once per input, read back while the slider moves
+    const Halide::Func base = params.cachedStage(k_base_stage, 2, [&] { return guidedBase(input_func, x, y, params); });
+
+    auto result = applyClarityAdjustment(input_func, luminance.of(input_func, x, y), base, value, x, y, c);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationClarity::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationClarity] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    auto value_res = params.getParam<float>(ParameterKey::Value);
+    if (!value_res) {
+        spdlog::warn("[OperationClarity] executeOnImageRegion: Param 'value' missing, skipping.");
+        return {};
+    }
+
+    // TODO implement with OpenImageIO or OpenCV Or manually. To determine
+
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Operations
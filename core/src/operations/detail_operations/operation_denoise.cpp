@@ -0,0 +1,265 @@
+/**
+ * @file operation_denoise.cpp
+ * @brief Implementation of OperationDenoise
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/operation_denoise.h"
+#include "operations/standalone_execution.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Name of the color strength scalar.
+ */
+constexpr std::string_view k_color_key = ParameterKeys::name(ParameterKey::ColorNoise);
+
+/**
+ * @brief Square root keeping the sign, so that out-of-gamut values round-trip.
+ */
+[[nodiscard]] Halide::Expr stabilize(const Halide::Expr& value)
+{
+    return Halide::select(value < 0.0f, -Halide::sqrt(-value), Halide::sqrt(value));
+}
+
+/**
+ * @brief Inverse of `stabilize`.
+ */
+[[nodiscard]] Halide::Expr unstabilize(const Halide::Expr& value)
+{
+    return value * Halide::abs(value);
+}
+
+/**
+ * @brief One separable pass of the B3-spline ([1 4 6 4 1] / 16), its taps `step` pixels apart.
+ */
+[[nodiscard]] Halide::Func atrousPass(const Halide::Func& input, int step, bool horizontal,
+                                      const Halide::Var& x, const Halide::Var& y, const Halide::Var& c,
+                                      const std::string& name)
+{
+    auto tap = [&](int offset) {
+        return horizontal ? input(x + offset, y, c) : input(x, y + offset, c);
+    };
+
+    Halide::Func pass(name);
+    pass(x, y, c) = (tap(-2 * step) + tap(2 * step)
+                     + 4.0f * (tap(-step) + tap(step))
+                     + 6.0f * tap(0)) * (1.0f / 16.0f);
+    return pass;
+}
+
+/**
+ * @brief Soft threshold: `d` moved towards zero by `threshold`, and zero within it.
+ */
+[[nodiscard]] Halide::Expr shrink(const Halide::Expr& detail, const Halide::Expr& threshold)
+{
+    return detail - Halide::clamp(detail, -threshold, threshold);
+}
+
+/**
+ * @brief Wavelet shrinkage of the luminance and color planes of `input`.
+ * @details Registers the planes and the smoothing passes as spatial stages of `params`.
+ */
+[[nodiscard]] Halide::Func applyDenoise(
+    const Halide::Func& input,
+    const Halide::Expr& luma_strength,
+    const Halide::Expr& color_strength,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params)
+{
+    // Planes: Y, C1 = R - G, C2 = B - G in the stabilized domain; alpha rides along in plane 3
+    const Halide::Expr r = stabilize(input(x, y, 0));
+    const Halide::Expr g = stabilize(input(x, y, 1));
+    const Halide::Expr b = stabilize(input(x, y, 2));
+    Halide::Func planes("denoise_planes");
+    planes(x, y, c) = Halide::select(c == 0, (r + g + b) * (1.0f / 3.0f),
+                                     c == 1, r - g,
+                                     c == 2, b - g,
+                                     input(x, y, c));
+
+    std::vector<Halide::Func> smoothed{ planes };
+    std::vector<Halide::Func> stages{ planes };
+    for (int scale = 0; scale < OperationDenoise::k_scales; ++scale) {
+        const int step = 1 << scale;
+        Halide::Func rows = atrousPass(smoothed.back(), step, true, x, y, c, "denoise_rows_" + std::to_string(scale));
+        Halide::Func columns = atrousPass(rows, step, false, x, y, c, "denoise_columns_" + std::to_string(scale));
+        stages.push_back(rows);
+        stages.push_back(columns);
+        smoothed.push_back(columns);
+    }
+    params.addSpatialStages(stages);
+
+    const Halide::Expr luma = Halide::clamp(luma_strength, OperationDenoise::MIN_DENOISE_VALUE, OperationDenoise::MAX_DENOISE_VALUE)
+                              * OperationDenoise::k_luma_threshold;
+    const Halide::Expr color = Halide::clamp(color_strength, OperationDenoise::MIN_DENOISE_VALUE, OperationDenoise::MAX_DENOISE_VALUE)
+                               * OperationDenoise::k_chroma_threshold;
+
+    // Coarsest residual plus every shrunk detail layer
+    auto denoised = [&](int plane) {
+        Halide::Expr sum = smoothed.back()(x, y, plane);
+        for (int scale = 0; scale < OperationDenoise::k_scales; ++scale) {
+            const auto index = static_cast<std::size_t>(scale);
+            const Halide::Expr threshold = plane == 0 ? luma * OperationDenoise::k_luma_scale_weights[index]
+                                                      : color * OperationDenoise::k_chroma_scale_weights[index];
+            sum = sum + shrink(smoothed[index](x, y, plane) - smoothed[index + 1](x, y, plane), threshold);
+        }
+        return sum;
+    };
+
+    const Halide::Expr luminance = denoised(0);
+    const Halide::Expr red_difference = denoised(1);
+    const Halide::Expr blue_difference = denoised(2);
+    const Halide::Expr green = luminance - (red_difference + blue_difference) * (1.0f / 3.0f);
+
+    Halide::Func denoise_func("denoise_op");
+    denoise_func(x, y, c) = Halide::select(c == 0, unstabilize(red_difference + green),
+                                           c == 1, unstabilize(green),
+                                           c == 2, unstabilize(blue_difference + green),
+                                           input(x, y, c));
+    return denoise_func;
+}
+
+/**
+ * @brief Whether both strengths of a descriptor are at their minimum.
+ */
+[[nodiscard]] bool isNoOp(const OperationDescriptor& descriptor)
+{
+    return descriptor.getParam<float>(ParameterKey::Value).value_or(OperationDenoise::DEFAULT_DENOISE_VALUE) <= OperationDenoise::MIN_DENOISE_VALUE
+           && descriptor.getParam<float>(ParameterKey::ColorNoise).value_or(OperationDenoise::DEFAULT_DENOISE_VALUE) <= OperationDenoise::MIN_DENOISE_VALUE;
+}
+
+/**
+ * @brief Realizes the operation graph on an edge-clamped input, the passes computed at root.
+ */
+void realizeDenoise(const OperationDenoise& operation, const Halide::Func& input_func, Halide::Buffer<float>& output_buf,
+                    const OperationDescriptor& descriptor, const Halide::Var& x, const Halide::Var& y, const Halide::Var& c)
+{
+    FusionParameterBlock params;
+    FusedLuminance luminance;
+    Halide::Func denoise_func = operation.appendToFusedPipeline(input_func, x, y, c, params, luminance);
+    operation.updateFusionParameters(descriptor, params);
+
+    for (Halide::Func stage : params.spatialStages()) {
+        stage.compute_root().bound(c, 0, ImageProcessing::k_interleaved_channels).reorder(c, x, y).unroll(c)
+            .parallel(y).vectorize(x, 8);
+    }
+    denoise_func.bound(c, 0, output_buf.channels()).reorder(c, x, y)
+        .parallel(y).vectorize(x, 8);
+    denoise_func.realize(output_buf);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationDenoise::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationDenoise::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationDenoise::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: No-Op Optimization
+    if (isNoOp(descriptor)) {
+        CM_LOG_TRACE(Operations, "OperationDenoise::execute: Strengths are zero, skipping");
+        return {};
+    }
+    CM_LOG_DEBUG(Operations, "OperationDenoise::execute: Reducing noise over {} wavelet scales", k_scales);
+
+    // Step 3: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationDenoise::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& /*luminance*/
+    ) const
+{
+    // Declared as runtime inputs of the graph: updates reach the cached pipeline without recompilation.
+    const Halide::Param<float>& luma = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_DENOISE_VALUE);
+    const Halide::Param<float>& color = params.scalar(k_color_key, DEFAULT_DENOISE_VALUE);
+
+    CM_LOG_TRACE(Operations, "OperationDenoise::appendToFusedPipeline: Fusing with {} wavelet scales", k_scales);
+    return applyDenoise(input_func, luma, color, x, y, c, params);
+}
+
+bool OperationDenoise::isIdentity(const OperationDescriptor& descriptor) const
+{
+    return isNoOp(descriptor);
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationDenoise::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationDenoise] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    if (isNoOp(params)) {
+        return {};
+    }
+
+    try {
+        // Every pixel reads others: filter a copy
+        const std::span<float> pixels = region.getBuffer();
+        std::vector<float> source(pixels.begin(), pixels.end());
+
+        const auto width = static_cast<int>(region.width());
+        const auto height = static_cast<int>(region.height());
+        const auto channels = static_cast<int>(region.channels());
+
+        Halide::Var x, y, c;
+        Halide::Buffer<float> input_buf = ImageProcessing::wrapInterleaved(source.data(), width, height, channels);
+        Halide::Buffer<float> output_buf = ImageProcessing::wrapInterleaved(pixels.data(), width, height, channels);
+
+        Halide::Func input_func("denoise_region_input");
+        input_func(x, y, c) = Halide::BoundaryConditions::repeat_edge(input_buf)(x, y, c);
+        realizeDenoise(*this, input_func, output_buf, params, x, y, c);
+        return {};
+
+    } catch (const std::exception& e) {
+        spdlog::error("[OperationDenoise] executeOnImageRegion: Exception: {}", e.what());
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
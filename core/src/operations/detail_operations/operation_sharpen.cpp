@@ -0,0 +1,212 @@
+/**
+ * @file operation_sharpen.cpp
+ * @brief Implementation of OperationSharpen
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/operation_sharpen.h"
+#include "operations/standalone_execution.h"
+#include "operations/detail_operations/gaussian_blur.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Name of the radius scalar.
+ */
+constexpr std::string_view k_radius_key = ParameterKeys::name(ParameterKey::Radius);
+
+/**
+ * @brief Adds the amplified detail `luminance - blur(luminance)` to R, G and B.
+ * @details Registers the blur stages in `params`.
+ */
+[[nodiscard]] MaskedToneResult applySharpen(
+    const Halide::Func& input,
+    const Halide::Func& luminance,
+    const Halide::Expr& value,
+    const Halide::Expr& radius,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params)
+{
+    MaskedToneResult result{Halide::Func("sharpen_op"), Halide::Func("luminance_after_sharpen")};
+
+    // Own luminance func: the shared one is scheduled per pixel of the output, not at root
+    Halide::Func guide("sharpen_guide");
+    guide(x, y) = toneLuminance(input, x, y);
+
+    const Halide::Expr safe_radius = Halide::clamp(radius, OperationSharpen::MIN_SHARPEN_RADIUS, OperationSharpen::MAX_SHARPEN_RADIUS);
+    const auto blurred = GaussianBlur::applyPlane(guide, safe_radius, x, y);
+    params.addSpatialStages(blurred.m_stages);
+
+    const Halide::Expr safe_value = Halide::clamp(value, OperationSharpen::MIN_SHARPEN_VALUE, OperationSharpen::MAX_SHARPEN_VALUE);
+    const Halide::Expr detail = luminance(x, y) - blurred.m_output(x, y);
+
+    // Soft threshold: the detail within the noise floor is not amplified
+    Halide::Func offset("sharpen_offset");
+    offset(x, y) = safe_value * OperationSharpen::k_detail_gain
+                   * (detail - Halide::clamp(detail, -OperationSharpen::k_noise_floor, OperationSharpen::k_noise_floor));
+
+    result.m_output(x, y, c) = Halide::select(
+        c < 3,
+        input(x, y, c) + offset(x, y),
+        input(x, y, c) // Alpha unchanged
+        );
+    result.m_luminance(x, y) = luminance(x, y) + offset(x, y);
+
+    return result;
+}
+
+/**
+ * @brief Realizes the operation graph on an edge-clamped input, the blur stages computed at root.
+ */
+void realizeSharpen(const OperationSharpen& operation, const Halide::Func& input_func, Halide::Buffer<float>& output_buf,
+                    const OperationDescriptor& descriptor, const Halide::Var& x, const Halide::Var& y, const Halide::Var& c)
+{
+    FusionParameterBlock params;
+    FusedLuminance luminance;
+    Halide::Func sharpen_func = operation.appendToFusedPipeline(input_func, x, y, c, params, luminance);
+    operation.updateFusionParameters(descriptor, params);
+
+    for (Halide::Func stage : params.spatialStages()) {
+        stage.compute_root().parallel(y).vectorize(x, 8);
+    }
+    sharpen_func.bound(c, 0, output_buf.channels()).reorder(c, x, y)
+        .parallel(y).vectorize(x, 8);
+    sharpen_func.realize(output_buf);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationSharpen::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationSharpen::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationSharpen::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: No-Op Optimization
+    const float amount = descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_SHARPEN_VALUE);
+    if (amount <= MIN_SHARPEN_VALUE) {
+        CM_LOG_TRACE(Operations, "OperationSharpen::execute: Amount is zero, skipping");
+        return {};
+    }
+    CM_LOG_DEBUG(Operations, "OperationSharpen::execute: Sharpening with amount={:.2f}", amount);
+
+    // Step 3: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+Common::ImageDim OperationSharpen::haloPixels(const OperationDescriptor& params) const
+{
+    const float radius = std::clamp(params.getParam<float>(ParameterKey::Radius).value_or(DEFAULT_SHARPEN_RADIUS),
+                                    MIN_SHARPEN_RADIUS, MAX_SHARPEN_RADIUS);
+    return static_cast<Common::ImageDim>(GaussianBlur::haloFor(radius));
+}
+
+OperationCost OperationSharpen::cost(const OperationDescriptor& params) const
+{
+    const float radius = std::clamp(params.getParam<float>(ParameterKey::Radius).value_or(DEFAULT_SHARPEN_RADIUS),
+                                    MIN_SHARPEN_RADIUS, MAX_SHARPEN_RADIUS);
+    // Past k_direct_max_sigma the blur runs on a decimated level: the taps stop growing
+    const double taps_per_pass { 2.0 * std::ceil(3.0 * std::min(radius, GaussianBlur::k_direct_max_sigma)) + 1.0 };
+    return OperationCost::spatial(2.0 * taps_per_pass, haloPixels(params));
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationSharpen::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& luminance
+    ) const
+{
+    // Declared as runtime inputs of the graph: updates reach the cached pipeline without recompilation.
+    const Halide::Param<float>& value = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_SHARPEN_VALUE);
+    const Halide::Param<float>& radius = params.scalar(k_radius_key, DEFAULT_SHARPEN_RADIUS);
+
+    CM_LOG_TRACE(Operations, "OperationSharpen::appendToFusedPipeline: Fusing an unsharp mask of the luminance");
+    auto result = applySharpen(input_func, luminance.of(input_func, x, y), value, radius, x, y, c, params);
+    luminance.track(result.m_output, result.m_luminance);
+    return result.m_output;
+}
+
+bool OperationSharpen::isIdentity(const OperationDescriptor& descriptor) const
+{
+    return descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_SHARPEN_VALUE) <= MIN_SHARPEN_VALUE;
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationSharpen::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationSharpen] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    if (params.getParam<float>(ParameterKey::Value).value_or(DEFAULT_SHARPEN_VALUE) <= MIN_SHARPEN_VALUE) {
+        return {};
+    }
+
+    try {
+        // Every pixel reads others: filter a copy
+        const std::span<float> pixels = region.getBuffer();
+        std::vector<float> source(pixels.begin(), pixels.end());
+
+        const auto width = static_cast<int>(region.width());
+        const auto height = static_cast<int>(region.height());
+        const auto channels = static_cast<int>(region.channels());
+
+        Halide::Var x, y, c;
+        Halide::Buffer<float> input_buf = ImageProcessing::wrapInterleaved(source.data(), width, height, channels);
+        Halide::Buffer<float> output_buf = ImageProcessing::wrapInterleaved(pixels.data(), width, height, channels);
+
+        Halide::Func input_func("sharpen_region_input");
+        input_func(x, y, c) = Halide::BoundaryConditions::repeat_edge(input_buf)(x, y, c);
+        realizeSharpen(*this, input_func, output_buf, params, x, y, c);
+        return {};
+
+    } catch (const std::exception& e) {
+        spdlog::error("[OperationSharpen] executeOnImageRegion: Exception: {}", e.what());
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,364 @@
+/**
+ * @file edit_history.cpp
+ * @brief Implementation of EditHistory.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/edit_history.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] std::optional<OperationValue> valueOf(const OperationParameters& params, ParameterKey key)
+{
+    if (const OperationValue* value = params.find(key)) {
+        return *value;
+    }
+    return std::nullopt;
+}
+
+[[nodiscard]] const OperationDescriptor* findById(std::span<const OperationDescriptor> operations, std::uint64_t id) noexcept
+{
+    const auto it { std::ranges::find(operations, id, &OperationDescriptor::id) };
+    return it != operations.end() ? &*it : nullptr;
+}
+
+/**
+ * @brief true if both lists have the same operation kind and name under that id, in the same
+ *        relative order: only then are they diffed in place.
+ */
+[[nodiscard]] bool sameLayout(std::span<const OperationDescriptor> before, std::span<const OperationDescriptor> after)
+{
+    std::size_t next { 0 };
+    for (const auto& operation : before) {
+        const auto rest { after.subspan(next) };
+        const auto it { std::ranges::find(rest, operation.id, &OperationDescriptor::id) };
+        if (it == rest.end()) {
+            if (findById(after, operation.id)) {
+                return false; // Moved before a previous one
+            }
+            continue;
+        }
+        if (it->type != operation.type || it->name != operation.name) {
+            return false;
+        }
+        next += static_cast<std::size_t>(it - rest.begin()) + 1;
+    }
+    return true;
+}
+
+void eraseById(std::vector<OperationDescriptor>& operations, std::uint64_t id)
+{
+    std::erase_if(operations, [id](const OperationDescriptor& operation) { return operation.id == id; });
+}
+
+void insertAt(std::vector<OperationDescriptor>& operations, std::size_t position, const OperationDescriptor& descriptor)
+{
+    operations.insert(operations.begin() + static_cast<std::ptrdiff_t>(std::min(position, operations.size())), descriptor);
+}
+
+void applyParameters(std::vector<OperationDescriptor>& operations, const OperationDelta& change, bool forward)
+{
+    const auto it { std::ranges::find(operations, change.m_id, &OperationDescriptor::id) };
+    if (it == operations.end()) {
+        spdlog::error("[EditHistory]: Operation {} of a delta not found, history out of sync.", change.m_id);
+        return;
+    }
+
+    for (const ParameterChange& parameter : change.m_parameters) {
+        const auto& value { forward ? parameter.m_after : parameter.m_before };
+        if (value) {
+            it->params.set(parameter.m_key, *value);
+        } else {
+            it->params.erase(parameter.m_key);
+        }
+    }
+    if (change.m_enabled_toggled) {
+        it->enabled = !it->enabled;
+    }
+}
+
+} // anonymous namespace
+
+EditHistory::EditHistory(std::size_t preview_budget)
+    : m_preview_budget(preview_budget)
+{
+    reset();
+}
+
+void EditHistory::reset(std::vector<OperationDescriptor> operations)
+{
+    m_states.clear();
+    m_preview_bytes = 0;
+
+    State first;
+    first.m_id = m_next_state_id++;
+    first.m_snapshot = operations;
+    m_states.push_back(std::move(first));
+
+    m_current = 0;
+    m_current_operations = std::move(operations);
+}
+
+bool EditHistory::commit(std::vector<OperationDescriptor> operations, std::string label)
+{
+    if (operations == m_current_operations) {
+        return false;
+    }
+
+    // A new edit after undoing discards the redo branch
+    while (m_states.size() > m_current + 1) {
+        dropPreview(m_states.back());
+        m_states.pop_back();
+    }
+
+    State state;
+    state.m_id = m_next_state_id++;
+    state.m_label = std::move(label);
+    state.m_delta = diff(m_current_operations, operations);
+
+    std::size_t last_snapshot { m_current };
+    while (!m_states[last_snapshot].m_snapshot) {
+        --last_snapshot;
+    }
+    if (m_states.size() - last_snapshot >= k_snapshot_interval) {
+        state.m_snapshot = operations;
+    }
+
+    m_states.push_back(std::move(state));
+    m_current = m_states.size() - 1;
+    m_current_operations = std::move(operations);
+
+    trimOldest();
+    enforcePreviewBudget();
+    return true;
+}
+
+bool EditHistory::undo()
+{
+    if (!canUndo()) {
+        return false;
+    }
+    applyBackward(m_current_operations, m_states[m_current].m_delta);
+    --m_current;
+    return true;
+}
+
+bool EditHistory::redo()
+{
+    if (!canRedo()) {
+        return false;
+    }
+    ++m_current;
+    applyForward(m_current_operations, m_states[m_current].m_delta);
+    return true;
+}
+
+bool EditHistory::jumpTo(std::size_t index)
+{
+    if (index >= m_states.size()) {
+        return false;
+    }
+
+    std::size_t base { index };
+    while (!m_states[base].m_snapshot) {
+        --base;
+    }
+
+    // Replay from the current state when it is closer than the snapshot
+    const std::size_t from_current { index > m_current ? index - m_current : m_current - index };
+    if (from_current <= index - base) {
+        while (m_current > index) {
+            undo();
+        }
+        while (m_current < index) {
+            redo();
+        }
+        return true;
+    }
+
+    m_current_operations = *m_states[base].m_snapshot;
+    for (std::size_t i = base + 1; i <= index; ++i) {
+        applyForward(m_current_operations, m_states[i].m_delta);
+    }
+    m_current = index;
+    return true;
+}
+
+const std::string& EditHistory::label(std::size_t index) const
+{
+    if (index >= m_states.size()) {
+        throw std::out_of_range("EditHistory::label: index out of range");
+    }
+    return m_states[index].m_label;
+}
+
+std::uint64_t EditHistory::currentStateId() const noexcept
+{
+    return m_states[m_current].m_id;
+}
+
+bool EditHistory::storePreview(std::uint64_t state_id, Preview preview)
+{
+    const std::size_t bytes { previewSize(preview) };
+    if (bytes == 0 || bytes > m_preview_budget) {
+        return false;
+    }
+
+    const auto it { std::ranges::find(m_states, state_id, &State::m_id) };
+    if (it == m_states.end()) {
+        return false;
+    }
+
+    dropPreview(*it);
+    it->m_preview = std::move(preview);
+    m_preview_bytes += bytes;
+    enforcePreviewBudget();
+    return it->m_preview != nullptr;
+}
+
+EditHistory::Preview EditHistory::currentPreview() const noexcept
+{
+    return m_states[m_current].m_preview;
+}
+
+std::vector<OperationDelta> EditHistory::diff(std::span<const OperationDescriptor> before,
+                                              std::span<const OperationDescriptor> after)
+{
+    std::vector<OperationDelta> delta;
+
+    // Reordered or replaced operations: recorded as removed and added again (rare, never in place)
+    const bool in_place { sameLayout(before, after) };
+    const auto kept = [&](const OperationDescriptor& operation, std::span<const OperationDescriptor> other) {
+        return in_place && findById(other, operation.id) != nullptr;
+    };
+
+    for (std::size_t i = 0; i < before.size(); ++i) {
+        if (!kept(before[i], after)) {
+            delta.push_back({ OperationDelta::Kind::Removed, before[i].id, i, before[i], {}, false });
+        }
+    }
+
+    if (in_place) {
+        for (const auto& old_operation : before) {
+            const OperationDescriptor* new_operation { findById(after, old_operation.id) };
+            if (!new_operation || *new_operation == old_operation) {
+                continue;
+            }
+
+            OperationDelta change { OperationDelta::Kind::Modified, old_operation.id, 0, std::nullopt, {},
+                                    old_operation.enabled != new_operation->enabled };
+            for (std::size_t k = 0; k < ParameterKeys::k_count; ++k) {
+                const auto key { static_cast<ParameterKey>(k) };
+                auto old_value { valueOf(old_operation.params, key) };
+                auto new_value { valueOf(new_operation->params, key) };
+                if (old_value != new_value) {
+                    change.m_parameters.push_back({ key, std::move(old_value), std::move(new_value) });
+                }
+            }
+            delta.push_back(std::move(change));
+        }
+    }
+
+    // Ascending positions: inserting them in order rebuilds the newer list
+    for (std::size_t i = 0; i < after.size(); ++i) {
+        if (!kept(after[i], before)) {
+            delta.push_back({ OperationDelta::Kind::Added, after[i].id, i, after[i], {}, false });
+        }
+    }
+
+    return delta;
+}
+
+void EditHistory::applyForward(std::vector<OperationDescriptor>& operations, std::span<const OperationDelta> delta)
+{
+    for (const OperationDelta& change : delta) {
+        if (change.m_kind == OperationDelta::Kind::Removed) {
+            eraseById(operations, change.m_id);
+        } else if (change.m_kind == OperationDelta::Kind::Modified) {
+            applyParameters(operations, change, true);
+        }
+    }
+    for (const OperationDelta& change : delta) {
+        if (change.m_kind == OperationDelta::Kind::Added) {
+            insertAt(operations, change.m_position, *change.m_descriptor);
+        }
+    }
+}
+
+void EditHistory::applyBackward(std::vector<OperationDescriptor>& operations, std::span<const OperationDelta> delta)
+{
+    for (const OperationDelta& change : delta) {
+        if (change.m_kind == OperationDelta::Kind::Added) {
+            eraseById(operations, change.m_id);
+        } else if (change.m_kind == OperationDelta::Kind::Modified) {
+            applyParameters(operations, change, false);
+        }
+    }
+    for (const OperationDelta& change : delta) {
+        if (change.m_kind == OperationDelta::Kind::Removed) {
+            insertAt(operations, change.m_position, *change.m_descriptor);
+        }
+    }
+}
+
+void EditHistory::dropPreview(State& state) noexcept
+{
+    m_preview_bytes -= previewSize(state.m_preview);
+    state.m_preview.reset();
+}
+
+void EditHistory::enforcePreviewBudget()
+{
+    while (m_preview_bytes > m_preview_budget) {
+        State* farthest { nullptr };
+        std::size_t farthest_distance { 0 };
+        for (std::size_t i = 0; i < m_states.size(); ++i) {
+            const std::size_t distance { i > m_current ? i - m_current : m_current - i };
+            if (m_states[i].m_preview && (!farthest || distance > farthest_distance)) {
+                farthest = &m_states[i];
+                farthest_distance = distance;
+            }
+        }
+        if (!farthest) {
+            return;
+        }
+        dropPreview(*farthest);
+    }
+}
+
+void EditHistory::trimOldest()
+{
+    while (m_states.size() > k_max_states) {
+        // Drop up to the next snapshot: the history still starts with one
+        std::size_t next { 1 };
+        while (next < m_current && !m_states[next].m_snapshot) {
+            ++next;
+        }
+        if (next >= m_current) {
+            return;
+        }
+
+        for (std::size_t i = 0; i < next; ++i) {
+            dropPreview(m_states[i]);
+        }
+        m_states.erase(m_states.begin(), m_states.begin() + static_cast<std::ptrdiff_t>(next));
+        m_current -= next;
+        spdlog::debug("[EditHistory::trimOldest]: Dropped the {} oldest states.", next);
+    }
+}
+
+std::size_t EditHistory::previewSize(const Preview& preview) noexcept
+{
+    return preview ? preview->bytesPerLine() * static_cast<std::size_t>(preview->m_height) : 0;
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,231 @@
+/**
+ * @file fallback_kernels.cpp
+ * @brief Implementation of FallbackKernels.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/fallback_kernels.h"
+#include "operations/operation_ranges.h"
+#include "operations/color_operations/cube_lut.h"
+
+#include <spdlog/spdlog.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief The descriptor's value, clamped to the operation's range (as the fused helpers do).
+ */
+[[nodiscard]] float valueOf(const OperationDescriptor& descriptor, float default_value, float min_value, float max_value)
+{
+    return std::clamp(descriptor.getParam<float>(ParameterKey::Value).value_or(default_value), min_value, max_value);
+}
+
+[[nodiscard]] std::expected<void, ErrorHandling::CoreError> checkRegion(const Common::ImageRegion& region)
+{
+    if (!region.isValid() || region.m_channels < 3) {
+        spdlog::error("[FallbackKernels]: Invalid ImageRegion ({} channels).", region.m_channels);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+    return {};
+}
+
+/**
+ * @brief Runs `transform(r, g, b)` on every pixel; alpha (and any further channel) unchanged.
+ * @details The transforms are branch-free (selects, min/max): the compiler vectorizes the loop.
+ */
+template <typename Transform>
+[[nodiscard]] std::expected<void, ErrorHandling::CoreError> forEachPixel(Common::ImageRegion& region, Transform&& transform)
+{
+    if (auto valid = checkRegion(region); !valid) {
+        return valid;
+    }
+
+    const std::size_t channels = region.m_channels;
+    const std::size_t count = static_cast<std::size_t>(region.m_width) * region.m_height;
+    float* pixel = region.getBuffer().data();
+    for (std::size_t i = 0; i < count; ++i, pixel += channels) {
+        transform(pixel[0], pixel[1], pixel[2]);
+    }
+    return {};
+}
+
+[[nodiscard]] float clampUnit(float value) noexcept
+{
+    return std::min(std::max(value, 0.0f), 1.0f);
+}
+
+/**
+ * @brief Host counterparts of `toneLuminance`, `brightToneMask` and `darkToneMask`.
+ */
+[[nodiscard]] float luminanceOf(float r, float g, float b) noexcept
+{
+    return 0.299f * r + 0.587f * g + 0.114f * b;
+}
+
+[[nodiscard]] float brightMask(float luminance, float low_threshold, float high_threshold) noexcept
+{
+    return clampUnit((luminance - low_threshold) / (high_threshold - low_threshold));
+}
+
+[[nodiscard]] float darkMask(float luminance, float low_threshold, float high_threshold) noexcept
+{
+    return clampUnit((high_threshold - luminance) / (high_threshold - low_threshold));
+}
+
+/**
+ * @brief Offsets R, G and B by `value` times the tone mask of the pixel's luminance.
+ */
+[[nodiscard]] std::expected<void, ErrorHandling::CoreError> offsetTones(Common::ImageRegion& region, float value, bool bright,
+                                                                       float low_threshold, float high_threshold)
+{
+    if (value == 0.0f) {
+        return checkRegion(region);
+    }
+    return forEachPixel(region, [=](float& r, float& g, float& b) {
+        const float luminance = luminanceOf(r, g, b);
+        const float mask = bright ? brightMask(luminance, low_threshold, high_threshold)
+                                  : darkMask(luminance, low_threshold, high_threshold);
+        const float offset = value * mask;
+        r += offset;
+        g += offset;
+        b += offset;
+    });
+}
+
+/**
+ * @brief Kernels by `OperationType`; nullptr where the operation has none.
+ */
+constexpr auto k_kernels = [] {
+    std::array<FallbackKernels::Kernel, magic_enum::enum_count<OperationType>()> table{};
+    table[std::to_underlying(OperationType::Exposure)] = &FallbackKernels::exposure;
+    table[std::to_underlying(OperationType::Brightness)] = &FallbackKernels::brightness;
+    table[std::to_underlying(OperationType::Contrast)] = &FallbackKernels::contrast;
+    table[std::to_underlying(OperationType::Highlights)] = &FallbackKernels::highlights;
+    table[std::to_underlying(OperationType::Shadows)] = &FallbackKernels::shadows;
+    table[std::to_underlying(OperationType::Whites)] = &FallbackKernels::whites;
+    table[std::to_underlying(OperationType::Blacks)] = &FallbackKernels::blacks;
+    table[std::to_underlying(OperationType::Saturation)] = &FallbackKernels::saturation;
+    table[std::to_underlying(OperationType::Lut3D)] = &FallbackKernels::lut3d;
+    return table;
+}();
+
+} // anonymous namespace
+
+FallbackKernels::Kernel FallbackKernels::find(OperationType type) noexcept
+{
+    const auto index = static_cast<std::size_t>(std::to_underlying(type));
+    return index < k_kernels.size() ? k_kernels[index] : nullptr;
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::exposure(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    // The value is in stops
+    const float gain = std::exp2(valueOf(descriptor, OperationRanges::getExposureDefaultValue(),
+                                         OperationRanges::getExposureMinValue(), OperationRanges::getExposureMaxValue()));
+    return forEachPixel(region, [gain](float& r, float& g, float& b) {
+        r = clampUnit(r * gain);
+        g = clampUnit(g * gain);
+        b = clampUnit(b * gain);
+    });
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::brightness(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    const float value = valueOf(descriptor, OperationRanges::getBrightnessDefaultValue(),
+                                OperationRanges::getBrightnessMinValue(), OperationRanges::getBrightnessMaxValue());
+    return forEachPixel(region, [value](float& r, float& g, float& b) {
+        r = clampUnit(r + value);
+        g = clampUnit(g + value);
+        b = clampUnit(b + value);
+    });
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::contrast(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    const float factor = valueOf(descriptor, OperationRanges::getContrastDefaultValue(),
+                                 OperationRanges::getContrastMinValue(), OperationRanges::getContrastMaxValue());
+    return forEachPixel(region, [factor](float& r, float& g, float& b) {
+        r = clampUnit(0.5f + (r - 0.5f) * factor);
+        g = clampUnit(0.5f + (g - 0.5f) * factor);
+        b = clampUnit(0.5f + (b - 0.5f) * factor);
+    });
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::highlights(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    return offsetTones(region, valueOf(descriptor, OperationRanges::getHighlightsDefaultValue(),
+                                       OperationRanges::getHighlightsMinValue(), OperationRanges::getHighlightsMaxValue()),
+                       true, 0.7f, 1.0f);
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::shadows(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    return offsetTones(region, valueOf(descriptor, OperationRanges::getShadowsDefaultValue(),
+                                       OperationRanges::getShadowsMinValue(), OperationRanges::getShadowsMaxValue()),
+                       false, 0.0f, 0.3f);
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::whites(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    return offsetTones(region, valueOf(descriptor, OperationRanges::getWhitesDefaultValue(),
+                                       OperationRanges::getWhitesMinValue(), OperationRanges::getWhitesMaxValue()),
+                       true, 0.7f, 1.0f);
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::blacks(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    return offsetTones(region, valueOf(descriptor, OperationRanges::getBlacksDefaultValue(),
+                                       OperationRanges::getBlacksMinValue(), OperationRanges::getBlacksMaxValue()),
+                       false, 0.0f, 0.3f);
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::saturation(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    const float factor = valueOf(descriptor, OperationRanges::getSaturationDefaultValue(),
+                                 OperationRanges::getSaturationMinValue(), OperationRanges::getSaturationMaxValue());
+    return forEachPixel(region, [factor](float& r, float& g, float& b) {
+        // Around the luminance of the input pixel
+        const float luminance = luminanceOf(r, g, b);
+        r = clampUnit(luminance + (r - luminance) * factor);
+        g = clampUnit(luminance + (g - luminance) * factor);
+        b = clampUnit(luminance + (b - luminance) * factor);
+    });
+}
+
+std::expected<void, ErrorHandling::CoreError> FallbackKernels::lut3d(Common::ImageRegion& region, const OperationDescriptor& descriptor)
+{
+    const float amount = valueOf(descriptor, OperationRanges::getLut3DDefaultValue(),
+                                 OperationRanges::getLut3DMinValue(), OperationRanges::getLut3DMaxValue());
+    const std::string path = descriptor.getParam<std::string>(ParameterKey::LutPath).value_or(std::string{});
+    if (path.empty() || amount <= OperationRanges::getLut3DMinValue()) {
+        return checkRegion(region);
+    }
+
+    auto table = CubeLut::load(path);
+    if (!table) {
+        spdlog::warn("[FallbackKernels::lut3d]: LUT '{}' unavailable, applying the identity.", path);
+        return checkRegion(region);
+    }
+
+    const Halide::Buffer<float>& lattice = table.value();
+    return forEachPixel(region, [&lattice, amount](float& r, float& g, float& b) {
+        const auto mapped = CubeLut::sampleTetrahedral(lattice, r, g, b);
+        // Halide::lerp
+        r = r * (1.0f - amount) + mapped[0] * amount;
+        g = g * (1.0f - amount) + mapped[1] * amount;
+        b = b * (1.0f - amount) + mapped[2] * amount;
+    });
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,33 @@
+/**
+ * @file fused_luminance.cpp
+ * @brief Implementation of FusedLuminance.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/fused_luminance.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+
+namespace CaptureMoment::Core::Operations {
+
+Halide::Func FusedLuminance::of(const Halide::Func& image, const Halide::Var& x, const Halide::Var& y)
+{
+    if (m_image && m_image->function().same_as(image.function())) {
+        return m_luminance;
+    }
+
+    Halide::Func luminance("fused_luminance");
+    luminance(x, y) = toneLuminance(image, x, y);
+
+    track(image, luminance);
+    return luminance;
+}
+
+void FusedLuminance::track(const Halide::Func& image, const Halide::Func& luminance)
+{
+    m_image = image;
+    m_luminance = luminance;
+    m_stages.push_back(luminance);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,149 @@
+/**
+ * @file fusion_parameter_block.cpp
+ * @brief Implementation of FusionParameterBlock.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/fusion_parameter_block.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <type_traits>
+#include <variant>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+template<typename Entries>
+auto findByName(Entries& entries, std::string_view name)
+{
+    return std::find_if(entries.begin(), entries.end(),
+                        [name](const auto& entry) { return entry.first == name; });
+}
+
+} // namespace
+
+const Halide::Param<float>& FusionParameterBlock::scalar(std::string_view name, float default_value)
+{
+    if (auto it = findByName(m_scalars, name); it != m_scalars.end()) {
+        return it->second.m_param;
+    }
+
+    // Unnamed without a prefix: Halide generates a unique name, so two operations may both declare "value"
+    const std::string input_name = inputName("", name);
+    ScalarInput input{input_name.empty() ? Halide::Param<float>() : Halide::Param<float>(input_name), ParameterKeys::find(name)};
+    input.m_param.set(default_value);
+    return m_scalars.emplace_back(std::string(name), std::move(input)).second.m_param;
+}
+
+const Halide::ImageParam& FusionParameterBlock::lut(std::string_view name, Halide::Buffer<> initial)
+{
+    if (auto it = findByName(m_luts, name); it != m_luts.end()) {
+        return it->second.m_param;
+    }
+
+    const std::string input_name = inputName("lut_", name);
+    LookupTable table{input_name.empty() ? Halide::ImageParam(initial.type(), initial.dimensions())
+                                         : Halide::ImageParam(initial.type(), initial.dimensions(), input_name),
+                      std::move(initial)};
+    table.m_param.set(table.m_buffer);
+    return m_luts.emplace_back(std::string(name), std::move(table)).second.m_param;
+}
+
+void FusionParameterBlock::setScalar(std::string_view name, float value)
+{
+    auto it = findByName(m_scalars, name);
+    if (it == m_scalars.end()) {
+        spdlog::warn("[FusionParameterBlock::setScalar]: Scalar '{}' was not declared by the operation.", name);
+        return;
+    }
+    it->second.m_param.set(value);
+}
+
+void FusionParameterBlock::setLut(std::string_view name, Halide::Buffer<> contents)
+{
+    auto it = findByName(m_luts, name);
+    if (it == m_luts.end()) {
+        spdlog::warn("[FusionParameterBlock::setLut]: Table '{}' was not declared by the operation.", name);
+        return;
+    }
+    if (!contents.defined() || contents.dimensions() != it->second.m_param.dimensions()
+        || contents.type() != it->second.m_param.type()) {
+        spdlog::warn("[FusionParameterBlock::setLut]: Table '{}' expects {} dimension(s) of its declared type. Ignored.",
+                     name, it->second.m_param.dimensions());
+        return;
+    }
+
+    it->second.m_buffer = std::move(contents);
+    it->second.m_param.set(it->second.m_buffer);
+}
+
+void FusionParameterBlock::addSpatialStages(const std::vector<Halide::Func>& stages)
+{
+    m_spatial_stages.insert(m_spatial_stages.end(), stages.begin(), stages.end());
+}
+
+Halide::Func FusionParameterBlock::cachedStage(std::string_view name, int dimensions,
+                                              const std::function<Halide::Func()>& build)
+{
+    if (auto it = std::ranges::find(m_cached_stages, name, &CachedStage::m_name); it != m_cached_stages.end()) {
+        return it->m_producer.defined() ? it->m_producer : Halide::Func(it->m_param);
+    }
+
+    const std::string input_name = inputName("stage_", name);
+    CachedStage stage{std::string(name),
+                      input_name.empty() ? Halide::ImageParam(Halide::Float(32), dimensions)
+                                         : Halide::ImageParam(Halide::Float(32), dimensions, input_name),
+                      Halide::Func()};
+    if (!m_reuse_cached_stages) {
+        stage.m_producer = build();
+    }
+
+    const auto& declared = m_cached_stages.emplace_back(std::move(stage));
+    return declared.m_producer.defined() ? declared.m_producer : Halide::Func(declared.m_param);
+}
+
+void FusionParameterBlock::bindScalars(const OperationDescriptor& descriptor)
+{
+    for (auto& [name, input] : m_scalars) {
+        const OperationValue* value = input.m_key ? descriptor.params.find(*input.m_key) : nullptr;
+        if (!value) {
+            continue;
+        }
+
+        std::visit([&input](const auto& held) {
+            using T = std::decay_t<decltype(held)>;
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, int> || std::is_same_v<T, bool>) {
+                input.m_param.set(static_cast<float>(held));
+            }
+        }, *value);
+    }
+}
+
+std::string FusionParameterBlock::inputName(std::string_view kind, std::string_view name) const
+{
+    if (m_name_prefix.empty()) {
+        return {};
+    }
+
+    std::string input_name = m_name_prefix + std::string(kind) + std::string(name);
+    std::ranges::replace_if(input_name, [](char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != '_'; }, '_');
+    return input_name;
+}
+
+Halide::Expr FusionParameterBlock::sampleLinear(const Halide::ImageParam& table, const Halide::Expr& u)
+{
+    Halide::Expr last = table.dim(0).extent() - 1;
+    Halide::Expr position = Halide::clamp(u, 0.0f, 1.0f) * Halide::cast<float>(last);
+    Halide::Expr index = Halide::clamp(Halide::cast<int>(Halide::floor(position)), 0, last);
+    Halide::Expr next = Halide::min(index + 1, last);
+    Halide::Expr weight = position - Halide::cast<float>(index);
+
+    return Halide::lerp(table(table.dim(0).min() + index), table(table.dim(0).min() + next), weight);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,143 @@
+/**
+ * @file crop_geometry.cpp
+ * @brief Implementation of CropGeometry.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/operation_ranges.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numbers>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Reads a float parameter, kept at @p fallback when missing or not finite.
+ */
+[[nodiscard]] float floatParam(const OperationDescriptor& descriptor, ParameterKey key, float fallback)
+{
+    const float value = descriptor.getParam<float>(key).value_or(fallback);
+    return std::isfinite(value) ? value : fallback;
+}
+
+/**
+ * @brief Pixel span [first, last) of the normalized edges on an axis of @p size pixels.
+ */
+[[nodiscard]] std::pair<std::int64_t, std::int64_t> span(float first, float last, Common::ImageDim size) noexcept
+{
+    const auto extent = static_cast<std::int64_t>(std::max<Common::ImageDim>(size, 1));
+    const std::int64_t begin = std::clamp<std::int64_t>(std::llround(first * static_cast<double>(extent)), 0, extent - 1);
+    const std::int64_t end = std::clamp<std::int64_t>(std::llround(last * static_cast<double>(extent)), begin + 1, extent);
+    return { begin, end };
+}
+
+} // anonymous namespace
+
+CropGeometry CropGeometry::fromDescriptor(const OperationDescriptor& descriptor)
+{
+    constexpr float edge_min = OperationRanges::getCropEdgeMinValue();
+    constexpr float edge_max = OperationRanges::getCropEdgeMaxValue();
+
+    CropGeometry geometry;
+    geometry.m_left = std::clamp(floatParam(descriptor, ParameterKey::CropLeft, edge_min), edge_min, edge_max);
+    geometry.m_top = std::clamp(floatParam(descriptor, ParameterKey::CropTop, edge_min), edge_min, edge_max);
+    geometry.m_right = std::clamp(floatParam(descriptor, ParameterKey::CropRight, edge_max), edge_min, edge_max);
+    geometry.m_bottom = std::clamp(floatParam(descriptor, ParameterKey::CropBottom, edge_max), edge_min, edge_max);
+    if (geometry.m_right < geometry.m_left) {
+        std::swap(geometry.m_left, geometry.m_right);
+    }
+    if (geometry.m_bottom < geometry.m_top) {
+        std::swap(geometry.m_top, geometry.m_bottom);
+    }
+    geometry.m_angle = std::clamp(floatParam(descriptor, ParameterKey::Angle, OperationRanges::getStraightenAngleDefaultValue()),
+                                  OperationRanges::getStraightenAngleMinValue(), OperationRanges::getStraightenAngleMaxValue());
+    return geometry;
+}
+
+std::optional<CropGeometry> CropGeometry::of(std::span<const OperationDescriptor> operations)
+{
+    const auto it = std::ranges::find_if(operations, [](const OperationDescriptor& descriptor) {
+        return descriptor.enabled && descriptor.type == OperationType::Crop;
+    });
+    if (it == operations.end()) {
+        return std::nullopt;
+    }
+    return fromDescriptor(*it);
+}
+
+void CropGeometry::moveToFront(std::vector<OperationDescriptor>& operations)
+{
+    const auto it = std::ranges::find(operations, OperationType::Crop, &OperationDescriptor::type);
+    if (it != operations.end() && it != operations.begin()) {
+        std::rotate(operations.begin(), it, it + 1);
+    }
+}
+
+bool CropGeometry::isRotated() const noexcept
+{
+    return m_angle != 0.0f;
+}
+
+Common::RegionOfInterest CropGeometry::region(Common::ImageDim width, Common::ImageDim height) const noexcept
+{
+    const auto [x0, x1] = span(m_left, m_right, width);
+    const auto [y0, y1] = span(m_top, m_bottom, height);
+    return Common::RegionOfInterest{
+        static_cast<Common::ImageCoord>(x0),
+        static_cast<Common::ImageCoord>(y0),
+        static_cast<Common::ImageDim>(x1 - x0),
+        static_cast<Common::ImageDim>(y1 - y0)
+    };
+}
+
+std::array<float, 6> CropGeometry::sampling(Common::ImageDim width, Common::ImageDim height) const noexcept
+{
+    // Rotating the content counterclockwise (y down) samples the source clockwise of the output
+    const double radians = static_cast<double>(m_angle) * std::numbers::pi / 180.0;
+    const double cos_a = std::cos(radians);
+    const double sin_a = std::sin(radians);
+
+    const Common::RegionOfInterest rect = region(width, height);
+    const double cx = rect.m_x + 0.5 * static_cast<double>(rect.m_width);
+    const double cy = rect.m_y + 0.5 * static_cast<double>(rect.m_height);
+
+    // source = R (p - center) + center, with p the output pixel center (x + 0.5, y + 0.5),
+    // then back to pixel indices (- 0.5)
+    const double px = 0.5 - cx;
+    const double py = 0.5 - cy;
+    return {
+        static_cast<float>(cos_a), static_cast<float>(-sin_a), static_cast<float>(cos_a * px - sin_a * py + cx - 0.5),
+        static_cast<float>(sin_a), static_cast<float>(cos_a), static_cast<float>(sin_a * px + cos_a * py + cy - 0.5)
+    };
+}
+
+std::unique_ptr<Common::ImageRegion> CropGeometry::extractFrom(const Common::ImageRegion& image) const
+{
+    if (!image.isValid()) {
+        return nullptr;
+    }
+
+    const Common::RegionOfInterest rect = region(image.m_width, image.m_height);
+    const std::size_t row_elements = rect.m_width * image.m_channels;
+    Common::PixelBuffer data(row_elements * rect.m_height);
+    for (std::size_t row = 0; row < rect.m_height; ++row) {
+        const std::size_t source_offset = ((static_cast<std::size_t>(rect.m_y) + row) * image.m_width + static_cast<std::size_t>(rect.m_x))
+                                          * image.m_channels;
+        std::memcpy(data.data() + row * row_elements, image.m_data.data() + source_offset, row_elements * sizeof(float));
+    }
+
+    auto cropped = std::make_unique<Common::ImageRegion>(rect.m_x, rect.m_y, std::move(data), rect.m_width, rect.m_height,
+                                                         image.m_channels);
+    cropped->m_format = image.m_format;
+    return cropped;
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,182 @@
+/**
+ * @file lens_profile.cpp
+ * @brief Implementation of LensProfile.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/lens_profile.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <mutex>
+#include <span>
+#include <system_error>
+#include <unordered_map>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Smallest vignetting falloff divided out (a gain of 10 at most).
+ */
+constexpr float k_min_falloff = 0.1f;
+
+std::mutex& cacheMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<std::string, Halide::Buffer<float>>& cache()
+{
+    static std::unordered_map<std::string, Halide::Buffer<float>> tables;
+    return tables;
+}
+
+/**
+ * @brief Parses exactly `values.size()` comma-separated finite floats.
+ */
+[[nodiscard]] bool parseFloats(std::string_view text, std::span<float> values)
+{
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const std::size_t end = text.find(',');
+        if ((end == std::string_view::npos) != (i + 1 == values.size())) {
+            return false;
+        }
+        const std::string_view entry = text.substr(0, end);
+        const auto [last, error] = std::from_chars(entry.data(), entry.data() + entry.size(), values[i]);
+        if (error != std::errc{} || last != entry.data() + entry.size() || !std::isfinite(values[i])) {
+            return false;
+        }
+        text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+std::optional<LensProfile> LensProfile::parse(std::string_view text)
+{
+    const std::size_t first = text.find(';');
+    const std::size_t second = first == std::string_view::npos ? first : text.find(';', first + 1);
+    if (second == std::string_view::npos) {
+        return std::nullopt;
+    }
+
+    LensProfile profile;
+    if (!parseFloats(text.substr(0, first), profile.m_distortion)
+        || !parseFloats(text.substr(first + 1, second - first - 1), profile.m_vignetting)
+        || !parseFloats(text.substr(second + 1), profile.m_chromatic)) {
+        return std::nullopt;
+    }
+    if (std::ranges::any_of(profile.m_chromatic, [](float scale) { return !(scale > 0.0f); })) {
+        return std::nullopt;
+    }
+    return profile;
+}
+
+std::string LensProfile::format() const
+{
+    return std::format("{},{},{};{},{},{};{},{}", m_distortion[0], m_distortion[1], m_distortion[2],
+                       m_vignetting[0], m_vignetting[1], m_vignetting[2], m_chromatic[0], m_chromatic[1]);
+}
+
+bool LensProfile::isIdentity() const noexcept
+{
+    return *this == LensProfile{};
+}
+
+Halide::Buffer<float> LensProfile::sample() const
+{
+    const auto [a, b, c] = m_distortion;
+    const auto [k1, k2, k3] = m_vignetting;
+
+    Halide::Buffer<float> table(k_entry_channels, k_table_size);
+    for (int i = 0; i < k_table_size; ++i) {
+        const float r = static_cast<float>(i) / static_cast<float>(k_table_size - 1);
+
+        // ptlens: source radius of the corrected radius r, as a scale of r
+        const float scale = ((a * r + b) * r + c) * r + 1.0f - a - b - c;
+        table(0, i) = scale * m_chromatic[0];
+        table(1, i) = scale;
+        table(2, i) = scale * m_chromatic[1];
+
+        // pa: the falloff at the source radius, divided out
+        const float r2 = (r * scale) * (r * scale);
+        const float falloff = 1.0f + r2 * (k1 + r2 * (k2 + r2 * k3));
+        table(k_gain_entry, i) = 1.0f / std::max(falloff, k_min_falloff);
+    }
+    return table;
+}
+
+Halide::Buffer<float> LensProfile::table(const LensProfile& profile)
+{
+    std::string key = profile.format();
+
+    std::lock_guard lock(cacheMutex());
+    auto& tables = cache();
+    if (auto it = tables.find(key); it != tables.end()) {
+        return it->second;
+    }
+
+    spdlog::debug("[LensProfile::table]: Sampling the corrections of '{}'.", key);
+    Halide::Buffer<float> sampled = profile.sample();
+    tables.emplace(std::move(key), sampled);
+    return sampled;
+}
+
+void LensProfile::clearCache()
+{
+    std::lock_guard lock(cacheMutex());
+    cache().clear();
+}
+
+Halide::Buffer<float> LensProfile::identity()
+{
+    Halide::Buffer<float> table(k_entry_channels, 2);
+    table.fill(1.0f);
+    return table;
+}
+
+Halide::Expr LensProfile::sampleRadial(const Halide::ImageParam& table, const Halide::Expr& radius, const Halide::Expr& entry)
+{
+    const Halide::Expr last = table.dim(1).extent() - 1;
+    const Halide::Expr position = Halide::clamp(radius, 0.0f, 1.0f) * Halide::cast<float>(last);
+    const Halide::Expr index = Halide::clamp(Halide::cast<int>(Halide::floor(position)), 0, last - 1);
+    const Halide::Expr weight = position - Halide::cast<float>(index);
+
+    const Halide::Expr first = table.dim(1).min();
+    return Halide::lerp(table(entry, first + index), table(entry, first + index + 1), weight);
+}
+
+std::array<float, LensProfile::k_entry_channels> LensProfile::lookup(const Halide::Buffer<float>& table, float radius)
+{
+    const int last = table.dim(1).extent() - 1;
+    const float position = std::clamp(radius, 0.0f, 1.0f) * static_cast<float>(last);
+    const int index = std::clamp(static_cast<int>(std::floor(position)), 0, last - 1);
+    const float weight = position - static_cast<float>(index);
+
+    const int first = table.dim(1).min();
+    std::array<float, k_entry_channels> entries{};
+    for (int entry = 0; entry < k_entry_channels; ++entry) {
+        const float low = table(entry, first + index);
+        entries[static_cast<std::size_t>(entry)] = low + weight * (table(entry, first + index + 1) - low);
+    }
+    return entries;
+}
+
+void LensProfile::moveToFront(std::vector<OperationDescriptor>& operations)
+{
+    const auto it = std::ranges::find(operations, OperationType::LensCorrection, &OperationDescriptor::type);
+    if (it != operations.end() && it != operations.begin()) {
+        std::rotate(operations.begin(), it, it + 1);
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
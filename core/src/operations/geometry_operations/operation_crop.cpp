@@ -0,0 +1,124 @@
+/**
+ * @file operation_crop.cpp
+ * @brief Implementation of OperationCrop
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/operation_crop.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "common/error_handling/core_error.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationCrop::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationCrop::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationCrop::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: No-Op Optimization (the rectangle itself is applied by the consumers of the image)
+    if (!CropGeometry::fromDescriptor(descriptor).isRotated()) {
+        CM_LOG_TRACE(Operations, "OperationCrop::execute: Not straightened, skipping");
+        return {};
+    }
+
+    // Step 3: Copy, resample and upload
+    auto copy_result = working_image.exportToCPUCopy();
+    if (!copy_result) {
+        spdlog::error("OperationCrop::execute: Failed to export working image");
+        return std::unexpected(copy_result.error());
+    }
+    Common::ImageRegion& region = *copy_result.value();
+
+    if (auto result = executeOnImageRegion(region, descriptor); !result) {
+        return result;
+    }
+
+    auto update_res = working_image.updateFromCPU(region);
+    if (!update_res) {
+        spdlog::error("OperationCrop::execute: Failed to update working image from CPU");
+        return std::unexpected(update_res.error());
+    }
+    return {};
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationCrop::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationCrop] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const CropGeometry geometry = CropGeometry::fromDescriptor(params);
+    if (!geometry.isRotated()) {
+        return {};
+    }
+
+    const std::size_t width = region.width();
+    const std::size_t height = region.height();
+    const std::size_t channels = region.channels();
+    const Common::RegionOfInterest rect = geometry.region(width, height);
+    const auto a = geometry.sampling(width, height);
+
+    // The rectangle reads pixels it overwrites: sample a copy
+    const std::span<float> pixels = region.getBuffer();
+    const std::vector<float> source(pixels.begin(), pixels.end());
+
+    auto at = [&](std::ptrdiff_t x, std::ptrdiff_t y, std::size_t c) {
+        x = std::clamp<std::ptrdiff_t>(x, 0, static_cast<std::ptrdiff_t>(width) - 1);
+        y = std::clamp<std::ptrdiff_t>(y, 0, static_cast<std::ptrdiff_t>(height) - 1);
+        return source[(static_cast<std::size_t>(y) * width + static_cast<std::size_t>(x)) * channels + c];
+    };
+
+    for (std::size_t y = static_cast<std::size_t>(rect.m_y); y < rect.m_y + rect.m_height; ++y) {
+        for (std::size_t x = static_cast<std::size_t>(rect.m_x); x < rect.m_x + rect.m_width; ++x) {
+            const float sx = a[0] * static_cast<float>(x) + a[1] * static_cast<float>(y) + a[2];
+            const float sy = a[3] * static_cast<float>(x) + a[4] * static_cast<float>(y) + a[5];
+            const float fx = std::floor(sx);
+            const float fy = std::floor(sy);
+            const float wx = sx - fx;
+            const float wy = sy - fy;
+            const auto ix = static_cast<std::ptrdiff_t>(fx);
+            const auto iy = static_cast<std::ptrdiff_t>(fy);
+
+            float* pixel = pixels.data() + (y * width + x) * channels;
+            for (std::size_t c = 0; c < channels; ++c) {
+                const float top = at(ix, iy, c) + wx * (at(ix + 1, iy, c) - at(ix, iy, c));
+                const float bottom = at(ix, iy + 1, c) + wx * (at(ix + 1, iy + 1, c) - at(ix, iy + 1, c));
+                pixel[c] = top + wy * (bottom - top);
+            }
+        }
+    }
+
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Operations
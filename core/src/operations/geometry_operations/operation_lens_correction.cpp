@@ -0,0 +1,232 @@
+/**
+ * @file operation_lens_correction.cpp
+ * @brief Implementation of OperationLensCorrection
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/operation_lens_correction.h"
+#include "operations/standalone_execution.h"
+#include "operations/geometry_operations/lens_profile.h"
+#include "common/error_handling/core_error.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Lens models of a descriptor, if it has valid ones.
+ */
+[[nodiscard]] std::optional<LensProfile> profileOf(const OperationDescriptor& descriptor)
+{
+    const auto text_res = descriptor.getParam<std::string>(ParameterKey::LensProfile);
+    if (!text_res || text_res.value().empty()) {
+        return std::nullopt;
+    }
+    auto profile = LensProfile::parse(text_res.value());
+    if (!profile) {
+        spdlog::warn("OperationLensCorrection: Malformed lens profile '{}', not corrected", text_res.value());
+    }
+    return profile;
+}
+
+/**
+ * @brief Resamples each channel at its corrected radius and divides the vignetting out.
+ */
+[[nodiscard]] Halide::Func applyLensCorrection(
+    const Halide::Func& input,
+    const Halide::ImageParam& table,
+    const Halide::Expr& amount,
+    const Halide::Expr& width,
+    const Halide::Expr& height,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c)
+{
+    const Halide::Expr safe_amount = Halide::clamp(amount, OperationLensCorrection::MIN_LENS_CORRECTION_VALUE,
+                                                   OperationLensCorrection::MAX_LENS_CORRECTION_VALUE);
+
+    // Offset of the pixel center from the image center, and its radius (1 at the corners)
+    const Halide::Expr w = Halide::cast<float>(width);
+    const Halide::Expr h = Halide::cast<float>(height);
+    const Halide::Expr dx = Halide::cast<float>(x) + 0.5f - 0.5f * w;
+    const Halide::Expr dy = Halide::cast<float>(y) + 0.5f - 0.5f * h;
+    const Halide::Expr radius = Halide::sqrt(dx * dx + dy * dy) * (2.0f / Halide::sqrt(w * w + h * h));
+
+    // Alpha moves with green
+    const Halide::Expr entry = Halide::select(c < 3, c, 1);
+    const Halide::Expr scale = Halide::lerp(1.0f, LensProfile::sampleRadial(table, radius, entry), safe_amount);
+    const Halide::Expr gain = Halide::lerp(1.0f, LensProfile::sampleRadial(table, radius, LensProfile::k_gain_entry), safe_amount);
+
+    // Source position, in pixel indices; the taps stay in the image (bounded gather)
+    const Halide::Expr sx = 0.5f * w + dx * scale - 0.5f;
+    const Halide::Expr sy = 0.5f * h + dy * scale - 0.5f;
+    const Halide::Expr fx = Halide::floor(sx);
+    const Halide::Expr fy = Halide::floor(sy);
+    const Halide::Expr wx = sx - fx;
+    const Halide::Expr wy = sy - fy;
+    const Halide::Expr x0 = Halide::clamp(Halide::cast<int>(fx), 0, width - 1);
+    const Halide::Expr y0 = Halide::clamp(Halide::cast<int>(fy), 0, height - 1);
+    const Halide::Expr x1 = Halide::clamp(Halide::cast<int>(fx) + 1, 0, width - 1);
+    const Halide::Expr y1 = Halide::clamp(Halide::cast<int>(fy) + 1, 0, height - 1);
+
+    const Halide::Expr sampled = Halide::lerp(Halide::lerp(input(x0, y0, c), input(x1, y0, c), wx),
+                                              Halide::lerp(input(x0, y1, c), input(x1, y1, c), wx),
+                                              wy);
+
+    Halide::Func lens_func("lens_correction_op");
+    lens_func(x, y, c) = Halide::select(c < 3, sampled * gain, sampled);
+    return lens_func;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// IOperation Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationLensCorrection::execute(
+    ImageProcessing::IWorkingImageHardware& working_image,
+    const OperationDescriptor& descriptor)
+{
+    // Step 1: Validation
+    if (!working_image.isValid()) {
+        spdlog::warn("OperationLensCorrection::execute: Invalid working image provided");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    if (!descriptor.enabled) {
+        CM_LOG_TRACE(Operations, "OperationLensCorrection::execute: Operation is disabled, skipping");
+        return {};
+    }
+
+    // Step 2: No-Op Optimization
+    const auto profile = profileOf(descriptor);
+    const float amount = descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_LENS_CORRECTION_VALUE);
+    if (!profile || profile->isIdentity() || amount <= MIN_LENS_CORRECTION_VALUE) {
+        CM_LOG_TRACE(Operations, "OperationLensCorrection::execute: Nothing to correct, skipping");
+        return {};
+    }
+    CM_LOG_DEBUG(Operations, "OperationLensCorrection::execute: Correcting '{}' with amount={:.2f}", profile->format(), amount);
+
+    // Step 3: Execute in place, on the image's own buffers (the fused graph of this operation alone)
+    return StandaloneExecution::run(*this, descriptor, working_image);
+}
+
+// ============================================================================
+// IOperationFusionLogic Implementation
+// ============================================================================
+
+Halide::Func OperationLensCorrection::appendToFusedPipeline(
+    const Halide::Func& input_func,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params,
+    FusedLuminance& /*luminance*/
+    ) const
+{
+    // Declared as runtime inputs of the graph: the amount and the lens change without recompilation.
+    const Halide::Param<float>& amount = params.scalar(FusionParameterBlock::k_value_key, DEFAULT_LENS_CORRECTION_VALUE);
+    const Halide::ImageParam& table = params.lut(k_table_key, LensProfile::identity());
+
+    CM_LOG_TRACE(Operations, "OperationLensCorrection::appendToFusedPipeline: Fusing with a radial table and one gather");
+    return applyLensCorrection(input_func, table, amount, params.imageWidth(), params.imageHeight(), x, y, c);
+}
+
+void OperationLensCorrection::updateFusionParameters(const OperationDescriptor& descriptor, FusionParameterBlock& params) const
+{
+    params.bindScalars(descriptor);
+
+    // Cached after the first sampling: a map lookup per edit, and the same buffer is rebound
+    const auto profile = profileOf(descriptor);
+    params.setLut(k_table_key, profile ? LensProfile::table(*profile) : LensProfile::identity());
+}
+
+bool OperationLensCorrection::isIdentity(const OperationDescriptor& descriptor) const
+{
+    const auto profile = profileOf(descriptor);
+    return !profile || profile->isIdentity()
+           || descriptor.getParam<float>(ParameterKey::Value).value_or(DEFAULT_LENS_CORRECTION_VALUE) <= MIN_LENS_CORRECTION_VALUE;
+}
+
+// ============================================================================
+// IOperationDefaultLogic Implementation
+// ============================================================================
+
+std::expected<void, ErrorHandling::CoreError> OperationLensCorrection::executeOnImageRegion(
+    Common::ImageRegion& region,
+    const OperationDescriptor& params
+    ) const
+{
+    if (!region.isValid()) {
+        spdlog::error("[OperationLensCorrection] executeOnImageRegion: Invalid ImageRegion.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const auto profile = profileOf(params);
+    const float amount = std::clamp(params.getParam<float>(ParameterKey::Value).value_or(DEFAULT_LENS_CORRECTION_VALUE),
+                                    MIN_LENS_CORRECTION_VALUE, MAX_LENS_CORRECTION_VALUE);
+    if (!profile || profile->isIdentity() || amount <= MIN_LENS_CORRECTION_VALUE) {
+        return {};
+    }
+
+    const Halide::Buffer<float> table = LensProfile::table(*profile);
+    const std::size_t width = region.width();
+    const std::size_t height = region.height();
+    const std::size_t channels = region.channels();
+    const float w = static_cast<float>(width);
+    const float h = static_cast<float>(height);
+    const float inverse_radius = 2.0f / std::sqrt(w * w + h * h);
+
+    // Every pixel reads others: sample a copy
+    const std::span<float> pixels = region.getBuffer();
+    const std::vector<float> source(pixels.begin(), pixels.end());
+
+    auto at = [&](std::ptrdiff_t px, std::ptrdiff_t py, std::size_t ch) {
+        px = std::clamp<std::ptrdiff_t>(px, 0, static_cast<std::ptrdiff_t>(width) - 1);
+        py = std::clamp<std::ptrdiff_t>(py, 0, static_cast<std::ptrdiff_t>(height) - 1);
+        return source[(static_cast<std::size_t>(py) * width + static_cast<std::size_t>(px)) * channels + ch];
+    };
+
+    for (std::size_t y = 0; y < height; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            const float dx = static_cast<float>(x) + 0.5f - 0.5f * w;
+            const float dy = static_cast<float>(y) + 0.5f - 0.5f * h;
+            const auto entries = LensProfile::lookup(table, std::sqrt(dx * dx + dy * dy) * inverse_radius);
+            const float gain = 1.0f + amount * (entries[LensProfile::k_gain_entry] - 1.0f);
+
+            float* pixel = pixels.data() + (y * width + x) * channels;
+            for (std::size_t c = 0; c < channels; ++c) {
+                const float scale = 1.0f + amount * (entries[c < 3 ? c : 1] - 1.0f);
+                const float sx = 0.5f * w + dx * scale - 0.5f;
+                const float sy = 0.5f * h + dy * scale - 0.5f;
+                const float fx = std::floor(sx);
+                const float fy = std::floor(sy);
+                const float wx = sx - fx;
+                const float wy = sy - fy;
+                const auto ix = static_cast<std::ptrdiff_t>(fx);
+                const auto iy = static_cast<std::ptrdiff_t>(fy);
+
+                const float top = at(ix, iy, c) + wx * (at(ix + 1, iy, c) - at(ix, iy, c));
+                const float bottom = at(ix, iy + 1, c) + wx * (at(ix + 1, iy + 1, c) - at(ix, iy + 1, c));
+                const float sampled = top + wy * (bottom - top);
+                pixel[c] = c < 3 ? sampled * gain : sampled;
+            }
+        }
+    }
+
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,296 @@
+/**
+ * @file local_mask.cpp
+ * @brief Implementation of LocalMask.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/masks/local_mask.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr int k_tile = MaskTiles::k_tile_size;
+
+/**
+ * @brief Stored coverage of a pixel of `tiles` (0 in an empty tile).
+ */
+[[nodiscard]] MaskTiles::Coverage storedAt(const MaskTiles& tiles, int x, int y) noexcept
+{
+    const MaskTiles::Tile* stored = tiles.tile(x / k_tile, y / k_tile);
+    return stored ? (*stored)[static_cast<std::size_t>((y % k_tile) * k_tile + x % k_tile)] : MaskTiles::Coverage{0};
+}
+
+/**
+ * @brief Weight of a dab at distance `distance` from its center: `flow` inside the hard core,
+ *        a smoothstep down to 0 at the radius.
+ */
+[[nodiscard]] float dabWeight(const BrushDab& dab, float distance) noexcept
+{
+    if (distance >= dab.m_radius) {
+        return 0.0f;
+    }
+    const float inner = dab.m_radius * std::clamp(dab.m_hardness, 0.0f, 1.0f);
+    const float t = dab.m_radius > inner ? std::clamp((distance - inner) / (dab.m_radius - inner), 0.0f, 1.0f) : 0.0f;
+    return std::clamp(dab.m_flow, 0.0f, 1.0f) * (1.0f - t * t * (3.0f - 2.0f * t));
+}
+
+[[nodiscard]] MaskTiles::Coverage quantize(float coverage) noexcept
+{
+    return static_cast<MaskTiles::Coverage>(std::lround(std::clamp(coverage, 0.0f, 1.0f) * MaskTiles::k_full_coverage));
+}
+
+[[nodiscard]] bool isEmpty(const MaskTiles::Tile& tile) noexcept
+{
+    return std::ranges::all_of(tile, [](MaskTiles::Coverage value) { return value == 0; });
+}
+
+} // anonymous namespace
+
+LocalMask::LocalMask(Common::ImageDim width, Common::ImageDim height)
+    : m_width(width)
+    , m_height(height)
+{
+    // Halve down to a level that fits in a single tile
+    Common::ImageDim level_width{width};
+    Common::ImageDim level_height{height};
+    m_levels.emplace_back(level_width, level_height);
+    while (level_width > static_cast<Common::ImageDim>(k_tile) || level_height > static_cast<Common::ImageDim>(k_tile)) {
+        level_width = (level_width + 1) / 2;
+        level_height = (level_height + 1) / 2;
+        m_levels.emplace_back(level_width, level_height);
+    }
+    m_level_count = m_levels.size();
+    m_atlases.resize(m_level_count);
+}
+
+Common::RegionOfInterest LocalMask::paint(std::span<const BrushDab> dabs)
+{
+    std::scoped_lock lock(m_mutex);
+
+    MaskTiles& base = m_levels.front();
+    const auto width = static_cast<std::int64_t>(m_width);
+    const auto height = static_cast<std::int64_t>(m_height);
+
+    std::vector<char> touched(static_cast<std::size_t>(base.tilesX()) * static_cast<std::size_t>(base.tilesY()), 0);
+    std::int64_t dirty_x0{width}, dirty_y0{height}, dirty_x1{0}, dirty_y1{0};
+
+    for (const BrushDab& dab : dabs) {
+        if (!(dab.m_radius > 0.0f) || !(dab.m_flow > 0.0f)) {
+            continue;
+        }
+        const std::int64_t x0 = std::max<std::int64_t>(static_cast<std::int64_t>(std::floor(dab.m_x - dab.m_radius)), 0);
+        const std::int64_t y0 = std::max<std::int64_t>(static_cast<std::int64_t>(std::floor(dab.m_y - dab.m_radius)), 0);
+        const std::int64_t x1 = std::min<std::int64_t>(static_cast<std::int64_t>(std::ceil(dab.m_x + dab.m_radius)), width);
+        const std::int64_t y1 = std::min<std::int64_t>(static_cast<std::int64_t>(std::ceil(dab.m_y + dab.m_radius)), height);
+        if (x1 <= x0 || y1 <= y0) {
+            continue;
+        }
+
+        for (auto ty = static_cast<int>(y0 / k_tile); ty <= static_cast<int>((y1 - 1) / k_tile); ++ty) {
+            for (auto tx = static_cast<int>(x0 / k_tile); tx <= static_cast<int>((x1 - 1) / k_tile); ++tx) {
+                if (dab.m_erase && !base.tile(tx, ty)) {
+                    continue; // Nothing to erase
+                }
+                MaskTiles::Tile& tile = base.writableTile(tx, ty);
+
+                const std::int64_t tile_x0 = std::max<std::int64_t>(x0, std::int64_t{tx} * k_tile);
+                const std::int64_t tile_y0 = std::max<std::int64_t>(y0, std::int64_t{ty} * k_tile);
+                const std::int64_t tile_x1 = std::min<std::int64_t>(x1, std::int64_t{tx + 1} * k_tile);
+                const std::int64_t tile_y1 = std::min<std::int64_t>(y1, std::int64_t{ty + 1} * k_tile);
+
+                for (std::int64_t py = tile_y0; py < tile_y1; ++py) {
+                    const float dy = static_cast<float>(py) + 0.5f - dab.m_y;
+                    for (std::int64_t px = tile_x0; px < tile_x1; ++px) {
+                        const float dx = static_cast<float>(px) + 0.5f - dab.m_x;
+                        const float weight = dabWeight(dab, std::sqrt(dx * dx + dy * dy));
+                        if (weight <= 0.0f) {
+                            continue;
+                        }
+                        auto& stored = tile[static_cast<std::size_t>((py % k_tile) * k_tile + px % k_tile)];
+                        const float coverage = static_cast<float>(stored) / MaskTiles::k_full_coverage;
+                        stored = quantize(dab.m_erase ? coverage * (1.0f - weight) : coverage + weight * (1.0f - coverage));
+                    }
+                }
+
+                if (isEmpty(tile)) {
+                    base.releaseTile(tx, ty);
+                }
+                touched[static_cast<std::size_t>(ty) * static_cast<std::size_t>(base.tilesX()) + static_cast<std::size_t>(tx)] = 1;
+            }
+        }
+
+        dirty_x0 = std::min(dirty_x0, x0);
+        dirty_y0 = std::min(dirty_y0, y0);
+        dirty_x1 = std::max(dirty_x1, x1);
+        dirty_y1 = std::max(dirty_y1, y1);
+    }
+
+    if (dirty_x1 <= dirty_x0 || dirty_y1 <= dirty_y0) {
+        return {};
+    }
+
+    // Propagate to the coarser levels: only the parents of the touched tiles
+    int tiles_x{base.tilesX()};
+    for (std::size_t level = 1; level < m_level_count; ++level) {
+        const MaskTiles& parent = m_levels[level];
+        std::vector<char> parents(static_cast<std::size_t>(parent.tilesX()) * static_cast<std::size_t>(parent.tilesY()), 0);
+        for (std::size_t index = 0; index < touched.size(); ++index) {
+            if (touched[index]) {
+                const int tx = static_cast<int>(index % static_cast<std::size_t>(tiles_x)) / 2;
+                const int ty = static_cast<int>(index / static_cast<std::size_t>(tiles_x)) / 2;
+                parents[static_cast<std::size_t>(ty) * static_cast<std::size_t>(parent.tilesX()) + static_cast<std::size_t>(tx)] = 1;
+            }
+        }
+        for (std::size_t index = 0; index < parents.size(); ++index) {
+            if (parents[index]) {
+                downsampleTile(level,
+                               static_cast<int>(index % static_cast<std::size_t>(parent.tilesX())),
+                               static_cast<int>(index / static_cast<std::size_t>(parent.tilesX())));
+            }
+        }
+        touched = std::move(parents);
+        tiles_x = parent.tilesX();
+    }
+
+    ++m_version;
+    std::ranges::fill(m_atlases, std::nullopt);
+
+    return Common::RegionOfInterest{
+        static_cast<Common::ImageCoord>(dirty_x0),
+        static_cast<Common::ImageCoord>(dirty_y0),
+        static_cast<Common::ImageDim>(dirty_x1 - dirty_x0),
+        static_cast<Common::ImageDim>(dirty_y1 - dirty_y0)
+    };
+}
+
+void LocalMask::downsampleTile(std::size_t level, int tx, int ty)
+{
+    const MaskTiles& child = m_levels[level - 1];
+    MaskTiles& parent = m_levels[level];
+    const auto child_width = static_cast<int>(child.width());
+    const auto child_height = static_cast<int>(child.height());
+
+    MaskTiles::Tile averaged{};
+    const int rows = std::min(k_tile, static_cast<int>(parent.height()) - ty * k_tile);
+    const int columns = std::min(k_tile, static_cast<int>(parent.width()) - tx * k_tile);
+    for (int py = 0; py < rows; ++py) {
+        const int cy0 = 2 * (ty * k_tile + py);
+        const int cy1 = std::min(cy0 + 1, child_height - 1);
+        for (int px = 0; px < columns; ++px) {
+            const int cx0 = 2 * (tx * k_tile + px);
+            const int cx1 = std::min(cx0 + 1, child_width - 1);
+            const int sum = storedAt(child, cx0, cy0) + storedAt(child, cx1, cy0)
+                            + storedAt(child, cx0, cy1) + storedAt(child, cx1, cy1);
+            averaged[static_cast<std::size_t>(py * k_tile + px)] = static_cast<MaskTiles::Coverage>((sum + 2) / 4);
+        }
+    }
+
+    if (isEmpty(averaged)) {
+        parent.releaseTile(tx, ty);
+    } else {
+        parent.writableTile(tx, ty) = averaged;
+    }
+}
+
+void LocalMask::clear()
+{
+    std::scoped_lock lock(m_mutex);
+    for (MaskTiles& level : m_levels) {
+        level = MaskTiles(level.width(), level.height());
+    }
+    ++m_version;
+    std::ranges::fill(m_atlases, std::nullopt);
+}
+
+std::uint64_t LocalMask::version() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_version;
+}
+
+std::size_t LocalMask::levelFor(Common::ImageDim width) const noexcept
+{
+    for (std::size_t level = m_level_count; level-- > 0;) {
+        if (m_levels[level].width() >= width) {
+            return level;
+        }
+    }
+    return 0;
+}
+
+MaskTiles LocalMask::level(std::size_t level) const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_levels[level];
+}
+
+float LocalMask::coverage(Common::ImageCoord x, Common::ImageCoord y) const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_levels.front().coverage(x, y);
+}
+
+LocalMask::Atlas LocalMask::atlas(std::size_t level) const
+{
+    std::scoped_lock lock(m_mutex);
+    auto& cached = m_atlases[level];
+    if (!cached) {
+        cached = buildAtlas(m_levels[level]);
+        spdlog::debug("[LocalMask::atlas]: Packed level {} ({} tile(s)).", level, cached->m_tiles.dim(2).extent() - 1);
+    }
+    return *cached;
+}
+
+LocalMask::Atlas LocalMask::buildAtlas(const MaskTiles& tiles)
+{
+    const int tiles_x = std::max(tiles.tilesX(), 1);
+    const int tiles_y = std::max(tiles.tilesY(), 1);
+
+    Atlas atlas{Halide::Buffer<std::int32_t>(tiles_x, tiles_y),
+                Halide::Buffer<std::uint8_t>(k_tile, k_tile, static_cast<int>(tiles.allocatedTiles()) + 1),
+                std::max<Common::ImageDim>(tiles.width(), 1),
+                std::max<Common::ImageDim>(tiles.height(), 1)};
+    atlas.m_table.fill(0);
+    atlas.m_tiles.fill(0);
+
+    // Dimension 0 is dense and dimension 1 has a stride of k_tile: a slot is one stored tile
+    std::int32_t slot{0};
+    for (int ty = 0; ty < tiles.tilesY(); ++ty) {
+        for (int tx = 0; tx < tiles.tilesX(); ++tx) {
+            if (const MaskTiles::Tile* stored = tiles.tile(tx, ty)) {
+                ++slot;
+                std::memcpy(&atlas.m_tiles(0, 0, slot), stored->data(), sizeof(MaskTiles::Tile));
+                atlas.m_table(tx, ty) = slot;
+            }
+        }
+    }
+    return atlas;
+}
+
+LocalMask::Atlas LocalMask::emptyAtlas()
+{
+    Atlas atlas{Halide::Buffer<std::int32_t>(1, 1), Halide::Buffer<std::uint8_t>(k_tile, k_tile, 1), 1, 1};
+    atlas.m_table.fill(0);
+    atlas.m_tiles.fill(0);
+    return atlas;
+}
+
+std::size_t LocalMask::bytes() const
+{
+    std::scoped_lock lock(m_mutex);
+    std::size_t total{0};
+    for (const MaskTiles& level : m_levels) {
+        total += level.bytes();
+    }
+    return total;
+}
+
+} // namespace CaptureMoment::Core::Operations
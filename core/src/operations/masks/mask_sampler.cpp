@@ -0,0 +1,133 @@
+/**
+ * @file mask_sampler.cpp
+ * @brief Implementation of MaskSampler.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/masks/mask_sampler.h"
+#include "operations/masks/mask_store.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Table of tile slots (see `LocalMask::Atlas::m_table`).
+ */
+constexpr std::string_view k_table_key = "mask_table";
+
+/**
+ * @brief Packed tiles (see `LocalMask::Atlas::m_tiles`).
+ */
+constexpr std::string_view k_tiles_key = "mask_tiles";
+
+/**
+ * @brief Size of the bound level, in pixels.
+ */
+constexpr std::string_view k_width_key = "mask_width";
+constexpr std::string_view k_height_key = "mask_height";
+
+/**
+ * @brief Nearest pixel of a `mask_size` axis under pixel `coordinate` of an `image_size` axis.
+ */
+[[nodiscard]] Halide::Expr maskCoordinate(const Halide::Expr& coordinate, const Halide::Expr& mask_size, const Halide::Expr& image_size)
+{
+    const Halide::Expr extent = Halide::max(Halide::cast<int>(mask_size), 1);
+    const Halide::Expr scaled = (Halide::cast<float>(coordinate) + 0.5f) * mask_size / Halide::cast<float>(Halide::max(image_size, 1));
+    return Halide::clamp(Halide::cast<int>(Halide::floor(scaled)), 0, extent - 1);
+}
+
+} // anonymous namespace
+
+bool MaskSampler::isMasked(const OperationDescriptor& descriptor)
+{
+    const auto id = descriptor.getParam<std::string>(ParameterKey::Mask);
+    return id.has_value() && !id->empty();
+}
+
+Halide::Func MaskSampler::append(
+    const Halide::Func& before,
+    const Halide::Func& after,
+    const Halide::Var& x,
+    const Halide::Var& y,
+    const Halide::Var& c,
+    FusionParameterBlock& params)
+{
+    const LocalMask::Atlas empty = LocalMask::emptyAtlas();
+    const Halide::ImageParam& table = params.lut(k_table_key, empty.m_table);
+    const Halide::ImageParam& tiles = params.lut(k_tiles_key, empty.m_tiles);
+    const Halide::Param<float>& mask_width = params.scalar(k_width_key, 1.0f);
+    const Halide::Param<float>& mask_height = params.scalar(k_height_key, 1.0f);
+
+    const Halide::Expr mx = maskCoordinate(x, mask_width, params.imageWidth());
+    const Halide::Expr my = maskCoordinate(y, mask_height, params.imageHeight());
+
+    // Empty tiles map to slot 0, a tile of zeros: the lookup never branches
+    constexpr int tile_size = MaskTiles::k_tile_size;
+    const Halide::Expr tx = Halide::clamp(mx / tile_size, 0, table.dim(0).extent() - 1);
+    const Halide::Expr ty = Halide::clamp(my / tile_size, 0, table.dim(1).extent() - 1);
+    const Halide::Expr slot = Halide::clamp(table(tx, ty), 0, tiles.dim(2).extent() - 1);
+
+    Halide::Func coverage("mask_coverage");
+    coverage(x, y) = Halide::cast<float>(tiles(mx % tile_size, my % tile_size, slot)) / float{MaskTiles::k_full_coverage};
+
+    Halide::Func masked("masked_op");
+    masked(x, y, c) = Halide::select(
+        c < 3,
+        before(x, y, c) + coverage(x, y) * (after(x, y, c) - before(x, y, c)),
+        after(x, y, c) // Alpha as the operation leaves it
+        );
+    return masked;
+}
+
+void MaskSampler::bind(const OperationDescriptor& descriptor, FusionParameterBlock& params, Common::ImageDim image_width)
+{
+    const std::string id = descriptor.getParam<std::string>(ParameterKey::Mask).value_or(std::string{});
+    const auto mask = MaskStore::instance().find(id);
+    if (!mask) {
+        spdlog::warn("[MaskSampler::bind]: Mask '{}' of '{}' not found. The operation has no effect.", id, descriptor.name);
+    }
+
+    const LocalMask::Atlas atlas = mask ? mask->atlas(mask->levelFor(image_width)) : LocalMask::emptyAtlas();
+    params.setLut(k_table_key, atlas.m_table);
+    params.setLut(k_tiles_key, atlas.m_tiles);
+    params.setScalar(k_width_key, static_cast<float>(atlas.m_width));
+    params.setScalar(k_height_key, static_cast<float>(atlas.m_height));
+}
+
+void MaskSampler::blend(std::span<const float> before, Common::ImageRegion& after, const OperationDescriptor& descriptor)
+{
+    const std::string id = descriptor.getParam<std::string>(ParameterKey::Mask).value_or(std::string{});
+    const auto mask = MaskStore::instance().find(id);
+    const std::span<float> pixels = after.getBuffer();
+    if (before.size() != pixels.size() || after.m_width == 0 || after.m_height == 0) {
+        return;
+    }
+
+    const MaskTiles level = mask ? mask->level(mask->levelFor(after.m_width)) : MaskTiles{};
+    const double scale_x = static_cast<double>(level.width()) / static_cast<double>(after.m_width);
+    const double scale_y = static_cast<double>(level.height()) / static_cast<double>(after.m_height);
+    const std::size_t channels = after.m_channels;
+    const std::size_t color_channels = std::min<std::size_t>(channels, 3);
+
+    for (Common::ImageDim py = 0; py < after.m_height; ++py) {
+        const auto my = static_cast<Common::ImageCoord>((static_cast<double>(py) + 0.5) * scale_y);
+        for (Common::ImageDim px = 0; px < after.m_width; ++px) {
+            const auto mx = static_cast<Common::ImageCoord>((static_cast<double>(px) + 0.5) * scale_x);
+            const float coverage = level.coverage(mx, my);
+            const std::size_t offset = (py * after.m_width + px) * channels;
+            for (std::size_t ch = 0; ch < color_channels; ++ch) {
+                pixels[offset + ch] = before[offset + ch] + coverage * (pixels[offset + ch] - before[offset + ch]);
+            }
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
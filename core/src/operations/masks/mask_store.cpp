@@ -0,0 +1,58 @@
+/**
+ * @file mask_store.cpp
+ * @brief Implementation of MaskStore.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/masks/mask_store.h"
+
+#include <spdlog/spdlog.h>
+
+#include <format>
+
+namespace CaptureMoment::Core::Operations {
+
+MaskStore& MaskStore::instance()
+{
+    static MaskStore store;
+    return store;
+}
+
+std::string MaskStore::create(Common::ImageDim width, Common::ImageDim height)
+{
+    auto mask = std::make_shared<LocalMask>(width, height);
+
+    std::scoped_lock lock(m_mutex);
+    std::string id = std::format("mask-{}", m_next_id++);
+    m_masks.emplace(id, std::move(mask));
+    spdlog::debug("[MaskStore::create]: Created '{}' ({}x{}).", id, width, height);
+    return id;
+}
+
+std::shared_ptr<LocalMask> MaskStore::find(std::string_view id) const
+{
+    std::scoped_lock lock(m_mutex);
+    const auto it = m_masks.find(std::string(id));
+    return it != m_masks.end() ? it->second : nullptr;
+}
+
+void MaskStore::release(std::string_view id)
+{
+    std::scoped_lock lock(m_mutex);
+    m_masks.erase(std::string(id));
+}
+
+void MaskStore::clear()
+{
+    std::scoped_lock lock(m_mutex);
+    m_masks.clear();
+}
+
+std::size_t MaskStore::size() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_masks.size();
+}
+
+} // namespace CaptureMoment::Core::Operations
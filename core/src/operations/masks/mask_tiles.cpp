@@ -0,0 +1,84 @@
+/**
+ * @file mask_tiles.cpp
+ * @brief Implementation of MaskTiles.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/masks/mask_tiles.h"
+
+#include <algorithm>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] int tileCount(Common::ImageDim pixels) noexcept
+{
+    return static_cast<int>((pixels + MaskTiles::k_tile_size - 1) / MaskTiles::k_tile_size);
+}
+
+} // anonymous namespace
+
+MaskTiles::MaskTiles(Common::ImageDim width, Common::ImageDim height)
+    : m_width(width)
+    , m_height(height)
+    , m_tiles_x(tileCount(width))
+    , m_tiles_y(tileCount(height))
+    , m_tiles(static_cast<std::size_t>(m_tiles_x) * static_cast<std::size_t>(m_tiles_y))
+{
+}
+
+std::ptrdiff_t MaskTiles::indexOf(int tx, int ty) const noexcept
+{
+    if (tx < 0 || ty < 0 || tx >= m_tiles_x || ty >= m_tiles_y) {
+        return -1;
+    }
+    return static_cast<std::ptrdiff_t>(ty) * m_tiles_x + tx;
+}
+
+const MaskTiles::Tile* MaskTiles::tile(int tx, int ty) const noexcept
+{
+    const std::ptrdiff_t index = indexOf(tx, ty);
+    return index < 0 ? nullptr : m_tiles[static_cast<std::size_t>(index)].get();
+}
+
+MaskTiles::Tile& MaskTiles::writableTile(int tx, int ty)
+{
+    auto& slot = m_tiles[static_cast<std::size_t>(indexOf(tx, ty))];
+    if (!slot) {
+        slot = std::make_shared<Tile>();
+        slot->fill(0);
+    } else if (slot.use_count() > 1) {
+        // Shared with a snapshot: write to a copy of this tile only
+        slot = std::make_shared<Tile>(*slot);
+    }
+    return *slot;
+}
+
+void MaskTiles::releaseTile(int tx, int ty) noexcept
+{
+    if (const std::ptrdiff_t index = indexOf(tx, ty); index >= 0) {
+        m_tiles[static_cast<std::size_t>(index)].reset();
+    }
+}
+
+float MaskTiles::coverage(Common::ImageCoord x, Common::ImageCoord y) const noexcept
+{
+    if (x < 0 || y < 0) {
+        return 0.0f;
+    }
+    const Tile* stored = tile(x / k_tile_size, y / k_tile_size);
+    if (!stored) {
+        return 0.0f;
+    }
+    const auto offset = static_cast<std::size_t>((y % k_tile_size) * k_tile_size + x % k_tile_size);
+    return static_cast<float>((*stored)[offset]) / static_cast<float>(k_full_coverage);
+}
+
+std::size_t MaskTiles::allocatedTiles() const noexcept
+{
+    return static_cast<std::size_t>(std::ranges::count_if(m_tiles, [](const auto& stored) { return stored != nullptr; }));
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,82 @@
+/**
+ * @file operation_cost.cpp
+ * @brief Implementation of the chain cost estimates
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/operation_cost.h"
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/operation_descriptor.h"
+#include "operations/operation_factory.h"
+#include "operations/operation_registry.h"
+
+#include <array>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Factory of the built-in operations and of the plugins loaded so far.
+ * @details Built per estimate (a map of creators): plugins loaded later are known to the next one.
+ */
+[[nodiscard]] OperationFactory registeredFactory()
+{
+    OperationFactory factory;
+    OperationRegistry::registerAll(factory);
+    return factory;
+}
+
+} // anonymous namespace
+
+ChainCost chainCost(std::span<const OperationDescriptor> operations, const OperationFactory& factory)
+{
+    ChainCost total;
+    for (const auto& descriptor : operations) {
+        if (!descriptor.enabled) {
+            continue;
+        }
+
+        auto operation = factory.create(descriptor);
+        if (!operation || !*operation) {
+            total.add(OperationCost::perPixel());
+            continue;
+        }
+
+        // Left out of the fused chain: free
+        if (const auto* fusion = dynamic_cast<const IOperationFusionLogic*>(operation->get());
+            fusion && fusion->isIdentity(descriptor)) {
+            continue;
+        }
+        total.add((*operation)->cost(descriptor));
+    }
+    return total;
+}
+
+ChainCost chainCost(std::span<const OperationDescriptor> operations)
+{
+    return chainCost(operations, registeredFactory());
+}
+
+ChainCost benchmarkChainCost()
+{
+    static constexpr std::array k_benchmark_operations {
+        OperationType::Brightness, OperationType::Contrast, OperationType::Highlights,
+        OperationType::Shadows, OperationType::Whites, OperationType::Blacks
+    };
+
+    // The benchmark sets every adjustment away from its identity: sum the costs as they are
+    const OperationFactory factory { registeredFactory() };
+    ChainCost total;
+    for (const OperationType type : k_benchmark_operations) {
+        OperationDescriptor descriptor;
+        descriptor.type = type;
+        auto operation = factory.create(descriptor);
+        total.add(operation && *operation ? (*operation)->cost(descriptor) : OperationCost::perPixel());
+    }
+    return total;
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -9,6 +9,7 @@
 #include "operations/operation_descriptor.h"
 #include "operations/interfaces/i_operation.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 
 namespace CaptureMoment::Core::Operations {
 
@@ -31,4 +32,15 @@ namespace CaptureMoment::Core::Operations {
     return op;
 }
 
+std::vector<OperationType> OperationFactory::registeredTypes() const
+{
+    std::vector<OperationType> types;
+    types.reserve(m_creators.size());
+    for (const auto& [type, creator] : m_creators) {
+        types.push_back(type);
+    }
+    std::ranges::sort(types);
+    return types;
+}
+
 } // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,90 @@
+/**
+ * @file operation_parameters.cpp
+ * @brief Implementation of OperationParameters.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/operation_parameters.h"
+
+#include <bit>
+#include <type_traits>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Converts a numeric value to the type of the key.
+ */
+[[nodiscard]] OperationValue toKeyType(ParameterKey key, OperationValue value)
+{
+    switch (key) {
+    case ParameterKey::Value:
+    case ParameterKey::CurveShadows:
+    case ParameterKey::CurveDarks:
+    case ParameterKey::CurveLights:
+    case ParameterKey::CurveHighlights:
+    case ParameterKey::Temperature:
+    case ParameterKey::Tint:
+    case ParameterKey::CropLeft:
+    case ParameterKey::CropTop:
+    case ParameterKey::CropRight:
+    case ParameterKey::CropBottom:
+    case ParameterKey::Angle:
+    case ParameterKey::ColorNoise:
+    case ParameterKey::Radius:
+        return std::visit([&value](const auto& held) -> OperationValue {
+            using T = std::decay_t<decltype(held)>;
+            if constexpr (std::is_same_v<T, int> || std::is_same_v<T, bool>) {
+                return static_cast<float>(held);
+            } else {
+                return std::move(value);
+            }
+        }, value);
+    case ParameterKey::MaskMode:
+        return std::visit([&value](const auto& held) -> OperationValue {
+            using T = std::decay_t<decltype(held)>;
+            if constexpr (std::is_same_v<T, float> || std::is_same_v<T, bool>) {
+                return static_cast<int>(held);
+            } else {
+                return std::move(value);
+            }
+        }, value);
+    case ParameterKey::CurvePoints:
+    case ParameterKey::LutPath:
+    case ParameterKey::CameraProfile:
+    case ParameterKey::LensProfile:
+    case ParameterKey::Mask:
+    case ParameterKey::Count:
+        break;
+    }
+    return value;
+}
+
+} // namespace
+
+void OperationParameters::set(ParameterKey key, OperationValue value)
+{
+    m_values[ParameterKeys::indexOf(key)] = toKeyType(key, std::move(value));
+    m_present_mask |= bit(key);
+}
+
+void OperationParameters::erase(ParameterKey key) noexcept
+{
+    m_values[ParameterKeys::indexOf(key)] = OperationValue{};
+    m_present_mask &= ~bit(key);
+}
+
+void OperationParameters::clear() noexcept
+{
+    m_values.fill(OperationValue{});
+    m_present_mask = 0;
+}
+
+std::size_t OperationParameters::size() const noexcept
+{
+    return static_cast<std::size_t>(std::popcount(m_present_mask));
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -13,12 +13,20 @@
 #include "operations/basic_adjustment_operations/operation_shadows.h"
 #include "operations/basic_adjustment_operations/operation_whites.h"
 #include "operations/basic_adjustment_operations/operation_blacks.h"
+#include "operations/basic_adjustment_operations/operation_exposure.h"
+#include "operations/basic_adjustment_operations/operation_saturation.h"
+#include "operations/basic_adjustment_operations/operation_tone_curve.h"
+#include "operations/color_operations/operation_lut3d.h"
+#include "operations/color_operations/operation_white_balance.h"
+#include "operations/detail_operations/operation_clarity.h"
+#include "operations/detail_operations/operation_denoise.h"
+#include "operations/detail_operations/operation_sharpen.h"
+#include "operations/geometry_operations/operation_crop.h"
+#include "operations/geometry_operations/operation_lens_correction.h"
+#include "operations/plugins/operation_plugin_registry.h"
 
-// #include "operations/operation_saturation.h"       // TODO: Implement
 // #include "operations/operation_hue.h"              // TODO: Implement
-// #include "operations/operation_exposure.h"         // TODO: Implement
 // #include "operations/operation_vibrance.h"         // TODO: Implement
-// #include "operations/operation_clarity.h"          // TODO: Implement
 // #include "operations/operation_sharpen.h"          // TODO: Implement
 // #include "operations/operation_color_profile.h"    // TODO: Implement
 // #include "operations/operation_blur.h"             // TODO: Implement
@@ -32,10 +40,12 @@ void OperationRegistry::registerAll(OperationFactory& factory) {
     spdlog::info("OperationRegistry: Registering all operations");
 
     registerToneAdjustments(factory);
-    // registerColorOperations(factory);
-    // registerColorProfiles(factory);
-    // registerDetailOperations(factory);
+    registerColorOperations(factory);
+    registerColorProfiles(factory);
+    registerDetailOperations(factory);
+    registerGeometryOperations(factory);
     // registerEffects(factory);
+    registerPluginOperations(factory);
 
     spdlog::info("OperationRegistry: All operations registered");
 }
@@ -67,8 +77,13 @@ void OperationRegistry::registerToneAdjustments(OperationFactory& factory) {
     factory.registerCreator(OperationType::Blacks, []() { return std::make_unique<OperationBlacks>(); });
     spdlog::trace("Factory register Blacks");
 
-    // factory.registerCreator(OperationType::Exposure, []() { return std::make_unique<OperationExposure>(); });
-    // spdlog::trace("ok: Exposure");
+    // Exposure
+    factory.registerCreator(OperationType::Exposure, []() { return std::make_unique<OperationExposure>(); });
+    spdlog::trace("Factory register Exposure");
+
+    // Tone Curve
+    factory.registerCreator(OperationType::ToneCurve, []() { return std::make_unique<OperationToneCurve>(); });
+    spdlog::trace("Factory register ToneCurve");
 
     // REMOVED DUPLICATE: factory.registerCreator(OperationType::Shadows, []() { return std::make_unique<OperationShadows>(); });
 }
@@ -76,9 +91,15 @@ void OperationRegistry::registerToneAdjustments(OperationFactory& factory) {
 void OperationRegistry::registerColorOperations(OperationFactory& factory) {
     spdlog::debug("OperationRegistry: Registering color operations");
 
+    // Saturation
+    factory.registerCreator(OperationType::Saturation, []() { return std::make_unique<OperationSaturation>(); });
+    spdlog::trace("Factory register Saturation");
+
+    // 3D LUT
+    factory.registerCreator(OperationType::Lut3D, []() { return std::make_unique<OperationLut3D>(); });
+    spdlog::trace("Factory register Lut3D");
+
     // TODO: Add color operations as they are implemented
-    // factory.registerCreator(OperationType::Saturation, []() { return std::make_unique<OperationSaturation>(); });
-    // spdlog::trace("ok: Saturation");
 
     // factory.registerCreator(OperationType::Hue, []() { return std::make_unique<OperationHue>(); });
     // spdlog::trace("ok: Hue");
@@ -93,13 +114,14 @@ void OperationRegistry::registerColorOperations(OperationFactory& factory) {
 void OperationRegistry::registerColorProfiles(OperationFactory& factory) {
     spdlog::debug("OperationRegistry: Registering color profile operations");
 
+    // White Balance (and camera matrix)
+    factory.registerCreator(OperationType::WhiteBalance, []() { return std::make_unique<OperationWhiteBalance>(); });
+    spdlog::trace("Factory register WhiteBalance");
+
     // TODO: Add color profile operations as they are implemented
     // factory.registerCreator(OperationType::ColorProfile, []() { return std::make_unique<OperationColorProfile>(); });
     // spdlog::trace("ok: Color Profile");
 
-    // factory.registerCreator(OperationType::WhiteBalance, []() { return std::make_unique<OperationWhiteBalance>(); });
-    // spdlog::trace("ok: White Balance");
-
     // factory.registerCreator(OperationType::ColorSpaceConversion, []() { return std::make_unique<OperationColorSpaceConversion>(); });
     // spdlog::trace("ok: Color Space Conversion");
 }
@@ -107,18 +129,34 @@ void OperationRegistry::registerColorProfiles(OperationFactory& factory) {
 void OperationRegistry::registerDetailOperations(OperationFactory& factory) {
     spdlog::debug("OperationRegistry: Registering detail operations");
 
-    // TODO: Add detail operations as they are implemented
-    // factory.registerCreator(OperationType::Sharpen, []() { return std::make_unique<OperationSharpen>(); });
-    // spdlog::trace("ok: Sharpen");
+    // Clarity
+    factory.registerCreator(OperationType::Clarity, []() { return std::make_unique<OperationClarity>(); });
+    spdlog::trace("Factory register Clarity");
 
-    // factory.registerCreator(OperationType::Clarity, []() { return std::make_unique<OperationClarity>(); });
-    // spdlog::trace("ok: Clarity");
+    // Denoise (luminance and color)
+    factory.registerCreator(OperationType::Denoise, []() { return std::make_unique<OperationDenoise>(); });
+    spdlog::trace("Factory register Denoise");
+
+    // Sharpen (unsharp mask)
+    factory.registerCreator(OperationType::Sharpen, []() { return std::make_unique<OperationSharpen>(); });
+    spdlog::trace("Factory register Sharpen");
+
+    // TODO: Add detail operations as they are implemented
 
     // factory.registerCreator(OperationType::Texture, []() { return std::make_unique<OperationTexture>(); });
     // spdlog::trace("ok: Texture");
+}
+
+void OperationRegistry::registerGeometryOperations(OperationFactory& factory) {
+    spdlog::debug("OperationRegistry: Registering geometry operations");
+
+    // Crop (and straighten)
+    factory.registerCreator(OperationType::Crop, []() { return std::make_unique<OperationCrop>(); });
+    spdlog::trace("Factory register Crop");
 
-    // factory.registerCreator(OperationType::Denoise, []() { return std::make_unique<OperationDenoise>(); });
-    // spdlog::trace("ok: Denoise");
+    // Lens Correction (distortion, vignetting, lateral chromatic aberration)
+    factory.registerCreator(OperationType::LensCorrection, []() { return std::make_unique<OperationLensCorrection>(); });
+    spdlog::trace("Factory register LensCorrection");
 }
 
 void OperationRegistry::registerEffects(OperationFactory& factory) {
@@ -138,4 +176,11 @@ void OperationRegistry::registerEffects(OperationFactory& factory) {
     // spdlog::trace("ok: Perspective");
 }
 
+void OperationRegistry::registerPluginOperations(OperationFactory& factory) {
+    spdlog::debug("OperationRegistry: Registering plugin operations");
+
+    // Loaded at initialization (CAPTUREMOMENT_PLUGIN_PATH) or by the application
+    OperationPluginRegistry::registerAll(factory);
+}
+
 } // namespace CaptureMoment::Core::Operations
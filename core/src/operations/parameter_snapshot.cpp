@@ -0,0 +1,29 @@
+/**
+ * @file parameter_snapshot.cpp
+ * @brief Implementation of ParameterSnapshot.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/parameter_snapshot.h"
+
+namespace CaptureMoment::Core::Operations {
+
+void ParameterSnapshot::applyTo(std::vector<OperationDescriptor>& operations) const
+{
+    if (m_present_mask == 0) {
+        return;
+    }
+
+    for (auto& desc : operations) {
+        if (!has(desc.type)) {
+            continue;
+        }
+        // Inline slot: no allocation
+        if (desc.params.contains(ParameterKey::Value)) {
+            desc.params.set(ParameterKey::Value, m_values[slotOf(desc.type)]);
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,307 @@
+/**
+ * @file operation_plugin_registry.cpp
+ * @brief Implementation of OperationPluginRegistry
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/plugins/operation_plugin_registry.h"
+#include "operations/operation_factory.h"
+
+#include <spdlog/spdlog.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr std::size_t k_plugin_type_count { 256 - OperationPluginRegistry::k_first_plugin_type };
+
+/**
+ * @brief Extension of the shared libraries of the platform.
+ */
+#if defined(_WIN32)
+constexpr std::string_view k_library_extension { ".dll" };
+#elif defined(__APPLE__)
+constexpr std::string_view k_library_extension { ".dylib" };
+#else
+constexpr std::string_view k_library_extension { ".so" };
+#endif
+
+using ApiVersionFunction = std::uint32_t (*)();
+using RegisterFunction = void (*)(IOperationPluginRegistrar&);
+
+/**
+ * @brief One plugin operation.
+ */
+struct PluginOperation {
+    std::string m_name;
+    PluginOperationCreator m_creator;
+};
+
+/**
+ * @brief The registry's state. Slots are filled once and never cleared, so that the names
+ *        handed out by `typeName` stay valid.
+ */
+struct RegistryState {
+    std::shared_mutex m_mutex;
+    std::array<std::optional<PluginOperation>, k_plugin_type_count> m_operations;
+
+    // Loads run one at a time (a plugin registers while it is loaded)
+    std::mutex m_load_mutex;
+    std::vector<void*> m_libraries;
+};
+
+[[nodiscard]] RegistryState& state()
+{
+    static RegistryState s_state;
+    return s_state;
+}
+
+/**
+ * @brief FNV-1a: the same slot for the same name on every platform and session.
+ */
+[[nodiscard]] std::uint32_t hashName(std::string_view name) noexcept
+{
+    std::uint32_t hash { 2166136261u };
+    for (const char character : name) {
+        hash ^= static_cast<std::uint8_t>(character);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Qualified names only ("vendor.Operation"): they cannot clash with a built-in enumerator.
+ */
+[[nodiscard]] bool isValidName(std::string_view name) noexcept
+{
+    return name.find('.') != std::string_view::npos && name.front() != '.' && name.back() != '.'
+           && std::ranges::all_of(name, [](char character) {
+                  return std::isalnum(static_cast<unsigned char>(character)) || character == '.' || character == '_'
+                         || character == '-';
+              });
+}
+
+[[nodiscard]] void* openLibrary(const std::filesystem::path& path)
+{
+#if defined(_WIN32)
+    return LoadLibraryW(path.c_str());
+#else
+    return dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+}
+
+[[nodiscard]] void* findSymbol(void* library, const char* name)
+{
+#if defined(_WIN32)
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library), name));
+#else
+    return dlsym(library, name);
+#endif
+}
+
+void closeLibrary(void* library)
+{
+#if defined(_WIN32)
+    FreeLibrary(static_cast<HMODULE>(library));
+#else
+    dlclose(library);
+#endif
+}
+
+/**
+ * @brief Hands the operations of a plugin to the registry, counting them.
+ */
+class Registrar final : public IOperationPluginRegistrar {
+public:
+    std::optional<OperationType> addOperation(std::string_view type_name, PluginOperationCreator creator) override
+    {
+        auto type { OperationPluginRegistry::addOperation(type_name, std::move(creator)) };
+        m_added += type ? 1 : 0;
+        return type;
+    }
+
+    /**
+     * @brief Number of operations added.
+     */
+    std::size_t m_added { 0 };
+};
+
+} // anonymous namespace
+
+std::expected<std::size_t, ErrorHandling::CoreError> OperationPluginRegistry::load(const std::filesystem::path& library)
+{
+    RegistryState& registry { state() };
+    const std::scoped_lock lock { registry.m_load_mutex };
+
+    void* handle { openLibrary(library) };
+    if (!handle) {
+        spdlog::error("[OperationPluginRegistry::load]: Cannot open '{}'", library.string());
+        return std::unexpected(ErrorHandling::CoreError::PluginError);
+    }
+
+    const auto api_version { reinterpret_cast<ApiVersionFunction>(findSymbol(handle, "capturemoment_plugin_api_version")) };
+    const auto register_operations { reinterpret_cast<RegisterFunction>(findSymbol(handle, "capturemoment_register_operations")) };
+    if (!api_version || !register_operations) {
+        spdlog::error("[OperationPluginRegistry::load]: '{}' is not an operation plugin", library.string());
+        closeLibrary(handle);
+        return std::unexpected(ErrorHandling::CoreError::PluginError);
+    }
+    if (api_version() != k_operation_plugin_api_version) {
+        spdlog::error("[OperationPluginRegistry::load]: '{}' was built for the plugin API {} (this version: {})",
+                      library.string(), api_version(), k_operation_plugin_api_version);
+        closeLibrary(handle);
+        return std::unexpected(ErrorHandling::CoreError::PluginError);
+    }
+
+    Registrar registrar;
+    register_operations(registrar);
+    if (registrar.m_added == 0) {
+        spdlog::error("[OperationPluginRegistry::load]: '{}' registered no operation", library.string());
+        closeLibrary(handle);
+        return std::unexpected(ErrorHandling::CoreError::PluginError);
+    }
+
+    // Never unloaded: the creators and the compiled pipelines point into the library
+    registry.m_libraries.push_back(handle);
+    spdlog::info("[OperationPluginRegistry::load]: '{}' added {} operation(s)", library.string(), registrar.m_added);
+    return registrar.m_added;
+}
+
+std::size_t OperationPluginRegistry::loadDirectory(const std::filesystem::path& directory)
+{
+    std::error_code error;
+    std::vector<std::filesystem::path> libraries;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_regular_file(error) && entry.path().extension() == k_library_extension) {
+            libraries.push_back(entry.path());
+        }
+    }
+    if (error) {
+        spdlog::warn("[OperationPluginRegistry::loadDirectory]: Cannot list '{}': {}", directory.string(), error.message());
+    }
+
+    // Sorted: colliding names are probed in the same order on every launch
+    std::ranges::sort(libraries);
+
+    std::size_t loaded { 0 };
+    for (const auto& library : libraries) {
+        loaded += load(library) ? 1 : 0;
+    }
+    return loaded;
+}
+
+std::optional<OperationType> OperationPluginRegistry::addOperation(std::string_view type_name, PluginOperationCreator creator)
+{
+    if (!isValidName(type_name) || !creator) {
+        spdlog::error("[OperationPluginRegistry::addOperation]: Invalid operation '{}' (names are qualified, "
+                      "e.g. \"vendor.Operation\")", type_name);
+        return std::nullopt;
+    }
+
+    RegistryState& registry { state() };
+    const std::unique_lock lock { registry.m_mutex };
+
+    const bool taken { std::ranges::any_of(registry.m_operations, [type_name](const auto& operation) {
+        return operation && operation->m_name == type_name;
+    }) };
+    if (taken) {
+        spdlog::error("[OperationPluginRegistry::addOperation]: '{}' is already registered", type_name);
+        return std::nullopt;
+    }
+
+    // The slot of the name, or the next free one
+    const std::size_t first { hashName(type_name) % k_plugin_type_count };
+    for (std::size_t probe = 0; probe < k_plugin_type_count; ++probe) {
+        const std::size_t slot { (first + probe) % k_plugin_type_count };
+        if (registry.m_operations[slot]) {
+            continue;
+        }
+        if (probe > 0) {
+            spdlog::warn("[OperationPluginRegistry::addOperation]: '{}' collides with another plugin operation; "
+                         "its binary edits depend on the load order", type_name);
+        }
+        registry.m_operations[slot] = PluginOperation { std::string(type_name), std::move(creator) };
+        return static_cast<OperationType>(k_first_plugin_type + slot);
+    }
+
+    spdlog::error("[OperationPluginRegistry::addOperation]: No operation type left for '{}'", type_name);
+    return std::nullopt;
+}
+
+void OperationPluginRegistry::registerAll(OperationFactory& factory)
+{
+    RegistryState& registry { state() };
+    const std::shared_lock lock { registry.m_mutex };
+
+    for (std::size_t slot = 0; slot < k_plugin_type_count; ++slot) {
+        if (const auto& operation { registry.m_operations[slot] }) {
+            const auto type { static_cast<OperationType>(k_first_plugin_type + slot) };
+            factory.registerCreator(type, [creator = operation->m_creator, type]() { return creator(type); });
+            spdlog::trace("Factory register {}", operation->m_name);
+        }
+    }
+}
+
+bool OperationPluginRegistry::contains(OperationType type)
+{
+    const auto value { std::to_underlying(type) };
+    if (value < k_first_plugin_type) {
+        return false;
+    }
+
+    RegistryState& registry { state() };
+    const std::shared_lock lock { registry.m_mutex };
+    return registry.m_operations[value - k_first_plugin_type].has_value();
+}
+
+std::string_view OperationPluginRegistry::typeName(OperationType type)
+{
+    const auto value { std::to_underlying(type) };
+    if (value < k_first_plugin_type) {
+        return magic_enum::enum_name(type);
+    }
+
+    RegistryState& registry { state() };
+    const std::shared_lock lock { registry.m_mutex };
+    const auto& operation { registry.m_operations[value - k_first_plugin_type] };
+    return operation ? std::string_view { operation->m_name } : std::string_view {};
+}
+
+std::optional<OperationType> OperationPluginRegistry::findType(std::string_view name)
+{
+    if (const auto type { magic_enum::enum_cast<OperationType>(name) }) {
+        return type;
+    }
+
+    RegistryState& registry { state() };
+    const std::shared_lock lock { registry.m_mutex };
+    for (std::size_t slot = 0; slot < k_plugin_type_count; ++slot) {
+        if (registry.m_operations[slot] && registry.m_operations[slot]->m_name == name) {
+            return static_cast<OperationType>(k_first_plugin_type + slot);
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace CaptureMoment::Core::Operations
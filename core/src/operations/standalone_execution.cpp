@@ -0,0 +1,199 @@
+/**
+ * @file standalone_execution.cpp
+ * @brief Implementation of StandaloneExecution.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/standalone_execution.h"
+#include "operations/fused_luminance.h"
+#include "operations/fusion_parameter_block.h"
+#include "operations/masks/mask_sampler.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "image_processing/halide/halide_device_transfer.h"
+#include "image_processing/halide/working_image_halide.h"
+#include "config/app_config.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+std::expected<void, ErrorHandling::CoreError> StandaloneExecution::run(
+    const IOperationFusionLogic& operation,
+    const OperationDescriptor& descriptor,
+    ImageProcessing::IWorkingImageHardware& working_image)
+{
+    auto* halide_image = dynamic_cast<ImageProcessing::WorkingImageHalide*>(&working_image);
+    if (!halide_image) {
+        return runOnHostView(operation, descriptor, working_image);
+    }
+
+    // The destination holds the current image; the source is overwritten with the result
+    Halide::Buffer<> current = halide_image->getHalideBuffer();
+    Halide::Buffer<> result = halide_image->getHalideSourceBuffer();
+    if (!current.defined() || !result.defined() || current.type() != result.type()
+        || current.width() != result.width() || current.height() != result.height()
+        || !ImageProcessing::hasLayout(current, halide_image->getStorageLayout())
+        || !ImageProcessing::hasLayout(result, halide_image->getStorageLayout())) {
+        spdlog::error("StandaloneExecution::run: Halide buffers are undefined or mismatched.");
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    try {
+        const Halide::Target target = Config::AppConfig::getHalideTarget(working_image.getMemoryType());
+        const bool edge_clamped = operation.readsNeighborhood(operation.fusionVariant(descriptor));
+
+        Halide::Var x, y, c;
+        Halide::Func source = edge_clamped ? Halide::BoundaryConditions::repeat_edge(current) : Halide::Func(current);
+        Halide::Func input("standalone_input");
+        input(x, y, c) = Halide::cast<float>(source(x, y, c));
+
+        Halide::Func output = build(operation, descriptor, input, current.width(), current.height(), result.type(), target,
+                                    halide_image->getStorageLayout());
+
+        CM_LOG_TRACE(Operations, "StandaloneExecution::run: Realizing {} for {}.",
+                     magic_enum::enum_name(descriptor.type), target.to_string());
+        // GPU images stay on the device: Halide reads the device copy of 'current'
+        output.realize(result, target);
+
+        // Both buffers hold the result, as after an upload (device-side copy for GPU images)
+        if (!ImageProcessing::copyOnDevice(result, current)) {
+            result.copy_to_host();
+            current.copy_from(result);
+            current.set_host_dirty();
+        }
+        return {};
+
+    } catch (const std::exception& e) {
+        spdlog::critical("StandaloneExecution::run: Exception while applying {}: {}", magic_enum::enum_name(descriptor.type), e.what());
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+Halide::Func StandaloneExecution::build(
+    const IOperationFusionLogic& operation,
+    const OperationDescriptor& descriptor,
+    const Halide::Func& input,
+    int width,
+    int height,
+    const Halide::Type& stored_type,
+    const Halide::Target& target,
+    Common::PixelLayout layout)
+{
+    Halide::Var x, y, c;
+
+    // Same graph as a fused chain of one (see OperationPipelineExecutor::buildOperationChain)
+    FusionParameterBlock params;
+    params.setVariant(operation.fusionVariant(descriptor));
+    params.setImageExtent(width, height);
+    FusedLuminance luminance;
+    Halide::Func output = operation.appendToFusedPipeline(input, x, y, c, params, luminance);
+    const bool masked = MaskSampler::isMasked(descriptor);
+    if (masked) {
+        output = MaskSampler::append(input, output, x, y, c, params);
+    }
+    operation.updateFusionParameters(descriptor, params);
+    if (masked) {
+        MaskSampler::bind(descriptor, params, static_cast<Common::ImageDim>(width));
+    }
+
+    Halide::Func stored("standalone_output");
+    stored(x, y, c) = Halide::cast(stored_type, output(x, y, c));
+
+    scheduleStage(stored, x, y, c, target);
+    for (const Halide::Func& stage : params.spatialStages()) {
+        scheduleStage(stage, x, y, c, target);
+    }
+    ImageProcessing::constrainLayout(stored.output_buffer(), layout);
+    return stored;
+}
+
+void StandaloneExecution::scheduleStage(Halide::Func stage, const Halide::Var& x, const Halide::Var& y, const Halide::Var& c,
+                                        const Halide::Target& target)
+{
+    const bool on_gpu = target.has_gpu_feature();
+
+    stage.compute_root();
+    if (stage.dimensions() == 3) {
+        stage.bound(c, 0, ImageProcessing::k_interleaved_channels).reorder(c, x, y).unroll(c);
+    }
+
+    if (on_gpu) {
+        Halide::Var xi, yi;
+        ImageProcessing::applyGpuTiles(stage, x, y, xi, yi, Config::AppConfig::getGpuTileSchedule());
+    } else {
+        stage.parallel(y).vectorize(x, target.natural_vector_size<float>());
+    }
+
+    // Reductions (e.g. the bilateral grid splat) keep x and y pure
+    for (int i = 0; i < stage.num_update_definitions(); ++i) {
+        if (on_gpu) {
+            Halide::Var xo, yo, xi, yi;
+            stage.update(i).gpu_tile(x, y, xo, yo, xi, yi, 8, 8);
+        } else {
+            stage.update(i).parallel(y);
+        }
+    }
+}
+
+std::expected<void, ErrorHandling::CoreError> StandaloneExecution::runOnHostView(
+    const IOperationFusionLogic& operation,
+    const OperationDescriptor& descriptor,
+    ImageProcessing::IWorkingImageHardware& working_image)
+{
+    auto view_result = working_image.exportToCPUView();
+    if (!view_result) {
+        spdlog::error("StandaloneExecution::runOnHostView: Failed to export working image view");
+        return std::unexpected(view_result.error());
+    }
+    Common::ImageView view = std::move(view_result.value());
+
+    try {
+        Halide::Buffer<const float> input_buf = ImageProcessing::wrapView(view);
+
+        Common::ImageRegion result_region(
+            Common::PixelBuffer(static_cast<std::size_t>(view.m_width) * view.m_height * view.m_channels),
+            view.m_width, view.m_height, view.m_channels);
+
+        Halide::Buffer<float> output_buf = ImageProcessing::wrapInterleaved(
+            result_region.getBuffer().data(),
+            static_cast<int>(view.m_width),
+            static_cast<int>(view.m_height),
+            static_cast<int>(view.m_channels)
+            );
+
+        const bool edge_clamped = operation.readsNeighborhood(operation.fusionVariant(descriptor));
+        Halide::Var x, y, c;
+        Halide::Func input("standalone_input");
+        if (edge_clamped) {
+            input(x, y, c) = Halide::BoundaryConditions::repeat_edge(input_buf)(x, y, c);
+        } else {
+            input(x, y, c) = input_buf(x, y, c);
+        }
+
+        const Halide::Target target = Halide::get_jit_target_from_environment();
+        Halide::Func output = build(operation, descriptor, input, output_buf.width(), output_buf.height(), Halide::Float(32), target);
+        output.realize(output_buf, target);
+
+        // Release the view first so the working image can reuse its block
+        view = {};
+        auto update_res = working_image.updateFromCPU(result_region);
+        if (!update_res) {
+            spdlog::error("StandaloneExecution::runOnHostView: Failed to update working image from CPU");
+            return std::unexpected(update_res.error());
+        }
+        return {};
+
+    } catch (const std::exception& e) {
+        spdlog::critical("StandaloneExecution::runOnHostView: Exception while applying {}: {}", magic_enum::enum_name(descriptor.type), e.what());
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
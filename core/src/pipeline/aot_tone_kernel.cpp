@@ -0,0 +1,120 @@
+/**
+ * @file aot_tone_kernel.cpp
+ * @brief Implementation of AotToneKernel.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/aot_tone_kernel.h"
+#include "operations/basic_adjustment_operations/tone_mask_mode.h"
+#include "operations/masks/mask_sampler.h"
+
+#include "config.h"
+
+#if CAPTUREMOMENT_USE_AOT_TONE_KERNEL
+#include "capturemoment_tone_kernel.h"
+#endif
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+/**
+ * @brief Position of an operation in the kernel's canonical order, or -1 if it is not part of the kernel.
+ */
+[[nodiscard]] int toneStageIndex(Operations::OperationType type) noexcept
+{
+    switch (type) {
+    case Operations::OperationType::Brightness: return 0;
+    case Operations::OperationType::Contrast:   return 1;
+    case Operations::OperationType::Highlights: return 2;
+    case Operations::OperationType::Shadows:    return 3;
+    case Operations::OperationType::Whites:     return 4;
+    case Operations::OperationType::Blacks:     return 5;
+    default:                                    return -1;
+    }
+}
+
+} // namespace
+
+bool AotToneKernel::isAvailable() noexcept
+{
+    return CAPTUREMOMENT_USE_AOT_TONE_KERNEL != 0;
+}
+
+std::optional<ToneKernelArguments> AotToneKernel::matchChain(const std::vector<Operations::OperationDescriptor>& operations)
+{
+    ToneKernelArguments arguments;
+    int last_stage = -1;
+
+    for (const auto& desc : operations) {
+        if (!desc.enabled) {
+            continue;
+        }
+
+        const int stage = toneStageIndex(desc.type);
+        if (stage <= last_stage) {
+            // Not a tone adjustment, duplicated, or out of canonical order
+            return std::nullopt;
+        }
+        if (Operations::toneMaskModeOf(desc) != Operations::ToneMaskMode::PerPixel) {
+            // The kernel only has the per-pixel masks
+            return std::nullopt;
+        }
+        if (Operations::MaskSampler::isMasked(desc)) {
+            // Nor the local ones
+            return std::nullopt;
+        }
+
+        auto val_res = desc.getParam<float>(Operations::ParameterKey::Value);
+        if (!val_res) {
+            return std::nullopt;
+        }
+
+        arguments.m_values[static_cast<std::size_t>(stage)] = val_res.value();
+        arguments.m_enabled_mask |= (1 << stage);
+        last_stage = stage;
+    }
+
+    if (arguments.m_enabled_mask == 0) {
+        return std::nullopt;
+    }
+
+    return arguments;
+}
+
+bool AotToneKernel::run(const ToneKernelArguments& arguments,
+                        const Halide::Buffer<float>& input,
+                        Halide::Buffer<float>& output)
+{
+#if CAPTUREMOMENT_USE_AOT_TONE_KERNEL
+    const int result = capturemoment_tone_kernel(
+        input.raw_buffer(),
+        arguments.m_enabled_mask,
+        arguments.m_values[0],
+        arguments.m_values[1],
+        arguments.m_values[2],
+        arguments.m_values[3],
+        arguments.m_values[4],
+        arguments.m_values[5],
+        output.raw_buffer());
+
+    if (result != 0) {
+        spdlog::error("[AotToneKernel::run]: Kernel returned error code {}.", result);
+        return false;
+    }
+
+    output.set_host_dirty();
+    return true;
+#else
+    (void)arguments;
+    (void)input;
+    (void)output;
+    spdlog::error("[AotToneKernel::run]: AOT tone kernel is not available in this build.");
+    return false;
+#endif
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -0,0 +1,108 @@
+/**
+ * @file autoscheduler.cpp
+ * @brief Implementation of Autoscheduler.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/autoscheduler.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace CaptureMoment::Core::Pipeline {
+
+std::string_view Autoscheduler::nameFor(const Halide::Target& target) noexcept
+{
+    // Adams2019 only emits CPU schedules
+    return target.has_gpu_feature() ? "Li2018" : "Adams2019";
+}
+
+bool Autoscheduler::loadPlugin(std::string_view name)
+{
+    static std::mutex s_mutex;
+    static std::map<std::string, bool, std::less<>> s_loaded;
+
+    std::lock_guard lock(s_mutex);
+    if (auto it = s_loaded.find(name); it != s_loaded.end()) {
+        return it->second;
+    }
+
+    // e.g. "Adams2019" -> "autoschedule_adams2019" (libautoschedule_adams2019.so / .dylib / .dll)
+    std::string library = "autoschedule_";
+    std::ranges::transform(name, std::back_inserter(library),
+                           [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+
+    bool loaded = false;
+    try {
+        Halide::load_plugin(library);
+        loaded = true;
+        spdlog::info("[Autoscheduler::loadPlugin]: Loaded '{}'.", library);
+    }
+    catch (const std::exception& e) {
+        spdlog::warn("[Autoscheduler::loadPlugin]: Cannot load '{}': {}", library, e.what());
+    }
+
+    s_loaded.emplace(std::string(name), loaded);
+    return loaded;
+}
+
+std::optional<std::string> Autoscheduler::apply(Halide::Pipeline& pipeline, const Halide::Target& target)
+{
+    const std::string_view name = nameFor(target);
+    if (!loadPlugin(name)) {
+        return std::nullopt;
+    }
+
+    Halide::AutoschedulerParams params(std::string(name));
+    params.extra["parallelism"] = std::to_string(std::max(1u, std::thread::hardware_concurrency()));
+
+    try {
+        Halide::AutoSchedulerResults results = pipeline.apply_autoscheduler(target, params);
+        spdlog::debug("[Autoscheduler::apply]: {} scheduled the pipeline for {}.", name, target.to_string());
+        return std::move(results.schedule_source);
+    }
+    catch (const std::exception& e) {
+        spdlog::warn("[Autoscheduler::apply]: {} failed: {}", name, e.what());
+        return std::nullopt;
+    }
+}
+
+void Autoscheduler::exportSchedule(const std::filesystem::path& directory,
+                                   std::string_view cache_key,
+                                   const std::string& source)
+{
+    std::string file_name(cache_key);
+    std::ranges::replace_if(file_name, [](char ch) {
+        return ch == '|' || ch == ',' || ch == '/' || ch == '\\' || ch == ':';
+    }, '_');
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        spdlog::warn("[Autoscheduler::exportSchedule]: Cannot create '{}': {}", directory.string(), error.message());
+        return;
+    }
+
+    const std::filesystem::path path = directory / (file_name + ".schedule.h");
+    if (std::filesystem::exists(path, error)) {
+        return;
+    }
+
+    std::ofstream file(path);
+    file << "// Schedule of '" << cache_key << "'\n" << source;
+    if (!file) {
+        spdlog::warn("[Autoscheduler::exportSchedule]: Cannot write '{}'.", path.string());
+        return;
+    }
+    spdlog::info("[Autoscheduler::exportSchedule]: Exported the schedule of '{}' to '{}'.", cache_key, path.string());
+}
+
+} // namespace CaptureMoment::Core::Pipeline
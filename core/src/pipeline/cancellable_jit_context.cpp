@@ -0,0 +1,139 @@
+/**
+ * @file cancellable_jit_context.cpp
+ * @brief Implementation of CancellableJITContext.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/cancellable_jit_context.h"
+#include "common/trace/allocation_tracker.h"
+#include "common/trace/perf_counters.h"
+#include "image_processing/gpu/gpu_devices.h"
+#include "workers/compute_pool.h"
+#include "workers/engine_scheduler.h"
+
+#include <new>
+#include <utility>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+/**
+ * @brief Alignment of Halide's own `halide_malloc`, which the generated code relies on.
+ */
+constexpr std::align_val_t k_halide_alignment { 128 };
+
+} // anonymous namespace
+
+CancellableJITContext::CancellableJITContext(Common::CancellationToken token)
+    : m_token(std::move(token))
+{
+    handlers.custom_do_task = &CancellableJITContext::doTask;
+    handlers.custom_do_par_for = &CancellableJITContext::doParFor;
+    ImageProcessing::GpuDevices::instance().addContextHandlers(handlers);
+}
+
+void CancellableJITContext::capturePrints(std::string& sink) noexcept
+{
+    m_print_sink = &sink;
+    handlers.custom_print = &CancellableJITContext::print;
+}
+
+void CancellableJITContext::runSerially() noexcept
+{
+    handlers.custom_do_par_for = &CancellableJITContext::doParForSerial;
+}
+
+void CancellableJITContext::print(Halide::JITUserContext* context, const char* text)
+{
+    auto* self = static_cast<CancellableJITContext*>(context);
+    if (self->m_print_sink && text) {
+        self->m_print_sink->append(text);
+    }
+}
+
+int CancellableJITContext::doTask(Halide::JITUserContext* context,
+                                  int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                                  int index,
+                                  std::uint8_t* closure)
+{
+    // Halide hands back the context given to realize(), i.e. this object
+    if (static_cast<const CancellableJITContext*>(context)->m_token.isCancelled()) {
+        return k_cancelled_status;
+    }
+    return task(context, index, closure);
+}
+
+int CancellableJITContext::doParFor(Halide::JITUserContext* context,
+                                    int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                                    int min,
+                                    int extent,
+                                    std::uint8_t* closure)
+{
+    // Untagged callers (GUI thread, tests) wait for the result: they get the interactive lane
+    const auto priority { Workers::EngineScheduler::currentPriority().value_or(Workers::TaskPriority::Interactive) };
+    const auto do_task { context ? context->handlers.custom_do_task : nullptr };
+
+    // The iterations allocate on behalf of the caller's trace scope
+    const char* stage { Common::Trace::AllocationTracker::currentStage() };
+
+    const auto run = [&](int index) {
+        const Common::Trace::AllocationTracker::ScopedStage stage_scope { stage };
+        return do_task ? do_task(context, task, min + index, closure) : task(context, min + index, closure);
+    };
+
+    if (!Common::Trace::PerfCounters::isEnabled()) {
+        return Workers::ComputePool::instance().parallelFor(priority, extent, run);
+    }
+
+    // Profiling: the hardware counters of the pool threads are added to the caller's scope
+    Common::Trace::PerfCounters::Accumulator counters;
+    return Workers::ComputePool::instance().parallelFor(priority, extent, [&](int index) {
+        return counters.measure([&] { return run(index); });
+    });
+}
+
+int CancellableJITContext::doParForSerial(Halide::JITUserContext* context,
+                                          int (*task)(Halide::JITUserContext*, int, std::uint8_t*),
+                                          int min,
+                                          int extent,
+                                          std::uint8_t* closure)
+{
+    const auto do_task { context ? context->handlers.custom_do_task : nullptr };
+    for (int index = min; index < min + extent; ++index) {
+        const int status { do_task ? do_task(context, task, index, closure) : task(context, index, closure) };
+        if (status != 0) {
+            return status;
+        }
+    }
+    return 0;
+}
+
+void* CancellableJITContext::trackedMalloc(Halide::JITUserContext*, std::size_t bytes)
+{
+    // Padded by one alignment unit, as halide_malloc does: vectorized loops may read past the end
+    void* ptr { ::operator new(bytes + static_cast<std::size_t>(k_halide_alignment), k_halide_alignment, std::nothrow) };
+    Common::Trace::AllocationTracker::instance().recordAllocation(ptr, bytes);
+    return ptr;
+}
+
+void CancellableJITContext::trackedFree(Halide::JITUserContext*, void* ptr)
+{
+    Common::Trace::AllocationTracker::instance().recordFree(ptr);
+    ::operator delete(ptr, k_halide_alignment);
+}
+
+void CancellableJITContext::installDefaultHandlers()
+{
+    Halide::JITHandlers handlers;
+    handlers.custom_do_par_for = &CancellableJITContext::doParFor;
+    if (Common::Trace::AllocationTracker::instance().isEnabled()) {
+        handlers.custom_malloc = &CancellableJITContext::trackedMalloc;
+        handlers.custom_free = &CancellableJITContext::trackedFree;
+    }
+    ImageProcessing::GpuDevices::instance().addContextHandlers(handlers);
+    Halide::Internal::JITSharedRuntime::set_default_handlers(handlers);
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -0,0 +1,83 @@
+/**
+ * @file compiled_pipeline_cache.cpp
+ * @brief Implementation of CompiledPipelineCache.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/compiled_pipeline_cache.h"
+#include "operations/plugins/operation_plugin_registry.h"
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::Core::Pipeline {
+
+CompiledPipelineCache::CompiledPipelineCache(std::size_t capacity)
+    : m_capacity(capacity == 0 ? 1 : capacity)
+{
+}
+
+std::string CompiledPipelineCache::makeKey(const std::vector<Operations::OperationType>& chain,
+                                           const Halide::Target& target)
+{
+    std::string key { target.to_string() };
+    key += '|';
+
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        if (i > 0) {
+            key += ',';
+        }
+        key += Operations::OperationPluginRegistry::typeName(chain[i]);
+    }
+
+    return key;
+}
+
+std::optional<CompiledPipelineEntry> CompiledPipelineCache::find(const std::string& key)
+{
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        return std::nullopt;
+    }
+
+    // Move to front (most recently used)
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->second;
+}
+
+void CompiledPipelineCache::insert(const std::string& key, CompiledPipelineEntry entry)
+{
+    if (auto it = m_index.find(key); it != m_index.end()) {
+        it->second->second = std::move(entry);
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    m_entries.emplace_front(key, std::move(entry));
+    m_index[key] = m_entries.begin();
+
+    if (m_entries.size() > m_capacity) {
+        spdlog::debug("[CompiledPipelineCache::insert]: Evicting least recently used pipeline '{}'.", m_entries.back().first);
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+void CompiledPipelineCache::setCapacity(std::size_t capacity)
+{
+    m_capacity = capacity != 0 ? capacity : k_default_capacity;
+
+    while (m_entries.size() > m_capacity) {
+        spdlog::debug("[CompiledPipelineCache::setCapacity]: Evicting least recently used pipeline '{}'.", m_entries.back().first);
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+void CompiledPipelineCache::clear() noexcept
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -0,0 +1,107 @@
+/**
+ * @file display_encode_stage.cpp
+ * @brief Implementation of DisplayEncodeStage.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/display_encode_stage.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "config/app_config.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+/**
+ * @brief sRGB opto-electronic transfer function (IEC 61966-2-1), input clamped to [0, 1].
+ */
+Halide::Expr srgbEncode(const Halide::Expr& linear)
+{
+    Halide::Expr v = Halide::clamp(linear, 0.0f, 1.0f);
+    return Halide::select(v <= 0.0031308f,
+                          v * 12.92f,
+                          1.055f * Halide::pow(v, 1.0f / 2.4f) - 0.055f);
+}
+
+} // namespace
+
+DisplayEncodeStage::DisplayEncodeStage()
+    : m_scale_x("display_scale_x")
+    , m_scale_y("display_scale_y")
+    , m_taps_x("display_taps_x")
+    , m_taps_y("display_taps_y")
+    , m_origin_x("display_origin_x")
+    , m_origin_y("display_origin_y")
+    , m_extent_x("display_extent_x")
+    , m_extent_y("display_extent_y")
+{
+}
+
+Halide::Func DisplayEncodeStage::append(const Halide::Func& linear, const Halide::Target& target)
+{
+    Halide::Var x("dx"), y("dy"), c("dc");
+    Halide::Var xi("dxi"), yi("dyi"), yo("dyo");
+
+    // Box filter over the footprint of each display pixel, clamped to the edges of the source rectangle
+    auto footprint_start = [](const Halide::Var& v, const Halide::Param<float>& scale, const Halide::Param<int>& taps) {
+        Halide::Expr center = (Halide::cast<float>(v) + 0.5f) * scale;
+        return Halide::cast<int>(Halide::floor(center - Halide::cast<float>(taps) * 0.5f + 0.5f));
+    };
+
+    Halide::RDom r(0, m_taps_x, 0, m_taps_y, "display_footprint");
+
+    Halide::Func sum("display_sum");
+    sum(x, y, c) = 0.0f;
+    sum(x, y, c) += linear(m_origin_x + Halide::clamp(footprint_start(x, m_scale_x, m_taps_x) + r.x, 0, m_extent_x - 1),
+                           m_origin_y + Halide::clamp(footprint_start(y, m_scale_y, m_taps_y) + r.y, 0, m_extent_y - 1),
+                           c);
+
+    Halide::Expr average = sum(x, y, c) / Halide::cast<float>(m_taps_x * m_taps_y);
+
+    // Color channels are gamma-encoded, alpha stays linear
+    Halide::Expr encoded = Halide::select(c < 3, srgbEncode(average), Halide::clamp(average, 0.0f, 1.0f));
+
+    Halide::Func display("display_rgba8");
+    display(x, y, c) = Halide::cast<uint8_t>(encoded * 255.0f + 0.5f);
+
+    display.bound(c, 0, ImageProcessing::k_interleaved_channels).reorder(c, x, y).unroll(c);
+    ImageProcessing::constrainInterleaved(display.output_buffer());
+
+    if (target.has_gpu_feature()) {
+        ImageProcessing::applyGpuTiles(display, x, y, xi, yi, Config::AppConfig::getGpuTileSchedule());
+        sum.compute_at(display, xi).reorder(c, x, y).unroll(c);
+        sum.update().reorder(c, r.x, r.y).unroll(c);
+    } else {
+        const int vector_size = target.natural_vector_size<float>();
+        display.split(y, yo, yi, 16).parallel(yo).vectorize(x, vector_size);
+        sum.compute_at(display, x).reorder(c, x, y).unroll(c).vectorize(x, vector_size);
+        sum.update().reorder(c, x, r.x, r.y).unroll(c).vectorize(x, vector_size);
+    }
+
+    return display;
+}
+
+void DisplayEncodeStage::bind(const Common::RegionOfInterest& source,
+                              Common::ImageDim display_width, Common::ImageDim display_height)
+{
+    const Common::ImageDim source_width = std::max<Common::ImageDim>(source.m_width, 1);
+    const Common::ImageDim source_height = std::max<Common::ImageDim>(source.m_height, 1);
+    const float scale_x = static_cast<float>(source_width) / static_cast<float>(std::max<Common::ImageDim>(display_width, 1));
+    const float scale_y = static_cast<float>(source_height) / static_cast<float>(std::max<Common::ImageDim>(display_height, 1));
+
+    m_scale_x.set(scale_x);
+    m_scale_y.set(scale_y);
+    m_taps_x.set(std::max(1, static_cast<int>(std::ceil(scale_x))));
+    m_taps_y.set(std::max(1, static_cast<int>(std::ceil(scale_y))));
+    m_origin_x.set(static_cast<int>(source.m_x));
+    m_origin_y.set(static_cast<int>(source.m_y));
+    m_extent_x.set(static_cast<int>(source_width));
+    m_extent_y.set(static_cast<int>(source_height));
+}
+
+} // namespace CaptureMoment::Core::Pipeline
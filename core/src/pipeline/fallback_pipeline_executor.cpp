@@ -14,8 +14,12 @@
 
 #include "pipeline/fallback_pipeline_executor.h"
 #include "operations/interfaces/i_operation_default_logic.h"
+#include "operations/fallback_kernels.h"
+#include "operations/masks/mask_sampler.h"
 #include <spdlog/spdlog.h>
+#include <expected>
 #include <memory>
+#include <vector>
 
 namespace CaptureMoment::Core::Pipeline {
 
@@ -37,19 +41,27 @@ bool FallbackPipelineExecutor::execute(ImageProcessing::IWorkingImageHardware& w
         return false;
     }
 
-    // 2. Export image data to CPU copy
-    // Assuming exportToCPUCopy returns std::expected<std::unique_ptr<Common::ImageRegion>, std::error_code>
-    // Adapt if you haven't implemented std::expected yet (check for nullptr).
-    auto cpu_region_expected = working_image.exportToCPUCopy();
-    if (!cpu_region_expected.has_value()) {
-        spdlog::error("[FallbackPipelineExecutor] Failed to export image to CPU copy: {}",
-                      ErrorHandling::to_string(cpu_region_expected.error()));
-        return false;
+    // 2. Take a read-only view and materialize the single mutable CPU copy the operations run on.
+    // The view is released right after, so updateFromCPU() can reuse the working image's block.
+    std::unique_ptr<Common::ImageRegion> cpu_region;
+    {
+        auto view_expected = working_image.exportToCPUView();
+        if (!view_expected.has_value()) {
+            spdlog::error("[FallbackPipelineExecutor] Failed to export image view: {}",
+                          ErrorHandling::to_string(view_expected.error()));
+            return false;
+        }
+
+        try {
+            cpu_region = std::make_unique<Common::ImageRegion>(view_expected.value().toImageRegion());
+        } catch (const std::bad_alloc& e) {
+            spdlog::error("[FallbackPipelineExecutor] Failed to allocate CPU copy: {}", e.what());
+            return false;
+        }
     }
-    auto cpu_region = std::move(cpu_region_expected.value()); // Extract the unique_ptr
 
-    if (!cpu_region || !cpu_region->isValid()) {
-        spdlog::error("[FallbackPipelineExecutor] Exported CPU copy is invalid or null.");
+    if (!cpu_region->isValid()) {
+        spdlog::error("[FallbackPipelineExecutor] Exported CPU copy is invalid.");
         return false;
     }
 
@@ -65,26 +77,40 @@ bool FallbackPipelineExecutor::execute(ImageProcessing::IWorkingImageHardware& w
 
         spdlog::debug("[FallbackPipelineExecutor] Applying operation: {}", desc.name);
 
-        // 3a. Create the operation instance using the factory
-        auto op_instance = m_factory.create(desc);
-        if (!op_instance) {
-            spdlog::warn("[FallbackPipelineExecutor] Failed to create operation instance for '{}'. Skipping.", desc.name);
-            continue;
+        // 3a. A local adjustment keeps its input, to blend the result with it by its mask
+        const bool masked = Operations::MaskSampler::isMasked(desc);
+        std::vector<float> unmasked;
+        if (masked) {
+            unmasked.assign(cpu_region->getBuffer().begin(), cpu_region->getBuffer().end());
         }
 
-        // 3b. Check if the operation supports generic execution via IOperationDefaultLogic
-        // Cast the base IOperation pointer to the specific IOperationDefaultLogic interface
-        const auto* op_with_default_logic = dynamic_cast<const Operations::IOperationDefaultLogic*>(op_instance->get());
-        if (!op_with_default_logic) {
-            spdlog::warn("[FallbackPipelineExecutor] Operation '{}' does not support default execution (IOperationDefaultLogic). Skipping.", desc.name);
-            continue;
+        // 3b. Per-pixel operations run their host kernel: no instance, no allocation, no cast
+        std::expected<void, ErrorHandling::CoreError> applied;
+        if (const auto kernel = Operations::FallbackKernels::find(desc.type)) {
+            applied = kernel(*cpu_region, desc);
+        } else {
+            // 3c. The others are created through the factory and run their IOperationDefaultLogic
+            auto op_instance = m_factory.create(desc);
+            if (!op_instance) {
+                spdlog::warn("[FallbackPipelineExecutor] Failed to create operation instance for '{}'. Skipping.", desc.name);
+                continue;
+            }
+
+            const auto* op_with_default_logic = dynamic_cast<const Operations::IOperationDefaultLogic*>(op_instance->get());
+            if (!op_with_default_logic) {
+                spdlog::warn("[FallbackPipelineExecutor] Operation '{}' does not support default execution (IOperationDefaultLogic). Skipping.", desc.name);
+                continue;
+            }
+            applied = op_with_default_logic->executeOnImageRegion(*cpu_region, desc);
         }
 
-        // 3c. Execute the operation on the CPU region using the default logic
-        if (!op_with_default_logic->executeOnImageRegion(*cpu_region, desc)) {
+        if (!applied) {
             spdlog::error("[FallbackPipelineExecutor] Operation '{}' failed on CPU copy.", desc.name);
             return false; // Stop processing on error
         }
+        if (masked) {
+            Operations::MaskSampler::blend(unmasked, *cpu_region, desc);
+        }
 
         spdlog::debug("[FallbackPipelineExecutor] Operation '{}' applied successfully to CPU copy.", desc.name);
     }
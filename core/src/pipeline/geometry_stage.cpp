@@ -0,0 +1,53 @@
+/**
+ * @file geometry_stage.cpp
+ * @brief Implementation of GeometryStage.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/geometry_stage.h"
+
+namespace CaptureMoment::Core::Pipeline {
+
+GeometryStage::GeometryStage()
+    : m_coefficients{
+          Halide::Param<float>("geometry_xx", 1.0f), Halide::Param<float>("geometry_xy", 0.0f),
+          Halide::Param<float>("geometry_x0", 0.0f), Halide::Param<float>("geometry_yx", 0.0f),
+          Halide::Param<float>("geometry_yy", 1.0f), Halide::Param<float>("geometry_y0", 0.0f)
+      }
+{
+}
+
+Halide::Func GeometryStage::append(const Halide::Func& input,
+                                   const Halide::Var& x,
+                                   const Halide::Var& y,
+                                   const Halide::Var& c) const
+{
+    const Halide::Expr fx = Halide::cast<float>(x);
+    const Halide::Expr fy = Halide::cast<float>(y);
+    const Halide::Expr sx = m_coefficients[0] * fx + m_coefficients[1] * fy + m_coefficients[2];
+    const Halide::Expr sy = m_coefficients[3] * fx + m_coefficients[4] * fy + m_coefficients[5];
+
+    const Halide::Expr x0 = Halide::floor(sx);
+    const Halide::Expr y0 = Halide::floor(sy);
+    const Halide::Expr wx = sx - x0;
+    const Halide::Expr wy = sy - y0;
+    const Halide::Expr ix = Halide::cast<int>(x0);
+    const Halide::Expr iy = Halide::cast<int>(y0);
+
+    Halide::Func sampled("geometry_sampled");
+    sampled(x, y, c) = Halide::lerp(Halide::lerp(input(ix, iy, c), input(ix + 1, iy, c), wx),
+                                    Halide::lerp(input(ix, iy + 1, c), input(ix + 1, iy + 1, c), wx),
+                                    wy);
+    return sampled;
+}
+
+void GeometryStage::bind(const Operations::CropGeometry& geometry, Common::ImageDim width, Common::ImageDim height)
+{
+    const auto coefficients = geometry.sampling(width, height);
+    for (std::size_t i = 0; i < coefficients.size(); ++i) {
+        m_coefficients[i].set(coefficients[i]);
+    }
+}
+
+} // namespace CaptureMoment::Core::Pipeline
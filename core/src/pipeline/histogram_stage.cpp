@@ -0,0 +1,115 @@
+/**
+ * @file histogram_stage.cpp
+ * @brief Implementation of HistogramStage.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/histogram_stage.h"
+
+#include <algorithm>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+constexpr int k_bins = static_cast<int>(Common::PreviewHistogram::k_bins);
+constexpr int k_channels = static_cast<int>(Common::PreviewHistogram::k_channels);
+
+/**
+ * @brief Rec.709 luma weights in 1/256ths (54 + 183 + 19 = 256), shared by both paths.
+ */
+constexpr int k_luma_red = 54;
+constexpr int k_luma_green = 183;
+constexpr int k_luma_blue = 19;
+
+} // namespace
+
+HistogramStage::HistogramStage()
+    : m_width("histogram_width")
+    , m_height("histogram_height")
+{
+}
+
+Halide::Func HistogramStage::append(const Halide::Func& display, const Halide::Target& target)
+{
+    Halide::Var code("hcode"), channel("hchannel"), partial_index("hpartial");
+
+    // One sample per channel of each display pixel, luma being the fourth
+    Halide::RDom r(0, m_width, 0, m_height, 0, k_channels, "histogram_samples");
+
+    Halide::Expr red = Halide::cast<int>(display(r.x, r.y, 0));
+    Halide::Expr green = Halide::cast<int>(display(r.x, r.y, 1));
+    Halide::Expr blue = Halide::cast<int>(display(r.x, r.y, 2));
+    Halide::Expr luma = (k_luma_red * red + k_luma_green * green + k_luma_blue * blue + 128) / 256;
+    Halide::Expr sample = Halide::select(r.z == 0, red, r.z == 1, green, r.z == 2, blue, luma);
+
+    Halide::Func histogram("preview_histogram");
+    histogram(code, channel) = Halide::cast<uint32_t>(0);
+    histogram(Halide::clamp(sample, 0, k_bins - 1), r.z) += Halide::cast<uint32_t>(1);
+
+    histogram.bound(code, 0, k_bins).bound(channel, 0, k_channels);
+
+    // Chunks of rows counted in parallel into partial histograms, summed afterwards
+    const int vector_size = target.natural_vector_size<uint32_t>();
+    Halide::RVar rows_outer("hrows_outer"), rows_inner("hrows_inner");
+    Halide::Func partial = histogram.update()
+                               .reorder(r.z, r.x, r.y)
+                               .split(r.y, rows_outer, rows_inner, k_rows_per_partial)
+                               .rfactor(rows_outer, partial_index);
+
+    partial.compute_root().vectorize(code, vector_size);
+    partial.update().unroll(r.z).parallel(partial_index);
+    histogram.vectorize(code, vector_size);
+    histogram.update().vectorize(code, vector_size);
+
+    return histogram;
+}
+
+void HistogramStage::bind(Common::ImageDim display_width, Common::ImageDim display_height)
+{
+    m_width.set(static_cast<int>(display_width));
+    m_height.set(static_cast<int>(display_height));
+}
+
+Halide::Buffer<uint32_t> HistogramStage::makeBuffer()
+{
+    return Halide::Buffer<uint32_t>(k_bins, k_channels);
+}
+
+std::shared_ptr<const Common::PreviewHistogram> HistogramStage::read(const Halide::Buffer<uint32_t>& buffer)
+{
+    auto histogram { std::make_shared<Common::PreviewHistogram>() };
+    for (int channel = 0; channel < k_channels; ++channel) {
+        for (int code = 0; code < k_bins; ++code) {
+            histogram->m_counts[static_cast<std::size_t>(channel * k_bins + code)] = buffer(code, channel);
+        }
+    }
+    histogram->updateStatistics();
+    return histogram;
+}
+
+std::shared_ptr<const Common::PreviewHistogram> HistogramStage::computeOnHost(const Common::DisplayImage& image)
+{
+    if (!image.isValid()) {
+        return nullptr;
+    }
+
+    auto histogram { std::make_shared<Common::PreviewHistogram>() };
+    auto& counts { histogram->m_counts };
+    const std::size_t pixel_count { static_cast<std::size_t>(image.m_width) * image.m_height };
+
+    for (std::size_t i = 0; i < pixel_count; ++i) {
+        const std::uint8_t* pixel { image.m_data.data() + i * Common::DisplayImage::k_channels };
+        const int luma { (k_luma_red * pixel[0] + k_luma_green * pixel[1] + k_luma_blue * pixel[2] + 128) / 256 };
+
+        ++counts[pixel[0]];
+        ++counts[k_bins + pixel[1]];
+        ++counts[2 * k_bins + pixel[2]];
+        ++counts[3 * k_bins + std::min(luma, k_bins - 1)];
+    }
+    histogram->updateStatistics();
+    return histogram;
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -6,16 +6,85 @@
  */
 
 #include "pipeline/operation_pipeline_executor.h"
+#include "pipeline/cancellable_jit_context.h"
+#include "pipeline/autoscheduler.h"
+#include "pipeline/pipeline_object_cache.h"
 #include "operations/operation_factory.h"
+#include "operations/interfaces/i_operation.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/geometry_operations/lens_profile.h"
+#include "operations/detail_operations/guided_upsampling.h"
+#include "operations/masks/mask_sampler.h"
 #include "image_processing/halide/working_image_halide.h"
+#include "image_processing/halide/gpu_tile_schedule.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "image_processing/halide/halide_device_transfer.h"
 #include "image_processing/cpu/working_image_cpu_halide.h"
 #include "image_processing/gpu/working_image_gpu_halide.h"
 #include "config/app_config.h"
+#include "common/trace/tracer.h"
+#include "common/logging/log.h"
+#include "common/metrics/core_metrics.h"
+#include "managers/result_cache.h"
+#include "operations/plugins/operation_plugin_registry.h"
 
 #include <spdlog/spdlog.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
 
 namespace CaptureMoment::Core::Pipeline {
 
+namespace {
+
+/**
+ * @brief Observes the realization that started at @p realize_begin_ns (tracer clock).
+ */
+void recordRealizeDuration(std::int64_t realize_begin_ns)
+{
+    Common::Metrics::coreMetrics().m_pipeline_realize_ms.observe(
+        static_cast<double>(Common::Trace::Tracer::instance().now() - realize_begin_ns) / 1.0e6);
+}
+
+/**
+ * @brief Fits the aspect ratio of the @p shown rectangle into the requested display size.
+ */
+std::pair<Common::ImageDim, Common::ImageDim> fitDisplaySize(std::pair<Common::ImageDim, Common::ImageDim> requested,
+                                                             const Common::RegionOfInterest& shown)
+{
+    const double scale = std::min(static_cast<double>(requested.first) / static_cast<double>(shown.m_width),
+                                  static_cast<double>(requested.second) / static_cast<double>(shown.m_height));
+    return {
+        std::max<Common::ImageDim>(static_cast<Common::ImageDim>(std::lround(static_cast<double>(shown.m_width) * scale)), 1),
+        std::max<Common::ImageDim>(static_cast<Common::ImageDim>(std::lround(static_cast<double>(shown.m_height) * scale)), 1)
+    };
+}
+
+/**
+ * @brief Halide name of the stages of an operation type (plugin names hold dots, which Halide reserves).
+ */
+std::string stageName(Operations::OperationType type)
+{
+    if (const auto name = magic_enum::enum_name(type); !name.empty()) {
+        return std::string(name);
+    }
+    return "plugin" + std::to_string(std::to_underlying(type));
+}
+
+} // anonymous namespace
+
 OperationPipelineExecutor::OperationPipelineExecutor()
 
     : IHalidePipelineExecutor(),
@@ -23,33 +92,219 @@ OperationPipelineExecutor::OperationPipelineExecutor()
       m_backend(Config::AppConfig::instance().getProcessingBackend()),
       m_chain_built(false)
 {
-    spdlog::debug("OperationPipelineExecutor: Constructed. Input set to Float(32), 3 dimensions. Backend: {}",
-                  static_cast<int>(m_backend));
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor: Constructed. Input set to Float(32), 3 dimensions. Backend: {}",
+                           static_cast<int>(m_backend));
 }
 
 void OperationPipelineExecutor::init(
     std::vector<Operations::OperationDescriptor>&& operations,
     const Operations::OperationFactory& factory)
 {
-    spdlog::debug("OperationPipelineExecutor::init (Move): Initializing with {} operations.", operations.size());
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::init (Move): Initializing with {} operations.", operations.size());
 
+    // Of the list as given: the executor reorders its copy (lens profile and crop first)
+    m_initialized_structure = structureFingerprint(operations);
     m_operations = std::move(operations);
     m_factory = &factory;
+    Operations::LensProfile::moveToFront(m_operations);
+    Operations::CropGeometry::moveToFront(m_operations);
+    m_crop = Operations::CropGeometry::of(m_operations);
+
+    rebuild();
+}
+
+void OperationPipelineExecutor::warmUp(
+    std::vector<Operations::OperationDescriptor>&& operations,
+    const Operations::OperationFactory& factory)
+{
+    if (structureFingerprint(operations) == m_initialized_structure) {
+        return;
+    }
+
+    CM_TRACE_SCOPE("pipeline", "warm_up");
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::warmUp: Compiling a chain of {} operations ahead of use.", operations.size());
+
+    // Never initialized: no pass can be waiting on the current chain, the warmed one stays
+    if (!m_factory) {
+        const auto roi = std::exchange(m_roi, std::nullopt);
+        init(std::move(operations), factory);
+        m_roi = roi;
+        return;
+    }
+
+    auto current = std::move(m_operations);
+    const auto* current_factory = m_factory;
+    const auto current_structure = m_initialized_structure;
+
+    const auto roi = std::exchange(m_roi, std::nullopt);
+    init(std::move(operations), factory);
+    m_roi = roi;
+
+    // Back to the current chain, compiled before (reordered already: moving to the front again is a no-op)
+    init(std::move(current), *current_factory);
+    m_initialized_structure = current_structure;
+}
+
+std::uint64_t OperationPipelineExecutor::structureFingerprint(std::span<const Operations::OperationDescriptor> operations) noexcept
+{
+    // FNV-1a over the operation count, then each (id, type, enabled)
+    std::uint64_t hash { 14695981039346656037ull };
+    const auto mix = [&hash](std::uint64_t value) {
+        for (int byte = 0; byte < 8; ++byte) {
+            hash ^= (value >> (byte * 8)) & 0xFFu;
+            hash *= 1099511628211ull;
+        }
+    };
+
+    mix(operations.size());
+    for (const auto& operation : operations) {
+        mix(operation.id);
+        mix(static_cast<std::uint64_t>(operation.type));
+        mix(operation.enabled ? 1u : 0u);
+    }
+    return hash;
+}
+
+void OperationPipelineExecutor::rebuild()
+{
+    // A new structure starts from the computing variant (see executeOnBuffers)
+    m_reuse_cached_stages = false;
+    m_pipeline_has_cached_stages = false;
+    m_pipeline_has_memoized_outputs = false;
+    m_resume_from.reset();
+
+    // AOT fast path: no compilation needed for the built-in tone chain
+    m_aot_arguments = matchAotToneKernel();
+    if (m_aot_arguments) {
+        CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::rebuild: Chain runs on the AOT tone kernel, skipping JIT compilation.");
+        m_chain_built = false;
+        m_tone_lut_active = false;
+        m_pipeline_has_geometry = false;
+        m_pipeline = Halide::Pipeline();
+        m_pipeline_object = PipelineObject();
+        m_pipeline_params.clear();
+        return;
+    }
 
-    if (!m_operations.empty()) {
+    if (!m_operations.empty() || wantsDisplayOutput()) {
         buildOperationChain();
     } else {
         m_chain_built = false;
+        m_tone_lut_active = false;
+        m_pipeline_has_geometry = false;
         m_pipeline = Halide::Pipeline();
+        m_pipeline_object = PipelineObject();
         m_pipeline_params.clear();
     }
 }
 
+void OperationPipelineExecutor::switchBackend(Common::MemoryType backend)
+{
+    if (backend == m_backend) {
+        return;
+    }
+
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::switchBackend: {} -> {}",
+                           static_cast<int>(m_backend), static_cast<int>(backend));
+
+    // The schedule and the target depend on the backend. Chains already compiled
+    // for this backend are served from the pipeline cache (its key includes the target).
+    m_backend = backend;
+    m_target.reset();
+    rebuild();
+}
+
+void OperationPipelineExecutor::switchStorageFormat(Common::PixelFormat format)
+{
+    if (format == m_storage_format) {
+        return;
+    }
+
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::switchStorageFormat: {} -> {}",
+                           static_cast<int>(m_storage_format), static_cast<int>(format));
+
+    // The input type and the final store depend on the format (part of the cache key)
+    m_storage_format = format;
+    rebuild();
+}
+
+void OperationPipelineExecutor::switchStorageLayout(Common::PixelLayout layout)
+{
+    if (layout == m_storage_layout) {
+        return;
+    }
+
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::switchStorageLayout: {} -> {}",
+                           static_cast<int>(m_storage_layout), static_cast<int>(layout));
+
+    // The input and output constraints depend on the layout (part of the cache key)
+    m_storage_layout = layout;
+    rebuild();
+}
+
+void OperationPipelineExecutor::setProfiling(bool enabled)
+{
+    if (enabled == m_profiling) {
+        return;
+    }
+
+    CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::setProfiling: Profiling {}.", enabled ? "enabled" : "disabled");
+    m_profiling = enabled;
+    m_last_stats.reset();
+    m_target.reset();
+    rebuild();
+}
+
+void OperationPipelineExecutor::setInteractiveOperation(std::optional<std::uint64_t> operation_id) noexcept
+{
+    if (operation_id == m_interactive_operation) {
+        return;
+    }
+
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::setInteractiveOperation: Gesture {}.", operation_id ? "started" : "ended");
+    m_interactive_operation = operation_id;
+    // Another graph for the same descriptors: the next init rebuilds
+    m_initialized_structure.reset();
+}
+
 void OperationPipelineExecutor::updateRuntimeParams(std::vector<Operations::OperationDescriptor>&& operations)
 {
     // Move the input vector into the member variable. This updates our internal state
     // with the latest values without any memory allocation or copying of the data structure.
     m_operations = std::move(operations);
+    Operations::LensProfile::moveToFront(m_operations);
+    Operations::CropGeometry::moveToFront(m_operations);
+    m_crop = Operations::CropGeometry::of(m_operations);
+
+    // Straightening adds (or drops) the resampling stage: another graph, maybe already cached.
+    // The rectangle and the angle themselves are bound at execution.
+    if (wantsGeometry() != m_pipeline_has_geometry) {
+        CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::updateRuntimeParams: Straightening switched. Rebuilding.");
+        rebuild();
+        return;
+    }
+
+    if (m_aot_arguments) {
+        m_aot_arguments = matchAotToneKernel();
+        if (m_aot_arguments) {
+            return;
+        }
+        // Should not happen with an unchanged structure; fall back to a JIT build
+        spdlog::warn("OperationPipelineExecutor::updateRuntimeParams: Chain no longer matches the AOT kernel. Building JIT pipeline.");
+        buildOperationChain();
+        return;
+    }
+
+    if (m_tone_lut_active) {
+        if (ToneLutStage::matchChain(m_operations)) {
+            // Re-bake the table: the compiled pipeline is unchanged
+            m_tone_lut.bind(m_operations);
+            return;
+        }
+        spdlog::warn("OperationPipelineExecutor::updateRuntimeParams: Chain no longer matches the tone LUT. Rebuilding.");
+        buildOperationChain();
+        return;
+    }
 
     // FAST PATH: Iterate over the updated operations and sync the Halide Parameters.
     for (const auto& desc : m_operations) {
@@ -57,9 +312,31 @@ void OperationPipelineExecutor::updateRuntimeParams(std::vector<Operations::Oper
 
         auto it = m_pipeline_params.find(desc.id);
         if (it != m_pipeline_params.end()) {
-            // Parameter exists in cache, update its value
-            if (auto val_res = desc.getParam<float>("value")) {
-                it->second.set(val_res.value());
+            // A structural option changed (e.g. a mask mode): another graph, maybe already cached
+            if (it->second.m_fusion_logic->fusionVariant(desc) != it->second.m_params.variant()) {
+                CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::updateRuntimeParams: Variant of '{}' changed. Rebuilding.", desc.name);
+                buildOperationChain();
+                return;
+            }
+            // Masking adds (or drops) the blend stage: another graph as well
+            if (Operations::MaskSampler::isMasked(desc) != it->second.m_masked) {
+                CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::updateRuntimeParams: Mask of '{}' switched. Rebuilding.", desc.name);
+                buildOperationChain();
+                return;
+            }
+            // Parameter block exists in cache, let the operation refresh it
+            it->second.m_fusion_logic->updateFusionParameters(desc, it->second.m_params);
+        } else if (std::ranges::find(m_deferred_operations, desc.id) != m_deferred_operations.end()) {
+            // Left out until the gesture ends
+            continue;
+        } else if (const auto identity = m_identity_operations.find(desc.id); identity != m_identity_operations.end()) {
+            // Left out of the graph while neutral: once it changes pixels, it joins the chain.
+            // (the reverse is not checked: a bound operation set back to neutral keeps its graph)
+            const auto* fusion_logic = dynamic_cast<const Operations::IOperationFusionLogic*>(identity->second.get());
+            if (!fusion_logic->isIdentity(desc)) {
+                CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::updateRuntimeParams: '{}' is no longer an identity. Rebuilding.", desc.name);
+                buildOperationChain();
+                return;
             }
         } else {
             // If we reach here, the structure changed (new operation added) but init() wasn't called.
@@ -69,37 +346,215 @@ void OperationPipelineExecutor::updateRuntimeParams(std::vector<Operations::Oper
     }
 }
 
+void OperationPipelineExecutor::setRegionOfInterest(std::optional<Common::RegionOfInterest> roi) noexcept
+{
+    m_roi = roi;
+}
+
+void OperationPipelineExecutor::setCancellationToken(Common::CancellationToken token) noexcept
+{
+    m_cancellation = std::move(token);
+}
+
+void OperationPipelineExecutor::setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height)
+{
+    if (width == 0 || height == 0) {
+        spdlog::warn("OperationPipelineExecutor::setDisplayOutputSize: Invalid display size {}x{}. Ignored.", width, height);
+        return;
+    }
+    // The pipeline is (re)built with the display output at the next execution that needs it
+    m_display_size = std::make_pair(width, height);
+}
+
+void OperationPipelineExecutor::clearDisplayOutput()
+{
+    m_display_size.reset();
+    m_display_buffer = Halide::Buffer<uint8_t>();
+    m_display_image.reset();
+}
+
+std::optional<Common::DisplayImage> OperationPipelineExecutor::takeDisplayImage()
+{
+    return std::exchange(m_display_image, std::nullopt);
+}
+
+bool OperationPipelineExecutor::wantsDisplayOutput() const noexcept
+{
+    // A cropped realization only computes part of the image: the display is downsampled instead
+    return m_display_size.has_value() && !m_roi.has_value();
+}
+
+bool OperationPipelineExecutor::wantsGeometry() const noexcept
+{
+    return m_crop.has_value() && m_crop->isRotated();
+}
+
+bool OperationPipelineExecutor::wantsHistogramOutput() const noexcept
+{
+    // GPU histograms would need atomic updates: counted on the host instead (see captureHistogram)
+    return m_histogram_enabled && wantsDisplayOutput() && m_backend == Common::MemoryType::CPU_RAM;
+}
+
+bool OperationPipelineExecutor::displaysOnDevice() const noexcept
+{
+    return m_display_on_device && m_backend == Common::MemoryType::GPU_MEMORY
+           && pipelineTarget().has_feature(Halide::Target::Metal);
+}
+
+void OperationPipelineExecutor::captureDisplayImage()
+{
+    if (m_display_buffer.data() == nullptr) {
+        // Device-only buffer: no host copy to fall back to, the caller downsamples instead
+        if (!captureDeviceDisplayImage()) {
+            m_display_buffer = Halide::Buffer<uint8_t>();
+        }
+        return;
+    }
+
+    // GPU: the display output is tiny, this is the only host transfer of the execution
+    m_display_buffer.copy_to_host();
+
+    Common::DisplayImage image;
+    image.m_width = static_cast<Common::ImageDim>(m_display_buffer.width());
+    image.m_height = static_cast<Common::ImageDim>(m_display_buffer.height());
+    image.m_data.assign(m_display_buffer.data(), m_display_buffer.data() + m_display_buffer.number_of_elements());
+    m_display_image = std::move(image);
+}
+
+void OperationPipelineExecutor::captureHistogram()
+{
+    if (!m_display_image) {
+        return;
+    }
+    if (m_pipeline_has_histogram) {
+        m_display_image->m_histogram = HistogramStage::read(m_histogram_buffer);
+        return;
+    }
+    // GPU: the display image was downloaded anyway, and is small
+    m_display_image->m_histogram = HistogramStage::computeOnHost(*m_display_image);
+}
+
+Halide::Buffer<uint8_t> OperationPipelineExecutor::allocateDeviceDisplayBuffer(int width, int height,
+                                                                              const Halide::Target& target)
+{
+    // Rows padded so that a texture can alias the buffer (Metal linear textures); the
+    // allocation covers whole padded rows, the pipeline writes the cropped width
+    constexpr int channels = static_cast<int>(Common::DisplayImage::k_channels);
+    constexpr int pixels_per_step = k_device_row_alignment / channels;
+    const int padded_width = (width + pixels_per_step - 1) / pixels_per_step * pixels_per_step;
+
+    const halide_dimension_t shape[3] = {
+        {0, padded_width, channels, 0},
+        {0, height, padded_width * channels, 0},
+        {0, channels, 1, 0},
+    };
+
+    // Device memory only: the pixels never come back to the host
+    Halide::Buffer<uint8_t> padded(nullptr, 3, shape);
+    if (int result = padded.device_malloc(Halide::DeviceAPI::Metal, target); result != 0) {
+        spdlog::warn("OperationPipelineExecutor::allocateDeviceDisplayBuffer: device_malloc failed ({}), using a host buffer.", result);
+        return {};
+    }
+    return padded.cropped(0, 0, width);
+}
+
+bool OperationPipelineExecutor::captureDeviceDisplayImage()
+{
+    const auto handle = ImageProcessing::metalBufferOf(m_display_buffer);
+    if (!handle) {
+        return false;
+    }
+
+    // The consumer samples the buffer on another queue: the kernel must have completed
+    if (m_display_buffer.device_sync() != 0) {
+        spdlog::warn("OperationPipelineExecutor::captureDeviceDisplayImage: device_sync failed.");
+        return false;
+    }
+
+    Common::DisplayImage image;
+    image.m_width = static_cast<Common::ImageDim>(m_display_buffer.width());
+    image.m_height = static_cast<Common::ImageDim>(m_display_buffer.height());
+    image.m_device.m_api = Common::DisplayDeviceBuffer::Api::Metal;
+    image.m_device.m_native_buffer = handle->m_buffer;
+    image.m_device.m_offset = handle->m_offset;
+    image.m_device.m_bytes_per_row = static_cast<std::size_t>(m_display_buffer.dim(1).stride());
+    image.m_device.m_keep_alive = std::make_shared<Halide::Buffer<uint8_t>>(m_display_buffer);
+    m_display_image = std::move(image);
+
+    // The holder owns this buffer now: never realize into it again
+    m_display_buffer = Halide::Buffer<uint8_t>();
+    return true;
+}
+
+std::optional<ToneKernelArguments> OperationPipelineExecutor::matchAotToneKernel() const
+{
+    // The AOT kernel is compiled for float buffers only, and without the profiler
+    if (m_profiling || m_backend != Common::MemoryType::CPU_RAM || m_storage_format != Common::PixelFormat::RGBA_F32
+        || m_storage_layout != Common::PixelLayout::Interleaved || !AotToneKernel::isAvailable()) {
+        return std::nullopt;
+    }
+    return AotToneKernel::matchChain(m_operations);
+}
+
 void OperationPipelineExecutor::buildOperationChain()
 {
-    if (m_operations.empty()) {
+    const bool with_display = wantsDisplayOutput();
+    const bool with_histogram = wantsHistogramOutput();
+    const bool with_geometry = wantsGeometry();
+    m_pipeline_has_display = with_display;
+    m_pipeline_has_histogram = with_histogram;
+    m_pipeline_has_geometry = with_geometry;
+    m_pipeline_has_cached_stages = false;
+    m_pipeline_has_memoized_outputs = false;
+
+    if (m_operations.empty() && !with_display) {
         m_chain_built = false;
         return;
     }
 
-    spdlog::trace("OperationPipelineExecutor::buildOperationChain: Building operation graph with dynamic params...");
+    if (!m_factory) {
+        spdlog::error("OperationPipelineExecutor::buildOperationChain: Factory is null during graph build.");
+        m_chain_built = false;
+        return;
+    }
 
-    // IMPORTANT: Use local variables for Func and Vars to avoid crashes from reusing stale Halide objects.
-    // The 'm_pipeline' member stores the compiled result, but the construction uses fresh objects.
-    Halide::Var x("x"), y("y"), c("c");
-    Halide::Func output_func("fused_pipeline");
+    CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::buildOperationChain: Building operation graph with dynamic params...");
 
     // Reset the parameter cache
     m_pipeline_params.clear();
+    m_identity_operations.clear();
+    m_deferred_operations.clear();
+
+    // Tone-only chains collapse into one table lookup: no per-operation steps to resolve,
+    // and a single compiled pipeline serves every such chain.
+    // (profiled chains keep one stage per operation)
+    m_tone_lut_active = !m_profiling && ToneLutStage::matchChain(m_operations);
+    if (m_tone_lut_active) {
+        m_tone_lut.bind(m_operations);
+    }
 
-    // Define the output function based on the inherited m_input
-    output_func(x, y, c) = m_input(x, y, c);
+    // 1. Resolve the operations that will actually be fused, in order.
+    // The compiled code only depends on this list (and the target), so it is the cache key.
+    struct FusedStep {
+        const Operations::OperationDescriptor* m_descriptor;
+        std::unique_ptr<Operations::IOperation> m_operation;
+        const Operations::IOperationFusionLogic* m_fusion_logic;
+        std::uint32_t m_variant;
+        bool m_masked;
+        bool m_memoizes;
+        bool m_guided;
+    };
+    std::vector<FusedStep> steps;
+    std::vector<Operations::OperationType> chain;
+    bool after_interactive { false };
+    const bool guided_previews { !m_profiling && Config::AppConfig::instance().isGuidedPreviewUpsamplingEnabled() };
 
-    // Apply operations sequentially
     for (const auto& desc : m_operations) {
-        if (!desc.enabled) {
+        // The crop is applied by the executor: realization bounds and geometry stage
+        if (!desc.enabled || m_tone_lut_active || desc.type == Operations::OperationType::Crop) {
             continue;
         }
 
-        if (!m_factory) {
-            spdlog::error("OperationPipelineExecutor::buildOperationChain: Factory is null during graph build.");
-            return;
-        }
-
         auto op_impl_expected = m_factory->create(desc);
         if (!op_impl_expected) {
             spdlog::warn("OperationPipelineExecutor::buildOperationChain: Failed to create operation '{}'. Skipping.", desc.name);
@@ -107,46 +562,414 @@ void OperationPipelineExecutor::buildOperationChain()
         }
 
         auto op_impl = std::move(op_impl_expected.value());
-        auto* fusion_logic = dynamic_cast<const Operations::IOperationFusionLogic*>(op_impl.get());
+        const auto* fusion_logic = dynamic_cast<const Operations::IOperationFusionLogic*>(op_impl.get());
+        if (!fusion_logic) {
+            spdlog::warn("OperationPipelineExecutor::buildOperationChain: Operation '{}' does not support fusion. Skipping.", desc.name);
+            continue;
+        }
 
-        if (fusion_logic) {
-            // 1. Create or Retrieve the Halide::Param for this operation
-            auto& param_ref = m_pipeline_params[desc.id];
+        // During a gesture: each tick changes the input of the memoizing operations after the dragged one,
+        // recomputing them every time. Left out until it ends; the dragged one stays even when neutral.
+        const bool interactive { m_interactive_operation == desc.id };
+        const std::uint32_t variant = fusion_logic->fusionVariant(desc);
+        if (after_interactive && fusion_logic->memoizesOutput(variant)) {
+            CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::buildOperationChain: '{}' deferred until the gesture ends.", desc.name);
+            m_deferred_operations.push_back(desc.id);
+            continue;
+        }
+        after_interactive = after_interactive || interactive;
 
-            // 2. Initialize the parameter with the current value from the descriptor
-            // This ensures the first run (compilation) has valid data.
-            if (auto val_res = desc.getParam<float>("value")) {
-                param_ref.set(val_res.value());
-            }
+        // A neutral operation changes no pixel: left out of the graph, and so of the cache key
+        if (!interactive && fusion_logic->isIdentity(desc)) {
+            CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::buildOperationChain: '{}' is an identity. Left out of the chain.", desc.name);
+            m_identity_operations.emplace(desc.id, std::move(op_impl));
+            continue;
+        }
 
-            // 3. Pass the Parameter (not the descriptor) to the operation
-            // The operation will use this param in its expression graph.
-            output_func = fusion_logic->appendToFusedPipeline(output_func, x, y, c, param_ref);
+        // Previewed at reduced resolution: an approximation, never kept as the operation's output
+        const bool guided { interactive && guided_previews && fusion_logic->upsamplesPreview(variant) };
+
+        chain.push_back(desc.type);
+        steps.push_back(FusedStep{&desc, std::move(op_impl), fusion_logic, variant, Operations::MaskSampler::isMasked(desc),
+                                  fusion_logic->memoizesOutput(variant) && !guided, guided});
+    }
+
+    // Resumed variant: the steps up to this one are replaced by its memoized output (see resumePoint)
+    std::optional<std::size_t> resume_step;
+    if (m_resume_from) {
+        const auto resumed = std::ranges::find_if(steps, [this](const FusedStep& step) {
+            return step.m_memoizes && step.m_descriptor->id == *m_resume_from;
+        });
+        if (resumed != steps.end()) {
+            resume_step = static_cast<std::size_t>(resumed - steps.begin());
         } else {
-            spdlog::warn("OperationPipelineExecutor::buildOperationChain: Operation '{}' does not support fusion. Skipping.", desc.name);
+            m_resume_from.reset();
+        }
+    }
+    for (std::size_t i = resume_step ? *resume_step + 1 : 0; i < steps.size(); ++i) {
+        m_pipeline_has_memoized_outputs = m_pipeline_has_memoized_outputs || steps[i].m_memoizes;
+    }
+
+    Halide::Target target = pipelineTarget();
+    const bool half_storage = m_storage_format == Common::PixelFormat::RGBA_F16;
+    const bool planar_storage = m_storage_layout == Common::PixelLayout::Planar;
+    m_cpu_schedule = Config::AppConfig::instance().getCpuSchedule();
+    m_cpu_tile_size = Config::AppConfig::instance().getCpuTileSize();
+    const SchedulingStrategy strategy = Config::AppConfig::instance().getSchedulingStrategy();
+    const bool autoschedule = strategy != SchedulingStrategy::Manual && !with_display && !m_profiling;
+
+    std::string cache_key = m_tone_lut_active ? ToneLutStage::makeKey(target)
+                                              : CompiledPipelineCache::makeKey(chain, target);
+    // Structural options change the graph as much as the types do
+    if (std::ranges::any_of(steps, [](const FusedStep& step) { return step.m_variant != 0; })) {
+        cache_key += "|variants";
+        for (const FusedStep& step : steps) {
+            cache_key += ',' + std::to_string(step.m_variant);
+        }
+    }
+    if (std::ranges::any_of(steps, &FusedStep::m_masked)) {
+        cache_key += "|masks";
+        for (const FusedStep& step : steps) {
+            cache_key += step.m_masked ? '1' : '0';
+        }
+    }
+    if (const auto guided = std::ranges::find_if(steps, &FusedStep::m_guided); guided != steps.end()) {
+        cache_key += "|guided" + std::to_string(guided - steps.begin());
+    }
+    if (resume_step) {
+        cache_key += "|resume" + std::to_string(*resume_step);
+    }
+    if (with_geometry) {
+        cache_key += "|straighten";
+    }
+    if (half_storage) {
+        cache_key += "|f16";
+    }
+    if (planar_storage) {
+        cache_key += "|planar";
+    }
+    if (autoschedule) {
+        cache_key += "|auto";
+    } else if (m_backend == Common::MemoryType::CPU_RAM && m_cpu_schedule == CpuSchedule::Tiles) {
+        cache_key += "|tiles" + std::to_string(m_cpu_tile_size);
+    }
+    if (with_display) {
+        cache_key += "|display";
+    }
+    if (with_histogram) {
+        cache_key += "|histogram";
+    }
+    if (m_reuse_cached_stages) {
+        cache_key += "|reuse";
+    }
+
+    // 2. Cache hit: reuse the compiled pipeline, only rebind the parameters to the new ids
+    m_pipeline_cache.setCapacity(Config::AppConfig::instance().getPipelineCacheCapacity());
+    if (auto cached = m_pipeline_cache.find(cache_key)) {
+        for (std::size_t i = 0; i < steps.size(); ++i) {
+            m_pipeline_has_cached_stages = m_pipeline_has_cached_stages || !cached->m_params[i].cachedStages().empty();
+            bindFusedStep(steps[i].m_descriptor, std::move(steps[i].m_operation), cached->m_params[i], steps[i].m_masked);
+        }
+        pruneCachedStageBuffers();
+
+        m_pipeline = cached->m_pipeline;
+        m_pipeline_object = cached->m_object;
+        m_pipeline_key = cache_key;
+        m_schedule_source = cached->m_schedule_source;
+        m_chain_built = true;
+        Common::Metrics::coreMetrics().m_pipeline_cache_hits.add();
+        CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::buildOperationChain: Reusing cached pipeline '{}'.", cache_key);
+        return;
+    }
+
+    // 3. Cache miss: build the graph.
+    // IMPORTANT: Use local variables for Func and Vars to avoid crashes from reusing stale Halide objects.
+    // The 'm_pipeline' member stores the compiled result, but the construction uses fresh objects.
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Func output_func("fused_pipeline");
+
+    // Define the output function based on the inherited input.
+    // Half-float storage is widened on load: the operations always compute in float.
+    // Planar storage only changes the strides: the graph is the same, the loads are dense.
+    Halide::ImageParam& input = planar_storage ? (half_storage ? m_input_half_planar : m_input_planar)
+                                               : (half_storage ? m_input_half : m_input);
+
+    // Kernels reaching past the borders, and the straightened sampling, read the edge pixels.
+    // Per-pixel chains never read outside the image and keep the unclamped loads.
+    const bool reads_neighborhood = std::ranges::any_of(steps, [](const FusedStep& step) {
+        return step.m_guided || step.m_fusion_logic->readsNeighborhood(step.m_variant);
+    });
+    Halide::Func source = reads_neighborhood || with_geometry ? Halide::BoundaryConditions::repeat_edge(input)
+                                                              : Halide::Func(input);
+    output_func(x, y, c) = half_storage ? Halide::cast<float>(source(x, y, c)) : source(x, y, c);
+
+    // Straightened crop: the first Func samples the input through the affine map, so that
+    // every operation computes the straightened pixels directly (no rotated copy).
+    // A lens correction (moved to the front) is defined on the sensor frame: it comes first.
+    bool geometry_pending = with_geometry;
+    auto appendGeometry = [&]() {
+        if (geometry_pending) {
+            output_func = m_geometry_stage.append(output_func, x, y, c);
+            geometry_pending = false;
+        }
+    };
+    if (steps.empty() || steps.front().m_descriptor->type != Operations::OperationType::LensCorrection) {
+        appendGeometry();
+    }
+
+    CompiledPipelineEntry entry;
+    entry.m_params.reserve(steps.size());
+
+    // Luminance shared by the masked adjustments along the chain
+    Operations::FusedLuminance luminance;
+
+    if (m_tone_lut_active) {
+        output_func = m_tone_lut.append(output_func, x, y, c);
+    }
+
+    // Profiling: one named stage per operation, computed at root (see applyRootSchedule)
+    std::vector<Halide::Func> profiled_stages;
+
+    // Blurs and pyramid levels of the neighborhood operations, computed at root as well
+    std::vector<Halide::Func> spatial_stages;
+
+    // Producers of the cached stages: extra outputs of the computing variant
+    std::vector<Halide::Func> cached_producers;
+
+    // Outputs of the memoizing operations: extra outputs as well
+    std::vector<Halide::Func> memoized_producers;
+
+    // Runtime conditions under which the computed operations are neutral (see specializeNeutralOperations)
+    std::vector<Halide::Expr> identity_conditions;
+
+    // Apply operations sequentially
+    for (std::size_t index = 0; index < steps.size(); ++index) {
+        auto& step = steps[index];
+        // Steps up to the resumed one are still declared (their blocks stay bound), but nothing reads them
+        const bool computed = !resume_step || index > *resume_step;
+
+        // 1. The operation declares its runtime inputs in a fresh block while appending its logic.
+        // It receives the block (not the descriptor): no value is baked into the graph.
+        Operations::FusionParameterBlock params;
+        params.setNamePrefix("op" + std::to_string(index) + "_");
+        params.setReuseCachedStages(m_reuse_cached_stages);
+        params.setVariant(step.m_variant);
+        const Halide::Func step_input = output_func;
+        if (step.m_guided) {
+            // Gesture preview: the operation runs on a reduced copy, its effect is fitted and
+            // transferred to every pixel. The reduced branch has a luminance of its own.
+            constexpr int factor { Operations::GuidedUpsampling::k_factor };
+            params.setImageExtent((input.dim(0).extent() + factor - 1) / factor, (input.dim(1).extent() + factor - 1) / factor);
+            const auto reduced = Operations::GuidedUpsampling::reduce(output_func, x, y, c);
+            Operations::FusedLuminance reduced_luminance;
+            const Halide::Func reduced_output = step.m_fusion_logic->appendToFusedPipeline(reduced.m_output, x, y, c, params,
+                                                                                           reduced_luminance);
+            const auto upsampled = Operations::GuidedUpsampling::upsample(output_func, reduced.m_output, reduced_output, x, y, c);
+            params.addSpatialStages(reduced.m_stages);
+            params.addSpatialStages(upsampled.m_stages);
+            output_func = upsampled.m_output;
+            CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::buildOperationChain: '{}' previewed at 1/{} resolution.",
+                         step.m_descriptor->name, factor);
+        } else {
+            params.setImageExtent(input.dim(0).extent(), input.dim(1).extent());
+            output_func = step.m_fusion_logic->appendToFusedPipeline(output_func, x, y, c, params, luminance);
         }
+        if (step.m_masked) {
+            // Local adjustment: blended with its input by the mask coverage
+            output_func = Operations::MaskSampler::append(step_input, output_func, x, y, c, params);
+        }
+        if (resume_step && index == *resume_step) {
+            // Start over from the stored output (read edge-clamped, as the computing variant does)
+            output_func = Halide::BoundaryConditions::repeat_edge(m_resume_input);
+        } else if (computed && step.m_memoizes) {
+            Halide::Func memoized("memoized_" + stageName(step.m_descriptor->type));
+            memoized(x, y, c) = output_func(x, y, c);
+            memoized_producers.push_back(memoized);
+
+            // Later steps read the stored pixels, so that both variants compute the same image
+            output_func = Halide::Func("memoized_read_" + std::to_string(index));
+            output_func(x, y, c) = memoized(Halide::clamp(x, 0, input.dim(0).extent() - 1),
+                                            Halide::clamp(y, 0, input.dim(1).extent() - 1), c);
+        }
+        appendGeometry();
+        if (computed) {
+            spatial_stages.insert(spatial_stages.end(), params.spatialStages().begin(), params.spatialStages().end());
+            identity_conditions.push_back(step.m_fusion_logic->identityCondition(params));
+        }
+        if (computed && !m_reuse_cached_stages) {
+            for (const auto& stage : params.cachedStages()) {
+                cached_producers.push_back(stage.m_producer);
+            }
+        }
+
+        if (m_profiling) {
+            Halide::Func stage("op" + std::to_string(profiled_stages.size()) + "_"
+                               + stageName(step.m_descriptor->type));
+            stage(x, y, c) = output_func(x, y, c);
+            profiled_stages.push_back(stage);
+            output_func = stage;
+        }
+
+        // 2. Initialize the inputs with the current values from the descriptor.
+        // This ensures the first run (compilation) has valid data.
+        entry.m_params.push_back(params);
+        bindFusedStep(step.m_descriptor, std::move(step.m_operation), std::move(params), step.m_masked);
+    }
+    m_pipeline_has_cached_stages = std::ranges::any_of(entry.m_params, [](const Operations::FusionParameterBlock& params) {
+        return !params.cachedStages().empty();
+    });
+    pruneCachedStageBuffers();
+
+    // Half-float storage: narrow once, as the final store
+    Halide::Func stored_func = output_func;
+    Halide::Func linear_func = output_func;
+    if (half_storage) {
+        stored_func = Halide::Func("fused_pipeline_f16");
+        stored_func(x, y, c) = Halide::cast(Halide::Float(16), output_func(x, y, c));
+
+        linear_func = Halide::Func("fused_pipeline_linear");
+        linear_func(x, y, c) = Halide::cast<float>(stored_func(x, y, c));
+    }
+
+    if (autoschedule) {
+        // The autoscheduler starts from unscheduled funcs and tunes for the estimated extents
+        input.dim(0).set_estimate(0, Autoscheduler::k_estimate_width);
+        input.dim(1).set_estimate(0, Autoscheduler::k_estimate_height);
+        input.dim(2).set_estimate(0, ImageProcessing::k_interleaved_channels);
+        stored_func.set_estimates({{0, Autoscheduler::k_estimate_width},
+                                   {0, Autoscheduler::k_estimate_height},
+                                   {0, ImageProcessing::k_interleaved_channels}});
+        for (Halide::Func producer : cached_producers) {
+            producer.set_estimates({{0, Autoscheduler::k_estimate_width}, {0, Autoscheduler::k_estimate_height}});
+        }
+        for (Halide::Func producer : memoized_producers) {
+            producer.set_estimates({{0, Autoscheduler::k_estimate_width},
+                                    {0, Autoscheduler::k_estimate_height},
+                                    {0, ImageProcessing::k_interleaved_channels}});
+        }
+    } else if (m_profiling) {
+        // The luminance funcs read root stages: computed at root as well
+        applyScheduling(stored_func, x, y, c, target, {});
+        profiled_stages.insert(profiled_stages.end(), luminance.stages().begin(), luminance.stages().end());
+        profiled_stages.insert(profiled_stages.end(), spatial_stages.begin(), spatial_stages.end());
+        applyRootSchedule(profiled_stages, x, y, c, target);
+        applyRootSchedule(cached_producers, x, y, c, target);
+        applyRootSchedule(memoized_producers, x, y, c, target);
+    } else {
+        // Apply scheduling (CPU or GPU). Root spatial stages read the chain, luminance included:
+        // a luminance computed within the output's loops could not serve them, it stays inline.
+        applyScheduling(stored_func, x, y, c, target, reads_neighborhood ? std::vector<Halide::Func>{} : luminance.stages());
+        specializeNeutralOperations(stored_func, identity_conditions);
+        applyRootSchedule(spatial_stages, x, y, c, target);
+        applyRootSchedule(cached_producers, x, y, c, target);
+        applyRootSchedule(memoized_producers, x, y, c, target);
+    }
+
+    // The output is written in place into the working image, in its layout
+    ImageProcessing::constrainLayout(stored_func.output_buffer(), m_storage_layout);
+
+    // Optional second output, computed from the first within the same realization
+    Halide::Func display_func;
+    if (with_display) {
+        display_func = m_display_stage.append(linear_func, target);
     }
 
-    // Apply scheduling (CPU or GPU)
-    applyScheduling(output_func, x, y, c);
+    // Optional third output, reduced from the display output
+    Halide::Func histogram_func;
+    if (with_histogram) {
+        histogram_func = m_histogram_stage.append(display_func, target);
+    }
 
     // Use compile_jit(target), otherwise the pipeline defaults to CPU
     // even if gpu_tile() was applied. We must compile for the actual target.
-
-    Halide::Target target = Config::AppConfig::getHalideTarget();
-    spdlog::info("OperationPipelineExecutor::buildOperationChain: Compiling for target: {}", target.to_string());
+    CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::buildOperationChain: Compiling for target: {}", target.to_string());
 
     try {
-        // Compile JIT with the GPU target (e.g., Vulkan)
-        // This generates GPU kernels, not CPU code
-        output_func.compile_jit(target);
+        CM_TRACE_SCOPE("pipeline", "compile");
+
+        // Create the Pipeline (stored image, then display, histogram and cached stages), then
+        // compile JIT for the target (e.g., Vulkan). This generates GPU kernels, not CPU code
+        std::vector<Halide::Func> outputs{stored_func};
+        if (with_display) {
+            outputs.push_back(display_func);
+        }
+        if (with_histogram) {
+            outputs.push_back(histogram_func);
+        }
+        outputs.insert(outputs.end(), cached_producers.begin(), cached_producers.end());
+        outputs.insert(outputs.end(), memoized_producers.begin(), memoized_producers.end());
+        Halide::Pipeline pipeline(outputs);
+
+        // CPU pipelines compiled by an earlier session: loaded as they were scheduled, nothing compiles.
+        // Not for plugin operations: a plugin updated under the same name would run its old code
+        const bool with_plugins = std::ranges::any_of(steps, [](const FusedStep& step) {
+            return Operations::OperationPluginRegistry::contains(step.m_descriptor->type);
+        });
+        const bool persistent = m_backend == Common::MemoryType::CPU_RAM && !m_profiling && !with_plugins
+                                && PipelineObjectCache::isEnabled(target);
+        const std::string object_key = cache_key + '|' + std::string(magic_enum::enum_name(strategy));
+        if (persistent) {
+            if (auto object = PipelineObjectCache::instance().load(object_key, pipeline)) {
+                Common::Metrics::coreMetrics().m_pipeline_disk_cache_hits.add();
+
+                m_pipeline = pipeline;
+                m_pipeline_object = *object;
+                m_pipeline_key = cache_key;
+                m_schedule_source.clear();
+                m_chain_built = true;
+
+                entry.m_pipeline = m_pipeline;
+                entry.m_object = std::move(*object);
+                m_pipeline_cache.insert(cache_key, std::move(entry));
+
+                CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::buildOperationChain: Loaded compiled pipeline '{}' from the disk cache.",
+                                      cache_key);
+                return;
+            }
+        }
+
+        if (autoschedule) {
+            if (auto schedule = Autoscheduler::apply(pipeline, target)) {
+                if (strategy == SchedulingStrategy::AutoscheduleOffline) {
+                    Autoscheduler::exportSchedule(Config::AppConfig::instance().getScheduleDirectory(),
+                                                  cache_key, *schedule);
+                }
+                entry.m_schedule_source = std::move(*schedule);
+            } else {
+                spdlog::warn("OperationPipelineExecutor::buildOperationChain: Autoscheduling failed, using the manual schedule.");
+                applyScheduling(stored_func, x, y, c, target,
+                                reads_neighborhood ? std::vector<Halide::Func>{} : luminance.stages());
+                applyRootSchedule(spatial_stages, x, y, c, target);
+                applyRootSchedule(cached_producers, x, y, c, target);
+                applyRootSchedule(memoized_producers, x, y, c, target);
+            }
+        }
 
-        // Now create the Pipeline from the compiled function
-        m_pipeline = Halide::Pipeline(output_func);
+        const std::int64_t compile_begin_ns { Common::Trace::Tracer::instance().now() };
+        // Compiled ahead of time into the disk cache instead, when the pipeline can be kept there
+        std::optional<PipelineObject> object;
+        if (persistent) {
+            object = PipelineObjectCache::instance().compile(object_key, pipeline, target);
+        }
+        if (!object) {
+            pipeline.compile_jit(target);
+        }
+        Common::Metrics::coreMetrics().m_pipeline_compiles.add();
+        Common::Metrics::coreMetrics().m_pipeline_compile_ms.observe(
+            static_cast<double>(Common::Trace::Tracer::instance().now() - compile_begin_ns) / 1.0e6);
+
+        m_pipeline = pipeline;
+        m_pipeline_object = object.value_or(PipelineObject());
+        m_pipeline_key = cache_key;
+        m_schedule_source = entry.m_schedule_source;
         m_chain_built = true;
 
-        spdlog::info("OperationPipelineExecutor::buildOperationChain: Pipeline compiled successfully with {} cached parameters.",
-                     m_pipeline_params.size());
+        entry.m_pipeline = m_pipeline;
+        entry.m_object = m_pipeline_object;
+        m_pipeline_cache.insert(cache_key, std::move(entry));
+
+        CM_LOG_INFO(Pipeline, "OperationPipelineExecutor::buildOperationChain: Pipeline compiled successfully with {} cached parameters.",
+                              m_pipeline_params.size());
     }
     catch (const Halide::CompileError& e) {
         spdlog::critical("OperationPipelineExecutor::buildOperationChain: Halide Compile Error: {}", e.what());
@@ -158,69 +981,684 @@ void OperationPipelineExecutor::buildOperationChain()
     }
 }
 
-void OperationPipelineExecutor::applyScheduling(Halide::Func& pipeline, Halide::Var& x, Halide::Var& y, Halide::Var& c) const
+void OperationPipelineExecutor::bindFusedStep(const Operations::OperationDescriptor* descriptor,
+                                              std::unique_ptr<Operations::IOperation> operation,
+                                              Operations::FusionParameterBlock params,
+                                              bool masked)
+{
+    FusedBinding binding;
+    binding.m_fusion_logic = dynamic_cast<const Operations::IOperationFusionLogic*>(operation.get());
+    binding.m_operation = std::move(operation);
+    binding.m_params = std::move(params);
+    binding.m_masked = masked;
+    binding.m_memoizes = binding.m_fusion_logic->memoizesOutput(binding.m_params.variant());
+
+    binding.m_fusion_logic->updateFusionParameters(*descriptor, binding.m_params);
+    m_pipeline_params.insert_or_assign(descriptor->id, std::move(binding));
+}
+
+void OperationPipelineExecutor::bindMasks(Common::ImageDim image_width)
+{
+    for (const auto& desc : m_operations) {
+        const auto binding = m_pipeline_params.find(desc.id);
+        if (desc.enabled && binding != m_pipeline_params.end() && binding->second.m_masked) {
+            Operations::MaskSampler::bind(desc, binding->second.m_params, image_width);
+        }
+    }
+}
+
+void OperationPipelineExecutor::pruneCachedStageBuffers()
+{
+    // Buffers of operations that left the chain are not coming back with a matching signature
+    std::erase_if(m_cached_stage_buffers, [this](const auto& cached) {
+        const auto binding = m_pipeline_params.find(cached.first.first);
+        return binding == m_pipeline_params.end()
+               || std::ranges::none_of(binding->second.m_params.cachedStages(), [&](const auto& stage) {
+                      return stage.m_name == cached.first.second;
+                  });
+    });
+    std::erase_if(m_memoized_outputs, [this](const auto& memoized) {
+        const auto binding = m_pipeline_params.find(memoized.first);
+        return binding == m_pipeline_params.end() || !binding->second.m_memoizes;
+    });
+}
+
+std::uint64_t OperationPipelineExecutor::cachedStageSignature(const Halide::Buffer<>& input, std::size_t index) const
 {
+    const halide_buffer_t* raw = input.raw_buffer();
+    std::uint64_t signature { Managers::ResultCache::editHash(std::span(m_operations).first(index)) };
+    for (const std::uint64_t value : { static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(raw->host)),
+                                       static_cast<std::uint64_t>(raw->device),
+                                       static_cast<std::uint64_t>(input.width()),
+                                       static_cast<std::uint64_t>(input.height()),
+                                       static_cast<std::uint64_t>(input.type().bits) }) {
+        signature ^= value + 0x9e3779b97f4a7c15ull + (signature << 6) + (signature >> 2);
+    }
+    return signature;
+}
+
+bool OperationPipelineExecutor::cachedStagesReusable(const Halide::Buffer<>& input, std::size_t first) const
+{
+    for (std::size_t i = first; i < m_operations.size(); ++i) {
+        const auto binding = m_pipeline_params.find(m_operations[i].id);
+        if (!m_operations[i].enabled || binding == m_pipeline_params.end()) {
+            continue;
+        }
+        for (const auto& stage : binding->second.m_params.cachedStages()) {
+            const auto cached = m_cached_stage_buffers.find({m_operations[i].id, stage.m_name});
+            if (cached == m_cached_stage_buffers.end() || !cached->second.m_valid
+                || cached->second.m_buffer.width() != input.width() || cached->second.m_buffer.height() != input.height()
+                || cached->second.m_signature != cachedStageSignature(input, i)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<std::pair<OperationPipelineExecutor::CachedStageBuffer*, std::uint64_t>>
+OperationPipelineExecutor::prepareCachedStages(const Halide::Buffer<>& input, std::vector<Halide::Buffer<>>& outputs)
+{
+    std::vector<std::pair<CachedStageBuffer*, std::uint64_t>> computed;
+
+    // Same order as the outputs of the computing variant: fused steps, then declarations
+    for (std::size_t i = firstComputedOperation(); i < m_operations.size(); ++i) {
+        const auto binding = m_pipeline_params.find(m_operations[i].id);
+        if (!m_operations[i].enabled || binding == m_pipeline_params.end()) {
+            continue;
+        }
+        for (const auto& stage : binding->second.m_params.cachedStages()) {
+            CachedStageBuffer& cached = m_cached_stage_buffers[{m_operations[i].id, stage.m_name}];
+            if (m_reuse_cached_stages) {
+                Halide::ImageParam param = stage.m_param;
+                param.set(cached.m_buffer);
+                continue;
+            }
+
+            const int dimensions = stage.m_param.dimensions();
+            if (!cached.m_buffer.defined() || cached.m_buffer.dimensions() != dimensions
+                || cached.m_buffer.width() != input.width() || cached.m_buffer.height() != input.height()) {
+                cached.m_buffer = dimensions == 3
+                    ? Halide::Buffer<float>(input.width(), input.height(), ImageProcessing::k_interleaved_channels)
+                    : Halide::Buffer<float>(input.width(), input.height());
+            }
+            // Invalid until the realization completes (it may be cancelled halfway)
+            cached.m_valid = false;
+            outputs.emplace_back(cached.m_buffer);
+            computed.emplace_back(&cached, cachedStageSignature(input, i));
+        }
+    }
+    return computed;
+}
+
+std::optional<uint64_t> OperationPipelineExecutor::resumePoint(const Halide::Buffer<>& input) const
+{
+    std::optional<uint64_t> resume;
+    for (std::size_t i = 0; i < m_operations.size(); ++i) {
+        const auto binding = m_pipeline_params.find(m_operations[i].id);
+        if (!m_operations[i].enabled || binding == m_pipeline_params.end() || !binding->second.m_memoizes) {
+            continue;
+        }
+        // The output of operation i is the input of the operations after it
+        const auto memoized = m_memoized_outputs.find(m_operations[i].id);
+        if (memoized != m_memoized_outputs.end() && memoized->second.m_valid
+            && memoized->second.m_buffer.width() == input.width() && memoized->second.m_buffer.height() == input.height()
+            && memoized->second.m_signature == cachedStageSignature(input, i + 1)) {
+            resume = m_operations[i].id;
+        }
+    }
+    return resume;
+}
+
+std::size_t OperationPipelineExecutor::firstComputedOperation() const noexcept
+{
+    if (!m_resume_from) {
+        return 0;
+    }
+    const auto resumed = std::ranges::find(m_operations, *m_resume_from, &Operations::OperationDescriptor::id);
+    return resumed == m_operations.end() ? 0 : static_cast<std::size_t>(resumed - m_operations.begin()) + 1;
+}
+
+std::vector<std::pair<OperationPipelineExecutor::CachedStageBuffer*, std::uint64_t>>
+OperationPipelineExecutor::prepareMemoizedOutputs(const Halide::Buffer<>& input, std::vector<Halide::Buffer<>>& outputs)
+{
+    std::vector<std::pair<CachedStageBuffer*, std::uint64_t>> computed;
+
+    if (m_resume_from) {
+        m_resume_input.set(m_memoized_outputs[*m_resume_from].m_buffer);
+    }
+    if (!m_pipeline_has_memoized_outputs) {
+        return computed;
+    }
+
+    // Same order as the outputs of the pipeline: the memoizing steps after the resumed one
+    for (std::size_t i = firstComputedOperation(); i < m_operations.size(); ++i) {
+        const auto binding = m_pipeline_params.find(m_operations[i].id);
+        if (!m_operations[i].enabled || binding == m_pipeline_params.end() || !binding->second.m_memoizes) {
+            continue;
+        }
+        CachedStageBuffer& memoized = m_memoized_outputs[m_operations[i].id];
+        if (!memoized.m_buffer.defined() || memoized.m_buffer.width() != input.width()
+            || memoized.m_buffer.height() != input.height()) {
+            memoized.m_buffer = Halide::Buffer<float>(input.width(), input.height(), ImageProcessing::k_interleaved_channels);
+        }
+        // Invalid until the realization completes (it may be cancelled halfway)
+        memoized.m_valid = false;
+        outputs.emplace_back(memoized.m_buffer);
+        computed.emplace_back(&memoized, cachedStageSignature(input, i + 1));
+    }
+    return computed;
+}
+
+void OperationPipelineExecutor::applyScheduling(Halide::Func& pipeline, Halide::Var& x, Halide::Var& y, Halide::Var& c,
+                                                const Halide::Target& target,
+                                                const std::vector<Halide::Func>& per_pixel) const
+{
+    // Interleaved RGBA: iterate the channels innermost and unroll them,
+    // so that each pixel is processed with its four channels in registers.
+    pipeline.bound(c, 0, ImageProcessing::k_interleaved_channels)
+        .reorder(c, x, y)
+        .unroll(c);
+
     if (m_backend == Common::MemoryType::GPU_MEMORY) {
-        spdlog::trace("OperationPipelineExecutor::applyScheduling: Applying GPU scheduling.");
-        Halide::Var xo, yo, xi, yi;
-        pipeline.gpu_tile(x, y, xo, yo, xi, yi, 16, 16);
+        CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::applyScheduling: Applying GPU scheduling.");
+        // Block shape tuned for this GPU by the backend benchmark
+        const ImageProcessing::GpuTileSchedule schedule = Config::AppConfig::getGpuTileSchedule();
+        Halide::Var xi, yi;
+        ImageProcessing::applyGpuTiles(pipeline, x, y, xi, yi, schedule);
+
+        // Once per thread (pixel, or vector of pixels), in registers
+        for (Halide::Func func : per_pixel) {
+            func.compute_at(pipeline, xi);
+            if (schedule.m_vector_width > 1) {
+                func.vectorize(x, schedule.m_vector_width);
+            }
+        }
     } else {
-        spdlog::trace("OperationPipelineExecutor::applyScheduling: Applying CPU scheduling.");
-        Halide::Var var_x, var_y;
-        pipeline.split(y, var_y, var_x, 8).parallel(var_y).vectorize(var_x, 8);
+        // Vectorize across pixels: with c unrolled, each channel becomes a full-width
+        // strided vector that Halide lowers to dense loads plus shuffles (interleaved storage),
+        // or a plain dense load and store of its plane (planar storage, no shuffles).
+        const int vector_size = target.natural_vector_size<float>();
+
+        if (m_cpu_schedule == CpuSchedule::Tiles) {
+            CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::applyScheduling: Applying tiled CPU scheduling.");
+            // Guarded tails: regions of interest and refinement bands may be smaller than a tile
+            Halide::Var xo, yo, xi, yi, tile;
+            pipeline.tile(x, y, xo, yo, xi, yi, m_cpu_tile_size, m_cpu_tile_size, Halide::TailStrategy::GuardWithIf)
+                .fuse(xo, yo, tile)
+                .parallel(tile)
+                .vectorize(xi, vector_size);
+
+            // Once per tile, into a tile-sized buffer read back from L2 by every channel
+            for (Halide::Func func : per_pixel) {
+                func.compute_at(pipeline, tile).vectorize(x, vector_size);
+            }
+            return;
+        }
+
+        CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::applyScheduling: Applying CPU scheduling.");
+        Halide::Var yo, yi;
+        pipeline.split(y, yo, yi, 8)
+            .parallel(yo)
+            .vectorize(x, vector_size);
+
+        // Once per vector of pixels, shared by the unrolled channels
+        for (Halide::Func func : per_pixel) {
+            func.compute_at(pipeline, x).vectorize(x, vector_size);
+        }
     }
 }
 
-bool OperationPipelineExecutor::execute(ImageProcessing::IWorkingImageHardware& working_image)
+void OperationPipelineExecutor::specializeNeutralOperations(Halide::Func& pipeline, const std::vector<Halide::Expr>& conditions)
 {
-    if (!m_chain_built) {
-        return true;
+    std::vector<Halide::Expr> neutral;
+    std::ranges::copy_if(conditions, std::back_inserter(neutral), [](const Halide::Expr& condition) { return condition.defined(); });
+    if (neutral.empty()) {
+        return;
     }
 
-    // Dispatch based on backend type
-    if (m_backend == Common::MemoryType::CPU_RAM) {
-        if (auto* cpu_impl = dynamic_cast<ImageProcessing::WorkingImageCPU_Halide*>(&working_image)) {
-            return executeWithConcreteHalide(*cpu_impl);
-        } else {
-            spdlog::warn("OperationPipelineExecutor::execute: Backend mismatch: Configured for CPU, but image is not CPU_Halide.");
-            return false;
+    // Conjunction of the conditions, but the one at `active` (none if out of range)
+    const auto allNeutralBut = [&neutral](std::size_t active) {
+        Halide::Expr conjunction;
+        for (std::size_t i = 0; i < neutral.size(); ++i) {
+            if (i != active) {
+                conjunction = conjunction.defined() ? (conjunction && neutral[i]) : neutral[i];
+            }
+        }
+        return conjunction;
+    };
+
+    // Tested in order: every operation neutral first, then each one alone active.
+    // Each branch substitutes the neutral values, so the simplifier drops those operations.
+    pipeline.specialize(allNeutralBut(neutral.size()));
+    if (neutral.size() > 1 && neutral.size() <= k_max_single_operation_branches) {
+        for (std::size_t active = 0; active < neutral.size(); ++active) {
+            pipeline.specialize(allNeutralBut(active));
         }
-    } else if (m_backend == Common::MemoryType::GPU_MEMORY) {
-        if (auto* gpu_impl = dynamic_cast<ImageProcessing::WorkingImageGPU_Halide*>(&working_image)) {
-            return executeWithConcreteHalide(*gpu_impl);
+    }
+    CM_LOG_TRACE(Pipeline, "OperationPipelineExecutor::specializeNeutralOperations: {} neutral conditions.", neutral.size());
+}
+
+void OperationPipelineExecutor::applyRootSchedule(const std::vector<Halide::Func>& stages, Halide::Var& x, Halide::Var& y,
+                                                  Halide::Var& c, const Halide::Target& target) const
+{
+    const int vector_size = target.natural_vector_size<float>();
+    const ImageProcessing::GpuTileSchedule schedule = Config::AppConfig::getGpuTileSchedule();
+
+    for (Halide::Func stage : stages) {
+        stage.compute_root();
+        if (stage.dimensions() == 3) {
+            stage.bound(c, 0, ImageProcessing::k_interleaved_channels).reorder(c, x, y).unroll(c);
+        }
+
+        if (m_backend == Common::MemoryType::GPU_MEMORY) {
+            Halide::Var xi, yi;
+            ImageProcessing::applyGpuTiles(stage, x, y, xi, yi, schedule);
         } else {
-            spdlog::warn("OperationPipelineExecutor::execute: Backend mismatch: Configured for GPU, but image is not GPU_Halide.");
-            return false;
+            stage.parallel(y).vectorize(x, vector_size);
+        }
+
+        // Reductions (e.g. the bilateral grid splat) keep x and y pure: one cell per thread
+        for (int i = 0; i < stage.num_update_definitions(); ++i) {
+            if (m_backend == Common::MemoryType::GPU_MEMORY) {
+                Halide::Var xo, yo, xi, yi;
+                stage.update(i).gpu_tile(x, y, xo, yo, xi, yi, 8, 8);
+            } else {
+                stage.update(i).parallel(y);
+            }
+        }
+    }
+}
+
+Halide::Target OperationPipelineExecutor::pipelineTarget() const
+{
+    // Read on every run: skip the locked read of the configured target unless it changed
+    const std::uint64_t generation = Config::AppConfig::targetGeneration();
+    if (!m_target || generation != m_target_generation) {
+        const Halide::Target target = Config::AppConfig::getHalideTarget(m_backend);
+        m_target = m_profiling ? target.with_feature(Halide::Target::Profile) : target;
+        m_target_generation = generation;
+    }
+    return *m_target;
+}
+
+void OperationPipelineExecutor::collectProfile(const std::string& report, std::int64_t realize_begin_ns)
+{
+    auto stats = PipelineStats::parseReport(report);
+    if (!stats) {
+        spdlog::warn("OperationPipelineExecutor::collectProfile: No profiler report captured.");
+        return;
+    }
+
+    // Per-Func slices laid end to end from the start of the realization (the profiler samples
+    // totals, not intervals), so the trace shows each operation's share next to the stages.
+    auto& tracer = Common::Trace::Tracer::instance();
+    if (tracer.isEnabled()) {
+        std::int64_t begin_ns = realize_begin_ns;
+        for (const FuncStats& func : stats->m_funcs) {
+            const auto duration_ns = static_cast<std::int64_t>(func.m_time_ms * 1.0e6);
+            tracer.record("halide", tracer.intern(func.m_name), begin_ns, begin_ns + duration_ns);
+            begin_ns += duration_ns;
         }
     }
 
+    CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::collectProfile: {:.3f} ms per run, slowest '{}' ({:.3f} ms).",
+                           stats->m_time_per_run_ms, stats->m_funcs.front().m_name, stats->m_funcs.front().m_time_ms);
+    m_last_stats = std::move(stats);
+}
+
+std::expected<std::filesystem::path, ErrorHandling::CoreError>
+OperationPipelineExecutor::dumpDiagnostics(const std::filesystem::path& directory) const
+{
+    const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+    const std::filesystem::path folder = directory / std::format("pipeline-{:%Y%m%d-%H%M%S}", now);
+
+    std::error_code error;
+    std::filesystem::create_directories(folder, error);
+    if (error) {
+        spdlog::error("OperationPipelineExecutor::dumpDiagnostics: Cannot create '{}': {}", folder.string(), error.message());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    const Halide::Target target = pipelineTarget();
+    const bool jit_pipeline = m_chain_built && m_pipeline.defined();
+
+    std::ofstream manifest(folder / "manifest.txt", std::ios::trunc);
+    manifest << std::format("target: {}\n", target.to_string());
+    manifest << std::format("backend: {}\n", magic_enum::enum_name(m_backend));
+    manifest << std::format("storage: {} {}\n", magic_enum::enum_name(m_storage_format), magic_enum::enum_name(m_storage_layout));
+    manifest << std::format("scheduling: {}, cpu schedule {} (tiles of {}){}\n",
+                            magic_enum::enum_name(Config::AppConfig::instance().getSchedulingStrategy()),
+                            magic_enum::enum_name(m_cpu_schedule), m_cpu_tile_size, m_profiling ? ", profiled" : "");
+    manifest << std::format("pipeline: {}\n", m_aot_arguments ? "AOT tone kernel"
+                                              : !jit_pipeline  ? "none (identity copy)"
+                                              : m_pipeline_object.isValid() ? "loaded from the object cache"
+                                                                            : "JIT-compiled");
+    manifest << std::format("tone table: {}\n", m_tone_lut_active ? "yes" : "no");
+    if (jit_pipeline) {
+        manifest << std::format("cache key: {}\n", m_pipeline_key);
+        manifest << std::format("schedule: {}\n", m_schedule_source.empty() ? "manual" : "autoscheduled (schedule.h)");
+    }
+
+    manifest << "operations:\n";
+    for (const Operations::OperationDescriptor& operation : m_operations) {
+        manifest << std::format("  {} {} '{}'{}\n", operation.id, Operations::OperationPluginRegistry::typeName(operation.type),
+                                operation.name, operation.enabled ? "" : " (disabled)");
+    }
+
+    // Bounds of the last realization: the lowered statement is symbolic in them
+    const Halide::ImageParam& input = m_storage_layout == Common::PixelLayout::Planar
+                                          ? (m_storage_format == Common::PixelFormat::RGBA_F16 ? m_input_half_planar : m_input_planar)
+                                          : (m_storage_format == Common::PixelFormat::RGBA_F16 ? m_input_half : m_input);
+    manifest << "bounds:\n";
+    if (const Halide::Buffer<> bound = input.get(); bound.defined()) {
+        manifest << std::format("  input: {}x{}x{} at ({}, {})\n", bound.width(), bound.height(), bound.channels(),
+                                bound.dim(0).min(), bound.dim(1).min());
+    }
+    if (m_last_output_region) {
+        manifest << std::format("  output: {}x{} at ({}, {})\n", m_last_output_region->m_width, m_last_output_region->m_height,
+                                m_last_output_region->m_x, m_last_output_region->m_y);
+    }
+    if (m_roi) {
+        manifest << std::format("  region of interest: {}x{} at ({}, {})\n", m_roi->m_width, m_roi->m_height, m_roi->m_x, m_roi->m_y);
+    }
+    if (m_pipeline_has_display && m_display_buffer.defined()) {
+        manifest << std::format("  display: {}x{}\n", m_display_buffer.width(), m_display_buffer.height());
+    }
+    if (m_pipeline_has_histogram && m_histogram_buffer.defined()) {
+        manifest << std::format("  histogram: {} bins\n", m_histogram_buffer.number_of_elements());
+    }
+
+    if (jit_pipeline) {
+        if (!m_schedule_source.empty()) {
+            std::ofstream(folder / "schedule.h", std::ios::trunc) << m_schedule_source;
+        }
+
+        try {
+            Halide::Pipeline pipeline = m_pipeline;
+
+            std::vector<Halide::Internal::Function> functions;
+            for (const Halide::Func& output : pipeline.outputs()) {
+                functions.push_back(output.function());
+            }
+            std::ofstream(folder / "loop_nest.txt", std::ios::trunc) << Halide::Internal::print_loop_nest(functions);
+
+            const std::vector<Halide::Argument> arguments = pipeline.infer_arguments();
+            pipeline.compile_to_lowered_stmt((folder / "lowered.stmt").string(), arguments, Halide::StmtOutputFormat::Text, target);
+            pipeline.compile_to_lowered_stmt((folder / "lowered.stmt.html").string(), arguments, Halide::StmtOutputFormat::HTML, target);
+        } catch (const Halide::Error& e) {
+            // The manifest still describes the chain
+            manifest << std::format("lowering failed: {}\n", e.what());
+            spdlog::warn("OperationPipelineExecutor::dumpDiagnostics: Lowering failed: {}", e.what());
+        }
+    }
+
+    manifest.flush();
+    if (!manifest) {
+        spdlog::error("OperationPipelineExecutor::dumpDiagnostics: Write to '{}' failed", folder.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::info("OperationPipelineExecutor::dumpDiagnostics: Pipeline written to '{}'", folder.string());
+    return folder;
+}
+
+bool OperationPipelineExecutor::execute(ImageProcessing::IWorkingImageHardware& working_image)
+{
+    // Note: dispatch even when no chain is built, the destination buffer
+    // still has to be reset from the source (identity pipeline).
+
+    // Dispatch on the concrete image type: the backend is chosen per image,
+    // so CPU and GPU images may alternate within one session (e.g. proxy and full resolution).
+    // The exact types are compared first: a type_info comparison instead of a hierarchy walk,
+    // which shows on batches of thumbnails.
+    const std::type_info& type = typeid(working_image);
+    if (type == typeid(ImageProcessing::WorkingImageCPU_Halide)) {
+        switchBackend(Common::MemoryType::CPU_RAM);
+        return executeWithConcreteHalide(static_cast<ImageProcessing::WorkingImageCPU_Halide&>(working_image));
+    }
+    if (type == typeid(ImageProcessing::WorkingImageGPU_Halide)) {
+        switchBackend(Common::MemoryType::GPU_MEMORY);
+        return executeWithConcreteHalide(static_cast<ImageProcessing::WorkingImageGPU_Halide&>(working_image));
+    }
+
+    if (auto* cpu_impl = dynamic_cast<ImageProcessing::WorkingImageCPU_Halide*>(&working_image)) {
+        switchBackend(Common::MemoryType::CPU_RAM);
+        return executeWithConcreteHalide(*cpu_impl);
+    }
+
+    if (auto* gpu_impl = dynamic_cast<ImageProcessing::WorkingImageGPU_Halide*>(&working_image)) {
+        switchBackend(Common::MemoryType::GPU_MEMORY);
+        return executeWithConcreteHalide(*gpu_impl);
+    }
+
+    spdlog::warn("OperationPipelineExecutor::execute: Unsupported working image type (neither CPU_Halide nor GPU_Halide).");
     return false;
 }
 
-bool OperationPipelineExecutor::executeOnHalideBuffer(Halide::Buffer<float>& buffer)
+bool OperationPipelineExecutor::executeOnHalideBuffer(const Halide::Buffer<float>& input, Halide::Buffer<float>& output)
 {
-    if (!m_chain_built || !m_pipeline.defined()) {
-        return true;
+    return executeOnBuffers(input, output);
+}
+
+bool OperationPipelineExecutor::executeOnHalideBuffer(const Halide::Buffer<Halide::float16_t>& input,
+                                                      Halide::Buffer<Halide::float16_t>& output)
+{
+    return executeOnBuffers(input, output);
+}
+
+template<typename Element>
+bool OperationPipelineExecutor::executeOnBuffers(const Halide::Buffer<Element>& input, Halide::Buffer<Element>& output)
+{
+    constexpr bool k_half_storage = std::is_same_v<Element, Halide::float16_t>;
+
+    // The element type selects the pipeline variant (rebuilt or fetched from the cache)
+    switchStorageFormat(k_half_storage ? Common::PixelFormat::RGBA_F16 : Common::PixelFormat::RGBA_F32);
+
+    if (!input.defined() || !output.defined()) {
+        spdlog::error("OperationPipelineExecutor::executeOnHalideBuffer: Input or output buffer is undefined.");
+        return false;
+    }
+
+    // The compiled pipelines assume the same RGBA layout on both ends (see constrainLayout)
+    const Common::PixelLayout layout = ImageProcessing::layoutOf(input);
+    if (!ImageProcessing::hasLayout(input, layout) || !ImageProcessing::hasLayout(output, layout)) {
+        spdlog::error("OperationPipelineExecutor::executeOnHalideBuffer: Buffers must share an interleaved or planar RGBA layout.");
+        return false;
+    }
+    switchStorageLayout(layout);
+
+    // Restrict the realization to the crop and the region of interest, if any.
+    // A cropped buffer shares storage with 'output' and keeps absolute coordinates,
+    // so the pipeline only computes (and writes) the pixels inside the region.
+    const auto image_width = static_cast<Common::ImageDim>(output.width());
+    const auto image_height = static_cast<Common::ImageDim>(output.height());
+    const auto crop_region = m_crop ? std::optional(m_crop->region(image_width, image_height)) : std::nullopt;
+    std::optional<Common::RegionOfInterest> realized = m_roi;
+    if (crop_region) {
+        realized = m_roi ? m_roi->intersectedWith(*crop_region) : *crop_region;
+    }
+
+    Halide::Buffer<Element> target_buffer = output;
+    if (realized.has_value()) {
+        const auto roi = realized->clampedTo(image_width, image_height);
+        if (!roi.isValid()) {
+            CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::executeOnHalideBuffer: Region of interest is outside the image. Nothing to do.");
+            return true;
+        }
+        if (!roi.coversImage(image_width, image_height)) {
+            target_buffer = output.cropped({
+                {output.dim(0).min() + roi.m_x, static_cast<int>(roi.m_width)},
+                {output.dim(1).min() + roi.m_y, static_cast<int>(roi.m_height)},
+                {output.dim(2).min(), output.dim(2).extent()}
+            });
+        }
+    }
+
+    // Never hand out the display image of an earlier execution
+    m_display_image.reset();
+
+    // A newer request already replaced this one: do not start
+    if (m_cancellation.isCancelled()) {
+        CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::executeOnHalideBuffer: Request superseded before execution. Skipped.");
+        return false;
     }
 
     try {
-        // 1. Bind the actual C++ buffer memory to the Halide ImageParam
+        if constexpr (!k_half_storage) {
+            if (m_aot_arguments) {
+                if (AotToneKernel::run(*m_aot_arguments, input, target_buffer)) {
+                    output.set_host_dirty();
+                    return true;
+                }
+                spdlog::warn("OperationPipelineExecutor::executeOnHalideBuffer: AOT tone kernel failed. Falling back to JIT.");
+                m_aot_arguments.reset();
+                buildOperationChain();
+            }
+        }
+
+        // Add or drop the display and histogram outputs when the need changed (e.g. ROI set or cleared),
+        // and read the cached stages once they hold this input's results (computed otherwise).
+        // All variants stay in the pipeline cache, so toggling does not recompile.
+        const bool display_wanted = wantsDisplayOutput();
+        const bool histogram_wanted = wantsHistogramOutput();
+        // Resume from the last expensive operation whose memoized output still holds for this input.
+        const std::optional<uint64_t> resume_wanted = m_aot_arguments ? std::nullopt : resumePoint(input);
+        const bool resume_changed = resume_wanted != m_resume_from;
+        m_resume_from = resume_wanted;
+        const bool reuse_wanted = m_pipeline_has_cached_stages && cachedStagesReusable(input, firstComputedOperation());
+        if (!m_aot_arguments && (display_wanted != m_pipeline_has_display || histogram_wanted != m_pipeline_has_histogram
+                                 || reuse_wanted != m_reuse_cached_stages || resume_changed)) {
+            m_reuse_cached_stages = reuse_wanted;
+            buildOperationChain();
+        }
+
+        if (!m_chain_built || !m_pipeline.defined()) {
+            // Identity pipeline: the destination simply mirrors the source.
+            // Device-resident (GPU) images are copied on the device, without a host round trip.
+            if (!realized.has_value() && ImageProcessing::copyOnDevice(input, output)) {
+                return true;
+            }
+
+            // Host copy (shallow handle copy so the host sync can be issued on a const input)
+            Halide::Buffer<Element> source = input;
+            source.copy_to_host();
+            target_buffer.copy_from(source);
+            output.set_host_dirty();
+            return true;
+        }
+
+        // 1. Bind the source buffer to the Halide ImageParam of its element type
         // This is extremely fast (pointer copy), no data duplication.
-        m_input.set(buffer);
+        const bool planar = layout == Common::PixelLayout::Planar;
+        if constexpr (k_half_storage) {
+            (planar ? m_input_half_planar : m_input_half).set(input);
+        } else {
+            (planar ? m_input_planar : m_input).set(input);
+        }
+        // Masks: the pyramid level of this input's size, repacked only after a stroke
+        bindMasks(static_cast<Common::ImageDim>(input.width()));
         // 2. Get the target for execution
         // CRITICAL: For GPU execution, realize() MUST receive the target parameter
-        Halide::Target target = Config::AppConfig::getHalideTarget();
+        // (the target is logged when the pipeline compiles, not on every run)
+        Halide::Target target = pipelineTarget();
+
+        // Aborts the remaining parallel tasks once the request is cancelled
+        CancellableJITContext context(m_cancellation);
+        // Tiny realizations (thumbnails, preset previews) cost less than their dispatch to the pool
+        if (m_backend == Common::MemoryType::CPU_RAM
+            && static_cast<std::int64_t>(target_buffer.width()) * target_buffer.height() <= k_serial_max_pixels) {
+            context.runSerially();
+        }
+        CM_TRACE_SCOPE("pipeline", "realize");
+
+        // Profiled pipelines print their report at the end of each realization
+        std::string profiler_report;
+        const std::int64_t realize_begin_ns = Common::Trace::Tracer::instance().now();
+        if (m_profiling) {
+            context.capturePrints(profiler_report);
+        }
 
-        spdlog::debug("OperationPipelineExecutor::executeOnHalideBuffer: Halide Target Architecture: {}",
-                     target.to_string());
+        // 3. Execute the pipeline on the correct device (CPU or GPU), source -> destination
+        // For GPU: buffers are already on device (done once in WorkingImageGPU_Halide::updateFromCPU)
+        // realize() will execute the GPU kernel and leave the result device-resident
+        std::vector<Halide::Buffer<>> outputs{target_buffer};
+
+        // Straightened sampling of the crop, on this image's size
+        if (m_pipeline_has_geometry && m_crop) {
+            m_geometry_stage.bind(*m_crop, image_width, image_height);
+        }
+
+        if (m_pipeline_has_display) {
+            // Fused display output: allocated once per display size, the scale is a runtime parameter.
+            // A crop is shown alone, fitted into the display size.
+            const Common::RegionOfInterest shown = crop_region.value_or(Common::RegionOfInterest{0, 0, image_width, image_height});
+            const auto [display_width, display_height] = crop_region ? fitDisplaySize(*m_display_size, shown) : *m_display_size;
+            const bool on_device = displaysOnDevice();
+            if (!m_display_buffer.defined()
+                || m_display_buffer.width() != static_cast<int>(display_width)
+                || m_display_buffer.height() != static_cast<int>(display_height)
+                || on_device != (m_display_buffer.data() == nullptr)) {
+                m_display_buffer = on_device ? allocateDeviceDisplayBuffer(static_cast<int>(display_width),
+                                                                           static_cast<int>(display_height), target)
+                                             : Halide::Buffer<uint8_t>();
+                if (!m_display_buffer.defined()) {
+                    m_display_buffer = Halide::Buffer<uint8_t>::make_interleaved(
+                        static_cast<int>(display_width), static_cast<int>(display_height), Common::DisplayImage::k_channels);
+                }
+            }
+            m_display_stage.bind(shown, display_width, display_height);
+            outputs.emplace_back(m_display_buffer);
+
+            if (m_pipeline_has_histogram) {
+                if (!m_histogram_buffer.defined()) {
+                    m_histogram_buffer = HistogramStage::makeBuffer();
+                }
+                m_histogram_stage.bind(display_width, display_height);
+                outputs.emplace_back(m_histogram_buffer);
+            }
+        }
 
-        // 3. Execute the pipeline on the correct device (CPU or GPU)
-        // For GPU: buffer must already be on device (done in WorkingImageGPU_Halide::updateFromCPU)
-        // realize() will execute the GPU kernel
-        m_pipeline.realize(buffer, target);
+        std::vector<std::pair<CachedStageBuffer*, std::uint64_t>> computed_stages;
+        if (m_pipeline_has_cached_stages) {
+            computed_stages = prepareCachedStages(input, outputs);
+        }
+        for (const auto& memoized : prepareMemoizedOutputs(input, outputs)) {
+            computed_stages.push_back(memoized);
+        }
+
+        if (m_pipeline_object.isValid()) {
+            m_pipeline_object.realize(&context, outputs);
+        } else if (outputs.size() == 1) {
+            m_pipeline.realize(&context, target_buffer, target);
+        } else {
+            m_pipeline.realize(&context, Halide::Realization(std::move(outputs)), target);
+        }
+        recordRealizeDuration(realize_begin_ns);
+        m_last_output_region = Common::RegionOfInterest{
+            static_cast<Common::ImageCoord>(target_buffer.dim(0).min()), static_cast<Common::ImageCoord>(target_buffer.dim(1).min()),
+            static_cast<Common::ImageDim>(target_buffer.width()), static_cast<Common::ImageDim>(target_buffer.height())};
+
+        for (const auto& [cached, signature] : computed_stages) {
+            cached->m_signature = signature;
+            cached->m_valid = true;
+        }
+        if (m_pipeline_has_display) {
+            captureDisplayImage();
+            if (m_histogram_enabled) {
+                captureHistogram();
+            }
+        }
+        if (m_profiling) {
+            collectProfile(profiler_report, realize_begin_ns);
+        }
         return true;
     }
     catch (const Halide::RuntimeError& e) {
+        if (m_cancellation.isCancelled()) {
+            CM_LOG_DEBUG(Pipeline, "OperationPipelineExecutor::executeOnHalideBuffer: Realization aborted (request superseded).");
+            return false;
+        }
         spdlog::critical("OperationPipelineExecutor::executeOnHalideBuffer: Halide Runtime Error: {}", e.what());
         return false;
     }
@@ -249,15 +1687,24 @@ bool OperationPipelineExecutor::executeWithConcreteHalide(ConcreteImage& concret
 
     // Get the raw buffer - cast to WorkingImageHalide (common base class)
     auto& halide_part = static_cast<const ImageProcessing::WorkingImageHalide&>(concrete_image);
-    Halide::Buffer<float> working_buffer = halide_part.getHalideBuffer();
+    const Halide::Buffer<> source_buffer = halide_part.getHalideSourceBuffer();
+    const Halide::Buffer<> working_buffer = halide_part.getHalideBuffer();
 
-    if (!working_buffer.defined()) {
-        spdlog::error("OperationPipelineExecutor::executeWithConcreteHalide: Halide buffer is undefined.");
+    if (!source_buffer.defined() || !working_buffer.defined() || source_buffer.type() != working_buffer.type()) {
+        spdlog::error("OperationPipelineExecutor::executeWithConcreteHalide: Halide buffers are undefined or mismatched.");
         return false;
     }
 
-    // Call the fast path
-    return executeOnHalideBuffer(working_buffer);
+    // Call the fast path (ping-pong: source -> destination), typed by the storage format
+    if (halide_part.getStorageFormat() == Common::PixelFormat::RGBA_F16) {
+        const Halide::Buffer<Halide::float16_t> half_source = source_buffer;
+        Halide::Buffer<Halide::float16_t> half_working = working_buffer;
+        return executeOnHalideBuffer(half_source, half_working);
+    }
+
+    const Halide::Buffer<float> float_source = source_buffer;
+    Halide::Buffer<float> float_working = working_buffer;
+    return executeOnHalideBuffer(float_source, float_working);
 }
 
 } // namespace CaptureMoment::Core::Pipeline
@@ -8,6 +8,8 @@
 #include "pipeline/pipeline_builder.h"
 
 #include <spdlog/spdlog.h>
+
+#include <mutex>
 #include <utility>
 
 namespace CaptureMoment::Core::Pipeline {
@@ -20,19 +22,32 @@ std::unordered_map<PipelineType, PipelineBuilder::CreatorFunc>& PipelineBuilder:
     return registry;
 }
 
+std::shared_mutex& PipelineBuilder::getRegistryMutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
 void PipelineBuilder::registerCreator(PipelineType type, CreatorFunc creator)
 {
     // Register the creator function in the static map
+    std::unique_lock lock(getRegistryMutex());
     getRegistry()[type] = std::move(creator);
 }
 
 std::unique_ptr<IPipelineExecutor> PipelineBuilder::build(PipelineType type)
 {
-    auto& registry = getRegistry();
-    auto it = registry.find(type);
+    CreatorFunc creator;
+    {
+        std::shared_lock lock(getRegistryMutex());
+        const auto& registry = getRegistry();
+        if (const auto it = registry.find(type); it != registry.end()) {
+            creator = it->second;
+        }
+    }
 
     // Check if the requested type has been registered
-    if (it == registry.end())
+    if (!creator)
     {
         spdlog::error("[PipelineBuilder] No creator registered for pipeline type: {}", static_cast<int>(type));
         return nullptr;
@@ -42,7 +57,7 @@ std::unique_ptr<IPipelineExecutor> PipelineBuilder::build(PipelineType type)
     {
         // Invoke the stored lambda/function to create the instance
         // The creator is expected to call the default constructor of the concrete implementation.
-        return it->second();
+        return creator();
     }
     catch (const std::exception& e)
     {
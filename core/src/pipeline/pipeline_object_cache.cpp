@@ -0,0 +1,512 @@
+/**
+ * @file pipeline_object_cache.cpp
+ * @brief Implementation of PipelineObjectCache.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/pipeline_object_cache.h"
+#include "pipeline/cancellable_jit_context.h"
+#include "config/app_config.h"
+
+#include "config.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+/**
+ * @brief Name of the compiled function (its `_argv` and `_metadata` entry points are looked up).
+ */
+constexpr std::string_view k_function_name { "capturemoment_pipeline" };
+
+/**
+ * @brief Bumped when the layout of the entries or the calling convention changes.
+ */
+constexpr int k_format_version { 1 };
+
+#if defined(__APPLE__)
+constexpr std::string_view k_entry_extension { ".dylib" };
+#else
+constexpr std::string_view k_entry_extension { ".so" };
+#endif
+
+/**
+ * @brief Message of the last error raised by a library's runtime on this thread.
+ */
+thread_local std::string t_error;
+
+/**
+ * @brief 64-bit FNV-1a hash of a string (stable across runs, unlike std::hash).
+ */
+[[nodiscard]] std::uint64_t fnv1a(std::string_view text) noexcept
+{
+    std::uint64_t hash { 14695981039346656037ull };
+    for (const char c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief true for the names Halide gives to unnamed parameters (`p` followed by a counter).
+ */
+[[nodiscard]] bool isGeneratedName(std::string_view name) noexcept
+{
+    return name.size() > 1 && name.front() == 'p'
+           && std::ranges::all_of(name.substr(1), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+/**
+ * @brief Compiler driver linking the objects into shared libraries.
+ */
+[[nodiscard]] std::string compilerDriver()
+{
+    const char* driver = std::getenv("CC");
+    return driver && *driver ? std::string(driver) : std::string("cc");
+}
+
+#if !defined(_WIN32)
+
+/**
+ * @brief Identity of the binary the engine runs from: any rebuild or update changes it.
+ */
+[[nodiscard]] const std::string& buildIdentity()
+{
+    static const std::string s_identity = [] {
+        std::string identity { std::to_string(CAPTUREMOMENT_VERSION_MAJOR) + '.' + std::to_string(CAPTUREMOMENT_VERSION_MINOR)
+                               + '.' + std::to_string(CAPTUREMOMENT_VERSION_PATCH) };
+        Dl_info info {};
+        if (dladdr(reinterpret_cast<const void*>(&buildIdentity), &info) != 0 && info.dli_fname) {
+            std::error_code ec;
+            const auto size { std::filesystem::file_size(info.dli_fname, ec) };
+            const auto mtime { std::filesystem::last_write_time(info.dli_fname, ec) };
+            if (!ec) {
+                identity += '|' + std::string(info.dli_fname) + '|' + std::to_string(size) + '|'
+                          + std::to_string(mtime.time_since_epoch().count());
+            }
+        }
+        return identity;
+    }();
+    return s_identity;
+}
+
+/**
+ * @brief `halide_do_par_for` of the libraries: the engine's handler, as for the JIT pipelines.
+ */
+int objectDoParFor(void* user_context, halide_task_t task, int min, int extent, std::uint8_t* closure)
+{
+    // The library hands back the context given to realize(), as the JIT does
+    return CancellableJITContext::doParFor(static_cast<Halide::JITUserContext*>(user_context),
+                                           reinterpret_cast<int (*)(Halide::JITUserContext*, int, std::uint8_t*)>(task),
+                                           min, extent, closure);
+}
+
+/**
+ * @brief `halide_error` of the libraries: kept for the exception thrown by `realize`.
+ */
+void objectError(void* user_context, const char* message)
+{
+    static_cast<void>(user_context);
+    t_error += message ? message : "";
+}
+
+/**
+ * @brief `halide_print` of the libraries: the context's print handler, or stderr.
+ */
+void objectPrint(void* user_context, const char* text)
+{
+    auto* context { static_cast<Halide::JITUserContext*>(user_context) };
+    if (context && context->handlers.custom_print) {
+        context->handlers.custom_print(context, text);
+    } else if (text) {
+        std::fputs(text, stderr);
+    }
+}
+
+#endif
+
+} // anonymous namespace
+
+// ============================================================
+// PipelineObject
+// ============================================================
+
+/**
+ * @brief A loaded library and its entry point.
+ */
+struct PipelineObject::Library {
+    /**
+     * @brief Handle of the library.
+     */
+    void* m_handle{nullptr};
+
+    /**
+     * @brief `<function>_argv`: user context, inputs then outputs, each through a pointer.
+     */
+    int (*m_argv)(void**){nullptr};
+
+    ~Library()
+    {
+#if !defined(_WIN32)
+        if (m_handle) {
+            dlclose(m_handle);
+        }
+#endif
+    }
+};
+
+void PipelineObject::realize(Halide::JITUserContext* context, const std::vector<Halide::Buffer<>>& outputs) const
+{
+    if (!m_library) {
+        throw Halide::RuntimeError("Pipeline object is not loaded");
+    }
+
+    // Scalars are passed by address, buffers as their halide_buffer_t (no reallocation: addresses stay valid)
+    std::vector<halide_scalar_value_t> scalars(m_inputs.size());
+    std::vector<Halide::Buffer<>> buffers;
+    buffers.reserve(m_inputs.size() + outputs.size());
+    std::vector<void*> arguments;
+    arguments.reserve(1 + m_inputs.size() + outputs.size());
+
+    void* user_context { context };
+    arguments.push_back(&user_context);
+    for (std::size_t i = 0; i < m_inputs.size(); ++i) {
+        if (m_inputs[i].is_buffer()) {
+            // An unbound input is passed as null: the pipeline reports it
+            buffers.push_back(m_inputs[i].buffer());
+            arguments.push_back(buffers.back().defined() ? buffers.back().raw_buffer() : nullptr);
+        } else {
+            scalars[i] = m_inputs[i].scalar_raw_value();
+            arguments.push_back(&scalars[i]);
+        }
+    }
+    for (const auto& output : outputs) {
+        buffers.push_back(output);
+        arguments.push_back(buffers.back().raw_buffer());
+    }
+
+    t_error.clear();
+    if (const int result = m_library->m_argv(arguments.data()); result != 0) {
+        throw Halide::RuntimeError(t_error.empty() ? "Pipeline object failed with error " + std::to_string(result) : t_error);
+    }
+}
+
+// ============================================================
+// PipelineObjectCache
+// ============================================================
+
+PipelineObjectCache& PipelineObjectCache::instance()
+{
+    static PipelineObjectCache* s_instance { new PipelineObjectCache() };
+    return *s_instance;
+}
+
+bool PipelineObjectCache::isEnabled(const Halide::Target& target) noexcept
+{
+#if defined(_WIN32)
+    static_cast<void>(target);
+    return false;
+#else
+    return !target.has_gpu_feature() && Config::AppConfig::instance().getPipelineDiskCacheSizeMB() > 0;
+#endif
+}
+
+std::optional<PipelineObject> PipelineObjectCache::load(const std::string& key, const Halide::Pipeline& pipeline)
+{
+    const std::filesystem::path dir { directory() };
+    if (dir.empty()) {
+        return std::nullopt;
+    }
+
+    const std::filesystem::path entry { dir / entryName(key) };
+    std::error_code ec;
+    if (!std::filesystem::exists(entry, ec)) {
+        return std::nullopt;
+    }
+
+    const auto inputs { inferInputs(pipeline) };
+    if (!inputs) {
+        return std::nullopt;
+    }
+
+    auto object { open(entry, *inputs, pipeline.outputs().size()) };
+    if (!object) {
+        // Truncated, foreign or built for another graph: deleted so the next compilation replaces it
+        spdlog::warn("[PipelineObjectCache::load]: Discarding '{}'.", entry.string());
+        std::filesystem::remove(entry, ec);
+        return std::nullopt;
+    }
+
+    // Most recently used: eviction deletes the oldest modification times first
+    std::filesystem::last_write_time(entry, std::filesystem::file_time_type::clock::now(), ec);
+
+    spdlog::debug("[PipelineObjectCache::load]: Loaded '{}' for '{}'.", entry.string(), key);
+    return object;
+}
+
+std::optional<PipelineObject> PipelineObjectCache::compile(const std::string& key, Halide::Pipeline& pipeline,
+                                                           const Halide::Target& target)
+{
+    const std::uint64_t capacity_mb { Config::AppConfig::instance().getPipelineDiskCacheSizeMB() };
+    const std::filesystem::path dir { directory() };
+    if (!isEnabled(target) || dir.empty() || dir.string().find('\'') != std::string::npos || !linkerAvailable()) {
+        return std::nullopt;
+    }
+
+    const auto inputs { inferInputs(pipeline) };
+    if (!inputs) {
+        spdlog::debug("[PipelineObjectCache::compile]: '{}' has constant or unnamed inputs, left to the JIT.", key);
+        return std::nullopt;
+    }
+
+    std::lock_guard lock(m_store_mutex);
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        spdlog::warn("[PipelineObjectCache::compile]: Cannot create '{}': {}", dir.string(), ec.message());
+        return std::nullopt;
+    }
+
+    const std::filesystem::path entry { dir / entryName(key) };
+    std::filesystem::path object { entry };
+    object.replace_extension(".o");
+    std::filesystem::path partial { entry };
+    partial.replace_extension(".part");
+
+    std::vector<Halide::Argument> arguments;
+    arguments.reserve(inputs->size());
+    for (const auto& input : *inputs) {
+        arguments.push_back(input.arg);
+    }
+
+    // The user context carries the handlers (cancellation, compute pool) to the library's runtime
+    const Halide::Target object_target { target.without_feature(Halide::Target::JIT).with_feature(Halide::Target::UserContext) };
+    try {
+        pipeline.compile_to_object(object.string(), arguments, std::string(k_function_name), object_target);
+    } catch (const Halide::Error& e) {
+        spdlog::warn("[PipelineObjectCache::compile]: Cannot compile '{}': {}", key, e.what());
+        std::filesystem::remove(object, ec);
+        return std::nullopt;
+    }
+
+    // Linked aside, then renamed: another process never loads a partial library
+    std::string command { compilerDriver() + " -shared" };
+#if defined(__linux__)
+    // Each library binds to its own runtime, whose handlers are redirected below
+    command += " -Wl,-Bsymbolic";
+#endif
+    command += " -o '" + partial.string() + "' '" + object.string() + "'";
+    const int status { std::system(command.c_str()) };
+    std::filesystem::remove(object, ec);
+    if (status != 0) {
+        spdlog::warn("[PipelineObjectCache::compile]: Linking '{}' failed ({}).", key, status);
+        std::filesystem::remove(partial, ec);
+        return std::nullopt;
+    }
+
+    std::filesystem::rename(partial, entry, ec);
+    if (ec) {
+        spdlog::warn("[PipelineObjectCache::compile]: Cannot write '{}': {}", entry.string(), ec.message());
+        std::filesystem::remove(partial, ec);
+        return std::nullopt;
+    }
+
+    evict_unsafe(dir, capacity_mb * 1024 * 1024);
+
+    spdlog::debug("[PipelineObjectCache::compile]: Stored '{}' as '{}'.", key, entry.string());
+    return open(entry, *inputs, pipeline.outputs().size());
+}
+
+std::filesystem::path PipelineObjectCache::directory()
+{
+    const auto configured { Config::AppConfig::instance().getPipelineDiskCacheDirectory() };
+    if (!configured.empty()) {
+        return configured;
+    }
+
+    std::error_code ec;
+    const auto temp { std::filesystem::temp_directory_path(ec) };
+    return ec ? std::filesystem::path() : temp / "capturemoment" / "pipelines";
+}
+
+std::string PipelineObjectCache::entryName(const std::string& key)
+{
+    static constexpr char k_hex[] { "0123456789abcdef" };
+
+    std::string identity { key };
+    identity += "|halide-" + std::to_string(HALIDE_VERSION_MAJOR) + '.' + std::to_string(HALIDE_VERSION_MINOR)
+              + '.' + std::to_string(HALIDE_VERSION_PATCH);
+    identity += "|v" + std::to_string(k_format_version);
+#if !defined(_WIN32)
+    identity += '|' + buildIdentity();
+#endif
+
+    std::uint64_t hash { fnv1a(identity) };
+    std::string name(16, '0');
+    for (auto it = name.rbegin(); it != name.rend(); ++it, hash >>= 4) {
+        *it = k_hex[hash & 0xF];
+    }
+    return name + std::string(k_entry_extension);
+}
+
+std::optional<std::vector<Halide::Internal::InferredArgument>> PipelineObjectCache::inferInputs(const Halide::Pipeline& pipeline)
+{
+    std::vector<Halide::Internal::Function> functions;
+    for (const Halide::Func& output : pipeline.outputs()) {
+        functions.push_back(output.function());
+    }
+
+    // What Pipeline::infer_arguments() does, keeping the parameters
+    auto inputs { Halide::Internal::infer_arguments(Halide::Internal::Stmt(), functions) };
+
+    // A constant buffer would be baked into the library: its later contents would be ignored.
+    // Names generated by Halide ("p<n>") depend on the process: the arguments could not be matched.
+    if (std::ranges::any_of(inputs, [](const auto& input) {
+            return input.buffer.defined() || isGeneratedName(input.arg.name);
+        })) {
+        return std::nullopt;
+    }
+    return inputs;
+}
+
+std::optional<PipelineObject> PipelineObjectCache::open(const std::filesystem::path& path,
+                                                        const std::vector<Halide::Internal::InferredArgument>& inputs,
+                                                        std::size_t output_count)
+{
+#if defined(_WIN32)
+    static_cast<void>(path);
+    static_cast<void>(inputs);
+    static_cast<void>(output_count);
+    return std::nullopt;
+#else
+    void* handle { dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL) };
+    if (!handle) {
+        return std::nullopt;
+    }
+
+    auto library { std::make_shared<PipelineObject::Library>() };
+    library->m_handle = handle;
+
+    const std::string name { k_function_name };
+    library->m_argv = reinterpret_cast<int (*)(void**)>(dlsym(handle, (name + "_argv").c_str()));
+    const auto metadata { reinterpret_cast<const halide_filter_metadata_t* (*)()>(dlsym(handle, (name + "_metadata").c_str())) };
+    const auto set_do_par_for { reinterpret_cast<halide_do_par_for_t (*)(halide_do_par_for_t)>(dlsym(handle, "halide_set_custom_do_par_for")) };
+    const auto set_error_handler { reinterpret_cast<halide_error_handler_t (*)(halide_error_handler_t)>(dlsym(handle, "halide_set_error_handler")) };
+    const auto set_print { reinterpret_cast<halide_print_t (*)(halide_print_t)>(dlsym(handle, "halide_set_custom_print")) };
+    if (!library->m_argv || !metadata || !set_do_par_for || !set_error_handler || !set_print) {
+        return std::nullopt;
+    }
+
+    // Arguments: the user context, the inputs in order, then the outputs
+    const halide_filter_metadata_t* signature { metadata() };
+    if (!signature || signature->num_arguments < 1
+        || static_cast<std::size_t>(signature->num_arguments) != 1 + inputs.size() + output_count) {
+        return std::nullopt;
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const halide_filter_argument_t& argument { signature->arguments[i + 1] };
+        const Halide::Argument& expected { inputs[i].arg };
+        const int kind { expected.is_buffer() ? halide_argument_kind_input_buffer : halide_argument_kind_input_scalar };
+        if (!argument.name || expected.name != argument.name || argument.kind != kind
+            || argument.dimensions != expected.dimensions || Halide::Type(argument.type) != expected.type) {
+            return std::nullopt;
+        }
+    }
+    for (std::size_t i = 1 + inputs.size(); i < static_cast<std::size_t>(signature->num_arguments); ++i) {
+        if (signature->arguments[i].kind != halide_argument_kind_output_buffer) {
+            return std::nullopt;
+        }
+    }
+
+    // The library's runtime reports to the engine (idempotent for a library already loaded)
+    set_do_par_for(&objectDoParFor);
+    set_error_handler(&objectError);
+    set_print(&objectPrint);
+
+    PipelineObject object;
+    object.m_library = std::move(library);
+    object.m_inputs.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        object.m_inputs.push_back(input.param);
+    }
+    return object;
+#endif
+}
+
+bool PipelineObjectCache::linkerAvailable()
+{
+    static const bool s_available = [] {
+#if defined(_WIN32)
+        return false;
+#else
+        const bool available { std::system((compilerDriver() + " --version > /dev/null 2>&1").c_str()) == 0 };
+        if (!available) {
+            spdlog::info("[PipelineObjectCache::linkerAvailable]: No compiler driver ('{}'): pipelines are JIT-compiled every session.",
+                         compilerDriver());
+        }
+        return available;
+#endif
+    }();
+    return s_available;
+}
+
+void PipelineObjectCache::evict_unsafe(const std::filesystem::path& dir, std::uint64_t capacity_bytes)
+{
+    struct Entry {
+        std::filesystem::path m_path;
+        std::filesystem::file_time_type m_last_used;
+        std::uintmax_t m_size;
+    };
+
+    std::vector<Entry> entries;
+    std::uint64_t total_bytes { 0 };
+
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(dir, ec)) {
+        std::error_code file_ec;
+        if (!file.is_regular_file(file_ec) || file.path().extension() != k_entry_extension) {
+            continue;
+        }
+
+        Entry entry { file.path(), file.last_write_time(file_ec), file.file_size(file_ec) };
+        if (!file_ec) {
+            total_bytes += entry.m_size;
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    if (total_bytes <= capacity_bytes) {
+        return;
+    }
+
+    std::ranges::sort(entries, {}, &Entry::m_last_used);
+
+    for (const auto& entry : entries) {
+        if (total_bytes <= capacity_bytes) {
+            break;
+        }
+        // A library still loaded by a process stays mapped until it is closed
+        if (std::filesystem::remove(entry.m_path, ec)) {
+            total_bytes -= entry.m_size;
+            spdlog::debug("[PipelineObjectCache::evict_unsafe]: Evicted '{}'", entry.m_path.string());
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -0,0 +1,82 @@
+/**
+ * @file pipeline_stats.cpp
+ * @brief Implementation of PipelineStats.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/pipeline_stats.h"
+
+#include <algorithm>
+#include <regex>
+#include <string>
+
+namespace CaptureMoment::Core::Pipeline {
+
+std::optional<PipelineStats> PipelineStats::parseReport(std::string_view report)
+{
+    // Func lines:   "  op1_Contrast:   1.234ms   (12%)   threads: 7.9  peak: 4096 num: 1 avg: 4096"
+    static const std::regex k_func_line { R"(^\s+([A-Za-z0-9_.$]+):\s+([0-9.]+)ms\s+\(\s*([0-9.]+)%\))" };
+    static const std::regex k_peak { R"(peak:\s*([0-9]+))" };
+    static const std::regex k_allocations { R"(num:\s*([0-9]+))" };
+    static const std::regex k_runs { R"(runs:\s*([0-9]+))" };
+    static const std::regex k_time_per_run { R"(time/run:\s*([0-9.]+)\s*ms)" };
+    static const std::regex k_peak_heap { R"(peak heap usage:\s*([0-9]+))" };
+
+    PipelineStats stats;
+    std::smatch match;
+
+    std::size_t begin { 0 };
+    while (begin < report.size())
+    {
+        std::size_t end { report.find('\n', begin) };
+        if (end == std::string_view::npos) {
+            end = report.size();
+        }
+        const std::string line { report.substr(begin, end - begin) };
+        begin = end + 1;
+
+        if (std::regex_search(line, match, k_func_line)) {
+            FuncStats func;
+            func.m_name = match[1].str();
+            func.m_time_ms = std::stod(match[2].str());
+            func.m_percent = std::stod(match[3].str());
+            if (std::regex_search(line, match, k_peak)) {
+                func.m_peak_bytes = std::stoull(match[1].str());
+            }
+            if (std::regex_search(line, match, k_allocations)) {
+                func.m_allocations = std::stoull(match[1].str());
+            }
+            stats.m_funcs.push_back(std::move(func));
+            continue;
+        }
+
+        if (std::regex_search(line, match, k_runs)) {
+            stats.m_runs = std::stoi(match[1].str());
+        }
+        if (std::regex_search(line, match, k_time_per_run)) {
+            stats.m_time_per_run_ms = std::stod(match[1].str());
+        }
+        if (std::regex_search(line, match, k_peak_heap)) {
+            stats.m_peak_heap_bytes = std::stoull(match[1].str());
+        }
+
+        // The report opens with the pipeline name, alone on its line
+        const auto first { line.find_first_not_of(" \t\r") };
+        if (stats.m_pipeline.empty() && first != std::string::npos && line.find(':') == std::string::npos) {
+            stats.m_pipeline = line.substr(first);
+            while (!stats.m_pipeline.empty() && stats.m_pipeline.back() == '\r') {
+                stats.m_pipeline.pop_back();
+            }
+        }
+    }
+
+    if (stats.m_funcs.empty()) {
+        return std::nullopt;
+    }
+
+    std::ranges::stable_sort(stats.m_funcs, std::ranges::greater {}, &FuncStats::m_time_ms);
+    return stats;
+}
+
+} // namespace CaptureMoment::Core::Pipeline
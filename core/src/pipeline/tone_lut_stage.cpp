@@ -0,0 +1,275 @@
+/**
+ * @file tone_lut_stage.cpp
+ * @brief Implementation of ToneLutStage.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/tone_lut_stage.h"
+#include "operations/operation_ranges.h"
+#include "operations/basic_adjustment_operations/tone_adjustments.h"
+#include "operations/basic_adjustment_operations/tone_mask_mode.h"
+#include "operations/masks/mask_sampler.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+using Operations::OperationRanges;
+using Operations::OperationType;
+
+/**
+ * @brief One adjustment of the chain, with its value clamped to the operation's range.
+ */
+struct ToneStage {
+    OperationType m_type;
+    float m_value;
+};
+
+[[nodiscard]] bool isToneType(OperationType type) noexcept
+{
+    switch (type) {
+    case OperationType::Exposure:
+    case OperationType::Brightness:
+    case OperationType::Contrast:
+    case OperationType::Highlights:
+    case OperationType::Shadows:
+    case OperationType::Whites:
+    case OperationType::Blacks:
+    case OperationType::Saturation:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Whether the adjustment reads the pixel luminance (needs the 2D table).
+ */
+[[nodiscard]] bool isMaskedType(OperationType type) noexcept
+{
+    return type != OperationType::Exposure && type != OperationType::Brightness && type != OperationType::Contrast;
+}
+
+[[nodiscard]] ToneStage makeStage(const Operations::OperationDescriptor& desc)
+{
+    auto value_or = [&desc](float default_value, float min_value, float max_value) {
+        auto val_res = desc.getParam<float>(Operations::ParameterKey::Value);
+        return std::clamp(val_res ? val_res.value() : default_value, min_value, max_value);
+    };
+
+    switch (desc.type) {
+    case OperationType::Exposure:
+        return {desc.type, value_or(OperationRanges::getExposureDefaultValue(),
+                                    OperationRanges::getExposureMinValue(), OperationRanges::getExposureMaxValue())};
+    case OperationType::Saturation:
+        return {desc.type, value_or(OperationRanges::getSaturationDefaultValue(),
+                                    OperationRanges::getSaturationMinValue(), OperationRanges::getSaturationMaxValue())};
+    case OperationType::Brightness:
+        return {desc.type, value_or(OperationRanges::getBrightnessDefaultValue(),
+                                    OperationRanges::getBrightnessMinValue(), OperationRanges::getBrightnessMaxValue())};
+    case OperationType::Contrast:
+        return {desc.type, value_or(OperationRanges::getContrastDefaultValue(),
+                                    OperationRanges::getContrastMinValue(), OperationRanges::getContrastMaxValue())};
+    case OperationType::Highlights:
+        return {desc.type, value_or(OperationRanges::getHighlightsDefaultValue(),
+                                    OperationRanges::getHighlightsMinValue(), OperationRanges::getHighlightsMaxValue())};
+    case OperationType::Shadows:
+        return {desc.type, value_or(OperationRanges::getShadowsDefaultValue(),
+                                    OperationRanges::getShadowsMinValue(), OperationRanges::getShadowsMaxValue())};
+    case OperationType::Whites:
+        return {desc.type, value_or(OperationRanges::getWhitesDefaultValue(),
+                                    OperationRanges::getWhitesMinValue(), OperationRanges::getWhitesMaxValue())};
+    default:
+        return {desc.type, value_or(OperationRanges::getBlacksDefaultValue(),
+                                    OperationRanges::getBlacksMinValue(), OperationRanges::getBlacksMaxValue())};
+    }
+}
+
+/**
+ * @brief Scalar counterparts of the masks in `tone_adjustments.h` (default thresholds).
+ */
+[[nodiscard]] float brightMask(float luminance, float low_threshold, float high_threshold) noexcept
+{
+    if (luminance <= low_threshold) return 0.0f;
+    if (luminance >= high_threshold) return 1.0f;
+    return (luminance - low_threshold) / (high_threshold - low_threshold);
+}
+
+[[nodiscard]] float darkMask(float luminance, float low_threshold, float high_threshold) noexcept
+{
+    if (luminance >= high_threshold) return 0.0f;
+    if (luminance <= low_threshold) return 1.0f;
+    return (high_threshold - luminance) / (high_threshold - low_threshold);
+}
+
+/**
+ * @brief Runs the chain on one (value, luminance) sample, mirroring the Halide helpers of
+ *        `tone_adjustments.h`. Keep both in sync.
+ */
+[[nodiscard]] float evaluateChain(const std::vector<ToneStage>& stages, float value, float luminance) noexcept
+{
+    for (const auto& stage : stages) {
+        float offset = 0.0f;
+
+        switch (stage.m_type) {
+        case OperationType::Exposure: {
+            // The stage stores stops
+            const float gain = std::exp2(stage.m_value);
+            value = std::clamp(value * gain, 0.0f, 1.0f);
+            luminance = std::clamp(luminance * gain, 0.0f, 1.0f);
+            continue;
+        }
+        case OperationType::Saturation:
+            // Around the luminance, which it leaves unchanged (until a channel clips)
+            value = std::clamp(luminance + (value - luminance) * stage.m_value, 0.0f, 1.0f);
+            continue;
+        case OperationType::Brightness:
+            value = std::clamp(value + stage.m_value, 0.0f, 1.0f);
+            luminance = std::clamp(luminance + stage.m_value, 0.0f, 1.0f);
+            continue;
+        case OperationType::Contrast:
+            value = std::clamp(0.5f + (value - 0.5f) * stage.m_value, 0.0f, 1.0f);
+            luminance = std::clamp(0.5f + (luminance - 0.5f) * stage.m_value, 0.0f, 1.0f);
+            continue;
+        case OperationType::Highlights:
+        case OperationType::Whites:
+            offset = stage.m_value * brightMask(luminance, 0.7f, 1.0f);
+            break;
+        default:
+            offset = stage.m_value * darkMask(luminance, 0.0f, 0.3f);
+            break;
+        }
+
+        // Same offset on R, G and B: the luminance moves by exactly the same amount
+        value += offset;
+        luminance += offset;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Interpolation coordinates along one table axis; `u` is clamped to [0, 1].
+ */
+struct AxisSample {
+    Halide::Expr m_index;
+    Halide::Expr m_next;
+    Halide::Expr m_weight;
+};
+
+[[nodiscard]] AxisSample sampleAxis(const Halide::ImageParam& table, int dim, const Halide::Expr& u)
+{
+    Halide::Expr last = table.dim(dim).extent() - 1;
+    Halide::Expr position = Halide::clamp(u, 0.0f, 1.0f) * Halide::cast<float>(last);
+    Halide::Expr index = Halide::clamp(Halide::cast<int>(Halide::floor(position)), 0, last);
+
+    return {table.dim(dim).min() + index,
+            table.dim(dim).min() + Halide::min(index + 1, last),
+            position - Halide::cast<float>(index)};
+}
+
+} // namespace
+
+ToneLutStage::ToneLutStage()
+    : m_table(Halide::Float(32), 2, "tone_lut")
+{
+    // Identity: any pipeline built before the first bind is a pass-through
+    bind({});
+}
+
+bool ToneLutStage::matchChain(const std::vector<Operations::OperationDescriptor>& operations)
+{
+    int stages = 0;
+    for (const auto& desc : operations) {
+        // The crop is applied around the table, by the executor (bounds and geometry stage)
+        if (!desc.enabled || desc.type == Operations::OperationType::Crop) {
+            continue;
+        }
+        // Edge-aware masks read the neighborhood: not a function of (value, luminance)
+        if (!isToneType(desc.type) || Operations::toneMaskModeOf(desc) != Operations::ToneMaskMode::PerPixel) {
+            return false;
+        }
+        // A local mask varies per pixel as well
+        if (Operations::MaskSampler::isMasked(desc)) {
+            return false;
+        }
+        ++stages;
+    }
+    return stages >= k_min_stages;
+}
+
+std::string ToneLutStage::makeKey(const Halide::Target& target)
+{
+    return target.to_string() + "|ToneLut";
+}
+
+Halide::Func ToneLutStage::append(const Halide::Func& input,
+                                  const Halide::Var& x,
+                                  const Halide::Var& y,
+                                  const Halide::Var& c) const
+{
+    Halide::Expr luminance = Operations::toneLuminance(input, x, y);
+
+    const AxisSample v = sampleAxis(m_table, 0, input(x, y, c));
+    const AxisSample l = sampleAxis(m_table, 1, luminance);
+
+    Halide::Expr low = Halide::lerp(m_table(v.m_index, l.m_index), m_table(v.m_next, l.m_index), v.m_weight);
+    Halide::Expr high = Halide::lerp(m_table(v.m_index, l.m_next), m_table(v.m_next, l.m_next), v.m_weight);
+
+    Halide::Func tone_lut("tone_lut_op");
+    tone_lut(x, y, c) = Halide::select(
+        c < 3,
+        Halide::lerp(low, high, l.m_weight),
+        input(x, y, c) // Alpha unchanged
+        );
+
+    return tone_lut;
+}
+
+void ToneLutStage::bind(const std::vector<Operations::OperationDescriptor>& operations)
+{
+    std::vector<ToneStage> stages;
+    bool masked = false;
+
+    for (const auto& desc : operations) {
+        if (!desc.enabled || !isToneType(desc.type)) {
+            continue;
+        }
+        stages.push_back(makeStage(desc));
+        masked = masked || isMaskedType(desc.type);
+    }
+
+    const int value_entries = masked ? k_masked_value_entries : k_curve_entries;
+    const int luminance_entries = masked ? k_luminance_entries : 1;
+
+    if (!m_buffer.defined() || m_buffer.width() != value_entries || m_buffer.height() != luminance_entries) {
+        m_buffer = Halide::Buffer<float>(value_entries, luminance_entries);
+    }
+
+    const float value_step = 1.0f / static_cast<float>(value_entries - 1);
+    const float luminance_step = luminance_entries > 1 ? 1.0f / static_cast<float>(luminance_entries - 1) : 0.0f;
+
+    for (int j = 0; j < luminance_entries; ++j) {
+        const float luminance = static_cast<float>(j) * luminance_step;
+        for (int i = 0; i < value_entries; ++i) {
+            const float value = static_cast<float>(i) * value_step;
+            // Without a luminance axis no stage reads it: sample on the diagonal
+            m_buffer(i, j) = evaluateChain(stages, value, masked ? luminance : value);
+        }
+    }
+
+    m_buffer.set_host_dirty();
+    m_table.set(m_buffer);
+
+    spdlog::trace("[ToneLutStage::bind]: Baked {} stage(s) into a {}x{} table.",
+                  stages.size(), value_entries, luminance_entries);
+}
+
+} // namespace CaptureMoment::Core::Pipeline
@@ -0,0 +1,143 @@
+/**
+ * @file variant_renderer.cpp
+ * @brief Implementation of VariantRenderer.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/variant_renderer.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/interfaces/i_operation.h"
+#include "operations/operation_registry.h"
+#include "pipeline/pipeline_builder.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace CaptureMoment::Core::Pipeline {
+
+VariantRenderer::VariantRenderer()
+    : m_operation_factory(std::make_unique<Operations::OperationFactory>())
+{
+    Operations::OperationRegistry::registerAll(*m_operation_factory);
+
+    auto base_executor = PipelineBuilder::build(PipelineType::HalideOperation);
+    if (auto* concrete = dynamic_cast<OperationPipelineExecutor*>(base_executor.get())) {
+        base_executor.release();
+        m_executor.reset(concrete);
+    } else {
+        spdlog::error("[VariantRenderer::VariantRenderer]: No Halide executor: variants cannot be rendered.");
+    }
+}
+
+VariantRenderer::~VariantRenderer() = default;
+
+VariantRenderer::Result VariantRenderer::render(const Common::ImageRegion& image,
+                                                std::span<const Operations::OperationDescriptor> operations,
+                                                std::span<const Operations::ParameterSnapshot> variants,
+                                                Common::ImageDim max_long_edge,
+                                                const Common::CancellationToken& token)
+{
+    if (!m_executor) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    if (variants.empty()) {
+        return std::vector<Common::ImageRegion>{};
+    }
+    if (!image.isValid() || image.m_channels != ImageProcessing::k_interleaved_channels) {
+        spdlog::error("[VariantRenderer::render]: Invalid image ({} channels).", image.m_channels);
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    // ============================================================
+    // One reduced input for every variant
+    // ============================================================
+    auto reduced = reduce(image, max_long_edge);
+    if (!reduced) {
+        return std::unexpected(reduced.error());
+    }
+    const int width = static_cast<int>(reduced->m_width);
+    const int height = static_cast<int>(reduced->m_height);
+    const Halide::Buffer<float> input = ImageProcessing::wrapInterleaved(reduced->getBuffer().data(), width, height,
+                                                                         ImageProcessing::k_interleaved_channels);
+    const auto crop = Operations::CropGeometry::of(operations);
+
+    std::vector<Common::ImageRegion> rendered;
+    rendered.reserve(variants.size());
+
+    std::lock_guard lock(m_mutex);
+    m_executor->setCancellationToken(token);
+
+    for (std::size_t index = 0; index < variants.size(); ++index) {
+        if (token.isCancelled()) {
+            return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+        }
+
+        std::vector<Operations::OperationDescriptor> variant(operations.begin(), operations.end());
+        variants[index].applyTo(variant);
+
+        // Same structure as the previous variant: rebinds the values, no recompilation
+        if (index == 0) {
+            m_executor->init(std::move(variant), *m_operation_factory);
+        } else {
+            m_executor->updateRuntimeParams(std::move(variant));
+        }
+
+        Common::ImageRegion output(
+            Common::PixelBuffer(static_cast<std::size_t>(width) * height * ImageProcessing::k_interleaved_channels),
+            reduced->m_width, reduced->m_height, reduced->m_channels);
+        Halide::Buffer<float> output_buf = ImageProcessing::wrapInterleaved(output.getBuffer().data(), width, height,
+                                                                            ImageProcessing::k_interleaved_channels);
+        if (!m_executor->executeOnHalideBuffer(input, output_buf)) {
+            return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                       : ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+
+        if (crop) {
+            // Only the crop was computed: hand out that rectangle
+            auto cropped = crop->extractFrom(output);
+            if (!cropped) {
+                return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+            }
+            output = std::move(*cropped);
+        }
+        rendered.push_back(std::move(output));
+    }
+
+    CM_LOG_DEBUG(Pipeline, "[VariantRenderer::render]: {} variants rendered at {}x{}.", rendered.size(), width, height);
+    return rendered;
+}
+
+std::expected<Common::ImageRegion, ErrorHandling::CoreError>
+VariantRenderer::reduce(const Common::ImageRegion& image, Common::ImageDim max_long_edge)
+{
+    const Common::ImageDim long_edge = std::max(image.m_width, image.m_height);
+    if (max_long_edge == 0 || long_edge <= max_long_edge) {
+        const std::span<const float> pixels = image.m_data;
+        return Common::ImageRegion(Common::PixelBuffer(pixels.begin(), pixels.end()), image.m_width, image.m_height, image.m_channels);
+    }
+
+    const double scale = static_cast<double>(max_long_edge) / static_cast<double>(long_edge);
+    const auto target_width = std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(std::lround(image.m_width * scale)));
+    const auto target_height = std::max<Common::ImageDim>(1, static_cast<Common::ImageDim>(std::lround(image.m_height * scale)));
+
+    // Small inputs: the CPU beats the transfers to and from a GPU
+    auto working = ImageProcessing::WorkingImageFactory::create(image, Common::MemoryType::CPU_RAM);
+    if (!working) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+    auto downsampled = working->downsample(target_width, target_height);
+    if (!downsampled) {
+        return std::unexpected(downsampled.error());
+    }
+    return std::move(**downsampled);
+}
+
+} // namespace CaptureMoment::Core::Pipeline
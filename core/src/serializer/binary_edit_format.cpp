@@ -0,0 +1,248 @@
+/**
+ * @file binary_edit_format.cpp
+ * @brief Encoding and decoding of the binary edit layout.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/binary_edit_format.h"
+#include "operations/plugins/operation_plugin_registry.h"
+
+#include <spdlog/spdlog.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+namespace CaptureMoment::Core::Serializer {
+
+namespace {
+
+/**
+ * @brief Converts between native and little-endian order (no-op on little-endian hosts).
+ */
+template<typename T>
+[[nodiscard]] constexpr T littleEndian(T value) noexcept
+{
+    if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+        return std::byteswap(value);
+    } else {
+        return value;
+    }
+}
+
+void swapToLittle(EditFileHeader& header) noexcept
+{
+    header.m_version = littleEndian(header.m_version);
+    header.m_operation_count = littleEndian(header.m_operation_count);
+    header.m_parameter_count = littleEndian(header.m_parameter_count);
+    header.m_string_bytes = littleEndian(header.m_string_bytes);
+    header.m_reserved = littleEndian(header.m_reserved);
+}
+
+void swapToLittle(EditOperationRecord& record) noexcept
+{
+    record.m_id = littleEndian(record.m_id);
+    record.m_name_offset = littleEndian(record.m_name_offset);
+    record.m_name_size = littleEndian(record.m_name_size);
+    record.m_parameter_count = littleEndian(record.m_parameter_count);
+    record.m_first_parameter = littleEndian(record.m_first_parameter);
+}
+
+void swapToLittle(EditParameterRecord& record) noexcept
+{
+    record.m_reserved = littleEndian(record.m_reserved);
+    record.m_value = littleEndian(record.m_value);
+    record.m_string_offset = littleEndian(record.m_string_offset);
+}
+
+template<typename Record>
+void appendRecord(std::string& out, Record record)
+{
+    swapToLittle(record);
+    out.append(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+template<typename Record>
+[[nodiscard]] Record readRecord(const std::byte* data) noexcept
+{
+    Record record;
+    std::memcpy(&record, data, sizeof(record));
+    swapToLittle(record);
+    return record;
+}
+
+/**
+ * @brief Appends a string to the string block.
+ * @return Its offset.
+ */
+[[nodiscard]] std::uint32_t appendString(std::string& strings, std::string_view text)
+{
+    const auto offset { static_cast<std::uint32_t>(strings.size()) };
+    strings.append(text);
+    return offset;
+}
+
+} // anonymous namespace
+
+std::string editFilePathForImage(const IXmpPathStrategy& path_strategy, std::string_view source_image_path)
+{
+    std::filesystem::path path { path_strategy.getXmpPathForImage(source_image_path) };
+    path.replace_extension(k_edit_file_extension);
+    return path.string();
+}
+
+std::string encodeEditStack(std::span<const Operations::OperationDescriptor> operations)
+{
+    std::vector<EditOperationRecord> operation_records;
+    std::vector<EditParameterRecord> parameter_records;
+    std::string strings;
+    operation_records.reserve(operations.size());
+
+    for (const auto& operation : operations) {
+        EditOperationRecord record;
+        record.m_id = operation.id;
+        record.m_name_offset = appendString(strings, operation.name);
+        record.m_name_size = static_cast<std::uint32_t>(operation.name.size());
+        record.m_type = static_cast<std::uint8_t>(operation.type);
+        record.m_enabled = operation.enabled ? 1 : 0;
+        record.m_first_parameter = static_cast<std::uint32_t>(parameter_records.size());
+
+        operation.params.forEach([&](Operations::ParameterKey key, const Operations::OperationValue& value) {
+            EditParameterRecord parameter;
+            parameter.m_key = static_cast<std::uint8_t>(key);
+            parameter.m_kind = static_cast<EditValueKind>(value.index());
+            std::visit([&](const auto& held) {
+                using T = std::decay_t<decltype(held)>;
+                if constexpr (std::is_same_v<T, std::string>) {
+                    parameter.m_string_offset = appendString(strings, held);
+                    parameter.m_value = static_cast<std::uint32_t>(held.size());
+                } else if constexpr (std::is_same_v<T, float>) {
+                    parameter.m_value = std::bit_cast<std::uint32_t>(held);
+                } else {
+                    parameter.m_value = static_cast<std::uint32_t>(held);
+                }
+            }, value);
+            parameter_records.push_back(parameter);
+        });
+
+        record.m_parameter_count = static_cast<std::uint16_t>(parameter_records.size() - record.m_first_parameter);
+        operation_records.push_back(record);
+    }
+
+    EditFileHeader header;
+    header.m_operation_count = static_cast<std::uint32_t>(operation_records.size());
+    header.m_parameter_count = static_cast<std::uint32_t>(parameter_records.size());
+    header.m_string_bytes = static_cast<std::uint32_t>(strings.size());
+
+    std::string out;
+    out.reserve(sizeof(EditFileHeader) + operation_records.size() * sizeof(EditOperationRecord)
+                + parameter_records.size() * sizeof(EditParameterRecord) + strings.size());
+    appendRecord(out, header);
+    for (const auto& record : operation_records) {
+        appendRecord(out, record);
+    }
+    for (const auto& record : parameter_records) {
+        appendRecord(out, record);
+    }
+    out.append(strings);
+    return out;
+}
+
+std::expected<std::vector<Operations::OperationDescriptor>, ErrorHandling::CoreError>
+decodeEditStack(std::span<const std::byte> bytes)
+{
+    if (bytes.size() < sizeof(EditFileHeader)) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    const auto header { readRecord<EditFileHeader>(bytes.data()) };
+    if (header.m_magic != EditFileHeader::k_magic || header.m_version != k_edit_format_version) {
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    // Sizes in 64 bits: the counts of a corrupt header cannot overflow
+    const std::uint64_t operations_offset { sizeof(EditFileHeader) };
+    const std::uint64_t parameters_offset { operations_offset + std::uint64_t{header.m_operation_count} * sizeof(EditOperationRecord) };
+    const std::uint64_t strings_offset { parameters_offset + std::uint64_t{header.m_parameter_count} * sizeof(EditParameterRecord) };
+    if (strings_offset + header.m_string_bytes != bytes.size()) {
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    const auto* strings { reinterpret_cast<const char*>(bytes.data() + strings_offset) };
+    const auto string_at = [&](std::uint32_t offset, std::uint32_t size) -> std::optional<std::string_view> {
+        if (std::uint64_t{offset} + size > header.m_string_bytes) {
+            return std::nullopt;
+        }
+        return std::string_view(strings + offset, size);
+    };
+
+    std::vector<Operations::OperationDescriptor> operations;
+    operations.reserve(header.m_operation_count);
+
+    for (std::uint32_t i = 0; i < header.m_operation_count; ++i) {
+        const auto record { readRecord<EditOperationRecord>(bytes.data() + operations_offset + i * sizeof(EditOperationRecord)) };
+        const auto name { string_at(record.m_name_offset, record.m_name_size) };
+        if (!name || std::uint64_t{record.m_first_parameter} + record.m_parameter_count > header.m_parameter_count) {
+            return std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+
+        auto type { magic_enum::enum_cast<Operations::OperationType>(record.m_type) };
+        if (!type && Operations::OperationPluginRegistry::contains(static_cast<Operations::OperationType>(record.m_type))) {
+            type = static_cast<Operations::OperationType>(record.m_type);
+        }
+        if (!type) {
+            // A type of a newer version or of a plugin not loaded: skipped, like an unknown type in a sidecar
+            spdlog::warn("[decodeEditStack]: Unknown operation type {} ('{}'). Skipping operation.", record.m_type, *name);
+            continue;
+        }
+
+        Operations::OperationDescriptor operation;
+        operation.id = record.m_id;
+        operation.type = *type;
+        operation.name = std::string(*name);
+        operation.enabled = record.m_enabled != 0;
+
+        for (std::uint32_t p = record.m_first_parameter; p < record.m_first_parameter + record.m_parameter_count; ++p) {
+            const auto parameter { readRecord<EditParameterRecord>(bytes.data() + parameters_offset + p * sizeof(EditParameterRecord)) };
+            if (parameter.m_key >= Operations::ParameterKeys::k_count) {
+                // A key of a newer version: the others still apply
+                spdlog::warn("[decodeEditStack]: Unknown parameter key {} for operation '{}'. Ignored.", parameter.m_key, operation.name);
+                continue;
+            }
+
+            const auto key { static_cast<Operations::ParameterKey>(parameter.m_key) };
+            switch (parameter.m_kind) {
+            case EditValueKind::Float:
+                operation.params.set(key, std::bit_cast<float>(parameter.m_value));
+                break;
+            case EditValueKind::Int:
+                operation.params.set(key, static_cast<int>(parameter.m_value));
+                break;
+            case EditValueKind::Bool:
+                operation.params.set(key, parameter.m_value != 0);
+                break;
+            case EditValueKind::String: {
+                const auto text { string_at(parameter.m_string_offset, parameter.m_value) };
+                if (!text) {
+                    return std::unexpected(ErrorHandling::CoreError::DecodingError);
+                }
+                operation.params.set(key, std::string(*text));
+                break;
+            }
+            default:
+                return std::unexpected(ErrorHandling::CoreError::DecodingError);
+            }
+        }
+
+        operations.push_back(std::move(operation));
+    }
+
+    return operations;
+}
+
+} // namespace CaptureMoment::Core::Serializer
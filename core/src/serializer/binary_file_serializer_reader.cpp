@@ -0,0 +1,59 @@
+/**
+ * @file binary_file_serializer_reader.cpp
+ * @brief Implementation of BinaryFileSerializerReader
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/binary_file_serializer_reader.h"
+#include "serializer/binary_edit_format.h"
+#include "common/memory/mapped_file.h"
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace CaptureMoment::Core::Serializer {
+
+BinaryFileSerializerReader::BinaryFileSerializerReader(
+    std::unique_ptr<IXmpPathStrategy> path_strategy,
+    std::unique_ptr<IFileSerializerReader> xmp_reader)
+    : m_path_strategy(std::move(path_strategy))
+    , m_xmp_reader(std::move(xmp_reader))
+{
+    if (!m_path_strategy) {
+        spdlog::error("BinaryFileSerializerReader: Constructor received a null IXmpPathStrategy.");
+        throw std::invalid_argument("BinaryFileSerializerReader: IXmpPathStrategy cannot be null.");
+    }
+    spdlog::debug("BinaryFileSerializerReader: Constructed ({}).", m_xmp_reader ? "with XMP fallback" : "binary only");
+}
+
+std::vector<Operations::OperationDescriptor> BinaryFileSerializerReader::loadFromFile(std::string_view source_image_path) const
+{
+    CM_TRACE_SCOPE("xmp", "BinaryFileSerializerReader::loadFromFile");
+
+    if (source_image_path.empty()) {
+        spdlog::error("BinaryFileSerializerReader::loadFromFile: Source image path is empty.");
+        return {};
+    }
+
+    const std::string edit_path { editFilePathForImage(*m_path_strategy, source_image_path) };
+    if (auto mapped = Common::MappedFile::open(edit_path)) {
+        auto operations { decodeEditStack(mapped->bytes()) };
+        if (operations) {
+            spdlog::debug("BinaryFileSerializerReader::loadFromFile: Loaded {} operations from '{}'.", operations->size(), edit_path);
+            return std::move(*operations);
+        }
+        spdlog::warn("BinaryFileSerializerReader::loadFromFile: '{}' is not a valid edit file (error {}).", edit_path, static_cast<int>(operations.error()));
+    }
+
+    // No binary file (or an unreadable one): the interchange sidecar
+    if (m_xmp_reader) {
+        return m_xmp_reader->loadFromFile(source_image_path);
+    }
+    return {};
+}
+
+} // namespace CaptureMoment::Core::Serializer
@@ -0,0 +1,88 @@
+/**
+ * @file binary_file_serializer_writer.cpp
+ * @brief Implementation of BinaryFileSerializerWriter
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/binary_file_serializer_writer.h"
+#include "serializer/binary_edit_format.h"
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace CaptureMoment::Core::Serializer {
+
+BinaryFileSerializerWriter::BinaryFileSerializerWriter(
+    std::unique_ptr<IXmpPathStrategy> path_strategy,
+    std::unique_ptr<IFileSerializerWriter> xmp_writer,
+    std::chrono::milliseconds xmp_delay)
+    : m_path_strategy(std::move(path_strategy))
+    , m_xmp_writer(std::move(xmp_writer))
+{
+    if (!m_path_strategy) {
+        spdlog::error("BinaryFileSerializerWriter: Constructor received a null IXmpPathStrategy.");
+        throw std::invalid_argument("BinaryFileSerializerWriter: IXmpPathStrategy cannot be null.");
+    }
+
+    if (m_xmp_writer) {
+        m_xmp_autosaver = std::make_unique<XmpAutosaver>(*m_xmp_writer, xmp_delay);
+    }
+    spdlog::debug("BinaryFileSerializerWriter: Constructed ({}).", m_xmp_writer ? "with XMP sidecar" : "binary only");
+}
+
+BinaryFileSerializerWriter::~BinaryFileSerializerWriter()
+{
+    m_xmp_autosaver.reset();
+}
+
+bool BinaryFileSerializerWriter::saveToFile(std::string_view source_image_path, std::span<const Operations::OperationDescriptor> operations) const
+{
+    CM_TRACE_SCOPE("xmp", "BinaryFileSerializerWriter::saveToFile");
+
+    if (source_image_path.empty()) {
+        spdlog::error("BinaryFileSerializerWriter::saveToFile: Source image path is empty.");
+        return false;
+    }
+
+    const std::filesystem::path edit_path { editFilePathForImage(*m_path_strategy, source_image_path) };
+    const std::string encoded { encodeEditStack(operations) };
+
+    // Written aside, then renamed: a reader never maps a partial file
+    std::filesystem::path partial { edit_path };
+    partial += ".tmp";
+    std::error_code ec;
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+        if (!out.flush()) {
+            spdlog::error("BinaryFileSerializerWriter::saveToFile: Failed to write '{}'.", partial.string());
+            out.close();
+            std::filesystem::remove(partial, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(partial, edit_path, ec);
+    if (ec) {
+        spdlog::error("BinaryFileSerializerWriter::saveToFile: Failed to install '{}': {}", edit_path.string(), ec.message());
+        std::filesystem::remove(partial, ec);
+        return false;
+    }
+
+    spdlog::debug("BinaryFileSerializerWriter::saveToFile: Saved {} operations ({} bytes) to '{}'.", operations.size(), encoded.size(), edit_path.string());
+
+    // The interchange sidecar follows once the edits settle
+    if (m_xmp_autosaver) {
+        m_xmp_autosaver->scheduleSave(source_image_path, { operations.begin(), operations.end() });
+    }
+    return true;
+}
+
+} // namespace CaptureMoment::Core::Serializer
@@ -7,8 +7,16 @@
  */
 
 #include "serializer/file_serializer_manager.h"
+#include "serializer/provider/exiv2_initializer.h"
+#include "workers/engine_scheduler.h"
+#include "common/trace/tracer.h"
+
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace CaptureMoment::Core::Serializer {
 
 FileSerializerManager::FileSerializerManager(
@@ -73,4 +81,52 @@ std::vector<Operations::OperationDescriptor> FileSerializerManager::loadFromFile
     return operations;
 }
 
+std::size_t FileSerializerManager::loadFromFiles(std::span<const std::string> source_image_paths, const BatchCallback& on_loaded,
+                                                std::size_t thread_count) const
+{
+    CM_TRACE_SCOPE("xmp", "FileSerializerManager::loadFromFiles");
+
+    if (source_image_paths.empty()) {
+        return 0;
+    }
+
+    // Once for the batch, not on every file
+    Exiv2Initializer::initialize();
+
+    const std::size_t worker_count { std::clamp<std::size_t>(thread_count, 1, source_image_paths.size()) };
+    spdlog::info("FileSerializerManager::loadFromFiles: Loading operations for {} files on {} threads.", source_image_paths.size(), worker_count);
+
+    std::atomic<std::size_t> next_index {0};
+    std::atomic<std::size_t> loaded_count {0};
+    std::mutex callback_mutex;
+
+    {
+        // The first scheduler thread only serves the interactive lane: one more for the batch
+        Workers::EngineScheduler pool(worker_count + 1);
+
+        // Each worker pulls the next file until none are left
+        for (std::size_t worker {0}; worker < worker_count; ++worker) {
+            pool.post(Workers::TaskPriority::Thumbnail, [&]() {
+                for (std::size_t index { next_index.fetch_add(1, std::memory_order_relaxed) };
+                     index < source_image_paths.size();
+                     index = next_index.fetch_add(1, std::memory_order_relaxed)) {
+                    std::vector<Operations::OperationDescriptor> operations { m_reader->loadFromFile(source_image_paths[index]) };
+                    if (!operations.empty()) {
+                        loaded_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    if (on_loaded) {
+                        std::lock_guard lock(callback_mutex);
+                        on_loaded(index, std::move(operations));
+                    }
+                }
+            });
+        }
+        // Leaving the scope runs the queued workers to completion and joins the pool
+    }
+
+    spdlog::info("FileSerializerManager::loadFromFiles: {} of {} files had operations.", loaded_count.load(), source_image_paths.size());
+    return loaded_count.load();
+}
+
 } // namespace CaptureMoment::Core::Serializer
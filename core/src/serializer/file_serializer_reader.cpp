@@ -8,16 +8,72 @@
 #include "serializer/file_serializer_reader.h"
 #include "serializer/provider/exiv2_initializer.h"
 #include "serializer/operation_serialization.h"
+#include "common/trace/tracer.h"
+#include "operations/plugins/operation_plugin_registry.h"
 
 #include <spdlog/spdlog.h>
 #include <exiv2/exiv2.hpp>
+#include <charconv>
+#include <map>
+#include <optional>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <variant>
-#include <magic_enum/magic_enum.hpp>
-#include <unordered_map>
 
 namespace CaptureMoment::Core::Serializer {
 
+namespace {
+
+constexpr std::string_view k_operation_key_prefix { "Xmp.cm.operation[" };
+constexpr std::string_view k_param_field_prefix { "param." };
+
+/**
+ * @brief Fields of one "Xmp.cm.operation[<index>]" entry, as read from the packet.
+ */
+struct RawOperation {
+    std::optional<std::string> m_type;
+    std::optional<std::string> m_name;
+    std::optional<std::string> m_enabled;
+    /** @brief Parameter name and serialized value, in packet order. */
+    std::vector<std::pair<std::string, std::string>> m_params;
+};
+
+/**
+ * @brief Index and field name of an operation key.
+ */
+struct OperationField {
+    std::size_t m_index;
+    /** @brief The part after "]." (e.g. "type", "param.exposure"); views the key. */
+    std::string_view m_name;
+};
+
+/**
+ * @brief Splits "Xmp.cm.operation[<index>].<field>", or nullopt for other keys.
+ */
+[[nodiscard]] std::optional<OperationField> parseOperationKey(std::string_view key)
+{
+    if (!key.starts_with(k_operation_key_prefix)) {
+        return std::nullopt;
+    }
+    key.remove_prefix(k_operation_key_prefix.size());
+
+    std::size_t index {0};
+    const auto [end, error] = std::from_chars(key.data(), key.data() + key.size(), index);
+    if (error != std::errc {}) {
+        return std::nullopt;
+    }
+
+    key.remove_prefix(static_cast<std::size_t>(end - key.data()));
+    if (!key.starts_with("].")) {
+        return std::nullopt;
+    }
+    key.remove_prefix(2);
+    return OperationField { index, key };
+}
+
+} // anonymous namespace
+
 FileSerializerReader::FileSerializerReader(
     std::unique_ptr<IXmpProvider> xmp_provider,
     std::unique_ptr<IXmpPathStrategy> xmp_path_strategy)
@@ -33,6 +89,8 @@ FileSerializerReader::FileSerializerReader(
 
 std::vector<Operations::OperationDescriptor> FileSerializerReader::loadFromFile(std::string_view source_image_path) const
 {
+    CM_TRACE_SCOPE("xmp", "FileSerializerReader::loadFromFile");
+
     if (source_image_path.empty()) {
         spdlog::error("FileSerializerReader::loadFromFile: Source image path is empty.");
         return {}; // Return an empty vector
@@ -90,55 +148,58 @@ std::vector<Operations::OperationDescriptor> FileSerializerReader::parseXmpPacke
         source_image_path_from_xmp = xmp_data["Xmp.cm.sourceImagePath"].toString(); // Returns an empty string if the key does not exist
         spdlog::debug("FileSerializerReader::parseXmpPacket: Found source image path in XMP: '{}'", source_image_path_from_xmp);
 
-        std::vector<Operations::OperationDescriptor> operations;
-        // Iterate through potential operations in the XMP data
-        // This assumes operations are stored in an array-like structure Xmp.cm.operation[1], Xmp.cm.operation[2], etc.
-        size_t index {1};
-        while (true) {
-            std::string index_str { std::to_string(index) };
-            std::string type_key_str { "Xmp.cm.operation[" + index_str + "].type"};
-            std::string name_key_str { "Xmp.cm.operation[" + index_str + "].name"};
-            std::string enabled_key_str { "Xmp.cm.operation[" + index_str + "].enabled"};
-
-            // Create Exiv2::XmpKey objects
-            Exiv2::XmpKey type_key(type_key_str);
-            Exiv2::XmpKey name_key(name_key_str);
-            Exiv2::XmpKey enabled_key(enabled_key_str);
-
-            // Use the XmpKey objects with findKey
-            auto type_kv { xmp_data.findKey(type_key) };
-            auto name_kv { xmp_data.findKey(name_key) };
-            auto enabled_kv { xmp_data.findKey(enabled_key) };
-
-            if (type_kv == xmp_data.end()) {
-                // No more operations found with this index
-                break;
+        // Single pass over the keys: bucket the fields of each "Xmp.cm.operation[<index>]"
+        std::map<std::size_t, RawOperation> raw_operations;
+        for (const auto& kv : xmp_data) {
+            const std::string key { kv.key() };
+            const auto field { parseOperationKey(key) };
+            if (!field) {
+                continue;
             }
 
+            RawOperation& raw { raw_operations[field->m_index] };
+            if (field->m_name == "type") {
+                raw.m_type = kv.toString();
+            } else if (field->m_name == "name") {
+                raw.m_name = kv.toString();
+            } else if (field->m_name == "enabled") {
+                raw.m_enabled = kv.toString();
+            } else if (field->m_name.starts_with(k_param_field_prefix)) {
+                raw.m_params.emplace_back(field->m_name.substr(k_param_field_prefix.size()), kv.toString());
+            }
+        }
+
+        std::vector<Operations::OperationDescriptor> operations;
+        operations.reserve(raw_operations.size());
+
+        // Operations are numbered from 1: the first index without a type ends the list
+        std::size_t index {1};
+        for (auto it { raw_operations.find(index) }; it != raw_operations.end() && it->second.m_type;
+             it = raw_operations.find(++index)) {
+            RawOperation& raw { it->second };
             Operations::OperationDescriptor op_desc;
 
-            // Read Type (using magic_enum)
-            std::string type_str { type_kv->toString() };
-            auto type_opt = magic_enum::enum_cast<Operations::OperationType>(type_str);
+            // Read Type (a built-in enumerator, or the name of a loaded plugin operation)
+            const std::string& type_str { *raw.m_type };
+            auto type_opt = Operations::OperationPluginRegistry::findType(type_str);
             if (!type_opt.has_value()) {
                 spdlog::warn("FileSerializerReader::parseXmpPacket: Unknown OperationType '{}' found for operation index {}. Skipping operation.", type_str, index);
-                index++;
                 continue; // Move to the next operation
             }
             op_desc.type = type_opt.value();
 
             // Read Name
-            if (name_kv != xmp_data.end()) {
-                op_desc.name = name_kv->toString();
+            if (raw.m_name) {
+                op_desc.name = std::move(*raw.m_name);
             } else {
                 // Generate a default name if not found ?
                 op_desc.name = type_str + " (from XMP)";
             }
 
             // Read Enabled flag
-            if (enabled_kv != xmp_data.end())
+            if (raw.m_enabled)
             {
-                std::string enabled_str { enabled_kv->toString() };
+                const std::string& enabled_str { *raw.m_enabled };
                 // Handle various boolean representations
                 if (enabled_str == "true" || enabled_str == "True" || enabled_str == "TRUE" || enabled_str == "1") {
                     op_desc.enabled = true;
@@ -152,29 +213,25 @@ std::vector<Operations::OperationDescriptor> FileSerializerReader::parseXmpPacke
                 op_desc.enabled = true; // Default value
             }
 
-            // Read Parameters
-            // Iterate through keys that start with "Xmp.cm.operation[<index>].param."
-            std::string param_prefix { "Xmp.cm.operation[" + index_str + "].param." };
-            for (const auto& kv : xmp_data) {
-                std::string key = kv.key();
-                if (key.starts_with(param_prefix))
-                {
-                    std::string param_name { key.substr(param_prefix.length()) };
-                    std::string param_value_str { kv.toString() };
-
-                    // Deserialize the value using the robust typed approach via OperationSerialization
-                    auto parsed_value = Serializer::deserializeParameter(param_value_str);
-
-                    // Store the value directly. No need to check has_value() as variant always holds a value.
-                    op_desc.params[param_name] = parsed_value;
-
-                    spdlog::debug("FileSerializerReader::parseXmpPacket: Parsed parameter '{}' for operation '{}'.", param_name, op_desc.name);
+            // Read Parameters ("Xmp.cm.operation[<index>].param.<name>")
+            for (const auto& [param_name, param_value_str] : raw.m_params) {
+                // Deserialize the value using the robust typed approach via OperationSerialization
+                auto parsed_value = Serializer::deserializeParameter(param_value_str);
+
+                // Intern the name, the value is stored with the key's type. No need to check
+                // has_value() as variant always holds a value.
+                auto param_key = Operations::ParameterKeys::find(param_name);
+                if (!param_key) {
+                    spdlog::warn("FileSerializerReader::parseXmpPacket: Unknown parameter '{}' for operation '{}'. Ignored.", param_name, op_desc.name);
+                    continue;
                 }
+                op_desc.params.set(*param_key, std::move(parsed_value));
+
+                spdlog::debug("FileSerializerReader::parseXmpPacket: Parsed parameter '{}' for operation '{}'.", param_name, op_desc.name);
             }
 
-            operations.push_back(op_desc);
-            spdlog::debug("FileSerializerReader::parseXmpPacket: Parsed operation index {}: type={}, name={}, enabled={}", index, magic_enum::enum_name(op_desc.type), op_desc.name, op_desc.enabled);
-            index++;
+            spdlog::debug("FileSerializerReader::parseXmpPacket: Parsed operation index {}: type={}, name={}, enabled={}", index, Operations::OperationPluginRegistry::typeName(op_desc.type), op_desc.name, op_desc.enabled);
+            operations.push_back(std::move(op_desc));
         }
 
         spdlog::debug("FileSerializerReader::parseXmpPacket: Successfully parsed {} operations from XMP packet.", operations.size());
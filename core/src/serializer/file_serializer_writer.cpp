@@ -8,11 +8,17 @@
 #include "serializer/file_serializer_writer.h"
 #include "serializer/provider/exiv2_initializer.h"
 #include "serializer/operation_serialization.h"
+#include "serializer/xmp_autosaver.h"
+#include "common/trace/tracer.h"
+#include "operations/plugins/operation_plugin_registry.h"
 
 #include <spdlog/spdlog.h>
 #include <exiv2/exiv2.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
 #include <stdexcept>
-#include <magic_enum/magic_enum.hpp>
 
 namespace CaptureMoment::Core::Serializer {
 
@@ -31,13 +37,15 @@ FileSerializerWriter::FileSerializerWriter(
 
 bool FileSerializerWriter::saveToFile(std::string_view source_image_path, std::span<const Operations::OperationDescriptor> operations) const
 {
+    CM_TRACE_SCOPE("xmp", "FileSerializerWriter::saveToFile");
+
     if (source_image_path.empty()) {
         spdlog::error("FileSerializerWriter::saveToFile: Source image path is empty.");
         return false;
     }
     spdlog::debug("FileSerializerWriter::saveToFile: Attempting to save {} operations for image: {}", operations.size(), source_image_path);
 
-    // Ensure Exiv2 is initialized before any operations
+    // Ensure Exiv2 is initialized before any operations (once: registers the cm namespace)
     Exiv2Initializer::initialize();
 
     // Step 0: Determine the XMP file path using the injected strategy
@@ -69,46 +77,34 @@ std::string FileSerializerWriter::serializeOperationsToXmp(
 {
     spdlog::debug("FileSerializerWriter::serializeOperationsToXmp: Serializing {} operations for image: {}", operations.size(), source_image_path);
 
-    // XMP Namespace configuration for "CaptureMoment" (cm)
-    const std::string ns_uri { "https://github.com/YacinoBen/CaptureMoment/" };
-    const std::string ns_prefix { "cm" };
-
-    // Register the namespace for Exiv2 to recognize "Xmp.cm.*" keys correctly
-    // Note: This is generally safe to call multiple times or ensure it's called once globally.
-    Exiv2::XmpProperties::registerNs(ns_uri, ns_prefix);
+    const std::uint64_t edit_hash { XmpAutosaver::editHash(operations) };
+
+    std::shared_ptr<const Exiv2::XmpData> properties;
+    {
+        std::lock_guard lock(m_packet_cache_mutex);
+        const auto it { std::ranges::find(m_packet_cache, edit_hash, &PacketCacheEntry::m_edit_hash) };
+        if (it != m_packet_cache.end()) {
+            m_packet_cache.splice(m_packet_cache.begin(), m_packet_cache, it);
+            if (it->m_source_image_path == source_image_path) {
+                spdlog::debug("FileSerializerWriter::serializeOperationsToXmp: Reusing the encoded packet (size {}).", it->m_packet.size());
+                return it->m_packet;
+            }
+            properties = it->m_properties;
+        }
+    }
 
-    Exiv2::XmpData xmp_data;
+    if (!properties) {
+        properties = buildOperationProperties(operations);
+        if (!properties) {
+            return {};
+        }
+    }
 
     try {
-        // Add metadata about the serialization itself
-        xmp_data["Xmp.cm.serializedBy"] = "CaptureMoment";
-        xmp_data["Xmp.cm.version"] = "1.0";
-        // Include the source image path as a metadata field within the XMP
+        // Same edits, another image: only the path differs
+        Exiv2::XmpData xmp_data { *properties };
         xmp_data["Xmp.cm.sourceImagePath"] = std::string(source_image_path);
 
-        // Iterate through operations with index (1-based for readability in XMP)
-        for (size_t i = 0; i < operations.size(); ++i) {
-            const auto& op = operations[i];
-            std::string index_str { std::to_string(i + 1) };
-
-            // Use magic_enum to get the string name of the enum (must match Reader's enum_cast)
-            std::string_view type_name_view { magic_enum::enum_name(op.type) };
-            xmp_data["Xmp.cm.operation[" + index_str + "].type"] = std::string(type_name_view);
-            xmp_data["Xmp.cm.operation[" + index_str + "].name"] = op.name;
-            xmp_data["Xmp.cm.operation[" + index_str + "].enabled"] = op.enabled;
-
-            // Iterate through the parameters map
-            for (const auto& [param_name, param_value] : op.params)
-            {
-                // Serialize the value (variant) to string using the service
-                // No need to check .has_value() as variant always holds a value
-                std::string serialized_param_value { Serializer::serializeParameter(param_value) };
-
-                std::string xmp_param_key { "Xmp.cm.operation[" + index_str + "].param." + param_name };
-                xmp_data[xmp_param_key] = serialized_param_value;
-            }
-        }
-
         // Serialize the XMP data container to a packet string
         std::string xmp_packet;
         if (Exiv2::XmpParser::encode(xmp_packet, xmp_data) != 0) {
@@ -117,6 +113,13 @@ std::string FileSerializerWriter::serializeOperationsToXmp(
         }
 
         spdlog::debug("FileSerializerWriter::serializeOperationsToXmp: Successfully serialized to XMP packet (size {}).", xmp_packet.size());
+
+        std::lock_guard lock(m_packet_cache_mutex);
+        std::erase_if(m_packet_cache, [edit_hash](const PacketCacheEntry& entry) { return entry.m_edit_hash == edit_hash; });
+        m_packet_cache.push_front({ edit_hash, std::move(properties), std::string(source_image_path), xmp_packet });
+        if (m_packet_cache.size() > k_packet_cache_entries) {
+            m_packet_cache.pop_back();
+        }
         return xmp_packet;
 
     } catch (const Exiv2::Error& e) {
@@ -128,4 +131,64 @@ std::string FileSerializerWriter::serializeOperationsToXmp(
     }
 }
 
+std::shared_ptr<const Exiv2::XmpData> FileSerializerWriter::buildOperationProperties(
+    std::span<const Operations::OperationDescriptor> operations)
+{
+    auto xmp_data { std::make_shared<Exiv2::XmpData>() };
+
+    try {
+        // Add metadata about the serialization itself
+        (*xmp_data)["Xmp.cm.serializedBy"] = "CaptureMoment";
+        (*xmp_data)["Xmp.cm.version"] = "1.0";
+        // Set per image by serializeOperationsToXmp; added here to keep its place in the packet
+        (*xmp_data)["Xmp.cm.sourceImagePath"] = std::string();
+
+        // Reused across every property: "Xmp.cm.operation[<i>]." then the field
+        std::string key;
+        std::string value;
+
+        // Iterate through operations with index (1-based for readability in XMP)
+        for (size_t i = 0; i < operations.size(); ++i) {
+            const auto& op = operations[i];
+
+            char index[24];
+            const auto [index_end, ec] = std::to_chars(std::begin(index), std::end(index), i + 1);
+            key.assign("Xmp.cm.operation[");
+            key.append(index, index_end);
+            key.append("].");
+            const std::size_t prefix_size { key.size() };
+
+            // The enumerator of a built-in type, the qualified name of a plugin one (must match the Reader's findType)
+            key.append("type");
+            (*xmp_data)[key] = std::string(Operations::OperationPluginRegistry::typeName(op.type));
+            key.resize(prefix_size);
+            key.append("name");
+            (*xmp_data)[key] = op.name;
+            key.resize(prefix_size);
+            key.append("enabled");
+            (*xmp_data)[key] = op.enabled;
+
+            // Iterate through the set parameters, by key name
+            op.params.forEach([&xmp_data, &key, &value, prefix_size](Operations::ParameterKey param_key,
+                                                                     const Operations::OperationValue& param_value) {
+                key.resize(prefix_size);
+                key.append("param.");
+                key.append(Operations::ParameterKeys::name(param_key));
+
+                value.clear();
+                Serializer::appendParameter(value, param_value);
+                (*xmp_data)[key] = value;
+            });
+        }
+        return xmp_data;
+
+    } catch (const Exiv2::Error& e) {
+        spdlog::error("FileSerializerWriter::buildOperationProperties: Exiv2 error during serialization: {}", e.what());
+        return nullptr;
+    } catch (const std::exception& e) {
+        spdlog::error("FileSerializerWriter::buildOperationProperties: General error during serialization: {}", e.what());
+        return nullptr;
+    }
+}
+
 } // namespace CaptureMoment::Core::Serializer
@@ -10,35 +10,50 @@
 #include "operations/operation_descriptor.h"
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cmath>
 #include <cstdlib>
+#include <iterator>
 #include <spdlog/spdlog.h>
 
 namespace CaptureMoment::Core::Serializer {
 
-std::string serializeParameter(const Operations::OperationValue& value)
+void appendParameter(std::string& out, const Operations::OperationValue& value)
 {
-    // Use std::visit to handle each type in the variant
-    return std::visit([](auto&& arg) -> std::string {
+    std::visit([&out](const auto& arg) {
         using T = std::decay_t<decltype(arg)>;
 
         if constexpr (std::is_same_v<T, bool>) {
-            return arg ? "true" : "false";
+            out.append(arg ? "true" : "false");
         }
         else if constexpr (std::is_same_v<T, int>) {
-            return std::to_string(arg);
+            char buffer[16];
+            const auto [end, ec] = std::to_chars(std::begin(buffer), std::end(buffer), arg);
+            out.append(buffer, end);
         }
         else if constexpr (std::is_same_v<T, float>) {
-            return std::to_string(arg);
+            // Shortest form that parses back to the same float; longest is "-1.17549435e-38"
+            char buffer[32];
+            const auto [end, ec] = std::to_chars(std::begin(buffer), std::end(buffer), arg);
+            out.append(buffer, end);
+            // "1" would read back as an int (and "0" as a bool): keep a decimal point
+            if (std::isfinite(arg) && std::find_if(buffer, end, [](char c) { return c == '.' || c == 'e'; }) == end) {
+                out.append(".0");
+            }
         }
         else if constexpr (std::is_same_v<T, std::string>) {
-            return arg;
-        }
-        else {
-            return ""; // Should not happen if all variant types are handled
+            out.append(arg);
         }
     }, value);
 }
 
+std::string serializeParameter(const Operations::OperationValue& value)
+{
+    std::string result;
+    appendParameter(result, value);
+    return result;
+}
+
 Operations::OperationValue deserializeParameter(std::string_view value_str)
 {
     // 1. Check for Boolean (Case-insensitive)
@@ -74,12 +89,14 @@ std::string serializeOperationParameters(const Operations::OperationDescriptor&
 {
     // Simple format: "param1=value1;param2=value2"
     std::string result;
-    for (const auto& [key, val] : descriptor.params) {
+    descriptor.params.forEach([&result](Operations::ParameterKey key, const Operations::OperationValue& val) {
         if (!result.empty()) {
             result += ";";
         }
-        result += key + "=" + serializeParameter(val);
-    }
+        result.append(Operations::ParameterKeys::name(key));
+        result.push_back('=');
+        appendParameter(result, val);
+    });
     return result;
 }
 
@@ -98,10 +115,14 @@ bool deserializeOperationParameters(std::string_view params_str, Operations::Ope
 
         size_t eq_pos = pair.find('=');
         if (eq_pos != std::string_view::npos) {
-            std::string key(pair.substr(0, eq_pos));
+            std::string_view name(pair.substr(0, eq_pos));
             std::string_view val_view(pair.substr(eq_pos + 1));
 
-            descriptor.params[key] = deserializeParameter(val_view);
+            if (auto key = Operations::ParameterKeys::find(name)) {
+                descriptor.params.set(*key, deserializeParameter(val_view));
+            } else {
+                spdlog::warn("[deserializeOperationParameters]: Unknown parameter '{}'. Ignored.", name);
+            }
         }
 
         if (end == std::string_view::npos) break;
@@ -13,17 +13,30 @@ namespace CaptureMoment::Core::Serializer {
 
 // Static member definition
 std::once_flag Exiv2Initializer::m_init_flag;
+std::recursive_mutex Exiv2Initializer::m_xmp_mutex;
 
 void Exiv2Initializer::initialize()
 {
     std::call_once(m_init_flag, [](){
         spdlog::debug("Exiv2Initializer: Initializing Exiv2 XMP Parser...");
-        Exiv2::XmpParser::initialize();
+        Exiv2::XmpParser::initialize(&Exiv2Initializer::lockUnlock, &m_xmp_mutex);
+        // "Xmp.cm.*" keys of the CaptureMoment sidecars
+        Exiv2::XmpProperties::registerNs(k_namespace_uri, k_namespace_prefix);
         ::atexit(Exiv2Initializer::terminate); // Register termination function
         spdlog::info("Exiv2Initializer: Exiv2 XMP Parser initialized.");
     });
 }
 
+void Exiv2Initializer::lockUnlock(void* lock_data, bool lock)
+{
+    auto* mutex { static_cast<std::recursive_mutex*>(lock_data) };
+    if (lock) {
+        mutex->lock();
+    } else {
+        mutex->unlock();
+    }
+}
+
 void Exiv2Initializer::terminate()
 {
     spdlog::debug("Exiv2Initializer: Terminating Exiv2 XMP Parser...");
@@ -10,7 +10,9 @@
 #include "serializer/provider/exiv2_initializer.h"
 #include <spdlog/spdlog.h>
 #include <exiv2/exiv2.hpp>
+#include <filesystem>
 #include <string>
+#include <system_error>
 
 namespace CaptureMoment::Core::Serializer {
 
@@ -74,11 +76,24 @@ bool Exiv2Provider::writeXmp(std::string_view file_path, std::string_view xmp_da
     // Ensure Exiv2 is initialized
     Exiv2Initializer::initialize();
 
+    // Write into a copy and swap it in: a crash or a full disk never leaves a truncated file
+    const std::filesystem::path target { file_path };
+    std::filesystem::path temp { target };
+    temp += ".tmp";
+    std::error_code ignored;
+
     try {
-        // Open the image file for writing
-        Exiv2::Image::UniquePtr image = Exiv2::ImageFactory::open(file_path.data());
+        // Open the copy for writing (a missing sidecar starts as an empty XMP file)
+        Exiv2::Image::UniquePtr image;
+        if (std::filesystem::exists(target)) {
+            std::filesystem::copy_file(target, temp, std::filesystem::copy_options::overwrite_existing);
+            image = Exiv2::ImageFactory::open(temp.string());
+        } else if (target.extension() == ".xmp") {
+            image = Exiv2::ImageFactory::create(Exiv2::ImageType::xmp, temp.string());
+        }
         if (!image) {
             spdlog::error("Exiv2Provider::writeXmp: Failed to open image file with Exiv2 for writing: {}", file_path);
+            std::filesystem::remove(temp, ignored);
             return false;
         }
 
@@ -89,8 +104,10 @@ bool Exiv2Provider::writeXmp(std::string_view file_path, std::string_view xmp_da
 
         // If we have new XMP data, decode it into the container
         if (!xmp_data.empty()) {
-            if (Exiv2::XmpParser::decode(xmp_container, xmp_data.data()) != 0) {
+            if (Exiv2::XmpParser::decode(xmp_container, std::string(xmp_data)) != 0) {
                 spdlog::error("Exiv2Provider::writeXmp: Failed to decode provided XMP packet for file: {}", file_path);
+                image.reset();
+                std::filesystem::remove(temp, ignored);
                 return false;
             }
         } else {
@@ -100,18 +117,21 @@ bool Exiv2Provider::writeXmp(std::string_view file_path, std::string_view xmp_da
         // Set the XMP data (replaces any existing XMP)
         image->setXmpData(xmp_container);
 
-        // Write all metadata (Exif, Iptc, Xmp) back to the file
+        // Write all metadata (Exif, Iptc, Xmp) back to the copy, then replace the file with it
         image->writeMetadata();
+        image.reset();
+        std::filesystem::rename(temp, target);
 
         spdlog::info("Exiv2Provider::writeXmp: Successfully wrote XMP packet to file: {}", file_path);
         return true;
     } catch (const Exiv2::Error& e) {
         spdlog::error("Exiv2Provider::writeXmp: Exiv2 error writing XMP to file '{}': {}", file_path, e.what());
-        return false;
     } catch (const std::exception& e) {
         spdlog::error("Exiv2Provider::writeXmp: Standard exception writing XMP to file '{}': {}", file_path, e.what());
-        return false;
     }
+
+    std::filesystem::remove(temp, ignored);
+    return false;
 }
 
 } // namespace CaptureMoment::Core::Serializer
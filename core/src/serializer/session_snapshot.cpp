@@ -0,0 +1,298 @@
+/**
+ * @file session_snapshot.cpp
+ * @brief Implementation of SessionSnapshot.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/session_snapshot.h"
+#include "serializer/binary_edit_format.h"
+#include "utils/color_space_utils.h"
+
+#include <OpenImageIO/filesystem.h>
+#include <OpenImageIO/imagebuf.h>
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace CaptureMoment::Core::Serializer {
+
+namespace {
+
+/**
+ * @brief Converts between native and little-endian order (no-op on little-endian hosts).
+ */
+template<typename T>
+[[nodiscard]] constexpr T littleEndian(T value) noexcept
+{
+    if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::bit_cast<T>(std::byteswap(std::bit_cast<std::uint32_t>(value)));
+        } else {
+            return std::byteswap(value);
+        }
+    } else {
+        return value;
+    }
+}
+
+void swapToLittle(SessionFileHeader& header) noexcept
+{
+    header.m_version = littleEndian(header.m_version);
+    header.m_path_bytes = littleEndian(header.m_path_bytes);
+    header.m_source_width = littleEndian(header.m_source_width);
+    header.m_source_height = littleEndian(header.m_source_height);
+    header.m_zoom = littleEndian(header.m_zoom);
+    header.m_pan_x = littleEndian(header.m_pan_x);
+    header.m_pan_y = littleEndian(header.m_pan_y);
+    header.m_edit_bytes = littleEndian(header.m_edit_bytes);
+    header.m_preview_bytes = littleEndian(header.m_preview_bytes);
+}
+
+} // anonymous namespace
+
+std::filesystem::path SessionSnapshot::defaultPath()
+{
+    std::filesystem::path base;
+
+#if defined(_WIN32)
+    if (const char* local_app_data = std::getenv("LOCALAPPDATA")) {
+        base = local_app_data;
+    }
+#elif defined(__APPLE__)
+    if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / "Library" / "Caches";
+    }
+#else
+    if (const char* xdg_cache = std::getenv("XDG_CACHE_HOME"); xdg_cache && *xdg_cache) {
+        base = xdg_cache;
+    } else if (const char* home = std::getenv("HOME")) {
+        base = std::filesystem::path(home) / ".cache";
+    }
+#endif
+
+    if (base.empty()) {
+        std::error_code ec;
+        base = std::filesystem::temp_directory_path(ec);
+    }
+
+    return base / "CaptureMoment" / "session.cmsession";
+}
+
+std::expected<std::vector<std::byte>, ErrorHandling::CoreError> SessionSnapshot::encodePreview(Common::ImageRegion& image)
+{
+    if (!image.isValid() || image.m_channels != 4) {
+        spdlog::error("[SessionSnapshot::encodePreview]: Expected a valid RGBA image");
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+
+    const int width { static_cast<int>(image.m_width) };
+    const int height { static_cast<int>(image.m_height) };
+
+    OIIO::ImageSpec linear_spec(width, height, 4, OIIO::TypeDesc::FLOAT);
+    linear_spec.alpha_channel = 3;
+    linear_spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+    OIIO::ImageBuf pixels(linear_spec, image.m_data.data());
+    if (auto conversion = Utils::transformToColorSpace(pixels, "sRGB"); !conversion) {
+        return std::unexpected(conversion.error());
+    }
+
+    // JPEG into memory (RGB: the alpha is skipped through the pixel stride)
+    std::vector<unsigned char> encoded;
+    OIIO::Filesystem::IOVecOutput memory(encoded);
+
+    auto output { OIIO::ImageOutput::create("jpeg") };
+    if (!output) {
+        spdlog::error("[SessionSnapshot::encodePreview]: No JPEG writer: {}", OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    OIIO::ImageSpec jpeg_spec(width, height, 3, OIIO::TypeDesc::UINT8);
+    jpeg_spec.attribute("Compression", "jpeg:" + std::to_string(k_preview_quality));
+    jpeg_spec.attribute("oiio:ColorSpace", "sRGB");
+
+    output->set_ioproxy(&memory);
+    const auto pixel_stride { static_cast<OIIO::stride_t>(4 * sizeof(float)) };
+    if (!output->open("session.jpg", jpeg_spec)
+        || !output->write_image(OIIO::TypeDesc::FLOAT, image.m_data.data(), pixel_stride)
+        || !output->close()) {
+        spdlog::error("[SessionSnapshot::encodePreview]: JPEG encoding failed: {}", output->geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    std::vector<std::byte> bytes(encoded.size());
+    std::ranges::transform(encoded, bytes.begin(), [](unsigned char byte) { return std::byte{byte}; });
+    return bytes;
+}
+
+std::expected<Common::DisplayImage, ErrorHandling::CoreError> SessionSnapshot::decodePreview() const
+{
+    if (m_preview_jpeg.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::SourceNotLoaded);
+    }
+
+    OIIO::Filesystem::IOMemReader memory(m_preview_jpeg.data(), m_preview_jpeg.size());
+    auto input { OIIO::ImageInput::create("jpeg") };
+    if (!input) {
+        spdlog::error("[SessionSnapshot::decodePreview]: No JPEG reader: {}", OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    input->set_ioproxy(&memory);
+    OIIO::ImageSpec spec;
+    if (!input->open("session.jpg", spec) || spec.nchannels < 3 || spec.width <= 0 || spec.height <= 0) {
+        spdlog::error("[SessionSnapshot::decodePreview]: Cannot open the preview: {}", input->geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    Common::DisplayImage image;
+    image.m_width = static_cast<Common::ImageDim>(spec.width);
+    image.m_height = static_cast<Common::ImageDim>(spec.height);
+    // Opaque: the RGB channels are read into every fourth byte, the alpha stays
+    image.m_data.assign(image.bytesPerLine() * image.m_height, std::uint8_t { 255 });
+
+    const auto pixel_stride { static_cast<OIIO::stride_t>(Common::DisplayImage::k_channels) };
+    if (!input->read_image(0, 0, 0, 3, OIIO::TypeDesc::UINT8, image.m_data.data(), pixel_stride)) {
+        spdlog::error("[SessionSnapshot::decodePreview]: JPEG decoding failed: {}", input->geterror());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    input->close();
+    return image;
+}
+
+std::expected<void, ErrorHandling::CoreError> SessionSnapshot::save(const std::filesystem::path& path) const
+{
+    const std::string edits { encodeEditStack(m_operations) };
+
+    if (m_source_path.size() > std::numeric_limits<std::uint32_t>::max()
+        || edits.size() > std::numeric_limits<std::uint32_t>::max()) {
+        spdlog::error("[SessionSnapshot::save]: Session too large to save");
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    SessionFileHeader header;
+    header.m_path_bytes = static_cast<std::uint32_t>(m_source_path.size());
+    header.m_source_width = static_cast<std::uint32_t>(m_source_width);
+    header.m_source_height = static_cast<std::uint32_t>(m_source_height);
+    header.m_zoom = m_zoom;
+    header.m_pan_x = m_pan_x;
+    header.m_pan_y = m_pan_y;
+    header.m_edit_bytes = static_cast<std::uint32_t>(edits.size());
+    header.m_preview_bytes = m_preview_jpeg.size();
+    swapToLittle(header);
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            spdlog::warn("[SessionSnapshot::save]: Cannot create '{}': {}", path.parent_path().string(), ec.message());
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    // Written aside, then renamed: the previous session survives a crash while saving
+    std::filesystem::path partial { path };
+    partial += ".part";
+
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(m_source_path.data(), static_cast<std::streamsize>(m_source_path.size()));
+        out.write(edits.data(), static_cast<std::streamsize>(edits.size()));
+        out.write(reinterpret_cast<const char*>(m_preview_jpeg.data()), static_cast<std::streamsize>(m_preview_jpeg.size()));
+        if (!out.flush()) {
+            spdlog::warn("[SessionSnapshot::save]: Failed to write '{}'", partial.string());
+            out.close();
+            std::filesystem::remove(partial, ec);
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+
+    std::filesystem::rename(partial, path, ec);
+    if (ec) {
+        spdlog::warn("[SessionSnapshot::save]: Failed to install '{}': {}", path.string(), ec.message());
+        std::filesystem::remove(partial, ec);
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    spdlog::debug("[SessionSnapshot::save]: Session saved to '{}' ({} operation(s), {} preview bytes)",
+                  path.string(), m_operations.size(), m_preview_jpeg.size());
+    return {};
+}
+
+std::expected<SessionSnapshot, ErrorHandling::CoreError> SessionSnapshot::load(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) {
+        spdlog::debug("[SessionSnapshot::load]: No session at '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        spdlog::warn("[SessionSnapshot::load]: Cannot read '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    SessionFileHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        spdlog::warn("[SessionSnapshot::load]: '{}' is truncated", path.string());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+    swapToLittle(header);
+
+    if (header.m_magic != SessionFileHeader::k_magic || header.m_version != k_session_format_version) {
+        spdlog::info("[SessionSnapshot::load]: '{}' is not a session of this version, ignored", path.string());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    // Sizes checked against the file before anything is allocated
+    const auto file_size { std::filesystem::file_size(path, ec) };
+    const std::uint64_t payload { std::uint64_t { header.m_path_bytes } + header.m_edit_bytes + header.m_preview_bytes };
+    if (ec || header.m_preview_bytes > file_size || payload != file_size - sizeof(header)) {
+        spdlog::warn("[SessionSnapshot::load]: '{}' is truncated or inconsistent", path.string());
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    SessionSnapshot snapshot;
+    snapshot.m_source_path.resize(header.m_path_bytes);
+    std::string edits(header.m_edit_bytes, '\0');
+    snapshot.m_preview_jpeg.resize(static_cast<std::size_t>(header.m_preview_bytes));
+    if (!in.read(snapshot.m_source_path.data(), static_cast<std::streamsize>(snapshot.m_source_path.size()))
+        || !in.read(edits.data(), static_cast<std::streamsize>(edits.size()))
+        || !in.read(reinterpret_cast<char*>(snapshot.m_preview_jpeg.data()),
+                    static_cast<std::streamsize>(snapshot.m_preview_jpeg.size()))) {
+        spdlog::warn("[SessionSnapshot::load]: Failed to read '{}'", path.string());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    auto operations { decodeEditStack(std::as_bytes(std::span { edits })) };
+    if (!operations) {
+        spdlog::warn("[SessionSnapshot::load]: Edit stack of '{}' unreadable: {}", path.string(),
+                     ErrorHandling::to_string(operations.error()));
+        return std::unexpected(operations.error());
+    }
+
+    snapshot.m_source_width = header.m_source_width;
+    snapshot.m_source_height = header.m_source_height;
+    snapshot.m_operations = std::move(*operations);
+    snapshot.m_zoom = header.m_zoom;
+    snapshot.m_pan_x = header.m_pan_x;
+    snapshot.m_pan_y = header.m_pan_y;
+
+    spdlog::debug("[SessionSnapshot::load]: Session of '{}' read ({} operation(s))",
+                  snapshot.m_source_path, snapshot.m_operations.size());
+    return snapshot;
+}
+
+} // namespace CaptureMoment::Core::Serializer
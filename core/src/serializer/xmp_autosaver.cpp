@@ -0,0 +1,196 @@
+/**
+ * @file xmp_autosaver.cpp
+ * @brief Implementation of XmpAutosaver.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/xmp_autosaver.h"
+#include "serializer/operation_serialization.h"
+#include "common/trace/tracer.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace CaptureMoment::Core::Serializer {
+
+namespace {
+
+[[nodiscard]] std::uint64_t fnv1a(std::uint64_t hash, std::string_view bytes) noexcept
+{
+    for (const char c : bytes) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // anonymous namespace
+
+XmpAutosaver::XmpAutosaver(const IFileSerializerWriter& writer, std::chrono::milliseconds debounce, SaveCallback on_saved)
+    : m_writer(writer)
+    , m_debounce(debounce)
+    , m_on_saved(std::move(on_saved))
+    , m_thread([this](std::stop_token stop) { run(stop); })
+{
+    spdlog::debug("[XmpAutosaver]: Started ({} ms debounce).", m_debounce.count());
+}
+
+XmpAutosaver::~XmpAutosaver()
+{
+    // The thread writes what is pending before it stops
+    m_thread.request_stop();
+    m_thread.join();
+}
+
+void XmpAutosaver::scheduleSave(std::string_view source_image_path, std::vector<Operations::OperationDescriptor> operations)
+{
+    scheduleSave(source_image_path, std::move(operations), m_debounce);
+}
+
+void XmpAutosaver::scheduleSave(std::string_view source_image_path, std::vector<Operations::OperationDescriptor> operations,
+                                std::chrono::milliseconds delay)
+{
+    if (source_image_path.empty()) {
+        spdlog::error("[XmpAutosaver::scheduleSave]: Source image path is empty.");
+        return;
+    }
+
+    const Clock::time_point now { Clock::now() };
+    {
+        std::lock_guard lock(m_mutex);
+
+        // The edits of a previous image are final: write them first
+        for (PendingSave& pending : m_pending) {
+            if (pending.m_source_image_path != source_image_path) {
+                pending.m_deadline = std::min(pending.m_deadline, now);
+            }
+        }
+
+        auto it { std::ranges::find(m_pending, source_image_path, &PendingSave::m_source_image_path) };
+        if (it == m_pending.end()) {
+            m_pending.push_back({ std::string(source_image_path), std::move(operations), now + delay });
+        } else {
+            it->m_operations = std::move(operations);
+            it->m_deadline = now + delay;
+        }
+        ++m_generation;
+    }
+    m_wake.notify_all();
+}
+
+bool XmpAutosaver::flush()
+{
+    std::unique_lock lock(m_mutex);
+    if (m_pending.empty() && !m_writing) {
+        return m_last_success;
+    }
+
+    m_flush_requested = true;
+    m_wake.notify_all();
+    m_idle.wait(lock, [this] { return m_pending.empty() && !m_writing; });
+    return m_last_success;
+}
+
+void XmpAutosaver::markSaved(std::string_view source_image_path, std::span<const Operations::OperationDescriptor> operations)
+{
+    const std::uint64_t hash { editHash(operations) };
+    std::lock_guard lock(m_mutex);
+    m_saved_hashes.insert_or_assign(std::string(source_image_path), hash);
+}
+
+std::uint64_t XmpAutosaver::editHash(std::span<const Operations::OperationDescriptor> operations)
+{
+    if (operations.empty()) {
+        return 0;
+    }
+
+    std::uint64_t hash { 14695981039346656037ull };
+    for (const auto& operation : operations) {
+        // Everything the writer puts in the sidecar: equal hashes, equal packets
+        hash = fnv1a(hash, std::to_string(static_cast<int>(operation.type)));
+        hash = fnv1a(hash, operation.name);
+        hash = fnv1a(hash, operation.enabled ? "1" : "0");
+        hash = fnv1a(hash, serializeOperationParameters(operation));
+        hash = fnv1a(hash, "|");
+    }
+    // 0 is kept for "no edits"
+    return hash != 0 ? hash : 1;
+}
+
+void XmpAutosaver::run(std::stop_token stop)
+{
+    std::unique_lock lock(m_mutex);
+
+    while (!stop.stop_requested() || !m_pending.empty()) {
+        if (m_pending.empty()) {
+            m_wake.wait(lock, stop, [this] { return !m_pending.empty(); });
+            continue;
+        }
+
+        // Wait for the earliest deadline, unless flushed or stopped; a new schedule moves it
+        const auto next { std::ranges::min_element(m_pending, {}, &PendingSave::m_deadline) };
+        const Clock::time_point deadline { next->m_deadline };
+        if (!m_flush_requested && !stop.stop_requested() && Clock::now() < deadline) {
+            const std::uint64_t generation { m_generation };
+            m_wake.wait_until(lock, stop, deadline,
+                              [this, generation] { return m_flush_requested || m_generation != generation; });
+            continue;
+        }
+
+        PendingSave save { std::move(*next) };
+        m_pending.erase(next);
+
+        // Skip edits the sidecar already holds
+        const std::uint64_t hash { editHash(save.m_operations) };
+        const auto saved { m_saved_hashes.find(save.m_source_image_path) };
+        const bool unchanged { saved != m_saved_hashes.end() && saved->second == hash };
+
+        m_writing = true;
+        lock.unlock();
+
+        bool success { true };
+        if (unchanged) {
+            spdlog::trace("[XmpAutosaver::run]: Edits of '{}' unchanged, write skipped.", save.m_source_image_path);
+        } else {
+            success = write(save);
+        }
+        if (m_on_saved) {
+            m_on_saved(save.m_source_image_path, success);
+        }
+
+        lock.lock();
+        m_writing = false;
+        m_last_success = success;
+        if (!unchanged) {
+            if (success) {
+                m_saved_hashes.insert_or_assign(save.m_source_image_path, hash);
+            } else {
+                // Unknown content on disk: the next schedule writes again
+                m_saved_hashes.erase(save.m_source_image_path);
+            }
+        }
+
+        if (m_pending.empty()) {
+            m_flush_requested = false;
+            m_idle.notify_all();
+        }
+    }
+}
+
+bool XmpAutosaver::write(const PendingSave& save)
+{
+    CM_TRACE_SCOPE("xmp", "XmpAutosaver::write");
+
+    const bool success { m_writer.saveToFile(save.m_source_image_path, save.m_operations) };
+    if (success) {
+        spdlog::debug("[XmpAutosaver::write]: Saved {} operations for '{}'.", save.m_operations.size(), save.m_source_image_path);
+    } else {
+        spdlog::error("[XmpAutosaver::write]: Failed to save the edits of '{}'.", save.m_source_image_path);
+    }
+    return success;
+}
+
+} // namespace CaptureMoment::Core::Serializer
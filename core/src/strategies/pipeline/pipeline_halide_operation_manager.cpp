@@ -9,6 +9,9 @@
 
 #include <spdlog/spdlog.h>
 
+#include <cstdint>
+#include <utility>
+
 namespace CaptureMoment::Core::Strategies {
 
 PipelineHalideOperationManager::PipelineHalideOperationManager()
@@ -40,41 +43,25 @@ PipelineHalideOperationManager::PipelineHalideOperationManager()
 
 void PipelineHalideOperationManager::init(std::vector<Operations::OperationDescriptor>&& operations)
 {
-    // 1. Detect structural changes (type, name, enabled) vs value changes (params)
-    bool structure_changed = true;
-
-    spdlog::debug("[PipelineHalideOperationManager::init]: m_last_operations.size() = {}, operations.size() = {}",
-                  m_last_operations.size(), operations.size());
-
-    if (m_last_operations.size() == operations.size()) {
-        structure_changed = false;
-        for (size_t i = 0; i < operations.size(); ++i) {
+    // 1. Detect structural changes (order, id, type, enabled) vs value changes (params).
+    // Compared against the executor's own record, so the operations are neither copied nor walked twice.
+    const std::uint64_t structure = Pipeline::OperationPipelineExecutor::structureFingerprint(operations);
 
-            // Compare type, name, enabled. Ignore params for this check.
-            spdlog::debug("[PipelineHalideOperationManager::init]: Op[{}]: | last=({},{}) | new=({},{})",
-                          operations[i].id,m_last_operations[i].name, m_last_operations[i].enabled, operations[i].name, operations[i].enabled);
+    // 2. Lock and update the executor based on whether the structure changed or not.
+    std::lock_guard lock(m_mutex);
 
-            if (operations[i].id != m_last_operations[i].id &&
-                operations[i].enabled != m_last_operations[i].enabled) {
-                structure_changed = true;
-                spdlog::debug("[PipelineHalideOperationManager::init]: Structure change detected at index {}", i);
-                break;
-            }
-        }
+    if (!m_executor) {
+        spdlog::error("[PipelineHalideOperationManager::init]: No executor.");
+        return;
     }
-    spdlog::debug("[PipelineHalideOperationManager::init]: structure_changed = {}", structure_changed);
-
-    // 2. Update the cache with the new operations (for future structural change detection)
-    // This should be done before the lock to minimize time spent in critical section, as it's just a vector copy.
-    // Note: We are moving the operations into the cache, which is fine because we will move it again into the executor if structure changed.
-    m_last_operations = operations;
 
-    // 3. Lock and update the executor based on whether the structure changed or not.
-    std::lock_guard lock(m_mutex);
+    const bool structure_changed = m_executor->initializedStructure() != structure;
+    spdlog::debug("[PipelineHalideOperationManager::init]: {} operations, structure_changed = {}", operations.size(), structure_changed);
 
     if (structure_changed) {
-        spdlog::info("[PipelineHalideOperationManager::init]: Structure changed. Recompiling pipeline.");
-        // If the structure changed, we need to recompile the pipeline, which is more expensive. We call init() which will rebuild the graph and recompile.
+        spdlog::info("[PipelineHalideOperationManager::init]: Structure changed. Rebuilding pipeline.");
+        // The graph is rebuilt; the compiled-pipeline cache is keyed by the fused types and variants,
+        // not by ids, so a chain already compiled (e.g. after an undo) is not compiled again.
         m_executor->init(std::move(operations), *m_operation_factory);
     } else {
         spdlog::trace("[PipelineHalideOperationManager::init]: Values only. Updating runtime params.");
@@ -83,6 +70,112 @@ void PipelineHalideOperationManager::init(std::vector<Operations::OperationDescr
     }
 }
 
+void PipelineHalideOperationManager::warmUp(std::vector<Operations::OperationDescriptor>&& operations)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (!m_executor) {
+        spdlog::error("[PipelineHalideOperationManager::warmUp]: No executor.");
+        return;
+    }
+
+    m_executor->warmUp(std::move(operations), *m_operation_factory);
+}
+
+void PipelineHalideOperationManager::setRegionOfInterest(std::optional<Common::RegionOfInterest> roi)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setRegionOfInterest(roi);
+    }
+}
+
+void PipelineHalideOperationManager::setCancellationToken(Common::CancellationToken token)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setCancellationToken(std::move(token));
+    }
+}
+
+void PipelineHalideOperationManager::setDisplayOutputSize(Common::ImageDim width, Common::ImageDim height)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setDisplayOutputSize(width, height);
+    }
+}
+
+void PipelineHalideOperationManager::setDisplayOnDevice(bool enabled)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setDisplayOnDevice(enabled);
+    }
+}
+
+void PipelineHalideOperationManager::setHistogramOutput(bool enabled)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setHistogramOutput(enabled);
+    }
+}
+
+void PipelineHalideOperationManager::setInteractiveOperation(std::optional<std::uint64_t> operation_id)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setInteractiveOperation(operation_id);
+    }
+}
+
+std::optional<Common::DisplayImage> PipelineHalideOperationManager::takeDisplayImage()
+{
+    std::lock_guard lock(m_mutex);
+
+    if (!m_executor) {
+        return std::nullopt;
+    }
+    return m_executor->takeDisplayImage();
+}
+
+void PipelineHalideOperationManager::setProfiling(bool enabled)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_executor) {
+        m_executor->setProfiling(enabled);
+    }
+}
+
+std::optional<Pipeline::PipelineStats> PipelineHalideOperationManager::getPipelineStats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    if (!m_executor) {
+        return std::nullopt;
+    }
+    return m_executor->lastPipelineStats();
+}
+
+std::expected<std::filesystem::path, ErrorHandling::CoreError>
+PipelineHalideOperationManager::dumpDiagnostics(const std::filesystem::path& directory) const
+{
+    std::lock_guard lock(m_mutex);
+
+    if (!m_executor) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    return m_executor->dumpDiagnostics(directory);
+}
+
 bool PipelineHalideOperationManager::execute(ImageProcessing::IWorkingImageHardware& working_image)
 {
     std::lock_guard lock(m_mutex);
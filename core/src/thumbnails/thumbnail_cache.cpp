@@ -0,0 +1,356 @@
+/**
+ * @file thumbnail_cache.cpp
+ * @brief Implementation of ThumbnailCache
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "thumbnails/thumbnail_cache.h"
+#include "config/app_config.h"
+
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace CaptureMoment::Core::Thumbnails {
+
+/**
+ * @brief Version of the schema (SQLite `user_version`). A cache of another version is emptied:
+ *        its thumbnails are rendered again rather than migrated.
+ */
+constexpr int k_schema_version { 1 };
+
+/**
+ * @brief Schema of the cache: one row per source and size.
+ */
+constexpr const char* k_schema {
+    "CREATE TABLE IF NOT EXISTS thumbnails ("
+    "  source_path TEXT NOT NULL,"
+    "  max_long_edge INTEGER NOT NULL,"
+    "  source_mtime INTEGER NOT NULL,"
+    "  source_size INTEGER NOT NULL,"
+    "  edit_hash INTEGER NOT NULL,"
+    "  width INTEGER NOT NULL,"
+    "  height INTEGER NOT NULL,"
+    "  format TEXT NOT NULL,"
+    "  data BLOB NOT NULL,"
+    "  perceptual_hash INTEGER NOT NULL DEFAULT 0,"
+    "  last_access INTEGER NOT NULL,"
+    "  PRIMARY KEY (source_path, max_long_edge));"
+    "CREATE INDEX IF NOT EXISTS thumbnails_last_access ON thumbnails (last_access);"
+};
+
+/**
+ * @brief Statements prepared at open.
+ */
+constexpr const char* k_find_sql {
+    "SELECT rowid, width, height, format, data, perceptual_hash FROM thumbnails"
+    " WHERE source_path = ?1 AND max_long_edge = ?2"
+    " AND source_mtime = ?3 AND source_size = ?4 AND edit_hash = ?5;"
+};
+constexpr const char* k_touch_sql { "UPDATE thumbnails SET last_access = ?1 WHERE rowid = ?2;" };
+constexpr const char* k_store_sql {
+    "INSERT OR REPLACE INTO thumbnails"
+    " (source_path, max_long_edge, source_mtime, source_size, edit_hash, width, height, format, data, last_access,"
+    " perceptual_hash)"
+    " VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10, ?11);"
+};
+
+/**
+ * @brief Thumbnails deleted per eviction statement.
+ */
+constexpr int k_eviction_batch { 256 };
+
+/**
+ * @brief Seconds since the epoch (the recency of a row).
+ */
+[[nodiscard]] static std::int64_t now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Binds the lookup fields of a key (parameters 1 to 5).
+ */
+static void bindKey(sqlite3_stmt* statement, const ThumbnailCache::Key& key)
+{
+    // SQLite integers are signed: unsigned fields are stored bit for bit
+    sqlite3_bind_text(statement, 1, key.m_source_path.data(), static_cast<int>(key.m_source_path.size()), SQLITE_STATIC);
+    sqlite3_bind_int64(statement, 2, static_cast<sqlite3_int64>(key.m_max_long_edge));
+    sqlite3_bind_int64(statement, 3, key.m_source_mtime);
+    sqlite3_bind_int64(statement, 4, std::bit_cast<sqlite3_int64>(key.m_source_size));
+    sqlite3_bind_int64(statement, 5, std::bit_cast<sqlite3_int64>(key.m_edit_hash));
+}
+
+std::optional<ThumbnailCache::Key> ThumbnailCache::makeKey(std::string_view path, std::uint64_t edit_hash,
+                                                           Common::ImageDim max_long_edge)
+{
+    std::error_code ec;
+    const std::filesystem::path source { std::filesystem::absolute(std::filesystem::path(path), ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto size { std::filesystem::file_size(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    const auto mtime { std::filesystem::last_write_time(source, ec) };
+    if (ec) {
+        return std::nullopt;
+    }
+
+    Key key;
+    key.m_source_path = source.string();
+    key.m_source_mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+    key.m_source_size = static_cast<std::uint64_t>(size);
+    key.m_edit_hash = edit_hash;
+    key.m_max_long_edge = max_long_edge;
+    return key;
+}
+
+ThumbnailCache::ThumbnailCache(std::filesystem::path database)
+{
+    if (Config::AppConfig::instance().getThumbnailCacheSizeMB() == 0) {
+        spdlog::info("[ThumbnailCache::ThumbnailCache]: Thumbnail cache disabled");
+        return;
+    }
+
+    if (database.empty()) {
+        database = defaultDatabase();
+    }
+    if (database.empty()) {
+        spdlog::warn("[ThumbnailCache::ThumbnailCache]: No directory for the thumbnail cache");
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(database.parent_path(), ec);
+
+    std::lock_guard lock(m_mutex);
+
+    // The connection is serialized by m_mutex: SQLite's own mutexes are not needed
+    const int flags { SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX };
+    if (sqlite3_open_v2(database.string().c_str(), &m_db, flags, nullptr) != SQLITE_OK) {
+        spdlog::error("[ThumbnailCache::ThumbnailCache]: Cannot open '{}': {}", database.string(),
+                      m_db ? sqlite3_errmsg(m_db) : "out of memory");
+        close_unsafe();
+        return;
+    }
+
+    if (!prepare_unsafe()) {
+        spdlog::error("[ThumbnailCache::ThumbnailCache]: Cannot prepare '{}': {}", database.string(), sqlite3_errmsg(m_db));
+        close_unsafe();
+        return;
+    }
+
+    spdlog::info("[ThumbnailCache::ThumbnailCache]: '{}' opened ({} KB of thumbnails)",
+                 database.string(), m_total_bytes >> 10);
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+    std::lock_guard lock(m_mutex);
+    close_unsafe();
+}
+
+bool ThumbnailCache::isEnabled() const noexcept
+{
+    return m_db != nullptr;
+}
+
+std::optional<Thumbnail> ThumbnailCache::find(const Key& key)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_db) {
+        return std::nullopt;
+    }
+
+    sqlite3_reset(m_find_statement);
+    bindKey(m_find_statement, key);
+
+    if (sqlite3_step(m_find_statement) != SQLITE_ROW) {
+        return std::nullopt;
+    }
+
+    const sqlite3_int64 rowid { sqlite3_column_int64(m_find_statement, 0) };
+
+    Thumbnail thumbnail;
+    thumbnail.m_width = static_cast<Common::ImageDim>(sqlite3_column_int64(m_find_statement, 1));
+    thumbnail.m_height = static_cast<Common::ImageDim>(sqlite3_column_int64(m_find_statement, 2));
+    if (const auto* format = sqlite3_column_text(m_find_statement, 3)) {
+        thumbnail.m_format = reinterpret_cast<const char*>(format);
+    }
+
+    const void* data { sqlite3_column_blob(m_find_statement, 4) };
+    const int size { sqlite3_column_bytes(m_find_statement, 4) };
+    thumbnail.m_encoded.resize(static_cast<std::size_t>(size));
+    if (size > 0) {
+        std::memcpy(thumbnail.m_encoded.data(), data, static_cast<std::size_t>(size));
+    }
+    thumbnail.m_perceptual_hash = std::bit_cast<std::uint64_t>(sqlite3_column_int64(m_find_statement, 5));
+    sqlite3_reset(m_find_statement);
+
+    sqlite3_reset(m_touch_statement);
+    sqlite3_bind_int64(m_touch_statement, 1, now());
+    sqlite3_bind_int64(m_touch_statement, 2, rowid);
+    if (sqlite3_step(m_touch_statement) != SQLITE_DONE) {
+        // Only the recency is lost
+        spdlog::debug("[ThumbnailCache::find]: Access time not updated: {}", sqlite3_errmsg(m_db));
+    }
+    sqlite3_reset(m_touch_statement);
+
+    return thumbnail;
+}
+
+void ThumbnailCache::store(const Key& key, const Thumbnail& thumbnail)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_db || thumbnail.m_encoded.empty()) {
+        return;
+    }
+
+    sqlite3_reset(m_store_statement);
+    bindKey(m_store_statement, key);
+    sqlite3_bind_int64(m_store_statement, 6, static_cast<sqlite3_int64>(thumbnail.m_width));
+    sqlite3_bind_int64(m_store_statement, 7, static_cast<sqlite3_int64>(thumbnail.m_height));
+    sqlite3_bind_text(m_store_statement, 8, thumbnail.m_format.data(), static_cast<int>(thumbnail.m_format.size()), SQLITE_STATIC);
+    sqlite3_bind_blob(m_store_statement, 9, thumbnail.m_encoded.data(), static_cast<int>(thumbnail.m_encoded.size()), SQLITE_STATIC);
+    sqlite3_bind_int64(m_store_statement, 10, now());
+    sqlite3_bind_int64(m_store_statement, 11, std::bit_cast<sqlite3_int64>(thumbnail.m_perceptual_hash));
+
+    const int result { sqlite3_step(m_store_statement) };
+    sqlite3_reset(m_store_statement);
+    if (result != SQLITE_DONE) {
+        spdlog::warn("[ThumbnailCache::store]: Cannot store '{}': {}", key.m_source_path, sqlite3_errmsg(m_db));
+        return;
+    }
+
+    // A replaced row is counted twice until the next eviction recounts
+    m_total_bytes += thumbnail.m_encoded.size();
+
+    const std::uint64_t capacity_bytes { Config::AppConfig::instance().getThumbnailCacheSizeMB() << 20 };
+    if (m_total_bytes > capacity_bytes) {
+        evict_unsafe(capacity_bytes);
+    }
+}
+
+std::filesystem::path ThumbnailCache::defaultDatabase()
+{
+    const auto& configured { Config::AppConfig::instance().getThumbnailCachePath() };
+    if (!configured.empty()) {
+        return configured;
+    }
+
+    std::error_code ec;
+    const auto temp { std::filesystem::temp_directory_path(ec) };
+    return ec ? std::filesystem::path() : temp / "capturemoment" / "thumbnails.db";
+}
+
+bool ThumbnailCache::prepare_unsafe()
+{
+    // WAL: lookups never wait for a store; NORMAL sync is durable enough for a cache
+    sqlite3_busy_timeout(m_db, 2000);
+    if (sqlite3_exec(m_db, "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        return false;
+    }
+
+    int version { 0 };
+    sqlite3_stmt* user_version { nullptr };
+    if (sqlite3_prepare_v2(m_db, "PRAGMA user_version;", -1, &user_version, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    if (sqlite3_step(user_version) == SQLITE_ROW) {
+        version = sqlite3_column_int(user_version, 0);
+    }
+    sqlite3_finalize(user_version);
+
+    if (version != k_schema_version) {
+        const std::string reset { "DROP TABLE IF EXISTS thumbnails; PRAGMA user_version = " + std::to_string(k_schema_version) + ";" };
+        if (sqlite3_exec(m_db, reset.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+            return false;
+        }
+        if (version != 0) {
+            spdlog::info("[ThumbnailCache::prepare_unsafe]: Cache of schema {} emptied (now {})", version, k_schema_version);
+        }
+    }
+    if (sqlite3_exec(m_db, k_schema, nullptr, nullptr, nullptr) != SQLITE_OK) {
+        return false;
+    }
+
+    if (sqlite3_prepare_v3(m_db, k_find_sql, -1, SQLITE_PREPARE_PERSISTENT, &m_find_statement, nullptr) != SQLITE_OK
+        || sqlite3_prepare_v3(m_db, k_touch_sql, -1, SQLITE_PREPARE_PERSISTENT, &m_touch_statement, nullptr) != SQLITE_OK
+        || sqlite3_prepare_v3(m_db, k_store_sql, -1, SQLITE_PREPARE_PERSISTENT, &m_store_statement, nullptr) != SQLITE_OK) {
+        return false;
+    }
+
+    sqlite3_stmt* count { nullptr };
+    if (sqlite3_prepare_v2(m_db, "SELECT COALESCE(SUM(LENGTH(data)), 0) FROM thumbnails;", -1, &count, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    if (sqlite3_step(count) == SQLITE_ROW) {
+        m_total_bytes = static_cast<std::uint64_t>(sqlite3_column_int64(count, 0));
+    }
+    sqlite3_finalize(count);
+    return true;
+}
+
+void ThumbnailCache::evict_unsafe(std::uint64_t capacity_bytes)
+{
+    // Down to 90% of the budget, so the next stores do not evict again right away
+    const std::uint64_t target_bytes { capacity_bytes - capacity_bytes / 10 };
+
+    sqlite3_stmt* evict { nullptr };
+    sqlite3_stmt* count { nullptr };
+    if (sqlite3_prepare_v2(m_db,
+                           "DELETE FROM thumbnails WHERE rowid IN"
+                           " (SELECT rowid FROM thumbnails ORDER BY last_access LIMIT ?1);",
+                           -1, &evict, nullptr) != SQLITE_OK
+        || sqlite3_prepare_v2(m_db, "SELECT COALESCE(SUM(LENGTH(data)), 0) FROM thumbnails;", -1, &count, nullptr) != SQLITE_OK) {
+        spdlog::warn("[ThumbnailCache::evict_unsafe]: {}", sqlite3_errmsg(m_db));
+        sqlite3_finalize(evict);
+        sqlite3_finalize(count);
+        return;
+    }
+
+    const auto recount = [this, count]() {
+        sqlite3_reset(count);
+        if (sqlite3_step(count) == SQLITE_ROW) {
+            m_total_bytes = static_cast<std::uint64_t>(sqlite3_column_int64(count, 0));
+        }
+    };
+
+    std::uint64_t deleted_rows { 0 };
+    sqlite3_exec(m_db, "BEGIN;", nullptr, nullptr, nullptr);
+    for (recount(); m_total_bytes > target_bytes; recount()) {
+        sqlite3_reset(evict);
+        sqlite3_bind_int(evict, 1, k_eviction_batch);
+        if (sqlite3_step(evict) != SQLITE_DONE || sqlite3_changes(m_db) == 0) {
+            break;
+        }
+        deleted_rows += static_cast<std::uint64_t>(sqlite3_changes(m_db));
+    }
+    sqlite3_exec(m_db, "COMMIT;", nullptr, nullptr, nullptr);
+
+    sqlite3_finalize(evict);
+    sqlite3_finalize(count);
+
+    spdlog::debug("[ThumbnailCache::evict_unsafe]: Evicted {} thumbnails ({} KB left)", deleted_rows, m_total_bytes >> 10);
+}
+
+void ThumbnailCache::close_unsafe() noexcept
+{
+    sqlite3_finalize(std::exchange(m_find_statement, nullptr));
+    sqlite3_finalize(std::exchange(m_touch_statement, nullptr));
+    sqlite3_finalize(std::exchange(m_store_statement, nullptr));
+    sqlite3_close(std::exchange(m_db, nullptr));
+}
+
+} // namespace CaptureMoment::Core::Thumbnails
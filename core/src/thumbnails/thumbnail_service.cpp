@@ -0,0 +1,621 @@
+/**
+ * @file thumbnail_service.cpp
+ * @brief Implementation of ThumbnailService
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "thumbnails/thumbnail_service.h"
+#include "config/app_config.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "managers/source_manager.h"
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/interfaces/i_operation.h"
+#include "operations/interfaces/i_operation_fusion_logic.h"
+#include "operations/operation_cost.h"
+#include "operations/operation_registry.h"
+#include "pipeline/histogram_stage.h"
+#include "pipeline/pipeline_builder.h"
+#include "serializer/operation_serialization.h"
+#include "utils/color_space_utils.h"
+#include "utils/image_conversion.h"
+#include "utils/perceptual_hash.h"
+#include "utils/quantize.h"
+
+#include <OpenImageIO/filesystem.h>
+#include <OpenImageIO/imagebuf.h>
+#include <OpenImageIO/imageio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+namespace CaptureMoment::Core::Thumbnails {
+
+/**
+ * @brief Version of the rendering, hashed into every key: bump it to invalidate the cache.
+ */
+constexpr std::uint64_t k_render_version { 1 };
+
+/**
+ * @brief Folds bytes into a 64-bit FNV-1a hash (stable across runs, unlike std::hash).
+ */
+[[nodiscard]] static std::uint64_t fnv1a(std::uint64_t hash, std::string_view bytes) noexcept
+{
+    for (const char c : bytes) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Histogram of a linear RGBA_F32 image, counted like the pipeline's (see `HistogramStage`).
+ * @details Thumbnail-size: one quantization and one counting pass over a few hundred thousand pixels.
+ */
+[[nodiscard]] static std::shared_ptr<const Common::PreviewHistogram> histogramOf(const Common::ImageRegion& image)
+{
+    if (image.m_channels != Common::DisplayImage::k_channels) {
+        return nullptr;
+    }
+
+    Common::DisplayImage encoded;
+    encoded.m_width = image.m_width;
+    encoded.m_height = image.m_height;
+    encoded.m_data.resize(encoded.bytesPerLine() * image.m_height);
+    Utils::quantizeRowsU8(image.m_data.data(), static_cast<std::size_t>(image.m_width) * image.m_channels,
+                          encoded.m_data.data(), encoded.bytesPerLine(), image.m_width, image.m_height,
+                          Common::DisplayImage::k_channels);
+    return Pipeline::HistogramStage::computeOnHost(encoded);
+}
+
+/**
+ * @brief Encodes RGB pixels to a JPEG in memory (the pixel stride skips any alpha).
+ * @param pixels First pixel, `format` channels.
+ * @param x_stride Bytes from a pixel to the next.
+ * @param y_stride Bytes from a row to the next.
+ */
+[[nodiscard]] static ThumbnailService::Result writeJpeg(const void* pixels, OIIO::TypeDesc format,
+                                                        Common::ImageDim width, Common::ImageDim height,
+                                                        OIIO::stride_t x_stride, OIIO::stride_t y_stride)
+{
+    std::vector<unsigned char> encoded;
+    OIIO::Filesystem::IOVecOutput memory(encoded);
+
+    auto output { OIIO::ImageOutput::create("jpeg") };
+    if (!output) {
+        spdlog::error("[ThumbnailService::writeJpeg]: No JPEG writer: {}", OIIO::geterror());
+        return std::unexpected(ErrorHandling::CoreError::UnsupportedFormat);
+    }
+
+    OIIO::ImageSpec jpeg_spec(static_cast<int>(width), static_cast<int>(height), 3, OIIO::TypeDesc::UINT8);
+    jpeg_spec.attribute("Compression", "jpeg:" + std::to_string(ThumbnailService::k_jpeg_quality));
+    jpeg_spec.attribute("oiio:ColorSpace", "sRGB");
+
+    output->set_ioproxy(&memory);
+    if (!output->open("thumbnail.jpg", jpeg_spec)
+        || !output->write_image(format, pixels, x_stride, y_stride)
+        || !output->close()) {
+        spdlog::error("[ThumbnailService::writeJpeg]: JPEG encoding failed: {}", output->geterror());
+        return std::unexpected(ErrorHandling::CoreError::IOError);
+    }
+
+    Thumbnail thumbnail;
+    thumbnail.m_width = width;
+    thumbnail.m_height = height;
+    thumbnail.m_format = "jpeg";
+    thumbnail.m_encoded.resize(encoded.size());
+    std::ranges::transform(encoded, thumbnail.m_encoded.begin(), [](unsigned char byte) { return std::byte{byte}; });
+    return thumbnail;
+}
+
+ThumbnailService::ThumbnailService(std::unique_ptr<Serializer::IFileSerializerReader> reader,
+                                   std::unique_ptr<Managers::ISourceManager> source,
+                                   std::size_t worker_count,
+                                   std::unique_ptr<ThumbnailCache> cache)
+    : m_reader(std::move(reader))
+    , m_source(source ? std::move(source) : std::make_unique<Managers::SourceManager>())
+    , m_cache(cache ? std::move(cache) : std::make_unique<ThumbnailCache>())
+    , m_operation_factory(std::make_unique<Operations::OperationFactory>())
+    , m_request_generation(std::make_shared<Common::CancellationToken::Counter>(0))
+    // The first scheduler thread only runs interactive work: one more for the thumbnail lane
+    , m_pool(std::make_unique<Workers::EngineScheduler>(std::max<std::size_t>(worker_count, 1) + 1))
+{
+    Operations::OperationRegistry::registerAll(*m_operation_factory);
+
+    auto base_executor = Pipeline::PipelineBuilder::build(Pipeline::PipelineType::HalideOperation);
+    if (auto* concrete = dynamic_cast<Pipeline::OperationPipelineExecutor*>(base_executor.get())) {
+        base_executor.release();
+        m_executor.reset(concrete);
+    } else {
+        spdlog::error("[ThumbnailService::ThumbnailService]: No Halide executor: edited files get no thumbnail.");
+    }
+}
+
+ThumbnailService::~ThumbnailService()
+{
+    cancelRequests();
+    m_pool.reset();
+}
+
+ThumbnailService::Result ThumbnailService::getThumbnail(std::string_view path, Common::ImageDim max_long_edge,
+                                                        const Common::CancellationToken& token)
+{
+    if (path.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    auto edits { loadEdits(path) };
+    const auto key { ThumbnailCache::makeKey(path, editHash(edits), max_long_edge) };
+    if (!key) {
+        return std::unexpected(ErrorHandling::CoreError::FileNotFound);
+    }
+
+    if (auto cached = m_cache->find(*key)) {
+        spdlog::trace("[ThumbnailService::getThumbnail]: Cache hit for '{}'", path);
+        return std::move(*cached);
+    }
+
+    auto thumbnail { render(path, max_long_edge, std::move(edits), token) };
+    if (thumbnail) {
+        m_cache->store(*key, *thumbnail);
+    }
+    return thumbnail;
+}
+
+void ThumbnailService::requestThumbnails(std::span<const std::string> paths, Common::ImageDim max_long_edge,
+                                         ThumbnailCallback on_ready)
+{
+    const auto generation = m_request_generation->fetch_add(1, std::memory_order_relaxed) + 1;
+    const Common::CancellationToken token(m_request_generation, generation);
+
+    // Shared by the requests of this call
+    auto callback { std::make_shared<const ThumbnailCallback>(std::move(on_ready)) };
+
+    if (m_batch_size <= 1) {
+        for (const auto& path : paths) {
+            m_pool->post(Workers::TaskPriority::Thumbnail, [this, path, max_long_edge, token, callback]() {
+                if (token.isCancelled()) {
+                    (*callback)(path, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+                    return;
+                }
+                (*callback)(path, getThumbnail(path, max_long_edge, token));
+            });
+        }
+        return;
+    }
+
+    // A batch per task: the tasks still decode a few files at once, one each
+    for (std::size_t first = 0; first < paths.size(); first += m_batch_size) {
+        const auto chunk { paths.subspan(first, std::min(m_batch_size, paths.size() - first)) };
+        m_pool->post(Workers::TaskPriority::Thumbnail,
+                     [this, batch = std::vector<std::string>(chunk.begin(), chunk.end()), max_long_edge, token, callback]() {
+                         renderBatch(batch, max_long_edge, token, *callback);
+                     });
+    }
+}
+
+void ThumbnailService::cancelRequests()
+{
+    m_request_generation->fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint64_t ThumbnailService::editHash(std::span<const Operations::OperationDescriptor> operations)
+{
+    if (operations.empty()) {
+        return 0;
+    }
+
+    std::uint64_t hash { fnv1a(14695981039346656037ull, std::to_string(k_render_version)) };
+    for (const auto& operation : operations) {
+        // The serialized parameters are those the XMP round-trips: equal text, equal pixels
+        hash = fnv1a(hash, std::to_string(static_cast<int>(operation.type)));
+        hash = fnv1a(hash, operation.enabled ? "1" : "0");
+        hash = fnv1a(hash, Serializer::serializeOperationParameters(operation));
+        hash = fnv1a(hash, "|");
+    }
+    // 0 is kept for "no edits"
+    return hash != 0 ? hash : 1;
+}
+
+std::vector<Operations::OperationDescriptor> ThumbnailService::loadEdits(std::string_view path)
+{
+    if (!m_reader) {
+        return {};
+    }
+    std::lock_guard lock(m_reader_mutex);
+    return m_reader->loadFromFile(path);
+}
+
+ThumbnailService::Result ThumbnailService::render(std::string_view path, Common::ImageDim max_long_edge,
+                                                  std::vector<Operations::OperationDescriptor> edits,
+                                                  const Common::CancellationToken& token)
+{
+    // ============================================================
+    // Decode at thumbnail size
+    // ============================================================
+    auto decoded { decode(path, max_long_edge, token) };
+    if (!decoded) {
+        return std::unexpected(decoded.error());
+    }
+
+    // ============================================================
+    // Apply the saved edits at that size
+    // ============================================================
+    std::unique_ptr<Common::ImageRegion> image { std::move(decoded->m_image) };
+
+    const bool has_edits { std::ranges::any_of(edits, [](const auto& op) { return op.enabled; }) };
+    if (has_edits) {
+        auto edited { applyEdits(*image, std::move(edits), token) };
+        if (!edited) {
+            // An unedited thumbnail would misrepresent the image: none is produced
+            if (edited.error() != ErrorHandling::CoreError::LoadCancelled) {
+                spdlog::warn("[ThumbnailService::render]: Edits of '{}' not applied: {}", path,
+                             ErrorHandling::to_string(edited.error()));
+            }
+            return std::unexpected(edited.error());
+        }
+        image = std::move(*edited);
+    }
+
+    // ============================================================
+    // Turn upright, then encode
+    // ============================================================
+    auto oriented { upright(path, std::move(image)) };
+    if (!oriented) {
+        return std::unexpected(oriented.error());
+    }
+    image = std::move(*oriented);
+
+    auto thumbnail { encode(*image) };
+    if (thumbnail) {
+        thumbnail->m_perceptual_hash = decoded->m_perceptual_hash;
+        thumbnail->m_histogram = std::move(decoded->m_histogram);
+        spdlog::debug("[ThumbnailService::render]: '{}' -> {}x{} ({} bytes)", path,
+                      thumbnail->m_width, thumbnail->m_height, thumbnail->m_encoded.size());
+    }
+    return thumbnail;
+}
+
+std::expected<ThumbnailService::DecodedThumbnail, ErrorHandling::CoreError>
+ThumbnailService::decode(std::string_view path, Common::ImageDim max_long_edge, const Common::CancellationToken& token)
+{
+    auto decoded { m_source->decodeThumbnail(path, max_long_edge) };
+    if (!decoded) {
+        spdlog::warn("[ThumbnailService::decode]: Cannot decode '{}': {}", path, ErrorHandling::to_string(decoded.error()));
+        return std::unexpected(decoded.error());
+    }
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    DecodedThumbnail thumbnail;
+    thumbnail.m_image = std::move(*decoded);
+    const Common::ImageRegion& image { *thumbnail.m_image };
+    // Hashed before the edits: an edited image keeps matching its duplicates
+    thumbnail.m_perceptual_hash = Utils::differenceHash(image.m_data.data(), image.m_width, image.m_height, image.m_channels);
+    // Counted before the edits too: auto-tone suggests from the unedited tones
+    thumbnail.m_histogram = histogramOf(image);
+    return thumbnail;
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+ThumbnailService::upright(std::string_view path, std::unique_ptr<Common::ImageRegion> image) const
+{
+    const auto metadata { m_source->readMetadata(path) };
+    if (!metadata) {
+        return image;
+    }
+    const auto orientation { Common::orientationFromExif(metadata->m_orientation) };
+    if (orientation == Common::ImageOrientation::Normal) {
+        return image;
+    }
+
+    auto oriented { Utils::orient_F32(*image, orientation) };
+    if (!oriented) {
+        return std::unexpected(ErrorHandling::CoreError::AllocationFailed);
+    }
+    return oriented;
+}
+
+void ThumbnailService::renderBatch(std::span<const std::string> paths, Common::ImageDim max_long_edge,
+                                   const Common::CancellationToken& token, const ThumbnailCallback& on_ready)
+{
+    // ============================================================
+    // Cache hits first; files whose edits cannot be packed, one by one
+    // ============================================================
+    std::vector<BatchItem> items;
+    items.reserve(paths.size());
+
+    for (const auto& path : paths) {
+        if (token.isCancelled()) {
+            on_ready(path, std::unexpected(ErrorHandling::CoreError::LoadCancelled));
+            continue;
+        }
+
+        auto edits { loadEdits(path) };
+        const std::uint64_t edit_hash { editHash(edits) };
+        const auto key { ThumbnailCache::makeKey(path, edit_hash, max_long_edge) };
+        if (!key) {
+            on_ready(path, std::unexpected(ErrorHandling::CoreError::FileNotFound));
+            continue;
+        }
+        if (auto cached = m_cache->find(*key)) {
+            on_ready(path, std::move(*cached));
+            continue;
+        }
+
+        const bool has_edits { std::ranges::any_of(edits, [](const auto& op) { return op.enabled; }) };
+        if (!has_edits || !isBatchable(edits)) {
+            auto thumbnail { render(path, max_long_edge, std::move(edits), token) };
+            if (thumbnail) {
+                m_cache->store(*key, *thumbnail);
+            }
+            on_ready(path, std::move(thumbnail));
+            continue;
+        }
+
+        auto decoded { decode(path, max_long_edge, token) };
+        if (!decoded) {
+            on_ready(path, std::unexpected(decoded.error()));
+            continue;
+        }
+        // Per-pixel edits wherever the pixel is: turning upright first changes none of them
+        auto oriented { upright(path, std::move(decoded->m_image)) };
+        if (!oriented) {
+            on_ready(path, std::unexpected(oriented.error()));
+            continue;
+        }
+        decoded->m_image = std::move(*oriented);
+        items.push_back(BatchItem { path, *key, edit_hash, std::move(edits), std::move(*decoded) });
+    }
+
+    // ============================================================
+    // One execution per set of edits
+    // ============================================================
+    std::ranges::stable_sort(items, {}, &BatchItem::m_edit_hash);
+
+    for (auto first = items.begin(); first != items.end();) {
+        const auto last { std::find_if(first, items.end(), [hash = first->m_edit_hash](const BatchItem& item) {
+            return item.m_edit_hash != hash;
+        }) };
+        const std::span<BatchItem> group(first, last);
+
+        auto thumbnails { renderGroup(group, token) };
+        if (!thumbnails && thumbnails.error() != ErrorHandling::CoreError::LoadCancelled) {
+            spdlog::warn("[ThumbnailService::renderBatch]: Edits of {} file(s) not applied: {}", group.size(),
+                         ErrorHandling::to_string(thumbnails.error()));
+        }
+        for (std::size_t i = 0; i < group.size(); ++i) {
+            if (!thumbnails) {
+                on_ready(group[i].m_path, std::unexpected(thumbnails.error()));
+                continue;
+            }
+            Thumbnail& thumbnail = (*thumbnails)[i];
+            m_cache->store(group[i].m_key, thumbnail);
+            on_ready(group[i].m_path, std::move(thumbnail));
+        }
+        first = last;
+    }
+}
+
+std::expected<std::vector<Thumbnail>, ErrorHandling::CoreError>
+ThumbnailService::renderGroup(std::span<BatchItem> items, const Common::CancellationToken& token)
+{
+    if (!m_executor || items.empty()) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+    if (token.isCancelled()) {
+        return std::unexpected(ErrorHandling::CoreError::LoadCancelled);
+    }
+
+    // ============================================================
+    // Pack the images one above the other, as wide as the widest
+    // ============================================================
+    Common::ImageDim atlas_width { 0 };
+    Common::ImageDim atlas_height { 0 };
+    for (const BatchItem& item : items) {
+        atlas_width = std::max(atlas_width, item.m_decoded.m_image->m_width);
+        atlas_height += item.m_decoded.m_image->m_height;
+    }
+
+    Common::ImageRegion atlas;
+    atlas.m_width = atlas_width;
+    atlas.m_height = atlas_height;
+    atlas.m_channels = 4;
+    // Zeroed: the margins right of the narrower images are computed too
+    atlas.m_data.assign(static_cast<std::size_t>(atlas_width) * atlas_height * 4, 0.0f);
+
+    const std::size_t atlas_row { static_cast<std::size_t>(atlas_width) * 4 };
+    std::size_t offset { 0 };
+    for (const BatchItem& item : items) {
+        const Common::ImageRegion& image { *item.m_decoded.m_image };
+        const std::size_t row { static_cast<std::size_t>(image.m_width) * 4 };
+        for (Common::ImageDim y = 0; y < image.m_height; ++y) {
+            std::copy_n(image.m_data.begin() + static_cast<std::ptrdiff_t>(y * row), row,
+                        atlas.m_data.begin() + static_cast<std::ptrdiff_t>(offset));
+            offset += atlas_row;
+        }
+    }
+
+    // ============================================================
+    // One execution: edits and sRGB encoding in the same realization
+    // ============================================================
+    const auto& edits { items.front().m_edits };
+    auto backend { Common::MemoryType::CPU_RAM };
+    if (const auto cost_model = Config::AppConfig::instance().getBackendCostModel(); cost_model && cost_model->hasGpu()) {
+        backend = cost_model->selectBackend(atlas_width, atlas_height, Operations::chainCost(edits, *m_operation_factory),
+                                            Config::AppConfig::instance().currentEnergyPlan().m_gpu_advantage_threshold);
+    }
+
+    auto working { ImageProcessing::WorkingImageFactory::create(atlas, backend) };
+    if (!working && backend != Common::MemoryType::CPU_RAM) {
+        // Out of device memory: this batch runs on the CPU
+        working = ImageProcessing::WorkingImageFactory::create(atlas, Common::MemoryType::CPU_RAM);
+    }
+    if (!working) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    std::optional<Common::DisplayImage> display;
+    {
+        std::lock_guard lock(m_executor_mutex);
+        m_executor->init(std::vector<Operations::OperationDescriptor>(edits), *m_operation_factory);
+        m_executor->setCancellationToken(token);
+        // At the packed size: only the 8-bit pixels leave the device, in one transfer
+        m_executor->setDisplayOutputSize(atlas_width, atlas_height);
+        const bool executed { m_executor->execute(*working) };
+        display = m_executor->takeDisplayImage();
+        m_executor->clearDisplayOutput();
+        if (!executed) {
+            return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                       : ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+    }
+    spdlog::debug("[ThumbnailService::renderGroup]: {} file(s) in one {}x{} execution on {}", items.size(), atlas_width,
+                  atlas_height, backend == Common::MemoryType::GPU_MEMORY ? "the GPU" : "the CPU");
+
+    // ============================================================
+    // Cut back into thumbnails
+    // ============================================================
+    std::vector<Thumbnail> thumbnails;
+    thumbnails.reserve(items.size());
+    const auto finish = [&](const BatchItem& item, Result thumbnail) -> bool {
+        if (!thumbnail) {
+            return false;
+        }
+        thumbnail->m_perceptual_hash = item.m_decoded.m_perceptual_hash;
+        thumbnail->m_histogram = item.m_decoded.m_histogram;
+        thumbnails.push_back(std::move(*thumbnail));
+        return true;
+    };
+
+    if (display && display->m_width == atlas_width && display->m_height == atlas_height && !display->m_data.empty()) {
+        const std::size_t line { display->bytesPerLine() };
+        std::size_t first_line { 0 };
+        for (const BatchItem& item : items) {
+            const Common::ImageRegion& image { *item.m_decoded.m_image };
+            if (!finish(item, writeJpeg(display->m_data.data() + first_line * line, OIIO::TypeDesc::UINT8, image.m_width,
+                                        image.m_height, Common::DisplayImage::k_channels, static_cast<OIIO::stride_t>(line)))) {
+                return std::unexpected(ErrorHandling::CoreError::IOError);
+            }
+            first_line += image.m_height;
+        }
+        return thumbnails;
+    }
+
+    // No display image (a CPU chain served by the AOT kernel): the linear pixels, encoded per image
+    auto processed { working->exportToCPUCopy() };
+    if (!processed) {
+        return std::unexpected(processed.error());
+    }
+    offset = 0;
+    for (const BatchItem& item : items) {
+        const Common::ImageRegion& image { *item.m_decoded.m_image };
+        Common::ImageRegion edited;
+        edited.m_width = image.m_width;
+        edited.m_height = image.m_height;
+        edited.m_channels = 4;
+        const std::size_t row { static_cast<std::size_t>(image.m_width) * 4 };
+        edited.m_data.resize(row * image.m_height);
+        for (Common::ImageDim y = 0; y < image.m_height; ++y) {
+            std::copy_n((*processed)->m_data.begin() + static_cast<std::ptrdiff_t>(offset), row,
+                        edited.m_data.begin() + static_cast<std::ptrdiff_t>(y * row));
+            offset += atlas_row;
+        }
+        if (!finish(item, encode(edited))) {
+            return std::unexpected(ErrorHandling::CoreError::IOError);
+        }
+    }
+    return thumbnails;
+}
+
+bool ThumbnailService::isBatchable(std::span<const Operations::OperationDescriptor> edits) const
+{
+    using Operations::OperationType;
+
+    for (const auto& descriptor : edits) {
+        if (!descriptor.enabled) {
+            continue;
+        }
+        // Geometry, and plugins (their pixels may depend on the position, a vignette)
+        if (descriptor.type == OperationType::Crop || descriptor.type == OperationType::LensCorrection
+            || descriptor.type > OperationType::Sharpen) {
+            return false;
+        }
+
+        auto operation { m_operation_factory->create(descriptor) };
+        if (!operation) {
+            return false;
+        }
+        const auto* fusion_logic { dynamic_cast<const Operations::IOperationFusionLogic*>(operation->get()) };
+        if (!fusion_logic || fusion_logic->readsNeighborhood(fusion_logic->fusionVariant(descriptor))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::expected<std::unique_ptr<Common::ImageRegion>, ErrorHandling::CoreError>
+ThumbnailService::applyEdits(const Common::ImageRegion& image, std::vector<Operations::OperationDescriptor> edits,
+                             const Common::CancellationToken& token)
+{
+    if (!m_executor) {
+        return std::unexpected(ErrorHandling::CoreError::Unexpected);
+    }
+
+    // Thumbnails are small: the CPU beats the transfers to and from a GPU
+    auto working { ImageProcessing::WorkingImageFactory::create(image, Common::MemoryType::CPU_RAM) };
+    if (!working) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
+    }
+
+    const auto crop { Operations::CropGeometry::of(edits) };
+    {
+        std::lock_guard lock(m_executor_mutex);
+        m_executor->init(std::move(edits), *m_operation_factory);
+        m_executor->setCancellationToken(token);
+        if (!m_executor->execute(*working)) {
+            return std::unexpected(token.isCancelled() ? ErrorHandling::CoreError::LoadCancelled
+                                                       : ErrorHandling::CoreError::InvalidWorkingImage);
+        }
+    }
+
+    auto processed { working->exportToCPUCopy() };
+    if (!processed || !crop) {
+        return processed;
+    }
+    // Only the crop was computed: hand out that rectangle
+    auto cropped { crop->extractFrom(**processed) };
+    if (!cropped) {
+        return std::unexpected(ErrorHandling::CoreError::InvalidImageRegion);
+    }
+    return cropped;
+}
+
+ThumbnailService::Result ThumbnailService::encode(Common::ImageRegion& image)
+{
+    const int width { static_cast<int>(image.m_width) };
+    const int height { static_cast<int>(image.m_height) };
+
+    // ============================================================
+    // Linear to sRGB, in place
+    // ============================================================
+    OIIO::ImageSpec linear_spec(width, height, 4, OIIO::TypeDesc::FLOAT);
+    linear_spec.alpha_channel = 3;
+    linear_spec.attribute("oiio:ColorSpace", "lin_rec709_scene");
+    OIIO::ImageBuf pixels(linear_spec, image.m_data.data());
+    if (auto conversion = Utils::transformToColorSpace(pixels, "sRGB"); !conversion) {
+        return std::unexpected(conversion.error());
+    }
+
+    // ============================================================
+    // JPEG into memory (RGB: the alpha is skipped through the pixel stride)
+    // ============================================================
+    const auto pixel_stride { static_cast<OIIO::stride_t>(4 * sizeof(float)) };
+    return writeJpeg(image.m_data.data(), OIIO::TypeDesc::FLOAT, image.m_width, image.m_height, pixel_stride,
+                     OIIO::AutoStride);
+}
+
+} // namespace CaptureMoment::Core::Thumbnails
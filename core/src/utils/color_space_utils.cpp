@@ -6,10 +6,27 @@
  */
 
 #include "utils/color_space_utils.h"
+#include "common/trace/tracer.h"
 
+#include <OpenImageIO/color.h>
 #include <OpenImageIO/imagebufalgo.h>
+#include <OpenImageIO/parallel.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace CaptureMoment::Core::Utils {
 
 std::string getColorSpace(const OIIO::ImageBuf& buf) noexcept
@@ -43,6 +60,341 @@ bool isLinearToken(std::string_view colorspace) noexcept
     return false;
 }
 
+bool isSrgbToken(std::string_view colorspace) noexcept
+{
+    static constexpr std::array<std::string_view, 4> k_srgb_tokens {
+        "srgb", "srgb_rec709_scene", "srgb_rec709_display", "srgb_tx"
+    };
+
+    return std::ranges::any_of(k_srgb_tokens, [colorspace](std::string_view token) {
+        return std::ranges::equal(colorspace, token, [](char a, char b) {
+            return std::tolower(static_cast<unsigned char>(a)) == b;
+        });
+    });
+}
+
+namespace {
+
+/**
+ * @brief Transfer functions decoded through the fast path of `transformToColorSpace`.
+ */
+enum class TransferFunction { Srgb, Rec709, Gamma22, Gamma24 };
+
+/**
+ * @brief How a source color space decodes to "lin_rec709_scene" without OCIO.
+ */
+struct FastDecode {
+    TransferFunction transfer;
+    bool p3_primaries;  ///< Display P3 (D65): a 3x3 matrix follows the decode.
+};
+
+/**
+ * @brief Entries of the decoding tables: exact for 8-bit and 16-bit sources (65535 = 255 * 257).
+ */
+constexpr std::size_t k_decode_table_size { 65536 };
+
+/**
+ * @brief Linear Display P3 (D65) to linear Rec.709, row-major.
+ */
+constexpr std::array<float, 9> k_p3_to_rec709 {
+     1.2249402f, -0.2249402f,  0.0000000f,
+    -0.0420570f,  1.0420570f,  0.0000000f,
+    -0.0196376f, -0.0786360f,  1.0982736f
+};
+
+[[nodiscard]] bool equalsIgnoreCase(std::string_view value, std::string_view lowercase_token) noexcept
+{
+    return std::ranges::equal(value, lowercase_token, [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    });
+}
+
+[[nodiscard]] bool matchesAny(std::string_view value, std::span<const std::string_view> tokens) noexcept
+{
+    return std::ranges::any_of(tokens, [value](std::string_view token) { return equalsIgnoreCase(value, token); });
+}
+
+/**
+ * @brief Classifies the common display-referred inputs; anything else goes through OCIO.
+ */
+[[nodiscard]] std::optional<FastDecode> classifySource(std::string_view colorspace) noexcept
+{
+    static constexpr std::array<std::string_view, 2> k_rec709_tokens { "rec709", "rec709_rec709_display" };
+    static constexpr std::array<std::string_view, 4> k_g22_tokens {
+        "g22_rec709", "g22_rec709_scene", "g22_rec709_display", "g22_rec709_tx"
+    };
+    static constexpr std::array<std::string_view, 4> k_g24_tokens {
+        "g24_rec709", "g24_rec709_scene", "g24_rec709_display", "g24_rec709_tx"
+    };
+    static constexpr std::array<std::string_view, 5> k_p3_tokens {
+        "displayp3", "display p3", "srgb_p3d65_scene", "srgb_p3d65_display", "srgb_displayp3_scene"
+    };
+
+    if (isSrgbToken(colorspace)) {
+        return FastDecode { TransferFunction::Srgb, false };
+    }
+    if (matchesAny(colorspace, k_p3_tokens)) {
+        return FastDecode { TransferFunction::Srgb, true };
+    }
+    if (matchesAny(colorspace, k_rec709_tokens)) {
+        return FastDecode { TransferFunction::Rec709, false };
+    }
+    if (matchesAny(colorspace, k_g22_tokens)) {
+        return FastDecode { TransferFunction::Gamma22, false };
+    }
+    if (matchesAny(colorspace, k_g24_tokens)) {
+        return FastDecode { TransferFunction::Gamma24, false };
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Whether the target is scene-linear with Rec.709 primaries.
+ */
+[[nodiscard]] bool isLinearRec709Target(std::string_view colorspace) noexcept
+{
+    static constexpr std::array<std::string_view, 4> k_targets {
+        "lin_rec709_scene", "lin_rec709", "lin_srgb", "linear"
+    };
+    return matchesAny(colorspace, k_targets);
+}
+
+/**
+ * @brief Decodes one encoded value on [0, 1] to linear.
+ */
+[[nodiscard]] double decodeTransfer(TransferFunction transfer, double encoded) noexcept
+{
+    switch (transfer) {
+    case TransferFunction::Srgb:
+        // IEC 61966-2-1
+        return encoded <= 0.04045 ? encoded / 12.92 : std::pow((encoded + 0.055) / 1.055, 2.4);
+    case TransferFunction::Rec709:
+        // Inverse of the ITU-R BT.709 OETF
+        return encoded < 0.081 ? encoded / 4.5 : std::pow((encoded + 0.099) / 1.099, 1.0 / 0.45);
+    case TransferFunction::Gamma22:
+        return std::pow(encoded, 2.2);
+    case TransferFunction::Gamma24:
+        return std::pow(encoded, 2.4);
+    }
+    return encoded;
+}
+
+/**
+ * @brief Decodes any value, mirroring the curve for negative inputs (out-of-range float sources).
+ */
+[[nodiscard]] float decodeUnbounded(TransferFunction transfer, float encoded) noexcept
+{
+    const double decoded { decodeTransfer(transfer, std::abs(static_cast<double>(encoded))) };
+    return static_cast<float>(encoded < 0.0f ? -decoded : decoded);
+}
+
+/**
+ * @brief Builds the decoding table of `size` evenly spaced integer samples.
+ */
+[[nodiscard]] std::vector<float> makeDecodeTable(TransferFunction transfer, std::size_t size)
+{
+    std::vector<float> table(size);
+    const double max_sample { static_cast<double>(size - 1) };
+    for (std::size_t i = 0; i < size; ++i) {
+        table[i] = static_cast<float>(decodeTransfer(transfer, static_cast<double>(i) / max_sample));
+    }
+    return table;
+}
+
+/**
+ * @brief The 16-bit decoding table of a transfer function, built once, on first use.
+ */
+[[nodiscard]] std::span<const float> decodeTable(TransferFunction transfer)
+{
+    switch (transfer) {
+    case TransferFunction::Srgb: {
+        static const std::vector<float> s_srgb { makeDecodeTable(TransferFunction::Srgb, k_decode_table_size) };
+        return s_srgb;
+    }
+    case TransferFunction::Rec709: {
+        static const std::vector<float> s_rec709 { makeDecodeTable(TransferFunction::Rec709, k_decode_table_size) };
+        return s_rec709;
+    }
+    case TransferFunction::Gamma22: {
+        static const std::vector<float> s_g22 { makeDecodeTable(TransferFunction::Gamma22, k_decode_table_size) };
+        return s_g22;
+    }
+    case TransferFunction::Gamma24: {
+        static const std::vector<float> s_g24 { makeDecodeTable(TransferFunction::Gamma24, k_decode_table_size) };
+        return s_g24;
+    }
+    }
+    return {};
+}
+
+/**
+ * @brief Decodes the color channels of a row in place, then applies the P3 matrix if any.
+ *
+ * Values on [0, 1] go through the table (exact for 8/16-bit sources); the matrix pass is a
+ * branch-free loop over contiguous pixels, left to the compiler's auto-vectorizer.
+ */
+void decodeRow(float* row, int width, int channels, std::span<const float> table,
+               const FastDecode& decode) noexcept
+{
+    constexpr float k_max_index { static_cast<float>(k_decode_table_size - 1) };
+
+    float* px { row };
+    for (int x = 0; x < width; ++x, px += channels) {
+        for (int c = 0; c < 3; ++c) {
+            const float v { px[c] };
+            px[c] = (v >= 0.0f && v <= 1.0f)
+                ? table[static_cast<std::size_t>(v * k_max_index + 0.5f)]
+                : decodeUnbounded(decode.transfer, v);
+        }
+    }
+
+    if (!decode.p3_primaries) {
+        return;
+    }
+
+    const auto& m { k_p3_to_rec709 };
+    px = row;
+    for (int x = 0; x < width; ++x, px += channels) {
+        const float r { px[0] };
+        const float g { px[1] };
+        const float b { px[2] };
+        px[0] = m[0] * r + m[1] * g + m[2] * b;
+        px[1] = m[3] * r + m[4] * g + m[5] * b;
+        px[2] = m[6] * r + m[7] * g + m[8] * b;
+    }
+}
+
+/**
+ * @brief Table/matrix conversion of a local RGB(A) float buffer to linear Rec.709.
+ * @return false if the buffer or the color spaces are not covered (OCIO handles them).
+ */
+[[nodiscard]] bool tryFastDecode(OIIO::ImageBuf& image, std::string_view source_cs, std::string_view target_cs)
+{
+    const OIIO::ImageSpec& spec { image.spec() };
+    const auto decode { classifySource(source_cs) };
+
+    if (!decode || !isLinearRec709Target(target_cs)
+        || spec.format != OIIO::TypeDesc::FLOAT || !spec.channelformats.empty()
+        || spec.nchannels < 3 || spec.depth > 1 || image.localpixels() == nullptr) {
+        return false;
+    }
+
+    const std::span<const float> table { decodeTable(decode->transfer) };
+    const int width { spec.width };
+    const int channels { spec.nchannels };
+    float* const pixels { static_cast<float*>(image.localpixels()) };
+
+    OIIO::parallel_for(0, spec.height, [&](int64_t y) {
+        decodeRow(pixels + static_cast<std::size_t>(y) * static_cast<std::size_t>(width) * channels,
+                  width, channels, table, *decode);
+    });
+
+    image.specmod().attribute("oiio:ColorSpace", std::string(target_cs));
+    return true;
+}
+
+/**
+ * @brief Rows per block when a cached OCIO processor is applied in parallel.
+ */
+constexpr int k_rows_per_block { 64 };
+
+/**
+ * @brief OCIO processors by (config, source, target), built once and shared by every conversion.
+ *
+ * OCIO processors are immutable once built, so concurrent loads apply the same handle; only
+ * the map itself is guarded (shared for lookups, exclusive for the first build of a pair).
+ */
+class ColorProcessorCache {
+public:
+    [[nodiscard]] static ColorProcessorCache& instance()
+    {
+        static ColorProcessorCache s_cache;
+        return s_cache;
+    }
+
+    /**
+     * @brief The processor converting `source_cs` to `target_cs`, or null if OCIO cannot build it.
+     */
+    [[nodiscard]] OIIO::ColorProcessorHandle get(std::string_view source_cs, std::string_view target_cs)
+    {
+        const OIIO::ColorConfig& config { OIIO::ColorConfig::default_colorconfig() };
+
+        std::string key { config.configname() };
+        key.append(1, '\0').append(source_cs).append(1, '\0').append(target_cs);
+
+        {
+            std::shared_lock lock(m_mutex);
+            if (const auto it { m_processors.find(key) }; it != m_processors.end()) {
+                return it->second;
+            }
+        }
+
+        // Built outside the lock: two threads racing on a new pair build it twice, never block loads
+        OIIO::ColorProcessorHandle processor {
+            config.createColorProcessor(OIIO::ustring(source_cs), OIIO::ustring(target_cs))
+        };
+        if (!processor) {
+            return nullptr;
+        }
+
+        std::unique_lock lock(m_mutex);
+        return m_processors.try_emplace(std::move(key), std::move(processor)).first->second;
+    }
+
+private:
+    /**
+     * @brief Guards `m_processors`.
+     */
+    std::shared_mutex m_mutex;
+
+    /**
+     * @brief Processors keyed by "config\0source\0target".
+     */
+    std::unordered_map<std::string, OIIO::ColorProcessorHandle> m_processors;
+};
+
+/**
+ * @brief Applies a cached OCIO processor in place, in parallel over blocks of rows.
+ * @return false if the conversion failed (the error is left on the buffer).
+ */
+[[nodiscard]] bool applyProcessor(OIIO::ImageBuf& image, const OIIO::ColorProcessor* processor)
+{
+    // Blocks write concurrently: an ImageCache-backed buffer is made local first
+    if (!image.make_writable(true)) {
+        return false;
+    }
+
+    const OIIO::ROI roi { image.roi() };
+    const int blocks { (roi.height() + k_rows_per_block - 1) / k_rows_per_block };
+    std::atomic<bool> ok { true };
+
+    OIIO::parallel_for(0, blocks, [&](int64_t block) {
+        OIIO::ROI rows { roi };
+        rows.ybegin = roi.ybegin + static_cast<int>(block) * k_rows_per_block;
+        rows.yend = std::min(rows.ybegin + k_rows_per_block, roi.yend);
+        // One thread per block: the blocks already spread the work
+        if (!OIIO::ImageBufAlgo::colorconvert(image, image, processor, true, rows, 1)) {
+            ok.store(false, std::memory_order_relaxed);
+        }
+    });
+
+    return ok.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+std::span<const float> srgbToLinearTable(OIIO::TypeDesc format)
+{
+    if (format == OIIO::TypeDesc::UINT8) {
+        static const std::vector<float> s_table_8 { makeDecodeTable(TransferFunction::Srgb, 256) };
+        return s_table_8;
+    }
+    if (format == OIIO::TypeDesc::UINT16) {
+        return decodeTable(TransferFunction::Srgb);
+    }
+    return {};
+}
+
 ColorSpaceInfo analyzeColorSpace(const OIIO::ImageSpec& spec) noexcept
 {
     const auto cs { spec.get_string_attribute("oiio:ColorSpace") };
@@ -57,6 +409,8 @@ ColorSpaceInfo analyzeColorSpace(const OIIO::ImageSpec& spec) noexcept
 std::expected<void, ErrorHandling::CoreError>
 transformToColorSpace(OIIO::ImageBuf& image, std::string_view target_cs)
 {
+    CM_TRACE_SCOPE("color", "transformToColorSpace");
+
     if (!image.initialized()) {
         spdlog::warn("[transformToColorSpace]: Buffer is not initialized");
         return std::unexpected(ErrorHandling::CoreError::InvalidWorkingImage);
@@ -69,14 +423,23 @@ transformToColorSpace(OIIO::ImageBuf& image, std::string_view target_cs)
         return std::unexpected(ErrorHandling::CoreError::DecodingError);
     }
 
-    if (!OIIO::ImageBufAlgo::colorconvert(image, image,
-                                            source_cs,
-                                            std::string(target_cs))) {
+    if (tryFastDecode(image, source_cs, target_cs)) {
+        return {};
+    }
+
+    const OIIO::ColorProcessorHandle processor { ColorProcessorCache::instance().get(source_cs, target_cs) };
+    if (!processor) {
+        spdlog::error("[transformToColorSpace]: No color processor from {} to {}", source_cs, target_cs);
+        return std::unexpected(ErrorHandling::CoreError::DecodingError);
+    }
+
+    if (!processor->isNoOp() && !applyProcessor(image, processor.get())) {
         spdlog::error("[transformToColorSpace]: Conversion from {} to {} failed: {}",
                       source_cs, target_cs, image.geterror());
         return std::unexpected(ErrorHandling::CoreError::DecodingError);
     }
 
+    image.specmod().attribute("oiio:ColorSpace", std::string(target_cs));
     return {};
 }
 
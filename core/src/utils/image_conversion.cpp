@@ -10,46 +10,148 @@
 #include <OpenImageIO/imagebufalgo.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace CaptureMoment::Core::Utils {
 
-std::unique_ptr<Common::ImageRegion> convert_RGBA_F32_to_RGBA_U8(const Common::ImageRegion& input)
+std::unique_ptr<Common::DisplayImage> convert_RGBA_F32_to_RGBA_U8(const Common::ImageRegion& input, DitherMode dither)
 {
     if (!input.isValid() || input.m_channels != 4 || input.m_format != Common::PixelFormat::RGBA_F32) {
         spdlog::error("convert_RGBA_F32_to_RGBA_U8: Input is invalid or not RGBA_F32");
         return nullptr;
     }
 
+    auto result { std::make_unique<Common::DisplayImage>() };
+    result->m_width = input.width();
+    result->m_height = input.height();
+    result->m_data.resize(result->bytesPerLine() * result->m_height);
+
+    const std::size_t src_stride { static_cast<std::size_t>(input.width()) * 4 };
+    quantizeRowsU8(input.m_data.data(), src_stride, result->m_data.data(), result->bytesPerLine(),
+                   result->m_width, result->m_height, Common::DisplayImage::k_channels,
+                   QuantizeSettings{ .m_transfer = OutputTransfer::Srgb, .m_dither = dither,
+                                     .m_origin_y = static_cast<Common::ImageDim>(std::max(input.y(), 0)) });
+    return result;
+}
+
+std::unique_ptr<Common::ImageRegion> resize_F32(const Common::ImageRegion& input,
+                                                Common::ImageDim target_width,
+                                                Common::ImageDim target_height)
+{
+    if (!input.isValid() || target_width == 0 || target_height == 0) {
+        spdlog::error("resize_F32: Input is invalid or target size is empty ({}x{})", target_width, target_height);
+        return nullptr;
+    }
+
     // 1. Setup OIIO Source Buffer (Zero-Copy)
     OIIO::ImageSpec src_spec(input.m_width, input.m_height, input.m_channels, OIIO::TypeDesc::FLOAT);
     OIIO::ImageBuf src_buf(src_spec, const_cast<float*>(input.m_data.data()));
 
-    // 2. Setup OIIO Destination Spec
-    OIIO::ImageSpec dst_spec(input.m_width, input.m_height, input.m_channels, OIIO::TypeDesc::UINT8);
+    // 2. Setup OIIO Destination Buffer
+    OIIO::ImageSpec dst_spec(static_cast<int>(target_width), static_cast<int>(target_height),
+                             input.m_channels, OIIO::TypeDesc::FLOAT);
     OIIO::ImageBuf dst_buf(dst_spec);
 
-    // 3. Perform Conversion (F32 -> U8) using OIIO
-    if (!OIIO::ImageBufAlgo::copy(dst_buf, src_buf)) {
-        spdlog::error("convert_RGBA_F32_to_RGBA_U8: OIIO conversion failed");
+    // 3. Filtered resize
+    if (!OIIO::ImageBufAlgo::resize(dst_buf, src_buf)) {
+        spdlog::error("resize_F32: OIIO resize failed: {}", OIIO::geterror());
         return nullptr;
     }
 
-    // 4. Extract U8 data to ImageRegion
-    auto result { std::make_unique<Common::ImageRegion>() };
-    result->m_x = input.x();
-    result->m_y = input.y();
-    result->m_width = input.width();
-    result->m_height = input.height();
-    result->m_channels = input.channels();
+    // 4. Extract pixels to ImageRegion
+    Common::PixelBuffer data(target_width * target_height * input.m_channels);
+    if (!dst_buf.get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, data.data())) {
+        spdlog::error("resize_F32: Failed to extract pixels from OIIO buffer");
+        return nullptr;
+    }
+
+    auto result { std::make_unique<Common::ImageRegion>(std::move(data), target_width, target_height, input.m_channels) };
+    result->m_format = input.m_format;
+    return result;
+}
+
+std::unique_ptr<Common::ImageRegion> orient_F32(const Common::ImageRegion& input,
+                                                Common::ImageOrientation orientation)
+{
+    if (!input.isValid()) {
+        spdlog::error("orient_F32: Input is invalid");
+        return nullptr;
+    }
+
+    // 1. Setup OIIO Source Buffer (Zero-Copy), tagged with the orientation
+    OIIO::ImageSpec src_spec(static_cast<int>(input.m_width), static_cast<int>(input.m_height),
+                             input.m_channels, OIIO::TypeDesc::FLOAT);
+    src_spec.attribute("Orientation", static_cast<int>(orientation));
+    OIIO::ImageBuf src_buf(src_spec, const_cast<float*>(input.m_data.data()));
 
-    const size_t total_elements { static_cast<size_t>(input.width()) * input.height() * input.channels() };
-    result->m_data.resize(total_elements);
+    // 2. Transposes and flips as the tag says
+    OIIO::ImageBuf dst_buf { OIIO::ImageBufAlgo::reorient(src_buf) };
+    if (dst_buf.has_error()) {
+        spdlog::error("orient_F32: OIIO reorient failed: {}", dst_buf.geterror());
+        return nullptr;
+    }
 
-    if (!dst_buf.get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::UINT8, result->m_data.data())) {
-        spdlog::error("convert_RGBA_F32_to_RGBA_U8: Failed to extract U8 pixels from OIIO buffer");
+    // 3. Extract pixels to ImageRegion
+    const auto [width, height] = Common::orientedSize(orientation, input.m_width, input.m_height);
+    Common::PixelBuffer data(width * height * input.m_channels);
+    if (!dst_buf.get_pixels(OIIO::ROI(0, static_cast<int>(width), 0, static_cast<int>(height), 0, 1, 0, input.m_channels),
+                            OIIO::TypeDesc::FLOAT, data.data())) {
+        spdlog::error("orient_F32: Failed to extract pixels from OIIO buffer");
         return nullptr;
     }
 
+    auto result { std::make_unique<Common::ImageRegion>(std::move(data), width, height, input.m_channels) };
+    result->m_format = input.m_format;
     return result;
 }
 
+std::unique_ptr<Common::ImageRegion> downsample_rows_F32(const Common::ImageView& input,
+                                                         Common::ImageDim target_width,
+                                                         Common::ImageDim target_height,
+                                                         Common::ImageDim target_y,
+                                                         Common::ImageDim target_rows)
+{
+    if (!input.isValid() || target_width == 0 || target_height == 0 || target_rows == 0
+        || target_width > input.m_width || target_height > input.m_height
+        || target_y + target_rows > target_height) {
+        spdlog::error("downsample_rows_F32: Input is invalid or band is out of range ({}x{}, rows {}+{})",
+                      target_width, target_height, target_y, target_rows);
+        return nullptr;
+    }
+
+    const std::size_t channels { input.m_channels };
+    Common::PixelBuffer data(static_cast<std::size_t>(target_width) * target_rows * channels);
+    std::vector<float> sums(channels);
+
+    for (Common::ImageDim ty = 0; ty < target_rows; ++ty) {
+        // Source rows covered by this target row
+        const std::size_t y_begin { static_cast<std::size_t>(target_y + ty) * input.m_height / target_height };
+        const std::size_t y_end { static_cast<std::size_t>(target_y + ty + 1) * input.m_height / target_height };
+
+        for (Common::ImageDim tx = 0; tx < target_width; ++tx) {
+            const std::size_t x_begin { static_cast<std::size_t>(tx) * input.m_width / target_width };
+            const std::size_t x_end { static_cast<std::size_t>(tx + 1) * input.m_width / target_width };
+
+            std::fill(sums.begin(), sums.end(), 0.0f);
+            for (std::size_t y = y_begin; y < y_end; ++y) {
+                for (std::size_t x = x_begin; x < x_end; ++x) {
+                    for (std::size_t c = 0; c < channels; ++c) {
+                        sums[c] += input(static_cast<int>(y), static_cast<int>(x), static_cast<int>(c));
+                    }
+                }
+            }
+
+            const float inv_count { 1.0f / static_cast<float>((y_end - y_begin) * (x_end - x_begin)) };
+            float* dst { data.data() + (static_cast<std::size_t>(ty) * target_width + tx) * channels };
+            for (std::size_t c = 0; c < channels; ++c) {
+                dst[c] = sums[c] * inv_count;
+            }
+        }
+    }
+
+    return std::make_unique<Common::ImageRegion>(0, static_cast<Common::ImageCoord>(target_y), std::move(data),
+                                                 target_width, target_rows, input.m_channels);
+}
+
 } // namespace CaptureMoment::Core::Utils
@@ -0,0 +1,80 @@
+/**
+ * @file perceptual_hash.cpp
+ * @brief Implementation of the difference hash
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "utils/perceptual_hash.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace CaptureMoment::Core::Utils {
+
+namespace {
+
+/// Cells of the reduced image: one more column than bits per row, for the right neighbours.
+constexpr std::size_t k_cells_x { 9 };
+constexpr std::size_t k_cells_y { 8 };
+
+/// Source pixels [first, second) of each cell along an axis, never empty.
+template <std::size_t Cells>
+[[nodiscard]] std::array<std::pair<std::size_t, std::size_t>, Cells> cellSpans(std::size_t size) noexcept
+{
+    std::array<std::pair<std::size_t, std::size_t>, Cells> spans {};
+    for (std::size_t i = 0; i < Cells; ++i) {
+        // Images smaller than the grid: a cell reuses its neighbour's pixel
+        const std::size_t begin { std::min(i * size / Cells, size - 1) };
+        spans[i] = { begin, std::max(begin + 1, (i + 1) * size / Cells) };
+    }
+    return spans;
+}
+
+} // anonymous namespace
+
+std::uint64_t differenceHash(const float* pixels, Common::ImageDim width, Common::ImageDim height,
+                             Common::ImageChan channels)
+{
+    if (!pixels || width == 0 || height == 0 || channels == 0) {
+        return 0;
+    }
+
+    const auto columns { cellSpans<k_cells_x>(width) };
+    const auto rows { cellSpans<k_cells_y>(height) };
+
+    // Sum of the luminance of each cell, one pass over the rows
+    std::array<double, k_cells_x * k_cells_y> cells {};
+    for (std::size_t cy = 0; cy < k_cells_y; ++cy) {
+        for (std::size_t y = rows[cy].first; y < rows[cy].second; ++y) {
+            const float* row { pixels + y * width * channels };
+            for (std::size_t cx = 0; cx < k_cells_x; ++cx) {
+                double sum { 0.0 };
+                for (std::size_t x = columns[cx].first; x < columns[cx].second; ++x) {
+                    const float* pixel { row + x * channels };
+                    sum += channels >= 3 ? 0.2126 * pixel[0] + 0.7152 * pixel[1] + 0.0722 * pixel[2] : pixel[0];
+                }
+                cells[cy * k_cells_x + cx] += sum;
+            }
+        }
+    }
+
+    // Compared as means: cells may hold different pixel counts
+    std::uint64_t hash { 0 };
+    int bit { 0 };
+    for (std::size_t cy = 0; cy < k_cells_y; ++cy) {
+        const double cell_rows { static_cast<double>(rows[cy].second - rows[cy].first) };
+        for (std::size_t cx = 0; cx + 1 < k_cells_x; ++cx, ++bit) {
+            const double left { cells[cy * k_cells_x + cx] / (cell_rows * static_cast<double>(columns[cx].second - columns[cx].first)) };
+            const double right { cells[cy * k_cells_x + cx + 1] / (cell_rows * static_cast<double>(columns[cx + 1].second - columns[cx + 1].first)) };
+            if (left < right) {
+                hash |= std::uint64_t{1} << bit;
+            }
+        }
+    }
+    return hash;
+}
+
+} // namespace CaptureMoment::Core::Utils
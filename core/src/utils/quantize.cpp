@@ -0,0 +1,219 @@
+/**
+ * @file quantize.cpp
+ * @brief Implementation of the table-driven quantization
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "utils/quantize.h"
+
+#include <OpenImageIO/parallel.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace CaptureMoment::Core::Utils {
+
+namespace {
+
+/// 8-bit code table steps over [0, 1]; 14 bits keep near-black codes exact (the curve's slope is 12.92 there).
+constexpr std::size_t k_code_table_size { 1u << 14 };
+constexpr float k_code_table_scale { static_cast<float>(k_code_table_size - 1) };
+
+/// Float curve steps over [0, 1], interpolated: within a hundredth of a 16-bit code.
+constexpr std::size_t k_curve_table_size { 1u << 16 };
+constexpr float k_curve_table_scale { static_cast<float>(k_curve_table_size - 1) };
+
+/// Pixels quantized together: the clamp and the table indexing vectorize over the block.
+constexpr std::size_t k_block_pixels { 64 };
+
+/// From this many pixels, rows are quantized in parallel.
+constexpr std::size_t k_parallel_min_pixels { std::size_t{1} << 16 };
+
+/// 8x8 Bayer matrix, thresholds 0 to 63.
+constexpr std::array<std::uint8_t, 64> k_bayer_8x8 {
+     0, 32,  8, 40,  2, 34, 10, 42,
+    48, 16, 56, 24, 50, 18, 58, 26,
+    12, 44,  4, 36, 14, 46,  6, 38,
+    60, 28, 52, 20, 62, 30, 54, 22,
+     3, 35, 11, 43,  1, 33,  9, 41,
+    51, 19, 59, 27, 49, 17, 57, 25,
+    15, 47,  7, 39, 13, 45,  5, 37,
+    63, 31, 55, 23, 61, 29, 53, 21
+};
+
+[[nodiscard]] double srgbEncode(double linear) noexcept
+{
+    return linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+}
+
+const std::array<std::uint8_t, k_code_table_size>& srgbCodeTable()
+{
+    static const auto table = [] {
+        std::array<std::uint8_t, k_code_table_size> codes {};
+        for (std::size_t i = 0; i < k_code_table_size; ++i) {
+            const double encoded { srgbEncode(static_cast<double>(i) / static_cast<double>(k_code_table_size - 1)) };
+            codes[i] = static_cast<std::uint8_t>(std::clamp(encoded * 255.0 + 0.5, 0.0, 255.0));
+        }
+        return codes;
+    }();
+    return table;
+}
+
+/**
+ * @brief Encoded values of the curve, one entry past 1.0 so interpolation never reads out of bounds.
+ */
+const std::vector<float>& srgbCurveTable()
+{
+    static const auto table = [] {
+        std::vector<float> curve(k_curve_table_size + 1);
+        for (std::size_t i = 0; i < k_curve_table_size; ++i) {
+            curve[i] = static_cast<float>(srgbEncode(static_cast<double>(i) / static_cast<double>(k_curve_table_size - 1)));
+        }
+        curve[k_curve_table_size] = curve[k_curve_table_size - 1];
+        return curve;
+    }();
+    return table;
+}
+
+/**
+ * @brief Dither offset of a pixel, in codes, in [-0.5, 0.5).
+ */
+[[nodiscard]] float ditherOffset(DitherMode mode, std::size_t x, std::size_t y) noexcept
+{
+    if (mode == DitherMode::Ordered) {
+        return (static_cast<float>(k_bayer_8x8[(y & 7) * 8 + (x & 7)]) + 0.5f) / 64.0f - 0.5f;
+    }
+    // Interleaved gradient noise, as in image_display.frag (pixel centers)
+    const float px { static_cast<float>(x) + 0.5f };
+    const float py { static_cast<float>(y) + 0.5f };
+    const float inner { 0.06711056f * px + 0.00583715f * py };
+    const float noise { 52.9829189f * (inner - std::floor(inner)) };
+    return (noise - std::floor(noise)) - 0.5f;
+}
+
+/**
+ * @brief Clamps to [0, 1]; NaN fails both comparisons and lands on 0.
+ */
+[[nodiscard]] inline float clampUnit(float v) noexcept
+{
+    return v > 0.0f ? (v < 1.0f ? v : 1.0f) : 0.0f;
+}
+
+template<typename Sample>
+void quantizeRow(const float* src, Sample* dst, std::size_t width, int dst_channels,
+                 const QuantizeSettings& settings, std::size_t y)
+{
+    constexpr float k_max_code { static_cast<float>((1u << (8 * sizeof(Sample))) - 1) };
+    const bool srgb { settings.m_transfer == OutputTransfer::Srgb };
+    const bool dither { settings.m_dither != DitherMode::None };
+    const auto channels { static_cast<std::size_t>(dst_channels) };
+
+    // 8-bit sRGB without dither: the code table gives the rounded result directly
+    if constexpr (sizeof(Sample) == 1) {
+        if (srgb && !dither) {
+            const auto& table { srgbCodeTable() };
+            std::array<std::uint16_t, k_block_pixels * 4> indices;
+
+            for (std::size_t begin = 0; begin < width; begin += k_block_pixels) {
+                const std::size_t count { std::min(k_block_pixels, width - begin) };
+                const float* block_src { src + begin * 4 };
+                Sample* block_dst { dst + begin * channels };
+
+                for (std::size_t i = 0; i < count * 4; ++i) {
+                    indices[i] = static_cast<std::uint16_t>(clampUnit(block_src[i]) * k_code_table_scale + 0.5f);
+                }
+                for (std::size_t p = 0; p < count; ++p) {
+                    Sample* out { block_dst + p * channels };
+                    out[0] = table[indices[p * 4 + 0]];
+                    out[1] = table[indices[p * 4 + 1]];
+                    out[2] = table[indices[p * 4 + 2]];
+                    if (channels == 4) {
+                        // Alpha is not gamma-encoded
+                        out[3] = static_cast<Sample>(clampUnit(block_src[p * 4 + 3]) * k_max_code + 0.5f);
+                    }
+                }
+            }
+            return;
+        }
+    }
+
+    const float* curve { srgb ? srgbCurveTable().data() : nullptr };
+    std::array<float, k_block_pixels * 4> values;
+
+    for (std::size_t begin = 0; begin < width; begin += k_block_pixels) {
+        const std::size_t count { std::min(k_block_pixels, width - begin) };
+        const float* block_src { src + begin * 4 };
+        Sample* block_dst { dst + begin * channels };
+
+        for (std::size_t i = 0; i < count * 4; ++i) {
+            values[i] = clampUnit(block_src[i]);
+        }
+
+        // Transfer function on the color samples: interpolated table
+        if (curve) {
+            for (std::size_t i = 0; i < count * 4; ++i) {
+                if ((i & 3) == 3) {
+                    continue;
+                }
+                const float position { values[i] * k_curve_table_scale };
+                const auto index { static_cast<std::uint32_t>(position) };
+                const float fraction { position - static_cast<float>(index) };
+                values[i] = curve[index] + fraction * (curve[index + 1] - curve[index]);
+            }
+        }
+
+        for (std::size_t p = 0; p < count; ++p) {
+            const float offset { dither ? ditherOffset(settings.m_dither, begin + p, y) : 0.0f };
+            Sample* out { block_dst + p * channels };
+            for (std::size_t c = 0; c < 3; ++c) {
+                const float code { values[p * 4 + c] * k_max_code + 0.5f + offset };
+                out[c] = static_cast<Sample>(code > 0.0f ? (code < k_max_code ? code : k_max_code) : 0.0f);
+            }
+            if (channels == 4) {
+                out[3] = static_cast<Sample>(values[p * 4 + 3] * k_max_code + 0.5f);
+            }
+        }
+    }
+}
+
+template<typename Sample>
+void quantizeRows(const float* src, std::size_t src_stride, Sample* dst, std::size_t dst_stride,
+                  Common::ImageDim width, Common::ImageDim rows, int dst_channels, const QuantizeSettings& settings)
+{
+    if (!src || !dst || width == 0 || rows == 0 || (dst_channels != 3 && dst_channels != 4)) {
+        return;
+    }
+
+    const auto quantize_row = [&](std::size_t y) {
+        quantizeRow(src + y * src_stride, dst + y * dst_stride, width, dst_channels, settings, settings.m_origin_y + y);
+    };
+
+    if (width * rows >= k_parallel_min_pixels && rows > 1) {
+        OIIO::parallel_for(int64_t { 0 }, static_cast<int64_t>(rows), [&](int64_t y) {
+            quantize_row(static_cast<std::size_t>(y));
+        });
+        return;
+    }
+    for (std::size_t y = 0; y < rows; ++y) {
+        quantize_row(y);
+    }
+}
+
+} // anonymous namespace
+
+void quantizeRowsU8(const float* src, std::size_t src_stride, std::uint8_t* dst, std::size_t dst_stride,
+                    Common::ImageDim width, Common::ImageDim rows, int dst_channels, const QuantizeSettings& settings)
+{
+    quantizeRows(src, src_stride, dst, dst_stride, width, rows, dst_channels, settings);
+}
+
+void quantizeRowsU16(const float* src, std::size_t src_stride, std::uint16_t* dst, std::size_t dst_stride,
+                     Common::ImageDim width, Common::ImageDim rows, int dst_channels, const QuantizeSettings& settings)
+{
+    quantizeRows(src, src_stride, dst, dst_stride, width, rows, dst_channels, settings);
+}
+
+} // namespace CaptureMoment::Core::Utils
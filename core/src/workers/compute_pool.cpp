@@ -0,0 +1,269 @@
+/**
+ * @file compute_pool.cpp
+ * @brief Implementation of ComputePool.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "workers/compute_pool.h"
+#include "workers/engine_scheduler.h"
+#include "common/numa_topology.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace CaptureMoment::Core::Workers {
+
+ComputePool& ComputePool::instance()
+{
+    static ComputePool* s_instance { new ComputePool() };
+    return *s_instance;
+}
+
+ComputePool::ComputePool()
+{
+    m_lane_caps[static_cast<std::size_t>(TaskPriority::Thumbnail)] = k_default_thumbnail_cap;
+    setConcurrency(0);
+}
+
+void ComputePool::setConcurrency(std::size_t threads)
+{
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_concurrency.store(threads, std::memory_order_relaxed);
+        startHelpers_unsafe();
+        refreshWantedLanes_unsafe();
+    }
+    m_work_available.notify_all();
+
+    spdlog::debug("[ComputePool::setConcurrency]: {} threads.", threads);
+}
+
+std::size_t ComputePool::concurrency() const noexcept
+{
+    return m_concurrency.load(std::memory_order_relaxed);
+}
+
+void ComputePool::setLaneCap(TaskPriority priority, std::size_t threads)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_lane_caps[static_cast<std::size_t>(priority)] = threads;
+        refreshWantedLanes_unsafe();
+    }
+    m_work_available.notify_all();
+}
+
+std::size_t ComputePool::laneCap(TaskPriority priority) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_lane_caps[static_cast<std::size_t>(priority)];
+}
+
+void ComputePool::setNodePinning(bool enabled)
+{
+    const std::size_t nodes { Common::NumaTopology::instance().nodeCount() };
+    if (enabled && (nodes < 2 || nodes > k_max_pinned_nodes)) {
+        spdlog::info("[ComputePool::setNodePinning]: {} memory node(s): helpers left unpinned.", nodes);
+        enabled = false;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_node_pinning.store(enabled, std::memory_order_relaxed);
+        refreshWantedLanes_unsafe();
+    }
+    // Idle helpers apply it now, busy ones after their loop
+    m_work_available.notify_all();
+}
+
+bool ComputePool::nodePinning() const noexcept
+{
+    return m_node_pinning.load(std::memory_order_relaxed);
+}
+
+std::optional<std::size_t> ComputePool::callerNode() const noexcept
+{
+    return nodePinning() ? Common::NumaTopology::pinnedNode() : std::nullopt;
+}
+
+int ComputePool::run(Loop& loop)
+{
+    if (loop.m_extent <= 0) {
+        return 0;
+    }
+
+    const std::size_t lane { static_cast<std::size_t>(loop.m_priority) };
+    if (loop.m_extent > 1 && concurrency() > 1) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_lanes[lane].push_back(&loop);
+            refreshWantedLanes_unsafe();
+        }
+        m_work_available.notify_all();
+    }
+
+    // The caller works too: the loop completes even if every helper is busy elsewhere
+    work(loop, 0);
+
+    std::unique_lock lock(m_mutex);
+    auto& loops { m_lanes[lane] };
+    if (const auto it = std::ranges::find(loops, &loop); it != loops.end()) {
+        loops.erase(it);
+        refreshWantedLanes_unsafe();
+    }
+    // Every iteration is claimed: wait for those the helpers are still running
+    m_helper_left.wait(lock, [&loop]() { return loop.m_helpers == 0; });
+
+    return loop.m_status.load(std::memory_order_relaxed);
+}
+
+void ComputePool::work(Loop& loop, std::uint64_t preempt_mask)
+{
+    for (;;) {
+        const int index { loop.m_next.fetch_add(1, std::memory_order_relaxed) };
+        if (index >= loop.m_extent) {
+            return;
+        }
+
+        // After a failure, the remaining iterations are only claimed
+        if (loop.m_status.load(std::memory_order_relaxed) == 0) {
+            if (const int status = loop.m_invoke(loop.m_body, index); status != 0) {
+                int expected { 0 };
+                loop.m_status.compare_exchange_strong(expected, status, std::memory_order_relaxed);
+            }
+        }
+
+        if ((m_wanted_lanes.load(std::memory_order_relaxed) & preempt_mask) != 0) {
+            return;
+        }
+    }
+}
+
+void ComputePool::helper(std::size_t index)
+{
+    const auto& topology { Common::NumaTopology::instance() };
+    const std::size_t home_node { index % topology.nodeCount() };
+    bool pinned { false };
+    bool pinning_applied { false };
+
+    std::unique_lock lock(m_mutex);
+    for (;;) {
+        Loop* loop { nullptr };
+        m_work_available.wait(lock, [&]() {
+            return pinning_applied != nodePinning()
+                || (loop = selectLoop_unsafe(pinned ? std::optional { home_node } : std::nullopt)) != nullptr;
+        });
+
+        if (pinning_applied != nodePinning()) {
+            pinning_applied = nodePinning();
+            lock.unlock();
+            if (pinning_applied) {
+                // If the system refuses, the helper stays unpinned and serves any loop
+                pinned = topology.pinCurrentThread(home_node);
+            } else if (pinned) {
+                topology.unpinCurrentThread();
+                pinned = false;
+            }
+            lock.lock();
+            continue;
+        }
+
+        const std::optional<std::size_t> helper_node { pinned ? std::optional { home_node } : std::nullopt };
+        const std::size_t lane { static_cast<std::size_t>(loop->m_priority) };
+        ++loop->m_helpers;
+        ++m_lane_helpers[lane];
+        ++m_busy_helpers;
+        refreshWantedLanes_unsafe();
+        lock.unlock();
+
+        {
+            // Loops nested in this one run in its lane
+            EngineScheduler::ScopedPriority scope { loop->m_priority };
+            work(*loop, preemptMask(lane, helper_node));
+        }
+
+        lock.lock();
+        --m_lane_helpers[lane];
+        --m_busy_helpers;
+        refreshWantedLanes_unsafe();
+        if (--loop->m_helpers == 0) {
+            m_helper_left.notify_all();
+        }
+        // A slot freed up: an idle helper (maybe of another node) may take a loop this one could not
+        if (m_wanted_lanes.load(std::memory_order_relaxed) != 0) {
+            m_work_available.notify_all();
+        }
+    }
+}
+
+ComputePool::Loop* ComputePool::selectLoop_unsafe(std::optional<std::size_t> helper_node) const
+{
+    if (m_busy_helpers + 1 >= concurrency()) {
+        return nullptr;
+    }
+
+    for (std::size_t lane = 0; lane < k_task_priority_count; ++lane) {
+        if (m_lane_caps[lane] != 0 && m_lane_helpers[lane] >= m_lane_caps[lane]) {
+            continue;
+        }
+        for (Loop* loop : m_lanes[lane]) {
+            const bool reachable { !helper_node || !loop->m_node || loop->m_node == helper_node };
+            if (reachable && loop->m_next.load(std::memory_order_relaxed) < loop->m_extent) {
+                return loop;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::uint64_t ComputePool::preemptMask(std::size_t lane, std::optional<std::size_t> helper_node) noexcept
+{
+    // The more urgent lanes, in one slot
+    const std::uint64_t lanes { (std::uint64_t{1} << lane) - 1 };
+
+    if (!helper_node) {
+        std::uint64_t mask { 0 };
+        for (std::size_t slot = 0; slot <= k_max_pinned_nodes; ++slot) {
+            mask |= lanes << (slot * k_task_priority_count);
+        }
+        return mask;
+    }
+    return lanes | (lanes << (slotOf(helper_node) * k_task_priority_count));
+}
+
+std::size_t ComputePool::slotOf(std::optional<std::size_t> node) noexcept
+{
+    return node ? std::min(*node, k_max_pinned_nodes - 1) + 1 : 0;
+}
+
+void ComputePool::refreshWantedLanes_unsafe()
+{
+    std::uint64_t wanted { 0 };
+    for (std::size_t lane = 0; lane < k_task_priority_count; ++lane) {
+        if (m_lane_caps[lane] != 0 && m_lane_helpers[lane] >= m_lane_caps[lane]) {
+            continue;
+        }
+        for (const Loop* loop : m_lanes[lane]) {
+            if (loop->m_next.load(std::memory_order_relaxed) < loop->m_extent) {
+                wanted |= std::uint64_t{1} << (slotOf(loop->m_node) * k_task_priority_count + lane);
+            }
+        }
+    }
+    m_wanted_lanes.store(wanted, std::memory_order_relaxed);
+}
+
+void ComputePool::startHelpers_unsafe()
+{
+    const std::size_t target { concurrency() - 1 };
+    while (m_helpers.size() < target) {
+        m_helpers.emplace_back([this, index = m_helpers.size()]() { helper(index); });
+    }
+}
+
+} // namespace CaptureMoment::Core::Workers
@@ -0,0 +1,144 @@
+/**
+ * @file engine_scheduler.cpp
+ * @brief Implementation of EngineScheduler.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "workers/engine_scheduler.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace CaptureMoment::Core::Workers {
+
+namespace {
+
+/**
+ * @brief Lane of the task running on this thread.
+ */
+thread_local std::optional<TaskPriority> t_current_priority;
+
+} // anonymous namespace
+
+std::optional<TaskPriority> EngineScheduler::currentPriority() noexcept
+{
+    return t_current_priority;
+}
+
+EngineScheduler::ScopedPriority::ScopedPriority(TaskPriority priority) noexcept
+    : m_previous(std::exchange(t_current_priority, priority))
+{
+}
+
+EngineScheduler::ScopedPriority::~ScopedPriority()
+{
+    t_current_priority = m_previous;
+}
+
+EngineScheduler::EngineScheduler(std::size_t thread_count)
+{
+    thread_count = std::max<std::size_t>(thread_count, 2);
+    m_threads.reserve(thread_count);
+
+    try {
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            m_threads.emplace_back([this, interactive_only = (i == 0)]() { run(interactive_only); });
+        }
+    } catch (...) {
+        // Joinable threads must not be destroyed: stop the ones already started
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_task_available.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+        throw;
+    }
+
+    spdlog::debug("[EngineScheduler::EngineScheduler]: Started {} threads.", thread_count);
+}
+
+EngineScheduler::~EngineScheduler()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_task_available.notify_all();
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+
+    spdlog::debug("[EngineScheduler::~EngineScheduler]: Stopped.");
+}
+
+void EngineScheduler::post(TaskPriority priority, Task task)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_lanes[static_cast<std::size_t>(priority)].push_back(std::move(task));
+    }
+
+    // Interactive tasks may only be runnable by some threads: wake them all
+    if (priority == TaskPriority::Interactive) {
+        m_task_available.notify_all();
+    } else {
+        m_task_available.notify_one();
+    }
+}
+
+std::size_t EngineScheduler::pendingCount(TaskPriority priority) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_lanes[static_cast<std::size_t>(priority)].size();
+}
+
+bool EngineScheduler::popTask(bool interactive_only, Task& task, TaskPriority& priority)
+{
+    const std::size_t lane_count = interactive_only ? 1 : m_lanes.size();
+
+    for (std::size_t lane = 0; lane < lane_count; ++lane) {
+        if (!m_lanes[lane].empty()) {
+            task = std::move(m_lanes[lane].front());
+            m_lanes[lane].pop_front();
+            priority = static_cast<TaskPriority>(lane);
+            return true;
+        }
+    }
+    return false;
+}
+
+void EngineScheduler::run(bool interactive_only)
+{
+    for (;;) {
+        Task task;
+        TaskPriority priority { TaskPriority::Interactive };
+        {
+            std::unique_lock lock(m_mutex);
+            m_task_available.wait(lock, [&]() { return popTask(interactive_only, task, priority) || m_stopping; });
+
+            if (!task) {
+                // Stopping, and nothing left this thread may run
+                return;
+            }
+        }
+
+        ScopedPriority scope { priority };
+        try {
+            task();
+        } catch (const std::exception& e) {
+            spdlog::error("[EngineScheduler::run]: Task threw: {}", e.what());
+        } catch (...) {
+            spdlog::error("[EngineScheduler::run]: Task threw an unknown exception.");
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Workers
@@ -9,33 +9,38 @@
 #include "strategies/pipeline/pipeline_halide_operation_manager.h"
 
 #include <spdlog/spdlog.h>
-#include <future>
+#include <exception>
 
 namespace CaptureMoment::Core {
 namespace Workers {
 
-std::future<bool> HalideOperationWorker::execute(
+void HalideOperationWorker::dispatch(
     Pipeline::PipelineContext& context,
-    ImageProcessing::IWorkingImageHardware& working_image)
+    ImageProcessing::IWorkingImageHardware& working_image,
+    TaskPriority priority,
+    CompletionHandler on_complete)
 {
-    spdlog::trace("[HalideOperationWorker] Executing Halide pipeline.");
+    spdlog::trace("[HalideOperationWorker] Queuing Halide pipeline (lane {}).", static_cast<int>(priority));
 
     // 1. Retrieve the specific manager from the context
     // We use the context to avoid passing the manager directly as a parameter.
     auto& halide_manager = context.getHalideManager();
 
-    // 2. Wrap the execution in a future
-    // Since the manager's execute() is synchronous (blocks until done),
-    // we use std::async to create a future that runs this logic.
-    // This satisfies the IWorkerRequest interface requirement.
-    return std::async(std::launch::deferred, [&halide_manager, &working_image]() {
-        bool success = halide_manager.execute(working_image);
-        
+    // 2. Run the synchronous manager execution on a pool thread.
+    // The continuation runs on that same thread: no extra thread, no polling.
+    m_scheduler->post(priority, [&halide_manager, &working_image, on_complete = std::move(on_complete)]() mutable {
+        bool success = false;
+        try {
+            success = halide_manager.execute(working_image);
+        } catch (const std::exception& e) {
+            spdlog::critical("[HalideOperationWorker] Exception during execution: {}", e.what());
+        }
+
         if (!success) {
             spdlog::error("[HalideOperationWorker] Execution failed.");
         }
-        
-        return success;
+
+        on_complete(success);
     });
 }
 
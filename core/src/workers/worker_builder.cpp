@@ -8,6 +8,8 @@
 #include "workers/worker_builder.h"
 
 #include <spdlog/spdlog.h>
+
+#include <mutex>
 #include <utility>
 
 namespace CaptureMoment::Core::Workers {
@@ -19,19 +21,32 @@ std::unordered_map<WorkerType, WorkerBuilder::CreatorFunc>& WorkerBuilder::getRe
     return registry;
 }
 
+std::shared_mutex& WorkerBuilder::getRegistryMutex()
+{
+    static std::shared_mutex mutex;
+    return mutex;
+}
+
 void WorkerBuilder::registerCreator(WorkerType type, CreatorFunc creator)
 {
     // Register the creator function in the static map
+    std::unique_lock lock(getRegistryMutex());
     getRegistry()[type] = std::move(creator);
 }
 
-std::unique_ptr<IWorkerRequest> WorkerBuilder::build(WorkerType type)
+std::unique_ptr<IWorkerRequest> WorkerBuilder::build(WorkerType type, EngineScheduler& scheduler)
 {
-    auto& registry = getRegistry();
-    auto it = registry.find(type);
+    CreatorFunc creator;
+    {
+        std::shared_lock lock(getRegistryMutex());
+        const auto& registry = getRegistry();
+        if (const auto it = registry.find(type); it != registry.end()) {
+            creator = it->second;
+        }
+    }
 
     // Check if the requested type has been registered
-    if (it == registry.end())
+    if (!creator)
     {
         spdlog::error("[WorkerBuilder] No creator registered for worker type: {}", static_cast<int>(type));
         return nullptr;
@@ -40,8 +55,8 @@ std::unique_ptr<IWorkerRequest> WorkerBuilder::build(WorkerType type)
     try
     {
         // Invoke the stored lambda/function to create the instance
-        // The creator is expected to call the default constructor of the concrete implementation.
-        return it->second();
+        // The creator binds the concrete implementation to the scheduler.
+        return creator(scheduler);
     }
     catch (const std::exception& e)
     {
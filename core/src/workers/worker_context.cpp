@@ -12,20 +12,25 @@
 
 namespace CaptureMoment::Core::Workers {
 
-WorkerContext::WorkerContext()
+WorkerContext::WorkerContext(std::shared_ptr<EngineScheduler> scheduler)
+    : m_scheduler(std::move(scheduler))
 {
     spdlog::info("WorkerContext::WorkerContext: Initializing Context...");
 
-    // 1. Create the unique instance of the Builder
+    // 1. Start the persistent worker pool shared by all workers, unless the engine shares one
+    if (!m_scheduler) {
+        m_scheduler = std::make_shared<EngineScheduler>();
+    }
+
+    // 2. Create the unique instance of the Builder
     m_builder = std::make_unique<WorkerBuilder>();
 
-    // 2. Register all available worker types in this builder
+    // 3. Register all available worker types in this builder
     WorkerRegistry::registerAll(*m_builder);
 
-    // 3. Instantiate concrete workers (Halide only for now)
-    // Note: We assume WorkerBuilder::build returns the correct concrete type.
-    // For Halide, we create the specific worker instance.
-    m_halide_worker = std::make_unique<HalideOperationWorker>();
+    // 4. Instantiate concrete workers (Halide only for now)
+    // For Halide, we create the specific worker instance, bound to the scheduler.
+    m_halide_worker = std::make_unique<HalideOperationWorker>(*m_scheduler);
 
     if (!m_halide_worker) {
         spdlog::error("WorkerContext::WorkerContext: Failed to build Halide Worker.");
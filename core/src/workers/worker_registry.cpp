@@ -24,8 +24,8 @@ void WorkerRegistry::registerAll(WorkerBuilder& builder) {
 void WorkerRegistry::registerHalideWorkers(WorkerBuilder& builder) {
     spdlog::debug("WorkerRegistry: Registering Halide workers");
 
-    builder.registerCreator(WorkerType::HalideOperation, []() {
-        return std::make_unique<HalideOperationWorker>();
+    builder.registerCreator(WorkerType::HalideOperation, [](EngineScheduler& scheduler) {
+        return std::make_unique<HalideOperationWorker>(scheduler);
     });
     spdlog::trace("WorkerRegistry: Registered HalideOperationWorker");
 }
@@ -34,8 +34,8 @@ void WorkerRegistry::registerAIWorkers(WorkerBuilder& builder) {
     spdlog::debug("WorkerRegistry: Registering AI/Computer Vision workers");
 
     // Exemple: Sky Replacement
-    // builder.registerCreator(WorkerType::SkyAI, []() {
-    //     return std::make_unique<SkyReplacementWorker>();
+    // builder.registerCreator(WorkerType::SkyAI, [](EngineScheduler& scheduler) {
+    //     return std::make_unique<SkyReplacementWorker>(scheduler);
     // });
     // spdlog::trace("WorkerRegistry: Registered SkyReplacementWorker");
 }
@@ -74,7 +74,7 @@ OperationDescriptor createBrightnessOp(float value) {
     brightness.type = OperationType::Brightness;
     brightness.name = "Brightness(+" + std::to_string(value) + ")";
     brightness.enabled = true;
-    brightness.setParam("value", value);
+    brightness.setParam(Core::Operations::ParameterKey::Value, value);
     return brightness;
 }
 
@@ -0,0 +1,111 @@
+/**
+ * @file bindings.h
+ * @brief Shared declarations of the Python bindings (one `bind*` function per area).
+ *
+ * @details
+ * Conventions of the module:
+ * - Pixel buffers are handed to Python through the buffer protocol, never copied:
+ *   `numpy.asarray(region)` aliases the C++ storage, and the array keeps its owner alive.
+ * - Every call that decodes, processes or encodes releases the GIL, so a thread pool of
+ *   Python workers drives as many engines at once.
+ * - A `CoreError` result is raised as `capturemoment.CoreError` (see `unwrap`).
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/error_handling/core_error.h"
+
+#include <pybind11/pybind11.h>
+
+#include <magic_enum/magic_enum.hpp>
+
+#include <expected>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace CaptureMoment::Python {
+
+/**
+ * @brief C++ side of `capturemoment.CoreError`.
+ */
+class CoreErrorException : public std::runtime_error {
+public:
+    explicit CoreErrorException(Core::ErrorHandling::CoreError code)
+        : std::runtime_error(std::string(Core::ErrorHandling::to_string(code)))
+        , m_code(code)
+    {
+    }
+
+    /**
+     * @brief The error raised.
+     */
+    [[nodiscard]] Core::ErrorHandling::CoreError code() const noexcept { return m_code; }
+
+private:
+    /**
+     * @brief The error raised.
+     */
+    Core::ErrorHandling::CoreError m_code;
+};
+
+/**
+ * @brief Returns the value of a core result, or throws its error.
+ */
+template<typename T>
+[[nodiscard]] T unwrap(std::expected<T, Core::ErrorHandling::CoreError>&& result)
+{
+    if (!result) {
+        throw CoreErrorException(result.error());
+    }
+    return std::move(*result);
+}
+
+/**
+ * @brief Throws the error of a core result, if any.
+ */
+inline void unwrap(std::expected<void, Core::ErrorHandling::CoreError>&& result)
+{
+    if (!result) {
+        throw CoreErrorException(result.error());
+    }
+}
+
+/**
+ * @brief Binds every value of a scoped enumeration, under its C++ name.
+ */
+template<typename Enum>
+pybind11::enum_<Enum> bindEnum(pybind11::module_& module, const char* name, const char* doc = "")
+{
+    pybind11::enum_<Enum> binding(module, name, doc);
+    for (const auto& [value, value_name] : magic_enum::enum_entries<Enum>()) {
+        // pybind11 keeps the pointer: the names of magic_enum are static and null-terminated
+        binding.value(value_name.data(), value);
+    }
+    return binding;
+}
+
+/**
+ * @brief `ImageRegion` and `ImageView`, with their buffers.
+ */
+void bindImages(pybind11::module_& module);
+
+/**
+ * @brief `OperationType` and `OperationDescriptor`.
+ */
+void bindOperations(pybind11::module_& module);
+
+/**
+ * @brief `EngineScheduler`, `ProcessingOutcome` and `PhotoEngine`.
+ */
+void bindEngine(pybind11::module_& module);
+
+/**
+ * @brief `BatchExporter`, its settings, jobs and results, and the sidecar reader.
+ */
+void bindExport(pybind11::module_& module);
+
+} // namespace CaptureMoment::Python
@@ -0,0 +1,66 @@
+/**
+ * @file capturemoment_module.cpp
+ * @brief Entry point of the `capturemoment` Python module.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Typical batch script:
+ * @code{.py}
+ * import capturemoment as cm
+ * import numpy
+ * from concurrent.futures import ThreadPoolExecutor
+ *
+ * cm.initialize()
+ * scheduler = cm.EngineScheduler()
+ *
+ * def process(path):
+ *     engine = cm.PhotoEngine(scheduler)
+ *     engine.load_image(path)
+ *     exposure = cm.OperationDescriptor(cm.OperationType.Exposure, "Exposure")
+ *     exposure.set_param("value", 0.5)
+ *     engine.apply_operations([exposure])
+ *     pixels = numpy.asarray(engine.working_image_view())  # (height, width, channels), no copy
+ *     return pixels.mean()
+ *
+ * with ThreadPoolExecutor() as pool:
+ *     means = list(pool.map(process, paths))
+ * @endcode
+ */
+
+#include "bindings.h"
+
+#include "core_initialization.h"
+
+#include <pybind11/pybind11.h>
+
+#include <string>
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(capturemoment, module)
+{
+    using namespace CaptureMoment;
+
+    module.doc() = "CaptureMoment image processing core: engines, operations and batch export.";
+
+    py::register_exception<Python::CoreErrorException>(module, "CoreError", PyExc_RuntimeError);
+
+    module.def("initialize",
+               [](bool force_benchmark) {
+                   // The benchmark may run for seconds
+                   py::gil_scoped_release release;
+                   Core::initialize(force_benchmark);
+               },
+               py::arg("force_benchmark") = false,
+               "Registers the backends and selects the CPU or the GPU. Call once, before any engine or export.");
+
+    module.def("set_log_level",
+               [](const std::string& level) { Core::set_log_level(level.c_str()); },
+               py::arg("level"),
+               "Sets the log level of the core (trace, debug, info, warn, error, critical, off).");
+
+    Python::bindImages(module);
+    Python::bindOperations(module);
+    Python::bindEngine(module);
+    Python::bindExport(module);
+}
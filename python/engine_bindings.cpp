@@ -0,0 +1,114 @@
+/**
+ * @file engine_bindings.cpp
+ * @brief Python bindings of PhotoEngine and EngineScheduler.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * Every call that waits on the engine (decode, pass, export of the working image) releases the
+ * GIL first: engines driven from a Python thread pool process in parallel. The arguments are
+ * converted before the release, the results after the reacquisition.
+ */
+
+#include "bindings.h"
+
+#include "common/image_region.h"
+#include "common/image_view.h"
+#include "common/types/processing_outcome.h"
+#include "engine/photo_engine.h"
+#include "operations/parameter_snapshot.h"
+#include "workers/engine_scheduler.h"
+
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace CaptureMoment::Python {
+
+void bindEngine(py::module_& module)
+{
+    using Core::Engine::PhotoEngine;
+    using Core::Operations::OperationDescriptor;
+    using Core::Workers::EngineScheduler;
+
+    bindEnum<Core::Common::ProcessingOutcome>(module, "ProcessingOutcome", "How a processing request ended.");
+
+    py::class_<EngineScheduler, std::shared_ptr<EngineScheduler>>(module, "EngineScheduler",
+        "Thread pool shared by engines: one per process bounds the processing threads of a batch.")
+        .def(py::init<std::size_t>(), py::arg("thread_count") = EngineScheduler::k_default_thread_count);
+
+    py::class_<PhotoEngine>(module, "PhotoEngine",
+        "Loads one image and processes it. Drive an engine from one thread at a time; give each worker "
+        "of a pool its own engine.")
+        .def(py::init<std::shared_ptr<EngineScheduler>>(), py::arg("scheduler") = nullptr)
+        .def("load_image",
+             [](PhotoEngine& engine, const std::string& path) {
+                 py::gil_scoped_release release;
+                 unwrap(engine.loadImage(path));
+             },
+             py::arg("path"), "Decodes an image file; raises CoreError if it cannot be read.")
+        .def("create_virtual_copy",
+             [](const PhotoEngine& engine) {
+                 py::gil_scoped_release release;
+                 return unwrap(engine.createVirtualCopy());
+             },
+             "A new engine on the same decoded image (no second decode), with its own edits.")
+        .def("apply_operations",
+             [](PhotoEngine& engine, std::vector<OperationDescriptor> operations) {
+                 py::gil_scoped_release release;
+                 return engine.applyOperations(std::move(operations)).get();
+             },
+             py::arg("operations"), "Processes the working image with the operations and waits for the pass.")
+        .def("render",
+             [](PhotoEngine& engine, std::vector<OperationDescriptor> operations, Core::Common::ImageDim max_long_edge) {
+                 std::vector<Core::Common::ImageRegion> rendered;
+                 {
+                     py::gil_scoped_release release;
+                     rendered = unwrap(engine.renderVariants(std::move(operations), { Core::Operations::ParameterSnapshot{} },
+                                                             max_long_edge).get());
+                 }
+                 if (rendered.empty()) {
+                     throw CoreErrorException(Core::ErrorHandling::CoreError::Unexpected);
+                 }
+                 // Moved into the Python object: the pixels are not copied
+                 return std::make_shared<Core::Common::ImageRegion>(std::move(rendered.front()));
+             },
+             py::arg("operations"), py::arg("max_long_edge"),
+             "Renders the image with the operations, reduced to max_long_edge, leaving the working image untouched.")
+        .def("working_image_view",
+             [](const PhotoEngine& engine) {
+                 py::gil_scoped_release release;
+                 return unwrap(engine.getWorkingImageView());
+             },
+             "Read-only view over the working image (no copy).")
+        .def("working_image",
+             [](const PhotoEngine& engine) {
+                 py::gil_scoped_release release;
+                 return std::shared_ptr<Core::Common::ImageRegion>(unwrap(engine.getWorkingImageAsRegion()));
+             },
+             "Writable copy of the working image.")
+        .def("set_histogram_enabled", &PhotoEngine::setHistogramEnabled, py::arg("enabled"),
+             "Reduces a histogram during each pass (needed by suggest_auto_tone).")
+        .def("suggest_auto_tone",
+             [](const PhotoEngine& engine, std::vector<OperationDescriptor> operations) {
+                 return unwrap(engine.suggestAutoTone(std::move(operations)));
+             },
+             py::arg("operations"),
+             "The operations with Exposure, Contrast, Whites and Blacks balanced from the histogram of the last pass.")
+        .def("dump_pipeline_diagnostics",
+             [](const PhotoEngine& engine, const std::filesystem::path& directory) {
+                 py::gil_scoped_release release;
+                 return unwrap(engine.dumpPipelineDiagnostics(directory));
+             },
+             py::arg("directory"),
+             "Writes the lowered statement, schedule, target and bounds of the last pass to a subfolder "
+             "of directory, and returns that subfolder.")
+        .def("cancel", &PhotoEngine::cancelProcessing, "Cancels the running and pending passes.");
+}
+
+} // namespace CaptureMoment::Python
@@ -0,0 +1,150 @@
+/**
+ * @file export_bindings.cpp
+ * @brief Python bindings of BatchExporter and of the sidecar reader.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bindings.h"
+
+#include "export/batch_exporter.h"
+#include "serializer/file_serializer_manager.h"
+#include "serializer/file_serializer_reader.h"
+#include "serializer/file_serializer_writer.h"
+#include "serializer/provider/exiv2_provider.h"
+#include "serializer/strategy/sidecar_xmp_path_strategy.h"
+#include "utils/quantize.h"
+
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+#include <pybind11/stl/filesystem.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace CaptureMoment::Python {
+
+namespace {
+
+using Core::Export::BatchExporter;
+using Core::Export::ExportJob;
+using Core::Export::ExportRendition;
+using Core::Export::ExportResult;
+using Core::Export::ExportSettings;
+using Core::Operations::OperationDescriptor;
+
+/**
+ * @brief Reads the edits saved in the XMP sidecars of the files (empty for a file without any).
+ */
+[[nodiscard]] std::vector<std::vector<OperationDescriptor>> readEdits(const std::vector<std::string>& paths)
+{
+    std::vector<std::vector<OperationDescriptor>> edits(paths.size());
+
+    const Core::Serializer::FileSerializerManager serializer(
+        std::make_unique<Core::Serializer::FileSerializerWriter>(
+            std::make_unique<Core::Serializer::Exiv2Provider>(),
+            std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()),
+        std::make_unique<Core::Serializer::FileSerializerReader>(
+            std::make_unique<Core::Serializer::Exiv2Provider>(),
+            std::make_unique<Core::Serializer::SidecarXmpPathStrategy>()));
+
+    // The callback runs on the reader's threads, one call at a time
+    serializer.loadFromFiles(paths, [&edits](std::size_t index, std::vector<OperationDescriptor> operations) {
+        edits[index] = std::move(operations);
+    });
+    return edits;
+}
+
+} // anonymous namespace
+
+void bindExport(py::module_& module)
+{
+    bindEnum<Core::Export::ExportFormat>(module, "ExportFormat", "Encoded format of exported files.");
+    bindEnum<Core::Utils::DitherMode>(module, "DitherMode", "Dithering of 8-bit exports.");
+
+    py::class_<ExportRendition>(module, "ExportRendition",
+        "An extra output of every file (e.g. a web JPEG), rendered from the same processing pass.")
+        .def(py::init([](std::string suffix, Core::Export::ExportFormat format, int jpeg_quality,
+                         Core::Common::ImageDim max_long_edge) {
+                 return ExportRendition { std::move(suffix), format, jpeg_quality, max_long_edge };
+             }),
+             py::arg("suffix"), py::arg("format") = Core::Export::ExportFormat::Jpeg, py::arg("jpeg_quality") = 92,
+             py::arg("max_long_edge") = 0)
+        .def_readwrite("suffix", &ExportRendition::m_suffix)
+        .def_readwrite("format", &ExportRendition::m_format)
+        .def_readwrite("jpeg_quality", &ExportRendition::m_jpeg_quality)
+        .def_readwrite("max_long_edge", &ExportRendition::m_max_long_edge);
+
+    py::class_<ExportSettings>(module, "ExportSettings", "Output settings shared by every file of an export.")
+        .def(py::init<>())
+        .def_readwrite("format", &ExportSettings::m_format)
+        .def_readwrite("jpeg_quality", &ExportSettings::m_jpeg_quality)
+        .def_readwrite("dither", &ExportSettings::m_dither)
+        .def_readwrite("max_long_edge", &ExportSettings::m_max_long_edge)
+        .def_readwrite("output_directory", &ExportSettings::m_output_directory)
+        .def_readwrite("overwrite", &ExportSettings::m_overwrite)
+        .def_readwrite("renditions", &ExportSettings::m_renditions);
+
+    py::class_<ExportJob>(module, "ExportJob", "One file to export and the operations it is processed with.")
+        .def(py::init([](std::string source_path, std::vector<OperationDescriptor> operations) {
+                 return ExportJob { std::move(source_path), std::move(operations) };
+             }),
+             py::arg("source_path"), py::arg("operations") = std::vector<OperationDescriptor>{})
+        .def_readwrite("source_path", &ExportJob::m_source_path)
+        .def_readwrite("operations", &ExportJob::m_operations);
+
+    py::class_<ExportResult>(module, "ExportResult", "Outcome of one exported file.")
+        .def_readonly("source_path", &ExportResult::m_source_path)
+        .def_readonly("output_path", &ExportResult::m_output_path)
+        .def_readonly("rendition_paths", &ExportResult::m_rendition_paths)
+        .def_property_readonly("ok", [](const ExportResult& result) { return result.m_status.has_value(); })
+        .def_property_readonly("error", [](const ExportResult& result) -> py::object {
+            if (result.m_status) {
+                return py::none();
+            }
+            return py::str(std::string(Core::ErrorHandling::to_string(result.m_status.error())));
+        });
+
+    py::class_<BatchExporter>(module, "BatchExporter",
+        "Decodes, processes and encodes many files, stages overlapping, within a memory budget.")
+        .def(py::init<std::size_t, std::size_t>(),
+             py::arg("memory_budget_bytes") = BatchExporter::k_default_memory_budget_bytes,
+             py::arg("encode_threads") = 0)
+        .def("run",
+             [](BatchExporter& exporter, const std::vector<ExportJob>& jobs, const ExportSettings& settings,
+                const std::function<void(std::size_t, const ExportResult&)>& on_progress) {
+                 BatchExporter::ProgressCallback progress;
+                 if (on_progress) {
+                     // Called on an export thread: the GIL is taken for the call only
+                     progress = [&on_progress](std::size_t index, const ExportResult& result) {
+                         py::gil_scoped_acquire acquire;
+                         try {
+                             on_progress(index, result);
+                         } catch (py::error_already_set& error) {
+                             // An export thread cannot propagate it: reported like an unraisable hook error
+                             error.discard_as_unraisable("capturemoment.BatchExporter.run progress callback");
+                         }
+                     };
+                 }
+                 py::gil_scoped_release release;
+                 return exporter.run(jobs, settings, progress);
+             },
+             py::arg("jobs"), py::arg("settings"), py::arg("on_progress") = nullptr,
+             "Exports the files and returns one ExportResult per job, in order. on_progress(index, result) "
+             "is called as each file completes, from an export thread.")
+        .def_property_readonly("processor_count", &BatchExporter::processorCount);
+
+    module.def("read_edits",
+               [](const std::vector<std::string>& paths) {
+                   py::gil_scoped_release release;
+                   return readEdits(paths);
+               },
+               py::arg("paths"),
+               "Reads the operations saved in the XMP sidecars of the files (an empty list for a file without edits).");
+}
+
+} // namespace CaptureMoment::Python
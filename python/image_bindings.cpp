@@ -0,0 +1,80 @@
+/**
+ * @file image_bindings.cpp
+ * @brief Python bindings of ImageRegion and ImageView (buffer protocol, no copy).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bindings.h"
+
+#include "common/image_region.h"
+#include "common/image_view.h"
+
+#include <memory>
+#include <string>
+
+namespace py = pybind11;
+
+namespace CaptureMoment::Python {
+
+namespace {
+
+constexpr auto k_float_size { static_cast<py::ssize_t>(sizeof(float)) };
+
+} // anonymous namespace
+
+void bindImages(py::module_& module)
+{
+    using Core::Common::ImageRegion;
+    using Core::Common::ImageView;
+
+    // ============================================================
+    // ImageRegion: owned, writable pixels (shared with the arrays made from it)
+    // ============================================================
+    py::class_<ImageRegion, std::shared_ptr<ImageRegion>>(module, "ImageRegion", py::buffer_protocol(),
+        "Float pixels owned by the region. numpy.asarray(region) is a writable (height, width, channels) "
+        "float32 array over the same memory.")
+        .def_property_readonly("width", &ImageRegion::width)
+        .def_property_readonly("height", &ImageRegion::height)
+        .def_property_readonly("channels", &ImageRegion::channels)
+        .def_property_readonly("x", &ImageRegion::x)
+        .def_property_readonly("y", &ImageRegion::y)
+        .def_buffer([](ImageRegion& region) {
+            const auto channels { static_cast<py::ssize_t>(region.m_channels) };
+            const auto width { static_cast<py::ssize_t>(region.m_width) };
+            return py::buffer_info(region.m_data.data(), k_float_size, py::format_descriptor<float>::format(), 3,
+                                   { static_cast<py::ssize_t>(region.m_height), width, channels },
+                                   { width * channels * k_float_size, channels * k_float_size, k_float_size });
+        })
+        .def("__repr__", [](const ImageRegion& region) {
+            return "<ImageRegion " + std::to_string(region.m_width) + "x" + std::to_string(region.m_height)
+                   + "x" + std::to_string(region.m_channels) + ">";
+        });
+
+    // ============================================================
+    // ImageView: read-only window on the storage of a working image
+    // ============================================================
+    py::class_<ImageView>(module, "ImageView", py::buffer_protocol(),
+        "Read-only view over the pixels of a working image. numpy.asarray(view) is a read-only "
+        "(height, width, channels) float32 array over the engine's own storage, kept alive by the array; "
+        "processing the image again is visible through it.")
+        .def_readonly("width", &ImageView::m_width)
+        .def_readonly("height", &ImageView::m_height)
+        .def_readonly("channels", &ImageView::m_channels)
+        .def_buffer([](const ImageView& view) {
+            return py::buffer_info(const_cast<float*>(view.m_data.data()), k_float_size,
+                                   py::format_descriptor<float>::format(), 3,
+                                   { static_cast<py::ssize_t>(view.m_height), static_cast<py::ssize_t>(view.m_width),
+                                     static_cast<py::ssize_t>(view.m_channels) },
+                                   { static_cast<py::ssize_t>(view.m_y_stride) * k_float_size,
+                                     static_cast<py::ssize_t>(view.m_x_stride) * k_float_size,
+                                     static_cast<py::ssize_t>(view.m_c_stride) * k_float_size },
+                                   /* readonly */ true);
+        })
+        .def("__repr__", [](const ImageView& view) {
+            return "<ImageView " + std::to_string(view.m_width) + "x" + std::to_string(view.m_height)
+                   + "x" + std::to_string(view.m_channels) + ">";
+        });
+}
+
+} // namespace CaptureMoment::Python
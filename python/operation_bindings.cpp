@@ -0,0 +1,125 @@
+/**
+ * @file operation_bindings.cpp
+ * @brief Python bindings of OperationType and OperationDescriptor.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "bindings.h"
+
+#include "operations/operation_descriptor.h"
+#include "operations/operation_type.h"
+#include "operations/parameter_key.h"
+
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace py = pybind11;
+
+namespace CaptureMoment::Python {
+
+namespace {
+
+using Core::Operations::OperationDescriptor;
+using Core::Operations::OperationValue;
+using Core::Operations::ParameterKey;
+using Core::Operations::ParameterKeys;
+
+/**
+ * @brief Key of a parameter name, or `KeyError`.
+ */
+[[nodiscard]] ParameterKey keyOf(const std::string& name)
+{
+    const auto key { ParameterKeys::find(name) };
+    if (!key) {
+        throw py::key_error("Unknown parameter '" + name + "'");
+    }
+    return *key;
+}
+
+/**
+ * @brief The Python object of a parameter value (float, int, bool or str).
+ */
+[[nodiscard]] py::object toPython(const OperationValue& value)
+{
+    return std::visit([](const auto& alternative) -> py::object { return py::cast(alternative); }, value);
+}
+
+/**
+ * @brief The parameter value of a Python object.
+ *
+ * @details `bool` is tested before `int` (a Python bool is an int), and an int stays an int:
+ * the kernels read each parameter as the alternative its operation declares.
+ */
+[[nodiscard]] OperationValue fromPython(const py::handle& object)
+{
+    if (py::isinstance<py::bool_>(object)) {
+        return object.cast<bool>();
+    }
+    if (py::isinstance<py::int_>(object)) {
+        return object.cast<int>();
+    }
+    if (py::isinstance<py::float_>(object)) {
+        return object.cast<float>();
+    }
+    if (py::isinstance<py::str>(object)) {
+        return object.cast<std::string>();
+    }
+    throw py::type_error("Parameter values are float, int, bool or str");
+}
+
+} // anonymous namespace
+
+void bindOperations(py::module_& module)
+{
+    bindEnum<Core::Operations::OperationType>(module, "OperationType", "Type of an image operation.");
+
+    py::class_<OperationDescriptor>(module, "OperationDescriptor",
+        "One operation of an edit stack: its type, state and parameters. Lists of descriptors are copied "
+        "to and from Python.")
+        .def(py::init([](Core::Operations::OperationType type, std::string name, bool enabled) {
+                 OperationDescriptor descriptor;
+                 descriptor.id = OperationDescriptor::generateId();
+                 descriptor.type = type;
+                 descriptor.name = std::move(name);
+                 descriptor.enabled = enabled;
+                 return descriptor;
+             }),
+             py::arg("type"), py::arg("name") = "", py::arg("enabled") = true)
+        .def_readonly("id", &OperationDescriptor::id)
+        .def_readwrite("type", &OperationDescriptor::type)
+        .def_readwrite("name", &OperationDescriptor::name)
+        .def_readwrite("enabled", &OperationDescriptor::enabled)
+        .def("set_param",
+             [](OperationDescriptor& descriptor, const std::string& name, const py::handle& value) {
+                 descriptor.params.set(keyOf(name), fromPython(value));
+             },
+             py::arg("name"), py::arg("value"), "Sets a parameter (e.g. \"value\"); raises KeyError for an unknown name. The Python type is kept: "
+             "pass 1.0, not 1, to a float parameter.")
+        .def("get_param",
+             [](const OperationDescriptor& descriptor, const std::string& name) -> py::object {
+                 const OperationValue* value { descriptor.params.find(keyOf(name)) };
+                 return value ? toPython(*value) : py::none();
+             },
+             py::arg("name"), "Returns a parameter, or None if it is not set.")
+        .def_property_readonly("params",
+             [](const OperationDescriptor& descriptor) {
+                 py::dict params;
+                 descriptor.params.forEach([&params](ParameterKey key, const OperationValue& value) {
+                     params[py::str(std::string(ParameterKeys::name(key)))] = toPython(value);
+                 });
+                 return params;
+             },
+             "The set parameters, by name (a copy).")
+        .def(py::self == py::self)
+        .def("__repr__", [](const OperationDescriptor& descriptor) {
+            return "<OperationDescriptor " + std::string(magic_enum::enum_name(descriptor.type)) + " '" + descriptor.name
+                   + "'" + (descriptor.enabled ? "" : " disabled") + ">";
+        });
+}
+
+} // namespace CaptureMoment::Python
@@ -0,0 +1,102 @@
+/**
+ * @file thumbnail_image_provider.h
+ * @brief Asynchronous QML image provider of the browser thumbnails (`image://thumbnails/<path>`).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QQuickAsyncImageProvider>
+#include <QSize>
+#include <QString>
+#include <QThreadPool>
+#include <QUrl>
+
+#include <atomic>
+#include <memory>
+
+namespace CaptureMoment::Core::Thumbnails {
+class ThumbnailService;
+}
+
+namespace CaptureMoment::UI {
+
+namespace Browser {
+
+/**
+ * @class ThumbnailImageProvider
+ * @brief Serves `ThumbnailService` thumbnails to QML `Image` items, decoded off the GUI thread.
+ *
+ * @details
+ * Built for grids of thousands of cells scrolled at full speed:
+ * - **Off the GUI thread**: the cache lookup (or render) and the JPEG decode run on the
+ *   provider's pool. The decode is scaled to the item's `sourceSize` by the JPEG decoder itself
+ *   (DCT scaling), so a 512 px thumbnail shown in a 128 px cell is never decoded at 512 px.
+ * - **Visible cells first**: requests are started newest first. While scrolling, the cells now
+ *   on screen were requested last and overtake those the view has already passed.
+ * - **Cancellation**: a cell scrolled out of view (its delegate destroyed) cancels its request.
+ *   A queued request then ends as soon as it is picked, without a lookup, and a running render
+ *   stops before its next step.
+ *
+ * Register it once with `QQmlEngine::addImageProvider(k_provider_id, ...)`, which takes ownership.
+ */
+class ThumbnailImageProvider : public QQuickAsyncImageProvider {
+public:
+    /**
+     * @brief Host part of the image URLs (`image://thumbnails/...`).
+     */
+    static constexpr const char* k_provider_id { "thumbnails" };
+
+    /**
+     * @brief Default number of thumbnails served at once (cache hits mostly: the pool is
+     *        bound by the JPEG decodes).
+     */
+    static constexpr int k_default_worker_count { 4 };
+
+    /**
+     * @brief Creates the provider.
+     * @param service Renders and caches the thumbnails (shared with the rest of the application).
+     * @param worker_count Thumbnails served at once.
+     */
+    explicit ThumbnailImageProvider(std::shared_ptr<Core::Thumbnails::ThumbnailService> service,
+                                    int worker_count = k_default_worker_count);
+
+    /**
+     * @brief Drops the queued requests and waits for the running ones.
+     */
+    ~ThumbnailImageProvider() override;
+
+    ThumbnailImageProvider(const ThumbnailImageProvider&) = delete;
+    ThumbnailImageProvider& operator=(const ThumbnailImageProvider&) = delete;
+
+    /**
+     * @brief Starts serving the thumbnail of `id` (a percent-encoded file path).
+     */
+    [[nodiscard]] QQuickImageResponse* requestImageResponse(const QString& id, const QSize& requested_size) override;
+
+    /**
+     * @brief URL of the thumbnail of a file, for the `source` of a QML `Image`.
+     */
+    [[nodiscard]] static QUrl sourceUrl(const QString& path);
+
+private:
+    /**
+     * @brief Renders and caches the thumbnails.
+     */
+    std::shared_ptr<Core::Thumbnails::ThumbnailService> m_service;
+
+    /**
+     * @brief Serves the requests (newest first).
+     */
+    QThreadPool m_pool;
+
+    /**
+     * @brief Priority of the next request: each one is higher than the previous.
+     */
+    std::atomic<int> m_sequence{0};
+};
+
+} // namespace Browser
+
+} // namespace CaptureMoment::UI
@@ -0,0 +1,168 @@
+/**
+ * @file adaptive_preview_quality.h
+ * @brief Lowers the preview proxy resolution while interactive previews miss their frame budget.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QSize>
+
+#include <array>
+#include <cstddef>
+
+namespace CaptureMoment::UI {
+
+namespace Controller {
+
+/**
+ * @class AdaptivePreviewQuality
+ * @brief Picks the scale of the preview proxy from the measured processing time of the previews.
+ *
+ * @details
+ * The proxy is prepared at the display size, which keeps a slider smooth on most machines but
+ * not on a slow CPU, a large window or a heavy operation stack. Each finished preview reports its
+ * processing time (`recordPreview`):
+ * - after `k_slow_samples` consecutive previews over the frame budget, the proxy drops one
+ *   level (half the pixels);
+ * - after `k_fast_samples` consecutive previews that would still fit the budget one level up
+ *   (with `k_headroom`), it climbs back one level.
+ * A single slow preview (a pipeline compilation, a cache miss) changes nothing, and a level
+ * change restarts the counts, so the proxy does not oscillate.
+ *
+ * When a gesture starts, the engine's prediction of the chain (`Core::PhotoEngine::estimateRenderMilliseconds`)
+ * can lower the proxy at once (`predictPreview`): a heavy chain (noise reduction, clarity)
+ * starts at a level it can afford instead of dropping after its first slow frames. The
+ * measurements then take over, climbing back if the prediction was pessimistic.
+ *
+ * `restore` returns to full quality once input is idle: the full-resolution pass replaces the
+ * display anyway, and the next interaction starts from the display size again. Full quality
+ * is the scale ceiling of the energy plan (`Core::Config::EnergyPlan::m_proxy_scale`), the
+ * display size unless the plan saves power.
+ *
+ * Not thread-safe: used from the controller's worker thread only, where previews are run.
+ */
+class AdaptivePreviewQuality {
+public:
+    /**
+     * @brief Frame budget of an interactive preview by default (30 frames per second).
+     */
+    static constexpr double k_default_frame_budget_ms { 33.0 };
+
+    /**
+     * @brief Proxy scales, relative to the display size: each level halves the pixels.
+     */
+    static constexpr std::array k_levels { 1.0, 0.7071, 0.5, 0.3536, 0.25 };
+
+    /**
+     * @brief Consecutive previews over budget before the proxy drops one level.
+     */
+    static constexpr int k_slow_samples { 3 };
+
+    /**
+     * @brief Consecutive previews within budget one level up before the proxy climbs back.
+     */
+    static constexpr int k_fast_samples { 6 };
+
+    /**
+     * @brief Share of the budget the predicted time one level up must stay under.
+     */
+    static constexpr double k_headroom { 0.75 };
+
+    /**
+     * @brief Long edge under which the proxy is not reduced further, in pixels.
+     */
+    static constexpr int k_min_long_edge { 320 };
+
+    /**
+     * @brief Constructs the controller at full quality.
+     * @param frame_budget_ms Processing time a preview should stay under (16 for 60 fps, 33 for 30 fps).
+     */
+    explicit AdaptivePreviewQuality(double frame_budget_ms = k_default_frame_budget_ms) noexcept;
+
+    /**
+     * @brief Sets the full-quality proxy size (the display size it was prepared at) and restores full quality.
+     */
+    void setFullSize(QSize size) noexcept;
+
+    /**
+     * @brief Sets the largest scale of the proxy (snapped down to a level).
+     * @return true if the proxy level changed: prepare the proxy at `proxySize()`.
+     */
+    [[nodiscard]] bool setScaleCeiling(double scale) noexcept;
+
+    /**
+     * @brief Records the processing time of a finished preview.
+     * @return true if the proxy level changed: prepare the proxy at `proxySize()`.
+     */
+    [[nodiscard]] bool recordPreview(double processing_ms) noexcept;
+
+    /**
+     * @brief Lowers the proxy to the first level the predicted processing time fits the budget at.
+     * @param predicted_ms Predicted processing time at the current `proxySize()`.
+     * @return true if the proxy level changed: prepare the proxy at `proxySize()`.
+     */
+    [[nodiscard]] bool predictPreview(double predicted_ms) noexcept;
+
+    /**
+     * @brief Returns to the scale ceiling and restarts the measurements.
+     * @return true if the proxy level changed: prepare it at `proxySize()` again.
+     */
+    [[nodiscard]] bool restore() noexcept;
+
+    /**
+     * @brief Size the proxy should have at the current level (empty before `setFullSize`).
+     */
+    [[nodiscard]] QSize proxySize() const noexcept;
+
+    /**
+     * @brief true while the proxy is reduced.
+     */
+    [[nodiscard]] bool isReduced() const noexcept { return m_level > 0; }
+
+private:
+    /**
+     * @brief Size of the proxy at `level`.
+     */
+    [[nodiscard]] QSize sizeAt(std::size_t level) const noexcept;
+
+    /**
+     * @brief Moves to `level` and restarts the counts.
+     */
+    void changeLevel(std::size_t level) noexcept;
+
+    /**
+     * @brief Processing time a preview should stay under.
+     */
+    double m_frame_budget_ms;
+
+    /**
+     * @brief Proxy size at full quality.
+     */
+    QSize m_full_size;
+
+    /**
+     * @brief Index in `k_levels` of the current scale.
+     */
+    std::size_t m_level { 0 };
+
+    /**
+     * @brief Index in `k_levels` of the largest scale allowed.
+     */
+    std::size_t m_ceiling { 0 };
+
+    /**
+     * @brief Consecutive previews over budget at the current level.
+     */
+    int m_slow_count { 0 };
+
+    /**
+     * @brief Consecutive previews that would fit the budget one level up.
+     */
+    int m_fast_count { 0 };
+};
+
+} // namespace Controller
+
+} // namespace CaptureMoment::UI
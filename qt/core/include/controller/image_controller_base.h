@@ -8,11 +8,27 @@
 #pragma once
 
 #include <QObject>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <future>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <QSize>
 #include <QThread>
+#include <QTimer>
 #include <QUrl>
 
+#include "controller/adaptive_preview_quality.h"
+#include "controller/submission_pacer.h"
+#include "controller/performance_monitor.h"
 #include "engine/photo_engine.h"
+#include "operations/edit_history.h"
+#include "operations/parameter_snapshot.h"
+#include "serializer/session_snapshot.h"
 #include "models/operations/i_operation_model.h"
 #include "display/display_manager.h"
 #include "managers/operation_state_manager.h"
@@ -59,6 +75,17 @@ class ImageControllerBase : public QObject {
      */
     Q_PROPERTY(CaptureMoment::UI::Managers::OperationStateManager* operationStateManager READ operationStateManager CONSTANT)
 
+    /**
+     * @property performanceMonitor
+     * @brief Exposes the PerformanceMonitor feeding the performance overlay to QML.
+     */
+    Q_PROPERTY(CaptureMoment::UI::Controller::PerformanceMonitor* performanceMonitor READ performanceMonitor CONSTANT)
+
+    /** @property canUndo true if an earlier edit state exists. */
+    Q_PROPERTY(bool canUndo READ canUndo NOTIFY historyChanged)
+    /** @property canRedo true if an undone edit state can be restored. */
+    Q_PROPERTY(bool canRedo READ canRedo NOTIFY historyChanged)
+
 public:
     /**
      * @brief Constructs ImageController
@@ -81,6 +108,16 @@ public:
      */
     [[nodiscard]] int imageHeight() const noexcept { return m_image_height; }
 
+    /**
+     * @brief true if an earlier edit state exists
+     */
+    [[nodiscard]] bool canUndo() const noexcept { return m_edit_history.canUndo(); }
+
+    /**
+     * @brief true if an undone edit state can be restored
+     */
+    [[nodiscard]] bool canRedo() const noexcept { return m_edit_history.canRedo(); }
+
     /**
      * @brief Register an operation model for notifications
      *
@@ -92,6 +129,14 @@ public:
      */
     void registerModel(IOperationModel* model);
 
+    /**
+     * @brief Compiles the pipeline of the operations an image is being opened with (any thread).
+     * @details Forwards to `PhotoEngine::warmUpPipeline`, which does not block; typically called
+     *          once the image's sidecar is parsed, while the image decodes.
+     * @param operations The operations read from the sidecar.
+     */
+    void warmUpPipeline(std::vector<Core::Operations::OperationDescriptor> operations);
+
     /**
      * @brief Get current displayManager instance
      */
@@ -102,6 +147,11 @@ public:
      */
     [[nodiscard]] CaptureMoment::UI::Managers::OperationStateManager* operationStateManager() { return m_operation_state_manager.get(); }
 
+    /**
+     * @brief Get the performance monitor (engine, memory and render statistics)
+     */
+    [[nodiscard]] PerformanceMonitor* performanceMonitor() { return m_performance_monitor.get(); }
+
     /**
      * @brief Get current operationModelManager instance
      */
@@ -110,18 +160,140 @@ public:
     /**
      * @brief Perform actual image load (runs on worker thread).
      * This method contains the common logic for loading and updating the display.
+     * The display size is then picked on the GUI thread, which continues with `doPrepareLoadedImage`.
      * @param file_path Path to the image file to load.
      */
     void doLoadImage(const QString& file_path);
 
+    /**
+     * @brief Second half of a load (runs on worker thread): display image and preview proxy.
+     * @param downsample_size Display size picked by the DisplayManager for the new image.
+     * @param keep_displayed true to leave the displayed image (a restored session's preview)
+     *        until the edits render: only the unedited copy is handed over.
+     */
+    void doPrepareLoadedImage(QSize downsample_size, bool keep_displayed = false);
+
+    /**
+     * @brief Swaps the full-quality image in for the preview it was loaded with (runs on worker thread).
+     * Then continues like a load, and re-applies the active operations.
+     * @param file_path Path notified by the engine's refined callback.
+     */
+    void doAdoptRefinedImage(const std::string& file_path);
+
+    /**
+     * @brief Renders the session's preview from the working image and writes the session (runs on worker thread).
+     * @param snapshot The session, without its preview (filled on the GUI thread).
+     * @param preview_size Size of the preview, the current display size.
+     */
+    void doSaveSession(Core::Serializer::SessionSnapshot snapshot, QSize preview_size);
+
+    /**
+     * @brief Publishes the loaded image size on the GUI thread, then continues with `doPrepareLoadedImage`.
+     * @param reapply_operations true to re-apply the active operations once the image is prepared.
+     */
+    void publishLoadedImage(bool reapply_operations);
+
     /**
      * @brief Perform actual operations (runs on worker thread).
      * @details
      * This method contains the common logic for applying operations and updating the display.
      * Takes ownership of the operations to allow zero-copy transfer to the engine.
+     * Blocks the worker thread on the request; the display image and the result are posted
+     * back to this object's (GUI) thread.
      * @param operations Vector of operation descriptors (moved)
+     * @param display_size Display size, read on the GUI thread when the request was made.
+     * @param preview If true, only the preview proxy is processed (interactive path).
+     * @param history_state Edit history state the operations render (0: none); its cached
+     *        preview is the resulting display image.
+     */
+    void doApplyOperations(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                           QSize display_size, bool preview = false, std::uint64_t history_state = 0);
+
+    /**
+     * @brief Ends a slider gesture and displays its full-quality refine (runs on worker thread).
+     * @details
+     * The engine refines the edits of the gesture (`PhotoEngine::endInteraction`); if it
+     * submitted none (a click, or a tick the pacer had not run yet), `operations` are applied
+     * at full resolution instead.
+     * @param operations The active operations, read on the GUI thread when the control was released.
+     * @param display_size Display size, read on the GUI thread as well.
+     * @param history_state Edit history state the operations render (0: none).
+     */
+    void doFinishInteraction(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                             QSize display_size, std::uint64_t history_state);
+
+    /**
+     * @brief Waits for a request and displays its result (runs on worker thread).
+     * @param apply_future Future of the request.
+     * @param display_size Display size the request renders.
+     * @param preview true for a preview proxy request (its time feeds `m_preview_quality`).
+     * @param history_state Edit history state the request renders (0: none).
+     * @param submitted_at When the request was submitted.
+     */
+    void presentProcessingOutcome(std::future<Core::Common::ProcessingOutcome> apply_future, QSize display_size,
+                                  bool preview, std::uint64_t history_state,
+                                  std::chrono::steady_clock::time_point submitted_at);
+
+    /**
+     * @brief Brings the preview proxy back to full quality once input is idle (runs on worker thread).
      */
-    void doApplyOperations(std::vector<Core::Operations::OperationDescriptor>&& operations);
+    void doRestorePreviewQuality();
+
+    /**
+     * @brief Lowers the preview proxy to what the engine predicts the active operations can afford (runs on worker thread).
+     */
+    void doPredictPreviewQuality();
+
+    /**
+     * @brief Prepares the preview proxy again at the size picked by `m_preview_quality`, if it changed (runs on worker thread).
+     */
+    void doResizePreviewProxy();
+
+    /**
+     * @brief Downsamples the current image again for a new display size (runs on worker thread).
+     * @details The working image already holds the current state: no pass runs. Skipped if a
+     *          newer refresh was requested meanwhile.
+     * @param display_size Display size requested by the DisplayManager.
+     * @param serial Value of `m_display_refresh_serial` when the refresh was requested.
+     */
+    void doRefreshDisplayImage(QSize display_size, std::uint64_t serial);
+
+    /**
+     * @brief Perform operations progressively (runs on worker thread).
+     * @details
+     * Submits a progressive request: the proxy preview replaces the display image, then
+     * each refined band is merged with `DisplayManager::updateDisplayTile`. The engine
+     * callbacks (images and outcome) are forwarded to this object's thread; the call does
+     * not block, so the tiles are displayed as they complete.
+     * @param operations Vector of operation descriptors (moved)
+     * @param display_size Display size, read on the GUI thread when the request was made.
+     */
+    void doApplyProgressiveOperations(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                                      QSize display_size);
+
+    /**
+     * @brief Extracts deep-zoom pyramid tiles from the working image (runs on worker thread).
+     * @details
+     * Each tile is box-filtered from the full-resolution working image at its level, then
+     * handed to `DisplayManager::addDisplayTile` on the GUI thread.
+     * @param generation Request generation, passed back with each tile.
+     * @param tiles The tiles and the source area each one covers (computed on the GUI thread).
+     */
+    void doExtractDisplayTiles(quint64 generation,
+                               std::vector<std::pair<Display::TileKey, QRect>> tiles);
+
+    /**
+     * @brief Extracts pan-ahead tiles one at a time at low priority (runs on worker thread).
+     * @details
+     * Extracts the first tile, then queues itself again for the rest: visible tiles, previews
+     * and other work posted meanwhile run in between. Stops once a newer prefetch was requested
+     * (the motion changed).
+     * @param generation Request generation, passed back with each tile.
+     * @param serial Value of `m_tile_prefetch_serial` when the prefetch was requested.
+     * @param tiles The tiles left, nearest to the view first.
+     */
+    void doPrefetchDisplayTiles(quint64 generation, std::uint64_t serial,
+                                std::vector<std::pair<Display::TileKey, QRect>> tiles);
 
     /**
      * @brief Loads an image from a QUrl (typically from QML FileDialog).
@@ -130,12 +302,113 @@ public:
      */
     Q_INVOKABLE void loadImageFromUrl(const QUrl& file_url);
 
+    /**
+     * @brief Paces the preview runs on the frames of the window displaying the image.
+     * @param window Window of the viewport (nullptr: paced by a timer at a nominal frame rate).
+     */
+    Q_INVOKABLE void setPacingWindow(QQuickWindow* window);
+
+    /**
+     * @brief Shows the session saved by the last launch at once, then loads its image behind it.
+     * @details The saved preview is displayed with the saved viewport; the image then loads
+     *          (with its pipeline warmed up), and the saved edits render over the preview.
+     * @return false if there is no session, or its image no longer exists.
+     */
+    Q_INVOKABLE bool restoreSession();
+
+    /**
+     * @brief Saves the session for the next launch: open image, edits, viewport and preview.
+     * @details Gathered here, written on the worker thread. Also saved a short while after each
+     *          load or settled edit, and when the controller is destroyed.
+     */
+    Q_INVOKABLE void saveSession();
+
+    /**
+     * @brief Restores the previous edit state.
+     * @details Its cached preview is displayed at once; the full-resolution pass runs once
+     *          stepping stops, like after an edit.
+     */
+    Q_INVOKABLE void undo();
+
+    /**
+     * @brief Restores the next edit state (see `undo()`).
+     */
+    Q_INVOKABLE void redo();
+
+    /**
+     * @brief Sets Exposure, Contrast, Whites and Blacks to the engine's suggestion ("Auto").
+     * @details Read off the histogram of the displayed image (`PhotoEngine::suggestAutoTone`):
+     *          no extra pass. Recorded as one edit state, undone like any other.
+     */
+    Q_INVOKABLE void autoTone();
+
+    /**
+     * @brief Starts a batch of slider changes: a preset, "reset all" (GUI thread).
+     * @details Until the matching `commitParameterTransaction()`, the changes of the models are
+     *          staged (`OperationModelManager` and `OperationStateManager` transactions): no
+     *          preview, no published value, no engine run. Transactions nest.
+     */
+    Q_INVOKABLE void beginParameterTransaction();
+
+    /**
+     * @brief Ends a batch of slider changes (GUI thread).
+     * @details The outermost commit publishes one parameter snapshot, records one edit state
+     *          and submits one full-resolution request for all the changes.
+     */
+    Q_INVOKABLE void commitParameterTransaction();
+
 private :
     /**
      * @brief Worker thread for non-blocking operations
      */
     QThread m_worker_thread;
 
+    /**
+     * @brief Context object living on `m_worker_thread`: the engine calls are queued to it.
+     * @details Declared after the thread: destroyed first, once the thread has stopped.
+     */
+    QObject m_worker_context;
+
+    /**
+     * @brief Display size chosen by the DisplayManager (GUI thread only).
+     */
+    [[nodiscard]] QSize currentDisplaySize() const;
+
+    /**
+     * @brief The session to save: open image, edits with their published values, viewport (GUI thread only).
+     * @details The preview is rendered by `doSaveSession`.
+     */
+    [[nodiscard]] Core::Serializer::SessionSnapshot currentSession() const;
+
+    /**
+     * @brief Posts a downsampled display image to the DisplayManager on the GUI thread.
+     *
+     * @param image The display image (nullptr: the displayed one stays).
+     * @param original The unedited display image for before/after comparison, if it changed.
+     */
+    void postDisplayImage(std::unique_ptr<Core::Common::ImageRegion> image,
+                          std::unique_ptr<Core::Common::ImageRegion> original = nullptr);
+
+    /**
+     * @brief Posts `onImageLoadResult` to the GUI thread.
+     */
+    void postImageLoadResult(bool success, const QString& error_msg);
+
+    /**
+     * @brief Posts `onOperationResult` to the GUI thread.
+     */
+    void postOperationResult(bool success, const QString& error_msg);
+
+    /**
+     * @brief Records the current operations, with their published values, as an edit state.
+     */
+    void commitHistoryState();
+
+    /**
+     * @brief Applies the current edit state: operations, sliders, published values and display.
+     */
+    void restoreHistoryState();
+
 
     /**
      * @brief Holds the current source image for display operations.
@@ -166,6 +439,99 @@ private :
      */
     std::unique_ptr<CaptureMoment::UI::Models::Manager::OperationModelManager> m_operation_model_manager {nullptr};
 
+    /**
+     * @brief Delay without parameter changes after which the full-resolution pass is scheduled.
+     */
+    static constexpr int k_full_resolution_idle_ms { 300 };
+
+    /**
+     * @brief Screen pixels per source pixel from which a draft RAW preview is replaced by its full quality.
+     */
+    static constexpr float k_full_quality_magnification { 1.0f };
+
+    /**
+     * @brief Single-shot timer restarted on every parameter change.
+     * @details While it is running, edits are rendered on the preview proxy only.
+     *          On timeout, the full-resolution pass is applied. Slider gestures stop it: their
+     *          refine runs on release instead.
+     */
+    QTimer m_full_resolution_timer;
+
+    /**
+     * @brief Latest slider values, published to the engine on every change.
+     * @details Written on the thread emitting the models' `valueChanged` only.
+     */
+    Core::Operations::ParameterSnapshot m_parameter_snapshot;
+
+    /**
+     * @brief Undo/redo history, one state per settled edit (GUI thread only).
+     */
+    Core::Operations::EditHistory m_edit_history;
+
+    /**
+     * @brief Set while the sliders are moved to a restored state: their changes are not edits.
+     */
+    bool m_restoring_history { false };
+
+    /**
+     * @brief Set while a slider is pressed: its edits are one gesture, refined on release.
+     * @details The idle timer of the full-resolution pass is not armed meanwhile (GUI thread only).
+     */
+    bool m_interacting { false };
+
+    /**
+     * @brief Paces the preview runs on the window's frames and the engine latency.
+     * @details At most one preview run is in flight and one pending: ticks arriving meanwhile
+     *          only publish their value, which the next run picks up.
+     */
+    SubmissionPacer m_submission_pacer;
+
+    /**
+     * @brief Lowers the proxy resolution while previews miss their frame budget (worker thread only).
+     * @details Fed the processing time of every completed preview; restored once input is idle.
+     */
+    AdaptivePreviewQuality m_preview_quality;
+
+    /**
+     * @brief true when the proxy no longer has the size `m_preview_quality` picked (worker thread only).
+     */
+    bool m_preview_proxy_stale { false };
+
+    /**
+     * @brief Incremented by every display refresh request: a resize queues at most one downsample.
+     */
+    std::atomic<std::uint64_t> m_display_refresh_serial { 0 };
+
+    /**
+     * @brief Incremented by every pan-ahead prefetch request: only the latest one keeps running.
+     */
+    std::atomic<std::uint64_t> m_tile_prefetch_serial { 0 };
+
+    /**
+     * @brief Delay after a load or a settled edit before the session is saved.
+     */
+    static constexpr int k_session_save_delay_ms { 2000 };
+
+    /**
+     * @brief Single-shot timer saving the session, restarted by every load and settled edit.
+     */
+    QTimer m_session_save_timer;
+
+    /**
+     * @brief Session file (`Core::Serializer::SessionSnapshot::defaultPath()`).
+     */
+    std::filesystem::path m_session_path;
+
+    /**
+     * @brief Path of the loaded image (GUI thread only; empty: nothing to save).
+     */
+    std::string m_session_source_path;
+
+    /**
+     * @brief Edits of a restored session, applied once its image is loaded (GUI thread only).
+     */
+    std::optional<std::vector<Core::Operations::OperationDescriptor>> m_session_operations;
+
 public slots:
     /**
      * @brief Load image from file path (non-blocking)
@@ -184,6 +550,26 @@ public slots:
      */
     void applyOperations(std::vector<Core::Operations::OperationDescriptor> operations);
 
+    /**
+     * @brief Apply operations on the preview proxy only (non-blocking).
+     * @details
+     * Interactive counterpart of `applyOperations`, used while a control is being dragged.
+     * The full-resolution pass is scheduled separately once input goes idle.
+     *
+     * @param operations Vector of operation descriptors
+     */
+    void applyPreviewOperations(std::vector<Core::Operations::OperationDescriptor> operations);
+
+    /**
+     * @brief Apply operations progressively (non-blocking).
+     * @details
+     * The display first shows the low-resolution result, then sharpens in place as the
+     * full-resolution tiles complete. A newer call stops the refinement.
+     *
+     * @param operations Vector of operation descriptors
+     */
+    void applyProgressiveOperations(std::vector<Core::Operations::OperationDescriptor> operations);
+
     /**
      * @brief Internal: Handle load image result
      * @param success Whether load succeeded
@@ -228,6 +614,11 @@ signals:
      */
     void imageSizeChanged();
 
+    /**
+     * @brief Emitted when the edit history moves or changes (canUndo, canRedo).
+     */
+    void historyChanged();
+
 protected:
     /**
      * @brief Core processing engine
@@ -239,6 +630,11 @@ protected:
      */
     std::unique_ptr<CaptureMoment::UI::Display::DisplayManager> m_display_manager {nullptr};
 
+    /**
+     * @brief Statistics of the performance overlay; subscribed to the engine's request timings.
+     */
+    std::unique_ptr<PerformanceMonitor> m_performance_monitor {nullptr};
+
     /**
      * @brief Connects the operationRequested signal from all created models to the OperationStateManager.
      * This method should be called after models are created.
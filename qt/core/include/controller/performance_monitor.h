@@ -0,0 +1,207 @@
+/**
+ * @file performance_monitor.h
+ * @brief Samples engine, memory and render statistics for the performance overlay.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMetaObject>
+#include <QObject>
+#include <QPointer>
+#include <QQuickWindow>
+#include <QString>
+#include <QTimer>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "common/types/memory_type.h"
+#include "common/types/processing_timings.h"
+
+namespace CaptureMoment::Core::Engine {
+class PhotoEngine;
+}
+
+namespace CaptureMoment::UI {
+
+namespace Controller {
+
+/**
+ * @class PerformanceMonitor
+ * @brief Live statistics behind the performance overlay (HUD), for diagnosing slowness
+ *        on a user's machine without a profiler.
+ *
+ * @details
+ * While `active`, the monitor refreshes every `k_refresh_interval_ms`:
+ * - engine latency (submission to settlement) and pipeline time of the completed requests,
+ *   from the engine's timings callback;
+ * - queue depth (running pass and pending request);
+ * - requests coalesced (superseded before they ran) and dropped (aborted mid-pass);
+ * - backend and Halide target of the last pass;
+ * - memory budget usage (`Core::Common::MemoryBudget`);
+ * - texture upload time (`Rendering::RenderStats`) and render FPS (`frameSwapped` of the window).
+ *
+ * The request counters run from construction (or `reset`), the timings over the last refresh.
+ * Lives on, and must be used from, the GUI thread; only the timings callback runs elsewhere.
+ */
+class PerformanceMonitor : public QObject {
+    Q_OBJECT
+
+    /** @property active true while the overlay is shown: sampling runs only then. */
+    Q_PROPERTY(bool active READ isActive WRITE setActive NOTIFY activeChanged)
+
+    /** @property engineLatencyMs Mean submission-to-result time of the completed requests, in ms. */
+    Q_PROPERTY(double engineLatencyMs READ engineLatencyMs NOTIFY statsChanged)
+    /** @property engineLatencyMaxMs Slowest completed request of the last refresh, in ms. */
+    Q_PROPERTY(double engineLatencyMaxMs READ engineLatencyMaxMs NOTIFY statsChanged)
+    /** @property pipelineMs Mean pipeline time of the completed requests, in ms. */
+    Q_PROPERTY(double pipelineMs READ pipelineMs NOTIFY statsChanged)
+    /** @property queueDepth Requests not settled yet (0 to 2). */
+    Q_PROPERTY(int queueDepth READ queueDepth NOTIFY statsChanged)
+    /** @property completedRequests Requests that ran to completion. */
+    Q_PROPERTY(int completedRequests READ completedRequests NOTIFY statsChanged)
+    /** @property coalescedRequests Requests superseded before they ran. */
+    Q_PROPERTY(int coalescedRequests READ coalescedRequests NOTIFY statsChanged)
+    /** @property droppedRequests Requests aborted while their pass ran. */
+    Q_PROPERTY(int droppedRequests READ droppedRequests NOTIFY statsChanged)
+    /** @property backend Backend of the last pass ("CPU", "GPU", or empty before the first). */
+    Q_PROPERTY(QString backend READ backend NOTIFY statsChanged)
+    /** @property target Halide target of the last pass. */
+    Q_PROPERTY(QString target READ target NOTIFY statsChanged)
+    /** @property memoryUsedMB Memory held by the budgeted caches and pools, in MB. */
+    Q_PROPERTY(double memoryUsedMB READ memoryUsedMB NOTIFY statsChanged)
+    /** @property memoryBudgetMB Memory ceiling, in MB (0: unlimited). */
+    Q_PROPERTY(double memoryBudgetMB READ memoryBudgetMB NOTIFY statsChanged)
+    /** @property textureUploadMs Mean texture upload time of the last refresh, in ms. */
+    Q_PROPERTY(double textureUploadMs READ textureUploadMs NOTIFY statsChanged)
+    /** @property renderFps Frames presented per second by the window. */
+    Q_PROPERTY(double renderFps READ renderFps NOTIFY statsChanged)
+
+public:
+    /**
+     * @brief Refresh interval of the statistics while active.
+     */
+    static constexpr int k_refresh_interval_ms { 500 };
+
+    /**
+     * @brief Constructs the monitor and subscribes to the engine's request timings.
+     * @param engine The engine of the controller.
+     * @param parent Parent QObject
+     */
+    explicit PerformanceMonitor(std::shared_ptr<Core::Engine::PhotoEngine> engine, QObject* parent = nullptr);
+
+    /**
+     * @brief Unsubscribes from the engine.
+     */
+    ~PerformanceMonitor() override;
+
+    PerformanceMonitor(const PerformanceMonitor&) = delete;
+    PerformanceMonitor& operator=(const PerformanceMonitor&) = delete;
+
+    /**
+     * @brief Counts the frames of `window` for the render FPS (nullptr: no FPS).
+     */
+    void setWindow(QQuickWindow* window);
+
+    [[nodiscard]] bool isActive() const noexcept { return m_active; }
+
+    /**
+     * @brief Starts or stops sampling (the request counters keep running).
+     */
+    void setActive(bool active);
+
+    /**
+     * @brief Resets the request counters.
+     */
+    Q_INVOKABLE void reset();
+
+    [[nodiscard]] double engineLatencyMs() const noexcept { return m_engine_latency_ms; }
+    [[nodiscard]] double engineLatencyMaxMs() const noexcept { return m_engine_latency_max_ms; }
+    [[nodiscard]] double pipelineMs() const noexcept { return m_pipeline_ms; }
+    [[nodiscard]] int queueDepth() const noexcept { return m_queue_depth; }
+    [[nodiscard]] int completedRequests() const noexcept { return m_completed; }
+    [[nodiscard]] int coalescedRequests() const noexcept { return m_coalesced; }
+    [[nodiscard]] int droppedRequests() const noexcept { return m_dropped; }
+    [[nodiscard]] QString backend() const { return m_backend_name; }
+    [[nodiscard]] QString target() const { return m_target; }
+    [[nodiscard]] double memoryUsedMB() const noexcept { return m_memory_used_mb; }
+    [[nodiscard]] double memoryBudgetMB() const noexcept { return m_memory_budget_mb; }
+    [[nodiscard]] double textureUploadMs() const noexcept { return m_texture_upload_ms; }
+    [[nodiscard]] double renderFps() const noexcept { return m_render_fps; }
+
+signals:
+    void activeChanged(bool active);
+
+    /**
+     * @brief Emitted after each refresh.
+     */
+    void statsChanged();
+
+private:
+    /**
+     * @brief Request timings accumulated between two refreshes (guarded by `m_timings_mutex`).
+     */
+    struct TimingsWindow {
+        std::uint64_t m_completed { 0 };
+        std::uint64_t m_coalesced { 0 };
+        std::uint64_t m_dropped { 0 };
+        double m_latency_total_ms { 0.0 };
+        double m_latency_max_ms { 0.0 };
+        double m_pipeline_total_ms { 0.0 };
+        std::optional<Core::Common::MemoryType> m_backend;
+    };
+
+    /**
+     * @brief Engine timings callback (engine threads, under the engine's request lock).
+     */
+    void recordTimings(const Core::Common::ProcessingTimings& timings);
+
+    /**
+     * @brief Takes the accumulated samples and publishes them.
+     */
+    void refresh();
+
+    /**
+     * @brief A frame was presented (queued from the render thread).
+     */
+    void onFrameSwapped() { ++m_frames; }
+
+    std::shared_ptr<Core::Engine::PhotoEngine> m_engine;
+
+    std::mutex m_timings_mutex;
+    TimingsWindow m_window_timings;
+
+    QTimer m_refresh_timer;
+    QElapsedTimer m_refresh_clock;
+
+    QPointer<QQuickWindow> m_window;
+    QMetaObject::Connection m_frame_connection;
+    std::uint64_t m_frames { 0 };
+
+    bool m_active { false };
+
+    std::optional<Core::Common::MemoryType> m_last_backend;
+
+    double m_engine_latency_ms { 0.0 };
+    double m_engine_latency_max_ms { 0.0 };
+    double m_pipeline_ms { 0.0 };
+    int m_queue_depth { 0 };
+    int m_completed { 0 };
+    int m_coalesced { 0 };
+    int m_dropped { 0 };
+    QString m_backend_name;
+    QString m_target;
+    double m_memory_used_mb { 0.0 };
+    double m_memory_budget_mb { 0.0 };
+    double m_texture_upload_ms { 0.0 };
+    double m_render_fps { 0.0 };
+};
+
+} // namespace Controller
+
+} // namespace CaptureMoment::UI
@@ -0,0 +1,164 @@
+/**
+ * @file submission_pacer.h
+ * @brief Paces interactive edit submissions on the window's frames and the engine latency.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QMetaObject>
+#include <QObject>
+#include <QPointer>
+#include <QQuickWindow>
+#include <QTimer>
+
+namespace CaptureMoment::UI {
+
+namespace Controller {
+
+/**
+ * @class SubmissionPacer
+ * @brief Turns a stream of edit ticks into at most one in-flight and one queued preview request.
+ *
+ * @details
+ * Sliders change far more often than frames are displayed. Every tick only marks the state
+ * dirty (`requestSubmission`); `submit` is emitted when no request is in flight, aligned to
+ * the window's frames (`QQuickWindow::frameSwapped`):
+ * - while the engine is faster than a frame, the next request starts at the next frame,
+ *   so no more requests are computed than can be shown;
+ * - once the measured engine latency exceeds a frame interval, the next request starts as
+ *   soon as the previous one finishes, since waiting for a frame would only add idle time.
+ *
+ * The latency from a tick to its display is thus bounded by one frame plus one processing time.
+ * Without a window, a timer at a nominal frame rate stands in for the frames.
+ * Lives on, and must be used from, the GUI thread.
+ */
+class SubmissionPacer : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Frame interval assumed until frames were measured, and without a window.
+     */
+    static constexpr int k_default_frame_interval_ms { 16 };
+
+    /**
+     * @brief Weight of the newest sample in the latency and frame interval averages.
+     */
+    static constexpr double k_smoothing { 0.25 };
+
+    /**
+     * @brief Constructs a pacer without window (timer-paced).
+     * @param parent Parent QObject
+     */
+    explicit SubmissionPacer(QObject* parent = nullptr);
+
+    /**
+     * @brief Paces the submissions on the frames of `window` (nullptr: timer-paced).
+     */
+    void setWindow(QQuickWindow* window);
+
+    /**
+     * @brief Marks the edit state dirty: a submission follows at the next opportunity.
+     */
+    void requestSubmission();
+
+    /**
+     * @brief Reports that the request started by the last `submit` has finished.
+     */
+    void submissionFinished();
+
+    /**
+     * @brief Drops the pending submission, if any: a full-resolution request covers the state.
+     */
+    void discardPending() noexcept { m_pending = false; }
+
+    /**
+     * @brief Smoothed duration of the last requests, in milliseconds.
+     */
+    [[nodiscard]] double latencyMs() const noexcept { return m_latency_ms; }
+
+    /**
+     * @brief true while a submitted request has not finished.
+     */
+    [[nodiscard]] bool isInFlight() const noexcept { return m_in_flight; }
+
+signals:
+    /**
+     * @brief Emitted when the current edit state must be submitted.
+     *        The receiver calls `submissionFinished` once the request is done.
+     */
+    void submit();
+
+private:
+    /**
+     * @brief A frame was presented (queued from the render thread).
+     */
+    void onFrameSwapped();
+
+    /**
+     * @brief Asks for a frame (window update, or the fallback timer).
+     */
+    void scheduleFrame();
+
+    /**
+     * @brief Emits `submit` if the state is dirty and no request is in flight.
+     */
+    void trySubmit();
+
+    /**
+     * @brief Window whose frames pace the submissions.
+     */
+    QPointer<QQuickWindow> m_window;
+
+    /**
+     * @brief Connection to `m_window`'s `frameSwapped`.
+     */
+    QMetaObject::Connection m_frame_connection;
+
+    /**
+     * @brief Stands in for the frames without a window.
+     */
+    QTimer m_fallback_timer;
+
+    /**
+     * @brief Monotonic clock of the measurements.
+     */
+    QElapsedTimer m_clock;
+
+    /**
+     * @brief Clock time of the last `submit`.
+     */
+    qint64 m_submitted_at_ms { 0 };
+
+    /**
+     * @brief Clock time of the last frame, or -1 before the first one.
+     */
+    qint64 m_last_frame_ms { -1 };
+
+    /**
+     * @brief Smoothed interval between frames.
+     */
+    double m_frame_interval_ms { k_default_frame_interval_ms };
+
+    /**
+     * @brief Smoothed duration of the requests.
+     */
+    double m_latency_ms { 0.0 };
+
+    /**
+     * @brief true if ticks arrived since the last `submit`.
+     */
+    bool m_pending { false };
+
+    /**
+     * @brief true while the last submitted request runs.
+     */
+    bool m_in_flight { false };
+};
+
+} // namespace Controller
+
+} // namespace CaptureMoment::UI
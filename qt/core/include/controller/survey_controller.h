@@ -0,0 +1,190 @@
+/**
+ * @file survey_controller.h
+ * @brief Feeds the survey view: one engine and edit stack per image, proxy renders per cell.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QStringList>
+#include <QThread>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "engine/photo_engine.h"
+#include "operations/operation_descriptor.h"
+#include "rendering/rhi_survey_item.h"
+
+namespace CaptureMoment::Core::Workers {
+class EngineScheduler;
+}
+
+namespace CaptureMoment::UI {
+
+namespace Controller {
+
+/**
+ * @class SurveyController
+ * @brief Loads 1 to `RHISurveyItem::k_max_images` images for side-by-side comparison (culling).
+ *
+ * @details
+ * Each image gets its own `PhotoEngine` and edit stack; the engines share one scheduler, and
+ * a path listed twice becomes a virtual copy of the first (`PhotoEngine::createVirtualCopy`),
+ * so it is decoded once. Cells are rendered with `PhotoEngine::renderVariants` at the long
+ * edge the survey item needs (`RHISurveyItem::cellLongEdge`): proxy-resolution renders that
+ * leave the engines' display images alone. A cell is rendered again when its operations
+ * change or the cells are resized past a step.
+ *
+ * Engine calls block on their futures: they run on the controller's worker thread, and the
+ * images are handed to the item on the GUI thread. Loading a new set supersedes the renders
+ * of the previous one.
+ */
+class SurveyController : public QObject {
+    Q_OBJECT
+
+    /**
+     * @property surveyItem
+     * @brief The survey item the cells are shown in (non-owned).
+     */
+    Q_PROPERTY(CaptureMoment::UI::Rendering::RHISurveyItem* surveyItem READ surveyItem WRITE setSurveyItem NOTIFY surveyItemChanged)
+
+    /** @property count Number of images of the survey. */
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    /**
+     * @brief Constructs the controller, its scheduler and its worker thread.
+     * @param parent Parent QObject
+     */
+    explicit SurveyController(QObject* parent = nullptr);
+
+    /**
+     * @brief Stops the worker thread, then releases the engines.
+     */
+    ~SurveyController() override;
+
+    /**
+     * @brief Number of images of the survey.
+     */
+    [[nodiscard]] int count() const noexcept { return m_count; }
+
+    /**
+     * @brief The survey item the cells are shown in.
+     */
+    [[nodiscard]] Rendering::RHISurveyItem* surveyItem() const noexcept { return m_survey_item; }
+
+    /**
+     * @brief Sets the survey item and follows its cell size.
+     */
+    void setSurveyItem(Rendering::RHISurveyItem* item);
+
+    /**
+     * @brief Loads the images to compare, in cell order (local paths or file URLs).
+     *
+     * @details Paths beyond `RHISurveyItem::k_max_images` are ignored. Each cell is rendered
+     *          unedited as soon as its image is loaded.
+     */
+    Q_INVOKABLE void loadImages(const QStringList& paths);
+
+    /**
+     * @brief Replaces the edit stack of an image and renders its cell again.
+     * @param index Cell index, in [0, count()).
+     * @param operations The operations of the image (e.g. read from its sidecar).
+     */
+    void setOperations(int index, std::vector<Core::Operations::OperationDescriptor> operations);
+
+signals:
+    /**
+     * @brief Emitted when the survey item changes.
+     */
+    void surveyItemChanged();
+
+    /**
+     * @brief Emitted when the number of images changes.
+     */
+    void countChanged(int count);
+
+    /**
+     * @brief Emitted when an image of the survey cannot be loaded (its cell stays empty).
+     */
+    void imageLoadFailed(int index, const QString& path);
+
+private:
+    /**
+     * @brief An image of the survey (worker thread only).
+     */
+    struct Entry {
+        std::string path;                                           ///< File of the image
+        std::unique_ptr<Core::Engine::PhotoEngine> engine;          ///< Engine of the image, nullptr if not loaded
+        std::vector<Core::Operations::OperationDescriptor> operations;  ///< Edit stack of the image
+    };
+
+    /**
+     * @brief Loads the images of a set and renders their cells (worker thread).
+     */
+    void doLoadImages(std::vector<std::string> paths, std::uint64_t generation);
+
+    /**
+     * @brief Renders one cell and hands the image to the item (worker thread).
+     */
+    void doRenderCell(int index, std::uint64_t generation);
+
+    /**
+     * @brief Renders every loaded cell again (worker thread).
+     */
+    void doRenderAll(std::uint64_t generation);
+
+    /**
+     * @brief Engine scheduler shared by the engines of the survey.
+     */
+    std::shared_ptr<Core::Workers::EngineScheduler> m_scheduler;
+
+    /**
+     * @brief Images of the survey, in cell order (worker thread only).
+     */
+    std::vector<Entry> m_entries;
+
+    /**
+     * @brief Number of images of the survey (GUI thread).
+     */
+    int m_count{0};
+
+    /**
+     * @brief Bumped by each loadImages(): work of an older set is dropped.
+     */
+    std::atomic<std::uint64_t> m_generation{0};
+
+    /**
+     * @brief Long edge of the cell renders, 0 before the item is laid out.
+     */
+    std::atomic<int> m_cell_long_edge{0};
+
+    /**
+     * @brief Survey item (non-owned, set externally).
+     */
+    Rendering::RHISurveyItem* m_survey_item{nullptr};
+
+    /**
+     * @brief Connection to the item's cellLongEdgeChanged signal.
+     */
+    QMetaObject::Connection m_cell_edge_connection;
+
+    /**
+     * @brief Worker thread the engine calls run on.
+     */
+    QThread m_worker_thread;
+
+    /**
+     * @brief Context object living on `m_worker_thread`: the engine calls are queued to it.
+     */
+    QObject m_worker_context;
+};
+
+} // namespace Controller
+
+} // namespace CaptureMoment::UI
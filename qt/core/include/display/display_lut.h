@@ -0,0 +1,98 @@
+/**
+ * @file display_lut.h
+ * @brief 3D lookup table of the display transform (monitor ICC profile or OCIO display/view).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QString>
+#include <memory>
+#include <vector>
+
+class QColorSpace;
+
+namespace CaptureMoment::UI {
+namespace Display {
+
+/**
+ * @struct DisplayLut
+ * @brief Display transform baked into an RGBA float cube, sampled by the RHI fragment shader.
+ *
+ * @details
+ * The cube is indexed by sRGB-encoded Rec.709 values in [0, 1]: the sRGB curve acts as the
+ * shaper, spreading the grid points evenly in perceptual terms. Each entry holds the
+ * display-encoded RGB of that color for the target monitor, so the shader only encodes to
+ * sRGB and samples the cube (trilinear filtering interpolates between grid points). Values
+ * outside the sRGB gamut are clipped by the shaper.
+ *
+ * Baking costs a few milliseconds at 33^3, once per profile: switching monitors only switches
+ * the cube.
+ */
+struct DisplayLut {
+    /**
+     * @brief Default grid size per axis (33^3 entries).
+     */
+    static constexpr int k_default_size { 33 };
+
+    /**
+     * @brief Largest supported grid size per axis (65^3 entries).
+     */
+    static constexpr int k_max_size { 65 };
+
+    /**
+     * @brief Grid points per axis.
+     */
+    int m_size { 0 };
+
+    /**
+     * @brief RGBA entries, red varying fastest, then green, then blue (one depth slice per blue step).
+     */
+    std::vector<float> m_rgba;
+
+    /**
+     * @brief Checks that the cube holds m_size^3 RGBA entries.
+     */
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return m_size >= 2 && m_rgba.size() == static_cast<std::size_t>(m_size) * m_size * m_size * 4;
+    }
+
+    /**
+     * @brief Bakes the sRGB-to-display conversion of a color space (typically a monitor profile).
+     *
+     * @param display The monitor color space.
+     * @param size Grid points per axis, clamped to [2, k_max_size].
+     * @return The cube, or nullptr if the color space is invalid.
+     */
+    [[nodiscard]] static std::shared_ptr<const DisplayLut> fromColorSpace(const QColorSpace& display,
+                                                                          int size = k_default_size);
+
+    /**
+     * @brief Bakes the conversion to the monitor described by an ICC profile file.
+     *
+     * @param icc_path Path of the .icc/.icm file.
+     * @param size Grid points per axis, clamped to [2, k_max_size].
+     * @return The cube, or nullptr if the file cannot be read or parsed.
+     */
+    [[nodiscard]] static std::shared_ptr<const DisplayLut> fromIccProfile(const QString& icc_path,
+                                                                          int size = k_default_size);
+
+    /**
+     * @brief Bakes an OCIO display/view transform from scene-linear Rec.709.
+     *
+     * Uses the OCIO configuration OIIO is set up with (the `OCIO` environment variable, or its
+     * built-in configuration).
+     *
+     * @param display OCIO display name.
+     * @param view OCIO view name.
+     * @param size Grid points per axis, clamped to [2, k_max_size].
+     * @return The cube, or nullptr if OCIO has no such display/view.
+     */
+    [[nodiscard]] static std::shared_ptr<const DisplayLut> fromOcioDisplay(const QString& display, const QString& view,
+                                                                           int size = k_default_size);
+};
+
+} // namespace Display
+} // namespace CaptureMoment::UI
@@ -16,12 +16,20 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <QObject>
 #include <QSize>
+#include <QPoint>
 #include <QPointF>
+#include <QList>
+#include <QElapsedTimer>
 
 #include "common/image_region.h"
+#include "common/display_image.h"
+#include "common/types/image_orientation.h"
 #include "viewport_manager.h"
+#include "tile_pyramid.h"
+#include "display_overlays.h"
 
 // Forward declaration
 namespace CaptureMoment::UI::Rendering {
@@ -61,13 +69,24 @@ namespace Display {
  * 2. **Image Loading (per image)**:
  *    - SourceManager loads full resolution image
  *    - Call `setSourceImageSize()` with source dimensions
- *    - DisplayManager calculates optimal downsample size
- *    - Signal `displayImageRequest()` emitted
+ *    - DisplayManager calculates optimal downsample size (`downsampleSize()`)
  *    - SourceManager downsamples and provides via `createDisplayImage()`
  *
  * 3. **Display**:
  *    - Rendering item receives the downsampled image
  *    - Call `fitToView()` to center and fit the image
+ *
+ * 4. **Resize**:
+ *    - The current texture is scaled to the new display size on the GPU
+ *    - Signal `displayImageRequest()` is emitted only when the downsample crosses a level
+ *      (see `DisplayConfig::downsampleLevelsPerDoubling()`): growing at the next level,
+ *      shrinking only below half the pixels
+ *
+ * 5. **Deep zoom**:
+ *    - Past the magnification the downsample serves, `displayTilesRequest()` asks for the
+ *      visible pyramid tiles, answered through `addDisplayTile()`
+ *    - While panning, `displayTilesPrefetch()` asks for the tiles the extrapolated motion
+ *      reveals next, so edges are filled before they scroll into view
  */
 class DisplayManager : public QObject {
     Q_OBJECT
@@ -96,6 +115,15 @@ class DisplayManager : public QObject {
     /** @property Maximum downsample dimension in pixels. */
     Q_PROPERTY(int maxDownsample READ maxDownsample NOTIFY maxDownsampleChanged)
 
+    /** @property clippingWarning Shows the clipped highlights and shadows (display shader). */
+    Q_PROPERTY(bool clippingWarning READ clippingWarning WRITE setClippingWarning NOTIFY overlaysChanged)
+
+    /** @property focusPeaking Shows the in-focus edges (display shader). */
+    Q_PROPERTY(bool focusPeaking READ focusPeaking WRITE setFocusPeaking NOTIFY overlaysChanged)
+
+    /** @property peakingThreshold Edge strength marked by focus peaking (lower marks more). */
+    Q_PROPERTY(float peakingThreshold READ peakingThreshold WRITE setPeakingThreshold NOTIFY overlaysChanged)
+
 
 public:
     /**
@@ -179,6 +207,17 @@ public:
      */
     void createDisplayImage(std::unique_ptr<Core::Common::ImageRegion> source_image);
 
+    /**
+     * @brief Creates the display buffer from a display-ready (sRGB RGBA8) image.
+     *
+     * Called with the image encoded by the fused pipeline display stage.
+     * The rendering item uploads it without conversion, from these very bytes:
+     * the image is shared (edit history, renderer), never copied.
+     *
+     * @param display_image The display image produced by the core.
+     */
+    void createDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> display_image);
+
     /**
      * @brief Updates a specific tile region of the display image.
      *
@@ -188,6 +227,13 @@ public:
      */
     void updateDisplayTile(std::unique_ptr<Core::Common::ImageRegion> source_tile);
 
+    /**
+     * @brief Forwards the unedited display image to the rendering item (before/after comparison).
+     *
+     * @param original_image The display image of the freshly loaded file, before any edit.
+     */
+    void setOriginalImage(std::unique_ptr<Core::Common::ImageRegion> original_image);
+
     /**
      * @brief Sets the source image size metadata.
      *
@@ -199,6 +245,35 @@ public:
      */
     Q_INVOKABLE void setSourceImageSize(int width, int height);
 
+    /**
+     * @brief Sets the EXIF orientation of the source image.
+     *
+     * The display image and the tiles stay in the stored frame: the rendering item turns them.
+     * Fit, pan limits and visible tiles then follow the upright image. Items without
+     * orientation support show the stored frame, laid out as such.
+     *
+     * @param orientation The orientation read from the file.
+     */
+    void setSourceOrientation(Core::Common::ImageOrientation orientation);
+
+    /**
+     * @brief Hands a deep-zoom pyramid tile requested by displayTilesRequest to the rendering item.
+     *
+     * Tiles from an older request generation (the image changed meanwhile) or that left the
+     * resident set (the view moved on) are dropped.
+     *
+     * @param generation The generation the tile was requested for.
+     * @param key The tile.
+     * @param tile Linear RGBA_F32 pixels of the tile, at its level's resolution.
+     */
+    void addDisplayTile(quint64 generation, const TileKey& key,
+                        std::unique_ptr<Core::Common::ImageRegion> tile);
+
+    /**
+     * @brief Tile geometry of the current source image.
+     */
+    [[nodiscard]] const TilePyramid& tilePyramid() const noexcept { return m_pyramid; }
+
     // =========================================================================
     // Zoom & Pan
     // =========================================================================
@@ -301,6 +376,44 @@ public:
      */
     Q_INVOKABLE void setQualityMargin(float margin);
 
+    // =========================================================================
+    // Overlays
+    // =========================================================================
+
+    /**
+     * @brief Shows or hides the clipping warnings.
+     *
+     * Drawn by the rendering item's display shader: no engine work, updated at the display
+     * refresh rate while panning. Items without a display shader show nothing.
+     */
+    Q_INVOKABLE void setClippingWarning(bool enabled);
+
+    /**
+     * @brief Whether the clipping warnings are shown.
+     */
+    [[nodiscard]] bool clippingWarning() const noexcept { return m_overlays.m_clipping; }
+
+    /**
+     * @brief Shows or hides focus peaking (see setClippingWarning()).
+     */
+    Q_INVOKABLE void setFocusPeaking(bool enabled);
+
+    /**
+     * @brief Whether focus peaking is shown.
+     */
+    [[nodiscard]] bool focusPeaking() const noexcept { return m_overlays.m_focus_peaking; }
+
+    /**
+     * @brief Sets the edge strength focus peaking marks.
+     * @param threshold Sobel magnitude of the display-encoded luma, clamped to [0.05, 2].
+     */
+    Q_INVOKABLE void setPeakingThreshold(float threshold);
+
+    /**
+     * @brief Edge strength focus peaking marks.
+     */
+    [[nodiscard]] float peakingThreshold() const noexcept { return m_overlays.m_peaking_threshold; }
+
     // =========================================================================
     // Coordinate Mapping
     // =========================================================================
@@ -368,13 +481,37 @@ signals:
      * @brief Emitted when a new downsampled image is needed.
      *
      * Connect this to SourceManager to request a new downsampled version
-     * when the display requirements change.
+     * when a viewport resize moves the downsample to another level.
      *
      * @param target_width Requested width in pixels.
      * @param target_height Requested height in pixels.
      */
     void displayImageRequest(int target_width, int target_height);
 
+    /**
+     * @brief Emitted when the view needs pyramid tiles it does not hold yet.
+     *
+     * Connect this to a tile producer, which answers each tile through addDisplayTile().
+     *
+     * @param generation Request generation, to pass back with each tile.
+     * @param level Pyramid level of the tiles.
+     * @param tiles Tile columns (x) and rows (y) at that level.
+     */
+    void displayTilesRequest(quint64 generation, int level, const QList<QPoint>& tiles);
+
+    /**
+     * @brief Emitted while panning with the tiles the predicted motion brings into view next.
+     *
+     * Same contract as displayTilesRequest, but the tiles are not visible yet: produce them at
+     * low priority, after any visible tile. Tiles the view no longer wants are dropped by
+     * addDisplayTile().
+     *
+     * @param generation Request generation, to pass back with each tile.
+     * @param level Pyramid level of the tiles.
+     * @param tiles Tile columns (x) and rows (y) at that level, nearest to the view first.
+     */
+    void displayTilesPrefetch(quint64 generation, int level, const QList<QPoint>& tiles);
+
     /**
      * @brief Emitted when zoom changes.
      * @param zoom New zoom level.
@@ -423,6 +560,11 @@ signals:
      */
     void maxDownsampleChanged(int max_dim);
 
+    /**
+     * @brief Emitted when an overlay is toggled or tuned.
+     */
+    void overlaysChanged();
+
     /**
      * @brief Emitted when initialization completes.
      * @param initialized True if successfully initialized.
@@ -442,6 +584,45 @@ private:
      */
     void constrainPan();
 
+    /**
+     * @brief Size of a stored-frame size as laid out on screen (swapped for quarter turns).
+     */
+    [[nodiscard]] QSize uprightSize(const QSize& size) const;
+
+    /**
+     * @brief Maps a rectangle of the upright display image to the stored display image.
+     */
+    [[nodiscard]] QRectF storedDisplayRect(const QRectF& upright_rect) const;
+
+    /**
+     * @brief Hands m_overlays to the rendering item and notifies.
+     */
+    void applyOverlays();
+
+    /**
+     * @brief Selects the pyramid level for the current zoom and requests the visible tiles.
+     *
+     * Called after every zoom, pan or viewport change. While the display downsample is
+     * fine enough for the zoom, no level is drawn and nothing is requested.
+     */
+    void updateVisibleTiles();
+
+    /**
+     * @brief Forgets every resident tile and invalidates pending requests.
+     */
+    void resetPyramid();
+
+    /**
+     * @brief Updates the pan velocity with the motion of a setPan() call.
+     * @param delta Pan change, in screen pixels.
+     */
+    void trackPanVelocity(const QPointF& delta);
+
+    /**
+     * @brief Pan change expected over k_pan_lookahead_ms, in screen pixels (null when not panning).
+     */
+    [[nodiscard]] QPointF predictedPanShift() const;
+
     /**
      * @brief Calculates display size from source and viewport.
      *
@@ -452,6 +633,22 @@ private:
      */
     [[nodiscard]] QSize calculateDisplaySize(const QSize& source_size) const;
 
+    // =========================================================================
+    // Pan-ahead Prefetch
+    // =========================================================================
+
+    /** @brief How far ahead the pan motion is extrapolated to prefetch tiles. */
+    static constexpr double k_pan_lookahead_ms { 250.0 };
+
+    /** @brief Gap between pan updates after which the motion counts as stopped. */
+    static constexpr qint64 k_pan_idle_ms { 100 };
+
+    /** @brief Weight of the newest pan delta in the velocity average. */
+    static constexpr double k_pan_smoothing { 0.5 };
+
+    /** @brief Most tiles prefetched per view update. */
+    static constexpr std::size_t k_max_prefetch_tiles { 8 };
+
     // =========================================================================
     // Member Variables
     // =========================================================================
@@ -479,11 +676,38 @@ private:
     /** @brief Pre-calculated scale factor (m_display_image_size / m_source_image_size). */
     float m_display_scale{1.0f};
 
+    /** @brief EXIF orientation of the source, applied by the rendering item. */
+    Core::Common::ImageOrientation m_orientation{Core::Common::ImageOrientation::Normal};
+
     /** @brief Pointer to the active rendering component. */
     Rendering::IRenderingItemBase* m_rendering_item{nullptr};
 
+    /** @brief Clipping and focus peaking overlays, handed to the rendering item. */
+    Display::DisplayOverlays m_overlays;
+
     /** @brief Cached fit-to-view zoom for the current image. */
     float m_fit_zoom{1.0f};
+
+    /** @brief Deep-zoom tile geometry of the source image. */
+    TilePyramid m_pyramid;
+
+    /** @brief Tiles requested or held by the rendering item, with their last use (LRU). */
+    std::unordered_map<TileKey, quint64, TileKeyHash> m_resident_tiles;
+
+    /** @brief Use counter stamping m_resident_tiles. */
+    quint64 m_tile_clock{0};
+
+    /** @brief Pyramid level currently drawn (-1: display image alone). */
+    int m_pyramid_level{-1};
+
+    /** @brief Bumped whenever the image changes, so stale tiles are recognised. */
+    quint64 m_pyramid_generation{0};
+
+    /** @brief Smoothed pan velocity, in screen pixels per millisecond. */
+    QPointF m_pan_velocity{0, 0};
+
+    /** @brief Time since the last setPan() call. */
+    QElapsedTimer m_pan_timer;
 };
 
 } // namespace Display
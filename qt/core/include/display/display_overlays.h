@@ -0,0 +1,55 @@
+/**
+ * @file display_overlays.h
+ * @brief Culling aids drawn by the display shader (clipping warnings, focus peaking).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+namespace CaptureMoment::UI {
+namespace Display {
+
+/**
+ * @struct DisplayOverlays
+ * @brief Settings of the overlays the fragment shader draws over the displayed image.
+ *
+ * @details
+ * Computed per fragment on the displayed texture: they cost no engine time and follow
+ * every pan and zoom at the display refresh rate.
+ * - **Clipping**: pixels whose largest channel reaches `m_highlight_clip` (of the screen's
+ *   white) show red; pixels whose largest channel stays at or below `m_shadow_clip` show blue.
+ * - **Focus peaking**: pixels where the Sobel gradient of the displayed luma exceeds
+ *   `m_peaking_threshold` show green.
+ */
+struct DisplayOverlays {
+    /**
+     * @brief Shows the clipped highlights and shadows.
+     */
+    bool m_clipping { false };
+
+    /**
+     * @brief Shows the in-focus edges.
+     */
+    bool m_focus_peaking { false };
+
+    /**
+     * @brief Linear level, relative to the screen's white, from which a highlight is clipped.
+     */
+    float m_highlight_clip { 0.995f };
+
+    /**
+     * @brief Linear level at or below which a shadow is clipped.
+     */
+    float m_shadow_clip { 0.0005f };
+
+    /**
+     * @brief Sobel magnitude of the display-encoded luma above which an edge is in focus.
+     */
+    float m_peaking_threshold { 0.35f };
+
+    [[nodiscard]] bool operator==(const DisplayOverlays&) const = default;
+};
+
+} // namespace Display
+} // namespace CaptureMoment::UI
@@ -0,0 +1,109 @@
+/**
+ * @file tile_pyramid.h
+ * @brief Tile geometry of the multi-resolution display pyramid used for deep zoom.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QPoint>
+#include <QRect>
+#include <QRectF>
+#include <QSize>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace CaptureMoment::UI {
+namespace Display {
+
+/**
+ * @struct TileKey
+ * @brief Identifies one tile of the pyramid.
+ */
+struct TileKey {
+    int level{0};   ///< Pyramid level: 0 is full resolution, each level halves the size
+    int x{0};       ///< Tile column at this level
+    int y{0};       ///< Tile row at this level
+
+    [[nodiscard]] bool operator==(const TileKey&) const noexcept = default;
+};
+
+/**
+ * @struct TileKeyHash
+ * @brief Hash of a TileKey, for unordered containers.
+ */
+struct TileKeyHash {
+    [[nodiscard]] std::size_t operator()(const TileKey& key) const noexcept
+    {
+        const std::size_t h { std::hash<int>{}(key.level) };
+        return (h * 31u + std::hash<int>{}(key.x)) * 31u + std::hash<int>{}(key.y);
+    }
+};
+
+/**
+ * @class TilePyramid
+ * @brief Maps a viewport onto the tiles of a power-of-two image pyramid.
+ *
+ * @details
+ * Level L shows the source image at 1/2^L of its size, cut into k_tile_size square tiles
+ * (edge tiles are smaller). The display downsample covers the zoomed-out range; tiles are
+ * only needed once the viewport magnifies it, so the pyramid never holds more than the
+ * tiles a viewport touches.
+ */
+class TilePyramid {
+public:
+    /**
+     * @brief Tile edge, in pixels of its level.
+     */
+    static constexpr int k_tile_size { 512 };
+
+    /**
+     * @brief Most tiles kept resident at once: 64 x 512 x 512 RGBA16F is 128 MiB of GPU memory.
+     */
+    static constexpr std::size_t k_max_resident_tiles { 64 };
+
+    /**
+     * @brief Sets the full-resolution source size (clears nothing: the geometry is stateless).
+     */
+    void setSourceSize(const QSize& source_size) noexcept { m_source_size = source_size; }
+
+    /**
+     * @brief The full-resolution source size.
+     */
+    [[nodiscard]] QSize sourceSize() const noexcept { return m_source_size; }
+
+    /**
+     * @brief The level whose pixels are at least as fine as the screen pixels.
+     *
+     * @param source_per_screen_pixel Source pixels covered by one screen pixel.
+     * @return The coarsest sufficient level (0 when magnifying past the source resolution).
+     */
+    [[nodiscard]] static int levelFor(float source_per_screen_pixel) noexcept;
+
+    /**
+     * @brief Area of the source image covered by a tile, in full-resolution pixels.
+     */
+    [[nodiscard]] QRect tileSourceRect(const TileKey& key) const noexcept;
+
+    /**
+     * @brief Size of a tile in pixels of its level (k_tile_size, less at the right/bottom edges).
+     */
+    [[nodiscard]] QSize tilePixelSize(const TileKey& key) const noexcept;
+
+    /**
+     * @brief Tiles of a level intersecting an area of the source image.
+     *
+     * @param level The pyramid level.
+     * @param source_rect The area, in full-resolution pixels (clipped to the image).
+     * @return The tiles, row by row.
+     */
+    [[nodiscard]] std::vector<TileKey> tilesIntersecting(int level, const QRectF& source_rect) const;
+
+private:
+    QSize m_source_size;
+};
+
+} // namespace Display
+} // namespace CaptureMoment::UI
@@ -14,6 +14,7 @@
 #include <QSize>
 #include <QtGlobal>
 #include <algorithm>
+#include <cmath>
 
 namespace CaptureMoment::UI {
 namespace Display {
@@ -126,6 +127,36 @@ struct DisplayConfig {
     [[nodiscard]] consteval static float hidpiDprThreshold() noexcept {
         return 2.0f;
     }
+
+    // =========================================================================
+    // Downsample Levels
+    // =========================================================================
+
+    /**
+     * @brief Levels of the long edge of a downsample per doubling of its pixels.
+     *
+     * Downsample sizes are snapped up to the levels minDisplayDimension() × 2^(k/2)
+     * (256, 362, 512, 724, 1024, 1448, 2048, 2896...), capped at the plafond:
+     * a resize re-requests a downsample only when it crosses a level, and the
+     * engine's results keyed on the display size repeat from one resize to the next.
+     *
+     * @return Levels per doubling of the pixels (2).
+     */
+    [[nodiscard]] consteval static int downsampleLevelsPerDoubling() noexcept {
+        return 2;
+    }
+
+    /**
+     * @brief Levels the needed downsample must drop below the current one before it shrinks.
+     *
+     * A smaller viewport keeps the current texture, scaled down on the GPU, until it needs
+     * less than half the pixels (two levels); a larger one grows it at the next level.
+     *
+     * @return Levels of hysteresis when shrinking (2).
+     */
+    [[nodiscard]] consteval static int downsampleShrinkLevels() noexcept {
+        return 2;
+    }
 };
 
 // =============================================================================
@@ -167,5 +198,35 @@ inline int determinePlafond(int screen_physical_width, int screen_physical_heigh
     return DisplayConfig::plafondSmallScreen();
 }
 
+/**
+ * @brief Index of the smallest downsample level whose long edge is at least `dimension`.
+ *
+ * @param dimension Long edge needed, in pixels.
+ * @return Level index (0 for minDisplayDimension() and below).
+ */
+inline int downsampleLevelFor(int dimension) noexcept
+{
+    int level = 0;
+    while (std::round(DisplayConfig::minDisplayDimension()
+                      * std::exp2(static_cast<double>(level) / DisplayConfig::downsampleLevelsPerDoubling())) < dimension) {
+        ++level;
+    }
+    return level;
+}
+
+/**
+ * @brief Long edge of a downsample level, capped at the plafond.
+ *
+ * @param level Level index (see downsampleLevelFor()).
+ * @param plafond Screen-based ceiling (see determinePlafond()).
+ * @return Long edge in pixels.
+ */
+inline int downsampleLevelDimension(int level, int plafond) noexcept
+{
+    const double dimension { std::round(DisplayConfig::minDisplayDimension()
+                                        * std::exp2(static_cast<double>(level) / DisplayConfig::downsampleLevelsPerDoubling())) };
+    return std::min(static_cast<int>(dimension), plafond);
+}
+
 } // namespace Display
 } // namespace CaptureMoment::UI
@@ -100,6 +100,10 @@ public:
     
     /**
      * @brief Updates the viewport size.
+     *
+     * The maximum downsample grows as soon as the viewport needs the next level, and only
+     * shrinks once it needs DisplayConfig::downsampleShrinkLevels() levels less.
+     *
      * @param viewport_logical New logical viewport size.
      */
     void setViewportSize(const QSize& viewport_logical);
@@ -224,8 +228,14 @@ private:
 
     /**
      * @brief Updates the maximum downsample dimension based on current viewport and plafond.
+     *
+     * The dimension is snapped up to a downsample level (see DisplayConfig::downsampleLevelsPerDoubling()).
+     *
+     * @param hysteresis If true (viewport resizes), the dimension only shrinks once the needed level
+     *        is DisplayConfig::downsampleShrinkLevels() below the current one: until then the current
+     *        texture is scaled down on the GPU.
      */
-    void updateMaxDownsample();
+    void updateMaxDownsample(bool hysteresis = false);
 
     /**
      * @brief Whether initialize() has been called
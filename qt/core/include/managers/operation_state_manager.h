@@ -8,6 +8,8 @@
 #pragma once
 
 #include "operations/operation_descriptor.h"
+#include <cstddef>
+#include <optional>
 #include <vector>
 #include <mutex>
 
@@ -25,6 +27,10 @@ namespace Managers {
  * It does NOT directly interact with PhotoEngine or ImageControllerBase.
  * Its purpose is solely to store the state of operations and provide a thread-safe
  * method to retrieve the current list of active operations.
+ *
+ * Changes made between `beginTransaction()` and `commitTransaction()` (a preset, "reset all")
+ * are staged: `getActiveOperations()` keeps returning the list as it was until the outermost
+ * commit installs them all at once, so no reader sees half of them.
  */
 class OperationStateManager {
 public:
@@ -63,6 +69,13 @@ public:
      */
     void clearAllOperations();
 
+    /**
+     * @brief Replaces all active operations (e.g. with an edit history state).
+     *
+     * @param operations The new list of active operation descriptors.
+     */
+    void setOperations(std::vector<Core::Operations::OperationDescriptor> operations);
+
     /**
      * @brief Gets the current list of active operation descriptors.
      *
@@ -71,9 +84,32 @@ public:
      */
     [[nodiscard]] std::vector<Core::Operations::OperationDescriptor> getActiveOperations() const;
 
+    /**
+     * @brief Starts staging changes (transactions nest: only the outermost commit installs them).
+     */
+    void beginTransaction();
+
+    /**
+     * @brief Ends a transaction; the outermost one installs the staged changes.
+     * @return true if this ended the outermost transaction (the changes are now active).
+     */
+    bool commitTransaction();
+
+    /**
+     * @brief Checks whether changes are being staged.
+     */
+    [[nodiscard]] bool isInTransaction() const;
+
 private:
+    /**
+     * @brief The list changes apply to: the staged one during a transaction. Caller holds `m_mutex`.
+     */
+    [[nodiscard]] std::vector<Core::Operations::OperationDescriptor>& editedOperations();
+
     mutable std::mutex m_mutex; //!< Mutex protecting access to m_active_operations.
     std::vector<Core::Operations::OperationDescriptor> m_active_operations; //!< The current list of active operations.
+    std::optional<std::vector<Core::Operations::OperationDescriptor>> m_staged_operations; //!< The list being edited by a transaction.
+    std::size_t m_transaction_depth{0}; //!< Number of open transactions.
 };
 
 } // namespace Managers
@@ -0,0 +1,150 @@
+/**
+ * @file folder_image_model.h
+ * @brief List model of the images of a folder, for the virtualized filmstrip and grid views.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QString>
+#include <QUrl>
+
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::UI {
+
+namespace Models {
+
+/**
+ * @class FolderImageModel
+ * @brief The image files of one folder, by name, with the URL of their thumbnail.
+ *
+ * @details
+ * The model holds a path and a name per image, nothing decoded: a `GridView` or `ListView`
+ * instantiates delegates for the visible cells only, and each delegate's `Image` fetches its
+ * thumbnail asynchronously from `ThumbnailImageProvider` (the `thumbnail` role). A 10k-image
+ * folder costs about a megabyte here.
+ *
+ * The folder is listed on a pool thread and the model reset once with the whole list, so
+ * opening a large folder (or a slow network share) never stalls the GUI thread. Lives on, and
+ * must be used from, the GUI thread.
+ */
+class FolderImageModel : public QAbstractListModel {
+    Q_OBJECT
+
+    /** @property folder Absolute path of the listed folder (empty: none). */
+    Q_PROPERTY(QString folder READ folder WRITE setFolder NOTIFY folderChanged)
+
+    /** @property count Number of images listed. */
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+    /** @property loading true while the folder is being listed. */
+    Q_PROPERTY(bool loading READ isLoading NOTIFY loadingChanged)
+
+public:
+    /**
+     * @brief Roles of the model, named in `roleNames`.
+     */
+    enum Role {
+        PathRole = Qt::UserRole + 1,    ///< "path": absolute path of the file
+        FileNameRole,                   ///< "fileName": file name, for captions
+        UrlRole,                        ///< "url": file URL, for `ImageControllerBase::loadImageFromUrl`
+        ThumbnailRole                   ///< "thumbnail": `image://thumbnails/...` source of the cell
+    };
+
+    explicit FolderImageModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Drops the listing in progress.
+     */
+    ~FolderImageModel() override;
+
+    FolderImageModel(const FolderImageModel&) = delete;
+    FolderImageModel& operator=(const FolderImageModel&) = delete;
+
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+    [[nodiscard]] QString folder() const { return m_folder; }
+
+    /**
+     * @brief Lists another folder (the current list stays until the new one is ready).
+     */
+    void setFolder(const QString& folder);
+
+    /**
+     * @brief Lists the folder of a file (e.g. the image just opened).
+     */
+    Q_INVOKABLE void showFolderOf(const QUrl& file_url);
+
+    /**
+     * @brief Lists the folder again.
+     */
+    Q_INVOKABLE void reload();
+
+    /**
+     * @brief Row of a file, or -1 if it is not listed.
+     */
+    Q_INVOKABLE int indexOf(const QString& path) const;
+
+    [[nodiscard]] int count() const noexcept { return static_cast<int>(m_entries.size()); }
+    [[nodiscard]] bool isLoading() const noexcept { return m_loading; }
+
+signals:
+    void folderChanged();
+    void countChanged();
+    void loadingChanged();
+
+private:
+    /**
+     * @brief One listed image.
+     */
+    struct Entry {
+        QString m_path;
+        QString m_file_name;
+    };
+
+    /**
+     * @brief Link from a listing job back to the model, cut when the model is destroyed.
+     */
+    struct ListingGuard;
+
+    /**
+     * @brief Replaces the list with the result of listing `generation` (GUI thread).
+     */
+    void applyListing(unsigned generation, std::vector<Entry> entries);
+
+    /**
+     * @brief The listed folder.
+     */
+    QString m_folder;
+
+    /**
+     * @brief The images, by name.
+     */
+    std::vector<Entry> m_entries;
+
+    /**
+     * @brief Generation of the latest listing: an older one finishing late is ignored.
+     */
+    unsigned m_generation{0};
+
+    /**
+     * @brief true while a listing runs.
+     */
+    bool m_loading{false};
+
+    /**
+     * @brief Shared with the listing jobs.
+     */
+    std::shared_ptr<ListingGuard> m_guard;
+};
+
+} // namespace Models
+
+} // namespace CaptureMoment::UI
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <QQmlContext>
@@ -82,7 +83,31 @@ public:
      */
     [[nodiscard]] const std::vector<std::shared_ptr<UI::Models::Operations::BaseAdjustmentModel>>& getBaseAdjustmentModels() const { return m_base_adjustment_models; }
 
+    /**
+     * @brief Starts a batch of model changes (a preset, "reset all"). Transactions nest.
+     * @details While a transaction is open, the value changes of the models are staged by
+     *          their listener (`ImageControllerBase`) instead of each launching an engine run;
+     *          the outermost `commitTransaction` turns them into one snapshot and one request.
+     */
+    void beginTransaction() noexcept { ++m_transaction_depth; }
+
+    /**
+     * @brief Ends a transaction.
+     * @return true if this ended the outermost transaction: the staged changes are to be applied.
+     */
+    bool commitTransaction() noexcept;
+
+    /**
+     * @brief Checks whether model changes are being batched.
+     */
+    [[nodiscard]] bool isInTransaction() const noexcept { return m_transaction_depth > 0; }
+
 private:
+    /**
+     * @brief Number of open transactions.
+     */
+    std::size_t m_transaction_depth{0};
+
     /**
      * @brief Internal storage for the created operation model instances.
      * Models are stored as shared_ptr to manage their lifetime safely.
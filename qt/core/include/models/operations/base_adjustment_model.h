@@ -129,6 +129,22 @@ public slots:
      */
     void setValue(float val);
 
+    /**
+     * @brief Marks the control as pressed: the edits that follow are one gesture.
+     *
+     * Called from QML when the slider is pressed. ImageControllerBase forwards it to
+     * `PhotoEngine::beginInteraction` with the id of this operation.
+     */
+    void beginInteraction();
+
+    /**
+     * @brief Marks the control as released: the gesture is over and can be refined.
+     *
+     * Called from QML when the slider is released. ImageControllerBase forwards it to
+     * `PhotoEngine::endInteraction`.
+     */
+    void endInteraction();
+
 signals:
     /**
      * @brief Signal emitted when the adjustment value changes.
@@ -137,6 +153,16 @@ signals:
      * @param value The new value of the parameter.
      */
     void valueChanged(float value);
+
+    /**
+     * @brief Signal emitted when the control is pressed (see `beginInteraction`).
+     */
+    void interactionStarted();
+
+    /**
+     * @brief Signal emitted when the control is released (see `endInteraction`).
+     */
+    void interactionEnded();
 };
 
 } // namespace Models::Operations
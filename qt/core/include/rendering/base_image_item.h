@@ -11,6 +11,8 @@
 #include <QPointF>
 #include <QMutex>
 #include <QSize>
+#include <memory>
+#include "rendering/frame_handoff.h"
 #include "rendering/i_rendering_item_base.h"
 
 namespace CaptureMoment::UI {
@@ -22,7 +24,8 @@ namespace Rendering {
  *
  * It does NOT implement the IRenderingItemBase interface (that's done by derived classes).
  * It provides a common Qt Quick foundation for different rendering implementations (SGS, Painted, RHI).
- * Note: m_image_width and m_image_height are protected by m_image_mutex and require locking for thread-safe access.
+ * Images reach the rendering code through m_frames (lock-free); m_image_mutex protects the rest of the
+ * state shared with the render thread.
  */
 class BaseImageItem : public IRenderingItemBase
 {
@@ -59,21 +62,21 @@ public:
 
         /**
      * @brief Gets the width of the image.
-     * This method provides thread-safe access to m_image_width.
+     * Lock-free: the width of the latest published frame.
      * @return The image width in pixels.
      */
     [[nodiscard]] int imageWidth() const override;
 
     /**
      * @brief Gets the height of the image.
-     * This method provides thread-safe access to m_image_height.
+     * Lock-free: the height of the latest published frame.
      * @return The image height in pixels.
      */
     [[nodiscard]] int imageHeight() const override;
 
     /**
      * @brief Checks if the full image data is loaded and valid.
-     * This method provides thread-safe access to check the image state.
+     * Lock-free: checks the size of the latest published frame.
      * @return True if the image is valid, false otherwise.
      */
     [[nodiscard]] bool isImageValid() const override;
@@ -88,27 +91,26 @@ public:
     [[nodiscard]] QMutex* getImageMutex() const override { return &m_image_mutex; };
 
     /**
-     * @brief Gets a pointer to the full image data.
-     * This method provides access to the internal image data pointer.
-     * @return A pointer to the ImageRegion, or nullptr if no image is loaded.
+     * @brief Gets the handoff carrying the images to the render thread.
+     * Shared with the renderer, which may outlive the item.
+     * @return The handoff (never null).
      */
-    [[nodiscard]] const Core::Common::ImageRegion* getFullImage() const override {
-        return m_full_image.get();}
+    [[nodiscard]] std::shared_ptr<FrameHandoff> frameHandoff() const { return m_frames; }
 
 protected:
 
     /* --------------------- Protected Members --------------------*/
 
     /**
-     * @brief Unique pointer to the full image data displayed by this item.
+     * @brief Images set on the item, on their way to the render thread.
      *
-     * This member holds the complete image data (CPU side, float32) which is used to update the display.
+     * The item publishes (GUI thread), the rendering code takes and converts (render thread):
+     * neither waits for the other.
      */
-    std::unique_ptr<Core::Common::ImageRegion> m_full_image;
+    std::shared_ptr<FrameHandoff> m_frames { std::make_shared<FrameHandoff>() };
 
     /**
-     * @brief Mutex protecting access to m_full_image and related state.
-     * Ensures thread-safe updates to the image data.
+     * @brief Mutex protecting the display state shared with the render thread (not the images).
      */
     mutable QMutex m_image_mutex;
 
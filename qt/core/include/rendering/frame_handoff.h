@@ -0,0 +1,175 @@
+/**
+ * @file frame_handoff.h
+ * @brief Lock-free handoff of the displayed image from the GUI thread to the render thread.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+#include "common/frame_mailbox.h"
+#include "common/image_region.h"
+#include "common/seqlock.h"
+
+#include <QMutex>
+#include <QRect>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::UI {
+
+namespace Rendering {
+
+/**
+ * @class FrameHandoff
+ * @brief Carries the images set on a rendering item to the code that converts and uploads them.
+ *
+ * @details
+ * The producer is the thread setting images on the item (`DisplayManager`, GUI thread); the
+ * consumer is the render-thread code turning them into texture data. Whole images go through a
+ * `Core::Common::FrameMailbox`: publishing and acquiring are single atomic exchanges, so the
+ * producer never waits for a conversion in progress and the consumer converts the frame it
+ * acquired with no lock held. Images published faster than they are drawn replace each other.
+ *
+ * Tiles must not be dropped, so they are queued instead (O(1) under `m_tiles_mutex`, never
+ * held while pixels are copied) and merged by the consumer into its own frame. Each frame has a
+ * generation: tiles queued for an image a newer one already replaced are discarded.
+ *
+ * Shared (`std::shared_ptr`) between the item and its renderer, so either may be destroyed first.
+ */
+class FrameHandoff {
+public:
+    /**
+     * @brief An image published by the producer.
+     */
+    struct Frame {
+        /**
+         * @brief Linear float image, or null when the frame is a display image.
+         */
+        std::unique_ptr<Core::Common::ImageRegion> m_image;
+
+        /**
+         * @brief Display-ready image; takes precedence over `m_image`.
+         *
+         * Shared, never copied: the same bytes may also be held by the edit history and,
+         * until its next upload, by the renderer uploading from them.
+         */
+        std::shared_ptr<const Core::Common::DisplayImage> m_display_image;
+
+        /**
+         * @brief Generation of the frame (tiles carry the generation they apply to).
+         */
+        std::uint64_t m_generation { 0 };
+    };
+
+    /**
+     * @brief Dimensions of the latest published frame.
+     */
+    struct Size {
+        int m_width { 0 };
+        int m_height { 0 };
+    };
+
+    /**
+     * @brief What changed in the consumer's frame since its previous `take()`.
+     */
+    struct Update {
+        /**
+         * @brief A new frame replaced the previous one: convert it whole.
+         */
+        bool m_replaced { false };
+
+        /**
+         * @brief Sub-rectangles of the (unreplaced) linear image updated by tiles.
+         */
+        std::vector<QRect> m_dirty_regions;
+    };
+
+    /* ----------------------- Producer --------------------------- */
+
+    /**
+     * @brief Publishes a linear image (replaces the previous frame).
+     */
+    void publishImage(std::unique_ptr<Core::Common::ImageRegion> image);
+
+    /**
+     * @brief Publishes a display-ready image (replaces the previous frame).
+     */
+    void publishDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image);
+
+    /**
+     * @brief Queues a tile of the current linear image; a tile of the full size is published as a frame.
+     * @return false if there is no linear image or the tile falls outside of it.
+     */
+    bool publishTile(std::unique_ptr<Core::Common::ImageRegion> tile);
+
+    /* ----------------------- Any thread ------------------------- */
+
+    /**
+     * @brief Dimensions of the latest published frame, {0, 0} before the first one.
+     */
+    [[nodiscard]] Size size() const noexcept { return m_size.load(); }
+
+    /* ----------------------- Consumer --------------------------- */
+
+    /**
+     * @brief Takes the latest frame, then merges the tiles queued for it.
+     */
+    [[nodiscard]] Update take();
+
+    /**
+     * @brief The consumer's frame, valid until its next `take()`.
+     */
+    [[nodiscard]] const Frame& current() const noexcept { return m_frames.front(); }
+
+private:
+    /**
+     * @brief A tile and the generation of the image it belongs to.
+     */
+    struct PendingTile {
+        std::uint64_t m_generation { 0 };
+        std::unique_ptr<Core::Common::ImageRegion> m_tile;
+    };
+
+    /**
+     * @brief Publishes the back frame and releases the stale one handed back (producer thread).
+     */
+    void publishBack(Size size);
+
+    /**
+     * @brief Latest frames, in flight from the producer to the consumer.
+     */
+    Core::Common::FrameMailbox<Frame> m_frames;
+
+    /**
+     * @brief Dimensions of the latest published frame, readable from any thread.
+     */
+    Core::Common::Seqlock<Size> m_size;
+
+    /**
+     * @brief Generation of the latest published frame (producer thread only).
+     */
+    std::uint64_t m_generation { 0 };
+
+    /**
+     * @brief true if the latest published frame is a linear image (producer thread only).
+     */
+    bool m_linear { false };
+
+    /**
+     * @brief Protects `m_tiles` (push and swap only).
+     */
+    QMutex m_tiles_mutex;
+
+    /**
+     * @brief Tiles queued since the consumer's last `take()`.
+     */
+    std::vector<PendingTile> m_tiles;
+};
+
+} // namespace Rendering
+
+} // namespace CaptureMoment::UI
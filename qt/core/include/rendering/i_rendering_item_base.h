@@ -10,9 +10,14 @@
 #include <QObject>
 #include <QMutex>
 #include <QPointF>
+#include <QRectF>
 #include <memory>
 
 #include "common/image_region.h"
+#include "common/display_image.h"
+#include "common/types/image_orientation.h"
+#include "display/display_overlays.h"
+#include "display/tile_pyramid.h"
 
 namespace CaptureMoment::UI {
 
@@ -48,6 +53,17 @@ public:
      * @param image The image data.
      */
     virtual void setImage(std::unique_ptr<Core::Common::ImageRegion> image) = 0;
+
+    /**
+     * @brief Sets a display-ready image (sRGB-encoded RGBA8) to be displayed.
+     *
+     * Produced by the fused pipeline display stage: the item uploads the bytes
+     * as is, without color conversion. Replaces any image set with `setImage`.
+     * The image is shared, not copied, on its way to the upload.
+     *
+     * @param image The display image data (not null).
+     */
+    virtual void setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image) = 0;
     
     /**
      * @brief Updates a specific tile of the displayed image.
@@ -111,11 +127,66 @@ public:
     [[nodiscard]] virtual QMutex* getImageMutex() const = 0;
 
     /**
-     * @brief Gets a pointer to the full image data.
-     * This method provides access to the internal image data pointer.
-     * @return A pointer to the ImageRegion, or nullptr if no image is loaded.
+     * @brief Whether the item draws a deep-zoom tile pyramid over the display image.
+     * @return false by default: the DisplayManager then requests no tiles.
+     */
+    [[nodiscard]] virtual bool supportsTilePyramid() const { return false; }
+
+    /**
+     * @brief Hands over one full-detail tile of the pyramid.
+     *
+     * @param key The tile (level and position in the pyramid).
+     * @param display_rect Where the tile lies, in display image coordinates (the space of `setImage`).
+     * @param tile Linear RGBA_F32 pixels of the tile, at its level's resolution.
+     */
+    virtual void setPyramidTile(const Display::TileKey& key, const QRectF& display_rect,
+                                std::unique_ptr<Core::Common::ImageRegion> tile)
+    {
+        (void)key;
+        (void)display_rect;
+        (void)tile;
+    }
+
+    /**
+     * @brief Selects the pyramid level drawn over the display image.
+     * @param level The level, or -1 to draw the display image alone.
+     */
+    virtual void setPyramidLevel(int level) { (void)level; }
+
+    /**
+     * @brief Drops every pyramid tile (the image content changed).
+     */
+    virtual void clearPyramidTiles() {}
+
+    /**
+     * @brief Hands over the unedited display image, kept for before/after comparison.
+     *
+     * Items that cannot compare on the GPU ignore it (the default).
+     *
+     * @param image Linear RGBA_F32 pixels of the freshly loaded image, at display size.
+     */
+    virtual void setOriginalImage(std::unique_ptr<Core::Common::ImageRegion> image) { (void)image; }
+
+    /**
+     * @brief Sets the clipping and focus peaking overlays.
+     *
+     * Items without a display shader ignore them (the default).
+     */
+    virtual void setOverlays(const Display::DisplayOverlays& overlays) { (void)overlays; }
+
+    /**
+     * @brief Whether the item draws the image turned by its EXIF orientation (see `setOrientation`).
+     * @return false by default: the DisplayManager then lays out the stored frame.
+     */
+    [[nodiscard]] virtual bool supportsOrientation() const { return false; }
+
+    /**
+     * @brief Sets the EXIF orientation the image is drawn with.
+     *
+     * The images handed over stay in the stored frame; the item turns its quad. Items that
+     * do not support it draw the stored frame (the default).
      */
-    [[nodiscard]] virtual const Core::Common::ImageRegion* getFullImage() const = 0;
+    virtual void setOrientation(Core::Common::ImageOrientation orientation) { (void)orientation; }
 };
 
 } // namespace Rendering
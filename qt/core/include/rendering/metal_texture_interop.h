@@ -0,0 +1,59 @@
+/**
+ * @file metal_texture_interop.h
+ * @brief Aliases device-resident display buffers as Metal textures (zero-copy display).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/display_image.h"
+
+#include <QtGlobal>
+
+class QRhi;
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @brief Helpers turning a `Core::Common::DisplayDeviceBuffer` into a native texture for `QRhiTexture::createFrom`.
+ *
+ * @details
+ * Only built on Apple platforms (`CAPTUREMOMENT_METAL_INTEROP`), where Halide's Metal buffers
+ * can back a linear texture directly. Elsewhere every function reports "unavailable" and the
+ * display keeps uploading host bytes.
+ */
+namespace MetalInterop {
+
+#ifdef CAPTUREMOMENT_METAL_INTEROP
+
+/**
+ * @brief Checks that the RHI runs on Metal, so that engine buffers can be sampled in place.
+ */
+[[nodiscard]] bool isAvailable(QRhi* rhi);
+
+/**
+ * @brief Creates an RGBA8 texture over the device buffer of a display image.
+ *
+ * @param rhi The RHI whose device must own the buffer.
+ * @param image A display image with `isOnDevice()`.
+ * @return A retained `id<MTLTexture>`, or 0 if the buffer cannot be aliased (other device, layout).
+ */
+[[nodiscard]] quint64 createTexture(QRhi* rhi, const Core::Common::DisplayImage& image);
+
+/**
+ * @brief Releases a texture returned by createTexture().
+ */
+void releaseTexture(quint64 texture);
+
+#else
+
+[[nodiscard]] inline bool isAvailable(QRhi*) { return false; }
+[[nodiscard]] inline quint64 createTexture(QRhi*, const Core::Common::DisplayImage&) { return 0; }
+inline void releaseTexture(quint64) {}
+
+#endif
+
+} // namespace MetalInterop
+
+} // namespace CaptureMoment::UI::Rendering
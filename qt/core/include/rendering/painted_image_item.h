@@ -9,6 +9,9 @@
 
 #include <QQuickPaintedItem>
 #include <QImage>
+#include <QThreadPool>
+
+#include <cstdint>
 
 #include "rendering/base_image_item.h"
 
@@ -48,6 +51,36 @@ private:
      */
     QImage m_current_qimage;
 
+    /**
+     * @brief m_current_qimage resampled to the current zoom, drawn without scaling.
+     *
+     * Computed off the GUI thread by requestScaledImage(); valid only while
+     * m_scaled_generation equals m_scale_generation. Protected by m_image_mutex.
+     */
+    QImage m_scaled_qimage;
+
+    /**
+     * @brief Bumped whenever the image or the zoom changes (protected by m_image_mutex).
+     */
+    std::uint64_t m_scale_generation{0};
+
+    /**
+     * @brief Generation m_scaled_qimage was computed for (protected by m_image_mutex).
+     */
+    std::uint64_t m_scaled_generation{0};
+
+    /**
+     * @brief Single-thread pool running the rescale jobs; pending jobs are dropped by newer requests.
+     */
+    QThreadPool m_scale_pool;
+
+    /**
+     * @brief Largest pre-scaled image kept, in pixels (64 MB of RGBA8).
+     *
+     * Deep zoom-in beyond this keeps drawing the source image through the painter's scale.
+     */
+    static constexpr qint64 k_max_scaled_pixels{16 * 1024 * 1024};
+
 public:
     /**
      * @brief Constructs a new PaintedImageItem.
@@ -56,9 +89,9 @@ public:
     explicit PaintedImageItem(QQuickItem* parent = nullptr);
     
     /**
-     * @brief Destroys the PaintedImageItem.
+     * @brief Destroys the PaintedImageItem, waiting for a running rescale job.
      */
-    ~PaintedImageItem() = default;
+    ~PaintedImageItem() override;
     
     /**
      * @brief Sets the full image to be displayed.
@@ -69,6 +102,12 @@ public:
      * @param image The image data.
      */
     void setImage(std::unique_ptr<Core::Common::ImageRegion> image) override;
+
+    /**
+     * @brief Sets a display-ready (sRGB RGBA8) image, uploaded without conversion.
+     * @param image The display image data.
+     */
+    void setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image) override;
     
     /**
      * @brief Updates a specific tile of the displayed image.
@@ -81,14 +120,31 @@ public:
      */
     void updateTile(std::unique_ptr<Core::Common::ImageRegion> tile) override;
 
+    /**
+     * @brief Checks if an image was converted for painting.
+     * @details Images are converted on the calling thread, not handed off: the size is m_current_qimage's.
+     */
+    [[nodiscard]] bool isImageValid() const override;
+
+    /**
+     * @brief Gets the width of m_current_qimage.
+     */
+    [[nodiscard]] int imageWidth() const override;
+
+    /**
+     * @brief Gets the height of m_current_qimage.
+     */
+    [[nodiscard]] int imageHeight() const override;
+
 protected:
     // QQuickPaintedItem override
     /**
      * @brief Paints the image using QPainter.
      * 
      * This override is called by the Qt Quick scene graph to render the item's content.
-     * It uses QPainter to draw the internal m_current_qimage, applying zoom and pan
-     * transformations.
+     * When the pre-scaled image matches the current zoom, it is blitted at the pan offset;
+     * otherwise (rescale still running, or zoom too deep) m_current_qimage is drawn with the
+     * zoom and pan transformations.
      * 
      * @param painter The QPainter instance to use for drawing.
      */
@@ -126,19 +182,26 @@ private:
      */
     [[nodiscard]] QImage convertImageRegionToQImage(const Core::Common::ImageRegion& region) const;
 
+    /**
+     * @brief Schedules the resampling of m_current_qimage to the current zoom on m_scale_pool.
+     *
+     * Invalidates the current pre-scaled image and drops pending jobs; the job stores its result
+     * only if no newer request was made meanwhile, then schedules a repaint. Nothing is scheduled
+     * at zoom 1 or beyond k_max_scaled_pixels.
+     */
+    void requestScaledImage();
+
     /**
      * @brief Checks if the source image is valid AND the converted QImage is not null.
      *
-     * This method provides a convenient way to check if both the source image data
-     * (managed by BaseImageItem/IRenderingItemBase) is valid and the internal
-     * QImage representation (m_current_qimage) used for painting is ready.
-     * It combines the checks from isImageValid() and m_current_qimage.isNull().
+     * The source image is converted as soon as it is set, so this is true once the
+     * internal QImage representation (m_current_qimage) used for painting is ready.
      *
      * This method is intended for use within PaintedImageItem methods like paint()
      * and updateTile() to avoid redundant checks and potential deadlocks from
      * calling isImageValid() inside a mutex-locked scope.
      *
-     * @return True if both the source image is valid and m_current_qimage is not null, false otherwise.
+     * @return True if m_current_qimage is not null, false otherwise.
      */
     [[nodiscard]] bool isImagePaintValid() const;
 
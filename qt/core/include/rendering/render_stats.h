@@ -0,0 +1,69 @@
+/**
+ * @file render_stats.h
+ * @brief Texture upload timings reported by the renderers (read by the performance overlay).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @class RenderStats
+ * @brief Process-wide accumulator of the texture uploads of all image items.
+ *
+ * @details
+ * The renderers time the CPU side of each upload (staging the pixels and recording the
+ * upload in the frame's batch) on the render thread; a reader periodically takes the
+ * accumulated totals. Lock-free: two relaxed atomics per upload.
+ */
+class RenderStats {
+public:
+    /**
+     * @brief Uploads accumulated since the previous `takeTextureUploads`.
+     */
+    struct Uploads {
+        /** @brief Number of uploads. */
+        std::uint64_t m_count { 0 };
+        /** @brief Total time spent in the uploads, in nanoseconds. */
+        std::int64_t m_total_ns { 0 };
+    };
+
+    /**
+     * @class ScopedUpload
+     * @brief Records the lifetime of a scope as one texture upload.
+     */
+    class ScopedUpload {
+    public:
+        ScopedUpload() noexcept : m_begin(std::chrono::steady_clock::now()) {}
+
+        ~ScopedUpload()
+        {
+            recordTextureUpload(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_begin).count());
+        }
+
+        ScopedUpload(const ScopedUpload&) = delete;
+        ScopedUpload& operator=(const ScopedUpload&) = delete;
+
+    private:
+        std::chrono::steady_clock::time_point m_begin;
+    };
+
+    /**
+     * @brief Adds one upload (any thread).
+     * @param duration_ns Time spent in the upload.
+     */
+    static void recordTextureUpload(std::int64_t duration_ns) noexcept;
+
+    /**
+     * @brief Returns the uploads recorded since the last call, and starts a new window.
+     */
+    [[nodiscard]] static Uploads takeTextureUploads() noexcept;
+};
+
+} // namespace CaptureMoment::UI::Rendering
@@ -8,10 +8,19 @@
 #pragma once
 
 #include <QQuickRhiItem>
+#include <QHash>
+#include <QMetaObject>
 #include <QMutex>
+#include <QRect>
+#include <QString>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "rendering/base_image_item.h"
+#include "display/display_lut.h"
+#include "display/display_overlays.h"
 
 namespace CaptureMoment::UI {
 
@@ -23,6 +32,34 @@ namespace CaptureMoment::UI {
  */
 namespace Rendering {
 
+/**
+ * @brief Encoding of the image output, from the window's swapchain.
+ *
+ * The values are those of the `hdrOutput` uniform of image_display.frag.
+ * Uses std::uint8_t as underlying type for memory efficiency.
+ */
+enum class HdrOutput : std::uint8_t {
+    /**
+     * @brief 8-bit SDR: sRGB (or Display P3, or the display transform cube) encoding.
+     */
+    Sdr = 0,
+
+    /**
+     * @brief FP16 scRGB: linear Rec.709, 1.0 = 80 nits, values above 1 and below 0 kept.
+     */
+    ExtendedSrgbLinear = 1,
+
+    /**
+     * @brief HDR10: Rec.2020 primaries, SMPTE ST 2084 (PQ) encoding.
+     */
+    Hdr10 = 2,
+
+    /**
+     * @brief Extended linear Display P3 (macOS EDR): 1.0 = SDR white.
+     */
+    ExtendedDisplayP3Linear = 3
+};
+
 /**
  * @class RHIImageItem
  * @brief Modern QQuickItem that renders an image via RHI (Vulkan/Metal/DX12/OpenGL) using QQuickRhiItem.
@@ -37,12 +74,13 @@ namespace Rendering {
  * by the RHIImageItemRenderer class.
  *
  * This class inherits from QQuickRhiItem for RHI integration and BaseImageItem for common state
- * management (zoom, pan, mutex-protected image storage).
+ * management (zoom, pan, lock-free frame handoff).
  *
  * @par Threading Model
  * - GUI Thread: RHIImageItem lives here, receives setImage() calls
  * - Render Thread: RHIImageItemRenderer lives here, performs GPU operations
- * - Synchronization: synchronize() copies data between threads safely via mutex
+ * - Synchronization: synchronize() copies the display state under the item's mutex; images
+ *   go through the FrameHandoff and are converted in render(), with no lock held
  *
  * @par Usage Example
  * @code
@@ -66,12 +104,107 @@ class RHIImageItem : public QQuickRhiItem, public BaseImageItem {
 
 private:
     /**
-     * @brief Flag indicating if the GPU texture needs to be updated from m_full_image.
+     * @brief A pyramid tile handed over by setPyramidTile(), waiting for synchronize().
+     */
+    struct PyramidTileUpdate {
+        Display::TileKey key;
+        QRectF display_rect;
+        std::unique_ptr<Core::Common::ImageRegion> tile;
+    };
+
+    /**
+     * @brief Pyramid tiles not yet taken by the renderer (protected by m_image_mutex).
+     */
+    std::vector<PyramidTileUpdate> m_pyramid_updates;
+
+    /**
+     * @brief Pyramid level drawn over the display image, -1 for none (protected by m_image_mutex).
+     */
+    int m_pyramid_level{-1};
+
+    /**
+     * @brief Set by clearPyramidTiles(): the renderer drops its tile cache (protected by m_image_mutex).
+     */
+    bool m_pyramid_cleared{false};
+
+    /**
+     * @brief Exposure preview in EV, applied by the fragment shader (protected by m_image_mutex).
+     */
+    float m_exposure_preview{0.0f};
+
+    /**
+     * @brief Whether output is encoded for a Display P3 screen (protected by m_image_mutex).
+     */
+    bool m_display_p3{false};
+
+    /**
+     * @brief Unedited display image set by setOriginalImage(), until the renderer takes it (protected by m_image_mutex).
+     */
+    std::unique_ptr<Core::Common::ImageRegion> m_original_image;
+
+    /**
+     * @brief Before/after split, as a fraction of the image width shown unedited (protected by m_image_mutex).
+     */
+    float m_compare_split{0.0f};
+
+    /**
+     * @brief Clipping and focus peaking overlays, drawn by the fragment shader (protected by m_image_mutex).
+     */
+    Display::DisplayOverlays m_overlays;
+
+    /**
+     * @brief EXIF orientation the quad is turned by (protected by m_image_mutex).
+     */
+    Core::Common::ImageOrientation m_orientation{Core::Common::ImageOrientation::Normal};
+
+    /**
+     * @brief Display transform cube of the current screen, nullptr for the built-in encode (protected by m_image_mutex).
+     */
+    std::shared_ptr<const Display::DisplayLut> m_display_lut;
+
+    /**
+     * @brief Set when m_display_lut changed since the last synchronize() (protected by m_image_mutex).
+     */
+    bool m_display_lut_dirty{false};
+
+    /**
+     * @brief Display transform cubes by screen name; "" applies to screens without their own (GUI thread).
+     */
+    QHash<QString, std::shared_ptr<const Display::DisplayLut>> m_screen_luts;
+
+    /**
+     * @brief Connection to the window's screenChanged signal (GUI thread).
+     */
+    QMetaObject::Connection m_screen_connection;
+
+    /**
+     * @brief Picks the cube of the window's current screen and hands it to the renderer (GUI thread).
+     */
+    void updateActiveDisplayLut();
+
+    /**
+     * @brief Whether the renderer samples device-resident display images in place.
+     *
+     * Written by the renderer (render thread), read from any thread.
+     */
+    std::atomic<bool> m_device_images_supported{false};
+
+    /**
+     * @brief Records the renderer's device image support and notifies on change (render thread).
+     */
+    void setDeviceImagesSupported(bool supported);
+
+    /**
+     * @brief Encoding the renderer outputs, from the window's swapchain.
      *
-     * Set to true when setImage or updateTile is called to signal the render thread.
-     * This flag is accessed from both GUI and render threads, protected by m_image_mutex.
+     * Written by the renderer (render thread), read from any thread.
      */
-    bool m_texture_needs_update{false};
+    std::atomic<HdrOutput> m_hdr_output{HdrOutput::Sdr};
+
+    /**
+     * @brief Records the renderer's output encoding and notifies on change (render thread).
+     */
+    void setHdrOutput(HdrOutput output);
 
     friend class RHIImageItemRenderer;
 
@@ -97,64 +230,192 @@ public:
     /**
      * @brief Sets the full image to be displayed.
      *
-     * This method safely updates the internal image data and marks the GPU texture
-     * for an update on the next render pass. The texture update happens in the render
-     * thread during the synchronize() call.
+     * This method publishes the image on the frame handoff; the renderer converts and
+     * uploads it in its next render(), on the render thread.
      *
      * @param image The image data as an ImageRegion. Ownership is transferred.
      *
      * @pre image != nullptr
      * @pre image->isValid() == true
-     * @post m_full_image contains the new image
-     * @post m_texture_needs_update is set to true
      *
-     * @note Thread-safe: uses m_image_mutex
+     * @note Lock-free: never waits for a conversion in progress
      * @note Called from GUI thread
      */
     void setImage(std::unique_ptr<Core::Common::ImageRegion> image) override;
 
+    /**
+     * @brief Sets a display-ready (sRGB RGBA8) image, uploaded without conversion.
+     * @param image The display image data.
+     */
+    void setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image) override;
+
     /**
      * @brief Updates a specific tile of the displayed image.
      *
-     * This method merges the data from the provided tile into the full image buffer
-     * and marks the GPU texture for an update. It's intended for incremental updates
-     * after processing specific regions.
+     * This method queues the tile on the frame handoff; the renderer merges it into its
+     * copy of the image and uploads only its sub-rectangle. It's intended for incremental
+     * updates after processing specific regions.
      *
      * @param tile The image tile containing the updated region. Ownership is transferred.
      *
      * @pre tile != nullptr
      * @pre tile->isValid() == true
-     * @pre m_full_image != nullptr (base image must exist)
+     * @pre a linear image was set (base image must exist)
      *
-     * @note Thread-safe: uses m_image_mutex
      * @note Called from GUI thread
      */
     void updateTile(std::unique_ptr<Core::Common::ImageRegion> tile) override;
 
     /**
-     * @brief Gets the state of the texture update flag.
+     * @brief The RHI renderer keeps a GPU tile cache: deep zoom is supported.
+     */
+    [[nodiscard]] bool supportsTilePyramid() const override { return true; }
+
+    /**
+     * @brief Queues a pyramid tile for upload to the renderer's tile cache.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setPyramidTile(const Display::TileKey& key, const QRectF& display_rect,
+                        std::unique_ptr<Core::Common::ImageRegion> tile) override;
+
+    /**
+     * @brief Selects the pyramid level drawn over the display image (-1 for none).
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setPyramidLevel(int level) override;
+
+    /**
+     * @brief Drops the queued tiles and the renderer's tile cache.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void clearPyramidTiles() override;
+
+    /**
+     * @brief Sets the exposure preview, applied on the GPU without any engine work.
+     *
+     * Only affects linear images (setImage()); display-ready images are shown as is.
+     *
+     * @param ev Exposure offset in stops.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setExposurePreview(float ev);
+
+    /**
+     * @brief Gets the exposure preview in stops.
+     */
+    [[nodiscard]] float exposurePreview() const;
+
+    /**
+     * @brief Selects Display P3 output instead of sRGB for wide-gamut screens.
+     * @param enabled true to map Rec.709 primaries to P3 before encoding.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setDisplayP3(bool enabled);
+
+    /**
+     * @brief Whether output is encoded for a Display P3 screen.
+     */
+    [[nodiscard]] bool displayP3() const;
+
+    /**
+     * @brief Keeps the unedited display image on the GPU for before/after comparison.
+     *
+     * Uploaded once into a second texture; comparing is then a shader uniform, with no engine work.
      *
-     * This method provides access to the flag indicating if the GPU texture
-     * needs to be updated from the internal image data.
+     * @param image Linear RGBA_F32 pixels of the freshly loaded image.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setOriginalImage(std::unique_ptr<Core::Common::ImageRegion> image) override;
+
+    /**
+     * @brief Sets the before/after split.
      *
-     * @return True if the texture needs an update, false otherwise.
+     * The part of the image left of the split shows the original, the rest the edited image:
+     * 0 shows the edit only, 1 the original only (toggle), anything between a split view.
      *
+     * @param position Fraction of the image width, clamped to [0, 1].
      * @note Thread-safe: uses m_image_mutex
      */
-    [[nodiscard]] bool textureNeedsUpdate() const;
+    void setCompareSplit(float position);
 
     /**
-     * @brief Sets the state of the texture update flag.
+     * @brief Gets the before/after split (fraction of the image width shown unedited).
+     */
+    [[nodiscard]] float compareSplit() const;
+
+    /**
+     * @brief Sets the clipping and focus peaking overlays.
      *
-     * This method allows setting the flag indicating if the GPU texture
-     * needs to be updated. Typically called from the render thread during
-     * synchronize() after texture upload is complete.
+     * Evaluated per fragment on the displayed texture: toggling them, like panning with
+     * them on, costs no engine work.
      *
-     * @param needs_update The new state of the flag.
+     * @note Thread-safe: uses m_image_mutex
+     */
+    void setOverlays(const Display::DisplayOverlays& overlays) override;
+
+    /**
+     * @brief The quad is turned by the renderer's transform: no pixel is moved.
+     */
+    [[nodiscard]] bool supportsOrientation() const override { return true; }
+
+    /**
+     * @brief Sets the EXIF orientation the image is drawn with.
+     *
+     * The display image and the tiles stay in the stored frame; the renderer turns their quads.
      *
      * @note Thread-safe: uses m_image_mutex
      */
-    void setTextureNeedsUpdate(bool needs_update);
+    void setOrientation(Core::Common::ImageOrientation orientation) override;
+
+    /**
+     * @brief Sets the display transform cube used while the window is on a screen.
+     *
+     * The fragment shader then samples the cube instead of the built-in sRGB/P3 encode,
+     * for linear and display-ready images alike. Moving the window to another screen
+     * switches to that screen's cube without re-baking.
+     *
+     * @param screen_name `QScreen::name()`, or "" for every screen without its own cube.
+     * @param lut The baked cube, or nullptr to remove the screen's cube.
+     */
+    void setScreenDisplayLut(const QString& screen_name, std::shared_ptr<const Display::DisplayLut> lut);
+
+    /**
+     * @brief Bakes a monitor ICC profile and uses it for a screen (see setScreenDisplayLut()).
+     * @return false if the profile cannot be read.
+     */
+    Q_INVOKABLE bool loadScreenIccProfile(const QString& screen_name, const QString& icc_path);
+
+    /**
+     * @brief Bakes an OCIO display/view and uses it for a screen (see setScreenDisplayLut()).
+     * @return false if OCIO has no such display/view.
+     */
+    Q_INVOKABLE bool setScreenOcioDisplay(const QString& screen_name, const QString& display, const QString& view);
+
+    /**
+     * @brief Whether a display transform cube is applied on the current screen.
+     */
+    [[nodiscard]] bool hasDisplayLut() const;
+
+    /**
+     * @brief Whether display images may stay on the GPU (see `Core::Common::DisplayDeviceBuffer`).
+     *
+     * True once the renderer runs on a backend that can alias the engine's device buffers
+     * (Metal). Thread-safe.
+     */
+    [[nodiscard]] bool supportsDeviceImages() const noexcept { return m_device_images_supported.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Encoding of the output on the window's current swapchain. Thread-safe.
+     *
+     * HDR output needs an HDR swapchain, requested through `QSG_RHI_HDR` (`scrgb`, `hdr10` or
+     * `p3`) before the window is created; the item then renders into a half-float color buffer.
+     */
+    [[nodiscard]] HdrOutput hdrOutput() const noexcept { return m_hdr_output.load(std::memory_order_acquire); }
+
+    /**
+     * @brief true if an HDR swapchain was requested for the windows of this process (`QSG_RHI_HDR`).
+     */
+    [[nodiscard]] static bool hdrSwapChainRequested();
 
 signals:
     /**
@@ -177,6 +438,42 @@ signals:
      */
     void imageSizeChanged();
 
+    /**
+     * @brief Signal emitted when the exposure preview changes.
+     * @param ev The new exposure offset in stops.
+     */
+    void exposurePreviewChanged(float ev);
+
+    /**
+     * @brief Signal emitted when the output color space changes.
+     * @param enabled true for Display P3, false for sRGB.
+     */
+    void displayP3Changed(bool enabled);
+
+    /**
+     * @brief Signal emitted when the before/after split changes.
+     * @param position The new split, as a fraction of the image width.
+     */
+    void compareSplitChanged(float position);
+
+    /**
+     * @brief Signal emitted when the display transform cube of the current screen changes.
+     * @param active true if a cube is applied, false for the built-in encode.
+     */
+    void displayLutChanged(bool active);
+
+    /**
+     * @brief Signal emitted when the renderer's device image support is known or changes.
+     * @param supported true if device-resident display images are sampled in place.
+     */
+    void deviceImagesSupportedChanged(bool supported);
+
+    /**
+     * @brief Signal emitted when the output switches between SDR and HDR encoding.
+     * @param active true if the output is HDR (see hdrOutput()).
+     */
+    void hdrOutputChanged(bool active);
+
 protected:
     // =========================================================================
     // QQuickRhiItem Interface
@@ -195,6 +492,11 @@ protected:
      */
     QQuickRhiItemRenderer *createRenderer() override;
 
+    /**
+     * @brief Follows the window across screens, to switch the display transform cube.
+     */
+    void itemChange(ItemChange change, const ItemChangeData& value) override;
+
     // =========================================================================
     // BaseImageItem Virtual Handlers
     // =========================================================================
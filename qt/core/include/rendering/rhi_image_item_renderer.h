@@ -27,20 +27,38 @@
 
 #include <QQuickRhiItemRenderer>
 #include <rhi/qrhi.h>
+#include <QByteArray>
 #include <QMutex>
 #include <QPointF>
+#include <QRect>
 #include <QSize>
+#include <QRectF>
+#include <QMatrix4x4>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+
+#include "display/tile_pyramid.h"
+#include "display/display_lut.h"
+#include "display/display_overlays.h"
+#include "common/memory/memory_budget.h"
+#include "common/types/image_orientation.h"
+#include "rendering/frame_handoff.h"
+
+class QScreen;
 
 namespace CaptureMoment::Core::Common {
 struct ImageRegion;
+struct DisplayImage;
 }
 
 namespace CaptureMoment::UI::Rendering {
 
-// Forward declaration
+// Forward declarations
 class RHIImageItem;
+enum class HdrOutput : std::uint8_t;
 
 /**
  * @class RHIImageItemRenderer
@@ -64,24 +82,42 @@ class RHIImageItem;
  *      │
  *      │ setImage(unique_ptr<ImageRegion>)
  *      ▼
- * m_full_image (protected by mutex)
+ * FrameHandoff (triple-buffered mailbox + tile queue, no lock held while converting)
  *      │
- *      │ synchronize() - locks mutex, copies data
+ *      │ render() - takes the latest frame, stages its pixels
  *      ▼
- * m_pixel_data (RGBA8, render thread local)
+ * m_pixel_data (RGBA16F/RGBA32F linear; render thread local), or the display frame's
+ * own RGBA8 bytes (m_display_source, no copy)
  *      │
  *      │ render() - uploads to GPU
  *      ▼
  * m_texture (GPU memory)
  *      │
+ *      │ image_display.frag - exposure, P3 matrix or display LUT, sRGB OETF, dithering
+ *      │                      (HDR swapchain: highlight roll-off, scRGB / PQ / extended P3)
  *      ▼
  * Screen
  * @endcode
  *
  * @par Format Conversion
- * Input format: RGBA_F32 (4 channels, 32-bit float per channel)
- * GPU format:   RGBA8_UNORM (4 channels, 8-bit unsigned normalized)
- * Conversion happens in updateTextureFromImage() during synchronize().
+ * Input format: RGBA_F32 (4 channels, 32-bit float per channel, linear Rec.709)
+ * GPU format:   RGBA16F, or RGBA32F where half floats are not supported
+ * No color conversion on the CPU: the display transform runs in the fragment shader,
+ * so values above 1.0 and wide-gamut output survive until the final encode.
+ * Display-ready images (DisplayImage, already sRGB RGBA8) are uploaded as RGBA8 and
+ * passed through by the shader. On Metal, display images left on the GPU by the engine
+ * are not uploaded at all: the texture aliases the engine's buffer (see MetalInterop).
+ * When the item has a display transform for its screen (ICC profile or OCIO display/view),
+ * its cube is sampled after the sRGB encode instead of the built-in P3/sRGB output.
+ * The unedited image of the file is kept in a second texture: before/after comparison is a
+ * split position in the uniforms, with no engine work.
+ *
+ * @par HDR Output
+ * On an HDR swapchain (`QSG_RHI_HDR`, with the item's color buffer in half floats), the
+ * shader writes the linear data unclamped: scRGB, HDR10 (Rec.2020 primaries, PQ) or
+ * extended linear Display P3, with SDR white at the level the system reports. Highlights
+ * roll off softly into the peak luminance of the screen instead of clipping. The display
+ * transform cube and the dithering only apply to SDR output.
  *
  * @note All methods except the constructor are called on the render thread
  * @warning Do not call GUI thread methods from render thread
@@ -171,9 +207,12 @@ public:
      *
      * Operations performed:
      * 1. Locks the image mutex from RHIImageItem
-     * 2. Reads current zoom, pan, and image dimensions
-     * 3. If image changed, converts RGBA_F32 to RGBA8
-     * 4. Sets m_texture_needs_update flag if needed
+     * 2. Reads current zoom, pan, and the item's frame handoff
+     * 3. Reads the exposure preview and output color space
+     * 4. Stages the queued pyramid tiles and the original image
+     *
+     * Images are not touched here: render() takes them from the frame handoff, so the GUI
+     * thread is never blocked by a conversion.
      *
      * @par Thread Safety
      * This method is called on the render thread but safely accesses
@@ -185,7 +224,6 @@ public:
      *
      * @pre item != nullptr
      * @post Render thread has current copy of display state
-     * @post m_pixel_data contains current image data if changed
      *
      * @note Called on the render thread, but can safely access GUI thread data
      * @note Called every frame, so must be efficient
@@ -198,7 +236,7 @@ public:
      * @details
      * Called by Qt to render the item to the screen. This method:
      *
-     * 1. Checks if texture needs upload, uploads if necessary
+     * 1. Takes the latest frame (takeFrame()), uploads the texture if needed
      * 2. Updates the uniform buffer with current zoom/pan
      * 3. Sets up the graphics pipeline
      * 4. Binds vertex/index buffers and shader resources
@@ -223,6 +261,47 @@ public:
     void render(QRhiCommandBuffer* cb) override;
 
 private:
+    // =========================================================================
+    // Pyramid Tile Cache
+    // =========================================================================
+
+    /**
+     * @brief A cached full-detail tile of the deep-zoom pyramid, with its own GPU resources.
+     *
+     * @details
+     * Drawn with the shared quad and pipeline over the display image; its uniform buffer
+     * places the quad on display_rect.
+     */
+    struct PyramidTile {
+        int level{0};                                      ///< Pyramid level of the tile
+        QRectF display_rect;                               ///< Position in display image coordinates
+        QSize size;                                        ///< Texture size in pixels
+        QByteArray texels;                                 ///< Staged texels, released after upload
+        bool needs_upload{false};                          ///< texels not yet in texture
+        uint64_t last_used{0};                             ///< Frame of the last draw (LRU)
+        std::unique_ptr<QRhiTexture> texture;              ///< Float texture, no mips
+        std::unique_ptr<QRhiBuffer> uniforms;              ///< Per-tile transform + display parameters
+        std::unique_ptr<QRhiShaderResourceBindings> srb;   ///< Layout-compatible with m_srb
+    };
+
+    /**
+     * @brief Maximum number of cached tiles (the DisplayManager requests no more than this).
+     */
+    static constexpr std::size_t k_max_pyramid_tiles { Display::TilePyramid::k_max_resident_tiles };
+
+    // =========================================================================
+    // Device Textures (zero-copy display)
+    // =========================================================================
+
+    /**
+     * @brief A replaced device texture, kept until the frames that sampled it have completed.
+     */
+    struct RetiredDeviceTexture {
+        quint64 native{0};                       ///< Retained native texture (see MetalInterop)
+        std::shared_ptr<const void> keep_alive;  ///< Engine buffer backing the texture
+        uint64_t frame{0};                       ///< Frame at which it was replaced
+    };
+
     // =========================================================================
     // Private Helper Methods
     // =========================================================================
@@ -286,34 +365,162 @@ private:
     void createPipeline();
 
     /**
-     * @brief Converts ImageRegion data to GPU-ready format.
+     * @brief Stages linear ImageRegion data for a float texture upload.
      *
      * @details
-     * Converts the float32 RGBA image data to uint8 RGBA8 format
-     * suitable for GPU texture upload. The conversion includes:
-     *
-     * - Value clamping: 0.0f to 1.0f range
-     * - Scaling: Multiply by 255.0f
-     * - Type conversion: float to uint8_t
+     * No clamping and no color conversion: the values reach the fragment shader as is.
      *
      * @par Input Format
      * - Source: RGBA_F32 (4 x float32 per pixel)
-     * - Size: width * height * 4 * sizeof(float)
      *
      * @par Output Format
-     * - Destination: RGBA8 (4 x uint8 per pixel)
-     * - Size: width * height * 4 bytes
+     * - RGBA16F: bulk float-to-half conversion (qFloatToFloat16, F16C where available)
+     * - RGBA32F: plain copy
      *
-     * @param image The source ImageRegion to convert. Must have 4 channels.
+     * @param image The source ImageRegion. Must have 4 channels.
      *
      * @pre image.isValid() == true
      * @pre image.channels() == 4
-     * @post m_pixel_data contains converted RGBA8 data
+     * @post m_pixel_data contains the staged texels
      * @post m_pixel_data_size matches image dimensions
-     * @post m_texture is recreated if dimensions changed
+     * @post m_texture is recreated if dimensions or format changed
      */
     void updateTextureFromImage(const Core::Common::ImageRegion& image);
 
+    /**
+     * @brief Takes the latest frame from the item's handoff and stages it for upload.
+     *
+     * @details
+     * Called at the start of render(), while the GUI thread runs: the whole-image
+     * conversion (or the display image copy) happens with no lock held. A new frame, or a
+     * texture of the wrong size, stages the whole image; merged tiles stage only their
+     * sub-rectangles, O(tile) instead of O(image).
+     */
+    void takeFrame();
+
+    /**
+     * @brief Packs a sub-rectangle of a linear ImageRegion into texels of the given format.
+     *
+     * @details
+     * Used for the full image (one contiguous run) and for each tile delivered through
+     * RHIImageItem::updateTile(), so a tile costs O(tile) to stage and upload.
+     *
+     * @param image The source ImageRegion (RGBA_F32, the full image).
+     * @param rect The region to pack, in image pixels. Must lie within the image.
+     * @param format RGBA16F or RGBA32F.
+     * @param texels Receives the tightly packed texels (resized as needed).
+     */
+    static void stageRegion(const Core::Common::ImageRegion& image, const QRect& rect,
+                            QRhiTexture::Format format, QByteArray& texels);
+
+    /**
+     * @brief Stages a pyramid tile into the tile cache, evicting the least recently drawn.
+     *
+     * @param key The tile.
+     * @param display_rect Where the tile lies, in display image coordinates.
+     * @param tile Linear RGBA_F32 pixels of the tile.
+     */
+    void stagePyramidTile(const Display::TileKey& key, const QRectF& display_rect,
+                          const Core::Common::ImageRegion& tile);
+
+    /**
+     * @brief Creates, uploads and positions the cached tiles of the current level that reach the screen.
+     *
+     * @param cb Command buffer receiving the uploads and uniform updates.
+     * @param display_to_clip Transform from display image coordinates to clip space.
+     * @return The tiles to draw this frame, over the display image.
+     */
+    [[nodiscard]] std::vector<PyramidTile*> preparePyramidTiles(QRhiCommandBuffer* cb,
+                                                                const QMatrix4x4& display_to_clip);
+
+    /**
+     * @brief Creates the binding set of a pyramid tile (its uniforms and texture, the shared cube).
+     * @return false if the binding set cannot be created.
+     */
+    [[nodiscard]] bool bindPyramidTile(PyramidTile& tile);
+
+    /**
+     * @brief Uploads m_display_lut into m_lut_texture, one depth slice per entry.
+     *
+     * @details
+     * Recreates the 3D texture when the grid size changes, then the binding sets referencing it
+     * (see invalidateBindings()).
+     *
+     * @param cb Command buffer receiving the upload.
+     */
+    void uploadDisplayLut(QRhiCommandBuffer* cb);
+
+    /**
+     * @brief Uploads m_original_pixel_data into m_original_texture, then frees the staging copy.
+     * @param cb Command buffer receiving the upload (and the mip generation).
+     */
+    void uploadOriginalTexture(QRhiCommandBuffer* cb);
+
+    /**
+     * @brief Rebuilds the binding sets after a shared texture was recreated.
+     *
+     * m_srb is recreated immediately, the tiles' on their next draw.
+     */
+    void invalidateBindings();
+
+    /**
+     * @brief Follows the encoding of the window's swapchain and the HDR levels of its screen.
+     *
+     * @details
+     * Queries the swapchain's HDR information only when its format or the window's screen
+     * changes, then reports the encoding to the item. Called from synchronize().
+     */
+    void updateHdrOutput(RHIImageItem& item);
+
+    /**
+     * @brief Float texture format used for linear images.
+     * @return RGBA16F if the backend supports it, RGBA32F otherwise.
+     */
+    [[nodiscard]] QRhiTexture::Format floatTextureFormat() const;
+
+    /**
+     * @brief Creates the texture (and its shader resource bindings) for m_pixel_data_size.
+     *
+     * @details
+     * No-op if the current texture already has this size and format. Shared by the float
+     * path and the display-ready path, which uploads the DisplayImage bytes in place (m_display_source).
+     *
+     * @param format RGBA8 for display-ready bytes, floatTextureFormat() for linear data.
+     *
+     * @post m_texture matches m_pixel_data_size and format
+     */
+    void ensureTexture(QRhiTexture::Format format);
+
+    /**
+     * @brief Recreates m_srb around the current m_texture.
+     */
+    void bindTexture();
+
+    /**
+     * @brief Samples a device-resident display image in place (no upload).
+     *
+     * @details
+     * Wraps a native texture aliasing the engine's buffer with QRhiTexture::createFrom. The
+     * texture has no mip chain (linear textures cannot have one).
+     *
+     * @param image A display image with `isOnDevice()`.
+     * @return false if the buffer cannot be aliased on this RHI (the previous texture is kept).
+     *
+     * @post On success, m_texture wraps the image and m_device_texture owns the native texture
+     */
+    [[nodiscard]] bool adoptDeviceImage(const Core::Common::DisplayImage& image);
+
+    /**
+     * @brief Moves the current device texture (if any) to the retired list.
+     */
+    void retireDeviceTexture();
+
+    /**
+     * @brief Releases the retired device textures no frame in flight can still sample.
+     * @param all true to release them all (destruction).
+     */
+    void releaseRetiredDeviceTextures(bool all = false);
+
     // =========================================================================
     // Member Variables
     // =========================================================================
@@ -331,6 +538,13 @@ private:
      */
     RHIImageItem* m_item{nullptr};
 
+    /**
+     * @brief The item's frame handoff, taken in the first synchronize().
+     *
+     * Shared with the item: render() reads frames from it even if the item is gone.
+     */
+    std::shared_ptr<FrameHandoff> m_frames;
+
     // -------------------------------------------------------------------------
     // RHI Resources (GPU)
     // -------------------------------------------------------------------------
@@ -339,11 +553,12 @@ private:
      * @brief GPU texture storing the image data.
      *
      * @details
-     * Format: QRhiTexture::RGBA8 (4 channels, 8 bits per channel)
+     * Format: RGBA16F/RGBA32F for linear images, RGBA8 for display-ready images
      * Size: Matches current image dimensions
      * Usage: Sampled in fragment shader for display
      *
-     * @note Recreated when image dimensions change
+     * @note Recreated when image dimensions or format change
+     * @note Mipmapped when m_mipmapped: the chain is regenerated on the GPU after each upload
      */
     std::unique_ptr<QRhiTexture> m_texture;
 
@@ -354,7 +569,7 @@ private:
      * Configuration:
      * - Minification: Linear
      * - Magnification: Linear
-     * - Mipmap: None
+     * - Mipmap: Linear (trilinear) when m_mipmapped, None otherwise
      * - Address U/V: Clamp to Edge
      */
     std::unique_ptr<QRhiSampler> m_sampler;
@@ -384,8 +599,11 @@ private:
      * @brief Uniform buffer for shader parameters.
      *
      * @details
-     * Contains transformation matrix:
+     * Contains transformation matrix and display transform parameters:
      * - MVP matrix (mat4): 64 bytes
+     * - Exposure gain, source encoded, output P3 and dither flags: 16 bytes
+     * - Display LUT flag, LUT scale and offset, before/after split: 16 bytes
+     * - Before/after discard flag (pyramid tiles), HDR encoding, SDR white scale, peak: 16 bytes
      *
      * Total: 256 bytes (aligned for GPU requirements)
      */
@@ -398,6 +616,8 @@ private:
      * Binding layout:
      * - Binding 0: Uniform buffer (vertex + fragment stages)
      * - Binding 1: Texture + sampler (fragment stage only)
+     * - Binding 2: Display transform cube + sampler (fragment stage only)
+     * - Binding 3: Unedited image + sampler (fragment stage only)
      */
     std::unique_ptr<QRhiShaderResourceBindings> m_srb;
 
@@ -415,6 +635,23 @@ private:
      */
     std::unique_ptr<QRhiGraphicsPipeline> m_pipeline;
 
+    /**
+     * @brief 3D texture holding the display transform cube (2x2x2 placeholder until one is set).
+     */
+    std::unique_ptr<QRhiTexture> m_lut_texture;
+
+    /**
+     * @brief Trilinear sampler of the cube, clamped on all three axes.
+     */
+    std::unique_ptr<QRhiSampler> m_lut_sampler;
+
+    /**
+     * @brief Unedited display image for before/after comparison (1x1 placeholder until one is set).
+     *
+     * @details Float format, mipmapped like m_texture; sampled with m_sampler.
+     */
+    std::unique_ptr<QRhiTexture> m_original_texture;
+
     // -------------------------------------------------------------------------
     // Render State (Thread-Local Copy)
     // -------------------------------------------------------------------------
@@ -465,25 +702,161 @@ private:
      */
     QPointF m_pan{0, 0};
 
+    /**
+     * @brief Exposure preview in EV, applied in the fragment shader.
+     *
+     * @details
+     * Copied from RHIImageItem during synchronize(). Ignored for display-ready images.
+     */
+    float m_exposure_preview{0.0f};
+
+    /**
+     * @brief Whether the output is encoded for a Display P3 screen instead of sRGB.
+     */
+    bool m_display_p3{false};
+
+    /**
+     * @brief SDR white, in nits, when the system does not report it (ITU-R BT.2408 reference white).
+     */
+    static constexpr float k_reference_white_nits { 203.0f };
+
+    /**
+     * @brief Luminance of 1.0 in scRGB, in nits.
+     */
+    static constexpr float k_scrgb_unit_nits { 80.0f };
+
+    /**
+     * @brief Encoding of the output (`HdrOutput::Sdr` unless the swapchain is HDR).
+     */
+    HdrOutput m_hdr_output{};
+
+    /**
+     * @brief Factor from linear values (1.0 = SDR white) to the output encoding's unit.
+     *
+     * @details SDR white / 80 nits for scRGB, SDR white / 10000 nits for PQ, 1 otherwise.
+     */
+    float m_sdr_white_scale{1.0f};
+
+    /**
+     * @brief Peak luminance of the screen, relative to SDR white (at least 1).
+     */
+    float m_hdr_peak{1.0f};
+
+    /**
+     * @brief Swapchain format the output encoding was last resolved for.
+     */
+    QRhiSwapChain::Format m_swapchain_format{QRhiSwapChain::SDR};
+
+    /**
+     * @brief Screen the HDR levels were last queried on (compared only, never dereferenced).
+     */
+    const QScreen* m_hdr_screen{nullptr};
+
+    /**
+     * @brief Whether the texture holds display-encoded sRGB bytes (DisplayImage).
+     *
+     * @details
+     * The shader then passes the texels through instead of encoding them.
+     */
+    bool m_source_encoded{false};
+
+    /**
+     * @brief Display transform cube of the item's screen, nullptr for the built-in encode.
+     *
+     * @details Copied from RHIImageItem during synchronize() when it changed.
+     */
+    std::shared_ptr<const Display::DisplayLut> m_display_lut;
+
+    /**
+     * @brief m_display_lut is not yet in m_lut_texture.
+     */
+    bool m_lut_needs_upload{false};
+
+    /**
+     * @brief Before/after split, as a fraction of the image width shown unedited (0 for none).
+     *
+     * @details Copied from RHIImageItem during synchronize().
+     */
+    float m_compare_split{0.0f};
+
+    /**
+     * @brief Clipping and focus peaking overlays, copied from RHIImageItem during synchronize().
+     */
+    Display::DisplayOverlays m_overlays;
+
+    /**
+     * @brief EXIF orientation of the image, copied from RHIImageItem during synchronize().
+     */
+    Core::Common::ImageOrientation m_orientation{Core::Common::ImageOrientation::Normal};
+
+    /**
+     * @brief Texels of the unedited image staged in synchronize(), freed once uploaded.
+     */
+    QByteArray m_original_pixel_data;
+
+    /**
+     * @brief Size of the staged unedited image.
+     */
+    QSize m_original_size;
+
+    /**
+     * @brief m_original_pixel_data is not yet in m_original_texture.
+     */
+    bool m_original_needs_upload{false};
+
+    /**
+     * @brief Whether m_original_texture holds an unedited image (the split is ignored otherwise).
+     */
+    bool m_has_original{false};
+
     // -------------------------------------------------------------------------
     // Pixel Data (CPU Staging)
     // -------------------------------------------------------------------------
 
     /**
-     * @brief Converted pixel data in RGBA8 format ready for GPU upload.
+     * @brief Texels staged for GPU upload, in the format of m_texture.
      *
      * @details
-     * This buffer holds the image data after conversion from float32 to uint8.
-     * It is populated in updateTextureFromImage() during synchronize() and
-     * uploaded to m_texture during render().
+     * Half or single floats for linear images, RGBA8 bytes for display-ready images.
+     * It is populated during synchronize() and uploaded to m_texture during render().
      *
      * @par Memory Layout
      * Row-major order: [R0, G0, B0, A0, R1, G1, B1, A1, ...]
-     * Size: width * height * 4 bytes
+     * Size: width * height * 4 * bytes per channel
+     *
+     * Implicitly shared with the upload: QRhi keeps a reference instead of a deep copy.
+     * Empty while the texture is uploaded from m_display_source.
      *
      * @note Kept between frames to avoid reallocation when image doesn't change
      */
-    std::vector<uint8_t> m_pixel_data;
+    QByteArray m_pixel_data;
+
+    /**
+     * @brief Display-ready frame the texture is uploaded from, in place.
+     *
+     * @details
+     * The bytes the engine encoded, shared with the frame handoff and the edit history:
+     * wrapped (QByteArray::fromRawData) rather than copied, and kept alive here until the
+     * next frame replaces them, after the upload has consumed them.
+     */
+    std::shared_ptr<const Core::Common::DisplayImage> m_display_source;
+
+    /**
+     * @brief A tile staged for a partial texture upload.
+     */
+    struct PendingRegion {
+        QRect rect;                    ///< Destination in the texture
+        QByteArray texels;             ///< Tightly packed texels, in the format of m_texture
+    };
+
+    /**
+     * @brief Tiles staged in synchronize() and uploaded in render().
+     *
+     * @details
+     * Each is uploaded with setDestinationTopLeft()/setSourceSize(), after the full
+     * upload when both are pending. Cleared when a full upload supersedes them.
+     */
+    std::vector<PendingRegion> m_pending_regions;
 
     /**
      * @brief Dimensions of the current pixel data.
@@ -509,6 +882,52 @@ private:
      */
     bool m_texture_needs_update{false};
 
+    /**
+     * @brief GPU tile cache of the deep-zoom pyramid, all levels, LRU-evicted.
+     */
+    std::unordered_map<Display::TileKey, PyramidTile, Display::TileKeyHash> m_pyramid_tiles;
+
+    /**
+     * @brief Pyramid level drawn over the display image, -1 for none.
+     */
+    int m_pyramid_level{-1};
+
+    /**
+     * @brief Frame counter driving the tile cache LRU.
+     */
+    uint64_t m_frame{0};
+
+    /**
+     * @brief Native texture wrapped by m_texture when it aliases an engine buffer, 0 otherwise.
+     */
+    quint64 m_device_texture{0};
+
+    /**
+     * @brief Engine buffer backing m_device_texture.
+     */
+    std::shared_ptr<const void> m_device_keep_alive;
+
+    /**
+     * @brief Device textures replaced while frames in flight may still sample them.
+     */
+    std::vector<RetiredDeviceTexture> m_retired_device_textures;
+
+    /**
+     * @brief Whether device-resident display images are sampled in place (Metal backend).
+     *
+     * @details Set in createPipeline(), cleared if an image cannot be aliased; reported to the item.
+     */
+    bool m_device_images{false};
+
+    /**
+     * @brief Whether the backend generates mip chains (QRhi::MipMapGeneration).
+     *
+     * @details
+     * Set in createPipeline(). When true, textures are created MipMapped and
+     * UsedWithGenerateMips, and zooming below fit samples trilinearly instead of shimmering.
+     */
+    bool m_mipmapped{false};
+
     /**
      * @brief Flag indicating RHI resources are initialized.
      *
@@ -517,6 +936,21 @@ private:
      * Used to prevent rendering before resources are ready.
      */
     bool m_initialized{false};
+
+    /**
+     * @brief Capacity of m_pixel_data, mirrored for the memory budget's usage callback (any thread).
+     */
+    std::atomic<std::size_t> m_pixel_data_bytes{0};
+
+    /**
+     * @brief Set by the memory budget: m_pixel_data is freed in render() once uploaded.
+     */
+    std::atomic<bool> m_release_pixel_data{false};
+
+    /**
+     * @brief Registration of m_pixel_data with the memory budget (reads the two atomics above).
+     */
+    Core::Common::MemoryBudget::Registration m_budget_registration;
 };
 
 } // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,217 @@
+/**
+ * @file rhi_survey_item.h
+ * @brief Survey view: several images side by side, drawn by one RHI pipeline in one draw call.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QQuickRhiItem>
+#include <QMutex>
+#include <QRectF>
+#include <QSize>
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace CaptureMoment::Core::Common {
+struct ImageRegion;
+}
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @class RHISurveyItem
+ * @brief Shows 1 to `k_max_images` images in a grid, for comparing and culling.
+ *
+ * @details
+ * Each cell shows one image, fitted to the cell with its aspect ratio kept. The images are
+ * proxy-resolution renders (see `Controller::SurveyController`): `cellLongEdge()` is the long
+ * edge, in device pixels, a render needs to fill a cell.
+ *
+ * The renderer (`RHISurveyItemRenderer`) keeps every image in one atlas texture and draws all
+ * cells with one pipeline, one sampler and one instanced draw call, so adding cells adds no GPU
+ * state. Only the cells whose image changed are uploaded.
+ *
+ * @par Threading Model
+ * Same as `RHIImageItem`: the images are handed over on the GUI thread and taken by the
+ * renderer in synchronize(), under `m_mutex`.
+ */
+class RHISurveyItem : public QQuickRhiItem {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Maximum number of images shown at once (slots of the renderer's atlas).
+     */
+    static constexpr int k_max_images { 8 };
+
+    /**
+     * @brief Gap between the cells, in logical pixels.
+     */
+    static constexpr qreal k_spacing { 8.0 };
+
+    /**
+     * @brief Largest long edge of a cell image, in pixels (bounds the atlas to 4096 x 2048).
+     */
+    static constexpr int k_max_cell_edge { 1024 };
+
+    /**
+     * @brief Step the cell long edge is rounded up to, so that resizing the window does not
+     *        re-render the images at each pixel.
+     */
+    static constexpr int k_cell_edge_step { 128 };
+
+    /**
+     * @brief Constructs an empty survey.
+     * @param parent The parent QQuickItem, if any.
+     */
+    explicit RHISurveyItem(QQuickItem* parent = nullptr);
+
+    ~RHISurveyItem() override;
+
+    /**
+     * @brief Number of cells shown, in [0, k_max_images].
+     */
+    [[nodiscard]] int count() const;
+
+    /**
+     * @brief Sets the number of cells; cells beyond it drop their image.
+     */
+    void setCount(int count);
+
+    /**
+     * @brief Cell drawn with a selection frame, -1 for none.
+     */
+    [[nodiscard]] int selectedIndex() const;
+
+    /**
+     * @brief Selects a cell (-1 for none).
+     */
+    void setSelectedIndex(int index);
+
+    /**
+     * @brief Whether output is encoded for a Display P3 screen.
+     */
+    [[nodiscard]] bool displayP3() const;
+
+    /**
+     * @brief Selects Display P3 output instead of sRGB for wide-gamut screens.
+     */
+    void setDisplayP3(bool enabled);
+
+    /**
+     * @brief Long edge, in device pixels, an image needs to fill a cell at the current size.
+     */
+    [[nodiscard]] int cellLongEdge() const noexcept { return m_cell_long_edge; }
+
+    /**
+     * @brief Sets the image of a cell (linear RGBA_F32, long edge at most `k_max_cell_edge`).
+     *
+     * @param index Cell index, in [0, count()).
+     * @param image The image. Ownership is transferred.
+     * @note Thread-safe: uses m_mutex
+     */
+    void setCellImage(int index, std::unique_ptr<Core::Common::ImageRegion> image);
+
+    /**
+     * @brief Empties every cell (a new set of images is loading).
+     * @note Thread-safe: uses m_mutex
+     */
+    void clearImages();
+
+    /**
+     * @brief Index of the cell under a point of the item, -1 for none (e.g. a click between cells).
+     */
+    Q_INVOKABLE int cellAt(const QPointF& point) const;
+
+    /**
+     * @brief Rectangle of cell `index` in an area showing `count` cells.
+     *
+     * @details The grid is as square as possible: ceil(sqrt(count)) columns, rows as needed.
+     */
+    [[nodiscard]] static QRectF cellRect(int index, int count, const QSizeF& area);
+
+signals:
+    /**
+     * @brief Emitted when the number of cells changes.
+     */
+    void countChanged(int count);
+
+    /**
+     * @brief Emitted when the selected cell changes.
+     */
+    void selectedIndexChanged(int index);
+
+    /**
+     * @brief Emitted when the output color space changes.
+     */
+    void displayP3Changed(bool enabled);
+
+    /**
+     * @brief Emitted when the cells grow or shrink past a step: the images should be rendered again.
+     */
+    void cellLongEdgeChanged(int edge);
+
+protected:
+    /**
+     * @brief Creates the RHISurveyItemRenderer.
+     */
+    QQuickRhiItemRenderer* createRenderer() override;
+
+    /**
+     * @brief Recomputes the cell long edge when the item is resized.
+     */
+    void geometryChange(const QRectF& new_geometry, const QRectF& old_geometry) override;
+
+private:
+    /**
+     * @brief Recomputes `m_cell_long_edge` from the size, the cell count and the device pixel ratio.
+     */
+    void updateCellLongEdge();
+
+    /**
+     * @brief Protects the state read by the renderer.
+     */
+    mutable QMutex m_mutex;
+
+    /**
+     * @brief Number of cells shown (protected by m_mutex).
+     */
+    int m_count{0};
+
+    /**
+     * @brief Selected cell, -1 for none (protected by m_mutex).
+     */
+    int m_selected_index{-1};
+
+    /**
+     * @brief Whether output is encoded for a Display P3 screen (protected by m_mutex).
+     */
+    bool m_display_p3{false};
+
+    /**
+     * @brief Images handed over and not yet taken by the renderer (protected by m_mutex).
+     */
+    std::array<std::unique_ptr<Core::Common::ImageRegion>, k_max_images> m_pending_images;
+
+    /**
+     * @brief Size of the image of each cell, empty for none (protected by m_mutex).
+     */
+    std::array<QSize, k_max_images> m_image_sizes;
+
+    /**
+     * @brief Set by clearImages(): the renderer drops the images it holds (protected by m_mutex).
+     */
+    bool m_images_cleared{false};
+
+    /**
+     * @brief Long edge an image needs to fill a cell (GUI thread).
+     */
+    int m_cell_long_edge{0};
+
+    friend class RHISurveyItemRenderer;
+};
+
+} // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,181 @@
+/**
+ * @file rhi_survey_item_renderer.h
+ * @brief RHI renderer of the survey view: every cell from one atlas, in one instanced draw call.
+ * @author CaptureMoment Team
+ * @date 2026
+ *
+ * @details
+ * The cell images live in the slots of one atlas texture (`k_atlas_columns` x `k_atlas_rows`
+ * slots of `m_slot_edge` pixels, RGBA16F where supported). The vertex shader places instance i
+ * of the unit quad on cell i and maps it to slot i; the fragment shader encodes for the screen
+ * (sRGB or Display P3, dithered) and frames the selected cell. One pipeline, one sampler, one
+ * binding set and one draw call, whatever the number of cells.
+ *
+ * @see RHISurveyItem for the QQuickItem frontend
+ * @see RHIImageItemRenderer for the single-image renderer it follows
+ */
+
+#pragma once
+
+#include <QQuickRhiItemRenderer>
+#include <rhi/qrhi.h>
+#include <QSize>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rendering/rhi_survey_item.h"
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @class RHISurveyItemRenderer
+ * @brief GPU renderer for RHISurveyItem.
+ *
+ * @note All methods except the constructor are called on the render thread
+ */
+class RHISurveyItemRenderer : public QQuickRhiItemRenderer {
+public:
+    /**
+     * @brief Slots per atlas row.
+     */
+    static constexpr int k_atlas_columns { 4 };
+
+    /**
+     * @brief Slot rows of the atlas (k_atlas_columns * k_atlas_rows = RHISurveyItem::k_max_images).
+     */
+    static constexpr int k_atlas_rows { 2 };
+
+    static_assert(k_atlas_columns * k_atlas_rows == RHISurveyItem::k_max_images,
+                  "The atlas must hold one slot per survey cell");
+
+    /**
+     * @brief Constructs the renderer of `item`; resources are created in initialize().
+     */
+    explicit RHISurveyItemRenderer(RHISurveyItem* item);
+
+    ~RHISurveyItemRenderer() override;
+
+    RHISurveyItemRenderer(const RHISurveyItemRenderer&) = delete;
+    RHISurveyItemRenderer& operator=(const RHISurveyItemRenderer&) = delete;
+
+    /**
+     * @brief Creates the quad, the uniform buffer, the sampler, a placeholder atlas and the pipeline.
+     */
+    void initialize(QRhiCommandBuffer* cb) override;
+
+    /**
+     * @brief Takes the cell count, the selection and the new cell images from the item.
+     */
+    void synchronize(QQuickRhiItem* item) override;
+
+    /**
+     * @brief Uploads the changed slots, then draws every cell in one instanced draw call.
+     */
+    void render(QRhiCommandBuffer* cb) override;
+
+private:
+    /**
+     * @brief A cell image staged for upload into its slot.
+     */
+    struct PendingCell {
+        int index{0};                  ///< Cell (and atlas slot) index
+        QSize size;                    ///< Image size in pixels
+        std::vector<uint8_t> texels;   ///< Texels in the atlas format
+    };
+
+    /**
+     * @brief Creates the unit quad and the uniform buffer.
+     */
+    void createGeometry(QRhiCommandBuffer* cb);
+
+    /**
+     * @brief Creates the sampler, the placeholder atlas, the binding set and the pipeline.
+     */
+    void createPipeline();
+
+    /**
+     * @brief Recreates the atlas when the slots must grow to `slot_edge`, and rebinds it.
+     * @return false if the texture cannot be created.
+     */
+    bool ensureAtlas(int slot_edge);
+
+    /**
+     * @brief (Re)creates the binding set around the current atlas.
+     */
+    void bindAtlas();
+
+    /**
+     * @brief Format of the atlas: RGBA16F, or RGBA32F where half floats are not supported.
+     */
+    [[nodiscard]] QRhiTexture::Format atlasFormat() const;
+
+    /**
+     * @brief Parent item (GUI thread object, read in synchronize() only).
+     */
+    RHISurveyItem* m_item;
+
+    std::unique_ptr<QRhiBuffer> m_vertex_buffer;
+    std::unique_ptr<QRhiBuffer> m_index_buffer;
+
+    /**
+     * @brief Uniforms of both stages: projection, cell and slot rectangles, output options.
+     */
+    std::unique_ptr<QRhiBuffer> m_uniform_buffer;
+
+    /**
+     * @brief The one sampler of every cell (linear, clamped; slots are inset by half a texel).
+     */
+    std::unique_ptr<QRhiSampler> m_sampler;
+
+    /**
+     * @brief Atlas of the cell images, one slot per cell.
+     */
+    std::unique_ptr<QRhiTexture> m_atlas;
+
+    std::unique_ptr<QRhiShaderResourceBindings> m_srb;
+    std::unique_ptr<QRhiGraphicsPipeline> m_pipeline;
+
+    /**
+     * @brief Edge of an atlas slot in pixels (0 for the placeholder atlas).
+     */
+    int m_slot_edge{0};
+
+    /**
+     * @brief Cells to draw.
+     */
+    int m_count{0};
+
+    /**
+     * @brief Selected cell, -1 for none.
+     */
+    int m_selected_index{-1};
+
+    /**
+     * @brief Whether output is encoded for a Display P3 screen.
+     */
+    bool m_display_p3{false};
+
+    /**
+     * @brief Size of the image held by each slot, empty for none.
+     */
+    std::array<QSize, RHISurveyItem::k_max_images> m_slot_sizes;
+
+    /**
+     * @brief Cell images staged by synchronize(), uploaded by the next render().
+     */
+    std::vector<PendingCell> m_pending_cells;
+
+    /**
+     * @brief Device pixel ratio of the window, for the cell layout.
+     */
+    qreal m_device_pixel_ratio{1.0};
+
+    /**
+     * @brief true once initialize() created every resource.
+     */
+    bool m_initialized{false};
+};
+
+} // namespace CaptureMoment::UI::Rendering
@@ -30,8 +30,8 @@ namespace Rendering {
  * @brief QQuickItem that renders an image via QSGSimpleTextureNode.
  *
  * This class provides an image display component using the simpler QSGSimpleTextureNode
- * instead of the more complex QSGRenderNode. It converts Core::Common::ImageRegion data to a format
- * suitable for QSGTexture (e.g., QImage) and manages zoom and pan operations.
+ * instead of the more complex QSGRenderNode. It encodes Core::Common::ImageRegion data to sRGB RGBA8
+ * into a persistent staging texture (SGSStagingTexture) and manages zoom and pan operations.
  * It's a good choice for basic image display where custom RHI shaders are not needed.
  * Inherits from QQuickItem for Qt Quick integration and BaseImageItem for common state
  * (zoom, pan, image dimensions) and QML properties/signals.
@@ -39,15 +39,6 @@ namespace Rendering {
 class SGSImageItem : public QQuickItem, public BaseImageItem {
     Q_OBJECT
 
-private:
-    /**
-     * @brief Flag indicating if the internal image data has changed and needs conversion.
-     *
-     * Set to true when setImage or updateTile is called. Checked in updatePaintNode
-     * to determine if a new QImage and QSGTexture need to be created.
-     */
-    bool m_image_dirty{false};
-
 public:
     /**
      * @brief Constructs a new SGSImageItem.
@@ -63,20 +54,24 @@ public:
     /**
      * @brief Sets the full image to be displayed.
      *
-     * This method safely updates the internal image data and marks the internal state
-     * for an update on the next render pass. The conversion to GPU texture happens
-     * in updatePaintNode on the render thread.
+     * This method publishes the image on the frame handoff without taking a lock.
+     * The conversion to GPU texture happens in updatePaintNode on the render thread.
      *
      * @param image The image data.
      */
     void setImage(std::unique_ptr<Core::Common::ImageRegion> image) override;
 
+    /**
+     * @brief Sets a display-ready (sRGB RGBA8) image, uploaded without conversion.
+     * @param image The display image data.
+     */
+    void setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image) override;
+
     /**
      * @brief Updates a specific tile of the displayed image.
      *
-     * This method safely merges the data from the provided tile into the internal
-     * full image buffer (CPU side) and marks the internal state for an update.
-     * The conversion to GPU texture happens in updatePaintNode on the render thread.
+     * This method queues the tile on the frame handoff; updatePaintNode merges it into
+     * the render thread's copy of the image, then re-encodes it.
      *
      * @param tile The image tile containing the updated region.
      */
@@ -107,7 +102,8 @@ protected:
      *
      * This override creates and returns the QSGNode responsible for
      * rendering the image using QSGSimpleTextureNode.
-     * It handles the conversion from ImageRegion to QImage to QSGTexture on the render thread.
+     * On the render thread, the image is encoded to sRGB RGBA8 into the staging buffer of the
+     * node's SGSStagingTexture, which re-uploads it in place (reallocated only on size change).
      *
      * @param node The previous QSGNode, if any.
      * @param data Update data provided by the scene graph.
@@ -0,0 +1,116 @@
+/**
+ * @file sgs_staging_texture.h
+ * @brief Scene graph texture updated in place from a persistent CPU staging buffer.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QSGDynamicTexture>
+#include <QSize>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class QRhi;
+class QRhiTexture;
+class QRhiResourceUpdateBatch;
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @brief RGBA8 QSGTexture whose QRhiTexture is kept across edits and re-uploaded in place.
+ *
+ * @details
+ * `QQuickWindow::createTextureFromImage` allocates a new GPU texture (and mip chain) for each
+ * image. This texture instead owns one staging buffer and one `QRhiTexture`:
+ * - the item writes sRGB RGBA8 pixels into `stage()` during `updatePaintNode` (render thread),
+ * - the scene graph calls `commitTextureOperations` when the material is prepared, which
+ *   uploads the staging buffer into the existing texture and regenerates its mips.
+ *
+ * The GPU texture and the staging buffer are only reallocated when the image size changes.
+ * All members are used on the render thread only.
+ */
+class SGSStagingTexture : public QSGDynamicTexture {
+    Q_OBJECT
+
+private:
+    /**
+     * @brief CPU copy of the next upload, tightly packed RGBA8 rows.
+     */
+    std::vector<std::uint8_t> m_staging;
+
+    /**
+     * @brief Size of the staged image.
+     */
+    QSize m_size;
+
+    /**
+     * @brief GPU texture, recreated only when m_size changes.
+     */
+    QRhiTexture* m_texture{nullptr};
+
+    /**
+     * @brief True when the staging buffer holds pixels not uploaded yet.
+     */
+    bool m_upload_pending{false};
+
+public:
+    /**
+     * @brief Constructs an empty texture; the GPU side is created on the first commit.
+     */
+    SGSStagingTexture() = default;
+
+    /**
+     * @brief Releases the GPU texture.
+     */
+    ~SGSStagingTexture() override;
+
+    /**
+     * @brief Returns the staging buffer sized for an image, reusing its storage.
+     *
+     * The caller fills `size.width() * size.height()` RGBA8 pixels (bytesPerLine() per row),
+     * then calls markStaged().
+     *
+     * @param size The image size in pixels.
+     * @return Pointer to the first staged row.
+     */
+    [[nodiscard]] std::uint8_t* stage(const QSize& size);
+
+    /**
+     * @brief Bytes per staged row (tightly packed).
+     */
+    [[nodiscard]] std::size_t bytesPerLine() const noexcept { return static_cast<std::size_t>(m_size.width()) * 4; }
+
+    /**
+     * @brief Schedules the staged pixels for upload on the next commitTextureOperations().
+     */
+    void markStaged() noexcept { m_upload_pending = true; }
+
+    // QSGTexture overrides
+    [[nodiscard]] qint64 comparisonKey() const override;
+    [[nodiscard]] QRhiTexture* rhiTexture() const override;
+    [[nodiscard]] QSize textureSize() const override { return m_size; }
+    [[nodiscard]] bool hasAlphaChannel() const override { return true; }
+    [[nodiscard]] bool hasMipmaps() const override { return true; }
+
+    /**
+     * @brief Uploads the staged pixels into the existing texture and regenerates its mips.
+     *
+     * Creates (or resizes) the GPU texture first when needed.
+     *
+     * @param rhi The scene graph's RHI.
+     * @param resourceUpdates The batch of the pass sampling this texture.
+     */
+    void commitTextureOperations(QRhi* rhi, QRhiResourceUpdateBatch* resourceUpdates) override;
+
+    // QSGDynamicTexture override
+    /**
+     * @brief Reports whether staged pixels are waiting for the next commit.
+     */
+    bool updateTexture() override { return m_upload_pending; }
+};
+
+} // namespace CaptureMoment::UI::Rendering
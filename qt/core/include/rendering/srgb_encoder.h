@@ -0,0 +1,44 @@
+/**
+ * @file srgb_encoder.h
+ * @brief Table-driven encoding of linear float RGBA rows to sRGB RGBA8.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CaptureMoment::UI::Rendering {
+
+/**
+ * @brief Encodes linear RGBA float pixels to sRGB RGBA8 (alpha stays linear).
+ *
+ * @details
+ * Delegates to `Core::Utils::quantizeRowsU8` (the same tables as the exports): values are
+ * clamped to [0, 1] and quantized to a 16384-entry index, then looked up in a table holding
+ * the 8-bit sRGB code for each step. The result differs from the exact encode only on
+ * rounding boundaries, by one code.
+ *
+ * @param src Linear RGBA samples (4 floats per pixel).
+ * @param dst Destination RGBA8 pixels (4 bytes per pixel).
+ * @param pixel_count Number of pixels to encode.
+ */
+void encodeLinearToSrgb8(const float* src, std::uint8_t* dst, std::size_t pixel_count) noexcept;
+
+/**
+ * @brief Encodes a linear RGBA float image to sRGB RGBA8, row by row (rows in parallel for large images).
+ *
+ * @param src First source row.
+ * @param src_stride Distance between source rows, in floats.
+ * @param dst First destination row.
+ * @param dst_stride Distance between destination rows, in bytes.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ */
+void encodeLinearToSrgb8(const float* src, std::size_t src_stride,
+                         std::uint8_t* dst, std::size_t dst_stride,
+                         std::size_t width, std::size_t height) noexcept;
+
+} // namespace CaptureMoment::UI::Rendering
@@ -8,10 +8,12 @@
 #pragma once
 
 #include "serializer/file_serializer_manager.h"
+#include "serializer/xmp_autosaver.h"
 #include "operations/operation_descriptor.h"
 
 #include <QObject>
 #include <QString>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -36,6 +38,9 @@ namespace Serializer {
  * It emits Qt signals to notify the UI layer about the success or failure of these operations.
  * This class is designed to be exposed to QML and operates within the UI thread.
  * It is fully independent of PhotoEngine and only deals with serialization logic.
+ *
+ * Saves never block the UI thread: they are written by a `Core::Serializer::XmpAutosaver`,
+ * and the result signals are delivered on the UI thread once the write is done.
  */
 class SerializerController : public QObject
 {
@@ -100,7 +105,7 @@ public slots:
     /**
      * @brief Saves the provided list of operations to a file associated with the given image path.
      *
-     * This slot calls the core FileSerializerManager to perform the save operation.
+     * The write runs right away on the autosave thread (the slot returns at once).
      * It emits either operationsSaved() or operationsSaveFailed() upon completion.
      *
      * @param image_path The path to the source image file. Used to determine the target XMP file location.
@@ -119,12 +124,53 @@ public slots:
      */
     void loadOperations(const QString& image_path);
 
+    /**
+     * @brief Saves the operations once the edits have been idle for the debounce delay.
+     *
+     * Call it after every edit: a burst of edits produces one write, skipped if the sidecar
+     * already holds these operations. Emits operationsSaved() or operationsSaveFailed() when written.
+     *
+     * @param image_path The path to the source image file.
+     * @param operations The current operations of the image.
+     */
+    void scheduleAutosave(const QString& image_path, const std::vector<CaptureMoment::Core::Operations::OperationDescriptor>& operations);
+
+    /**
+     * @brief Writes the pending autosave now and waits for it (e.g. before closing the image).
+     */
+    void flushAutosave();
+
+    /**
+     * @brief Handler receiving the operations of each parsed sidecar (must not block).
+     */
+    using OperationsParsedHandler = std::function<void(const std::vector<CaptureMoment::Core::Operations::OperationDescriptor>&)>;
+
+    /**
+     * @brief Sets the handler called by loadOperations() as soon as a sidecar is parsed, before operationsLoaded().
+     *
+     * Lets the application start work that only depends on the operations (e.g. compiling the
+     * image's pipeline with `PhotoEngine::warmUpPipeline`) while the image itself still loads.
+     *
+     * @param handler The handler, or an empty function to remove it.
+     */
+    void setOperationsParsedHandler(OperationsParsedHandler handler);
+
 private:
     /**
      * @brief Unique pointer to the core FileSerializerManager instance.
      * This manager handles the actual serialization logic using Exiv2, path strategies, etc.
      */
     std::unique_ptr<CaptureMoment::Core::Serializer::FileSerializerManager> m_file_serializer_manager;
+
+    /**
+     * @brief Writes the saves in the background. Declared after the manager: destroyed (and flushed) first.
+     */
+    std::unique_ptr<CaptureMoment::Core::Serializer::XmpAutosaver> m_autosaver;
+
+    /**
+     * @brief Called with the operations of each parsed sidecar (see setOperationsParsedHandler()).
+     */
+    OperationsParsedHandler m_operations_parsed_handler;
 };
 
 } // namespace Serializer
@@ -3,18 +3,236 @@
 // --- Fragment Input ---
 layout(location = 0) in vec2 vTexCoord;  // Interpolated texture coordinates from vertex shader
 
+// --- Uniform Buffer Object (shared with the vertex shader) ---
+layout(std140, binding = 0) uniform buf {
+    mat4 mvp;             // Model-View-Projection matrix (vertex stage)
+    float exposureGain;   // 2^EV exposure preview, linear data only
+    int sourceEncoded;    // 1: texture already holds display-encoded sRGB bytes
+    int outputP3;         // 1: encode for a Display P3 screen instead of sRGB
+    int dither;           // 1: add +/- half an 8-bit step of noise after encoding
+    int displayLut;       // 1: map through the display transform cube instead of the built-in encode
+    float lutScale;       // (N - 1) / N for an N^3 cube
+    float lutOffset;      // 0.5 / N: samples land on texel centers
+    float compareSplit;   // before/after: texture x below which the unedited image shows, 0 for none
+    int compareDiscard;   // 1 (pyramid tiles): discard the unedited side, the quad below shows it
+    int hdrOutput;        // 0: SDR, 1: scRGB, 2: HDR10 (PQ), 3: extended linear Display P3
+    float sdrWhiteScale;  // HDR: linear 1.0 (SDR white) in the unit of the encoding
+    float hdrPeak;        // HDR: peak luminance of the screen, relative to SDR white
+    int overlays;         // Bits: 1 clipping warnings, 2 focus peaking
+    float highlightClip;  // Clipping: linear level, relative to the screen's white, of a clipped highlight
+    float shadowClip;     // Clipping: linear level of a clipped shadow
+    float peakingThreshold;  // Focus peaking: Sobel magnitude of the encoded luma marking an edge
+};
+
 // --- Texture Sampler ---
-layout(binding = 1) uniform sampler2D inputTexture;  // RGBA image texture
+layout(binding = 1) uniform sampler2D inputTexture;  // RGBA image texture (linear Rec.709 or sRGB bytes)
+layout(binding = 2) uniform sampler3D displayLutTexture;  // Display transform, indexed by sRGB-encoded Rec.709
+layout(binding = 3) uniform sampler2D originalTexture;    // Unedited display image (linear Rec.709)
 
 // --- Fragment Output ---
 layout(location = 0) out vec4 fragColor;  // Final pixel color
 
+// Linear Rec.709 to linear Display P3 (D65), column-major
+const mat3 REC709_TO_P3 = mat3(
+    0.8224621, 0.0331941, 0.0170827,
+    0.1775380, 0.9668058, 0.0723974,
+    0.0000000, 0.0000000, 0.9105199);
+
+// Linear Rec.709 to linear Rec.2020, column-major
+const mat3 REC709_TO_REC2020 = mat3(
+    0.6274040, 0.0690970, 0.0163916,
+    0.3292820, 0.9195400, 0.0880132,
+    0.0433136, 0.0113612, 0.8955950);
+
+// sRGB opto-electronic transfer function (IEC 61966-2-1), shared by sRGB and Display P3
+vec3 srgbEncode(vec3 linear)
+{
+    vec3 v = clamp(linear, 0.0, 1.0);
+    vec3 low = v * 12.92;
+    vec3 high = 1.055 * pow(v, vec3(1.0 / 2.4)) - 0.055;
+    return mix(high, low, vec3(lessThanEqual(v, vec3(0.0031308))));
+}
+
+// Inverse of srgbEncode, for display-ready bytes shown on an HDR swapchain
+vec3 srgbDecode(vec3 encoded)
+{
+    vec3 low = encoded / 12.92;
+    vec3 high = pow((encoded + 0.055) / 1.055, vec3(2.4));
+    return mix(high, low, vec3(lessThanEqual(encoded, vec3(0.04045))));
+}
+
+// SMPTE ST 2084 (PQ) encoding of luminance normalized to 10000 nits
+vec3 pqEncode(vec3 normalized)
+{
+    const float m1 = 0.1593017578125;
+    const float m2 = 78.84375;
+    const float c1 = 0.8359375;
+    const float c2 = 18.8515625;
+    const float c3 = 18.6875;
+    vec3 p = pow(clamp(normalized, 0.0, 1.0), vec3(m1));
+    return pow((c1 + c2 * p) / (1.0 + c3 * p), vec3(m2));
+}
+
+// Highlights above 80% of the peak roll off into it instead of clipping
+// (applied to the largest component, so hues are kept; continuous slope at the knee)
+vec3 toneMapHighlights(vec3 rgb)
+{
+    float peak = max(hdrPeak, 1.0);
+    float knee = 0.8 * peak;
+    float m = max(rgb.r, max(rgb.g, rgb.b));
+    if (m <= knee) {
+        return rgb;
+    }
+    float range = peak - knee;
+    float mapped = knee + range * (1.0 - exp(-(m - knee) / range));
+    return rgb * (mapped / m);
+}
+
+// Linear Rec.709 (1.0 = SDR white) to the encoding of the HDR swapchain
+vec3 encodeHdr(vec3 rgb)
+{
+    if (hdrOutput == 2) {
+        vec3 wide = max(REC709_TO_REC2020 * rgb, 0.0);
+        return pqEncode(toneMapHighlights(wide) * sdrWhiteScale);
+    }
+    if (hdrOutput == 3) {
+        return toneMapHighlights(REC709_TO_P3 * rgb);
+    }
+    // scRGB keeps Rec.709 primaries: colors outside them stay negative
+    return toneMapHighlights(rgb) * sdrWhiteScale;
+}
+
+// Monitor ICC / OCIO display transform, baked over an sRGB-encoded grid
+vec3 applyDisplayLut(vec3 srgb)
+{
+    return texture(displayLutTexture, clamp(srgb, 0.0, 1.0) * lutScale + lutOffset).rgb;
+}
+
+// Overlay colors, linear Rec.709 at SDR white (encoded like the image they replace)
+const vec3 HIGHLIGHT_CLIP_COLOR = vec3(1.0, 0.0, 0.0);
+const vec3 SHADOW_CLIP_COLOR = vec3(0.0, 0.25, 1.0);
+const vec3 PEAKING_COLOR = vec3(0.1, 1.0, 0.1);
+
+// Display-encoded luma of a texel of the edited image (explicit LOD: valid in any control flow)
+float encodedLuma(vec2 uv, bool encoded)
+{
+    vec3 c = textureLod(inputTexture, uv, 0.0).rgb;
+    if (!encoded) {
+        c = srgbEncode(c * exposureGain);
+    }
+    return dot(c, vec3(0.2126, 0.7152, 0.0722));
+}
+
+// Sobel gradient magnitude of the encoded luma, one texel apart
+float sobelMagnitude(vec2 uv, bool encoded)
+{
+    vec2 texel = 1.0 / vec2(textureSize(inputTexture, 0));
+    float tl = encodedLuma(uv + texel * vec2(-1.0, -1.0), encoded);
+    float t  = encodedLuma(uv + texel * vec2( 0.0, -1.0), encoded);
+    float tr = encodedLuma(uv + texel * vec2( 1.0, -1.0), encoded);
+    float l  = encodedLuma(uv + texel * vec2(-1.0,  0.0), encoded);
+    float r  = encodedLuma(uv + texel * vec2( 1.0,  0.0), encoded);
+    float bl = encodedLuma(uv + texel * vec2(-1.0,  1.0), encoded);
+    float b  = encodedLuma(uv + texel * vec2( 0.0,  1.0), encoded);
+    float br = encodedLuma(uv + texel * vec2( 1.0,  1.0), encoded);
+    float gx = (tr + 2.0 * r + br) - (tl + 2.0 * l + bl);
+    float gy = (bl + 2.0 * b + br) - (tl + 2.0 * t + tr);
+    return length(vec2(gx, gy));
+}
+
+// Clipping warnings, then focus peaking: the overlay color of the fragment, if any
+bool overlayColor(vec3 linear, bool encoded, out vec3 color)
+{
+    color = vec3(0.0);
+    if ((overlays & 1) != 0) {
+        float white = hdrOutput != 0 ? max(hdrPeak, 1.0) : 1.0;
+        float m = max(linear.r, max(linear.g, linear.b));
+        if (m >= highlightClip * white) {
+            color = HIGHLIGHT_CLIP_COLOR;
+            return true;
+        }
+        if (m <= shadowClip) {
+            color = SHADOW_CLIP_COLOR;
+            return true;
+        }
+    }
+    if ((overlays & 2) != 0 && sobelMagnitude(vTexCoord, encoded) > peakingThreshold) {
+        color = PEAKING_COLOR;
+        return true;
+    }
+    return false;
+}
+
+// Interleaved gradient noise in [0, 1), stable per screen pixel
+float ditherNoise(vec2 fragCoord)
+{
+    return fract(52.9829189 * fract(dot(fragCoord, vec2(0.06711056, 0.00583715))));
+}
+
 void main()
 {
     // Sample color from texture at interpolated texture coordinate
     vec4 sampledColor = texture(inputTexture, vTexCoord);
+    bool encodedSource = sourceEncoded == 1;
+    float gain = exposureGain;
+    bool showOverlays = true;
+
+    // Before/after: the unedited image left of the split, without the exposure preview
+    // (compareSplit is uniform, so both textures are sampled in uniform control flow)
+    if (compareSplit > 0.0) {
+        vec4 originalColor = texture(originalTexture, vTexCoord);
+        if (vTexCoord.x < compareSplit) {
+            if (compareDiscard == 1) {
+                discard;
+            }
+            sampledColor = originalColor;
+            encodedSource = false;
+            gain = 1.0;
+            showOverlays = false;
+        }
+    }
+
+    // Culling aids over the edited image: the overlay color replaces the sample, then goes
+    // through the same output encoding (SDR, HDR, display transform)
+    vec3 overlay;
+    if (showOverlays && overlays != 0
+        && overlayColor(encodedSource ? srgbDecode(sampledColor.rgb) : sampledColor.rgb * gain, encodedSource, overlay)) {
+        sampledColor.rgb = overlay;
+        encodedSource = false;
+        gain = 1.0;
+    }
+
+    // Display-ready bytes are shown as is on an SDR swapchain
+    // (still mapped to the monitor when a display transform is set)
+    if (encodedSource && hdrOutput == 0) {
+        if (displayLut == 1) {
+            sampledColor.rgb = applyDisplayLut(sampledColor.rgb);
+        }
+        fragColor = sampledColor;
+        return;
+    }
+
+    // HDR: linear values go out unclamped, the system maps them to the screen
+    // (display-ready bytes are SDR content, decoded and placed at SDR white)
+    vec3 rgb = encodedSource ? srgbDecode(sampledColor.rgb) : sampledColor.rgb * gain;
+    if (hdrOutput != 0) {
+        fragColor = vec4(encodeHdr(rgb), clamp(sampledColor.a, 0.0, 1.0));
+        return;
+    }
+
+    vec3 encoded;
+    if (displayLut == 1) {
+        encoded = applyDisplayLut(srgbEncode(rgb));
+    } else {
+        if (outputP3 == 1) {
+            rgb = REC709_TO_P3 * rgb;
+        }
+        encoded = srgbEncode(rgb);
+    }
+
+    if (dither == 1) {
+        encoded += (ditherNoise(gl_FragCoord.xy) - 0.5) / 255.0;
+    }
 
-    // Output the sampled color directly
-    // Note: Ready for future modifications (brightness, contrast, effects, etc.)
-    fragColor = sampledColor;
+    fragColor = vec4(encoded, clamp(sampledColor.a, 0.0, 1.0));
 }
@@ -6,7 +6,11 @@ layout(location = 1) in vec2 texCoord;   // Texture coordinates (u, v)
 
 // --- Uniform Buffer Object ---
 layout(std140, binding = 0) uniform buf {
-    mat4 mvp;        // Model-View-Projection matrix
+    mat4 mvp;             // Model-View-Projection matrix
+    float exposureGain;   // Display transform parameters (fragment stage)
+    int sourceEncoded;
+    int outputP3;
+    int dither;
 };
 
 // --- Vertex Output ---
@@ -0,0 +1,74 @@
+#version 440
+
+// --- Fragment Input ---
+layout(location = 0) in vec2 vTexCoord;        // Atlas coordinates
+layout(location = 1) in vec2 vCellPos;         // Position in the cell image, in pixels
+layout(location = 2) flat in int vCell;        // Cell of the instance
+
+// --- Uniform Buffer Object (shared with the vertex shader) ---
+layout(std140, binding = 0) uniform buf {
+    mat4 mvp;               // Vertex stage
+    vec4 cellRects[8];      // Image rectangle of each cell, in pixels (x, y, w, h)
+    vec4 atlasRects[8];     // Vertex stage
+    int selected;           // Cell framed as selected, -1 for none
+    int outputP3;           // 1: encode for a Display P3 screen instead of sRGB
+    int dither;             // 1: add +/- half an 8-bit step of noise after encoding
+    float borderWidth;      // Width of the selection frame, in pixels
+};
+
+// --- Texture Sampler ---
+layout(binding = 1) uniform sampler2D atlasTexture;  // Linear Rec.709 cell images, one slot per cell
+
+// --- Fragment Output ---
+layout(location = 0) out vec4 fragColor;
+
+// Linear Rec.709 to linear Display P3 (D65), column-major
+const mat3 REC709_TO_P3 = mat3(
+    0.8224621, 0.0331941, 0.0170827,
+    0.1775380, 0.9668058, 0.0723974,
+    0.0000000, 0.0000000, 0.9105199);
+
+// Frame of the selected cell
+const vec3 SELECTION_COLOR = vec3(0.26, 0.56, 0.96);
+
+// sRGB opto-electronic transfer function (IEC 61966-2-1), shared by sRGB and Display P3
+vec3 srgbEncode(vec3 linear)
+{
+    vec3 v = clamp(linear, 0.0, 1.0);
+    vec3 low = v * 12.92;
+    vec3 high = 1.055 * pow(v, vec3(1.0 / 2.4)) - 0.055;
+    return mix(high, low, vec3(lessThanEqual(v, vec3(0.0031308))));
+}
+
+// Interleaved gradient noise in [0, 1), stable per screen pixel
+float ditherNoise(vec2 fragCoord)
+{
+    return fract(52.9829189 * fract(dot(fragCoord, vec2(0.06711056, 0.00583715))));
+}
+
+void main()
+{
+    vec4 sampledColor = texture(atlasTexture, vTexCoord);
+
+    if (vCell == selected) {
+        vec2 size = cellRects[vCell].zw;
+        vec2 edge = min(vCellPos, size - vCellPos);
+        if (min(edge.x, edge.y) < borderWidth) {
+            fragColor = vec4(SELECTION_COLOR, 1.0);
+            return;
+        }
+    }
+
+    vec3 rgb = sampledColor.rgb;
+    if (outputP3 == 1) {
+        rgb = REC709_TO_P3 * rgb;
+    }
+    vec3 encoded = srgbEncode(rgb);
+
+    if (dither == 1) {
+        encoded += (ditherNoise(gl_FragCoord.xy) - 0.5) / 255.0;
+    }
+
+    // Opaque: cells never blend with the background
+    fragColor = vec4(encoded, 1.0);
+}
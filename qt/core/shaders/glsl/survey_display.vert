@@ -0,0 +1,32 @@
+#version 440
+
+// --- Vertex Input ---
+layout(location = 0) in vec2 position;   // Unit quad corner (x, y), shared by every cell
+
+// --- Uniform Buffer Object ---
+layout(std140, binding = 0) uniform buf {
+    mat4 mvp;               // Render target pixels to clip space
+    vec4 cellRects[8];      // Image rectangle of each cell, in pixels (x, y, w, h)
+    vec4 atlasRects[8];     // Texel-center rectangle of each atlas slot (u, v, du, dv)
+    int selected;           // Fragment stage
+    int outputP3;
+    int dither;
+    float borderWidth;
+};
+
+// --- Vertex Output ---
+layout(location = 0) out vec2 vTexCoord;       // Atlas coordinates
+layout(location = 1) out vec2 vCellPos;        // Position in the cell image, in pixels
+layout(location = 2) flat out int vCell;       // Cell of the instance
+
+void main()
+{
+    // Instance i draws cell i: one draw call for the whole survey
+    vec4 cell = cellRects[gl_InstanceIndex];
+    vec4 slot = atlasRects[gl_InstanceIndex];
+
+    vTexCoord = slot.xy + position * slot.zw;
+    vCellPos = position * cell.zw;
+    vCell = gl_InstanceIndex;
+    gl_Position = mvp * vec4(cell.xy + position * cell.zw, 0.0, 1.0);
+}
@@ -0,0 +1,197 @@
+/**
+ * @file thumbnail_image_provider.cpp
+ * @brief Implementation of ThumbnailImageProvider
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "browser/thumbnail_image_provider.h"
+
+#include "common/cancellation_token.h"
+#include "thumbnails/thumbnail_service.h"
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QImage>
+#include <QImageReader>
+#include <QMetaObject>
+#include <QQuickTextureFactory>
+#include <QRunnable>
+
+#include <spdlog/spdlog.h>
+
+#include <mutex>
+#include <utility>
+
+namespace CaptureMoment::UI::Browser {
+
+namespace {
+
+/**
+ * @brief State of a request shared by its response (request thread) and its job (pool thread).
+ */
+struct RequestState {
+    /**
+     * @brief Guards the members below.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief The response to notify (nullptr once destroyed by the engine).
+     */
+    QQuickImageResponse* m_response{nullptr};
+
+    /**
+     * @brief true once `finished` was queued (by the job or by a cancellation).
+     */
+    bool m_finished{false};
+
+    QImage m_image;
+    QString m_error;
+
+    /**
+     * @brief Bumped by `cancel`: the token of the request sees it.
+     */
+    std::shared_ptr<Core::Common::CancellationToken::Counter> m_cancelled {
+        std::make_shared<Core::Common::CancellationToken::Counter>(0)
+    };
+};
+
+/**
+ * @brief Queues `finished` on the response's thread. Caller holds the state's mutex.
+ */
+void queueFinished_unsafe(RequestState& state)
+{
+    state.m_finished = true;
+    if (auto* response = state.m_response) {
+        // Dropped with the response if the engine destroys it first
+        QMetaObject::invokeMethod(response, [response]() { emit response->finished(); }, Qt::QueuedConnection);
+    }
+}
+
+/**
+ * @class ThumbnailResponse
+ * @brief Response of one request: the decoded thumbnail, or the error.
+ */
+class ThumbnailResponse : public QQuickImageResponse {
+public:
+    explicit ThumbnailResponse(std::shared_ptr<RequestState> state)
+        : m_state(std::move(state))
+    {
+        std::lock_guard lock(m_state->m_mutex);
+        m_state->m_response = this;
+    }
+
+    ~ThumbnailResponse() override
+    {
+        std::lock_guard lock(m_state->m_mutex);
+        m_state->m_response = nullptr;
+    }
+
+    [[nodiscard]] QQuickTextureFactory* textureFactory() const override
+    {
+        std::lock_guard lock(m_state->m_mutex);
+        return QQuickTextureFactory::textureFactoryForImage(m_state->m_image);
+    }
+
+    [[nodiscard]] QString errorString() const override
+    {
+        std::lock_guard lock(m_state->m_mutex);
+        return m_state->m_error;
+    }
+
+    void cancel() override
+    {
+        m_state->m_cancelled->fetch_add(1, std::memory_order_relaxed);
+
+        // A cancelled response still finishes, so the engine releases it
+        std::lock_guard lock(m_state->m_mutex);
+        if (!m_state->m_finished) {
+            queueFinished_unsafe(*m_state);
+        }
+    }
+
+private:
+    std::shared_ptr<RequestState> m_state;
+};
+
+/**
+ * @brief Decodes a JPEG thumbnail, scaled down by the decoder to fit `requested_size`.
+ */
+[[nodiscard]] QImage decode(const std::vector<std::byte>& encoded, const QSize& requested_size)
+{
+    QByteArray bytes { QByteArray::fromRawData(reinterpret_cast<const char*>(encoded.data()), static_cast<qsizetype>(encoded.size())) };
+    QBuffer buffer { &bytes };
+    buffer.open(QIODevice::ReadOnly);
+
+    QImageReader reader { &buffer };
+    const QSize size { reader.size() };
+    if (size.isValid() && requested_size.isValid() && !requested_size.isEmpty()
+        && (size.width() > requested_size.width() || size.height() > requested_size.height())) {
+        reader.setScaledSize(size.scaled(requested_size, Qt::KeepAspectRatio));
+    }
+    return reader.read();
+}
+
+} // anonymous namespace
+
+ThumbnailImageProvider::ThumbnailImageProvider(std::shared_ptr<Core::Thumbnails::ThumbnailService> service, int worker_count)
+    : m_service(std::move(service))
+{
+    m_pool.setMaxThreadCount(worker_count);
+    spdlog::debug("[ThumbnailImageProvider::ThumbnailImageProvider]: {} workers", worker_count);
+}
+
+ThumbnailImageProvider::~ThumbnailImageProvider()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+QQuickImageResponse* ThumbnailImageProvider::requestImageResponse(const QString& id, const QSize& requested_size)
+{
+    auto state { std::make_shared<RequestState>() };
+    auto* response { new ThumbnailResponse(state) };
+
+    const std::string path { QUrl::fromPercentEncoding(id.toUtf8()).toStdString() };
+    const Core::Common::CancellationToken token { state->m_cancelled, 0 };
+
+    auto* job { QRunnable::create([service = m_service, state, path, requested_size, token]() {
+        if (token.isCancelled()) {
+            return;
+        }
+
+        QImage image;
+        QString error;
+        if (auto thumbnail = service->getThumbnail(path, Core::Thumbnails::ThumbnailService::k_default_long_edge, token)) {
+            image = decode(thumbnail->m_encoded, requested_size);
+            if (image.isNull()) {
+                error = QStringLiteral("Cannot decode the thumbnail of %1").arg(QString::fromStdString(path));
+            }
+        } else if (thumbnail.error() == Core::ErrorHandling::CoreError::LoadCancelled) {
+            return;
+        } else {
+            error = QString::fromStdString(Core::ErrorHandling::to_string(thumbnail.error()));
+        }
+
+        std::lock_guard lock(state->m_mutex);
+        if (state->m_finished) {
+            return;
+        }
+        state->m_image = std::move(image);
+        state->m_error = std::move(error);
+        queueFinished_unsafe(*state);
+    }) };
+
+    // Newest first: the cells on screen now were requested last
+    m_pool.start(job, m_sequence.fetch_add(1, std::memory_order_relaxed));
+    return response;
+}
+
+QUrl ThumbnailImageProvider::sourceUrl(const QString& path)
+{
+    return QUrl(QStringLiteral("image://%1/%2").arg(QLatin1String(k_provider_id),
+                                                   QString::fromLatin1(QUrl::toPercentEncoding(path))));
+}
+
+} // namespace CaptureMoment::UI::Browser
@@ -0,0 +1,143 @@
+/**
+ * @file adaptive_preview_quality.cpp
+ * @brief Implementation of AdaptivePreviewQuality
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "controller/adaptive_preview_quality.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::UI::Controller {
+
+AdaptivePreviewQuality::AdaptivePreviewQuality(double frame_budget_ms) noexcept
+    : m_frame_budget_ms(frame_budget_ms)
+{
+}
+
+void AdaptivePreviewQuality::setFullSize(QSize size) noexcept
+{
+    m_full_size = size;
+    changeLevel(m_ceiling);
+}
+
+bool AdaptivePreviewQuality::setScaleCeiling(double scale) noexcept
+{
+    // The largest level not above the scale (tolerating the rounding of the levels)
+    const auto found { std::ranges::find_if(k_levels, [scale](double level) { return level <= scale + 1e-3; }) };
+    const std::size_t ceiling { found != k_levels.end() ? static_cast<std::size_t>(found - k_levels.begin())
+                                                        : k_levels.size() - 1 };
+    if (ceiling == m_ceiling) {
+        return false;
+    }
+    m_ceiling = ceiling;
+
+    const QSize previous { proxySize() };
+    if (m_level < m_ceiling) {
+        changeLevel(m_ceiling);
+    }
+    return proxySize() != previous;
+}
+
+bool AdaptivePreviewQuality::recordPreview(double processing_ms) noexcept
+{
+    if (m_full_size.isEmpty()) {
+        return false;
+    }
+
+    if (processing_ms > m_frame_budget_ms) {
+        m_fast_count = 0;
+        // The smallest level is reached when a further step would not shrink the proxy
+        const std::size_t lower { m_level + 1 };
+        if (++m_slow_count >= k_slow_samples && lower < k_levels.size() && sizeAt(lower) != sizeAt(m_level)) {
+            spdlog::debug("[AdaptivePreviewQuality::recordPreview]: Previews take {:.1f} ms (budget {:.1f} ms), proxy scale {:.2f}",
+                          processing_ms, m_frame_budget_ms, k_levels[lower]);
+            changeLevel(lower);
+            return true;
+        }
+        return false;
+    }
+    m_slow_count = 0;
+
+    if (m_level <= m_ceiling) {
+        return false;
+    }
+
+    // Processing time grows with the pixels: predict the time one level up
+    const double ratio { k_levels[m_level - 1] / k_levels[m_level] };
+    if (processing_ms * ratio * ratio < m_frame_budget_ms * k_headroom) {
+        if (++m_fast_count >= k_fast_samples) {
+            spdlog::debug("[AdaptivePreviewQuality::recordPreview]: Previews take {:.1f} ms, proxy scale back to {:.2f}",
+                          processing_ms, k_levels[m_level - 1]);
+            changeLevel(m_level - 1);
+            return true;
+        }
+    } else {
+        m_fast_count = 0;
+    }
+    return false;
+}
+
+bool AdaptivePreviewQuality::predictPreview(double predicted_ms) noexcept
+{
+    if (m_full_size.isEmpty()) {
+        return false;
+    }
+
+    // Processing time grows with the pixels: the time at a lower level is the prediction scaled down
+    const double current_scale { k_levels[m_level] };
+    std::size_t level { m_level };
+    while (level + 1 < k_levels.size() && sizeAt(level + 1) != sizeAt(level)) {
+        const double ratio { k_levels[level] / current_scale };
+        if (predicted_ms * ratio * ratio <= m_frame_budget_ms) {
+            break;
+        }
+        ++level;
+    }
+    if (level == m_level) {
+        return false;
+    }
+
+    spdlog::debug("[AdaptivePreviewQuality::predictPreview]: Previews predicted at {:.1f} ms (budget {:.1f} ms), proxy scale {:.2f}",
+                  predicted_ms, m_frame_budget_ms, k_levels[level]);
+    changeLevel(level);
+    return true;
+}
+
+bool AdaptivePreviewQuality::restore() noexcept
+{
+    const QSize previous { proxySize() };
+    changeLevel(m_ceiling);
+    return proxySize() != previous;
+}
+
+QSize AdaptivePreviewQuality::proxySize() const noexcept
+{
+    return sizeAt(m_level);
+}
+
+QSize AdaptivePreviewQuality::sizeAt(std::size_t level) const noexcept
+{
+    if (m_full_size.isEmpty() || level == 0) {
+        return m_full_size;
+    }
+
+    // Never below the minimum long edge (nor above the full size, for small displays)
+    const int long_edge { std::max(m_full_size.width(), m_full_size.height()) };
+    const double scale { std::min(1.0, std::max(k_levels[level], static_cast<double>(k_min_long_edge) / long_edge)) };
+    return QSize { std::max(1, static_cast<int>(std::lround(m_full_size.width() * scale))),
+                   std::max(1, static_cast<int>(std::lround(m_full_size.height() * scale))) };
+}
+
+void AdaptivePreviewQuality::changeLevel(std::size_t level) noexcept
+{
+    m_level = level;
+    m_slow_count = 0;
+    m_fast_count = 0;
+}
+
+} // namespace CaptureMoment::UI::Controller
@@ -12,9 +12,16 @@
 #include "models/operations/base_adjustment_model.h"
 #include "common/error_handling/core_error.h"
 #include "common/types/image_types.h"
+#include "common/types/processing_outcome.h"
+#include "config/app_config.h"
 
 #include <QMetaObject>
+#include <QPointF>
 #include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <utility>
 
 #include <spdlog/spdlog.h>
 
@@ -43,16 +50,270 @@ ImageControllerBase::ImageControllerBase(QObject* parent)
     m_engine = std::make_shared<Core::Engine::PhotoEngine>();
     spdlog::info("[ImageControllerBase::ImageControllerBase]: Initialized PhotoEngine");
 
+    m_performance_monitor = std::make_unique<PerformanceMonitor>(m_engine);
+
+    // Auto tone reads the statistics the pipeline reduces from each display image
+    m_engine->setHistogramEnabled(true);
+
+    // RAW files may show their embedded preview first: swap the full demosaic in on the worker thread
+    m_engine->setImageRefinedCallback([this](std::string_view path) {
+        QMetaObject::invokeMethod(&m_worker_context, [this, file_path = std::string(path)]() {
+            doAdoptRefinedImage(file_path);
+        }, Qt::QueuedConnection);
+    });
+
+    // A draft RAW preview is enough until its pixels are magnified: then request the full quality
+    QObject::connect(m_display_manager.get(), &Display::DisplayManager::zoomChanged, this, [this](float zoom) {
+        if (zoom * m_display_manager->displayScale() < k_full_quality_magnification) {
+            return;
+        }
+        QMetaObject::invokeMethod(&m_worker_context, [this]() {
+            if (m_engine->isPreviewImage()) {
+                m_engine->requestFullQualityImage();
+            }
+        }, Qt::QueuedConnection);
+    });
+
+    // A new downsample level after a resize (the texture is scaled on the GPU in between)
+    QObject::connect(m_display_manager.get(), &Display::DisplayManager::displayImageRequest, this,
+                     [this](int width, int height) {
+        const std::uint64_t serial { m_display_refresh_serial.fetch_add(1, std::memory_order_relaxed) + 1 };
+        QMetaObject::invokeMethod(&m_worker_context, [this, size = QSize(width, height), serial]() {
+            doRefreshDisplayImage(size, serial);
+        }, Qt::QueuedConnection);
+    });
+
+    // Deep zoom: the tiles the view is missing are cut from the working image on the worker thread
+    QObject::connect(m_display_manager.get(), &Display::DisplayManager::displayTilesRequest, this,
+                     [this](quint64 generation, int level, const QList<QPoint>& positions) {
+        std::vector<std::pair<Display::TileKey, QRect>> tiles;
+        tiles.reserve(static_cast<std::size_t>(positions.size()));
+        for (const QPoint& position : positions) {
+            const Display::TileKey key { level, position.x(), position.y() };
+            tiles.emplace_back(key, m_display_manager->tilePyramid().tileSourceRect(key));
+        }
+        QMetaObject::invokeMethod(&m_worker_context, [this, generation, tiles = std::move(tiles)]() mutable {
+            doExtractDisplayTiles(generation, std::move(tiles));
+        }, Qt::QueuedConnection);
+    });
+
+    // Pan-ahead: the tiles about to scroll into view, cut when the worker has nothing else to do
+    QObject::connect(m_display_manager.get(), &Display::DisplayManager::displayTilesPrefetch, this,
+                     [this](quint64 generation, int level, const QList<QPoint>& positions) {
+        std::vector<std::pair<Display::TileKey, QRect>> tiles;
+        tiles.reserve(static_cast<std::size_t>(positions.size()));
+        for (const QPoint& position : positions) {
+            const Display::TileKey key { level, position.x(), position.y() };
+            tiles.emplace_back(key, m_display_manager->tilePyramid().tileSourceRect(key));
+        }
+        const std::uint64_t serial { m_tile_prefetch_serial.fetch_add(1, std::memory_order_relaxed) + 1 };
+        QMetaObject::invokeMethod(&m_worker_context, [this, generation, serial, tiles = std::move(tiles)]() mutable {
+            doPrefetchDisplayTiles(generation, serial, std::move(tiles));
+        }, Qt::QueuedConnection);
+    });
+
     connectModelsToStateManager();
+
+    // Engine calls (which block on their futures) run on the worker thread, never on the GUI thread
+    m_worker_context.moveToThread(&m_worker_thread);
+    m_worker_thread.setObjectName("ImageControllerWorker");
+    m_worker_thread.start();
+
+    // Full-resolution pass once parameter changes stop for a short while
+    m_full_resolution_timer.setSingleShot(true);
+    m_full_resolution_timer.setInterval(k_full_resolution_idle_ms);
+    QObject::connect(&m_full_resolution_timer, &QTimer::timeout, this, [this]() {
+        if (!m_operation_state_manager) {
+            return;
+        }
+        spdlog::debug("[ImageControllerBase]: Input idle, scheduling full-resolution pass");
+
+        // The settled edits are one history state; its display image becomes the state's preview.
+        // An empty list (everything undone) still runs: the working image returns to the source.
+        commitHistoryState();
+        QMetaObject::invokeMethod(&m_worker_context, [this, ops = m_operation_state_manager->getActiveOperations(),
+                                                      size = currentDisplaySize(),
+                                                      history_state = m_edit_history.currentStateId()]() mutable {
+            doApplyOperations(std::move(ops), size, false, history_state);
+            doRestorePreviewQuality();
+        }, Qt::QueuedConnection);
+    });
+
+    // The session is saved once loads and edits settle, for an instant restore at the next launch
+    m_session_path = Core::Serializer::SessionSnapshot::defaultPath();
+    m_session_save_timer.setSingleShot(true);
+    m_session_save_timer.setInterval(k_session_save_delay_ms);
+    QObject::connect(&m_session_save_timer, &QTimer::timeout, this, &ImageControllerBase::saveSession);
+
+    // Preview runs, one at a time, started by the pacer on the window's frames
+    QObject::connect(&m_submission_pacer, &SubmissionPacer::submit, this, [this]() {
+        QMetaObject::invokeMethod(&m_worker_context, [this, size = currentDisplaySize()]() {
+            auto active_ops = m_operation_state_manager->getActiveOperations();
+            if (!active_ops.empty()) {
+                doApplyOperations(std::move(active_ops), size, true);
+                // Once the preview is displayed: the proxy is resampled while the pacer waits
+                doResizePreviewProxy();
+            }
+            QMetaObject::invokeMethod(this, [this]() { m_submission_pacer.submissionFinished(); }, Qt::QueuedConnection);
+        }, Qt::QueuedConnection);
+    });
+
     spdlog::debug("[ImageControllerBase::ImageControllerBase]: Completed construction");
 }
 
 ImageControllerBase::~ImageControllerBase()
 {
     spdlog::debug("[ImageControllerBase::~ImageControllerBase]: Destroying ImageControllerBase");
+    // Unblock a worker waiting on a request, then drain its queue
+    if (m_engine) {
+        m_engine->setImageRefinedCallback({});
+        m_engine->cancelProcessing();
+    }
     m_worker_thread.quit();
     m_worker_thread.wait();
     spdlog::debug("[ImageControllerBase::~ImageControllerBase]: Worker thread stopped and destroyed");
+
+    // The worker has stopped: the last session's preview is rendered on this thread
+    if (m_engine && !m_session_source_path.empty()) {
+        doSaveSession(currentSession(), currentDisplaySize());
+    }
+}
+
+void ImageControllerBase::setPacingWindow(QQuickWindow* window)
+{
+    m_submission_pacer.setWindow(window);
+}
+
+void ImageControllerBase::undo()
+{
+    if (!m_edit_history.undo()) {
+        spdlog::debug("[ImageControllerBase::undo]: Nothing to undo");
+        return;
+    }
+    restoreHistoryState();
+}
+
+void ImageControllerBase::redo()
+{
+    if (!m_edit_history.redo()) {
+        spdlog::debug("[ImageControllerBase::redo]: Nothing to redo");
+        return;
+    }
+    restoreHistoryState();
+}
+
+void ImageControllerBase::autoTone()
+{
+    // The edits the displayed image was rendered with are a state of their own
+    commitHistoryState();
+
+    auto suggested { m_engine->suggestAutoTone(m_edit_history.current()) };
+    if (!suggested) {
+        spdlog::warn("[ImageControllerBase::autoTone]: No suggestion: {}", Core::ErrorHandling::to_string(suggested.error()));
+        return;
+    }
+
+    if (!m_edit_history.commit(std::move(*suggested), "Auto tone")) {
+        spdlog::debug("[ImageControllerBase::autoTone]: Tones already balanced");
+        return;
+    }
+    restoreHistoryState();
+}
+
+void ImageControllerBase::beginParameterTransaction()
+{
+    if (!m_operation_model_manager || !m_operation_state_manager) {
+        return;
+    }
+
+    // The edits the displayed image was rendered with are a state of their own
+    if (!m_operation_model_manager->isInTransaction()) {
+        commitHistoryState();
+    }
+    m_operation_model_manager->beginTransaction();
+    m_operation_state_manager->beginTransaction();
+}
+
+void ImageControllerBase::commitParameterTransaction()
+{
+    if (!m_operation_model_manager || !m_operation_state_manager) {
+        return;
+    }
+
+    m_operation_state_manager->commitTransaction();
+    if (!m_operation_model_manager->commitTransaction() || !m_engine) {
+        return;
+    }
+
+    // All the staged values at once: one snapshot, one edit state, one engine request
+    m_engine->publishParameters(m_parameter_snapshot);
+    commitHistoryState();
+
+    m_submission_pacer.discardPending();
+    m_full_resolution_timer.stop();
+    auto operations { m_operation_state_manager->getActiveOperations() };
+    m_parameter_snapshot.applyTo(operations);
+    spdlog::debug("[ImageControllerBase::commitParameterTransaction]: Applying {} operation(s) in one request", operations.size());
+    if (!operations.empty()) {
+        applyOperations(std::move(operations));
+    }
+}
+
+void ImageControllerBase::commitHistoryState()
+{
+    // The descriptors carry the value they were registered with: take the published ones
+    auto operations { m_operation_state_manager->getActiveOperations() };
+    m_parameter_snapshot.applyTo(operations);
+
+    if (m_edit_history.commit(std::move(operations))) {
+        spdlog::debug("[ImageControllerBase::commitHistoryState]: Edit state {} recorded", m_edit_history.currentIndex());
+        emit historyChanged();
+        m_session_save_timer.start();
+    }
+}
+
+void ImageControllerBase::restoreHistoryState()
+{
+    const auto& operations { m_edit_history.current() };
+    spdlog::debug("[ImageControllerBase::restoreHistoryState]: Restoring edit state {} ({} operation(s))",
+                  m_edit_history.currentIndex(), operations.size());
+
+    m_operation_state_manager->setOperations(operations);
+
+    // Published values: exactly the operations of the state (an absent one registers again when edited)
+    m_parameter_snapshot = {};
+    for (const auto& operation : operations) {
+        if (auto value = operation.getParam<float>(Core::Operations::ParameterKey::Value)) {
+            m_parameter_snapshot.set(operation.type, *value);
+        }
+    }
+    m_engine->publishParameters(m_parameter_snapshot);
+
+    // Sliders follow, without their changes being taken for edits
+    m_restoring_history = true;
+    for (const auto& model : m_operation_model_manager->getBaseAdjustmentModels()) {
+        if (!model) {
+            continue;
+        }
+        const auto type { model->getDescriptor().type };
+        const auto it { std::ranges::find(operations, type, &Core::Operations::OperationDescriptor::type) };
+        float value { 0.0f };
+        if (it != operations.end()) {
+            value = it->getParam<float>(Core::Operations::ParameterKey::Value).value_or(0.0f);
+        }
+        model->setValue(value);
+    }
+    m_restoring_history = false;
+
+    // Show the state's cached preview at once; the full-resolution pass runs once stepping stops
+    if (auto preview = m_edit_history.currentPreview(); preview && m_display_manager) {
+        m_display_manager->createDisplayImage(std::move(preview));
+    } else if (!operations.empty()) {
+        m_submission_pacer.requestSubmission();
+    }
+    m_full_resolution_timer.start();
+
+    emit historyChanged();
 }
 
 void ImageControllerBase::registerModel(IOperationModel* model)
@@ -81,8 +342,11 @@ void ImageControllerBase::loadImage(const QString& file_path)
 
     spdlog::info("[ImageControllerBase::loadImage]: Calling method-thread doLoadImage() Loading {}", file_path.toStdString());
 
+    // Another image replaces a session still being restored
+    m_session_operations.reset();
+
     // Run on worker thread to avoid blocking UI
-    QMetaObject::invokeMethod(this, [this, file_path]() {
+    QMetaObject::invokeMethod(&m_worker_context, [this, file_path]() {
         doLoadImage(file_path);
     }, Qt::QueuedConnection);
 }
@@ -116,6 +380,111 @@ void ImageControllerBase::loadImageFromUrl(const QUrl& file_url)
     loadImage(native_path);
 }
 
+bool ImageControllerBase::restoreSession()
+{
+    auto snapshot { Core::Serializer::SessionSnapshot::load(m_session_path) };
+    if (!snapshot) {
+        spdlog::debug("[ImageControllerBase::restoreSession]: No session to restore");
+        return false;
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(snapshot->m_source_path, ec)) {
+        spdlog::info("[ImageControllerBase::restoreSession]: '{}' no longer exists, session skipped", snapshot->m_source_path);
+        return false;
+    }
+
+    spdlog::info("[ImageControllerBase::restoreSession]: Restoring the session of '{}' ({} operation(s))",
+                 snapshot->m_source_path, snapshot->m_operations.size());
+
+    // The last preview, where it was left, while the image loads behind it
+    if (m_display_manager) {
+        m_display_manager->setSourceImageSize(static_cast<int>(snapshot->m_source_width),
+                                              static_cast<int>(snapshot->m_source_height));
+        if (auto preview = snapshot->decodePreview()) {
+            m_display_manager->createDisplayImage(std::make_shared<const Core::Common::DisplayImage>(std::move(*preview)));
+        } else {
+            spdlog::debug("[ImageControllerBase::restoreSession]: No preview: {}", Core::ErrorHandling::to_string(preview.error()));
+        }
+        m_display_manager->setZoom(snapshot->m_zoom);
+        m_display_manager->setPan(QPointF(snapshot->m_pan_x, snapshot->m_pan_y));
+    }
+
+    if (!snapshot->m_operations.empty()) {
+        warmUpPipeline(snapshot->m_operations);
+    }
+    loadImage(QString::fromStdString(snapshot->m_source_path));
+    // Set after the load request, which clears it: applied once this image is loaded
+    m_session_operations = std::move(snapshot->m_operations);
+    return true;
+}
+
+void ImageControllerBase::saveSession()
+{
+    m_session_save_timer.stop();
+    if (m_session_source_path.empty()) {
+        return;
+    }
+
+    QMetaObject::invokeMethod(&m_worker_context, [this, snapshot = currentSession(), size = currentDisplaySize()]() mutable {
+        doSaveSession(std::move(snapshot), size);
+    }, Qt::QueuedConnection);
+}
+
+Core::Serializer::SessionSnapshot ImageControllerBase::currentSession() const
+{
+    Core::Serializer::SessionSnapshot snapshot;
+    snapshot.m_source_path = m_session_source_path;
+    snapshot.m_source_width = static_cast<Core::Common::ImageDim>(m_image_width);
+    snapshot.m_source_height = static_cast<Core::Common::ImageDim>(m_image_height);
+
+    // The descriptors carry the value they were registered with: take the published ones
+    if (m_operation_state_manager) {
+        snapshot.m_operations = m_operation_state_manager->getActiveOperations();
+        m_parameter_snapshot.applyTo(snapshot.m_operations);
+    }
+
+    if (m_display_manager) {
+        snapshot.m_zoom = m_display_manager->zoom();
+        snapshot.m_pan_x = static_cast<float>(m_display_manager->pan().x());
+        snapshot.m_pan_y = static_cast<float>(m_display_manager->pan().y());
+    }
+    return snapshot;
+}
+
+void ImageControllerBase::doSaveSession(Core::Serializer::SessionSnapshot snapshot, QSize preview_size)
+{
+    // The working image holds the settled edits: one downsample, no pass
+    if (m_engine && !preview_size.isEmpty()) {
+        auto display_image_result = m_engine->getDownsampledDisplayImage(
+            static_cast<Core::Common::ImageDim>(preview_size.width()),
+            static_cast<Core::Common::ImageDim>(preview_size.height())
+        );
+        if (display_image_result) {
+            if (auto preview = Core::Serializer::SessionSnapshot::encodePreview(*display_image_result.value())) {
+                snapshot.m_preview_jpeg = std::move(*preview);
+            }
+        } else {
+            spdlog::debug("[ImageControllerBase::doSaveSession]: Session saved without a preview: {}",
+                          Core::ErrorHandling::to_string(display_image_result.error()));
+        }
+    }
+
+    if (auto saved = snapshot.save(m_session_path); !saved) {
+        spdlog::warn("[ImageControllerBase::doSaveSession]: Session not saved: {}", Core::ErrorHandling::to_string(saved.error()));
+    }
+}
+
+void ImageControllerBase::warmUpPipeline(std::vector<Core::Operations::OperationDescriptor> operations)
+{
+    if (!m_engine) {
+        spdlog::warn("[ImageControllerBase::warmUpPipeline]: Engine not available");
+        return;
+    }
+
+    m_engine->warmUpPipeline(std::move(operations));
+}
+
 void ImageControllerBase::applyOperations(std::vector<Core::Operations::OperationDescriptor> operations)
 {
     if (!m_engine)
@@ -136,15 +505,62 @@ void ImageControllerBase::applyOperations(std::vector<Core::Operations::Operatio
 
     if (m_operation_state_manager)
     {
-   QMetaObject::invokeMethod(this, [this, ops = std::move(operations)]() mutable {
-        doApplyOperations(std::move(ops));
-    }, Qt::QueuedConnection);
+        // The display size is read here, on the GUI thread that owns the DisplayManager
+        QMetaObject::invokeMethod(&m_worker_context, [this, ops = std::move(operations), size = currentDisplaySize()]() mutable {
+            doApplyOperations(std::move(ops), size);
+        }, Qt::QueuedConnection);
     } else {
         spdlog::error("[ImageControllerBase::applyOperations]: OperationStateManager is null during legacy applyOperations call!");
         emit operationFailed("Internal error: OperationStateManager not initialized");
     }
 }
 
+void ImageControllerBase::applyPreviewOperations(std::vector<Core::Operations::OperationDescriptor> operations)
+{
+    if (!m_engine)
+    {
+        spdlog::warn("[ImageControllerBase::applyPreviewOperations]: Engine not available");
+        emit operationFailed("No image loaded");
+        return;
+    }
+
+    if (operations.empty())
+    {
+        spdlog::warn("[ImageControllerBase::applyPreviewOperations]: Empty operation list provided");
+        emit operationFailed("No operations specified");
+        return;
+    }
+
+    spdlog::debug("[ImageControllerBase::applyPreviewOperations]: Applying {} operation(s) on proxy", operations.size());
+
+    QMetaObject::invokeMethod(&m_worker_context, [this, ops = std::move(operations), size = currentDisplaySize()]() mutable {
+        doApplyOperations(std::move(ops), size, true);
+    }, Qt::QueuedConnection);
+}
+
+void ImageControllerBase::applyProgressiveOperations(std::vector<Core::Operations::OperationDescriptor> operations)
+{
+    if (!m_engine)
+    {
+        spdlog::warn("[ImageControllerBase::applyProgressiveOperations]: Engine not available");
+        emit operationFailed("No image loaded");
+        return;
+    }
+
+    if (operations.empty())
+    {
+        spdlog::warn("[ImageControllerBase::applyProgressiveOperations]: Empty operation list provided");
+        emit operationFailed("No operations specified");
+        return;
+    }
+
+    spdlog::debug("[ImageControllerBase::applyProgressiveOperations]: Applying {} operation(s) progressively", operations.size());
+
+    QMetaObject::invokeMethod(&m_worker_context, [this, ops = std::move(operations), size = currentDisplaySize()]() mutable {
+        doApplyProgressiveOperations(std::move(ops), size);
+    }, Qt::QueuedConnection);
+}
+
 void ImageControllerBase::doLoadImage(const QString& file_path)
 {
     spdlog::info("[ImageControllerBase::doLoadImage]: Starting load on worker thread");
@@ -158,35 +574,102 @@ void ImageControllerBase::doLoadImage(const QString& file_path)
         QString error_msg = QString::fromStdString(
             std::format("CoreError [{}]: {}", static_cast<int>(err), Core::ErrorHandling::to_string(err))
         );
-        onImageLoadResult(false, error_msg);
+        postImageLoadResult(false, error_msg);
         return;
     }
 
-    // 2. Get Metadata
-    m_image_width = m_engine->width();
-    m_image_height = m_engine->height();
-
-    spdlog::info("[ImageControllerBase::doLoadImage]: Image loaded {}x{}", m_image_width, m_image_height);
+    // Queued before the publication: the session names the image once it is loaded
+    QMetaObject::invokeMethod(this, [this, path = file_path.toStdString()]() {
+        m_session_source_path = path;
+    }, Qt::QueuedConnection);
 
-    // 3. Notify DisplayManager of source size
-    if (m_display_manager) {
-        m_display_manager->setSourceImageSize(
-            static_cast<int>(m_image_width),
-            static_cast<int>(m_image_height)
-        );
-    }
+    publishLoadedImage(false);
+}
 
-    // 4. Get display size from DisplayManager
-    QSize downsample_size { m_display_manager->downsampleSize() };
+void ImageControllerBase::doAdoptRefinedImage(const std::string& file_path)
+{
+    // The full demosaic replaces the embedded preview the image was loaded with
+    auto adopt_result = m_engine->adoptRefinedImage(file_path);
 
-    if (downsample_size.isEmpty()) {
-        spdlog::error("[ImageControllerBase::doLoadImage]: Invalid downsample size");
-        onImageLoadResult(false, "Invalid downsample size");
+    if (!adopt_result) {
+        spdlog::error("[ImageControllerBase::doAdoptRefinedImage]: Swap to the full-quality image failed: {}",
+                      Core::ErrorHandling::to_string(adopt_result.error()));
+        return;
+    }
+    if (!adopt_result.value()) {
+        spdlog::debug("[ImageControllerBase::doAdoptRefinedImage]: '{}' is no longer the loaded image", file_path);
         return;
     }
 
-    // 5. Get downsampled image directly (GPU → small ImageRegion)
-    spdlog::debug("[ImageControllerBase::doLoadImage]: Requesting downsampled image {}x{}",
+    publishLoadedImage(true);
+}
+
+void ImageControllerBase::publishLoadedImage(bool reapply_operations)
+{
+    // 2. Get Metadata
+    const int width = static_cast<int>(m_engine->width());
+    const int height = static_cast<int>(m_engine->height());
+    const Core::Common::ImageOrientation orientation { m_engine->orientation() };
+
+    spdlog::info("[ImageControllerBase::publishLoadedImage]: Image loaded {}x{}", width, height);
+
+    // 3. On the GUI thread: publish the size and let the DisplayManager pick the display size,
+    // then come back to the worker thread for the display image
+    QMetaObject::invokeMethod(this, [this, width, height, orientation, reapply_operations]() {
+        m_image_width = width;
+        m_image_height = height;
+
+        // A new image starts a new history (the full-quality swap of the same image keeps it);
+        // a restored session's starts at its saved edits
+        bool restore_session { false };
+        if (!reapply_operations) {
+            if (m_session_operations) {
+                restore_session = !m_session_operations->empty();
+                m_edit_history.reset(std::move(*m_session_operations));
+                m_session_operations.reset();
+            } else {
+                auto operations { m_operation_state_manager->getActiveOperations() };
+                m_parameter_snapshot.applyTo(operations);
+                m_edit_history.reset(std::move(operations));
+            }
+            emit historyChanged();
+        }
+
+        if (m_display_manager) {
+            // Before the size: the fit that follows lays out the upright image
+            m_display_manager->setSourceOrientation(orientation);
+            m_display_manager->setSourceImageSize(width, height);
+        }
+
+        const QSize downsample_size { currentDisplaySize() };
+        if (downsample_size.isEmpty()) {
+            spdlog::error("[ImageControllerBase::publishLoadedImage]: Invalid downsample size");
+            onImageLoadResult(false, "Invalid downsample size");
+            return;
+        }
+
+        QMetaObject::invokeMethod(&m_worker_context, [this, downsample_size, restore_session]() {
+            doPrepareLoadedImage(downsample_size, restore_session);
+        }, Qt::QueuedConnection);
+
+        // The session's edits render over its preview (queued after the preparation)
+        if (restore_session) {
+            restoreHistoryState();
+        }
+
+        // Edits made on the preview carry over to the full-quality image (queued after the preparation)
+        if (reapply_operations && m_operation_state_manager) {
+            if (auto active_ops = m_operation_state_manager->getActiveOperations(); !active_ops.empty()) {
+                applyOperations(std::move(active_ops));
+            }
+        }
+    }, Qt::QueuedConnection);
+}
+
+void ImageControllerBase::doPrepareLoadedImage(QSize downsample_size, bool keep_displayed)
+{
+    // 4. Get downsampled image directly (GPU → small ImageRegion)
+    spdlog::debug("[ImageControllerBase::doPrepareLoadedImage]: Requesting downsampled image {}x{}",
                   downsample_size.width(), downsample_size.height());
 
     auto display_image_result = m_engine->getDownsampledDisplayImage(
@@ -195,86 +678,274 @@ void ImageControllerBase::doLoadImage(const QString& file_path)
     );
 
     if (!display_image_result) {
-        spdlog::error("[ImageControllerBase::doLoadImage]: Failed to get downsampled image: {}",
+        spdlog::error("[ImageControllerBase::doPrepareLoadedImage]: Failed to get downsampled image: {}",
                       Core::ErrorHandling::to_string(display_image_result.error()));
-        onImageLoadResult(false, "Failed to get display image");
+        postImageLoadResult(false, "Failed to get display image");
         return;
     }
 
-    spdlog::debug("[ImageControllerBase::doLoadImage]: Got downsampled image successfully");
+    spdlog::debug("[ImageControllerBase::doPrepareLoadedImage]: Got downsampled image successfully");
+
+    // 5. Prepare the preview proxy used while dragging controls, at full quality (within the energy plan)
+    static_cast<void>(m_preview_quality.setScaleCeiling(Core::Config::AppConfig::instance().currentEnergyPlan().m_proxy_scale));
+    m_preview_quality.setFullSize(downsample_size);
+    const QSize proxy_size { m_preview_quality.proxySize() };
+    if (auto proxy_result = m_engine->prepareProxy(
+            static_cast<Core::Common::ImageDim>(proxy_size.width()),
+            static_cast<Core::Common::ImageDim>(proxy_size.height())); !proxy_result) {
+        spdlog::warn("[ImageControllerBase::doPrepareLoadedImage]: Preview proxy unavailable ({}), edits will run at full resolution",
+                     Core::ErrorHandling::to_string(proxy_result.error()));
+        m_preview_quality.setFullSize(QSize());
+    }
+    m_preview_proxy_stale = false;
 
-    // 6. Update DisplayManager with const& (no copy, no shared_ptr)
-    if (m_display_manager) {
-        m_display_manager->createDisplayImage(std::move(display_image_result.value()));
-        spdlog::info("[ImageControllerBase::doLoadImage]: DisplayManager updated");
+    // 6. Hand the image over to the DisplayManager on the GUI thread, then report.
+    // An unedited copy stays with the renderer: before/after comparison needs no engine pass
+    if (keep_displayed) {
+        postDisplayImage(nullptr, std::move(display_image_result.value()));
     } else {
-        spdlog::error("[ImageControllerBase::doLoadImage]: No DisplayManager available!");
+        auto original { std::make_unique<Core::Common::ImageRegion>(*display_image_result.value()) };
+        postDisplayImage(std::move(display_image_result.value()), std::move(original));
     }
-
-    onImageLoadResult(true, "");
+    postImageLoadResult(true, "");
 }
 
-void ImageControllerBase::doApplyOperations(std::vector<Core::Operations::OperationDescriptor>&& operations)
+void ImageControllerBase::doApplyOperations(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                                            QSize display_size, bool preview, std::uint64_t history_state)
 {
-    spdlog::debug("[ImageControllerBase::doApplyOperations]: Starting operation processing with {} operations", operations.size());
+    spdlog::debug("[ImageControllerBase::doApplyOperations]: Starting operation processing with {} operations (preview={})",
+                  operations.size(), preview);
 
     if (!m_engine) {
         spdlog::error("[ImageControllerBase::doApplyOperations]: No engine available");
-        onOperationResult(false, "No engine available");
+        postOperationResult(false, "No engine available");
         return;
     }
 
-    // 1. Trigger Core Processing and wait for completion
-    // The core uses a deferred future: the continuation that updates the working image
-    // and clears the "update in progress" flag only runs when .get() is called.
+    // 1. Trigger Core Processing and wait for its outcome (this is the worker thread)
+    // A newer request supersedes this one (its own call updates the display).
+    // The pipeline also encodes the display image in the same pass when it can.
+    if (!display_size.isEmpty()) {
+        m_engine->setDisplayOutputSize(static_cast<Core::Common::ImageDim>(display_size.width()),
+                                       static_cast<Core::Common::ImageDim>(display_size.height()));
+    }
+
     spdlog::debug("[ImageControllerBase::doApplyOperations]: Applying operations via PhotoEngine");
-    auto apply_future = m_engine->applyOperations(std::move(operations));
+    const auto submitted_at { std::chrono::steady_clock::now() };
+    auto apply_future = preview ? m_engine->applyOperationsToProxy(std::move(operations))
+                                : m_engine->applyOperations(std::move(operations));
+    presentProcessingOutcome(std::move(apply_future), display_size, preview, history_state, submitted_at);
+}
+
+void ImageControllerBase::doFinishInteraction(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                                              QSize display_size, std::uint64_t history_state)
+{
+    if (!m_engine) {
+        spdlog::error("[ImageControllerBase::doFinishInteraction]: No engine available");
+        postOperationResult(false, "No engine available");
+        return;
+    }
+
+    if (!display_size.isEmpty()) {
+        m_engine->setDisplayOutputSize(static_cast<Core::Common::ImageDim>(display_size.width()),
+                                       static_cast<Core::Common::ImageDim>(display_size.height()));
+    }
+
+    // The engine refines what the gesture submitted; a click (or a tick not run yet) submitted nothing
+    const auto submitted_at { std::chrono::steady_clock::now() };
+    auto refine_future { m_engine->endInteraction() };
+    if (!refine_future.valid()) {
+        spdlog::debug("[ImageControllerBase::doFinishInteraction]: Nothing refined by the engine, applying {} operations",
+                      operations.size());
+        refine_future = m_engine->applyOperations(std::move(operations));
+    }
+    presentProcessingOutcome(std::move(refine_future), display_size, false, history_state, submitted_at);
+    doRestorePreviewQuality();
+}
+
+void ImageControllerBase::presentProcessingOutcome(std::future<Core::Common::ProcessingOutcome> apply_future,
+                                                   QSize display_size, bool preview, std::uint64_t history_state,
+                                                   std::chrono::steady_clock::time_point submitted_at)
+{
     if (!apply_future.valid()) {
-        onOperationResult(false, "Failed to start operation");
+        postOperationResult(false, "Failed to start operation");
         return;
     }
-    bool apply_ok = apply_future.get();
-    if (!apply_ok) {
-        onOperationResult(false, "Operation processing failed");
+    switch (apply_future.get()) {
+    case Core::Common::ProcessingOutcome::Completed:
+        if (preview) {
+            const std::chrono::duration<double, std::milli> processing { std::chrono::steady_clock::now() - submitted_at };
+            m_preview_proxy_stale = m_preview_quality.recordPreview(processing.count()) || m_preview_proxy_stale;
+        }
+        break;
+    case Core::Common::ProcessingOutcome::Superseded:
+    case Core::Common::ProcessingOutcome::Cancelled:
+        spdlog::debug("[ImageControllerBase::presentProcessingOutcome]: Request superseded or cancelled, display left to the newer request");
+        return;
+    case Core::Common::ProcessingOutcome::Failed:
+        postOperationResult(false, "Operation processing failed");
         return;
     }
 
-    // 2. Get display size from DisplayManager
-    QSize downsample_size { m_display_manager->downsampleSize() };
+    // 2. Fused display image: already sRGB RGBA8, no separate downsample or conversion pass
+    if (auto display_image = m_engine->takeDisplayImage()) {
+        // One shared frame from here to the upload: the history and the display hold the same bytes
+        auto image { std::make_shared<const Core::Common::DisplayImage>(std::move(*display_image)) };
+        QMetaObject::invokeMethod(this, [this, image = std::move(image), history_state]() mutable {
+            // Host pixels only: a device buffer goes back to its pool once displayed
+            if (history_state != 0 && !image->isOnDevice()) {
+                m_edit_history.storePreview(history_state, image);
+            }
+            if (m_display_manager) {
+                m_display_manager->createDisplayImage(std::move(image));
+                spdlog::info("[ImageControllerBase::presentProcessingOutcome]: Display updated (fused)");
+            }
+        }, Qt::QueuedConnection);
+        postOperationResult(true, "");
+        return;
+    }
 
-    if (downsample_size.isEmpty()) {
-        spdlog::error("[ImageControllerBase::doApplyOperations]: Invalid downsample size");
-        onOperationResult(false, "Invalid downsample size");
+    // 3. Otherwise (region of interest, AOT kernel, identity): downsample the working image
+    if (display_size.isEmpty()) {
+        spdlog::error("[ImageControllerBase::presentProcessingOutcome]: Invalid downsample size");
+        postOperationResult(false, "Invalid downsample size");
         return;
     }
 
-    // 3. Get downsampled image directly (GPU → small ImageRegion)
-    spdlog::debug("[ImageControllerBase::doApplyOperations]: Requesting downsampled image {}x{}", 
-                  downsample_size.width(), downsample_size.height());
+    // 4. Get downsampled image directly (GPU → small ImageRegion)
+    spdlog::debug("[ImageControllerBase::presentProcessingOutcome]: Requesting downsampled image {}x{}", 
+                  display_size.width(), display_size.height());
 
     auto display_image_result = m_engine->getDownsampledDisplayImage(
-        static_cast<Core::Common::ImageDim>(downsample_size.width()),
-        static_cast<Core::Common::ImageDim>(downsample_size.height())
+        static_cast<Core::Common::ImageDim>(display_size.width()),
+        static_cast<Core::Common::ImageDim>(display_size.height())
     );
 
     if (!display_image_result) {
-        spdlog::error("[ImageControllerBase::doApplyOperations]: Failed to get downsampled display image: {}",
+        spdlog::error("[ImageControllerBase::presentProcessingOutcome]: Failed to get downsampled display image: {}",
                       Core::ErrorHandling::to_string(display_image_result.error()));
-        onOperationResult(false, "Failed to get display image");
+        postOperationResult(false, "Failed to get display image");
         return;
     }
 
-    spdlog::debug("[ImageControllerBase::doApplyOperations]: Got downsampled image successfully");
+    spdlog::debug("[ImageControllerBase::presentProcessingOutcome]: Got downsampled image successfully");
 
-    // 4. Update DisplayManager with const& (no copy, no shared_ptr)
-    if (m_display_manager) {
-        m_display_manager->createDisplayImage(std::move(display_image_result.value()));
-        spdlog::info("[ImageControllerBase::doApplyOperations]: Display updated");
-    } else {
-        spdlog::warn("[ImageControllerBase::doApplyOperations]: No DisplayManager");
+    // 5. Hand the image over to the DisplayManager on the GUI thread, then report
+    postDisplayImage(std::move(display_image_result.value()));
+    postOperationResult(true, "");
+}
+
+void ImageControllerBase::doRestorePreviewQuality()
+{
+    // The next interaction starts from full quality again, as far as the energy plan allows
+    const auto energy_plan { Core::Config::AppConfig::instance().currentEnergyPlan() };
+    m_preview_proxy_stale = m_preview_quality.setScaleCeiling(energy_plan.m_proxy_scale) || m_preview_proxy_stale;
+    m_preview_proxy_stale = m_preview_quality.restore() || m_preview_proxy_stale;
+    doResizePreviewProxy();
+}
+
+void ImageControllerBase::doPredictPreviewQuality()
+{
+    if (!m_engine || !m_operation_state_manager) {
+        return;
+    }
+
+    const QSize size { m_preview_quality.proxySize() };
+    if (size.isEmpty()) {
+        return;
+    }
+
+    const auto operations { m_operation_state_manager->getActiveOperations() };
+    const auto predicted { m_engine->estimateRenderMilliseconds(operations, static_cast<Core::Common::ImageDim>(size.width()),
+                                                                static_cast<Core::Common::ImageDim>(size.height())) };
+    if (predicted && m_preview_quality.predictPreview(*predicted)) {
+        m_preview_proxy_stale = true;
+        doResizePreviewProxy();
+    }
+}
+
+void ImageControllerBase::doResizePreviewProxy()
+{
+    if (!m_preview_proxy_stale || !m_engine) {
+        return;
     }
+    m_preview_proxy_stale = false;
 
-    onOperationResult(true, "");
+    const QSize size { m_preview_quality.proxySize() };
+    if (size.isEmpty()) {
+        return;
+    }
+
+    // Waits for the running pass: the proxy it reads is replaced
+    if (auto proxy_result = m_engine->prepareProxy(static_cast<Core::Common::ImageDim>(size.width()),
+                                                   static_cast<Core::Common::ImageDim>(size.height())); !proxy_result) {
+        spdlog::warn("[ImageControllerBase::doResizePreviewProxy]: Failed to resize the preview proxy to {}x{}: {}",
+                     size.width(), size.height(), Core::ErrorHandling::to_string(proxy_result.error()));
+        return;
+    }
+    spdlog::debug("[ImageControllerBase::doResizePreviewProxy]: Preview proxy resized to {}x{}", size.width(), size.height());
+}
+
+void ImageControllerBase::doRefreshDisplayImage(QSize display_size, std::uint64_t serial)
+{
+    // Superseded by a later resize
+    if (serial != m_display_refresh_serial.load(std::memory_order_relaxed) || !m_engine || display_size.isEmpty()) {
+        return;
+    }
+
+    auto display_image_result = m_engine->getDownsampledDisplayImage(
+        static_cast<Core::Common::ImageDim>(display_size.width()),
+        static_cast<Core::Common::ImageDim>(display_size.height())
+    );
+    if (!display_image_result) {
+        spdlog::debug("[ImageControllerBase::doRefreshDisplayImage]: No display image at {}x{}: {}",
+                      display_size.width(), display_size.height(),
+                      Core::ErrorHandling::to_string(display_image_result.error()));
+        return;
+    }
+
+    spdlog::debug("[ImageControllerBase::doRefreshDisplayImage]: Display image downsampled to {}x{}",
+                  display_size.width(), display_size.height());
+    postDisplayImage(std::move(display_image_result.value()));
+}
+
+QSize ImageControllerBase::currentDisplaySize() const
+{
+    return m_display_manager ? m_display_manager->downsampleSize() : QSize();
+}
+
+void ImageControllerBase::postDisplayImage(std::unique_ptr<Core::Common::ImageRegion> image,
+                                           std::unique_ptr<Core::Common::ImageRegion> original)
+{
+    // The shared holders keep the queued functor copyable
+    QMetaObject::invokeMethod(this, [this, holder = std::shared_ptr<Core::Common::ImageRegion>(std::move(image)),
+                                     original_holder = std::shared_ptr<Core::Common::ImageRegion>(std::move(original))]() {
+        if (m_display_manager) {
+            if (original_holder) {
+                m_display_manager->setOriginalImage(std::make_unique<Core::Common::ImageRegion>(std::move(*original_holder)));
+            }
+            if (holder) {
+                m_display_manager->createDisplayImage(std::make_unique<Core::Common::ImageRegion>(std::move(*holder)));
+                spdlog::info("[ImageControllerBase::postDisplayImage]: Display updated");
+            }
+        } else {
+            spdlog::warn("[ImageControllerBase::postDisplayImage]: No DisplayManager");
+        }
+    }, Qt::QueuedConnection);
+}
+
+void ImageControllerBase::postImageLoadResult(bool success, const QString& error_msg)
+{
+    QMetaObject::invokeMethod(this, [this, success, error_msg]() {
+        onImageLoadResult(success, error_msg);
+    }, Qt::QueuedConnection);
+}
+
+void ImageControllerBase::postOperationResult(bool success, const QString& error_msg)
+{
+    QMetaObject::invokeMethod(this, [this, success, error_msg]() {
+        onOperationResult(success, error_msg);
+    }, Qt::QueuedConnection);
 }
 
 void ImageControllerBase::onImageLoadResult(bool success, const QString& error_msg)
@@ -286,12 +957,155 @@ void ImageControllerBase::onImageLoadResult(bool success, const QString& error_m
                      m_image_width, m_image_height);
         emit imageSizeChanged();
         emit imageLoaded(m_image_width, m_image_height);
+        m_session_save_timer.start();
     } else {
         spdlog::error("[ImageControllerBase::onImageLoadResult]: Image load failed - {}", error_msg.toStdString());
         emit imageLoadFailed(error_msg);
     }
 }
 
+void ImageControllerBase::doApplyProgressiveOperations(std::vector<Core::Operations::OperationDescriptor>&& operations,
+                                                       QSize display_size)
+{
+    if (!m_engine || !m_display_manager) {
+        spdlog::error("[ImageControllerBase::doApplyProgressiveOperations]: No engine or DisplayManager available");
+        postOperationResult(false, "No engine available");
+        return;
+    }
+
+    if (display_size.isEmpty()) {
+        spdlog::error("[ImageControllerBase::doApplyProgressiveOperations]: Invalid downsample size");
+        postOperationResult(false, "Invalid downsample size");
+        return;
+    }
+
+    // The engine calls back on its scheduler threads: hand the images and the outcome over to this thread.
+    // The shared holder keeps the queued functor copyable.
+    Core::Managers::ProgressiveRefinement refinement;
+    refinement.m_display_width = static_cast<Core::Common::ImageDim>(display_size.width());
+    refinement.m_display_height = static_cast<Core::Common::ImageDim>(display_size.height());
+    refinement.m_on_preview = [this](std::unique_ptr<Core::Common::ImageRegion> preview) {
+        QMetaObject::invokeMethod(this, [this, image = std::shared_ptr<Core::Common::ImageRegion>(std::move(preview))]() {
+            m_display_manager->createDisplayImage(std::make_unique<Core::Common::ImageRegion>(std::move(*image)));
+        }, Qt::QueuedConnection);
+    };
+    refinement.m_on_tile = [this](std::unique_ptr<Core::Common::ImageRegion> tile) {
+        QMetaObject::invokeMethod(this, [this, image = std::shared_ptr<Core::Common::ImageRegion>(std::move(tile))]() {
+            m_display_manager->updateDisplayTile(std::make_unique<Core::Common::ImageRegion>(std::move(*image)));
+        }, Qt::QueuedConnection);
+    };
+
+    // Do not block on the future: the images are delivered to this thread while the request runs
+    refinement.m_on_finished = [this](Core::Common::ProcessingOutcome outcome) {
+        QMetaObject::invokeMethod(this, [this, outcome]() {
+            switch (outcome) {
+            case Core::Common::ProcessingOutcome::Completed:
+                onOperationResult(true, "");
+                return;
+            case Core::Common::ProcessingOutcome::Superseded:
+            case Core::Common::ProcessingOutcome::Cancelled:
+                spdlog::debug("[ImageControllerBase::doApplyProgressiveOperations]: Refinement superseded or cancelled");
+                return;
+            case Core::Common::ProcessingOutcome::Failed:
+                onOperationResult(false, "Operation processing failed");
+                return;
+            }
+        }, Qt::QueuedConnection);
+    };
+
+    // The outcome is reported through m_on_finished
+    (void) m_engine->applyOperationsProgressive(std::move(operations), std::move(refinement));
+}
+
+void ImageControllerBase::doExtractDisplayTiles(quint64 generation,
+                                                std::vector<std::pair<Display::TileKey, QRect>> tiles)
+{
+    if (!m_engine) {
+        return;
+    }
+
+    auto view_result { m_engine->getWorkingImageView() };
+    if (!view_result) {
+        spdlog::warn("[ImageControllerBase::doExtractDisplayTiles]: No working image: {}",
+                     Core::ErrorHandling::to_string(view_result.error()));
+        return;
+    }
+
+    const Core::Common::ImageView& view { *view_result };
+    const int view_width { static_cast<int>(view.m_width) };
+    const int view_height { static_cast<int>(view.m_height) };
+    const int channels { static_cast<int>(view.m_channels) };
+
+    for (const auto& [key, source_rect] : tiles) {
+        // Box filter: each tile pixel averages a (2^level)^2 block of source pixels
+        const int factor { 1 << key.level };
+        const QRect rect { source_rect.intersected(QRect(0, 0, view_width, view_height)) };
+        const int width { (rect.width() + factor - 1) / factor };
+        const int height { (rect.height() + factor - 1) / factor };
+        if (width <= 0 || height <= 0) {
+            continue;
+        }
+
+        Core::Common::PixelBuffer data(static_cast<std::size_t>(width) * height * 4);
+
+        for (int y = 0; y < height; ++y) {
+            const int y0 { rect.y() + y * factor };
+            const int y1 { std::min(y0 + factor, rect.y() + rect.height()) };
+            for (int x = 0; x < width; ++x) {
+                const int x0 { rect.x() + x * factor };
+                const int x1 { std::min(x0 + factor, rect.x() + rect.width()) };
+
+                float sum[4] { 0.0f, 0.0f, 0.0f, 0.0f };
+                for (int sy = y0; sy < y1; ++sy) {
+                    for (int sx = x0; sx < x1; ++sx) {
+                        for (int c = 0; c < std::min(channels, 4); ++c) {
+                            sum[c] += view(sy, sx, c);
+                        }
+                    }
+                }
+
+                const float inv_count { 1.0f / static_cast<float>((y1 - y0) * (x1 - x0)) };
+                float* out { data.data() + (static_cast<std::size_t>(y) * width + x) * 4 };
+                out[0] = sum[0] * inv_count;
+                out[1] = (channels > 1 ? sum[1] : sum[0]) * inv_count;
+                out[2] = (channels > 2 ? sum[2] : sum[0]) * inv_count;
+                out[3] = channels > 3 ? sum[3] * inv_count : 1.0f;
+            }
+        }
+
+        auto tile { std::make_shared<Core::Common::ImageRegion>(
+            rect.x(), rect.y(), std::move(data),
+            static_cast<Core::Common::ImageDim>(width), static_cast<Core::Common::ImageDim>(height), 4) };
+
+        QMetaObject::invokeMethod(this, [this, generation, key, tile]() {
+            if (m_display_manager) {
+                m_display_manager->addDisplayTile(generation, key,
+                                                  std::make_unique<Core::Common::ImageRegion>(std::move(*tile)));
+            }
+        }, Qt::QueuedConnection);
+    }
+}
+
+void ImageControllerBase::doPrefetchDisplayTiles(quint64 generation, std::uint64_t serial,
+                                                 std::vector<std::pair<Display::TileKey, QRect>> tiles)
+{
+    if (tiles.empty() || serial != m_tile_prefetch_serial.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::vector<std::pair<Display::TileKey, QRect>> first;
+    first.push_back(tiles.front());
+    tiles.erase(tiles.begin());
+    doExtractDisplayTiles(generation, std::move(first));
+
+    // Back of the queue: whatever was posted while this tile was cut runs first
+    if (!tiles.empty()) {
+        QMetaObject::invokeMethod(&m_worker_context, [this, generation, serial, tiles = std::move(tiles)]() mutable {
+            doPrefetchDisplayTiles(generation, serial, std::move(tiles));
+        }, Qt::QueuedConnection);
+    }
+}
+
 void ImageControllerBase::onOperationResult(bool success, const QString& error_msg)
 {
     spdlog::debug("[ImageControllerBase::onOperationResult]: success={}", success);
@@ -320,29 +1134,77 @@ void ImageControllerBase::connectModelsToStateManager()
         if (model) {
             // Connect the EXISTING valueChanged signal from BaseAdjustmentModel
             // The type is known at compile time, no cast needed here.
+            const Core::Operations::OperationType type = model->getDescriptor().type;
             QObject::connect(model.get(), &UI::Models::Operations::BaseAdjustmentModel::valueChanged,
-                             [this, model /* Capture the shared_ptr to the specific model */ ](float new_value) {
-                                 spdlog::debug("[ImageControllerBase::connectModelsToStateManager]: Value changed signal received for model {}", model->name().toStdString());
+                             [this, model /* Capture the shared_ptr to the specific model */, type](float new_value) {
+                                 // This lambda is called on every tick of the specific BaseAdjustmentModel.
+                                 // A restored history state, not an edit
+                                 if (m_restoring_history) {
+                                     return;
+                                 }
 
-                                 // This lambda is called when the specific BaseAdjustmentModel's value changes.
+                                 if (!m_operation_state_manager || !m_engine) {
+                                     spdlog::warn("[ImageControllerBase::connectModelsToStateManager]: Received valueChanged signal, but StateManager or engine is null.");
+                                     return;
+                                 }
 
-                                 // 1. Update the OperationStateManager with the CURRENT state of this specific model
-                                 if (m_operation_state_manager) {
-                                     auto descriptor = model->getDescriptor(); // Get the descriptor for the specific model that changed
+                                 // 1. Structural change only the first time the model is edited:
+                                 // register its descriptor with the OperationStateManager
+                                 if (!m_parameter_snapshot.has(type)) {
+                                     auto descriptor = model->getDescriptor();
                                      m_operation_state_manager->addOrUpdateOperation(descriptor);
-                                     spdlog::debug("[ImageControllerBase::connectModelsToStateManager]: Operation '{}' updated in StateManager via valueChanged signal.", descriptor.name);
-                                 } else {
-                                     spdlog::warn("[ImageControllerBase::connectModelsToStateManager]: Received valueChanged signal, but StateManager is null.");
-                                     return; // Exit if StateManager is not available
+                                     spdlog::debug("[ImageControllerBase::connectModelsToStateManager]: Operation '{}' added to StateManager.", descriptor.name);
                                  }
 
-                                 // 2. Retrieve the full list of active operations from OperationStateManager
-                                auto active_ops = m_operation_state_manager->getActiveOperations();
+                                 // 2. Hot path: publish the value (no allocation, no mutex).
+                                 // Runs launched from now on read it, whatever descriptors they were given.
+                                 // In a transaction (a preset), the commit publishes and submits them all at once.
+                                 m_parameter_snapshot.set(type, new_value);
+                                 if (m_operation_model_manager->isInTransaction()) {
+                                     return;
+                                 }
+                                 m_engine->publishParameters(m_parameter_snapshot);
 
-                                 // 3. Trigger the applyOperations workflow with the full list of active operations (Move semantics)
-                                applyOperations(std::move(active_ops));
+                                 // 3. Ask the pacer for a preview run (it reads the latest values),
+                                 // and (re)arm the idle timer of the full-resolution pass
+                                 m_submission_pacer.requestSubmission();
+                                 if (!m_interacting) {
+                                     m_full_resolution_timer.start();
+                                 }
+                             });
 
+            // Pressed: the ticks until release are one gesture, previewed on the engine's interactive path
+            QObject::connect(model.get(), &UI::Models::Operations::BaseAdjustmentModel::interactionStarted,
+                             [this, model]() {
+                                 if (!m_engine) {
+                                     return;
+                                 }
+                                 m_interacting = true;
+                                 m_full_resolution_timer.stop();
+                                 m_engine->beginInteraction(model->getDescriptor().id);
+                                 // Before the gesture's first preview: the proxy resolution its chain can afford
+                                 QMetaObject::invokeMethod(&m_worker_context, [this]() { doPredictPreviewQuality(); },
+                                                           Qt::QueuedConnection);
+                             });
 
+            // Released: the gesture's edits are one history state, refined at once instead of after the idle delay
+            QObject::connect(model.get(), &UI::Models::Operations::BaseAdjustmentModel::interactionEnded,
+                             [this]() {
+                                 if (!m_interacting || !m_operation_state_manager) {
+                                     return;
+                                 }
+                                 m_interacting = false;
+                                 m_full_resolution_timer.stop();
+                                 // A preview not submitted yet would supersede the refine
+                                 m_submission_pacer.discardPending();
+                                 commitHistoryState();
+
+                                 // Behind the gesture's last preview run on the worker queue
+                                 QMetaObject::invokeMethod(&m_worker_context, [this, ops = m_operation_state_manager->getActiveOperations(),
+                                                                               size = currentDisplaySize(),
+                                                                               history_state = m_edit_history.currentStateId()]() mutable {
+                                     doFinishInteraction(std::move(ops), size, history_state);
+                                 }, Qt::QueuedConnection);
                              });
             spdlog::debug("[ImageControllerBase::connectModelsToStateManager]: Connected model {}", model->name().toStdString());
         }
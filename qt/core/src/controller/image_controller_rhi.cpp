@@ -24,8 +24,21 @@ ImageControllerRHI::~ImageControllerRHI()
 
 void ImageControllerRHI::setRHIImageItem(CaptureMoment::UI::Rendering::RHIImageItem* item)
 {
+    if (m_rhi_image_item) {
+        QObject::disconnect(m_rhi_image_item, &Rendering::RHIImageItem::deviceImagesSupportedChanged, this, nullptr);
+    }
+
     m_rhi_image_item = item;
 
+    // GPU results stay on the GPU when the renderer can sample the engine's buffers in place
+    if (m_rhi_image_item) {
+        QObject::connect(m_rhi_image_item, &Rendering::RHIImageItem::deviceImagesSupportedChanged, this,
+                         [this](bool supported) {
+            m_engine->setDisplayOnDevice(supported);
+        });
+    }
+    m_engine->setDisplayOnDevice(m_rhi_image_item && m_rhi_image_item->supportsDeviceImages());
+
     if (m_display_manager)
     {
         // The DisplayManager handles rendering, so give it the RHI item.
@@ -0,0 +1,179 @@
+/**
+ * @file performance_monitor.cpp
+ * @brief Implementation of PerformanceMonitor
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "controller/performance_monitor.h"
+
+#include "engine/photo_engine.h"
+#include "config/app_config.h"
+#include "common/memory/memory_budget.h"
+#include "rendering/render_stats.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::UI::Controller {
+
+namespace {
+
+constexpr double k_bytes_per_mb { 1024.0 * 1024.0 };
+
+[[nodiscard]] double toMs(Core::Common::ProcessingTimings::Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+PerformanceMonitor::PerformanceMonitor(std::shared_ptr<Core::Engine::PhotoEngine> engine, QObject* parent)
+    : QObject(parent)
+    , m_engine(std::move(engine))
+{
+    m_refresh_timer.setInterval(k_refresh_interval_ms);
+    QObject::connect(&m_refresh_timer, &QTimer::timeout, this, &PerformanceMonitor::refresh);
+
+    // The counters run even while the overlay is hidden: opening it shows the session so far
+    if (m_engine) {
+        m_engine->setProcessingTimingsCallback([this](const Core::Common::ProcessingTimings& timings) {
+            recordTimings(timings);
+        });
+    }
+}
+
+PerformanceMonitor::~PerformanceMonitor()
+{
+    // Returns once no callback runs any more (the engine swaps it under its request lock)
+    if (m_engine) {
+        m_engine->setProcessingTimingsCallback({});
+    }
+}
+
+void PerformanceMonitor::setWindow(QQuickWindow* window)
+{
+    QObject::disconnect(m_frame_connection);
+    m_window = window;
+
+    if (m_window && m_active) {
+        // frameSwapped is emitted on the render thread with the threaded render loop
+        m_frame_connection = QObject::connect(m_window, &QQuickWindow::frameSwapped,
+                                              this, &PerformanceMonitor::onFrameSwapped, Qt::QueuedConnection);
+    }
+}
+
+void PerformanceMonitor::setActive(bool active)
+{
+    if (active == m_active) {
+        return;
+    }
+
+    m_active = active;
+    spdlog::debug("[PerformanceMonitor::setActive]: Sampling {}", active ? "started" : "stopped");
+
+    if (m_active) {
+        // Start from a clean window: what accumulated while hidden is not per-refresh
+        static_cast<void>(Rendering::RenderStats::takeTextureUploads());
+        m_frames = 0;
+        m_refresh_clock.start();
+        m_refresh_timer.start();
+    } else {
+        m_refresh_timer.stop();
+    }
+    setWindow(m_window);
+
+    emit activeChanged(m_active);
+}
+
+void PerformanceMonitor::reset()
+{
+    {
+        std::lock_guard lock(m_timings_mutex);
+        m_window_timings = {};
+    }
+    m_completed = 0;
+    m_coalesced = 0;
+    m_dropped = 0;
+    emit statsChanged();
+}
+
+void PerformanceMonitor::recordTimings(const Core::Common::ProcessingTimings& timings)
+{
+    using Core::Common::ProcessingOutcome;
+
+    std::lock_guard lock(m_timings_mutex);
+
+    switch (timings.m_outcome) {
+    case ProcessingOutcome::Completed: {
+        const double latency_ms { toMs(timings.m_settled - timings.m_submitted) };
+        ++m_window_timings.m_completed;
+        m_window_timings.m_latency_total_ms += latency_ms;
+        m_window_timings.m_latency_max_ms = std::max(m_window_timings.m_latency_max_ms, latency_ms);
+        m_window_timings.m_pipeline_total_ms += toMs(timings.pipeline());
+        break;
+    }
+    case ProcessingOutcome::Superseded:
+    case ProcessingOutcome::Cancelled:
+        if (timings.ran()) {
+            ++m_window_timings.m_dropped;
+        } else if (timings.m_outcome == ProcessingOutcome::Superseded) {
+            ++m_window_timings.m_coalesced;
+        }
+        break;
+    case ProcessingOutcome::Failed:
+        break;
+    }
+
+    if (timings.ran()) {
+        m_window_timings.m_backend = timings.m_backend;
+    }
+}
+
+void PerformanceMonitor::refresh()
+{
+    TimingsWindow window;
+    {
+        std::lock_guard lock(m_timings_mutex);
+        window = m_window_timings;
+        m_window_timings = {};
+    }
+
+    m_completed += static_cast<int>(window.m_completed);
+    m_coalesced += static_cast<int>(window.m_coalesced);
+    m_dropped += static_cast<int>(window.m_dropped);
+
+    // Idle refreshes keep the last figures rather than dropping to zero
+    if (window.m_completed > 0) {
+        m_engine_latency_ms = window.m_latency_total_ms / static_cast<double>(window.m_completed);
+        m_engine_latency_max_ms = window.m_latency_max_ms;
+        m_pipeline_ms = window.m_pipeline_total_ms / static_cast<double>(window.m_completed);
+    }
+
+    if (window.m_backend && window.m_backend != m_last_backend) {
+        m_last_backend = window.m_backend;
+        m_backend_name = *m_last_backend == Core::Common::MemoryType::GPU_MEMORY ? QStringLiteral("GPU") : QStringLiteral("CPU");
+        m_target = QString::fromStdString(Core::Config::AppConfig::getHalideTarget(*m_last_backend).to_string());
+    }
+
+    m_queue_depth = m_engine ? static_cast<int>(m_engine->getQueueDepth()) : 0;
+
+    const auto& budget { Core::Common::MemoryBudget::instance() };
+    m_memory_used_mb = static_cast<double>(budget.usageBytes()) / k_bytes_per_mb;
+    m_memory_budget_mb = static_cast<double>(budget.ceilingBytes()) / k_bytes_per_mb;
+
+    const auto uploads { Rendering::RenderStats::takeTextureUploads() };
+    if (uploads.m_count > 0) {
+        m_texture_upload_ms = static_cast<double>(uploads.m_total_ns) / 1.0e6 / static_cast<double>(uploads.m_count);
+    }
+
+    const qint64 elapsed_ms { m_refresh_clock.restart() };
+    m_render_fps = elapsed_ms > 0 ? static_cast<double>(m_frames) * 1000.0 / static_cast<double>(elapsed_ms) : 0.0;
+    m_frames = 0;
+
+    emit statsChanged();
+}
+
+} // namespace CaptureMoment::UI::Controller
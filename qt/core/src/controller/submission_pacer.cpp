@@ -0,0 +1,120 @@
+/**
+ * @file submission_pacer.cpp
+ * @brief Implementation of SubmissionPacer
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "controller/submission_pacer.h"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::UI::Controller {
+
+namespace {
+
+/**
+ * @brief Frame intervals outside this range (idle windows, first frames) are not averaged.
+ */
+constexpr double k_min_frame_interval_ms { 4.0 };
+constexpr double k_max_frame_interval_ms { 100.0 };
+
+} // namespace
+
+SubmissionPacer::SubmissionPacer(QObject* parent)
+    : QObject(parent)
+{
+    m_clock.start();
+
+    m_fallback_timer.setSingleShot(true);
+    m_fallback_timer.setInterval(k_default_frame_interval_ms);
+    QObject::connect(&m_fallback_timer, &QTimer::timeout, this, &SubmissionPacer::trySubmit);
+}
+
+void SubmissionPacer::setWindow(QQuickWindow* window)
+{
+    if (m_frame_connection) {
+        QObject::disconnect(m_frame_connection);
+    }
+
+    m_window = window;
+    m_last_frame_ms = -1;
+
+    if (m_window) {
+        // frameSwapped is emitted on the render thread with the threaded render loop
+        m_frame_connection = QObject::connect(m_window, &QQuickWindow::frameSwapped,
+                                              this, &SubmissionPacer::onFrameSwapped, Qt::QueuedConnection);
+        spdlog::debug("[SubmissionPacer::setWindow]: Submissions paced on the window frames");
+    } else {
+        spdlog::debug("[SubmissionPacer::setWindow]: No window, submissions paced by timer");
+    }
+}
+
+void SubmissionPacer::requestSubmission()
+{
+    m_pending = true;
+
+    // The finishing request picks the pending state up
+    if (!m_in_flight) {
+        scheduleFrame();
+    }
+}
+
+void SubmissionPacer::submissionFinished()
+{
+    m_in_flight = false;
+
+    const auto latency = static_cast<double>(m_clock.elapsed() - m_submitted_at_ms);
+    m_latency_ms = m_latency_ms == 0.0 ? latency : m_latency_ms + k_smoothing * (latency - m_latency_ms);
+
+    if (!m_pending) {
+        return;
+    }
+
+    // Engine-bound: start right away. Otherwise wait for the frame, one request per frame at most.
+    if (m_latency_ms >= m_frame_interval_ms) {
+        trySubmit();
+    } else {
+        scheduleFrame();
+    }
+}
+
+void SubmissionPacer::onFrameSwapped()
+{
+    const qint64 now = m_clock.elapsed();
+    if (m_last_frame_ms >= 0) {
+        const auto interval = static_cast<double>(now - m_last_frame_ms);
+        if (interval >= k_min_frame_interval_ms && interval <= k_max_frame_interval_ms) {
+            m_frame_interval_ms += k_smoothing * (interval - m_frame_interval_ms);
+        }
+    }
+    m_last_frame_ms = now;
+
+    trySubmit();
+}
+
+void SubmissionPacer::scheduleFrame()
+{
+    if (m_window) {
+        // A static scene renders no frames: request one
+        m_window->update();
+    } else if (!m_fallback_timer.isActive()) {
+        m_fallback_timer.start();
+    }
+}
+
+void SubmissionPacer::trySubmit()
+{
+    if (!m_pending || m_in_flight) {
+        return;
+    }
+
+    m_pending = false;
+    m_in_flight = true;
+    m_submitted_at_ms = m_clock.elapsed();
+    emit submit();
+}
+
+} // namespace CaptureMoment::UI::Controller
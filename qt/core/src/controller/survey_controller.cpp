@@ -0,0 +1,186 @@
+/**
+ * @file survey_controller.cpp
+ * @brief Implementation of SurveyController
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "controller/survey_controller.h"
+
+#include "common/image_region.h"
+#include "operations/parameter_snapshot.h"
+#include "workers/engine_scheduler.h"
+
+#include <spdlog/spdlog.h>
+#include <QUrl>
+#include <algorithm>
+
+namespace CaptureMoment::UI::Controller {
+
+SurveyController::SurveyController(QObject* parent)
+    : QObject(parent)
+    , m_scheduler(std::make_shared<Core::Workers::EngineScheduler>())
+{
+    // Engine calls (which block on their futures) run on the worker thread, never on the GUI thread
+    m_worker_context.moveToThread(&m_worker_thread);
+    m_worker_thread.setObjectName("SurveyControllerWorker");
+    m_worker_thread.start();
+}
+
+SurveyController::~SurveyController()
+{
+    // Queued loads and renders of the current set are dropped
+    m_generation.fetch_add(1, std::memory_order_relaxed);
+    m_worker_thread.quit();
+    m_worker_thread.wait();
+}
+
+void SurveyController::setSurveyItem(Rendering::RHISurveyItem* item)
+{
+    if (item == m_survey_item) {
+        return;
+    }
+
+    QObject::disconnect(m_cell_edge_connection);
+    m_survey_item = item;
+
+    if (m_survey_item) {
+        m_survey_item->setCount(m_count);
+        m_cell_long_edge.store(m_survey_item->cellLongEdge(), std::memory_order_relaxed);
+
+        // Larger cells need sharper renders, smaller ones cheaper uploads
+        m_cell_edge_connection = QObject::connect(m_survey_item, &Rendering::RHISurveyItem::cellLongEdgeChanged,
+                                                  this, [this](int edge) {
+            m_cell_long_edge.store(edge, std::memory_order_relaxed);
+            QMetaObject::invokeMethod(&m_worker_context, [this, generation = m_generation.load(std::memory_order_relaxed)]() {
+                doRenderAll(generation);
+            }, Qt::QueuedConnection);
+        });
+    }
+
+    emit surveyItemChanged();
+}
+
+void SurveyController::loadImages(const QStringList& paths)
+{
+    std::vector<std::string> files;
+    for (const QString& path : paths) {
+        if (static_cast<int>(files.size()) == Rendering::RHISurveyItem::k_max_images) {
+            spdlog::warn("[SurveyController::loadImages]: Only the first {} images are surveyed",
+                         Rendering::RHISurveyItem::k_max_images);
+            break;
+        }
+        const QUrl url { path };
+        files.push_back((url.isLocalFile() ? url.toLocalFile() : path).toStdString());
+    }
+
+    m_count = static_cast<int>(files.size());
+    if (m_survey_item) {
+        m_survey_item->clearImages();
+        m_survey_item->setCount(m_count);
+    }
+    emit countChanged(m_count);
+
+    const std::uint64_t generation { m_generation.fetch_add(1, std::memory_order_relaxed) + 1 };
+    QMetaObject::invokeMethod(&m_worker_context, [this, files = std::move(files), generation]() mutable {
+        doLoadImages(std::move(files), generation);
+    }, Qt::QueuedConnection);
+}
+
+void SurveyController::setOperations(int index, std::vector<Core::Operations::OperationDescriptor> operations)
+{
+    QMetaObject::invokeMethod(&m_worker_context, [this, index, ops = std::move(operations),
+                                                  generation = m_generation.load(std::memory_order_relaxed)]() mutable {
+        if (generation != m_generation.load(std::memory_order_relaxed)
+            || index < 0 || index >= static_cast<int>(m_entries.size())) {
+            return;
+        }
+        m_entries[index].operations = std::move(ops);
+        doRenderCell(index, generation);
+    }, Qt::QueuedConnection);
+}
+
+void SurveyController::doLoadImages(std::vector<std::string> paths, std::uint64_t generation)
+{
+    if (generation != m_generation.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    m_entries.clear();
+    m_entries.resize(paths.size());
+
+    for (std::size_t index = 0; index < paths.size(); ++index) {
+        // A newer set was requested: its load replaces this one
+        if (generation != m_generation.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        Entry& entry = m_entries[index];
+        entry.path = std::move(paths[index]);
+
+        // The same file twice: a virtual copy shares the decode of the first one
+        const auto end = m_entries.begin() + static_cast<std::ptrdiff_t>(index);
+        const auto first = std::find_if(m_entries.begin(), end,
+                                        [&entry](const Entry& other) { return other.engine && other.path == entry.path; });
+        if (first != end) {
+            if (auto copy = first->engine->createVirtualCopy()) {
+                entry.engine = std::move(*copy);
+            }
+        }
+
+        if (!entry.engine) {
+            auto engine = std::make_unique<Core::Engine::PhotoEngine>(m_scheduler);
+            if (auto loaded = engine->loadImage(entry.path); !loaded) {
+                spdlog::error("[SurveyController::doLoadImages]: Failed to load '{}'", entry.path);
+                QMetaObject::invokeMethod(this, [this, index = static_cast<int>(index), path = QString::fromStdString(entry.path)]() {
+                    emit imageLoadFailed(index, path);
+                }, Qt::QueuedConnection);
+                continue;
+            }
+            entry.engine = std::move(engine);
+        }
+
+        doRenderCell(static_cast<int>(index), generation);
+    }
+
+    spdlog::info("[SurveyController::doLoadImages]: {} image(s) surveyed", m_entries.size());
+}
+
+void SurveyController::doRenderCell(int index, std::uint64_t generation)
+{
+    const int long_edge { m_cell_long_edge.load(std::memory_order_relaxed) };
+    if (long_edge <= 0 || generation != m_generation.load(std::memory_order_relaxed)) {
+        return;  // Rendered once the item is laid out (cellLongEdgeChanged)
+    }
+
+    Entry& entry = m_entries[index];
+    if (!entry.engine) {
+        return;
+    }
+
+    // One variant: the image under its own edit stack, reduced to the cell
+    auto operations = entry.operations;
+    auto rendered = entry.engine->renderVariants(std::move(operations), { Core::Operations::ParameterSnapshot{} },
+                                                 static_cast<Core::Common::ImageDim>(long_edge)).get();
+    if (!rendered || rendered->empty()) {
+        spdlog::warn("[SurveyController::doRenderCell]: Cell {} ('{}') could not be rendered", index, entry.path);
+        return;
+    }
+
+    // The shared holder keeps the queued functor copyable
+    QMetaObject::invokeMethod(this, [this, index, generation,
+                                     holder = std::make_shared<Core::Common::ImageRegion>(std::move(rendered->front()))]() {
+        if (m_survey_item && generation == m_generation.load(std::memory_order_relaxed)) {
+            m_survey_item->setCellImage(index, std::make_unique<Core::Common::ImageRegion>(std::move(*holder)));
+        }
+    }, Qt::QueuedConnection);
+}
+
+void SurveyController::doRenderAll(std::uint64_t generation)
+{
+    for (int index = 0; index < static_cast<int>(m_entries.size()); ++index) {
+        doRenderCell(index, generation);
+    }
+}
+
+} // namespace CaptureMoment::UI::Controller
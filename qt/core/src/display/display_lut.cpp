@@ -0,0 +1,134 @@
+/**
+ * @file display_lut.cpp
+ * @brief Implementation of DisplayLut
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "display/display_lut.h"
+
+#include <OpenImageIO/color.h>
+#include <spdlog/spdlog.h>
+#include <QColorSpace>
+#include <QColorTransform>
+#include <QFile>
+#include <QRgbaFloat>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace CaptureMoment::UI::Display {
+
+namespace {
+
+/**
+ * @brief Allocates a cube whose entries hold the sRGB-encoded grid coordinates (alpha 1).
+ */
+std::shared_ptr<DisplayLut> makeShaperGrid(int size)
+{
+    auto lut { std::make_shared<DisplayLut>() };
+    lut->m_size = std::clamp(size, 2, DisplayLut::k_max_size);
+
+    const int n { lut->m_size };
+    const float step { 1.0f / static_cast<float>(n - 1) };
+    lut->m_rgba.resize(static_cast<std::size_t>(n) * n * n * 4);
+
+    float* entry { lut->m_rgba.data() };
+    for (int b = 0; b < n; ++b) {
+        for (int g = 0; g < n; ++g) {
+            for (int r = 0; r < n; ++r) {
+                entry[0] = static_cast<float>(r) * step;
+                entry[1] = static_cast<float>(g) * step;
+                entry[2] = static_cast<float>(b) * step;
+                entry[3] = 1.0f;
+                entry += 4;
+            }
+        }
+    }
+    return lut;
+}
+
+/**
+ * @brief sRGB EOTF (IEC 61966-2-1): shaper coordinate to linear Rec.709.
+ */
+float srgbDecode(float encoded)
+{
+    return encoded <= 0.04045f ? encoded / 12.92f : std::pow((encoded + 0.055f) / 1.055f, 2.4f);
+}
+
+} // anonymous namespace
+
+std::shared_ptr<const DisplayLut> DisplayLut::fromColorSpace(const QColorSpace& display, int size)
+{
+    if (!display.isValid()) {
+        spdlog::warn("[DisplayLut::fromColorSpace]: Invalid display color space");
+        return nullptr;
+    }
+
+    auto lut { makeShaperGrid(size) };
+    const QColorTransform transform { QColorSpace(QColorSpace::SRgb).transformationToColorSpace(display) };
+
+    for (std::size_t i = 0; i < lut->m_rgba.size(); i += 4) {
+        float* entry { lut->m_rgba.data() + i };
+        const QRgbaFloat32 mapped { transform.map(QRgbaFloat32 { entry[0], entry[1], entry[2], 1.0f }) };
+        entry[0] = mapped.red();
+        entry[1] = mapped.green();
+        entry[2] = mapped.blue();
+    }
+
+    spdlog::info("[DisplayLut::fromColorSpace]: Baked '{}' ({}^3)", display.description().toStdString(), lut->m_size);
+    return lut;
+}
+
+std::shared_ptr<const DisplayLut> DisplayLut::fromIccProfile(const QString& icc_path, int size)
+{
+    QFile file(icc_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        spdlog::warn("[DisplayLut::fromIccProfile]: Cannot open '{}'", icc_path.toStdString());
+        return nullptr;
+    }
+
+    const QColorSpace display { QColorSpace::fromIccProfile(file.readAll()) };
+    if (!display.isValid()) {
+        spdlog::warn("[DisplayLut::fromIccProfile]: '{}' is not a supported ICC profile", icc_path.toStdString());
+        return nullptr;
+    }
+
+    return fromColorSpace(display, size);
+}
+
+std::shared_ptr<const DisplayLut> DisplayLut::fromOcioDisplay(const QString& display, const QString& view, int size)
+{
+    const std::string display_name { display.toStdString() };
+    const std::string view_name { view.toStdString() };
+
+    OIIO::ColorConfig config;
+    const OIIO::ColorProcessorHandle processor { config.createDisplayTransform(
+        OIIO::string_view(display_name), OIIO::string_view(view_name), OIIO::string_view("lin_rec709_scene")) };
+
+    if (!processor) {
+        spdlog::warn("[DisplayLut::fromOcioDisplay]: No OCIO transform for display '{}', view '{}': {}",
+                     display_name, view_name, config.geterror());
+        return nullptr;
+    }
+
+    auto lut { makeShaperGrid(size) };
+
+    // The OCIO transform starts from scene-linear: undo the shaper first
+    for (std::size_t i = 0; i < lut->m_rgba.size(); i += 4) {
+        float* entry { lut->m_rgba.data() + i };
+        entry[0] = srgbDecode(entry[0]);
+        entry[1] = srgbDecode(entry[1]);
+        entry[2] = srgbDecode(entry[2]);
+    }
+
+    const int entries { lut->m_size * lut->m_size * lut->m_size };
+    processor->apply(lut->m_rgba.data(), entries, 1, 4,
+                     sizeof(float), 4 * sizeof(float), static_cast<OIIO::stride_t>(entries) * 4 * sizeof(float));
+
+    spdlog::info("[DisplayLut::fromOcioDisplay]: Baked '{}' / '{}' ({}^3)", display_name, view_name, lut->m_size);
+    return lut;
+}
+
+} // namespace CaptureMoment::UI::Display
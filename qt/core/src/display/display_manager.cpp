@@ -7,9 +7,11 @@
 
 #include "display/display_manager.h"
 #include "rendering/i_rendering_item_base.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
+#include <cmath>
 #include <QScreen>
 
 namespace CaptureMoment::UI::Display {
@@ -18,7 +20,7 @@ DisplayManager::DisplayManager(QObject* parent)
     : QObject(parent)
     , m_viewport_manager(std::make_unique<ViewportManager>())
 {
-    spdlog::debug("[DisplayManager::DisplayManager]: Created");
+    CM_LOG_DEBUG(Render, "[DisplayManager::DisplayManager]: Created");
     initialize();
 }
 
@@ -94,17 +96,20 @@ bool DisplayManager::isInitialized() const noexcept
 void DisplayManager::setRenderingItem(Rendering::IRenderingItemBase* item)
 {
     if (m_rendering_item == item) {
-        spdlog::trace("[DisplayManager::setRenderingItem]: Item is already set, skipping update");
+        CM_LOG_TRACE(Render, "[DisplayManager::setRenderingItem]: Item is already set, skipping update");
         return;
     }
 
-    spdlog::debug("[DisplayManager::setRenderingItem]: Setting new rendering item");
+    CM_LOG_DEBUG(Render, "[DisplayManager::setRenderingItem]: Setting new rendering item");
     m_rendering_item = item;
+    resetPyramid();
 
     if (m_rendering_item) {
-        spdlog::debug("[DisplayManager::setRenderingItem]: Updating zoom and pan on rendering item");
+        CM_LOG_DEBUG(Render, "[DisplayManager::setRenderingItem]: Updating zoom and pan on rendering item");
         m_rendering_item->setZoom(m_zoom);
         m_rendering_item->setPan(m_pan);
+        m_rendering_item->setOverlays(m_overlays);
+        m_rendering_item->setOrientation(m_orientation);
     } else {
         spdlog::warn("[DisplayManager::setRenderingItem]: Rendering item is null");
     }
@@ -141,14 +146,15 @@ void DisplayManager::createDisplayImage(std::unique_ptr<Core::Common::ImageRegio
                           static_cast<float>(m_source_image_size.width());
     }
 
-    spdlog::debug("[DisplayManager::createDisplayImage]: Creating display image: {}x{}, scale={:.3f}",
-                  m_downsample_size.width(), m_downsample_size.height(),
-                  m_display_scale);
+    CM_LOG_DEBUG(Render, "[DisplayManager::createDisplayImage]: Creating display image: {}x{}, scale={:.3f}",
+                         m_downsample_size.width(), m_downsample_size.height(),
+                         m_display_scale);
 
     // =========================================================================
     // Transfer to rendering item
     // =========================================================================
 
+    resetPyramid();
     m_rendering_item->setImage(std::move(source_image));
 
     // =========================================================================
@@ -157,6 +163,40 @@ void DisplayManager::createDisplayImage(std::unique_ptr<Core::Common::ImageRegio
 
     emit displayImageSizeChanged(m_display_image_size);
     emit displayScaleChanged(m_display_scale);
+
+    updateVisibleTiles();
+}
+
+void DisplayManager::createDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> display_image)
+{
+    if (!display_image || (!display_image->isValid() && !display_image->isOnDevice())) {
+        spdlog::warn("[DisplayManager::createDisplayImage]: Invalid display image");
+        return;
+    }
+
+    if (!m_rendering_item) {
+        spdlog::warn("[DisplayManager::createDisplayImage]: No rendering item");
+        return;
+    }
+
+    m_downsample_size = QSize(static_cast<int>(display_image->m_width), static_cast<int>(display_image->m_height));
+
+    if (m_source_image_size.isValid() && m_source_image_size.width() > 0) {
+        m_display_scale = static_cast<float>(m_downsample_size.width()) /
+                          static_cast<float>(m_source_image_size.width());
+    }
+
+    CM_LOG_DEBUG(Render, "[DisplayManager::createDisplayImage]: Creating display image (display-ready): {}x{}, scale={:.3f}",
+                         m_downsample_size.width(), m_downsample_size.height(),
+                         m_display_scale);
+
+    resetPyramid();
+    m_rendering_item->setDisplayImage(std::move(display_image));
+
+    emit displayImageSizeChanged(m_display_image_size);
+    emit displayScaleChanged(m_display_scale);
+
+    updateVisibleTiles();
 }
 
 void DisplayManager::updateDisplayTile(std::unique_ptr<Core::Common::ImageRegion> source_tile)
@@ -171,12 +211,53 @@ void DisplayManager::updateDisplayTile(std::unique_ptr<Core::Common::ImageRegion
         return;
     }
 
-    spdlog::debug("[DisplayManager::updateDisplayTile]: Updating display {}x{}",
-                  m_display_image_size.width(), m_display_image_size.height());
+    CM_LOG_DEBUG(Render, "[DisplayManager::updateDisplayTile]: Updating display {}x{}",
+                         m_display_image_size.width(), m_display_image_size.height());
 
     m_rendering_item->updateTile(std::move(source_tile));
 }
 
+void DisplayManager::setOriginalImage(std::unique_ptr<Core::Common::ImageRegion> original_image)
+{
+    if (!original_image || !original_image->isValid()) {
+        spdlog::warn("[DisplayManager::setOriginalImage]: Invalid original image");
+        return;
+    }
+
+    if (!m_rendering_item) {
+        spdlog::warn("[DisplayManager::setOriginalImage]: No rendering item");
+        return;
+    }
+
+    m_rendering_item->setOriginalImage(std::move(original_image));
+}
+
+void DisplayManager::addDisplayTile(quint64 generation, const TileKey& key,
+                                    std::unique_ptr<Core::Common::ImageRegion> tile)
+{
+    if (!tile || !tile->isValid()) {
+        spdlog::warn("[DisplayManager::addDisplayTile]: Invalid tile");
+        return;
+    }
+
+    if (generation != m_pyramid_generation || !m_resident_tiles.contains(key)) {
+        CM_LOG_TRACE(Render, "[DisplayManager::addDisplayTile]: Dropping stale tile L{} ({}, {})",
+                             key.level, key.x, key.y);
+        return;
+    }
+
+    if (!m_rendering_item) {
+        spdlog::warn("[DisplayManager::addDisplayTile]: No rendering item");
+        return;
+    }
+
+    const QRect source_rect { m_pyramid.tileSourceRect(key) };
+    const QRectF display_rect { source_rect.x() * m_display_scale, source_rect.y() * m_display_scale,
+                                source_rect.width() * m_display_scale, source_rect.height() * m_display_scale };
+
+    m_rendering_item->setPyramidTile(key, display_rect, std::move(tile));
+}
+
 void DisplayManager::setSourceImageSize(int width, int height)
 {
     // =========================================================================
@@ -184,8 +265,10 @@ void DisplayManager::setSourceImageSize(int width, int height)
     // =========================================================================
 
     m_source_image_size = QSize(width, height);
+    m_pyramid.setSourceSize(m_source_image_size);
+    resetPyramid();
 
-    spdlog::debug("[DisplayManager::setSourceImageSize]: Source image size: {}x{}", width, height);
+    CM_LOG_DEBUG(Render, "[DisplayManager::setSourceImageSize]: Source image size: {}x{}", width, height);
 
     // =========================================================================
     // Calculate display parameters via ViewportManager
@@ -218,12 +301,7 @@ void DisplayManager::setSourceImageSize(int width, int height)
             spdlog::info("[DisplayManager::setSourceImageSize]:  Fit zoom: {:.3f}", m_fit_zoom);
             spdlog::info("[DisplayManager::setSourceImageSize]:  Texture memory: {} MB", calc.texture_memory_mb);
 
-            // Request new downsampled image if needed
-            if (calc.needs_downsample) {
-                spdlog::debug("[DisplayManager::setSourceImageSize]: Requesting downsampled image: {}x{}",
-                              m_downsample_size.width(), m_downsample_size.height());
-                emit displayImageRequest(m_downsample_size.width(), m_downsample_size.height());
-            }
+            // No displayImageRequest: the loader downsamples a new source at downsampleSize() itself
         }
     }
 
@@ -235,6 +313,18 @@ void DisplayManager::setSourceImageSize(int width, int height)
     emit displayImageSizeChanged(m_display_image_size);
     emit downsampleSizeChanged(m_downsample_size);
     emit displayScaleChanged(m_display_scale);
+
+    updateVisibleTiles();
+}
+
+void DisplayManager::setSourceOrientation(Core::Common::ImageOrientation orientation)
+{
+    m_orientation = orientation;
+    CM_LOG_DEBUG(Render, "[DisplayManager::setSourceOrientation]: Orientation {}", static_cast<int>(orientation));
+
+    if (m_rendering_item) {
+        m_rendering_item->setOrientation(orientation);
+    }
 }
 
 void DisplayManager::setZoom(float zoom)
@@ -249,7 +339,7 @@ void DisplayManager::setZoom(float zoom)
         return;
     }
 
-    spdlog::debug("[DisplayManager::setZoom]: Zoom: {:.3f} → {:.3f}", m_zoom, clamped_zoom);
+    CM_LOG_DEBUG(Render, "[DisplayManager::setZoom]: Zoom: {:.3f} → {:.3f}", m_zoom, clamped_zoom);
 
     m_zoom = clamped_zoom;
     constrainPan();
@@ -260,23 +350,29 @@ void DisplayManager::setZoom(float zoom)
     }
 
     emit zoomChanged(m_zoom);
+
+    updateVisibleTiles();
 }
 
 void DisplayManager::setPan(const QPointF& pan)
 {
     if (m_pan == pan) {
-        spdlog::trace("[DisplayManager::setPan]: Pan is already set to ({:.3f}, {:.3f}), skipping update", pan.x(), pan.y());
+        CM_LOG_TRACE(Render, "[DisplayManager::setPan]: Pan is already set to ({:.3f}, {:.3f}), skipping update", pan.x(), pan.y());
         return;
     }
 
+    const QPointF previous_pan { m_pan };
     m_pan = pan;
     constrainPan();
+    trackPanVelocity(m_pan - previous_pan);
 
     if (m_rendering_item) {
         m_rendering_item->setPan(m_pan);
     }
 
     emit panChanged(m_pan);
+
+    updateVisibleTiles();
 }
 
 void DisplayManager::zoomAt(const QPointF& point, float zoom_delta)
@@ -298,37 +394,39 @@ void DisplayManager::zoomAt(const QPointF& point, float zoom_delta)
     m_pan = adjusted_pan;
     constrainPan();
 
-    spdlog::debug("[DisplayManager::zoomAt]: Zoom changed from {:.6f} to {:.6f}, pan adjusted to ({:.6f}, {:.6f})",
-                 old_zoom, m_zoom, m_pan.x(), m_pan.y());
+    CM_LOG_DEBUG(Render, "[DisplayManager::zoomAt]: Zoom changed from {:.6f} to {:.6f}, pan adjusted to ({:.6f}, {:.6f})",
+                        old_zoom, m_zoom, m_pan.x(), m_pan.y());
 
     if (m_rendering_item) {
-        spdlog::trace("[DisplayManager::zoomAt]: Updating zoom and pan on rendering item");
+        CM_LOG_TRACE(Render, "[DisplayManager::zoomAt]: Updating zoom and pan on rendering item");
         m_rendering_item->setZoom(m_zoom);
         m_rendering_item->setPan(m_pan);
     }
 
     emit zoomChanged(m_zoom);
     emit panChanged(m_pan);
+
+    updateVisibleTiles();
 }
 
 void DisplayManager::fitToView()
 {
-   spdlog::debug("[DisplayManager::fitToView]: Fitting view to image");
+   CM_LOG_DEBUG(Render, "[DisplayManager::fitToView]: Fitting view to image");
 
-    spdlog::debug("[DisplayManager::fitToView]: m_display_image_size={}x{}, m_source_image_size={}x{}",
-                  m_display_image_size.width(), m_display_image_size.height(),
-                  m_source_image_size.width(), m_source_image_size.height());
+    CM_LOG_DEBUG(Render, "[DisplayManager::fitToView]: m_display_image_size={}x{}, m_source_image_size={}x{}",
+                         m_display_image_size.width(), m_display_image_size.height(),
+                         m_source_image_size.width(), m_source_image_size.height());
 
-    spdlog::debug("[DisplayManager::fitToView]: viewport={}x{}",
-                  m_viewport_manager ? m_viewport_manager->viewportSize().width() : -1,
-                  m_viewport_manager ? m_viewport_manager->viewportSize().height() : -1);
+    CM_LOG_DEBUG(Render, "[DisplayManager::fitToView]: viewport={}x{}",
+                         m_viewport_manager ? m_viewport_manager->viewportSize().width() : -1,
+                         m_viewport_manager ? m_viewport_manager->viewportSize().height() : -1);
 
     bool image_valid { !m_downsample_size.isEmpty() };
     bool viewport_manager_valid { m_viewport_manager != nullptr };
     bool viewport_valid { m_viewport_manager && !m_viewport_manager->viewportSize().isEmpty() };
 
-    spdlog::debug("[DisplayManager::fitToView]: image_valid={}, viewport_manager_valid={}, viewport_valid={}",
-                  image_valid, viewport_manager_valid, viewport_valid);
+    CM_LOG_DEBUG(Render, "[DisplayManager::fitToView]: image_valid={}, viewport_manager_valid={}, viewport_valid={}",
+                         image_valid, viewport_manager_valid, viewport_valid);
 
     if (!image_valid || !viewport_manager_valid || !viewport_valid) {
         spdlog::warn("[DisplayManager::fitToView]: Image size or viewport is empty, using defaults");
@@ -336,40 +434,43 @@ void DisplayManager::fitToView()
         m_pan = QPointF(0.0, 0.0);
     } else {
         const QSize viewport { m_viewport_manager->viewportSize() };
+        const QSize upright { uprightSize(m_downsample_size) };
 
         // ============================================================
         // Calculate zoom to fit downsampled image in viewport
         // ============================================================
-        const float zoom_x = static_cast<float>(viewport.width()) / m_downsample_size.width();
-        const float zoom_y = static_cast<float>(viewport.height()) / m_downsample_size.height();
+        const float zoom_x = static_cast<float>(viewport.width()) / upright.width();
+        const float zoom_y = static_cast<float>(viewport.height()) / upright.height();
         m_zoom = std::min(zoom_x, zoom_y);
 
         // ============================================================
         // Calculate pan to center the image
         // ============================================================
-        const float image_displayed_width = m_downsample_size.width() * m_zoom;
-        const float image_displayed_height = m_downsample_size.height() * m_zoom;
+        const float image_displayed_width = upright.width() * m_zoom;
+        const float image_displayed_height = upright.height() * m_zoom;
         
         const float pan_x = (viewport.width() - image_displayed_width) / 2.0f;
         const float pan_y = (viewport.height() - image_displayed_height) / 2.0f;
         m_pan = QPointF(pan_x, pan_y);
 
-        spdlog::debug("[DisplayManager::fitToView]: zoom={:.3f}, pan=({:.1f}, {:.1f})",
-                      m_zoom, m_pan.x(), m_pan.y());
+        CM_LOG_DEBUG(Render, "[DisplayManager::fitToView]: zoom={:.3f}, pan=({:.1f}, {:.1f})",
+                             m_zoom, m_pan.x(), m_pan.y());
     }
 
     if (m_rendering_item) {
-        spdlog::trace("[DisplayManager::fitToView]: Updating zoom and pan on rendering item");
+        CM_LOG_TRACE(Render, "[DisplayManager::fitToView]: Updating zoom and pan on rendering item");
         m_rendering_item->setZoom(m_zoom);
         m_rendering_item->setPan(m_pan);
     }
 
     emit zoomChanged(m_zoom);
     emit panChanged(m_pan);
+
+    updateVisibleTiles();
 }
 
 void DisplayManager::resetView() {
-    spdlog::debug("[DisplayManager::resetView]: Resetting view");
+    CM_LOG_DEBUG(Render, "[DisplayManager::resetView]: Resetting view");
     fitToView();
 }
 
@@ -406,22 +507,28 @@ void DisplayManager::setViewportSize(const QSize& size) {
 
     m_viewport_manager->setViewportSize(size);
 
-    // Check if max downsample changed
+    // Check if max downsample changed (it moves by levels, with hysteresis when shrinking)
     const int new_max { m_viewport_manager->maxDownsample() };
     if (new_max != old_max) {
-        spdlog::debug("[DisplayManager::setViewportSize]: Max downsample changed: {} → {}", old_max, new_max);
+        CM_LOG_DEBUG(Render, "[DisplayManager::setViewportSize]: Max downsample changed: {} → {}", old_max, new_max);
         emit maxDownsampleChanged(new_max);
+    }
 
-        // Recalculate display if we have a source image
-        if (m_source_image_size.isValid()) {
-            ViewportCalculation calc = m_viewport_manager->calculateDisplay(m_source_image_size);
+    // Recalculate display if we have a source image
+    if (m_source_image_size.isValid() && isInitialized()) {
+        ViewportCalculation calc = m_viewport_manager->calculateDisplay(m_source_image_size);
 
-            if (calc.isValid() && calc.downsample_size != m_downsample_size) {
+        if (calc.isValid()) {
+            // The current texture is scaled to the new display size on the GPU...
+            if (calc.display_size != m_display_image_size) {
                 m_display_image_size = calc.display_size;
-                m_downsample_size = calc.downsample_size;
                 m_fit_zoom = calc.fit_zoom;
-
                 emit displayImageSizeChanged(m_display_image_size);
+            }
+
+            // ... and a new downsample is only requested when the level changed
+            if (calc.downsample_size != m_downsample_size) {
+                m_downsample_size = calc.downsample_size;
                 emit downsampleSizeChanged(m_downsample_size);
                 emit displayImageRequest(m_downsample_size.width(), m_downsample_size.height());
             }
@@ -430,6 +537,7 @@ void DisplayManager::setViewportSize(const QSize& size) {
 
     if (old_viewport != size) {
         emit viewportSizeChanged(size);
+        updateVisibleTiles();
     }
 }
 
@@ -448,6 +556,43 @@ void DisplayManager::setQualityMargin(float margin)
         emit maxDownsampleChanged(new_max);
     }
 }
+
+// =============================================================================
+// Overlays
+// =============================================================================
+void DisplayManager::setClippingWarning(bool enabled)
+{
+    if (m_overlays.m_clipping != enabled) {
+        m_overlays.m_clipping = enabled;
+        applyOverlays();
+    }
+}
+
+void DisplayManager::setFocusPeaking(bool enabled)
+{
+    if (m_overlays.m_focus_peaking != enabled) {
+        m_overlays.m_focus_peaking = enabled;
+        applyOverlays();
+    }
+}
+
+void DisplayManager::setPeakingThreshold(float threshold)
+{
+    threshold = std::clamp(threshold, 0.05f, 2.0f);
+    if (!qFuzzyCompare(m_overlays.m_peaking_threshold, threshold)) {
+        m_overlays.m_peaking_threshold = threshold;
+        applyOverlays();
+    }
+}
+
+void DisplayManager::applyOverlays()
+{
+    if (m_rendering_item) {
+        m_rendering_item->setOverlays(m_overlays);
+    }
+    emit overlaysChanged();
+}
+
 // =============================================================================
 // Coordinate Mapping
 // =============================================================================
@@ -473,7 +618,7 @@ QPoint DisplayManager::mapDisplayToBackend(float display_x, float display_y) con
 void DisplayManager::constrainPan()
 {
     if (m_display_image_size.isEmpty()) {
-        spdlog::trace("[DisplayManager::constrainPan]: Display image size is empty, skipping constraint");
+        CM_LOG_TRACE(Render, "[DisplayManager::constrainPan]: Display image size is empty, skipping constraint");
         return;
     }
 
@@ -481,8 +626,9 @@ void DisplayManager::constrainPan()
     const QSize viewport { m_viewport_manager ? m_viewport_manager->viewportSize() : QSize(800, 600) };
 
     // Calculate visible area at current zoom
-    const float visible_width { m_display_image_size.width() * m_zoom };
-    const float visible_height { m_display_image_size.height() * m_zoom };
+    const QSize upright { uprightSize(m_display_image_size) };
+    const float visible_width { upright.width() * m_zoom };
+    const float visible_height { upright.height() * m_zoom };
 
     // Calculate maximum pan in each direction
     const float max_pan_x { std::max(0.0f, (visible_width - viewport.width()) / 2.0f) };
@@ -494,8 +640,191 @@ void DisplayManager::constrainPan()
     m_pan.setY(std::clamp(static_cast<float>(m_pan.y()), -max_pan_y, max_pan_y));
 
     if (m_pan != old_pan) {
-        spdlog::trace("[DisplayManager::constrainPan]: Pan constrained: ({:.1f}, {:.1f}) → ({:.1f}, {:.1f})",
-                      old_pan.x(), old_pan.y(), m_pan.x(), m_pan.y());
+        CM_LOG_TRACE(Render, "[DisplayManager::constrainPan]: Pan constrained: ({:.1f}, {:.1f}) → ({:.1f}, {:.1f})",
+                             old_pan.x(), old_pan.y(), m_pan.x(), m_pan.y());
+    }
+}
+
+QSize DisplayManager::uprightSize(const QSize& size) const
+{
+    const bool turned { m_rendering_item && m_rendering_item->supportsOrientation()
+                        && Core::Common::swapsAxes(m_orientation) };
+    return turned ? size.transposed() : size;
+}
+
+QRectF DisplayManager::storedDisplayRect(const QRectF& upright_rect) const
+{
+    if (!m_rendering_item || !m_rendering_item->supportsOrientation()
+        || m_orientation == Core::Common::ImageOrientation::Normal) {
+        return upright_rect;
+    }
+
+    // The orientations map rectangles to rectangles: two opposite corners are enough
+    const double width { static_cast<double>(m_downsample_size.width()) };
+    const double height { static_cast<double>(m_downsample_size.height()) };
+    const auto [x0, y0] = Core::Common::orientedToStored(m_orientation, upright_rect.left(), upright_rect.top(), width, height);
+    const auto [x1, y1] = Core::Common::orientedToStored(m_orientation, upright_rect.right(), upright_rect.bottom(), width, height);
+    return QRectF(QPointF(std::min(x0, x1), std::min(y0, y1)), QPointF(std::max(x0, x1), std::max(y0, y1)));
+}
+
+void DisplayManager::updateVisibleTiles()
+{
+    if (!m_rendering_item || !m_rendering_item->supportsTilePyramid()) {
+        return;
+    }
+
+    if (m_pyramid.sourceSize().isEmpty() || m_downsample_size.isEmpty() || !m_viewport_manager) {
+        return;
+    }
+
+    // =========================================================================
+    // Pick the level: tiles only help once the downsample is magnified
+    // =========================================================================
+
+    const float magnification { m_zoom * m_display_scale };
+    const int level { TilePyramid::levelFor(1.0f / magnification) };
+
+    if (std::ldexp(1.0f, -level) <= m_display_scale) {
+        if (m_pyramid_level != -1) {
+            CM_LOG_DEBUG(Render, "[DisplayManager::updateVisibleTiles]: Downsample is sufficient, leaving the pyramid");
+            m_pyramid_level = -1;
+            m_rendering_item->setPyramidLevel(-1);
+        }
+        return;
+    }
+
+    if (level != m_pyramid_level) {
+        CM_LOG_DEBUG(Render, "[DisplayManager::updateVisibleTiles]: Pyramid level {} → {}", m_pyramid_level, level);
+        m_pyramid_level = level;
+        m_rendering_item->setPyramidLevel(level);
+    }
+
+    // =========================================================================
+    // Visible area, in source pixels (screen = pan + zoom * display)
+    // =========================================================================
+
+    // The screen shows the upright image: back to the stored frame the tiles are cut from
+    const QSize viewport { m_viewport_manager->viewportSize() };
+    const QRectF upright_display { -m_pan.x() / m_zoom, -m_pan.y() / m_zoom,
+                                   viewport.width() / m_zoom, viewport.height() / m_zoom };
+    const QRectF visible_display { storedDisplayRect(upright_display) };
+    const QRectF visible_source { visible_display.x() / m_display_scale, visible_display.y() / m_display_scale,
+                                  visible_display.width() / m_display_scale, visible_display.height() / m_display_scale };
+
+    std::vector<TileKey> visible { m_pyramid.tilesIntersecting(level, visible_source) };
+    if (visible.size() > TilePyramid::k_max_resident_tiles) {
+        spdlog::warn("[DisplayManager::updateVisibleTiles]: {} visible tiles, keeping {}",
+                     visible.size(), TilePyramid::k_max_resident_tiles);
+        visible.resize(TilePyramid::k_max_resident_tiles);
+    }
+
+    // =========================================================================
+    // Touch the resident tiles, collect the missing ones
+    // =========================================================================
+
+    // Visible tiles carry the current stamp, prefetched ones the stamp just before
+    m_tile_clock += 2;
+    QList<QPoint> missing;
+
+    for (const TileKey& key : visible) {
+        const auto [it, inserted] = m_resident_tiles.try_emplace(key, m_tile_clock);
+        it->second = m_tile_clock;
+        if (inserted) {
+            missing.append(QPoint(key.x, key.y));
+        }
+    }
+
+    // =========================================================================
+    // Pan-ahead: the tiles the extrapolated motion brings into view
+    // =========================================================================
+
+    QList<QPoint> ahead;
+    const QPointF shift { predictedPanShift() };
+
+    if (!shift.isNull() && visible.size() < TilePyramid::k_max_resident_tiles) {
+        // The view moves against the pan: screen pixels to display pixels, then to the stored frame
+        const QRectF ahead_display { storedDisplayRect(upright_display.translated(-shift.x() / m_zoom,
+                                                                                  -shift.y() / m_zoom)) };
+        const QRectF ahead_source { ahead_display.x() / m_display_scale, ahead_display.y() / m_display_scale,
+                                    ahead_display.width() / m_display_scale, ahead_display.height() / m_display_scale };
+
+        std::vector<TileKey> candidates { m_pyramid.tilesIntersecting(level, ahead_source) };
+        const QPointF center { visible_source.center() };
+        const auto distance = [this, &center](const TileKey& key) {
+            const QPointF offset { QRectF(m_pyramid.tileSourceRect(key)).center() - center };
+            return offset.x() * offset.x() + offset.y() * offset.y();
+        };
+        std::ranges::sort(candidates, [&distance](const TileKey& a, const TileKey& b) { return distance(a) < distance(b); });
+
+        const std::size_t budget { std::min(k_max_prefetch_tiles, TilePyramid::k_max_resident_tiles - visible.size()) };
+        for (const TileKey& key : candidates) {
+            if (static_cast<std::size_t>(ahead.size()) >= budget) {
+                break;
+            }
+            const auto [it, inserted] = m_resident_tiles.try_emplace(key, m_tile_clock - 1);
+            it->second = std::max(it->second, m_tile_clock - 1);
+            if (inserted) {
+                ahead.append(QPoint(key.x, key.y));
+            }
+        }
+    }
+
+    // LRU eviction: visible and prefetched tiles carry the newest stamps and are never the oldest
+    while (m_resident_tiles.size() > TilePyramid::k_max_resident_tiles) {
+        const auto oldest = std::min_element(m_resident_tiles.begin(), m_resident_tiles.end(),
+                                             [](const auto& a, const auto& b) { return a.second < b.second; });
+        m_resident_tiles.erase(oldest);
+    }
+
+    if (!missing.isEmpty()) {
+        CM_LOG_DEBUG(Render, "[DisplayManager::updateVisibleTiles]: Requesting {} tiles at level {}", missing.size(), level);
+        emit displayTilesRequest(m_pyramid_generation, level, missing);
+    }
+
+    if (!ahead.isEmpty()) {
+        CM_LOG_TRACE(Render, "[DisplayManager::updateVisibleTiles]: Prefetching {} tiles at level {}, pan shift ({:.0f}, {:.0f})",
+                             ahead.size(), level, shift.x(), shift.y());
+        emit displayTilesPrefetch(m_pyramid_generation, level, ahead);
+    }
+}
+
+void DisplayManager::trackPanVelocity(const QPointF& delta)
+{
+    // A first update, or one after a pause, starts a new gesture without history
+    if (!m_pan_timer.isValid() || m_pan_timer.elapsed() > k_pan_idle_ms) {
+        m_pan_velocity = QPointF(0, 0);
+        m_pan_timer.start();
+        return;
+    }
+
+    const qint64 elapsed_ms { std::max<qint64>(m_pan_timer.restart(), 1) };
+    const QPointF velocity { delta / static_cast<double>(elapsed_ms) };
+    m_pan_velocity = m_pan_velocity * (1.0 - k_pan_smoothing) + velocity * k_pan_smoothing;
+}
+
+QPointF DisplayManager::predictedPanShift() const
+{
+    // Zoom, resize and image changes also update the tiles: only a pan in progress predicts
+    if (!m_pan_timer.isValid() || m_pan_timer.elapsed() > k_pan_idle_ms || !m_viewport_manager) {
+        return {};
+    }
+
+    // At most one viewport ahead
+    const QSize viewport { m_viewport_manager->viewportSize() };
+    const QPointF shift { m_pan_velocity * k_pan_lookahead_ms };
+    return QPointF { std::clamp(shift.x(), -static_cast<double>(viewport.width()), static_cast<double>(viewport.width())),
+                     std::clamp(shift.y(), -static_cast<double>(viewport.height()), static_cast<double>(viewport.height())) };
+}
+
+void DisplayManager::resetPyramid()
+{
+    ++m_pyramid_generation;
+    m_resident_tiles.clear();
+    m_pyramid_level = -1;
+
+    if (m_rendering_item) {
+        m_rendering_item->clearPyramidTiles();
+        m_rendering_item->setPyramidLevel(-1);
     }
 }
 
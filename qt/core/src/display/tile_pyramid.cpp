@@ -0,0 +1,62 @@
+/**
+ * @file tile_pyramid.cpp
+ * @brief Implementation of TilePyramid
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "display/tile_pyramid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CaptureMoment::UI::Display {
+
+int TilePyramid::levelFor(float source_per_screen_pixel) noexcept
+{
+    if (!(source_per_screen_pixel > 1.0f)) {
+        return 0;
+    }
+    return static_cast<int>(std::floor(std::log2(source_per_screen_pixel)));
+}
+
+QRect TilePyramid::tileSourceRect(const TileKey& key) const noexcept
+{
+    const int span { k_tile_size << key.level };
+    const QRect tile(key.x * span, key.y * span, span, span);
+    return tile.intersected(QRect(QPoint(0, 0), m_source_size));
+}
+
+QSize TilePyramid::tilePixelSize(const TileKey& key) const noexcept
+{
+    const QRect source { tileSourceRect(key) };
+    const int scale { 1 << key.level };
+    return QSize((source.width() + scale - 1) / scale, (source.height() + scale - 1) / scale);
+}
+
+std::vector<TileKey> TilePyramid::tilesIntersecting(int level, const QRectF& source_rect) const
+{
+    std::vector<TileKey> tiles;
+
+    const QRectF clipped { source_rect.intersected(QRectF(QPointF(0, 0), QSizeF(m_source_size))) };
+    if (clipped.isEmpty()) {
+        return tiles;
+    }
+
+    const double span { static_cast<double>(k_tile_size << level) };
+    const int first_x { static_cast<int>(std::floor(clipped.left() / span)) };
+    const int first_y { static_cast<int>(std::floor(clipped.top() / span)) };
+    const int last_x { static_cast<int>(std::ceil(clipped.right() / span)) - 1 };
+    const int last_y { static_cast<int>(std::ceil(clipped.bottom() / span)) - 1 };
+
+    tiles.reserve(static_cast<std::size_t>(std::max(0, last_x - first_x + 1))
+                  * static_cast<std::size_t>(std::max(0, last_y - first_y + 1)));
+    for (int y = first_y; y <= last_y; ++y) {
+        for (int x = first_x; x <= last_x; ++x) {
+            tiles.push_back({ level, x, y });
+        }
+    }
+    return tiles;
+}
+
+} // namespace CaptureMoment::UI::Display
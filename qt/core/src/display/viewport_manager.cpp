@@ -6,6 +6,7 @@
  */
 
 #include "display/viewport_manager.h"
+#include "common/logging/log.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
 #include <cmath>
@@ -19,7 +20,7 @@ namespace CaptureMoment::UI::Display {
 ViewportManager::ViewportManager(QObject* parent)
     : QObject(parent)
 {
-    spdlog::debug("[ViewportManager::ViewportManager]: Created");
+    CM_LOG_DEBUG(Render, "[ViewportManager::ViewportManager]: Created");
 }
 
 // =============================================================================
@@ -113,10 +114,10 @@ void ViewportManager::setViewportSize(const QSize& viewport_logical)
         static_cast<int>(std::round(viewport_logical.height() * m_screen.dpr))
     );
     
-    updateMaxDownsample();
+    updateMaxDownsample(true);
     
-    spdlog::debug("[ViewportManager::setViewportSize]: Viewport resized: {}x{}",
-                  m_viewport_logical.width(), m_viewport_logical.height());
+    CM_LOG_DEBUG(Render, "[ViewportManager::setViewportSize]: Viewport resized: {}x{}",
+                         m_viewport_logical.width(), m_viewport_logical.height());
     
     emit viewportSizeChanged(m_viewport_logical);
 }
@@ -129,7 +130,7 @@ void ViewportManager::setQualityMargin(float margin)
         updateMaxDownsample();
     }
     
-    spdlog::debug("[ViewportManager::setQualityMargin]: Quality margin: {:.2f}", m_quality_margin);
+    CM_LOG_DEBUG(Render, "[ViewportManager::setQualityMargin]: Quality margin: {:.2f}", m_quality_margin);
 }
 
 void ViewportManager::setMaxDownsample(int max_dim)
@@ -206,11 +207,11 @@ ViewportCalculation ViewportManager::calculateDisplay(const QSize& source_size)
     // Step 7: Log result (debug only)
     // =========================================================================
     
-    spdlog::debug("[ViewportManager::calculateDisplay]: Display calc: source={}x{}, display={}x{}, downsample={}x{}, fit_zoom={:.3f}",
-                  src_w, src_h,
-                  result.display_size.width(), result.display_size.height(),
-                  result.downsample_size.width(), result.downsample_size.height(),
-                  result.fit_zoom);
+    CM_LOG_DEBUG(Render, "[ViewportManager::calculateDisplay]: Display calc: source={}x{}, display={}x{}, downsample={}x{}, fit_zoom={:.3f}",
+                         src_w, src_h,
+                         result.display_size.width(), result.display_size.height(),
+                         result.downsample_size.width(), result.downsample_size.height(),
+                         result.fit_zoom);
     
     return result;
 }
@@ -270,8 +271,8 @@ QSize ViewportManager::calculateDownsampleSize(const QSize& source_size) const
     // If source is smaller than max, return source unchanged
     
     if (src_w <= m_max_downsample && src_h <= m_max_downsample) {
-        spdlog::trace("[ViewportManager::calculateDownsampleSize]: No downsample needed (source {}x{} <= max {})",
-                      src_w, src_h, m_max_downsample);
+        CM_LOG_TRACE(Render, "[ViewportManager::calculateDownsampleSize]: No downsample needed (source {}x{} <= max {})",
+                             src_w, src_h, m_max_downsample);
         return source_size;
     }
     
@@ -325,7 +326,7 @@ ViewportState ViewportManager::calculateFitToView(const QSize& display_size) con
 // Internal Methods
 // =============================================================================
 
-void ViewportManager::updateMaxDownsample()
+void ViewportManager::updateMaxDownsample(bool hysteresis)
 {
     // =========================================================================
     // Calculate max from viewport physical size with quality margin
@@ -336,20 +337,27 @@ void ViewportManager::updateMaxDownsample()
     const int with_margin = static_cast<int>(std::round(viewport_max * m_quality_margin));
     
     // =========================================================================
-    // Apply plafond (screen-based ceiling)
+    // Snap up to a downsample level, then apply plafond (screen-based ceiling)
     // =========================================================================
-    // max_downsample = min(viewport_physical × margin, plafond)
+    // max_downsample = min(level(viewport_physical × margin), plafond)
     
-    m_max_downsample = std::min(with_margin, m_plafond);
+    const int needed_level = downsampleLevelFor(with_margin);
+    const int needed = downsampleLevelDimension(needed_level, m_plafond);
     
     // =========================================================================
-    // Ensure minimum size
+    // Hysteresis: grow at once, shrink only well below the current level
     // =========================================================================
     
-    m_max_downsample = std::max(m_max_downsample, DisplayConfig::minDisplayDimension());
+    if (hysteresis && needed < m_max_downsample
+        && needed_level + DisplayConfig::downsampleShrinkLevels() > downsampleLevelFor(m_max_downsample)) {
+        CM_LOG_TRACE(Render, "[ViewportManager::updateMaxDownsample]: Keeping {}px (needs {}px)", m_max_downsample, needed);
+        return;
+    }
+    
+    m_max_downsample = std::max(needed, DisplayConfig::minDisplayDimension());
     
-    spdlog::debug("[ViewportManager::updateMaxDownsample]: Max downsample: {}px (viewport={}, plafond={})",
-                  m_max_downsample, with_margin, m_plafond);
+    CM_LOG_DEBUG(Render, "[ViewportManager::updateMaxDownsample]: Max downsample: {}px (viewport={}, plafond={})",
+                         m_max_downsample, with_margin, m_plafond);
     
     emit maxDownsampleChanged(m_max_downsample);
 }
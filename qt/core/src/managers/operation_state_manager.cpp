@@ -9,6 +9,7 @@
 #include "operations/operation_descriptor.h"
 #include <spdlog/spdlog.h>
 #include <algorithm>
+#include <utility>
 
 namespace CaptureMoment::UI::Managers {
 
@@ -23,16 +24,17 @@ void OperationStateManager::addOrUpdateOperation(const Core::Operations::Operati
     spdlog::debug("OperationStateManager::addOrUpdateOperation: Adding/updating operation '{}'.", descriptor.name);
 
     // Find if an operation of the same type already exists
-    auto it = std::find_if(m_active_operations.begin(), m_active_operations.end(),
+    auto& operations = editedOperations();
+    auto it = std::find_if(operations.begin(), operations.end(),
                            [&descriptor](const auto& op) { return op.type == descriptor.type; });
 
-    if (it != m_active_operations.end()) {
+    if (it != operations.end()) {
         // Update existing operation
         *it = descriptor;
         spdlog::debug("OperationStateManager::addOrUpdateOperation: Updated operation '{}'.", descriptor.name);
     } else {
         // Add new operation
-        m_active_operations.push_back(descriptor);
+        operations.push_back(descriptor);
         spdlog::debug("OperationStateManager::addOrUpdateOperation: Added new operation '{}'.", descriptor.name);
     }
 }
@@ -43,10 +45,11 @@ void OperationStateManager::removeOperation(Core::Operations::OperationType type
     spdlog::debug("OperationStateManager::removeOperation: Removing operation type '{}'.", static_cast<int>(type));
 
     // Remove operation of the specified type
-    m_active_operations.erase(
-        std::remove_if(m_active_operations.begin(), m_active_operations.end(),
+    auto& operations = editedOperations();
+    operations.erase(
+        std::remove_if(operations.begin(), operations.end(),
                        [type](const auto& op) { return op.type == type; }),
-        m_active_operations.end()
+        operations.end()
         );
 
     spdlog::debug("OperationStateManager::removeOperation: Operation type '{}' removed (if it existed).", static_cast<int>(type));
@@ -59,10 +62,18 @@ void OperationStateManager::clearAllOperations()
     std::lock_guard lock(m_mutex);
     spdlog::debug("OperationStateManager::clearAllOperations: Clearing all operations.");
 
-    m_active_operations.clear();
+    editedOperations().clear();
     spdlog::debug("OperationStateManager::clearAllOperations: All operations cleared.");
 }
 
+void OperationStateManager::setOperations(std::vector<Core::Operations::OperationDescriptor> operations)
+{
+    std::lock_guard lock(m_mutex);
+    spdlog::debug("OperationStateManager::setOperations: Replacing all operations with {} operation(s).", operations.size());
+
+    editedOperations() = std::move(operations);
+}
+
 std::vector<Core::Operations::OperationDescriptor> OperationStateManager::getActiveOperations() const
 {
     std::lock_guard lock(m_mutex);
@@ -70,4 +81,41 @@ std::vector<Core::Operations::OperationDescriptor> OperationStateManager::getAct
     return m_active_operations;
 }
 
+void OperationStateManager::beginTransaction()
+{
+    std::lock_guard lock(m_mutex);
+    if (m_transaction_depth++ == 0) {
+        m_staged_operations = m_active_operations;
+        spdlog::debug("OperationStateManager::beginTransaction: Staging changes.");
+    }
+}
+
+bool OperationStateManager::commitTransaction()
+{
+    std::lock_guard lock(m_mutex);
+    if (m_transaction_depth == 0) {
+        spdlog::warn("OperationStateManager::commitTransaction: No transaction to commit.");
+        return false;
+    }
+    if (--m_transaction_depth > 0) {
+        return false;
+    }
+
+    m_active_operations = std::move(*m_staged_operations);
+    m_staged_operations.reset();
+    spdlog::debug("OperationStateManager::commitTransaction: {} operation(s) installed.", m_active_operations.size());
+    return true;
+}
+
+bool OperationStateManager::isInTransaction() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_transaction_depth > 0;
+}
+
+std::vector<Core::Operations::OperationDescriptor>& OperationStateManager::editedOperations()
+{
+    return m_staged_operations ? *m_staged_operations : m_active_operations;
+}
+
 } // namespace CaptureMoment::UI::Managers
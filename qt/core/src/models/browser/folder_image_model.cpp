@@ -0,0 +1,177 @@
+/**
+ * @file folder_image_model.cpp
+ * @brief Implementation of FolderImageModel
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "models/browser/folder_image_model.h"
+#include "browser/thumbnail_image_provider.h"
+
+#include "catalog/catalog_sync.h"
+
+#include <QCollator>
+#include <QFileInfo>
+#include <QMetaObject>
+#include <QThreadPool>
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+namespace CaptureMoment::UI::Models {
+
+struct FolderImageModel::ListingGuard {
+    /**
+     * @brief Guards `m_model`.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * @brief The model (nullptr once destroyed).
+     */
+    FolderImageModel* m_model{nullptr};
+};
+
+FolderImageModel::FolderImageModel(QObject* parent)
+    : QAbstractListModel(parent)
+    , m_guard(std::make_shared<ListingGuard>())
+{
+    m_guard->m_model = this;
+}
+
+FolderImageModel::~FolderImageModel()
+{
+    std::lock_guard lock(m_guard->m_mutex);
+    m_guard->m_model = nullptr;
+}
+
+int FolderImageModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : count();
+}
+
+QVariant FolderImageModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= count()) {
+        return {};
+    }
+
+    const Entry& entry { m_entries[static_cast<std::size_t>(index.row())] };
+    switch (role) {
+    case PathRole:
+        return entry.m_path;
+    case Qt::DisplayRole:
+    case FileNameRole:
+        return entry.m_file_name;
+    case UrlRole:
+        return QUrl::fromLocalFile(entry.m_path);
+    case ThumbnailRole:
+        return Browser::ThumbnailImageProvider::sourceUrl(entry.m_path);
+    default:
+        return {};
+    }
+}
+
+QHash<int, QByteArray> FolderImageModel::roleNames() const
+{
+    return {
+        { PathRole, "path" },
+        { FileNameRole, "fileName" },
+        { UrlRole, "url" },
+        { ThumbnailRole, "thumbnail" },
+    };
+}
+
+void FolderImageModel::setFolder(const QString& folder)
+{
+    if (folder == m_folder) {
+        return;
+    }
+    m_folder = folder;
+    emit folderChanged();
+    reload();
+}
+
+void FolderImageModel::showFolderOf(const QUrl& file_url)
+{
+    if (file_url.isLocalFile()) {
+        setFolder(QFileInfo(file_url.toLocalFile()).absolutePath());
+    }
+}
+
+void FolderImageModel::reload()
+{
+    const unsigned generation { ++m_generation };
+    if (!m_loading) {
+        m_loading = true;
+        emit loadingChanged();
+    }
+
+    if (m_folder.isEmpty()) {
+        applyListing(generation, {});
+        return;
+    }
+
+    QThreadPool::globalInstance()->start([guard = m_guard, folder = m_folder.toStdString(), generation]() {
+        std::vector<Entry> entries;
+
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it { folder, ec }, end; !ec && it != end; it.increment(ec)) {
+            std::error_code file_ec;
+            if (it->is_regular_file(file_ec) && Core::Catalog::CatalogSync::isImageFile(it->path())) {
+                entries.push_back(Entry { QString::fromStdString(it->path().string()),
+                                          QString::fromStdString(it->path().filename().string()) });
+            }
+        }
+        if (ec) {
+            spdlog::warn("[FolderImageModel::reload]: Cannot list '{}': {}", folder, ec.message());
+        }
+
+        // Natural order: IMG_2.CR3 before IMG_10.CR3
+        QCollator collator;
+        collator.setNumericMode(true);
+        std::ranges::sort(entries, [&collator](const Entry& a, const Entry& b) {
+            return collator.compare(a.m_file_name, b.m_file_name) < 0;
+        });
+
+        std::lock_guard lock(guard->m_mutex);
+        if (auto* model = guard->m_model) {
+            QMetaObject::invokeMethod(model, [model, generation, entries = std::move(entries)]() mutable {
+                model->applyListing(generation, std::move(entries));
+            }, Qt::QueuedConnection);
+        }
+    });
+}
+
+int FolderImageModel::indexOf(const QString& path) const
+{
+    const auto it { std::ranges::find(m_entries, path, &Entry::m_path) };
+    return it != m_entries.end() ? static_cast<int>(it - m_entries.begin()) : -1;
+}
+
+void FolderImageModel::applyListing(unsigned generation, std::vector<Entry> entries)
+{
+    if (generation != m_generation) {
+        return;
+    }
+
+    const int previous_count { count() };
+    beginResetModel();
+    m_entries = std::move(entries);
+    endResetModel();
+
+    spdlog::debug("[FolderImageModel::applyListing]: {} image(s) in '{}'", m_entries.size(), m_folder.toStdString());
+
+    m_loading = false;
+    emit loadingChanged();
+    if (count() != previous_count) {
+        emit countChanged();
+    }
+}
+
+} // namespace CaptureMoment::UI::Models
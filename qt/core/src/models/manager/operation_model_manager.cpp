@@ -42,6 +42,15 @@ bool OperationModelManager::createBasicAdjustmentModels()
     return true;
 }
 
+bool OperationModelManager::commitTransaction() noexcept
+{
+    if (m_transaction_depth == 0) {
+        spdlog::warn("OperationModelManager::commitTransaction: No transaction to commit.");
+        return false;
+    }
+    return --m_transaction_depth == 0;
+}
+
 bool OperationModelManager::registerModelsToQml(QQmlContext* context)
 {
     if (!context) {
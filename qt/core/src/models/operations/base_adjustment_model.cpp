@@ -45,4 +45,16 @@ void BaseAdjustmentModel::setValue(float val)
     }
 }
 
+void BaseAdjustmentModel::beginInteraction()
+{
+    spdlog::trace("BaseAdjustmentModel::beginInteraction: Control {} pressed", name().toStdString());
+    emit interactionStarted();
+}
+
+void BaseAdjustmentModel::endInteraction()
+{
+    spdlog::trace("BaseAdjustmentModel::endInteraction: Control {} released", name().toStdString());
+    emit interactionEnded();
+}
+
 } // namespace CaptureMoment::UI::Models::Operations
@@ -24,7 +24,7 @@ Core::Operations::OperationDescriptor BrightnessModel::getDescriptor() const
     descriptor.type = Core::Operations::OperationType::Brightness;
     descriptor.name = "Brightness (" + std::to_string(static_cast<int>(m_params.value * 100)) + "%)";
     descriptor.enabled = true;
-    descriptor.setParam<float>("value", m_params.value);
+    descriptor.setParam<float>(Core::Operations::ParameterKey::Value, m_params.value);
     return descriptor;
 }
 
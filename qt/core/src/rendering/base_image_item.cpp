@@ -6,6 +6,7 @@
  */
 
 #include "rendering/base_image_item.h"
+#include "common/logging/log.h"
 #include <spdlog/spdlog.h>
 
 namespace CaptureMoment::UI::Rendering {
@@ -13,7 +14,7 @@ namespace CaptureMoment::UI::Rendering {
 // Constructor: Initializes the base item.
 BaseImageItem::BaseImageItem()
 {
-    spdlog::debug("[BaseImageItem::BaseImageItem]: Created");
+    CM_LOG_DEBUG(Render, "[BaseImageItem::BaseImageItem]: Created");
 }
 
 void BaseImageItem::setZoom(float zoom)
@@ -34,22 +35,20 @@ void BaseImageItem::setPan(const QPointF& pan)
 
 bool BaseImageItem::isImageValid() const
 {
-    QMutexLocker lock(&m_image_mutex);
-    return m_full_image && m_full_image->isValid();
+    const FrameHandoff::Size size { m_frames->size() };
+    return size.m_width > 0 && size.m_height > 0;
 }
 
 // Gets the width of the image.
 int BaseImageItem::imageWidth() const
 {
-    QMutexLocker lock(&m_image_mutex);
-    return m_full_image ? static_cast<int>(m_full_image->width()) : 0;
+    return m_frames->size().m_width;
 }
 
 // Gets the height of the image.
 int BaseImageItem::imageHeight() const
 {
-    QMutexLocker lock(&m_image_mutex);
-    return m_full_image ? static_cast<int>(m_full_image->height()) : 0;
+    return m_frames->size().m_height;
 }
 
 } // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,119 @@
+/**
+ * @file frame_handoff.cpp
+ * @brief Implementation of FrameHandoff
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/frame_handoff.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace CaptureMoment::UI::Rendering {
+
+void FrameHandoff::publishImage(std::unique_ptr<Core::Common::ImageRegion> image)
+{
+    const Size size { static_cast<int>(image->width()), static_cast<int>(image->height()) };
+
+    Frame& frame { m_frames.back() };
+    frame.m_image = std::move(image);
+    frame.m_display_image.reset();
+    m_linear = true;
+    publishBack(size);
+}
+
+void FrameHandoff::publishDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image)
+{
+    const Size size { static_cast<int>(image->m_width), static_cast<int>(image->m_height) };
+
+    Frame& frame { m_frames.back() };
+    frame.m_image.reset();
+    frame.m_display_image = std::move(image);
+    m_linear = false;
+    publishBack(size);
+}
+
+bool FrameHandoff::publishTile(std::unique_ptr<Core::Common::ImageRegion> tile)
+{
+    const Size size { m_size.load() };
+    if (!m_linear) {
+        spdlog::warn("[FrameHandoff::publishTile]: No base image");
+        return false;
+    }
+
+    // Same dimensions: a whole new image, nothing to merge
+    if (static_cast<int>(tile->width()) == size.m_width && static_cast<int>(tile->height()) == size.m_height) {
+        publishImage(std::move(tile));
+        return true;
+    }
+
+    if (tile->x() < 0 || tile->y() < 0 ||
+        tile->x() + static_cast<int>(tile->width()) > size.m_width ||
+        tile->y() + static_cast<int>(tile->height()) > size.m_height) {
+        spdlog::warn("[FrameHandoff::publishTile]: Tile out of bounds");
+        return false;
+    }
+
+    QMutexLocker lock(&m_tiles_mutex);
+    m_tiles.push_back({ m_generation, std::move(tile) });
+    return true;
+}
+
+void FrameHandoff::publishBack(Size size)
+{
+    m_frames.back().m_generation = ++m_generation;
+    m_size.store(size);
+    m_frames.publish();
+
+    // The slot handed back holds a frame the consumer is done with: free it now, not on reuse
+    Frame& stale { m_frames.back() };
+    stale.m_image.reset();
+    stale.m_display_image.reset();
+}
+
+FrameHandoff::Update FrameHandoff::take()
+{
+    // Drained before acquiring: every tile taken then belongs to the acquired frame or an older one
+    std::vector<PendingTile> tiles;
+    {
+        QMutexLocker lock(&m_tiles_mutex);
+        tiles.swap(m_tiles);
+    }
+
+    Update update;
+    update.m_replaced = m_frames.acquire();
+
+    Frame& frame { m_frames.front() };
+    for (PendingTile& pending : tiles) {
+        const Core::Common::ImageRegion& tile { *pending.m_tile };
+        if (pending.m_generation != frame.m_generation || !frame.m_image ||
+            tile.channels() != frame.m_image->channels()) {
+            // Queued for an image a newer one replaced
+            continue;
+        }
+
+        Core::Common::ImageRegion& image { *frame.m_image };
+        const std::size_t row_size { tile.width() * tile.channels() };
+        for (std::size_t y = 0; y < tile.height(); ++y) {
+            const float* src { tile.getBuffer().data() + y * row_size };
+            float* dst { image.getBuffer().data() +
+                         ((static_cast<std::size_t>(tile.y()) + y) * image.width() + static_cast<std::size_t>(tile.x())) * image.channels() };
+            std::copy(src, src + row_size, dst);
+        }
+
+        if (!update.m_replaced) {
+            update.m_dirty_regions.emplace_back(tile.x(), tile.y(), static_cast<int>(tile.width()), static_cast<int>(tile.height()));
+        }
+    }
+
+    CM_LOG_DEBUG(Render, "[FrameHandoff::take]: replaced={}, {} tile(s)", update.m_replaced, update.m_dirty_regions.size());
+    return update;
+}
+
+} // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,75 @@
+/**
+ * @file metal_texture_interop.mm
+ * @brief Metal implementation of the zero-copy display texture.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/metal_texture_interop.h"
+
+#include <rhi/qrhi.h>
+#include <spdlog/spdlog.h>
+
+#import <Metal/Metal.h>
+
+namespace CaptureMoment::UI::Rendering::MetalInterop {
+
+bool isAvailable(QRhi* rhi)
+{
+    return rhi && rhi->backend() == QRhi::Metal;
+}
+
+quint64 createTexture(QRhi* rhi, const Core::Common::DisplayImage& image)
+{
+    if (!isAvailable(rhi) || !image.isOnDevice()
+        || image.m_device.m_api != Core::Common::DisplayDeviceBuffer::Api::Metal) {
+        return 0;
+    }
+
+    const auto* handles = static_cast<const QRhiMetalNativeHandles*>(rhi->nativeHandles());
+    id<MTLDevice> device = handles ? (__bridge id<MTLDevice>)handles->dev : nil;
+    id<MTLBuffer> buffer = (__bridge id<MTLBuffer>)reinterpret_cast<void*>(image.m_device.m_native_buffer);
+
+    // The engine must have run on the GPU that renders the window
+    if (!device || !buffer || buffer.device != device) {
+        spdlog::debug("[MetalInterop::createTexture]: Buffer belongs to another device");
+        return 0;
+    }
+
+    const NSUInteger alignment = [device minimumLinearTextureAlignmentForPixelFormat:MTLPixelFormatRGBA8Unorm];
+    const NSUInteger bytes_per_row = image.m_device.m_bytes_per_row;
+    const NSUInteger last_row_end = image.m_device.m_offset + bytes_per_row * (image.m_height - 1) + image.bytesPerLine();
+    if (bytes_per_row % alignment != 0 || image.m_device.m_offset % alignment != 0 || last_row_end > buffer.length) {
+        spdlog::debug("[MetalInterop::createTexture]: Buffer layout cannot back a linear texture");
+        return 0;
+    }
+
+    MTLTextureDescriptor* descriptor =
+        [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA8Unorm
+                                                           width:image.m_width
+                                                          height:image.m_height
+                                                       mipmapped:NO];
+    descriptor.storageMode = buffer.storageMode;
+    descriptor.usage = MTLTextureUsageShaderRead;
+
+    id<MTLTexture> texture = [buffer newTextureWithDescriptor:descriptor
+                                                       offset:image.m_device.m_offset
+                                                  bytesPerRow:bytes_per_row];
+    if (!texture) {
+        spdlog::warn("[MetalInterop::createTexture]: newTextureWithDescriptor failed");
+        return 0;
+    }
+
+    // Ownership goes to the caller (released by releaseTexture)
+    return reinterpret_cast<quint64>((__bridge_retained void*)texture);
+}
+
+void releaseTexture(quint64 texture)
+{
+    if (texture != 0) {
+        id<MTLTexture> released = (__bridge_transfer id<MTLTexture>)reinterpret_cast<void*>(texture);
+        released = nil;
+    }
+}
+
+} // namespace CaptureMoment::UI::Rendering::MetalInterop
@@ -6,6 +6,7 @@
  */
 
 #include "rendering/painted_image_item.h"
+#include "common/logging/log.h"
 #include <spdlog/spdlog.h>
 #include <QPainter>
 #include <QColorSpace>
@@ -17,7 +18,16 @@ namespace CaptureMoment::UI::Rendering {
 PaintedImageItem::PaintedImageItem(QQuickItem* parent)
     : QQuickPaintedItem(parent)
 {
-    spdlog::debug("[PaintedImageItem:aintedImageItem]: Created");
+    // One job at a time: a zoom gesture only needs the latest level
+    m_scale_pool.setMaxThreadCount(1);
+    CM_LOG_DEBUG(Render, "[PaintedImageItem:aintedImageItem]: Created");
+}
+
+PaintedImageItem::~PaintedImageItem()
+{
+    // A running job writes into this item: let it finish before the members go away
+    m_scale_pool.clear();
+    m_scale_pool.waitForDone();
 }
 
 // Sets the full image to be displayed.
@@ -33,10 +43,36 @@ void PaintedImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image
 
     {
         QMutexLocker lock(&m_image_mutex);
-        m_full_image = std::move(image);
-        m_current_qimage = convertImageRegionToQImage(*m_full_image);
+        m_current_qimage = convertImageRegionToQImage(*image);
+    }
+
+    requestScaledImage();
+    onImageChanged();
+}
+
+// Sets a display-ready image: already sRGB RGBA8, so it is wrapped without conversion.
+void PaintedImageItem::setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image)
+{
+    if (!image || !image->isValid()) {
+        spdlog::warn("[PaintedImageItem::setDisplayImage]: Invalid image");
+        return;
+    }
+
+    spdlog::info("[PaintedImageItem::setDisplayImage]: {}x{}", image->m_width, image->m_height);
+
+    {
+        QMutexLocker lock(&m_image_mutex);
+        // Owned copy: the rescale job reads it off-thread, after the display image is gone
+        m_current_qimage = QImage(
+            image->m_data.data(),
+            static_cast<int>(image->m_width),
+            static_cast<int>(image->m_height),
+            static_cast<qsizetype>(image->bytesPerLine()),
+            QImage::Format_RGBA8888
+            ).copy();
     }
 
+    requestScaledImage();
     onImageChanged();
 }
 
@@ -55,11 +91,12 @@ void PaintedImageItem::updateTile(std::unique_ptr<Core::Common::ImageRegion> til
 
         // ALWAYS full replacement - we receive the complete downsampled image
         // The name "updateTile" is misleading; it's always the full display image
-        m_full_image = std::move(tile);
-        m_current_qimage = convertImageRegionToQImage(*m_full_image);
+        m_current_qimage = convertImageRegionToQImage(*tile);
     }
 
-    spdlog::debug("[PaintedImageItem::updateTile]: Replaced with {}x{}", tile_w, tile_h);
+    CM_LOG_DEBUG(Render, "[PaintedImageItem::updateTile]: Replaced with {}x{}", tile_w, tile_h);
+
+    requestScaledImage();
 
     // Thread-safe update - must be called from GUI thread
     QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
@@ -74,6 +111,12 @@ void PaintedImageItem::paint(QPainter* painter)
 
     QMutexLocker lock(&m_image_mutex);
 
+    if (!m_scaled_qimage.isNull() && m_scaled_generation == m_scale_generation) {
+        // Pre-scaled for this zoom: panning is a plain blit
+        painter->drawImage(m_pan, m_scaled_qimage);
+        return;
+    }
+
     painter->save();
     painter->translate(m_pan);
     painter->scale(m_zoom, m_zoom);
@@ -104,15 +147,81 @@ QImage PaintedImageItem::convertImageRegionToQImage(const Core::Common::ImageReg
         .convertToFormat(QImage::Format_RGBA8888);
 }
 
+void PaintedImageItem::requestScaledImage()
+{
+    QImage source;
+    QSize target_size;
+    std::uint64_t generation { 0 };
+
+    {
+        QMutexLocker lock(&m_image_mutex);
+
+        generation = ++m_scale_generation;
+        m_scaled_qimage = QImage();
+
+        if (m_current_qimage.isNull() || qFuzzyCompare(m_zoom, 1.0f)) {
+            return;
+        }
+
+        target_size = QSize(
+            std::max(1, qRound(m_current_qimage.width() * m_zoom)),
+            std::max(1, qRound(m_current_qimage.height() * m_zoom)));
+
+        if (static_cast<qint64>(target_size.width()) * target_size.height() > k_max_scaled_pixels) {
+            CM_LOG_DEBUG(Render, "[PaintedImageItem::requestScaledImage]: {}x{} exceeds the cache budget, drawing scaled",
+                                 target_size.width(), target_size.height());
+            return;
+        }
+
+        // Implicitly shared: the job keeps these pixels alive even if the image is replaced
+        source = m_current_qimage;
+    }
+
+    // Superseded requests that have not started yet are dropped
+    m_scale_pool.clear();
+    m_scale_pool.start([this, source = std::move(source), target_size, generation] {
+        QImage scaled { source.scaled(target_size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation) };
+
+        {
+            QMutexLocker lock(&m_image_mutex);
+            if (generation != m_scale_generation) {
+                return;
+            }
+            m_scaled_qimage = std::move(scaled);
+            m_scaled_generation = generation;
+        }
+
+        QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
+    });
+}
+
 bool PaintedImageItem::isImagePaintValid() const
 {
     QMutexLocker lock(&m_image_mutex);
-    return m_full_image && m_full_image->isValid() && !m_current_qimage.isNull();
+    return !m_current_qimage.isNull();
+}
+
+bool PaintedImageItem::isImageValid() const
+{
+    return isImagePaintValid();
+}
+
+int PaintedImageItem::imageWidth() const
+{
+    QMutexLocker lock(&m_image_mutex);
+    return m_current_qimage.width();
+}
+
+int PaintedImageItem::imageHeight() const
+{
+    QMutexLocker lock(&m_image_mutex);
+    return m_current_qimage.height();
 }
 
 
 void PaintedImageItem::onZoomChanged(float new_zoom)
 {
+    requestScaledImage();
     emit zoomChanged(new_zoom);
     update();
 }
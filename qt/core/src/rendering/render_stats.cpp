@@ -0,0 +1,36 @@
+/**
+ * @file render_stats.cpp
+ * @brief Implementation of RenderStats
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/render_stats.h"
+
+#include <atomic>
+
+namespace CaptureMoment::UI::Rendering {
+
+namespace {
+
+std::atomic<std::uint64_t> g_upload_count { 0 };
+std::atomic<std::int64_t> g_upload_total_ns { 0 };
+
+} // namespace
+
+void RenderStats::recordTextureUpload(std::int64_t duration_ns) noexcept
+{
+    g_upload_total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+    g_upload_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+RenderStats::Uploads RenderStats::takeTextureUploads() noexcept
+{
+    // The two counters are taken separately: an upload racing the take lands in either window
+    Uploads uploads;
+    uploads.m_count = g_upload_count.exchange(0, std::memory_order_relaxed);
+    uploads.m_total_ns = g_upload_total_ns.exchange(0, std::memory_order_relaxed);
+    return uploads;
+}
+
+} // namespace CaptureMoment::UI::Rendering
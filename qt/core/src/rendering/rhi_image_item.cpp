@@ -7,20 +7,34 @@
 
 #include "rendering/rhi_image_item.h"
 #include "rendering/rhi_image_item_renderer.h"
+#include "common/logging/log.h"
 #include <spdlog/spdlog.h>
 #include <QMutexLocker>
+#include <QQuickWindow>
+#include <QScreen>
+#include <algorithm>
 
 namespace CaptureMoment::UI::Rendering {
 
 RHIImageItem::RHIImageItem(QQuickItem* parent)
     : QQuickRhiItem(parent)
 {
-    spdlog::debug("[RHIImageItem::RHIImageItem]: Created");
+    // An 8-bit color buffer would clamp the output before an HDR swapchain sees it
+    if (hdrSwapChainRequested()) {
+        setColorBufferFormat(TextureFormat::RGBA16F);
+    }
+
+    CM_LOG_DEBUG(Render, "[RHIImageItem::RHIImageItem]: Created");
+}
+
+bool RHIImageItem::hdrSwapChainRequested()
+{
+    return !qEnvironmentVariableIsEmpty("QSG_RHI_HDR");
 }
 
 RHIImageItem::~RHIImageItem()
 {
-    spdlog::debug("[RHIImageItem::~RHIImageItem]: Destroyed");
+    CM_LOG_DEBUG(Render, "[RHIImageItem::~RHIImageItem]: Destroyed");
 }
 
 void RHIImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image)
@@ -32,12 +46,22 @@ void RHIImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image)
 
     spdlog::info("[RHIImageItem::setImage]: {}x{}", image->width(), image->height());
 
-    {
-        QMutexLocker lock(&m_image_mutex);
-        m_full_image = std::move(image);
-        m_texture_needs_update = true;
+    m_frames->publishImage(std::move(image));
+
+    onImageChanged();
+}
+
+void RHIImageItem::setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image)
+{
+    if (!image || (!image->isValid() && !image->isOnDevice())) {
+        spdlog::warn("[RHIImageItem::setDisplayImage]: Invalid image");
+        return;
     }
 
+    spdlog::info("[RHIImageItem::setDisplayImage]: {}x{}", image->m_width, image->m_height);
+
+    m_frames->publishDisplayImage(std::move(image));
+
     onImageChanged();
 }
 
@@ -48,47 +72,182 @@ void RHIImageItem::updateTile(std::unique_ptr<Core::Common::ImageRegion> tile)
         return;
     }
 
+    const int tile_x { tile->x() };
+    const int tile_y { tile->y() };
+
+    // Merged and staged by the renderer, O(tile): the full-size case is published as a new image
+    if (!m_frames->publishTile(std::move(tile))) {
+        return;
+    }
+
+    CM_LOG_DEBUG(Render, "[RHIImageItem::updateTile]: Queued tile at ({}, {})", tile_x, tile_y);
+    update();
+}
+
+void RHIImageItem::setPyramidTile(const Display::TileKey& key, const QRectF& display_rect,
+                                  std::unique_ptr<Core::Common::ImageRegion> tile)
+{
+    if (!tile || !tile->isValid()) {
+        spdlog::warn("[RHIImageItem::setPyramidTile]: Invalid tile");
+        return;
+    }
+
     {
         QMutexLocker lock(&m_image_mutex);
+        m_pyramid_updates.push_back({ key, display_rect, std::move(tile) });
+    }
+
+    update();
+}
 
-        if (!m_full_image) {
-            spdlog::warn("[RHIImageItem::updateTile]: No base image");
+void RHIImageItem::setPyramidLevel(int level)
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (m_pyramid_level == level) {
             return;
         }
+        m_pyramid_level = level;
+    }
 
-        // Full replacement if same dimensions
-        if (tile->width() == m_full_image->width() &&
-            tile->height() == m_full_image->height()) {
-            m_full_image = std::move(tile);
-            spdlog::debug("[RHIImageItem::updateTile]: Full replacement");
-        } else {
-            // Partial copy by row (optimized)
-            const size_t row_size = tile->width() * tile->channels();
-            for (int y = 0; y < tile->height(); ++y) {
-                const float* src = tile->getBuffer().data() + y * row_size;
-                float* dst = m_full_image->getBuffer().data() +
-                    ((tile->y() + y) * m_full_image->width() + tile->x()) * m_full_image->channels();
-                std::copy(src, src + row_size, dst);
-            }
-            spdlog::debug("[RHIImageItem::updateTile]: Partial at ({}, {})", tile->x(), tile->y());
+    update();
+}
+
+void RHIImageItem::clearPyramidTiles()
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        m_pyramid_updates.clear();
+        m_pyramid_cleared = true;
+    }
+
+    update();
+}
+
+void RHIImageItem::setExposurePreview(float ev)
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (qFuzzyCompare(m_exposure_preview, ev)) {
+            return;
         }
+        m_exposure_preview = ev;
+    }
+
+    emit exposurePreviewChanged(ev);
+    update();
+}
+
+float RHIImageItem::exposurePreview() const
+{
+    QMutexLocker lock(&m_image_mutex);
+    return m_exposure_preview;
+}
 
-        m_texture_needs_update = true;
+void RHIImageItem::setDisplayP3(bool enabled)
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (m_display_p3 == enabled) {
+            return;
+        }
+        m_display_p3 = enabled;
     }
 
+    emit displayP3Changed(enabled);
     update();
 }
 
-bool RHIImageItem::textureNeedsUpdate() const
+bool RHIImageItem::displayP3() const
 {
     QMutexLocker lock(&m_image_mutex);
-    return m_texture_needs_update;
+    return m_display_p3;
+}
+
+void RHIImageItem::setOriginalImage(std::unique_ptr<Core::Common::ImageRegion> image)
+{
+    if (!image || !image->isValid()) {
+        spdlog::warn("[RHIImageItem::setOriginalImage]: Invalid image");
+        return;
+    }
+
+    CM_LOG_DEBUG(Render, "[RHIImageItem::setOriginalImage]: {}x{}", image->width(), image->height());
+
+    {
+        QMutexLocker lock(&m_image_mutex);
+        m_original_image = std::move(image);
+    }
+
+    update();
+}
+
+void RHIImageItem::setCompareSplit(float position)
+{
+    position = std::clamp(position, 0.0f, 1.0f);
+
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (qFuzzyCompare(m_compare_split + 1.0f, position + 1.0f)) {
+            return;
+        }
+        m_compare_split = position;
+    }
+
+    emit compareSplitChanged(position);
+    update();
 }
 
-void RHIImageItem::setTextureNeedsUpdate(bool needs_update)
+float RHIImageItem::compareSplit() const
 {
     QMutexLocker lock(&m_image_mutex);
-    m_texture_needs_update = needs_update;
+    return m_compare_split;
+}
+
+void RHIImageItem::setOverlays(const Display::DisplayOverlays& overlays)
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (m_overlays == overlays) {
+            return;
+        }
+        m_overlays = overlays;
+    }
+
+    update();
+}
+
+void RHIImageItem::setOrientation(Core::Common::ImageOrientation orientation)
+{
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (m_orientation == orientation) {
+            return;
+        }
+        m_orientation = orientation;
+    }
+
+    update();
+}
+
+void RHIImageItem::setDeviceImagesSupported(bool supported)
+{
+    if (m_device_images_supported.exchange(supported, std::memory_order_acq_rel) != supported) {
+        spdlog::info("[RHIImageItem::setDeviceImagesSupported]: Device-resident display images {}",
+                     supported ? "enabled" : "disabled");
+        emit deviceImagesSupportedChanged(supported);
+    }
+}
+
+void RHIImageItem::setHdrOutput(HdrOutput output)
+{
+    const HdrOutput previous { m_hdr_output.exchange(output, std::memory_order_acq_rel) };
+    if (previous != output) {
+        spdlog::info("[RHIImageItem::setHdrOutput]: Output encoding {} → {}",
+                     static_cast<int>(previous), static_cast<int>(output));
+        if ((previous == HdrOutput::Sdr) != (output == HdrOutput::Sdr)) {
+            emit hdrOutputChanged(output != HdrOutput::Sdr);
+        }
+    }
 }
 
 void RHIImageItem::onZoomChanged(float new_zoom)
@@ -114,4 +273,90 @@ QQuickRhiItemRenderer* RHIImageItem::createRenderer()
     return new RHIImageItemRenderer(this);
 }
 
+void RHIImageItem::setScreenDisplayLut(const QString& screen_name, std::shared_ptr<const Display::DisplayLut> lut)
+{
+    if (lut && lut->isValid()) {
+        m_screen_luts.insert(screen_name, std::move(lut));
+    } else {
+        m_screen_luts.remove(screen_name);
+    }
+
+    updateActiveDisplayLut();
+}
+
+bool RHIImageItem::loadScreenIccProfile(const QString& screen_name, const QString& icc_path)
+{
+    auto lut { Display::DisplayLut::fromIccProfile(icc_path) };
+    if (!lut) {
+        return false;
+    }
+
+    setScreenDisplayLut(screen_name, std::move(lut));
+    return true;
+}
+
+bool RHIImageItem::setScreenOcioDisplay(const QString& screen_name, const QString& display, const QString& view)
+{
+    auto lut { Display::DisplayLut::fromOcioDisplay(display, view) };
+    if (!lut) {
+        return false;
+    }
+
+    setScreenDisplayLut(screen_name, std::move(lut));
+    return true;
+}
+
+bool RHIImageItem::hasDisplayLut() const
+{
+    QMutexLocker lock(&m_image_mutex);
+    return static_cast<bool>(m_display_lut);
+}
+
+void RHIImageItem::updateActiveDisplayLut()
+{
+    const QScreen* screen { window() ? window()->screen() : nullptr };
+
+    std::shared_ptr<const Display::DisplayLut> lut;
+    if (screen) {
+        lut = m_screen_luts.value(screen->name());
+    }
+    if (!lut) {
+        lut = m_screen_luts.value(QString());
+    }
+
+    {
+        QMutexLocker lock(&m_image_mutex);
+        if (m_display_lut == lut) {
+            return;
+        }
+        m_display_lut = lut;
+        m_display_lut_dirty = true;
+    }
+
+    spdlog::info("[RHIImageItem::updateActiveDisplayLut]: {} on screen '{}'",
+                 lut ? "Display transform cube" : "Built-in encode",
+                 screen ? screen->name().toStdString() : std::string());
+
+    emit displayLutChanged(static_cast<bool>(lut));
+    update();
+}
+
+void RHIImageItem::itemChange(ItemChange change, const ItemChangeData& value)
+{
+    if (change == ItemSceneChange) {
+        disconnect(m_screen_connection);
+        if (value.window) {
+            // Moving to another monitor swaps the cube on the next frame, nothing is re-baked
+            m_screen_connection = connect(value.window, &QWindow::screenChanged,
+                                          this, &RHIImageItem::updateActiveDisplayLut);
+        }
+    }
+
+    QQuickRhiItem::itemChange(change, value);
+
+    if (change == ItemSceneChange) {
+        updateActiveDisplayLut();
+    }
+}
+
 } // namespace CaptureMoment::UI::Rendering
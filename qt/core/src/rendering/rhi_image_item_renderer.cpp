@@ -7,27 +7,128 @@
 
 #include "rendering/rhi_image_item_renderer.h"
 #include "rendering/rhi_image_item.h"
+#include "rendering/metal_texture_interop.h"
+#include "rendering/render_stats.h"
 #include "common/image_region.h"
+#include "common/display_image.h"
+#include "common/trace/tracer.h"
+#include "common/logging/log.h"
 
 #include <spdlog/spdlog.h>
 #include <QMutexLocker>
 #include <QFile>
 #include <QMatrix4x4>
+#include <QFloat16>
+#include <QQuickWindow>
+#include <QScreen>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace CaptureMoment::UI::Rendering {
 
+namespace {
+
+/**
+ * @brief Layout of the uniform block shared by image_display.vert and image_display.frag (std140).
+ */
+struct DisplayUniforms {
+    float mvp[16];
+    float exposure_gain;     ///< 2^EV, applied to linear data only
+    qint32 source_encoded;   ///< 1: the texture already holds display-encoded sRGB bytes
+    qint32 output_p3;        ///< 1: Rec.709 primaries are mapped to Display P3 before encoding
+    qint32 dither;           ///< 1: noise of +/- half an 8-bit step is added after encoding
+    qint32 display_lut;      ///< 1: the display transform cube replaces the built-in encode
+    float lut_scale;         ///< (N - 1) / N: maps [0, 1] onto the centers of the outer texels
+    float lut_offset;        ///< 0.5 / N
+    float compare_split;     ///< Texture x below which the unedited image is shown, 0 for none
+    qint32 compare_discard;  ///< 1: fragments on the unedited side are discarded (pyramid tiles)
+    qint32 hdr_output;       ///< HdrOutput of the swapchain, 0 for SDR
+    float sdr_white_scale;   ///< Linear value (1.0 = SDR white) to the unit of the HDR encoding
+    float hdr_peak;          ///< Peak luminance of the screen, relative to SDR white
+    qint32 overlays;         ///< Overlay bits: 1 clipping, 2 focus peaking
+    float highlight_clip;    ///< Linear level, relative to the screen's white, of a clipped highlight
+    float shadow_clip;       ///< Linear level of a clipped shadow
+    float peaking_threshold; ///< Sobel magnitude of the encoded luma marking an in-focus edge
+};
+
+static_assert(sizeof(DisplayUniforms) == 128, "DisplayUniforms must match the std140 block");
+
+/**
+ * @brief Maps the stored display image, [0, width] x [0, height], onto its upright frame.
+ * @details The affine map sending the stored corners where `storedToOriented` does.
+ */
+[[nodiscard]] QMatrix4x4 orientationMatrix(Core::Common::ImageOrientation orientation, int width, int height)
+{
+    const double w { static_cast<double>(width) };
+    const double h { static_cast<double>(height) };
+    const auto [ox, oy] = Core::Common::storedToOriented(orientation, 0.0, 0.0, w, h);
+    const auto [xx, xy] = Core::Common::storedToOriented(orientation, w, 0.0, w, h);
+    const auto [yx, yy] = Core::Common::storedToOriented(orientation, 0.0, h, w, h);
+    // Unit steps along the stored x and y axes, in the upright frame
+    const float ux { static_cast<float>((xx - ox) / w) };
+    const float uy { static_cast<float>((xy - oy) / w) };
+    const float vx { static_cast<float>((yx - ox) / h) };
+    const float vy { static_cast<float>((yy - oy) / h) };
+    return QMatrix4x4(ux, vx, 0.0f, static_cast<float>(ox),
+                      uy, vy, 0.0f, static_cast<float>(oy),
+                      0.0f, 0.0f, 1.0f, 0.0f,
+                      0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+/**
+ * @brief Fills the display transform part of the uniforms (everything but the matrix).
+ */
+void fillDisplayUniforms(DisplayUniforms& uniforms, float exposure_preview, bool source_encoded,
+                         bool display_p3, const Display::DisplayLut* lut,
+                         HdrOutput hdr_output, float sdr_white_scale, float hdr_peak,
+                         const Display::DisplayOverlays& overlays)
+{
+    uniforms.exposure_gain = std::exp2(exposure_preview);
+    uniforms.source_encoded = source_encoded ? 1 : 0;
+    uniforms.output_p3 = display_p3 ? 1 : 0;
+    uniforms.dither = 1;
+    uniforms.display_lut = lut ? 1 : 0;
+
+    const float size { lut ? static_cast<float>(lut->m_size) : 1.0f };
+    uniforms.lut_scale = (size - 1.0f) / size;
+    uniforms.lut_offset = 0.5f / size;
+
+    uniforms.hdr_output = static_cast<qint32>(hdr_output);
+    uniforms.sdr_white_scale = sdr_white_scale;
+    uniforms.hdr_peak = hdr_peak;
+
+    uniforms.overlays = (overlays.m_clipping ? 1 : 0) | (overlays.m_focus_peaking ? 2 : 0);
+    uniforms.highlight_clip = overlays.m_highlight_clip;
+    uniforms.shadow_clip = overlays.m_shadow_clip;
+    uniforms.peaking_threshold = overlays.m_peaking_threshold;
+}
+
+} // namespace
+
 // =============================================================================
 // Constructor & Destructor
 // =============================================================================
 
 RHIImageItemRenderer::RHIImageItemRenderer(RHIImageItem* item)
     : m_item(item)
+    , m_budget_registration(Core::Common::MemoryBudget::instance().registerConsumer(
+          "RHI display staging",
+          [this] { return m_pixel_data_bytes.load(std::memory_order_relaxed); },
+          [this](std::size_t) {
+              // Render-thread data: freed by the next render(), after its pending upload
+              m_release_pixel_data.store(true, std::memory_order_relaxed);
+              return m_pixel_data_bytes.load(std::memory_order_relaxed);
+          }))
 {
-    spdlog::debug("[RHIImageItemRenderer::RHIImageItemRenderer]: Created");
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::RHIImageItemRenderer]: Created");
 }
 
-RHIImageItemRenderer::~RHIImageItemRenderer() = default;
+RHIImageItemRenderer::~RHIImageItemRenderer()
+{
+    retireDeviceTexture();
+    releaseRetiredDeviceTextures(true);
+}
 
 // =============================================================================
 // QQuickRhiItemRenderer Interface
@@ -44,7 +145,7 @@ void RHIImageItemRenderer::initialize(QRhiCommandBuffer* cb)
         return;
     }
 
-    spdlog::debug("[RHIImageItemRenderer::initialize]: Starting initialization...");
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::initialize]: Starting initialization...");
 
     // Create all GPU resources
     createGeometry(cb);
@@ -61,7 +162,7 @@ void RHIImageItemRenderer::initialize(QRhiCommandBuffer* cb)
 
 void RHIImageItemRenderer::synchronize(QQuickRhiItem* item)
 {
-    spdlog::debug("[RHIImageItemRenderer::synchronize]: Synchronizing...");
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::synchronize]: Synchronizing...");
 
     auto* rhi_item = static_cast<RHIImageItem*>(item);
     if (!rhi_item) {
@@ -75,40 +176,130 @@ void RHIImageItemRenderer::synchronize(QQuickRhiItem* item)
     // Copy display parameters
     m_zoom = rhi_item->zoom();
     m_pan = rhi_item->pan();
+    m_exposure_preview = rhi_item->m_exposure_preview;
+    m_display_p3 = rhi_item->m_display_p3;
+    m_compare_split = rhi_item->m_compare_split;
+    m_overlays = rhi_item->m_overlays;
+    m_orientation = rhi_item->m_orientation;
+    if (rhi_item->m_original_image) {
+        // Staged once per loaded image, uploaded by the next render()
+        const auto& original = *rhi_item->m_original_image;
+        m_original_size = QSize(static_cast<int>(original.width()), static_cast<int>(original.height()));
+        stageRegion(original, QRect(QPoint(0, 0), m_original_size), floatTextureFormat(), m_original_pixel_data);
+        m_original_needs_upload = true;
+        rhi_item->m_original_image.reset();
+    }
+    if (rhi_item->m_display_lut_dirty) {
+        m_display_lut = rhi_item->m_display_lut;
+        m_lut_needs_upload = static_cast<bool>(m_display_lut);
+        rhi_item->m_display_lut_dirty = false;
+    }
+    if (m_initialized) {
+        rhi_item->setDeviceImagesSupported(m_device_images);
+    }
+    updateHdrOutput(*rhi_item);
+
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::synchronize]: zoom={}, pan=({}, {})",
+                         m_zoom, m_pan.x(), m_pan.y());
+
+    // Pyramid tiles: drop the cache when the content changed, then take the queued tiles
+    m_pyramid_level = rhi_item->m_pyramid_level;
+    if (rhi_item->m_pyramid_cleared) {
+        m_pyramid_tiles.clear();
+        rhi_item->m_pyramid_cleared = false;
+    }
+    for (auto& update : rhi_item->m_pyramid_updates) {
+        stagePyramidTile(update.key, update.display_rect, *update.tile);
+    }
+    rhi_item->m_pyramid_updates.clear();
+
+    // Images are taken from the handoff by render(), without this lock
+    if (!m_frames) {
+        m_frames = rhi_item->frameHandoff();
+    }
+}
+
+void RHIImageItemRenderer::takeFrame()
+{
+    if (!m_frames) {
+        return;
+    }
 
-    spdlog::debug("[RHIImageItemRenderer::synchronize]: zoom={}, pan=({}, {})",
-                  m_zoom, m_pan.x(), m_pan.y());
+    const FrameHandoff::Update update { m_frames->take() };
+    const FrameHandoff::Frame& frame { m_frames->current() };
 
-    // Get the current image
-    const auto* image = rhi_item->getFullImage();
+    // Get the current image (display-ready bytes take precedence over float data)
+    const auto* display_image = frame.m_display_image.get();
+    const auto* image = frame.m_image.get();
 
     // Check if texture needs update:
-    // 1. Flag was set by setImage() or updateTile()
+    // 1. A new frame was published by setImage(), setDisplayImage() or a full-size updateTile()
     // 2. Or we have an image but texture dimensions don't match
-    const bool needs_update = rhi_item->m_texture_needs_update;
-    const bool size_mismatch = image && image->isValid() &&
-                               (!m_texture || m_texture->pixelSize() != QSize(image->width(), image->height()));
-
-    if (needs_update || size_mismatch) {
-        if (image && image->isValid()) {
+    const bool size_mismatch = display_image && (display_image->isValid() || display_image->isOnDevice())
+        ? (!m_texture || m_texture->pixelSize() != QSize(static_cast<int>(display_image->m_width), static_cast<int>(display_image->m_height)))
+        : image && image->isValid() &&
+              (!m_texture || m_texture->pixelSize() != QSize(image->width(), image->height()));
+
+    if (update.m_replaced || size_mismatch) {
+        if (display_image && display_image->isOnDevice()) {
+            // Left on the GPU by the engine: sample its buffer in place, nothing to upload
+            if (adoptDeviceImage(*display_image)) {
+                m_image_width = static_cast<int>(display_image->m_width);
+                m_image_height = static_cast<int>(display_image->m_height);
+                m_source_encoded = true;
+                m_pixel_data = QByteArray();
+                m_display_source.reset();
+                m_texture_needs_update = false;
+            } else {
+                // Keep the previous texture; reported to the item by the next synchronize(),
+                // the engine goes back to host images from its next pass
+                spdlog::warn("[RHIImageItemRenderer::takeFrame]: Device image cannot be sampled, disabling device images");
+                m_device_images = false;
+            }
+        } else if (display_image && display_image->isValid()) {
+            m_image_width = static_cast<int>(display_image->m_width);
+            m_image_height = static_cast<int>(display_image->m_height);
+
+            // Already sRGB RGBA8, encoded by the engine: uploaded from the frame itself, no copy,
+            // passed through by the shader
+            m_display_source = frame.m_display_image;
+            m_pixel_data = QByteArray();
+            m_pixel_data_size = QSize(m_image_width, m_image_height);
+            m_source_encoded = true;
+            ensureTexture(QRhiTexture::RGBA8);
+            m_texture_needs_update = true;
+        } else if (image && image->isValid()) {
             m_image_width = static_cast<int>(image->width());
             m_image_height = static_cast<int>(image->height());
 
-            spdlog::debug("[RHIImageItemRenderer::synchronize]: Converting image {}x{}",
-                          m_image_width, m_image_height);
+            CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::takeFrame]: Converting image {}x{}",
+                                 m_image_width, m_image_height);
 
+            m_display_source.reset();
             updateTextureFromImage(*image);
             m_texture_needs_update = true;
         }
-        // Clear the item's flag
-        rhi_item->m_texture_needs_update = false;
+        // The full upload supersedes any pending tile
+        m_pending_regions.clear();
+    } else if (!update.m_dirty_regions.empty() && image && image->isValid() && m_texture && !m_source_encoded) {
+        // Tiles only: stage just the updated sub-rectangles, O(tile) instead of O(image)
+        const QRect bounds(QPoint(0, 0), m_texture->pixelSize());
+        for (const QRect& dirty : update.m_dirty_regions) {
+            const QRect rect = dirty.intersected(bounds);
+            if (rect.isEmpty()) {
+                continue;
+            }
+            PendingRegion& region = m_pending_regions.emplace_back();
+            region.rect = rect;
+            stageRegion(*image, rect, m_texture->format(), region.texels);
+        }
+
+        CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::takeFrame]: Staged {} tile(s)", update.m_dirty_regions.size());
     }
 }
 
 void RHIImageItemRenderer::render(QRhiCommandBuffer* cb)
 {
-    spdlog::error("[RHIImageItemRenderer::render]: RENDER CALLED");
-
     if (!m_initialized || !m_pipeline || !cb) {
         spdlog::warn("[RHIImageItemRenderer::render]: Not ready (initialized={}, pipeline={})",
                      m_initialized, static_cast<bool>(m_pipeline));
@@ -120,30 +311,95 @@ void RHIImageItemRenderer::render(QRhiCommandBuffer* cb)
         return;
     }
 
+    // Device textures replaced in earlier frames are released once no frame samples them
+    releaseRetiredDeviceTextures();
+
+    // Latest image from the item, converted here while the GUI thread runs
+    takeFrame();
+
     // Upload texture data if needed
-    if (m_texture_needs_update && m_texture && !m_pixel_data.empty()) {
+    bool level0_changed = false;
+    if (m_texture_needs_update && m_texture && (m_display_source || !m_pixel_data.isEmpty())) {
+        CM_TRACE_SCOPE("display", "textureUpload");
+        const RenderStats::ScopedUpload upload_timer;
         QRhiResourceUpdateBatch* resourceUpdates = rhi()->nextResourceUpdateBatch();
         if (resourceUpdates) {
-            QRhiTextureSubresourceUploadDescription subresDesc(
-                m_pixel_data.data(),
-                static_cast<quint32>(m_pixel_data.size())
-                );
+            // Shared, not copied: raw display bytes stay alive in m_display_source until the next frame
+            const QByteArray texels { m_display_source
+                ? QByteArray::fromRawData(reinterpret_cast<const char*>(m_display_source->m_data.data()),
+                                          static_cast<qsizetype>(m_display_source->m_data.size()))
+                : m_pixel_data };
+            QRhiTextureSubresourceUploadDescription subresDesc(texels);
 
             QRhiTextureUploadDescription desc(QRhiTextureUploadEntry(0, 0, subresDesc));
             resourceUpdates->uploadTexture(m_texture.get(), desc);
             cb->resourceUpdate(resourceUpdates);
             m_texture_needs_update = false;
+            level0_changed = true;
+
+            CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::render]: Texture uploaded {}x{}",
+                                 m_pixel_data_size.width(), m_pixel_data_size.height());
+        }
+    }
+
+    // Asked back by the memory budget: once uploaded, the texture holds the pixels
+    if (!m_texture_needs_update && m_release_pixel_data.exchange(false, std::memory_order_relaxed)) {
+        m_pixel_data = QByteArray();
+    }
+    m_pixel_data_bytes.store(static_cast<std::size_t>(m_pixel_data.capacity()), std::memory_order_relaxed);
+
+    // Upload updated tiles into their sub-rectangles
+    if (!m_pending_regions.empty() && m_texture) {
+        CM_TRACE_SCOPE("display", "textureUploadRegions");
+        const RenderStats::ScopedUpload upload_timer;
+        QRhiResourceUpdateBatch* resourceUpdates = rhi()->nextResourceUpdateBatch();
+        if (resourceUpdates) {
+            std::vector<QRhiTextureUploadEntry> entries;
+            entries.reserve(m_pending_regions.size());
+
+            for (const PendingRegion& region : m_pending_regions) {
+                QRhiTextureSubresourceUploadDescription subresDesc(region.texels);
+                subresDesc.setDestinationTopLeft(region.rect.topLeft());
+                subresDesc.setSourceSize(region.rect.size());
+                entries.emplace_back(0, 0, subresDesc);
+            }
+
+            QRhiTextureUploadDescription desc;
+            desc.setEntries(entries.cbegin(), entries.cend());
+            resourceUpdates->uploadTexture(m_texture.get(), desc);
+            cb->resourceUpdate(resourceUpdates);
+
+            CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::render]: {} tile(s) uploaded", m_pending_regions.size());
+            m_pending_regions.clear();
+            level0_changed = true;
+        }
+    }
 
-            spdlog::debug("[RHIImageItemRenderer::render]: Texture uploaded {}x{}",
-                          m_pixel_data_size.width(), m_pixel_data_size.height());
+    // Rebuild the mip chain on the GPU: zooming out then samples trilinearly, with no engine work
+    if (level0_changed && m_mipmapped) {
+        QRhiResourceUpdateBatch* resourceUpdates = rhi()->nextResourceUpdateBatch();
+        if (resourceUpdates) {
+            resourceUpdates->generateMips(m_texture.get());
+            cb->resourceUpdate(resourceUpdates);
         }
     }
 
+    // Display transform cube of the current screen
+    if (m_lut_needs_upload) {
+        uploadDisplayLut(cb);
+    }
+
+    // Unedited image of the before/after comparison
+    if (m_original_needs_upload) {
+        uploadOriginalTexture(cb);
+    }
+
     // Build transformation matrix
     // The quad vertices are in [0,1] range, so we scale to image dimensions
     // then apply zoom and pan transformations
     QMatrix4x4 matrix;
     QSize rt_size = renderTarget()->pixelSize();
+    ++m_frame;
 
     // Orthographic projection: (0,0) at top-left, matches Qt Quick coordinate system
     matrix.ortho(0.0f, static_cast<float>(rt_size.width()),
@@ -155,22 +411,38 @@ void RHIImageItemRenderer::render(QRhiCommandBuffer* cb)
     // 3. Apply pan translation
     matrix.translate(static_cast<float>(m_pan.x()), static_cast<float>(m_pan.y()));
     matrix.scale(m_zoom, m_zoom);
+    // 4. Turn the stored frame upright (EXIF orientation): pan and zoom apply to the upright image
+    if (m_orientation != Core::Common::ImageOrientation::Normal && m_image_width > 0 && m_image_height > 0) {
+        matrix *= orientationMatrix(m_orientation, m_image_width, m_image_height);
+    }
+
+    // Display image space to clip space: pyramid tiles are placed from here
+    const QMatrix4x4 display_to_clip = matrix;
     matrix.scale(static_cast<float>(m_image_width), static_cast<float>(m_image_height));
 
 
-    spdlog::debug("[RHIImageItemRenderer::render]: image={}x{}, zoom={}, pan=({}, {}), viewport={}x{}",
-                  m_image_width, m_image_height, m_zoom, m_pan.x(), m_pan.y(),
-                  rt_size.width(), rt_size.height());
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::render]: image={}x{}, zoom={}, pan=({}, {}), viewport={}x{}",
+                         m_image_width, m_image_height, m_zoom, m_pan.x(), m_pan.y(),
+                         rt_size.width(), rt_size.height());
 
-    // Update uniform buffer
+    // Update uniform buffer: transform + display transform parameters for the fragment shader
     if (m_uniform_buffer) {
         QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
         if (batch) {
-            batch->updateDynamicBuffer(m_uniform_buffer.get(), 0, 64, matrix.constData());
+            DisplayUniforms uniforms {};
+            std::memcpy(uniforms.mvp, matrix.constData(), sizeof(uniforms.mvp));
+            fillDisplayUniforms(uniforms, m_exposure_preview, m_source_encoded, m_display_p3, m_display_lut.get(),
+                                m_hdr_output, m_sdr_white_scale, m_hdr_peak, m_overlays);
+            uniforms.compare_split = m_has_original ? m_compare_split : 0.0f;
+
+            batch->updateDynamicBuffer(m_uniform_buffer.get(), 0, sizeof(uniforms), &uniforms);
             cb->resourceUpdate(batch);
         }
     }
 
+    // Full-detail tiles of the current pyramid level that reach the screen
+    const std::vector<PyramidTile*> visible_tiles = preparePyramidTiles(cb, display_to_clip);
+
     // Begin render pass - use dark gray background to distinguish from rendering issues
     cb->beginPass(renderTarget(), QColor(30, 30, 30, 255), {1.0f, 0});
 
@@ -190,6 +462,12 @@ void RHIImageItemRenderer::render(QRhiCommandBuffer* cb)
     // Draw quad (6 indices for 2 triangles)
     cb->drawIndexed(6);
 
+    // Draw the pyramid tiles over it, same quad and pipeline, one binding set per tile
+    for (const PyramidTile* tile : visible_tiles) {
+        cb->setShaderResources(tile->srb.get());
+        cb->drawIndexed(6);
+    }
+
     cb->endPass();
 }
 
@@ -270,7 +548,7 @@ void RHIImageItemRenderer::createGeometry(QRhiCommandBuffer* cb)
             batch->uploadStaticBuffer(m_vertex_buffer.get(), vertices);
             batch->uploadStaticBuffer(m_index_buffer.get(), indices);
             cb->resourceUpdate(batch);
-            spdlog::debug("[RHIImageItemRenderer::createGeometry]: Geometry buffers uploaded");
+            CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::createGeometry]: Geometry buffers uploaded");
         } else {
             spdlog::error("[RHIImageItemRenderer::createGeometry]: Failed to get resource update batch");
         }
@@ -310,13 +588,19 @@ void RHIImageItemRenderer::createPipeline()
         return;
     }
 
-    spdlog::debug("[RHIImageItemRenderer::createPipeline]: Shaders loaded successfully");
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::createPipeline]: Shaders loaded successfully");
+
+    // Mip chains are generated after each upload when the backend can do it on the GPU
+    m_mipmapped = rhi()->isFeatureSupported(QRhi::MipMapGeneration);
 
-    // Create texture sampler
+    // Engine buffers left on the GPU can be sampled in place (Metal only)
+    m_device_images = MetalInterop::isAvailable(rhi());
+
+    // Create texture sampler (trilinear when mipmapped)
     m_sampler.reset(rhi()->newSampler(
         QRhiSampler::Linear,      // mag filter
         QRhiSampler::Linear,      // min filter
-        QRhiSampler::None,        // mipmap mode
+        m_mipmapped ? QRhiSampler::Linear : QRhiSampler::None,  // mipmap mode
         QRhiSampler::ClampToEdge, // address U
         QRhiSampler::ClampToEdge  // address V
         ));
@@ -326,6 +610,37 @@ void RHIImageItemRenderer::createPipeline()
         return;
     }
 
+    // Display transform cube: trilinear between grid points, never mipmapped
+    m_lut_sampler.reset(rhi()->newSampler(
+        QRhiSampler::Linear,
+        QRhiSampler::Linear,
+        QRhiSampler::None,
+        QRhiSampler::ClampToEdge,
+        QRhiSampler::ClampToEdge,
+        QRhiSampler::ClampToEdge
+        ));
+
+    if (!m_lut_sampler->create()) {
+        spdlog::error("[RHIImageItemRenderer::createPipeline]: Failed to create LUT sampler");
+        return;
+    }
+
+    // Placeholder cube (2x2x2, never sampled while no display transform is set)
+    m_lut_texture.reset(rhi()->newTexture(floatTextureFormat(), 2, 2, 2, 1, QRhiTexture::ThreeDimensional));
+
+    if (!m_lut_texture->create()) {
+        spdlog::error("[RHIImageItemRenderer::createPipeline]: Failed to create placeholder LUT texture");
+        return;
+    }
+
+    // Placeholder original (1x1, never sampled until an original image is set)
+    m_original_texture.reset(rhi()->newTexture(QRhiTexture::RGBA8, QSize(1, 1)));
+
+    if (!m_original_texture->create()) {
+        spdlog::error("[RHIImageItemRenderer::createPipeline]: Failed to create placeholder original texture");
+        return;
+    }
+
     // Create placeholder texture (1x1, will be replaced when image is loaded)
     m_texture.reset(rhi()->newTexture(QRhiTexture::RGBA8, QSize(1, 1)));
 
@@ -350,10 +665,24 @@ void RHIImageItemRenderer::createPipeline()
             QRhiShaderResourceBinding::FragmentStage,
             m_texture.get(),
             m_sampler.get()
+            ),
+        // Binding 2: Display transform cube (fragment stage only)
+        QRhiShaderResourceBinding::sampledTexture(
+            2,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_lut_texture.get(),
+            m_lut_sampler.get()
+            ),
+        // Binding 3: Unedited image of the before/after comparison (fragment stage only)
+        QRhiShaderResourceBinding::sampledTexture(
+            3,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_original_texture.get(),
+            m_sampler.get()
             )
     };
 
-    m_srb->setBindings(bindings, bindings + 2);
+    m_srb->setBindings(bindings, bindings + 4);
 
     if (!m_srb->create()) {
         spdlog::error("[RHIImageItemRenderer::createPipeline]: Failed to create shader resource bindings");
@@ -408,7 +737,7 @@ void RHIImageItemRenderer::createPipeline()
         return;
     }
 
-    spdlog::debug("[RHIImageItemRenderer::createPipeline]: Pipeline created successfully");
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::createPipeline]: Pipeline created successfully");
 }
 
 void RHIImageItemRenderer::updateTextureFromImage(const Core::Common::ImageRegion& image)
@@ -416,63 +745,480 @@ void RHIImageItemRenderer::updateTextureFromImage(const Core::Common::ImageRegio
     const int w = static_cast<int>(image.width());
     const int h = static_cast<int>(image.height());
 
-    spdlog::debug("[RHIImageItemRenderer::updateTextureFromImage]: Converting {}x{} (channels: {})",
-                  w, h, image.channels());
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::updateTextureFromImage]: Staging {}x{} (channels: {})",
+                         w, h, image.channels());
+
+    const QRhiTexture::Format format = floatTextureFormat();
 
-    // Resize pixel data buffer (RGBA8 = 4 bytes per pixel)
-    m_pixel_data.resize(static_cast<size_t>(w) * static_cast<size_t>(h) * 4);
     m_pixel_data_size = QSize(w, h);
+    m_source_encoded = false;
+
+    // Linear floats go up as is: exposure, OETF and dithering happen in image_display.frag
+    stageRegion(image, QRect(0, 0, w, h), format, m_pixel_data);
+
+    ensureTexture(format);
+}
+
+void RHIImageItemRenderer::stageRegion(const Core::Common::ImageRegion& image, const QRect& rect,
+                                       QRhiTexture::Format format, QByteArray& texels)
+{
+    CM_TRACE_SCOPE("display", "stageRegion");
+
+    const size_t row_samples = static_cast<size_t>(rect.width()) * 4;
+    const size_t sample_bytes = format == QRhiTexture::RGBA16F ? sizeof(qfloat16) : sizeof(float);
+    const size_t image_width = static_cast<size_t>(image.width());
+
+    texels.resize(static_cast<qsizetype>(row_samples * static_cast<size_t>(rect.height()) * sample_bytes));
+
+    const float* src = image.getBuffer().data()
+        + (static_cast<size_t>(rect.y()) * image_width + static_cast<size_t>(rect.x())) * 4;
+    uint8_t* dst = reinterpret_cast<uint8_t*>(texels.data());
 
-    // Convert from RGBA_F32 (float) to RGBA8 (uint8)
-    const float* src = image.getBuffer().data();
-    uint8_t* dst = m_pixel_data.data();
-    const size_t total_pixels = static_cast<size_t>(w) * static_cast<size_t>(h);
+    // A full-width region is one contiguous run; a tile is packed row by row
+    const bool contiguous = static_cast<size_t>(rect.width()) == image_width;
+    const size_t runs = contiguous ? 1 : static_cast<size_t>(rect.height());
+    const size_t run_samples = contiguous ? row_samples * static_cast<size_t>(rect.height()) : row_samples;
 
-    for (size_t i = 0; i < total_pixels; ++i) {
-        const size_t idx = i * 4;
+    for (size_t run = 0; run < runs; ++run) {
+        if (format == QRhiTexture::RGBA16F) {
+            qFloatToFloat16(reinterpret_cast<qfloat16*>(dst), src, static_cast<qsizetype>(run_samples));
+        } else {
+            std::memcpy(dst, src, run_samples * sizeof(float));
+        }
+        src += image_width * 4;
+        dst += run_samples * sample_bytes;
+    }
+}
+
+void RHIImageItemRenderer::stagePyramidTile(const Display::TileKey& key, const QRectF& display_rect,
+                                            const Core::Common::ImageRegion& tile)
+{
+    const QSize size(static_cast<int>(tile.width()), static_cast<int>(tile.height()));
+
+    PyramidTile& entry = m_pyramid_tiles[key];
+    entry.level = key.level;
+    entry.display_rect = display_rect;
+    entry.size = size;
+    entry.last_used = m_frame;
+    entry.needs_upload = true;
+    stageRegion(tile, QRect(QPoint(0, 0), size), floatTextureFormat(), entry.texels);
+
+    // LRU eviction: the least recently drawn tiles go first
+    while (m_pyramid_tiles.size() > k_max_pyramid_tiles) {
+        const auto oldest = std::min_element(m_pyramid_tiles.begin(), m_pyramid_tiles.end(),
+                                             [](const auto& a, const auto& b) {
+                                                 return a.second.last_used < b.second.last_used;
+                                             });
+        m_pyramid_tiles.erase(oldest);
+    }
+}
 
-        // Clamp to [0,1] range and convert to [0,255]
-        dst[idx + 0] = static_cast<uint8_t>(std::clamp(src[idx + 0], 0.0f, 1.0f) * 255.0f);  // R
-        dst[idx + 1] = static_cast<uint8_t>(std::clamp(src[idx + 1], 0.0f, 1.0f) * 255.0f);  // G
-        dst[idx + 2] = static_cast<uint8_t>(std::clamp(src[idx + 2], 0.0f, 1.0f) * 255.0f);  // B
-        dst[idx + 3] = static_cast<uint8_t>(std::clamp(src[idx + 3], 0.0f, 1.0f) * 255.0f);  // A
+std::vector<RHIImageItemRenderer::PyramidTile*>
+RHIImageItemRenderer::preparePyramidTiles(QRhiCommandBuffer* cb, const QMatrix4x4& display_to_clip)
+{
+    std::vector<PyramidTile*> visible;
+    if (m_pyramid_level < 0 || m_pyramid_tiles.empty() || m_image_width <= 0) {
+        return visible;
+    }
+
+    QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
+    if (!batch) {
+        return visible;
     }
 
-    // Recreate texture if size changed
-    if (!m_texture || m_texture->pixelSize() != m_pixel_data_size) {
-        m_texture.reset(rhi()->newTexture(QRhiTexture::RGBA8, m_pixel_data_size));
+    const QRectF clip_bounds(-1.0, -1.0, 2.0, 2.0);
+    const QRhiTexture::Format format = floatTextureFormat();
+    const double split_x = m_has_original ? static_cast<double>(m_compare_split) * m_image_width : 0.0;
 
-        if (!m_texture->create()) {
-            spdlog::error("[RHIImageItemRenderer::updateTextureFromImage]: Failed to create texture {}x{}",
-                          w, h);
+    for (auto& [key, tile] : m_pyramid_tiles) {
+        if (tile.level != m_pyramid_level) {
+            continue;
+        }
+
+        // Skip tiles outside the render target (they stay cached for the next pan)
+        const QRectF clip_rect = display_to_clip.mapRect(tile.display_rect).normalized();
+        if (!clip_rect.intersects(clip_bounds)) {
+            continue;
+        }
+
+        // Tiles entirely on the unedited side of the before/after split would be discarded
+        if (split_x >= tile.display_rect.right()) {
+            continue;
+        }
+
+        if (!tile.texture || tile.texture->pixelSize() != tile.size) {
+            tile.texture.reset(rhi()->newTexture(format, tile.size));
+            tile.uniforms.reset(rhi()->newBuffer(QRhiBuffer::Dynamic, QRhiBuffer::UniformBuffer, 256));
+            tile.srb.reset();
+            if (!tile.texture->create() || !tile.uniforms->create()) {
+                spdlog::error("[RHIImageItemRenderer::preparePyramidTiles]: Failed to create tile ({}, {}, {})",
+                              key.level, key.x, key.y);
+                tile.texture.reset();
+                continue;
+            }
+            tile.needs_upload = true;
+        }
+
+        // Also rebuilt after the display transform cube was replaced
+        if (!tile.srb && !bindPyramidTile(tile)) {
+            tile.texture.reset();
+            continue;
+        }
+
+        if (tile.needs_upload) {
+            QRhiTextureSubresourceUploadDescription subresDesc(tile.texels);
+            batch->uploadTexture(tile.texture.get(), QRhiTextureUploadDescription(QRhiTextureUploadEntry(0, 0, subresDesc)));
+            tile.needs_upload = false;
+            tile.texels = {};
+        }
+
+        QMatrix4x4 tile_matrix = display_to_clip;
+        tile_matrix.translate(static_cast<float>(tile.display_rect.x()), static_cast<float>(tile.display_rect.y()));
+        tile_matrix.scale(static_cast<float>(tile.display_rect.width()), static_cast<float>(tile.display_rect.height()));
+
+        DisplayUniforms uniforms {};
+        std::memcpy(uniforms.mvp, tile_matrix.constData(), sizeof(uniforms.mvp));
+        fillDisplayUniforms(uniforms, m_exposure_preview, false, m_display_p3, m_display_lut.get(),
+                            m_hdr_output, m_sdr_white_scale, m_hdr_peak, m_overlays);
+        if (split_x > tile.display_rect.left()) {
+            // The split in the tile's own texture coordinates; the display image shows the original there
+            uniforms.compare_split = static_cast<float>((split_x - tile.display_rect.left()) / tile.display_rect.width());
+            uniforms.compare_discard = 1;
+        }
+        batch->updateDynamicBuffer(tile.uniforms.get(), 0, sizeof(uniforms), &uniforms);
+
+        tile.last_used = m_frame;
+        visible.push_back(&tile);
+    }
+
+    cb->resourceUpdate(batch);
+    return visible;
+}
+
+bool RHIImageItemRenderer::bindPyramidTile(PyramidTile& tile)
+{
+    tile.srb.reset(rhi()->newShaderResourceBindings());
+    tile.srb->setBindings({
+        QRhiShaderResourceBinding::uniformBuffer(
+            0,
+            QRhiShaderResourceBinding::VertexStage | QRhiShaderResourceBinding::FragmentStage,
+            tile.uniforms.get()),
+        QRhiShaderResourceBinding::sampledTexture(
+            1,
+            QRhiShaderResourceBinding::FragmentStage,
+            tile.texture.get(),
+            m_sampler.get()),
+        QRhiShaderResourceBinding::sampledTexture(
+            2,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_lut_texture.get(),
+            m_lut_sampler.get()),
+        QRhiShaderResourceBinding::sampledTexture(
+            3,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_original_texture.get(),
+            m_sampler.get())
+    });
+
+    if (!tile.srb->create()) {
+        spdlog::error("[RHIImageItemRenderer::bindPyramidTile]: Failed to create tile SRB");
+        tile.srb.reset();
+        return false;
+    }
+    return true;
+}
+
+void RHIImageItemRenderer::uploadDisplayLut(QRhiCommandBuffer* cb)
+{
+    if (!m_display_lut || !m_display_lut->isValid()) {
+        m_lut_needs_upload = false;
+        return;
+    }
+
+    const int n { m_display_lut->m_size };
+    const QRhiTexture::Format format { floatTextureFormat() };
+
+    // A cube of another size needs a new texture, and every binding set referencing the old one
+    if (!m_lut_texture || m_lut_texture->depth() != n || m_lut_texture->format() != format) {
+        m_lut_texture.reset(rhi()->newTexture(format, n, n, n, 1, QRhiTexture::ThreeDimensional));
+        if (!m_lut_texture->create()) {
+            spdlog::error("[RHIImageItemRenderer::uploadDisplayLut]: Failed to create {}^3 LUT texture", n);
+            m_display_lut.reset();
+            m_lut_needs_upload = false;
+            return;
+        }
+
+        invalidateBindings();
+    }
+
+    QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
+    if (!batch) {
+        return;
+    }
+
+    // One upload entry per depth slice (blue step)
+    const std::size_t slice_samples { static_cast<std::size_t>(n) * n * 4 };
+    const std::size_t sample_bytes { format == QRhiTexture::RGBA16F ? sizeof(qfloat16) : sizeof(float) };
+    std::vector<uint8_t> slice(slice_samples * sample_bytes);
+
+    std::vector<QRhiTextureUploadEntry> entries;
+    entries.reserve(static_cast<std::size_t>(n));
+
+    for (int z = 0; z < n; ++z) {
+        const float* src { m_display_lut->m_rgba.data() + static_cast<std::size_t>(z) * slice_samples };
+        if (format == QRhiTexture::RGBA16F) {
+            qFloatToFloat16(reinterpret_cast<qfloat16*>(slice.data()), src, static_cast<qsizetype>(slice_samples));
+        } else {
+            std::memcpy(slice.data(), src, slice_samples * sizeof(float));
+        }
+        // The description copies the bytes, so the slice buffer is reused
+        entries.emplace_back(z, 0, QRhiTextureSubresourceUploadDescription(slice.data(), static_cast<quint32>(slice.size())));
+    }
+
+    QRhiTextureUploadDescription desc;
+    desc.setEntries(entries.cbegin(), entries.cend());
+    batch->uploadTexture(m_lut_texture.get(), desc);
+    cb->resourceUpdate(batch);
+    m_lut_needs_upload = false;
+
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::uploadDisplayLut]: Display transform cube uploaded ({}^3)", n);
+}
+
+void RHIImageItemRenderer::uploadOriginalTexture(QRhiCommandBuffer* cb)
+{
+    const QRhiTexture::Format format { floatTextureFormat() };
+
+    if (!m_original_texture || m_original_texture->pixelSize() != m_original_size
+        || m_original_texture->format() != format) {
+        const QRhiTexture::Flags flags = m_mipmapped
+            ? QRhiTexture::MipMapped | QRhiTexture::UsedWithGenerateMips
+            : QRhiTexture::Flags {};
+        m_original_texture.reset(rhi()->newTexture(format, m_original_size, 1, flags));
+
+        if (!m_original_texture->create()) {
+            spdlog::error("[RHIImageItemRenderer::uploadOriginalTexture]: Failed to create original texture {}x{}",
+                          m_original_size.width(), m_original_size.height());
+            m_has_original = false;
+            m_original_needs_upload = false;
+            m_original_pixel_data = QByteArray();
             return;
         }
 
-        spdlog::debug("[RHIImageItemRenderer::updateTextureFromImage]: Texture created {}x{}", w, h);
-
-        // Recreate shader resource bindings with new texture
-        m_srb.reset(rhi()->newShaderResourceBindings());
-
-        QRhiShaderResourceBinding bindings[] = {
-            QRhiShaderResourceBinding::uniformBuffer(
-                0,
-                QRhiShaderResourceBinding::VertexStage | QRhiShaderResourceBinding::FragmentStage,
-                m_uniform_buffer.get()
-                ),
-            QRhiShaderResourceBinding::sampledTexture(
-                1,
-                QRhiShaderResourceBinding::FragmentStage,
-                m_texture.get(),
-                m_sampler.get()
-                )
-        };
-
-        m_srb->setBindings(bindings, bindings + 2);
-
-        if (!m_srb->create()) {
-            spdlog::error("[RHIImageItemRenderer::updateTextureFromImage]: Failed to recreate SRB");
+        invalidateBindings();
+    }
+
+    QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
+    if (!batch) {
+        return;
+    }
+
+    QRhiTextureSubresourceUploadDescription subresDesc(m_original_pixel_data);
+    batch->uploadTexture(m_original_texture.get(), QRhiTextureUploadDescription(QRhiTextureUploadEntry(0, 0, subresDesc)));
+    if (m_mipmapped) {
+        batch->generateMips(m_original_texture.get());
+    }
+    cb->resourceUpdate(batch);
+
+    // The texture holds it from now on: the staging copy is not kept (the upload has its own reference)
+    m_original_pixel_data = QByteArray();
+    m_original_needs_upload = false;
+    m_has_original = true;
+
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::uploadOriginalTexture]: Original uploaded {}x{}",
+                         m_original_size.width(), m_original_size.height());
+}
+
+void RHIImageItemRenderer::invalidateBindings()
+{
+    bindTexture();
+    for (auto& [key, tile] : m_pyramid_tiles) {
+        tile.srb.reset();
+    }
+}
+
+void RHIImageItemRenderer::updateHdrOutput(RHIImageItem& item)
+{
+    // Only a float color buffer carries values outside [0, 1] to the swapchain
+    const QQuickWindow* window { item.window() };
+    const QRhiSwapChain* swapchain { window ? window->swapChain() : nullptr };
+    const bool float_buffer { item.colorBufferFormat() == QQuickRhiItem::TextureFormat::RGBA16F
+                              || item.colorBufferFormat() == QQuickRhiItem::TextureFormat::RGBA32F };
+    const QRhiSwapChain::Format format { swapchain && float_buffer ? swapchain->format() : QRhiSwapChain::SDR };
+    const QScreen* screen { window ? window->screen() : nullptr };
+
+    if (format == m_swapchain_format && screen == m_hdr_screen) {
+        return;
+    }
+    m_swapchain_format = format;
+    m_hdr_screen = screen;
+
+    m_hdr_output = HdrOutput::Sdr;
+    m_sdr_white_scale = 1.0f;
+    m_hdr_peak = 1.0f;
+
+    if (format != QRhiSwapChain::SDR) {
+        const QRhiSwapChainHdrInfo info { swapchain->hdrInfo() };
+        const float sdr_white { info.sdrWhiteLevel > 0.0f ? info.sdrWhiteLevel : k_reference_white_nits };
+
+        // Peak relative to SDR white: reported in nits (Windows), or as a component value (macOS EDR)
+        if (info.limitsType == QRhiSwapChainHdrInfo::LuminanceInNits) {
+            m_hdr_peak = std::max(1.0f, info.limits.luminanceInNits.maxLuminance / sdr_white);
+        } else {
+            m_hdr_peak = std::max(1.0f, info.limits.colorComponentValue.maxColorComponentValue);
+        }
+
+        switch (format) {
+        case QRhiSwapChain::HDRExtendedSrgbLinear:
+            m_hdr_output = HdrOutput::ExtendedSrgbLinear;
+            m_sdr_white_scale = sdr_white / k_scrgb_unit_nits;
+            break;
+        case QRhiSwapChain::HDR10:
+            m_hdr_output = HdrOutput::Hdr10;
+            m_sdr_white_scale = sdr_white / 10000.0f;
+            break;
+        case QRhiSwapChain::HDRExtendedDisplayP3Linear:
+            m_hdr_output = HdrOutput::ExtendedDisplayP3Linear;
+            break;
+        default:
+            m_hdr_peak = 1.0f;
+            break;
+        }
+
+        spdlog::info("[RHIImageItemRenderer::updateHdrOutput]: HDR output {} (SDR white {:.0f} nits, peak {:.2f}x)",
+                     static_cast<int>(m_hdr_output), sdr_white, m_hdr_peak);
+    }
+
+    item.setHdrOutput(m_hdr_output);
+}
+
+QRhiTexture::Format RHIImageItemRenderer::floatTextureFormat() const
+{
+    if (rhi()->isTextureFormatSupported(QRhiTexture::RGBA16F)) {
+        return QRhiTexture::RGBA16F;
+    }
+    return QRhiTexture::RGBA32F;
+}
+
+void RHIImageItemRenderer::ensureTexture(QRhiTexture::Format format)
+{
+    const int w = m_pixel_data_size.width();
+    const int h = m_pixel_data_size.height();
+
+    // Recreate texture if size or format changed, or if it aliases an engine buffer
+    if (!m_texture || m_texture->pixelSize() != m_pixel_data_size || m_texture->format() != format
+        || m_device_texture != 0) {
+        retireDeviceTexture();
+
+        const QRhiTexture::Flags flags = m_mipmapped
+            ? QRhiTexture::MipMapped | QRhiTexture::UsedWithGenerateMips
+            : QRhiTexture::Flags {};
+        m_texture.reset(rhi()->newTexture(format, m_pixel_data_size, 1, flags));
+
+        if (!m_texture->create()) {
+            spdlog::error("[RHIImageItemRenderer::ensureTexture]: Failed to create texture {}x{} (format {})",
+                          w, h, static_cast<int>(format));
+            return;
         }
+
+        CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::ensureTexture]: Texture created {}x{} (format {})",
+                             w, h, static_cast<int>(format));
+
+        bindTexture();
+    }
+}
+
+void RHIImageItemRenderer::bindTexture()
+{
+    // Shader resource bindings reference the texture: recreate them around the new one
+    m_srb.reset(rhi()->newShaderResourceBindings());
+
+    QRhiShaderResourceBinding bindings[] = {
+        QRhiShaderResourceBinding::uniformBuffer(
+            0,
+            QRhiShaderResourceBinding::VertexStage | QRhiShaderResourceBinding::FragmentStage,
+            m_uniform_buffer.get()
+            ),
+        QRhiShaderResourceBinding::sampledTexture(
+            1,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_texture.get(),
+            m_sampler.get()
+            ),
+        QRhiShaderResourceBinding::sampledTexture(
+            2,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_lut_texture.get(),
+            m_lut_sampler.get()
+            ),
+        QRhiShaderResourceBinding::sampledTexture(
+            3,
+            QRhiShaderResourceBinding::FragmentStage,
+            m_original_texture.get(),
+            m_sampler.get()
+            )
+    };
+
+    m_srb->setBindings(bindings, bindings + 4);
+
+    if (!m_srb->create()) {
+        spdlog::error("[RHIImageItemRenderer::bindTexture]: Failed to recreate SRB");
+    }
+}
+
+bool RHIImageItemRenderer::adoptDeviceImage(const Core::Common::DisplayImage& image)
+{
+    if (!m_device_images) {
+        return false;
+    }
+
+    const quint64 native = MetalInterop::createTexture(rhi(), image);
+    if (native == 0) {
+        return false;
+    }
+
+    const QSize size(static_cast<int>(image.m_width), static_cast<int>(image.m_height));
+    std::unique_ptr<QRhiTexture> texture(rhi()->newTexture(QRhiTexture::RGBA8, size));
+    if (!texture->createFrom({native, 0})) {
+        spdlog::error("[RHIImageItemRenderer::adoptDeviceImage]: createFrom failed");
+        MetalInterop::releaseTexture(native);
+        return false;
+    }
+
+    // The previous texture may still be sampled by a frame in flight
+    retireDeviceTexture();
+    m_texture = std::move(texture);
+    m_device_texture = native;
+    m_device_keep_alive = image.m_device.m_keep_alive;
+    m_pixel_data_size = size;
+    bindTexture();
+
+    CM_LOG_DEBUG(Render, "[RHIImageItemRenderer::adoptDeviceImage]: Sampling device image {}x{} in place",
+                         size.width(), size.height());
+    return true;
+}
+
+void RHIImageItemRenderer::retireDeviceTexture()
+{
+    if (m_device_texture == 0) {
+        return;
     }
+
+    m_retired_device_textures.push_back({m_device_texture, std::move(m_device_keep_alive), m_frame});
+    m_device_texture = 0;
+    m_device_keep_alive.reset();
+}
+
+void RHIImageItemRenderer::releaseRetiredDeviceTextures(bool all)
+{
+    const uint64_t frames_in_flight = rhi() ? static_cast<uint64_t>(rhi()->resourceLimit(QRhi::FramesInFlight)) : 0;
+
+    std::erase_if(m_retired_device_textures, [&](const RetiredDeviceTexture& retired) {
+        if (!all && m_frame - retired.frame <= frames_in_flight) {
+            return false;
+        }
+        MetalInterop::releaseTexture(retired.native);
+        return true;
+    });
 }
 
 } // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,196 @@
+/**
+ * @file rhi_survey_item.cpp
+ * @brief Implementation of RHISurveyItem
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/rhi_survey_item.h"
+#include "rendering/rhi_survey_item_renderer.h"
+#include "common/image_region.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <QMutexLocker>
+#include <QQuickWindow>
+#include <algorithm>
+#include <cmath>
+
+namespace CaptureMoment::UI::Rendering {
+
+RHISurveyItem::RHISurveyItem(QQuickItem* parent)
+    : QQuickRhiItem(parent)
+{
+    CM_LOG_DEBUG(Render, "[RHISurveyItem::RHISurveyItem]: Created");
+}
+
+RHISurveyItem::~RHISurveyItem()
+{
+    CM_LOG_DEBUG(Render, "[RHISurveyItem::~RHISurveyItem]: Destroyed");
+}
+
+int RHISurveyItem::count() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_count;
+}
+
+void RHISurveyItem::setCount(int count)
+{
+    count = std::clamp(count, 0, k_max_images);
+    {
+        QMutexLocker lock(&m_mutex);
+        if (count == m_count) {
+            return;
+        }
+        for (int index = count; index < k_max_images; ++index) {
+            m_pending_images[index].reset();
+            m_image_sizes[index] = QSize();
+        }
+        m_count = count;
+        if (m_selected_index >= count) {
+            m_selected_index = -1;
+        }
+    }
+
+    emit countChanged(count);
+    updateCellLongEdge();
+    update();
+}
+
+int RHISurveyItem::selectedIndex() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_selected_index;
+}
+
+void RHISurveyItem::setSelectedIndex(int index)
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        index = index >= 0 && index < m_count ? index : -1;
+        if (index == m_selected_index) {
+            return;
+        }
+        m_selected_index = index;
+    }
+
+    emit selectedIndexChanged(index);
+    update();
+}
+
+bool RHISurveyItem::displayP3() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_display_p3;
+}
+
+void RHISurveyItem::setDisplayP3(bool enabled)
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        if (enabled == m_display_p3) {
+            return;
+        }
+        m_display_p3 = enabled;
+    }
+
+    emit displayP3Changed(enabled);
+    update();
+}
+
+void RHISurveyItem::setCellImage(int index, std::unique_ptr<Core::Common::ImageRegion> image)
+{
+    if (!image || !image->isValid()) {
+        spdlog::warn("[RHISurveyItem::setCellImage]: Invalid image for cell {}", index);
+        return;
+    }
+    if (std::max(image->width(), image->height()) > k_max_cell_edge) {
+        spdlog::warn("[RHISurveyItem::setCellImage]: {}x{} exceeds the cell size limit ({})",
+                     image->width(), image->height(), k_max_cell_edge);
+        return;
+    }
+
+    {
+        QMutexLocker lock(&m_mutex);
+        if (index < 0 || index >= m_count) {
+            spdlog::warn("[RHISurveyItem::setCellImage]: Cell {} out of range (count {})", index, m_count);
+            return;
+        }
+        m_image_sizes[index] = QSize(static_cast<int>(image->width()), static_cast<int>(image->height()));
+        m_pending_images[index] = std::move(image);
+    }
+
+    update();
+}
+
+void RHISurveyItem::clearImages()
+{
+    {
+        QMutexLocker lock(&m_mutex);
+        for (int index = 0; index < k_max_images; ++index) {
+            m_pending_images[index].reset();
+            m_image_sizes[index] = QSize();
+        }
+        m_images_cleared = true;
+    }
+
+    update();
+}
+
+int RHISurveyItem::cellAt(const QPointF& point) const
+{
+    const int cells { count() };
+    for (int index = 0; index < cells; ++index) {
+        if (cellRect(index, cells, size()).contains(point)) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+QRectF RHISurveyItem::cellRect(int index, int count, const QSizeF& area)
+{
+    if (count <= 0 || index < 0 || index >= count) {
+        return {};
+    }
+
+    const int columns { static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count)))) };
+    const int rows { (count + columns - 1) / columns };
+    const qreal width { std::max<qreal>(0.0, (area.width() - (columns - 1) * k_spacing) / columns) };
+    const qreal height { std::max<qreal>(0.0, (area.height() - (rows - 1) * k_spacing) / rows) };
+
+    return QRectF((index % columns) * (width + k_spacing), (index / columns) * (height + k_spacing), width, height);
+}
+
+QQuickRhiItemRenderer* RHISurveyItem::createRenderer()
+{
+    return new RHISurveyItemRenderer(this);
+}
+
+void RHISurveyItem::geometryChange(const QRectF& new_geometry, const QRectF& old_geometry)
+{
+    QQuickRhiItem::geometryChange(new_geometry, old_geometry);
+    if (new_geometry.size() != old_geometry.size()) {
+        updateCellLongEdge();
+    }
+}
+
+void RHISurveyItem::updateCellLongEdge()
+{
+    const QRectF cell { cellRect(0, count(), size()) };
+    const qreal ratio { window() ? window()->effectiveDevicePixelRatio() : 1.0 };
+    const int pixels { static_cast<int>(std::ceil(std::max(cell.width(), cell.height()) * ratio)) };
+
+    // Rounded up to a step: a render fills the cell until it grows past the step
+    const int edge { pixels > 0 ? std::min(k_max_cell_edge, (pixels + k_cell_edge_step - 1) / k_cell_edge_step * k_cell_edge_step)
+                                : 0 };
+    if (edge == m_cell_long_edge) {
+        return;
+    }
+
+    m_cell_long_edge = edge;
+    emit cellLongEdgeChanged(edge);
+}
+
+} // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,400 @@
+/**
+ * @file rhi_survey_item_renderer.cpp
+ * @brief Implementation of RHISurveyItemRenderer
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/rhi_survey_item_renderer.h"
+#include "rendering/render_stats.h"
+#include "common/image_region.h"
+#include "common/trace/tracer.h"
+#include "common/logging/log.h"
+
+#include <spdlog/spdlog.h>
+#include <QFile>
+#include <QFloat16>
+#include <QMatrix4x4>
+#include <QMutexLocker>
+#include <QQuickWindow>
+#include <algorithm>
+#include <cstring>
+
+namespace CaptureMoment::UI::Rendering {
+
+namespace {
+
+/**
+ * @brief Layout of the uniform block shared by survey_display.vert and survey_display.frag (std140).
+ */
+struct SurveyUniforms {
+    float mvp[16];
+    float cell_rects[RHISurveyItem::k_max_images][4];   ///< Image rectangle of each cell, in pixels (x, y, w, h)
+    float atlas_rects[RHISurveyItem::k_max_images][4];  ///< Texel-center rectangle of each slot (u, v, du, dv)
+    qint32 selected;                                    ///< Cell framed as selected, -1 for none
+    qint32 output_p3;                                   ///< 1: Rec.709 primaries are mapped to Display P3 before encoding
+    qint32 dither;                                      ///< 1: noise of +/- half an 8-bit step is added after encoding
+    float border_width;                                 ///< Width of the selection frame, in pixels
+};
+
+static_assert(sizeof(SurveyUniforms) == 336, "SurveyUniforms must match the std140 block");
+
+/**
+ * @brief Width of the selection frame, in logical pixels.
+ */
+constexpr float k_selection_border { 3.0f };
+
+} // namespace
+
+RHISurveyItemRenderer::RHISurveyItemRenderer(RHISurveyItem* item)
+    : m_item(item)
+{
+    CM_LOG_DEBUG(Render, "[RHISurveyItemRenderer::RHISurveyItemRenderer]: Created");
+}
+
+RHISurveyItemRenderer::~RHISurveyItemRenderer() = default;
+
+void RHISurveyItemRenderer::initialize(QRhiCommandBuffer* cb)
+{
+    if (m_initialized) {
+        return;
+    }
+
+    if (!rhi()) {
+        spdlog::error("[RHISurveyItemRenderer::initialize]: No RHI context available");
+        return;
+    }
+
+    // All cells are instances of one quad
+    if (!rhi()->isFeatureSupported(QRhi::Instancing)) {
+        spdlog::error("[RHISurveyItemRenderer::initialize]: Instanced drawing is not supported by this backend");
+        return;
+    }
+
+    createGeometry(cb);
+    createPipeline();
+
+    if (m_vertex_buffer && m_index_buffer && m_uniform_buffer && m_sampler && m_atlas && m_srb && m_pipeline) {
+        m_initialized = true;
+        spdlog::info("[RHISurveyItemRenderer::initialize]: Initialized successfully");
+    } else {
+        spdlog::error("[RHISurveyItemRenderer::initialize]: Initialization failed - missing resources");
+    }
+}
+
+void RHISurveyItemRenderer::synchronize(QQuickRhiItem* item)
+{
+    auto* survey_item = static_cast<RHISurveyItem*>(item);
+    if (!survey_item) {
+        spdlog::warn("[RHISurveyItemRenderer::synchronize]: Null item");
+        return;
+    }
+
+    m_device_pixel_ratio = survey_item->window() ? survey_item->window()->effectiveDevicePixelRatio() : 1.0;
+
+    QMutexLocker lock(&survey_item->m_mutex);
+
+    m_count = survey_item->m_count;
+    m_selected_index = survey_item->m_selected_index;
+    m_display_p3 = survey_item->m_display_p3;
+
+    // A new set of images: the previous ones are neither drawn nor uploaded
+    if (survey_item->m_images_cleared) {
+        m_slot_sizes.fill(QSize());
+        m_pending_cells.clear();
+        survey_item->m_images_cleared = false;
+    }
+
+    // Cells removed since the last frame keep no image
+    for (int index = m_count; index < RHISurveyItem::k_max_images; ++index) {
+        m_slot_sizes[index] = QSize();
+    }
+
+    // Images wait in the item until the atlas format is known
+    if (!m_initialized) {
+        return;
+    }
+
+    const QRhiTexture::Format format { atlasFormat() };
+    const std::size_t sample_bytes { format == QRhiTexture::RGBA16F ? sizeof(qfloat16) : sizeof(float) };
+
+    for (int index = 0; index < m_count; ++index) {
+        auto& image = survey_item->m_pending_images[index];
+        if (!image) {
+            continue;
+        }
+
+        // A newer image of the same cell replaces a staged one
+        std::erase_if(m_pending_cells, [index](const PendingCell& cell) { return cell.index == index; });
+
+        PendingCell& cell = m_pending_cells.emplace_back();
+        cell.index = index;
+        cell.size = QSize(static_cast<int>(image->width()), static_cast<int>(image->height()));
+
+        const std::size_t samples { static_cast<std::size_t>(cell.size.width()) * cell.size.height() * 4 };
+        cell.texels.resize(samples * sample_bytes);
+        if (format == QRhiTexture::RGBA16F) {
+            qFloatToFloat16(reinterpret_cast<qfloat16*>(cell.texels.data()), image->getBuffer().data(),
+                            static_cast<qsizetype>(samples));
+        } else {
+            std::memcpy(cell.texels.data(), image->getBuffer().data(), samples * sizeof(float));
+        }
+        image.reset();
+    }
+}
+
+void RHISurveyItemRenderer::render(QRhiCommandBuffer* cb)
+{
+    if (!m_initialized || !cb || !renderTarget()) {
+        return;
+    }
+
+    // Slots grow to the largest staged image; a new atlas drops the images it held
+    if (!m_pending_cells.empty()) {
+        int needed { m_slot_edge };
+        for (const PendingCell& cell : m_pending_cells) {
+            needed = std::max({ needed, cell.size.width(), cell.size.height() });
+        }
+        if (!ensureAtlas(needed)) {
+            m_pending_cells.clear();
+        }
+    }
+
+    // Upload the changed slots in one batch
+    if (!m_pending_cells.empty()) {
+        CM_TRACE_SCOPE("display", "surveyUpload");
+        const RenderStats::ScopedUpload upload_timer;
+        QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
+        if (batch) {
+            std::vector<QRhiTextureUploadEntry> entries;
+            entries.reserve(m_pending_cells.size());
+
+            for (const PendingCell& cell : m_pending_cells) {
+                QRhiTextureSubresourceUploadDescription subres(cell.texels.data(),
+                                                               static_cast<quint32>(cell.texels.size()));
+                subres.setDestinationTopLeft(QPoint((cell.index % k_atlas_columns) * m_slot_edge,
+                                                    (cell.index / k_atlas_columns) * m_slot_edge));
+                subres.setSourceSize(cell.size);
+                entries.emplace_back(0, 0, subres);
+                m_slot_sizes[cell.index] = cell.size;
+            }
+
+            QRhiTextureUploadDescription desc;
+            desc.setEntries(entries.cbegin(), entries.cend());
+            batch->uploadTexture(m_atlas.get(), desc);
+            cb->resourceUpdate(batch);
+
+            CM_LOG_DEBUG(Render, "[RHISurveyItemRenderer::render]: {} cell(s) uploaded", m_pending_cells.size());
+            m_pending_cells.clear();
+        }
+    }
+
+    const QSize rt_size { renderTarget()->pixelSize() };
+
+    // Cells in device pixels: laid out in logical pixels, like RHISurveyItem::cellAt
+    const qreal ratio { m_device_pixel_ratio > 0.0 ? m_device_pixel_ratio : 1.0 };
+    const QSizeF logical_size { rt_size.width() / ratio, rt_size.height() / ratio };
+
+    SurveyUniforms uniforms {};
+    QMatrix4x4 projection;
+    projection.ortho(0.0f, static_cast<float>(rt_size.width()), static_cast<float>(rt_size.height()), 0.0f, -1.0f, 1.0f);
+    std::memcpy(uniforms.mvp, projection.constData(), sizeof(uniforms.mvp));
+
+    const float atlas_width { static_cast<float>(m_atlas->pixelSize().width()) };
+    const float atlas_height { static_cast<float>(m_atlas->pixelSize().height()) };
+
+    for (int index = 0; index < m_count; ++index) {
+        const QSize image_size { m_slot_sizes[index] };
+        if (image_size.isEmpty()) {
+            continue;  // Zero-sized: the instance draws nothing until its image arrives
+        }
+
+        // The image fitted into its cell, centered, aspect ratio kept
+        const QRectF cell { RHISurveyItem::cellRect(index, m_count, logical_size) };
+        const qreal scale { std::min(cell.width() / image_size.width(), cell.height() / image_size.height()) * ratio };
+        const qreal width { image_size.width() * scale };
+        const qreal height { image_size.height() * scale };
+        uniforms.cell_rects[index][0] = static_cast<float>(cell.center().x() * ratio - width * 0.5);
+        uniforms.cell_rects[index][1] = static_cast<float>(cell.center().y() * ratio - height * 0.5);
+        uniforms.cell_rects[index][2] = static_cast<float>(width);
+        uniforms.cell_rects[index][3] = static_cast<float>(height);
+
+        // Texel centers of the slot: linear filtering never reads the neighbouring slot
+        const float slot_x { static_cast<float>((index % k_atlas_columns) * m_slot_edge) };
+        const float slot_y { static_cast<float>((index / k_atlas_columns) * m_slot_edge) };
+        uniforms.atlas_rects[index][0] = (slot_x + 0.5f) / atlas_width;
+        uniforms.atlas_rects[index][1] = (slot_y + 0.5f) / atlas_height;
+        uniforms.atlas_rects[index][2] = static_cast<float>(image_size.width() - 1) / atlas_width;
+        uniforms.atlas_rects[index][3] = static_cast<float>(image_size.height() - 1) / atlas_height;
+    }
+
+    uniforms.selected = m_selected_index;
+    uniforms.output_p3 = m_display_p3 ? 1 : 0;
+    uniforms.dither = 1;
+    uniforms.border_width = k_selection_border * static_cast<float>(ratio);
+
+    QRhiResourceUpdateBatch* batch = rhi()->nextResourceUpdateBatch();
+    if (batch) {
+        batch->updateDynamicBuffer(m_uniform_buffer.get(), 0, sizeof(uniforms), &uniforms);
+        cb->resourceUpdate(batch);
+    }
+
+    cb->beginPass(renderTarget(), QColor(30, 30, 30, 255), {1.0f, 0});
+    cb->setGraphicsPipeline(m_pipeline.get());
+    cb->setViewport(QRhiViewport(0, 0, rt_size.width(), rt_size.height()));
+    cb->setShaderResources(m_srb.get());
+
+    QRhiCommandBuffer::VertexInput vertex_input{m_vertex_buffer.get(), 0};
+    cb->setVertexInput(0, 1, &vertex_input, m_index_buffer.get(), 0, QRhiCommandBuffer::IndexUInt16);
+
+    // Every cell in one call: instance i is cell i
+    if (m_count > 0) {
+        cb->drawIndexed(6, static_cast<quint32>(m_count));
+    }
+
+    cb->endPass();
+}
+
+void RHISurveyItemRenderer::createGeometry(QRhiCommandBuffer* cb)
+{
+    // Unit quad: the vertex shader places it on the cell and maps it to the slot
+    const float vertices[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f
+    };
+    const uint16_t indices[] = { 0, 1, 2, 0, 2, 3 };
+
+    m_vertex_buffer.reset(rhi()->newBuffer(QRhiBuffer::Immutable, QRhiBuffer::VertexBuffer, sizeof(vertices)));
+    m_index_buffer.reset(rhi()->newBuffer(QRhiBuffer::Immutable, QRhiBuffer::IndexBuffer, sizeof(indices)));
+    m_uniform_buffer.reset(rhi()->newBuffer(QRhiBuffer::Dynamic, QRhiBuffer::UniformBuffer, sizeof(SurveyUniforms)));
+
+    if (!m_vertex_buffer->create() || !m_index_buffer->create() || !m_uniform_buffer->create()) {
+        spdlog::error("[RHISurveyItemRenderer::createGeometry]: Failed to create buffers");
+        m_vertex_buffer.reset();
+        return;
+    }
+
+    QRhiResourceUpdateBatch* batch = cb ? rhi()->nextResourceUpdateBatch() : nullptr;
+    if (!batch) {
+        spdlog::error("[RHISurveyItemRenderer::createGeometry]: No resource update batch for the geometry");
+        m_vertex_buffer.reset();
+        return;
+    }
+    batch->uploadStaticBuffer(m_vertex_buffer.get(), vertices);
+    batch->uploadStaticBuffer(m_index_buffer.get(), indices);
+    cb->resourceUpdate(batch);
+}
+
+void RHISurveyItemRenderer::createPipeline()
+{
+    QFile vs_file(":/shaders/glsl/survey_display.vert.qsb");
+    QFile fs_file(":/shaders/glsl/survey_display.frag.qsb");
+
+    if (!vs_file.open(QIODevice::ReadOnly) || !fs_file.open(QIODevice::ReadOnly)) {
+        spdlog::error("[RHISurveyItemRenderer::createPipeline]: Failed to open the survey shaders");
+        return;
+    }
+
+    const QShader vs = QShader::fromSerialized(vs_file.readAll());
+    const QShader fs = QShader::fromSerialized(fs_file.readAll());
+    if (!vs.isValid() || !fs.isValid()) {
+        spdlog::error("[RHISurveyItemRenderer::createPipeline]: Invalid survey shaders");
+        return;
+    }
+
+    // Cells are shown near their rendered size: no mip chain
+    m_sampler.reset(rhi()->newSampler(QRhiSampler::Linear, QRhiSampler::Linear, QRhiSampler::None,
+                                      QRhiSampler::ClampToEdge, QRhiSampler::ClampToEdge));
+    if (!m_sampler->create()) {
+        spdlog::error("[RHISurveyItemRenderer::createPipeline]: Failed to create sampler");
+        return;
+    }
+
+    // Placeholder atlas (1x1, never sampled while no cell has an image)
+    m_atlas.reset(rhi()->newTexture(atlasFormat(), QSize(1, 1)));
+    if (!m_atlas->create()) {
+        spdlog::error("[RHISurveyItemRenderer::createPipeline]: Failed to create placeholder atlas");
+        m_atlas.reset();
+        return;
+    }
+
+    bindAtlas();
+    if (!m_srb) {
+        return;
+    }
+
+    m_pipeline.reset(rhi()->newGraphicsPipeline());
+    m_pipeline->setShaderStages({
+        QRhiShaderStage{QRhiShaderStage::Vertex, vs},
+        QRhiShaderStage{QRhiShaderStage::Fragment, fs}
+    });
+
+    QRhiVertexInputLayout input_layout;
+    input_layout.setBindings({ QRhiVertexInputBinding(2 * sizeof(float)) });
+    input_layout.setAttributes({ QRhiVertexInputAttribute(0, 0, QRhiVertexInputAttribute::Float2, 0) });
+    m_pipeline->setVertexInputLayout(input_layout);
+    m_pipeline->setShaderResourceBindings(m_srb.get());
+    m_pipeline->setRenderPassDescriptor(renderTarget()->renderPassDescriptor());
+    m_pipeline->setTopology(QRhiGraphicsPipeline::Triangles);
+
+    if (!m_pipeline->create()) {
+        spdlog::error("[RHISurveyItemRenderer::createPipeline]: Failed to create graphics pipeline");
+        m_pipeline.reset();
+        return;
+    }
+
+    CM_LOG_DEBUG(Render, "[RHISurveyItemRenderer::createPipeline]: Pipeline created successfully");
+}
+
+bool RHISurveyItemRenderer::ensureAtlas(int slot_edge)
+{
+    if (slot_edge <= m_slot_edge) {
+        return true;
+    }
+
+    const QSize size(k_atlas_columns * slot_edge, k_atlas_rows * slot_edge);
+    std::unique_ptr<QRhiTexture> atlas { rhi()->newTexture(atlasFormat(), size) };
+    if (!atlas->create()) {
+        spdlog::error("[RHISurveyItemRenderer::ensureAtlas]: Failed to create atlas {}x{}", size.width(), size.height());
+        return false;
+    }
+
+    m_atlas = std::move(atlas);
+    m_slot_edge = slot_edge;
+    m_slot_sizes.fill(QSize());
+    bindAtlas();
+
+    CM_LOG_DEBUG(Render, "[RHISurveyItemRenderer::ensureAtlas]: Atlas {}x{} ({} px slots)",
+                         size.width(), size.height(), slot_edge);
+    return static_cast<bool>(m_srb);
+}
+
+void RHISurveyItemRenderer::bindAtlas()
+{
+    // Layout-compatible with the pipeline's binding set: the pipeline is kept
+    m_srb.reset(rhi()->newShaderResourceBindings());
+    m_srb->setBindings({
+        QRhiShaderResourceBinding::uniformBuffer(
+            0, QRhiShaderResourceBinding::VertexStage | QRhiShaderResourceBinding::FragmentStage,
+            m_uniform_buffer.get()),
+        QRhiShaderResourceBinding::sampledTexture(
+            1, QRhiShaderResourceBinding::FragmentStage, m_atlas.get(), m_sampler.get())
+    });
+
+    if (!m_srb->create()) {
+        spdlog::error("[RHISurveyItemRenderer::bindAtlas]: Failed to create shader resource bindings");
+        m_srb.reset();
+    }
+}
+
+QRhiTexture::Format RHISurveyItemRenderer::atlasFormat() const
+{
+    if (rhi()->isTextureFormatSupported(QRhiTexture::RGBA16F)) {
+        return QRhiTexture::RGBA16F;
+    }
+    return QRhiTexture::RGBA32F;
+}
+
+} // namespace CaptureMoment::UI::Rendering
@@ -6,15 +6,17 @@
  */
 
 #include "rendering/sgs_image_item.h"
+#include "rendering/sgs_staging_texture.h"
+#include "rendering/render_stats.h"
+#include "rendering/srgb_encoder.h"
+#include "common/logging/log.h"
 #include <spdlog/spdlog.h>
-#include <QMutexLocker>
 #include <QSGSimpleTextureNode>
 #include <QSGTexture>
+#include <QSGTextureMaterial>
 #include <QQuickWindow>
-#include <QImage>
-#include <algorithm>
+#include <cstdint>
 #include <cstring>
-#include <QColorSpace>
 
 namespace CaptureMoment::UI::Rendering {
 
@@ -24,18 +26,18 @@ SGSImageItem::SGSImageItem(QQuickItem* parent)
 {
     // Indicate to Qt Quick that this item has custom content rendered via the scene graph.
     setFlag(QQuickItem::ItemHasContents, true);
-    spdlog::debug("[SGSImageItem::SGSImageItem]: Created");
+    CM_LOG_DEBUG(Render, "[SGSImageItem::SGSImageItem]: Created");
 }
 
 // Destructor: Cleans up resources.
 SGSImageItem::~SGSImageItem() {
     // The deletion of textures managed by QSGNodes is handled by Qt Quick
     // when the nodes are destroyed.
-    spdlog::debug("[SGSImageItem::~SGSImageItem()]: Destroyed");
+    CM_LOG_DEBUG(Render, "[SGSImageItem::~SGSImageItem()]: Destroyed");
 }
 
 // Sets the full image to be displayed.
-// Updates the internal image data and marks the internal state for update.
+// Publishes it for the render thread, which converts it in updatePaintNode.
 void SGSImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image)
 {
     if (!image || !image->isValid())
@@ -46,12 +48,8 @@ void SGSImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image)
 
     spdlog::info("[SGSImageItem::setImage]: {}x{}", image->width(), image->height());
 
-    // This lock is held while updating the core image data members.
-    {
-        QMutexLocker lock(&m_image_mutex);
-        m_full_image = std::move(image);
-        m_image_dirty = true;
-    }
+    // Handed to the render thread without a lock: a conversion in progress never delays it
+    m_frames->publishImage(std::move(image));
 
     // Emit signal for QML binding (BaseImageItem manages the signal emission)
     emit imageSizeChanged();
@@ -60,8 +58,27 @@ void SGSImageItem::setImage(std::unique_ptr<Core::Common::ImageRegion> image)
     QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
 }
 
+// Sets a display-ready image (sRGB RGBA8).
+// The texture is created from the bytes in updatePaintNode, without color conversion.
+void SGSImageItem::setDisplayImage(std::shared_ptr<const Core::Common::DisplayImage> image)
+{
+    if (!image || !image->isValid())
+    {
+        spdlog::warn("[SGSImageItem::setDisplayImage]: Invalid image");
+        return;
+    }
+
+    spdlog::info("[SGSImageItem::setDisplayImage]: {}x{}", image->m_width, image->m_height);
+
+    m_frames->publishDisplayImage(std::move(image));
+
+    emit imageSizeChanged();
+
+    QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
+}
+
 // Updates a specific tile of the displayed image.
-// Merges the tile data into the full image buffer (CPU side) and marks the internal state for update.
+// Queues the tile for the render thread, which merges it into its copy of the image.
 void SGSImageItem::updateTile(std::unique_ptr<Core::Common::ImageRegion> tile)
 {
     if (!tile || !tile->isValid()) {
@@ -69,56 +86,15 @@ void SGSImageItem::updateTile(std::unique_ptr<Core::Common::ImageRegion> tile)
         return;
     }
 
-    {
-        QMutexLocker lock(&m_image_mutex);
-
-        if (!m_full_image) {
-            spdlog::warn("[SGSImageItem::updateTile]: No base image");
-            return;
-        }
-
-        // Full replacement if same dimensions (most common case)
-        if (tile->width() == m_full_image->width() &&
-            tile->height() == m_full_image->height())
-        {
-            // Copy data instead of move to avoid destructor issues
-            const size_t data_size { tile->width() * tile->height() * tile->channels() };
-            std::copy(tile->getBuffer().data(),
-                      tile->getBuffer().data() + data_size,
-                      m_full_image->getBuffer().data());
-            m_image_dirty = true;
-            spdlog::info("[SGSImageItem::updateTile]: Full copy {}x{}", tile->width(), tile->height());
-        } else
-        {
-            // Partial tile update
-            if (tile->x() < 0 || tile->y() < 0 ||
-                tile->x() + tile->width() > m_full_image->width() ||
-                tile->y() + tile->height() > m_full_image->height()) {
-                spdlog::warn("[SGSImageItem::updateTile]: Tile out of bounds");
-                return;
-            }
+    const int tile_x { tile->x() };
+    const int tile_y { tile->y() };
 
-            // Copy the tile data row by row
-            const size_t row_size { tile->width() * tile->channels() };
-            const int full_w { static_cast<int>(m_full_image->width()) };
-            const int tile_x { tile->x() };
-            const int tile_y { tile->y() } ;
-            const int tile_h { static_cast<int>(tile->height()) };
-
-            for (size_t y = 0; y < tile_h; ++y)
-            {
-                const float* src = tile->getBuffer().data() + y * row_size;
-                // FIXED: (tile_y + y) not (tile_x + y)
-                float* dst = m_full_image->getBuffer().data() +
-                             ((tile_y + y) * full_w + tile_x) * m_full_image->channels();
-                std::copy(src, src + row_size, dst);
-            }
-            m_image_dirty = true;
-            spdlog::debug("[SGSImageItem::updateTile]: Partial copy at ({}, {})", tile_x, tile_y);
-        }
+    // Queued for the render thread, which merges it into its own copy of the image
+    if (!m_frames->publishTile(std::move(tile))) {
+        return;
     }
 
-    spdlog::debug("[SGSImageItem::updateTile]: Merged tile at ({}, {})", tile->x(), tile->y());
+    CM_LOG_DEBUG(Render, "[SGSImageItem::updateTile]: Queued tile at ({}, {})", tile_x, tile_y);
     QMetaObject::invokeMethod(this, &QQuickItem::update, Qt::QueuedConnection);
 }
 
@@ -132,69 +108,78 @@ QSGNode* SGSImageItem::updatePaintNode(QSGNode* node, UpdatePaintNodeData* data)
         return node;
     }
 
+    QQuickWindow* win = window();
+    if (!win) {
+        spdlog::warn("[SGSImageItem::updatePaintNode]: No window attached");
+        return node;
+    }
+
     auto* texture_node { static_cast<QSGSimpleTextureNode*>(node) };
+    if (!texture_node) {
+        // One texture for the node's lifetime: edits re-upload into it instead of allocating a new one
+        texture_node = new QSGSimpleTextureNode();
+        auto* staging_texture { new SGSStagingTexture() };
+        // Mips regenerated on each upload: zooming out samples trilinearly instead of shimmering
+        staging_texture->setMipmapFiltering(QSGTexture::Linear);
+        texture_node->setTexture(staging_texture);
+        texture_node->setOwnsTexture(true);
+    }
+
+    auto* texture { static_cast<SGSStagingTexture*>(texture_node->texture()) };
 
     int img_w { 0 };
     int img_h { 0 };
-    bool needs_texture_update { false };
-    QImage new_qimage;
 
+    // Latest frame, with its tiles merged: the render thread owns it, encoded with no lock held
+    const FrameHandoff::Update update { m_frames->take() };
+    const FrameHandoff::Frame& frame { m_frames->current() };
+    const bool stage { update.m_replaced || !update.m_dirty_regions.empty() || texture->textureSize().isEmpty() };
+
+    if (frame.m_display_image && frame.m_display_image->isValid())
     {
-        QMutexLocker lock(&m_image_mutex);
+        const Core::Common::DisplayImage& display_image { *frame.m_display_image };
+        img_w = static_cast<int>(display_image.m_width);
+        img_h = static_cast<int>(display_image.m_height);
 
-        if (m_full_image && m_full_image->isValid())
+        if (stage)
         {
-            img_w = static_cast<int>(m_full_image->width());
-            img_h = static_cast<int>(m_full_image->height());
-
-            if (m_image_dirty)
-            {
-                needs_texture_update = true;
-
-                QImage linear_img(
-                    reinterpret_cast<const uchar*>(m_full_image->getBuffer().data()),
-                    img_w, img_h,
-                    img_w * 4 * static_cast<int>(sizeof(float)),
-                    QImage::Format_RGBA32FPx4
-                    );
-
-                const QColorSpace linear_cs { QColorSpace::SRgbLinear };
-                linear_img.setColorSpace(linear_cs);
-
-                new_qimage = linear_img.convertedToColorSpace(QColorSpace::SRgb)
-                                 .convertToFormat(QImage::Format_RGBA8888);
-
-                m_image_dirty = false;
+            const RenderStats::ScopedUpload upload_timer;
+            // Already sRGB RGBA8: row copy into the staging buffer, no conversion
+            std::uint8_t* dst { texture->stage(QSize(img_w, img_h)) };
+            const std::size_t row_bytes { texture->bytesPerLine() };
+            const std::size_t src_stride { display_image.bytesPerLine() };
+
+            for (int y = 0; y < img_h; ++y) {
+                std::memcpy(dst + y * row_bytes, display_image.m_data.data() + y * src_stride, row_bytes);
             }
-        }
-    }
 
-    QQuickWindow* win = window();
-    if (!win) {
-        spdlog::warn("[SGSImageItem::updatePaintNode]: No window attached");
-        return node;
+            texture->markStaged();
+        }
     }
+    else if (frame.m_image && frame.m_image->isValid())
+    {
+        img_w = static_cast<int>(frame.m_image->width());
+        img_h = static_cast<int>(frame.m_image->height());
 
-    if (!texture_node) {
-        texture_node = new QSGSimpleTextureNode();
+        if (stage)
+        {
+            const RenderStats::ScopedUpload upload_timer;
+            // Linear floats encoded straight into the staging buffer (table-driven sRGB encode)
+            std::uint8_t* dst { texture->stage(QSize(img_w, img_h)) };
+            encodeLinearToSrgb8(frame.m_image->getBuffer().data(), static_cast<std::size_t>(img_w) * 4,
+                                dst, texture->bytesPerLine(),
+                                static_cast<std::size_t>(img_w), static_cast<std::size_t>(img_h));
+
+            texture->markStaged();
+        }
     }
 
-    if (needs_texture_update && !new_qimage.isNull())
-    {
-        QSGTexture* new_texture { win->createTextureFromImage(
-            new_qimage,
-            QQuickWindow::TextureHasAlphaChannel
-            ) };
-
-        if (new_texture) {
-            texture_node->setTexture(new_texture);
-            texture_node->setOwnsTexture(true);
-        } else {
-            spdlog::warn("[SGSImageItem::updatePaintNode]: Failed to create texture");
-        }
+    if (texture->updateTexture()) {
+        // Re-prepares the material, which commits the upload into the existing texture
+        texture_node->markDirty(QSGNode::DirtyMaterial);
     }
 
-    if (texture_node->texture())
+    if (!texture->textureSize().isEmpty())
     {
         float display_w, display_h;
         if (img_w > 0 && img_h > 0) {
@@ -210,6 +195,15 @@ QSGNode* SGSImageItem::updatePaintNode(QSGNode* node, UpdatePaintNodeData* data)
 
         texture_node->setRect(x_pos, y_pos, display_w, display_h);
         texture_node->setFiltering(QSGTexture::Linear);
+
+        // QSGSimpleTextureNode has no mipmap setter: both of its materials are opaque texture materials
+        for (QSGMaterial* material : { texture_node->material(), texture_node->opaqueMaterial() }) {
+            auto* texture_material = static_cast<QSGOpaqueTextureMaterial*>(material);
+            if (texture_material && texture_material->mipmapFiltering() != QSGTexture::Linear) {
+                texture_material->setMipmapFiltering(QSGTexture::Linear);
+                texture_node->markDirty(QSGNode::DirtyMaterial);
+            }
+        }
     }
 
     return texture_node;
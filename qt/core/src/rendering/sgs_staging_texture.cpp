@@ -0,0 +1,81 @@
+/**
+ * @file sgs_staging_texture.cpp
+ * @brief Implementation of SGSStagingTexture
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/sgs_staging_texture.h"
+#include "common/logging/log.h"
+
+#include <rhi/qrhi.h>
+#include <QByteArray>
+#include <spdlog/spdlog.h>
+
+namespace CaptureMoment::UI::Rendering {
+
+SGSStagingTexture::~SGSStagingTexture()
+{
+    // Destroyed with its node on the render thread; deferred in case a frame still references it
+    if (m_texture) {
+        m_texture->deleteLater();
+    }
+}
+
+std::uint8_t* SGSStagingTexture::stage(const QSize& size)
+{
+    m_size = size;
+    // resize() keeps the capacity: same-size edits never reallocate
+    m_staging.resize(static_cast<std::size_t>(size.width()) * static_cast<std::size_t>(size.height()) * 4);
+    return m_staging.data();
+}
+
+qint64 SGSStagingTexture::comparisonKey() const
+{
+    return m_texture ? qint64(qintptr(m_texture)) : qint64(qintptr(this));
+}
+
+QRhiTexture* SGSStagingTexture::rhiTexture() const
+{
+    return m_texture;
+}
+
+void SGSStagingTexture::commitTextureOperations(QRhi* rhi, QRhiResourceUpdateBatch* resourceUpdates)
+{
+    if (!m_upload_pending || m_size.isEmpty() || !rhi || !resourceUpdates) {
+        return;
+    }
+
+    if (!m_texture || m_texture->pixelSize() != m_size)
+    {
+        if (!m_texture) {
+            m_texture = rhi->newTexture(QRhiTexture::RGBA8, m_size, 1,
+                                        QRhiTexture::MipMapped | QRhiTexture::UsedWithGenerateMips);
+        } else {
+            m_texture->setPixelSize(m_size);
+        }
+
+        if (!m_texture->create()) {
+            spdlog::warn("[SGSStagingTexture::commitTextureOperations]: Failed to create {}x{} texture",
+                         m_size.width(), m_size.height());
+            delete m_texture;
+            m_texture = nullptr;
+            return;
+        }
+        CM_LOG_DEBUG(Render, "[SGSStagingTexture::commitTextureOperations]: Allocated {}x{} texture",
+                             m_size.width(), m_size.height());
+    }
+
+    // The batch records the upload in this frame, before the next sync can rewrite the staging buffer
+    const QByteArray bytes { QByteArray::fromRawData(reinterpret_cast<const char*>(m_staging.data()),
+                                                     static_cast<qsizetype>(m_staging.size())) };
+    QRhiTextureSubresourceUploadDescription level0 { bytes };
+    level0.setDataStride(static_cast<quint32>(bytesPerLine()));
+
+    resourceUpdates->uploadTexture(m_texture, QRhiTextureUploadDescription(QRhiTextureUploadEntry(0, 0, level0)));
+    resourceUpdates->generateMips(m_texture);
+
+    m_upload_pending = false;
+}
+
+} // namespace CaptureMoment::UI::Rendering
@@ -0,0 +1,27 @@
+/**
+ * @file srgb_encoder.cpp
+ * @brief Implementation of the table-driven sRGB encoder
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "rendering/srgb_encoder.h"
+
+#include "utils/quantize.h"
+
+namespace CaptureMoment::UI::Rendering {
+
+void encodeLinearToSrgb8(const float* src, std::uint8_t* dst, std::size_t pixel_count) noexcept
+{
+    // One row: the whole span is encoded on the calling thread
+    Core::Utils::quantizeRowsU8(src, pixel_count * 4, dst, pixel_count * 4, pixel_count, 1, 4);
+}
+
+void encodeLinearToSrgb8(const float* src, std::size_t src_stride,
+                         std::uint8_t* dst, std::size_t dst_stride,
+                         std::size_t width, std::size_t height) noexcept
+{
+    Core::Utils::quantizeRowsU8(src, src_stride, dst, dst_stride, width, height, 4);
+}
+
+} // namespace CaptureMoment::UI::Rendering
@@ -6,8 +6,11 @@
  */
 
 #include "serializer/serializer_controller.h"
+#include <QMetaObject>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+
 namespace CaptureMoment::UI {
 
 namespace Serializer {
@@ -30,6 +33,22 @@ SerializerController::SerializerController(std::unique_ptr<CaptureMoment::Core::
         spdlog::error("SerializerController: Constructor received a null FileSerializerManager.");
         throw std::invalid_argument("SerializerController: FileSerializerManager cannot be null.");
     }
+
+    // The result of a write is reported on the UI thread
+    m_autosaver = std::make_unique<CaptureMoment::Core::Serializer::XmpAutosaver>(
+        m_file_serializer_manager->writer(),
+        CaptureMoment::Core::Serializer::XmpAutosaver::k_default_debounce,
+        [this](const std::string& image_path, bool success) {
+            QMetaObject::invokeMethod(this, [this, image_path, success]() {
+                if (success) {
+                    spdlog::info("SerializerController: Successfully saved operations for image: {}", image_path);
+                    emit operationsSaved();
+                } else {
+                    spdlog::error("SerializerController: Failed to save operations for image: {}", image_path);
+                    emit operationsSaveFailed("Failed to write operations to file.");
+                }
+            }, Qt::QueuedConnection);
+        });
     spdlog::debug("SerializerController: Constructed with FileSerializerManager.");
 }
 
@@ -37,13 +56,15 @@ SerializerController::SerializerController(std::unique_ptr<CaptureMoment::Core::
  * @brief Destructor.
  */
 SerializerController::~SerializerController() {
+    // Write the pending edits while this object is whole
+    m_autosaver.reset();
     spdlog::debug("SerializerController: Destroyed.");
 }
 
 /**
  * @brief Saves the provided list of operations to a file associated with the given image path.
  *
- * This slot calls the core FileSerializerManager to perform the save operation.
+ * The write runs right away on the autosave thread (the slot returns at once).
  * It emits either operationsSaved() or operationsSaveFailed() upon completion.
  *
  * @param image_path The path to the source image file. Used to determine the target XMP file location.
@@ -66,15 +87,7 @@ void SerializerController::saveOperations(const QString& image_path, const std::
 
     spdlog::debug("SerializerController::saveOperations: Attempting to save {} operations for image: {}", operations.size(), image_path.toStdString());
 
-    bool success = m_file_serializer_manager->saveToFile(image_path.toStdString(), operations);
-
-    if (success) {
-        spdlog::info("SerializerController::saveOperations: Successfully saved operations for image: {}", image_path.toStdString());
-        emit operationsSaved();
-    } else {
-        spdlog::error("SerializerController::saveOperations: Failed to save operations for image: {}", image_path.toStdString());
-        emit operationsSaveFailed("Failed to write operations to file.");
-    }
+    m_autosaver->scheduleSave(image_path.toStdString(), operations, std::chrono::milliseconds{0});
 }
 
 /**
@@ -112,9 +125,51 @@ void SerializerController::loadOperations(const QString& image_path) {
     }
 
     spdlog::info("SerializerController::loadOperations: Successfully loaded {} operations from file for image: {}", loaded_ops.size(), image_path.toStdString());
+
+    // Started before the operations travel through the UI: e.g. the pipeline compiles while the image decodes
+    if (m_operations_parsed_handler) {
+        m_operations_parsed_handler(loaded_ops);
+    }
+
+    // Re-applying the loaded operations must not rewrite the sidecar
+    m_autosaver->markSaved(image_path.toStdString(), loaded_ops);
     emit operationsLoaded(loaded_ops);
 }
 
+/**
+ * @brief Sets the handler called as soon as a sidecar is parsed.
+ *
+ * @param handler The handler, or an empty function to remove it.
+ */
+void SerializerController::setOperationsParsedHandler(OperationsParsedHandler handler) {
+    m_operations_parsed_handler = std::move(handler);
+}
+
+/**
+ * @brief Saves the operations once the edits have been idle for the debounce delay.
+ *
+ * @param image_path The path to the source image file.
+ * @param operations The current operations of the image.
+ */
+void SerializerController::scheduleAutosave(const QString& image_path, const std::vector<CaptureMoment::Core::Operations::OperationDescriptor>& operations) {
+    if (image_path.isEmpty())
+    {
+        spdlog::error("SerializerController::scheduleAutosave: Image path is empty.");
+        return;
+    }
+
+    m_autosaver->scheduleSave(image_path.toStdString(), operations);
+}
+
+/**
+ * @brief Writes the pending autosave now and waits for it.
+ */
+void SerializerController::flushAutosave() {
+    if (!m_autosaver->flush()) {
+        spdlog::warn("SerializerController::flushAutosave: The last save failed.");
+    }
+}
+
 } // namespace Serializer
 
 } // namespace CaptureMoment::UI
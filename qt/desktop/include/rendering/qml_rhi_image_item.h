@@ -36,6 +36,9 @@ class QMLRHIImageItem : public Rendering::RHIImageItem
     Q_PROPERTY(QPointF pan READ pan WRITE setPan NOTIFY panChanged)
     Q_PROPERTY(int imageWidth READ imageWidth NOTIFY imageSizeChanged)
     Q_PROPERTY(int imageHeight READ imageHeight NOTIFY imageSizeChanged)
+    Q_PROPERTY(float exposurePreview READ exposurePreview WRITE setExposurePreview NOTIFY exposurePreviewChanged)
+    Q_PROPERTY(bool displayP3 READ displayP3 WRITE setDisplayP3 NOTIFY displayP3Changed)
+    Q_PROPERTY(float compareSplit READ compareSplit WRITE setCompareSplit NOTIFY compareSplitChanged)
 
 public:
     /**
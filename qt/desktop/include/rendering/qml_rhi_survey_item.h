@@ -0,0 +1,43 @@
+/**
+ * @file qml_rhi_survey_item.h
+ * @brief QML object of RHISurveyItem
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include <QQuickItem>
+#include "rendering/rhi_survey_item.h"
+
+namespace CaptureMoment::UI {
+
+/**
+ * @brief Survey view (several images side by side, one draw call), directly usable in QML.
+ *
+ * Exposes the properties of RHISurveyItem; the images come from the "surveyController"
+ * context object, given this item as its `surveyItem`.
+ */
+class QMLRHISurveyItem : public Rendering::RHISurveyItem
+{
+    Q_OBJECT
+
+    Q_PROPERTY(int count READ count WRITE setCount NOTIFY countChanged)
+    Q_PROPERTY(int selectedIndex READ selectedIndex WRITE setSelectedIndex NOTIFY selectedIndexChanged)
+    Q_PROPERTY(bool displayP3 READ displayP3 WRITE setDisplayP3 NOTIFY displayP3Changed)
+    Q_PROPERTY(int cellLongEdge READ cellLongEdge NOTIFY cellLongEdgeChanged)
+
+public:
+    /**
+     * @brief Constructs a QMLRHISurveyItem.
+     * @param parent Optional parent QQuickItem.
+     */
+    explicit QMLRHISurveyItem(QQuickItem* parent = nullptr);
+
+    /**
+     * @brief Destroys the QMLRHISurveyItem.
+     */
+    ~QMLRHISurveyItem();
+};
+
+} // namespace CaptureMoment::UI
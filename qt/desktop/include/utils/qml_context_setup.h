@@ -14,12 +14,17 @@ namespace CaptureMoment::UI {
 
 namespace Controller {
 class ImageControllerBase;
+class SurveyController;
 }
 
 namespace Serializer {
 class SerializerController;
 }
 
+namespace Models {
+class FolderImageModel;
+}
+
 /**
  * @brief Central manager for QML context setup
  *
@@ -40,6 +45,9 @@ public:
      *
      * Registers to QML:
      * - "controller" → ImageController (which internally manages models)
+     * - "performanceMonitor" → PerformanceMonitor (performance overlay statistics)
+     * - "folderImageModel" → FolderImageModel (images of the filmstrip and of the grid)
+     * - "surveyController" → SurveyController (images compared side by side)
      *
      * @param context The QML context to setup
      * @return true if setup was successful, false otherwise.
@@ -89,6 +97,18 @@ private:
      */
     static std::unique_ptr<Serializer::SerializerController> m_serializer_controller;
 
+    /**
+     * @brief Static unique pointer to the images of the current folder, shown by the filmstrip
+     * and the thumbnail grid. Created and registered by registerCoreToQml().
+     */
+    static std::unique_ptr<Models::FolderImageModel> m_folder_image_model;
+
+    /**
+     * @brief Static unique pointer to the controller of the survey view (several images side by
+     * side, for culling). Created and registered by registerCoreToQml().
+     */
+    static std::unique_ptr<Controller::SurveyController> m_survey_controller;
+
     /**
      * @brief Create the central ImageController orchestrator.
      * @return true if the controller was created successfully, false otherwise.
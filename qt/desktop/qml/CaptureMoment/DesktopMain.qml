@@ -20,9 +20,10 @@ ApplicationWindow {
         onOpenFileTriggered: console.log("Open file")
         onSaveTriggered: console.log("Save file")
         onExitTriggered: window.close()
-        onUndoTriggered: console.log("Undo")
-        onRedoTriggered: console.log("Redo")
+        onUndoTriggered: controller.undo()
+        onRedoTriggered: controller.redo()
         onPreferencesTriggered: console.log("Preferences")
+        onPerformanceOverlayToggled: (visible) => performanceOverlay.visible = visible
         onAboutTriggered: console.log("About")
     }
 
@@ -31,6 +32,16 @@ ApplicationWindow {
         anchors.fill: parent
     }
 
+    // Runtime performance HUD (View > Performance Overlay)
+    PerformanceOverlay {
+        id: performanceOverlay
+        visible: false
+        z: 100
+        anchors.top: parent.top
+        anchors.right: parent.right
+        anchors.margins: 12
+    }
+
     // Setup performed when the component is fully loaded
     Component.onCompleted: {
         console.log("Application started")
@@ -11,6 +11,7 @@ MenuBar {
     signal undoTriggered()
     signal redoTriggered()
     signal preferencesTriggered()
+    signal performanceOverlayToggled(bool visible)
     signal aboutTriggered()
     
     Menu {
@@ -41,10 +42,12 @@ MenuBar {
         
         Action {
             text: qsTr("&Undo")
+            shortcut: StandardKey.Undo
             onTriggered: appMenuBar.undoTriggered()
         }
         Action {
             text: qsTr("&Redo")
+            shortcut: StandardKey.Redo
             onTriggered: appMenuBar.redoTriggered()
         }
         MenuSeparator { }
@@ -54,6 +57,17 @@ MenuBar {
         }
     }
     
+    Menu {
+        title: qsTr("&View")
+
+        Action {
+            text: qsTr("&Performance Overlay")
+            checkable: true
+            shortcut: "Ctrl+Shift+P"
+            onToggled: appMenuBar.performanceOverlayToggled(checked)
+        }
+    }
+    
     Menu {
         title: qsTr("&Help")
         
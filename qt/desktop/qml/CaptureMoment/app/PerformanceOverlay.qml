@@ -0,0 +1,106 @@
+import QtQuick
+import QtQuick.Layouts
+
+// Runtime performance HUD, fed by the performanceMonitor context property.
+// Sampling runs only while the overlay is visible.
+Rectangle {
+    id: performanceOverlay
+
+    readonly property var monitor: typeof performanceMonitor !== "undefined" ? performanceMonitor : null
+    readonly property int totalRequests: monitor
+        ? monitor.completedRequests + monitor.coalescedRequests + monitor.droppedRequests : 0
+
+    function formatMs(value) {
+        return value.toFixed(1) + " ms"
+    }
+
+    function share(count) {
+        return totalRequests > 0 ? " (" + (100 * count / totalRequests).toFixed(0) + "%)" : ""
+    }
+
+    width: statsGrid.implicitWidth + 24
+    height: statsGrid.implicitHeight + 24
+    radius: 6
+    color: "#CC101010"
+    border.color: "#404040"
+
+    onVisibleChanged: {
+        if (monitor) {
+            monitor.active = visible
+        }
+    }
+    Component.onCompleted: {
+        if (monitor) {
+            monitor.active = visible
+        }
+    }
+
+    component StatLabel: Text {
+        color: "#AAAAAA"
+        font.pixelSize: 11
+        font.family: "monospace"
+    }
+
+    component StatValue: Text {
+        color: "white"
+        font.pixelSize: 11
+        font.family: "monospace"
+    }
+
+    GridLayout {
+        id: statsGrid
+
+        anchors.centerIn: parent
+        columns: 2
+        columnSpacing: 12
+        rowSpacing: 2
+
+        StatLabel { text: "Engine latency" }
+        StatValue {
+            text: monitor ? formatMs(monitor.engineLatencyMs) + " (max " + formatMs(monitor.engineLatencyMaxMs) + ")" : "-"
+            color: monitor && monitor.engineLatencyMs > 100 ? "#FF8A65" : "white"
+        }
+
+        StatLabel { text: "Pipeline" }
+        StatValue { text: monitor ? formatMs(monitor.pipelineMs) : "-" }
+
+        StatLabel { text: "Queue depth" }
+        StatValue { text: monitor ? monitor.queueDepth : "-" }
+
+        StatLabel { text: "Completed" }
+        StatValue { text: monitor ? monitor.completedRequests : "-" }
+
+        StatLabel { text: "Coalesced" }
+        StatValue { text: monitor ? monitor.coalescedRequests + share(monitor.coalescedRequests) : "-" }
+
+        StatLabel { text: "Dropped" }
+        StatValue { text: monitor ? monitor.droppedRequests + share(monitor.droppedRequests) : "-" }
+
+        StatLabel { text: "Backend" }
+        StatValue { text: monitor && monitor.backend !== "" ? monitor.backend : "-" }
+
+        StatLabel { text: "Target" }
+        StatValue {
+            text: monitor && monitor.target !== "" ? monitor.target : "-"
+            elide: Text.ElideRight
+            Layout.maximumWidth: 260
+        }
+
+        StatLabel { text: "Memory" }
+        StatValue {
+            text: monitor
+                ? monitor.memoryUsedMB.toFixed(0) + " MB"
+                  + (monitor.memoryBudgetMB > 0
+                     ? " / " + monitor.memoryBudgetMB.toFixed(0) + " MB ("
+                       + (100 * monitor.memoryUsedMB / monitor.memoryBudgetMB).toFixed(0) + "%)"
+                     : " (no budget)")
+                : "-"
+        }
+
+        StatLabel { text: "Texture upload" }
+        StatValue { text: monitor ? formatMs(monitor.textureUploadMs) : "-" }
+
+        StatLabel { text: "Render FPS" }
+        StatValue { text: monitor ? monitor.renderFps.toFixed(1) : "-" }
+    }
+}
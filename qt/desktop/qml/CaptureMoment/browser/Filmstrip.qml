@@ -0,0 +1,38 @@
+import QtQuick
+import QtQuick.Controls
+
+// Horizontal strip of the images of the current folder. Only the visible cells (plus
+// cacheBuffer) exist: scrolling a 10k-image folder creates and recycles a few dozen delegates.
+ListView {
+    id: filmstrip
+
+    property var imageModel: folderImageModel
+
+    signal imageActivated(url fileUrl)
+
+    orientation: ListView.Horizontal
+    clip: true
+    spacing: 2
+    model: imageModel
+    reuseItems: true
+    // Half a screen ahead: the next cells are requested before they scroll in
+    cacheBuffer: width / 2
+    boundsBehavior: Flickable.StopAtBounds
+
+    ScrollBar.horizontal: ScrollBar { policy: ScrollBar.AsNeeded }
+
+    delegate: ThumbnailCell {
+        required property int index
+        required property url url
+
+        width: filmstrip.height * 1.25
+        height: filmstrip.height - 10
+        showCaption: false
+        selected: filmstrip.currentIndex === index
+
+        onClicked: {
+            filmstrip.currentIndex = index
+            filmstrip.imageActivated(url)
+        }
+    }
+}
@@ -0,0 +1,70 @@
+import QtQuick
+import QtQuick.Controls
+
+// One cell of the filmstrip and of the grid: the thumbnail, decoded off the GUI thread by the
+// "thumbnails" image provider at the size of the cell, and the file name.
+Item {
+    id: thumbnailCell
+
+    // Filled from the model roles of the same name
+    required property url thumbnail
+    required property string fileName
+    property bool selected: false
+    property bool showCaption: true
+
+    signal clicked()
+    signal doubleClicked()
+
+    Rectangle {
+        anchors.fill: parent
+        anchors.margins: 2
+        radius: 3
+        color: thumbnailCell.selected ? "#3a3a3a" : "#222222"
+        border.color: thumbnailCell.selected ? "#4CAF50" : "transparent"
+        border.width: 2
+
+        Image {
+            id: thumbnailImage
+            anchors.fill: parent
+            anchors.margins: 4
+            anchors.bottomMargin: thumbnailCell.showCaption ? caption.height + 6 : 4
+
+            source: thumbnailCell.thumbnail
+            // Decoded at the cell size, never at the stored size
+            sourceSize.width: width * Screen.devicePixelRatio
+            sourceSize.height: height * Screen.devicePixelRatio
+            asynchronous: true
+            cache: true
+            fillMode: Image.PreserveAspectFit
+            smooth: false
+        }
+
+        BusyIndicator {
+            anchors.centerIn: thumbnailImage
+            width: 24
+            height: 24
+            running: thumbnailImage.status === Image.Loading
+            visible: running
+        }
+
+        Text {
+            id: caption
+            anchors.left: parent.left
+            anchors.right: parent.right
+            anchors.bottom: parent.bottom
+            anchors.margins: 4
+            visible: thumbnailCell.showCaption
+            text: thumbnailCell.fileName
+            color: "#BBBBBB"
+            font.pixelSize: 10
+            elide: Text.ElideMiddle
+            horizontalAlignment: Text.AlignHCenter
+        }
+
+        MouseArea {
+            anchors.fill: parent
+            onClicked: thumbnailCell.clicked()
+            onDoubleClicked: thumbnailCell.doubleClicked()
+        }
+    }
+}
@@ -0,0 +1,46 @@
+import QtQuick
+import QtQuick.Controls
+
+// Grid of the images of the current folder, virtualized like the filmstrip.
+GridView {
+    id: thumbnailGrid
+
+    property var imageModel: folderImageModel
+    property int cellSize: 160
+
+    signal imageActivated(url fileUrl)
+
+    clip: true
+    model: imageModel
+    reuseItems: true
+    cellWidth: Math.max(cellSize, width / Math.max(1, Math.floor(width / cellSize)))
+    cellHeight: cellSize + 16
+    // One screen ahead
+    cacheBuffer: height
+    boundsBehavior: Flickable.StopAtBounds
+
+    ScrollBar.vertical: ScrollBar { policy: ScrollBar.AsNeeded }
+
+    delegate: ThumbnailCell {
+        required property int index
+        required property url url
+
+        width: thumbnailGrid.cellWidth
+        height: thumbnailGrid.cellHeight
+        selected: thumbnailGrid.currentIndex === index
+
+        onClicked: thumbnailGrid.currentIndex = index
+        onDoubleClicked: {
+            thumbnailGrid.currentIndex = index
+            thumbnailGrid.imageActivated(url)
+        }
+    }
+
+    Text {
+        anchors.centerIn: parent
+        visible: thumbnailGrid.count === 0
+        text: imageModel && imageModel.loading ? qsTr("Listing the folder…") : qsTr("Open an image to browse its folder")
+        color: "#888888"
+        font.pixelSize: 14
+    }
+}
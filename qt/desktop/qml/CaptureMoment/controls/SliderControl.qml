@@ -12,6 +12,10 @@ Control {
     property real to: 100
     property real stepSize: 1
 
+    // Pressed and released: a gesture on the control (a drag, or a click)
+    signal interactionStarted()
+    signal interactionEnded()
+
     implicitHeight: layout.implicitHeight + 16
 
     leftPadding: 8
@@ -40,6 +44,14 @@ Control {
                 sliderControl.value = value
             }
 
+            onPressedChanged: {
+                if (pressed) {
+                    sliderControl.interactionStarted()
+                } else {
+                    sliderControl.interactionEnded()
+                }
+            }
+
             background: Rectangle {
                 x: slider.leftPadding
                 y: slider.topPadding + slider.availableHeight / 2 - height / 2
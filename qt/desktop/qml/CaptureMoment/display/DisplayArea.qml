@@ -132,6 +132,7 @@ Rectangle {
         onAccepted: {
             console.log("Loading image:", selectedFile)
             controller.loadImageFromUrl(selectedFile)
+            folderImageModel.showFolderOf(selectedFile)
         }
     }
 
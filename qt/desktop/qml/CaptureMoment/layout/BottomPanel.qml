@@ -2,6 +2,7 @@ import QtQuick
 import QtQuick.Controls
 import QtQuick.Controls.Material
 import QtQuick.Layouts
+import CaptureMoment.desktop
 
 Rectangle {
     id: bottomPanel
@@ -16,24 +17,20 @@ Rectangle {
 
         // Header
         Text {
-            text: "Collections"
+            text: folderImageModel.folder.length > 0
+                  ? qsTr("Filmstrip") + "  ·  " + folderImageModel.count + " " + qsTr("images")
+                  : qsTr("Filmstrip")
             color: "white"
             font.bold: true
             font.pixelSize: 14
         }
-        
-        // Future content placeholder
-        Rectangle {
+
+        Filmstrip {
             Layout.fillWidth: true
             Layout.fillHeight: true
-            color: Material.Teal
-            radius: 4
-            
-            Text {
-                anchors.centerIn: parent
-                text: "Future: Collections & Gallery"
-                color: Material.foreground
-                font.pixelSize: 12
+
+            onImageActivated: function(fileUrl) {
+                controller.loadImageFromUrl(fileUrl)
             }
         }
     }
@@ -7,6 +7,8 @@ Rectangle {
     id: centerPanel
 
     property alias idDisplayArea: displayArea
+    // true: the thumbnail grid of the current folder instead of the editor
+    property bool showLibrary: false
     color: "#2a2a2a"
 
     ColumnLayout {
@@ -30,10 +32,23 @@ Rectangle {
             }
         }
 
-        DisplayArea {
-            id: displayArea
+        StackLayout {
             Layout.fillWidth: true
             Layout.fillHeight: true
+            currentIndex: centerPanel.showLibrary ? 1 : 0
+
+            DisplayArea {
+                id: displayArea
+            }
+
+            ThumbnailGrid {
+                id: thumbnailGrid
+
+                onImageActivated: function(fileUrl) {
+                    controller.loadImageFromUrl(fileUrl)
+                    centerPanel.showLibrary = false
+                }
+            }
         }
     }
 }
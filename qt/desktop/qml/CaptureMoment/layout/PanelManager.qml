@@ -16,7 +16,7 @@ ColumnLayout {
         }
 
         onBibliothequeClicked: {
-            console.log("Bibliotheque view clicked")
+            centerPanel.showLibrary = !centerPanel.showLibrary
         }
 
         onCollectionsClicked: {
@@ -22,5 +22,8 @@ Item {
             console.log("Value Blacks : ", value)
             blacksControl.setValue(value )
         }
+
+        onInteractionStarted: blacksControl.beginInteraction()
+        onInteractionEnded: blacksControl.endInteraction()
     }
 }
@@ -22,5 +22,8 @@ Item {
             console.log("Value Brightness : ", value)
             brightnessControl.setValue(value )
         }
+
+        onInteractionStarted: brightnessControl.beginInteraction()
+        onInteractionEnded: brightnessControl.endInteraction()
     }
 }
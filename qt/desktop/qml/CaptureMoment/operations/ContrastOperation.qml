@@ -22,5 +22,8 @@ Item {
             console.log("Value Contrast : ", value)
             contrastControl.setValue(value )
         }
+
+        onInteractionStarted: contrastControl.beginInteraction()
+        onInteractionEnded: contrastControl.endInteraction()
     }
 }
@@ -22,5 +22,8 @@ Item {
             console.log("Value Highlights : ", value)
             highlightsControl.setValue(value )
         }
+
+        onInteractionStarted: highlightsControl.beginInteraction()
+        onInteractionEnded: highlightsControl.endInteraction()
     }
 }
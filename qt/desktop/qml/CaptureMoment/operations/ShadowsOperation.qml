@@ -22,5 +22,8 @@ Item {
             console.log("Value Shadows : ", value)
             shadowsControl.setValue(value )
         }
+
+        onInteractionStarted: shadowsControl.beginInteraction()
+        onInteractionEnded: shadowsControl.endInteraction()
     }
 }
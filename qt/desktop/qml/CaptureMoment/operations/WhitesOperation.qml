@@ -22,5 +22,8 @@ Item {
             console.log("Value Whites : ", value)
             whitesControl.setValue(value )
         }
+
+        onInteractionStarted: whitesControl.beginInteraction()
+        onInteractionEnded: whitesControl.endInteraction()
     }
 }
@@ -1,23 +1,41 @@
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
+#include <QQuickWindow>
 
 #include "utils/qml_context_setup.h"
+#include "controller/image_controller_base.h"
+#include "browser/thumbnail_image_provider.h"
 
 #include "rendering/qml_painted_image_item.h"
 #include "rendering/qml_sgs_image_item.h"
 #include "rendering/qml_rhi_image_item.h"
+#include "rendering/qml_rhi_survey_item.h"
 
 #include "core_initialization.h"
+#include "common/trace/startup_profile.h"
+#include "thumbnails/thumbnail_service.h"
 
 #include <spdlog/spdlog.h>
 
+#include <memory>
+#include <optional>
+
 int main(int argc, char *argv[])
 {
+    using CaptureMoment::Core::Common::Trace::ScopedStartupPhase;
+    using CaptureMoment::Core::Common::Trace::StartupProfile;
+
+    // Launch phases are timed from here
+    static_cast<void>(StartupProfile::instance());
+
+    std::optional<ScopedStartupPhase> qt_phase { std::in_place, "ui.qt_application" };
     QGuiApplication app(argc, argv);
     QQmlApplicationEngine engine;
+    qt_phase.reset();
 
     spdlog::info("Initialization");
-    CaptureMoment::Core::initialize();
+    // The backend benchmark (first launch only) and the JIT warm-up run behind the UI
+    CaptureMoment::Core::initialize(false, CaptureMoment::Core::BackendSelection::Background);
 
 
     // Register QML types Rendering
@@ -30,14 +48,25 @@ int main(int argc, char *argv[])
     qmlRegisterType<CaptureMoment::UI::QMLRHIImageItem>(
         "CaptureMoment.UI.Rendering.RHI", 1, 0, "QMLRHIImageItem"
         );
+    qmlRegisterType<CaptureMoment::UI::QMLRHISurveyItem>(
+        "CaptureMoment.UI.Rendering.RHI", 1, 0, "QMLRHISurveyItem"
+        );
 
     // Setup QML context once
     auto context = engine.rootContext();
-    if (!CaptureMoment::UI::QmlContextSetup::setupContext(context)) {
-        spdlog::error("Failed to setup QML context");
-        return -1;
+    {
+        ScopedStartupPhase phase { "ui.context_setup" };
+        if (!CaptureMoment::UI::QmlContextSetup::setupContext(context)) {
+            spdlog::error("Failed to setup QML context");
+            return -1;
+        }
     }
 
+    // Thumbnails of the filmstrip and of the grid (the engine owns the provider)
+    engine.addImageProvider(CaptureMoment::UI::Browser::ThumbnailImageProvider::k_provider_id,
+                            new CaptureMoment::UI::Browser::ThumbnailImageProvider(
+                                std::make_shared<CaptureMoment::Core::Thumbnails::ThumbnailService>()));
+
     // Handle QML engine errors
     QObject::connect(
         &engine,
@@ -48,12 +77,35 @@ int main(int argc, char *argv[])
     );
 
     // Load the main QML module
-    engine.loadFromModule("CaptureMoment.desktop", "DesktopMain");
+    {
+        ScopedStartupPhase phase { "ui.qml_load" };
+        engine.loadFromModule("CaptureMoment.desktop", "DesktopMain");
+    }
 
     if (engine.rootObjects().isEmpty()) {
         spdlog::error("Failed to load QML module");
         return -1;
     }
 
+    // Pace the preview runs on the frames of the main window, which the performance overlay counts
+    if (auto* window = qobject_cast<QQuickWindow*>(engine.rootObjects().first())) {
+        auto controller = CaptureMoment::UI::QmlContextSetup::getControllerMainScene();
+        controller->setPacingWindow(window);
+        controller->performanceMonitor()->setWindow(window);
+
+        // The last session's preview is on screen with the first frame; its image loads behind it
+        {
+            ScopedStartupPhase phase { "ui.session_restore" };
+            static_cast<void>(controller->restoreSession());
+        }
+
+        // Interactive once the first frame is on screen
+        QObject::connect(window, &QQuickWindow::frameSwapped, &app,
+                         [] { StartupProfile::instance().finish(); },
+                         Qt::SingleShotConnection);
+    } else {
+        StartupProfile::instance().finish();
+    }
+
     return app.exec();
 }
@@ -0,0 +1,23 @@
+/**
+ * @file qml_rhi_survey_item.cpp
+ * @brief Implementation of QML QMLRHISurveyItem
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include <spdlog/spdlog.h>
+
+#include "rendering/qml_rhi_survey_item.h"
+
+namespace CaptureMoment::UI {
+
+QMLRHISurveyItem::QMLRHISurveyItem(QQuickItem* parent)
+    : Rendering::RHISurveyItem(parent) {
+    spdlog::debug("QMLRHISurveyItem: Created");
+}
+
+QMLRHISurveyItem::~QMLRHISurveyItem() {
+    spdlog::debug("QMLRHISurveyItem: Destroyed");
+}
+
+} // namespace CaptureMoment::UI
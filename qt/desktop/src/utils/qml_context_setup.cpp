@@ -9,8 +9,10 @@
 #include "controller/image_controller_sgs.h"
 #include "controller/image_controller_rhi.h"
 #include "controller/image_controller_painted.h"
+#include "controller/survey_controller.h"
 
 #include "serializer/serializer_controller.h"
+#include "models/browser/folder_image_model.h"
 
 #include <spdlog/spdlog.h>
 
@@ -19,6 +21,8 @@ namespace CaptureMoment::UI {
 // Static member initialization
 std::shared_ptr<Controller::ImageControllerBase> QmlContextSetup::m_controller_main_scene = nullptr;
 std::unique_ptr<Serializer::SerializerController> QmlContextSetup::m_serializer_controller = nullptr;
+std::unique_ptr<Models::FolderImageModel> QmlContextSetup::m_folder_image_model = nullptr;
+std::unique_ptr<Controller::SurveyController> QmlContextSetup::m_survey_controller = nullptr;
 
 bool QmlContextSetup::setupContext(QQmlContext* context)
 {
@@ -105,6 +109,17 @@ bool QmlContextSetup::registerCoreToQml(QQmlContext* context)
     context->setContextProperty("controller", m_controller_main_scene.get());
     spdlog::debug("Controller Base registered to QML context.");
 
+    context->setContextProperty("performanceMonitor", m_controller_main_scene->performanceMonitor());
+    spdlog::debug("PerformanceMonitor registered to QML context.");
+
+    m_folder_image_model = std::make_unique<Models::FolderImageModel>();
+    context->setContextProperty("folderImageModel", m_folder_image_model.get());
+    spdlog::debug("FolderImageModel registered to QML context.");
+
+    m_survey_controller = std::make_unique<Controller::SurveyController>();
+    context->setContextProperty("surveyController", m_survey_controller.get());
+    spdlog::debug("SurveyController registered to QML context.");
+
     spdlog::info("QmlContextSetup::registerCoreToQml: Objects registered to QML successfully.");
     return true;
 }
@@ -129,6 +144,14 @@ bool QmlContextSetup::registerSerializerToQml(QQmlContext* context)
         return false;
     }
 
+    // The pipeline of an opened image compiles as soon as its sidecar is parsed
+    m_serializer_controller->setOperationsParsedHandler(
+        [controller = std::weak_ptr<Controller::ImageControllerBase>(m_controller_main_scene)](const auto& operations) {
+            if (auto locked = controller.lock()) {
+                locked->warmUpPipeline(operations);
+            }
+        });
+
     context->setContextProperty("serializerController", m_serializer_controller.get());
     spdlog::debug("SerializerController registered to QML context.");
 
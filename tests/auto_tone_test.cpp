@@ -0,0 +1,94 @@
+/**
+ * @file auto_tone_test.cpp
+ * @brief Tests of the auto-tone suggestions read off a histogram.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/auto_tone.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Histogram of a gray image whose codes are spread evenly over [first, last].
+ */
+[[nodiscard]] Common::PreviewHistogram grayRamp(int first, int last, std::uint32_t per_code = 100)
+{
+    Common::PreviewHistogram histogram;
+    for (std::size_t channel = 0; channel < Common::PreviewHistogram::k_channels; ++channel) {
+        for (int code = first; code <= last; ++code) {
+            histogram.m_counts[channel * Common::PreviewHistogram::k_bins + code] = per_code;
+        }
+    }
+    histogram.updateStatistics();
+    return histogram;
+}
+
+} // anonymous namespace
+
+TEST(AutoToneTest, KeepsTheCurrentValuesWithoutPixels)
+{
+    const AutoTone::Settings current { 0.5f, 1.1f, -0.2f, 0.1f };
+    EXPECT_EQ(AutoTone::suggest(Common::PreviewHistogram{}, current), current);
+}
+
+TEST(AutoToneTest, BrightensADarkImageAndDarkensABrightOne)
+{
+    EXPECT_GT(AutoTone::suggest(grayRamp(5, 70)).m_exposure, 0.5f);
+    EXPECT_LT(AutoTone::suggest(grayRamp(170, 250)).m_exposure, -0.5f);
+}
+
+TEST(AutoToneTest, SpreadsAFlatImageOnly)
+{
+    EXPECT_GT(AutoTone::suggest(grayRamp(100, 150)).m_contrast, 1.0f);
+    EXPECT_FLOAT_EQ(AutoTone::suggest(grayRamp(0, 255)).m_contrast, 1.0f);
+}
+
+TEST(AutoToneTest, LeavesClippedHighlightsAlone)
+{
+    auto histogram { grayRamp(20, 200) };
+    for (std::size_t channel = 0; channel < Common::PreviewHistogram::k_channels; ++channel) {
+        histogram.m_counts[channel * Common::PreviewHistogram::k_bins + 255] = 5000;
+    }
+    histogram.updateStatistics();
+
+    EXPECT_FLOAT_EQ(AutoTone::suggest(histogram).m_whites, 0.0f);
+}
+
+TEST(AutoToneTest, RefinesTheCurrentValues)
+{
+    const auto histogram { grayRamp(5, 70) };
+    const auto from_neutral { AutoTone::suggest(histogram) };
+    const auto from_current { AutoTone::suggest(histogram, AutoTone::Settings{ 1.0f, 1.0f, 0.0f, 0.0f }) };
+
+    EXPECT_NEAR(from_current.m_exposure, from_neutral.m_exposure + 1.0f, 1.0e-5f);
+}
+
+TEST(AutoToneTest, AppliesAndReadsBackTheAdjustments)
+{
+    std::vector<OperationDescriptor> operations(1);
+    operations[0].type = OperationType::Exposure;
+    operations[0].name = "Exposure";
+    operations[0].enabled = false;
+    operations[0].setParam(ParameterKey::Value, 2.0f);
+
+    // Disabled: read as the default
+    EXPECT_EQ(AutoTone::read(operations), AutoTone::Settings{});
+
+    const AutoTone::Settings settings { 0.75f, 1.2f, 0.1f, -0.1f };
+    AutoTone::applyTo(operations, settings);
+
+    ASSERT_EQ(operations.size(), 4u);
+    EXPECT_TRUE(operations[0].enabled);
+    EXPECT_EQ(operations[1].type, OperationType::Contrast);
+    EXPECT_EQ(AutoTone::read(operations), settings);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,66 @@
+/**
+ * @file bilateral_grid_test.cpp
+ * @brief Edge preservation tests of the BilateralGrid building block.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/bilateral_grid.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr int k_size { 256 };
+
+/**
+ * @brief Smooths a plane with the grid stages computed at root, as the executor schedules them.
+ */
+[[nodiscard]] Halide::Buffer<float> smoothPlane(const Halide::Buffer<float>& plane)
+{
+    Halide::Var x("x"), y("y");
+    Halide::Func source = Halide::BoundaryConditions::repeat_edge(plane);
+
+    auto result { BilateralGrid::smooth(source, x, y) };
+    for (Halide::Func stage : result.m_stages) {
+        stage.compute_root();
+    }
+    return result.m_output.realize({ k_size, k_size });
+}
+
+} // anonymous namespace
+
+TEST(BilateralGridTest, KeepsAFlatPlaneUnchanged)
+{
+    Halide::Buffer<float> plane(k_size, k_size);
+    plane.fill(0.5f);
+
+    const auto smoothed { smoothPlane(plane) };
+    for (int y = 0; y < k_size; y += 7) {
+        for (int x = 0; x < k_size; x += 7) {
+            EXPECT_NEAR(smoothed(x, y), 0.5f, 1.0e-4f) << "at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+TEST(BilateralGridTest, DoesNotAverageAcrossAStrongEdge)
+{
+    // Vertical step off the cell grid: both sides fall into bins the range blur keeps apart
+    constexpr int k_edge { k_size / 2 + 5 };
+    Halide::Buffer<float> plane(k_size, k_size);
+    for (int y = 0; y < k_size; ++y) {
+        for (int x = 0; x < k_size; ++x) {
+            plane(x, y) = x < k_edge ? 0.2f : 0.8f;
+        }
+    }
+
+    const auto smoothed { smoothPlane(plane) };
+    for (int y = 0; y < k_size; y += 13) {
+        EXPECT_NEAR(smoothed(k_edge - 1, y), 0.2f, 1.0e-3f);
+        EXPECT_NEAR(smoothed(k_edge, y), 0.8f, 1.0e-3f);
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,93 @@
+/**
+ * @file binary_edit_format_test.cpp
+ * @brief Round-trip and validation tests of the binary edit format.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/binary_edit_format.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Serializer {
+
+namespace {
+
+[[nodiscard]] std::vector<Operations::OperationDescriptor> makeEditStack()
+{
+    std::vector<Operations::OperationDescriptor> operations(3);
+
+    operations[0].id = 11;
+    operations[0].type = Operations::OperationType::Exposure;
+    operations[0].name = "Exposure";
+    operations[0].params.set(Operations::ParameterKey::Value, 0.75f);
+
+    operations[1].id = 12;
+    operations[1].type = Operations::OperationType::Contrast;
+    operations[1].name = "Contrast (disabled)";
+    operations[1].enabled = false;
+    operations[1].params.set(Operations::ParameterKey::Value, -0.25f);
+
+    // No parameters and an empty name
+    operations[2].id = 13;
+    operations[2].type = Operations::OperationType::Shadows;
+
+    return operations;
+}
+
+[[nodiscard]] std::span<const std::byte> asBytes(const std::string& encoded)
+{
+    return std::as_bytes(std::span(encoded.data(), encoded.size()));
+}
+
+} // anonymous namespace
+
+TEST(BinaryEditFormatTest, RoundTripsTheEditStack)
+{
+    const auto operations { makeEditStack() };
+    const std::string encoded { encodeEditStack(operations) };
+
+    const auto decoded { decodeEditStack(asBytes(encoded)) };
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), operations.size());
+
+    for (std::size_t i = 0; i < operations.size(); ++i) {
+        EXPECT_EQ((*decoded)[i].id, operations[i].id);
+        EXPECT_EQ((*decoded)[i].type, operations[i].type);
+        EXPECT_EQ((*decoded)[i].name, operations[i].name);
+        EXPECT_EQ((*decoded)[i].enabled, operations[i].enabled);
+        EXPECT_EQ((*decoded)[i].params, operations[i].params);
+    }
+}
+
+TEST(BinaryEditFormatTest, EmptyStackIsJustTheHeader)
+{
+    const std::string encoded { encodeEditStack({}) };
+    EXPECT_EQ(encoded.size(), sizeof(EditFileHeader));
+
+    const auto decoded { decodeEditStack(asBytes(encoded)) };
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_TRUE(decoded->empty());
+}
+
+TEST(BinaryEditFormatTest, RejectsForeignAndTruncatedFiles)
+{
+    const std::string encoded { encodeEditStack(makeEditStack()) };
+
+    std::string foreign { encoded };
+    foreign[0] = 'X';
+    EXPECT_EQ(decodeEditStack(asBytes(foreign)).error(), ErrorHandling::CoreError::UnsupportedFormat);
+
+    const std::string truncated { encoded.substr(0, encoded.size() - 1) };
+    EXPECT_EQ(decodeEditStack(asBytes(truncated)).error(), ErrorHandling::CoreError::DecodingError);
+
+    const std::string header_only { encoded.substr(0, sizeof(EditFileHeader) - 1) };
+    EXPECT_EQ(decodeEditStack(asBytes(header_only)).error(), ErrorHandling::CoreError::DecodingError);
+}
+
+} // namespace CaptureMoment::Core::Serializer
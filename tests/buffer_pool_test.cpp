@@ -0,0 +1,90 @@
+/**
+ * @file buffer_pool_test.cpp
+ * @brief Large BufferPool blocks mapped on huge pages.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief Size class used by no other test, so the free lists start empty.
+ */
+constexpr std::size_t k_block_bytes = std::size_t{21} * 1024 * 1024 + 4321;
+
+/**
+ * @brief Restores regular pages after each test.
+ */
+class BufferPoolTest : public ::testing::Test {
+protected:
+    void TearDown() override
+    {
+        BufferPool::instance().setHugePages(BufferPool::HugePages::Off);
+        BufferPool::instance().trim();
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(BufferPoolTest, RegularPagesMapNoHugePage)
+{
+    auto& pool { BufferPool::instance() };
+    const std::size_t before { pool.hugePageAllocationCount() };
+
+    void* block { pool.acquire(k_block_bytes) };
+    pool.release(block, k_block_bytes);
+    pool.trim();
+    EXPECT_EQ(pool.hugePageAllocationCount(), before);
+}
+
+#if defined(__linux__)
+TEST_F(BufferPoolTest, HugePageBlocksAreAlignedAndRecycled)
+{
+    auto& pool { BufferPool::instance() };
+    pool.setHugePages(BufferPool::HugePages::Transparent);
+    const std::size_t before { pool.hugePageAllocationCount() };
+
+    auto* block { static_cast<std::byte*>(pool.acquire(k_block_bytes)) };
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(pool.hugePageAllocationCount(), before + 1);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % BufferPool::k_huge_page_size, 0u);
+
+    // The whole size class is mapped
+    std::memset(block, 0x5A, BufferPool::sizeClass(k_block_bytes));
+    pool.release(block, k_block_bytes);
+
+    // Recycled as it is, even once the pool is back to regular pages
+    pool.setHugePages(BufferPool::HugePages::Off);
+    void* recycled { pool.acquire(k_block_bytes) };
+    EXPECT_EQ(recycled, block);
+    EXPECT_EQ(static_cast<std::byte*>(recycled)[k_block_bytes - 1], std::byte { 0x5A });
+    pool.release(recycled, k_block_bytes);
+
+    // Unmapped, not deleted
+    pool.trim();
+    EXPECT_EQ(pool.cachedBytes(), 0u);
+}
+
+TEST_F(BufferPoolTest, SmallBlocksStayOnRegularPages)
+{
+    auto& pool { BufferPool::instance() };
+    pool.setHugePages(BufferPool::HugePages::Explicit);
+    const std::size_t before { pool.hugePageAllocationCount() };
+
+    constexpr std::size_t bytes { BufferPool::k_huge_page_threshold / 2 + 99 };
+    void* block { pool.acquire(bytes) };
+    pool.release(block, bytes);
+    EXPECT_EQ(pool.hugePageAllocationCount(), before);
+}
+#endif
+
+} // namespace CaptureMoment::Core::Common
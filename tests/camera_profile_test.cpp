@@ -0,0 +1,167 @@
+/**
+ * @file camera_profile_test.cpp
+ * @brief Profile parsing and white balance development tests of CameraProfile and OperationWhiteBalance.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/camera_profile.h"
+#include "operations/color_operations/operation_white_balance.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Camera to sRGB matrix of LibRaw's layout (3 rows of 4 columns), a plausible camera.
+ */
+constexpr std::array<float, 12> k_rgb_cam{
+     1.70f, -0.55f, -0.15f, 0.0f,
+    -0.20f,  1.55f, -0.35f, 0.0f,
+     0.05f, -0.50f,  1.45f, 0.0f
+};
+
+/**
+ * @brief As-shot multipliers (R, G, B, G2), not normalized.
+ */
+constexpr std::array<float, 4> k_cam_mul{ 2048.0f, 1024.0f, 1536.0f, 1024.0f };
+
+[[nodiscard]] OperationDescriptor whiteBalance(const CameraProfile& profile, float temperature = 0.0f, float tint = 0.0f)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::WhiteBalance;
+    descriptor.name = "WhiteBalance";
+    descriptor.setParam(ParameterKey::CameraProfile, profile.format());
+    descriptor.setParam(ParameterKey::Temperature, temperature);
+    descriptor.setParam(ParameterKey::Tint, tint);
+    return descriptor;
+}
+
+} // anonymous namespace
+
+TEST(CameraProfileTest, BuildsFromLibRawData)
+{
+    const auto profile { CameraProfile::fromLibRaw(k_cam_mul, k_rgb_cam) };
+    ASSERT_TRUE(profile.has_value());
+    EXPECT_FLOAT_EQ(profile->m_multipliers[0], 2.0f);
+    EXPECT_FLOAT_EQ(profile->m_multipliers[1], 1.0f);
+    EXPECT_FLOAT_EQ(profile->m_multipliers[2], 1.5f);
+
+    // rgb_cam rows sum to 1 (white maps to white), and so do the sRGB to ProPhoto rows
+    for (int row = 0; row < 3; ++row) {
+        const float sum { profile->m_matrix[row * 3] + profile->m_matrix[row * 3 + 1] + profile->m_matrix[row * 3 + 2] };
+        EXPECT_NEAR(sum, 1.0f, 1.0e-4f);
+    }
+
+    // Missing as-shot data or matrix: no profile
+    EXPECT_FALSE(CameraProfile::fromLibRaw(std::array<float, 4>{}, k_rgb_cam).has_value());
+    EXPECT_FALSE(CameraProfile::fromLibRaw(k_cam_mul, std::array<float, 12>{}).has_value());
+    EXPECT_FALSE(CameraProfile::fromLibRaw(k_cam_mul, {}).has_value());
+}
+
+TEST(CameraProfileTest, FormatRoundTrips)
+{
+    const auto profile { CameraProfile::fromLibRaw(k_cam_mul, k_rgb_cam) };
+    ASSERT_TRUE(profile.has_value());
+    const auto parsed { CameraProfile::parse(profile->format()) };
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(*parsed, *profile);
+
+    EXPECT_FALSE(CameraProfile::parse("").has_value());
+    EXPECT_FALSE(CameraProfile::parse("1,1,1").has_value());
+    EXPECT_FALSE(CameraProfile::parse("1,1;1,0,0,0,1,0,0,0,1").has_value());
+    EXPECT_FALSE(CameraProfile::parse("1,0,1;1,0,0,0,1,0,0,0,1").has_value());
+    EXPECT_FALSE(CameraProfile::parse("1,1,1;1,0,0,0,1,0,0,0,1,0").has_value());
+}
+
+TEST(CameraProfileTest, ShiftsMoveTheGainsInStops)
+{
+    const CameraProfile profile;
+    const auto warm { profile.multipliers(1.0f, 0.0f) };
+    EXPECT_NEAR(warm[0] / warm[2], 2.0f, 1.0e-5f);
+    EXPECT_FLOAT_EQ(warm[1], 1.0f);
+
+    const auto magenta { profile.multipliers(0.0f, 1.0f) };
+    EXPECT_NEAR(magenta[1], 1.0f / std::exp2(CameraProfile::k_tint_stops), 1.0e-5f);
+
+    // Out of range shifts are clamped
+    EXPECT_EQ(profile.multipliers(5.0f, -5.0f), profile.multipliers(1.0f, -1.0f));
+}
+
+TEST(CameraProfileTest, AttachMovesOrInsertsTheWhiteBalanceFirst)
+{
+    const std::string text { CameraProfile{}.format() };
+
+    OperationDescriptor exposure;
+    exposure.type = OperationType::Exposure;
+    exposure.setParam(ParameterKey::Value, 0.5f);
+
+    // Inserted at the head
+    std::vector<OperationDescriptor> inserted { exposure };
+    CameraProfile::attachTo(inserted, text);
+    ASSERT_EQ(inserted.size(), 2u);
+    EXPECT_EQ(inserted.front().type, OperationType::WhiteBalance);
+    EXPECT_EQ(inserted.front().getParam<std::string>(ParameterKey::CameraProfile).value_or(""), text);
+
+    // The user's white balance is moved to the head, with its shifts
+    OperationDescriptor user;
+    user.type = OperationType::WhiteBalance;
+    user.setParam(ParameterKey::Temperature, 0.25f);
+    std::vector<OperationDescriptor> moved { exposure, user };
+    CameraProfile::attachTo(moved, text);
+    ASSERT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved.front().type, OperationType::WhiteBalance);
+    EXPECT_FLOAT_EQ(moved.front().getParam<float>(ParameterKey::Temperature).value_or(0.0f), 0.25f);
+    EXPECT_EQ(moved.back().type, OperationType::Exposure);
+
+    // No profile: unchanged
+    std::vector<OperationDescriptor> developed { exposure };
+    CameraProfile::attachTo(developed, std::nullopt);
+    EXPECT_EQ(developed.size(), 1u);
+}
+
+TEST(OperationWhiteBalanceTest, DevelopsNeutralsAndClipsHighlights)
+{
+    const auto profile { CameraProfile::fromLibRaw(k_cam_mul, k_rgb_cam) };
+    ASSERT_TRUE(profile.has_value());
+
+    // A gray card as the camera saw it (1 / multipliers), then a saturated pixel
+    Common::PixelBuffer data {
+        0.25f, 0.5f, 1.0f / 3.0f, 1.0f,
+        1.0f, 1.0f, 1.0f, 1.0f
+    };
+    Common::ImageRegion region(std::move(data), 2, 1, 4);
+    ASSERT_TRUE(OperationWhiteBalance{}.executeOnImageRegion(region, whiteBalance(*profile)).has_value());
+
+    const auto pixels { region.getBuffer() };
+    for (int c = 0; c < 3; ++c) {
+        EXPECT_NEAR(pixels[c], 0.5f, 1.0e-4f) << "gray channel " << c;
+        EXPECT_NEAR(pixels[4 + c], 1.0f, 1.0e-4f) << "clipped channel " << c;
+    }
+    EXPECT_FLOAT_EQ(pixels[3], 1.0f);
+}
+
+TEST(OperationWhiteBalanceTest, ShiftsDevelopedSourcesWithoutClipping)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::WhiteBalance;
+    descriptor.setParam(ParameterKey::Temperature, 1.0f);
+
+    Common::PixelBuffer data { 2.0f, 2.0f, 2.0f, 1.0f };
+    Common::ImageRegion region(std::move(data), 1, 1, 4);
+    ASSERT_TRUE(OperationWhiteBalance{}.executeOnImageRegion(region, descriptor).has_value());
+
+    const auto pixels { region.getBuffer() };
+    EXPECT_NEAR(pixels[0], 2.0f * std::sqrt(2.0f), 1.0e-4f);
+    EXPECT_FLOAT_EQ(pixels[1], 2.0f);
+    EXPECT_NEAR(pixels[2], 2.0f / std::sqrt(2.0f), 1.0e-4f);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,113 @@
+/**
+ * @file card_importer_test.cpp
+ * @brief Checksummed copies, name clashes and duplicates of CardImporter.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/card_importer.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief A fake card and a catalog in a fresh directory, removed with the fixture.
+ */
+class CardImporterTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        std::filesystem::remove_all(m_dir);
+        std::filesystem::create_directories(m_dir / "card" / "100CAMERA");
+        std::filesystem::create_directories(m_dir / "card" / "101CAMERA");
+        auto catalog { CatalogDatabase::open(m_dir / "catalog.db") };
+        ASSERT_TRUE(catalog.has_value());
+        m_catalog = std::move(*catalog);
+    }
+
+    void TearDown() override
+    {
+        m_catalog.reset();
+        std::filesystem::remove_all(m_dir);
+    }
+
+    /**
+     * @brief Writes a file on the card.
+     */
+    [[nodiscard]] std::string write(const std::string& name, const std::string& content) const
+    {
+        const std::filesystem::path path { m_dir / "card" / name };
+        std::ofstream(path, std::ios::binary) << content;
+        return path.string();
+    }
+
+    const std::filesystem::path m_dir { std::filesystem::temp_directory_path() / "capturemoment_import_test" };
+    std::unique_ptr<CatalogDatabase> m_catalog;
+};
+
+} // anonymous namespace
+
+TEST_F(CardImporterTest, CopyHashesWhatItWrites)
+{
+    // Larger than a block, not a multiple of it
+    std::string content(CardImporter::k_block_bytes + 12345, '\0');
+    for (std::size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i * 7);
+    }
+    const std::string source { write("100CAMERA/big.bin", content) };
+
+    std::vector<std::byte> buffer(CardImporter::k_block_bytes);
+    const auto copied { CardImporter::copyFile(source, m_dir / "copy.bin", buffer) };
+    ASSERT_TRUE(copied.has_value());
+    EXPECT_EQ(std::filesystem::file_size(m_dir / "copy.bin"), content.size());
+    EXPECT_EQ(CardImporter::hashFile(m_dir / "copy.bin", buffer), *copied);
+    EXPECT_EQ(CardImporter::hashFile(source, buffer), *copied);
+
+    // Never overwrites
+    EXPECT_EQ(CardImporter::copyFile(source, m_dir / "copy.bin", buffer).error(), ErrorHandling::CoreError::IOError);
+}
+
+TEST_F(CardImporterTest, SameNamesAreKeptApartAndDuplicatesDropped)
+{
+    const std::vector<std::string> sources {
+        write("100CAMERA/IMG_0001.JPG", "first"),
+        write("101CAMERA/IMG_0001.JPG", "second"),
+        write("101CAMERA/IMG_0002.JPG", "first"),
+    };
+
+    ImportSettings settings;
+    settings.m_destination = m_dir / "library";
+    CardImporter importer(*m_catalog);
+    const auto results { importer.run(sources, settings) };
+    ASSERT_EQ(results.size(), 3u);
+
+    std::size_t copied { 0 };
+    std::size_t duplicates { 0 };
+    for (const auto& result : results) {
+        ASSERT_TRUE(result.m_status.has_value()) << result.m_source_path;
+        EXPECT_NE(result.m_content_hash, 0u);
+        (*result.m_status == ImportOutcome::Copied ? copied : duplicates) += 1;
+    }
+    EXPECT_EQ(copied, 2u);
+    EXPECT_EQ(duplicates, 1u);
+    EXPECT_EQ(results[0].m_content_hash, results[2].m_content_hash);
+    EXPECT_NE(results[0].m_destination_path, results[1].m_destination_path);
+
+    // Only the kept copies remain, no part file
+    std::size_t files { 0 };
+    for (const auto& entry : std::filesystem::directory_iterator(settings.m_destination)) {
+        EXPECT_EQ(entry.path().extension(), ".JPG");
+        ++files;
+    }
+    EXPECT_EQ(files, 2u);
+}
+
+} // namespace CaptureMoment::Core::Catalog
@@ -0,0 +1,302 @@
+/**
+ * @file catalog_database_test.cpp
+ * @brief Import, grid paging, edits, keywords and thumbnails of CatalogDatabase, and the
+ *        sidecar edits served by CatalogEditsReader.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/catalog_database.h"
+#include "catalog/catalog_edits_reader.h"
+#include "serializer/strategy/sidecar_xmp_path_strategy.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Catalog in a fresh directory, removed with the fixture.
+ */
+class CatalogDatabaseTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        std::filesystem::remove_all(m_dir);
+        auto catalog { CatalogDatabase::open(m_dir / "catalog.db") };
+        ASSERT_TRUE(catalog.has_value());
+        m_catalog = std::move(*catalog);
+    }
+
+    void TearDown() override
+    {
+        m_catalog.reset();
+        std::filesystem::remove_all(m_dir);
+    }
+
+    /**
+     * @brief Record of a (fictitious) file, without touching the disk.
+     */
+    [[nodiscard]] static ImageRecord record(const std::string& folder, const std::string& name, const std::string& date)
+    {
+        ImageRecord image;
+        image.m_path = folder + "/" + name;
+        image.m_file_size = 1000;
+        image.m_metadata.m_width = 6000;
+        image.m_metadata.m_height = 4000;
+        image.m_metadata.m_capture_date = date;
+        image.m_metadata.m_camera_model = "Camera";
+        return image;
+    }
+
+    [[nodiscard]] ImageId idOf(const std::string& path) const
+    {
+        const auto found { m_catalog->findImage(path) };
+        return found && *found ? (*found)->m_id : 0;
+    }
+
+    const std::filesystem::path m_dir { std::filesystem::temp_directory_path() / "capturemoment_catalog_test" };
+    std::unique_ptr<CatalogDatabase> m_catalog;
+};
+
+/**
+ * @brief Sidecar reader returning one exposure of the given value, counting its parses.
+ */
+class CountingReader final : public Serializer::IFileSerializerReader {
+public:
+    CountingReader(std::atomic<int>& parses, float value)
+        : m_parses(parses)
+        , m_value(value)
+    {
+    }
+
+    [[nodiscard]] std::vector<Operations::OperationDescriptor> loadFromFile(std::string_view) const override
+    {
+        ++m_parses;
+        Operations::OperationDescriptor exposure;
+        exposure.type = Operations::OperationType::Exposure;
+        exposure.name = "Exposure";
+        exposure.params.set(Operations::ParameterKey::Value, m_value);
+        return { exposure };
+    }
+
+private:
+    std::atomic<int>& m_parses;
+    float m_value;
+};
+
+} // anonymous namespace
+
+TEST_F(CatalogDatabaseTest, ImportSpansSeveralBatchesAndUpdatesInPlace)
+{
+    std::vector<ImageRecord> records;
+    for (std::size_t i = 0; i < CatalogDatabase::k_import_batch_rows + 10; ++i) {
+        records.push_back(record("/photos/a", "img" + std::to_string(i) + ".cr3", "2026:01:01 10:00:00"));
+    }
+    ASSERT_EQ(m_catalog->addImages(records), records.size());
+    EXPECT_EQ(m_catalog->imageCount(), records.size());
+
+    const ImageId id { idOf("/photos/a/img3.cr3") };
+    ASSERT_NE(id, 0);
+    ASSERT_TRUE(m_catalog->setRating(id, 4).has_value());
+
+    // Re-import: metadata refreshed, rating kept, no duplicate
+    records[3].m_metadata.m_lens = "Lens";
+    ASSERT_TRUE(m_catalog->addImages(std::span(records).subspan(3, 1)).has_value());
+    EXPECT_EQ(m_catalog->imageCount(), records.size());
+
+    const auto found { m_catalog->findImage("/photos/a/img3.cr3") };
+    ASSERT_TRUE(found && *found);
+    EXPECT_EQ((*found)->m_id, id);
+    EXPECT_EQ((*found)->m_metadata.m_lens, "Lens");
+    EXPECT_EQ((*found)->m_rating, 4);
+    EXPECT_EQ((*found)->m_metadata.m_width, 6000u);
+
+    EXPECT_EQ(m_catalog->setRating(id + 100000, 1).error(), ErrorHandling::CoreError::NotInCatalog);
+}
+
+TEST_F(CatalogDatabaseTest, GridPagesFollowTheCaptureDateWithoutGapsOrRepeats)
+{
+    const std::vector<ImageRecord> records {
+        record("/photos/a", "c.jpg", "2026:03:01 09:00:00"),
+        record("/photos/a", "a.jpg", "2026:01:01 09:00:00"),
+        record("/photos/b", "x.jpg", "2026:02:01 09:00:00"),
+        record("/photos/a", "b.jpg", "2026:01:01 09:00:00"),
+        record("/photos/a", "d.jpg", ""),
+    };
+    ASSERT_TRUE(m_catalog->addImages(records).has_value());
+
+    GridQuery query;
+    query.m_limit = 2;
+    std::vector<std::string> paths;
+    for (;;) {
+        const auto page { m_catalog->queryGrid(query) };
+        ASSERT_TRUE(page.has_value());
+        for (const auto& image : *page) {
+            paths.push_back(image.m_path);
+        }
+        if (page->size() < query.m_limit) {
+            break;
+        }
+        query.m_after = GridCursor::after(page->back());
+    }
+    const std::vector<std::string> expected { "/photos/a/d.jpg", "/photos/a/a.jpg", "/photos/a/b.jpg",
+                                              "/photos/b/x.jpg", "/photos/a/c.jpg" };
+    EXPECT_EQ(paths, expected);
+
+    GridQuery folder;
+    folder.m_folder = "/photos/b";
+    const auto in_folder { m_catalog->queryGrid(folder) };
+    ASSERT_TRUE(in_folder.has_value());
+    ASSERT_EQ(in_folder->size(), 1u);
+    EXPECT_EQ(in_folder->front().m_path, "/photos/b/x.jpg");
+
+    ASSERT_TRUE(m_catalog->setRating(idOf("/photos/a/c.jpg"), 5).has_value());
+    GridQuery rated;
+    rated.m_min_rating = 3;
+    const auto five_stars { m_catalog->queryGrid(rated) };
+    ASSERT_TRUE(five_stars.has_value());
+    ASSERT_EQ(five_stars->size(), 1u);
+    EXPECT_EQ(five_stars->front().m_path, "/photos/a/c.jpg");
+}
+
+TEST_F(CatalogDatabaseTest, KeywordsTagImagesAndFilterTheGrid)
+{
+    ASSERT_TRUE(m_catalog->addImages(std::vector {
+        record("/photos/a", "1.jpg", "2026:01:01 09:00:00"),
+        record("/photos/a", "2.jpg", "2026:01:02 09:00:00"),
+        record("/photos/b", "3.jpg", "2026:01:03 09:00:00"),
+    }).has_value());
+
+    const std::vector<ImageId> tagged { idOf("/photos/a/2.jpg"), idOf("/photos/b/3.jpg") };
+    ASSERT_TRUE(m_catalog->tagImages(tagged, "Beach").has_value());
+    ASSERT_TRUE(m_catalog->tagImages(std::span(tagged).first(1), "Sunset").has_value());
+
+    EXPECT_EQ(m_catalog->keywordsOf(tagged[0]), (std::vector<std::string> { "Beach", "Sunset" }));
+
+    GridQuery beach;
+    beach.m_keyword = "beach";
+    const auto page { m_catalog->queryGrid(beach) };
+    ASSERT_TRUE(page.has_value());
+    EXPECT_EQ(page->size(), 2u);
+
+    beach.m_folder = "/photos/b";
+    const auto in_folder { m_catalog->queryGrid(beach) };
+    ASSERT_TRUE(in_folder.has_value());
+    ASSERT_EQ(in_folder->size(), 1u);
+    EXPECT_EQ(in_folder->front().m_path, "/photos/b/3.jpg");
+
+    // An unknown image rolls the whole tagging back
+    const std::vector<ImageId> unknown { tagged[0], 999999 };
+    EXPECT_EQ(m_catalog->tagImages(unknown, "Rollback").error(), ErrorHandling::CoreError::NotInCatalog);
+    EXPECT_EQ(m_catalog->keywordsOf(tagged[0])->size(), 2u);
+}
+
+TEST_F(CatalogDatabaseTest, EditsAndThumbnailsRoundTrip)
+{
+    ASSERT_TRUE(m_catalog->addImages(std::vector { record("/photos/a", "1.jpg", "2026:01:01 09:00:00") }).has_value());
+    const ImageId id { idOf("/photos/a/1.jpg") };
+
+    EXPECT_TRUE(m_catalog->loadEdits(id)->empty());
+
+    Operations::OperationDescriptor exposure;
+    exposure.id = 1;
+    exposure.type = Operations::OperationType::Exposure;
+    exposure.name = "Exposure";
+    exposure.params.set(Operations::ParameterKey::Value, 0.75f);
+    ASSERT_TRUE(m_catalog->saveEdits(id, std::vector { exposure }).has_value());
+
+    const auto edits { m_catalog->loadEdits(id) };
+    ASSERT_TRUE(edits.has_value());
+    ASSERT_EQ(edits->size(), 1u);
+    EXPECT_EQ(edits->front().type, Operations::OperationType::Exposure);
+    EXPECT_EQ(edits->front().params.get<float>(Operations::ParameterKey::Value), 0.75f);
+
+    Thumbnails::Thumbnail thumbnail;
+    thumbnail.m_width = 2;
+    thumbnail.m_height = 1;
+    thumbnail.m_format = "jpeg";
+    thumbnail.m_encoded = { std::byte { 1 }, std::byte { 2 }, std::byte { 3 } };
+    thumbnail.m_perceptual_hash = 0xF0F0F0F0F0F0F0F0ull;
+    ASSERT_TRUE(m_catalog->storeThumbnail(id, 42, thumbnail).has_value());
+
+    // The hash goes to the record, where the duplicate grouping reads it
+    const auto hashes { m_catalog->perceptualHashes() };
+    ASSERT_TRUE(hashes.has_value());
+    ASSERT_EQ(hashes->size(), 1u);
+    EXPECT_EQ(hashes->front().m_id, id);
+    EXPECT_EQ(hashes->front().m_hash, thumbnail.m_perceptual_hash);
+
+    const auto stored { m_catalog->loadThumbnail(id, 42) };
+    ASSERT_TRUE(stored && *stored);
+    EXPECT_EQ((*stored)->m_encoded, thumbnail.m_encoded);
+    EXPECT_EQ((*stored)->m_format, "jpeg");
+
+    // Rendered with other edits: stale
+    EXPECT_FALSE(m_catalog->loadThumbnail(id, 43)->has_value());
+
+    EXPECT_EQ(m_catalog->saveEdits(id + 1, std::vector { exposure }).error(), ErrorHandling::CoreError::NotInCatalog);
+}
+
+TEST_F(CatalogDatabaseTest, FolderTreesListAndRemoveTheirImages)
+{
+    ASSERT_TRUE(m_catalog->addImages(std::vector {
+        record("/photos/a", "1.jpg", "2026:01:01 09:00:00"),
+        record("/photos/a/sub", "2.jpg", "2026:01:02 09:00:00"),
+        record("/photos/ab", "3.jpg", "2026:01:03 09:00:00"),
+    }).has_value());
+
+    // "/photos/ab" shares the prefix but is not below "/photos/a"
+    EXPECT_EQ(m_catalog->foldersUnder("/photos/a"), (std::vector<std::string> { "/photos/a", "/photos/a/sub" }));
+    EXPECT_EQ(m_catalog->folderImages("/photos/a")->size(), 1u);
+
+    ASSERT_TRUE(m_catalog->setSidecarMtime(idOf("/photos/a/1.jpg"), 1234).has_value());
+    EXPECT_EQ((*m_catalog->findImage("/photos/a/1.jpg"))->m_sidecar_mtime, 1234);
+
+    const std::vector<std::string> removed { "/photos/a/sub/2.jpg", "/photos/a/unknown.jpg" };
+    EXPECT_EQ(m_catalog->removeImages(removed), 1u);
+    EXPECT_EQ(m_catalog->imageCount(), 2u);
+    EXPECT_FALSE(m_catalog->findImage("/photos/a/sub/2.jpg")->has_value());
+}
+
+TEST_F(CatalogDatabaseTest, UnchangedSidecarsAreServedFromTheCatalog)
+{
+    std::filesystem::create_directories(m_dir / "photos");
+    const std::string image { (m_dir / "photos" / "1.jpg").string() };
+    ASSERT_TRUE(m_catalog->addImages(std::vector { record((m_dir / "photos").string(), "1.jpg", "2026:01:01 09:00:00") }).has_value());
+    std::ofstream(image + ".xmp") << "<x:xmpmeta/>";
+
+    std::atomic<int> parses { 0 };
+    const CatalogEditsReader reader(*m_catalog, std::make_unique<Serializer::SidecarXmpPathStrategy>(),
+                                    std::make_unique<CountingReader>(parses, 0.5f));
+
+    // First open parses, the next ones read the catalog
+    ASSERT_EQ(reader.loadFromFile(image).size(), 1u);
+    const auto cached { reader.loadFromFile(image) };
+    EXPECT_EQ(parses, 1);
+    ASSERT_EQ(cached.size(), 1u);
+    EXPECT_EQ(cached.front().params.get<float>(Operations::ParameterKey::Value), 0.5f);
+
+    const auto stamped { m_catalog->findSidecarEdits(image) };
+    ASSERT_TRUE(stamped && *stamped);
+    EXPECT_EQ((*stamped)->m_sidecar_size, std::filesystem::file_size(image + ".xmp"));
+
+    // Another size: parsed again
+    std::ofstream(image + ".xmp") << "<x:xmpmeta></x:xmpmeta>";
+    EXPECT_EQ(reader.loadFromFile(image).size(), 1u);
+    EXPECT_EQ(parses, 2);
+
+    // A stamp recorded without reading the edits is never served
+    ASSERT_TRUE(m_catalog->setSidecarMtime((*stamped)->m_id, (*stamped)->m_sidecar_mtime).has_value());
+    EXPECT_EQ(reader.loadFromFile(image).size(), 1u);
+    EXPECT_EQ(parses, 3);
+}
+
+} // namespace CaptureMoment::Core::Catalog
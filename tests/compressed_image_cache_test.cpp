@@ -0,0 +1,92 @@
+/**
+ * @file compressed_image_cache_test.cpp
+ * @brief Round trip and eviction tests of CompressedImageCache.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/compressed_image_cache.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+/**
+ * @brief RGBA float image with smooth gradients, taller than a band and not a multiple of it.
+ */
+[[nodiscard]] OIIO::ImageBuf gradientImage(int width, int height)
+{
+    OIIO::ImageSpec spec(width, height, 4, OIIO::TypeDesc::FLOAT);
+    spec.attribute("Orientation", 6);
+    OIIO::ImageBuf image(spec);
+    std::vector<float> pixels(static_cast<std::size_t>(width) * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float* pixel { pixels.data() + (static_cast<std::size_t>(y) * width + x) * 4 };
+            pixel[0] = static_cast<float>(x) / width;
+            pixel[1] = static_cast<float>(y) / height * 4.0f;
+            pixel[2] = 0.01f * static_cast<float>((x + y) % 7);
+            pixel[3] = 1.0f;
+        }
+    }
+    image.set_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, pixels.data());
+    return image;
+}
+
+} // anonymous namespace
+
+TEST(CompressedImageCacheTest, RestoresPixelsToHalfPrecision)
+{
+    constexpr int width { 97 };
+    constexpr int height { 2 * CompressedImageCache::k_band_rows + 13 };
+    const OIIO::ImageBuf image { gradientImage(width, height) };
+
+    CompressedImageCache cache;
+    cache.store("a.jpg", image);
+    ASSERT_TRUE(cache.contains("a.jpg"));
+    EXPECT_LT(cache.sizeBytes(), image.spec().image_bytes());
+
+    const auto restored { cache.load("a.jpg") };
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->spec().width, width);
+    EXPECT_EQ(restored->spec().height, height);
+    EXPECT_EQ(restored->spec().format, OIIO::TypeDesc::FLOAT);
+    EXPECT_EQ(restored->spec().get_int_attribute("Orientation"), 6);
+
+    std::vector<float> expected(static_cast<std::size_t>(width) * height * 4);
+    std::vector<float> actual(expected.size());
+    ASSERT_TRUE(image.get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, expected.data()));
+    ASSERT_TRUE(restored->get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, actual.data()));
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        // Half floats: 11 significant bits
+        ASSERT_NEAR(actual[i], expected[i], std::abs(expected[i]) * 1.0e-3f + 1.0e-6f) << i;
+    }
+}
+
+TEST(CompressedImageCacheTest, KeepsTheMostRecentEntries)
+{
+    const OIIO::ImageBuf image { gradientImage(16, 16) };
+
+    CompressedImageCache cache(CompressedImageCache::k_default_capacity_bytes, 2);
+    cache.store("a.jpg", image);
+    cache.store("b.jpg", image);
+    ASSERT_NE(cache.load("a.jpg"), nullptr);
+    cache.store("c.jpg", image);
+
+    // b was the least recently used
+    EXPECT_TRUE(cache.contains("a.jpg"));
+    EXPECT_FALSE(cache.contains("b.jpg"));
+    EXPECT_TRUE(cache.contains("c.jpg"));
+    EXPECT_EQ(cache.load("b.jpg"), nullptr);
+
+    EXPECT_GT(cache.evictBytes(cache.sizeBytes()), 0u);
+    EXPECT_EQ(cache.sizeBytes(), 0u);
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,111 @@
+/**
+ * @file compute_pool_test.cpp
+ * @brief Iterations, failures, nesting and lane preemption of ComputePool.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "workers/compute_pool.h"
+#include "workers/engine_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace CaptureMoment::Core::Workers {
+
+namespace {
+
+/**
+ * @brief Restores the default budget after a test changed it.
+ */
+class ComputePoolTest : public ::testing::Test {
+protected:
+    void SetUp() override { ComputePool::instance().setConcurrency(4); }
+    void TearDown() override { ComputePool::instance().setConcurrency(0); }
+};
+
+} // anonymous namespace
+
+TEST_F(ComputePoolTest, RunsEveryIterationOnce)
+{
+    std::vector<std::atomic<int>> runs(1000);
+    const int status { ComputePool::instance().parallelFor(TaskPriority::Refine, 1000, [&runs](int index) {
+        runs[static_cast<std::size_t>(index)].fetch_add(1);
+        return 0;
+    }) };
+
+    EXPECT_EQ(status, 0);
+    for (const auto& count : runs) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST_F(ComputePoolTest, StopsAtTheFirstFailure)
+{
+    std::atomic<int> started { 0 };
+    const int status { ComputePool::instance().parallelFor(TaskPriority::Export, 10'000, [&started](int index) {
+        started.fetch_add(1);
+        return index == 10 ? -1 : 0;
+    }) };
+
+    EXPECT_EQ(status, -1);
+    EXPECT_LT(started.load(), 10'000);
+}
+
+TEST_F(ComputePoolTest, NestedLoopsComplete)
+{
+    std::atomic<int> inner { 0 };
+    const int status { ComputePool::instance().parallelFor(TaskPriority::Refine, 16, [&inner](int) {
+        return ComputePool::instance().parallelFor(TaskPriority::Refine, 16, [&inner](int) {
+            inner.fetch_add(1);
+            return 0;
+        });
+    }) };
+
+    EXPECT_EQ(status, 0);
+    EXPECT_EQ(inner.load(), 256);
+}
+
+TEST_F(ComputePoolTest, InteractiveLoopPreemptsExport)
+{
+    using namespace std::chrono_literals;
+
+    // A long export keeps every helper busy, one short iteration at a time
+    std::atomic<bool> interactive_done { false };
+    std::atomic<int> export_helpers_seen { 0 };
+    std::thread exporter([&]() {
+        EngineScheduler::ScopedPriority scope { TaskPriority::Export };
+        ComputePool::instance().parallelFor(TaskPriority::Export, 1'000'000, [&](int) {
+            if (interactive_done.load()) {
+                return 1;
+            }
+            export_helpers_seen.fetch_add(1);
+            std::this_thread::sleep_for(100us);
+            return 0;
+        });
+    });
+    while (export_helpers_seen.load() < 100) {
+        std::this_thread::yield();
+    }
+
+    // The interactive loop gets helpers back between two export iterations
+    std::vector<std::thread::id> ids(64);
+    ComputePool::instance().parallelFor(TaskPriority::Interactive, 64, [&](int index) {
+        ids[static_cast<std::size_t>(index)] = std::this_thread::get_id();
+        std::this_thread::sleep_for(2ms);
+        return 0;
+    });
+    interactive_done.store(true);
+    exporter.join();
+
+    std::ranges::sort(ids);
+    const auto distinct { std::ranges::distance(ids.begin(), std::ranges::unique(ids).begin()) };
+    EXPECT_GT(distinct, 1);
+}
+
+} // namespace CaptureMoment::Core::Workers
@@ -0,0 +1,136 @@
+/**
+ * @file crop_geometry_test.cpp
+ * @brief Rectangle, sampling and extraction tests of CropGeometry, and straightening of OperationCrop.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/crop_geometry.h"
+#include "operations/geometry_operations/operation_crop.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor crop(float left, float top, float right, float bottom, float angle = 0.0f)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::Crop;
+    descriptor.name = "Crop";
+    descriptor.setParam(ParameterKey::CropLeft, left);
+    descriptor.setParam(ParameterKey::CropTop, top);
+    descriptor.setParam(ParameterKey::CropRight, right);
+    descriptor.setParam(ParameterKey::CropBottom, bottom);
+    descriptor.setParam(ParameterKey::Angle, angle);
+    return descriptor;
+}
+
+/**
+ * @brief Single-channel image whose pixel value is its index.
+ */
+[[nodiscard]] Common::ImageRegion ramp(Common::ImageDim width, Common::ImageDim height)
+{
+    Common::PixelBuffer data(width * height);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<float>(i);
+    }
+    return Common::ImageRegion{ std::move(data), width, height, 1 };
+}
+
+} // anonymous namespace
+
+TEST(CropGeometryTest, RegionRoundsAndOrdersEdges)
+{
+    const auto geometry { CropGeometry::fromDescriptor(crop(0.75f, 0.9f, 0.25f, 0.1f)) };
+    EXPECT_FLOAT_EQ(geometry.m_left, 0.25f);
+    EXPECT_FLOAT_EQ(geometry.m_right, 0.75f);
+
+    const auto rect { geometry.region(100, 50) };
+    EXPECT_EQ(rect.m_x, 25);
+    EXPECT_EQ(rect.m_y, 5);
+    EXPECT_EQ(rect.m_width, 50u);
+    EXPECT_EQ(rect.m_height, 40u);
+
+    // A degenerate crop keeps one pixel
+    const auto empty { CropGeometry::fromDescriptor(crop(0.5f, 0.5f, 0.5f, 0.5f)).region(10, 10) };
+    EXPECT_EQ(empty.m_width, 1u);
+    EXPECT_EQ(empty.m_height, 1u);
+}
+
+TEST(CropGeometryTest, SamplingTurnsAboutTheCenter)
+{
+    const auto identity { CropGeometry::fromDescriptor(crop(0.0f, 0.0f, 1.0f, 1.0f)).sampling(8, 8) };
+    EXPECT_FLOAT_EQ(identity[0], 1.0f);
+    EXPECT_FLOAT_EQ(identity[1], 0.0f);
+    EXPECT_NEAR(identity[2], 0.0f, 1.0e-6f);
+    EXPECT_NEAR(identity[5], 0.0f, 1.0e-6f);
+
+    // The center of a 9x9 rectangle is the center of pixel (4, 4): it samples itself
+    const auto a { CropGeometry::fromDescriptor(crop(0.0f, 0.0f, 1.0f, 1.0f, 30.0f)).sampling(9, 9) };
+    EXPECT_NEAR(a[0] * 4.0f + a[1] * 4.0f + a[2], 4.0f, 1.0e-4f);
+    EXPECT_NEAR(a[3] * 4.0f + a[4] * 4.0f + a[5], 4.0f, 1.0e-4f);
+}
+
+TEST(CropGeometryTest, OfAndMoveToFrontFindTheFirstCrop)
+{
+    OperationDescriptor brightness;
+    brightness.type = OperationType::Brightness;
+    std::vector<OperationDescriptor> chain{ brightness, crop(0.1f, 0.1f, 0.9f, 0.9f) };
+
+    CropGeometry::moveToFront(chain);
+    EXPECT_EQ(chain.front().type, OperationType::Crop);
+    ASSERT_TRUE(CropGeometry::of(chain).has_value());
+
+    chain.front().enabled = false;
+    EXPECT_FALSE(CropGeometry::of(chain).has_value());
+}
+
+TEST(CropGeometryTest, ExtractFromCopiesTheRectangle)
+{
+    const auto image { ramp(4, 4) };
+    const auto cropped { CropGeometry::fromDescriptor(crop(0.25f, 0.5f, 0.75f, 1.0f)).extractFrom(image) };
+    ASSERT_NE(cropped, nullptr);
+    ASSERT_EQ(cropped->width(), 2u);
+    ASSERT_EQ(cropped->height(), 2u);
+    EXPECT_FLOAT_EQ(cropped->getBuffer()[0], 9.0f);
+    EXPECT_FLOAT_EQ(cropped->getBuffer()[1], 10.0f);
+    EXPECT_FLOAT_EQ(cropped->getBuffer()[2], 13.0f);
+    EXPECT_FLOAT_EQ(cropped->getBuffer()[3], 14.0f);
+}
+
+TEST(CropGeometryTest, IntersectsRegions)
+{
+    const Common::RegionOfInterest a{ 0, 0, 10, 10 };
+    const Common::RegionOfInterest b{ 5, 8, 10, 10 };
+    const auto common { a.intersectedWith(b) };
+    EXPECT_EQ(common.m_x, 5);
+    EXPECT_EQ(common.m_y, 8);
+    EXPECT_EQ(common.m_width, 5u);
+    EXPECT_EQ(common.m_height, 2u);
+    EXPECT_FALSE(a.intersectedWith(Common::RegionOfInterest{ 20, 20, 1, 1 }).isValid());
+}
+
+TEST(OperationCropTest, StraightensOnlyTheRectangle)
+{
+    OperationCrop operation;
+    auto image { ramp(5, 5) };
+    const auto source { std::vector<float>(image.getBuffer().begin(), image.getBuffer().end()) };
+
+    // Unrotated: the pixels are left to the consumers
+    ASSERT_TRUE(operation.executeOnImageRegion(image, crop(0.2f, 0.2f, 0.8f, 0.8f)).has_value());
+    EXPECT_TRUE(std::ranges::equal(image.getBuffer(), source));
+
+    // Straightened: the rectangle turns about its center, the frame around it is kept
+    ASSERT_TRUE(operation.executeOnImageRegion(image, crop(0.2f, 0.2f, 0.8f, 0.8f, 45.0f)).has_value());
+    EXPECT_NEAR(image.getBuffer()[12], 12.0f, 1.0e-3f);
+    EXPECT_FLOAT_EQ(image.getBuffer()[0], 0.0f);
+    EXPECT_FLOAT_EQ(image.getBuffer()[24], 24.0f);
+    EXPECT_NE(image.getBuffer()[6], 6.0f);
+}
+
+} // namespace CaptureMoment::Core::Operations
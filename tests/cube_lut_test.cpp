@@ -0,0 +1,132 @@
+/**
+ * @file cube_lut_test.cpp
+ * @brief Parsing and tetrahedral lookup tests of the CubeLut tables.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/color_operations/cube_lut.h"
+
+#include <gtest/gtest.h>
+
+#include <format>
+#include <sstream>
+#include <string>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief A .cube text of `size`^3 entries mapping (r, g, b) to (g, b, 0.5 * r + 0.25), a linear map.
+ */
+[[nodiscard]] std::string linearCube(int size)
+{
+    std::string text { std::format("TITLE \"linear\"\n# comment\nLUT_3D_SIZE {}\nDOMAIN_MIN 0 0 0\nDOMAIN_MAX 1 1 1\n", size) };
+    const float last { static_cast<float>(size - 1) };
+    for (int b = 0; b < size; ++b) {
+        for (int g = 0; g < size; ++g) {
+            for (int r = 0; r < size; ++r) {
+                text += std::format("{} {} {}\n", g / last, b / last, 0.5f * r / last + 0.25f);
+            }
+        }
+    }
+    return text;
+}
+
+[[nodiscard]] std::expected<Halide::Buffer<float>, ErrorHandling::CoreError> parseText(const std::string& text)
+{
+    std::istringstream stream(text);
+    return CubeLut::parse(stream);
+}
+
+} // anonymous namespace
+
+TEST(CubeLutTest, ParsesEntriesInFileOrder)
+{
+    const auto table { parseText(linearCube(3)) };
+    ASSERT_TRUE(table.has_value());
+    ASSERT_EQ(table->dimensions(), 4);
+    EXPECT_EQ(table->dim(0).extent(), CubeLut::k_entry_channels);
+    EXPECT_EQ(table->dim(1).extent(), 3);
+
+    // Entry (r = 2, g = 1, b = 0) -> (0.5, 0, 0.75)
+    EXPECT_FLOAT_EQ((*table)(0, 2, 1, 0), 0.5f);
+    EXPECT_FLOAT_EQ((*table)(1, 2, 1, 0), 0.0f);
+    EXPECT_FLOAT_EQ((*table)(2, 2, 1, 0), 0.75f);
+}
+
+TEST(CubeLutTest, RejectsMalformedAndUnsupportedFiles)
+{
+    EXPECT_EQ(parseText("LUT_1D_SIZE 2\n0 0 0\n1 1 1\n").error(), ErrorHandling::CoreError::UnsupportedFormat);
+    EXPECT_EQ(parseText("LUT_3D_SIZE 2\nDOMAIN_MAX 2 2 2\n").error(), ErrorHandling::CoreError::UnsupportedFormat);
+    EXPECT_EQ(parseText("LUT_3D_SIZE 2\n0 0 0\n").error(), ErrorHandling::CoreError::DecodingError);
+    EXPECT_EQ(parseText("0 0 0\n").error(), ErrorHandling::CoreError::DecodingError);
+    EXPECT_EQ(parseText("LUT_3D_SIZE 2\nBOGUS\n").error(), ErrorHandling::CoreError::DecodingError);
+}
+
+TEST(CubeLutTest, TetrahedralLookupIsExactForLinearMaps)
+{
+    const auto table { parseText(linearCube(5)) };
+    ASSERT_TRUE(table.has_value());
+
+    constexpr int k_samples { 16 };
+    Halide::Buffer<float> colors(k_samples, k_samples, 3);
+    for (int y = 0; y < k_samples; ++y) {
+        for (int x = 0; x < k_samples; ++x) {
+            colors(x, y, 0) = x / (k_samples - 1.0f);
+            colors(x, y, 1) = y / (k_samples - 1.0f);
+            colors(x, y, 2) = 0.37f * ((x + 3 * y) % k_samples) / (k_samples - 1.0f);
+        }
+    }
+
+    Halide::ImageParam lattice(Halide::Float(32), 4);
+    lattice.set(*table);
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Func mapped("mapped");
+    mapped(x, y, c) = CubeLut::sampleTetrahedral(lattice, colors(x, y, 0), colors(x, y, 1), colors(x, y, 2), c);
+    const Halide::Buffer<float> output { mapped.realize({ k_samples, k_samples, 3 }) };
+
+    for (int y_index = 0; y_index < k_samples; ++y_index) {
+        for (int x_index = 0; x_index < k_samples; ++x_index) {
+            EXPECT_NEAR(output(x_index, y_index, 0), colors(x_index, y_index, 1), 1.0e-5f);
+            EXPECT_NEAR(output(x_index, y_index, 1), colors(x_index, y_index, 2), 1.0e-5f);
+            EXPECT_NEAR(output(x_index, y_index, 2), 0.5f * colors(x_index, y_index, 0) + 0.25f, 1.0e-5f);
+        }
+    }
+}
+
+TEST(CubeLutTest, HostLookupMatchesTheGraph)
+{
+    const auto table { parseText(linearCube(4)) };
+    ASSERT_TRUE(table.has_value());
+
+    constexpr int k_samples { 8 };
+    Halide::Buffer<float> colors(k_samples, k_samples, 3);
+    for (int y = 0; y < k_samples; ++y) {
+        for (int x = 0; x < k_samples; ++x) {
+            colors(x, y, 0) = x / (k_samples - 1.0f);
+            colors(x, y, 1) = 0.9f * ((3 * x + y) % k_samples) / (k_samples - 1.0f);
+            colors(x, y, 2) = y / (k_samples - 1.0f);
+        }
+    }
+
+    Halide::ImageParam lattice(Halide::Float(32), 4);
+    lattice.set(*table);
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Func mapped("mapped");
+    mapped(x, y, c) = CubeLut::sampleTetrahedral(lattice, colors(x, y, 0), colors(x, y, 1), colors(x, y, 2), c);
+    const Halide::Buffer<float> output { mapped.realize({ k_samples, k_samples, 3 }) };
+
+    for (int y_index = 0; y_index < k_samples; ++y_index) {
+        for (int x_index = 0; x_index < k_samples; ++x_index) {
+            const auto host { CubeLut::sampleTetrahedral(*table, colors(x_index, y_index, 0),
+                                                         colors(x_index, y_index, 1), colors(x_index, y_index, 2)) };
+            for (int channel = 0; channel < 3; ++channel) {
+                EXPECT_NEAR(host[channel], output(x_index, y_index, channel), 1.0e-6f);
+            }
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
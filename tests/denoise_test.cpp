@@ -0,0 +1,102 @@
+/**
+ * @file denoise_test.cpp
+ * @brief Wavelet shrinkage tests of OperationDenoise (CPU region path).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/operation_denoise.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor denoise(float luma, float color)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::Denoise;
+    descriptor.name = "Denoise";
+    descriptor.setParam(ParameterKey::Value, luma);
+    descriptor.setParam(ParameterKey::ColorNoise, color);
+    return descriptor;
+}
+
+/**
+ * @brief RGBA mid gray with a one-pixel checkerboard of `amplitude` on `channel` (alpha 1).
+ */
+[[nodiscard]] Common::ImageRegion checkerboard(Common::ImageDim size, std::size_t channel, float amplitude)
+{
+    Common::ImageRegion region{ Common::PixelBuffer(size * size * 4, 0.25f), size, size, 4 };
+    for (std::size_t y = 0; y < size; ++y) {
+        for (std::size_t x = 0; x < size; ++x) {
+            float* pixel = region.getBuffer().data() + (y * size + x) * 4;
+            pixel[channel] += (x + y) % 2 == 0 ? amplitude : -amplitude;
+            pixel[3] = 1.0f;
+        }
+    }
+    return region;
+}
+
+/**
+ * @brief Mean absolute deviation of `channel` from the mid gray.
+ */
+[[nodiscard]] float deviation(const Common::ImageRegion& region, std::size_t channel)
+{
+    const auto pixels = region.getBuffer();
+    float sum = 0.0f;
+    for (std::size_t i = channel; i < pixels.size(); i += 4) {
+        sum += std::abs(pixels[i] - 0.25f);
+    }
+    return sum / static_cast<float>(pixels.size() / 4);
+}
+
+} // anonymous namespace
+
+TEST(OperationDenoiseTest, ZeroStrengthsKeepTheImage)
+{
+    OperationDenoise operation;
+    auto image { checkerboard(16, 1, 0.02f) };
+    const auto original { image.getBuffer()[1] };
+
+    ASSERT_TRUE(operation.executeOnImageRegion(image, denoise(0.0f, 0.0f)).has_value());
+    EXPECT_EQ(image.getBuffer()[1], original);
+}
+
+TEST(OperationDenoiseTest, FlatImagesStayFlat)
+{
+    OperationDenoise operation;
+    auto image { checkerboard(16, 1, 0.0f) };
+
+    ASSERT_TRUE(operation.executeOnImageRegion(image, denoise(1.0f, 1.0f)).has_value());
+    for (std::size_t channel = 0; channel < 3; ++channel) {
+        EXPECT_NEAR(deviation(image, channel), 0.0f, 1.0e-5f);
+    }
+    EXPECT_FLOAT_EQ(image.getBuffer()[3], 1.0f);
+}
+
+TEST(OperationDenoiseTest, ShrinksFineNoise)
+{
+    OperationDenoise operation;
+
+    // Luminance-like noise on every channel
+    auto gray { checkerboard(32, 0, 0.01f) };
+    for (std::size_t i = 0; i < gray.getBuffer().size(); i += 4) {
+        gray.getBuffer()[i + 1] = gray.getBuffer()[i];
+        gray.getBuffer()[i + 2] = gray.getBuffer()[i];
+    }
+    const float before = deviation(gray, 1);
+    ASSERT_TRUE(operation.executeOnImageRegion(gray, denoise(1.0f, 0.0f)).has_value());
+    EXPECT_LT(deviation(gray, 1), 0.5f * before);
+
+    // Green-only noise is two thirds color: the color strength alone removes that part
+    auto colored { checkerboard(32, 1, 0.01f) };
+    ASSERT_TRUE(operation.executeOnImageRegion(colored, denoise(0.0f, 1.0f)).has_value());
+    EXPECT_LT(deviation(colored, 1), 0.01f);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,132 @@
+/**
+ * @file edit_history_test.cpp
+ * @brief Undo/redo, jump and preview cache tests of EditHistory.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/edit_history.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor makeOperation(std::uint64_t id, OperationType type, float value)
+{
+    OperationDescriptor operation;
+    operation.id = id;
+    operation.type = type;
+    operation.name = "Operation";
+    operation.params.set(ParameterKey::Value, value);
+    return operation;
+}
+
+[[nodiscard]] EditHistory::Preview makePreview(Common::ImageDim width, Common::ImageDim height)
+{
+    auto preview { std::make_shared<Common::DisplayImage>() };
+    preview->m_width = width;
+    preview->m_height = height;
+    preview->m_data.resize(preview->bytesPerLine() * height);
+    return preview;
+}
+
+} // anonymous namespace
+
+TEST(EditHistoryTest, UndoAndRedoApplyTheDeltas)
+{
+    EditHistory history;
+
+    std::vector<OperationDescriptor> operations { makeOperation(1, OperationType::Exposure, 0.5f) };
+    const auto first { operations };
+    ASSERT_TRUE(history.commit(operations, "Add exposure"));
+
+    operations[0].params.set(ParameterKey::Value, 0.8f);
+    operations[0].enabled = false;
+    operations.insert(operations.begin(), makeOperation(2, OperationType::Contrast, -0.2f));
+    const auto second { operations };
+    ASSERT_TRUE(history.commit(operations, "Edit"));
+    EXPECT_FALSE(history.commit(operations)); // Unchanged
+
+    ASSERT_TRUE(history.undo());
+    EXPECT_EQ(history.current(), first);
+    ASSERT_TRUE(history.undo());
+    EXPECT_TRUE(history.current().empty());
+    EXPECT_FALSE(history.undo());
+
+    ASSERT_TRUE(history.redo());
+    ASSERT_TRUE(history.redo());
+    EXPECT_EQ(history.current(), second);
+    EXPECT_FALSE(history.redo());
+    EXPECT_EQ(history.label(1), "Add exposure");
+}
+
+TEST(EditHistoryTest, ReorderedOperationsRoundTrip)
+{
+    const std::vector<OperationDescriptor> before { makeOperation(1, OperationType::Exposure, 0.1f),
+                                                    makeOperation(2, OperationType::Contrast, 0.2f),
+                                                    makeOperation(3, OperationType::Shadows, 0.3f) };
+    const std::vector<OperationDescriptor> after { before[2], before[0], makeOperation(4, OperationType::Whites, 0.4f) };
+
+    const auto delta { EditHistory::diff(before, after) };
+
+    auto operations { before };
+    EditHistory::applyForward(operations, delta);
+    EXPECT_EQ(operations, after);
+    EditHistory::applyBackward(operations, delta);
+    EXPECT_EQ(operations, before);
+}
+
+TEST(EditHistoryTest, JumpsMatchStepping)
+{
+    EditHistory history;
+    std::vector<std::vector<OperationDescriptor>> states { {} };
+
+    std::vector<OperationDescriptor> operations { makeOperation(1, OperationType::Exposure, 0.0f) };
+    for (int i = 1; i <= 3 * static_cast<int>(EditHistory::k_snapshot_interval) + 5; ++i) {
+        operations[0].params.set(ParameterKey::Value, static_cast<float>(i) / 100.0f);
+        ASSERT_TRUE(history.commit(operations));
+        states.push_back(operations);
+    }
+
+    for (const std::size_t index : { std::size_t{ 0 }, std::size_t{ 37 }, std::size_t{ 5 }, history.size() - 1, std::size_t{ 20 } }) {
+        ASSERT_TRUE(history.jumpTo(index));
+        EXPECT_EQ(history.currentIndex(), index);
+        EXPECT_EQ(history.current(), states[index]);
+    }
+    EXPECT_FALSE(history.jumpTo(history.size()));
+}
+
+TEST(EditHistoryTest, PreviewsFollowTheirStateWithinTheBudget)
+{
+    // Room for two 16x16 RGBA8 previews
+    EditHistory history(2 * 16 * 16 * 4);
+    std::vector<OperationDescriptor> operations { makeOperation(1, OperationType::Exposure, 0.0f) };
+
+    for (int i = 1; i <= 3; ++i) {
+        operations[0].params.set(ParameterKey::Value, static_cast<float>(i));
+        ASSERT_TRUE(history.commit(operations));
+        EXPECT_TRUE(history.storePreview(history.currentStateId(), makePreview(16, 16)));
+    }
+    EXPECT_EQ(history.previewBytes(), 2u * 16 * 16 * 4);
+
+    // The oldest preview, farthest from the current state, was evicted
+    ASSERT_TRUE(history.jumpTo(1));
+    EXPECT_EQ(history.currentPreview(), nullptr);
+    ASSERT_TRUE(history.redo());
+    EXPECT_NE(history.currentPreview(), nullptr);
+
+    // A new edit discards the redo branch and its preview; a late preview of it is refused
+    const std::uint64_t discarded { history.currentStateId() + 1 };
+    operations[0].params.set(ParameterKey::Value, 10.0f);
+    ASSERT_TRUE(history.commit(operations));
+    EXPECT_FALSE(history.storePreview(discarded, makePreview(16, 16)));
+    EXPECT_EQ(history.previewBytes(), 16u * 16 * 4);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,70 @@
+/**
+ * @file energy_policy_test.cpp
+ * @brief Plans of the energy policies across power states, and their effect on backend selection.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "config/energy_policy.h"
+#include "image_processing/deciders/backend_cost_model.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Config {
+
+namespace {
+
+constexpr PowerState k_mains {};
+constexpr PowerState k_battery { true, ThermalState::Nominal };
+constexpr PowerState k_critical { false, ThermalState::Critical };
+
+} // anonymous namespace
+
+TEST(EnergyPolicyTest, PerformanceIgnoresThePowerState)
+{
+    EXPECT_EQ(EnergyPlan::resolve(EnergyPolicy::Performance, k_battery), EnergyPlan{});
+    EXPECT_EQ(EnergyPlan::resolve(EnergyPolicy::Performance, k_critical), EnergyPlan{});
+}
+
+TEST(EnergyPolicyTest, BalancedRestrainsOnBatteryOnly)
+{
+    EXPECT_EQ(EnergyPlan::resolve(EnergyPolicy::Balanced, k_mains), EnergyPlan{});
+
+    const EnergyPlan plan { EnergyPlan::resolve(EnergyPolicy::Balanced, k_battery) };
+    EXPECT_TRUE(plan.m_allow_gpu);
+    EXPECT_DOUBLE_EQ(plan.m_gpu_advantage_threshold, EnergyPlan::k_constrained_gpu_advantage);
+    EXPECT_LT(plan.m_thread_fraction, 1.0);
+    EXPECT_DOUBLE_EQ(plan.m_proxy_scale, 1.0);
+}
+
+TEST(EnergyPolicyTest, BatteryKeepsToTheCpuAndCriticalHeatRestrainsFurther)
+{
+    const EnergyPlan mains { EnergyPlan::resolve(EnergyPolicy::Battery, k_mains) };
+    EXPECT_FALSE(mains.m_allow_gpu);
+    EXPECT_LT(mains.m_proxy_scale, 1.0);
+
+    const EnergyPlan hot { EnergyPlan::resolve(EnergyPolicy::Battery, k_critical) };
+    EXPECT_LT(hot.m_thread_fraction, mains.m_thread_fraction);
+    EXPECT_LT(hot.m_proxy_scale, mains.m_proxy_scale);
+}
+
+TEST(EnergyPolicyTest, ConstrainedThresholdKeepsMarginalGpuWinsOnTheCpu)
+{
+    // The GPU takes 70% of the CPU time: worth it on mains, not on battery
+    const ImageProcessing::BackendCostModel model { ImageProcessing::BackendProfile { 0.0, 10.0, 0.0 },
+                                                    ImageProcessing::BackendProfile { 0.0, 7.0, 0.0 } };
+    const EnergyPlan battery { EnergyPlan::resolve(EnergyPolicy::Balanced, k_battery) };
+
+    EXPECT_EQ(model.selectBackend(4000, 3000), Common::MemoryType::GPU_MEMORY);
+    EXPECT_EQ(model.selectBackend(4000, 3000, battery.m_gpu_advantage_threshold), Common::MemoryType::CPU_RAM);
+}
+
+TEST(EnergyPolicyTest, PolicyNamesRoundTrip)
+{
+    for (const auto policy : { EnergyPolicy::Performance, EnergyPolicy::Balanced, EnergyPolicy::Battery }) {
+        EXPECT_EQ(EnergyPlan::parsePolicy(EnergyPlan::policyName(policy)), policy);
+    }
+    EXPECT_FALSE(EnergyPlan::parsePolicy("turbo").has_value());
+}
+
+} // namespace CaptureMoment::Core::Config
@@ -0,0 +1,73 @@
+/**
+ * @file fallback_kernels_test.cpp
+ * @brief Dispatch and arithmetic of the host kernels of the sequential fallback.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/fallback_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor withValue(OperationType type, float value)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = type;
+    descriptor.setParam(ParameterKey::Value, value);
+    return descriptor;
+}
+
+} // anonymous namespace
+
+TEST(FallbackKernelsTest, PerPixelOperationsHaveAKernel)
+{
+    EXPECT_NE(FallbackKernels::find(OperationType::Brightness), nullptr);
+    EXPECT_NE(FallbackKernels::find(OperationType::Saturation), nullptr);
+    EXPECT_NE(FallbackKernels::find(OperationType::Lut3D), nullptr);
+
+    // Neighborhood and geometry operations keep their IOperationDefaultLogic
+    EXPECT_EQ(FallbackKernels::find(OperationType::Denoise), nullptr);
+    EXPECT_EQ(FallbackKernels::find(OperationType::Crop), nullptr);
+}
+
+TEST(FallbackKernelsTest, BrightnessClampsColorsAndKeepsAlpha)
+{
+    Common::PixelBuffer data { 0.2f, 0.5f, 0.9f, 0.25f };
+    Common::ImageRegion region(std::move(data), 1, 1, 4);
+
+    const auto kernel = FallbackKernels::find(OperationType::Brightness);
+    ASSERT_TRUE(kernel(region, withValue(OperationType::Brightness, 0.3f)).has_value());
+
+    EXPECT_FLOAT_EQ(region.getBuffer()[0], 0.5f);
+    EXPECT_FLOAT_EQ(region.getBuffer()[1], 0.8f);
+    EXPECT_FLOAT_EQ(region.getBuffer()[2], 1.0f);
+    EXPECT_FLOAT_EQ(region.getBuffer()[3], 0.25f);
+}
+
+TEST(FallbackKernelsTest, ZeroSaturationYieldsTheLuminance)
+{
+    Common::PixelBuffer data { 0.8f, 0.4f, 0.1f, 1.0f };
+    Common::ImageRegion region(std::move(data), 1, 1, 4);
+
+    ASSERT_TRUE(FallbackKernels::saturation(region, withValue(OperationType::Saturation, 0.0f)).has_value());
+
+    const float luminance = 0.299f * 0.8f + 0.587f * 0.4f + 0.114f * 0.1f;
+    for (int channel = 0; channel < 3; ++channel) {
+        EXPECT_NEAR(region.getBuffer()[channel], luminance, 1.0e-6f);
+    }
+}
+
+TEST(FallbackKernelsTest, RejectsRegionsWithoutColors)
+{
+    Common::PixelBuffer data { 0.5f, 0.5f };
+    Common::ImageRegion region(std::move(data), 2, 1, 1);
+    EXPECT_FALSE(FallbackKernels::brightness(region, withValue(OperationType::Brightness, 0.1f)).has_value());
+}
+
+} // namespace CaptureMoment::Core::Operations
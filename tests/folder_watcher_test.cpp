@@ -0,0 +1,83 @@
+/**
+ * @file folder_watcher_test.cpp
+ * @brief Change notifications of FolderWatcher.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/folder_watcher.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief Collects the reported paths and waits for an expected one.
+ */
+class Recorder {
+public:
+    void add(std::vector<std::filesystem::path> paths)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_paths.insert(m_paths.end(), paths.begin(), paths.end());
+        }
+        m_changed.notify_all();
+    }
+
+    [[nodiscard]] bool waitFor(const std::filesystem::path& path)
+    {
+        std::unique_lock lock(m_mutex);
+        return m_changed.wait_for(lock, std::chrono::seconds(5), [this, &path]() {
+            return std::ranges::find(m_paths, path) != m_paths.end();
+        });
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::filesystem::path> m_paths;
+};
+
+} // anonymous namespace
+
+TEST(FolderWatcherTest, ReportsFilesWrittenBelowTheRoot)
+{
+    if (!FolderWatcher::isSupported()) {
+        GTEST_SKIP() << "No change notifications on this platform";
+    }
+
+    const std::filesystem::path root { std::filesystem::canonical(std::filesystem::temp_directory_path()) / "capturemoment_watcher_test" };
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "day1");
+
+    Recorder recorder;
+    {
+        FolderWatcher watcher([&recorder](std::vector<std::filesystem::path> paths) { recorder.add(std::move(paths)); });
+        ASSERT_TRUE(watcher.watch(root).has_value());
+        EXPECT_EQ(watcher.watch(root / "missing").error(), ErrorHandling::CoreError::FileNotFound);
+
+        std::ofstream(root / "day1" / "a.jpg") << "jpeg";
+        EXPECT_TRUE(recorder.waitFor(root / "day1" / "a.jpg"));
+
+        // A directory created after the watch started is watched too
+        std::filesystem::create_directories(root / "day2");
+        EXPECT_TRUE(recorder.waitFor(root / "day2"));
+        std::ofstream(root / "day2" / "b.xmp") << "xmp";
+        EXPECT_TRUE(recorder.waitFor(root / "day2" / "b.xmp"));
+    }
+
+    std::filesystem::remove_all(root);
+}
+
+} // namespace CaptureMoment::Core::Catalog
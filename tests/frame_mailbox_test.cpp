@@ -0,0 +1,95 @@
+/**
+ * @file frame_mailbox_test.cpp
+ * @brief Latest-wins handoff and slot ownership of FrameMailbox.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/frame_mailbox.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace CaptureMoment::Core::Common {
+
+TEST(FrameMailboxTest, NothingToAcquireBeforePublish)
+{
+    FrameMailbox<int> mailbox;
+
+    EXPECT_FALSE(mailbox.hasFresh());
+    EXPECT_FALSE(mailbox.acquire());
+    EXPECT_EQ(mailbox.front(), 0);
+}
+
+TEST(FrameMailboxTest, LatestPublishedFrameWins)
+{
+    FrameMailbox<int> mailbox;
+    mailbox.publish(1);
+    mailbox.publish(2);
+    mailbox.publish(3);
+
+    ASSERT_TRUE(mailbox.acquire());
+    EXPECT_EQ(mailbox.front(), 3);
+
+    // Acquired once: the front slot stays the consumer's until the next publish
+    EXPECT_FALSE(mailbox.acquire());
+    EXPECT_EQ(mailbox.front(), 3);
+}
+
+TEST(FrameMailboxTest, ProducerNeverWritesTheFrontSlot)
+{
+    FrameMailbox<int> mailbox;
+    mailbox.publish(1);
+    ASSERT_TRUE(mailbox.acquire());
+
+    for (int frame = 2; frame < 10; ++frame) {
+        EXPECT_NE(&mailbox.back(), &mailbox.front());
+        mailbox.publish(frame);
+        EXPECT_EQ(mailbox.front(), 1);
+    }
+}
+
+TEST(FrameMailboxTest, ConsumerSeesWholeFramesInOrder)
+{
+    // Every word of a frame carries its sequence number: a torn or reordered frame is caught
+    using Frame = std::array<std::uint64_t, 16>;
+    constexpr std::uint64_t k_frames { 200'000 };
+
+    FrameMailbox<Frame> mailbox;
+    std::atomic<bool> done { false };
+
+    std::thread producer([&] {
+        for (std::uint64_t sequence = 1; sequence <= k_frames; ++sequence) {
+            mailbox.back().fill(sequence);
+            mailbox.publish();
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::uint64_t last { 0 };
+    bool consistent { true };
+    while (true) {
+        const bool finished { done.load(std::memory_order_acquire) };
+        if (mailbox.acquire()) {
+            const Frame& frame { mailbox.front() };
+            for (const std::uint64_t word : frame) {
+                consistent = consistent && word == frame[0];
+            }
+            consistent = consistent && frame[0] > last;
+            last = frame[0];
+        }
+        if (finished && !mailbox.hasFresh()) {
+            break;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(last, k_frames);
+}
+
+} // namespace CaptureMoment::Core::Common
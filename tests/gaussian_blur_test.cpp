@@ -0,0 +1,146 @@
+/**
+ * @file gaussian_blur_test.cpp
+ * @brief Accuracy and level selection tests of the GaussianBlur building block.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/gaussian_blur.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr int k_size { 512 };
+
+/**
+ * @brief Blurs a plane with the stages computed at root, as the executor schedules them.
+ */
+[[nodiscard]] Halide::Buffer<float> blurPlane(const Halide::Buffer<float>& plane, float sigma)
+{
+    Halide::Var x("x"), y("y");
+    Halide::Func source = Halide::BoundaryConditions::repeat_edge(plane);
+
+    Halide::Param<float> sigma_param("sigma");
+    sigma_param.set(sigma);
+
+    auto result { GaussianBlur::applyPlane(source, sigma_param, x, y) };
+    for (Halide::Func stage : result.m_stages) {
+        stage.compute_root();
+    }
+    return result.m_output.realize({ plane.width(), plane.height() });
+}
+
+/**
+ * @brief Mass and variance along x of a blurred centered impulse.
+ */
+struct Moments {
+    double m_mass { 0.0 };
+    double m_variance { 0.0 };
+};
+
+[[nodiscard]] Moments impulseMoments(float sigma)
+{
+    Halide::Buffer<float> impulse(k_size, k_size);
+    impulse.fill(0.0f);
+    impulse(k_size / 2, k_size / 2) = 1.0f;
+
+    const auto blurred { blurPlane(impulse, sigma) };
+
+    Moments moments;
+    double mean { 0.0 };
+    for (int y = 0; y < k_size; ++y) {
+        for (int x = 0; x < k_size; ++x) {
+            moments.m_mass += blurred(x, y);
+            mean += blurred(x, y) * x;
+        }
+    }
+    mean /= moments.m_mass;
+    for (int y = 0; y < k_size; ++y) {
+        for (int x = 0; x < k_size; ++x) {
+            moments.m_variance += blurred(x, y) * (x - mean) * (x - mean);
+        }
+    }
+    moments.m_variance /= moments.m_mass;
+    return moments;
+}
+
+} // anonymous namespace
+
+TEST(GaussianBlurTest, SelectsTheFullResolutionKernelForSmallSigmas)
+{
+    EXPECT_EQ(GaussianBlur::levelFor(0.0f), 0);
+    EXPECT_EQ(GaussianBlur::levelFor(GaussianBlur::k_direct_max_sigma), 0);
+    EXPECT_EQ(GaussianBlur::levelFor(GaussianBlur::k_direct_max_sigma * 1.5f), 1);
+    EXPECT_EQ(GaussianBlur::levelFor(GaussianBlur::k_max_sigma), GaussianBlur::k_pyramid_levels);
+    EXPECT_EQ(GaussianBlur::levelFor(GaussianBlur::k_max_sigma * 4.0f), GaussianBlur::k_pyramid_levels);
+}
+
+TEST(GaussianBlurTest, KeepsTheMassAndMatchesTheRequestedSigma)
+{
+    // Direct kernel, then one, two and four pyramid levels
+    for (const float sigma : { 2.0f, 6.0f, 12.0f, 48.0f }) {
+        const auto moments { impulseMoments(sigma) };
+        EXPECT_NEAR(moments.m_mass, 1.0, 1e-3) << "sigma " << sigma;
+        EXPECT_NEAR(std::sqrt(moments.m_variance), sigma, 0.1 * sigma) << "sigma " << sigma;
+    }
+}
+
+TEST(GaussianBlurTest, LeavesFlatImagesUnchanged)
+{
+    Halide::Buffer<float> flat(k_size, k_size);
+    flat.fill(0.25f);
+
+    for (const float sigma : { 0.0f, 3.0f, 30.0f }) {
+        const auto blurred { blurPlane(flat, sigma) };
+        for (int y = 0; y < k_size; y += 37) {
+            for (int x = 0; x < k_size; x += 37) {
+                ASSERT_NEAR(blurred(x, y), 0.25f, 1e-5f) << "sigma " << sigma << " at " << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST(GaussianBlurTest, StripsReadWithTheHaloMatchTheWholeImage)
+{
+    Halide::Buffer<float> image(k_size, k_size);
+    for (int y = 0; y < k_size; ++y) {
+        for (int x = 0; x < k_size; ++x) {
+            image(x, y) = static_cast<float>((x * 7 + y * 13) % 17) / 17.0f;
+        }
+    }
+
+    // Direct kernel, then two and three pyramid levels
+    for (const float sigma : { 2.0f, 12.0f, 20.0f }) {
+        const auto whole { blurPlane(image, sigma) };
+
+        // Rows [first, first + rows), processed as an image of their own, as the strip exporter does
+        constexpr int first { 200 };
+        constexpr int rows { 40 };
+        const int halo { GaussianBlur::haloFor(sigma) };
+        int read_y { std::max(first - halo, 0) };
+        read_y -= read_y % GaussianBlur::k_alignment;
+        const int read_end { std::min(k_size, first + rows + halo) };
+
+        Halide::Buffer<float> strip(k_size, read_end - read_y);
+        for (int y = read_y; y < read_end; ++y) {
+            for (int x = 0; x < k_size; ++x) {
+                strip(x, y - read_y) = image(x, y);
+            }
+        }
+        const auto blurred { blurPlane(strip, sigma) };
+
+        for (int y = first; y < first + rows; ++y) {
+            for (int x = 0; x < k_size; ++x) {
+                ASSERT_EQ(blurred(x, y - read_y), whole(x, y)) << "sigma " << sigma << " at " << x << "," << y;
+            }
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,90 @@
+/**
+ * @file guided_upsampling_test.cpp
+ * @brief Transfer tests of the GuidedUpsampling building block.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/detail_operations/guided_upsampling.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr int k_size { 256 };
+
+/**
+ * @brief RGBA image with smooth, distinct gradients per channel.
+ */
+[[nodiscard]] Halide::Buffer<float> gradientImage()
+{
+    Halide::Buffer<float> image(k_size, k_size, 4);
+    for (int y = 0; y < k_size; ++y) {
+        for (int x = 0; x < k_size; ++x) {
+            image(x, y, 0) = static_cast<float>(x) / k_size;
+            image(x, y, 1) = static_cast<float>(y) / k_size;
+            image(x, y, 2) = static_cast<float>(x + y) / (2 * k_size);
+            image(x, y, 3) = 1.0f;
+        }
+    }
+    return image;
+}
+
+/**
+ * @brief Runs `effect` at reduced resolution and upsamples it, the stages computed at root as the executor schedules them.
+ */
+template<typename Effect>
+[[nodiscard]] Halide::Buffer<float> upsampleEffect(const Halide::Buffer<float>& image, const Effect& effect)
+{
+    Halide::Var x("x"), y("y"), c("c");
+    Halide::Func source = Halide::BoundaryConditions::repeat_edge(image);
+
+    auto reduced { GuidedUpsampling::reduce(source, x, y, c) };
+    Halide::Func reduced_output("reduced_output");
+    reduced_output(x, y, c) = effect(reduced.m_output(x, y, c));
+
+    auto upsampled { GuidedUpsampling::upsample(source, reduced.m_output, reduced_output, x, y, c) };
+    for (Halide::Func stage : reduced.m_stages) {
+        stage.compute_root();
+    }
+    for (Halide::Func stage : upsampled.m_stages) {
+        stage.compute_root();
+    }
+    return upsampled.m_output.realize({ k_size, k_size, 4 });
+}
+
+} // anonymous namespace
+
+TEST(GuidedUpsamplingTest, LeavesTheInputUnchangedWithoutEffect)
+{
+    const auto image { gradientImage() };
+    const auto output { upsampleEffect(image, [](const Halide::Expr& value) { return value; }) };
+
+    for (int y = 0; y < k_size; y += 7) {
+        for (int x = 0; x < k_size; x += 7) {
+            for (int c = 0; c < 4; ++c) {
+                EXPECT_NEAR(output(x, y, c), image(x, y, c), 1.0e-4f) << "at (" << x << ", " << y << ", " << c << ")";
+            }
+        }
+    }
+}
+
+TEST(GuidedUpsamplingTest, ReproducesAnAffineEffectAtFullResolution)
+{
+    const auto image { gradientImage() };
+    const auto output { upsampleEffect(image, [](const Halide::Expr& value) { return 0.5f * value + 0.1f; }) };
+
+    for (int y = 0; y < k_size; y += 7) {
+        for (int x = 0; x < k_size; x += 7) {
+            for (int c = 0; c < 3; ++c) {
+                EXPECT_NEAR(output(x, y, c), 0.5f * image(x, y, c) + 0.1f, 1.0e-2f) << "at (" << x << ", " << y << ", " << c << ")";
+            }
+            // Alpha is never transformed
+            EXPECT_FLOAT_EQ(output(x, y, 3), 1.0f);
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
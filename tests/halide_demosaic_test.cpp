@@ -0,0 +1,98 @@
+/**
+ * @file halide_demosaic_test.cpp
+ * @brief CFA phases and levels of the HalideDemosaic kernel.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/halide/halide_demosaic.h"
+#include "image_processing/halide/halide_buffer_layout.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CaptureMoment::Core::ImageProcessing {
+
+namespace {
+
+constexpr Common::ImageDim k_size { 16 };
+constexpr float k_black { 512.0f };
+constexpr float k_white { 16383.0f };
+
+/**
+ * @brief Mosaic of a flat color: each photosite holds the level of its CFA color.
+ */
+[[nodiscard]] RawMosaic flatMosaic(CfaPattern pattern, const std::array<float, 3>& rgb)
+{
+    // Color index of each photosite of the top-left quad, row by row
+    static constexpr std::array<std::array<int, 4>, 4> k_quads {{
+        { 0, 1, 1, 2 }, // RGGB
+        { 1, 0, 2, 1 }, // GRBG
+        { 1, 2, 0, 1 }, // GBRG
+        { 2, 1, 1, 0 }, // BGGR
+    }};
+    const auto& quad { k_quads[static_cast<std::size_t>(pattern)] };
+
+    RawMosaic mosaic;
+    mosaic.m_width = k_size;
+    mosaic.m_height = k_size;
+    mosaic.m_pattern = pattern;
+    mosaic.m_black_level = k_black;
+    mosaic.m_white_level = k_white;
+    mosaic.m_data.resize(static_cast<std::size_t>(k_size) * k_size);
+    for (Common::ImageDim y = 0; y < k_size; ++y) {
+        for (Common::ImageDim x = 0; x < k_size; ++x) {
+            const float level { rgb[quad[(y % 2) * 2 + x % 2]] };
+            mosaic.m_data[static_cast<std::size_t>(y) * k_size + x] =
+                static_cast<std::uint16_t>(k_black + level * (k_white - k_black) + 0.5f);
+        }
+    }
+    return mosaic;
+}
+
+[[nodiscard]] std::vector<float> demosaic(const RawMosaic& mosaic, bool half_size)
+{
+    const int width { static_cast<int>(half_size ? mosaic.m_width / 2 : mosaic.m_width) };
+    const int height { static_cast<int>(half_size ? mosaic.m_height / 2 : mosaic.m_height) };
+    std::vector<float> pixels(static_cast<std::size_t>(width) * height * k_interleaved_channels);
+    Halide::Buffer<float> output { wrapInterleaved(pixels.data(), width, height, k_interleaved_channels) };
+
+    HalideDemosaic demosaic;
+    const auto result { demosaic.run(mosaic, output, half_size, Halide::get_host_target()) };
+    EXPECT_TRUE(result.has_value());
+    return pixels;
+}
+
+} // anonymous namespace
+
+TEST(HalideDemosaicTest, FlatColorSurvivesEveryPattern)
+{
+    const std::array<float, 3> rgb { 0.6f, 0.3f, 0.1f };
+    for (const CfaPattern pattern : { CfaPattern::RGGB, CfaPattern::GRBG, CfaPattern::GBRG, CfaPattern::BGGR }) {
+        for (const bool half_size : { false, true }) {
+            const auto pixels { demosaic(flatMosaic(pattern, rgb), half_size) };
+            for (std::size_t i = 0; i < pixels.size(); i += k_interleaved_channels) {
+                ASSERT_NEAR(pixels[i + 0], rgb[0], 1.0e-3f) << "pattern " << static_cast<int>(pattern) << " half " << half_size;
+                ASSERT_NEAR(pixels[i + 1], rgb[1], 1.0e-3f) << "pattern " << static_cast<int>(pattern) << " half " << half_size;
+                ASSERT_NEAR(pixels[i + 2], rgb[2], 1.0e-3f) << "pattern " << static_cast<int>(pattern) << " half " << half_size;
+                ASSERT_FLOAT_EQ(pixels[i + 3], 1.0f);
+            }
+        }
+    }
+}
+
+TEST(HalideDemosaicTest, RejectsAnOutputOfTheWrongSize)
+{
+    const RawMosaic mosaic { flatMosaic(CfaPattern::RGGB, { 0.5f, 0.5f, 0.5f }) };
+    std::vector<float> pixels(static_cast<std::size_t>(k_size) * k_size * k_interleaved_channels);
+    Halide::Buffer<float> output { wrapInterleaved(pixels.data(), k_size, k_size, k_interleaved_channels) };
+
+    HalideDemosaic demosaic;
+    EXPECT_FALSE(demosaic.run(mosaic, output, true, Halide::get_host_target()).has_value());
+}
+
+} // namespace CaptureMoment::Core::ImageProcessing
@@ -0,0 +1,75 @@
+/**
+ * @file hdr_merger_test.cpp
+ * @brief Alignment and weighting of the HDR merge.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/hdr_merger.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+/**
+ * @brief Blocky test pattern, sampled at (x + dx, y + dy), scaled like another exposure.
+ */
+[[nodiscard]] HdrMerger::GreyImage makePattern(Common::ImageDim width, Common::ImageDim height, int dx, int dy, float gain)
+{
+    HdrMerger::GreyImage image { width, height, std::vector<std::uint8_t>(width * height) };
+    for (Common::ImageDim y = 0; y < height; ++y) {
+        for (Common::ImageDim x = 0; x < width; ++x) {
+            const auto sx { static_cast<std::uint32_t>(static_cast<int>(x) + dx + 64) };
+            const auto sy { static_cast<std::uint32_t>(static_cast<int>(y) + dy + 64) };
+            // Hash of 8x8 blocks: textured at every scale of the pyramid
+            const std::uint32_t block { ((sx / 8) * 73856093u) ^ ((sy / 8) * 19349663u) ^ ((sx / 3) * 83492791u) };
+            const float value { static_cast<float>(block % 200u + 20u) * gain };
+            image.m_pixels[y * width + x] = static_cast<std::uint8_t>(std::min(value, 255.0f));
+        }
+    }
+    return image;
+}
+
+} // anonymous namespace
+
+TEST(HdrMergerTest, AlignsShiftedFrames)
+{
+    const auto reference { makePattern(256, 192, 0, 0, 1.0f) };
+
+    // The frame shows the reference's (x, y) at (x - dx, y - dy) of its own pixels
+    const auto frame { makePattern(256, 192, -5, 3, 0.5f) };
+    EXPECT_EQ(HdrMerger::alignMtb(reference, frame, 4), (HdrMerger::Offset { 5, -3 }));
+
+    EXPECT_EQ(HdrMerger::alignMtb(reference, reference, 4), (HdrMerger::Offset { 0, 0 }));
+}
+
+TEST(HdrMergerTest, RejectsMismatchedFrames)
+{
+    const auto reference { makePattern(64, 64, 0, 0, 1.0f) };
+    const auto frame { makePattern(32, 64, 0, 0, 1.0f) };
+    EXPECT_EQ(HdrMerger::alignMtb(reference, frame, 3), (HdrMerger::Offset {}));
+}
+
+TEST(HdrMergerTest, WeightsAvoidBlackAndClipping)
+{
+    EXPECT_FLOAT_EQ(HdrMerger::weight(0.0f), 0.0f);
+    EXPECT_FLOAT_EQ(HdrMerger::weight(0.96f), 0.0f);
+    EXPECT_FLOAT_EQ(HdrMerger::weight(2.0f), 0.0f);
+    EXPECT_NEAR(HdrMerger::weight(0.475f), 1.0f, 1e-6f);
+    EXPECT_GT(HdrMerger::weight(0.2f), 0.9f);
+    EXPECT_LT(HdrMerger::weight(0.01f), HdrMerger::weight(0.1f));
+}
+
+TEST(HdrMergerTest, MergedPathNamesTheFirstFrame)
+{
+    const std::vector<std::string> frames { "/shots/IMG_0100.CR3", "/shots/IMG_0101.CR3", "/shots/IMG_0102.CR3" };
+    EXPECT_EQ(HdrMerger::mergedPath(frames), "/shots/IMG_0100_HDR");
+}
+
+} // namespace CaptureMoment::Core::Managers
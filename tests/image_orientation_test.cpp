@@ -0,0 +1,93 @@
+/**
+ * @file image_orientation_test.cpp
+ * @brief Tests of the EXIF orientation mapping and of the export rotation.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/types/image_orientation.h"
+#include "utils/image_conversion.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+constexpr std::array k_orientations {
+    ImageOrientation::Normal, ImageOrientation::MirrorHorizontal, ImageOrientation::Rotate180,
+    ImageOrientation::MirrorVertical, ImageOrientation::Transpose, ImageOrientation::Rotate90,
+    ImageOrientation::Transverse, ImageOrientation::Rotate270
+};
+
+/**
+ * @brief RGBA image whose red channel holds the index of the pixel.
+ */
+[[nodiscard]] ImageRegion indexedImage(ImageDim width, ImageDim height)
+{
+    ImageRegion image;
+    image.m_width = width;
+    image.m_height = height;
+    image.m_channels = 4;
+    image.m_data.resize(static_cast<std::size_t>(width) * height * 4);
+    for (ImageDim y = 0; y < height; ++y) {
+        for (ImageDim x = 0; x < width; ++x) {
+            const std::size_t offset { (static_cast<std::size_t>(y) * width + x) * 4 };
+            image.m_data[offset] = static_cast<float>(y * width + x);
+            image.m_data[offset + 3] = 1.0f;
+        }
+    }
+    return image;
+}
+
+} // anonymous namespace
+
+TEST(ImageOrientationTest, MappingsAreInverse)
+{
+    constexpr double width { 5.0 };
+    constexpr double height { 3.0 };
+    for (const ImageOrientation orientation : k_orientations) {
+        for (const auto [x, y] : { std::pair{ 0.5, 0.5 }, std::pair{ 4.5, 0.5 }, std::pair{ 1.5, 2.5 } }) {
+            const auto [ox, oy] = storedToOriented(orientation, x, y, width, height);
+            const auto [sx, sy] = orientedToStored(orientation, ox, oy, width, height);
+            EXPECT_DOUBLE_EQ(sx, x) << static_cast<int>(orientation);
+            EXPECT_DOUBLE_EQ(sy, y) << static_cast<int>(orientation);
+        }
+    }
+}
+
+TEST(ImageOrientationTest, Rotate90TurnsClockwise)
+{
+    // The stored top-left corner ends at the upright top-right
+    const auto [x, y] = storedToOriented(ImageOrientation::Rotate90, 0.0, 0.0, 5.0, 3.0);
+    EXPECT_DOUBLE_EQ(x, 3.0);
+    EXPECT_DOUBLE_EQ(y, 0.0);
+    EXPECT_EQ(orientedSize(ImageOrientation::Rotate90, 5, 3), (std::pair<ImageDim, ImageDim>{ 3, 5 }));
+}
+
+TEST(ImageOrientationTest, OrientedPixelsFollowTheMapping)
+{
+    constexpr ImageDim width { 5 };
+    constexpr ImageDim height { 3 };
+    const ImageRegion image { indexedImage(width, height) };
+
+    for (const ImageOrientation orientation : k_orientations) {
+        const auto upright { Utils::orient_F32(image, orientation) };
+        ASSERT_NE(upright, nullptr);
+        const auto [upright_width, upright_height] = orientedSize(orientation, width, height);
+        ASSERT_EQ(upright->m_width, upright_width);
+        ASSERT_EQ(upright->m_height, upright_height);
+
+        for (ImageDim y = 0; y < height; ++y) {
+            for (ImageDim x = 0; x < width; ++x) {
+                const auto [ox, oy] = storedToOriented(orientation, x + 0.5, y + 0.5, width, height);
+                const std::size_t offset { (static_cast<std::size_t>(oy) * upright_width + static_cast<std::size_t>(ox)) * 4 };
+                EXPECT_EQ(upright->m_data[offset], static_cast<float>(y * width + x)) << static_cast<int>(orientation);
+            }
+        }
+    }
+}
+
+} // namespace CaptureMoment::Core::Common
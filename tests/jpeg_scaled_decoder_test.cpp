@@ -0,0 +1,45 @@
+/**
+ * @file jpeg_scaled_decoder_test.cpp
+ * @brief Scale selection and file detection of JpegScaledDecoder.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/jpeg_scaled_decoder.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Managers {
+
+TEST(JpegScaledDecoderTest, PicksTheSmallestScaleCoveringTheRequest)
+{
+    // 6000x4000: 750, 1500, 3000 pixels on the long edge at 1/8, 1/4, 1/2
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(6000, 4000, 512), 8);
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(6000, 4000, 750), 8);
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(6000, 4000, 751), 4);
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(4000, 6000, 2048), 2);
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(6000, 4000, 3001), 1);
+}
+
+TEST(JpegScaledDecoderTest, ScaledEdgesRoundUpLikeLibjpeg)
+{
+    // 1001 / 8 = 125.125, which libjpeg decodes as 126 pixels
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(1001, 10, 126), 8);
+    EXPECT_EQ(JpegScaledDecoder::scaleDenominator(1001, 10, 127), 4);
+}
+
+TEST(JpegScaledDecoderTest, DetectsJpegExtensionsCaseInsensitively)
+{
+    EXPECT_TRUE(JpegScaledDecoder::isJpegFile("/photos/IMG_0001.JPG"));
+    EXPECT_TRUE(JpegScaledDecoder::isJpegFile("scan.jpeg"));
+    EXPECT_TRUE(JpegScaledDecoder::isJpegFile("old.jpe"));
+    EXPECT_FALSE(JpegScaledDecoder::isJpegFile("frame.png"));
+    EXPECT_FALSE(JpegScaledDecoder::isJpegFile("jpg"));
+}
+
+TEST(JpegScaledDecoderTest, MissingFileIsAnError)
+{
+    EXPECT_FALSE(JpegScaledDecoder::decode("/nonexistent/photo.jpg", 256).has_value());
+}
+
+} // namespace CaptureMoment::Core::Managers
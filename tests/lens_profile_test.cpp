@@ -0,0 +1,121 @@
+/**
+ * @file lens_profile_test.cpp
+ * @brief Profile parsing, radial table and CPU correction tests of LensProfile and OperationLensCorrection.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/geometry_operations/lens_profile.h"
+#include "operations/geometry_operations/operation_lens_correction.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor lensCorrection(const std::string& profile, float amount = 1.0f)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::LensCorrection;
+    descriptor.name = "LensCorrection";
+    descriptor.setParam(ParameterKey::LensProfile, profile);
+    descriptor.setParam(ParameterKey::Value, amount);
+    return descriptor;
+}
+
+/**
+ * @brief Single-channel image of a constant value.
+ */
+[[nodiscard]] Common::ImageRegion flat(Common::ImageDim width, Common::ImageDim height, float value)
+{
+    return Common::ImageRegion{ Common::PixelBuffer(width * height, value), width, height, 1 };
+}
+
+} // anonymous namespace
+
+TEST(LensProfileTest, ParsesWhatItFormats)
+{
+    LensProfile profile;
+    profile.m_distortion = { 0.01f, -0.04f, 0.02f };
+    profile.m_vignetting = { -0.3f, 0.05f, 0.0f };
+    profile.m_chromatic = { 1.002f, 0.998f };
+
+    const auto parsed { LensProfile::parse(profile.format()) };
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(*parsed, profile);
+    EXPECT_FALSE(parsed->isIdentity());
+
+    EXPECT_FALSE(LensProfile::parse("0,0,0;0,0,0").has_value());
+    EXPECT_FALSE(LensProfile::parse("0,0,0;0,0,0;1").has_value());
+    EXPECT_FALSE(LensProfile::parse("0,0,0;0,0,0;0,1").has_value());
+    EXPECT_TRUE(LensProfile::parse("0,0,0;0,0,0;1,1")->isIdentity());
+}
+
+TEST(LensProfileTest, TableSamplesTheModels)
+{
+    LensProfile profile;
+    profile.m_distortion = { 0.0f, 0.0f, 0.1f };
+    profile.m_vignetting = { -0.5f, 0.0f, 0.0f };
+    profile.m_chromatic = { 1.01f, 0.99f };
+    const auto table { profile.sample() };
+
+    // Center: the scale is d = 1 - a - b - c, nothing to divide out
+    const auto center { LensProfile::lookup(table, 0.0f) };
+    EXPECT_NEAR(center[1], 0.9f, 1.0e-6f);
+    EXPECT_NEAR(center[0], 0.9f * 1.01f, 1.0e-6f);
+    EXPECT_NEAR(center[2], 0.9f * 0.99f, 1.0e-6f);
+    EXPECT_NEAR(center[LensProfile::k_gain_entry], 1.0f, 1.0e-6f);
+
+    // Corner: scale c + d = 1, the falloff 1 + k1 is divided out
+    const auto corner { LensProfile::lookup(table, 1.0f) };
+    EXPECT_NEAR(corner[1], 1.0f, 1.0e-6f);
+    EXPECT_NEAR(corner[LensProfile::k_gain_entry], 2.0f, 1.0e-5f);
+}
+
+TEST(LensProfileTest, TablesAreCachedByProfile)
+{
+    LensProfile::clearCache();
+    LensProfile profile;
+    profile.m_vignetting = { -0.2f, 0.0f, 0.0f };
+
+    const auto first { LensProfile::table(profile) };
+    const auto second { LensProfile::table(profile) };
+    EXPECT_EQ(first.data(), second.data());
+}
+
+TEST(LensProfileTest, MoveToFrontKeepsTheOthersInOrder)
+{
+    OperationDescriptor exposure;
+    exposure.type = OperationType::Exposure;
+    OperationDescriptor contrast;
+    contrast.type = OperationType::Contrast;
+    std::vector<OperationDescriptor> chain{ exposure, contrast, lensCorrection("0,0,0;0,0,0;1,1") };
+
+    LensProfile::moveToFront(chain);
+    EXPECT_EQ(chain[0].type, OperationType::LensCorrection);
+    EXPECT_EQ(chain[1].type, OperationType::Exposure);
+    EXPECT_EQ(chain[2].type, OperationType::Contrast);
+}
+
+TEST(OperationLensCorrectionTest, DividesTheVignettingOut)
+{
+    OperationLensCorrection operation;
+
+    // A flat field keeps its value wherever it is sampled: only the gain shows
+    auto image { flat(9, 9, 0.5f) };
+    ASSERT_TRUE(operation.executeOnImageRegion(image, lensCorrection("0.02,0,-0.05;-0.4,0,0;1,1")).has_value());
+    EXPECT_NEAR(image.getBuffer()[4 * 9 + 4], 0.5f, 1.0e-6f);
+    EXPECT_GT(image.getBuffer()[0], 0.5f);
+
+    // No amount, no change
+    auto untouched { flat(9, 9, 0.5f) };
+    ASSERT_TRUE(operation.executeOnImageRegion(untouched, lensCorrection("0.02,0,-0.05;-0.4,0,0;1,1", 0.0f)).has_value());
+    EXPECT_TRUE(std::ranges::all_of(untouched.getBuffer(), [](float value) { return value == 0.5f; }));
+}
+
+} // namespace CaptureMoment::Core::Operations
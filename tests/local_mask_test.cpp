@@ -0,0 +1,120 @@
+/**
+ * @file local_mask_test.cpp
+ * @brief Sparse storage, strokes, pyramid and blending of the local masks.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/masks/local_mask.h"
+#include "operations/masks/mask_sampler.h"
+#include "operations/masks/mask_store.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+constexpr int k_tile = MaskTiles::k_tile_size;
+
+} // anonymous namespace
+
+TEST(LocalMaskTest, AStrokeAllocatesTheTouchedTilesOnly)
+{
+    LocalMask mask(1024, 768);
+    EXPECT_EQ(mask.level(0).allocatedTiles(), 0u);
+
+    const std::array dabs{BrushDab{.m_x = 128.0f, .m_y = 128.0f, .m_radius = 20.0f, .m_hardness = 1.0f}};
+    const Common::RegionOfInterest dirty = mask.paint(dabs);
+
+    EXPECT_EQ(dirty.m_x, 108);
+    EXPECT_EQ(dirty.m_y, 108);
+    EXPECT_EQ(dirty.m_width, 40u);
+    EXPECT_EQ(dirty.m_height, 40u);
+
+    // The dab spans tiles (1..2, 1..2) of a 16x12 grid
+    EXPECT_EQ(mask.level(0).allocatedTiles(), 4u);
+    EXPECT_FLOAT_EQ(mask.coverage(128, 128), 1.0f);
+    EXPECT_FLOAT_EQ(mask.coverage(150, 128), 0.0f);
+    EXPECT_FLOAT_EQ(mask.coverage(500, 500), 0.0f);
+}
+
+TEST(LocalMaskTest, ErasingReleasesTheTiles)
+{
+    LocalMask mask(256, 256);
+    const std::array paint{BrushDab{.m_x = 32.0f, .m_y = 32.0f, .m_radius = 10.0f, .m_hardness = 1.0f}};
+    (void)mask.paint(paint);
+    ASSERT_EQ(mask.level(0).allocatedTiles(), 1u);
+
+    const std::array erase{BrushDab{.m_x = 32.0f, .m_y = 32.0f, .m_radius = 12.0f, .m_hardness = 1.0f, .m_erase = true}};
+    (void)mask.paint(erase);
+    EXPECT_EQ(mask.level(0).allocatedTiles(), 0u);
+    EXPECT_EQ(mask.bytes(), 0u);
+}
+
+TEST(LocalMaskTest, CoarserLevelsFollowTheStrokes)
+{
+    LocalMask mask(512, 512);
+    ASSERT_EQ(mask.levelCount(), 4u); // 512, 256, 128, 64
+
+    const std::uint64_t before = mask.version();
+    const std::array dabs{BrushDab{.m_x = 400.0f, .m_y = 400.0f, .m_radius = 40.0f, .m_hardness = 1.0f}};
+    (void)mask.paint(dabs);
+    EXPECT_GT(mask.version(), before);
+
+    for (std::size_t level = 1; level < mask.levelCount(); ++level) {
+        const MaskTiles tiles = mask.level(level);
+        const int scale = 1 << level;
+        EXPECT_FLOAT_EQ(tiles.coverage(400 / scale, 400 / scale), 1.0f) << "level " << level;
+        EXPECT_FLOAT_EQ(tiles.coverage(100 / scale, 100 / scale), 0.0f) << "level " << level;
+    }
+    EXPECT_EQ(mask.levelFor(128), 2u);
+    EXPECT_EQ(mask.levelFor(512), 0u);
+}
+
+TEST(LocalMaskTest, AtlasPacksThePaintedTiles)
+{
+    LocalMask mask(256, 128);
+    const std::array dabs{BrushDab{.m_x = 200.0f, .m_y = 20.0f, .m_radius = 8.0f, .m_hardness = 1.0f}};
+    (void)mask.paint(dabs);
+
+    const LocalMask::Atlas atlas = mask.atlas(0);
+    ASSERT_EQ(atlas.m_table.width(), 256 / k_tile);
+    ASSERT_EQ(atlas.m_table.height(), 128 / k_tile);
+    ASSERT_EQ(atlas.m_tiles.dim(2).extent(), 2); // The empty slot and one tile
+
+    EXPECT_EQ(atlas.m_table(0, 0), 0);
+    const int slot = atlas.m_table(200 / k_tile, 20 / k_tile);
+    EXPECT_EQ(slot, 1);
+    EXPECT_EQ(atlas.m_tiles(200 % k_tile, 20, slot), MaskTiles::k_full_coverage);
+}
+
+TEST(LocalMaskTest, BlendKeepsTheUnmaskedPixels)
+{
+    const std::string id = MaskStore::instance().create(128, 64);
+    const std::array dabs{BrushDab{.m_x = 32.0f, .m_y = 32.0f, .m_radius = 16.0f, .m_hardness = 1.0f}};
+    (void)MaskStore::instance().find(id)->paint(dabs);
+
+    OperationDescriptor descriptor;
+    descriptor.setParam(ParameterKey::Mask, id);
+    ASSERT_TRUE(MaskSampler::isMasked(descriptor));
+
+    const std::vector<float> before(128 * 64 * 4, 0.0f);
+    Common::ImageRegion after{Common::PixelBuffer(128 * 64 * 4, 1.0f), 128, 64, 4};
+    MaskSampler::blend(before, after, descriptor);
+
+    const auto pixel = [&after](std::size_t x, std::size_t y) { return after.getBuffer()[(y * 128 + x) * 4]; };
+    EXPECT_FLOAT_EQ(pixel(32, 32), 1.0f);
+    EXPECT_FLOAT_EQ(pixel(100, 32), 0.0f);
+    EXPECT_FLOAT_EQ(after.getBuffer()[(32 * 128 + 100) * 4 + 3], 1.0f); // Alpha as the operation left it
+
+    MaskStore::instance().release(id);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,57 @@
+/**
+ * @file numa_placement_test.cpp
+ * @brief Node topology, and node-local recycling of BufferPool blocks.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/buffer_pool.h"
+#include "common/numa_topology.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief Size class used by no other test, so the free lists start empty.
+ */
+constexpr std::size_t k_block_bytes = std::size_t{7} * 1024 * 1024 + 12345;
+
+} // anonymous namespace
+
+TEST(NumaPlacementTest, TopologyHasCpus)
+{
+    const auto& topology { NumaTopology::instance() };
+    ASSERT_GE(topology.nodeCount(), 1u);
+    for (std::size_t node = 0; node < topology.nodeCount(); ++node) {
+        EXPECT_FALSE(topology.cpusOf(node).empty());
+    }
+}
+
+TEST(NumaPlacementTest, PinnedBlocksAreRecycledOnTheirNode)
+{
+    const auto& topology { NumaTopology::instance() };
+    auto& pool { BufferPool::instance() };
+
+    ASSERT_TRUE(topology.pinCurrentThread(0));
+    EXPECT_EQ(NumaTopology::pinnedNode(), 0u);
+    void* pinned_block { pool.acquire(k_block_bytes) };
+    pool.release(pinned_block, k_block_bytes);
+    topology.unpinCurrentThread();
+    EXPECT_FALSE(NumaTopology::pinnedNode().has_value());
+
+    // Unpinned threads do not get the block first touched on node 0
+    void* unpinned_block { pool.acquire(k_block_bytes) };
+    EXPECT_NE(unpinned_block, pinned_block);
+    pool.release(unpinned_block, k_block_bytes);
+
+    ASSERT_TRUE(topology.pinCurrentThread(0));
+    void* recycled { pool.acquire(k_block_bytes) };
+    EXPECT_EQ(recycled, pinned_block);
+    pool.release(recycled, k_block_bytes);
+    topology.unpinCurrentThread();
+}
+
+} // namespace CaptureMoment::Core::Common
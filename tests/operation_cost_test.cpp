@@ -0,0 +1,73 @@
+/**
+ * @file operation_cost_test.cpp
+ * @brief Tests of the operation costs and of their calibration by the backend cost model.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "image_processing/deciders/backend_cost_model.h"
+#include "operations/operation_cost.h"
+#include "operations/operation_descriptor.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor adjustment(OperationType type, float value)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = type;
+    descriptor.params.set(ParameterKey::Value, value);
+    return descriptor;
+}
+
+} // anonymous namespace
+
+TEST(OperationCostTest, IdentityAndDisabledOperationsAreFree)
+{
+    std::vector<OperationDescriptor> operations { adjustment(OperationType::Sharpen, 0.0f),
+                                                  adjustment(OperationType::Brightness, 0.5f) };
+    operations[1].enabled = false;
+
+    EXPECT_TRUE(chainCost(operations).isEmpty());
+}
+
+TEST(OperationCostTest, SpatialOperationsAddTheirHalos)
+{
+    const std::vector<OperationDescriptor> tone { adjustment(OperationType::Brightness, 0.5f) };
+    const std::vector<OperationDescriptor> detail { adjustment(OperationType::Brightness, 0.5f),
+                                                    adjustment(OperationType::Sharpen, 1.0f),
+                                                    adjustment(OperationType::Denoise, 0.5f) };
+
+    const ChainCost tone_cost { chainCost(tone) };
+    const ChainCost detail_cost { chainCost(detail) };
+    EXPECT_EQ(tone_cost.m_spatial_operations, 0u);
+    EXPECT_EQ(tone_cost.m_halo_pixels, 0u);
+    EXPECT_EQ(detail_cost.m_spatial_operations, 2u);
+    EXPECT_GT(detail_cost.m_halo_pixels, 0u);
+    EXPECT_GT(detail_cost.m_cpu_ns_per_pixel, 5.0 * tone_cost.m_cpu_ns_per_pixel);
+}
+
+TEST(OperationCostTest, CalibrationReproducesTheBenchmark)
+{
+    ImageProcessing::BackendCostModel model { ImageProcessing::BackendProfile { 1.0, 12.0, 0.0 },
+                                              ImageProcessing::BackendProfile { 4.0, 1.5, 2.0 } };
+    const ChainCost benchmark { benchmarkChainCost() };
+    model.calibrate(benchmark);
+
+    for (const auto backend : { Common::MemoryType::CPU_RAM, Common::MemoryType::GPU_MEMORY }) {
+        EXPECT_NEAR(*model.estimateMilliseconds(backend, benchmark, 6000, 4000),
+                    *model.estimateMilliseconds(backend, 6000, 4000), 1e-6);
+    }
+
+    // A heavier chain on the same image costs more, the fixed costs apart
+    const std::vector<OperationDescriptor> detail { adjustment(OperationType::Denoise, 0.5f) };
+    EXPECT_GT(*model.estimateMilliseconds(Common::MemoryType::CPU_RAM, chainCost(detail), 6000, 4000),
+              *model.estimateMilliseconds(Common::MemoryType::CPU_RAM, 6000, 4000));
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,122 @@
+/**
+ * @file operation_plugin_registry_test.cpp
+ * @brief Tests of the registration, naming and storage of plugin operations.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/interfaces/i_operation.h"
+#include "operations/operation_factory.h"
+#include "operations/operation_registry.h"
+#include "operations/plugins/operation_plugin_registry.h"
+#include "serializer/binary_edit_format.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+/**
+ * @brief Operation of a test plugin: no effect, reports the type it was given.
+ */
+class NoOpPluginOperation : public IOperation {
+public:
+    explicit NoOpPluginOperation(OperationType type) : m_type(type) {}
+
+    [[nodiscard]] OperationType type() const override { return m_type; }
+    [[nodiscard]] const char* name() const override { return "No-op"; }
+
+    [[nodiscard]] std::expected<void, ErrorHandling::CoreError> execute(ImageProcessing::IWorkingImageHardware&,
+                                                                        const OperationDescriptor&) override
+    {
+        return {};
+    }
+
+private:
+    OperationType m_type;
+};
+
+[[nodiscard]] PluginOperationCreator noOpCreator()
+{
+    return [](OperationType type) { return std::make_unique<NoOpPluginOperation>(type); };
+}
+
+} // anonymous namespace
+
+// The registry is process-wide: every test adds operations of its own names
+
+TEST(OperationPluginRegistryTest, AssignsTypesAboveTheBuiltInOnes)
+{
+    const auto type { OperationPluginRegistry::addOperation("test.Assigned", noOpCreator()) };
+    ASSERT_TRUE(type.has_value());
+
+    EXPECT_GE(std::to_underlying(*type), OperationPluginRegistry::k_first_plugin_type);
+    EXPECT_TRUE(OperationPluginRegistry::contains(*type));
+    EXPECT_FALSE(OperationPluginRegistry::contains(OperationType::Exposure));
+}
+
+TEST(OperationPluginRegistryTest, RefusesUnqualifiedAndDuplicateNames)
+{
+    EXPECT_FALSE(OperationPluginRegistry::addOperation("Exposure", noOpCreator()).has_value());
+    EXPECT_FALSE(OperationPluginRegistry::addOperation("test.", noOpCreator()).has_value());
+    EXPECT_FALSE(OperationPluginRegistry::addOperation("test.With space", noOpCreator()).has_value());
+    EXPECT_FALSE(OperationPluginRegistry::addOperation("test.NoCreator", PluginOperationCreator{}).has_value());
+
+    ASSERT_TRUE(OperationPluginRegistry::addOperation("test.Duplicate", noOpCreator()).has_value());
+    EXPECT_FALSE(OperationPluginRegistry::addOperation("test.Duplicate", noOpCreator()).has_value());
+}
+
+TEST(OperationPluginRegistryTest, NamesBuiltInAndPluginTypes)
+{
+    const auto type { OperationPluginRegistry::addOperation("test.Named", noOpCreator()) };
+    ASSERT_TRUE(type.has_value());
+
+    EXPECT_EQ(OperationPluginRegistry::typeName(OperationType::Contrast), "Contrast");
+    EXPECT_EQ(OperationPluginRegistry::typeName(*type), "test.Named");
+    EXPECT_EQ(OperationPluginRegistry::findType("Contrast"), OperationType::Contrast);
+    EXPECT_EQ(OperationPluginRegistry::findType("test.Named"), type);
+    EXPECT_FALSE(OperationPluginRegistry::findType("test.Unknown").has_value());
+}
+
+TEST(OperationPluginRegistryTest, FactoriesCreatePluginOperations)
+{
+    const auto type { OperationPluginRegistry::addOperation("test.Created", noOpCreator()) };
+    ASSERT_TRUE(type.has_value());
+
+    OperationFactory factory;
+    OperationRegistry::registerAll(factory);
+
+    OperationDescriptor descriptor;
+    descriptor.type = *type;
+    const auto operation { factory.create(descriptor) };
+    ASSERT_TRUE(operation.has_value());
+    ASSERT_NE(operation->get(), nullptr);
+    EXPECT_EQ((*operation)->type(), *type);
+}
+
+TEST(OperationPluginRegistryTest, BinaryEditsKeepPluginOperations)
+{
+    const auto type { OperationPluginRegistry::addOperation("test.Stored", noOpCreator()) };
+    ASSERT_TRUE(type.has_value());
+
+    std::vector<OperationDescriptor> operations(1);
+    operations[0].id = 7;
+    operations[0].type = *type;
+    operations[0].name = "Stored";
+    operations[0].params.set(ParameterKey::Value, 0.5f);
+
+    const std::string bytes { Serializer::encodeEditStack(operations) };
+    const auto decoded { Serializer::decodeEditStack(std::as_bytes(std::span { bytes.data(), bytes.size() })) };
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, operations);
+}
+
+} // namespace CaptureMoment::Core::Operations
@@ -0,0 +1,43 @@
+/**
+ * @file operation_serialization_test.cpp
+ * @brief Round-trip tests of the XMP parameter values.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/operation_serialization.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <variant>
+
+namespace CaptureMoment::Core::Serializer {
+
+TEST(OperationSerializationTest, FloatsReadBackExactlyAndAsFloats)
+{
+    for (const float value : { 0.0f, 1.0f, -2.0f, 0.1f, 1.0e-7f, 3.4028235e38f, -0.333333343f }) {
+        const std::string text { serializeParameter(value) };
+        const Operations::OperationValue parsed { deserializeParameter(text) };
+        ASSERT_TRUE(std::holds_alternative<float>(parsed)) << text;
+        EXPECT_EQ(std::get<float>(parsed), value) << text;
+    }
+    EXPECT_EQ(serializeParameter(0.5f), "0.5");
+    EXPECT_EQ(serializeParameter(1.0f), "1.0");
+}
+
+TEST(OperationSerializationTest, OtherTypesReadBack)
+{
+    EXPECT_EQ(std::get<int>(deserializeParameter(serializeParameter(-42))), -42);
+    EXPECT_EQ(std::get<bool>(deserializeParameter(serializeParameter(true))), true);
+    EXPECT_EQ(std::get<std::string>(deserializeParameter(serializeParameter(std::string("srgb")))), "srgb");
+}
+
+TEST(OperationSerializationTest, AppendKeepsThePrefix)
+{
+    std::string out { "param=" };
+    appendParameter(out, 2.25f);
+    EXPECT_EQ(out, "param=2.25");
+}
+
+} // namespace CaptureMoment::Core::Serializer
@@ -0,0 +1,139 @@
+/**
+ * @file perceptual_index_test.cpp
+ * @brief Difference hash, near-duplicate lookups and burst grouping of PerceptualIndex.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "catalog/perceptual_index.h"
+#include "utils/perceptual_hash.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace CaptureMoment::Core::Catalog {
+
+namespace {
+
+/**
+ * @brief RGBA image whose luminance rises from left to right, with a bright square.
+ */
+std::vector<float> testImage(std::size_t width, std::size_t height)
+{
+    std::vector<float> pixels(width * height * 4);
+    for (std::size_t y = 0; y < height; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            const bool square { x > width / 4 && x < width / 2 && y > height / 4 && y < height / 2 };
+            const float value { square ? 1.0f : 0.5f * static_cast<float>(x) / static_cast<float>(width) };
+            float* pixel { pixels.data() + (y * width + x) * 4 };
+            pixel[0] = pixel[1] = pixel[2] = value;
+            pixel[3] = 1.0f;
+        }
+    }
+    return pixels;
+}
+
+/**
+ * @brief `hash` with `bits` distinct random bits flipped.
+ */
+std::uint64_t flip(std::uint64_t hash, int bits, std::mt19937_64& random)
+{
+    std::vector<int> positions(64);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::shuffle(positions.begin(), positions.end(), random);
+    for (int i = 0; i < bits; ++i) {
+        hash ^= std::uint64_t{1} << positions[static_cast<std::size_t>(i)];
+    }
+    return hash;
+}
+
+} // anonymous namespace
+
+TEST(PerceptualIndexTest, DifferenceHashIgnoresTheSize)
+{
+    const auto large { testImage(640, 480) };
+    const auto small { testImage(160, 120) };
+    const std::uint64_t large_hash { Utils::differenceHash(large.data(), 640, 480, 4) };
+    const std::uint64_t small_hash { Utils::differenceHash(small.data(), 160, 120, 4) };
+
+    EXPECT_NE(large_hash, 0u);
+    EXPECT_LE(Utils::hammingDistance(large_hash, small_hash), 2);
+
+    // Smaller than the 9x8 grid: still a hash, no read past the end
+    const auto tiny { testImage(3, 2) };
+    EXPECT_NE(Utils::differenceHash(tiny.data(), 3, 2, 4), 0u);
+    EXPECT_EQ(Utils::differenceHash(nullptr, 0, 0, 4), 0u);
+}
+
+TEST(PerceptualIndexTest, LookupsMatchABruteForceScan)
+{
+    std::mt19937_64 random { 7 };
+
+    // Clusters of near-duplicates among unrelated images
+    std::vector<PerceptualHashEntry> entries;
+    for (ImageId id = 1; id <= 3000; ++id) {
+        const std::uint64_t hash { id % 3 == 0 && !entries.empty()
+                                       ? flip(entries[random() % entries.size()].m_hash, static_cast<int>(random() % 6), random)
+                                       : random() };
+        entries.push_back(PerceptualHashEntry { id, hash, {} });
+    }
+    const PerceptualIndex index { entries };
+    ASSERT_EQ(index.size(), entries.size());
+
+    for (const int radius : { 0, 3, 7 }) {
+        for (std::size_t query = 0; query < entries.size(); query += 97) {
+            std::vector<ImageId> expected;
+            for (const auto& entry : entries) {
+                if (Utils::hammingDistance(entry.m_hash, entries[query].m_hash) <= radius) {
+                    expected.push_back(entry.m_id);
+                }
+            }
+            EXPECT_EQ(index.near(entries[query].m_hash, radius), expected) << "radius " << radius;
+        }
+    }
+
+    // Every image of a group has a duplicate in it; no image is in two groups
+    const auto groups { index.duplicateGroups() };
+    std::vector<ImageId> grouped;
+    for (const auto& group : groups) {
+        ASSERT_GE(group.size(), 2u);
+        grouped.insert(grouped.end(), group.begin(), group.end());
+    }
+    std::ranges::sort(grouped);
+    EXPECT_EQ(std::ranges::adjacent_find(grouped), grouped.end());
+    for (const auto& entry : entries) {
+        const bool has_duplicate { index.near(entry.m_hash, PerceptualIndex::k_default_duplicate_radius).size() > 1 };
+        EXPECT_EQ(std::ranges::binary_search(grouped, entry.m_id), has_duplicate) << "image " << entry.m_id;
+    }
+}
+
+TEST(PerceptualIndexTest, BurstsAreConsecutiveSimilarFrames)
+{
+    const std::uint64_t scene { 0x0123456789ABCDEFull };
+    const std::uint64_t other { ~scene };
+    const std::vector<PerceptualHashEntry> entries {
+        { 1, scene, "2026:03:14 10:00:00" },
+        { 2, scene ^ 0x3, "2026:03:14 10:00:00" },
+        { 3, scene ^ 0x7, "2026:03:14 10:00:01" },
+        { 4, other, "2026:03:14 10:00:01" },        // another subject
+        { 5, other ^ 0x1, "2026:03:14 10:05:00" },  // same subject, minutes later
+        { 6, scene, "" },                           // no capture date
+        { 7, other, "2026:03:14 11:00:00" },
+        { 8, other ^ 0x10, "2026-03-14 11:00:02" },
+    };
+
+    const auto bursts { PerceptualIndex::burstGroups(entries) };
+    ASSERT_EQ(bursts.size(), 2u);
+    EXPECT_EQ(bursts[0], (std::vector<ImageId> { 1, 2, 3 }));
+    EXPECT_EQ(bursts[1], (std::vector<ImageId> { 7, 8 }));
+
+    EXPECT_EQ(PerceptualIndex::captureSeconds("1970:01:02 00:00:01"), 86401);
+    EXPECT_FALSE(PerceptualIndex::captureSeconds("0000:00:00 00:00:00").has_value());
+    EXPECT_FALSE(PerceptualIndex::captureSeconds("yesterday").has_value());
+}
+
+} // namespace CaptureMoment::Core::Catalog
@@ -0,0 +1,67 @@
+/**
+ * @file performance_profile_test.cpp
+ * @brief Parsing of the performance profile files.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "config/performance_profile.h"
+
+#include <gtest/gtest.h>
+
+namespace CaptureMoment::Core::Config {
+
+TEST(PerformanceProfileTest, ParsesEverySetting)
+{
+    const auto profile { PerformanceProfile::parse(R"({
+        // Comments are allowed
+        "threads": { "budget": 16, "refine": 12, "thumbnail": 2 },
+        "memory_budget_mb": 24576,
+        "source_tile_cache_mb": 4096,
+        "proxy_max_long_edge": 2560,
+        "cpu_tile_size": 128,
+        "fp16": true,
+        "pipeline_cache_size": 32,
+        "backend": "gpu"
+    })") };
+    ASSERT_TRUE(profile.has_value());
+
+    EXPECT_EQ(profile->m_threads, 16u);
+    EXPECT_FALSE(profile->m_priority_threads[0].has_value());
+    EXPECT_EQ(profile->m_priority_threads[1], 12u);
+    EXPECT_EQ(profile->m_priority_threads[3], 2u);
+    EXPECT_EQ(profile->m_memory_budget_mb, 24576u);
+    EXPECT_EQ(profile->m_source_tile_cache_mb, 4096.0f);
+    EXPECT_EQ(profile->m_proxy_max_long_edge, 2560u);
+    EXPECT_EQ(profile->m_cpu_tile_size, 128);
+    EXPECT_EQ(profile->m_fp16, true);
+    EXPECT_EQ(profile->m_pipeline_cache_size, 32u);
+    ASSERT_TRUE(profile->m_backend.has_value());
+    EXPECT_EQ(*profile->m_backend, Common::MemoryType::GPU_MEMORY);
+}
+
+TEST(PerformanceProfileTest, AbsentKeysStayUnset)
+{
+    const auto profile { PerformanceProfile::parse(R"({ "backend": "auto", "unknown": 1 })") };
+    ASSERT_TRUE(profile.has_value());
+
+    // "auto" is set, to nothing: the selection decides again
+    ASSERT_TRUE(profile->m_backend.has_value());
+    EXPECT_FALSE(profile->m_backend->has_value());
+    EXPECT_FALSE(profile->m_threads.has_value());
+    EXPECT_FALSE(profile->m_fp16.has_value());
+    EXPECT_FALSE(profile->m_memory_budget_mb.has_value());
+}
+
+TEST(PerformanceProfileTest, RejectsMalformedProfilesWhole)
+{
+    EXPECT_FALSE(PerformanceProfile::parse("{ \"fp16\": true").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse("[1, 2]").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse(R"({ "fp16": 1 })").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse(R"({ "memory_budget_mb": -1 })").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse(R"({ "threads": 8 })").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse(R"({ "threads": { "export": "all" } })").has_value());
+    EXPECT_FALSE(PerformanceProfile::parse(R"({ "backend": "tpu" })").has_value());
+}
+
+} // namespace CaptureMoment::Core::Config
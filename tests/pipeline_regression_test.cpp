@@ -0,0 +1,459 @@
+/**
+ * @file pipeline_regression_test.cpp
+ * @brief Golden-image and time-budget regression tests of the fused and fallback pipelines.
+ *
+ * @details
+ * Every registered operation (at its minimum, half its maximum and its maximum), plus a
+ * combined tone edit, runs on the reference images through each execution path:
+ * - `FallbackPipelineExecutor` (sequential, CPU), the reference the goldens are written from;
+ * - `OperationPipelineExecutor` on the CPU, with RGBA_F32 and RGBA_F16 working storage, and
+ *   with planar RGBA_F32 storage;
+ * - `OperationPipelineExecutor` on the GPU (skipped without a GPU Halide target).
+ *
+ * Each output is compared against `tests/golden/<image>_<case>.exr` within the tolerance of
+ * its path. Missing goldens skip the comparison; `CAPTUREMOMENT_UPDATE_GOLDENS=1` (re)writes
+ * them from the fallback path.
+ *
+ * The budget tests time the tone edit on a 12 MP image per path (median of several runs,
+ * JIT compilation excluded) against fixed budgets, scaled by `CAPTUREMOMENT_PERF_BUDGET_SCALE`.
+ *
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "test_common.h"
+
+#include "config/app_config.h"
+#include "image_processing/factories/working_image_factory.h"
+#include "operations/operation_factory.h"
+#include "operations/operation_ranges.h"
+#include "operations/operation_registry.h"
+#include "pipeline/fallback_pipeline_executor.h"
+#include "pipeline/operation_pipeline_executor.h"
+#include "pipeline/pipeline_builder.h"
+
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <array>
+#include <expected>
+#include <format>
+#include <ostream>
+#include <tuple>
+#include <utility>
+
+namespace CaptureMoment::Tests {
+
+namespace {
+
+using Core::Operations::OperationDescriptor;
+using Core::Operations::OperationType;
+
+/**
+ * @brief The ways an edit can be executed.
+ */
+enum class ExecutionPath : std::uint8_t {
+    Fallback,
+    FusedCpu,
+    FusedCpuHalf,
+    FusedCpuPlanar,
+    FusedGpu,
+};
+
+constexpr std::array k_all_paths { ExecutionPath::Fallback, ExecutionPath::FusedCpu,
+                                   ExecutionPath::FusedCpuHalf, ExecutionPath::FusedCpuPlanar,
+                                   ExecutionPath::FusedGpu };
+
+/**
+ * @brief Tolerance of each path against the goldens.
+ * @details The fallback wrote them (only compiler and FMA differences remain). The fused paths
+ *          evaluate the tone curves through a LUT; half storage rounds input and output to 11 bits.
+ */
+Tolerance toleranceOf(ExecutionPath path)
+{
+    switch (path) {
+    case ExecutionPath::Fallback:
+        return { .m_absolute = 1.0e-5f, .m_relative = 1.0e-5f, .m_mean_absolute = 1.0e-6f };
+    case ExecutionPath::FusedCpu:
+    case ExecutionPath::FusedCpuPlanar:
+    case ExecutionPath::FusedGpu:
+        return { .m_absolute = 2.0e-3f, .m_relative = 4.0e-3f, .m_mean_absolute = 5.0e-4f };
+    case ExecutionPath::FusedCpuHalf:
+        return { .m_absolute = 4.0e-3f, .m_relative = 1.0e-2f, .m_mean_absolute = 1.0e-3f };
+    }
+    return {};
+}
+
+/**
+ * @brief Time budget of the 12 MP tone edit on each path, in ms (before scaling).
+ */
+double budgetMsOf(ExecutionPath path)
+{
+    switch (path) {
+    case ExecutionPath::Fallback:
+        return 3000.0;
+    case ExecutionPath::FusedCpu:
+    case ExecutionPath::FusedCpuHalf:
+    case ExecutionPath::FusedCpuPlanar:
+        return 250.0;
+    case ExecutionPath::FusedGpu:
+        return 100.0;
+    }
+    return 0.0;
+}
+
+/**
+ * @brief Value range of an operation (a symmetric default for operations added later).
+ */
+std::pair<float, float> valueRangeOf(OperationType type)
+{
+    using Core::Operations::OperationRanges;
+    switch (type) {
+    case OperationType::Brightness:
+        return { OperationRanges::getBrightnessMinValue(), OperationRanges::getBrightnessMaxValue() };
+    case OperationType::Contrast:
+        return { OperationRanges::getContrastMinValue(), OperationRanges::getContrastMaxValue() };
+    case OperationType::Highlights:
+        return { OperationRanges::getHighlightsMinValue(), OperationRanges::getHighlightsMaxValue() };
+    case OperationType::Shadows:
+        return { OperationRanges::getShadowsMinValue(), OperationRanges::getShadowsMaxValue() };
+    case OperationType::Whites:
+        return { OperationRanges::getWhitesMinValue(), OperationRanges::getWhitesMaxValue() };
+    case OperationType::Blacks:
+        return { OperationRanges::getBlacksMinValue(), OperationRanges::getBlacksMaxValue() };
+    case OperationType::Exposure:
+        return { OperationRanges::getExposureMinValue(), OperationRanges::getExposureMaxValue() };
+    case OperationType::Saturation:
+        return { OperationRanges::getSaturationMinValue(), OperationRanges::getSaturationMaxValue() };
+    case OperationType::Clarity:
+        return { OperationRanges::getClarityMinValue(), OperationRanges::getClarityMaxValue() };
+    case OperationType::ToneCurve:
+        return { OperationRanges::getToneCurveRegionMinValue(), OperationRanges::getToneCurveRegionMaxValue() };
+    case OperationType::Lut3D:
+        return { OperationRanges::getLut3DMinValue(), OperationRanges::getLut3DMaxValue() };
+    case OperationType::WhiteBalance:
+        return { OperationRanges::getWhiteBalanceShiftMinValue(), OperationRanges::getWhiteBalanceShiftMaxValue() };
+    case OperationType::Crop:
+        return { OperationRanges::getStraightenAngleMinValue(), OperationRanges::getStraightenAngleMaxValue() };
+    case OperationType::LensCorrection:
+        return { OperationRanges::getLensCorrectionMinValue(), OperationRanges::getLensCorrectionMaxValue() };
+    case OperationType::Denoise:
+        return { OperationRanges::getDenoiseMinValue(), OperationRanges::getDenoiseMaxValue() };
+    case OperationType::Sharpen:
+        return { OperationRanges::getSharpenMinValue(), OperationRanges::getSharpenMaxValue() };
+    default:
+        return { -1.0f, 1.0f };
+    }
+}
+
+OperationDescriptor makeDescriptor(OperationType type, float value)
+{
+    OperationDescriptor descriptor;
+    descriptor.type = type;
+    descriptor.name = std::string(magic_enum::enum_name(type));
+    descriptor.enabled = true;
+    if (type == OperationType::ToneCurve) {
+        // No single value: the value moves every parametric region, over an S-shaped point curve
+        using Core::Operations::ParameterKey;
+        for (const ParameterKey key : { ParameterKey::CurveShadows, ParameterKey::CurveDarks,
+                                        ParameterKey::CurveLights, ParameterKey::CurveHighlights }) {
+            descriptor.setParam(key, value);
+        }
+        descriptor.setParam(ParameterKey::CurvePoints, std::string("0,0;0.25,0.2;0.75,0.8;1,1"));
+        return descriptor;
+    }
+    if (type == OperationType::WhiteBalance) {
+        // No single value and no source profile: a temperature and tint shift of developed images
+        descriptor.setParam(Core::Operations::ParameterKey::Temperature, value);
+        descriptor.setParam(Core::Operations::ParameterKey::Tint, 0.5f * value);
+        return descriptor;
+    }
+    if (type == OperationType::Crop) {
+        // The whole frame, straightened: every path resamples every pixel
+        descriptor.setParam(Core::Operations::ParameterKey::Angle, value);
+        return descriptor;
+    }
+    if (type == OperationType::LensCorrection) {
+        // Barrel distortion, vignetting and lateral CA: every pixel moves, the corners most
+        descriptor.setParam(Core::Operations::ParameterKey::LensProfile, std::string("0.01,-0.04,0.02;-0.3,0.05,0;1.002,0.998"));
+    }
+    if (type == OperationType::Denoise) {
+        // Both the luminance and the color planes shrunk
+        descriptor.setParam(Core::Operations::ParameterKey::ColorNoise, value);
+    }
+    descriptor.setParam(Core::Operations::ParameterKey::Value, value);
+    return descriptor;
+}
+
+/**
+ * @brief A named edit.
+ */
+struct RegressionCase {
+    std::string m_name;
+    std::vector<OperationDescriptor> m_operations;
+};
+
+/**
+ * @brief Prints the case name in the test reports.
+ */
+void PrintTo(const RegressionCase& regression_case, std::ostream* os)
+{
+    *os << regression_case.m_name;
+}
+
+const Core::Operations::OperationFactory& factory()
+{
+    static const Core::Operations::OperationFactory instance = [] {
+        Core::Operations::OperationFactory registered;
+        Core::Operations::OperationRegistry::registerAll(registered);
+        return registered;
+    }();
+    return instance;
+}
+
+/**
+ * @brief One typical value per tone operation, applied together.
+ */
+RegressionCase toneEdit()
+{
+    RegressionCase edit { "ToneEdit", {} };
+    const std::pair<OperationType, float> values[] {
+        { OperationType::Brightness, 0.05f }, { OperationType::Contrast, 0.2f },
+        { OperationType::Highlights, -0.4f }, { OperationType::Shadows, 0.3f },
+        { OperationType::Whites, 0.1f },      { OperationType::Blacks, -0.1f },
+    };
+    for (const auto& [type, value] : values) {
+        edit.m_operations.push_back(makeDescriptor(type, value));
+    }
+    return edit;
+}
+
+/**
+ * @brief Every registered operation at its extremes and half its maximum, then the tone edit.
+ */
+std::vector<RegressionCase> regressionCases()
+{
+    std::vector<RegressionCase> cases;
+    for (const OperationType type : factory().registeredTypes()) {
+        const auto [min_value, max_value] { valueRangeOf(type) };
+        const std::string name { magic_enum::enum_name(type) };
+
+        cases.push_back({ name + "_Min", { makeDescriptor(type, min_value) } });
+        cases.push_back({ name + "_Half", { makeDescriptor(type, 0.5f * max_value) } });
+        cases.push_back({ name + "_Max", { makeDescriptor(type, max_value) } });
+    }
+    cases.push_back(toneEdit());
+    return cases;
+}
+
+/**
+ * @brief Sets the working image storage format for the scope of a test.
+ */
+class ScopedWorkingFormat {
+public:
+    explicit ScopedWorkingFormat(Core::Common::PixelFormat format)
+        : m_previous(Core::Config::AppConfig::instance().getWorkingPixelFormat())
+    {
+        Core::Config::AppConfig::instance().setWorkingPixelFormat(format);
+    }
+
+    ~ScopedWorkingFormat() { Core::Config::AppConfig::instance().setWorkingPixelFormat(m_previous); }
+
+    ScopedWorkingFormat(const ScopedWorkingFormat&) = delete;
+    ScopedWorkingFormat& operator=(const ScopedWorkingFormat&) = delete;
+
+private:
+    Core::Common::PixelFormat m_previous;
+};
+
+/**
+ * @brief Sets the working image storage layout for the scope of a test.
+ */
+class ScopedWorkingLayout {
+public:
+    explicit ScopedWorkingLayout(Core::Common::PixelLayout layout)
+        : m_previous(Core::Config::AppConfig::instance().getWorkingPixelLayout())
+    {
+        Core::Config::AppConfig::instance().setWorkingPixelLayout(layout);
+    }
+
+    ~ScopedWorkingLayout() { Core::Config::AppConfig::instance().setWorkingPixelLayout(m_previous); }
+
+    ScopedWorkingLayout(const ScopedWorkingLayout&) = delete;
+    ScopedWorkingLayout& operator=(const ScopedWorkingLayout&) = delete;
+
+private:
+    Core::Common::PixelLayout m_previous;
+};
+
+/**
+ * @brief A working image and the executor of one path, ready to run an edit.
+ */
+struct PreparedRun {
+    std::unique_ptr<Core::ImageProcessing::IWorkingImageHardware> m_working;
+    std::unique_ptr<Core::Pipeline::IPipelineExecutor> m_executor;
+};
+
+/**
+ * @brief Builds the working image and executor of @p path.
+ * @return The run, or the reason it is unavailable on this machine.
+ */
+std::expected<PreparedRun, std::string> prepare(ExecutionPath path,
+                                                const Core::Common::ImageRegion& source,
+                                                const std::vector<OperationDescriptor>& operations)
+{
+    const Core::Common::MemoryType backend { path == ExecutionPath::FusedGpu ? Core::Common::MemoryType::GPU_MEMORY
+                                                                             : Core::Common::MemoryType::CPU_RAM };
+    if (backend == Core::Common::MemoryType::GPU_MEMORY && !Core::Config::AppConfig::hasGpuHalideTarget()) {
+        return std::unexpected("no GPU Halide target on this machine");
+    }
+
+    const ScopedWorkingFormat format { path == ExecutionPath::FusedCpuHalf ? Core::Common::PixelFormat::RGBA_F16
+                                                                           : Core::Common::PixelFormat::RGBA_F32 };
+    const ScopedWorkingLayout layout { path == ExecutionPath::FusedCpuPlanar ? Core::Common::PixelLayout::Planar
+                                                                             : Core::Common::PixelLayout::Interleaved };
+
+    PreparedRun run;
+    run.m_working = Core::ImageProcessing::WorkingImageFactory::create(source, backend);
+    if (!run.m_working) {
+        return std::unexpected("working image unavailable on this backend");
+    }
+
+    if (path == ExecutionPath::Fallback) {
+        run.m_executor = std::make_unique<Core::Pipeline::FallbackPipelineExecutor>(
+            std::vector<OperationDescriptor>(operations), factory());
+        return run;
+    }
+
+    run.m_executor = Core::Pipeline::PipelineBuilder::build(Core::Pipeline::PipelineType::HalideOperation);
+    auto* executor { dynamic_cast<Core::Pipeline::OperationPipelineExecutor*>(run.m_executor.get()) };
+    if (!executor) {
+        return std::unexpected("no Halide executor registered");
+    }
+    executor->init(std::vector<OperationDescriptor>(operations), factory());
+    return run;
+}
+
+std::string pathName(const ::testing::TestParamInfo<ExecutionPath>& info)
+{
+    return std::string(magic_enum::enum_name(info.param));
+}
+
+// ============================================================
+// Golden-image regression
+// ============================================================
+
+class PipelineRegressionTest : public ::testing::TestWithParam<std::tuple<RegressionCase, ExecutionPath>> {};
+
+TEST_P(PipelineRegressionTest, MatchesGolden)
+{
+    const auto& [regression_case, path] { GetParam() };
+    const bool update { updateGoldens() && path == ExecutionPath::Fallback };
+
+    for (const ReferenceImage& reference : referenceImages()) {
+        SCOPED_TRACE(reference.m_name);
+        const std::string golden_name { std::format("{}_{}", reference.m_name, regression_case.m_name) };
+
+        auto run { prepare(path, *reference.m_image, regression_case.m_operations) };
+        if (!run) {
+            GTEST_SKIP() << run.error();
+        }
+
+        ASSERT_TRUE(run->m_executor->execute(*run->m_working)) << "execute failed";
+        auto output { run->m_working->exportToCPUCopy() };
+        ASSERT_TRUE(output.has_value()) << "export failed";
+
+        if (update) {
+            ASSERT_TRUE(saveGolden(golden_name, **output)) << "cannot write golden " << golden_name;
+            continue;
+        }
+
+        const auto golden { loadGolden(golden_name) };
+        if (!golden) {
+            GTEST_SKIP() << "no golden " << golden_name << " (run with CAPTUREMOMENT_UPDATE_GOLDENS=1 to create it)";
+        }
+
+        const ImageDiff diff { compareImages(**output, *golden, toleranceOf(path)) };
+        EXPECT_TRUE(diff.passes(toleranceOf(path))) << golden_name << ": " << diff.describe();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllOperations, PipelineRegressionTest,
+    ::testing::Combine(::testing::ValuesIn(regressionCases()), ::testing::ValuesIn(k_all_paths)),
+    [](const ::testing::TestParamInfo<PipelineRegressionTest::ParamType>& info) {
+        return std::format("{}_{}", std::get<0>(info.param).m_name, magic_enum::enum_name(std::get<1>(info.param)));
+    });
+
+// ============================================================
+// Fused against fallback (no goldens needed)
+// ============================================================
+
+class FusedMatchesFallbackTest : public ::testing::TestWithParam<ExecutionPath> {};
+
+TEST_P(FusedMatchesFallbackTest, ToneEdit)
+{
+    const RegressionCase edit { toneEdit() };
+
+    for (const ReferenceImage& reference : referenceImages()) {
+        SCOPED_TRACE(reference.m_name);
+
+        auto expected_run { prepare(ExecutionPath::Fallback, *reference.m_image, edit.m_operations) };
+        ASSERT_TRUE(expected_run.has_value()) << expected_run.error();
+        ASSERT_TRUE(expected_run->m_executor->execute(*expected_run->m_working));
+        auto expected { expected_run->m_working->exportToCPUCopy() };
+        ASSERT_TRUE(expected.has_value());
+
+        auto run { prepare(GetParam(), *reference.m_image, edit.m_operations) };
+        if (!run) {
+            GTEST_SKIP() << run.error();
+        }
+        ASSERT_TRUE(run->m_executor->execute(*run->m_working));
+        auto output { run->m_working->exportToCPUCopy() };
+        ASSERT_TRUE(output.has_value());
+
+        const ImageDiff diff { compareImages(**output, **expected, toleranceOf(GetParam())) };
+        EXPECT_TRUE(diff.passes(toleranceOf(GetParam()))) << diff.describe();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(FusedPaths, FusedMatchesFallbackTest,
+                         ::testing::Values(ExecutionPath::FusedCpu, ExecutionPath::FusedCpuHalf,
+                                           ExecutionPath::FusedCpuPlanar, ExecutionPath::FusedGpu),
+                         pathName);
+
+// ============================================================
+// Time budgets
+// ============================================================
+
+class PerformanceBudgetTest : public ::testing::TestWithParam<ExecutionPath> {};
+
+TEST_P(PerformanceBudgetTest, ToneEdit12MP)
+{
+    if (perfBudgetScale() == 0.0) {
+        GTEST_SKIP() << "budgets disabled (CAPTUREMOMENT_PERF_BUDGET_SCALE=0)";
+    }
+
+    const auto source { makeGradientImage(4000, 3000) };
+    auto run { prepare(GetParam(), *source, toneEdit().m_operations) };
+    if (!run) {
+        GTEST_SKIP() << run.error();
+    }
+
+    // JIT compilation and first transfers stay out of the measurement
+    ASSERT_TRUE(run->m_executor->execute(*run->m_working)) << "execute failed";
+
+    const auto median { medianMs(5, [&] { return run->m_executor->execute(*run->m_working); }) };
+    ASSERT_TRUE(median.has_value()) << "execute failed";
+
+    const double budget { budgetMsOf(GetParam()) * perfBudgetScale() };
+    RecordProperty("median_ms", std::format("{:.2f}", *median));
+    RecordProperty("budget_ms", std::format("{:.2f}", budget));
+    EXPECT_LE(*median, budget) << "median " << *median << " ms over the " << budget << " ms budget";
+}
+
+INSTANTIATE_TEST_SUITE_P(AllPaths, PerformanceBudgetTest, ::testing::ValuesIn(k_all_paths), pathName);
+
+} // anonymous namespace
+
+} // namespace CaptureMoment::Tests
@@ -0,0 +1,143 @@
+/**
+ * @file quantize_test.cpp
+ * @brief Accuracy, layout and dither tests of the table-driven quantization.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "utils/quantize.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace CaptureMoment::Core::Utils {
+
+namespace {
+
+[[nodiscard]] double exactSrgb(double linear)
+{
+    linear = std::clamp(linear, 0.0, 1.0);
+    return linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+}
+
+/**
+ * @brief A horizontal ramp of `width` pixels, alpha 1.
+ */
+[[nodiscard]] std::vector<float> makeRamp(std::size_t width, std::size_t rows)
+{
+    std::vector<float> pixels(width * rows * 4);
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            float* p { pixels.data() + (y * width + x) * 4 };
+            const float v { static_cast<float>(x) / static_cast<float>(width - 1) };
+            p[0] = v;
+            p[1] = v * 0.5f;
+            p[2] = 1.0f - v;
+            p[3] = 1.0f;
+        }
+    }
+    return pixels;
+}
+
+} // anonymous namespace
+
+TEST(QuantizeTest, EightBitsMatchTheExactCurveWithinOneCode)
+{
+    constexpr std::size_t width { 4096 };
+    const auto pixels { makeRamp(width, 1) };
+    std::vector<std::uint8_t> codes(width * 4);
+
+    quantizeRowsU8(pixels.data(), width * 4, codes.data(), width * 4, width, 1, 4);
+
+    for (std::size_t i = 0; i < width * 4; ++i) {
+        const double expected { (i % 4 == 3) ? 255.0 : std::round(exactSrgb(pixels[i]) * 255.0) };
+        EXPECT_LE(std::abs(codes[i] - expected), 1.0) << "sample " << i;
+    }
+}
+
+TEST(QuantizeTest, SixteenBitsMatchTheExactCurveWithinOneCode)
+{
+    constexpr std::size_t width { 4096 };
+    const auto pixels { makeRamp(width, 1) };
+    std::vector<std::uint16_t> codes(width * 3);
+
+    quantizeRowsU16(pixels.data(), width * 4, codes.data(), width * 3, width, 1, 3);
+
+    for (std::size_t x = 0; x < width; ++x) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            const double expected { std::round(exactSrgb(pixels[x * 4 + c]) * 65535.0) };
+            EXPECT_LE(std::abs(codes[x * 3 + c] - expected), 1.0) << "pixel " << x << " channel " << c;
+        }
+    }
+}
+
+TEST(QuantizeTest, ClampsOutOfRangeAndNaN)
+{
+    const float pixels[8] { -1.0f, 2.0f, std::numeric_limits<float>::quiet_NaN(), 0.5f,
+                            std::numeric_limits<float>::infinity(), 0.0f, 1.0f, 1.5f };
+    std::uint8_t codes[8] {};
+
+    quantizeRowsU8(pixels, 8, codes, 8, 2, 1, 4, { .m_transfer = OutputTransfer::Linear });
+
+    EXPECT_EQ(codes[0], 0);
+    EXPECT_EQ(codes[1], 255);
+    EXPECT_EQ(codes[2], 0);
+    EXPECT_EQ(codes[3], 128);
+    EXPECT_EQ(codes[4], 255);
+    EXPECT_EQ(codes[5], 0);
+    EXPECT_EQ(codes[6], 255);
+    EXPECT_EQ(codes[7], 255);
+}
+
+TEST(QuantizeTest, DitherStaysWithinOneCodeAndKeepsTheMean)
+{
+    // A flat value halfway between two codes: rounding alone would give a single code
+    constexpr std::size_t width { 256 };
+    constexpr std::size_t rows { 64 };
+    const float level { 100.5f / 255.0f };
+    std::vector<float> pixels(width * rows * 4, level);
+    std::vector<std::uint8_t> codes(width * rows * 3);
+
+    for (const DitherMode mode : { DitherMode::Ordered, DitherMode::Noise }) {
+        quantizeRowsU8(pixels.data(), width * 4, codes.data(), width * 3, width, rows, 3,
+                       { .m_transfer = OutputTransfer::Linear, .m_dither = mode });
+
+        double sum { 0.0 };
+        for (const auto code : codes) {
+            EXPECT_TRUE(code == 100 || code == 101);
+            sum += code;
+        }
+        EXPECT_NEAR(sum / static_cast<double>(codes.size()), 100.5, 0.05);
+    }
+}
+
+TEST(QuantizeTest, StripsMatchASinglePass)
+{
+    // Large enough to take the parallel path
+    constexpr std::size_t width { 512 };
+    constexpr std::size_t rows { 256 };
+    const auto pixels { makeRamp(width, rows) };
+    const QuantizeSettings settings { .m_dither = DitherMode::Noise };
+
+    std::vector<std::uint8_t> whole(width * rows * 3);
+    quantizeRowsU8(pixels.data(), width * 4, whole.data(), width * 3, width, rows, 3, settings);
+
+    std::vector<std::uint8_t> strips(width * rows * 3);
+    for (std::size_t y = 0; y < rows; y += 37) {
+        const std::size_t count { std::min<std::size_t>(37, rows - y) };
+        QuantizeSettings strip_settings { settings };
+        strip_settings.m_origin_y = y;
+        quantizeRowsU8(pixels.data() + y * width * 4, width * 4, strips.data() + y * width * 3, width * 3, width,
+                       count, 3, strip_settings);
+    }
+
+    EXPECT_EQ(whole, strips);
+}
+
+} // namespace CaptureMoment::Core::Utils
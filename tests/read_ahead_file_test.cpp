@@ -0,0 +1,63 @@
+/**
+ * @file read_ahead_file_test.cpp
+ * @brief Whole-file reads of ReadAheadFile, across chunk boundaries.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/memory/read_ahead_file.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief Writes `size` pseudo-random bytes to a temporary file and returns them.
+ */
+std::vector<char> writeFile(const std::filesystem::path& path, std::size_t size)
+{
+    std::vector<char> bytes(size);
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::ranges::generate(bytes, [&] { return static_cast<char>(generator()); });
+
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(size));
+    return bytes;
+}
+
+} // namespace
+
+TEST(ReadAheadFileTest, ReadsWholeFilesOfAnySize)
+{
+    const std::filesystem::path path { std::filesystem::temp_directory_path() / "capturemoment_read_ahead_test.bin" };
+
+    // Empty, under one chunk, exactly one chunk, and many chunks with a partial last one
+    for (const std::size_t size : { std::size_t { 0 }, std::size_t { 1 }, ReadAheadFile::k_chunk_bytes,
+                                    ReadAheadFile::k_chunk_bytes * (ReadAheadFile::k_queue_depth + 3) + 12345 }) {
+        const std::vector<char> expected { writeFile(path, size) };
+
+        const auto contents { ReadAheadFile::read(path) };
+        ASSERT_TRUE(contents.has_value()) << size;
+        ASSERT_EQ(contents->bytes().size(), size);
+        EXPECT_TRUE(std::ranges::equal(contents->bytes(), expected,
+                                       [](std::byte a, char b) { return a == static_cast<std::byte>(b); }))
+            << size;
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ReadAheadFileTest, MissingFileIsNotFound)
+{
+    const auto contents { ReadAheadFile::read(std::filesystem::temp_directory_path() / "capturemoment_no_such_file.bin") };
+    ASSERT_FALSE(contents.has_value());
+    EXPECT_EQ(contents.error(), ErrorHandling::CoreError::FileNotFound);
+}
+
+} // namespace CaptureMoment::Core::Common
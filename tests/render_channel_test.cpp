@@ -0,0 +1,126 @@
+/**
+ * @file render_channel_test.cpp
+ * @brief Requests and replies of RenderChannel, their pixels passed in shared memory.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_channel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace CaptureMoment::Core::Export {
+
+#if !defined(_WIN32)
+
+TEST(RenderChannelTest, RequestCarriesItsPixels)
+{
+    auto ends { RenderChannel::pair() };
+    ASSERT_TRUE(ends.has_value());
+    auto& [client, server] { *ends };
+
+    Common::ImageRegion image(Common::PixelBuffer(3 * 2 * 4, 0.25f), 3, 2, static_cast<Common::ImageChan>(4));
+    image.m_data[5] = 0.75f;
+    auto input { SharedImage::share(image) };
+    ASSERT_TRUE(input.has_value());
+
+    RenderRequest request;
+    request.m_edit_blob = std::string("\x01\x00\x02", 3);
+    request.m_max_long_edge = 400;
+    request.m_format = RenderPixelFormat::LinearF32;
+    request.m_dither = Utils::DitherMode::Noise;
+    request.m_input = std::move(*input);
+    ASSERT_TRUE(client.send(request).has_value());
+
+    const auto received { server.receiveRequest() };
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->m_edit_blob, request.m_edit_blob);
+    EXPECT_EQ(received->m_max_long_edge, 400u);
+    EXPECT_EQ(received->m_format, RenderPixelFormat::LinearF32);
+    EXPECT_EQ(received->m_dither, Utils::DitherMode::Noise);
+    ASSERT_TRUE(received->m_input.has_value());
+    EXPECT_EQ(received->m_input->m_width, 3u);
+    EXPECT_EQ(received->m_input->m_height, 2u);
+
+    // The same pages: a write of the sender shows through the receiver's mapping
+    const auto* pixels { reinterpret_cast<const float*>(received->m_input->m_memory.bytes().data()) };
+    EXPECT_FLOAT_EQ(pixels[0], 0.25f);
+    EXPECT_FLOAT_EQ(pixels[5], 0.75f);
+    reinterpret_cast<float*>(request.m_input->m_memory.writableBytes().data())[0] = 0.5f;
+    EXPECT_FLOAT_EQ(pixels[0], 0.5f);
+}
+
+TEST(RenderChannelTest, RepliesCarryTheImageOrTheError)
+{
+    auto ends { RenderChannel::pair() };
+    ASSERT_TRUE(ends.has_value());
+    auto& [client, server] { *ends };
+
+    auto memory { Common::SharedMemory::create(SharedImage::byteSize(4, 4, RenderPixelFormat::Srgb8)) };
+    ASSERT_TRUE(memory.has_value());
+    std::memset(memory->writableBytes().data(), 0x7F, memory->bytes().size());
+
+    // From another thread, as a server replies
+    std::jthread sender([&server, memory = std::move(*memory)]() mutable {
+        (void)server.send(RenderReply { SharedImage { std::move(memory), 4, 4, RenderPixelFormat::Srgb8 } });
+        (void)server.send(RenderReply { std::unexpected(ErrorHandling::CoreError::FileNotFound) });
+    });
+
+    const auto image { client.receiveReply() };
+    ASSERT_TRUE(image.has_value());
+    ASSERT_TRUE(image->m_image.has_value());
+    EXPECT_EQ(image->m_image->m_width, 4u);
+    EXPECT_EQ(image->m_image->m_format, RenderPixelFormat::Srgb8);
+    EXPECT_EQ(image->m_image->m_memory.bytes()[15], std::byte { 0x7F });
+
+    const auto error { client.receiveReply() };
+    ASSERT_TRUE(error.has_value());
+    ASSERT_FALSE(error->m_image.has_value());
+    EXPECT_EQ(error->m_image.error(), ErrorHandling::CoreError::FileNotFound);
+}
+
+TEST(RenderChannelTest, ClosedPeerEndsTheConnection)
+{
+    auto ends { RenderChannel::pair() };
+    ASSERT_TRUE(ends.has_value());
+    {
+        const RenderChannel closed { std::move(ends->first) };
+    }
+    const auto request { ends->second.receiveRequest() };
+    ASSERT_FALSE(request.has_value());
+    EXPECT_EQ(request.error(), ErrorHandling::CoreError::IOError);
+}
+
+TEST(RenderChannelTest, NoServerIsFileNotFound)
+{
+    const auto channel { RenderChannel::connect(std::filesystem::temp_directory_path() / "capturemoment_no_server.sock") };
+    ASSERT_FALSE(channel.has_value());
+    EXPECT_EQ(channel.error(), ErrorHandling::CoreError::FileNotFound);
+}
+
+#if defined(__linux__)
+TEST(RenderChannelTest, ResizableRegionsAreRefused)
+{
+    // A region its sender could truncate under the receiver's mapping
+    const int descriptor { ::memfd_create("unsealed", MFD_CLOEXEC) };
+    ASSERT_GE(descriptor, 0);
+    ASSERT_EQ(::ftruncate(descriptor, 4096), 0);
+
+    const auto memory { Common::SharedMemory::adopt(descriptor, false) };
+    ASSERT_FALSE(memory.has_value());
+    EXPECT_EQ(memory.error(), ErrorHandling::CoreError::InvalidImageRegion);
+}
+#endif
+
+#endif
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,136 @@
+/**
+ * @file render_farm_queue_test.cpp
+ * @brief Submission, exclusive claims, results and stale claims of RenderFarmQueue.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/render_farm_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+/**
+ * @brief A farm queue in a fresh directory, removed with the fixture.
+ */
+class RenderFarmQueueTest : public ::testing::Test {
+protected:
+    void SetUp() override { std::filesystem::remove_all(m_dir); }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    /**
+     * @brief Jobs of files without edits.
+     */
+    [[nodiscard]] static std::vector<ExportJob> jobs(std::size_t count)
+    {
+        std::vector<ExportJob> jobs(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            jobs[i].m_source_path = "/shoot/IMG_" + std::to_string(i) + ".CR3";
+        }
+        return jobs;
+    }
+
+    const std::filesystem::path m_dir { std::filesystem::temp_directory_path() / "capturemoment_farm_test" };
+    RenderFarmQueue m_queue { m_dir };
+};
+
+} // anonymous namespace
+
+TEST_F(RenderFarmQueueTest, EachJobIsClaimedOnce)
+{
+    ExportSettings settings;
+    settings.m_format = ExportFormat::Tiff;
+    settings.m_max_long_edge = 2048;
+    settings.m_output_directory = "/exports";
+    settings.m_renditions = { { "_thumb", ExportFormat::Jpeg, 80, 400 } };
+
+    const auto ids { m_queue.submit(jobs(5), settings) };
+    ASSERT_TRUE(ids.has_value());
+    ASSERT_EQ(ids->size(), 5u);
+
+    const auto first { m_queue.claim("node-a", 3) };
+    const auto second { m_queue.claim("node-b", 3) };
+    EXPECT_EQ(first.size(), 3u);
+    EXPECT_EQ(second.size(), 2u);
+    EXPECT_TRUE(m_queue.claim("node-c", 3).empty());
+
+    std::set<std::string> claimed;
+    for (const auto* batch : { &first, &second }) {
+        for (const FarmJob& job : *batch) {
+            EXPECT_TRUE(claimed.insert(job.m_id).second) << job.m_id;
+            EXPECT_EQ(job.m_settings.m_format, ExportFormat::Tiff);
+            EXPECT_EQ(job.m_settings.m_max_long_edge, 2048u);
+            EXPECT_EQ(job.m_settings.m_output_directory, "/exports");
+            ASSERT_EQ(job.m_settings.m_renditions.size(), 1u);
+            EXPECT_EQ(job.m_settings.m_renditions[0].m_suffix, "_thumb");
+            EXPECT_EQ(job.m_settings.m_renditions[0].m_jpeg_quality, 80);
+            EXPECT_EQ(job.m_settings.m_renditions[0].m_max_long_edge, 400u);
+            EXPECT_FALSE(job.m_edit_blob.empty());
+        }
+    }
+    EXPECT_EQ(claimed, std::set<std::string>(ids->begin(), ids->end()));
+}
+
+TEST_F(RenderFarmQueueTest, ClaimsStopAtThePredictedTime)
+{
+    ASSERT_TRUE(m_queue.submit(jobs(5), {}).has_value());
+
+    // The job reaching the budget is the last one claimed
+    const auto estimate = [](const FarmJob&) { return 10.0; };
+    EXPECT_EQ(m_queue.claim("node-a", 5, estimate, 25.0).size(), 3u);
+    EXPECT_EQ(m_queue.claim("node-b", 5, estimate, 5.0).size(), 1u);
+    EXPECT_EQ(m_queue.claim("node-c", 5).size(), 1u);
+}
+
+TEST_F(RenderFarmQueueTest, WaitCollectsResultsInSubmissionOrder)
+{
+    ExportSettings settings;
+    settings.m_output_directory = "/exports";
+    const auto ids { m_queue.submit(jobs(3), settings) };
+    ASSERT_TRUE(ids.has_value());
+
+    for (const FarmJob& job : m_queue.claim("node-a", 3)) {
+        FarmResult result { job.m_id, job.m_source_path, "/exports/out.jpg", "node-a", {} };
+        if (job.m_id == (*ids)[1]) {
+            result.m_status = std::unexpected(ErrorHandling::CoreError::DecodingError);
+        }
+        ASSERT_TRUE(m_queue.complete(result).has_value());
+    }
+
+    std::size_t reported { 0 };
+    const auto results { m_queue.wait(*ids, [&](std::size_t, const FarmResult&) { ++reported; }) };
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(reported, 3u);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].m_id, (*ids)[i]);
+        EXPECT_EQ(results[i].m_worker, "node-a");
+        EXPECT_EQ(results[i].m_status.has_value(), i != 1);
+    }
+}
+
+TEST_F(RenderFarmQueueTest, StaleClaimsAreRequeued)
+{
+    ASSERT_TRUE(m_queue.submit(jobs(2), {}).has_value());
+    const auto claimed { m_queue.claim("node-a", 2) };
+    ASSERT_EQ(claimed.size(), 2u);
+
+    // One job finished before its worker died: only the other one is rendered again
+    ASSERT_TRUE(m_queue.complete({ claimed[0].m_id, claimed[0].m_source_path, {}, "node-a", {} }).has_value());
+    EXPECT_EQ(m_queue.requeueStale(std::chrono::hours(1)), 0u);
+    EXPECT_EQ(m_queue.requeueStale(std::chrono::seconds(0)), 1u);
+
+    const auto again { m_queue.claim("node-b", 2) };
+    ASSERT_EQ(again.size(), 1u);
+    EXPECT_EQ(again[0].m_id, claimed[1].m_id);
+}
+
+} // namespace CaptureMoment::Core::Export
@@ -0,0 +1,127 @@
+/**
+ * @file result_cache_test.cpp
+ * @brief Key, memory tier and disk tier tests of ResultCache.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "managers/result_cache.h"
+#include "config/app_config.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace CaptureMoment::Core::Managers {
+
+namespace {
+
+[[nodiscard]] ResultCache::Image makeImage(Common::ImageDim width, Common::ImageDim height, std::uint8_t fill)
+{
+    auto image { std::make_shared<Common::DisplayImage>() };
+    image->m_width = width;
+    image->m_height = height;
+    image->m_data.assign(image->bytesPerLine() * height, fill);
+    return image;
+}
+
+[[nodiscard]] Operations::OperationDescriptor makeOperation(std::uint64_t id, Operations::OperationType type, float value)
+{
+    Operations::OperationDescriptor operation;
+    operation.id = id;
+    operation.type = type;
+    operation.name = "Operation";
+    operation.params.set(Operations::ParameterKey::Value, value);
+    return operation;
+}
+
+} // anonymous namespace
+
+TEST(ResultCacheTest, EditHashIgnoresWhatDoesNotChangeThePixels)
+{
+    std::vector<Operations::OperationDescriptor> operations { makeOperation(1, Operations::OperationType::Exposure, 0.5f),
+                                                              makeOperation(2, Operations::OperationType::Contrast, 0.2f) };
+    const auto reference { ResultCache::editHash(operations) };
+
+    auto renamed { operations };
+    renamed[0].id = 7;
+    renamed[0].name = "Renamed";
+    EXPECT_EQ(ResultCache::editHash(renamed), reference);
+
+    auto disabled { operations };
+    disabled.push_back(makeOperation(3, Operations::OperationType::Shadows, 0.9f));
+    disabled.back().enabled = false;
+    EXPECT_EQ(ResultCache::editHash(disabled), reference);
+
+    auto changed { operations };
+    changed[1].params.set(Operations::ParameterKey::Value, 0.3f);
+    EXPECT_NE(ResultCache::editHash(changed), reference);
+
+    const std::vector<Operations::OperationDescriptor> reordered { operations[1], operations[0] };
+    EXPECT_NE(ResultCache::editHash(reordered), reference);
+}
+
+TEST(ResultCacheTest, ProxyResultsOnlyServeProxyRequests)
+{
+    ResultCache cache;
+    const ResultCache::Key key { 1, 2, 8, 8 };
+
+    cache.insert(key, makeImage(8, 8, 10), false);
+    EXPECT_NE(cache.find(key, false), nullptr);
+    EXPECT_EQ(cache.find(key, true), nullptr);
+
+    // A full-resolution result replaces the proxy one, never the reverse
+    cache.insert(key, makeImage(8, 8, 20), true);
+    cache.insert(key, makeImage(8, 8, 30), false);
+    const auto image { cache.find(key, true) };
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->m_data.front(), 20);
+    EXPECT_EQ(cache.sizeBytes(), 8u * 8 * 4);
+}
+
+TEST(ResultCacheTest, EvictsLeastRecentlyUsedWithinTheBudget)
+{
+    ResultCache cache(2 * 8 * 8 * 4);
+    const ResultCache::Key first { 1, 1, 8, 8 };
+    const ResultCache::Key second { 1, 2, 8, 8 };
+    const ResultCache::Key third { 1, 3, 8, 8 };
+
+    cache.insert(first, makeImage(8, 8, 1), true);
+    cache.insert(second, makeImage(8, 8, 2), true);
+    ASSERT_NE(cache.find(first, true), nullptr); // Most recently used
+    cache.insert(third, makeImage(8, 8, 3), true);
+
+    EXPECT_NE(cache.find(first, true), nullptr);
+    EXPECT_EQ(cache.find(second, true), nullptr);
+    EXPECT_NE(cache.find(third, true), nullptr);
+}
+
+TEST(ResultCacheTest, DiskTierRestoresFullResolutionResults)
+{
+    const auto dir { std::filesystem::temp_directory_path() / "capturemoment_result_cache_test" };
+    std::filesystem::remove_all(dir);
+    Config::AppConfig::instance().setResultDiskCacheDirectory(dir);
+
+    const ResultCache::Key key { 3, 4, 6, 5 };
+    {
+        ResultCache writer;
+        writer.storeOnDisk(key, *makeImage(6, 5, 42));
+    }
+
+    ResultCache reader;
+    const auto image { reader.find(key, true) };
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->m_width, 6u);
+    EXPECT_EQ(image->m_height, 5u);
+    EXPECT_EQ(image->m_data.back(), 42);
+
+    // Another state: a miss
+    EXPECT_EQ(reader.find(ResultCache::Key{ 3, 5, 6, 5 }, true), nullptr);
+
+    Config::AppConfig::instance().reset();
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace CaptureMoment::Core::Managers
@@ -0,0 +1,94 @@
+/**
+ * @file sequence_exporter_test.cpp
+ * @brief Keyframe interpolation and deflicker of the sequence export.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "export/sequence_exporter.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace CaptureMoment::Core::Export {
+
+namespace {
+
+[[nodiscard]] SequenceKeyframe makeKeyframe(std::size_t frame, float exposure, int mode)
+{
+    SequenceKeyframe keyframe;
+    keyframe.m_frame = frame;
+    keyframe.m_operations.resize(1);
+    keyframe.m_operations[0].id = 3;
+    keyframe.m_operations[0].type = Operations::OperationType::Exposure;
+    keyframe.m_operations[0].name = "Exposure";
+    keyframe.m_operations[0].params.set(Operations::ParameterKey::Value, exposure);
+    keyframe.m_operations[0].params.set(Operations::ParameterKey::MaskMode, mode);
+    return keyframe;
+}
+
+[[nodiscard]] float exposureOf(const std::vector<Operations::OperationDescriptor>& operations)
+{
+    return operations.front().getParam<float>(Operations::ParameterKey::Value).value_or(-100.0f);
+}
+
+} // anonymous namespace
+
+TEST(SequenceExporterTest, InterpolatesFloatsBetweenKeyframes)
+{
+    const std::vector<SequenceKeyframe> keyframes { makeKeyframe(10, 0.0f, 1), makeKeyframe(20, 2.0f, 2) };
+
+    EXPECT_FLOAT_EQ(exposureOf(SequenceExporter::operationsAt(keyframes, 15)), 1.0f);
+    EXPECT_FLOAT_EQ(exposureOf(SequenceExporter::operationsAt(keyframes, 20)), 2.0f);
+
+    // Before the first and after the last keyframe, its values hold
+    EXPECT_FLOAT_EQ(exposureOf(SequenceExporter::operationsAt(keyframes, 0)), 0.0f);
+    EXPECT_FLOAT_EQ(exposureOf(SequenceExporter::operationsAt(keyframes, 99)), 2.0f);
+
+    // Values that are not floats are held from the earlier keyframe
+    const auto between { SequenceExporter::operationsAt(keyframes, 19) };
+    EXPECT_EQ(between.front().getParam<int>(Operations::ParameterKey::MaskMode).value_or(0), 1);
+    EXPECT_EQ(between.front().id, 3u);
+}
+
+TEST(SequenceExporterTest, DeflickerRemovesFrameToFrameFlicker)
+{
+    // A steady ramp with a flicker on one frame
+    std::vector<float> log_luminance { -4.0f, -4.0f, -4.0f, -3.0f, -4.0f, -4.0f, -4.0f };
+    const auto offsets { SequenceExporter::deflickerOffsets(log_luminance, 7) };
+
+    ASSERT_EQ(offsets.size(), log_luminance.size());
+    EXPECT_LT(offsets[3], -0.5f);
+    EXPECT_GT(offsets[0], -0.2f);
+
+    // A steady sequence is left alone
+    const std::vector<float> steady(9, -2.0f);
+    for (const float offset : SequenceExporter::deflickerOffsets(steady, 5)) {
+        EXPECT_FLOAT_EQ(offset, 0.0f);
+    }
+}
+
+TEST(SequenceExporterTest, DeflickerSkipsUnknownFrames)
+{
+    const float nan { std::numeric_limits<float>::quiet_NaN() };
+    const std::vector<float> log_luminance { -2.0f, nan, -2.0f };
+    const auto offsets { SequenceExporter::deflickerOffsets(log_luminance, 3) };
+
+    EXPECT_FLOAT_EQ(offsets[0], 0.0f);
+    EXPECT_FLOAT_EQ(offsets[1], 0.0f);
+    EXPECT_FLOAT_EQ(offsets[2], 0.0f);
+}
+
+TEST(SequenceExporterTest, MedianLogLuminanceOfAFlatImage)
+{
+    Common::ImageRegion image(Common::PixelBuffer(8 * 8 * 4, 0.25f), 8, 8, static_cast<Common::ImageChan>(4));
+    EXPECT_NEAR(SequenceExporter::medianLogLuminance(image), -2.0f, 0.05f);
+
+    Common::ImageRegion black(Common::PixelBuffer(4 * 4 * 4, 0.0f), 4, 4, static_cast<Common::ImageChan>(4));
+    EXPECT_TRUE(std::isnan(SequenceExporter::medianLogLuminance(black)));
+}
+
+} // namespace CaptureMoment::Core::Export
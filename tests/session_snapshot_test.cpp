@@ -0,0 +1,85 @@
+/**
+ * @file session_snapshot_test.cpp
+ * @brief Round trip and validation of the session files.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "serializer/session_snapshot.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+
+namespace CaptureMoment::Core::Serializer {
+
+namespace {
+
+[[nodiscard]] SessionSnapshot makeSnapshot()
+{
+    SessionSnapshot snapshot;
+    snapshot.m_source_path = "/photos/2026/IMG_0042.CR3";
+    snapshot.m_source_width = 6000;
+    snapshot.m_source_height = 4000;
+    snapshot.m_zoom = 2.5f;
+    snapshot.m_pan_x = -120.0f;
+    snapshot.m_pan_y = 64.5f;
+
+    snapshot.m_operations.resize(1);
+    snapshot.m_operations[0].id = 7;
+    snapshot.m_operations[0].type = Operations::OperationType::Exposure;
+    snapshot.m_operations[0].name = "Exposure";
+    snapshot.m_operations[0].params.set(Operations::ParameterKey::Value, 0.5f);
+
+    // The file stores the preview bytes as given
+    snapshot.m_preview_jpeg = { std::byte { 0xFF }, std::byte { 0xD8 }, std::byte { 0x42 } };
+    return snapshot;
+}
+
+} // anonymous namespace
+
+TEST(SessionSnapshotTest, RoundTripsTheSession)
+{
+    const auto path { std::filesystem::temp_directory_path() / "capturemoment_session_test" / "session.cmsession" };
+    std::filesystem::remove_all(path.parent_path());
+
+    const SessionSnapshot snapshot { makeSnapshot() };
+    ASSERT_TRUE(snapshot.save(path).has_value());
+
+    const auto loaded { SessionSnapshot::load(path) };
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->m_source_path, snapshot.m_source_path);
+    EXPECT_EQ(loaded->m_source_width, 6000u);
+    EXPECT_EQ(loaded->m_source_height, 4000u);
+    EXPECT_EQ(loaded->m_zoom, 2.5f);
+    EXPECT_EQ(loaded->m_pan_x, -120.0f);
+    EXPECT_EQ(loaded->m_pan_y, 64.5f);
+    EXPECT_EQ(loaded->m_preview_jpeg, snapshot.m_preview_jpeg);
+    ASSERT_EQ(loaded->m_operations.size(), 1u);
+    EXPECT_EQ(loaded->m_operations[0].type, Operations::OperationType::Exposure);
+    EXPECT_EQ(loaded->m_operations[0].getParam<float>(Operations::ParameterKey::Value), 0.5f);
+
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(SessionSnapshotTest, RejectsTruncatedAndForeignFiles)
+{
+    const auto dir { std::filesystem::temp_directory_path() / "capturemoment_session_test" };
+    std::filesystem::remove_all(dir);
+
+    EXPECT_EQ(SessionSnapshot::load(dir / "missing.cmsession").error(), ErrorHandling::CoreError::FileNotFound);
+
+    const auto path { dir / "session.cmsession" };
+    ASSERT_TRUE(makeSnapshot().save(path).has_value());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_EQ(SessionSnapshot::load(path).error(), ErrorHandling::CoreError::DecodingError);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a session file at all, but long enough for a header";
+    EXPECT_EQ(SessionSnapshot::load(path).error(), ErrorHandling::CoreError::UnsupportedFormat);
+
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace CaptureMoment::Core::Serializer
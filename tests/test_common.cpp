@@ -0,0 +1,234 @@
+/**
+ * @file test_common.cpp
+ * @brief Implementation of the shared test fixtures.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "test_common.h"
+
+#include <OpenImageIO/imagebuf.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <limits>
+
+namespace CaptureMoment::Tests {
+
+namespace {
+
+/**
+ * @brief Size of the reference images: small enough for the goldens to live in the tree.
+ */
+constexpr Core::Common::ImageDim k_reference_width { 256 };
+constexpr Core::Common::ImageDim k_reference_height { 192 };
+
+/**
+ * @brief Creates the patch chart: 8 x 6 flat patches covering the tonal and colour extremes.
+ */
+std::unique_ptr<Core::Common::ImageRegion> makePatchImage(Core::Common::ImageDim width, Core::Common::ImageDim height)
+{
+    // Near-black, shadows, midtones, near-white, highlights above 1.0, saturated primaries
+    constexpr std::array<std::array<float, 3>, 12> k_patches { {
+        { 0.0f, 0.0f, 0.0f },   { 0.002f, 0.002f, 0.002f }, { 0.02f, 0.02f, 0.02f }, { 0.18f, 0.18f, 0.18f },
+        { 0.5f, 0.5f, 0.5f },   { 0.9f, 0.9f, 0.9f },       { 1.0f, 1.0f, 1.0f },    { 1.8f, 1.6f, 1.4f },
+        { 0.8f, 0.05f, 0.05f }, { 0.05f, 0.8f, 0.05f },     { 0.05f, 0.05f, 0.8f },  { 0.9f, 0.7f, 0.1f },
+    } };
+
+    Core::Common::PixelBuffer data(width * height * 4);
+    float* pixel { data.data() };
+    for (Core::Common::ImageDim y = 0; y < height; ++y) {
+        for (Core::Common::ImageDim x = 0; x < width; ++x) {
+            const std::size_t patch { (y * 6 / height) * 8 + (x * 8 / width) };
+            const auto& colour { k_patches[patch % k_patches.size()] };
+            pixel[0] = colour[0];
+            pixel[1] = colour[1];
+            pixel[2] = colour[2];
+            pixel[3] = 1.0f;
+            pixel += 4;
+        }
+    }
+
+    return std::make_unique<Core::Common::ImageRegion>(std::move(data), width, height, 4);
+}
+
+} // anonymous namespace
+
+const std::vector<ReferenceImage>& referenceImages()
+{
+    static const std::vector<ReferenceImage> images {
+        { "gradient", makeGradientImage(k_reference_width, k_reference_height) },
+        { "patches", makePatchImage(k_reference_width, k_reference_height) },
+    };
+    return images;
+}
+
+std::unique_ptr<Core::Common::ImageRegion> makeGradientImage(Core::Common::ImageDim width,
+                                                             Core::Common::ImageDim height)
+{
+    Core::Common::PixelBuffer data(width * height * 4);
+
+    // Horizontal ramp over 0..2 (highlights above 1.0), vertical tint, slow ripple for texture
+    float* pixel { data.data() };
+    for (Core::Common::ImageDim y = 0; y < height; ++y) {
+        const float v { static_cast<float>(y) / static_cast<float>(height) };
+        for (Core::Common::ImageDim x = 0; x < width; ++x) {
+            const float u { static_cast<float>(x) / static_cast<float>(width) };
+            const float ripple { 0.05f * std::sin(static_cast<float>(x + y) * 0.01f) };
+            pixel[0] = 2.0f * u * u + ripple;
+            pixel[1] = 2.0f * u * (0.5f + 0.5f * v);
+            pixel[2] = 2.0f * u * (1.0f - 0.5f * v) - ripple;
+            pixel[3] = 1.0f;
+            pixel += 4;
+        }
+    }
+
+    return std::make_unique<Core::Common::ImageRegion>(std::move(data), width, height, 4);
+}
+
+std::string ImageDiff::describe() const
+{
+    if (m_shape_mismatch) {
+        return "image shapes differ";
+    }
+
+    std::string text { std::format("max |error| {:.6f}, mean |error| {:.6f}, {} samples out of tolerance",
+                                   m_max_absolute, m_mean_absolute, m_failing_samples) };
+    if (m_first_failure) {
+        const auto& [x, y, c] { *m_first_failure };
+        text += std::format(" (first at x={} y={} c={})", x, y, c);
+    }
+    return text;
+}
+
+ImageDiff compareImages(const Core::Common::ImageRegion& actual,
+                        const Core::Common::ImageRegion& expected,
+                        const Tolerance& tolerance)
+{
+    ImageDiff diff;
+    if (actual.m_width != expected.m_width || actual.m_height != expected.m_height
+        || actual.m_channels != expected.m_channels || actual.m_data.size() != expected.m_data.size()) {
+        diff.m_shape_mismatch = true;
+        return diff;
+    }
+
+    double error_sum { 0.0 };
+    for (std::size_t i = 0; i < expected.m_data.size(); ++i) {
+        const float reference { expected.m_data[i] };
+        // NaN never compares within tolerance
+        const float error { std::isnan(actual.m_data[i]) ? std::numeric_limits<float>::infinity()
+                                                         : std::abs(actual.m_data[i] - reference) };
+
+        diff.m_max_absolute = std::max(diff.m_max_absolute, error);
+        error_sum += error;
+
+        if (!(error <= tolerance.m_absolute + tolerance.m_relative * std::abs(reference))) {
+            if (diff.m_failing_samples++ == 0) {
+                const std::size_t pixel { i / expected.m_channels };
+                diff.m_first_failure = std::array<std::size_t, 3>{ pixel % expected.m_width, pixel / expected.m_width,
+                                                                   i % expected.m_channels };
+            }
+        }
+    }
+    diff.m_mean_absolute = expected.m_data.empty() ? 0.0 : error_sum / static_cast<double>(expected.m_data.size());
+
+    return diff;
+}
+
+std::filesystem::path goldenDirectory()
+{
+    if (const char* directory = std::getenv("CAPTUREMOMENT_GOLDEN_DIR"); directory && *directory) {
+        return directory;
+    }
+    return CAPTUREMOMENT_GOLDEN_DIR;
+}
+
+bool updateGoldens()
+{
+    const char* update { std::getenv("CAPTUREMOMENT_UPDATE_GOLDENS") };
+    return update && std::string_view(update) == "1";
+}
+
+std::optional<Core::Common::ImageRegion> loadGolden(std::string_view name)
+{
+    const auto path { goldenDirectory() / std::format("{}.exr", name) };
+    if (!std::filesystem::exists(path)) {
+        return std::nullopt;
+    }
+
+    OIIO::ImageBuf golden(path.string());
+    if (!golden.read(0, 0, true, OIIO::TypeDesc::FLOAT)) {
+        spdlog::error("[loadGolden]: Cannot read '{}': {}", path.string(), golden.geterror());
+        return std::nullopt;
+    }
+
+    const OIIO::ImageSpec& spec { golden.spec() };
+    Core::Common::PixelBuffer data(static_cast<std::size_t>(spec.width) * spec.height * spec.nchannels);
+    if (!golden.get_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, data.data())) {
+        spdlog::error("[loadGolden]: Cannot get the pixels of '{}': {}", path.string(), golden.geterror());
+        return std::nullopt;
+    }
+
+    return Core::Common::ImageRegion(std::move(data), static_cast<Core::Common::ImageDim>(spec.width),
+                                     static_cast<Core::Common::ImageDim>(spec.height),
+                                     static_cast<Core::Common::ImageChan>(spec.nchannels));
+}
+
+bool saveGolden(std::string_view name, const Core::Common::ImageRegion& image)
+{
+    std::error_code error;
+    std::filesystem::create_directories(goldenDirectory(), error);
+
+    const auto path { goldenDirectory() / std::format("{}.exr", name) };
+
+    OIIO::ImageSpec spec(static_cast<int>(image.m_width), static_cast<int>(image.m_height),
+                         static_cast<int>(image.m_channels), OIIO::TypeDesc::FLOAT);
+    spec.attribute("compression", "zip");
+
+    OIIO::ImageBuf golden(spec);
+    if (!golden.set_pixels(OIIO::ROI::All(), OIIO::TypeDesc::FLOAT, image.m_data.data()) || !golden.write(path.string())) {
+        spdlog::error("[saveGolden]: Cannot write '{}': {}", path.string(), golden.geterror());
+        return false;
+    }
+    return true;
+}
+
+double perfBudgetScale()
+{
+    static const double scale = [] {
+        const char* value { std::getenv("CAPTUREMOMENT_PERF_BUDGET_SCALE") };
+        if (!value || !*value) {
+            return 1.0;
+        }
+        char* end { nullptr };
+        const double parsed { std::strtod(value, &end) };
+        return (end != value && parsed >= 0.0) ? parsed : 1.0;
+    }();
+    return scale;
+}
+
+std::optional<double> medianMs(int runs, const std::function<bool()>& body)
+{
+    std::vector<double> durations;
+    durations.reserve(static_cast<std::size_t>(runs));
+
+    for (int run = 0; run < runs; ++run) {
+        const auto begin { std::chrono::steady_clock::now() };
+        if (!body()) {
+            return std::nullopt;
+        }
+        durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    }
+
+    if (durations.empty()) {
+        return std::nullopt;
+    }
+    std::ranges::nth_element(durations, durations.begin() + static_cast<std::ptrdiff_t>(durations.size() / 2));
+    return durations[durations.size() / 2];
+}
+
+} // namespace CaptureMoment::Tests
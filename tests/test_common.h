@@ -0,0 +1,122 @@
+/**
+ * @file test_common.h
+ * @brief Shared fixtures of the test suite (reference images, image comparison, goldens, time budgets).
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#pragma once
+
+#include "common/image_region.h"
+
+#include <array>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CaptureMoment::Tests {
+
+/**
+ * @brief A named synthetic input of the regression cases.
+ */
+struct ReferenceImage {
+    std::string m_name;
+    std::shared_ptr<const Core::Common::ImageRegion> m_image;
+};
+
+/**
+ * @brief The reference inputs: a smooth gradient (0..2, highlights above 1.0) and a patch
+ *        chart (saturated colours, near-black, near-white, out of range).
+ * @details Deterministic: the same pixels on every machine, so goldens can be shared.
+ */
+[[nodiscard]] const std::vector<ReferenceImage>& referenceImages();
+
+/**
+ * @brief Creates a linear RGBA_F32 gradient (the benchmark pattern).
+ */
+[[nodiscard]] std::unique_ptr<Core::Common::ImageRegion> makeGradientImage(Core::Common::ImageDim width,
+                                                                           Core::Common::ImageDim height);
+
+/**
+ * @brief Per-sample tolerance: `|actual - expected| <= m_absolute + m_relative * |expected|`.
+ */
+struct Tolerance {
+    float m_absolute { 0.0f };
+    float m_relative { 0.0f };
+    /** @brief Bound on the mean absolute error (catches small systematic shifts). */
+    float m_mean_absolute { 0.0f };
+};
+
+/**
+ * @brief Result of comparing two images.
+ */
+struct ImageDiff {
+    /** @brief Set when the sizes or channel counts differ (the errors are then meaningless). */
+    bool m_shape_mismatch { false };
+    float m_max_absolute { 0.0f };
+    double m_mean_absolute { 0.0 };
+    /** @brief Samples outside the per-sample tolerance. */
+    std::size_t m_failing_samples { 0 };
+    /** @brief First failing sample (x, y, channel), for the report. */
+    std::optional<std::array<std::size_t, 3>> m_first_failure;
+
+    /**
+     * @brief Whether the images match within @p tolerance.
+     */
+    [[nodiscard]] bool passes(const Tolerance& tolerance) const noexcept
+    {
+        return !m_shape_mismatch && m_failing_samples == 0 && m_mean_absolute <= tolerance.m_mean_absolute;
+    }
+
+    /**
+     * @brief One-line summary for the failure message.
+     */
+    [[nodiscard]] std::string describe() const;
+};
+
+/**
+ * @brief Compares @p actual against @p expected sample by sample.
+ */
+[[nodiscard]] ImageDiff compareImages(const Core::Common::ImageRegion& actual,
+                                      const Core::Common::ImageRegion& expected,
+                                      const Tolerance& tolerance);
+
+/**
+ * @brief Directory of the golden images (`tests/golden`, or `CAPTUREMOMENT_GOLDEN_DIR`).
+ */
+[[nodiscard]] std::filesystem::path goldenDirectory();
+
+/**
+ * @brief Whether the run rewrites the goldens (`CAPTUREMOMENT_UPDATE_GOLDENS=1`).
+ */
+[[nodiscard]] bool updateGoldens();
+
+/**
+ * @brief Loads a golden image (float OpenEXR).
+ * @return The image, or `std::nullopt` if the file does not exist or cannot be read.
+ */
+[[nodiscard]] std::optional<Core::Common::ImageRegion> loadGolden(std::string_view name);
+
+/**
+ * @brief Writes a golden image (float OpenEXR, lossless).
+ * @return false if the file cannot be written.
+ */
+[[nodiscard]] bool saveGolden(std::string_view name, const Core::Common::ImageRegion& image);
+
+/**
+ * @brief Scale of the time budgets (`CAPTUREMOMENT_PERF_BUDGET_SCALE`, default 1).
+ * @details Raise it on slow or shared machines; 0 disables the budget checks.
+ */
+[[nodiscard]] double perfBudgetScale();
+
+/**
+ * @brief Median wall time of @p runs calls of @p body, in milliseconds.
+ * @details Stops early and returns `std::nullopt` as soon as one call fails.
+ */
+[[nodiscard]] std::optional<double> medianMs(int runs, const std::function<bool()>& body);
+
+} // namespace CaptureMoment::Tests
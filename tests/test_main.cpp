@@ -0,0 +1,22 @@
+/**
+ * @file test_main.cpp
+ * @brief Entry point of the test suite: core initialization, then GoogleTest.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "core_initialization.h"
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // Backends, Halide targets and working image factories, as the application does at startup
+    CaptureMoment::Core::initialize();
+    spdlog::set_level(spdlog::level::warn);
+
+    return RUN_ALL_TESTS();
+}
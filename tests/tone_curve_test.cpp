@@ -0,0 +1,96 @@
+/**
+ * @file tone_curve_test.cpp
+ * @brief Parsing and baking tests of the ToneCurve tables.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "operations/basic_adjustment_operations/tone_curve.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace CaptureMoment::Core::Operations {
+
+namespace {
+
+[[nodiscard]] OperationDescriptor curveDescriptor()
+{
+    OperationDescriptor descriptor;
+    descriptor.type = OperationType::ToneCurve;
+    descriptor.name = "ToneCurve";
+    descriptor.enabled = true;
+    return descriptor;
+}
+
+[[nodiscard]] std::vector<float> bakeTable(const OperationDescriptor& descriptor)
+{
+    std::vector<float> table(ToneCurve::k_table_size);
+    ToneCurve::bake(descriptor, table);
+    return table;
+}
+
+} // anonymous namespace
+
+TEST(ToneCurveTest, ParsesSortsAndFormatsPoints)
+{
+    const auto points { ToneCurve::parsePoints(" 1,1; 0,0 ;0.5,0.6;") };
+    ASSERT_TRUE(points.has_value());
+    ASSERT_EQ(points->size(), 3u);
+    EXPECT_EQ(points->at(1), (ToneCurve::Point{ 0.5f, 0.6f }));
+
+    const auto round_trip { ToneCurve::parsePoints(ToneCurve::formatPoints(*points)) };
+    ASSERT_TRUE(round_trip.has_value());
+    EXPECT_EQ(*round_trip, *points);
+
+    EXPECT_FALSE(ToneCurve::parsePoints("0,0;0.5").has_value());
+    EXPECT_FALSE(ToneCurve::parsePoints("0,0;a,b").has_value());
+}
+
+TEST(ToneCurveTest, BakesTheIdentityWithoutParameters)
+{
+    const auto descriptor { curveDescriptor() };
+    EXPECT_TRUE(ToneCurve::isIdentity(descriptor));
+
+    const auto table { bakeTable(descriptor) };
+    for (int i = 0; i < ToneCurve::k_table_size; ++i) {
+        EXPECT_FLOAT_EQ(table[i], static_cast<float>(i) / (ToneCurve::k_table_size - 1));
+    }
+}
+
+TEST(ToneCurveTest, PointCurveIsMonotoneAndPassesThroughItsPoints)
+{
+    auto descriptor { curveDescriptor() };
+    descriptor.setParam(ParameterKey::CurvePoints, std::string("0,0;0.25,0.1;0.5,0.5;0.75,0.95;1,1"));
+    EXPECT_FALSE(ToneCurve::isIdentity(descriptor));
+
+    const auto table { bakeTable(descriptor) };
+    for (int i = 1; i < ToneCurve::k_table_size; ++i) {
+        EXPECT_GE(table[i], table[i - 1]) << "at entry " << i;
+    }
+    const int last { ToneCurve::k_table_size - 1 };
+    EXPECT_NEAR(table[0], 0.0f, 1.0e-6f);
+    EXPECT_NEAR(table[last / 2], 0.5f, 2.0e-3f);
+    EXPECT_NEAR(table[last], 1.0f, 1.0e-6f);
+}
+
+TEST(ToneCurveTest, ParametricRegionsKeepTheEndPoints)
+{
+    auto descriptor { curveDescriptor() };
+    descriptor.setParam(ParameterKey::CurveShadows, 1.0f);
+    descriptor.setParam(ParameterKey::CurveHighlights, -1.0f);
+
+    const auto table { bakeTable(descriptor) };
+    const int last { ToneCurve::k_table_size - 1 };
+    EXPECT_FLOAT_EQ(table[0], 0.0f);
+    EXPECT_FLOAT_EQ(table[last], 1.0f);
+    EXPECT_GT(table[last / 8], 0.125f + 0.5f * ToneCurve::k_region_gain); // Shadows lifted
+    EXPECT_LT(table[7 * last / 8], 0.875f - 0.5f * ToneCurve::k_region_gain); // Highlights lowered
+    for (int i = 1; i < ToneCurve::k_table_size; ++i) {
+        EXPECT_GE(table[i], table[i - 1]) << "at entry " << i;
+    }
+}
+
+} // namespace CaptureMoment::Core::Operations
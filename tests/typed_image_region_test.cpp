@@ -0,0 +1,102 @@
+/**
+ * @file typed_image_region_test.cpp
+ * @brief Element conversions, layouts and sizes of the typed image regions.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "common/typed_image_region.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+namespace CaptureMoment::Core::Common {
+
+namespace {
+
+/**
+ * @brief A 3x2 RGBA float region whose elements encode their position.
+ */
+[[nodiscard]] ImageRegion makeGradient()
+{
+    PixelBuffer data(3 * 2 * 4);
+    ImageRegion region(5, 7, std::move(data), 3, 2, 4);
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 3; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                region(y, x, c) = static_cast<float>(y * 12 + x * 4 + c) / 23.0f;
+            }
+        }
+    }
+    return region;
+}
+
+} // anonymous namespace
+
+TEST(TypedImageRegionTest, HalfRoundTripsAndRoundsToNearestEven)
+{
+    for (const float value : { 0.0f, -0.0f, 1.0f, -2.5f, 0.333251953125f, 65504.0f, 6.103515625e-05f, 5.9604645e-08f }) {
+        EXPECT_EQ(Half::fromFloat(value).toFloat(), value) << value;
+    }
+
+    EXPECT_EQ(Half::fromFloat(1.0f).m_bits, 0x3C00u);
+    // 1 + 2^-11 is halfway between 1 and the next half: ties to the even 1
+    EXPECT_EQ(Half::fromFloat(1.0f + 0.00048828125f).m_bits, 0x3C00u);
+    EXPECT_EQ(Half::fromFloat(65520.0f).toFloat(), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(Half::fromFloat(1e-9f).toFloat(), 0.0f);
+    EXPECT_TRUE(std::isnan(Half::fromFloat(std::numeric_limits<float>::quiet_NaN()).toFloat()));
+}
+
+TEST(TypedImageRegionTest, IntegersAreNormalizedClampedAndRounded)
+{
+    EXPECT_EQ(PixelTraits<std::uint8_t>::fromFloat(1.0f), 255);
+    EXPECT_EQ(PixelTraits<std::uint8_t>::fromFloat(0.5f), 128);
+    EXPECT_EQ(PixelTraits<std::uint8_t>::fromFloat(-0.2f), 0);
+    EXPECT_EQ(PixelTraits<std::uint8_t>::fromFloat(3.0f), 255);
+    EXPECT_EQ(PixelTraits<std::uint8_t>::fromFloat(std::numeric_limits<float>::quiet_NaN()), 0);
+    EXPECT_EQ(PixelTraits<std::uint16_t>::fromFloat(1.0f), 65535);
+    EXPECT_FLOAT_EQ(PixelTraits<std::uint16_t>::toFloat(65535), 1.0f);
+}
+
+TEST(TypedImageRegionTest, ConversionsKeepPositionAndShrinkTheBuffer)
+{
+    const ImageRegion source { makeGradient() };
+
+    const ImageRegionU8 bytes { convertImage<std::uint8_t>(source) };
+    ASSERT_TRUE(bytes.isValid());
+    EXPECT_EQ(bytes.x(), 5);
+    EXPECT_EQ(bytes.y(), 7);
+    EXPECT_EQ(bytes.sizeInBytes() * 4, source.sizeInBytes());
+
+    const ImageRegion back { toImageRegion(bytes) };
+    ASSERT_TRUE(back.isValid());
+    for (std::size_t i = 0; i < source.getDataSize(); ++i) {
+        EXPECT_NEAR(back.m_data[i], source.m_data[i], 0.5f / 255.0f);
+    }
+}
+
+TEST(TypedImageRegionTest, PlanarLayoutStoresOnePlanePerChannel)
+{
+    const ImageRegion source { makeGradient() };
+
+    auto planar { convertImage<float, PixelLayout::Planar>(source) };
+    ASSERT_TRUE(planar.isValid());
+
+    for (int c = 0; c < 4; ++c) {
+        const auto plane { planar.plane(c) };
+        ASSERT_EQ(plane.size(), 6u);
+        for (int y = 0; y < 2; ++y) {
+            for (int x = 0; x < 3; ++x) {
+                EXPECT_EQ(plane[static_cast<std::size_t>(y) * 3 + x], source(y, x, c));
+            }
+        }
+    }
+
+    // And back to interleaved halves, through the generic path
+    const ImageRegionF16 halves { convertImage<Half>(planar) };
+    EXPECT_NEAR(halves(1, 2, 3).toFloat(), source(1, 2, 3), 1e-3f);
+}
+
+} // namespace CaptureMoment::Core::Common
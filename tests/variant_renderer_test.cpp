@@ -0,0 +1,81 @@
+/**
+ * @file variant_renderer_test.cpp
+ * @brief Parameter snapshots rendered by VariantRenderer.
+ * @author CaptureMoment Team
+ * @date 2026
+ */
+
+#include "pipeline/variant_renderer.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace CaptureMoment::Core::Pipeline {
+
+namespace {
+
+using Operations::OperationDescriptor;
+using Operations::OperationType;
+using Operations::ParameterKey;
+using Operations::ParameterSnapshot;
+
+[[nodiscard]] Common::ImageRegion grayImage(Common::ImageDim width, Common::ImageDim height, float level)
+{
+    Common::ImageRegion image{Common::PixelBuffer(static_cast<std::size_t>(width) * height * 4, level), width, height, 4};
+    for (std::size_t i = 3; i < image.m_data.size(); i += 4) {
+        image.m_data[i] = 1.0f;
+    }
+    return image;
+}
+
+[[nodiscard]] ParameterSnapshot brightness(float value)
+{
+    ParameterSnapshot snapshot;
+    snapshot.set(OperationType::Brightness, value);
+    return snapshot;
+}
+
+} // anonymous namespace
+
+TEST(VariantRendererTest, RendersEachSnapshotInOrder)
+{
+    OperationDescriptor descriptor;
+    descriptor.id = 1;
+    descriptor.type = OperationType::Brightness;
+    descriptor.setParam(ParameterKey::Value, 0.0f);
+    const std::array operations{descriptor};
+
+    // The neutral first variant leaves the operation out of the chain: the next ones add it back
+    const std::array variants{brightness(0.0f), brightness(0.25f), brightness(0.5f)};
+
+    VariantRenderer renderer;
+    const auto rendered = renderer.render(grayImage(16, 8, 0.25f), operations, variants);
+    ASSERT_TRUE(rendered.has_value());
+    ASSERT_EQ(rendered->size(), variants.size());
+
+    const std::array expected{0.25f, 0.5f, 0.75f};
+    for (std::size_t k = 0; k < variants.size(); ++k) {
+        const Common::ImageRegion& image = (*rendered)[k];
+        ASSERT_EQ(image.m_width, 16u);
+        ASSERT_EQ(image.m_height, 8u);
+        EXPECT_NEAR(image.m_data[0], expected[k], 1.0e-5f) << "variant " << k;
+        EXPECT_NEAR(image.m_data[image.m_data.size() - 2], expected[k], 1.0e-5f) << "variant " << k;
+        EXPECT_FLOAT_EQ(image.m_data[3], 1.0f) << "variant " << k;
+    }
+}
+
+TEST(VariantRendererTest, ReducesToTheLongEdge)
+{
+    const std::array variants{brightness(0.1f)};
+    VariantRenderer renderer;
+    const auto rendered = renderer.render(grayImage(400, 200, 0.5f), {}, variants, 100);
+    ASSERT_TRUE(rendered.has_value());
+    ASSERT_EQ(rendered->size(), 1u);
+    EXPECT_EQ(rendered->front().m_width, 100u);
+    EXPECT_EQ(rendered->front().m_height, 50u);
+}
+
+} // namespace CaptureMoment::Core::Pipeline